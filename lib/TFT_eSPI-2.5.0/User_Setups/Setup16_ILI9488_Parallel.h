@@ -24,6 +24,17 @@
 #define TFT_D6   27
 #define TFT_D7   14
 
+// XPT2046 touch controller wiring (not used by TFT_eSPI):
+// TFT_eSPI does not support touch in parallel mode, so TOUCH_CS is deliberately
+// not defined here. The touch controller sits on its own HSPI bus and is driven
+// by src/manager/touch_manager.cpp using the TOUCH_*_PIN constants in src/config/config.h.
+//   T_CS   -> 21
+//   T_IRQ  -> 34  (input only, no internal pull-up: relies on the module's pull-up)
+//   T_CLK  -> 5
+//   T_DO   -> 19  (MISO)
+//   T_DIN  -> 23  (MOSI)
+// Touch is disabled by default; set "touch.enabled" in data/config.json once wired.
+
 
 #define LOAD_GLCD   // Font 1. Original Adafruit 8 pixel font needs ~1820 bytes in FLASH
 #define LOAD_FONT2  // Font 2. Small 16 pixel high font, needs ~3534 bytes in FLASH, 96 characters
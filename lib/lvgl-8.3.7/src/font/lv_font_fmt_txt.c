@@ -189,6 +189,34 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+/**
+ * Get the glyph id of a letter in a font of LittlevGL's native font format.
+ * @param font pointer to font
+ * @param letter a UNICODE letter code
+ * @return the glyph id or 0 if the letter was not found
+ */
+uint32_t lv_font_get_glyph_id_fmt_txt(const lv_font_t * font, uint32_t letter)
+{
+    return get_glyph_dsc_id(font, letter);
+}
+
+#if LV_USE_FONT_COMPRESSED
+/**
+ * Decompress the bitmap of a glyph of a compressed font into a caller-provided buffer.
+ * @param in the compressed bitmap of the glyph
+ * @param out buffer for `box_w * box_h` pixels (3 bpp glyphs are decompressed to 4 bpp)
+ * @param w width of the glyph's bounding box
+ * @param h height of the glyph's bounding box
+ * @param bpp bit per pixel of the font
+ * @param prefilter true: the bitmap format is `LV_FONT_FMT_TXT_COMPRESSED` (the lines are XORed)
+ */
+void lv_font_decompress_fmt_txt(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord_t h, uint8_t bpp,
+                                bool prefilter)
+{
+    decompress(in, out, w, h, bpp, prefilter);
+}
+#endif /*LV_USE_FONT_COMPRESSED*/
+
 /**
  * Free the allocated memories.
  */
@@ -212,6 +240,12 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
+    /*Use the direct lookup table if there is one*/
+    if(fdsc->cmap_index && letter < (uint32_t)fdsc->cmap_index->page_num * LV_FONT_FMT_TXT_CMAP_INDEX_PAGE_SIZE) {
+        const uint16_t * page = fdsc->cmap_index->pages[letter / LV_FONT_FMT_TXT_CMAP_INDEX_PAGE_SIZE];
+        return page ? page[letter % LV_FONT_FMT_TXT_CMAP_INDEX_PAGE_SIZE] : 0;
+    }
+
     /*Check the cache first*/
     if(fdsc->cache && letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
 
@@ -220,7 +254,7 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
         /*Relative code point*/
         uint32_t rcp = letter - fdsc->cmaps[i].range_start;
-        if(rcp > fdsc->cmaps[i].range_length) continue;
+        if(rcp >= fdsc->cmaps[i].range_length) continue;
         uint32_t glyph_id = 0;
         if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
             glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
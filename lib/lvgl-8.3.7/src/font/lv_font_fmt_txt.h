@@ -156,6 +156,19 @@ typedef struct {
     uint32_t last_glyph_id;
 } lv_font_fmt_txt_glyph_cache_t;
 
+/*Number of code points in a page of `lv_font_fmt_txt_cmap_index_t`*/
+#define LV_FONT_FMT_TXT_CMAP_INDEX_PAGE_SIZE 256
+
+/**
+ * Direct lookup table from code points to glyph ids, built at run time for fonts with many glyphs.
+ * The glyph id of `letter` is `pages[letter / 256][letter % 256]`, pages without glyphs are NULL.
+ * Code points from `page_num * 256` are still searched in the cmaps.
+ */
+typedef struct {
+    const uint16_t * const * pages;
+    uint16_t page_num;
+} lv_font_fmt_txt_cmap_index_t;
+
 /*Describe store additional data for fonts*/
 typedef struct {
     /*The bitmaps of all glyphs*/
@@ -195,6 +208,9 @@ typedef struct {
 
     /*Cache the last letter and is glyph id*/
     lv_font_fmt_txt_glyph_cache_t * cache;
+
+    /*Optional direct lookup table of the cmaps, NULL to search the cmaps*/
+    const lv_font_fmt_txt_cmap_index_t * cmap_index;
 } lv_font_fmt_txt_dsc_t;
 
 /**********************
@@ -220,6 +236,30 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t lett
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Get the glyph id of a letter in a font of LittlevGL's native font format.
+ * Can be used by custom `get_glyph_bitmap` callbacks which fetch the bitmaps from somewhere else.
+ * @param font pointer to font
+ * @param letter a UNICODE letter code
+ * @return the glyph id or 0 if the letter was not found
+ */
+uint32_t lv_font_get_glyph_id_fmt_txt(const lv_font_t * font, uint32_t letter);
+
+#if LV_USE_FONT_COMPRESSED
+/**
+ * Decompress the bitmap of a glyph of a compressed font into a caller-provided buffer.
+ * Can be used by custom `get_glyph_bitmap` callbacks which keep the decompressed bitmaps.
+ * @param in the compressed bitmap of the glyph
+ * @param out buffer for `box_w * box_h` pixels (3 bpp glyphs are decompressed to 4 bpp)
+ * @param w width of the glyph's bounding box
+ * @param h height of the glyph's bounding box
+ * @param bpp bit per pixel of the font
+ * @param prefilter true: the bitmap format is `LV_FONT_FMT_TXT_COMPRESSED` (the lines are XORed)
+ */
+void lv_font_decompress_fmt_txt(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord_t h, uint8_t bpp,
+                                bool prefilter);
+#endif /*LV_USE_FONT_COMPRESSED*/
+
 /**
  * Free the allocated memories.
  */
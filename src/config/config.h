@@ -3,8 +3,9 @@
 // 引入必要的头文件
 #include <Arduino.h>
 #include "lvgl.h"
-// 字体定义 - 方便后续更换字体
-#define GBFont &lvgl_font_song_16
+// 中文字体 - 方便后续更换字体（SPIFFS中有/fonts/song16.bin时优先使用，其次是资源分区中的song16），
+// 映射资源分区后在initDisplayDriver中解析一次，之前为编译进固件的字体
+extern const lv_font_t* GBFont;
 // 软件版本定义
 #define SOFTWARE_VERSION "0.1.2"
 // NTP服务器配置
@@ -32,6 +33,12 @@ enum ButtonEvent {
 const int BUTTON_PIN = 18; // 按键连接到引脚18
 const int LIGHT_SENSOR_PIN = 35; // 光线传感器引脚
 const int SCREEN_BRIGHTNESS_PIN = 22; // 屏幕亮度控制引脚
+// XPT2046触摸控制器引脚：屏幕使用8位并口，触摸控制器单独接一组SPI引脚（接线见TFT_eSPI的User_Setups/Setup16_ILI9488_Parallel.h）
+const int TOUCH_CS_PIN = 21;   // 触摸片选
+const int TOUCH_IRQ_PIN = 34;  // 触摸中断（PENIRQ，按下时为低电平）
+const int TOUCH_SCLK_PIN = 5;  // 触摸SPI时钟
+const int TOUCH_MISO_PIN = 19; // 触摸SPI数据输入
+const int TOUCH_MOSI_PIN = 23; // 触摸SPI数据输出
 // 屏幕配置
 const uint32_t screenWidth = 320;
 const uint32_t screenHeight = 480;
@@ -41,8 +48,18 @@ const unsigned long SHORT_PRESS_THRESHOLD = 200; // 短按阈值(毫秒)
 const unsigned long LONG_PRESS_THRESHOLD = 1000; // 长按阈值(毫秒)
 const unsigned long MULTI_CLICK_THRESHOLD = 300; // 多击检测时间窗口(毫秒)
 extern const char* ntpServer; // NTP服务器地址（声明）
+extern TaskHandle_t webConfigTaskHandle; // 主程序创建的Web配置服务任务（声明）
+extern TaskHandle_t mainDataTaskHandle;  // 主程序创建的数据处理任务（声明）
 const long updateInterval = 15; // 更新间隔（秒）
+const unsigned long SCREEN_PREPARE_DELAY = 1000; // 换屏后延迟多久开始预先准备下一个屏幕（毫秒）
 const long brightnessUpdateInterval = 200; // 亮度更新间隔（毫秒）
+// 任务栈大小（字节）：显示任务运行LVGL绘制、轮廓字体光栅化和各图像解码器，
+// 数据任务与DataManager的任务一样执行HTTPS请求和图像导入，Web任务处理WebSocket握手和JSON序列化
+const uint32_t DISPLAY_TASK_STACK_SIZE = 10240;
+const uint32_t WEB_CONFIG_TASK_STACK_SIZE = 6144;
+const uint32_t DATA_TASK_STACK_SIZE = 8192;
+// 任务栈最低剩余量的报警阈值（字节），性能测试结果中低于该值时提示加大栈
+const uint32_t TASK_STACK_MIN_FREE = 1024;
 // 声明全局变量
 extern const char* MaoSelect[];
 extern const int MaoSelectCount;
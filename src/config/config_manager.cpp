@@ -130,6 +130,128 @@ int ConfigManager::getNTPServerTimezone() {
     return 8; // 默认东八区
 }
 
+/**
+ * 将"HH:MM"格式的时间转换为当天的分钟数，格式错误时返回-1
+ */
+static int parseTimeOfDay(const char* text) {
+    int hour = 0;
+    int minute = 0;
+    if (text == nullptr || sscanf(text, "%d:%d", &hour, &minute) != 2 ||
+        hour < 0 || hour > 23 || minute < 0 || minute > 59) {
+        return -1;
+    }
+    return hour * 60 + minute;
+}
+
+/**
+ * 读取夜间模式配置
+ * night.enabled、night.dark_threshold、night.light_threshold、night.dark_delay（秒）、
+ * night.start和night.end（"HH:MM"，两者都有效时才按时间段休眠）
+ */
+void ConfigManager::getNightModeConfig(NightModeConfig& nightConfig) {
+    nightConfig.enabled = true;
+    nightConfig.darkThreshold = 100;
+    nightConfig.lightThreshold = 300;
+    nightConfig.darkDelay = 60;
+    nightConfig.startMinute = -1;
+    nightConfig.endMinute = -1;
+    if (!configLoaded || !configDoc.containsKey("night")) {
+        return;
+    }
+    
+    JsonObject nightObj = configDoc["night"];
+    nightConfig.enabled = nightObj["enabled"] | nightConfig.enabled;
+    nightConfig.darkThreshold = nightObj["dark_threshold"] | nightConfig.darkThreshold;
+    nightConfig.lightThreshold = nightObj["light_threshold"] | nightConfig.lightThreshold;
+    nightConfig.darkDelay = nightObj["dark_delay"] | nightConfig.darkDelay;
+    int startMinute = parseTimeOfDay(nightObj["start"] | (const char*)nullptr);
+    int endMinute = parseTimeOfDay(nightObj["end"] | (const char*)nullptr);
+    if (startMinute >= 0 && endMinute >= 0 && startMinute != endMinute) {
+        nightConfig.startMinute = startMinute;
+        nightConfig.endMinute = endMinute;
+    }
+    if (nightConfig.lightThreshold <= nightConfig.darkThreshold) {
+        nightConfig.lightThreshold = nightConfig.darkThreshold + 1;
+    }
+}
+
+// 读取触摸屏配置
+void ConfigManager::getTouchConfig(TouchConfig& touchConfig) {
+    // 默认值为常见3.2寸XPT2046模块在竖屏方向下的读数范围；没有接触摸屏时悬空的PENIRQ会引起误触发，默认关闭
+    touchConfig.enabled = false;
+    touchConfig.pressureThreshold = 400;
+    touchConfig.calibration.xMin = 300;
+    touchConfig.calibration.xMax = 3800;
+    touchConfig.calibration.yMin = 250;
+    touchConfig.calibration.yMax = 3850;
+    touchConfig.calibration.swapXY = false;
+    if (!configLoaded || !configDoc.containsKey("touch")) {
+        return;
+    }
+    
+    JsonObject touchObj = configDoc["touch"];
+    touchConfig.enabled = touchObj["enabled"] | touchConfig.enabled;
+    touchConfig.pressureThreshold = touchObj["pressure_threshold"] | touchConfig.pressureThreshold;
+    TouchCalibration& cal = touchConfig.calibration;
+    cal.xMin = touchObj["x_min"] | cal.xMin;
+    cal.xMax = touchObj["x_max"] | cal.xMax;
+    cal.yMin = touchObj["y_min"] | cal.yMin;
+    cal.yMax = touchObj["y_max"] | cal.yMax;
+    cal.swapXY = touchObj["swap_xy"] | cal.swapXY;
+}
+
+// 读取数据接口的地址
+String ConfigManager::getApiUrl(const char* name, const char* defaultUrl) {
+    if (!configLoaded || !configDoc.containsKey("api")) {
+        return defaultUrl;
+    }
+    
+    JsonObject apiObj = configDoc["api"];
+    const char* url = apiObj[name] | defaultUrl;
+    return url;
+}
+
+// 读取远程图像导入配置
+void ConfigManager::getImageIngestConfig(ImageIngestConfig& ingestConfig) {
+    ingestConfig.enabled = true;
+    ingestConfig.compress = false;
+    if (!configLoaded || !configDoc.containsKey("ingest")) {
+        return;
+    }
+    
+    JsonObject ingestObj = configDoc["ingest"];
+    ingestConfig.enabled = ingestObj["enabled"] | ingestConfig.enabled;
+    ingestConfig.compress = ingestObj["compress"] | ingestConfig.compress;
+}
+
+// 保存触摸屏校准参数
+bool ConfigManager::setTouchCalibration(const TouchCalibration& calibration) {
+    if (!configLoaded) {
+        return false;
+    }
+    
+    configDoc["touch"]["x_min"] = calibration.xMin;
+    configDoc["touch"]["x_max"] = calibration.xMax;
+    configDoc["touch"]["y_min"] = calibration.yMin;
+    configDoc["touch"]["y_max"] = calibration.yMax;
+    configDoc["touch"]["swap_xy"] = calibration.swapXY;
+    
+    return saveConfigToFile();
+}
+
+// 读取屏幕对象堆内存预算
+uint32_t ConfigManager::getScreenHeapBudget(uint32_t defaultBudget) {
+    if (!configLoaded || !configDoc.containsKey("ui")) {
+        return defaultBudget;
+    }
+    
+    JsonObject uiObj = configDoc["ui"];
+    if (uiObj.containsKey("heap_budget")) {
+        return uiObj["heap_budget"].as<uint32_t>();
+    }
+    
+    return defaultBudget;
+}
 
 // 设置NTP时区配置
 bool ConfigManager::setNTPServerTimezone(int timezone) {
@@ -4,6 +4,30 @@
 #include <Arduino.h>
 #include <SPIFFS.h>
 #include <ArduinoJson.h>
+#include "manager/touch_gesture.h"
+
+// 夜间模式配置
+struct NightModeConfig {
+    bool enabled;            // 是否启用夜间模式
+    int darkThreshold;       // 光线传感器读数低于该值视为环境变暗
+    int lightThreshold;      // 读数高于该值视为环境变亮（大于darkThreshold，避免在临界亮度反复切换）
+    uint32_t darkDelay;      // 持续变暗多久后进入休眠（秒）
+    int startMinute;         // 夜间时间段开始（当天的分钟数，-1表示不使用时间段）
+    int endMinute;           // 夜间时间段结束（当天的分钟数）
+};
+
+// 触摸屏配置
+struct TouchConfig {
+    bool enabled;                  // 是否启用触摸屏
+    uint16_t pressureThreshold;    // 压力读数低于该值视为未按下
+    TouchCalibration calibration;  // 校准参数
+};
+
+// 远程图像导入配置
+struct ImageIngestConfig {
+    bool enabled;            // 是否下载每日一句的分享图片（fenxiang_img）
+    bool compress;           // 是否按行游程编码保存（否则保存RGB565原始数据，显示时无需任何解码）
+};
 
 // 配置管理类，负责统一处理所有配置的读取和保存
 class ConfigManager {
@@ -40,6 +64,24 @@ public:
     
     // 设置NTP时区配置
     bool setNTPServerTimezone(int timezone);
+
+    // 读取屏幕对象堆内存预算（ui.heap_budget），未配置时返回默认值
+    uint32_t getScreenHeapBudget(uint32_t defaultBudget);
+
+    // 读取夜间模式配置（night），未配置的项使用默认值
+    void getNightModeConfig(NightModeConfig& nightConfig);
+
+    // 读取触摸屏配置（touch），未配置的项使用默认值
+    void getTouchConfig(TouchConfig& touchConfig);
+
+    // 保存触摸屏校准参数
+    bool setTouchCalibration(const TouchCalibration& calibration);
+
+    // 读取数据接口的地址（api.<名称>），未配置时返回默认地址（可指向本地的模拟服务器）
+    String getApiUrl(const char* name, const char* defaultUrl);
+
+    // 读取远程图像导入配置（ingest），未配置的项使用默认值
+    void getImageIngestConfig(ImageIngestConfig& ingestConfig);
     
     // 检查配置是否已加载
     bool isConfigLoaded();
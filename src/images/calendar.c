@@ -1,3 +1,4 @@
+/* 由tools/image_converter.py生成，请勿手工修改：按行游程编码的RGB565图像，由RleImage解码器在绘制时逐行解压 */
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -12,6 +13,9 @@
     #include "lvgl/lvgl.h"
 #endif
 
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP != 0
+#error "calendar.c只包含RGB565数据（LV_COLOR_DEPTH = 16，LV_COLOR_16_SWAP = 0），其他色深请重新转换"
+#endif
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -22,506 +26,474 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_CALENDAR uint8_t calendar_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x10, 0x3a, 0x19, 0x1a, 0x3a, 0x1a, 0x3e, 0x5e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x59, 0x75, 0x71, 0x4d, 0x55, 0x9a, 0x75, 0x4c, 0x91, 0x55, 0x39, 0x1c, 0x1c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x75, 0x71, 0x4d, 0x71, 0x96, 0xb6, 0x96, 0x96, 0xdf, 0xf6, 0xa0, 0xc0, 0x63, 0x0b, 0x73, 0x9a, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x51, 0x2c, 0x35, 0x76, 0x96, 0x96, 0x76, 0x96, 0xdf, 0xba, 0x90, 0x92, 0xbb, 0xd7, 0xeb, 0xca, 0xb7, 0xdb, 0xff, 0xbb, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x75, 0x96, 0x71, 0x71, 0x96, 0xbb, 0x16, 0x1b, 0x9a, 0xdb, 0xbb, 0x97, 0xdb, 0xdf, 0xb7, 0xdb, 0xff, 0xdf, 0xbb, 0x72, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x4d, 0x4d, 0x31, 0x56, 0x7b, 0x56, 0x56, 0x96, 0xdb, 0xbb, 0x37, 0x37, 0x76, 0xb6, 0xbb, 0xff, 0xdb, 0x72, 0x72, 0x96, 0x72, 0x0d, 0x0d, 0x12, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x31, 0x35, 0x5a, 0x1b, 0x56, 0x56, 0x71, 0x71, 0x97, 0x5b, 0x12, 0x56, 0x52, 0x96, 0x97, 0xdb, 0xff, 0xdf, 0x96, 0x72, 0x76, 0x12, 0x12, 0x52, 0x71, 0x51, 0x31, 0x16, 0x12, 0x00, 0x09, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x75, 0x51, 0x51, 0x56, 0x3f, 0x56, 0x36, 0x36, 0x96, 0xbb, 0xb7, 0x53, 0x77, 0xbb, 0xdb, 0xbb, 0xbb, 0x9b, 0x32, 0x12, 0x2d, 0x72, 0x56, 0x72, 0x96, 0xba, 0x76, 0x51, 0x12, 0x09, 0x21, 0xa9, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x4d, 0x4d, 0x51, 0x55, 0x55, 0x5a, 0x51, 0x72, 0x96, 0xbb, 0x76, 0x52, 0x16, 0x52, 0xbb, 0xbb, 0xdf, 0xdf, 0xbb, 0x96, 0x52, 0x12, 0x12, 0x11, 0x32, 0x96, 0x96, 0x96, 0xdb, 0xbb, 0x96, 0x52, 0x4d, 0x11, 0x2d, 0x2a, 0x64, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x35, 0x1e, 0x31, 0x75, 0x91, 0x71, 0x92, 0x96, 0x7a, 0x36, 0x1b, 0x1f, 0xbb, 0xdb, 0x9b, 0x97, 0xbb, 0xdb, 0xbb, 0x96, 0x96, 0x56, 0x16, 0x11, 0x51, 0x76, 0x56, 0x9b, 0xbb, 0xdb, 0x9a, 0x76, 0xba, 0x76, 0x96, 0x52, 0x6d, 0x48, 0x16, 0x1b, 0x0e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x96, 0x96, 0x71, 0x4d, 0x75, 0x92, 0xb6, 0x71, 0x56, 0x96, 0xb7, 0xbb, 0x57, 0x1b, 0x5b, 0x97, 0xbb, 0xb7, 0xbb, 0xba, 0x76, 0x55, 0x51, 0x52, 0x36, 0x76, 0x96, 0x9a, 0x9a, 0x5a, 0xbb, 0xbb, 0x96, 0x7a, 0x5a, 0xba, 0xbb, 0xbb, 0x72, 0x6d, 0x61, 0x0e, 0x1b, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x71, 0x4d, 0x2c, 0x75, 0x95, 0xb6, 0x71, 0x92, 0xb2, 0xd6, 0xad, 0x6d, 0x51, 0x30, 0x96, 0x96, 0xb7, 0xbb, 0xdb, 0xba, 0x96, 0x76, 0x76, 0x36, 0x35, 0x56, 0x76, 0x96, 0x5a, 0x9a, 0xdb, 0xdb, 0x9a, 0x1a, 0x9a, 0x96, 0x76, 0x7a, 0x1a, 0x9a, 0xbb, 0x52, 0x51, 0x55, 0x2d, 0x08, 0x0a, 0x0e, 0x0e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x11, 0x35, 0x35, 0x95, 0x95, 0x92, 0x92, 0x92, 0xb7, 0x92, 0x89, 0xa9, 0xd2, 0xd2, 0xd2, 0xc1, 0xce, 0xd7, 0xb6, 0xb7, 0xb6, 0xba, 0x99, 0x75, 0x55, 0x56, 0x76, 0x5a, 0xba, 0xdb, 0xdb, 0x9a, 0x35, 0x9a, 0x76, 0x51, 0x96, 0x1a, 0x9a, 0xdf, 0xbb, 0x5a, 0x3a, 0x1a, 0x15, 0x0d, 0x55, 0x59, 0x2d, 0x30, 0x09, 0x09, 0x0f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x71, 0x71, 0x6d, 0x4d, 0x91, 0xb2, 0x92, 0x8e, 0xb2, 0xd7, 0xdb, 0xd2, 0xc0, 0xc0, 0xc9, 0xd2, 0xd7, 0xf7, 0xf7, 0xd6, 0x95, 0x51, 0x51, 0x7a, 0x5a, 0x76, 0x76, 0x9a, 0x9a, 0x55, 0xba, 0xba, 0xb6, 0x9a, 0x35, 0x9a, 0xbf, 0xbb, 0x9a, 0x39, 0x5a, 0x5a, 0x3a, 0x3a, 0x3a, 0x3a, 0x35, 0x2d, 0x55, 0x5a, 0x2d, 0x16, 0x1b, 0x0e, 0x09, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x75, 0x95, 0x55, 0x75, 0x91, 0x92, 0xdb, 0xcd, 0xe8, 0xe0, 0xee, 0xb2, 0xd7, 0xf2, 0xf7, 0xf7, 0xd2, 0xb2, 0xb5, 0x75, 0x19, 0x39, 0x55, 0x76, 0x7a, 0x9a, 0xbb, 0xdb, 0xdb, 0x7a, 0x55, 0x9a, 0x72, 0x72, 0x96, 0x59, 0x59, 0xbf, 0x9a, 0x59, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x31, 0x4d, 0x5a, 0x5a, 0x4d, 0x1a, 0x1f, 0x1b, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x59, 0x95, 0xad, 0x8d, 0xb6, 0x96, 0x91, 0xb0, 0x8d, 0xd7, 0xd7, 0xf6, 0xf0, 0xee, 0xce, 0xb6, 0xb7, 0xf7, 0xf2, 0xed, 0xac, 0x71, 0x59, 0x59, 0x96, 0xba, 0xba, 0xba, 0x79, 0x79, 0xb6, 0x96, 0x96, 0x7a, 0x55, 0x9a, 0xdb, 0xba, 0x79, 0x59, 0x55, 0x35, 0x39, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x32, 0x51, 0x5a, 0x5a, 0x31, 0x99, 0xbd, 0x7f, 0x11, 0x08, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x75, 0x91, 0x8d, 0xad, 0xc8, 0xa4, 0xa9, 0xd2, 0xd1, 0xe4, 0xec, 0xc4, 0xc9, 0xd2, 0xf7, 0xff, 0xff, 0xf7, 0xad, 0xad, 0xec, 0xe8, 0xcc, 0xb1, 0x76, 0xb6, 0x75, 0xb6, 0xba, 0xda, 0xba, 0x59, 0x79, 0x9a, 0x76, 0xb6, 0x76, 0x55, 0x79, 0x79, 0x59, 0x59, 0x59, 0x55, 0x59, 0x5a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x2e, 0x55, 0x5a, 0x5a, 0x35, 0xac, 0xfc, 0xdc, 0x78, 0x04, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xf1, 0xf1, 0xac, 0x64, 0x41, 0x60, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0xc0, 0xee, 0xf7, 0xfb, 0xd7, 0xd6, 0xf6, 0xcd, 0xe0, 0xac, 0x91, 0xb1, 0xb1, 0xd6, 0xda, 0xda, 0xba, 0x54, 0xba, 0x96, 0x51, 0x96, 0x79, 0x55, 0xba, 0xba, 0x9a, 0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x59, 0x5a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x37, 0x2f, 0x55, 0x5a, 0x5a, 0x55, 0x84, 0xec, 0xfc, 0xd8, 0x04, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xc8, 0xe4, 0xe4, 0xe0, 0xc0, 0xa5, 0xa8, 0x88, 0xa8, 0xa0, 0xa9, 0xce, 0xf7, 0xff, 0xfb, 0xf2, 0xad, 0xac, 0xb0, 0xac, 0xd1, 0xb2, 0x96, 0x95, 0x74, 0xb6, 0xd6, 0xd6, 0x95, 0x54, 0x95, 0xbb, 0xb6, 0xb6, 0x75, 0x59, 0x59, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x37, 0x52, 0x59, 0x5a, 0x5a, 0x5a, 0x6d, 0xe0, 0xec, 0xf0, 0x44, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xb1, 0x51, 0xa9, 0xe0, 0xe4, 0xe4, 0xe4, 0xc5, 0xaa, 0xce, 0xd2, 0xd2, 0xd2, 0xe9, 0xe0, 0xe0, 0xb1, 0x91, 0x95, 0x95, 0xda, 0xda, 0xda, 0x99, 0x74, 0xb6, 0x71, 0x4c, 0x91, 0x78, 0x75, 0xba, 0x9a, 0x75, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x36, 0x51, 0x5a, 0x5a, 0x5a, 0x5a, 0x4d, 0xa0, 0xe0, 0xe0, 0x48, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xc8, 0x51, 0x0d, 0xc5, 0xe8, 0xc0, 0xca, 0xce, 0xce, 0xc9, 0xc8, 0xa8, 0xa4, 0xe8, 0xd1, 0xb6, 0xb5, 0xd9, 0x95, 0x95, 0xb6, 0xb6, 0xb1, 0x95, 0x74, 0xba, 0xb6, 0xb5, 0xb5, 0x78, 0x74, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x32, 0x55, 0x7a, 0x7a, 0x5a, 0x5a, 0x51, 0x80, 0xa0, 0xc0, 0x68, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x89, 0x8c, 0x71, 0x71, 0xe4, 0xe0, 0xa0, 0xe9, 0xe8, 0xa0, 0xc1, 0xc6, 0xa6, 0x8c, 0x94, 0x91, 0xd6, 0xda, 0xb6, 0x94, 0x95, 0xb6, 0x6d, 0x8d, 0x91, 0x98, 0x99, 0xb9, 0x98, 0x98, 0x98, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x3a, 0x3a, 0x36, 0x32, 0x5a, 0x79, 0x75, 0x5a, 0x5a, 0x55, 0x60, 0x80, 0x84, 0x2c, 0x10, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x44, 0x2c, 0x54, 0xad, 0xc8, 0xa8, 0x69, 0xe9, 0xea, 0xc7, 0xc7, 0xa7, 0x82, 0x6c, 0x98, 0x91, 0x91, 0x91, 0xcd, 0x94, 0x74, 0xda, 0xd6, 0xb6, 0x94, 0x98, 0x98, 0x98, 0x98, 0x98, 0x74, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x3a, 0x16, 0x52, 0x5a, 0x7a, 0x75, 0x5a, 0x5a, 0x55, 0x49, 0x80, 0x68, 0x0c, 0x10, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x4a, 0x25, 0x71, 0x92, 0xb1, 0xd0, 0xac, 0xa0, 0xa7, 0xcb, 0xab, 0xa7, 0x60, 0x90, 0x98, 0x95, 0x92, 0x8d, 0xcd, 0xb5, 0x94, 0x95, 0x95, 0x94, 0x94, 0x98, 0x98, 0x98, 0xb8, 0x98, 0x74, 0x55, 0x55, 0x75, 0x55, 0x55, 0x55, 0x55, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x35, 0x5a, 0x3a, 0x11, 0x51, 0x5a, 0x5a, 0x7a, 0x5a, 0x5a, 0x59, 0x4d, 0x61, 0x48, 0x0c, 0x0c, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x87, 0xa2, 0xc5, 0xd0, 0xb1, 0xd1, 0x8e, 0x86, 0x61, 0xa7, 0xab, 0x86, 0x60, 0x94, 0x98, 0xb5, 0xd7, 0xd6, 0xb5, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x98, 0x98, 0x98, 0xb8, 0x94, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x55, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x3a, 0x5a, 0x3a, 0x31, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x51, 0x41, 0x4c, 0x10, 0x08, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xd1, 0xc4, 0xe8, 0xc8, 0xac, 0x91, 0xd2, 0x93, 0x8a, 0x61, 0x81, 0xa6, 0x81, 0x64, 0x94, 0x98, 0x98, 0xb5, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x98, 0x98, 0x98, 0x98, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x55, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x35, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x36, 0x51, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x7a, 0x7a, 0x51, 0x49, 0x2c, 0x10, 0x08, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xb1, 0xc4, 0xe9, 0xc5, 0xb1, 0x91, 0xe9, 0xe9, 0x80, 0x60, 0xa2, 0xa2, 0x60, 0x68, 0x94, 0x98, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xb4, 0xb4, 0x98, 0x98, 0x94, 0x74, 0x74, 0x74, 0x74, 0x74, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x35, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x3a, 0x55, 0x51, 0x59, 0x5a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x55, 0x29, 0x10, 0x10, 0x08, 0x0c, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x74, 0xa9, 0x82, 0xa6, 0x91, 0x75, 0xe4, 0xc0, 0xc4, 0xc4, 0x81, 0xa5, 0x70, 0x54, 0x78, 0x94, 0x94, 0xb4, 0xb4, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xb4, 0x94, 0x94, 0x98, 0x94, 0x74, 0x74, 0x74, 0x75, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x35, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x3a, 0x55, 0x55, 0x5a, 0x7a, 0x5a, 0x79, 0x95, 0x7a, 0x7a, 0x55, 0x2d, 0x0d, 0x10, 0x0c, 0x0c, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x34, 0x91, 0xa9, 0xd5, 0x74, 0x55, 0xc8, 0xc5, 0xc5, 0xc4, 0xe0, 0xa8, 0x34, 0x58, 0x78, 0x74, 0x74, 0x94, 0xb4, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x74, 0x74, 0x74, 0x75, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x3a, 0x51, 0x55, 0x5a, 0x7a, 0x7a, 0x7a, 0x75, 0x79, 0x7a, 0x55, 0x2d, 0x0d, 0x0d, 0x0c, 0x29, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x15, 0x55, 0xf5, 0xd4, 0x35, 0x51, 0xad, 0xe5, 0xe5, 0xe1, 0xe1, 0x44, 0x34, 0x58, 0x78, 0x78, 0x74, 0x74, 0x94, 0x94, 0xb4, 0xb4, 0xb4, 0x94, 0x94, 0x94, 0x94, 0xb4, 0x94, 0x74, 0x74, 0x79, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x3a, 0x35, 0x51, 0x59, 0x7a, 0x7a, 0x7a, 0x7a, 0x91, 0x79, 0x7a, 0x79, 0x4d, 0x0d, 0x0e, 0x0a, 0x26, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x38, 0x1e, 0x1f, 0x97, 0xb0, 0x55, 0x71, 0xad, 0xc4, 0xc1, 0xa3, 0x81, 0x00, 0x54, 0x58, 0x59, 0x58, 0x78, 0x74, 0x74, 0x74, 0x94, 0x94, 0xb4, 0xb4, 0x94, 0xb4, 0xb4, 0xb4, 0x94, 0x74, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x56, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x3a, 0x51, 0x51, 0x59, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x7a, 0x79, 0x51, 0x2a, 0x0b, 0x0b, 0x06, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x1e, 0x7a, 0x92, 0x4e, 0x71, 0x55, 0x71, 0x8d, 0xa4, 0xc2, 0x82, 0x20, 0x60, 0xb0, 0x58, 0x59, 0x59, 0x58, 0x78, 0x74, 0x74, 0x74, 0x74, 0x94, 0xb4, 0xb8, 0xb8, 0xb4, 0x94, 0x75, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x51, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x51, 0x2b, 0x07, 0x0b, 0x46, 0x4c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x9a, 0xd5, 0xb0, 0x95, 0x35, 0x55, 0x6e, 0x72, 0x69, 0xe1, 0xe0, 0x60, 0xec, 0xf0, 0x78, 0x59, 0x59, 0x59, 0x78, 0x74, 0x74, 0x74, 0x74, 0x74, 0x94, 0x94, 0xb8, 0xb8, 0x99, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x55, 0x55, 0x79, 0x7a, 0x99, 0x99, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x55, 0x4a, 0x23, 0x07, 0x61, 0x4c, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xd5, 0xb4, 0xb8, 0x94, 0x54, 0x71, 0x6d, 0x8d, 0x8d, 0xa0, 0xe0, 0xec, 0xf4, 0xf0, 0x98, 0x59, 0x59, 0x79, 0x79, 0x78, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x98, 0x99, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x55, 0x59, 0x79, 0x7a, 0x99, 0xb9, 0x79, 0x79, 0x7a, 0x7a, 0x79, 0x75, 0x49, 0x42, 0x22, 0x44, 0x31, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xe0, 0xac, 0xd8, 0xd8, 0x54, 0x6c, 0x8c, 0x88, 0x6d, 0x88, 0xe8, 0xe8, 0xec, 0xf0, 0xb4, 0x59, 0x59, 0x79, 0x79, 0x79, 0x78, 0x74, 0x74, 0x74, 0x75, 0x79, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x55, 0x59, 0x79, 0x79, 0x79, 0x99, 0x79, 0x79, 0x7a, 0x79, 0x7a, 0x79, 0x4d, 0x61, 0x61, 0x49, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x08, 0xc1, 0xc1, 0x80, 0x8d, 0x70, 0x6c, 0x8c, 0x68, 0x6d, 0xc9, 0xe8, 0xe4, 0xe0, 0xe0, 0xb1, 0x59, 0x59, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x55, 0x55, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x55, 0x59, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x79, 0x99, 0x95, 0x79, 0x7a, 0x4e, 0x62, 0x80, 0x4d, 0x0d, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x04, 0x81, 0xc3, 0xa7, 0xad, 0x70, 0x6c, 0x6c, 0x6c, 0x6d, 0xad, 0xe8, 0xe4, 0xe1, 0xc1, 0xce, 0x79, 0x79, 0x79, 0x79, 0x79, 0x59, 0x59, 0x59, 0x59, 0x55, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x55, 0x59, 0x79, 0x79, 0x79, 0x79, 0x99, 0x9a, 0x95, 0x95, 0x95, 0x99, 0x7a, 0x52, 0x66, 0x84, 0x51, 0x11, 0x11, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x05, 0x02, 0xa3, 0xc7, 0xb1, 0x90, 0x6c, 0x6c, 0x6c, 0x6d, 0x8d, 0xd2, 0xf7, 0xe1, 0xe0, 0xc4, 0x78, 0x79, 0x79, 0x79, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x75, 0x59, 0x79, 0x79, 0x79, 0x79, 0x99, 0x9a, 0x99, 0x95, 0x95, 0x99, 0x7a, 0x75, 0x69, 0x88, 0x15, 0x15, 0x10, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x05, 0x01, 0x8d, 0x8d, 0x95, 0x90, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x76, 0x92, 0xc0, 0xe0, 0xc0, 0x74, 0x79, 0x79, 0x59, 0x59, 0x39, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x79, 0x59, 0x55, 0x55, 0x79, 0x79, 0x7a, 0x79, 0x95, 0x95, 0x95, 0x79, 0x79, 0x6d, 0x6c, 0x15, 0x16, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x08, 0x04, 0x08, 0x70, 0x74, 0x54, 0x70, 0x6c, 0x6c, 0x6c, 0x6c, 0x8c, 0x76, 0x52, 0x04, 0x84, 0x80, 0x70, 0x59, 0x59, 0x39, 0x39, 0x59, 0x39, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x39, 0x59, 0x79, 0x79, 0x55, 0x55, 0x55, 0x79, 0x79, 0x7a, 0x79, 0x99, 0x79, 0x79, 0x79, 0x79, 0x6d, 0x51, 0x1b, 0x1f, 0x1f, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x30, 0x14, 0x4c, 0x74, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0xb4, 0xd4, 0x56, 0x36, 0x28, 0x08, 0x08, 0x2d, 0x39, 0x39, 0x39, 0x39, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5e, 0x5a, 0x35, 0x39, 0x59, 0x79, 0x79, 0x79, 0x55, 0x51, 0x79, 0x79, 0x99, 0x79, 0x79, 0x79, 0x99, 0xba, 0x99, 0x51, 0x3f, 0x1f, 0x1f, 0x1f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x50, 0x10, 0x14, 0x30, 0x54, 0x74, 0x6c, 0x6c, 0x6c, 0xb4, 0xf8, 0xf8, 0x74, 0x3a, 0x0d, 0x08, 0x08, 0x0e, 0x3a, 0x39, 0x39, 0x59, 0x59, 0x59, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x35, 0x31, 0x35, 0x59, 0x79, 0x79, 0x79, 0x75, 0x75, 0x79, 0x79, 0x99, 0x99, 0x79, 0x9a, 0x9a, 0xba, 0x99, 0x54, 0x1f, 0x1f, 0x1f, 0x1f, 0x11, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x7c, 0x15, 0x3a, 0x59, 0x54, 0x70, 0x6c, 0x6c, 0xb4, 0xf8, 0xf8, 0xf8, 0x70, 0x12, 0x12, 0x08, 0x04, 0x17, 0x3a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x35, 0x35, 0x55, 0x35, 0x59, 0x7d, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x99, 0x99, 0x9a, 0x99, 0x99, 0x79, 0x79, 0x75, 0x16, 0x1f, 0x1f, 0x1b, 0x11, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x19, 0x19, 0x3a, 0x55, 0x74, 0x70, 0x6c, 0xb4, 0xf8, 0xf8, 0xf8, 0xf8, 0x94, 0x0c, 0x12, 0x0d, 0x09, 0x1f, 0x3b, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x59, 0x59, 0x5a, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5e, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x55, 0x35, 0x35, 0x79, 0x7d, 0x79, 0x79, 0x79, 0x79, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x95, 0x99, 0x79, 0x30, 0x1a, 0x1f, 0x17, 0x0c, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x35, 0x11, 0x34, 0x2c, 0x70, 0x74, 0x4c, 0xd4, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x95, 0x0c, 0x0c, 0x09, 0x12, 0x1f, 0x3f, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x59, 0x5a, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5e, 0x5a, 0x31, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x55, 0x39, 0x55, 0x9d, 0x99, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0xb9, 0xb9, 0x99, 0x95, 0x95, 0x95, 0x99, 0x79, 0x31, 0x18, 0x39, 0x32, 0x0d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x55, 0x30, 0x28, 0x24, 0x74, 0x74, 0xd4, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x55, 0x10, 0x10, 0x2c, 0x1b, 0x1f, 0x1f, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5e, 0x5e, 0x5a, 0x5a, 0x5e, 0x5a, 0x31, 0x31, 0x5a, 0x5a, 0x5a, 0x59, 0x79, 0x79, 0x1a, 0x99, 0xdc, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xb9, 0x99, 0x95, 0x99, 0x95, 0x99, 0x99, 0x55, 0x18, 0x38, 0x4c, 0x29, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x98, 0x2c, 0x00, 0x48, 0x74, 0xd8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd8, 0x39, 0x11, 0x11, 0x30, 0x1b, 0x1f, 0x1f, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x5a, 0x5a, 0x5e, 0x5a, 0x5e, 0x5a, 0x55, 0x55, 0x5a, 0x5a, 0x5a, 0x79, 0x99, 0x5a, 0x19, 0xb8, 0xdd, 0x99, 0x99, 0x99, 0x99, 0x99, 0x75, 0x75, 0x99, 0x99, 0x99, 0x99, 0x95, 0xb4, 0x99, 0x99, 0x75, 0x19, 0x58, 0x6c, 0x6c, 0xb1, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x98, 0x98, 0x94, 0xb0, 0xb0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd8, 0x19, 0x31, 0x12, 0x15, 0x10, 0x1a, 0x1f, 0x5e, 0x59, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x55, 0x31, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x5a, 0x5a, 0x5a, 0x5a, 0x99, 0x99, 0x5a, 0x59, 0xd8, 0xb9, 0x99, 0x99, 0x99, 0x99, 0x75, 0x75, 0x75, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x75, 0x34, 0x74, 0x8c, 0xa8, 0xcc, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x70, 0xbc, 0xb8, 0xd0, 0xec, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb9, 0x19, 0x35, 0x15, 0x1e, 0x15, 0x10, 0x12, 0x59, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x35, 0x5a, 0x5a, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x79, 0x79, 0x3a, 0x79, 0xb8, 0xb9, 0x99, 0x99, 0x99, 0x99, 0x75, 0x99, 0x75, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x79, 0x91, 0xed, 0xc8, 0xc4, 0xa8, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x11, 0x4c, 0xb8, 0x6c, 0xc0, 0xf0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x75, 0x35, 0x36, 0x15, 0x1e, 0x16, 0x11, 0x08, 0x31, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x59, 0x31, 0x5a, 0x5a, 0x5a, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x79, 0x5e, 0x39, 0x78, 0x94, 0x74, 0x99, 0x99, 0x99, 0x99, 0x75, 0x75, 0x75, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x78, 0xb2, 0xef, 0xeb, 0xc0, 0xc8, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x54, 0x94, 0x70, 0x20, 0xe9, 0xf1, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x55, 0x35, 0x39, 0x36, 0x1f, 0x15, 0x10, 0x10, 0x31, 0x5a, 0x5a, 0x59, 0x59, 0x79, 0x79, 0x59, 0x59, 0x59, 0x59, 0x59, 0x55, 0x59, 0x59, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x35, 0x59, 0x5a, 0x7a, 0x7a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x5a, 0x5e, 0x35, 0x70, 0x95, 0x70, 0x99, 0xb9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x95, 0xf3, 0xf3, 0xef, 0xe5, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x98, 0x59, 0x7e, 0x8c, 0xee, 0xf6, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd8, 0x39, 0x39, 0x59, 0x51, 0x16, 0x1b, 0x10, 0x30, 0x30, 0x5a, 0x5a, 0x5a, 0x7a, 0x7a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x35, 0x35, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5e, 0x5a, 0x59, 0x59, 0x5a, 0x39, 0x54, 0x50, 0x95, 0x74, 0x99, 0xb9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x74, 0xf3, 0xf3, 0xf3, 0xef, 0xed, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xb0, 0x4c, 0x35, 0x7d, 0xb4, 0xce, 0xf5, 0xf4, 0xf8, 0xf8, 0xf5, 0xf4, 0xf8, 0xd9, 0x19, 0x39, 0x59, 0x71, 0x6d, 0x1f, 0x1b, 0x30, 0x09, 0x36, 0x59, 0x5a, 0x5a, 0x5a, 0x59, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x31, 0x35, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x7d, 0x7d, 0x5e, 0x59, 0x55, 0x59, 0x59, 0x39, 0x54, 0x74, 0x74, 0x50, 0x98, 0xb9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x94, 0x94, 0x94, 0x99, 0x74, 0xcd, 0xef, 0xf7, 0xf3, 0xcd, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xc9, 0x81, 0xc0, 0xe8, 0xcd, 0xa8, 0xac, 0xf1, 0xf5, 0xf6, 0xf6, 0xf5, 0xf4, 0xb5, 0x19, 0x39, 0x39, 0x95, 0xb0, 0x3b, 0x16, 0x17, 0x0f, 0x33, 0x59, 0x5a, 0x59, 0x5a, 0x5a, 0x79, 0x59, 0x5a, 0x59, 0x59, 0x55, 0x55, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x55, 0x55, 0x35, 0x59, 0x59, 0x39, 0x78, 0x74, 0x74, 0xb8, 0xb8, 0xb8, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xb9, 0xb9, 0x98, 0x94, 0x94, 0x94, 0x98, 0x79, 0xac, 0xec, 0xf2, 0xf3, 0x8c, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xc6, 0xc3, 0xe6, 0xc4, 0xa4, 0xa8, 0x88, 0x88, 0xcd, 0xf2, 0xf3, 0xf3, 0xf6, 0x75, 0x35, 0x35, 0x39, 0x55, 0x36, 0x16, 0x11, 0x12, 0x13, 0x33, 0x5a, 0x5a, 0x5a, 0x79, 0x75, 0x91, 0x79, 0x5a, 0x59, 0x59, 0x55, 0x59, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x55, 0x75, 0x50, 0x55, 0x39, 0x59, 0x98, 0x98, 0x98, 0xd8, 0xb8, 0xb8, 0xb9, 0xb9, 0xb9, 0xb9, 0x99, 0x74, 0x98, 0xbd, 0xb9, 0x98, 0x94, 0x94, 0x94, 0x98, 0x98, 0x91, 0xf0, 0xf0, 0x88, 0x6c, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xc4, 0xe2, 0xe6, 0xc4, 0xc4, 0xa8, 0x88, 0x88, 0x88, 0xa8, 0xee, 0xef, 0xf3, 0x54, 0x39, 0x3a, 0x1a, 0x36, 0x36, 0x1b, 0x16, 0x0d, 0x07, 0x0f, 0x5a, 0x59, 0x5a, 0x75, 0x75, 0x91, 0x95, 0x5a, 0x59, 0x59, 0x5a, 0x59, 0x5a, 0x5a, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x55, 0x59, 0x59, 0x59, 0x59, 0x59, 0x51, 0x75, 0x50, 0x98, 0xdd, 0xb8, 0x74, 0xb4, 0xb8, 0xd8, 0xd8, 0xb8, 0xb8, 0xb8, 0xb9, 0x74, 0x74, 0x74, 0x94, 0xb8, 0xb8, 0x98, 0x94, 0x98, 0x98, 0x98, 0x98, 0x75, 0xd0, 0xac, 0x24, 0x8c, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xec, 0xf4, 0xec, 0xc4, 0xe4, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xca, 0xd3, 0x1a, 0x1a, 0x1a, 0x1a, 0x36, 0x35, 0x16, 0x1b, 0x0e, 0x03, 0x07, 0x5a, 0x59, 0x5a, 0x79, 0x95, 0x91, 0x95, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x79, 0x79, 0x59, 0x5a, 0x5a, 0x55, 0x59, 0x51, 0x55, 0x59, 0x55, 0x74, 0x70, 0x50, 0x70, 0x70, 0xb8, 0xfc, 0xd8, 0x94, 0xd8, 0xf8, 0xd4, 0xd8, 0xd8, 0xb8, 0xd8, 0xd8, 0xb8, 0x74, 0x74, 0x94, 0xb8, 0xb8, 0x98, 0x98, 0x98, 0x98, 0xb8, 0xb8, 0x94, 0xb0, 0x68, 0x44, 0x68, 0x51, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xf8, 0xfc, 0xfd, 0xf4, 0xe0, 0xc9, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x69, 0x13, 0x1b, 0x17, 0x1a, 0x1a, 0x16, 0x36, 0x16, 0x1f, 0x13, 0x03, 0x27, 0x55, 0x5a, 0x5a, 0x5a, 0x79, 0x79, 0x79, 0x5a, 0x5a, 0x59, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x59, 0x59, 0x79, 0x75, 0x59, 0x51, 0x51, 0x74, 0x70, 0x70, 0x70, 0x90, 0xb4, 0x94, 0x94, 0xd8, 0xd4, 0xb0, 0x90, 0xd8, 0xd8, 0xb4, 0xd8, 0xfc, 0xfc, 0xfc, 0xb4, 0x94, 0x74, 0x98, 0xb8, 0xb8, 0x98, 0x98, 0xb8, 0xb9, 0xb8, 0xb8, 0x98, 0x71, 0x44, 0x64, 0x8c, 0x51, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xfd, 0xfd, 0xfd, 0xfd, 0xec, 0xc9, 0x88, 0x88, 0x88, 0x88, 0x89, 0x4e, 0x0e, 0x13, 0x17, 0x17, 0x17, 0x17, 0x15, 0x16, 0x16, 0x17, 0x0b, 0x07, 0x29, 0x74, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x5a, 0x59, 0x59, 0x79, 0x99, 0xb9, 0x99, 0x55, 0x51, 0x2c, 0x50, 0x70, 0x70, 0x95, 0xb8, 0xdc, 0xb9, 0x77, 0xd2, 0xf2, 0xf1, 0xb1, 0x6c, 0x90, 0x90, 0xd4, 0xf8, 0xfc, 0xf8, 0xb4, 0x94, 0x98, 0xb8, 0xb8, 0xb8, 0xb9, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0x71, 0x85, 0x80, 0x64, 0xac, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xfd, 0xfd, 0xfd, 0xf4, 0xe9, 0xa9, 0x88, 0x88, 0x88, 0x6a, 0x4f, 0x0e, 0x0e, 0x13, 0x17, 0x17, 0x17, 0x16, 0x15, 0x16, 0x17, 0x16, 0x0f, 0x29, 0x4c, 0x94, 0x59, 0x5a, 0x5a, 0x5a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x59, 0x79, 0x51, 0xb9, 0xd9, 0xd9, 0x95, 0x75, 0x51, 0x75, 0x75, 0x75, 0x95, 0x95, 0x75, 0x79, 0x99, 0x9b, 0x77, 0xb7, 0xf5, 0xf1, 0xb1, 0xad, 0x68, 0x6c, 0x8c, 0xb5, 0xd4, 0xf8, 0xfc, 0xfc, 0xd8, 0xb8, 0xb9, 0xb9, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0x90, 0xc4, 0xa0, 0x80, 0xe8, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xf8, 0xf4, 0xc8, 0xc0, 0xe5, 0x89, 0x68, 0x88, 0x6b, 0x0f, 0x0f, 0x0f, 0x0e, 0x13, 0x17, 0x17, 0x17, 0x15, 0x35, 0x36, 0x76, 0xb1, 0x2c, 0x28, 0x4c, 0x70, 0x59, 0x7a, 0x7a, 0x9a, 0x9a, 0x9a, 0x9a, 0x7a, 0x7a, 0x79, 0x71, 0x95, 0x71, 0xb5, 0x95, 0x75, 0x75, 0x95, 0x99, 0xd9, 0xf9, 0xb5, 0x95, 0x76, 0x76, 0x76, 0x76, 0x97, 0x72, 0x92, 0x71, 0x91, 0x91, 0xb0, 0x6d, 0x6c, 0x6a, 0x4b, 0x8f, 0xf5, 0xf8, 0xf8, 0xf9, 0xf9, 0xd8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0x90, 0xa1, 0xa0, 0xc4, 0xec, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xb0, 0xa4, 0xa0, 0xf0, 0xf0, 0xe4, 0x84, 0x65, 0x4b, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x13, 0x17, 0x17, 0x36, 0x15, 0x15, 0x36, 0xd5, 0xd0, 0x00, 0x04, 0x50, 0x4c, 0x75, 0xba, 0xba, 0xba, 0xba, 0x9a, 0x95, 0x99, 0xb9, 0x99, 0x75, 0x71, 0x71, 0x71, 0x9a, 0xba, 0xb9, 0x99, 0xba, 0xda, 0xf9, 0xd5, 0x76, 0x76, 0x7a, 0x76, 0x51, 0x51, 0x2d, 0x52, 0x52, 0x52, 0x72, 0x71, 0x6d, 0x6d, 0x6a, 0x67, 0xa7, 0xcf, 0xd2, 0xd5, 0xd5, 0xf5, 0xf0, 0xd4, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0x95, 0xa1, 0xc0, 0xe8, 0xec, 0xd0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xd1, 0xd0, 0xaa, 0x8f, 0xae, 0xc0, 0x66, 0x2b, 0x0b, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x13, 0x17, 0x17, 0x35, 0x35, 0x35, 0x16, 0xb5, 0xd8, 0x6c, 0x04, 0x70, 0x50, 0x95, 0xba, 0xba, 0x9a, 0xb5, 0xb5, 0xb1, 0xb5, 0x95, 0xba, 0xb6, 0xb6, 0xda, 0xda, 0xba, 0xb6, 0xb6, 0xda, 0xdb, 0xbb, 0x9a, 0x7a, 0x76, 0x56, 0x55, 0x51, 0x51, 0x31, 0x2d, 0x32, 0x36, 0x32, 0x52, 0x71, 0x71, 0x95, 0x91, 0xd2, 0xd2, 0x93, 0x6f, 0x89, 0xcc, 0xf0, 0xcd, 0xc8, 0xcc, 0xb0, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb4, 0xe5, 0xe0, 0xe0, 0xc4, 0xed, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x8e, 0xad, 0x6a, 0x63, 0xe6, 0xf3, 0xb7, 0x6f, 0x0b, 0x07, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x13, 0x36, 0x35, 0x35, 0x56, 0x16, 0xb6, 0xf8, 0xb4, 0x6c, 0x2c, 0xb8, 0xfd, 0x9a, 0x79, 0x75, 0xb5, 0xb1, 0xb1, 0xb2, 0xdb, 0xff, 0xfb, 0xba, 0xb6, 0x96, 0xb6, 0xdb, 0xdb, 0xdb, 0x9b, 0x7a, 0x76, 0x56, 0x51, 0x51, 0x55, 0x55, 0x51, 0x2d, 0x51, 0x51, 0x36, 0x51, 0x51, 0x51, 0x51, 0x75, 0xb5, 0xf8, 0xf4, 0x8d, 0x49, 0x66, 0x66, 0x8f, 0xae, 0xcc, 0xcc, 0xc8, 0xc8, 0xd0, 0xb4, 0xb8, 0xb8, 0xb8, 0xc9, 0xe1, 0xc0, 0xa0, 0xcd, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x4b, 0x25, 0xd4, 0xf1, 0xc9, 0xfb, 0xff, 0xff, 0xfb, 0xb7, 0x93, 0x4f, 0x0b, 0x2b, 0x6f, 0x37, 0x55, 0x36, 0x36, 0x56, 0x57, 0x96, 0xf8, 0xd4, 0xd0, 0xac, 0xd8, 0xfc, 0x99, 0x99, 0xba, 0xda, 0xd6, 0xf6, 0xf6, 0xdb, 0xb6, 0x96, 0xb6, 0xdb, 0xdb, 0xdb, 0xbb, 0x96, 0x76, 0x76, 0x51, 0x51, 0x2d, 0x55, 0x56, 0x76, 0x56, 0x51, 0x31, 0x56, 0x36, 0x56, 0x51, 0x51, 0x31, 0x31, 0x31, 0x91, 0xf8, 0xf8, 0xb0, 0x90, 0x69, 0x4f, 0x1f, 0x37, 0x60, 0xac, 0xcc, 0xec, 0xec, 0xec, 0xd0, 0xb4, 0xb8, 0xcd, 0xe2, 0x80, 0x80, 0x88, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x6b, 0xf9, 0xfc, 0xf9, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xb7, 0xb3, 0x36, 0x36, 0x16, 0x36, 0x56, 0x36, 0x56, 0xd1, 0xd4, 0xf4, 0xf4, 0xf4, 0xd0, 0xda, 0xff, 0xff, 0xf6, 0xd1, 0xb6, 0x96, 0x96, 0xba, 0xdb, 0xdb, 0xdb, 0xb6, 0x96, 0x76, 0x76, 0x55, 0x51, 0x51, 0x55, 0x51, 0x56, 0x36, 0x56, 0x56, 0x36, 0x56, 0x5a, 0x56, 0x56, 0x51, 0x32, 0x11, 0x11, 0x11, 0x12, 0x52, 0x71, 0x90, 0xb0, 0x90, 0x8d, 0x97, 0x6e, 0x20, 0x00, 0x44, 0xa8, 0xd0, 0xf0, 0xf0, 0xf0, 0xd0, 0xcc, 0xa5, 0x24, 0x44, 0x69, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xf2, 0xe5, 0xec, 0xf5, 0xf1, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0x55, 0x56, 0x56, 0x36, 0x32, 0x32, 0x57, 0x9b, 0xf2, 0xf0, 0xf4, 0xd0, 0xd1, 0xe9, 0xf6, 0xdb, 0xb6, 0x91, 0x96, 0xba, 0xdb, 0xff, 0xdb, 0xbb, 0x96, 0x76, 0x76, 0x51, 0x51, 0x55, 0x76, 0x7a, 0x55, 0x56, 0x56, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x56, 0x56, 0x56, 0x12, 0x12, 0x12, 0x12, 0x13, 0x17, 0x13, 0x52, 0x2d, 0x48, 0x6c, 0x6c, 0x8c, 0x8c, 0x8c, 0x6c, 0x68, 0x68, 0x44, 0x88, 0xd0, 0xf4, 0xf4, 0xf4, 0xb0, 0x09, 0x0d, 0x0d, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xf3, 0xee, 0xe4, 0xe1, 0xc1, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xb6, 0x95, 0x51, 0x31, 0x51, 0x56, 0x76, 0x7b, 0xbb, 0xdf, 0xff, 0xff, 0xf0, 0xac, 0x64, 0xa8, 0xc9, 0xd1, 0x96, 0xb6, 0xdb, 0xff, 0xff, 0xdb, 0xba, 0x96, 0x96, 0x75, 0x51, 0x51, 0x4d, 0x55, 0x76, 0x7a, 0x76, 0x31, 0x31, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x56, 0x56, 0x56, 0x36, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x52, 0x96, 0x4e, 0x04, 0x04, 0x28, 0x49, 0x6d, 0x6c, 0x6c, 0x8c, 0x8c, 0x6c, 0x6c, 0x68, 0x90, 0xf4, 0xf8, 0xf8, 0xd4, 0x6d, 0x68, 0x6c, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xeb, 0xeb, 0xea, 0xc1, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xb5, 0x74, 0x75, 0x75, 0x32, 0x32, 0x76, 0x9b, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xfb, 0xed, 0xec, 0xa8, 0x84, 0x60, 0x8d, 0xff, 0xff, 0xff, 0xdb, 0x96, 0x96, 0x76, 0x75, 0x75, 0x71, 0x51, 0x51, 0x51, 0x51, 0x76, 0x56, 0x56, 0x56, 0x3a, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x56, 0x36, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x72, 0x9b, 0x52, 0x04, 0x04, 0x05, 0x0b, 0x07, 0x28, 0x48, 0x4c, 0x48, 0x68, 0x6c, 0x50, 0x4c, 0x48, 0x44, 0x8c, 0xd0, 0x8c, 0xd0, 0x8d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xeb, 0xcf, 0x83, 0xab, 0xd2, 0xff, 0xff, 0xd6, 0x95, 0x70, 0x74, 0x95, 0x95, 0x52, 0x56, 0x96, 0xbb, 0xdb, 0xdb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xed, 0xc9, 0x84, 0x64, 0xa9, 0xfb, 0xbb, 0x96, 0x96, 0x96, 0x91, 0x8d, 0x71, 0x76, 0x76, 0x51, 0x51, 0x51, 0x51, 0x56, 0x5a, 0x5a, 0x56, 0x56, 0x36, 0x36, 0x36, 0x16, 0x16, 0x16, 0x16, 0x16, 0x36, 0x32, 0x17, 0x17, 0x17, 0x17, 0x17, 0x52, 0x96, 0xbb, 0x52, 0x00, 0x04, 0x06, 0x0b, 0x07, 0x00, 0x04, 0x28, 0x4c, 0x4d, 0x30, 0x10, 0x50, 0x4c, 0x28, 0x08, 0x0c, 0x40, 0x84, 0x8c, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xcf, 0xe2, 0xc0, 0xc5, 0xce, 0xb6, 0xb6, 0x91, 0x71, 0x71, 0x95, 0x74, 0x74, 0x96, 0xbb, 0xb6, 0x96, 0xb6, 0xda, 0xfa, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x8d, 0xae, 0xa1, 0xa5, 0xec, 0xd6, 0x96, 0x76, 0x71, 0x8d, 0x91, 0x91, 0x91, 0x76, 0x75, 0x51, 0x51, 0x56, 0x56, 0x56, 0x56, 0x55, 0x56, 0x56, 0x36, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x36, 0x12, 0x17, 0x17, 0x17, 0x17, 0x17, 0x72, 0xbb, 0xbf, 0x72, 0x00, 0x04, 0x07, 0x0f, 0x0b, 0x00, 0x09, 0x0d, 0x0e, 0x11, 0x34, 0x2c, 0x28, 0x28, 0x4c, 0x71, 0x95, 0xcc, 0xc8, 0xb0, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xed, 0xe4, 0xc0, 0xe8, 0xcd, 0xb5, 0x8c, 0x88, 0xac, 0xb1, 0xd9, 0xb9, 0xb6, 0xb2, 0xb6, 0xb6, 0xd6, 0xda, 0xda, 0xdb, 0xb6, 0xb7, 0xff, 0xff, 0xb7, 0xb7, 0x72, 0xca, 0xa1, 0xa5, 0xec, 0xf5, 0x71, 0x71, 0x75, 0x71, 0x91, 0x91, 0x91, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x36, 0x36, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x31, 0x12, 0x17, 0x17, 0x17, 0x17, 0x32, 0x96, 0xbf, 0xbf, 0x72, 0x00, 0x05, 0x0b, 0x0f, 0x0b, 0x0e, 0x12, 0x0e, 0x0e, 0x31, 0x34, 0x2c, 0x04, 0x24, 0x69, 0xac, 0x88, 0xac, 0xd0, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xe8, 0xe4, 0xea, 0xef, 0xcd, 0xf5, 0xcc, 0xac, 0x68, 0xad, 0xf2, 0xda, 0xb6, 0xb6, 0xda, 0xdb, 0xb6, 0xb6, 0x92, 0x93, 0x73, 0x73, 0x73, 0x33, 0x0f, 0x97, 0x97, 0xab, 0xa2, 0xa5, 0xa5, 0xd3, 0x76, 0x76, 0x76, 0x91, 0x91, 0x91, 0x71, 0x55, 0x55, 0x55, 0x51, 0x51, 0x55, 0x55, 0x55, 0x35, 0x36, 0x36, 0x16, 0x16, 0x16, 0x16, 0x16, 0x36, 0x16, 0x36, 0x31, 0x12, 0x17, 0x17, 0x17, 0x17, 0x72, 0xbb, 0xbf, 0xbf, 0x72, 0x00, 0x09, 0x2a, 0x26, 0x07, 0x0a, 0x0e, 0x0e, 0x12, 0x34, 0x34, 0x0d, 0x49, 0x8c, 0xac, 0xd0, 0x8c, 0x50, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xc8, 0xf2, 0xf3, 0xf3, 0xe8, 0xc4, 0xc8, 0xf5, 0xd1, 0xcd, 0xd2, 0xd6, 0xdb, 0xda, 0xb6, 0xb2, 0x72, 0x92, 0x73, 0x53, 0x33, 0x32, 0x32, 0x52, 0x12, 0x97, 0x9f, 0xd3, 0xc2, 0xa1, 0xf3, 0xf7, 0x76, 0x75, 0x75, 0x91, 0x71, 0x55, 0x55, 0x55, 0x51, 0x51, 0x51, 0x55, 0x51, 0x51, 0x51, 0x51, 0x51, 0x35, 0x35, 0x36, 0x16, 0x16, 0x16, 0x16, 0x16, 0x35, 0x31, 0x12, 0x17, 0x17, 0x17, 0x53, 0xb6, 0xbf, 0xbf, 0xbf, 0x7a, 0x10, 0x0c, 0x25, 0x01, 0x03, 0x02, 0x00, 0x05, 0x51, 0x98, 0x9a, 0x6e, 0x69, 0x84, 0xa8, 0xb0, 0x98, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf4, 0xfa, 0xff, 0xf3, 0xe9, 0xe8, 0xe9, 0xed, 0xf6, 0xd6, 0xd6, 0xda, 0xd6, 0xd1, 0x6d, 0x6e, 0x73, 0x53, 0x33, 0x0e, 0x0e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x76, 0xda, 0xb6, 0xae, 0xce, 0xfb, 0xfb, 0x96, 0x75, 0x75, 0x55, 0x55, 0x51, 0x51, 0x51, 0x55, 0x55, 0x51, 0x51, 0x51, 0x51, 0x51, 0x55, 0x55, 0x51, 0x51, 0x51, 0x35, 0x36, 0x16, 0x36, 0x16, 0x11, 0x11, 0x12, 0x17, 0x17, 0x17, 0x92, 0xbb, 0xbf, 0x9a, 0x59, 0x3c, 0x3c, 0x15, 0x02, 0x01, 0x02, 0x02, 0x21, 0xa6, 0xec, 0xf4, 0xf5, 0xe9, 0xc8, 0x84, 0x44, 0x08, 0x10, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xf5, 0xfa, 0xf2, 0xe0, 0xec, 0xf1, 0xf2, 0xd6, 0xda, 0xd6, 0xb1, 0x8d, 0x8d, 0x8e, 0x6e, 0x2f, 0x0e, 0x12, 0x12, 0x32, 0x32, 0x32, 0x12, 0x12, 0x12, 0x32, 0x32, 0x96, 0xb6, 0x93, 0xf7, 0xfb, 0xfb, 0xb7, 0x51, 0x51, 0x51, 0x51, 0x51, 0x55, 0x51, 0x51, 0x51, 0x51, 0x51, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x51, 0x31, 0x31, 0x55, 0x76, 0x56, 0x36, 0x56, 0x31, 0x16, 0x37, 0x17, 0x57, 0x91, 0x76, 0x31, 0x10, 0x38, 0x3c, 0x3c, 0x12, 0x02, 0x03, 0x07, 0x06, 0xa6, 0xf3, 0xfc, 0xfc, 0xd0, 0xa8, 0xa8, 0x28, 0x08, 0x0c, 0x10, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xf5, 0xee, 0xe9, 0xed, 0xf1, 0xfa, 0xd6, 0xb2, 0x91, 0xb2, 0x8e, 0x6f, 0x33, 0x0e, 0x0e, 0x0e, 0x0e, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x17, 0x17, 0x12, 0x0e, 0xba, 0xfa, 0xcf, 0xea, 0xf2, 0xf7, 0xfb, 0x51, 0x51, 0x51, 0x55, 0x51, 0x51, 0x51, 0x55, 0x55, 0x51, 0x51, 0x51, 0x55, 0x55, 0x55, 0x51, 0x31, 0x55, 0x76, 0x9b, 0x9a, 0x76, 0x9a, 0xbb, 0x9a, 0x96, 0xbb, 0xdf, 0xbb, 0x96, 0x71, 0x0c, 0x0c, 0x34, 0x5c, 0x3c, 0x3c, 0x0a, 0x03, 0x0b, 0x0a, 0x09, 0xc5, 0xe5, 0xf4, 0xf8, 0x8c, 0x08, 0x0c, 0x0c, 0x10, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xf1, 0xf1, 0xf1, 0xf5, 0xec, 0xee, 0xce, 0x88, 0xa9, 0xaa, 0xca, 0xca, 0xaa, 0xa9, 0xa9, 0xad, 0xad, 0x8d, 0x8e, 0xae, 0xae, 0xae, 0x92, 0x77, 0x57, 0x32, 0x0e, 0x91, 0xd1, 0xe2, 0xe2, 0xe0, 0xc5, 0xb3, 0x76, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x31, 0x55, 0x9a, 0xbf, 0xbb, 0xbb, 0xbb, 0xdb, 0xbb, 0xbb, 0xbb, 0xdf, 0xdf, 0xdf, 0xdf, 0xdb, 0xdb, 0xbb, 0x96, 0x39, 0x3c, 0x3c, 0x34, 0x65, 0x8e, 0x2d, 0x0d, 0x69, 0xc5, 0xc4, 0x84, 0x08, 0x0c, 0x10, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x10, 0x91, 0xf1, 0xe9, 0xe5, 0xe1, 0xe2, 0xe1, 0xc0, 0xc0, 0xa0, 0xc0, 0xe0, 0xe0, 0xc0, 0xc0, 0xec, 0xf0, 0xc1, 0xe3, 0xe5, 0xe8, 0xe8, 0xcd, 0xdf, 0xdf, 0xbf, 0x9b, 0xb7, 0xc5, 0xc3, 0xc3, 0x62, 0x01, 0x2b, 0x76, 0x51, 0x55, 0x55, 0x51, 0x51, 0x55, 0x51, 0x51, 0x51, 0x51, 0x55, 0x55, 0x76, 0xba, 0xbb, 0xbb, 0xbb, 0xdb, 0xdf, 0xbb, 0x76, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb, 0xb6, 0x0d, 0x12, 0x1a, 0x31, 0x48, 0x8c, 0x6c, 0x2d, 0x69, 0x68, 0x08, 0x0c, 0x10, 0x15, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x68, 0xc5, 0xe5, 0xe0, 0xc1, 0xe9, 0xf4, 0xf4, 0xf0, 0xe4, 0xe0, 0xe0, 0xc4, 0xc4, 0xc4, 0xe8, 0xe5, 0xe9, 0xe8, 0xe8, 0xac, 0x51, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xf2, 0xc2, 0x63, 0x42, 0x26, 0x2b, 0x97, 0x51, 0x51, 0x55, 0x55, 0x55, 0x55, 0x51, 0x51, 0x51, 0x75, 0x96, 0xba, 0xbb, 0xbb, 0xdb, 0xdb, 0xdb, 0x96, 0xbb, 0xdf, 0xbb, 0x52, 0x76, 0xbb, 0xdf, 0xdf, 0xdf, 0xdb, 0xdb, 0xdb, 0xdb, 0x72, 0x56, 0x5f, 0x1b, 0x0d, 0x0c, 0x4c, 0x4c, 0x2c, 0x0c, 0x0c, 0x10, 0x19, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x04, 0x04, 0x24, 0xc4, 0xe9, 0xe8, 0xf5, 0xfd, 0xfc, 0xf8, 0xe8, 0xe8, 0xe0, 0xa0, 0xc4, 0xe8, 0xe8, 0xe8, 0xe8, 0xe4, 0xc8, 0x71, 0x57, 0xdf, 0xdf, 0xdf, 0xdf, 0x9b, 0xb1, 0xe5, 0xa2, 0x42, 0x27, 0x07, 0x72, 0x75, 0x51, 0x51, 0x55, 0x51, 0x51, 0x51, 0x76, 0x96, 0x96, 0x96, 0xbb, 0xdb, 0xdb, 0xbb, 0x96, 0x72, 0xbb, 0xdf, 0xdf, 0xdf, 0xbb, 0x11, 0x0c, 0x11, 0x57, 0x9f, 0xbf, 0xdb, 0xdb, 0xb6, 0x4c, 0x71, 0x7f, 0x5a, 0x0c, 0x2c, 0x0c, 0x0c, 0x0c, 0x11, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x04, 0x00, 0x64, 0x88, 0xa8, 0xec, 0xf4, 0xfd, 0xfd, 0xf0, 0xa8, 0xb0, 0xf8, 0xf0, 0xe8, 0xe8, 0xe4, 0xe4, 0xe4, 0xe5, 0xa9, 0x6e, 0x3f, 0xdf, 0xdf, 0xbb, 0x76, 0x76, 0xb6, 0xf0, 0xed, 0x8a, 0x4b, 0x61, 0xce, 0x76, 0x51, 0x51, 0x51, 0x75, 0x96, 0x96, 0x96, 0x96, 0xbb, 0xdb, 0xdb, 0xda, 0x96, 0x72, 0x51, 0x96, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xbb, 0x32, 0x11, 0x1b, 0x1f, 0x3f, 0x7f, 0x71, 0x70, 0x2c, 0x17, 0x1b, 0x30, 0x0c, 0x0c, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x68, 0xb0, 0x8c, 0xa8, 0xc8, 0xa8, 0xd0, 0xfc, 0xf9, 0xf5, 0xf4, 0xf8, 0xf8, 0xf7, 0xef, 0xea, 0x81, 0xa2, 0xa3, 0x87, 0x67, 0x6a, 0x76, 0x9b, 0x77, 0x56, 0x77, 0x57, 0x96, 0xd4, 0xd0, 0xac, 0xc9, 0xe0, 0xe9, 0x92, 0x51, 0x76, 0x96, 0xb6, 0x96, 0x96, 0xbb, 0xdb, 0xfa, 0xfe, 0xfd, 0xfc, 0xd9, 0x71, 0x72, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xbf, 0x56, 0x56, 0x75, 0x56, 0x1b, 0x1b, 0x3a, 0x11, 0x11, 0x0d, 0x0c, 0x10, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x6c, 0xb0, 0xf4, 0xf0, 0xc8, 0xac, 0xcc, 0xd0, 0xf0, 0xfd, 0xf8, 0xcc, 0xf2, 0xf3, 0xf3, 0xf3, 0xef, 0xaa, 0x6a, 0x2a, 0x4a, 0x51, 0x74, 0x35, 0x13, 0x17, 0x17, 0x17, 0x57, 0xad, 0xac, 0xea, 0xe9, 0xe8, 0xc8, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xbb, 0xbb, 0x96, 0x71, 0x91, 0xb5, 0xd9, 0xd8, 0xd8, 0x90, 0xbb, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x76, 0x76, 0x7a, 0x11, 0x15, 0x5f, 0x36, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x70, 0x28, 0x6c, 0xac, 0xd0, 0xf0, 0xf4, 0xf0, 0x88, 0x8c, 0xd4, 0xf0, 0xf3, 0xf3, 0xf3, 0xf3, 0xcf, 0xae, 0x68, 0x28, 0x4c, 0x50, 0x55, 0x55, 0x0d, 0x0e, 0x17, 0x17, 0x13, 0xae, 0xd1, 0xf7, 0xf2, 0xa8, 0x6d, 0xb6, 0xb6, 0xb6, 0xbb, 0xb6, 0x92, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x51, 0x52, 0x71, 0x48, 0x4d, 0x71, 0x75, 0x96, 0x9b, 0xbb, 0x96, 0x91, 0x75, 0x76, 0x17, 0x36, 0x58, 0x74, 0x30, 0x10, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xd8, 0x90, 0x28, 0x28, 0x68, 0xac, 0xf0, 0xcc, 0x88, 0x44, 0x24, 0x8d, 0xd3, 0xef, 0xe6, 0xc4, 0xa8, 0x8d, 0x88, 0x4c, 0x70, 0x50, 0x54, 0x55, 0x0e, 0x0d, 0x0d, 0x12, 0x77, 0xb7, 0xb2, 0xd1, 0xd0, 0x8d, 0xb6, 0xb6, 0xb6, 0xb6, 0x91, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x52, 0xbb, 0xda, 0x6c, 0x08, 0x28, 0x4d, 0x37, 0x1b, 0x76, 0x92, 0x4d, 0x56, 0x31, 0x0d, 0x30, 0x30, 0x10, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x74, 0xb8, 0xb4, 0x48, 0x48, 0x48, 0x4c, 0x68, 0x88, 0x68, 0x68, 0x68, 0x08, 0x08, 0x89, 0xe9, 0xe8, 0xc9, 0x8e, 0x81, 0x6c, 0x70, 0x71, 0x31, 0x0c, 0x0e, 0x0e, 0x0e, 0x72, 0xff, 0xdf, 0x68, 0x6d, 0x8d, 0x91, 0xb6, 0x91, 0x91, 0xb6, 0x96, 0x71, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x52, 0x96, 0xff, 0xff, 0xfa, 0x90, 0x70, 0x56, 0x52, 0x4d, 0xb6, 0x92, 0x4d, 0x0d, 0x0c, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x74, 0x74, 0x6c, 0x48, 0x48, 0x48, 0x94, 0xd8, 0x94, 0x6c, 0x68, 0x68, 0x74, 0x78, 0x34, 0x4c, 0xac, 0xc9, 0x42, 0x2b, 0x6a, 0x6c, 0x5b, 0x1b, 0x12, 0x0d, 0x0e, 0x73, 0xff, 0xff, 0xff, 0x91, 0x2d, 0x31, 0x16, 0x57, 0x6d, 0x6d, 0x91, 0x92, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xda, 0xb4, 0xb4, 0x95, 0x4d, 0x70, 0x70, 0x2c, 0x0c, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x70, 0x4c, 0x4c, 0x4c, 0x48, 0x4c, 0xdc, 0xfc, 0xfc, 0xd8, 0xb4, 0x90, 0x54, 0x58, 0x38, 0x10, 0x4c, 0x4e, 0x2f, 0x67, 0x71, 0x3f, 0x1f, 0x1f, 0x16, 0x77, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x29, 0x77, 0xbb, 0xc6, 0x66, 0x89, 0x89, 0xa9, 0xad, 0xae, 0x8e, 0x72, 0x72, 0x72, 0xfb, 0xff, 0xfa, 0xb5, 0x70, 0xb9, 0xd9, 0x95, 0x50, 0x30, 0x08, 0x10, 0x35, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x50, 0x2c, 0x4c, 0x4c, 0x4c, 0x28, 0x70, 0xdc, 0xfc, 0xfc, 0xfc, 0xd8, 0x90, 0x08, 0x10, 0x14, 0x19, 0x14, 0x31, 0x4b, 0x57, 0x1f, 0x1f, 0x1f, 0x1b, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0xa1, 0xe1, 0xe5, 0xec, 0xe9, 0xa4, 0x80, 0xa0, 0xa0, 0xc0, 0xa0, 0x64, 0x65, 0xb1, 0xf5, 0x8c, 0xd0, 0x8c, 0x94, 0xb4, 0x70, 0x2c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x74, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x50, 0x94, 0xfc, 0xfc, 0xfc, 0xdc, 0xdc, 0xb8, 0x90, 0x2c, 0x14, 0x39, 0x18, 0x30, 0x32, 0x3f, 0x1f, 0x1b, 0x13, 0x47, 0x89, 0xfb, 0xff, 0xff, 0xff, 0xa8, 0xe1, 0xc1, 0x65, 0xed, 0xec, 0xec, 0xc8, 0xa0, 0xa0, 0xc0, 0xa4, 0x84, 0xc8, 0xd1, 0xd4, 0xb0, 0xd4, 0x4c, 0x70, 0x2c, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x98, 0x98, 0x94, 0x94, 0x74, 0x94, 0x94, 0x94, 0x74, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0x70, 0x08, 0x0c, 0x10, 0x14, 0x10, 0x28, 0x2e, 0x17, 0x17, 0x2b, 0x81, 0xc1, 0xce, 0xfb, 0xff, 0xee, 0xc1, 0x41, 0x45, 0xc9, 0xe8, 0xec, 0xec, 0xe8, 0xc0, 0xa4, 0xa8, 0x84, 0xad, 0xf5, 0xd4, 0xb4, 0x6c, 0x0c, 0x0c, 0x0c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x50, 0x54, 0x54, 0x54, 0x54, 0x74, 0x74, 0x74, 0x74, 0x94, 0x74, 0x50, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x2f, 0x6f, 0x6b, 0xa6, 0xe0, 0xe4, 0xf2, 0xee, 0x62, 0x61, 0x41, 0x86, 0x80, 0xa4, 0xc8, 0xe8, 0xec, 0xa8, 0x64, 0xc8, 0xd5, 0xb0, 0x6c, 0x2c, 0x0c, 0x0c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0c, 0x0c, 0x2c, 0x2c, 0x2c, 0x50, 0x50, 0x50, 0x74, 0x74, 0x74, 0x74, 0x54, 0x50, 0x2c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x4c, 0x4c, 0x08, 0x0c, 0x0c, 0x08, 0x29, 0x0f, 0xaa, 0xe4, 0xec, 0xf6, 0xf6, 0x83, 0x43, 0x8b, 0xcb, 0xa0, 0xa4, 0x84, 0xac, 0xf0, 0xec, 0xa8, 0xc8, 0x8d, 0x08, 0x0c, 0x0c, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x2c, 0x2c, 0x30, 0x50, 0x74, 0x74, 0x74, 0x74, 0x54, 0x54, 0x30, 0x2c, 0x08, 0x08, 0x08, 0x91, 0xda, 0xb5, 0x71, 0x0c, 0x0c, 0x08, 0x08, 0x45, 0xc9, 0xf7, 0xfb, 0xfb, 0xea, 0xa3, 0xaf, 0xcb, 0xe4, 0xa4, 0x68, 0xd0, 0xf0, 0xac, 0x68, 0x08, 0x0c, 0x11, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x2c, 0x30, 0x50, 0x50, 0x2c, 0x2c, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x08, 0x04, 0x95, 0xda, 0xfe, 0xda, 0x95, 0x0c, 0x0c, 0x0c, 0x08, 0x04, 0xae, 0xf7, 0xfb, 0xf2, 0xe6, 0xca, 0xa5, 0xa8, 0xa8, 0xac, 0xac, 0x48, 0x08, 0x0c, 0x15, 0x5e, 0x7f, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x28, 0x08, 0x08, 0x08, 0x08, 0x09, 0x29, 0x45, 0x49, 0x48, 0x4d, 0x6d, 0x50, 0x2c, 0x50, 0x2c, 0x0c, 0x08, 0x04, 0x24, 0xb2, 0xf3, 0xe4, 0xe5, 0xa8, 0x8c, 0x88, 0x48, 0x08, 0x0c, 0x35, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x2c, 0x2c, 0x2c, 0x28, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x05, 0x25, 0x25, 0x25, 0x04, 0x04, 0x04, 0x04, 0x04, 0x28, 0x28, 0x04, 0x08, 0x48, 0x64, 0x00, 0x44, 0xc4, 0xe5, 0x88, 0x28, 0x08, 0x0c, 0x35, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0d, 0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x09, 0x05, 0x25, 0x25, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00, 0x44, 0x84, 0x44, 0x00, 0x04, 0x08, 0x08, 0x0c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x09, 0x09, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0c, 0x08, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x10, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x10, 0x11, 0x11, 0x11, 0x11, 0x15, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0c, 0x0c, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x15, 0x15, 0x19, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x1e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0x80, 0x03, 0x8c, 0x2e, 0x6c, 0x06, 0x8d, 0x06, 0x4c, 0x26, 0x8d, 0x06, 0x0d, 0x1f, 0x6c, 0x3f, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0xeb, 0x35, 0xa8, 0x5c, 0x08, 0x64, 0x27, 0x43, 0xab, 0x4c, 0x52, 0x86, 0xa8, 0x64, 0x23, 0x43, 0xa7, 0x83, 0x4b, 0x45, 0xe9, 0x25, 0xc0, 0x06, 0x80, 0x06, 0xeb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x06, 0xc8, 0x5c, 0x09, 0x64, 0x46, 0x4b, 0x49, 0x54, 0x0f, 0x8d, 0x91, 0xa5, 0xee, 0x8c, 0x10, 0x8d, 0xb9, 0xc6, 0x13, 0xe5, 0x00, 0xa8, 0x00, 0xc0, 0x15, 0x68, 0x39, 0x02, 0x56, 0x5c, 0x32, 0x86, 0x6c, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x85, 0x33, 0x04, 0x2b, 0x09, 0x15, 0x6c, 0x5d, 0x2e, 0x8d, 0xed, 0x84, 0xf0, 0x6c, 0x33, 0x85, 0xdb, 0xce, 0xb2, 0xad, 0x22, 0x84, 0x70, 0x84, 0xf8, 0xb5, 0x77, 0xcd, 0x99, 0xda, 0x33, 0xca, 0xdc, 0xb4, 0x5f, 0xbe, 0x1e, 0xdf, 0xf7, 0xb5, 0x08, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3c, 0x89, 0x74, 0xac, 0x7c, 0x09, 0x5c, 0xea, 0x5b, 0x74, 0x95, 0x37, 0xa6, 0xf3, 0x04, 0x3a, 0x06, 0x93, 0x7d, 0x79, 0xc6, 0xb5, 0xa5, 0x37, 0x8d, 0x5c, 0xb6, 0x9b, 0xc6, 0x34, 0xa5, 0x1d, 0xce, 0x3e, 0xe7, 0xfb, 0xd6, 0xf5, 0xad, 0x90, 0x64, 0x8d, 0x0a, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x44, 0x65, 0x4b, 0x05, 0x43, 0x88, 0x34, 0xed, 0x3c, 0xf6, 0x65, 0x8f, 0x44, 0xef, 0x44, 0x31, 0x85, 0x9a, 0xc6, 0x59, 0xb6, 0xf5, 0x24, 0x55, 0x35, 0xf2, 0x64, 0x33, 0x95, 0xb6, 0xb5, 0x3c, 0xe7, 0x78, 0xbe, 0x30, 0x6c, 0xac, 0x63, 0xd0, 0x84, 0x50, 0x64, 0xa7, 0x02, 0x68, 0x03, 0xce, 0x03, 0x87, 0x01, 0xe1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x14, 0xca, 0x2c, 0x51, 0x3e, 0x16, 0x06, 0xb1, 0x3c, 0xf1, 0x4c, 0x09, 0x64, 0xec, 0x63, 0x75, 0x7d, 0xb7, 0x55, 0x33, 0x04, 0xd4, 0x4c, 0x6d, 0x54, 0x13, 0x8d, 0x35, 0x95, 0x59, 0xbe, 0x5d, 0xdf, 0xfb, 0xc6, 0xd1, 0x7c, 0x2d, 0x74, 0x91, 0x54, 0x31, 0x04, 0x91, 0x03, 0xae, 0x43, 0x0b, 0x74, 0x09, 0x44, 0xc8, 0x2b, 0x90, 0x04, 0x8d, 0x03, 0x04, 0x10, 0xc6, 0x09, 0xc7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x54, 0x8a, 0x64, 0xc8, 0x4b, 0xa8, 0x53, 0x33, 0x4d, 0x9a, 0x26, 0x90, 0x34, 0x52, 0x2d, 0x72, 0x25, 0x33, 0x7d, 0x17, 0xae, 0x54, 0x95, 0x34, 0x3c, 0x59, 0x75, 0x39, 0xae, 0x18, 0xbe, 0xf8, 0xb5, 0xd6, 0xa5, 0x94, 0x85, 0x4f, 0x2c, 0x2f, 0x04, 0x8a, 0x33, 0x6f, 0x54, 0x92, 0x4c, 0x92, 0x5c, 0x32, 0x7d, 0xb2, 0x9d, 0xed, 0x64, 0x2a, 0x44, 0x91, 0x04, 0x49, 0x12, 0x05, 0x18, 0xc5, 0x99, 0x87, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2c, 0x86, 0x43, 0xe5, 0x32, 0x6a, 0x3c, 0x2c, 0x4d, 0xab, 0x44, 0xd3, 0x4d, 0x6b, 0x3c, 0x8c, 0x64, 0xf3, 0x84, 0xf7, 0xa5, 0x34, 0x65, 0x90, 0x3c, 0x93, 0x04, 0x92, 0x3c, 0x95, 0x9d, 0x96, 0xa5, 0xba, 0xc6, 0xd9, 0xc6, 0x56, 0xae, 0x0f, 0x75, 0x0f, 0x44, 0xed, 0x0b, 0x0f, 0x04, 0x8c, 0x0b, 0x31, 0x1c, 0xf0, 0x7c, 0x92, 0x8d, 0x73, 0x7d, 0x58, 0xce, 0x56, 0xb6, 0x71, 0x8d, 0x70, 0x4c, 0x2c, 0x53, 0x6c, 0x04, 0x87, 0x23, 0x2c, 0x22, 0xe0, 0x68, 0xa5, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x26, 0x04, 0x09, 0x15, 0x2d, 0x07, 0x67, 0x34, 0xcc, 0x74, 0x69, 0x7c, 0x2a, 0x6c, 0x0e, 0x74, 0x12, 0x85, 0xb2, 0x75, 0x13, 0x2d, 0x19, 0x06, 0x1d, 0x07, 0x19, 0x9e, 0x59, 0xbe, 0xd7, 0x8d, 0x75, 0x7d, 0xf7, 0xa5, 0x99, 0xb6, 0xd5, 0xa5, 0x53, 0x8d, 0x30, 0x75, 0x90, 0x4d, 0xad, 0x04, 0x4b, 0x04, 0x4c, 0x3c, 0x0f, 0x55, 0x73, 0x55, 0xd6, 0x95, 0x59, 0xa6, 0x35, 0xbe, 0xf2, 0x85, 0x30, 0x55, 0x93, 0xad, 0x8d, 0x6c, 0xaf, 0x7c, 0x31, 0x44, 0xa7, 0x5a, 0x60, 0x3a, 0x34, 0x05, 0xfe, 0x05, 0x71, 0x03, 0xa0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x7d, 0x0d, 0x95, 0xe9, 0x63, 0x06, 0x3b, 0xab, 0x64, 0x6d, 0x84, 0x11, 0x9d, 0x6a, 0x54, 0xed, 0x44, 0xce, 0x8c, 0x95, 0xa5, 0x95, 0x9d, 0x37, 0x35, 0x1a, 0x06, 0x5c, 0x46, 0xf4, 0x84, 0xd6, 0xad, 0x75, 0xa5, 0x98, 0xb6, 0x14, 0x96, 0x8f, 0x65, 0xcc, 0x44, 0x6b, 0x3c, 0x8c, 0x3c, 0x4f, 0x2d, 0x51, 0x6d, 0x92, 0x8d, 0xf3, 0x85, 0xf1, 0x85, 0xae, 0x3d, 0x14, 0x9e, 0xf5, 0xad, 0x92, 0x8d, 0xd1, 0x5d, 0xcf, 0x35, 0xd3, 0x9d, 0xb4, 0xa5, 0xf6, 0xb5, 0x4f, 0x54, 0x46, 0x5b, 0x25, 0x58, 0xef, 0x02, 0xdd, 0x05, 0xfa, 0x04, 0xe0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x1c, 0xe7, 0x5b, 0x04, 0x43, 0x44, 0x1b, 0xeb, 0x64, 0x8b, 0x8c, 0x11, 0x9d, 0x2b, 0x6c, 0x2f, 0x8c, 0x73, 0x94, 0x14, 0xbd, 0xaa, 0xb2, 0x09, 0x73, 0xea, 0x4b, 0xa0, 0x2b, 0xf0, 0x8c, 0xd3, 0x8c, 0x75, 0xa5, 0xf8, 0xb5, 0x38, 0xbe, 0xd3, 0xad, 0xce, 0x84, 0x8d, 0x5c, 0x6d, 0x5d, 0x6d, 0x35, 0x0c, 0x2d, 0xcd, 0x54, 0x0f, 0x6d, 0x90, 0x85, 0x8d, 0x45, 0xf3, 0x95, 0x56, 0xbe, 0x14, 0xb6, 0xf0, 0x85, 0xad, 0x05, 0x12, 0x8e, 0x10, 0x7d, 0xd2, 0x64, 0xd2, 0x65, 0xee, 0x05, 0x53, 0x8e, 0x75, 0x9e, 0x4f, 0x4c, 0xeb, 0x43, 0xaa, 0x4c, 0xea, 0x32, 0x80, 0x01, 0x2d, 0x02, 0x73, 0x03, 0xce, 0x0a, 0x71, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x03, 0xa6, 0x13, 0x8c, 0x35, 0x09, 0x25, 0xa9, 0x74, 0xeb, 0x8c, 0x4d, 0x8c, 0xac, 0x7b, 0x50, 0x8c, 0x15, 0xa5, 0xf2, 0x7b, 0xa7, 0x91, 0x86, 0xb1, 0x32, 0xc4, 0x10, 0xbc, 0xf0, 0xcb, 0x45, 0xb8, 0x6f, 0xc3, 0x55, 0xcd, 0x13, 0xad, 0x35, 0xa5, 0x32, 0x9d, 0xf1, 0x9d, 0xac, 0x7d, 0x6b, 0x55, 0xab, 0x3c, 0xad, 0x3c, 0x4e, 0x5d, 0xaf, 0x55, 0xd4, 0x9d, 0x56, 0xc6, 0x55, 0xbe, 0x11, 0x96, 0x6a, 0x1d, 0x12, 0x8e, 0x4f, 0x75, 0x4a, 0x54, 0x4f, 0x7d, 0xac, 0x05, 0x32, 0x7e, 0x1a, 0xcf, 0x75, 0x9e, 0x0f, 0x4e, 0x0e, 0x26, 0x0e, 0x0e, 0x4c, 0x05, 0x4b, 0x03, 0x8a, 0x4c, 0x8c, 0x3d, 0x47, 0x2b, 0x82, 0x13, 0x6a, 0x02, 0x0b, 0x02, 0x94, 0x03, 0xef, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0xc5, 0x6b, 0xc8, 0x73, 0x27, 0x5b, 0x26, 0x33, 0x8c, 0x74, 0x6c, 0x94, 0xad, 0x7b, 0x6d, 0x83, 0xad, 0x9b, 0x55, 0xbd, 0xb7, 0xc5, 0x11, 0xbc, 0x00, 0xb8, 0x00, 0xc0, 0x29, 0xd2, 0x73, 0xc4, 0xb4, 0xbc, 0x36, 0xe5, 0x55, 0xe5, 0x11, 0xc5, 0xcb, 0x7c, 0x27, 0x3c, 0x68, 0x4c, 0x8e, 0x5d, 0x90, 0x45, 0x6f, 0x5d, 0x50, 0x75, 0xd2, 0x95, 0xae, 0x7d, 0x4a, 0x45, 0xd3, 0x9d, 0xb2, 0xa5, 0x71, 0x9d, 0xaf, 0x7d, 0x68, 0x1d, 0x31, 0x76, 0xb8, 0xae, 0x77, 0xb6, 0xf2, 0x95, 0xcb, 0x1d, 0x0e, 0x36, 0x2f, 0x4e, 0x0d, 0x1e, 0x0e, 0x26, 0x0e, 0x2e, 0x0e, 0x2e, 0xec, 0x1c, 0x0a, 0x23, 0x4b, 0x4d, 0xed, 0x3d, 0x26, 0x33, 0x50, 0x0d, 0x19, 0x06, 0x8d, 0x02, 0xc8, 0x01, 0x05, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x07, 0xc9, 0x64, 0xec, 0x84, 0x6b, 0x55, 0xe8, 0x64, 0xcc, 0x73, 0x52, 0x94, 0xb8, 0xc5, 0x2b, 0xcb, 0x40, 0xda, 0x00, 0xd0, 0x6d, 0xdb, 0xf0, 0xb3, 0xf4, 0xcc, 0x73, 0xe4, 0x77, 0xe5, 0x76, 0xe5, 0x0f, 0xb4, 0xad, 0x9b, 0xeb, 0x9c, 0x86, 0x6d, 0xc5, 0x0d, 0x88, 0x1d, 0xeb, 0x4c, 0xee, 0x6c, 0x8f, 0x65, 0xaf, 0x75, 0x35, 0xb6, 0x75, 0xbe, 0x55, 0xbe, 0x8d, 0x6d, 0x47, 0x3d, 0xd1, 0x85, 0x6c, 0x54, 0x6f, 0x74, 0x70, 0x8d, 0x88, 0x35, 0xcb, 0x55, 0x94, 0x9e, 0x0f, 0x7e, 0xca, 0x45, 0xed, 0x2d, 0x2e, 0x2e, 0x2d, 0x26, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x0e, 0x2e, 0x4c, 0x14, 0x4a, 0x3b, 0xac, 0x4d, 0x0d, 0x46, 0x68, 0x33, 0xf1, 0x0d, 0xfd, 0x07, 0x38, 0x06, 0x00, 0x01, 0xa4, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x2b, 0x46, 0xc7, 0x7c, 0x85, 0x9b, 0x67, 0x8b, 0xd0, 0x9c, 0x2f, 0x95, 0x85, 0x8c, 0x20, 0x9c, 0x4a, 0x8b, 0x76, 0xc5, 0x35, 0xd5, 0x4f, 0xf5, 0xc0, 0xfb, 0x8e, 0xfb, 0x70, 0xcb, 0xb4, 0xb4, 0x15, 0xb5, 0x75, 0xe5, 0x4e, 0xdc, 0x25, 0xdb, 0xa0, 0xaa, 0xa6, 0x5b, 0x89, 0x45, 0xea, 0x4d, 0x8d, 0x7d, 0xd2, 0xa5, 0xf4, 0x9d, 0xf3, 0xa5, 0x8a, 0x65, 0x8c, 0x6d, 0x91, 0x95, 0xcc, 0x74, 0x0e, 0x85, 0x8c, 0x6d, 0x65, 0x3d, 0xf0, 0x75, 0x97, 0xb6, 0x54, 0xa6, 0xac, 0x6d, 0x88, 0x45, 0x88, 0x45, 0x65, 0x2d, 0x88, 0x2d, 0xec, 0x35, 0x2e, 0x36, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x36, 0xee, 0x2d, 0xcc, 0x1b, 0xea, 0x43, 0x0d, 0x46, 0x0d, 0x46, 0xea, 0x33, 0xa6, 0x7d, 0xeb, 0xa7, 0xf5, 0x5f, 0x09, 0x04, 0x20, 0x0a, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x07, 0x08, 0x75, 0x25, 0x84, 0x64, 0x73, 0xe4, 0x9a, 0x02, 0xba, 0xa0, 0xa0, 0xea, 0xa1, 0xb0, 0xb3, 0xa6, 0xcb, 0x60, 0xe9, 0x40, 0xeb, 0xe0, 0xc8, 0x49, 0xb2, 0x10, 0xc4, 0x97, 0xd5, 0xbb, 0xfe, 0xdc, 0xfe, 0xd5, 0xdc, 0x2c, 0xa3, 0x07, 0x9b, 0xe0, 0xda, 0x40, 0xd2, 0xe4, 0xd2, 0xca, 0x9b, 0x0f, 0x6d, 0x6e, 0x9d, 0xe6, 0x5c, 0x51, 0x95, 0xb4, 0xb5, 0x14, 0xbe, 0xd1, 0x9d, 0x88, 0x4d, 0x89, 0x5d, 0xd1, 0x95, 0xcd, 0x6c, 0xb0, 0x94, 0x6c, 0x6d, 0x86, 0x45, 0xa9, 0x5d, 0xcb, 0x6d, 0x86, 0x45, 0x86, 0x45, 0x87, 0x45, 0x87, 0x45, 0xaa, 0x3d, 0x0d, 0x36, 0x0e, 0x36, 0x2e, 0x36, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x36, 0x2e, 0x36, 0x90, 0x25, 0x53, 0x1b, 0xaa, 0x4c, 0x2d, 0x4e, 0x2d, 0x4e, 0xaa, 0x2c, 0xe2, 0xb2, 0x00, 0xef, 0xe0, 0xcf, 0x82, 0x75, 0x82, 0x01, 0x66, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xa4, 0xa6, 0xd3, 0x44, 0xdc, 0xa2, 0xaa, 0x22, 0x59, 0x65, 0x40, 0x00, 0x60, 0x60, 0xb1, 0x00, 0x99, 0x23, 0xa1, 0x42, 0xb1, 0x00, 0xa8, 0x03, 0xb8, 0xee, 0xea, 0x16, 0xfd, 0x19, 0xee, 0xd6, 0xc4, 0x93, 0xbc, 0xf3, 0xd4, 0xa9, 0xc2, 0x20, 0xe0, 0xa2, 0xa2, 0xc6, 0x8b, 0xe8, 0xa3, 0x48, 0xa4, 0x51, 0xbd, 0xb4, 0xbd, 0xd3, 0xbd, 0xaf, 0x9d, 0x00, 0x45, 0xd2, 0x95, 0x70, 0x85, 0xc5, 0x43, 0xad, 0x84, 0xa8, 0x5d, 0x86, 0x45, 0x32, 0x9e, 0x53, 0xae, 0xad, 0x7d, 0x67, 0x55, 0x86, 0x4d, 0x65, 0x4d, 0x65, 0x45, 0x86, 0x4d, 0x86, 0x4d, 0x88, 0x45, 0xeb, 0x3d, 0x0d, 0x36, 0x2e, 0x36, 0x2e, 0x36, 0x2e, 0x36, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x36, 0x2e, 0x36, 0x2e, 0x2e, 0x56, 0x15, 0x79, 0x2b, 0x4a, 0x55, 0x4e, 0x4e, 0x2d, 0x4e, 0x4c, 0x35, 0x23, 0x91, 0xc0, 0xf2, 0x20, 0xf7, 0x20, 0xc6, 0x01, 0x01, 0x26, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x7c, 0x64, 0xb2, 0x63, 0xe1, 0xc0, 0xf8, 0x20, 0xf0, 0x03, 0xc0, 0xe4, 0xa8, 0x80, 0xa1, 0x20, 0x8a, 0xa0, 0xa1, 0x00, 0xa0, 0xa8, 0xa9, 0x71, 0xb3, 0x37, 0xdd, 0x9b, 0xf6, 0x19, 0xfe, 0x93, 0xfc, 0xa7, 0xaa, 0xa0, 0x9a, 0xa0, 0xab, 0x43, 0x9b, 0xeb, 0xbb, 0x6c, 0xa4, 0x6e, 0x8d, 0x8c, 0x8d, 0x23, 0x65, 0x0e, 0x9d, 0x51, 0xb5, 0x2d, 0xbd, 0x0b, 0x85, 0x41, 0x55, 0x8c, 0x75, 0x15, 0xae, 0x53, 0xa5, 0xcf, 0x9c, 0x87, 0x55, 0x86, 0x4d, 0x87, 0x55, 0x85, 0x4d, 0x84, 0x4d, 0x66, 0x55, 0x66, 0x4d, 0x66, 0x4d, 0x66, 0x4d, 0x86, 0x4d, 0xa9, 0x45, 0x0c, 0x3e, 0x2e, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x4e, 0x36, 0x4e, 0x2e, 0x4e, 0x2e, 0x4e, 0x36, 0x4e, 0x36, 0x2d, 0x36, 0x75, 0x15, 0xb3, 0x43, 0xec, 0x55, 0x4e, 0x4e, 0x4d, 0x4e, 0xcd, 0x45, 0xa5, 0x6a, 0x00, 0xd8, 0x00, 0xfb, 0x40, 0xe4, 0x21, 0x39, 0xa4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xbb, 0x89, 0xa3, 0x2b, 0x44, 0x85, 0xa1, 0x83, 0xe0, 0xa1, 0xf0, 0xc0, 0xe0, 0x02, 0xd9, 0x68, 0xc1, 0x6e, 0xaa, 0x32, 0xc3, 0xf3, 0xcb, 0x53, 0xbc, 0xae, 0xcb, 0x27, 0xea, 0x00, 0xe0, 0x00, 0xd8, 0xe7, 0xab, 0x89, 0x8c, 0x09, 0x8d, 0x0a, 0x85, 0xb3, 0xb5, 0xd2, 0xb5, 0xf2, 0xbd, 0x8b, 0x8d, 0x40, 0x65, 0x4c, 0x95, 0xe8, 0x63, 0xc4, 0x4a, 0x08, 0x84, 0x84, 0x5d, 0x66, 0x65, 0x12, 0x9e, 0xce, 0x85, 0x67, 0x5d, 0x86, 0x4d, 0x86, 0x55, 0x86, 0x55, 0x86, 0x55, 0x86, 0x55, 0x66, 0x55, 0x66, 0x55, 0x66, 0x4d, 0x66, 0x4d, 0xca, 0x3d, 0x0d, 0x3e, 0x2e, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x2d, 0x36, 0x2e, 0x25, 0x4b, 0x4c, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x0e, 0x4e, 0x67, 0x4b, 0x00, 0xb0, 0x00, 0xd8, 0x00, 0xd8, 0xc0, 0x51, 0x84, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x92, 0x44, 0xba, 0x8b, 0x44, 0x89, 0x03, 0x65, 0xd1, 0xc0, 0xf9, 0x00, 0xc0, 0x0d, 0xc2, 0xb1, 0xca, 0xaf, 0xc2, 0x0a, 0xc2, 0xa0, 0xc1, 0xc0, 0x99, 0x40, 0xb1, 0x60, 0xda, 0xa7, 0xbb, 0xac, 0xac, 0x0b, 0xad, 0xab, 0xbd, 0x48, 0x85, 0xc6, 0x7c, 0xee, 0x9c, 0x0e, 0x9d, 0x2b, 0x94, 0x06, 0x85, 0x60, 0x6d, 0xac, 0x95, 0x11, 0xb5, 0xac, 0xa4, 0xe7, 0x9c, 0xa0, 0x6d, 0x63, 0x55, 0x61, 0x4d, 0x63, 0x4d, 0x65, 0x55, 0x66, 0x55, 0x86, 0x55, 0x86, 0x55, 0x86, 0x55, 0x66, 0x55, 0x65, 0x4d, 0x65, 0x4d, 0x87, 0x4d, 0xec, 0x3d, 0x2e, 0x3e, 0x2e, 0x3e, 0x2e, 0x3e, 0x2e, 0x3e, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0xcd, 0x2d, 0x2e, 0x1c, 0x0b, 0x4d, 0x2e, 0x56, 0xec, 0x55, 0x4e, 0x4e, 0x2e, 0x4e, 0x08, 0x44, 0x00, 0x78, 0x40, 0xa8, 0x80, 0xb8, 0x40, 0x52, 0xe3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x06, 0x25, 0x7a, 0xe1, 0x82, 0xe6, 0x6b, 0x85, 0x5b, 0x22, 0xe9, 0x00, 0xd0, 0x02, 0x98, 0x05, 0xea, 0xc0, 0xf1, 0x00, 0xa8, 0x08, 0xb0, 0x52, 0xc9, 0x0d, 0xa1, 0xa0, 0x82, 0x00, 0x7d, 0x0c, 0x8c, 0x52, 0xcd, 0xae, 0xc5, 0x4c, 0xb5, 0x03, 0x75, 0x06, 0x7d, 0x50, 0xad, 0x4a, 0x6b, 0xab, 0x82, 0x87, 0x84, 0xa0, 0x7d, 0xa6, 0x8d, 0xaa, 0xa5, 0xa1, 0x95, 0xa1, 0x8d, 0x81, 0x75, 0x64, 0x55, 0x65, 0x55, 0x65, 0x55, 0x66, 0x55, 0x65, 0x55, 0x66, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x4d, 0xa9, 0x4d, 0x2d, 0x3e, 0x2e, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x2e, 0x3e, 0x2e, 0x3e, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4f, 0x1d, 0x10, 0x2c, 0xac, 0x4d, 0xac, 0x65, 0x4a, 0x65, 0x2e, 0x4e, 0x4e, 0x4e, 0xaa, 0x44, 0x81, 0x60, 0x00, 0x80, 0xe0, 0x80, 0x00, 0x33, 0x22, 0x04, 0xe7, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x3c, 0x83, 0x39, 0x60, 0x23, 0x43, 0x3d, 0x67, 0x9b, 0x83, 0xca, 0xa2, 0x91, 0x09, 0x6a, 0xe8, 0xd1, 0x92, 0xf1, 0x39, 0xc1, 0x3e, 0xb1, 0xff, 0xa8, 0x0d, 0x70, 0x60, 0x6b, 0x81, 0x85, 0x4a, 0x94, 0x2b, 0x94, 0x0a, 0x7c, 0x48, 0xb3, 0xc0, 0x8c, 0x20, 0x75, 0xb2, 0xb5, 0x13, 0xcd, 0xcd, 0xb4, 0x43, 0x85, 0xa0, 0x8d, 0xa0, 0x8d, 0xa0, 0x8d, 0xa0, 0x95, 0xa0, 0x95, 0x82, 0x6d, 0x64, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x66, 0x4d, 0xeb, 0x45, 0x4e, 0x3e, 0x2e, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x2e, 0x3e, 0x2d, 0x3e, 0x2d, 0x36, 0x2d, 0x36, 0x4d, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x2e, 0x36, 0x2e, 0x36, 0x2d, 0x36, 0xb0, 0x0c, 0x0d, 0x3c, 0x0d, 0x4e, 0xed, 0x5d, 0x09, 0x6d, 0x2d, 0x56, 0x4e, 0x4e, 0x2b, 0x4d, 0xa6, 0x51, 0x01, 0x70, 0xa0, 0x59, 0x20, 0x03, 0x22, 0x04, 0x86, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x2c, 0xb2, 0x49, 0xa9, 0x18, 0x47, 0x64, 0x72, 0x7c, 0x46, 0xb4, 0x20, 0xd4, 0xa0, 0xb2, 0x40, 0xa0, 0x57, 0xb1, 0xbf, 0xb9, 0x9f, 0xa9, 0x19, 0x99, 0x00, 0x70, 0x20, 0x74, 0xa0, 0x85, 0xc7, 0x8c, 0x0d, 0x84, 0x6a, 0x7b, 0x0b, 0xbb, 0xa5, 0x9c, 0x60, 0x7d, 0x85, 0x8d, 0x84, 0x8d, 0x80, 0x8d, 0x80, 0x8d, 0x80, 0x8d, 0x80, 0x95, 0x80, 0x95, 0xa0, 0x95, 0x80, 0x8d, 0x63, 0x5d, 0x64, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x88, 0x4d, 0x0c, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4d, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x4d, 0x3e, 0x4e, 0x3e, 0x4e, 0x3e, 0x4d, 0x3e, 0x4d, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x2e, 0x36, 0x6b, 0x2d, 0xcd, 0x35, 0xee, 0x35, 0x2a, 0x14, 0x89, 0x44, 0x4e, 0x4e, 0x2e, 0x56, 0x0d, 0x56, 0x2d, 0x4e, 0x2d, 0x4e, 0xac, 0x4d, 0xaa, 0x3a, 0x04, 0x60, 0x40, 0x4a, 0x80, 0x03, 0x21, 0x03, 0x05, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x83, 0x34, 0x71, 0x2f, 0x90, 0x65, 0xd1, 0x04, 0xcc, 0x0b, 0xac, 0x49, 0xc4, 0x73, 0x7b, 0x4e, 0x71, 0x0c, 0x50, 0xf6, 0x90, 0x9e, 0xb1, 0x90, 0x80, 0x00, 0x68, 0xc0, 0x84, 0xa0, 0x8d, 0x48, 0x95, 0x74, 0xc5, 0x2f, 0xcd, 0x29, 0xb5, 0x42, 0x95, 0x60, 0x8d, 0x60, 0x8d, 0x60, 0x8d, 0x60, 0x8d, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0xa0, 0x95, 0x80, 0x85, 0x64, 0x5d, 0x44, 0x55, 0x64, 0x55, 0x65, 0x55, 0x45, 0x55, 0x45, 0x55, 0x65, 0x55, 0xca, 0x4d, 0x4d, 0x46, 0x4e, 0x46, 0x4d, 0x46, 0x4e, 0x46, 0x4d, 0x3e, 0x4d, 0x3e, 0x4d, 0x3e, 0x4d, 0x3e, 0x4e, 0x3e, 0x2e, 0x3e, 0x4d, 0x3e, 0x4e, 0x3e, 0x4e, 0x3e, 0x6e, 0x3e, 0x4e, 0x36, 0xad, 0x35, 0xcd, 0x35, 0xad, 0x2d, 0xe8, 0x2b, 0x2a, 0x45, 0x4e, 0x4e, 0x2d, 0x4e, 0x0d, 0x4e, 0x0d, 0x4e, 0x2d, 0x56, 0xec, 0x55, 0x89, 0x33, 0x65, 0x50, 0xe0, 0x32, 0xe1, 0x03, 0x41, 0x02, 0xa5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x07, 0xc8, 0xc3, 0x20, 0xd1, 0x22, 0xea, 0x80, 0xd1, 0xc0, 0xaa, 0xaa, 0x83, 0x0f, 0xc4, 0xb7, 0x8b, 0xf0, 0x89, 0x07, 0x68, 0x08, 0x88, 0xae, 0xa8, 0x05, 0x78, 0x20, 0x69, 0x20, 0x8d, 0xa0, 0x8d, 0x81, 0x95, 0x85, 0x95, 0x60, 0x95, 0x60, 0x8d, 0x60, 0x95, 0x60, 0x8d, 0x60, 0x8d, 0x60, 0x8d, 0x60, 0x8d, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x61, 0x75, 0x64, 0x5d, 0x44, 0x5d, 0x44, 0x5d, 0x44, 0x55, 0x44, 0x55, 0x86, 0x55, 0x0b, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6d, 0x46, 0x4d, 0x46, 0x4e, 0x46, 0x4d, 0x46, 0x4d, 0x3e, 0x4d, 0x3e, 0x6e, 0x3e, 0xed, 0x3d, 0x2b, 0x2d, 0x0d, 0x36, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x0e, 0x36, 0x2f, 0x3e, 0x4c, 0x2d, 0x08, 0x3c, 0x6b, 0x45, 0x2d, 0x4e, 0x2d, 0x4e, 0x4d, 0x56, 0x4d, 0x56, 0x4d, 0x56, 0x0c, 0x56, 0x28, 0x3c, 0xa4, 0x39, 0x60, 0x23, 0x22, 0x04, 0x40, 0x02, 0x64, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x06, 0xc5, 0xab, 0x02, 0xc1, 0x85, 0xd9, 0x45, 0xc1, 0x85, 0x93, 0x65, 0x8c, 0xaa, 0xe9, 0xaa, 0xd1, 0x00, 0x90, 0x01, 0x68, 0x12, 0x98, 0x2e, 0xa0, 0x00, 0x70, 0x80, 0x62, 0x60, 0x8d, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x8d, 0x60, 0x8d, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x8d, 0x62, 0x65, 0x43, 0x5d, 0x44, 0x5d, 0x44, 0x5d, 0x44, 0x55, 0xa8, 0x4d, 0x2d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6d, 0x46, 0x4d, 0x46, 0x4d, 0x46, 0x4d, 0x3e, 0x6e, 0x46, 0xcd, 0x3d, 0xaa, 0x24, 0xad, 0x35, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x4e, 0x3e, 0xee, 0x35, 0xcb, 0x34, 0x49, 0x44, 0xcc, 0x4d, 0x4d, 0x56, 0x6d, 0x56, 0x4d, 0x56, 0x2c, 0x5e, 0x4d, 0x56, 0x2d, 0x5e, 0x88, 0x4c, 0x65, 0x22, 0xa3, 0x03, 0x23, 0x04, 0x80, 0x02, 0xe4, 0x0a, 0x49, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x05, 0x00, 0x55, 0x86, 0x92, 0x0e, 0x80, 0x13, 0x99, 0x28, 0x84, 0xe6, 0x5c, 0x60, 0xd1, 0x00, 0xc8, 0xe0, 0xd0, 0x00, 0xb1, 0x48, 0x88, 0x0a, 0xa1, 0x80, 0x63, 0x42, 0x45, 0xc1, 0x6d, 0x80, 0x85, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x60, 0x7d, 0x43, 0x5d, 0x43, 0x5d, 0x42, 0x5d, 0x64, 0x55, 0xea, 0x4d, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0xed, 0x3d, 0xed, 0x45, 0x4e, 0x46, 0x4d, 0x46, 0x4d, 0x46, 0x4e, 0x46, 0x2e, 0x3e, 0x4c, 0x35, 0xed, 0x3d, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x2d, 0x36, 0x2e, 0x36, 0xcd, 0x2d, 0x8c, 0x3c, 0xea, 0x44, 0x2c, 0x4e, 0x4d, 0x56, 0x6d, 0x56, 0xcb, 0x65, 0xa7, 0x74, 0x0c, 0x5e, 0x4d, 0x5e, 0x0a, 0x4d, 0xc8, 0x1a, 0x27, 0x03, 0x04, 0x04, 0x01, 0x03, 0x82, 0x0a, 0x68, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x0c, 0xc0, 0x24, 0x06, 0x84, 0xca, 0xa9, 0x8a, 0xcc, 0xc4, 0x5c, 0xc7, 0x44, 0x63, 0xba, 0x67, 0xc9, 0x64, 0xc9, 0xe0, 0xc0, 0x00, 0xd0, 0x20, 0xaa, 0x62, 0x2d, 0xe3, 0x45, 0xe3, 0x55, 0x80, 0x5d, 0x60, 0x75, 0x80, 0x8d, 0x80, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x8d, 0x61, 0x6d, 0x43, 0x5d, 0x42, 0x5d, 0x86, 0x55, 0x2c, 0x4e, 0x6f, 0x46, 0x8f, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6d, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0xad, 0x3d, 0xad, 0x45, 0x4e, 0x46, 0x4e, 0x46, 0x4d, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4e, 0x3e, 0x4e, 0x3e, 0x2e, 0x3e, 0x2e, 0x3e, 0x4e, 0x3e, 0x6e, 0x3e, 0x4e, 0x36, 0xac, 0x35, 0x4b, 0x4c, 0x4b, 0x45, 0x4c, 0x56, 0x4d, 0x56, 0x6d, 0x56, 0x0c, 0x66, 0xc9, 0x74, 0xec, 0x65, 0x6d, 0x5e, 0x6b, 0x55, 0xe8, 0x2a, 0xca, 0x02, 0x67, 0x03, 0x00, 0x03, 0xc8, 0x19, 0x29, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x0e, 0x68, 0x05, 0x2c, 0x3d, 0x8c, 0xd5, 0x20, 0xcd, 0xe5, 0x2c, 0x88, 0x54, 0xe6, 0xb2, 0x26, 0xd1, 0x44, 0xd9, 0x68, 0xe0, 0x05, 0xd8, 0xe0, 0x48, 0x02, 0x2d, 0x04, 0x4e, 0x24, 0x56, 0xc1, 0x55, 0x60, 0x55, 0x80, 0x65, 0x80, 0x75, 0x60, 0x8d, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x60, 0x8d, 0x41, 0x65, 0x42, 0x5d, 0xc9, 0x55, 0x4e, 0x4e, 0x6f, 0x46, 0x6f, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0xee, 0x45, 0x8d, 0x3d, 0x2e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x2e, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x2e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x46, 0x6e, 0x3e, 0x4d, 0x36, 0x0b, 0x2d, 0x4a, 0x54, 0xcb, 0x4d, 0x6c, 0x56, 0x4c, 0x5e, 0x4d, 0x5e, 0x0c, 0x5e, 0x66, 0x7c, 0x8a, 0x6d, 0x6d, 0x56, 0xcb, 0x55, 0x48, 0x33, 0xeb, 0x0a, 0xb0, 0x02, 0x50, 0x02, 0x2e, 0x19, 0x89, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x5a, 0x84, 0x25, 0x12, 0x07, 0xf8, 0x06, 0x35, 0x8d, 0x60, 0x94, 0x25, 0x3d, 0xe9, 0x6b, 0x28, 0x93, 0x20, 0xc1, 0x6a, 0xc8, 0x76, 0xa8, 0x28, 0x78, 0x00, 0x00, 0x82, 0x3c, 0x24, 0x56, 0x24, 0x56, 0x03, 0x56, 0xa1, 0x5d, 0x80, 0x5d, 0x80, 0x5d, 0x80, 0x65, 0x80, 0x7d, 0x60, 0x95, 0x60, 0x9d, 0x80, 0x95, 0x60, 0x95, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x60, 0x85, 0x64, 0x5d, 0xea, 0x4d, 0x6e, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x4e, 0x46, 0x4d, 0x45, 0x2e, 0x4e, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x2e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x2e, 0x3e, 0x0d, 0x3e, 0x2d, 0x3e, 0x4e, 0x3e, 0x6e, 0x46, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x6e, 0x3e, 0x0d, 0x36, 0x48, 0x34, 0x68, 0x44, 0x2c, 0x56, 0x6c, 0x56, 0x4d, 0x56, 0x4d, 0x5e, 0x2d, 0x5e, 0x8a, 0x6d, 0x0b, 0x66, 0x4d, 0x5e, 0x0c, 0x5e, 0xa8, 0x43, 0x8e, 0x12, 0x3a, 0x02, 0xdd, 0x01, 0xef, 0x08, 0x20, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x05, 0xd1, 0x06, 0x2f, 0x6e, 0x6e, 0x84, 0xb3, 0x4a, 0x67, 0x64, 0x26, 0x4d, 0xac, 0x6b, 0x4b, 0x8b, 0x20, 0xa9, 0x6d, 0xd0, 0x4f, 0x78, 0x00, 0x28, 0x20, 0x68, 0x41, 0xb4, 0x24, 0x4e, 0x04, 0x56, 0x04, 0x56, 0xe3, 0x55, 0x80, 0x5d, 0x80, 0x5d, 0x60, 0x5d, 0x80, 0x5d, 0x60, 0x75, 0x60, 0x8d, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x60, 0x95, 0x85, 0x6d, 0x2c, 0x4e, 0x8e, 0x46, 0x6e, 0x46, 0x6e, 0x4e, 0x6e, 0x4e, 0x6f, 0x46, 0xad, 0x45, 0xad, 0x45, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x2e, 0x46, 0x2e, 0x46, 0x2e, 0x46, 0x4e, 0x3e, 0x6e, 0x3e, 0x6d, 0x3e, 0x6d, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x4e, 0x3e, 0xcc, 0x3d, 0xea, 0x44, 0x88, 0x3c, 0x6c, 0x56, 0x6c, 0x56, 0x4c, 0x66, 0x4d, 0x66, 0x4c, 0x5e, 0x4d, 0x66, 0x4c, 0x5e, 0x4c, 0x5e, 0x2c, 0x5e, 0x68, 0x4c, 0xd6, 0x19, 0x7e, 0x01, 0xbf, 0x01, 0x90, 0x40, 0xe0, 0x4a, 0xab, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x66, 0x93, 0x86, 0xc8, 0xc4, 0x20, 0xb4, 0xa9, 0x7c, 0xa5, 0x34, 0xe7, 0x4c, 0x6d, 0x63, 0xae, 0x6b, 0x27, 0x6a, 0x09, 0xd8, 0x41, 0xd8, 0x40, 0x60, 0x60, 0xdb, 0x40, 0xf4, 0x04, 0x5e, 0x24, 0x4e, 0x04, 0x56, 0x04, 0x56, 0xe3, 0x55, 0x80, 0x5d, 0x60, 0x5d, 0x60, 0x65, 0x60, 0x5d, 0x80, 0x65, 0x80, 0x75, 0x80, 0x8d, 0x80, 0x95, 0x80, 0x95, 0xc7, 0x7d, 0x2d, 0x4e, 0x2e, 0x46, 0x0d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x2e, 0x46, 0x6f, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x2d, 0x46, 0x0d, 0x46, 0x2d, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4d, 0x3e, 0x4e, 0x3e, 0x4d, 0x3e, 0x4d, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x0d, 0x3e, 0x8c, 0x3d, 0x2b, 0x45, 0xc8, 0x44, 0x4c, 0x56, 0x6c, 0x56, 0x2c, 0x86, 0x2c, 0x86, 0x4c, 0x5e, 0x4c, 0x5e, 0x2c, 0x66, 0x2c, 0x5e, 0x2c, 0x5e, 0xe9, 0x4c, 0x90, 0x39, 0x79, 0x10, 0x1c, 0x01, 0x0a, 0x50, 0x62, 0x4b, 0x2a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0xc9, 0xc4, 0x20, 0xa5, 0x00, 0xb6, 0x60, 0x8d, 0x02, 0x35, 0x44, 0x5c, 0xc8, 0x72, 0x6b, 0x73, 0x49, 0x73, 0x00, 0xa0, 0x00, 0xe0, 0xa0, 0xda, 0xa0, 0xfc, 0x40, 0xfc, 0xa3, 0x8d, 0x24, 0x46, 0x05, 0x56, 0x04, 0x56, 0x04, 0x56, 0xc2, 0x5d, 0x60, 0x65, 0x60, 0x65, 0x60, 0x65, 0x80, 0x65, 0x80, 0x5d, 0x80, 0x6d, 0x80, 0x85, 0x09, 0x76, 0x6e, 0x56, 0x2d, 0x46, 0xac, 0x45, 0x2d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6f, 0x46, 0x4e, 0x46, 0x2d, 0x46, 0x2e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x3e, 0x4d, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0xec, 0x3d, 0x8c, 0x3d, 0x4b, 0x45, 0xcb, 0x55, 0x4c, 0x5e, 0x4c, 0x5e, 0x4c, 0x7e, 0x2b, 0x96, 0x2c, 0x56, 0x2c, 0x5e, 0x2c, 0x6e, 0x2c, 0x66, 0x2c, 0x66, 0x6a, 0x55, 0x09, 0x4a, 0x11, 0x40, 0x33, 0x28, 0x82, 0x48, 0xc5, 0x23, 0x89, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x8a, 0x00, 0xd8, 0x40, 0xb3, 0xe0, 0xc5, 0x21, 0xb6, 0xa2, 0x44, 0x61, 0x73, 0x82, 0x7a, 0x82, 0x7a, 0x68, 0x6b, 0xa2, 0x89, 0x00, 0xe2, 0x20, 0xfa, 0x60, 0xf3, 0xa0, 0xfb, 0xa1, 0x9c, 0x24, 0x46, 0x05, 0x56, 0x05, 0x56, 0x05, 0x56, 0x04, 0x56, 0x81, 0x5d, 0x60, 0x65, 0x60, 0x65, 0x41, 0x5d, 0x04, 0x55, 0xa5, 0x55, 0xe8, 0x4d, 0x2b, 0x46, 0x4d, 0x4e, 0x6d, 0x4e, 0x6e, 0x4e, 0x6e, 0x46, 0x6e, 0x46, 0x4d, 0x46, 0x4d, 0x46, 0x2e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x4d, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4d, 0x36, 0xab, 0x45, 0x8b, 0x3d, 0x6a, 0x4d, 0x2b, 0x56, 0x6c, 0x5e, 0x4c, 0x5e, 0x2c, 0x66, 0x2c, 0x7e, 0x2c, 0x66, 0x4c, 0x66, 0x4c, 0x66, 0x2c, 0x66, 0x2c, 0x66, 0xcb, 0x65, 0xcc, 0x4a, 0x0a, 0x60, 0x06, 0x70, 0xe5, 0x49, 0xa5, 0x03, 0xe8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0xe2, 0x01, 0x07, 0xb8, 0x09, 0xc0, 0x03, 0x88, 0x89, 0x83, 0x61, 0x64, 0x00, 0x73, 0xa0, 0x72, 0x40, 0x72, 0x48, 0x63, 0x04, 0xca, 0xe0, 0xf9, 0x80, 0xf1, 0x00, 0xd0, 0x02, 0xd8, 0xc6, 0xb3, 0x24, 0x4e, 0x05, 0x56, 0x25, 0x56, 0x05, 0x56, 0x05, 0x56, 0xe3, 0x5d, 0x80, 0x65, 0xa4, 0x5d, 0x47, 0x45, 0xa7, 0x44, 0xca, 0x45, 0x2b, 0x3e, 0x0a, 0x3e, 0x0b, 0x3e, 0x2c, 0x46, 0x4d, 0x46, 0x4d, 0x46, 0x2d, 0x46, 0x2e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x8e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x4e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x8e, 0x3e, 0x0d, 0x36, 0x8a, 0x45, 0x8b, 0x3d, 0x89, 0x4d, 0x4b, 0x4e, 0x4b, 0x56, 0x2b, 0x5e, 0x4b, 0x5e, 0x4c, 0x6e, 0x4c, 0x6e, 0x4c, 0x66, 0xcb, 0x75, 0xa6, 0x8c, 0xeb, 0x6d, 0x0c, 0x66, 0x8e, 0x4b, 0x0e, 0x68, 0x00, 0x78, 0x04, 0x53, 0x84, 0x03, 0x87, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x23, 0x60, 0x01, 0x0c, 0x70, 0x17, 0xc8, 0x16, 0x99, 0x8c, 0x9b, 0x00, 0x6c, 0x40, 0x63, 0x00, 0x63, 0xa0, 0x6a, 0x48, 0x63, 0xa7, 0xaa, 0xa0, 0xf9, 0x83, 0xf0, 0x05, 0xd8, 0x09, 0xc0, 0xae, 0xb2, 0x04, 0x5e, 0x24, 0x56, 0x05, 0x5e, 0x05, 0x5e, 0x05, 0x5e, 0x26, 0x56, 0x08, 0x4e, 0xe9, 0x3d, 0xea, 0x45, 0x08, 0x4d, 0xea, 0x3d, 0x4b, 0x3e, 0x0b, 0x3e, 0x0b, 0x3e, 0xeb, 0x3d, 0x0c, 0x46, 0x4e, 0x46, 0x6f, 0x46, 0x8f, 0x46, 0x8e, 0x46, 0x6d, 0x46, 0x6d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x8e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0xec, 0x35, 0x8a, 0x4d, 0x6a, 0x45, 0xc9, 0x4d, 0x4b, 0x5e, 0x6b, 0x5e, 0x6b, 0x5e, 0x6b, 0x5e, 0x4b, 0x8e, 0x4c, 0x76, 0x49, 0x7d, 0x29, 0x85, 0xe8, 0x84, 0xaa, 0x75, 0x2d, 0x6e, 0x4c, 0x54, 0xed, 0x60, 0xe0, 0x78, 0x47, 0x3c, 0x06, 0x04, 0x05, 0x04, 0xee, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x1b, 0x05, 0x01, 0x0d, 0x10, 0x18, 0xb0, 0x7a, 0xc1, 0x89, 0x9c, 0x40, 0x84, 0x20, 0x5b, 0x40, 0x63, 0x00, 0x63, 0x45, 0x6b, 0x6a, 0x73, 0x4e, 0xbc, 0xb5, 0xd4, 0x0a, 0xf8, 0x03, 0xe8, 0x21, 0xc1, 0x84, 0x6d, 0x25, 0x56, 0x05, 0x5e, 0x05, 0x56, 0x07, 0x4e, 0x2a, 0x3e, 0x4c, 0x36, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x46, 0x4b, 0x3e, 0x0b, 0x3e, 0x0b, 0x3e, 0x0b, 0x3e, 0x2c, 0x3e, 0x0b, 0x3e, 0x4d, 0x3e, 0x6e, 0x46, 0x8e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6f, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x8e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4d, 0x3e, 0x6d, 0x3e, 0x6d, 0x3e, 0x8e, 0x3e, 0x8e, 0x3e, 0x4d, 0x3e, 0xcb, 0x35, 0xcb, 0x4d, 0x6a, 0x55, 0x2b, 0x56, 0x6b, 0x5e, 0x4b, 0x5e, 0x2b, 0x5e, 0x6b, 0x5e, 0x4c, 0x7e, 0x4d, 0x7e, 0xaa, 0x7d, 0x49, 0x85, 0x08, 0x85, 0xaa, 0x7d, 0x4d, 0x6e, 0x0a, 0x5d, 0xe5, 0x71, 0x41, 0x72, 0xe8, 0x14, 0xa7, 0x04, 0x02, 0x0c, 0x87, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0a, 0x66, 0x01, 0x0a, 0x00, 0xca, 0x82, 0x6a, 0x8b, 0x24, 0x75, 0x41, 0x84, 0x00, 0x5b, 0x60, 0x63, 0x40, 0x63, 0x40, 0x63, 0xd0, 0x5b, 0xb1, 0x64, 0x8c, 0x74, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x04, 0x5d, 0x45, 0x5e, 0x26, 0x56, 0x29, 0x46, 0x4b, 0x36, 0x4b, 0x36, 0x2b, 0x36, 0x2b, 0x3e, 0x0b, 0x3e, 0x0b, 0x3e, 0x0b, 0x3e, 0x2b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x4c, 0x3e, 0x6d, 0x3e, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x4d, 0x3e, 0x6e, 0x3e, 0x6d, 0x3e, 0x6d, 0x3e, 0x6e, 0x3e, 0xec, 0x3d, 0xeb, 0x35, 0xeb, 0x3d, 0x89, 0x55, 0x4b, 0x56, 0xea, 0x55, 0x69, 0x4d, 0xa7, 0x3c, 0x2b, 0x5e, 0x6c, 0x6e, 0x4c, 0x6e, 0x2b, 0x6e, 0x08, 0x8d, 0xc7, 0x94, 0x89, 0x85, 0x6c, 0x6e, 0x8a, 0x5d, 0xa7, 0x62, 0x63, 0x6b, 0xc6, 0x04, 0x6e, 0x05, 0xb7, 0x06, 0xd7, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x41, 0x02, 0x60, 0x01, 0x60, 0x02, 0x80, 0x5c, 0xe0, 0x6c, 0x22, 0x4d, 0xe1, 0x63, 0x20, 0x63, 0x40, 0x63, 0x40, 0x63, 0x40, 0x63, 0x60, 0x7b, 0x91, 0x64, 0x4f, 0x3c, 0x20, 0x09, 0x01, 0x81, 0x02, 0x88, 0x23, 0x5c, 0x47, 0x46, 0x4b, 0x3e, 0x4c, 0x36, 0x4c, 0x36, 0x4b, 0x36, 0x4b, 0x36, 0x2b, 0x36, 0x2b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2c, 0x3e, 0x2b, 0x36, 0x4c, 0x3e, 0x6e, 0x46, 0x8f, 0x46, 0x8e, 0x46, 0x8e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x3e, 0x4e, 0x3e, 0x6e, 0x3e, 0x8e, 0x3e, 0x6d, 0x3e, 0xeb, 0x3d, 0x2c, 0x36, 0xca, 0x35, 0xc9, 0x55, 0x6b, 0x5e, 0xe8, 0x44, 0x08, 0x4d, 0xc8, 0x44, 0xca, 0x55, 0x4b, 0x6e, 0x6c, 0x6e, 0x4c, 0x6e, 0xea, 0x7d, 0x2b, 0x76, 0x6b, 0x6e, 0x6b, 0x66, 0xea, 0x65, 0x4a, 0x53, 0x69, 0x4c, 0x75, 0x06, 0xbe, 0x07, 0xdf, 0x07, 0x34, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xe1, 0x01, 0xc0, 0x1b, 0x80, 0x14, 0x60, 0x3b, 0xc2, 0x64, 0x43, 0x55, 0x80, 0x6b, 0x40, 0x6b, 0x20, 0x63, 0x20, 0x5b, 0xa0, 0xac, 0x40, 0xcd, 0xd1, 0x4c, 0x52, 0x2d, 0x20, 0x2a, 0xa1, 0x01, 0x83, 0x01, 0x65, 0x33, 0x4b, 0x36, 0x4c, 0x36, 0x4c, 0x36, 0x4c, 0x36, 0x4c, 0x36, 0x4c, 0x36, 0x4c, 0x3e, 0x4c, 0x3e, 0x4b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x2b, 0x3e, 0x4c, 0x3e, 0x4b, 0x36, 0x4b, 0x36, 0x4c, 0x3e, 0x6d, 0x3e, 0x6e, 0x46, 0x8f, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x8e, 0x46, 0x8e, 0x3e, 0x2d, 0x3e, 0x29, 0x2d, 0x0c, 0x2e, 0xa9, 0x35, 0x0a, 0x66, 0x6b, 0x6e, 0xc9, 0x5d, 0x08, 0x4d, 0x87, 0x3c, 0xa9, 0x5d, 0x6b, 0x6e, 0x4b, 0x76, 0x4b, 0x6e, 0x6b, 0x6e, 0x4b, 0x6e, 0x4b, 0x76, 0x4d, 0xa6, 0x2b, 0x8e, 0xe8, 0x43, 0x98, 0x16, 0xff, 0x07, 0xff, 0x07, 0x5d, 0x07, 0x8d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x7d, 0x61, 0x44, 0x80, 0x0c, 0x03, 0x05, 0x04, 0x24, 0xc3, 0x3c, 0x02, 0x5d, 0x40, 0x6b, 0x40, 0x63, 0x00, 0x5b, 0xa0, 0xa4, 0x00, 0xee, 0xe0, 0xe5, 0x81, 0x6c, 0xf2, 0x35, 0x0b, 0x03, 0xe0, 0x01, 0x01, 0x02, 0x2e, 0x03, 0x2d, 0x2e, 0x4b, 0x36, 0x4b, 0x36, 0x4c, 0x36, 0x4c, 0x36, 0x4c, 0x36, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x2b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x36, 0x4c, 0x36, 0x4d, 0x3e, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x8e, 0x46, 0xcc, 0x3d, 0x4a, 0x35, 0x48, 0x2c, 0x49, 0x25, 0xe9, 0x4d, 0x6b, 0x66, 0x4a, 0x6e, 0xe9, 0x65, 0x48, 0x55, 0x69, 0x5d, 0x2a, 0x6e, 0x4b, 0x6e, 0x6b, 0x86, 0x4b, 0x76, 0x4c, 0x6e, 0x4d, 0x76, 0x6d, 0x96, 0x6c, 0x9e, 0x4a, 0x76, 0xa2, 0x4c, 0xb8, 0x06, 0xff, 0x07, 0xff, 0x07, 0x1b, 0x07, 0x8b, 0x0c, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9f, 0x84, 0x6e, 0x06, 0x05, 0x72, 0x16, 0xa8, 0x45, 0xe1, 0x44, 0x62, 0x64, 0x00, 0x63, 0x00, 0x5b, 0xc0, 0xac, 0x20, 0xee, 0x20, 0xf6, 0x00, 0xe6, 0x61, 0x74, 0x4f, 0x04, 0xf1, 0x03, 0x63, 0x02, 0x60, 0x01, 0xf8, 0x04, 0x31, 0x2e, 0x4a, 0x36, 0x2c, 0x36, 0x2c, 0x36, 0x4c, 0x36, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x36, 0x4c, 0x3e, 0x4c, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x4d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x8e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x8e, 0x46, 0xea, 0x2c, 0xa9, 0x2c, 0xea, 0x34, 0xc8, 0x2c, 0x29, 0x56, 0xab, 0x5e, 0x2a, 0x6e, 0x2a, 0x6e, 0x0a, 0x6e, 0x4a, 0x76, 0x4b, 0x76, 0x4b, 0x76, 0x4b, 0x86, 0x4b, 0x7e, 0x4c, 0x76, 0x6c, 0x7e, 0x6a, 0x7e, 0x6a, 0x6e, 0x49, 0x6e, 0x25, 0x5d, 0x6f, 0x05, 0xdd, 0x07, 0xff, 0x07, 0x98, 0x06, 0x67, 0x04, 0xcb, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 0xe5, 0x0d, 0xc6, 0x0d, 0x52, 0x1e, 0x4a, 0x4d, 0x00, 0x55, 0xe2, 0x63, 0xe0, 0x52, 0xc0, 0xac, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xee, 0x21, 0xee, 0xa4, 0x84, 0xc0, 0x02, 0xce, 0x03, 0xc9, 0x02, 0x28, 0x02, 0xdd, 0x06, 0x34, 0x26, 0x4a, 0x36, 0x2c, 0x36, 0x2c, 0x36, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x0b, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2d, 0x3e, 0x4d, 0x46, 0x4d, 0x46, 0x8e, 0x46, 0x8e, 0x46, 0x8e, 0x46, 0x2d, 0x3e, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x8a, 0x3d, 0xca, 0x34, 0xa9, 0x34, 0xa7, 0x2c, 0x69, 0x5e, 0xaa, 0x6e, 0x29, 0x76, 0x2a, 0x76, 0x2a, 0x76, 0x2a, 0x76, 0x4b, 0x76, 0x2b, 0x76, 0x2a, 0x8e, 0x69, 0x96, 0x89, 0x86, 0x69, 0x7e, 0xe8, 0x7d, 0x66, 0x7d, 0x69, 0x76, 0xa8, 0x65, 0x60, 0x1c, 0x4d, 0x06, 0xdc, 0x07, 0x94, 0x05, 0x20, 0x03, 0x6a, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x66, 0xeb, 0x2c, 0x46, 0x04, 0xe3, 0x14, 0x00, 0x33, 0x40, 0x6c, 0x23, 0x5d, 0x41, 0x53, 0xe0, 0xb4, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xee, 0x20, 0xf6, 0x21, 0xee, 0x27, 0x7d, 0x01, 0x03, 0x84, 0x03, 0x28, 0x02, 0x51, 0x04, 0xff, 0x07, 0xb8, 0x1e, 0x2b, 0x36, 0x4c, 0x3e, 0x4d, 0x46, 0x4d, 0x46, 0x4c, 0x46, 0x4d, 0x46, 0x4c, 0x46, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x6d, 0x46, 0x8e, 0x46, 0x8e, 0x46, 0x4d, 0x3e, 0x8e, 0x46, 0x8e, 0x46, 0x2d, 0x3e, 0x69, 0x34, 0x4b, 0x35, 0x8e, 0x46, 0x6e, 0x46, 0x6d, 0x3e, 0x4d, 0x3e, 0xa9, 0x55, 0x4a, 0x45, 0xab, 0x25, 0x88, 0x3d, 0xa6, 0x8e, 0x88, 0x7e, 0x29, 0x76, 0x29, 0x76, 0x2a, 0x76, 0x2a, 0x7e, 0x4a, 0x86, 0x4a, 0x86, 0x49, 0x96, 0x68, 0xb6, 0x48, 0x86, 0x46, 0x8d, 0x87, 0x85, 0x05, 0x8d, 0x49, 0x7e, 0x08, 0x76, 0x65, 0x34, 0x80, 0x0d, 0x29, 0x16, 0xac, 0x1b, 0x8a, 0x02, 0xa8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x5e, 0xc7, 0x34, 0x24, 0x24, 0x61, 0x1a, 0x80, 0x28, 0xc1, 0x6c, 0x02, 0x65, 0x00, 0xbd, 0x20, 0xee, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x02, 0xe6, 0x69, 0x55, 0x04, 0x04, 0xe0, 0x0b, 0x61, 0x1b, 0x5a, 0x06, 0xff, 0x07, 0x7c, 0x17, 0x4c, 0x3e, 0x6d, 0x46, 0x6d, 0x46, 0x6d, 0x46, 0x6d, 0x46, 0x6d, 0x46, 0x4c, 0x46, 0x2c, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x2b, 0x3e, 0x2c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2c, 0x3e, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x3e, 0x4c, 0x3e, 0x6d, 0x3e, 0x8e, 0x46, 0x8e, 0x46, 0x8d, 0x3e, 0x8e, 0x3e, 0x8e, 0x3e, 0x4d, 0x3e, 0x49, 0x2c, 0x69, 0x2c, 0x6e, 0x3e, 0x6e, 0x3e, 0x4d, 0x3e, 0x0c, 0x46, 0xe8, 0x6d, 0x4c, 0x56, 0x2d, 0x06, 0x06, 0x8e, 0xe2, 0xc6, 0x47, 0x7e, 0x29, 0x76, 0x29, 0x7e, 0x4a, 0x86, 0x6b, 0x8e, 0x6a, 0x8e, 0x4a, 0x86, 0x4a, 0x8e, 0x28, 0xb6, 0x28, 0x86, 0x04, 0x8d, 0xc7, 0x7d, 0x66, 0x85, 0x69, 0x7e, 0x49, 0x76, 0x86, 0x44, 0xc4, 0x05, 0xa0, 0x25, 0xe3, 0x52, 0x89, 0x2a, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9f, 0xe1, 0x85, 0xa0, 0x2a, 0x00, 0x00, 0xc0, 0x51, 0xe1, 0x74, 0xc1, 0xbd, 0x20, 0xf6, 0x20, 0xee, 0x00, 0xee, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0xe3, 0xd5, 0x89, 0x2d, 0x07, 0x0c, 0x86, 0x0c, 0x60, 0x24, 0x16, 0x06, 0xff, 0x07, 0xff, 0x07, 0x90, 0x3e, 0x4c, 0x46, 0x6c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x2c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x0c, 0x3e, 0x0c, 0x3e, 0x0c, 0x3e, 0x4c, 0x46, 0x6c, 0x46, 0x4c, 0x46, 0x2c, 0x3e, 0xeb, 0x3d, 0x4c, 0x3e, 0x8d, 0x3e, 0x8e, 0x46, 0x8e, 0x46, 0x8e, 0x3e, 0x6e, 0x3e, 0xeb, 0x34, 0xaa, 0x34, 0x4e, 0x3e, 0x6e, 0x46, 0x4d, 0x3e, 0xea, 0x5d, 0x08, 0x7e, 0x8d, 0x56, 0xeb, 0x05, 0x03, 0xae, 0x85, 0xc6, 0x28, 0x7e, 0x28, 0x86, 0x49, 0x86, 0x6a, 0x8e, 0x6a, 0x8e, 0x48, 0x6d, 0x68, 0x6d, 0x6a, 0x86, 0x49, 0x8e, 0x68, 0x86, 0x86, 0x8d, 0x45, 0x8d, 0x83, 0x94, 0x07, 0x86, 0x69, 0x7e, 0x07, 0x5d, 0xc5, 0x05, 0x80, 0x3d, 0xc0, 0x5a, 0xa0, 0x72, 0x05, 0x9c, 0xeb, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x5c, 0x80, 0x85, 0xc0, 0x8d, 0x00, 0x7d, 0x00, 0x9c, 0x42, 0xa4, 0xe1, 0xdd, 0x20, 0xfe, 0x00, 0xee, 0x00, 0xee, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0xc4, 0xbd, 0xa9, 0x05, 0x49, 0x1c, 0x6c, 0x04, 0x09, 0x0d, 0x00, 0x04, 0x12, 0x06, 0xbe, 0x07, 0x91, 0x36, 0x4b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x0c, 0x3e, 0x0c, 0x3e, 0x0c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x4c, 0x46, 0x4c, 0x46, 0x2a, 0x35, 0x48, 0x2c, 0x4c, 0x3e, 0x6c, 0x3e, 0x6d, 0x3e, 0x6d, 0x3e, 0x8e, 0x46, 0x8e, 0x3e, 0x6c, 0x35, 0x8c, 0x3d, 0x6e, 0x46, 0x6e, 0x46, 0x2d, 0x3e, 0xc8, 0x75, 0x09, 0x86, 0x4d, 0x46, 0xa8, 0x3d, 0x40, 0xd6, 0x65, 0xb6, 0x46, 0x86, 0x27, 0x8e, 0x49, 0x8e, 0xa8, 0x75, 0x28, 0x65, 0x28, 0x65, 0x07, 0x5d, 0x6a, 0x86, 0x69, 0x86, 0x67, 0x86, 0x06, 0x8e, 0xe6, 0x8d, 0x27, 0x8e, 0x68, 0x86, 0x68, 0x7e, 0x67, 0x65, 0x63, 0x25, 0xe0, 0x6c, 0xe0, 0x8a, 0x40, 0xaa, 0x63, 0xb3, 0x49, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x02, 0x60, 0x5c, 0x80, 0xae, 0x40, 0xa6, 0x21, 0xc4, 0x41, 0xdb, 0xe0, 0xf5, 0x20, 0xfe, 0x00, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x85, 0x9d, 0x88, 0x0d, 0xcb, 0x24, 0xab, 0x04, 0xb3, 0x06, 0x6c, 0x05, 0x82, 0x04, 0x2c, 0x0c, 0xab, 0x3d, 0x6c, 0x46, 0x4c, 0x46, 0x2c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x0b, 0x3e, 0x0c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x2c, 0x3e, 0x2b, 0x3e, 0x4c, 0x46, 0x4c, 0x3e, 0x0c, 0x3e, 0xc9, 0x34, 0x6d, 0x46, 0x6d, 0x46, 0x6c, 0x3e, 0x2c, 0x3e, 0x6d, 0x3e, 0x6e, 0x3e, 0x8e, 0x46, 0x8f, 0x46, 0x6e, 0x46, 0x6d, 0x46, 0xeb, 0x45, 0xc8, 0x75, 0x4b, 0x66, 0x2c, 0x36, 0xa5, 0x55, 0x41, 0xae, 0x65, 0x9e, 0x46, 0x8e, 0x46, 0x8e, 0x48, 0x8e, 0xe8, 0x7d, 0xe8, 0x64, 0xcb, 0x75, 0xc7, 0x54, 0x49, 0x7e, 0x69, 0x86, 0x67, 0x8e, 0x87, 0x8e, 0x87, 0x86, 0x67, 0x86, 0x67, 0x86, 0x48, 0x86, 0xa6, 0x6d, 0x68, 0x94, 0x69, 0xdb, 0x00, 0xca, 0xe0, 0xb0, 0x43, 0xa2, 0x07, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x15, 0xe5, 0x03, 0x60, 0x43, 0x80, 0xad, 0x61, 0x6b, 0x00, 0xc0, 0xc0, 0xf3, 0x00, 0xfe, 0x20, 0xfe, 0x00, 0xfe, 0xe0, 0xf5, 0xe0, 0xf5, 0x00, 0xf6, 0x00, 0xee, 0x86, 0x75, 0x87, 0x1d, 0x4d, 0x25, 0xcb, 0x0c, 0xd3, 0x06, 0x6e, 0x05, 0xe6, 0x03, 0x00, 0x02, 0x46, 0x24, 0x6c, 0x46, 0x4c, 0x46, 0x2c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2c, 0x46, 0x2c, 0x4e, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x4c, 0x46, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2b, 0x3e, 0x4b, 0x46, 0x6c, 0x46, 0x0c, 0x3e, 0xc6, 0x23, 0x2c, 0x46, 0x6d, 0x56, 0x6c, 0x4e, 0x4c, 0x3e, 0x4c, 0x3e, 0x6d, 0x3e, 0x6e, 0x3e, 0x8e, 0x46, 0x8e, 0x46, 0x4d, 0x46, 0x0b, 0x4e, 0x2a, 0x5e, 0xce, 0x4e, 0x2b, 0x2e, 0xa4, 0x65, 0x64, 0x75, 0xc4, 0x64, 0x46, 0x96, 0x46, 0x96, 0x48, 0x8e, 0x48, 0x8e, 0x07, 0x65, 0x68, 0x6d, 0x07, 0x65, 0x69, 0x86, 0x89, 0x86, 0x67, 0x8e, 0x67, 0x8e, 0x67, 0x8e, 0x47, 0x8e, 0x47, 0x8e, 0x47, 0x86, 0x04, 0x76, 0x0f, 0x9c, 0x7c, 0xfb, 0xf5, 0xe9, 0x00, 0xc0, 0xc0, 0xb1, 0x87, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x04, 0xa2, 0x44, 0xe0, 0x7c, 0x20, 0x5c, 0x01, 0x20, 0x05, 0xe2, 0x87, 0xfc, 0x00, 0xfe, 0x20, 0xfe, 0x00, 0xfe, 0xe0, 0xfd, 0xe0, 0xf5, 0x00, 0xfe, 0xe1, 0xe5, 0x87, 0x4d, 0x68, 0x2d, 0x8c, 0x35, 0x8f, 0x2d, 0xb5, 0x06, 0xec, 0x04, 0x80, 0x03, 0x81, 0x03, 0x04, 0x1c, 0x4c, 0x46, 0x4c, 0x46, 0x2c, 0x46, 0x2c, 0x4e, 0x0c, 0x5e, 0x2c, 0x56, 0x2c, 0x56, 0x2c, 0x46, 0x2b, 0x46, 0x4c, 0x46, 0xeb, 0x3d, 0x2a, 0x35, 0x2b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x0b, 0x3e, 0x4b, 0x46, 0x4c, 0x46, 0x2c, 0x3e, 0xa9, 0x2c, 0x0c, 0x3e, 0x4d, 0x46, 0x6d, 0x56, 0x4d, 0x56, 0x4d, 0x3e, 0x4d, 0x36, 0x4d, 0x3e, 0x6d, 0x46, 0x8e, 0x46, 0x6d, 0x46, 0x2b, 0x46, 0x8d, 0x4e, 0xaf, 0x36, 0x67, 0x2d, 0x63, 0x5c, 0x45, 0x75, 0x84, 0x5c, 0x26, 0x8e, 0x66, 0x96, 0x47, 0x8e, 0x48, 0x8e, 0xc7, 0x7d, 0x29, 0x86, 0x69, 0x8e, 0x69, 0x8e, 0x69, 0x86, 0x48, 0x8e, 0x47, 0x8e, 0x47, 0x8e, 0x47, 0x8e, 0x67, 0x8e, 0x67, 0x86, 0x24, 0x76, 0x8c, 0x84, 0x5e, 0xfc, 0x1f, 0xfc, 0x99, 0xf2, 0x29, 0xd9, 0xe3, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x5e, 0xa0, 0x75, 0xea, 0x4d, 0xcc, 0x5e, 0x40, 0x93, 0xf1, 0xe2, 0x90, 0xed, 0xe0, 0xfd, 0xe0, 0xfd, 0xe0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xe0, 0xfd, 0xc3, 0xd5, 0x88, 0x25, 0x88, 0x2d, 0xaa, 0x45, 0x2a, 0x54, 0xcd, 0x04, 0x15, 0x06, 0xe4, 0x03, 0xc0, 0x1b, 0xc2, 0x1b, 0xec, 0x3d, 0x6c, 0x46, 0x4c, 0x4e, 0x2d, 0x66, 0x2c, 0x66, 0x4c, 0x4e, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x4c, 0x46, 0x09, 0x35, 0x88, 0x34, 0x0b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2b, 0x3e, 0x2b, 0x46, 0x4c, 0x46, 0x4c, 0x3e, 0x4c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x46, 0x2d, 0x4e, 0x4d, 0x46, 0x6c, 0x4e, 0x8c, 0x4e, 0x8d, 0x46, 0x8d, 0x46, 0x2c, 0x46, 0x2b, 0x46, 0x8d, 0x46, 0x0b, 0x2e, 0x42, 0x45, 0x62, 0x54, 0x85, 0x7d, 0xe4, 0x64, 0x26, 0x96, 0x66, 0x9e, 0x46, 0x96, 0x48, 0x8e, 0x68, 0x8e, 0x68, 0x8e, 0x68, 0x8e, 0x48, 0x86, 0x48, 0x86, 0x47, 0x8e, 0x46, 0x8e, 0x66, 0x8e, 0x46, 0x8e, 0xa4, 0x85, 0xa4, 0x85, 0x66, 0x7e, 0x04, 0x6d, 0x19, 0xe4, 0x7f, 0xfc, 0x3f, 0xfc, 0x3a, 0xfb, 0x65, 0xd3, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xff, 0x83, 0xa3, 0x60, 0x53, 0xc8, 0x2c, 0xab, 0x66, 0x00, 0xad, 0x2e, 0xbb, 0x2b, 0xe5, 0x81, 0xfd, 0x83, 0xfd, 0x84, 0xfd, 0x65, 0xfd, 0x81, 0xfd, 0xc0, 0xfd, 0xa5, 0xb5, 0x88, 0x05, 0x89, 0x35, 0xaa, 0x3d, 0x28, 0x64, 0x86, 0x5b, 0x5d, 0x17, 0x54, 0x0e, 0xc0, 0x1b, 0x8b, 0x02, 0x51, 0x35, 0x6c, 0x46, 0x4c, 0x4e, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x2c, 0x46, 0x4c, 0x46, 0x8b, 0x3d, 0x69, 0x34, 0xe9, 0x34, 0x4c, 0x3e, 0x4c, 0x3e, 0x2b, 0x3e, 0x0b, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x3e, 0x2c, 0x3e, 0x0c, 0x3e, 0x0c, 0x3e, 0x2c, 0x3e, 0x4c, 0x46, 0xac, 0x5e, 0xac, 0x5e, 0x8d, 0x4e, 0xaa, 0x3d, 0x49, 0x3d, 0x0a, 0x46, 0x4b, 0x46, 0xe9, 0x2d, 0x82, 0x4d, 0xc1, 0x5c, 0xc3, 0x64, 0xe2, 0x4b, 0xa4, 0x85, 0x65, 0x9e, 0x25, 0x96, 0x47, 0x96, 0x47, 0x8e, 0x27, 0x8e, 0x27, 0x8e, 0x46, 0x8e, 0x46, 0x8e, 0x45, 0x8e, 0x66, 0x8e, 0x83, 0x8d, 0xe2, 0x84, 0x23, 0x7d, 0x43, 0x7d, 0x45, 0x86, 0x63, 0x65, 0xe5, 0xc2, 0x57, 0xfb, 0x9f, 0xfc, 0x3d, 0xfc, 0x27, 0xbb, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x9d, 0x29, 0xba, 0x05, 0x88, 0x00, 0xb0, 0x00, 0xda, 0xa5, 0xca, 0x80, 0xaa, 0x80, 0x92, 0xa6, 0xdb, 0x8b, 0xfc, 0xce, 0xfc, 0xcf, 0xfc, 0xec, 0xfc, 0x60, 0xfd, 0x86, 0x95, 0x89, 0x05, 0x89, 0x35, 0xa9, 0x2d, 0xe9, 0x7c, 0x04, 0x94, 0x16, 0x2e, 0x52, 0x05, 0xf5, 0x04, 0x58, 0x03, 0x77, 0x24, 0x6c, 0x46, 0x6c, 0x3e, 0x4c, 0x3e, 0x4c, 0x46, 0x4c, 0x46, 0xeb, 0x55, 0x2c, 0x4e, 0x4c, 0x46, 0x2c, 0x46, 0x0c, 0x46, 0xca, 0x34, 0xe9, 0x34, 0x4c, 0x3e, 0x4c, 0x3e, 0x2c, 0x46, 0x0b, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x0c, 0x46, 0x0b, 0x3e, 0x2b, 0x46, 0x2c, 0x46, 0x4c, 0x46, 0x2b, 0x46, 0x8b, 0x4e, 0xea, 0x4d, 0x8a, 0x45, 0xe8, 0x3c, 0xe8, 0x34, 0x88, 0x3d, 0xe9, 0x35, 0xe9, 0x35, 0xa1, 0x6d, 0x40, 0x75, 0x01, 0x65, 0x00, 0x96, 0x63, 0x9e, 0x63, 0x9e, 0x26, 0x96, 0x28, 0x96, 0x26, 0x96, 0x45, 0x96, 0x45, 0x96, 0x45, 0x96, 0x45, 0x96, 0x66, 0x96, 0x66, 0x96, 0xc3, 0x8d, 0x22, 0x85, 0x23, 0x7d, 0x42, 0x75, 0x24, 0x8e, 0xc4, 0x75, 0x63, 0x9b, 0xa0, 0xf2, 0xf2, 0xfb, 0xf6, 0xeb, 0xc3, 0x8a, 0x25, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xa3, 0x8e, 0xc1, 0x14, 0xc0, 0xec, 0xe0, 0x23, 0xc9, 0xa3, 0xa8, 0x43, 0xa2, 0xe0, 0x79, 0xe0, 0x81, 0xa7, 0xb2, 0x92, 0xf3, 0x18, 0xfc, 0x37, 0xfc, 0xad, 0xfc, 0x66, 0x6d, 0x88, 0x1d, 0x68, 0x35, 0x8a, 0x2d, 0x4a, 0x4d, 0xf1, 0x14, 0x74, 0x05, 0xeb, 0x03, 0x51, 0x04, 0xdf, 0x03, 0xdc, 0x13, 0x6d, 0x3e, 0x6c, 0x3e, 0x6c, 0x3e, 0xeb, 0x55, 0x8b, 0x65, 0x87, 0x7c, 0xcb, 0x5d, 0x4c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x4a, 0x3d, 0xeb, 0x45, 0x2c, 0x46, 0x4c, 0x46, 0x4c, 0x56, 0x0b, 0x4e, 0x0c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x4b, 0x46, 0x2b, 0x46, 0x2b, 0x46, 0x2b, 0x46, 0x6c, 0x4e, 0xaa, 0x45, 0xc7, 0x44, 0x88, 0x55, 0x64, 0x4c, 0x04, 0x45, 0xe8, 0x2d, 0xe8, 0x35, 0xc0, 0x8d, 0xc0, 0x85, 0x80, 0x85, 0x80, 0xce, 0x63, 0xae, 0x24, 0xa6, 0x25, 0xa6, 0x25, 0x9e, 0x45, 0x96, 0x44, 0x96, 0x04, 0x8e, 0xc2, 0x64, 0x03, 0x86, 0xa5, 0xa6, 0x85, 0xa6, 0x04, 0x86, 0x02, 0x8d, 0x43, 0x85, 0x01, 0x7d, 0x43, 0x8e, 0xe3, 0x85, 0x25, 0x7c, 0xe1, 0xdb, 0xc0, 0xdb, 0x40, 0x8a, 0xa1, 0x72, 0xc5, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xbb, 0xc4, 0xc8, 0x11, 0xd8, 0x6c, 0xe9, 0x02, 0xb9, 0x22, 0xc9, 0x43, 0xa2, 0x00, 0x82, 0x20, 0x8a, 0x00, 0x82, 0x24, 0x9a, 0xd2, 0xda, 0x7b, 0xfb, 0x17, 0xec, 0x64, 0x45, 0x89, 0x25, 0x8c, 0x1d, 0xae, 0x0d, 0x8e, 0x25, 0x51, 0x25, 0x94, 0x05, 0xd2, 0x04, 0xc8, 0x02, 0x79, 0x01, 0x3e, 0x03, 0x12, 0x36, 0x6c, 0x46, 0x6d, 0x3e, 0x49, 0x75, 0xcb, 0x74, 0x68, 0x84, 0x29, 0x75, 0x4c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x4c, 0x46, 0x2c, 0x46, 0x2c, 0x4e, 0x2c, 0x4e, 0x2c, 0x4e, 0x0c, 0x4e, 0x4c, 0x4e, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x6a, 0x3d, 0xea, 0x45, 0x2b, 0x46, 0x2b, 0x46, 0x0a, 0x4e, 0xa8, 0x4d, 0x85, 0x44, 0x45, 0x5d, 0x42, 0x4c, 0xe3, 0x95, 0x64, 0xd7, 0x23, 0xa6, 0x20, 0x75, 0x80, 0xad, 0x80, 0xad, 0xe0, 0xcd, 0x02, 0xc6, 0x41, 0xae, 0x40, 0xae, 0x43, 0x9e, 0x44, 0x96, 0xe2, 0x74, 0xe2, 0x74, 0xe2, 0x74, 0x82, 0x7d, 0x83, 0x9e, 0x64, 0x9e, 0xa3, 0x8d, 0xa1, 0x8c, 0x03, 0x8e, 0x42, 0x8e, 0x42, 0x8e, 0x02, 0x8e, 0xa4, 0x74, 0x43, 0xcc, 0x40, 0xab, 0x60, 0x19, 0x81, 0x8a, 0x67, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xcb, 0x00, 0xeb, 0x44, 0xfd, 0x42, 0xf3, 0xa1, 0xd0, 0x63, 0xe1, 0x22, 0x8a, 0x00, 0x82, 0x20, 0x8a, 0x40, 0x8a, 0x20, 0x8a, 0x00, 0x8a, 0xee, 0xc1, 0x16, 0xb4, 0xaf, 0x05, 0xce, 0x05, 0xcf, 0x05, 0xd0, 0x05, 0x8f, 0x1d, 0x08, 0x35, 0x70, 0x05, 0xd7, 0x05, 0x33, 0x03, 0x1a, 0x00, 0x7c, 0x01, 0x93, 0x35, 0x6c, 0x46, 0x4d, 0x46, 0xec, 0x55, 0xca, 0x74, 0x89, 0x74, 0xc8, 0x7c, 0x4c, 0x4e, 0x4c, 0x46, 0x2c, 0x46, 0x2c, 0x4e, 0x0c, 0x4e, 0x0c, 0x56, 0x2c, 0x66, 0x4c, 0x56, 0x2c, 0x4e, 0x4c, 0x4e, 0x4c, 0x46, 0x4a, 0x35, 0x2b, 0x46, 0x67, 0x34, 0x49, 0x45, 0xea, 0x4d, 0x67, 0x4d, 0xc4, 0x54, 0x20, 0x5c, 0xe0, 0x53, 0x80, 0x5c, 0x60, 0x64, 0x41, 0xb6, 0xe2, 0xff, 0x60, 0xd6, 0xe0, 0x84, 0xc3, 0xb5, 0x61, 0xee, 0x80, 0xbd, 0xa0, 0xb5, 0x40, 0xb6, 0x60, 0xa6, 0x82, 0xbe, 0x82, 0xc6, 0x81, 0x95, 0xc1, 0x74, 0xe2, 0x74, 0x42, 0x75, 0x62, 0x96, 0x63, 0x9e, 0x23, 0x8e, 0x42, 0x8e, 0x62, 0x8e, 0x42, 0x96, 0x42, 0x9e, 0x42, 0x9e, 0x22, 0x7d, 0xe2, 0x9b, 0xe0, 0x69, 0x60, 0x49, 0x41, 0x6a, 0x4b, 0x34, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x4e, 0x44, 0xe6, 0x23, 0xff, 0xe5, 0xff, 0x43, 0xf5, 0x01, 0xd0, 0xc4, 0xd1, 0x01, 0x7a, 0x00, 0x7a, 0x20, 0x82, 0x40, 0x8a, 0x00, 0x82, 0x00, 0x8a, 0x65, 0x62, 0x77, 0x04, 0x9e, 0x05, 0x9a, 0x05, 0x94, 0x05, 0x91, 0x0d, 0x4d, 0x15, 0x2e, 0x1d, 0x2e, 0x0d, 0x9b, 0x06, 0xfb, 0x03, 0x1d, 0x00, 0x17, 0x19, 0x09, 0x4d, 0x6d, 0x46, 0x4d, 0x46, 0x2c, 0x4e, 0x8b, 0x65, 0xcc, 0x5d, 0x0c, 0x56, 0x4c, 0x46, 0x2c, 0x4e, 0x0c, 0x56, 0x0c, 0x56, 0x2d, 0x56, 0x4d, 0x56, 0x4c, 0x5e, 0x4c, 0x56, 0x2c, 0x46, 0x4c, 0x4e, 0x2c, 0x56, 0x88, 0x54, 0xaa, 0x4d, 0x67, 0x44, 0x06, 0x3c, 0xc4, 0x54, 0x60, 0x5c, 0x20, 0x6c, 0xe0, 0x63, 0x80, 0x7c, 0x20, 0x95, 0xc0, 0x7c, 0xe0, 0x7c, 0xe0, 0xb5, 0x62, 0xc5, 0x62, 0x9c, 0x80, 0x8c, 0x20, 0xd6, 0xe0, 0xcd, 0xc0, 0x9c, 0xe0, 0xd5, 0xa1, 0xe6, 0xc1, 0xde, 0xa0, 0xde, 0x60, 0x95, 0x01, 0x7d, 0xe1, 0x74, 0x81, 0x85, 0x62, 0x96, 0x62, 0xae, 0x43, 0x96, 0x42, 0x8e, 0x43, 0x9e, 0x65, 0xa6, 0x42, 0xa6, 0x20, 0x9e, 0x81, 0x8d, 0xe5, 0x5b, 0x81, 0x50, 0xc0, 0x70, 0xa0, 0x72, 0x69, 0x44, 0x14, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x8e, 0xa7, 0xf7, 0xe5, 0xff, 0xe6, 0xff, 0x66, 0xff, 0xa4, 0xe2, 0xc6, 0xb9, 0xe1, 0x71, 0x00, 0x72, 0x00, 0x7a, 0x00, 0x7a, 0x26, 0x7a, 0xee, 0x4a, 0x6e, 0x03, 0x55, 0x04, 0x7f, 0x05, 0x7f, 0x05, 0x5f, 0x05, 0x56, 0x0d, 0x09, 0x0d, 0x53, 0x15, 0xf3, 0x04, 0x36, 0x05, 0xfb, 0x01, 0x59, 0x01, 0x48, 0x32, 0xc4, 0x6c, 0x4c, 0x46, 0x2d, 0x46, 0x2d, 0x4e, 0x2d, 0x4e, 0x2c, 0x56, 0x0c, 0x56, 0x0c, 0x56, 0x2c, 0x5e, 0x2c, 0x5e, 0x4d, 0x5e, 0x6d, 0x5e, 0x2c, 0x56, 0xeb, 0x45, 0x2b, 0x4e, 0x09, 0x6e, 0x29, 0x96, 0x8a, 0xa6, 0x89, 0x8d, 0x88, 0x44, 0xc5, 0x33, 0x43, 0x23, 0x62, 0x4c, 0x82, 0x64, 0x63, 0x6c, 0xa7, 0x74, 0x24, 0xae, 0xc0, 0xd6, 0x0b, 0x9e, 0xd5, 0x64, 0x51, 0xb4, 0x6f, 0xf4, 0xec, 0xe3, 0xa6, 0xa3, 0x20, 0x6b, 0xc0, 0x83, 0xe0, 0x83, 0x20, 0xc5, 0x60, 0xee, 0xc1, 0xfe, 0x60, 0xee, 0xc0, 0x9c, 0x20, 0x85, 0x20, 0x96, 0x41, 0x96, 0x42, 0x96, 0x44, 0xa6, 0x44, 0xa6, 0x43, 0x9e, 0x41, 0xa6, 0x41, 0xa6, 0x20, 0x9e, 0x20, 0x9e, 0xc0, 0x95, 0x49, 0x64, 0x27, 0x89, 0x00, 0x80, 0xa0, 0x60, 0x04, 0xa3, 0x6a, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xbe, 0xe5, 0xff, 0xe6, 0xff, 0x05, 0xef, 0x24, 0xd5, 0x45, 0xea, 0x27, 0xb2, 0xc0, 0x71, 0xe0, 0x71, 0xc0, 0x71, 0x30, 0x6a, 0x3a, 0x3b, 0x74, 0x03, 0x4e, 0x03, 0x55, 0x04, 0x1c, 0x05, 0x5f, 0x05, 0x5f, 0x05, 0x10, 0x0d, 0xe8, 0x0c, 0x51, 0x15, 0x59, 0x05, 0xf3, 0x04, 0x36, 0x0b, 0x4c, 0x1a, 0xe0, 0x42, 0xa3, 0x84, 0x2c, 0x56, 0x4d, 0x46, 0x2d, 0x4e, 0x0c, 0x56, 0xec, 0x65, 0xec, 0x6d, 0x0d, 0x76, 0x2d, 0x6e, 0x4e, 0x5e, 0x2d, 0x56, 0xab, 0x55, 0xaa, 0x5d, 0x06, 0x4c, 0x28, 0x9e, 0x48, 0xbe, 0x07, 0xb6, 0x86, 0x95, 0xa6, 0x5c, 0x06, 0x44, 0xc7, 0x64, 0xc7, 0x74, 0xa7, 0x6c, 0xea, 0x84, 0x0b, 0x7d, 0x2a, 0x6d, 0xa7, 0x75, 0xcc, 0x8d, 0x1b, 0x86, 0x5f, 0x6d, 0xb5, 0xa4, 0xab, 0xdc, 0x68, 0xdc, 0xe6, 0xab, 0x24, 0x93, 0x62, 0x6a, 0xa0, 0x62, 0x22, 0x7b, 0x86, 0xac, 0x80, 0xcd, 0x40, 0xee, 0xe0, 0xfe, 0xa0, 0xf6, 0x40, 0xc6, 0x40, 0x9e, 0x44, 0x9e, 0x46, 0xae, 0x62, 0xb6, 0x40, 0xae, 0x40, 0xa6, 0x20, 0xa6, 0x20, 0xa6, 0x20, 0xa6, 0x00, 0x9e, 0x43, 0x7c, 0x23, 0xc1, 0x00, 0x98, 0x00, 0x88, 0x02, 0xea, 0xc7, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xce, 0x61, 0xe6, 0xa1, 0xd4, 0x80, 0xc9, 0x00, 0xc8, 0x64, 0xe1, 0x04, 0x92, 0xa0, 0x69, 0xe0, 0x79, 0x96, 0x5a, 0x1f, 0x13, 0x3f, 0x03, 0x75, 0x03, 0x4f, 0x03, 0x57, 0x04, 0x1c, 0x05, 0x1d, 0x05, 0x17, 0x05, 0xe9, 0x0c, 0x0b, 0x15, 0x4e, 0x2d, 0xb0, 0x64, 0x47, 0x94, 0x24, 0x2b, 0x40, 0x1a, 0x20, 0x43, 0xe0, 0x63, 0xcb, 0x55, 0x2d, 0x56, 0x0c, 0x6e, 0xec, 0x7d, 0x0e, 0x8e, 0x2f, 0x8e, 0x4f, 0x86, 0x4e, 0x66, 0x2d, 0x5e, 0xab, 0x65, 0x48, 0x54, 0x6a, 0x75, 0xe4, 0x73, 0x87, 0xad, 0x67, 0x8d, 0xe6, 0x64, 0xe6, 0x64, 0x48, 0x7d, 0xa9, 0x8d, 0x4b, 0xc6, 0x4a, 0xee, 0x29, 0xb5, 0xab, 0x7c, 0xcc, 0x6c, 0x2f, 0x65, 0x71, 0x65, 0x94, 0x75, 0x98, 0x7d, 0x74, 0x6c, 0x2c, 0x74, 0x09, 0x6c, 0xe7, 0x73, 0x04, 0x84, 0xa4, 0x93, 0xa6, 0x62, 0x81, 0x6a, 0x0f, 0x5a, 0xba, 0x49, 0xf5, 0x92, 0x28, 0xd5, 0x40, 0xf6, 0x62, 0xf6, 0x67, 0xfe, 0x27, 0xee, 0xe2, 0xc5, 0x40, 0xa6, 0x40, 0xa6, 0x40, 0xae, 0x60, 0xae, 0x40, 0xae, 0x20, 0xae, 0x20, 0xa6, 0x20, 0xa6, 0x61, 0x7c, 0x64, 0xa0, 0x03, 0xb0, 0x60, 0xd1, 0x80, 0xfa, 0x45, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x07, 0x24, 0xac, 0x20, 0x91, 0x00, 0xa8, 0x80, 0xdb, 0x83, 0xd3, 0x83, 0xe0, 0x60, 0x79, 0x89, 0x69, 0x5a, 0x4a, 0x3f, 0x03, 0x3f, 0x03, 0x5f, 0x03, 0x59, 0x03, 0x31, 0x03, 0x78, 0x04, 0x3e, 0x05, 0x1c, 0x05, 0xee, 0x1c, 0xca, 0x0c, 0xeb, 0x14, 0x0c, 0x1d, 0x27, 0xbd, 0x60, 0xbc, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x4b, 0x00, 0x3b, 0x0a, 0x65, 0x0d, 0x9e, 0x0e, 0xb6, 0x50, 0xae, 0x51, 0x9e, 0xcf, 0x85, 0x0b, 0x8d, 0xcb, 0x7d, 0xc8, 0x95, 0xa7, 0x8d, 0xa7, 0x64, 0x89, 0x6c, 0x87, 0x6b, 0x49, 0x5c, 0xad, 0x8d, 0xce, 0xa5, 0xeb, 0xa5, 0xaa, 0x95, 0x8c, 0x95, 0xce, 0xd5, 0x69, 0xf6, 0x8b, 0xb5, 0xef, 0x64, 0x72, 0x65, 0xb3, 0x5d, 0x50, 0x55, 0x2b, 0x4c, 0xc8, 0x43, 0x25, 0x2b, 0x0e, 0x3c, 0x72, 0x34, 0x51, 0x44, 0x2c, 0x6c, 0x86, 0x6b, 0xe5, 0x52, 0x45, 0x73, 0x6f, 0x62, 0x7b, 0x61, 0xbe, 0xa8, 0x9a, 0xc2, 0x6f, 0xc4, 0xe4, 0xbc, 0x46, 0xcd, 0x46, 0xf5, 0x22, 0xec, 0xc0, 0xc4, 0xc0, 0xad, 0x20, 0x9e, 0x40, 0xa6, 0x40, 0xae, 0x60, 0xb6, 0x60, 0xb6, 0x40, 0xae, 0xc5, 0x94, 0x6a, 0x98, 0x04, 0xc0, 0xe1, 0xf9, 0x00, 0xfb, 0x03, 0xd4, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x6d, 0x27, 0xbc, 0xa0, 0xc3, 0xf0, 0x91, 0x1a, 0x73, 0x10, 0xab, 0x00, 0xd0, 0x4f, 0x69, 0x5d, 0x32, 0x1f, 0x02, 0x3f, 0x02, 0xff, 0x02, 0x5f, 0x03, 0x5f, 0x03, 0x17, 0x03, 0x1b, 0x04, 0xff, 0x04, 0xf7, 0x14, 0xc9, 0x1c, 0xeb, 0x1c, 0xeb, 0x1c, 0xec, 0x04, 0x29, 0xad, 0x80, 0xd5, 0x40, 0x63, 0x00, 0x01, 0xe0, 0x5b, 0xa0, 0x4b, 0x2a, 0x8d, 0x50, 0xb6, 0x2f, 0x9e, 0xee, 0x7d, 0x89, 0x94, 0xaa, 0x94, 0x09, 0xa4, 0xe8, 0x9c, 0x6a, 0x85, 0xaf, 0x95, 0x2f, 0x9d, 0x30, 0xad, 0x13, 0xce, 0xf1, 0xb5, 0xf1, 0xad, 0x70, 0x95, 0x50, 0x9d, 0xd4, 0xbd, 0x16, 0xce, 0xb5, 0xad, 0xb3, 0x8d, 0x93, 0x6d, 0x72, 0x65, 0x2f, 0x55, 0xaa, 0x44, 0x46, 0x44, 0xa7, 0x3b, 0x88, 0x33, 0x48, 0x33, 0x0e, 0x34, 0xd2, 0x34, 0x71, 0x34, 0x2f, 0x34, 0x2b, 0x54, 0x88, 0x74, 0x84, 0x84, 0xe5, 0x93, 0xae, 0xbb, 0xb3, 0xcb, 0xfb, 0x7b, 0x15, 0x5b, 0x65, 0x8a, 0x40, 0xb3, 0xa0, 0xdb, 0xc8, 0xca, 0x42, 0xca, 0xe0, 0xc2, 0x40, 0xb4, 0xa0, 0xa5, 0x20, 0xa6, 0x40, 0xa6, 0x40, 0xae, 0x60, 0xb6, 0x63, 0x9d, 0x47, 0xd1, 0x00, 0xf8, 0x20, 0xd8, 0x80, 0xc1, 0x24, 0xe3, 0x6a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x04, 0x13, 0x83, 0x66, 0x93, 0x32, 0x5a, 0x1d, 0x58, 0x0e, 0xd1, 0x55, 0xd4, 0x9e, 0xa4, 0x5f, 0x5b, 0x1f, 0x0a, 0x5f, 0x01, 0xbf, 0x01, 0xbf, 0x02, 0x1f, 0x03, 0xbe, 0x02, 0x7f, 0x03, 0x5d, 0x0c, 0xad, 0x24, 0xaa, 0x24, 0xcc, 0x2c, 0x0f, 0x3d, 0xf2, 0x14, 0x6e, 0x9d, 0x20, 0xee, 0x20, 0xa5, 0x00, 0x53, 0xc0, 0x2a, 0xa0, 0xad, 0x47, 0xe7, 0xed, 0x75, 0xab, 0x65, 0x89, 0x65, 0xa8, 0x9c, 0x4a, 0xac, 0x4a, 0xa4, 0x6c, 0xac, 0x35, 0xce, 0x97, 0xee, 0x35, 0xde, 0x91, 0xb5, 0x4f, 0x9d, 0x0f, 0x95, 0x52, 0xa5, 0xd5, 0xbd, 0xf6, 0xc5, 0x16, 0xb6, 0xd4, 0x8d, 0xb3, 0x6d, 0x72, 0x5d, 0xcd, 0x4c, 0x68, 0x44, 0x25, 0x44, 0x89, 0x4c, 0xcb, 0x4c, 0x8c, 0x44, 0x88, 0x2b, 0xaa, 0x33, 0x0b, 0x34, 0x0f, 0x35, 0x8c, 0x34, 0x29, 0x3c, 0xe6, 0x43, 0x26, 0x4c, 0xc7, 0x64, 0x28, 0xb5, 0xe2, 0xf5, 0x40, 0xdd, 0x48, 0x73, 0xec, 0x51, 0x4c, 0x51, 0x92, 0x59, 0x78, 0x8b, 0xf0, 0xb2, 0x20, 0xcb, 0xe0, 0xca, 0xa0, 0xc1, 0x40, 0xba, 0x20, 0xb4, 0x80, 0xb5, 0x00, 0xa6, 0x20, 0xa6, 0xa0, 0xa5, 0x08, 0xca, 0x06, 0xf8, 0x00, 0xb0, 0x00, 0x90, 0x84, 0xd2, 0x6a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x54, 0xd7, 0x39, 0x2a, 0x29, 0xc0, 0xb4, 0x47, 0xe4, 0xca, 0xc9, 0x7c, 0xf6, 0x1e, 0xff, 0xbe, 0xf6, 0x1f, 0xde, 0x3f, 0xb5, 0x3f, 0x84, 0x3f, 0x4b, 0x5f, 0x02, 0xdf, 0x19, 0x5f, 0x73, 0xf5, 0x24, 0xea, 0x3c, 0xcf, 0x34, 0xd1, 0x2c, 0x14, 0x45, 0x14, 0x35, 0x31, 0x7d, 0xe2, 0xe5, 0x40, 0xbd, 0x20, 0xb4, 0xc0, 0xa2, 0xa0, 0xd5, 0xe4, 0xee, 0xcb, 0x7d, 0x8c, 0x85, 0xf3, 0xa5, 0x93, 0xc5, 0x53, 0xc5, 0xf0, 0xdc, 0xcf, 0xdc, 0x15, 0xce, 0x50, 0xa5, 0xce, 0x8c, 0x10, 0x95, 0xd5, 0xb5, 0x57, 0xce, 0x58, 0xce, 0xd5, 0xad, 0x73, 0x85, 0x71, 0x65, 0x0e, 0x55, 0xea, 0x3b, 0x09, 0x34, 0x66, 0x2b, 0xab, 0x3c, 0x2e, 0x3d, 0x6f, 0x55, 0xed, 0x44, 0x09, 0x34, 0x2b, 0x34, 0x4f, 0x35, 0x70, 0x35, 0x0e, 0x35, 0x27, 0x3c, 0x49, 0x3c, 0x09, 0x34, 0x09, 0x34, 0xa7, 0x23, 0x04, 0x74, 0xe0, 0xe5, 0x00, 0xe6, 0x40, 0x9c, 0x82, 0x83, 0x26, 0x6a, 0xf6, 0x4a, 0x3f, 0x07, 0xfa, 0x1c, 0x20, 0x68, 0xa0, 0xa2, 0x40, 0xc3, 0x20, 0xd3, 0xe0, 0xe2, 0x60, 0xfb, 0x00, 0xd4, 0x40, 0xb5, 0xc0, 0xa5, 0xe8, 0xba, 0x0e, 0xe8, 0x62, 0x88, 0x00, 0x80, 0x21, 0x8a, 0xa6, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x83, 0xb6, 0x61, 0xca, 0xdd, 0x80, 0xff, 0x0a, 0xee, 0x13, 0xd4, 0xfd, 0xfe, 0x1e, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xdf, 0xee, 0x3f, 0xd6, 0x1e, 0xb5, 0x98, 0xa4, 0x10, 0x1d, 0xd1, 0x1c, 0xf4, 0x14, 0x92, 0x1c, 0x90, 0x34, 0x90, 0x34, 0xb2, 0x3c, 0x69, 0xbc, 0xa0, 0xd4, 0xc0, 0xec, 0xe1, 0xfc, 0xc3, 0xdc, 0xc2, 0xcb, 0xb2, 0xb5, 0xd9, 0xde, 0x1b, 0xef, 0x32, 0xd5, 0xeb, 0xbb, 0xad, 0xa4, 0xad, 0x8c, 0x10, 0x8d, 0xb3, 0xad, 0x37, 0xce, 0x58, 0xd6, 0x17, 0xc6, 0x93, 0x9d, 0x31, 0x7d, 0xef, 0x6c, 0xec, 0x64, 0xaa, 0x54, 0x69, 0x44, 0x29, 0x34, 0x8b, 0x3c, 0x6c, 0x34, 0x2f, 0x35, 0x2f, 0x35, 0x0e, 0x45, 0x0c, 0x35, 0x0e, 0x35, 0x70, 0x3d, 0x91, 0x3d, 0x50, 0x3d, 0xcd, 0x44, 0x4a, 0x3c, 0x4c, 0x2c, 0xcb, 0x13, 0x8b, 0x03, 0x8c, 0x03, 0xce, 0x03, 0x51, 0x34, 0x0b, 0x5c, 0xc0, 0x7b, 0x60, 0xa4, 0xc0, 0x8b, 0x28, 0x7b, 0x18, 0x7d, 0x94, 0x6b, 0x00, 0x28, 0x00, 0x00, 0x00, 0x49, 0x60, 0x9a, 0xa0, 0xd3, 0x40, 0xfc, 0x40, 0xfc, 0x20, 0xf4, 0x00, 0xc4, 0xc3, 0xba, 0xa9, 0xa8, 0xe3, 0x28, 0x23, 0x49, 0x84, 0x62, 0xa7, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7e, 0x2d, 0xd4, 0x26, 0xd9, 0x60, 0xfb, 0x04, 0xfd, 0x0c, 0xd4, 0x36, 0xd5, 0x1e, 0xff, 0x1e, 0xff, 0x1e, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0x5e, 0xff, 0xfa, 0xe6, 0xf4, 0xb5, 0x8c, 0x54, 0xd0, 0x3c, 0x11, 0x3d, 0x11, 0x35, 0x6e, 0x24, 0x73, 0x24, 0x39, 0x4d, 0x3e, 0x8e, 0x72, 0xdc, 0x20, 0xf4, 0xc0, 0xe4, 0xe1, 0xc3, 0xaa, 0xcb, 0x09, 0xda, 0x53, 0xe5, 0x76, 0xce, 0x2f, 0x9d, 0x6b, 0x7c, 0xef, 0x8c, 0xb3, 0xad, 0x77, 0xce, 0xb9, 0xde, 0x78, 0xce, 0xb5, 0xad, 0x31, 0x8d, 0xef, 0x74, 0xad, 0x64, 0x0a, 0x4c, 0x69, 0x54, 0xa9, 0x54, 0x2c, 0x55, 0x8e, 0x5d, 0x8c, 0x44, 0xed, 0x3c, 0xcd, 0x34, 0xac, 0x2c, 0x0e, 0x2d, 0x6f, 0x35, 0x70, 0x35, 0x50, 0x2d, 0x30, 0x35, 0x30, 0x45, 0x71, 0x4d, 0xef, 0x44, 0x51, 0x0c, 0x32, 0x04, 0x53, 0x04, 0x74, 0x04, 0x95, 0x04, 0x96, 0x04, 0x54, 0x04, 0xad, 0x43, 0xc9, 0x2a, 0x20, 0x32, 0x01, 0x5b, 0x40, 0x6b, 0x00, 0x7b, 0x00, 0x83, 0x00, 0x73, 0xc0, 0x6a, 0x60, 0x62, 0x00, 0x5a, 0x60, 0x41, 0x00, 0x82, 0xc0, 0xd3, 0xc0, 0xfc, 0xc0, 0xfc, 0xc0, 0xdc, 0xa0, 0x93, 0x47, 0x02, 0x8c, 0x02, 0xc9, 0x02, 0x07, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x8c, 0x1c, 0xec, 0xd1, 0xfa, 0x20, 0xf9, 0x06, 0xd0, 0x0a, 0xb0, 0xd8, 0xdd, 0x3f, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xfc, 0xf6, 0x57, 0xd6, 0x70, 0x9d, 0xea, 0x74, 0x4a, 0x44, 0x0a, 0x24, 0x6a, 0x44, 0xed, 0x44, 0x92, 0x5d, 0x99, 0x75, 0x7f, 0x96, 0x3f, 0xd7, 0xdf, 0xef, 0xd8, 0xfe, 0x60, 0xf4, 0x60, 0xa3, 0xe0, 0x58, 0x84, 0x99, 0x08, 0xba, 0xaa, 0xcb, 0xad, 0x7c, 0x52, 0x9d, 0x57, 0xc6, 0xfa, 0xe6, 0xda, 0xe6, 0x57, 0xce, 0x93, 0x9d, 0x0f, 0x7d, 0xed, 0x74, 0x8b, 0x6c, 0xc9, 0x4b, 0xc9, 0x43, 0x8a, 0x3b, 0xac, 0x4c, 0x8f, 0x5d, 0xaf, 0x5d, 0x6d, 0x5d, 0xc9, 0x2b, 0x8c, 0x2c, 0x6f, 0x35, 0x70, 0x2d, 0x6f, 0x25, 0x2e, 0x2d, 0x0f, 0x35, 0x10, 0x35, 0x51, 0x3d, 0x72, 0x3d, 0x72, 0x3d, 0xf0, 0x2c, 0xd7, 0x04, 0xd7, 0x04, 0xb6, 0x04, 0xb6, 0x04, 0xb6, 0x04, 0xb6, 0x04, 0xd0, 0x3b, 0xb1, 0x7c, 0x4d, 0x3b, 0xe0, 0x00, 0x43, 0x01, 0xc3, 0x19, 0x8c, 0x3a, 0xe8, 0x52, 0x00, 0x6b, 0x20, 0x73, 0x40, 0x73, 0x20, 0x73, 0x20, 0x73, 0xe0, 0x6a, 0x40, 0x62, 0xe0, 0x93, 0x20, 0xdd, 0x80, 0xed, 0x20, 0xf6, 0x62, 0xcd, 0x86, 0x53, 0x83, 0x62, 0x64, 0x6b, 0xf5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xb4, 0x1f, 0xda, 0x7d, 0xf2, 0xaf, 0xe9, 0x08, 0xb0, 0x48, 0xaa, 0xbb, 0xf6, 0x5e, 0xff, 0x3d, 0xff, 0xdb, 0xf6, 0xf5, 0xc5, 0x6b, 0x95, 0xe0, 0x6c, 0x84, 0x6c, 0xaa, 0x64, 0x4d, 0x34, 0x8e, 0x34, 0xcf, 0x54, 0xd7, 0x8d, 0x9d, 0xae, 0xdd, 0xc6, 0xdf, 0xf7, 0xff, 0xff, 0xbc, 0xf7, 0x77, 0xee, 0x28, 0xf3, 0x20, 0xe3, 0x20, 0xb2, 0x40, 0x89, 0x00, 0x68, 0xc9, 0x8a, 0xf9, 0xde, 0x5c, 0xef, 0xda, 0xde, 0x16, 0xb6, 0x72, 0x95, 0x0f, 0x7d, 0xed, 0x74, 0xec, 0x6c, 0xcb, 0x6c, 0x6b, 0x5c, 0x2b, 0x4c, 0xc9, 0x43, 0x2c, 0x4c, 0x8c, 0x4c, 0x4e, 0x55, 0x4d, 0x4d, 0x4e, 0x45, 0x8f, 0x35, 0xb0, 0x35, 0x6f, 0x2d, 0x2e, 0x2d, 0xed, 0x24, 0x0f, 0x2d, 0x30, 0x2d, 0x11, 0x25, 0x11, 0x15, 0x52, 0x1d, 0x72, 0x3d, 0xf0, 0x2c, 0xd7, 0x04, 0xd7, 0x04, 0xd6, 0x04, 0xb6, 0x04, 0xb6, 0x04, 0x75, 0x04, 0x0e, 0x6c, 0xf7, 0x8d, 0xaf, 0x43, 0xa0, 0x00, 0x24, 0x01, 0x2a, 0x01, 0xbc, 0x01, 0x74, 0x01, 0xe0, 0x29, 0x81, 0x42, 0xa0, 0x4a, 0x60, 0x52, 0x20, 0x5a, 0xc0, 0x5a, 0xa0, 0x53, 0xe0, 0x42, 0xc0, 0x39, 0xc0, 0x38, 0x40, 0x8b, 0x60, 0xbc, 0x40, 0x83, 0x20, 0xbc, 0x64, 0x8b, 0x2a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xcb, 0x7d, 0xea, 0xba, 0xc2, 0x15, 0x88, 0x38, 0x9a, 0x2f, 0xb4, 0x1c, 0xff, 0x9a, 0xe6, 0x93, 0xb5, 0xc9, 0x84, 0x40, 0x54, 0xc1, 0x64, 0x65, 0x85, 0x0b, 0x7d, 0x8f, 0x4c, 0x8f, 0x4c, 0x33, 0x85, 0xf8, 0xad, 0x3a, 0xc6, 0x94, 0xc5, 0x71, 0xe6, 0x38, 0xef, 0x7b, 0xef, 0x9c, 0xf7, 0x1c, 0xef, 0x4b, 0xd2, 0xa7, 0xe2, 0x68, 0xba, 0x00, 0x89, 0xc0, 0x70, 0x44, 0x92, 0x57, 0xd6, 0x17, 0xb6, 0x52, 0x95, 0x2f, 0x7d, 0xcd, 0x7c, 0x6b, 0x74, 0x87, 0x8b, 0x6a, 0x74, 0x2d, 0x65, 0x2f, 0x65, 0x6c, 0x4c, 0x6b, 0x4c, 0xaa, 0x3b, 0x8b, 0x3c, 0x4d, 0x45, 0x8f, 0x45, 0xaf, 0x3d, 0x6e, 0x3d, 0x2d, 0x35, 0x0d, 0x35, 0x0f, 0x2d, 0x10, 0x1d, 0xf0, 0x0c, 0xf0, 0x04, 0xf1, 0x0c, 0x11, 0x0d, 0x32, 0x15, 0x31, 0x2d, 0x8e, 0x1c, 0xd7, 0x04, 0xd7, 0x04, 0xd7, 0x04, 0xd7, 0x04, 0xd7, 0x04, 0x11, 0x3c, 0x33, 0x8d, 0x9b, 0x96, 0xf0, 0x4b, 0x40, 0x00, 0x22, 0x01, 0x33, 0x01, 0x5f, 0x02, 0x57, 0x01, 0x00, 0x00, 0xc0, 0x00, 0xe0, 0x21, 0xa4, 0x42, 0xc6, 0x4a, 0x82, 0x1b, 0x21, 0x0c, 0xa0, 0x43, 0x20, 0x3b, 0x60, 0x2a, 0x61, 0x02, 0xe3, 0x02, 0x00, 0x48, 0x80, 0x78, 0xc3, 0x8a, 0x48, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x5e, 0x35, 0xc3, 0x10, 0xd0, 0x83, 0xc0, 0xe6, 0xc8, 0x72, 0xbb, 0xad, 0xa4, 0xf0, 0xa4, 0xe8, 0x83, 0xa4, 0x73, 0x46, 0x6c, 0x04, 0x7d, 0x80, 0x5c, 0xc2, 0x6c, 0xf2, 0x7c, 0xd8, 0xad, 0x52, 0x9d, 0xd1, 0x8c, 0xcf, 0x94, 0x91, 0xcd, 0xf3, 0xd5, 0x58, 0xce, 0x3c, 0xe7, 0x9d, 0xf7, 0x9d, 0xff, 0x5d, 0xf7, 0x31, 0xbc, 0x8b, 0x83, 0x0c, 0xab, 0x67, 0xa0, 0xa4, 0x90, 0x20, 0xdb, 0x0c, 0xcd, 0x50, 0x85, 0xed, 0x74, 0x49, 0x6c, 0x46, 0x83, 0x87, 0x8b, 0x2a, 0x7c, 0x2a, 0x7c, 0x2e, 0x65, 0xcc, 0x5c, 0x88, 0x3b, 0x4b, 0x3c, 0x2d, 0x4d, 0x6e, 0x45, 0x4c, 0x3d, 0x2c, 0x45, 0x2c, 0x4d, 0x2d, 0x3d, 0x2f, 0x35, 0x30, 0x25, 0x30, 0x0d, 0x10, 0x05, 0xd0, 0x04, 0xf0, 0x0c, 0x11, 0x15, 0x11, 0x0d, 0x32, 0x0d, 0xce, 0x1c, 0x2d, 0x0c, 0xd9, 0x04, 0xd8, 0x04, 0xd8, 0x04, 0xd7, 0x04, 0xb6, 0x04, 0x2f, 0x6c, 0x59, 0x9e, 0xbb, 0x9e, 0x31, 0x54, 0x00, 0x00, 0x02, 0x01, 0x98, 0x01, 0x1f, 0x03, 0xd9, 0x01, 0x60, 0x00, 0xe8, 0x01, 0xcb, 0x02, 0xec, 0x02, 0xab, 0x03, 0xa0, 0x24, 0xe0, 0x1a, 0xc0, 0x19, 0x60, 0x2a, 0xe2, 0x32, 0x04, 0x5c, 0x09, 0x8d, 0xc0, 0xc2, 0x20, 0xc2, 0x83, 0x93, 0x07, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0xe7, 0xea, 0x40, 0xf1, 0x00, 0xc0, 0xc0, 0xd9, 0x28, 0xbb, 0xc8, 0x9c, 0x20, 0x7b, 0x61, 0x8a, 0x24, 0xab, 0x66, 0xa4, 0xe9, 0xbd, 0xab, 0x9d, 0x0e, 0xad, 0x8f, 0xb4, 0xb1, 0x9c, 0xce, 0x9c, 0x72, 0xbd, 0xd3, 0xcd, 0x93, 0xbd, 0xd5, 0xbd, 0x34, 0xa5, 0x75, 0xb5, 0x1c, 0xe7, 0xbf, 0xd6, 0x5f, 0xa5, 0x55, 0xa5, 0x30, 0x64, 0x71, 0xb2, 0x6a, 0xa8, 0xab, 0xa8, 0x02, 0xdb, 0xa6, 0xd4, 0x69, 0x5c, 0x69, 0x54, 0x8b, 0x64, 0x4a, 0x74, 0x08, 0x7c, 0xc8, 0x83, 0xc8, 0x83, 0xaa, 0x54, 0xcb, 0x4c, 0xec, 0x44, 0x2c, 0x45, 0x0b, 0x45, 0xea, 0x44, 0xea, 0x44, 0x2c, 0x4d, 0x6f, 0x45, 0x70, 0x2d, 0x50, 0x15, 0x30, 0x0d, 0x30, 0x0d, 0x10, 0x05, 0xf0, 0x04, 0x10, 0x0d, 0x51, 0x15, 0x52, 0x15, 0x31, 0x15, 0x6a, 0x1c, 0x2f, 0x0c, 0xda, 0x04, 0xda, 0x04, 0xd8, 0x04, 0xd8, 0x04, 0x33, 0x34, 0x53, 0x95, 0xdb, 0xa6, 0xdb, 0xa6, 0x51, 0x5c, 0x00, 0x00, 0xe5, 0x00, 0x99, 0x01, 0x1f, 0x03, 0x79, 0x02, 0x2f, 0x03, 0xf2, 0x03, 0x90, 0x03, 0xed, 0x02, 0x67, 0x1c, 0xc0, 0x2c, 0x20, 0x23, 0x20, 0x01, 0x41, 0x29, 0x27, 0x5a, 0xa3, 0x9a, 0x41, 0x82, 0xe0, 0x9a, 0x62, 0xb4, 0x85, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x84, 0x60, 0xda, 0xe0, 0xf8, 0x32, 0xda, 0x76, 0xe3, 0x4b, 0xd3, 0xeb, 0xdc, 0x40, 0xbb, 0x40, 0x9b, 0x60, 0x6a, 0xca, 0x9a, 0x4e, 0xd4, 0xf4, 0xbd, 0x71, 0xa5, 0xcf, 0xb4, 0xd4, 0xcd, 0xf5, 0xcd, 0x52, 0xb5, 0x10, 0xa5, 0x0f, 0x7c, 0x14, 0x74, 0x7a, 0x74, 0x7a, 0x6c, 0x7a, 0x64, 0xda, 0x33, 0x55, 0x03, 0x15, 0x95, 0xfe, 0x74, 0x59, 0xaa, 0x8c, 0xb0, 0xcc, 0xa0, 0x49, 0xa1, 0x16, 0xbc, 0xcd, 0x64, 0xec, 0x64, 0xec, 0x5c, 0xa8, 0x7b, 0xc8, 0x7b, 0xe8, 0x7b, 0x6a, 0x74, 0x0b, 0x4d, 0xeb, 0x4c, 0xc9, 0x44, 0x88, 0x44, 0x88, 0x44, 0xa9, 0x4c, 0xca, 0x4c, 0x89, 0x3c, 0xcb, 0x2c, 0x0e, 0x25, 0x50, 0x15, 0x51, 0x0d, 0x31, 0x05, 0x51, 0x05, 0xf0, 0x04, 0x31, 0x0d, 0x52, 0x15, 0x72, 0x15, 0x0f, 0x15, 0x47, 0x1c, 0x50, 0x0c, 0xfc, 0x04, 0xdb, 0x04, 0xda, 0x04, 0x98, 0x04, 0x2f, 0x74, 0x58, 0xae, 0xfc, 0xae, 0xfc, 0xae, 0x72, 0x64, 0x00, 0x00, 0xc6, 0x09, 0xb2, 0x11, 0x11, 0x19, 0x38, 0x09, 0x53, 0x02, 0x0f, 0x03, 0x50, 0x03, 0x8d, 0x03, 0x63, 0x1d, 0xa0, 0x24, 0x2b, 0x03, 0x08, 0x42, 0xa0, 0x72, 0x01, 0xb3, 0x00, 0xcc, 0x80, 0x73, 0x23, 0x3c, 0x65, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xbc, 0x00, 0xd2, 0xd3, 0xeb, 0x1e, 0xe4, 0xba, 0xf3, 0xa0, 0xe9, 0x20, 0xd1, 0x20, 0xd2, 0xe7, 0xec, 0xaa, 0xbb, 0x8b, 0xbb, 0x4d, 0xbc, 0x92, 0xbd, 0x15, 0xce, 0x93, 0xc5, 0xae, 0xa4, 0x6d, 0x9c, 0xaf, 0x6b, 0x34, 0x74, 0x38, 0x6c, 0xf8, 0x3b, 0xd4, 0x23, 0xf1, 0x2b, 0x11, 0x2c, 0x50, 0x34, 0xad, 0x13, 0xf5, 0x7c, 0xbf, 0x86, 0x79, 0xbc, 0x6e, 0xb8, 0x0a, 0x98, 0xf7, 0xd3, 0x5d, 0xed, 0xcf, 0x74, 0xaa, 0x5c, 0x8a, 0x5c, 0xc8, 0x73, 0x49, 0x64, 0xeb, 0x44, 0xaa, 0x44, 0x89, 0x4c, 0x68, 0x44, 0x89, 0x4c, 0x8a, 0x4c, 0xaa, 0x4c, 0x68, 0x44, 0x47, 0x3c, 0x47, 0x34, 0x67, 0x34, 0x67, 0x34, 0x89, 0x34, 0xcc, 0x2c, 0x0f, 0x1d, 0x51, 0x0d, 0x11, 0x05, 0x32, 0x0d, 0x52, 0x15, 0x52, 0x15, 0xac, 0x14, 0x26, 0x14, 0x72, 0x0c, 0x1d, 0x05, 0xdc, 0x04, 0xdb, 0x04, 0x55, 0x44, 0x31, 0xa5, 0xfb, 0xb6, 0x1c, 0xb7, 0xfa, 0xa6, 0xb0, 0x5d, 0x20, 0x04, 0xa1, 0x0a, 0xc6, 0x18, 0x07, 0x10, 0x19, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa5, 0x00, 0xa7, 0x53, 0xc0, 0x95, 0xd1, 0x85, 0x51, 0x73, 0xa8, 0x61, 0x60, 0x89, 0xc0, 0x99, 0xa0, 0xb3, 0x84, 0x85, 0xed, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x06, 0x43, 0xed, 0xb0, 0xfd, 0x9c, 0xfe, 0x76, 0xfc, 0x28, 0xea, 0xc0, 0xd9, 0xa9, 0xe9, 0xab, 0xe2, 0xaf, 0xd4, 0xef, 0xc4, 0x92, 0xc5, 0xb4, 0xc5, 0x30, 0xc5, 0x6a, 0xbc, 0xe9, 0x6a, 0x31, 0x63, 0xb7, 0x6b, 0xb8, 0x53, 0xb4, 0x2b, 0x70, 0x03, 0x8e, 0x13, 0xae, 0x1b, 0x30, 0x2c, 0x10, 0x24, 0x10, 0x24, 0xf0, 0x13, 0x92, 0x64, 0xb3, 0xb5, 0x92, 0xac, 0x13, 0xa3, 0xb2, 0xc2, 0x9e, 0xfd, 0xbe, 0xfd, 0xb2, 0x84, 0xc9, 0x54, 0xca, 0x5c, 0xaa, 0x54, 0x88, 0x44, 0x68, 0x4c, 0x68, 0x4c, 0x89, 0x4c, 0xaa, 0x4c, 0xaa, 0x4c, 0x89, 0x44, 0x69, 0x44, 0x68, 0x44, 0x68, 0x3c, 0x68, 0x3c, 0x89, 0x3c, 0x88, 0x3c, 0x88, 0x3c, 0x67, 0x3c, 0x87, 0x34, 0xaa, 0x2c, 0xad, 0x14, 0x10, 0x05, 0x73, 0x15, 0x0f, 0x0d, 0x68, 0x04, 0x26, 0x04, 0x93, 0x04, 0x1e, 0x05, 0xfd, 0x04, 0xdb, 0x04, 0x71, 0x8c, 0x36, 0xae, 0xb9, 0xa6, 0xd3, 0x7d, 0xca, 0x4d, 0xc0, 0x26, 0xc0, 0x26, 0x27, 0x0d, 0x0d, 0x10, 0x08, 0x08, 0x12, 0x00, 0x0d, 0x00, 0x0a, 0x20, 0x8f, 0xa0, 0x81, 0xe2, 0xe0, 0xec, 0x8b, 0xdc, 0xc5, 0xe9, 0x20, 0xca, 0x60, 0x81, 0x80, 0x41, 0x00, 0x02, 0xa3, 0x03, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x9e, 0x88, 0xf5, 0xad, 0xfd, 0xac, 0xeb, 0x00, 0xe0, 0x02, 0xeb, 0xe4, 0xe3, 0x6e, 0xdc, 0x51, 0xd5, 0xd3, 0xcd, 0x51, 0xc5, 0x2b, 0xa4, 0xe8, 0x7a, 0xec, 0x92, 0x90, 0x93, 0x74, 0x53, 0x55, 0x2b, 0x34, 0x03, 0x93, 0x03, 0xf1, 0x13, 0x8d, 0x1b, 0xce, 0x23, 0xcf, 0x13, 0xf0, 0x03, 0x32, 0x04, 0x53, 0x14, 0x51, 0x1c, 0x10, 0x2c, 0xee, 0x8c, 0x71, 0xa5, 0x58, 0x74, 0xfb, 0xdc, 0x1f, 0xfe, 0x3f, 0xfe, 0x35, 0xb5, 0x86, 0x3c, 0x67, 0x44, 0x47, 0x4c, 0x47, 0x4c, 0x89, 0x54, 0xaa, 0x54, 0x89, 0x4c, 0x68, 0x44, 0x89, 0x44, 0x89, 0x44, 0x69, 0x44, 0x89, 0x44, 0x89, 0x3c, 0xaa, 0x3c, 0xa9, 0x3c, 0xa9, 0x3c, 0x88, 0x3c, 0x88, 0x34, 0x67, 0x2c, 0x47, 0x24, 0xac, 0x44, 0x71, 0x5d, 0x50, 0x4d, 0xed, 0x34, 0x0d, 0x55, 0x68, 0x2c, 0x94, 0x0c, 0x3e, 0x1d, 0x1e, 0x05, 0x97, 0x3c, 0x8b, 0x8c, 0xee, 0x64, 0xe6, 0x2b, 0xa0, 0x03, 0x40, 0x1e, 0xe0, 0x2e, 0x00, 0x27, 0x6d, 0x04, 0x13, 0x00, 0x15, 0x00, 0xb8, 0x00, 0x4e, 0x01, 0x14, 0xa9, 0xd9, 0xfb, 0x83, 0xfe, 0x60, 0xff, 0x20, 0xc4, 0x01, 0xaa, 0x40, 0x92, 0xa0, 0x19, 0x61, 0x02, 0x62, 0x03, 0x23, 0x04, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xb6, 0xea, 0xf4, 0x2d, 0xfb, 0xc8, 0xf1, 0x0a, 0xf3, 0x48, 0xec, 0xb1, 0xdd, 0x72, 0xc5, 0x2d, 0x94, 0xa9, 0x8b, 0xed, 0xab, 0x34, 0x7b, 0x76, 0x5b, 0xb5, 0x23, 0x72, 0x03, 0x4f, 0x03, 0x2f, 0x03, 0x4f, 0x03, 0xb1, 0x03, 0xd1, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xd0, 0x03, 0xf1, 0x03, 0xb5, 0x04, 0x94, 0x04, 0x10, 0x04, 0x8e, 0x03, 0xad, 0x9d, 0x8f, 0xde, 0x15, 0xc3, 0x30, 0xea, 0xd4, 0xfb, 0x9c, 0xfd, 0x99, 0xd5, 0x47, 0x3c, 0x47, 0x44, 0x69, 0x4c, 0x8a, 0x54, 0x68, 0x4c, 0x48, 0x44, 0x68, 0x44, 0x89, 0x4c, 0x89, 0x4c, 0x89, 0x44, 0x68, 0x44, 0x89, 0x44, 0xa9, 0x3c, 0xa9, 0x3c, 0x89, 0x3c, 0x88, 0x34, 0x87, 0x2c, 0xcb, 0x3c, 0x71, 0x6d, 0xd5, 0x85, 0xb4, 0x75, 0x72, 0x75, 0xb3, 0x95, 0x15, 0x9e, 0xb4, 0x8d, 0x73, 0x85, 0x39, 0xa6, 0xbd, 0xb6, 0x9d, 0xae, 0x74, 0x8d, 0x29, 0x54, 0x20, 0x03, 0xe0, 0x02, 0x40, 0x1d, 0xe0, 0x36, 0x00, 0x2f, 0x80, 0x1e, 0xf1, 0x01, 0x16, 0x00, 0xb5, 0x01, 0x51, 0x02, 0x6a, 0x02, 0xc6, 0xc0, 0xe6, 0xf8, 0x21, 0xfd, 0x01, 0xd6, 0xc0, 0x72, 0x00, 0x02, 0xa1, 0x02, 0x82, 0x03, 0x64, 0x0c, 0x86, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x05, 0xca, 0xe3, 0x8b, 0xfb, 0x84, 0xfc, 0x86, 0xe4, 0x03, 0xd3, 0xec, 0xe2, 0xae, 0xca, 0xa3, 0x89, 0x67, 0xb2, 0x4e, 0xa2, 0xf1, 0xb1, 0xef, 0xb9, 0x4c, 0xaa, 0x89, 0xa2, 0x68, 0xa2, 0xe9, 0xa2, 0x69, 0xab, 0xaa, 0x8a, 0xb0, 0x8a, 0xf0, 0xa2, 0x4d, 0x9b, 0x6e, 0x93, 0xcf, 0x93, 0x56, 0x65, 0xf5, 0x44, 0xaf, 0x13, 0x2d, 0x03, 0x2b, 0x7c, 0xe7, 0xbb, 0x13, 0xe8, 0x13, 0xf0, 0x01, 0xe0, 0xa7, 0xc0, 0xb6, 0x9b, 0xae, 0x5c, 0x47, 0x44, 0x68, 0x4c, 0x68, 0x4c, 0x48, 0x4c, 0x68, 0x4c, 0x68, 0x4c, 0x69, 0x4c, 0x89, 0x4c, 0x89, 0x4c, 0x89, 0x44, 0xa9, 0x44, 0x89, 0x3c, 0x88, 0x34, 0x87, 0x2c, 0xeb, 0x54, 0xf3, 0x8d, 0xb9, 0xb6, 0x37, 0xa6, 0xb4, 0x95, 0x36, 0xb6, 0x78, 0xbe, 0x17, 0x9e, 0xf7, 0x9d, 0x7a, 0xb6, 0xfd, 0xce, 0x1e, 0xd7, 0x3e, 0xd7, 0xbb, 0xce, 0x17, 0xbe, 0xf6, 0xbd, 0x94, 0xad, 0xf0, 0x84, 0xc5, 0x25, 0xc0, 0x36, 0x20, 0x2f, 0x21, 0x1d, 0xeb, 0x68, 0x2f, 0x83, 0xea, 0x22, 0x86, 0x02, 0x69, 0x62, 0xc8, 0xd0, 0xe0, 0xc0, 0x00, 0x79, 0xc0, 0x01, 0xc1, 0x02, 0xc3, 0x03, 0xa4, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0xc3, 0x03, 0xc7, 0x7b, 0x89, 0xf3, 0x06, 0xf2, 0xe7, 0xe8, 0x04, 0xf0, 0x0d, 0xf8, 0x0b, 0xf8, 0x00, 0xc8, 0x00, 0xc8, 0x00, 0xb0, 0x00, 0xc0, 0x00, 0xe8, 0x40, 0xe0, 0x40, 0xd0, 0x00, 0xc8, 0xa0, 0xe2, 0xe0, 0xeb, 0x49, 0xc8, 0x15, 0xd8, 0xcb, 0xf8, 0x80, 0xf9, 0x40, 0xfa, 0x45, 0xc3, 0xdb, 0xb6, 0x7e, 0xc7, 0xdc, 0xae, 0x39, 0x96, 0x15, 0x9d, 0x28, 0xb9, 0x16, 0xb8, 0x5c, 0xc0, 0x32, 0x68, 0x04, 0x08, 0x5c, 0x32, 0xd4, 0x74, 0x66, 0x44, 0x89, 0x4c, 0x89, 0x54, 0x68, 0x4c, 0x69, 0x4c, 0x89, 0x54, 0x89, 0x4c, 0x89, 0x4c, 0x89, 0x4c, 0x88, 0x44, 0x88, 0x3c, 0x88, 0x44, 0x0d, 0x6d, 0xd3, 0x95, 0x36, 0xae, 0x16, 0xae, 0x16, 0xae, 0x78, 0xc6, 0x99, 0xc6, 0x7a, 0xb6, 0x33, 0x75, 0x59, 0xae, 0x1d, 0xd7, 0x5e, 0xdf, 0x3e, 0xdf, 0x3e, 0xd7, 0x1e, 0xd7, 0x38, 0xbe, 0xf7, 0xbd, 0x17, 0xbe, 0x37, 0xc6, 0x54, 0x95, 0xaa, 0x02, 0x0e, 0x04, 0x13, 0x0e, 0x28, 0x34, 0x60, 0x4a, 0x00, 0x7b, 0x03, 0x5b, 0x06, 0x2b, 0x66, 0x6a, 0xc4, 0x71, 0x60, 0x02, 0x22, 0x03, 0xe2, 0x03, 0x65, 0x15, 0x00, 0x00, 0xf0, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x41, 0x02, 0x20, 0x02, 0x80, 0x69, 0x69, 0xd1, 0x49, 0xf9, 0x02, 0xe0, 0x08, 0xc8, 0x05, 0xea, 0xc0, 0xfc, 0x40, 0xf5, 0x00, 0xdc, 0x01, 0xf1, 0x00, 0xf8, 0x00, 0xf0, 0x80, 0xc8, 0xa0, 0xd0, 0x60, 0xd1, 0x00, 0xd2, 0x8a, 0xe1, 0xab, 0xf9, 0xe0, 0xf9, 0xe0, 0xf9, 0xc0, 0xaa, 0x2b, 0x44, 0x1c, 0xb7, 0xbf, 0xcf, 0x9f, 0xcf, 0xbf, 0xcf, 0x5e, 0xc7, 0xcd, 0xdb, 0x0c, 0xb8, 0x19, 0x60, 0x33, 0x50, 0xb2, 0x20, 0x1f, 0x22, 0xb4, 0x74, 0x87, 0x4c, 0x69, 0x4c, 0x8a, 0x54, 0x89, 0x54, 0x89, 0x54, 0x8a, 0x54, 0x8a, 0x4c, 0x89, 0x4c, 0x69, 0x4c, 0xcb, 0x5c, 0x4f, 0x7d, 0xf4, 0xa5, 0x16, 0xae, 0xd5, 0xa5, 0x16, 0xb6, 0x78, 0xc6, 0x37, 0xbe, 0xf2, 0x8c, 0x7b, 0xae, 0x7f, 0xcf, 0x39, 0x96, 0x4e, 0x3c, 0xf1, 0x6c, 0xb6, 0x95, 0xbb, 0xbe, 0x3d, 0xcf, 0xdb, 0xce, 0xd6, 0xbd, 0x17, 0xbe, 0x37, 0xc6, 0x17, 0xbe, 0x2e, 0x5c, 0x8d, 0x4c, 0xbd, 0x3e, 0xfc, 0x05, 0xa6, 0x02, 0x20, 0x03, 0x60, 0x3b, 0x00, 0x43, 0xa0, 0x22, 0xc0, 0x02, 0x61, 0x03, 0x23, 0x04, 0xa6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0xa0, 0x01, 0x60, 0x01, 0x00, 0x01, 0xa0, 0x30, 0xc0, 0xc8, 0xa4, 0xf1, 0xc0, 0xf1, 0x84, 0xf5, 0xc8, 0xff, 0x60, 0xff, 0xe0, 0xfd, 0x80, 0xda, 0x00, 0xf2, 0x80, 0xe8, 0x00, 0xa8, 0xa0, 0xc8, 0xc0, 0xe9, 0x00, 0xf2, 0xc0, 0xf9, 0x80, 0xf9, 0x41, 0xf1, 0xe3, 0xc9, 0xa8, 0x6b, 0x94, 0x35, 0x3d, 0xbf, 0xbf, 0xd7, 0x9f, 0xcf, 0xfb, 0xb6, 0xb4, 0x85, 0xcb, 0xa3, 0xe5, 0xd8, 0x13, 0xa8, 0x0f, 0x48, 0x3a, 0x19, 0xd5, 0x00, 0x31, 0x6c, 0xab, 0x5c, 0x69, 0x4c, 0x89, 0x54, 0x8a, 0x54, 0x8a, 0x4c, 0x69, 0x44, 0x8a, 0x4c, 0xec, 0x64, 0x2f, 0x7d, 0x51, 0x8d, 0x52, 0x95, 0x95, 0xa5, 0x37, 0xb6, 0x58, 0xc6, 0xb5, 0xa5, 0xd1, 0x84, 0xed, 0x5b, 0xb7, 0x95, 0x9f, 0xcf, 0x9f, 0xcf, 0x9f, 0xcf, 0x59, 0x96, 0x2a, 0x04, 0x64, 0x03, 0x4b, 0x04, 0x94, 0x55, 0x7d, 0x77, 0xdb, 0x9e, 0x37, 0xbe, 0xd4, 0xc5, 0xee, 0xa4, 0x24, 0x33, 0x6b, 0x5c, 0xd6, 0x6e, 0x53, 0x3e, 0x00, 0x03, 0xe0, 0x12, 0xa0, 0x12, 0xc1, 0x02, 0x82, 0x03, 0x64, 0x0c, 0xf0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x20, 0x01, 0x00, 0x01, 0x60, 0x00, 0x40, 0x59, 0xc0, 0x91, 0xa2, 0xa9, 0xe0, 0xe2, 0x80, 0xfd, 0xc9, 0xff, 0x89, 0xfe, 0xa0, 0xeb, 0x20, 0xaa, 0xa0, 0xb3, 0xa0, 0xe5, 0x40, 0xdc, 0x60, 0xea, 0x20, 0xfa, 0x83, 0xf1, 0xe4, 0xf8, 0x02, 0xf9, 0x66, 0xd9, 0xe5, 0xa1, 0x6e, 0x5b, 0x1d, 0x2f, 0xbf, 0xc7, 0x5d, 0xc7, 0x15, 0x9e, 0xef, 0x74, 0xcf, 0x5c, 0xcd, 0xa4, 0x02, 0xe4, 0x09, 0xdb, 0x4c, 0x72, 0x75, 0x4a, 0x07, 0x58, 0x4f, 0xb3, 0xce, 0x74, 0x69, 0x44, 0x6a, 0x4c, 0x69, 0x4c, 0xcb, 0x5c, 0xed, 0x74, 0x2f, 0x85, 0x0f, 0x8d, 0x11, 0x8d, 0x94, 0xa5, 0x57, 0xbe, 0x75, 0xce, 0xd0, 0xbd, 0x8e, 0x7c, 0x4c, 0x6c, 0xca, 0x53, 0xf2, 0x7c, 0x5f, 0xcf, 0x9f, 0xd7, 0x9f, 0xcf, 0x7f, 0xcf, 0x9f, 0xcf, 0x9a, 0x9e, 0x6c, 0x1c, 0x2a, 0x04, 0xf6, 0x05, 0xbf, 0x07, 0x9d, 0x27, 0x99, 0x5e, 0x65, 0x6c, 0xe0, 0x6b, 0x44, 0x13, 0x14, 0x05, 0x18, 0x06, 0xa3, 0x23, 0x80, 0x0a, 0xe1, 0x02, 0x82, 0x03, 0x63, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x60, 0x5a, 0xc0, 0xa3, 0xa0, 0x8a, 0xa0, 0x99, 0x20, 0xb2, 0xe0, 0xa9, 0x20, 0xc4, 0xe4, 0xf6, 0xe5, 0xfd, 0x26, 0xf5, 0x82, 0xdd, 0xe0, 0xdd, 0x60, 0xee, 0x16, 0xfd, 0x5a, 0xfb, 0xf1, 0xe9, 0x29, 0x90, 0x30, 0x98, 0x95, 0xa8, 0xd6, 0x90, 0x14, 0x71, 0x4c, 0x62, 0x53, 0x65, 0x9a, 0x8e, 0x76, 0x5d, 0x14, 0x4d, 0x14, 0x5d, 0xf4, 0x4c, 0x13, 0x8d, 0x83, 0xcc, 0x80, 0xbb, 0xc0, 0xb2, 0x07, 0xca, 0x01, 0xd8, 0x29, 0xea, 0x6e, 0x84, 0x69, 0x34, 0xcc, 0x6c, 0x4f, 0x95, 0x50, 0x95, 0xcf, 0x8c, 0xf0, 0x8c, 0xb4, 0xad, 0x15, 0xbe, 0x93, 0xd6, 0x2e, 0xef, 0x67, 0xff, 0x03, 0xff, 0xa8, 0xbd, 0xc6, 0x53, 0x6e, 0x64, 0x3e, 0xcf, 0xbf, 0xd7, 0x9f, 0xd7, 0x9f, 0xd7, 0x9f, 0xcf, 0x9f, 0xcf, 0x9f, 0xcf, 0xdc, 0xae, 0x10, 0x45, 0xcc, 0x44, 0x0a, 0x6d, 0x6e, 0x4d, 0x17, 0x06, 0x17, 0x06, 0xf4, 0x2d, 0x26, 0x04, 0xcb, 0x03, 0x07, 0x03, 0xc0, 0x02, 0x82, 0x03, 0xa4, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x21, 0x20, 0x63, 0x60, 0xac, 0xc0, 0xd4, 0xe0, 0xe3, 0x80, 0xb2, 0xa0, 0xa2, 0x60, 0xc3, 0xa0, 0xd3, 0x63, 0xdc, 0xea, 0xfe, 0xe2, 0xf5, 0x80, 0xc3, 0xad, 0xdb, 0xde, 0xfb, 0x5f, 0xfc, 0x5f, 0xfc, 0x5b, 0xeb, 0x34, 0xaa, 0xb3, 0x69, 0xb1, 0x29, 0x8e, 0x3a, 0xa6, 0x53, 0x00, 0x65, 0xec, 0x34, 0x76, 0x04, 0x3a, 0x05, 0x3b, 0x05, 0xfb, 0x04, 0x9a, 0x34, 0x27, 0xa3, 0x44, 0xab, 0x52, 0xea, 0x06, 0xfa, 0x60, 0xe2, 0x62, 0xba, 0xee, 0xa4, 0x90, 0xa5, 0x50, 0xa5, 0xf0, 0x94, 0x52, 0x9d, 0xf6, 0xb5, 0xd4, 0xad, 0xcf, 0x8c, 0xc7, 0x63, 0x64, 0x84, 0x26, 0x9d, 0xc6, 0xbd, 0xe4, 0xc5, 0xc1, 0xc5, 0x83, 0x84, 0xb5, 0x9d, 0x3d, 0xcf, 0x3d, 0xcf, 0x7e, 0xcf, 0x9f, 0xd7, 0x9f, 0xd7, 0xbf, 0xd7, 0x7f, 0xcf, 0xba, 0xbe, 0xef, 0x74, 0x90, 0x65, 0xb1, 0x55, 0x4a, 0x14, 0xc9, 0x04, 0xf6, 0x3e, 0xef, 0x1c, 0xc0, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x42, 0x80, 0x6b, 0x40, 0x32, 0x80, 0x52, 0x80, 0xa3, 0xa0, 0xd3, 0x00, 0xec, 0xe0, 0xfc, 0x00, 0xec, 0xa0, 0x81, 0xe0, 0x82, 0xe0, 0xd4, 0x04, 0xe4, 0xf9, 0xf3, 0x3f, 0xfc, 0x7e, 0xfc, 0xdb, 0xf3, 0x56, 0xd3, 0x2c, 0xa3, 0x60, 0x5a, 0x20, 0x32, 0x40, 0x53, 0x81, 0x4b, 0x24, 0x55, 0x88, 0x4d, 0x2b, 0x03, 0x8f, 0x03, 0xb7, 0x04, 0xfc, 0x04, 0x9c, 0x04, 0x2e, 0xab, 0xa9, 0xcb, 0xb9, 0xf4, 0x6d, 0xe4, 0x60, 0x9a, 0x05, 0x6b, 0x31, 0xa5, 0x11, 0x9d, 0x53, 0x9d, 0xd5, 0xb5, 0x93, 0xad, 0x4d, 0x84, 0xa9, 0x63, 0xc9, 0x63, 0xa8, 0x5b, 0xc7, 0x5b, 0xa5, 0x53, 0x06, 0x64, 0xca, 0x4b, 0x2e, 0x4c, 0xeb, 0x5b, 0x83, 0x3a, 0x45, 0x4b, 0x29, 0x64, 0xab, 0x74, 0x0e, 0x7d, 0xd4, 0x85, 0x36, 0xa6, 0xf1, 0x8c, 0xc5, 0x7b, 0x89, 0x5c, 0x2e, 0x6d, 0x1b, 0x05, 0x0f, 0x1d, 0xc0, 0x4d, 0x40, 0x5d, 0x80, 0x23, 0xc3, 0x03, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x74, 0x20, 0xce, 0x80, 0x83, 0xc0, 0x31, 0x80, 0x21, 0x20, 0x5a, 0x20, 0xab, 0x80, 0xe3, 0x80, 0xca, 0xa0, 0x81, 0x20, 0x41, 0x60, 0x21, 0x84, 0x82, 0xd5, 0xcb, 0x17, 0xf3, 0x92, 0xf1, 0x83, 0xd0, 0x01, 0xa2, 0xe8, 0x82, 0xa3, 0x71, 0xe0, 0x52, 0xc0, 0x5b, 0x00, 0x54, 0x22, 0x3d, 0xc6, 0x3c, 0x2e, 0x03, 0xeb, 0x02, 0xea, 0x02, 0xb3, 0x03, 0x7c, 0x65, 0x57, 0xad, 0xee, 0x9b, 0x6b, 0xbc, 0xa2, 0xb3, 0x89, 0x8b, 0xf1, 0x9c, 0x73, 0xa5, 0x73, 0xad, 0xef, 0xa4, 0xca, 0x7b, 0xa8, 0x63, 0xe9, 0x6b, 0xc9, 0x63, 0xe9, 0x63, 0xc9, 0x63, 0x0b, 0x64, 0x0d, 0x5c, 0x30, 0x54, 0x31, 0x4c, 0xb6, 0xad, 0x91, 0xc5, 0x00, 0x5b, 0xc0, 0x01, 0x00, 0x32, 0x68, 0x3b, 0x56, 0x35, 0x3a, 0x06, 0xaf, 0x6c, 0xb3, 0x7b, 0x29, 0x4b, 0x4e, 0x45, 0x09, 0x34, 0x27, 0x03, 0xa0, 0x13, 0x41, 0x2c, 0x02, 0x04, 0x08, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0xc0, 0x64, 0xe0, 0xad, 0x80, 0x9c, 0x60, 0x4a, 0x00, 0x42, 0xe0, 0x39, 0xe0, 0x4a, 0x20, 0x5a, 0xc0, 0x79, 0xe0, 0x71, 0xe0, 0x69, 0x00, 0x5a, 0x40, 0x12, 0x00, 0x02, 0x45, 0x8a, 0xeb, 0xd9, 0x80, 0xe9, 0x49, 0xca, 0xaf, 0x92, 0x6a, 0x88, 0x00, 0x73, 0xc0, 0x6b, 0x47, 0x64, 0xe7, 0x23, 0xe0, 0x02, 0x2d, 0x03, 0x2f, 0x03, 0xaf, 0x02, 0x72, 0x6c, 0x7e, 0xdf, 0xdb, 0xd6, 0xe3, 0x59, 0xc4, 0x52, 0x45, 0x83, 0xab, 0x93, 0xd1, 0xa4, 0x0c, 0x84, 0xc9, 0x83, 0x8d, 0x9c, 0x8f, 0x94, 0xcb, 0x6b, 0xea, 0x63, 0xec, 0x6b, 0xee, 0x6b, 0xd0, 0x63, 0xd1, 0x5b, 0xf1, 0x5b, 0xd0, 0x4b, 0x13, 0x95, 0x1b, 0xef, 0x1b, 0xf7, 0x33, 0xd6, 0xe2, 0x83, 0xc0, 0x5b, 0xd1, 0x4c, 0x93, 0x34, 0x8b, 0x53, 0x0f, 0x9d, 0x52, 0x7c, 0x85, 0x4b, 0x05, 0x03, 0xa0, 0x02, 0x40, 0x03, 0xe1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x5a, 0xa0, 0x64, 0xe0, 0x74, 0x80, 0x5b, 0x80, 0x4a, 0x00, 0x42, 0xe0, 0x39, 0x00, 0x8d, 0x60, 0xc6, 0xe0, 0x94, 0x00, 0x5b, 0x00, 0x52, 0x80, 0x52, 0x80, 0x54, 0x21, 0x6e, 0xc0, 0x1c, 0x60, 0x3b, 0xc0, 0x9a, 0xca, 0xc1, 0x11, 0x48, 0x1a, 0x22, 0x51, 0x62, 0x00, 0x6b, 0xf7, 0x4d, 0x5c, 0x06, 0x8c, 0x03, 0xca, 0x0a, 0xf1, 0x02, 0x77, 0x6c, 0x5e, 0xdf, 0xff, 0xf7, 0x7e, 0xef, 0xac, 0x83, 0x48, 0x33, 0xa7, 0x23, 0xd3, 0x04, 0x56, 0x4d, 0x0a, 0x6b, 0x69, 0x73, 0xec, 0x7b, 0x6f, 0x94, 0xce, 0x73, 0xd0, 0x63, 0xd1, 0x63, 0xf2, 0x6b, 0xf2, 0x6b, 0xd1, 0x5b, 0xb0, 0x53, 0x51, 0x74, 0xba, 0xee, 0x1b, 0xf7, 0xd9, 0xee, 0xf1, 0xcd, 0x04, 0xa5, 0x44, 0xa5, 0x0a, 0x75, 0x86, 0x53, 0x80, 0x5b, 0x02, 0x74, 0xe0, 0x32, 0x02, 0x03, 0xe4, 0x0b, 0x24, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x5d, 0x00, 0x6d, 0x40, 0x5c, 0x00, 0x3b, 0xe0, 0x42, 0xc0, 0x4a, 0x00, 0x3a, 0xc0, 0x3a, 0x80, 0xc6, 0xa0, 0xef, 0x20, 0xe7, 0x20, 0xbe, 0xe0, 0x94, 0x80, 0x74, 0x01, 0x4d, 0x23, 0x3e, 0xc1, 0x15, 0x60, 0x04, 0x60, 0x3b, 0x50, 0x4b, 0x1f, 0x1b, 0xbb, 0x50, 0xab, 0x63, 0x5e, 0x1f, 0xdf, 0x07, 0x3e, 0x07, 0xf4, 0x04, 0xb8, 0x6c, 0x7f, 0xe7, 0xff, 0xf7, 0xdf, 0xf7, 0xdf, 0xf7, 0x91, 0xa4, 0x00, 0x00, 0xe7, 0x21, 0x79, 0x5d, 0xb9, 0x95, 0x91, 0xb8, 0x52, 0x69, 0xea, 0x79, 0x47, 0x8a, 0x69, 0x92, 0x8b, 0x9a, 0xed, 0x9a, 0x6f, 0x93, 0xb0, 0x6b, 0xd0, 0x5b, 0xcf, 0x5b, 0x16, 0xd6, 0x97, 0xee, 0xf1, 0xe5, 0x86, 0xac, 0xe2, 0x63, 0xaa, 0xa5, 0xe7, 0xb5, 0x46, 0x8d, 0x83, 0x4c, 0x23, 0x2c, 0x40, 0x02, 0x83, 0x03, 0x68, 0x1d, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x5d, 0x80, 0x5c, 0x80, 0x3b, 0x00, 0x33, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x43, 0x60, 0x2a, 0xc0, 0x53, 0x20, 0xd7, 0xc0, 0xf7, 0xc0, 0xf7, 0xa0, 0xef, 0x60, 0xbe, 0x60, 0x74, 0x60, 0x0a, 0xe0, 0x03, 0x62, 0x05, 0xc4, 0x05, 0xe1, 0x14, 0xab, 0x2b, 0xd7, 0x39, 0x9a, 0x45, 0xff, 0x07, 0xff, 0x07, 0xdf, 0x07, 0x5f, 0x06, 0x18, 0x9d, 0x5d, 0xef, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xf7, 0x17, 0xce, 0x00, 0x00, 0x07, 0xa8, 0x09, 0xe8, 0x85, 0xd9, 0xa4, 0xfa, 0x4a, 0xea, 0x84, 0xa8, 0x00, 0x80, 0x00, 0x90, 0x00, 0xa8, 0x00, 0xc8, 0x20, 0xa0, 0xc3, 0x58, 0x86, 0x61, 0xc9, 0xa3, 0x6b, 0xe5, 0xe4, 0x7a, 0x60, 0xb4, 0x40, 0x7b, 0x83, 0x7c, 0x64, 0xa5, 0x02, 0x64, 0x40, 0x23, 0x80, 0x03, 0x82, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xad, 0x20, 0x6d, 0x80, 0x5c, 0x20, 0x54, 0x40, 0x5c, 0x80, 0x64, 0x80, 0x64, 0x80, 0x64, 0xc0, 0x4b, 0x40, 0x85, 0x80, 0xe7, 0xc0, 0xef, 0x60, 0xdf, 0x20, 0xd7, 0x00, 0xcf, 0x20, 0xb6, 0x40, 0x74, 0xe0, 0x2a, 0xa3, 0x04, 0x05, 0x16, 0xa0, 0x0d, 0x20, 0x14, 0x90, 0x1c, 0xdb, 0x1e, 0xbf, 0x0e, 0xbf, 0x05, 0x5f, 0x04, 0x17, 0x31, 0x49, 0x8a, 0x97, 0xdd, 0x9e, 0xf7, 0xff, 0xff, 0x1c, 0xe7, 0x84, 0x91, 0x06, 0xf8, 0x09, 0xc0, 0x48, 0x61, 0x06, 0xf3, 0x00, 0xfb, 0xc0, 0xfa, 0xc0, 0xc1, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xc0, 0x80, 0x98, 0x80, 0x81, 0x00, 0xba, 0x68, 0xcc, 0xa0, 0xbc, 0xe0, 0x93, 0x00, 0xbd, 0x81, 0x4b, 0xc1, 0x5b, 0xc0, 0x22, 0x40, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xad, 0xe0, 0x85, 0xa0, 0x7d, 0x80, 0x7d, 0x60, 0x75, 0x40, 0x75, 0x40, 0x75, 0x40, 0x75, 0x40, 0x75, 0x20, 0x75, 0x20, 0xa6, 0x40, 0xa6, 0xc0, 0x9d, 0xa0, 0x95, 0xc0, 0x9d, 0xe0, 0xa5, 0xa0, 0x9d, 0x40, 0x6c, 0x20, 0x02, 0xc0, 0x02, 0x82, 0x0c, 0x62, 0x0d, 0x00, 0x04, 0x80, 0x12, 0x93, 0x22, 0xfd, 0x0c, 0xff, 0x04, 0xfd, 0x29, 0x0c, 0x78, 0x09, 0xc8, 0xee, 0xc2, 0x18, 0xee, 0x5e, 0xf7, 0x8f, 0xf3, 0x07, 0xc8, 0x06, 0x38, 0x07, 0x39, 0xeb, 0xc9, 0x40, 0xe2, 0x00, 0xfb, 0x20, 0xfb, 0x40, 0xda, 0x60, 0xb0, 0x00, 0xb1, 0xc0, 0x99, 0x40, 0x79, 0xc7, 0x9a, 0xe9, 0xdc, 0x40, 0xd5, 0xa1, 0xa4, 0x60, 0x63, 0xa0, 0x02, 0xa0, 0x02, 0xe0, 0x02, 0xa0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x5d, 0x80, 0x4c, 0x80, 0x4c, 0x80, 0x54, 0xa0, 0x54, 0x80, 0x54, 0xa0, 0x54, 0xc0, 0x5c, 0xe0, 0x64, 0x00, 0x6d, 0x60, 0x75, 0x20, 0x65, 0x20, 0x34, 0xe0, 0x02, 0x20, 0x02, 0x00, 0x02, 0x20, 0x02, 0x40, 0x12, 0x20, 0x02, 0x00, 0x02, 0x00, 0x02, 0xa0, 0x02, 0x80, 0x03, 0x40, 0x03, 0xa0, 0x02, 0xca, 0x02, 0x76, 0x23, 0x1c, 0x5b, 0x1b, 0x5a, 0x90, 0xa8, 0x01, 0xd8, 0x40, 0xf1, 0xce, 0xfb, 0x50, 0xe3, 0x13, 0x60, 0x0b, 0x60, 0x6a, 0x48, 0xf4, 0x90, 0x00, 0x90, 0xc0, 0x98, 0xc0, 0xc1, 0x80, 0xe2, 0x80, 0xe2, 0x00, 0xa2, 0xe0, 0x60, 0x83, 0xb9, 0x8a, 0xcc, 0x24, 0xac, 0x20, 0x6b, 0x80, 0x1a, 0xe2, 0x02, 0x82, 0x03, 0xc3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x05, 0x60, 0x0b, 0x20, 0x0b, 0x20, 0x13, 0x40, 0x23, 0x80, 0x2b, 0xc0, 0x33, 0x00, 0x3c, 0x00, 0x3c, 0xc0, 0x54, 0x40, 0x6d, 0x60, 0x6d, 0x20, 0x65, 0xc0, 0x4c, 0x00, 0x3c, 0xe0, 0x12, 0x20, 0x02, 0xe0, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0xa3, 0x3a, 0xc3, 0x42, 0x20, 0x02, 0x20, 0x03, 0x20, 0x03, 0x60, 0x0a, 0x2c, 0x2a, 0xf9, 0x02, 0xd1, 0x99, 0xc0, 0xf8, 0xc0, 0xfa, 0x73, 0xfd, 0xb2, 0xec, 0x19, 0x90, 0x1d, 0x50, 0x59, 0x82, 0x79, 0xc2, 0x00, 0xa8, 0xc0, 0xa0, 0xe0, 0x88, 0xa0, 0xaa, 0x00, 0xf4, 0xe0, 0xd2, 0xc0, 0xa1, 0x43, 0xc2, 0x07, 0x73, 0x00, 0x02, 0xa1, 0x02, 0x42, 0x03, 0xc9, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x05, 0x00, 0x0b, 0xc0, 0x02, 0xa0, 0x02, 0xa0, 0x02, 0xc0, 0x0a, 0x00, 0x1b, 0x20, 0x1b, 0xa0, 0x2b, 0x60, 0x4c, 0xa0, 0x54, 0xc0, 0x5c, 0x00, 0x5d, 0x00, 0x55, 0xe0, 0x4c, 0xc0, 0x44, 0x20, 0x34, 0x20, 0x13, 0x40, 0x02, 0x00, 0x02, 0xa0, 0x01, 0x48, 0x84, 0xed, 0xc5, 0x2b, 0xa5, 0xa6, 0x6b, 0xc0, 0x0a, 0x00, 0x03, 0x40, 0x02, 0xa0, 0x01, 0x65, 0x41, 0xc4, 0xc9, 0x36, 0xfd, 0x7e, 0xfe, 0xda, 0xfd, 0xec, 0xe1, 0x3a, 0xa8, 0xde, 0xa2, 0x37, 0xd2, 0x00, 0xe1, 0x60, 0x99, 0xa0, 0x61, 0xe0, 0xd3, 0x60, 0xec, 0xe0, 0xaa, 0xa0, 0x59, 0x21, 0x02, 0xe1, 0x02, 0x65, 0x0c, 0xca, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0xa0, 0x02, 0x80, 0x02, 0xa0, 0x02, 0xa0, 0x0a, 0xa0, 0x0a, 0xa0, 0x0a, 0xa0, 0x0a, 0x60, 0x2b, 0xc0, 0x33, 0xc0, 0x33, 0xc0, 0x33, 0x80, 0x2b, 0x60, 0x2b, 0xa0, 0x2b, 0x00, 0x34, 0x20, 0x2c, 0xc0, 0x23, 0x40, 0x1b, 0x40, 0x0a, 0x80, 0x01, 0xc9, 0x94, 0x6e, 0xce, 0xb0, 0xd6, 0x6e, 0xce, 0xa6, 0x7c, 0xa0, 0x02, 0xa0, 0x02, 0x80, 0x02, 0xe0, 0x01, 0x20, 0x01, 0x71, 0x93, 0x7b, 0xe5, 0x3f, 0xfe, 0x14, 0xfc, 0x4f, 0xe1, 0xd4, 0xc1, 0x4c, 0xa9, 0x00, 0xb2, 0xc0, 0xa1, 0xe0, 0xa2, 0x20, 0x93, 0x00, 0x4a, 0x21, 0x02, 0x84, 0x03, 0xa6, 0x04, 0xf0, 0x47, 0xf5, 0x5f, 0xe8, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0xc0, 0x02, 0xa0, 0x02, 0x60, 0x02, 0x60, 0x02, 0x60, 0x02, 0x60, 0x02, 0xc0, 0x12, 0x20, 0x23, 0x21, 0x23, 0x01, 0x23, 0xe1, 0x22, 0xa0, 0x1a, 0x60, 0x1a, 0x40, 0x12, 0x20, 0x0a, 0x02, 0x0a, 0xc3, 0x09, 0xa4, 0x11, 0x87, 0x21, 0x49, 0x31, 0xe8, 0x39, 0x63, 0x3a, 0xc4, 0x42, 0x65, 0x5b, 0x83, 0x4b, 0x40, 0x23, 0x80, 0x33, 0x20, 0x2b, 0x80, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0x04, 0x21, 0xf4, 0xa3, 0x76, 0xec, 0x80, 0xf0, 0x84, 0xe0, 0x40, 0xb2, 0xc0, 0x8a, 0x00, 0x7a, 0xe0, 0x41, 0x41, 0x02, 0x43, 0x03, 0xc6, 0x1c, 0xee, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x02, 0x00, 0x02, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0x00, 0x02, 0xa0, 0x12, 0xa1, 0x1a, 0xa2, 0x1a, 0x82, 0x12, 0x63, 0x12, 0x65, 0x12, 0x46, 0x0a, 0x68, 0x0a, 0x49, 0x02, 0x08, 0x02, 0xa8, 0x09, 0x47, 0x11, 0xe8, 0x18, 0xca, 0x30, 0xc9, 0x28, 0x03, 0x01, 0x00, 0x01, 0xa0, 0x00, 0xa0, 0x00, 0x00, 0x01, 0xe0, 0x21, 0x60, 0x2a, 0x80, 0x01, 0xc0, 0x01, 0x40, 0x42, 0x40, 0x69, 0x00, 0x00, 0xe2, 0x48, 0xe2, 0xb8, 0x49, 0xd1, 0x04, 0x82, 0xe0, 0x21, 0x20, 0x02, 0x43, 0x03, 0x28, 0x1d, 0x00, 0x00, 0xf0, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0x00, 0x02, 0x21, 0x0a, 0x43, 0x02, 0x86, 0x02, 0xc9, 0x02, 0x2c, 0x03, 0x2d, 0x03, 0x0e, 0x03, 0xcc, 0x02, 0x6b, 0x02, 0xe8, 0x09, 0x46, 0x09, 0xe7, 0x18, 0xe8, 0x18, 0x05, 0x09, 0x21, 0x01, 0x21, 0x01, 0x40, 0x01, 0x20, 0x01, 0x20, 0x01, 0xc0, 0x00, 0x80, 0x00, 0xa0, 0x00, 0x80, 0x00, 0xa0, 0x38, 0x20, 0x89, 0xc0, 0x48, 0x60, 0x00, 0x00, 0x01, 0xa0, 0x01, 0x41, 0x02, 0x02, 0x03, 0x23, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0x01, 0x02, 0x44, 0x02, 0xa7, 0x02, 0xea, 0x02, 0xeb, 0x02, 0xeb, 0x02, 0x8a, 0x02, 0x28, 0x02, 0xa5, 0x01, 0x25, 0x09, 0xe6, 0x10, 0xe6, 0x10, 0x02, 0x01, 0x00, 0x01, 0x20, 0x01, 0x20, 0x01, 0x40, 0x01, 0x40, 0x01, 0x60, 0x01, 0x60, 0x01, 0x60, 0x01, 0x60, 0x09, 0x60, 0x01, 0x60, 0x01, 0xc1, 0x01, 0x21, 0x02, 0xc2, 0x02, 0x62, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0x00, 0x02, 0x22, 0x02, 0x43, 0x02, 0x45, 0x02, 0x45, 0x02, 0x24, 0x02, 0xe3, 0x01, 0x03, 0x02, 0x03, 0x02, 0x23, 0x02, 0x42, 0x02, 0x61, 0x02, 0x61, 0x02, 0xa2, 0x02, 0x41, 0x02, 0xa1, 0x02, 0x02, 0x03, 0x02, 0x03, 0xe2, 0x0a, 0x02, 0x03, 0x22, 0x03, 0x42, 0x03, 0xa3, 0x03, 0x65, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0xc0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0x20, 0x02, 0x41, 0x02, 0x61, 0x02, 0x81, 0x02, 0xc1, 0x02, 0xe2, 0x02, 0x02, 0x03, 0x22, 0x03, 0x42, 0x03, 0x63, 0x03, 0x63, 0x03, 0x23, 0x03, 0x64, 0x03, 0xa4, 0x03, 0xe4, 0x03, 0x44, 0x04, 0x64, 0x04, 0x66, 0x04, 0xa5, 0x04, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x43, 0x03, 0x63, 0x03, 0xa3, 0x03, 0xc4, 0x03, 0xe4, 0x03, 0xe4, 0x03, 0x04, 0x04, 0x45, 0x04, 0x85, 0x04, 0xc6, 0x0c, 0x07, 0x05, 0x08, 0x06, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x05, 0xed, 0x07, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x03, 0x80, 0x2e, 0x8c, 0x06, 0x6c, 0x06, 0x8d, 0x26, 0x4c, 0x06, 0x8d, 0x1f, 0x0d, 0x3f, 0x6c, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x35, 0xeb, 0x5c, 0xa8, 0x64, 0x08, 0x43, 0x27, 0x4c, 0xab, 0x86, 0x52, 0x64, 0xa8, 0x43, 0x23, 0x83, 0xa7, 0x45, 0x4b, 0x25, 0xe9, 0x06, 0xc0, 0x06, 0x80, 0x07, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0x5c, 0xc8, 0x64, 0x09, 0x4b, 0x46, 0x54, 0x49, 0x8d, 0x0f, 0xa5, 0x91, 0x8c, 0xee, 0x8d, 0x10, 0xc6, 0xb9, 0xe5, 0x13, 0xa8, 0x00, 0xc0, 0x00, 0x68, 0x15, 0x02, 0x39, 0x5c, 0x56, 0x86, 0x32, 0x3e, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x33, 0x85, 0x2b, 0x04, 0x15, 0x09, 0x5d, 0x6c, 0x8d, 0x2e, 0x84, 0xed, 0x6c, 0xf0, 0x85, 0x33, 0xce, 0xdb, 0xad, 0xb2, 0x84, 0x22, 0x84, 0x70, 0xb5, 0xf8, 0xcd, 0x77, 0xda, 0x99, 0xca, 0x33, 0xb4, 0xdc, 0xbe, 0x5f, 0xdf, 0x1e, 0xb5, 0xf7, 0x0c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x20, 0x74, 0x89, 0x7c, 0xac, 0x5c, 0x09, 0x5b, 0xea, 0x95, 0x74, 0xa6, 0x37, 0x04, 0xf3, 0x06, 0x3a, 0x7d, 0x93, 0xc6, 0x79, 0xa5, 0xb5, 0x8d, 0x37, 0xb6, 0x5c, 0xc6, 0x9b, 0xa5, 0x34, 0xce, 0x1d, 0xe7, 0x3e, 0xd6, 0xfb, 0xad, 0xf5, 0x64, 0x90, 0x0a, 0x8d, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x60, 0x4b, 0x65, 0x43, 0x05, 0x34, 0x88, 0x3c, 0xed, 0x65, 0xf6, 0x44, 0x8f, 0x44, 0xef, 0x85, 0x31, 0xc6, 0x9a, 0xb6, 0x59, 0x24, 0xf5, 0x35, 0x55, 0x64, 0xf2, 0x95, 0x33, 0xb5, 0xb6, 0xe7, 0x3c, 0xbe, 0x78, 0x6c, 0x30, 0x63, 0xac, 0x84, 0xd0, 0x64, 0x50, 0x02, 0xa7, 0x03, 0x68, 0x03, 0xce, 0x01, 0x87, 0x11, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x48, 0x2c, 0xca, 0x3e, 0x51, 0x06, 0x16, 0x3c, 0xb1, 0x4c, 0xf1, 0x64, 0x09, 0x63, 0xec, 0x7d, 0x75, 0x55, 0xb7, 0x04, 0x33, 0x4c, 0xd4, 0x54, 0x6d, 0x8d, 0x13, 0x95, 0x35, 0xbe, 0x59, 0xdf, 0x5d, 0xc6, 0xfb, 0x7c, 0xd1, 0x74, 0x2d, 0x54, 0x91, 0x04, 0x31, 0x03, 0x91, 0x43, 0xae, 0x74, 0x0b, 0x44, 0x09, 0x2b, 0xc8, 0x04, 0x90, 0x03, 0x8d, 0x10, 0x04, 0x09, 0xc6, 0x04, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x27, 0x64, 0x8a, 0x4b, 0xc8, 0x53, 0xa8, 0x4d, 0x33, 0x26, 0x9a, 0x34, 0x90, 0x2d, 0x52, 0x25, 0x72, 0x7d, 0x33, 0xae, 0x17, 0x95, 0x54, 0x3c, 0x34, 0x75, 0x59, 0xae, 0x39, 0xbe, 0x18, 0xb5, 0xf8, 0xa5, 0xd6, 0x85, 0x94, 0x2c, 0x4f, 0x04, 0x2f, 0x33, 0x8a, 0x54, 0x6f, 0x4c, 0x92, 0x5c, 0x92, 0x7d, 0x32, 0x9d, 0xb2, 0x64, 0xed, 0x44, 0x2a, 0x04, 0x91, 0x12, 0x49, 0x18, 0x05, 0x99, 0xc5, 0x9c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x22, 0x43, 0x86, 0x32, 0xe5, 0x3c, 0x6a, 0x4d, 0x2c, 0x44, 0xab, 0x4d, 0xd3, 0x3c, 0x6b, 0x64, 0x8c, 0x84, 0xf3, 0xa5, 0xf7, 0x65, 0x34, 0x3c, 0x90, 0x04, 0x93, 0x3c, 0x92, 0x9d, 0x95, 0xa5, 0x96, 0xc6, 0xba, 0xc6, 0xd9, 0xae, 0x56, 0x75, 0x0f, 0x44, 0x0f, 0x0b, 0xed, 0x04, 0x0f, 0x0b, 0x8c, 0x1c, 0x31, 0x7c, 0xf0, 0x8d, 0x92, 0x7d, 0x73, 0xce, 0x58, 0xb6, 0x56, 0x8d, 0x71, 0x4c, 0x70, 0x53, 0x2c, 0x04, 0x6c, 0x23, 0x87, 0x22, 0x2c, 0x68, 0xe0, 0x6b, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x04, 0x26, 0x15, 0x09, 0x07, 0x2d, 0x34, 0x67, 0x74, 0xcc, 0x7c, 0x69, 0x6c, 0x2a, 0x74, 0x0e, 0x85, 0x12, 0x75, 0xb2, 0x2d, 0x13, 0x06, 0x19, 0x07, 0x1d, 0x9e, 0x19, 0xbe, 0x59, 0x8d, 0xd7, 0x7d, 0x75, 0xa5, 0xf7, 0xb6, 0x99, 0xa5, 0xd5, 0x8d, 0x53, 0x75, 0x30, 0x4d, 0x90, 0x04, 0xad, 0x04, 0x4b, 0x3c, 0x4c, 0x55, 0x0f, 0x55, 0x73, 0x95, 0xd6, 0xa6, 0x59, 0xbe, 0x35, 0x85, 0xf2, 0x55, 0x30, 0xad, 0x93, 0x6c, 0x8d, 0x7c, 0xaf, 0x44, 0x31, 0x5a, 0xa7, 0x3a, 0x60, 0x05, 0x34, 0x05, 0xfe, 0x03, 0x71, 0x03, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x6c, 0x95, 0x0d, 0x63, 0xe9, 0x3b, 0x06, 0x64, 0xab, 0x84, 0x6d, 0x9d, 0x11, 0x54, 0x6a, 0x44, 0xed, 0x8c, 0xce, 0xa5, 0x95, 0x9d, 0x95, 0x35, 0x37, 0x06, 0x1a, 0x46, 0x5c, 0x84, 0xf4, 0xad, 0xd6, 0xa5, 0x75, 0xb6, 0x98, 0x96, 0x14, 0x65, 0x8f, 0x44, 0xcc, 0x3c, 0x6b, 0x3c, 0x8c, 0x2d, 0x4f, 0x6d, 0x51, 0x8d, 0x92, 0x85, 0xf3, 0x85, 0xf1, 0x3d, 0xae, 0x9e, 0x14, 0xad, 0xf5, 0x8d, 0x92, 0x5d, 0xd1, 0x35, 0xcf, 0x9d, 0xd3, 0xa5, 0xb4, 0xb5, 0xf6, 0x54, 0x4f, 0x5b, 0x46, 0x58, 0x25, 0x02, 0xef, 0x05, 0xdd, 0x04, 0xfa, 0x09, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x88, 0x5b, 0xe7, 0x43, 0x04, 0x1b, 0x44, 0x64, 0xeb, 0x8c, 0x8b, 0x9d, 0x11, 0x6c, 0x2b, 0x8c, 0x2f, 0x94, 0x73, 0xbd, 0x14, 0xb2, 0xaa, 0x73, 0x09, 0x4b, 0xea, 0x2b, 0xa0, 0x8c, 0xf0, 0x8c, 0xd3, 0xa5, 0x75, 0xb5, 0xf8, 0xbe, 0x38, 0xad, 0xd3, 0x84, 0xce, 0x5c, 0x8d, 0x5d, 0x6d, 0x35, 0x6d, 0x2d, 0x0c, 0x54, 0xcd, 0x6d, 0x0f, 0x85, 0x90, 0x45, 0x8d, 0x95, 0xf3, 0xbe, 0x56, 0xb6, 0x14, 0x85, 0xf0, 0x05, 0xad, 0x8e, 0x12, 0x7d, 0x10, 0x64, 0xd2, 0x65, 0xd2, 0x05, 0xee, 0x8e, 0x53, 0x9e, 0x75, 0x4c, 0x4f, 0x43, 0xeb, 0x4c, 0xaa, 0x32, 0xea, 0x01, 0x80, 0x02, 0x2d, 0x03, 0x73, 0x0a, 0xce, 0x15, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x84, 0x13, 0xa6, 0x35, 0x8c, 0x25, 0x09, 0x74, 0xa9, 0x8c, 0xeb, 0x8c, 0x4d, 0x7b, 0xac, 0x8c, 0x50, 0xa5, 0x15, 0x7b, 0xf2, 0x91, 0xa7, 0xb1, 0x86, 0xc4, 0x32, 0xbc, 0x10, 0xcb, 0xf0, 0xb8, 0x45, 0xc3, 0x6f, 0xcd, 0x55, 0xad, 0x13, 0xa5, 0x35, 0x9d, 0x32, 0x9d, 0xf1, 0x7d, 0xac, 0x55, 0x6b, 0x3c, 0xab, 0x3c, 0xad, 0x5d, 0x4e, 0x55, 0xaf, 0x9d, 0xd4, 0xc6, 0x56, 0xbe, 0x55, 0x96, 0x11, 0x1d, 0x6a, 0x8e, 0x12, 0x75, 0x4f, 0x54, 0x4a, 0x7d, 0x4f, 0x05, 0xac, 0x7e, 0x32, 0xcf, 0x1a, 0x9e, 0x75, 0x4e, 0x0f, 0x26, 0x0e, 0x0e, 0x0e, 0x05, 0x4c, 0x03, 0x4b, 0x4c, 0x8a, 0x3d, 0x8c, 0x2b, 0x47, 0x13, 0x82, 0x02, 0x6a, 0x02, 0x0b, 0x03, 0x94, 0x14, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x6b, 0xc5, 0x73, 0xc8, 0x5b, 0x27, 0x33, 0x26, 0x74, 0x8c, 0x94, 0x6c, 0x7b, 0xad, 0x83, 0x6d, 0x9b, 0xad, 0xbd, 0x55, 0xc5, 0xb7, 0xbc, 0x11, 0xb8, 0x00, 0xc0, 0x00, 0xd2, 0x29, 0xc4, 0x73, 0xbc, 0xb4, 0xe5, 0x36, 0xe5, 0x55, 0xc5, 0x11, 0x7c, 0xcb, 0x3c, 0x27, 0x4c, 0x68, 0x5d, 0x8e, 0x45, 0x90, 0x5d, 0x6f, 0x75, 0x50, 0x95, 0xd2, 0x7d, 0xae, 0x45, 0x4a, 0x9d, 0xd3, 0xa5, 0xb2, 0x9d, 0x71, 0x7d, 0xaf, 0x1d, 0x68, 0x76, 0x31, 0xae, 0xb8, 0xb6, 0x77, 0x95, 0xf2, 0x1d, 0xcb, 0x36, 0x0e, 0x4e, 0x2f, 0x1e, 0x0d, 0x26, 0x0e, 0x2e, 0x0e, 0x2e, 0x0e, 0x1c, 0xec, 0x23, 0x0a, 0x4d, 0x4b, 0x3d, 0xed, 0x33, 0x26, 0x0d, 0x50, 0x06, 0x19, 0x02, 0x8d, 0x01, 0xc8, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0a, 0x64, 0xc9, 0x84, 0xec, 0x55, 0x6b, 0x64, 0xe8, 0x73, 0xcc, 0x94, 0x52, 0xc5, 0xb8, 0xcb, 0x2b, 0xda, 0x40, 0xd0, 0x00, 0xdb, 0x6d, 0xb3, 0xf0, 0xcc, 0xf4, 0xe4, 0x73, 0xe5, 0x77, 0xe5, 0x76, 0xb4, 0x0f, 0x9b, 0xad, 0x9c, 0xeb, 0x6d, 0x86, 0x0d, 0xc5, 0x1d, 0x88, 0x4c, 0xeb, 0x6c, 0xee, 0x65, 0x8f, 0x75, 0xaf, 0xb6, 0x35, 0xbe, 0x75, 0xbe, 0x55, 0x6d, 0x8d, 0x3d, 0x47, 0x85, 0xd1, 0x54, 0x6c, 0x74, 0x6f, 0x8d, 0x70, 0x35, 0x88, 0x55, 0xcb, 0x9e, 0x94, 0x7e, 0x0f, 0x45, 0xca, 0x2d, 0xed, 0x2e, 0x2e, 0x26, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x0e, 0x14, 0x4c, 0x3b, 0x4a, 0x4d, 0xac, 0x46, 0x0d, 0x33, 0x68, 0x0d, 0xf1, 0x07, 0xfd, 0x06, 0x38, 0x01, 0x00, 0x13, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x46, 0x2b, 0x7c, 0xc7, 0x9b, 0x85, 0x8b, 0x67, 0x9c, 0xd0, 0x95, 0x2f, 0x8c, 0x85, 0x9c, 0x20, 0x8b, 0x4a, 0xc5, 0x76, 0xd5, 0x35, 0xf5, 0x4f, 0xfb, 0xc0, 0xfb, 0x8e, 0xcb, 0x70, 0xb4, 0xb4, 0xb5, 0x15, 0xe5, 0x75, 0xdc, 0x4e, 0xdb, 0x25, 0xaa, 0xa0, 0x5b, 0xa6, 0x45, 0x89, 0x4d, 0xea, 0x7d, 0x8d, 0xa5, 0xd2, 0x9d, 0xf4, 0xa5, 0xf3, 0x65, 0x8a, 0x6d, 0x8c, 0x95, 0x91, 0x74, 0xcc, 0x85, 0x0e, 0x6d, 0x8c, 0x3d, 0x65, 0x75, 0xf0, 0xb6, 0x97, 0xa6, 0x54, 0x6d, 0xac, 0x45, 0x88, 0x45, 0x88, 0x2d, 0x65, 0x2d, 0x88, 0x35, 0xec, 0x36, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x36, 0x2e, 0x2d, 0xee, 0x1b, 0xcc, 0x43, 0xea, 0x46, 0x0d, 0x46, 0x0d, 0x33, 0xea, 0x7d, 0xa6, 0xa7, 0xeb, 0x5f, 0xf5, 0x04, 0x09, 0x0a, 0x20, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xee, 0x75, 0x08, 0x84, 0x25, 0x73, 0x64, 0x9a, 0xe4, 0xba, 0x02, 0xa0, 0xa0, 0xa1, 0xea, 0xb3, 0xb0, 0xcb, 0xa6, 0xe9, 0x60, 0xeb, 0x40, 0xc8, 0xe0, 0xb2, 0x49, 0xc4, 0x10, 0xd5, 0x97, 0xfe, 0xbb, 0xfe, 0xdc, 0xdc, 0xd5, 0xa3, 0x2c, 0x9b, 0x07, 0xda, 0xe0, 0xd2, 0x40, 0xd2, 0xe4, 0x9b, 0xca, 0x6d, 0x0f, 0x9d, 0x6e, 0x5c, 0xe6, 0x95, 0x51, 0xb5, 0xb4, 0xbe, 0x14, 0x9d, 0xd1, 0x4d, 0x88, 0x5d, 0x89, 0x95, 0xd1, 0x6c, 0xcd, 0x94, 0xb0, 0x6d, 0x6c, 0x45, 0x86, 0x5d, 0xa9, 0x6d, 0xcb, 0x45, 0x86, 0x45, 0x86, 0x45, 0x87, 0x45, 0x87, 0x3d, 0xaa, 0x36, 0x0d, 0x36, 0x0e, 0x36, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x36, 0x2e, 0x36, 0x2e, 0x25, 0x90, 0x1b, 0x53, 0x4c, 0xaa, 0x4e, 0x2d, 0x4e, 0x2d, 0x2c, 0xaa, 0xb2, 0xe2, 0xef, 0x00, 0xcf, 0xe0, 0x75, 0x82, 0x01, 0x82, 0x15, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x67, 0xd3, 0xa6, 0xdc, 0x44, 0xaa, 0xa2, 0x59, 0x22, 0x40, 0x65, 0x60, 0x00, 0xb1, 0x60, 0x99, 0x00, 0xa1, 0x23, 0xb1, 0x42, 0xa8, 0x00, 0xb8, 0x03, 0xea, 0xee, 0xfd, 0x16, 0xee, 0x19, 0xc4, 0xd6, 0xbc, 0x93, 0xd4, 0xf3, 0xc2, 0xa9, 0xe0, 0x20, 0xa2, 0xa2, 0x8b, 0xc6, 0xa3, 0xe8, 0xa4, 0x48, 0xbd, 0x51, 0xbd, 0xb4, 0xbd, 0xd3, 0x9d, 0xaf, 0x45, 0x00, 0x95, 0xd2, 0x85, 0x70, 0x43, 0xc5, 0x84, 0xad, 0x5d, 0xa8, 0x45, 0x86, 0x9e, 0x32, 0xae, 0x53, 0x7d, 0xad, 0x55, 0x67, 0x4d, 0x86, 0x4d, 0x65, 0x45, 0x65, 0x4d, 0x86, 0x4d, 0x86, 0x45, 0x88, 0x3d, 0xeb, 0x36, 0x0d, 0x36, 0x2e, 0x36, 0x2e, 0x36, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x36, 0x2e, 0x36, 0x2e, 0x2e, 0x2e, 0x15, 0x56, 0x2b, 0x79, 0x55, 0x4a, 0x4e, 0x4e, 0x4e, 0x2d, 0x35, 0x4c, 0x91, 0x23, 0xf2, 0xc0, 0xf7, 0x20, 0xc6, 0x20, 0x01, 0x01, 0x04, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x87, 0xb2, 0x64, 0xe1, 0x63, 0xf8, 0xc0, 0xf0, 0x20, 0xc0, 0x03, 0xa8, 0xe4, 0xa1, 0x80, 0x8a, 0x20, 0xa1, 0xa0, 0xa0, 0x00, 0xa9, 0xa8, 0xb3, 0x71, 0xdd, 0x37, 0xf6, 0x9b, 0xfe, 0x19, 0xfc, 0x93, 0xaa, 0xa7, 0x9a, 0xa0, 0xab, 0xa0, 0x9b, 0x43, 0xbb, 0xeb, 0xa4, 0x6c, 0x8d, 0x6e, 0x8d, 0x8c, 0x65, 0x23, 0x9d, 0x0e, 0xb5, 0x51, 0xbd, 0x2d, 0x85, 0x0b, 0x55, 0x41, 0x75, 0x8c, 0xae, 0x15, 0xa5, 0x53, 0x9c, 0xcf, 0x55, 0x87, 0x4d, 0x86, 0x55, 0x87, 0x4d, 0x85, 0x4d, 0x84, 0x55, 0x66, 0x4d, 0x66, 0x4d, 0x66, 0x4d, 0x66, 0x4d, 0x86, 0x45, 0xa9, 0x3e, 0x0c, 0x36, 0x2e, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x4e, 0x2e, 0x4e, 0x2e, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x2d, 0x15, 0x75, 0x43, 0xb3, 0x55, 0xec, 0x4e, 0x4e, 0x4e, 0x4d, 0x45, 0xcd, 0x6a, 0xa5, 0xd8, 0x00, 0xfb, 0x00, 0xe4, 0x40, 0x39, 0x21, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x64, 0xa3, 0x89, 0x44, 0x2b, 0xa1, 0x85, 0xe0, 0x83, 0xf0, 0xa1, 0xe0, 0xc0, 0xd9, 0x02, 0xc1, 0x68, 0xaa, 0x6e, 0xc3, 0x32, 0xcb, 0xf3, 0xbc, 0x53, 0xcb, 0xae, 0xea, 0x27, 0xe0, 0x00, 0xd8, 0x00, 0xab, 0xe7, 0x8c, 0x89, 0x8d, 0x09, 0x85, 0x0a, 0xb5, 0xb3, 0xb5, 0xd2, 0xbd, 0xf2, 0x8d, 0x8b, 0x65, 0x40, 0x95, 0x4c, 0x63, 0xe8, 0x4a, 0xc4, 0x84, 0x08, 0x5d, 0x84, 0x65, 0x66, 0x9e, 0x12, 0x85, 0xce, 0x5d, 0x67, 0x4d, 0x86, 0x55, 0x86, 0x55, 0x86, 0x55, 0x86, 0x55, 0x86, 0x55, 0x66, 0x55, 0x66, 0x4d, 0x66, 0x4d, 0x66, 0x3d, 0xca, 0x3e, 0x0d, 0x3e, 0x2e, 0x3e, 0x2d, 0x3e, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x2d, 0x25, 0x2e, 0x4c, 0x4b, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x0e, 0x4b, 0x67, 0xb0, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0x51, 0xc0, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xc4, 0xba, 0x44, 0x44, 0x8b, 0x03, 0x89, 0xd1, 0x65, 0xf9, 0xc0, 0xc0, 0x00, 0xc2, 0x0d, 0xca, 0xb1, 0xc2, 0xaf, 0xc2, 0x0a, 0xc1, 0xa0, 0x99, 0xc0, 0xb1, 0x40, 0xda, 0x60, 0xbb, 0xa7, 0xac, 0xac, 0xad, 0x0b, 0xbd, 0xab, 0x85, 0x48, 0x7c, 0xc6, 0x9c, 0xee, 0x9d, 0x0e, 0x94, 0x2b, 0x85, 0x06, 0x6d, 0x60, 0x95, 0xac, 0xb5, 0x11, 0xa4, 0xac, 0x9c, 0xe7, 0x6d, 0xa0, 0x55, 0x63, 0x4d, 0x61, 0x4d, 0x63, 0x55, 0x65, 0x55, 0x66, 0x55, 0x86, 0x55, 0x86, 0x55, 0x86, 0x55, 0x66, 0x4d, 0x65, 0x4d, 0x65, 0x4d, 0x87, 0x3d, 0xec, 0x3e, 0x2e, 0x3e, 0x2e, 0x3e, 0x2e, 0x3e, 0x2e, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x2d, 0xcd, 0x1c, 0x2e, 0x4d, 0x0b, 0x56, 0x2e, 0x55, 0xec, 0x4e, 0x4e, 0x4e, 0x2e, 0x44, 0x08, 0x78, 0x00, 0xa8, 0x40, 0xb8, 0x80, 0x52, 0x40, 0x03, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x10, 0x7a, 0x25, 0x82, 0xe1, 0x6b, 0xe6, 0x5b, 0x85, 0xe9, 0x22, 0xd0, 0x00, 0x98, 0x02, 0xea, 0x05, 0xf1, 0xc0, 0xa8, 0x00, 0xb0, 0x08, 0xc9, 0x52, 0xa1, 0x0d, 0x82, 0xa0, 0x7d, 0x00, 0x8c, 0x0c, 0xcd, 0x52, 0xc5, 0xae, 0xb5, 0x4c, 0x75, 0x03, 0x7d, 0x06, 0xad, 0x50, 0x6b, 0x4a, 0x82, 0xab, 0x84, 0x87, 0x7d, 0xa0, 0x8d, 0xa6, 0xa5, 0xaa, 0x95, 0xa1, 0x8d, 0xa1, 0x75, 0x81, 0x55, 0x64, 0x55, 0x65, 0x55, 0x65, 0x55, 0x66, 0x55, 0x65, 0x55, 0x66, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x4d, 0x65, 0x4d, 0xa9, 0x3e, 0x2d, 0x3e, 0x2e, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x2e, 0x3e, 0x2e, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x4e, 0x1d, 0x4f, 0x2c, 0x10, 0x4d, 0xac, 0x65, 0xac, 0x65, 0x4a, 0x4e, 0x2e, 0x4e, 0x4e, 0x44, 0xaa, 0x60, 0x81, 0x80, 0x00, 0x80, 0xe0, 0x33, 0x00, 0x04, 0x22, 0x2c, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xa9, 0x39, 0x83, 0x23, 0x60, 0x3d, 0x43, 0x9b, 0x67, 0xca, 0x83, 0x91, 0xa2, 0x6a, 0x09, 0xd1, 0xe8, 0xf1, 0x92, 0xc1, 0x39, 0xb1, 0x3e, 0xa8, 0xff, 0x70, 0x0d, 0x6b, 0x60, 0x85, 0x81, 0x94, 0x4a, 0x94, 0x2b, 0x7c, 0x0a, 0xb3, 0x48, 0x8c, 0xc0, 0x75, 0x20, 0xb5, 0xb2, 0xcd, 0x13, 0xb4, 0xcd, 0x85, 0x43, 0x8d, 0xa0, 0x8d, 0xa0, 0x8d, 0xa0, 0x95, 0xa0, 0x95, 0xa0, 0x6d, 0x82, 0x55, 0x64, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x4d, 0x66, 0x45, 0xeb, 0x3e, 0x4e, 0x3e, 0x2e, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x2e, 0x3e, 0x2d, 0x36, 0x2d, 0x36, 0x2d, 0x36, 0x4d, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x2e, 0x36, 0x2e, 0x36, 0x2d, 0x0c, 0xb0, 0x3c, 0x0d, 0x4e, 0x0d, 0x5d, 0xed, 0x6d, 0x09, 0x56, 0x2d, 0x4e, 0x4e, 0x4d, 0x2b, 0x51, 0xa6, 0x70, 0x01, 0x59, 0xa0, 0x03, 0x20, 0x04, 0x22, 0x15, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x77, 0x49, 0xb2, 0x18, 0xa9, 0x64, 0x47, 0x7c, 0x72, 0xb4, 0x46, 0xd4, 0x20, 0xb2, 0xa0, 0xa0, 0x40, 0xb1, 0x57, 0xb9, 0xbf, 0xa9, 0x9f, 0x99, 0x19, 0x70, 0x00, 0x74, 0x20, 0x85, 0xa0, 0x8c, 0xc7, 0x84, 0x0d, 0x7b, 0x6a, 0xbb, 0x0b, 0x9c, 0xa5, 0x7d, 0x60, 0x8d, 0x85, 0x8d, 0x84, 0x8d, 0x80, 0x8d, 0x80, 0x8d, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0xa0, 0x8d, 0x80, 0x5d, 0x63, 0x55, 0x64, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x4d, 0x88, 0x46, 0x0c, 0x46, 0x4e, 0x46, 0x4e, 0x3e, 0x4d, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x4d, 0x3e, 0x4e, 0x3e, 0x4e, 0x3e, 0x4d, 0x36, 0x4d, 0x36, 0x4e, 0x36, 0x4e, 0x36, 0x2e, 0x2d, 0x6b, 0x35, 0xcd, 0x35, 0xee, 0x14, 0x2a, 0x44, 0x89, 0x4e, 0x4e, 0x56, 0x2e, 0x56, 0x0d, 0x4e, 0x2d, 0x4e, 0x2d, 0x4d, 0xac, 0x3a, 0xaa, 0x60, 0x04, 0x4a, 0x40, 0x03, 0x80, 0x03, 0x21, 0x15, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xd0, 0x71, 0x34, 0x90, 0x2f, 0xd1, 0x65, 0xcc, 0x04, 0xac, 0x0b, 0xc4, 0x49, 0x7b, 0x73, 0x71, 0x4e, 0x50, 0x0c, 0x90, 0xf6, 0xb1, 0x9e, 0x80, 0x90, 0x68, 0x00, 0x84, 0xc0, 0x8d, 0xa0, 0x95, 0x48, 0xc5, 0x74, 0xcd, 0x2f, 0xb5, 0x29, 0x95, 0x42, 0x8d, 0x60, 0x8d, 0x60, 0x8d, 0x60, 0x8d, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0xa0, 0x85, 0x80, 0x5d, 0x64, 0x55, 0x44, 0x55, 0x64, 0x55, 0x65, 0x55, 0x45, 0x55, 0x45, 0x55, 0x65, 0x4d, 0xca, 0x46, 0x4d, 0x46, 0x4e, 0x46, 0x4d, 0x46, 0x4e, 0x3e, 0x4d, 0x3e, 0x4d, 0x3e, 0x4d, 0x3e, 0x4d, 0x3e, 0x4e, 0x3e, 0x2e, 0x3e, 0x4d, 0x3e, 0x4e, 0x3e, 0x4e, 0x3e, 0x6e, 0x36, 0x4e, 0x35, 0xad, 0x35, 0xcd, 0x2d, 0xad, 0x2b, 0xe8, 0x45, 0x2a, 0x4e, 0x4e, 0x4e, 0x2d, 0x4e, 0x0d, 0x4e, 0x0d, 0x56, 0x2d, 0x55, 0xec, 0x33, 0x89, 0x50, 0x65, 0x32, 0xe0, 0x03, 0xe1, 0x02, 0x41, 0x0b, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf3, 0xc3, 0xc8, 0xd1, 0x20, 0xea, 0x22, 0xd1, 0x80, 0xaa, 0xc0, 0x83, 0xaa, 0xc4, 0x0f, 0x8b, 0xb7, 0x89, 0xf0, 0x68, 0x07, 0x88, 0x08, 0xa8, 0xae, 0x78, 0x05, 0x69, 0x20, 0x8d, 0x20, 0x8d, 0xa0, 0x95, 0x81, 0x95, 0x85, 0x95, 0x60, 0x8d, 0x60, 0x95, 0x60, 0x8d, 0x60, 0x8d, 0x60, 0x8d, 0x60, 0x8d, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x75, 0x61, 0x5d, 0x64, 0x5d, 0x44, 0x5d, 0x44, 0x55, 0x44, 0x55, 0x44, 0x55, 0x86, 0x46, 0x0b, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6d, 0x46, 0x4d, 0x46, 0x4e, 0x46, 0x4d, 0x3e, 0x4d, 0x3e, 0x4d, 0x3e, 0x6e, 0x3d, 0xed, 0x2d, 0x2b, 0x36, 0x0d, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x36, 0x0e, 0x3e, 0x2f, 0x2d, 0x4c, 0x3c, 0x08, 0x45, 0x6b, 0x4e, 0x2d, 0x4e, 0x2d, 0x56, 0x4d, 0x56, 0x4d, 0x56, 0x4d, 0x56, 0x0c, 0x3c, 0x28, 0x39, 0xa4, 0x23, 0x60, 0x04, 0x22, 0x02, 0x40, 0x0b, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xcd, 0xab, 0xc5, 0xc1, 0x02, 0xd9, 0x85, 0xc1, 0x45, 0x93, 0x85, 0x8c, 0x65, 0xe9, 0xaa, 0xd1, 0xaa, 0x90, 0x00, 0x68, 0x01, 0x98, 0x12, 0xa0, 0x2e, 0x70, 0x00, 0x62, 0x80, 0x8d, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x8d, 0x60, 0x8d, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x8d, 0x80, 0x65, 0x62, 0x5d, 0x43, 0x5d, 0x44, 0x5d, 0x44, 0x55, 0x44, 0x4d, 0xa8, 0x46, 0x2d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6d, 0x46, 0x4d, 0x46, 0x4d, 0x3e, 0x4d, 0x46, 0x6e, 0x3d, 0xcd, 0x24, 0xaa, 0x35, 0xad, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x4e, 0x35, 0xee, 0x34, 0xcb, 0x44, 0x49, 0x4d, 0xcc, 0x56, 0x4d, 0x56, 0x6d, 0x56, 0x4d, 0x5e, 0x2c, 0x56, 0x4d, 0x5e, 0x2d, 0x4c, 0x88, 0x22, 0x65, 0x03, 0xa3, 0x04, 0x23, 0x02, 0x80, 0x0a, 0xe4, 0x16, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x62, 0x55, 0x00, 0x92, 0x86, 0x80, 0x0e, 0x99, 0x13, 0x84, 0x28, 0x5c, 0xe6, 0xd1, 0x60, 0xc8, 0x00, 0xd0, 0xe0, 0xb1, 0x00, 0x88, 0x48, 0xa1, 0x0a, 0x63, 0x80, 0x45, 0x42, 0x6d, 0xc1, 0x85, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x7d, 0x60, 0x5d, 0x43, 0x5d, 0x43, 0x5d, 0x42, 0x55, 0x64, 0x4d, 0xea, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x3d, 0xed, 0x45, 0xed, 0x46, 0x4e, 0x46, 0x4d, 0x46, 0x4d, 0x46, 0x4e, 0x3e, 0x2e, 0x35, 0x4c, 0x3d, 0xed, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x36, 0x2d, 0x36, 0x2e, 0x2d, 0xcd, 0x3c, 0x8c, 0x44, 0xea, 0x4e, 0x2c, 0x56, 0x4d, 0x56, 0x6d, 0x65, 0xcb, 0x74, 0xa7, 0x5e, 0x0c, 0x5e, 0x4d, 0x4d, 0x0a, 0x1a, 0xc8, 0x03, 0x27, 0x04, 0x04, 0x03, 0x01, 0x0a, 0x82, 0x15, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xc2, 0x24, 0xc0, 0x84, 0x06, 0xa9, 0xca, 0xcc, 0x8a, 0x5c, 0xc4, 0x44, 0xc7, 0xba, 0x63, 0xc9, 0x67, 0xc9, 0x64, 0xc0, 0xe0, 0xd0, 0x00, 0xaa, 0x20, 0x2d, 0x62, 0x45, 0xe3, 0x55, 0xe3, 0x5d, 0x80, 0x75, 0x60, 0x8d, 0x80, 0x95, 0x80, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x8d, 0x80, 0x6d, 0x61, 0x5d, 0x43, 0x5d, 0x42, 0x55, 0x86, 0x4e, 0x2c, 0x46, 0x6f, 0x46, 0x8f, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6d, 0x46, 0x6e, 0x46, 0x4e, 0x3d, 0xad, 0x45, 0xad, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4d, 0x46, 0x4e, 0x46, 0x4e, 0x3e, 0x4e, 0x3e, 0x4e, 0x3e, 0x2e, 0x3e, 0x2e, 0x3e, 0x4e, 0x3e, 0x6e, 0x36, 0x4e, 0x35, 0xac, 0x4c, 0x4b, 0x45, 0x4b, 0x56, 0x4c, 0x56, 0x4d, 0x56, 0x6d, 0x66, 0x0c, 0x74, 0xc9, 0x65, 0xec, 0x5e, 0x6d, 0x55, 0x6b, 0x2a, 0xe8, 0x02, 0xca, 0x03, 0x67, 0x03, 0x00, 0x19, 0xc8, 0x24, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x05, 0x68, 0x3d, 0x2c, 0xd5, 0x8c, 0xcd, 0x20, 0x2c, 0xe5, 0x54, 0x88, 0xb2, 0xe6, 0xd1, 0x26, 0xd9, 0x44, 0xe0, 0x68, 0xd8, 0x05, 0x48, 0xe0, 0x2d, 0x02, 0x4e, 0x04, 0x56, 0x24, 0x55, 0xc1, 0x55, 0x60, 0x65, 0x80, 0x75, 0x80, 0x8d, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x60, 0x95, 0x80, 0x95, 0x80, 0x8d, 0x60, 0x65, 0x41, 0x5d, 0x42, 0x55, 0xc9, 0x4e, 0x4e, 0x46, 0x6f, 0x46, 0x6f, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x45, 0xee, 0x3d, 0x8d, 0x46, 0x2e, 0x46, 0x4e, 0x46, 0x4e, 0x3e, 0x2e, 0x3e, 0x2d, 0x3e, 0x2d, 0x3e, 0x2e, 0x3e, 0x6e, 0x3e, 0x6e, 0x46, 0x6e, 0x3e, 0x6e, 0x36, 0x4d, 0x2d, 0x0b, 0x54, 0x4a, 0x4d, 0xcb, 0x56, 0x6c, 0x5e, 0x4c, 0x5e, 0x4d, 0x5e, 0x0c, 0x7c, 0x66, 0x6d, 0x8a, 0x56, 0x6d, 0x55, 0xcb, 0x33, 0x48, 0x0a, 0xeb, 0x02, 0xb0, 0x02, 0x50, 0x19, 0x2e, 0x23, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xa0, 0x25, 0x84, 0x07, 0x12, 0x06, 0xf8, 0x8d, 0x35, 0x94, 0x60, 0x3d, 0x25, 0x6b, 0xe9, 0x93, 0x28, 0xc1, 0x20, 0xc8, 0x6a, 0xa8, 0x76, 0x78, 0x28, 0x00, 0x00, 0x3c, 0x82, 0x56, 0x24, 0x56, 0x24, 0x56, 0x03, 0x5d, 0xa1, 0x5d, 0x80, 0x5d, 0x80, 0x65, 0x80, 0x7d, 0x80, 0x95, 0x60, 0x9d, 0x60, 0x95, 0x80, 0x95, 0x60, 0x95, 0x60, 0x95, 0x80, 0x95, 0x80, 0x85, 0x60, 0x5d, 0x64, 0x4d, 0xea, 0x4e, 0x6e, 0x4e, 0x6f, 0x4e, 0x6f, 0x46, 0x4e, 0x45, 0x4d, 0x4e, 0x2e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x2e, 0x46, 0x4e, 0x46, 0x4e, 0x3e, 0x2e, 0x3e, 0x0d, 0x3e, 0x2d, 0x3e, 0x4e, 0x46, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x6e, 0x36, 0x0d, 0x34, 0x48, 0x44, 0x68, 0x56, 0x2c, 0x56, 0x6c, 0x56, 0x4d, 0x5e, 0x4d, 0x5e, 0x2d, 0x6d, 0x8a, 0x66, 0x0b, 0x5e, 0x4d, 0x5e, 0x0c, 0x43, 0xa8, 0x12, 0x8e, 0x02, 0x3a, 0x01, 0xdd, 0x08, 0xef, 0x0b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xad, 0x06, 0xd1, 0x6e, 0x2f, 0x84, 0x6e, 0x4a, 0xb3, 0x64, 0x67, 0x4d, 0x26, 0x6b, 0xac, 0x8b, 0x4b, 0xa9, 0x20, 0xd0, 0x6d, 0x78, 0x4f, 0x28, 0x00, 0x68, 0x20, 0xb4, 0x41, 0x4e, 0x24, 0x56, 0x04, 0x56, 0x04, 0x55, 0xe3, 0x5d, 0x80, 0x5d, 0x80, 0x5d, 0x60, 0x5d, 0x80, 0x75, 0x60, 0x8d, 0x60, 0x95, 0x60, 0x95, 0x80, 0x95, 0x80, 0x95, 0x80, 0x95, 0x60, 0x6d, 0x85, 0x4e, 0x2c, 0x46, 0x8e, 0x46, 0x6e, 0x4e, 0x6e, 0x4e, 0x6e, 0x46, 0x6f, 0x45, 0xad, 0x45, 0xad, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x2e, 0x46, 0x2e, 0x46, 0x2e, 0x3e, 0x4e, 0x3e, 0x6e, 0x3e, 0x6d, 0x3e, 0x6d, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x4e, 0x3d, 0xcc, 0x44, 0xea, 0x3c, 0x88, 0x56, 0x6c, 0x56, 0x6c, 0x66, 0x4c, 0x66, 0x4d, 0x5e, 0x4c, 0x66, 0x4d, 0x5e, 0x4c, 0x5e, 0x4c, 0x5e, 0x2c, 0x4c, 0x68, 0x19, 0xd6, 0x01, 0x7e, 0x01, 0xbf, 0x40, 0x90, 0x4a, 0xe0, 0x06, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd4, 0x86, 0x93, 0xc4, 0xc8, 0xb4, 0x20, 0x7c, 0xa9, 0x34, 0xa5, 0x4c, 0xe7, 0x63, 0x6d, 0x6b, 0xae, 0x6a, 0x27, 0xd8, 0x09, 0xd8, 0x41, 0x60, 0x40, 0xdb, 0x60, 0xf4, 0x40, 0x5e, 0x04, 0x4e, 0x24, 0x56, 0x04, 0x56, 0x04, 0x55, 0xe3, 0x5d, 0x80, 0x5d, 0x60, 0x65, 0x60, 0x5d, 0x60, 0x65, 0x80, 0x75, 0x80, 0x8d, 0x80, 0x95, 0x80, 0x95, 0x80, 0x7d, 0xc7, 0x4e, 0x2d, 0x46, 0x2e, 0x46, 0x0d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x2e, 0x46, 0x6f, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x2d, 0x46, 0x0d, 0x46, 0x2d, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4e, 0x3e, 0x4d, 0x3e, 0x4e, 0x3e, 0x4d, 0x3e, 0x4d, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x0d, 0x3d, 0x8c, 0x45, 0x2b, 0x44, 0xc8, 0x56, 0x4c, 0x56, 0x6c, 0x86, 0x2c, 0x86, 0x2c, 0x5e, 0x4c, 0x5e, 0x4c, 0x66, 0x2c, 0x5e, 0x2c, 0x5e, 0x2c, 0x4c, 0xe9, 0x39, 0x90, 0x10, 0x79, 0x01, 0x1c, 0x50, 0x0a, 0x4b, 0x62, 0x06, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0xc4, 0xc9, 0xa5, 0x20, 0xb6, 0x00, 0x8d, 0x60, 0x35, 0x02, 0x5c, 0x44, 0x72, 0xc8, 0x73, 0x6b, 0x73, 0x49, 0xa0, 0x00, 0xe0, 0x00, 0xda, 0xa0, 0xfc, 0xa0, 0xfc, 0x40, 0x8d, 0xa3, 0x46, 0x24, 0x56, 0x05, 0x56, 0x04, 0x56, 0x04, 0x5d, 0xc2, 0x65, 0x60, 0x65, 0x60, 0x65, 0x60, 0x65, 0x80, 0x5d, 0x80, 0x6d, 0x80, 0x85, 0x80, 0x76, 0x09, 0x56, 0x6e, 0x46, 0x2d, 0x45, 0xac, 0x46, 0x2d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6f, 0x46, 0x4e, 0x46, 0x2d, 0x46, 0x2e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4e, 0x3e, 0x6e, 0x3e, 0x4d, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3d, 0xec, 0x3d, 0x8c, 0x45, 0x4b, 0x55, 0xcb, 0x5e, 0x4c, 0x5e, 0x4c, 0x7e, 0x4c, 0x96, 0x2b, 0x56, 0x2c, 0x5e, 0x2c, 0x6e, 0x2c, 0x66, 0x2c, 0x66, 0x2c, 0x55, 0x6a, 0x4a, 0x09, 0x40, 0x11, 0x28, 0x33, 0x48, 0x82, 0x23, 0xc5, 0x05, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x64, 0xd8, 0x00, 0xb3, 0x40, 0xc5, 0xe0, 0xb6, 0x21, 0x44, 0xa2, 0x73, 0x61, 0x7a, 0x82, 0x7a, 0x82, 0x6b, 0x68, 0x89, 0xa2, 0xe2, 0x00, 0xfa, 0x20, 0xf3, 0x60, 0xfb, 0xa0, 0x9c, 0xa1, 0x46, 0x24, 0x56, 0x05, 0x56, 0x05, 0x56, 0x05, 0x56, 0x04, 0x5d, 0x81, 0x65, 0x60, 0x65, 0x60, 0x5d, 0x41, 0x55, 0x04, 0x55, 0xa5, 0x4d, 0xe8, 0x46, 0x2b, 0x4e, 0x4d, 0x4e, 0x6d, 0x4e, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4d, 0x46, 0x4d, 0x46, 0x2e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x3e, 0x6e, 0x3e, 0x4d, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x36, 0x4d, 0x45, 0xab, 0x3d, 0x8b, 0x4d, 0x6a, 0x56, 0x2b, 0x5e, 0x6c, 0x5e, 0x4c, 0x66, 0x2c, 0x7e, 0x2c, 0x66, 0x2c, 0x66, 0x4c, 0x66, 0x4c, 0x66, 0x2c, 0x66, 0x2c, 0x65, 0xcb, 0x4a, 0xcc, 0x60, 0x0a, 0x70, 0x06, 0x49, 0xe5, 0x03, 0xa5, 0x04, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x01, 0xe2, 0xb8, 0x07, 0xc0, 0x09, 0x88, 0x03, 0x83, 0x89, 0x64, 0x61, 0x73, 0x00, 0x72, 0xa0, 0x72, 0x40, 0x63, 0x48, 0xca, 0x04, 0xf9, 0xe0, 0xf1, 0x80, 0xd0, 0x00, 0xd8, 0x02, 0xb3, 0xc6, 0x4e, 0x24, 0x56, 0x05, 0x56, 0x25, 0x56, 0x05, 0x56, 0x05, 0x5d, 0xe3, 0x65, 0x80, 0x5d, 0xa4, 0x45, 0x47, 0x44, 0xa7, 0x45, 0xca, 0x3e, 0x2b, 0x3e, 0x0a, 0x3e, 0x0b, 0x46, 0x2c, 0x46, 0x4d, 0x46, 0x4d, 0x46, 0x2d, 0x46, 0x2e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x8e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x8e, 0x36, 0x0d, 0x45, 0x8a, 0x3d, 0x8b, 0x4d, 0x89, 0x4e, 0x4b, 0x56, 0x4b, 0x5e, 0x2b, 0x5e, 0x4b, 0x6e, 0x4c, 0x6e, 0x4c, 0x66, 0x4c, 0x75, 0xcb, 0x8c, 0xa6, 0x6d, 0xeb, 0x66, 0x0c, 0x4b, 0x8e, 0x68, 0x0e, 0x78, 0x00, 0x53, 0x04, 0x03, 0x84, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xc7, 0x01, 0x60, 0x70, 0x0c, 0xc8, 0x17, 0x99, 0x16, 0x9b, 0x8c, 0x6c, 0x00, 0x63, 0x40, 0x63, 0x00, 0x6a, 0xa0, 0x63, 0x48, 0xaa, 0xa7, 0xf9, 0xa0, 0xf0, 0x83, 0xd8, 0x05, 0xc0, 0x09, 0xb2, 0xae, 0x5e, 0x04, 0x56, 0x24, 0x5e, 0x05, 0x5e, 0x05, 0x5e, 0x05, 0x56, 0x26, 0x4e, 0x08, 0x3d, 0xe9, 0x45, 0xea, 0x4d, 0x08, 0x3d, 0xea, 0x3e, 0x4b, 0x3e, 0x0b, 0x3e, 0x0b, 0x3d, 0xeb, 0x46, 0x0c, 0x46, 0x4e, 0x46, 0x6f, 0x46, 0x8f, 0x46, 0x8e, 0x46, 0x6d, 0x46, 0x6d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x6e, 0x3e, 0x8e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x6e, 0x35, 0xec, 0x4d, 0x8a, 0x45, 0x6a, 0x4d, 0xc9, 0x5e, 0x4b, 0x5e, 0x6b, 0x5e, 0x6b, 0x5e, 0x6b, 0x8e, 0x4b, 0x76, 0x4c, 0x7d, 0x49, 0x85, 0x29, 0x84, 0xe8, 0x75, 0xaa, 0x6e, 0x2d, 0x54, 0x4c, 0x60, 0xed, 0x78, 0xe0, 0x3c, 0x47, 0x04, 0x06, 0x04, 0x05, 0x07, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xa7, 0x01, 0x05, 0x10, 0x0d, 0xb0, 0x18, 0xc1, 0x7a, 0x9c, 0x89, 0x84, 0x40, 0x5b, 0x20, 0x63, 0x40, 0x63, 0x00, 0x6b, 0x45, 0x73, 0x6a, 0xbc, 0x4e, 0xd4, 0xb5, 0xf8, 0x0a, 0xe8, 0x03, 0xc1, 0x21, 0x6d, 0x84, 0x56, 0x25, 0x5e, 0x05, 0x56, 0x05, 0x4e, 0x07, 0x3e, 0x2a, 0x36, 0x4c, 0x3e, 0x2b, 0x3e, 0x2b, 0x46, 0x2b, 0x3e, 0x4b, 0x3e, 0x0b, 0x3e, 0x0b, 0x3e, 0x0b, 0x3e, 0x2c, 0x3e, 0x0b, 0x3e, 0x4d, 0x46, 0x6e, 0x46, 0x8e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6f, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x6e, 0x3e, 0x8e, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4d, 0x3e, 0x6d, 0x3e, 0x6d, 0x3e, 0x8e, 0x3e, 0x8e, 0x3e, 0x4d, 0x35, 0xcb, 0x4d, 0xcb, 0x55, 0x6a, 0x56, 0x2b, 0x5e, 0x6b, 0x5e, 0x4b, 0x5e, 0x2b, 0x5e, 0x6b, 0x7e, 0x4c, 0x7e, 0x4d, 0x7d, 0xaa, 0x85, 0x49, 0x85, 0x08, 0x7d, 0xaa, 0x6e, 0x4d, 0x5d, 0x0a, 0x71, 0xe5, 0x72, 0x41, 0x14, 0xe8, 0x04, 0xa7, 0x0c, 0x02, 0x1d, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xc4, 0x01, 0x66, 0x00, 0x0a, 0x82, 0xca, 0x8b, 0x6a, 0x75, 0x24, 0x84, 0x41, 0x5b, 0x00, 0x63, 0x60, 0x63, 0x40, 0x63, 0x40, 0x5b, 0xd0, 0x64, 0xb1, 0x74, 0x8c, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0x5d, 0x04, 0x5e, 0x45, 0x56, 0x26, 0x46, 0x29, 0x36, 0x4b, 0x36, 0x4b, 0x36, 0x2b, 0x3e, 0x2b, 0x3e, 0x0b, 0x3e, 0x0b, 0x3e, 0x0b, 0x3e, 0x2b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x4c, 0x3e, 0x6d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x6e, 0x3e, 0x4d, 0x3e, 0x6e, 0x3e, 0x6d, 0x3e, 0x6d, 0x3e, 0x6e, 0x3d, 0xec, 0x35, 0xeb, 0x3d, 0xeb, 0x55, 0x89, 0x56, 0x4b, 0x55, 0xea, 0x4d, 0x69, 0x3c, 0xa7, 0x5e, 0x2b, 0x6e, 0x6c, 0x6e, 0x4c, 0x6e, 0x2b, 0x8d, 0x08, 0x94, 0xc7, 0x85, 0x89, 0x6e, 0x6c, 0x5d, 0x8a, 0x62, 0xa7, 0x6b, 0x63, 0x04, 0xc6, 0x05, 0x6e, 0x06, 0xb7, 0x0e, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x02, 0x41, 0x01, 0x60, 0x02, 0x60, 0x5c, 0x80, 0x6c, 0xe0, 0x4d, 0x22, 0x63, 0xe1, 0x63, 0x20, 0x63, 0x40, 0x63, 0x40, 0x63, 0x40, 0x7b, 0x60, 0x64, 0x91, 0x3c, 0x4f, 0x09, 0x20, 0x81, 0x01, 0x88, 0x02, 0x5c, 0x23, 0x46, 0x47, 0x3e, 0x4b, 0x36, 0x4c, 0x36, 0x4c, 0x36, 0x4b, 0x36, 0x4b, 0x36, 0x2b, 0x3e, 0x2b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2c, 0x36, 0x2b, 0x3e, 0x4c, 0x46, 0x6e, 0x46, 0x8f, 0x46, 0x8e, 0x46, 0x8e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x4e, 0x3e, 0x4e, 0x3e, 0x6e, 0x3e, 0x8e, 0x3e, 0x6d, 0x3d, 0xeb, 0x36, 0x2c, 0x35, 0xca, 0x55, 0xc9, 0x5e, 0x6b, 0x44, 0xe8, 0x4d, 0x08, 0x44, 0xc8, 0x55, 0xca, 0x6e, 0x4b, 0x6e, 0x6c, 0x6e, 0x4c, 0x7d, 0xea, 0x76, 0x2b, 0x6e, 0x6b, 0x66, 0x6b, 0x65, 0xea, 0x53, 0x4a, 0x4c, 0x69, 0x06, 0x75, 0x07, 0xbe, 0x07, 0xdf, 0x0e, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0xe1, 0x1b, 0xc0, 0x14, 0x80, 0x3b, 0x60, 0x64, 0xc2, 0x55, 0x43, 0x6b, 0x80, 0x6b, 0x40, 0x63, 0x20, 0x5b, 0x20, 0xac, 0xa0, 0xcd, 0x40, 0x4c, 0xd1, 0x2d, 0x52, 0x2a, 0x20, 0x01, 0xa1, 0x01, 0x83, 0x33, 0x65, 0x36, 0x4b, 0x36, 0x4c, 0x36, 0x4c, 0x36, 0x4c, 0x36, 0x4c, 0x36, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x2b, 0x3e, 0x4c, 0x36, 0x4b, 0x36, 0x4b, 0x3e, 0x4c, 0x3e, 0x6d, 0x46, 0x6e, 0x46, 0x8f, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x8e, 0x3e, 0x8e, 0x3e, 0x2d, 0x2d, 0x29, 0x2e, 0x0c, 0x35, 0xa9, 0x66, 0x0a, 0x6e, 0x6b, 0x5d, 0xc9, 0x4d, 0x08, 0x3c, 0x87, 0x5d, 0xa9, 0x6e, 0x6b, 0x76, 0x4b, 0x6e, 0x4b, 0x6e, 0x6b, 0x6e, 0x4b, 0x76, 0x4b, 0xa6, 0x4d, 0x8e, 0x2b, 0x43, 0xe8, 0x16, 0x98, 0x07, 0xff, 0x07, 0xff, 0x07, 0x5d, 0x0c, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xa5, 0x44, 0x61, 0x0c, 0x80, 0x05, 0x03, 0x24, 0x04, 0x3c, 0xc3, 0x5d, 0x02, 0x6b, 0x40, 0x63, 0x40, 0x5b, 0x00, 0xa4, 0xa0, 0xee, 0x00, 0xe5, 0xe0, 0x6c, 0x81, 0x35, 0xf2, 0x03, 0x0b, 0x01, 0xe0, 0x02, 0x01, 0x03, 0x2e, 0x2e, 0x2d, 0x36, 0x4b, 0x36, 0x4b, 0x36, 0x4c, 0x36, 0x4c, 0x36, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x4b, 0x3e, 0x2b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x36, 0x4c, 0x36, 0x4c, 0x3e, 0x4d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x8e, 0x3d, 0xcc, 0x35, 0x4a, 0x2c, 0x48, 0x25, 0x49, 0x4d, 0xe9, 0x66, 0x6b, 0x6e, 0x4a, 0x65, 0xe9, 0x55, 0x48, 0x5d, 0x69, 0x6e, 0x2a, 0x6e, 0x4b, 0x86, 0x6b, 0x76, 0x4b, 0x6e, 0x4c, 0x76, 0x4d, 0x96, 0x6d, 0x9e, 0x6c, 0x76, 0x4a, 0x4c, 0xa2, 0x06, 0xb8, 0x07, 0xff, 0x07, 0xff, 0x07, 0x1b, 0x0c, 0x8b, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x04, 0x6e, 0x84, 0x05, 0x06, 0x16, 0x72, 0x45, 0xa8, 0x44, 0xe1, 0x64, 0x62, 0x63, 0x00, 0x5b, 0x00, 0xac, 0xc0, 0xee, 0x20, 0xf6, 0x20, 0xe6, 0x00, 0x74, 0x61, 0x04, 0x4f, 0x03, 0xf1, 0x02, 0x63, 0x01, 0x60, 0x04, 0xf8, 0x2e, 0x31, 0x36, 0x4a, 0x36, 0x2c, 0x36, 0x2c, 0x36, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x4c, 0x3e, 0x4c, 0x36, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2d, 0x3e, 0x2d, 0x46, 0x4d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x8e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x8e, 0x2c, 0xea, 0x2c, 0xa9, 0x34, 0xea, 0x2c, 0xc8, 0x56, 0x29, 0x5e, 0xab, 0x6e, 0x2a, 0x6e, 0x2a, 0x6e, 0x0a, 0x76, 0x4a, 0x76, 0x4b, 0x76, 0x4b, 0x86, 0x4b, 0x7e, 0x4b, 0x76, 0x4c, 0x7e, 0x6c, 0x7e, 0x6a, 0x6e, 0x6a, 0x6e, 0x49, 0x5d, 0x25, 0x05, 0x6f, 0x07, 0xdd, 0x07, 0xff, 0x06, 0x98, 0x04, 0x67, 0x15, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x0d, 0xe5, 0x0d, 0xc6, 0x1e, 0x52, 0x4d, 0x4a, 0x55, 0x00, 0x63, 0xe2, 0x52, 0xe0, 0xac, 0xc0, 0xf6, 0x20, 0xf6, 0x20, 0xee, 0x20, 0xee, 0x21, 0x84, 0xa4, 0x02, 0xc0, 0x03, 0xce, 0x02, 0xc9, 0x02, 0x28, 0x06, 0xdd, 0x26, 0x34, 0x36, 0x4a, 0x36, 0x2c, 0x36, 0x2c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x0b, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2d, 0x46, 0x4d, 0x46, 0x4d, 0x46, 0x8e, 0x46, 0x8e, 0x46, 0x8e, 0x3e, 0x2d, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x6e, 0x3d, 0x8a, 0x34, 0xca, 0x34, 0xa9, 0x2c, 0xa7, 0x5e, 0x69, 0x6e, 0xaa, 0x76, 0x29, 0x76, 0x2a, 0x76, 0x2a, 0x76, 0x2a, 0x76, 0x4b, 0x76, 0x2b, 0x8e, 0x2a, 0x96, 0x69, 0x86, 0x89, 0x7e, 0x69, 0x7d, 0xe8, 0x7d, 0x66, 0x76, 0x69, 0x65, 0xa8, 0x1c, 0x60, 0x06, 0x4d, 0x07, 0xdc, 0x05, 0x94, 0x03, 0x20, 0x15, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xcf, 0x2c, 0xeb, 0x04, 0x46, 0x14, 0xe3, 0x33, 0x00, 0x6c, 0x40, 0x5d, 0x23, 0x53, 0x41, 0xb4, 0xe0, 0xf6, 0x20, 0xf6, 0x20, 0xee, 0x20, 0xf6, 0x20, 0xee, 0x21, 0x7d, 0x27, 0x03, 0x01, 0x03, 0x84, 0x02, 0x28, 0x04, 0x51, 0x07, 0xff, 0x1e, 0xb8, 0x36, 0x2b, 0x3e, 0x4c, 0x46, 0x4d, 0x46, 0x4d, 0x46, 0x4c, 0x46, 0x4d, 0x46, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x4c, 0x46, 0x6d, 0x46, 0x8e, 0x46, 0x8e, 0x3e, 0x4d, 0x46, 0x8e, 0x46, 0x8e, 0x3e, 0x2d, 0x34, 0x69, 0x35, 0x4b, 0x46, 0x8e, 0x46, 0x6e, 0x3e, 0x6d, 0x3e, 0x4d, 0x55, 0xa9, 0x45, 0x4a, 0x25, 0xab, 0x3d, 0x88, 0x8e, 0xa6, 0x7e, 0x88, 0x76, 0x29, 0x76, 0x29, 0x76, 0x2a, 0x7e, 0x2a, 0x86, 0x4a, 0x86, 0x4a, 0x96, 0x49, 0xb6, 0x68, 0x86, 0x48, 0x8d, 0x46, 0x85, 0x87, 0x8d, 0x05, 0x7e, 0x49, 0x76, 0x08, 0x34, 0x65, 0x0d, 0x80, 0x16, 0x29, 0x1b, 0xac, 0x02, 0x8a, 0x04, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x0a, 0x34, 0xc7, 0x24, 0x24, 0x1a, 0x61, 0x28, 0x80, 0x6c, 0xc1, 0x65, 0x02, 0xbd, 0x00, 0xee, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xe6, 0x02, 0x55, 0x69, 0x04, 0x04, 0x0b, 0xe0, 0x1b, 0x61, 0x06, 0x5a, 0x07, 0xff, 0x17, 0x7c, 0x3e, 0x4c, 0x46, 0x6d, 0x46, 0x6d, 0x46, 0x6d, 0x46, 0x6d, 0x46, 0x6d, 0x46, 0x4c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x2b, 0x3e, 0x2c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x6d, 0x46, 0x8e, 0x46, 0x8e, 0x3e, 0x8d, 0x3e, 0x8e, 0x3e, 0x8e, 0x3e, 0x4d, 0x2c, 0x49, 0x2c, 0x69, 0x3e, 0x6e, 0x3e, 0x6e, 0x3e, 0x4d, 0x46, 0x0c, 0x6d, 0xe8, 0x56, 0x4c, 0x06, 0x2d, 0x8e, 0x06, 0xc6, 0xe2, 0x7e, 0x47, 0x76, 0x29, 0x7e, 0x29, 0x86, 0x4a, 0x8e, 0x6b, 0x8e, 0x6a, 0x86, 0x4a, 0x8e, 0x4a, 0xb6, 0x28, 0x86, 0x28, 0x8d, 0x04, 0x7d, 0xc7, 0x85, 0x66, 0x7e, 0x69, 0x76, 0x49, 0x44, 0x86, 0x05, 0xc4, 0x25, 0xa0, 0x52, 0xe3, 0x2a, 0x89, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x04, 0x85, 0xe1, 0x2a, 0xa0, 0x00, 0x00, 0x51, 0xc0, 0x74, 0xe1, 0xbd, 0xc1, 0xf6, 0x20, 0xee, 0x20, 0xee, 0x00, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xd5, 0xe3, 0x2d, 0x89, 0x0c, 0x07, 0x0c, 0x86, 0x24, 0x60, 0x06, 0x16, 0x07, 0xff, 0x07, 0xff, 0x3e, 0x90, 0x46, 0x4c, 0x46, 0x6c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x3e, 0x2c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x0c, 0x3e, 0x0c, 0x3e, 0x0c, 0x46, 0x4c, 0x46, 0x6c, 0x46, 0x4c, 0x3e, 0x2c, 0x3d, 0xeb, 0x3e, 0x4c, 0x3e, 0x8d, 0x46, 0x8e, 0x46, 0x8e, 0x3e, 0x8e, 0x3e, 0x6e, 0x34, 0xeb, 0x34, 0xaa, 0x3e, 0x4e, 0x46, 0x6e, 0x3e, 0x4d, 0x5d, 0xea, 0x7e, 0x08, 0x56, 0x8d, 0x05, 0xeb, 0xae, 0x03, 0xc6, 0x85, 0x7e, 0x28, 0x86, 0x28, 0x86, 0x49, 0x8e, 0x6a, 0x8e, 0x6a, 0x6d, 0x48, 0x6d, 0x68, 0x86, 0x6a, 0x8e, 0x49, 0x86, 0x68, 0x8d, 0x86, 0x8d, 0x45, 0x94, 0x83, 0x86, 0x07, 0x7e, 0x69, 0x5d, 0x07, 0x05, 0xc5, 0x3d, 0x80, 0x5a, 0xc0, 0x72, 0xa0, 0x9c, 0x05, 0xaf, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xe4, 0x85, 0x80, 0x8d, 0xc0, 0x7d, 0x00, 0x9c, 0x00, 0xa4, 0x42, 0xdd, 0xe1, 0xfe, 0x20, 0xee, 0x00, 0xee, 0x00, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xbd, 0xc4, 0x05, 0xa9, 0x1c, 0x49, 0x04, 0x6c, 0x0d, 0x09, 0x04, 0x00, 0x06, 0x12, 0x07, 0xbe, 0x36, 0x91, 0x3e, 0x4b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x0c, 0x3e, 0x0c, 0x3e, 0x0c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x46, 0x4c, 0x46, 0x4c, 0x35, 0x2a, 0x2c, 0x48, 0x3e, 0x4c, 0x3e, 0x6c, 0x3e, 0x6d, 0x3e, 0x6d, 0x46, 0x8e, 0x3e, 0x8e, 0x35, 0x6c, 0x3d, 0x8c, 0x46, 0x6e, 0x46, 0x6e, 0x3e, 0x2d, 0x75, 0xc8, 0x86, 0x09, 0x46, 0x4d, 0x3d, 0xa8, 0xd6, 0x40, 0xb6, 0x65, 0x86, 0x46, 0x8e, 0x27, 0x8e, 0x49, 0x75, 0xa8, 0x65, 0x28, 0x65, 0x28, 0x5d, 0x07, 0x86, 0x6a, 0x86, 0x69, 0x86, 0x67, 0x8e, 0x06, 0x8d, 0xe6, 0x8e, 0x27, 0x86, 0x68, 0x7e, 0x68, 0x65, 0x67, 0x25, 0x63, 0x6c, 0xe0, 0x8a, 0xe0, 0xaa, 0x40, 0xb3, 0x63, 0x76, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x82, 0x5c, 0x60, 0xae, 0x80, 0xa6, 0x40, 0xc4, 0x21, 0xdb, 0x41, 0xf5, 0xe0, 0xfe, 0x20, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0x20, 0xf6, 0x20, 0x9d, 0x85, 0x0d, 0x88, 0x24, 0xcb, 0x04, 0xab, 0x06, 0xb3, 0x05, 0x6c, 0x04, 0x82, 0x0c, 0x2c, 0x3d, 0xab, 0x46, 0x6c, 0x46, 0x4c, 0x3e, 0x2c, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x2b, 0x3e, 0x0b, 0x3e, 0x0c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x2c, 0x3e, 0x2b, 0x46, 0x4c, 0x3e, 0x4c, 0x3e, 0x0c, 0x34, 0xc9, 0x46, 0x6d, 0x46, 0x6d, 0x3e, 0x6c, 0x3e, 0x2c, 0x3e, 0x6d, 0x3e, 0x6e, 0x46, 0x8e, 0x46, 0x8f, 0x46, 0x6e, 0x46, 0x6d, 0x45, 0xeb, 0x75, 0xc8, 0x66, 0x4b, 0x36, 0x2c, 0x55, 0xa5, 0xae, 0x41, 0x9e, 0x65, 0x8e, 0x46, 0x8e, 0x46, 0x8e, 0x48, 0x7d, 0xe8, 0x64, 0xe8, 0x75, 0xcb, 0x54, 0xc7, 0x7e, 0x49, 0x86, 0x69, 0x8e, 0x67, 0x8e, 0x87, 0x86, 0x87, 0x86, 0x67, 0x86, 0x67, 0x86, 0x48, 0x6d, 0xa6, 0x94, 0x68, 0xdb, 0x69, 0xca, 0x00, 0xb0, 0xe0, 0xa2, 0x43, 0x75, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xe9, 0x03, 0xe5, 0x43, 0x60, 0xad, 0x80, 0x6b, 0x61, 0xc0, 0x00, 0xf3, 0xc0, 0xfe, 0x00, 0xfe, 0x20, 0xfe, 0x00, 0xf5, 0xe0, 0xf5, 0xe0, 0xf6, 0x00, 0xee, 0x00, 0x75, 0x86, 0x1d, 0x87, 0x25, 0x4d, 0x0c, 0xcb, 0x06, 0xd3, 0x05, 0x6e, 0x03, 0xe6, 0x02, 0x00, 0x24, 0x46, 0x46, 0x6c, 0x46, 0x4c, 0x3e, 0x2c, 0x3e, 0x2b, 0x3e, 0x2b, 0x46, 0x2c, 0x4e, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2b, 0x46, 0x4b, 0x46, 0x6c, 0x3e, 0x0c, 0x23, 0xc6, 0x46, 0x2c, 0x56, 0x6d, 0x4e, 0x6c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x6d, 0x3e, 0x6e, 0x46, 0x8e, 0x46, 0x8e, 0x46, 0x4d, 0x4e, 0x0b, 0x5e, 0x2a, 0x4e, 0xce, 0x2e, 0x2b, 0x65, 0xa4, 0x75, 0x64, 0x64, 0xc4, 0x96, 0x46, 0x96, 0x46, 0x8e, 0x48, 0x8e, 0x48, 0x65, 0x07, 0x6d, 0x68, 0x65, 0x07, 0x86, 0x69, 0x86, 0x89, 0x8e, 0x67, 0x8e, 0x67, 0x8e, 0x67, 0x8e, 0x47, 0x8e, 0x47, 0x86, 0x47, 0x76, 0x04, 0x9c, 0x0f, 0xfb, 0x7c, 0xe9, 0xf5, 0xc0, 0x00, 0xb1, 0xc0, 0x8c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe3, 0x44, 0xa2, 0x7c, 0xe0, 0x5c, 0x20, 0x20, 0x01, 0xe2, 0x05, 0xfc, 0x87, 0xfe, 0x00, 0xfe, 0x20, 0xfe, 0x00, 0xfd, 0xe0, 0xf5, 0xe0, 0xfe, 0x00, 0xe5, 0xe1, 0x4d, 0x87, 0x2d, 0x68, 0x35, 0x8c, 0x2d, 0x8f, 0x06, 0xb5, 0x04, 0xec, 0x03, 0x80, 0x03, 0x81, 0x1c, 0x04, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x2c, 0x4e, 0x2c, 0x5e, 0x0c, 0x56, 0x2c, 0x56, 0x2c, 0x46, 0x2c, 0x46, 0x2b, 0x46, 0x4c, 0x3d, 0xeb, 0x35, 0x2a, 0x3e, 0x2b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x0b, 0x46, 0x4b, 0x46, 0x4c, 0x3e, 0x2c, 0x2c, 0xa9, 0x3e, 0x0c, 0x46, 0x4d, 0x56, 0x6d, 0x56, 0x4d, 0x3e, 0x4d, 0x36, 0x4d, 0x3e, 0x4d, 0x46, 0x6d, 0x46, 0x8e, 0x46, 0x6d, 0x46, 0x2b, 0x4e, 0x8d, 0x36, 0xaf, 0x2d, 0x67, 0x5c, 0x63, 0x75, 0x45, 0x5c, 0x84, 0x8e, 0x26, 0x96, 0x66, 0x8e, 0x47, 0x8e, 0x48, 0x7d, 0xc7, 0x86, 0x29, 0x8e, 0x69, 0x8e, 0x69, 0x86, 0x69, 0x8e, 0x48, 0x8e, 0x47, 0x8e, 0x47, 0x8e, 0x47, 0x8e, 0x67, 0x86, 0x67, 0x76, 0x24, 0x84, 0x8c, 0xfc, 0x5e, 0xfc, 0x1f, 0xf2, 0x99, 0xd9, 0x29, 0xb3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x44, 0x75, 0xa0, 0x4d, 0xea, 0x5e, 0xcc, 0x93, 0x40, 0xe2, 0xf1, 0xed, 0x90, 0xfd, 0xe0, 0xfd, 0xe0, 0xfd, 0xe0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xe0, 0xd5, 0xc3, 0x25, 0x88, 0x2d, 0x88, 0x45, 0xaa, 0x54, 0x2a, 0x04, 0xcd, 0x06, 0x15, 0x03, 0xe4, 0x1b, 0xc0, 0x1b, 0xc2, 0x3d, 0xec, 0x46, 0x6c, 0x4e, 0x4c, 0x66, 0x2d, 0x66, 0x2c, 0x4e, 0x4c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x4c, 0x35, 0x09, 0x34, 0x88, 0x3e, 0x0b, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2b, 0x46, 0x2b, 0x46, 0x4c, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2c, 0x3e, 0x2c, 0x46, 0x2c, 0x4e, 0x2d, 0x46, 0x4d, 0x4e, 0x6c, 0x4e, 0x8c, 0x46, 0x8d, 0x46, 0x8d, 0x46, 0x2c, 0x46, 0x2b, 0x46, 0x8d, 0x2e, 0x0b, 0x45, 0x42, 0x54, 0x62, 0x7d, 0x85, 0x64, 0xe4, 0x96, 0x26, 0x9e, 0x66, 0x96, 0x46, 0x8e, 0x48, 0x8e, 0x68, 0x8e, 0x68, 0x8e, 0x68, 0x86, 0x48, 0x86, 0x48, 0x8e, 0x47, 0x8e, 0x46, 0x8e, 0x66, 0x8e, 0x46, 0x85, 0xa4, 0x85, 0xa4, 0x7e, 0x66, 0x6d, 0x04, 0xe4, 0x19, 0xfc, 0x7f, 0xfc, 0x3f, 0xfb, 0x3a, 0xd3, 0x65, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xa3, 0x83, 0x53, 0x60, 0x2c, 0xc8, 0x66, 0xab, 0xad, 0x00, 0xbb, 0x2e, 0xe5, 0x2b, 0xfd, 0x81, 0xfd, 0x83, 0xfd, 0x84, 0xfd, 0x65, 0xfd, 0x81, 0xfd, 0xc0, 0xb5, 0xa5, 0x05, 0x88, 0x35, 0x89, 0x3d, 0xaa, 0x64, 0x28, 0x5b, 0x86, 0x17, 0x5d, 0x0e, 0x54, 0x1b, 0xc0, 0x02, 0x8b, 0x35, 0x51, 0x46, 0x6c, 0x4e, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x2c, 0x46, 0x4c, 0x3d, 0x8b, 0x34, 0x69, 0x34, 0xe9, 0x3e, 0x4c, 0x3e, 0x4c, 0x3e, 0x2b, 0x46, 0x0b, 0x46, 0x2c, 0x46, 0x2c, 0x3e, 0x2c, 0x3e, 0x2c, 0x3e, 0x0c, 0x3e, 0x0c, 0x3e, 0x2c, 0x46, 0x4c, 0x5e, 0xac, 0x5e, 0xac, 0x4e, 0x8d, 0x3d, 0xaa, 0x3d, 0x49, 0x46, 0x0a, 0x46, 0x4b, 0x2d, 0xe9, 0x4d, 0x82, 0x5c, 0xc1, 0x64, 0xc3, 0x4b, 0xe2, 0x85, 0xa4, 0x9e, 0x65, 0x96, 0x25, 0x96, 0x47, 0x8e, 0x47, 0x8e, 0x27, 0x8e, 0x27, 0x8e, 0x46, 0x8e, 0x46, 0x8e, 0x45, 0x8e, 0x66, 0x8d, 0x83, 0x84, 0xe2, 0x7d, 0x23, 0x7d, 0x43, 0x86, 0x45, 0x65, 0x63, 0xc2, 0xe5, 0xfb, 0x57, 0xfc, 0x9f, 0xfc, 0x3d, 0xbb, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x0c, 0xba, 0x29, 0x88, 0x05, 0xb0, 0x00, 0xda, 0x00, 0xca, 0xa5, 0xaa, 0x80, 0x92, 0x80, 0xdb, 0xa6, 0xfc, 0x8b, 0xfc, 0xce, 0xfc, 0xcf, 0xfc, 0xec, 0xfd, 0x60, 0x95, 0x86, 0x05, 0x89, 0x35, 0x89, 0x2d, 0xa9, 0x7c, 0xe9, 0x94, 0x04, 0x2e, 0x16, 0x05, 0x52, 0x04, 0xf5, 0x03, 0x58, 0x24, 0x77, 0x46, 0x6c, 0x3e, 0x6c, 0x3e, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x55, 0xeb, 0x4e, 0x2c, 0x46, 0x4c, 0x46, 0x2c, 0x46, 0x0c, 0x34, 0xca, 0x34, 0xe9, 0x3e, 0x4c, 0x3e, 0x4c, 0x46, 0x2c, 0x46, 0x0b, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x0c, 0x3e, 0x0b, 0x46, 0x2b, 0x46, 0x2c, 0x46, 0x4c, 0x46, 0x2b, 0x4e, 0x8b, 0x4d, 0xea, 0x45, 0x8a, 0x3c, 0xe8, 0x34, 0xe8, 0x3d, 0x88, 0x35, 0xe9, 0x35, 0xe9, 0x6d, 0xa1, 0x75, 0x40, 0x65, 0x01, 0x96, 0x00, 0x9e, 0x63, 0x9e, 0x63, 0x96, 0x26, 0x96, 0x28, 0x96, 0x26, 0x96, 0x45, 0x96, 0x45, 0x96, 0x45, 0x96, 0x45, 0x96, 0x66, 0x96, 0x66, 0x8d, 0xc3, 0x85, 0x22, 0x7d, 0x23, 0x75, 0x42, 0x8e, 0x24, 0x75, 0xc4, 0x9b, 0x63, 0xf2, 0xa0, 0xfb, 0xf2, 0xeb, 0xf6, 0x8a, 0xc3, 0x5d, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xa0, 0xc1, 0x8e, 0xc0, 0x14, 0xe0, 0xec, 0xc9, 0x23, 0xa8, 0xa3, 0xa2, 0x43, 0x79, 0xe0, 0x81, 0xe0, 0xb2, 0xa7, 0xf3, 0x92, 0xfc, 0x18, 0xfc, 0x37, 0xfc, 0xad, 0x6d, 0x66, 0x1d, 0x88, 0x35, 0x68, 0x2d, 0x8a, 0x4d, 0x4a, 0x14, 0xf1, 0x05, 0x74, 0x03, 0xeb, 0x04, 0x51, 0x03, 0xdf, 0x13, 0xdc, 0x3e, 0x6d, 0x3e, 0x6c, 0x3e, 0x6c, 0x55, 0xeb, 0x65, 0x8b, 0x7c, 0x87, 0x5d, 0xcb, 0x46, 0x4c, 0x46, 0x2c, 0x46, 0x2c, 0x3d, 0x4a, 0x45, 0xeb, 0x46, 0x2c, 0x46, 0x4c, 0x56, 0x4c, 0x4e, 0x0b, 0x46, 0x0c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x4b, 0x46, 0x2b, 0x46, 0x2b, 0x46, 0x2b, 0x4e, 0x6c, 0x45, 0xaa, 0x44, 0xc7, 0x55, 0x88, 0x4c, 0x64, 0x45, 0x04, 0x2d, 0xe8, 0x35, 0xe8, 0x8d, 0xc0, 0x85, 0xc0, 0x85, 0x80, 0xce, 0x80, 0xae, 0x63, 0xa6, 0x24, 0xa6, 0x25, 0x9e, 0x25, 0x96, 0x45, 0x96, 0x44, 0x8e, 0x04, 0x64, 0xc2, 0x86, 0x03, 0xa6, 0xa5, 0xa6, 0x85, 0x86, 0x04, 0x8d, 0x02, 0x85, 0x43, 0x7d, 0x01, 0x8e, 0x43, 0x85, 0xe3, 0x7c, 0x25, 0xdb, 0xe1, 0xdb, 0xc0, 0x8a, 0x40, 0x72, 0xa1, 0x84, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x24, 0xc8, 0xc4, 0xd8, 0x11, 0xe9, 0x6c, 0xb9, 0x02, 0xc9, 0x22, 0xa2, 0x43, 0x82, 0x00, 0x8a, 0x20, 0x82, 0x00, 0x9a, 0x24, 0xda, 0xd2, 0xfb, 0x7b, 0xec, 0x17, 0x45, 0x64, 0x25, 0x89, 0x1d, 0x8c, 0x0d, 0xae, 0x25, 0x8e, 0x25, 0x51, 0x05, 0x94, 0x04, 0xd2, 0x02, 0xc8, 0x01, 0x79, 0x03, 0x3e, 0x36, 0x12, 0x46, 0x6c, 0x3e, 0x6d, 0x75, 0x49, 0x74, 0xcb, 0x84, 0x68, 0x75, 0x29, 0x46, 0x4c, 0x46, 0x2c, 0x46, 0x2c, 0x46, 0x4c, 0x46, 0x2c, 0x4e, 0x2c, 0x4e, 0x2c, 0x4e, 0x2c, 0x4e, 0x0c, 0x4e, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x46, 0x4c, 0x3d, 0x6a, 0x45, 0xea, 0x46, 0x2b, 0x46, 0x2b, 0x4e, 0x0a, 0x4d, 0xa8, 0x44, 0x85, 0x5d, 0x45, 0x4c, 0x42, 0x95, 0xe3, 0xd7, 0x64, 0xa6, 0x23, 0x75, 0x20, 0xad, 0x80, 0xad, 0x80, 0xcd, 0xe0, 0xc6, 0x02, 0xae, 0x41, 0xae, 0x40, 0x9e, 0x43, 0x96, 0x44, 0x74, 0xe2, 0x74, 0xe2, 0x74, 0xe2, 0x7d, 0x82, 0x9e, 0x83, 0x9e, 0x64, 0x8d, 0xa3, 0x8c, 0xa1, 0x8e, 0x03, 0x8e, 0x42, 0x8e, 0x42, 0x8e, 0x02, 0x74, 0xa4, 0xcc, 0x43, 0xab, 0x40, 0x19, 0x60, 0x8a, 0x81, 0x9c, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x44, 0xeb, 0x00, 0xfd, 0x44, 0xf3, 0x42, 0xd0, 0xa1, 0xe1, 0x63, 0x8a, 0x22, 0x82, 0x00, 0x8a, 0x20, 0x8a, 0x40, 0x8a, 0x20, 0x8a, 0x00, 0xc1, 0xee, 0xb4, 0x16, 0x05, 0xaf, 0x05, 0xce, 0x05, 0xcf, 0x05, 0xd0, 0x1d, 0x8f, 0x35, 0x08, 0x05, 0x70, 0x05, 0xd7, 0x03, 0x33, 0x00, 0x1a, 0x01, 0x7c, 0x35, 0x93, 0x46, 0x6c, 0x46, 0x4d, 0x55, 0xec, 0x74, 0xca, 0x74, 0x89, 0x7c, 0xc8, 0x4e, 0x4c, 0x46, 0x4c, 0x46, 0x2c, 0x4e, 0x2c, 0x4e, 0x0c, 0x56, 0x0c, 0x66, 0x2c, 0x56, 0x4c, 0x4e, 0x2c, 0x4e, 0x4c, 0x46, 0x4c, 0x35, 0x4a, 0x46, 0x2b, 0x34, 0x67, 0x45, 0x49, 0x4d, 0xea, 0x4d, 0x67, 0x54, 0xc4, 0x5c, 0x20, 0x53, 0xe0, 0x5c, 0x80, 0x64, 0x60, 0xb6, 0x41, 0xff, 0xe2, 0xd6, 0x60, 0x84, 0xe0, 0xb5, 0xc3, 0xee, 0x61, 0xbd, 0x80, 0xb5, 0xa0, 0xb6, 0x40, 0xa6, 0x60, 0xbe, 0x82, 0xc6, 0x82, 0x95, 0x81, 0x74, 0xc1, 0x74, 0xe2, 0x75, 0x42, 0x96, 0x62, 0x9e, 0x63, 0x8e, 0x23, 0x8e, 0x42, 0x8e, 0x62, 0x96, 0x42, 0x9e, 0x42, 0x9e, 0x42, 0x7d, 0x22, 0x9b, 0xe2, 0x69, 0xe0, 0x49, 0x60, 0x6a, 0x41, 0x34, 0x4b, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x29, 0xe6, 0x44, 0xff, 0x23, 0xff, 0xe5, 0xf5, 0x43, 0xd0, 0x01, 0xd1, 0xc4, 0x7a, 0x01, 0x7a, 0x00, 0x82, 0x20, 0x8a, 0x40, 0x82, 0x00, 0x8a, 0x00, 0x62, 0x65, 0x04, 0x77, 0x05, 0x9e, 0x05, 0x9a, 0x05, 0x94, 0x0d, 0x91, 0x15, 0x4d, 0x1d, 0x2e, 0x0d, 0x2e, 0x06, 0x9b, 0x03, 0xfb, 0x00, 0x1d, 0x19, 0x17, 0x4d, 0x09, 0x46, 0x6d, 0x46, 0x4d, 0x4e, 0x2c, 0x65, 0x8b, 0x5d, 0xcc, 0x56, 0x0c, 0x46, 0x4c, 0x4e, 0x2c, 0x56, 0x0c, 0x56, 0x0c, 0x56, 0x2d, 0x56, 0x4d, 0x5e, 0x4c, 0x56, 0x4c, 0x46, 0x2c, 0x4e, 0x4c, 0x56, 0x2c, 0x54, 0x88, 0x4d, 0xaa, 0x44, 0x67, 0x3c, 0x06, 0x54, 0xc4, 0x5c, 0x60, 0x6c, 0x20, 0x63, 0xe0, 0x7c, 0x80, 0x95, 0x20, 0x7c, 0xc0, 0x7c, 0xe0, 0xb5, 0xe0, 0xc5, 0x62, 0x9c, 0x62, 0x8c, 0x80, 0xd6, 0x20, 0xcd, 0xe0, 0x9c, 0xc0, 0xd5, 0xe0, 0xe6, 0xa1, 0xde, 0xc1, 0xde, 0xa0, 0x95, 0x60, 0x7d, 0x01, 0x74, 0xe1, 0x85, 0x81, 0x96, 0x62, 0xae, 0x62, 0x96, 0x43, 0x8e, 0x42, 0x9e, 0x43, 0xa6, 0x65, 0xa6, 0x42, 0x9e, 0x20, 0x8d, 0x81, 0x5b, 0xe5, 0x50, 0x81, 0x70, 0xc0, 0x72, 0xa0, 0x44, 0x69, 0x07, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x88, 0xf7, 0xa7, 0xff, 0xe5, 0xff, 0xe6, 0xff, 0x66, 0xe2, 0xa4, 0xb9, 0xc6, 0x71, 0xe1, 0x72, 0x00, 0x7a, 0x00, 0x7a, 0x00, 0x7a, 0x26, 0x4a, 0xee, 0x03, 0x6e, 0x04, 0x55, 0x05, 0x7f, 0x05, 0x7f, 0x05, 0x5f, 0x0d, 0x56, 0x0d, 0x09, 0x15, 0x53, 0x04, 0xf3, 0x05, 0x36, 0x01, 0xfb, 0x01, 0x59, 0x32, 0x48, 0x6c, 0xc4, 0x46, 0x4c, 0x46, 0x2d, 0x4e, 0x2d, 0x4e, 0x2d, 0x56, 0x2c, 0x56, 0x0c, 0x56, 0x0c, 0x5e, 0x2c, 0x5e, 0x2c, 0x5e, 0x4d, 0x5e, 0x6d, 0x56, 0x2c, 0x45, 0xeb, 0x4e, 0x2b, 0x6e, 0x09, 0x96, 0x29, 0xa6, 0x8a, 0x8d, 0x89, 0x44, 0x88, 0x33, 0xc5, 0x23, 0x43, 0x4c, 0x62, 0x64, 0x82, 0x6c, 0x63, 0x74, 0xa7, 0xae, 0x24, 0xd6, 0xc0, 0x9e, 0x0b, 0x64, 0xd5, 0xb4, 0x51, 0xf4, 0x6f, 0xe3, 0xec, 0xa3, 0xa6, 0x6b, 0x20, 0x83, 0xc0, 0x83, 0xe0, 0xc5, 0x20, 0xee, 0x60, 0xfe, 0xc1, 0xee, 0x60, 0x9c, 0xc0, 0x85, 0x20, 0x96, 0x20, 0x96, 0x41, 0x96, 0x42, 0xa6, 0x44, 0xa6, 0x44, 0x9e, 0x43, 0xa6, 0x41, 0xa6, 0x41, 0x9e, 0x20, 0x9e, 0x20, 0x95, 0xc0, 0x64, 0x49, 0x89, 0x27, 0x80, 0x00, 0x60, 0xa0, 0xa3, 0x04, 0x75, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xe6, 0xff, 0xe5, 0xff, 0xe6, 0xef, 0x05, 0xd5, 0x24, 0xea, 0x45, 0xb2, 0x27, 0x71, 0xc0, 0x71, 0xe0, 0x71, 0xc0, 0x6a, 0x30, 0x3b, 0x3a, 0x03, 0x74, 0x03, 0x4e, 0x04, 0x55, 0x05, 0x1c, 0x05, 0x5f, 0x05, 0x5f, 0x0d, 0x10, 0x0c, 0xe8, 0x15, 0x51, 0x05, 0x59, 0x04, 0xf3, 0x0b, 0x36, 0x1a, 0x4c, 0x42, 0xe0, 0x84, 0xa3, 0x56, 0x2c, 0x46, 0x4d, 0x4e, 0x2d, 0x56, 0x0c, 0x65, 0xec, 0x6d, 0xec, 0x76, 0x0d, 0x6e, 0x2d, 0x5e, 0x4e, 0x56, 0x2d, 0x55, 0xab, 0x5d, 0xaa, 0x4c, 0x06, 0x9e, 0x28, 0xbe, 0x48, 0xb6, 0x07, 0x95, 0x86, 0x5c, 0xa6, 0x44, 0x06, 0x64, 0xc7, 0x74, 0xc7, 0x6c, 0xa7, 0x84, 0xea, 0x7d, 0x0b, 0x6d, 0x2a, 0x75, 0xa7, 0x8d, 0xcc, 0x86, 0x1b, 0x6d, 0x5f, 0xa4, 0xb5, 0xdc, 0xab, 0xdc, 0x68, 0xab, 0xe6, 0x93, 0x24, 0x6a, 0x62, 0x62, 0xa0, 0x7b, 0x22, 0xac, 0x86, 0xcd, 0x80, 0xee, 0x40, 0xfe, 0xe0, 0xf6, 0xa0, 0xc6, 0x40, 0x9e, 0x40, 0x9e, 0x44, 0xae, 0x46, 0xb6, 0x62, 0xae, 0x40, 0xa6, 0x40, 0xa6, 0x20, 0xa6, 0x20, 0xa6, 0x20, 0x9e, 0x00, 0x7c, 0x43, 0xc1, 0x23, 0x98, 0x00, 0x88, 0x00, 0xea, 0x02, 0xb4, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x45, 0xe6, 0x61, 0xd4, 0xa1, 0xc9, 0x80, 0xc8, 0x00, 0xe1, 0x64, 0x92, 0x04, 0x69, 0xa0, 0x79, 0xe0, 0x5a, 0x96, 0x13, 0x1f, 0x03, 0x3f, 0x03, 0x75, 0x03, 0x4f, 0x04, 0x57, 0x05, 0x1c, 0x05, 0x1d, 0x05, 0x17, 0x0c, 0xe9, 0x15, 0x0b, 0x2d, 0x4e, 0x64, 0xb0, 0x94, 0x47, 0x2b, 0x24, 0x1a, 0x40, 0x43, 0x20, 0x63, 0xe0, 0x55, 0xcb, 0x56, 0x2d, 0x6e, 0x0c, 0x7d, 0xec, 0x8e, 0x0e, 0x8e, 0x2f, 0x86, 0x4f, 0x66, 0x4e, 0x5e, 0x2d, 0x65, 0xab, 0x54, 0x48, 0x75, 0x6a, 0x73, 0xe4, 0xad, 0x87, 0x8d, 0x67, 0x64, 0xe6, 0x64, 0xe6, 0x7d, 0x48, 0x8d, 0xa9, 0xc6, 0x4b, 0xee, 0x4a, 0xb5, 0x29, 0x7c, 0xab, 0x6c, 0xcc, 0x65, 0x2f, 0x65, 0x71, 0x75, 0x94, 0x7d, 0x98, 0x6c, 0x74, 0x74, 0x2c, 0x6c, 0x09, 0x73, 0xe7, 0x84, 0x04, 0x93, 0xa4, 0x62, 0xa6, 0x6a, 0x81, 0x5a, 0x0f, 0x49, 0xba, 0x92, 0xf5, 0xd5, 0x28, 0xf6, 0x40, 0xf6, 0x62, 0xfe, 0x67, 0xee, 0x27, 0xc5, 0xe2, 0xa6, 0x40, 0xa6, 0x40, 0xae, 0x40, 0xae, 0x60, 0xae, 0x40, 0xae, 0x20, 0xa6, 0x20, 0xa6, 0x20, 0x7c, 0x61, 0xa0, 0x64, 0xb0, 0x03, 0xd1, 0x60, 0xfa, 0x80, 0xcc, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xed, 0xac, 0x24, 0x91, 0x20, 0xa8, 0x00, 0xdb, 0x80, 0xd3, 0x83, 0xe0, 0x83, 0x79, 0x60, 0x69, 0x89, 0x4a, 0x5a, 0x03, 0x3f, 0x03, 0x3f, 0x03, 0x5f, 0x03, 0x59, 0x03, 0x31, 0x04, 0x78, 0x05, 0x3e, 0x05, 0x1c, 0x1c, 0xee, 0x0c, 0xca, 0x14, 0xeb, 0x1d, 0x0c, 0xbd, 0x27, 0xbc, 0x60, 0x00, 0x00, 0x00, 0xe0, 0x4b, 0x80, 0x3b, 0x00, 0x65, 0x0a, 0x9e, 0x0d, 0xb6, 0x0e, 0xae, 0x50, 0x9e, 0x51, 0x85, 0xcf, 0x8d, 0x0b, 0x7d, 0xcb, 0x95, 0xc8, 0x8d, 0xa7, 0x64, 0xa7, 0x6c, 0x89, 0x6b, 0x87, 0x5c, 0x49, 0x8d, 0xad, 0xa5, 0xce, 0xa5, 0xeb, 0x95, 0xaa, 0x95, 0x8c, 0xd5, 0xce, 0xf6, 0x69, 0xb5, 0x8b, 0x64, 0xef, 0x65, 0x72, 0x5d, 0xb3, 0x55, 0x50, 0x4c, 0x2b, 0x43, 0xc8, 0x2b, 0x25, 0x3c, 0x0e, 0x34, 0x72, 0x44, 0x51, 0x6c, 0x2c, 0x6b, 0x86, 0x52, 0xe5, 0x73, 0x45, 0x62, 0x6f, 0x61, 0x7b, 0xa8, 0xbe, 0xc2, 0x9a, 0xc4, 0x6f, 0xbc, 0xe4, 0xcd, 0x46, 0xf5, 0x46, 0xec, 0x22, 0xc4, 0xc0, 0xad, 0xc0, 0x9e, 0x20, 0xa6, 0x40, 0xae, 0x40, 0xb6, 0x60, 0xb6, 0x60, 0xae, 0x40, 0x94, 0xc5, 0x98, 0x6a, 0xc0, 0x04, 0xf9, 0xe1, 0xfb, 0x00, 0xd4, 0x03, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xaa, 0xbc, 0x27, 0xc3, 0xa0, 0x91, 0xf0, 0x73, 0x1a, 0xab, 0x10, 0xd0, 0x00, 0x69, 0x4f, 0x32, 0x5d, 0x02, 0x1f, 0x02, 0x3f, 0x02, 0xff, 0x03, 0x5f, 0x03, 0x5f, 0x03, 0x17, 0x04, 0x1b, 0x04, 0xff, 0x14, 0xf7, 0x1c, 0xc9, 0x1c, 0xeb, 0x1c, 0xeb, 0x04, 0xec, 0xad, 0x29, 0xd5, 0x80, 0x63, 0x40, 0x01, 0x00, 0x5b, 0xe0, 0x4b, 0xa0, 0x8d, 0x2a, 0xb6, 0x50, 0x9e, 0x2f, 0x7d, 0xee, 0x94, 0x89, 0x94, 0xaa, 0xa4, 0x09, 0x9c, 0xe8, 0x85, 0x6a, 0x95, 0xaf, 0x9d, 0x2f, 0xad, 0x30, 0xce, 0x13, 0xb5, 0xf1, 0xad, 0xf1, 0x95, 0x70, 0x9d, 0x50, 0xbd, 0xd4, 0xce, 0x16, 0xad, 0xb5, 0x8d, 0xb3, 0x6d, 0x93, 0x65, 0x72, 0x55, 0x2f, 0x44, 0xaa, 0x44, 0x46, 0x3b, 0xa7, 0x33, 0x88, 0x33, 0x48, 0x34, 0x0e, 0x34, 0xd2, 0x34, 0x71, 0x34, 0x2f, 0x54, 0x2b, 0x74, 0x88, 0x84, 0x84, 0x93, 0xe5, 0xbb, 0xae, 0xcb, 0xb3, 0x7b, 0xfb, 0x5b, 0x15, 0x8a, 0x65, 0xb3, 0x40, 0xdb, 0xa0, 0xca, 0xc8, 0xca, 0x42, 0xc2, 0xe0, 0xb4, 0x40, 0xa5, 0xa0, 0xa6, 0x20, 0xa6, 0x40, 0xae, 0x40, 0xb6, 0x60, 0x9d, 0x63, 0xd1, 0x47, 0xf8, 0x00, 0xd8, 0x20, 0xc1, 0x80, 0xe3, 0x24, 0x06, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x33, 0x83, 0x13, 0x93, 0x66, 0x5a, 0x32, 0x58, 0x1d, 0xd1, 0x0e, 0xd4, 0x55, 0xa4, 0x9e, 0x5b, 0x5f, 0x0a, 0x1f, 0x01, 0x5f, 0x01, 0xbf, 0x02, 0xbf, 0x03, 0x1f, 0x02, 0xbe, 0x03, 0x7f, 0x0c, 0x5d, 0x24, 0xad, 0x24, 0xaa, 0x2c, 0xcc, 0x3d, 0x0f, 0x14, 0xf2, 0x9d, 0x6e, 0xee, 0x20, 0xa5, 0x20, 0x53, 0x00, 0x2a, 0xc0, 0xad, 0xa0, 0xe7, 0x47, 0x75, 0xed, 0x65, 0xab, 0x65, 0x89, 0x9c, 0xa8, 0xac, 0x4a, 0xa4, 0x4a, 0xac, 0x6c, 0xce, 0x35, 0xee, 0x97, 0xde, 0x35, 0xb5, 0x91, 0x9d, 0x4f, 0x95, 0x0f, 0xa5, 0x52, 0xbd, 0xd5, 0xc5, 0xf6, 0xb6, 0x16, 0x8d, 0xd4, 0x6d, 0xb3, 0x5d, 0x72, 0x4c, 0xcd, 0x44, 0x68, 0x44, 0x25, 0x4c, 0x89, 0x4c, 0xcb, 0x44, 0x8c, 0x2b, 0x88, 0x33, 0xaa, 0x34, 0x0b, 0x35, 0x0f, 0x34, 0x8c, 0x3c, 0x29, 0x43, 0xe6, 0x4c, 0x26, 0x64, 0xc7, 0xb5, 0x28, 0xf5, 0xe2, 0xdd, 0x40, 0x73, 0x48, 0x51, 0xec, 0x51, 0x4c, 0x59, 0x92, 0x8b, 0x78, 0xb2, 0xf0, 0xcb, 0x20, 0xca, 0xe0, 0xc1, 0xa0, 0xba, 0x40, 0xb4, 0x20, 0xb5, 0x80, 0xa6, 0x00, 0xa6, 0x20, 0xa5, 0xa0, 0xca, 0x08, 0xf8, 0x06, 0xb0, 0x00, 0x90, 0x00, 0xd2, 0x84, 0x65, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x75, 0x39, 0xd7, 0x29, 0x2a, 0xb4, 0xc0, 0xe4, 0x47, 0xc9, 0xca, 0xf6, 0x7c, 0xff, 0x1e, 0xf6, 0xbe, 0xde, 0x1f, 0xb5, 0x3f, 0x84, 0x3f, 0x4b, 0x3f, 0x02, 0x5f, 0x19, 0xdf, 0x73, 0x5f, 0x24, 0xf5, 0x3c, 0xea, 0x34, 0xcf, 0x2c, 0xd1, 0x45, 0x14, 0x35, 0x14, 0x7d, 0x31, 0xe5, 0xe2, 0xbd, 0x40, 0xb4, 0x20, 0xa2, 0xc0, 0xd5, 0xa0, 0xee, 0xe4, 0x7d, 0xcb, 0x85, 0x8c, 0xa5, 0xf3, 0xc5, 0x93, 0xc5, 0x53, 0xdc, 0xf0, 0xdc, 0xcf, 0xce, 0x15, 0xa5, 0x50, 0x8c, 0xce, 0x95, 0x10, 0xb5, 0xd5, 0xce, 0x57, 0xce, 0x58, 0xad, 0xd5, 0x85, 0x73, 0x65, 0x71, 0x55, 0x0e, 0x3b, 0xea, 0x34, 0x09, 0x2b, 0x66, 0x3c, 0xab, 0x3d, 0x2e, 0x55, 0x6f, 0x44, 0xed, 0x34, 0x09, 0x34, 0x2b, 0x35, 0x4f, 0x35, 0x70, 0x35, 0x0e, 0x3c, 0x27, 0x3c, 0x49, 0x34, 0x09, 0x34, 0x09, 0x23, 0xa7, 0x74, 0x04, 0xe5, 0xe0, 0xe6, 0x00, 0x9c, 0x40, 0x83, 0x82, 0x6a, 0x26, 0x4a, 0xf6, 0x07, 0x3f, 0x1c, 0xfa, 0x68, 0x20, 0xa2, 0xa0, 0xc3, 0x40, 0xd3, 0x20, 0xe2, 0xe0, 0xfb, 0x60, 0xd4, 0x00, 0xb5, 0x40, 0xa5, 0xc0, 0xba, 0xe8, 0xe8, 0x0e, 0x88, 0x62, 0x80, 0x00, 0x8a, 0x21, 0x6c, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf1, 0x61, 0xb6, 0xdd, 0xca, 0xff, 0x80, 0xee, 0x0a, 0xd4, 0x13, 0xfe, 0xfd, 0xff, 0x1e, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xee, 0xdf, 0xd6, 0x3f, 0xb5, 0x1e, 0xa4, 0x98, 0x1d, 0x10, 0x1c, 0xd1, 0x14, 0xf4, 0x1c, 0x92, 0x34, 0x90, 0x34, 0x90, 0x3c, 0xb2, 0xbc, 0x69, 0xd4, 0xa0, 0xec, 0xc0, 0xfc, 0xe1, 0xdc, 0xc3, 0xcb, 0xc2, 0xb5, 0xb2, 0xde, 0xd9, 0xef, 0x1b, 0xd5, 0x32, 0xbb, 0xeb, 0xa4, 0xad, 0x8c, 0xad, 0x8d, 0x10, 0xad, 0xb3, 0xce, 0x37, 0xd6, 0x58, 0xc6, 0x17, 0x9d, 0x93, 0x7d, 0x31, 0x6c, 0xef, 0x64, 0xec, 0x54, 0xaa, 0x44, 0x69, 0x34, 0x29, 0x3c, 0x8b, 0x34, 0x6c, 0x35, 0x2f, 0x35, 0x2f, 0x45, 0x0e, 0x35, 0x0c, 0x35, 0x0e, 0x3d, 0x70, 0x3d, 0x91, 0x3d, 0x50, 0x44, 0xcd, 0x3c, 0x4a, 0x2c, 0x4c, 0x13, 0xcb, 0x03, 0x8b, 0x03, 0x8c, 0x03, 0xce, 0x34, 0x51, 0x5c, 0x0b, 0x7b, 0xc0, 0xa4, 0x60, 0x8b, 0xc0, 0x7b, 0x28, 0x7d, 0x18, 0x6b, 0x94, 0x28, 0x00, 0x00, 0x00, 0x49, 0x00, 0x9a, 0x60, 0xd3, 0xa0, 0xfc, 0x40, 0xfc, 0x40, 0xf4, 0x20, 0xc4, 0x00, 0xba, 0xc3, 0xa8, 0xa9, 0x28, 0xe3, 0x49, 0x23, 0x62, 0x84, 0x64, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x10, 0xd4, 0x2d, 0xd9, 0x26, 0xfb, 0x60, 0xfd, 0x04, 0xd4, 0x0c, 0xd5, 0x36, 0xff, 0x1e, 0xff, 0x1e, 0xff, 0x1e, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0x5e, 0xe6, 0xfa, 0xb5, 0xf4, 0x54, 0x8c, 0x3c, 0xd0, 0x3d, 0x11, 0x35, 0x11, 0x24, 0x6e, 0x24, 0x73, 0x4d, 0x39, 0x8e, 0x3e, 0xdc, 0x72, 0xf4, 0x20, 0xe4, 0xc0, 0xc3, 0xe1, 0xcb, 0xaa, 0xda, 0x09, 0xe5, 0x53, 0xce, 0x76, 0x9d, 0x2f, 0x7c, 0x6b, 0x8c, 0xef, 0xad, 0xb3, 0xce, 0x77, 0xde, 0xb9, 0xce, 0x78, 0xad, 0xb5, 0x8d, 0x31, 0x74, 0xef, 0x64, 0xad, 0x4c, 0x0a, 0x54, 0x69, 0x54, 0xa9, 0x55, 0x2c, 0x5d, 0x8e, 0x44, 0x8c, 0x3c, 0xed, 0x34, 0xcd, 0x2c, 0xac, 0x2d, 0x0e, 0x35, 0x6f, 0x35, 0x70, 0x2d, 0x50, 0x35, 0x30, 0x45, 0x30, 0x4d, 0x71, 0x44, 0xef, 0x0c, 0x51, 0x04, 0x32, 0x04, 0x53, 0x04, 0x74, 0x04, 0x95, 0x04, 0x96, 0x04, 0x54, 0x43, 0xad, 0x2a, 0xc9, 0x32, 0x20, 0x5b, 0x01, 0x6b, 0x40, 0x7b, 0x00, 0x83, 0x00, 0x73, 0x00, 0x6a, 0xc0, 0x62, 0x60, 0x5a, 0x00, 0x41, 0x60, 0x82, 0x00, 0xd3, 0xc0, 0xfc, 0xc0, 0xfc, 0xc0, 0xdc, 0xc0, 0x93, 0xa0, 0x02, 0x47, 0x02, 0x8c, 0x02, 0xc9, 0x3c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x96, 0xec, 0x1c, 0xfa, 0xd1, 0xf9, 0x20, 0xd0, 0x06, 0xb0, 0x0a, 0xdd, 0xd8, 0xff, 0x3f, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xf6, 0xfc, 0xd6, 0x57, 0x9d, 0x70, 0x74, 0xea, 0x44, 0x4a, 0x24, 0x0a, 0x44, 0x6a, 0x44, 0xed, 0x5d, 0x92, 0x75, 0x99, 0x96, 0x7f, 0xd7, 0x3f, 0xef, 0xdf, 0xfe, 0xd8, 0xf4, 0x60, 0xa3, 0x60, 0x58, 0xe0, 0x99, 0x84, 0xba, 0x08, 0xcb, 0xaa, 0x7c, 0xad, 0x9d, 0x52, 0xc6, 0x57, 0xe6, 0xfa, 0xe6, 0xda, 0xce, 0x57, 0x9d, 0x93, 0x7d, 0x0f, 0x74, 0xed, 0x6c, 0x8b, 0x4b, 0xc9, 0x43, 0xc9, 0x3b, 0x8a, 0x4c, 0xac, 0x5d, 0x8f, 0x5d, 0xaf, 0x5d, 0x6d, 0x2b, 0xc9, 0x2c, 0x8c, 0x35, 0x6f, 0x2d, 0x70, 0x25, 0x6f, 0x2d, 0x2e, 0x35, 0x0f, 0x35, 0x10, 0x3d, 0x51, 0x3d, 0x72, 0x3d, 0x72, 0x2c, 0xf0, 0x04, 0xd7, 0x04, 0xd7, 0x04, 0xb6, 0x04, 0xb6, 0x04, 0xb6, 0x04, 0xb6, 0x3b, 0xd0, 0x7c, 0xb1, 0x3b, 0x4d, 0x00, 0xe0, 0x01, 0x43, 0x19, 0xc3, 0x3a, 0x8c, 0x52, 0xe8, 0x6b, 0x00, 0x73, 0x20, 0x73, 0x40, 0x73, 0x20, 0x73, 0x20, 0x6a, 0xe0, 0x62, 0x40, 0x93, 0xe0, 0xdd, 0x20, 0xed, 0x80, 0xf6, 0x20, 0xcd, 0x62, 0x53, 0x86, 0x62, 0x83, 0x6b, 0x64, 0x07, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x9a, 0xda, 0x1f, 0xf2, 0x7d, 0xe9, 0xaf, 0xb0, 0x08, 0xaa, 0x48, 0xf6, 0xbb, 0xff, 0x5e, 0xff, 0x3d, 0xf6, 0xdb, 0xc5, 0xf5, 0x95, 0x6b, 0x6c, 0xe0, 0x6c, 0x84, 0x64, 0xaa, 0x34, 0x4d, 0x34, 0x8e, 0x54, 0xcf, 0x8d, 0xd7, 0xae, 0x9d, 0xc6, 0xdd, 0xf7, 0xdf, 0xff, 0xff, 0xf7, 0xbc, 0xee, 0x77, 0xf3, 0x28, 0xe3, 0x20, 0xb2, 0x20, 0x89, 0x40, 0x68, 0x00, 0x8a, 0xc9, 0xde, 0xf9, 0xef, 0x5c, 0xde, 0xda, 0xb6, 0x16, 0x95, 0x72, 0x7d, 0x0f, 0x74, 0xed, 0x6c, 0xec, 0x6c, 0xcb, 0x5c, 0x6b, 0x4c, 0x2b, 0x43, 0xc9, 0x4c, 0x2c, 0x4c, 0x8c, 0x55, 0x4e, 0x4d, 0x4d, 0x45, 0x4e, 0x35, 0x8f, 0x35, 0xb0, 0x2d, 0x6f, 0x2d, 0x2e, 0x24, 0xed, 0x2d, 0x0f, 0x2d, 0x30, 0x25, 0x11, 0x15, 0x11, 0x1d, 0x52, 0x3d, 0x72, 0x2c, 0xf0, 0x04, 0xd7, 0x04, 0xd7, 0x04, 0xd6, 0x04, 0xb6, 0x04, 0xb6, 0x04, 0x75, 0x6c, 0x0e, 0x8d, 0xf7, 0x43, 0xaf, 0x00, 0xa0, 0x01, 0x24, 0x01, 0x2a, 0x01, 0xbc, 0x01, 0x74, 0x29, 0xe0, 0x42, 0x81, 0x4a, 0xa0, 0x52, 0x60, 0x5a, 0x20, 0x5a, 0xc0, 0x53, 0xa0, 0x42, 0xe0, 0x39, 0xc0, 0x38, 0xc0, 0x8b, 0x40, 0xbc, 0x60, 0x83, 0x40, 0xbc, 0x20, 0x8b, 0x64, 0x05, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xfa, 0xea, 0x7d, 0xc2, 0xba, 0x88, 0x15, 0x9a, 0x38, 0xb4, 0x2f, 0xff, 0x1c, 0xe6, 0x9a, 0xb5, 0x93, 0x84, 0xc9, 0x54, 0x40, 0x64, 0xc1, 0x85, 0x65, 0x7d, 0x0b, 0x4c, 0x8f, 0x4c, 0x8f, 0x85, 0x33, 0xad, 0xf8, 0xc6, 0x3a, 0xc5, 0x94, 0xe6, 0x71, 0xef, 0x38, 0xef, 0x7b, 0xf7, 0x9c, 0xef, 0x1c, 0xd2, 0x4b, 0xe2, 0xa7, 0xba, 0x68, 0x89, 0x00, 0x70, 0xc0, 0x92, 0x44, 0xd6, 0x57, 0xb6, 0x17, 0x95, 0x52, 0x7d, 0x2f, 0x7c, 0xcd, 0x74, 0x6b, 0x8b, 0x87, 0x74, 0x6a, 0x65, 0x2d, 0x65, 0x2f, 0x4c, 0x6c, 0x4c, 0x6b, 0x3b, 0xaa, 0x3c, 0x8b, 0x45, 0x4d, 0x45, 0x8f, 0x3d, 0xaf, 0x3d, 0x6e, 0x35, 0x2d, 0x35, 0x0d, 0x2d, 0x0f, 0x1d, 0x10, 0x0c, 0xf0, 0x04, 0xf0, 0x0c, 0xf1, 0x0d, 0x11, 0x15, 0x32, 0x2d, 0x31, 0x1c, 0x8e, 0x04, 0xd7, 0x04, 0xd7, 0x04, 0xd7, 0x04, 0xd7, 0x04, 0xd7, 0x3c, 0x11, 0x8d, 0x33, 0x96, 0x9b, 0x4b, 0xf0, 0x00, 0x40, 0x01, 0x22, 0x01, 0x33, 0x02, 0x5f, 0x01, 0x57, 0x00, 0x00, 0x00, 0xc0, 0x21, 0xe0, 0x42, 0xa4, 0x4a, 0xc6, 0x1b, 0x82, 0x0c, 0x21, 0x43, 0xa0, 0x3b, 0x20, 0x2a, 0x60, 0x02, 0x61, 0x02, 0xe3, 0x48, 0x00, 0x78, 0x80, 0x8a, 0xc3, 0x6d, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xad, 0xc3, 0x35, 0xd0, 0x10, 0xc0, 0x83, 0xc8, 0xe6, 0xbb, 0x72, 0xa4, 0xad, 0xa4, 0xf0, 0x83, 0xe8, 0x73, 0xa4, 0x6c, 0x46, 0x7d, 0x04, 0x5c, 0x80, 0x6c, 0xc2, 0x7c, 0xf2, 0xad, 0xd8, 0x9d, 0x52, 0x8c, 0xd1, 0x94, 0xcf, 0xcd, 0x91, 0xd5, 0xf3, 0xce, 0x58, 0xe7, 0x3c, 0xf7, 0x9d, 0xff, 0x9d, 0xf7, 0x5d, 0xbc, 0x31, 0x83, 0x8b, 0xab, 0x0c, 0xa0, 0x67, 0x90, 0xa4, 0xdb, 0x20, 0xcd, 0x0c, 0x85, 0x50, 0x74, 0xed, 0x6c, 0x49, 0x83, 0x46, 0x8b, 0x87, 0x7c, 0x2a, 0x7c, 0x2a, 0x65, 0x2e, 0x5c, 0xcc, 0x3b, 0x88, 0x3c, 0x4b, 0x4d, 0x2d, 0x45, 0x6e, 0x3d, 0x4c, 0x45, 0x2c, 0x4d, 0x2c, 0x3d, 0x2d, 0x35, 0x2f, 0x25, 0x30, 0x0d, 0x30, 0x05, 0x10, 0x04, 0xd0, 0x0c, 0xf0, 0x15, 0x11, 0x0d, 0x11, 0x0d, 0x32, 0x1c, 0xce, 0x0c, 0x2d, 0x04, 0xd9, 0x04, 0xd8, 0x04, 0xd8, 0x04, 0xd7, 0x04, 0xb6, 0x6c, 0x2f, 0x9e, 0x59, 0x9e, 0xbb, 0x54, 0x31, 0x00, 0x00, 0x01, 0x02, 0x01, 0x98, 0x03, 0x1f, 0x01, 0xd9, 0x00, 0x60, 0x01, 0xe8, 0x02, 0xcb, 0x02, 0xec, 0x03, 0xab, 0x24, 0xa0, 0x1a, 0xe0, 0x19, 0xc0, 0x2a, 0x60, 0x32, 0xe2, 0x5c, 0x04, 0x8d, 0x09, 0xc2, 0xc0, 0xc2, 0x20, 0x93, 0x83, 0x56, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x48, 0xea, 0xe7, 0xf1, 0x40, 0xc0, 0x00, 0xd9, 0xc0, 0xbb, 0x28, 0x9c, 0xc8, 0x7b, 0x20, 0x8a, 0x61, 0xab, 0x24, 0xa4, 0x66, 0xbd, 0xe9, 0x9d, 0xab, 0xad, 0x0e, 0xb4, 0x8f, 0x9c, 0xb1, 0x9c, 0xce, 0xbd, 0x72, 0xcd, 0xd3, 0xbd, 0x93, 0xbd, 0xd5, 0xa5, 0x34, 0xb5, 0x75, 0xe7, 0x1c, 0xd6, 0xbf, 0xa5, 0x5f, 0xa5, 0x55, 0x64, 0x30, 0xb2, 0x71, 0xa8, 0x6a, 0xa8, 0xab, 0xdb, 0x02, 0xd4, 0xa6, 0x5c, 0x69, 0x54, 0x69, 0x64, 0x8b, 0x74, 0x4a, 0x7c, 0x08, 0x83, 0xc8, 0x83, 0xc8, 0x54, 0xaa, 0x4c, 0xcb, 0x44, 0xec, 0x45, 0x2c, 0x45, 0x0b, 0x44, 0xea, 0x44, 0xea, 0x4d, 0x2c, 0x45, 0x6f, 0x2d, 0x70, 0x15, 0x50, 0x0d, 0x30, 0x0d, 0x30, 0x05, 0x10, 0x04, 0xf0, 0x0d, 0x10, 0x15, 0x51, 0x15, 0x52, 0x15, 0x31, 0x1c, 0x6a, 0x0c, 0x2f, 0x04, 0xda, 0x04, 0xda, 0x04, 0xd8, 0x04, 0xd8, 0x34, 0x33, 0x95, 0x53, 0xa6, 0xdb, 0xa6, 0xdb, 0x5c, 0x51, 0x00, 0x00, 0x00, 0xe5, 0x01, 0x99, 0x03, 0x1f, 0x02, 0x79, 0x03, 0x2f, 0x03, 0xf2, 0x03, 0x90, 0x02, 0xed, 0x1c, 0x67, 0x2c, 0xc0, 0x23, 0x20, 0x01, 0x20, 0x29, 0x41, 0x5a, 0x27, 0x9a, 0xa3, 0x82, 0x41, 0x9a, 0xe0, 0xb4, 0x62, 0x8d, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x46, 0xda, 0x60, 0xf8, 0xe0, 0xda, 0x32, 0xe3, 0x76, 0xd3, 0x4b, 0xdc, 0xeb, 0xbb, 0x40, 0x9b, 0x40, 0x6a, 0x60, 0x9a, 0xca, 0xd4, 0x4e, 0xbd, 0xf4, 0xa5, 0x71, 0xb4, 0xcf, 0xcd, 0xd4, 0xcd, 0xf5, 0xb5, 0x52, 0xa5, 0x10, 0x7c, 0x0f, 0x74, 0x14, 0x74, 0x7a, 0x6c, 0x7a, 0x64, 0x7a, 0x33, 0xda, 0x03, 0x55, 0x95, 0x15, 0x74, 0xfe, 0xaa, 0x59, 0xb0, 0x8c, 0xa0, 0xcc, 0xa1, 0x49, 0xbc, 0x16, 0x64, 0xcd, 0x64, 0xec, 0x5c, 0xec, 0x7b, 0xa8, 0x7b, 0xc8, 0x7b, 0xe8, 0x74, 0x6a, 0x4d, 0x0b, 0x4c, 0xeb, 0x44, 0xc9, 0x44, 0x88, 0x44, 0x88, 0x4c, 0xa9, 0x4c, 0xca, 0x3c, 0x89, 0x2c, 0xcb, 0x25, 0x0e, 0x15, 0x50, 0x0d, 0x51, 0x05, 0x31, 0x05, 0x51, 0x04, 0xf0, 0x0d, 0x31, 0x15, 0x52, 0x15, 0x72, 0x15, 0x0f, 0x1c, 0x47, 0x0c, 0x50, 0x04, 0xfc, 0x04, 0xdb, 0x04, 0xda, 0x04, 0x98, 0x74, 0x2f, 0xae, 0x58, 0xae, 0xfc, 0xae, 0xfc, 0x64, 0x72, 0x00, 0x00, 0x09, 0xc6, 0x11, 0xb2, 0x19, 0x11, 0x09, 0x38, 0x02, 0x53, 0x03, 0x0f, 0x03, 0x50, 0x03, 0x8d, 0x1d, 0x63, 0x24, 0xa0, 0x03, 0x2b, 0x42, 0x08, 0x72, 0xa0, 0xb3, 0x01, 0xcc, 0x00, 0x73, 0x80, 0x3c, 0x23, 0x0d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x82, 0xd2, 0x00, 0xeb, 0xd3, 0xe4, 0x1e, 0xf3, 0xba, 0xe9, 0xa0, 0xd1, 0x20, 0xd2, 0x20, 0xec, 0xe7, 0xbb, 0xaa, 0xbb, 0x8b, 0xbc, 0x4d, 0xbd, 0x92, 0xce, 0x15, 0xc5, 0x93, 0xa4, 0xae, 0x9c, 0x6d, 0x6b, 0xaf, 0x74, 0x34, 0x6c, 0x38, 0x3b, 0xf8, 0x23, 0xd4, 0x2b, 0xf1, 0x2c, 0x11, 0x34, 0x50, 0x13, 0xad, 0x7c, 0xf5, 0x86, 0xbf, 0xbc, 0x79, 0xb8, 0x6e, 0x98, 0x0a, 0xd3, 0xf7, 0xed, 0x5d, 0x74, 0xcf, 0x5c, 0xaa, 0x5c, 0x8a, 0x73, 0xc8, 0x64, 0x49, 0x44, 0xeb, 0x44, 0xaa, 0x4c, 0x89, 0x44, 0x68, 0x4c, 0x89, 0x4c, 0x8a, 0x4c, 0xaa, 0x44, 0x68, 0x3c, 0x47, 0x34, 0x47, 0x34, 0x67, 0x34, 0x67, 0x34, 0x89, 0x2c, 0xcc, 0x1d, 0x0f, 0x0d, 0x51, 0x05, 0x11, 0x0d, 0x32, 0x15, 0x52, 0x15, 0x52, 0x14, 0xac, 0x14, 0x26, 0x0c, 0x72, 0x05, 0x1d, 0x04, 0xdc, 0x04, 0xdb, 0x44, 0x55, 0xa5, 0x31, 0xb6, 0xfb, 0xb7, 0x1c, 0xa6, 0xfa, 0x5d, 0xb0, 0x04, 0x20, 0x0a, 0xa1, 0x18, 0xc6, 0x10, 0x07, 0x00, 0x19, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa5, 0x53, 0xa7, 0x95, 0xc0, 0x85, 0xd1, 0x73, 0x51, 0x61, 0xa8, 0x89, 0x60, 0x99, 0xc0, 0xb3, 0xa0, 0x85, 0x84, 0x07, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xb0, 0xed, 0x43, 0xfd, 0xb0, 0xfe, 0x9c, 0xfc, 0x76, 0xea, 0x28, 0xd9, 0xc0, 0xe9, 0xa9, 0xe2, 0xab, 0xd4, 0xaf, 0xc4, 0xef, 0xc5, 0x92, 0xc5, 0xb4, 0xc5, 0x30, 0xbc, 0x6a, 0x6a, 0xe9, 0x63, 0x31, 0x6b, 0xb7, 0x53, 0xb8, 0x2b, 0xb4, 0x03, 0x70, 0x13, 0x8e, 0x1b, 0xae, 0x2c, 0x30, 0x24, 0x10, 0x24, 0x10, 0x13, 0xf0, 0x64, 0x92, 0xb5, 0xb3, 0xac, 0x92, 0xa3, 0x13, 0xc2, 0xb2, 0xfd, 0x9e, 0xfd, 0xbe, 0x84, 0xb2, 0x54, 0xc9, 0x5c, 0xca, 0x54, 0xaa, 0x44, 0x88, 0x4c, 0x68, 0x4c, 0x68, 0x4c, 0x89, 0x4c, 0xaa, 0x4c, 0xaa, 0x44, 0x89, 0x44, 0x69, 0x44, 0x68, 0x3c, 0x68, 0x3c, 0x68, 0x3c, 0x89, 0x3c, 0x88, 0x3c, 0x88, 0x3c, 0x67, 0x34, 0x87, 0x2c, 0xaa, 0x14, 0xad, 0x05, 0x10, 0x15, 0x73, 0x0d, 0x0f, 0x04, 0x68, 0x04, 0x26, 0x04, 0x93, 0x05, 0x1e, 0x04, 0xfd, 0x04, 0xdb, 0x8c, 0x71, 0xae, 0x36, 0xa6, 0xb9, 0x7d, 0xd3, 0x4d, 0xca, 0x26, 0xc0, 0x26, 0xc0, 0x0d, 0x27, 0x10, 0x0d, 0x08, 0x08, 0x00, 0x12, 0x00, 0x0d, 0x20, 0x0a, 0xa0, 0x8f, 0xe2, 0x81, 0xec, 0xe0, 0xdc, 0x8b, 0xe9, 0xc5, 0xca, 0x20, 0x81, 0x60, 0x41, 0x80, 0x02, 0x00, 0x03, 0xa3, 0x05, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x4f, 0xf5, 0x88, 0xfd, 0xad, 0xeb, 0xac, 0xe0, 0x00, 0xeb, 0x02, 0xe3, 0xe4, 0xdc, 0x6e, 0xd5, 0x51, 0xcd, 0xd3, 0xc5, 0x51, 0xa4, 0x2b, 0x7a, 0xe8, 0x92, 0xec, 0x93, 0x90, 0x53, 0x74, 0x2b, 0x55, 0x03, 0x34, 0x03, 0x93, 0x13, 0xf1, 0x1b, 0x8d, 0x23, 0xce, 0x13, 0xcf, 0x03, 0xf0, 0x04, 0x32, 0x14, 0x53, 0x1c, 0x51, 0x2c, 0x10, 0x8c, 0xee, 0xa5, 0x71, 0x74, 0x58, 0xdc, 0xfb, 0xfe, 0x1f, 0xfe, 0x3f, 0xb5, 0x35, 0x3c, 0x86, 0x44, 0x67, 0x4c, 0x47, 0x4c, 0x47, 0x54, 0x89, 0x54, 0xaa, 0x4c, 0x89, 0x44, 0x68, 0x44, 0x89, 0x44, 0x89, 0x44, 0x69, 0x44, 0x89, 0x3c, 0x89, 0x3c, 0xaa, 0x3c, 0xa9, 0x3c, 0xa9, 0x3c, 0x88, 0x34, 0x88, 0x2c, 0x67, 0x24, 0x47, 0x44, 0xac, 0x5d, 0x71, 0x4d, 0x50, 0x34, 0xed, 0x55, 0x0d, 0x2c, 0x68, 0x0c, 0x94, 0x1d, 0x3e, 0x05, 0x1e, 0x3c, 0x97, 0x8c, 0x8b, 0x64, 0xee, 0x2b, 0xe6, 0x03, 0xa0, 0x1e, 0x40, 0x2e, 0xe0, 0x27, 0x00, 0x04, 0x6d, 0x00, 0x13, 0x00, 0x15, 0x00, 0xb8, 0x01, 0x4e, 0xa9, 0x14, 0xfb, 0xd9, 0xfe, 0x83, 0xff, 0x60, 0xc4, 0x20, 0xaa, 0x01, 0x92, 0x40, 0x19, 0xa0, 0x02, 0x61, 0x03, 0x62, 0x04, 0x23, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xaf, 0xf4, 0xea, 0xfb, 0x2d, 0xf1, 0xc8, 0xf3, 0x0a, 0xec, 0x48, 0xdd, 0xb1, 0xc5, 0x72, 0x94, 0x2d, 0x8b, 0xa9, 0xab, 0xed, 0x7b, 0x34, 0x5b, 0x76, 0x23, 0xb5, 0x03, 0x72, 0x03, 0x4f, 0x03, 0x2f, 0x03, 0x4f, 0x03, 0xb1, 0x03, 0xd1, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xd0, 0x03, 0xf1, 0x04, 0xb5, 0x04, 0x94, 0x04, 0x10, 0x03, 0x8e, 0x9d, 0xad, 0xde, 0x8f, 0xc3, 0x15, 0xea, 0x30, 0xfb, 0xd4, 0xfd, 0x9c, 0xd5, 0x99, 0x3c, 0x47, 0x44, 0x47, 0x4c, 0x69, 0x54, 0x8a, 0x4c, 0x68, 0x44, 0x48, 0x44, 0x68, 0x4c, 0x89, 0x4c, 0x89, 0x44, 0x89, 0x44, 0x68, 0x44, 0x89, 0x3c, 0xa9, 0x3c, 0xa9, 0x3c, 0x89, 0x34, 0x88, 0x2c, 0x87, 0x3c, 0xcb, 0x6d, 0x71, 0x85, 0xd5, 0x75, 0xb4, 0x75, 0x72, 0x95, 0xb3, 0x9e, 0x15, 0x8d, 0xb4, 0x85, 0x73, 0xa6, 0x39, 0xb6, 0xbd, 0xae, 0x9d, 0x8d, 0x74, 0x54, 0x29, 0x03, 0x20, 0x02, 0xe0, 0x1d, 0x40, 0x36, 0xe0, 0x2f, 0x00, 0x1e, 0x80, 0x01, 0xf1, 0x00, 0x16, 0x01, 0xb5, 0x02, 0x51, 0x02, 0x6a, 0xc0, 0xc6, 0xf8, 0xe6, 0xfd, 0x21, 0xd6, 0x01, 0x72, 0xc0, 0x02, 0x00, 0x02, 0xa1, 0x03, 0x82, 0x0c, 0x64, 0x1e, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe5, 0xe3, 0xca, 0xfb, 0x8b, 0xfc, 0x84, 0xe4, 0x86, 0xd3, 0x03, 0xe2, 0xec, 0xca, 0xae, 0x89, 0xa3, 0xb2, 0x67, 0xa2, 0x4e, 0xb1, 0xf1, 0xb9, 0xef, 0xaa, 0x4c, 0xa2, 0x89, 0xa2, 0x68, 0xa2, 0xe9, 0xab, 0x69, 0x8a, 0xaa, 0x8a, 0xb0, 0xa2, 0xf0, 0x9b, 0x4d, 0x93, 0x6e, 0x93, 0xcf, 0x65, 0x56, 0x44, 0xf5, 0x13, 0xaf, 0x03, 0x2d, 0x7c, 0x2b, 0xbb, 0xe7, 0xe8, 0x13, 0xf0, 0x13, 0xe0, 0x01, 0xc0, 0xa7, 0x9b, 0xb6, 0x5c, 0xae, 0x44, 0x47, 0x4c, 0x68, 0x4c, 0x68, 0x4c, 0x48, 0x4c, 0x68, 0x4c, 0x68, 0x4c, 0x69, 0x4c, 0x89, 0x4c, 0x89, 0x44, 0x89, 0x44, 0xa9, 0x3c, 0x89, 0x34, 0x88, 0x2c, 0x87, 0x54, 0xeb, 0x8d, 0xf3, 0xb6, 0xb9, 0xa6, 0x37, 0x95, 0xb4, 0xb6, 0x36, 0xbe, 0x78, 0x9e, 0x17, 0x9d, 0xf7, 0xb6, 0x7a, 0xce, 0xfd, 0xd7, 0x1e, 0xd7, 0x3e, 0xce, 0xbb, 0xbe, 0x17, 0xbd, 0xf6, 0xad, 0x94, 0x84, 0xf0, 0x25, 0xc5, 0x36, 0xc0, 0x2f, 0x20, 0x1d, 0x21, 0x68, 0xeb, 0x83, 0x2f, 0x22, 0xea, 0x02, 0x86, 0x62, 0x69, 0xd0, 0xc8, 0xc0, 0xe0, 0x79, 0x00, 0x01, 0xc0, 0x02, 0xc1, 0x03, 0xc3, 0x0c, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x03, 0xc3, 0x7b, 0xc7, 0xf3, 0x89, 0xf2, 0x06, 0xe8, 0xe7, 0xf0, 0x04, 0xf8, 0x0d, 0xf8, 0x0b, 0xc8, 0x00, 0xc8, 0x00, 0xb0, 0x00, 0xc0, 0x00, 0xe8, 0x00, 0xe0, 0x40, 0xd0, 0x40, 0xc8, 0x00, 0xe2, 0xa0, 0xeb, 0xe0, 0xc8, 0x49, 0xd8, 0x15, 0xf8, 0xcb, 0xf9, 0x80, 0xfa, 0x40, 0xc3, 0x45, 0xb6, 0xdb, 0xc7, 0x7e, 0xae, 0xdc, 0x96, 0x39, 0x9d, 0x15, 0xb9, 0x28, 0xb8, 0x16, 0xc0, 0x5c, 0x68, 0x32, 0x08, 0x04, 0x32, 0x5c, 0x74, 0xd4, 0x44, 0x66, 0x4c, 0x89, 0x54, 0x89, 0x4c, 0x68, 0x4c, 0x69, 0x54, 0x89, 0x4c, 0x89, 0x4c, 0x89, 0x4c, 0x89, 0x44, 0x88, 0x3c, 0x88, 0x44, 0x88, 0x6d, 0x0d, 0x95, 0xd3, 0xae, 0x36, 0xae, 0x16, 0xae, 0x16, 0xc6, 0x78, 0xc6, 0x99, 0xb6, 0x7a, 0x75, 0x33, 0xae, 0x59, 0xd7, 0x1d, 0xdf, 0x5e, 0xdf, 0x3e, 0xd7, 0x3e, 0xd7, 0x1e, 0xbe, 0x38, 0xbd, 0xf7, 0xbe, 0x17, 0xc6, 0x37, 0x95, 0x54, 0x02, 0xaa, 0x04, 0x0e, 0x0e, 0x13, 0x34, 0x28, 0x4a, 0x60, 0x7b, 0x00, 0x5b, 0x03, 0x2b, 0x06, 0x6a, 0x66, 0x71, 0xc4, 0x02, 0x60, 0x03, 0x22, 0x03, 0xe2, 0x15, 0x65, 0x00, 0x00, 0x87, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x41, 0x02, 0x20, 0x69, 0x80, 0xd1, 0x69, 0xf9, 0x49, 0xe0, 0x02, 0xc8, 0x08, 0xea, 0x05, 0xfc, 0xc0, 0xf5, 0x40, 0xdc, 0x00, 0xf1, 0x01, 0xf8, 0x00, 0xf0, 0x00, 0xc8, 0x80, 0xd0, 0xa0, 0xd1, 0x60, 0xd2, 0x00, 0xe1, 0x8a, 0xf9, 0xab, 0xf9, 0xe0, 0xf9, 0xe0, 0xaa, 0xc0, 0x44, 0x2b, 0xb7, 0x1c, 0xcf, 0xbf, 0xcf, 0x9f, 0xcf, 0xbf, 0xc7, 0x5e, 0xdb, 0xcd, 0xb8, 0x0c, 0x60, 0x19, 0x50, 0x33, 0x20, 0xb2, 0x22, 0x1f, 0x74, 0xb4, 0x4c, 0x87, 0x4c, 0x69, 0x54, 0x8a, 0x54, 0x89, 0x54, 0x89, 0x54, 0x8a, 0x4c, 0x8a, 0x4c, 0x89, 0x4c, 0x69, 0x5c, 0xcb, 0x7d, 0x4f, 0xa5, 0xf4, 0xae, 0x16, 0xa5, 0xd5, 0xb6, 0x16, 0xc6, 0x78, 0xbe, 0x37, 0x8c, 0xf2, 0xae, 0x7b, 0xcf, 0x7f, 0x96, 0x39, 0x3c, 0x4e, 0x6c, 0xf1, 0x95, 0xb6, 0xbe, 0xbb, 0xcf, 0x3d, 0xce, 0xdb, 0xbd, 0xd6, 0xbe, 0x17, 0xc6, 0x37, 0xbe, 0x17, 0x5c, 0x2e, 0x4c, 0x8d, 0x3e, 0xbd, 0x05, 0xfc, 0x02, 0xa6, 0x03, 0x20, 0x3b, 0x60, 0x43, 0x00, 0x22, 0xa0, 0x02, 0xc0, 0x03, 0x61, 0x04, 0x23, 0x15, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x01, 0xa0, 0x01, 0x60, 0x01, 0x00, 0x30, 0xa0, 0xc8, 0xc0, 0xf1, 0xa4, 0xf1, 0xc0, 0xf5, 0x84, 0xff, 0xc8, 0xff, 0x60, 0xfd, 0xe0, 0xda, 0x80, 0xf2, 0x00, 0xe8, 0x80, 0xa8, 0x00, 0xc8, 0xa0, 0xe9, 0xc0, 0xf2, 0x00, 0xf9, 0xc0, 0xf9, 0x80, 0xf1, 0x41, 0xc9, 0xe3, 0x6b, 0xa8, 0x35, 0x94, 0xbf, 0x3d, 0xd7, 0xbf, 0xcf, 0x9f, 0xb6, 0xfb, 0x85, 0xb4, 0xa3, 0xcb, 0xd8, 0xe5, 0xa8, 0x13, 0x48, 0x0f, 0x19, 0x3a, 0x00, 0xd5, 0x6c, 0x31, 0x5c, 0xab, 0x4c, 0x69, 0x54, 0x89, 0x54, 0x8a, 0x4c, 0x8a, 0x44, 0x69, 0x4c, 0x8a, 0x64, 0xec, 0x7d, 0x2f, 0x8d, 0x51, 0x95, 0x52, 0xa5, 0x95, 0xb6, 0x37, 0xc6, 0x58, 0xa5, 0xb5, 0x84, 0xd1, 0x5b, 0xed, 0x95, 0xb7, 0xcf, 0x9f, 0xcf, 0x9f, 0xcf, 0x9f, 0x96, 0x59, 0x04, 0x2a, 0x03, 0x64, 0x04, 0x4b, 0x55, 0x94, 0x77, 0x7d, 0x9e, 0xdb, 0xbe, 0x37, 0xc5, 0xd4, 0xa4, 0xee, 0x33, 0x24, 0x5c, 0x6b, 0x6e, 0xd6, 0x3e, 0x53, 0x03, 0x00, 0x12, 0xe0, 0x12, 0xa0, 0x02, 0xc1, 0x03, 0x82, 0x0c, 0x64, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x01, 0x20, 0x01, 0x00, 0x00, 0x60, 0x59, 0x40, 0x91, 0xc0, 0xa9, 0xa2, 0xe2, 0xe0, 0xfd, 0x80, 0xff, 0xc9, 0xfe, 0x89, 0xeb, 0xa0, 0xaa, 0x20, 0xb3, 0xa0, 0xe5, 0xa0, 0xdc, 0x40, 0xea, 0x60, 0xfa, 0x20, 0xf1, 0x83, 0xf8, 0xe4, 0xf9, 0x02, 0xd9, 0x66, 0xa1, 0xe5, 0x5b, 0x6e, 0x2f, 0x1d, 0xc7, 0xbf, 0xc7, 0x5d, 0x9e, 0x15, 0x74, 0xef, 0x5c, 0xcf, 0xa4, 0xcd, 0xe4, 0x02, 0xdb, 0x09, 0x72, 0x4c, 0x4a, 0x75, 0x58, 0x07, 0xb3, 0x4f, 0x74, 0xce, 0x44, 0x69, 0x4c, 0x6a, 0x4c, 0x69, 0x5c, 0xcb, 0x74, 0xed, 0x85, 0x2f, 0x8d, 0x0f, 0x8d, 0x11, 0xa5, 0x94, 0xbe, 0x57, 0xce, 0x75, 0xbd, 0xd0, 0x7c, 0x8e, 0x6c, 0x4c, 0x53, 0xca, 0x7c, 0xf2, 0xcf, 0x5f, 0xd7, 0x9f, 0xcf, 0x9f, 0xcf, 0x7f, 0xcf, 0x9f, 0x9e, 0x9a, 0x1c, 0x6c, 0x04, 0x2a, 0x05, 0xf6, 0x07, 0xbf, 0x27, 0x9d, 0x5e, 0x99, 0x6c, 0x65, 0x6b, 0xe0, 0x13, 0x44, 0x05, 0x14, 0x06, 0x18, 0x23, 0xa3, 0x0a, 0x80, 0x02, 0xe1, 0x03, 0x82, 0x0c, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x5a, 0x60, 0xa3, 0xc0, 0x8a, 0xa0, 0x99, 0xa0, 0xb2, 0x20, 0xa9, 0xe0, 0xc4, 0x20, 0xf6, 0xe4, 0xfd, 0xe5, 0xf5, 0x26, 0xdd, 0x82, 0xdd, 0xe0, 0xee, 0x60, 0xfd, 0x16, 0xfb, 0x5a, 0xe9, 0xf1, 0x90, 0x29, 0x98, 0x30, 0xa8, 0x95, 0x90, 0xd6, 0x71, 0x14, 0x62, 0x4c, 0x65, 0x53, 0x8e, 0x9a, 0x5d, 0x76, 0x4d, 0x14, 0x5d, 0x14, 0x4c, 0xf4, 0x8d, 0x13, 0xcc, 0x83, 0xbb, 0x80, 0xb2, 0xc0, 0xca, 0x07, 0xd8, 0x01, 0xea, 0x29, 0x84, 0x6e, 0x34, 0x69, 0x6c, 0xcc, 0x95, 0x4f, 0x95, 0x50, 0x8c, 0xcf, 0x8c, 0xf0, 0xad, 0xb4, 0xbe, 0x15, 0xd6, 0x93, 0xef, 0x2e, 0xff, 0x67, 0xff, 0x03, 0xbd, 0xa8, 0x53, 0xc6, 0x64, 0x6e, 0xcf, 0x3e, 0xd7, 0xbf, 0xd7, 0x9f, 0xd7, 0x9f, 0xcf, 0x9f, 0xcf, 0x9f, 0xcf, 0x9f, 0xae, 0xdc, 0x45, 0x10, 0x44, 0xcc, 0x6d, 0x0a, 0x4d, 0x6e, 0x06, 0x17, 0x06, 0x17, 0x2d, 0xf4, 0x04, 0x26, 0x03, 0xcb, 0x03, 0x07, 0x02, 0xc0, 0x03, 0x82, 0x0c, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xe0, 0x63, 0x20, 0xac, 0x60, 0xd4, 0xc0, 0xe3, 0xe0, 0xb2, 0x80, 0xa2, 0xa0, 0xc3, 0x60, 0xd3, 0xa0, 0xdc, 0x63, 0xfe, 0xea, 0xf5, 0xe2, 0xc3, 0x80, 0xdb, 0xad, 0xfb, 0xde, 0xfc, 0x5f, 0xfc, 0x5f, 0xeb, 0x5b, 0xaa, 0x34, 0x69, 0xb3, 0x29, 0xb1, 0x3a, 0x8e, 0x53, 0xa6, 0x65, 0x00, 0x34, 0xec, 0x04, 0x76, 0x05, 0x3a, 0x05, 0x3b, 0x04, 0xfb, 0x34, 0x9a, 0xa3, 0x27, 0xab, 0x44, 0xea, 0x52, 0xfa, 0x06, 0xe2, 0x60, 0xba, 0x62, 0xa4, 0xee, 0xa5, 0x90, 0xa5, 0x50, 0x94, 0xf0, 0x9d, 0x52, 0xb5, 0xf6, 0xad, 0xd4, 0x8c, 0xcf, 0x63, 0xc7, 0x84, 0x64, 0x9d, 0x26, 0xbd, 0xc6, 0xc5, 0xe4, 0xc5, 0xc1, 0x84, 0x83, 0x9d, 0xb5, 0xcf, 0x3d, 0xcf, 0x3d, 0xcf, 0x7e, 0xd7, 0x9f, 0xd7, 0x9f, 0xd7, 0xbf, 0xcf, 0x7f, 0xbe, 0xba, 0x74, 0xef, 0x65, 0x90, 0x55, 0xb1, 0x14, 0x4a, 0x04, 0xc9, 0x3e, 0xf6, 0x1c, 0xef, 0x02, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xc0, 0x6b, 0x80, 0x32, 0x40, 0x52, 0x80, 0xa3, 0x80, 0xd3, 0xa0, 0xec, 0x00, 0xfc, 0xe0, 0xec, 0x00, 0x81, 0xa0, 0x82, 0xe0, 0xd4, 0xe0, 0xe4, 0x04, 0xf3, 0xf9, 0xfc, 0x3f, 0xfc, 0x7e, 0xf3, 0xdb, 0xd3, 0x56, 0xa3, 0x2c, 0x5a, 0x60, 0x32, 0x20, 0x53, 0x40, 0x4b, 0x81, 0x55, 0x24, 0x4d, 0x88, 0x03, 0x2b, 0x03, 0x8f, 0x04, 0xb7, 0x04, 0xfc, 0x04, 0x9c, 0xab, 0x2e, 0xcb, 0xa9, 0xf4, 0xb9, 0xe4, 0x6d, 0x9a, 0x60, 0x6b, 0x05, 0xa5, 0x31, 0x9d, 0x11, 0x9d, 0x53, 0xb5, 0xd5, 0xad, 0x93, 0x84, 0x4d, 0x63, 0xa9, 0x63, 0xc9, 0x5b, 0xa8, 0x5b, 0xc7, 0x53, 0xa5, 0x64, 0x06, 0x4b, 0xca, 0x4c, 0x2e, 0x5b, 0xeb, 0x3a, 0x83, 0x4b, 0x45, 0x64, 0x29, 0x74, 0xab, 0x7d, 0x0e, 0x85, 0xd4, 0xa6, 0x36, 0x8c, 0xf1, 0x7b, 0xc5, 0x5c, 0x89, 0x6d, 0x2e, 0x05, 0x1b, 0x1d, 0x0f, 0x4d, 0xc0, 0x5d, 0x40, 0x23, 0x80, 0x03, 0xc3, 0x05, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xe0, 0xce, 0x20, 0x83, 0x80, 0x31, 0xc0, 0x21, 0x80, 0x5a, 0x20, 0xab, 0x20, 0xe3, 0x80, 0xca, 0x80, 0x81, 0xa0, 0x41, 0x20, 0x21, 0x60, 0x82, 0x84, 0xcb, 0xd5, 0xf3, 0x17, 0xf1, 0x92, 0xd0, 0x83, 0xa2, 0x01, 0x82, 0xe8, 0x71, 0xa3, 0x52, 0xe0, 0x5b, 0xc0, 0x54, 0x00, 0x3d, 0x22, 0x3c, 0xc6, 0x03, 0x2e, 0x02, 0xeb, 0x02, 0xea, 0x03, 0xb3, 0x65, 0x7c, 0xad, 0x57, 0x9b, 0xee, 0xbc, 0x6b, 0xb3, 0xa2, 0x8b, 0x89, 0x9c, 0xf1, 0xa5, 0x73, 0xad, 0x73, 0xa4, 0xef, 0x7b, 0xca, 0x63, 0xa8, 0x6b, 0xe9, 0x63, 0xc9, 0x63, 0xe9, 0x63, 0xc9, 0x64, 0x0b, 0x5c, 0x0d, 0x54, 0x30, 0x4c, 0x31, 0xad, 0xb6, 0xc5, 0x91, 0x5b, 0x00, 0x01, 0xc0, 0x32, 0x00, 0x3b, 0x68, 0x35, 0x56, 0x06, 0x3a, 0x6c, 0xaf, 0x7b, 0xb3, 0x4b, 0x29, 0x45, 0x4e, 0x34, 0x09, 0x03, 0x27, 0x13, 0xa0, 0x2c, 0x41, 0x04, 0x02, 0x05, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x64, 0xc0, 0xad, 0xe0, 0x9c, 0x80, 0x4a, 0x60, 0x42, 0x00, 0x39, 0xe0, 0x4a, 0xe0, 0x5a, 0x20, 0x79, 0xc0, 0x71, 0xe0, 0x69, 0xe0, 0x5a, 0x00, 0x12, 0x40, 0x02, 0x00, 0x8a, 0x45, 0xd9, 0xeb, 0xe9, 0x80, 0xca, 0x49, 0x92, 0xaf, 0x88, 0x6a, 0x73, 0x00, 0x6b, 0xc0, 0x64, 0x47, 0x23, 0xe7, 0x02, 0xe0, 0x03, 0x2d, 0x03, 0x2f, 0x02, 0xaf, 0x6c, 0x72, 0xdf, 0x7e, 0xd6, 0xdb, 0x59, 0xe3, 0x52, 0xc4, 0x83, 0x45, 0x93, 0xab, 0xa4, 0xd1, 0x84, 0x0c, 0x83, 0xc9, 0x9c, 0x8d, 0x94, 0x8f, 0x6b, 0xcb, 0x63, 0xea, 0x6b, 0xec, 0x6b, 0xee, 0x63, 0xd0, 0x5b, 0xd1, 0x5b, 0xf1, 0x4b, 0xd0, 0x95, 0x13, 0xef, 0x1b, 0xf7, 0x1b, 0xd6, 0x33, 0x83, 0xe2, 0x5b, 0xc0, 0x4c, 0xd1, 0x34, 0x93, 0x53, 0x8b, 0x9d, 0x0f, 0x7c, 0x52, 0x4b, 0x85, 0x03, 0x05, 0x02, 0xa0, 0x03, 0x40, 0x03, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xa0, 0x64, 0xa0, 0x74, 0xe0, 0x5b, 0x80, 0x4a, 0x80, 0x42, 0x00, 0x39, 0xe0, 0x8d, 0x00, 0xc6, 0x60, 0x94, 0xe0, 0x5b, 0x00, 0x52, 0x00, 0x52, 0x80, 0x54, 0x80, 0x6e, 0x21, 0x1c, 0xc0, 0x3b, 0x60, 0x9a, 0xc0, 0xc1, 0xca, 0x48, 0x11, 0x22, 0x1a, 0x62, 0x51, 0x6b, 0x00, 0x4d, 0xf7, 0x06, 0x5c, 0x03, 0x8c, 0x0a, 0xca, 0x02, 0xf1, 0x6c, 0x77, 0xdf, 0x5e, 0xf7, 0xff, 0xef, 0x7e, 0x83, 0xac, 0x33, 0x48, 0x23, 0xa7, 0x04, 0xd3, 0x4d, 0x56, 0x6b, 0x0a, 0x73, 0x69, 0x7b, 0xec, 0x94, 0x6f, 0x73, 0xce, 0x63, 0xd0, 0x63, 0xd1, 0x6b, 0xf2, 0x6b, 0xf2, 0x5b, 0xd1, 0x53, 0xb0, 0x74, 0x51, 0xee, 0xba, 0xf7, 0x1b, 0xee, 0xd9, 0xcd, 0xf1, 0xa5, 0x04, 0xa5, 0x44, 0x75, 0x0a, 0x53, 0x86, 0x5b, 0x80, 0x74, 0x02, 0x32, 0xe0, 0x03, 0x02, 0x0b, 0xe4, 0x0c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x60, 0x6d, 0x00, 0x5c, 0x40, 0x3b, 0x00, 0x42, 0xe0, 0x4a, 0xc0, 0x3a, 0x00, 0x3a, 0xc0, 0xc6, 0x80, 0xef, 0xa0, 0xe7, 0x20, 0xbe, 0x20, 0x94, 0xe0, 0x74, 0x80, 0x4d, 0x01, 0x3e, 0x23, 0x15, 0xc1, 0x04, 0x60, 0x3b, 0x60, 0x4b, 0x50, 0x1b, 0x1f, 0x50, 0xbb, 0x63, 0xab, 0x1f, 0x5e, 0x07, 0xdf, 0x07, 0x3e, 0x04, 0xf4, 0x6c, 0xb8, 0xe7, 0x7f, 0xf7, 0xff, 0xf7, 0xdf, 0xf7, 0xdf, 0xa4, 0x91, 0x00, 0x00, 0x21, 0xe7, 0x5d, 0x79, 0x95, 0xb9, 0xb8, 0x91, 0x69, 0x52, 0x79, 0xea, 0x8a, 0x47, 0x92, 0x69, 0x9a, 0x8b, 0x9a, 0xed, 0x93, 0x6f, 0x6b, 0xb0, 0x5b, 0xd0, 0x5b, 0xcf, 0xd6, 0x16, 0xee, 0x97, 0xe5, 0xf1, 0xac, 0x86, 0x63, 0xe2, 0xa5, 0xaa, 0xb5, 0xe7, 0x8d, 0x46, 0x4c, 0x83, 0x2c, 0x23, 0x02, 0x40, 0x03, 0x83, 0x1d, 0x68, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x60, 0x5c, 0x80, 0x3b, 0x80, 0x33, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x2a, 0x60, 0x53, 0xc0, 0xd7, 0x20, 0xf7, 0xc0, 0xf7, 0xc0, 0xef, 0xa0, 0xbe, 0x60, 0x74, 0x60, 0x0a, 0x60, 0x03, 0xe0, 0x05, 0x62, 0x05, 0xc4, 0x14, 0xe1, 0x2b, 0xab, 0x39, 0xd7, 0x45, 0x9a, 0x07, 0xff, 0x07, 0xff, 0x07, 0xdf, 0x06, 0x5f, 0x9d, 0x18, 0xef, 0x5d, 0xf7, 0xff, 0xf7, 0xdf, 0xf7, 0xff, 0xce, 0x17, 0x00, 0x00, 0xa8, 0x07, 0xe8, 0x09, 0xd9, 0x85, 0xfa, 0xa4, 0xea, 0x4a, 0xa8, 0x84, 0x80, 0x00, 0x90, 0x00, 0xa8, 0x00, 0xc8, 0x00, 0xa0, 0x20, 0x58, 0xc3, 0x61, 0x86, 0xa3, 0xc9, 0xe5, 0x6b, 0x7a, 0xe4, 0xb4, 0x60, 0x7b, 0x40, 0x7c, 0x83, 0xa5, 0x64, 0x64, 0x02, 0x23, 0x40, 0x03, 0x80, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x60, 0x6d, 0x20, 0x5c, 0x80, 0x54, 0x20, 0x5c, 0x40, 0x64, 0x80, 0x64, 0x80, 0x64, 0x80, 0x4b, 0xc0, 0x85, 0x40, 0xe7, 0x80, 0xef, 0xc0, 0xdf, 0x60, 0xd7, 0x20, 0xcf, 0x00, 0xb6, 0x20, 0x74, 0x40, 0x2a, 0xe0, 0x04, 0xa3, 0x16, 0x05, 0x0d, 0xa0, 0x14, 0x20, 0x1c, 0x90, 0x1e, 0xdb, 0x0e, 0xbf, 0x05, 0xbf, 0x04, 0x5f, 0x31, 0x17, 0x8a, 0x49, 0xdd, 0x97, 0xf7, 0x9e, 0xff, 0xff, 0xe7, 0x1c, 0x91, 0x84, 0xf8, 0x06, 0xc0, 0x09, 0x61, 0x48, 0xf3, 0x06, 0xfb, 0x00, 0xfa, 0xc0, 0xc1, 0xc0, 0x98, 0x00, 0xa8, 0x00, 0xc0, 0x00, 0x98, 0x80, 0x81, 0x80, 0xba, 0x00, 0xcc, 0x68, 0xbc, 0xa0, 0x93, 0xe0, 0xbd, 0x00, 0x4b, 0x81, 0x5b, 0xc1, 0x22, 0xc0, 0x02, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x60, 0x85, 0xe0, 0x7d, 0xa0, 0x7d, 0x80, 0x75, 0x60, 0x75, 0x40, 0x75, 0x40, 0x75, 0x40, 0x75, 0x40, 0x75, 0x20, 0xa6, 0x20, 0xa6, 0x40, 0x9d, 0xc0, 0x95, 0xa0, 0x9d, 0xc0, 0xa5, 0xe0, 0x9d, 0xa0, 0x6c, 0x40, 0x02, 0x20, 0x02, 0xc0, 0x0c, 0x82, 0x0d, 0x62, 0x04, 0x00, 0x12, 0x80, 0x22, 0x93, 0x0c, 0xfd, 0x04, 0xff, 0x29, 0xfd, 0x78, 0x0c, 0xc8, 0x09, 0xc2, 0xee, 0xee, 0x18, 0xf7, 0x5e, 0xf3, 0x8f, 0xc8, 0x07, 0x38, 0x06, 0x39, 0x07, 0xc9, 0xeb, 0xe2, 0x40, 0xfb, 0x00, 0xfb, 0x20, 0xda, 0x40, 0xb0, 0x60, 0xb1, 0x00, 0x99, 0xc0, 0x79, 0x40, 0x9a, 0xc7, 0xdc, 0xe9, 0xd5, 0x40, 0xa4, 0xa1, 0x63, 0x60, 0x02, 0xa0, 0x02, 0xa0, 0x02, 0xe0, 0x04, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x60, 0x4c, 0x80, 0x4c, 0x80, 0x54, 0x80, 0x54, 0xa0, 0x54, 0x80, 0x54, 0xa0, 0x5c, 0xc0, 0x64, 0xe0, 0x6d, 0x00, 0x75, 0x60, 0x65, 0x20, 0x34, 0x20, 0x02, 0xe0, 0x02, 0x20, 0x02, 0x00, 0x02, 0x20, 0x12, 0x40, 0x02, 0x20, 0x02, 0x00, 0x02, 0x00, 0x02, 0xa0, 0x03, 0x80, 0x03, 0x40, 0x02, 0xa0, 0x02, 0xca, 0x23, 0x76, 0x5b, 0x1c, 0x5a, 0x1b, 0xa8, 0x90, 0xd8, 0x01, 0xf1, 0x40, 0xfb, 0xce, 0xe3, 0x50, 0x60, 0x13, 0x60, 0x0b, 0x48, 0x6a, 0x90, 0xf4, 0x90, 0x00, 0x98, 0xc0, 0xc1, 0xc0, 0xe2, 0x80, 0xe2, 0x80, 0xa2, 0x00, 0x60, 0xe0, 0xb9, 0x83, 0xcc, 0x8a, 0xac, 0x24, 0x6b, 0x20, 0x1a, 0x80, 0x02, 0xe2, 0x03, 0x82, 0x04, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x60, 0x0b, 0x60, 0x0b, 0x20, 0x13, 0x20, 0x23, 0x40, 0x2b, 0x80, 0x33, 0xc0, 0x3c, 0x00, 0x3c, 0x00, 0x54, 0xc0, 0x6d, 0x40, 0x6d, 0x60, 0x65, 0x20, 0x4c, 0xc0, 0x3c, 0x00, 0x12, 0xe0, 0x02, 0x20, 0x01, 0xe0, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x3a, 0xa3, 0x42, 0xc3, 0x02, 0x20, 0x03, 0x20, 0x03, 0x20, 0x0a, 0x60, 0x2a, 0x2c, 0x02, 0xf9, 0x99, 0xd1, 0xf8, 0xc0, 0xfa, 0xc0, 0xfd, 0x73, 0xec, 0xb2, 0x90, 0x19, 0x50, 0x1d, 0x82, 0x59, 0xc2, 0x79, 0xa8, 0x00, 0xa0, 0xc0, 0x88, 0xe0, 0xaa, 0xa0, 0xf4, 0x00, 0xd2, 0xe0, 0xa1, 0xc0, 0xc2, 0x43, 0x73, 0x07, 0x02, 0x00, 0x02, 0xa1, 0x03, 0x42, 0x2d, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x60, 0x0b, 0x00, 0x02, 0xc0, 0x02, 0xa0, 0x02, 0xa0, 0x0a, 0xc0, 0x1b, 0x00, 0x1b, 0x20, 0x2b, 0xa0, 0x4c, 0x60, 0x54, 0xa0, 0x5c, 0xc0, 0x5d, 0x00, 0x55, 0x00, 0x4c, 0xe0, 0x44, 0xc0, 0x34, 0x20, 0x13, 0x20, 0x02, 0x40, 0x02, 0x00, 0x01, 0xa0, 0x84, 0x48, 0xc5, 0xed, 0xa5, 0x2b, 0x6b, 0xa6, 0x0a, 0xc0, 0x03, 0x00, 0x02, 0x40, 0x01, 0xa0, 0x41, 0x65, 0xc9, 0xc4, 0xfd, 0x36, 0xfe, 0x7e, 0xfd, 0xda, 0xe1, 0xec, 0xa8, 0x3a, 0xa2, 0xde, 0xd2, 0x37, 0xe1, 0x00, 0x99, 0x60, 0x61, 0xa0, 0xd3, 0xe0, 0xec, 0x60, 0xaa, 0xe0, 0x59, 0xa0, 0x02, 0x21, 0x02, 0xe1, 0x0c, 0x65, 0x36, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x02, 0xa0, 0x02, 0x80, 0x02, 0xa0, 0x0a, 0xa0, 0x0a, 0xa0, 0x0a, 0xa0, 0x0a, 0xa0, 0x2b, 0x60, 0x33, 0xc0, 0x33, 0xc0, 0x33, 0xc0, 0x2b, 0x80, 0x2b, 0x60, 0x2b, 0xa0, 0x34, 0x00, 0x2c, 0x20, 0x23, 0xc0, 0x1b, 0x40, 0x0a, 0x40, 0x01, 0x80, 0x94, 0xc9, 0xce, 0x6e, 0xd6, 0xb0, 0xce, 0x6e, 0x7c, 0xa6, 0x02, 0xa0, 0x02, 0xa0, 0x02, 0x80, 0x01, 0xe0, 0x01, 0x20, 0x93, 0x71, 0xe5, 0x7b, 0xfe, 0x3f, 0xfc, 0x14, 0xe1, 0x4f, 0xc1, 0xd4, 0xa9, 0x4c, 0xb2, 0x00, 0xa1, 0xc0, 0xa2, 0xe0, 0x93, 0x20, 0x4a, 0x00, 0x02, 0x21, 0x03, 0x84, 0x04, 0xa6, 0x47, 0xf0, 0x5f, 0xf5, 0x47, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x02, 0xc0, 0x02, 0xa0, 0x02, 0x60, 0x02, 0x60, 0x02, 0x60, 0x02, 0x60, 0x12, 0xc0, 0x23, 0x20, 0x23, 0x21, 0x23, 0x01, 0x22, 0xe1, 0x1a, 0xa0, 0x1a, 0x60, 0x12, 0x40, 0x0a, 0x20, 0x0a, 0x02, 0x09, 0xc3, 0x11, 0xa4, 0x21, 0x87, 0x31, 0x49, 0x39, 0xe8, 0x3a, 0x63, 0x42, 0xc4, 0x5b, 0x65, 0x4b, 0x83, 0x23, 0x40, 0x33, 0x80, 0x2b, 0x20, 0x0a, 0x80, 0x02, 0x00, 0x00, 0xc0, 0x21, 0x04, 0xa3, 0xf4, 0xec, 0x76, 0xf0, 0x80, 0xe0, 0x84, 0xb2, 0x40, 0x8a, 0xc0, 0x7a, 0x00, 0x41, 0xe0, 0x02, 0x41, 0x03, 0x43, 0x1c, 0xc6, 0x3f, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x02, 0x00, 0x02, 0x00, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x02, 0x00, 0x12, 0xa0, 0x1a, 0xa1, 0x1a, 0xa2, 0x12, 0x82, 0x12, 0x63, 0x12, 0x65, 0x0a, 0x46, 0x0a, 0x68, 0x02, 0x49, 0x02, 0x08, 0x09, 0xa8, 0x11, 0x47, 0x18, 0xe8, 0x30, 0xca, 0x28, 0xc9, 0x01, 0x03, 0x01, 0x00, 0x00, 0xa0, 0x00, 0xa0, 0x01, 0x00, 0x21, 0xe0, 0x2a, 0x60, 0x01, 0x80, 0x01, 0xc0, 0x42, 0x40, 0x69, 0x40, 0x00, 0x00, 0x48, 0xe2, 0xb8, 0xe2, 0xd1, 0x49, 0x82, 0x04, 0x21, 0xe0, 0x02, 0x20, 0x03, 0x43, 0x1d, 0x28, 0x00, 0x00, 0x87, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x01, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xe0, 0x01, 0xe0, 0x02, 0x00, 0x0a, 0x21, 0x02, 0x43, 0x02, 0x86, 0x02, 0xc9, 0x03, 0x2c, 0x03, 0x2d, 0x03, 0x0e, 0x02, 0xcc, 0x02, 0x6b, 0x09, 0xe8, 0x09, 0x46, 0x18, 0xe7, 0x18, 0xe8, 0x09, 0x05, 0x01, 0x21, 0x01, 0x21, 0x01, 0x40, 0x01, 0x20, 0x01, 0x20, 0x00, 0xc0, 0x00, 0x80, 0x00, 0xa0, 0x00, 0x80, 0x38, 0xa0, 0x89, 0x20, 0x48, 0xc0, 0x00, 0x60, 0x01, 0x00, 0x01, 0xa0, 0x02, 0x41, 0x03, 0x02, 0x05, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x01, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x02, 0x01, 0x02, 0x44, 0x02, 0xa7, 0x02, 0xea, 0x02, 0xeb, 0x02, 0xeb, 0x02, 0x8a, 0x02, 0x28, 0x01, 0xa5, 0x09, 0x25, 0x10, 0xe6, 0x10, 0xe6, 0x01, 0x02, 0x01, 0x00, 0x01, 0x20, 0x01, 0x20, 0x01, 0x40, 0x01, 0x40, 0x01, 0x60, 0x01, 0x60, 0x01, 0x60, 0x09, 0x60, 0x01, 0x60, 0x01, 0x60, 0x01, 0xc1, 0x02, 0x21, 0x02, 0xc2, 0x03, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x01, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x02, 0x00, 0x02, 0x22, 0x02, 0x43, 0x02, 0x45, 0x02, 0x45, 0x02, 0x24, 0x01, 0xe3, 0x02, 0x03, 0x02, 0x03, 0x02, 0x23, 0x02, 0x42, 0x02, 0x61, 0x02, 0x61, 0x02, 0xa2, 0x02, 0x41, 0x02, 0xa1, 0x03, 0x02, 0x03, 0x02, 0x0a, 0xe2, 0x03, 0x02, 0x03, 0x22, 0x03, 0x42, 0x03, 0xa3, 0x05, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0x01, 0xc0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x02, 0x20, 0x02, 0x41, 0x02, 0x61, 0x02, 0x81, 0x02, 0xc1, 0x02, 0xe2, 0x03, 0x02, 0x03, 0x22, 0x03, 0x42, 0x03, 0x63, 0x03, 0x63, 0x03, 0x23, 0x03, 0x64, 0x03, 0xa4, 0x03, 0xe4, 0x04, 0x44, 0x04, 0x64, 0x04, 0x66, 0x04, 0xa5, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x43, 0x03, 0x63, 0x03, 0xa3, 0x03, 0xc4, 0x03, 0xe4, 0x03, 0xe4, 0x04, 0x04, 0x04, 0x45, 0x04, 0x85, 0x0c, 0xc6, 0x05, 0x07, 0x06, 0x08, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x07, 0xed, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x69, 0x00, 0xff, 0x00, 0x70, 0x00, 0xff, 0x62, 0xce, 0x25, 0xff, 0x5c, 0xcb, 0x00, 0xff, 0x66, 0xcf, 0x00, 0xff, 0x60, 0xc8, 0x1e, 0xff, 0x65, 0xce, 0x00, 0xff, 0x66, 0xe0, 0x19, 0xff, 0x62, 0xeb, 0x3b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x00, 0xff, 0x57, 0xbd, 0x33, 0xff, 0x3c, 0x95, 0x54, 0xff, 0x41, 0x7e, 0x63, 0xff, 0x34, 0x63, 0x3d, 0xff, 0x5b, 0x92, 0x47, 0xff, 0x8c, 0xc7, 0x7e, 0xff, 0x42, 0x93, 0x5e, 0xff, 0x1b, 0x64, 0x43, 0xff, 0x37, 0x72, 0x83, 0xff, 0x5b, 0xa7, 0x3e, 0xff, 0x4b, 0xbb, 0x22, 0xff, 0x00, 0xd6, 0x00, 0xff, 0x00, 0xd1, 0x00, 0xff, 0x55, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x40, 0xbf, 0x00, 0xff, 0x43, 0x98, 0x55, 0xff, 0x4b, 0x7e, 0x5f, 0xff, 0x2c, 0x66, 0x46, 0xff, 0x48, 0x87, 0x50, 0xff, 0x76, 0xa0, 0x87, 0xff, 0x88, 0xae, 0x9d, 0xff, 0x6e, 0x9a, 0x87, 0xff, 0x83, 0x9f, 0x8b, 0xff, 0xcb, 0xd3, 0xc3, 0xff, 0x98, 0xa1, 0xdf, 0xff, 0x00, 0x00, 0xa7, 0xff, 0x00, 0x00, 0xc3, 0xff, 0xa5, 0x00, 0x65, 0xff, 0xc6, 0x44, 0x00, 0xff, 0xb1, 0x88, 0x57, 0xff, 0x90, 0xc4, 0x7d, 0xff, 0x5d, 0xcd, 0x36, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x76, 0x00, 0xff, 0x28, 0x71, 0x31, 0xff, 0x1f, 0x5f, 0x25, 0xff, 0x4b, 0x9f, 0x13, 0xff, 0x61, 0xab, 0x57, 0xff, 0x72, 0xa5, 0x86, 0xff, 0x65, 0x9b, 0x7c, 0xff, 0x7c, 0x9a, 0x68, 0xff, 0x98, 0xa2, 0x83, 0xff, 0xd5, 0xd9, 0xc5, 0xff, 0x93, 0xb4, 0xa4, 0xff, 0x0c, 0x83, 0x7c, 0xff, 0x7c, 0x8c, 0x80, 0xff, 0xc1, 0xbb, 0xac, 0xff, 0xbb, 0xac, 0xc5, 0xff, 0xc7, 0x4f, 0xd6, 0xff, 0x9a, 0x45, 0xc9, 0xff, 0xe1, 0x96, 0xac, 0xff, 0xff, 0xc6, 0xbb, 0xff, 0xee, 0xde, 0xda, 0xff, 0xbb, 0xbc, 0xad, 0xff, 0x3d, 0x81, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x84, 0x35, 0xff, 0x49, 0x91, 0x6f, 0xff, 0x62, 0x95, 0x7a, 0xff, 0x49, 0x7e, 0x5a, 0xff, 0x53, 0x7c, 0x55, 0xff, 0x9f, 0xab, 0x8c, 0xff, 0xb5, 0xc2, 0x9c, 0xff, 0x99, 0x9c, 0x03, 0xff, 0xcc, 0xc3, 0x00, 0xff, 0x99, 0xb1, 0x78, 0xff, 0xc6, 0xcb, 0xbe, 0xff, 0xab, 0xb2, 0xa1, 0xff, 0xb7, 0xa3, 0x85, 0xff, 0xe1, 0xc9, 0xb1, 0xff, 0xd9, 0xd1, 0xc2, 0xff, 0xa2, 0xa5, 0xa2, 0xff, 0xe4, 0xbe, 0xca, 0xff, 0xf0, 0xe2, 0xde, 0xff, 0xd5, 0xda, 0xcd, 0xff, 0xa8, 0xba, 0xa7, 0xff, 0x7f, 0x8e, 0x62, 0xff, 0x67, 0x50, 0x07, 0xff, 0x00, 0x3d, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x8b, 0x43, 0xff, 0x28, 0x6d, 0x47, 0xff, 0x2b, 0x61, 0x3f, 0xff, 0x41, 0x8f, 0x2f, 0xff, 0x6b, 0x9b, 0x3b, 0xff, 0xb0, 0xbc, 0x5d, 0xff, 0x77, 0x90, 0x42, 0xff, 0x75, 0x9d, 0x42, 0xff, 0x86, 0xa5, 0x7c, 0xff, 0xcd, 0xce, 0xc2, 0xff, 0xc9, 0xc8, 0xaf, 0xff, 0xa4, 0x9b, 0x1d, 0xff, 0xa9, 0xa6, 0x2f, 0xff, 0x8f, 0x9c, 0x5e, 0xff, 0x97, 0xa3, 0x91, 0xff, 0xac, 0xb4, 0xac, 0xff, 0xe2, 0xe4, 0xdc, 0xff, 0xc2, 0xca, 0xbb, 0xff, 0x7c, 0x84, 0x64, 0xff, 0x61, 0x75, 0x5c, 0xff, 0x82, 0x99, 0x7e, 0xff, 0x7d, 0x88, 0x61, 0xff, 0x37, 0x54, 0x00, 0xff, 0x43, 0x6c, 0x00, 0xff, 0x6c, 0x77, 0x00, 0xff, 0x3a, 0x2f, 0x03, 0xff, 0x07, 0x3c, 0x11, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x40, 0x00, 0xff, 0x3f, 0x89, 0x12, 0xff, 0x4e, 0x97, 0x2a, 0xff, 0x87, 0xc9, 0x36, 0xff, 0xae, 0xbf, 0x00, 0xff, 0x88, 0x92, 0x35, 0xff, 0x85, 0x9d, 0x46, 0xff, 0x4a, 0x81, 0x5c, 0xff, 0x5d, 0x7d, 0x62, 0xff, 0xa4, 0xad, 0x76, 0xff, 0xbb, 0xb3, 0x4c, 0xff, 0x95, 0x83, 0x00, 0xff, 0x9d, 0x98, 0x49, 0xff, 0x67, 0x8a, 0x4e, 0xff, 0x97, 0x9f, 0x85, 0xff, 0xa6, 0xa5, 0x8e, 0xff, 0xc7, 0xc9, 0xb6, 0xff, 0xe5, 0xe8, 0xd7, 0xff, 0xd6, 0xdc, 0xc3, 0xff, 0x85, 0x98, 0x74, 0xff, 0x6b, 0x82, 0x6e, 0xff, 0x86, 0x90, 0x51, 0xff, 0x86, 0x82, 0x00, 0xff, 0x8a, 0x70, 0x00, 0xff, 0x6c, 0x75, 0x3d, 0xff, 0x5a, 0x80, 0x6d, 0xff, 0x44, 0x81, 0x40, 0xff, 0x3e, 0x78, 0x29, 0xff, 0x7e, 0x90, 0x00, 0xff, 0x68, 0x71, 0x00, 0xff, 0x1e, 0x00, 0x0d, 0xff, 0x32, 0x38, 0x09, 0xff, 0x3a, 0x97, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x34, 0x85, 0x4c, 0xff, 0x4d, 0x90, 0x5f, 0xff, 0x3f, 0x78, 0x4b, 0xff, 0x41, 0x72, 0x4f, 0xff, 0x97, 0xa3, 0x47, 0xff, 0xd3, 0xd1, 0x1e, 0xff, 0x81, 0x90, 0x32, 0xff, 0x8d, 0xa7, 0x26, 0xff, 0x8f, 0xad, 0x1c, 0xff, 0x94, 0xa4, 0x77, 0xff, 0xbb, 0xc1, 0xa4, 0xff, 0xa1, 0xa9, 0x91, 0xff, 0xa0, 0x83, 0x39, 0xff, 0xc7, 0xa8, 0x6c, 0xff, 0xc5, 0xc5, 0xa5, 0xff, 0xbc, 0xc1, 0xb5, 0xff, 0xbf, 0xbd, 0xaf, 0xff, 0xae, 0xb6, 0xa3, 0xff, 0xa3, 0xb0, 0x80, 0xff, 0x78, 0x87, 0x28, 0xff, 0x7b, 0x85, 0x00, 0xff, 0x52, 0x6f, 0x2e, 0xff, 0x75, 0x8b, 0x52, 0xff, 0x8f, 0x91, 0x4a, 0xff, 0x92, 0x8e, 0x57, 0xff, 0x8f, 0xa5, 0x78, 0xff, 0x8d, 0xb5, 0x98, 0xff, 0x65, 0x9c, 0x5e, 0xff, 0x51, 0x83, 0x41, 0xff, 0x88, 0x8e, 0x00, 0xff, 0x48, 0x46, 0x0f, 0xff, 0x24, 0x00, 0x17, 0xff, 0x25, 0x38, 0x95, 0xff, 0x37, 0x91, 0x94, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x82, 0x25, 0xff, 0x30, 0x6f, 0x3f, 0xff, 0x24, 0x5c, 0x32, 0xff, 0x50, 0x8d, 0x3b, 0xff, 0x5f, 0xa4, 0x49, 0xff, 0x59, 0x95, 0x3e, 0xff, 0x98, 0xb8, 0x49, 0xff, 0x58, 0x8a, 0x34, 0xff, 0x61, 0x8e, 0x5e, 0xff, 0x94, 0x9d, 0x83, 0xff, 0xb8, 0xbc, 0xa3, 0xff, 0x9d, 0xa2, 0x62, 0xff, 0x7d, 0x8f, 0x3a, 0xff, 0x99, 0x90, 0x00, 0xff, 0x92, 0x8e, 0x37, 0xff, 0xa8, 0xb0, 0x99, 0xff, 0xb1, 0xb0, 0x9c, 0xff, 0xcf, 0xd2, 0xc1, 0xff, 0xcb, 0xd9, 0xbf, 0xff, 0xaf, 0xc9, 0xa4, 0xff, 0x7b, 0x9e, 0x70, 0xff, 0x75, 0x80, 0x3c, 0xff, 0x64, 0x7d, 0x04, 0xff, 0x7b, 0x80, 0x00, 0xff, 0x5f, 0x70, 0x09, 0xff, 0x85, 0x83, 0x18, 0xff, 0x80, 0x9b, 0x75, 0xff, 0x8e, 0xaf, 0x85, 0xff, 0x97, 0xaa, 0x7b, 0xff, 0xbf, 0xc8, 0xc5, 0xff, 0xaf, 0xc9, 0xac, 0xff, 0x85, 0xad, 0x8a, 0xff, 0x80, 0x8b, 0x46, 0xff, 0x5c, 0x65, 0x4d, 0xff, 0x5c, 0x8a, 0x00, 0xff, 0x3b, 0x6e, 0x1d, 0xff, 0x61, 0x45, 0x23, 0xff, 0x00, 0x1b, 0x69, 0xff, 0x27, 0x73, 0x65, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x89, 0x00, 0xff, 0x2d, 0x82, 0x00, 0xff, 0x46, 0x9e, 0x12, 0xff, 0x6b, 0xe4, 0x00, 0xff, 0x3b, 0x8a, 0x2e, 0xff, 0x5f, 0x96, 0x6e, 0xff, 0x4a, 0x8d, 0x75, 0xff, 0x52, 0x82, 0x65, 0xff, 0x70, 0x80, 0x71, 0xff, 0x8e, 0xa0, 0x7d, 0xff, 0x90, 0xb2, 0x6d, 0xff, 0x97, 0x9e, 0x24, 0xff, 0xca, 0xc0, 0x01, 0xff, 0xe5, 0xdf, 0x00, 0xff, 0xc6, 0xc1, 0x97, 0xff, 0xc8, 0xc6, 0xb7, 0xff, 0xbb, 0xb7, 0x8b, 0xff, 0xa6, 0xab, 0x79, 0xff, 0xb5, 0xbb, 0x9d, 0xff, 0xc7, 0xcf, 0xb2, 0xff, 0xab, 0xb8, 0xa2, 0xff, 0x96, 0xa7, 0x86, 0xff, 0x83, 0xa5, 0x73, 0xff, 0x7d, 0xae, 0x46, 0xff, 0x64, 0x95, 0x00, 0xff, 0x5b, 0x86, 0x00, 0xff, 0x5f, 0x88, 0x34, 0xff, 0x78, 0x9f, 0x53, 0xff, 0x9b, 0xad, 0x4c, 0xff, 0xac, 0xb9, 0x8d, 0xff, 0xc9, 0xc6, 0x9d, 0xff, 0xa6, 0xc5, 0xb5, 0xff, 0x8f, 0xbc, 0x82, 0xff, 0x7e, 0xa5, 0x51, 0xff, 0x9a, 0xb0, 0xaa, 0xff, 0x65, 0x90, 0x6b, 0xff, 0x7a, 0x93, 0x74, 0xff, 0x84, 0x83, 0x3d, 0xff, 0x3a, 0x54, 0x5a, 0xff, 0x00, 0x4b, 0x3a, 0xff, 0x9f, 0xa3, 0x00, 0xff, 0xf0, 0xbd, 0x00, 0xff, 0x84, 0x6c, 0x00, 0xff, 0x00, 0x73, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x62, 0xaa, 0x7a, 0xff, 0x69, 0x9f, 0x8c, 0xff, 0x47, 0x7d, 0x5e, 0xff, 0x2f, 0x60, 0x37, 0xff, 0x5b, 0x94, 0x61, 0xff, 0x6a, 0x8a, 0x81, 0xff, 0x89, 0xa1, 0x96, 0xff, 0x4e, 0x8a, 0x52, 0xff, 0x65, 0x9c, 0x3e, 0xff, 0x73, 0x96, 0x89, 0xff, 0xab, 0xaf, 0x9d, 0xff, 0xa8, 0xb0, 0x98, 0xff, 0xb7, 0xa3, 0x32, 0xff, 0xce, 0xbe, 0x00, 0xff, 0xdf, 0xc9, 0x43, 0xff, 0xa1, 0x9a, 0x81, 0xff, 0xb0, 0xb7, 0xaa, 0xff, 0xa6, 0xad, 0xa2, 0xff, 0xbc, 0xce, 0xaf, 0xff, 0x9c, 0xc1, 0x91, 0xff, 0x78, 0xaf, 0x63, 0xff, 0x5f, 0x97, 0x41, 0xff, 0x5a, 0x8a, 0x34, 0xff, 0x63, 0x8f, 0x3b, 0xff, 0x77, 0xa8, 0x24, 0xff, 0x86, 0xa9, 0x6a, 0xff, 0x90, 0xae, 0x89, 0xff, 0x98, 0xba, 0x7f, 0xff, 0x86, 0xbc, 0x7f, 0xff, 0x6c, 0xb4, 0x34, 0xff, 0xa0, 0xbe, 0x97, 0xff, 0xa4, 0xbb, 0xa7, 0xff, 0x8e, 0xae, 0x8b, 0xff, 0x89, 0xb8, 0x57, 0xff, 0x7b, 0xb7, 0x30, 0xff, 0x9b, 0xb7, 0x9b, 0xff, 0xa2, 0xb2, 0xa3, 0xff, 0xb2, 0xbd, 0xac, 0xff, 0x78, 0x86, 0x50, 0xff, 0x32, 0x69, 0x59, 0xff, 0x24, 0x04, 0x58, 0xff, 0x79, 0x5c, 0x00, 0xff, 0xe9, 0xb7, 0x00, 0xff, 0xce, 0x9d, 0x00, 0xff, 0x00, 0x3b, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x91, 0x15, 0xff, 0x37, 0x7c, 0x54, 0xff, 0x21, 0x5f, 0x43, 0xff, 0x1f, 0x69, 0x14, 0xff, 0x57, 0x9c, 0x61, 0xff, 0x54, 0x90, 0x8a, 0xff, 0x8b, 0xa1, 0x9a, 0xff, 0x59, 0x84, 0x69, 0xff, 0x74, 0x85, 0x88, 0xff, 0x99, 0x8d, 0x93, 0xff, 0x9f, 0xa0, 0xb9, 0xff, 0x4e, 0x54, 0xac, 0xff, 0x4a, 0x5e, 0x6c, 0xff, 0x4e, 0x7b, 0x49, 0xff, 0x00, 0x72, 0x25, 0xff, 0x82, 0x9a, 0x86, 0xff, 0x94, 0x96, 0x89, 0xff, 0xa7, 0xac, 0x9c, 0xff, 0xbd, 0xbc, 0xad, 0xff, 0xbc, 0xc4, 0xb9, 0xff, 0x99, 0xb6, 0xa9, 0xff, 0x71, 0x99, 0x7e, 0xff, 0x66, 0x90, 0x58, 0xff, 0x6b, 0xaa, 0x59, 0xff, 0x66, 0xab, 0x2c, 0xff, 0x5d, 0x9f, 0x25, 0xff, 0x66, 0x98, 0x4f, 0xff, 0x77, 0x9f, 0x6a, 0xff, 0x82, 0xaf, 0x83, 0xff, 0x6a, 0xb1, 0x3c, 0xff, 0x96, 0xba, 0x8c, 0xff, 0xaf, 0xc6, 0xb9, 0xff, 0xa0, 0xc1, 0xb0, 0xff, 0x83, 0xba, 0x81, 0xff, 0x64, 0xb4, 0x00, 0xff, 0x92, 0xc0, 0x8a, 0xff, 0x83, 0xa0, 0x7a, 0xff, 0x92, 0x98, 0x62, 0xff, 0x91, 0xb8, 0x60, 0xff, 0x6c, 0xbc, 0x00, 0xff, 0x96, 0xc7, 0x89, 0xff, 0xa6, 0xcc, 0x97, 0xff, 0x7a, 0x89, 0x45, 0xff, 0x56, 0x7d, 0x3e, 0xff, 0x4e, 0x92, 0x44, 0xff, 0x4f, 0x5a, 0x2c, 0xff, 0x00, 0x30, 0x00, 0xff, 0x68, 0x44, 0x00, 0xff, 0x96, 0x6a, 0x01, 0xff, 0x72, 0x58, 0x05, 0xff, 0x86, 0xaa, 0x0c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x6f, 0x00, 0xff, 0x32, 0x75, 0x0d, 0xff, 0x5e, 0xae, 0x2f, 0xff, 0x48, 0xa1, 0x1f, 0xff, 0x4b, 0x94, 0x73, 0xff, 0x58, 0x9c, 0x87, 0xff, 0x66, 0x89, 0x84, 0xff, 0x62, 0x73, 0x77, 0xff, 0x7e, 0x88, 0x8a, 0xff, 0xa6, 0xa1, 0x9f, 0xff, 0x93, 0x7c, 0x77, 0xff, 0x39, 0x34, 0x8d, 0xff, 0x33, 0x31, 0xad, 0xff, 0x93, 0x85, 0xc0, 0xff, 0x82, 0x7e, 0xb9, 0xff, 0x7d, 0x7a, 0xca, 0xff, 0x26, 0x07, 0xb7, 0xff, 0x74, 0x6a, 0xc3, 0xff, 0xa5, 0xa6, 0xc5, 0xff, 0x99, 0xa1, 0xa6, 0xff, 0xa6, 0xa5, 0xa0, 0xff, 0x93, 0xa3, 0x9a, 0xff, 0x86, 0xbd, 0x9b, 0xff, 0x5f, 0xb3, 0x77, 0xff, 0x56, 0xaa, 0x50, 0xff, 0x54, 0x92, 0x36, 0xff, 0x65, 0x95, 0x35, 0xff, 0x70, 0xa9, 0x54, 0xff, 0x7b, 0xb2, 0x4c, 0xff, 0x9f, 0xb9, 0x96, 0xff, 0xb1, 0xc8, 0xbc, 0xff, 0xa8, 0xc7, 0xb4, 0xff, 0x87, 0xbe, 0x8e, 0xff, 0x4d, 0xad, 0x19, 0xff, 0x92, 0xc1, 0x86, 0xff, 0x7a, 0xa7, 0x6e, 0xff, 0x53, 0x89, 0x4d, 0xff, 0x78, 0xa6, 0x74, 0xff, 0x61, 0xb5, 0x00, 0xff, 0x8c, 0xc3, 0x75, 0xff, 0xcf, 0xe0, 0xc9, 0xff, 0xa7, 0xcc, 0x95, 0xff, 0x7b, 0xc1, 0x4b, 0xff, 0x6e, 0xc0, 0x1c, 0xff, 0x6d, 0xbe, 0x06, 0xff, 0x5f, 0xa7, 0x00, 0xff, 0x55, 0x66, 0x00, 0xff, 0x50, 0x91, 0x44, 0xff, 0x5f, 0xb0, 0x39, 0xff, 0x39, 0x68, 0x27, 0xff, 0x0d, 0x71, 0x11, 0xff, 0x4c, 0x4c, 0x00, 0xff, 0x59, 0x40, 0x00, 0xff, 0xa2, 0x6f, 0x02, 0xff, 0x79, 0x9d, 0x0d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x88, 0x00, 0xff, 0x2b, 0x79, 0x65, 0xff, 0x3d, 0x79, 0x6c, 0xff, 0x34, 0x64, 0x54, 0xff, 0x2d, 0x63, 0x31, 0xff, 0x5d, 0x8f, 0x70, 0xff, 0x60, 0x8a, 0x90, 0xff, 0x65, 0x75, 0x7a, 0xff, 0x64, 0x6d, 0x83, 0xff, 0x68, 0x72, 0x95, 0xff, 0xaa, 0xa9, 0xb8, 0xff, 0xb9, 0xb4, 0xc2, 0xff, 0x86, 0x80, 0xb9, 0xff, 0x00, 0x00, 0xb9, 0xff, 0x00, 0x00, 0xbd, 0xff, 0x49, 0x42, 0xcd, 0xff, 0x96, 0x8c, 0xc0, 0xff, 0xa0, 0x95, 0xb7, 0xff, 0xb2, 0xa2, 0xde, 0xff, 0xab, 0xa7, 0xe0, 0xff, 0x89, 0x9e, 0xbc, 0xff, 0x59, 0x96, 0x75, 0xff, 0x3b, 0x84, 0x3a, 0xff, 0x3e, 0x8b, 0x45, 0xff, 0x73, 0xb0, 0x56, 0xff, 0x7c, 0xb0, 0x3e, 0xff, 0x76, 0xad, 0x59, 0xff, 0x7c, 0xa9, 0x6c, 0xff, 0x91, 0xb6, 0x8f, 0xff, 0x70, 0xb2, 0x77, 0xff, 0x4d, 0xa8, 0x3d, 0xff, 0x97, 0xb8, 0x95, 0xff, 0x90, 0xb2, 0x9f, 0xff, 0x87, 0xad, 0x98, 0xff, 0x74, 0xb5, 0x77, 0xff, 0x40, 0xad, 0x17, 0xff, 0x8b, 0xc4, 0x73, 0xff, 0xc1, 0xd5, 0xa6, 0xff, 0xb6, 0xcc, 0xae, 0xff, 0x8d, 0xba, 0x8f, 0xff, 0x5b, 0xb7, 0x19, 0xff, 0x6d, 0xbf, 0x33, 0xff, 0x77, 0xc5, 0x48, 0xff, 0x69, 0xc1, 0x18, 0xff, 0x6c, 0xc1, 0x1f, 0xff, 0x6f, 0xc1, 0x28, 0xff, 0x71, 0xc0, 0x29, 0xff, 0x5f, 0x9a, 0x19, 0xff, 0x4c, 0x61, 0x22, 0xff, 0x56, 0xa6, 0x48, 0xff, 0x65, 0xbd, 0x36, 0xff, 0x2c, 0x63, 0x2e, 0xff, 0x83, 0xa8, 0x0a, 0xff, 0xc4, 0xbe, 0x00, 0xff, 0x68, 0x51, 0x00, 0xff, 0x3d, 0x36, 0x02, 0xff, 0x28, 0x81, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4e, 0xde, 0x00, 0xff, 0x4a, 0x97, 0x62, 0xff, 0x5c, 0x9c, 0x7d, 0xff, 0x54, 0xad, 0x4f, 0xff, 0x43, 0x9d, 0x60, 0xff, 0x5e, 0x76, 0x73, 0xff, 0x8d, 0x86, 0x8e, 0xff, 0xbe, 0xb3, 0xc1, 0xff, 0x5b, 0x63, 0xc5, 0xff, 0x00, 0x46, 0xd9, 0xff, 0x00, 0x00, 0xd0, 0xff, 0x6a, 0x6a, 0xd5, 0xff, 0x7d, 0x7c, 0xae, 0xff, 0xa1, 0x9b, 0xc8, 0xff, 0x97, 0x8d, 0xdd, 0xff, 0xb6, 0xac, 0xdd, 0xff, 0xad, 0xab, 0xe0, 0xff, 0x7a, 0x7f, 0xb3, 0xff, 0x6a, 0x73, 0x98, 0xff, 0x58, 0x9b, 0x94, 0xff, 0x2e, 0xaf, 0x64, 0xff, 0x2a, 0xb6, 0x0a, 0xff, 0x3e, 0xb0, 0x14, 0xff, 0x58, 0x9d, 0x45, 0xff, 0x6e, 0x9a, 0x66, 0xff, 0x78, 0xb0, 0x5f, 0xff, 0x74, 0xb4, 0x70, 0xff, 0xa6, 0xc4, 0xaf, 0xff, 0xaa, 0xca, 0xb9, 0xff, 0xa4, 0xc9, 0xb9, 0xff, 0x67, 0xb0, 0x6b, 0xff, 0x37, 0xa7, 0x36, 0xff, 0x88, 0xb7, 0x81, 0xff, 0x60, 0x8b, 0x51, 0xff, 0x77, 0x8d, 0x6c, 0xff, 0x80, 0xad, 0x86, 0xff, 0x43, 0xb1, 0x33, 0xff, 0x54, 0xb6, 0x4c, 0xff, 0xa0, 0xd0, 0x9b, 0xff, 0x7a, 0xc0, 0x78, 0xff, 0x51, 0xb7, 0x3f, 0xff, 0x64, 0xbd, 0x2b, 0xff, 0x6d, 0xc3, 0x26, 0xff, 0x6a, 0xc3, 0x1f, 0xff, 0x6c, 0xc2, 0x28, 0xff, 0x6e, 0xc2, 0x2a, 0xff, 0x70, 0xc2, 0x2a, 0xff, 0x71, 0xc0, 0x2a, 0xff, 0x5c, 0x88, 0x10, 0xff, 0x4f, 0x68, 0x34, 0xff, 0x60, 0xb5, 0x45, 0xff, 0x67, 0xbf, 0x3d, 0xff, 0x41, 0x6b, 0x33, 0xff, 0x87, 0xbc, 0x05, 0xff, 0xe5, 0xff, 0x00, 0xff, 0xbe, 0xc3, 0x00, 0xff, 0x00, 0x20, 0x01, 0xff, 0x1d, 0x72, 0x10, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x55, 0xc2, 0x3d, 0xff, 0x3b, 0x97, 0x76, 0xff, 0x24, 0x6f, 0x95, 0xff, 0x36, 0x6c, 0x89, 0xff, 0x81, 0x99, 0x98, 0xff, 0x74, 0xa4, 0x8e, 0xff, 0x28, 0x8f, 0x87, 0xff, 0x00, 0x84, 0x9a, 0xff, 0x4e, 0x67, 0x86, 0xff, 0xb3, 0xaa, 0xc2, 0xff, 0xa6, 0xa2, 0xcd, 0xff, 0x79, 0xa7, 0xf3, 0xff, 0x00, 0x78, 0xfb, 0xff, 0x71, 0x6e, 0xf4, 0xff, 0x7f, 0x6b, 0xc9, 0xff, 0x9f, 0x92, 0xae, 0xff, 0xa5, 0x9e, 0xac, 0xff, 0xa8, 0xab, 0xdf, 0xff, 0x6f, 0x86, 0xd7, 0xff, 0x28, 0x64, 0xd7, 0xff, 0x00, 0x54, 0xa9, 0xff, 0x2e, 0x75, 0x5a, 0xff, 0x4b, 0xb1, 0x42, 0xff, 0x4e, 0xbb, 0x46, 0xff, 0x68, 0xae, 0x77, 0xff, 0x93, 0xb9, 0xa2, 0xff, 0x9d, 0xbb, 0x94, 0xff, 0x9b, 0xbb, 0xa0, 0xff, 0x53, 0xb1, 0x60, 0xff, 0x5d, 0xb0, 0x67, 0xff, 0x88, 0xae, 0x90, 0xff, 0x61, 0x98, 0x72, 0xff, 0x73, 0x9f, 0x83, 0xff, 0x63, 0xb1, 0x68, 0xff, 0x26, 0xac, 0x3a, 0xff, 0x7e, 0xba, 0x72, 0xff, 0xba, 0xce, 0xb3, 0xff, 0x9d, 0xc6, 0xa0, 0xff, 0x5e, 0xb4, 0x69, 0xff, 0x3d, 0xb1, 0x3e, 0xff, 0x3c, 0xaf, 0x3f, 0xff, 0x28, 0xab, 0x2a, 0xff, 0x3f, 0xb0, 0x2b, 0xff, 0x61, 0xbc, 0x2e, 0xff, 0x71, 0xc3, 0x2c, 0xff, 0x70, 0xc4, 0x2a, 0xff, 0x6e, 0xc4, 0x2a, 0xff, 0x6d, 0xc4, 0x2b, 0xff, 0x6f, 0xc2, 0x2b, 0xff, 0x72, 0xc3, 0x2c, 0xff, 0x6c, 0xbb, 0x28, 0xff, 0x63, 0x76, 0x15, 0xff, 0x53, 0x7b, 0x41, 0xff, 0x66, 0xbe, 0x43, 0xff, 0x69, 0xc1, 0x42, 0xff, 0x4d, 0x7b, 0x2f, 0xff, 0x33, 0xb5, 0x76, 0xff, 0x54, 0xff, 0x9e, 0xff, 0xa6, 0xfc, 0x54, 0xff, 0x47, 0x7f, 0x00, 0xff, 0x00, 0x45, 0x0a, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x3c, 0xa0, 0x6e, 0xff, 0x28, 0x82, 0x82, 0xff, 0x22, 0x6d, 0x70, 0xff, 0x20, 0x5a, 0x96, 0xff, 0x10, 0x3e, 0xbb, 0xff, 0x00, 0x12, 0xa3, 0xff, 0x53, 0x3a, 0x9f, 0xff, 0x7d, 0x74, 0xb3, 0xff, 0x2f, 0x75, 0xc6, 0xff, 0x00, 0x2b, 0xe8, 0xff, 0x00, 0x69, 0xe7, 0xff, 0x00, 0x1d, 0xc7, 0xff, 0x44, 0x47, 0xb3, 0xff, 0x7c, 0x7e, 0xc0, 0xff, 0xb8, 0xaf, 0xd1, 0xff, 0xdb, 0xd4, 0xf9, 0xff, 0xe2, 0xd8, 0xf4, 0xff, 0xa7, 0x99, 0xdb, 0xff, 0x5c, 0x62, 0x9f, 0xff, 0x37, 0x60, 0x96, 0xff, 0x00, 0x5a, 0xd7, 0xff, 0x00, 0x47, 0xd0, 0xff, 0x1c, 0x5b, 0xcd, 0xff, 0x51, 0x78, 0x99, 0xff, 0x75, 0xa1, 0x6a, 0xff, 0x72, 0xac, 0x94, 0xff, 0x30, 0x9b, 0x5a, 0xff, 0x89, 0xa9, 0x93, 0xff, 0x9d, 0xb5, 0xaf, 0xff, 0x9f, 0xc1, 0xb4, 0xff, 0x88, 0xb8, 0x98, 0xff, 0x41, 0xb1, 0x4b, 0xff, 0x49, 0xb1, 0x57, 0xff, 0x84, 0xb9, 0x8c, 0xff, 0x69, 0x96, 0x68, 0xff, 0x7e, 0x92, 0x91, 0xff, 0x60, 0xaa, 0x6b, 0xff, 0x2c, 0xaf, 0x42, 0xff, 0x48, 0xb2, 0x56, 0xff, 0x58, 0xb7, 0x66, 0xff, 0x2e, 0xb1, 0x41, 0xff, 0x33, 0xb1, 0x3e, 0xff, 0x3a, 0xb0, 0x43, 0xff, 0x3b, 0xaf, 0x40, 0xff, 0x4f, 0xb5, 0x39, 0xff, 0x68, 0xbe, 0x30, 0xff, 0x6f, 0xc1, 0x2d, 0xff, 0x70, 0xc3, 0x2c, 0xff, 0x6f, 0xc4, 0x2a, 0xff, 0x6f, 0xc5, 0x2a, 0xff, 0x6e, 0xc4, 0x2b, 0xff, 0x70, 0xc3, 0x2c, 0xff, 0x73, 0xc5, 0x2c, 0xff, 0x7e, 0xb1, 0x20, 0xff, 0x95, 0x69, 0x1a, 0xff, 0x51, 0x93, 0x47, 0xff, 0x6a, 0xc5, 0x46, 0xff, 0x6a, 0xc3, 0x45, 0xff, 0x51, 0x93, 0x29, 0xff, 0x12, 0x5c, 0xad, 0xff, 0x00, 0xdf, 0xe6, 0xff, 0x00, 0xff, 0xca, 0xff, 0x12, 0xb0, 0x6e, 0xff, 0x11, 0x2f, 0x00, 0xff, 0x33, 0xaa, 0x11, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0x8a, 0x9e, 0xff, 0x2f, 0x75, 0xd0, 0xff, 0x20, 0x87, 0xdb, 0xff, 0x13, 0x55, 0xab, 0xff, 0x11, 0x25, 0x57, 0xff, 0x2a, 0x0b, 0x3d, 0xff, 0x00, 0x00, 0x5d, 0xff, 0x00, 0x2d, 0xac, 0xff, 0x00, 0x1e, 0x95, 0xff, 0x19, 0x24, 0x9f, 0xff, 0x0e, 0x28, 0xac, 0xff, 0x00, 0x00, 0xaa, 0xff, 0x17, 0x00, 0xb8, 0xff, 0x72, 0x5b, 0xeb, 0xff, 0xae, 0x9e, 0xf8, 0xff, 0xca, 0xbe, 0xe4, 0xff, 0xae, 0x96, 0xc0, 0xff, 0x9b, 0x91, 0xb7, 0xff, 0x94, 0x9a, 0xd0, 0xff, 0x45, 0x53, 0xbe, 0xff, 0x00, 0x02, 0xdc, 0xff, 0x12, 0x53, 0xa2, 0xff, 0x2f, 0x76, 0x88, 0xff, 0x3c, 0x7d, 0xa2, 0xff, 0x41, 0x88, 0x9d, 0xff, 0x87, 0xa9, 0xb4, 0xff, 0x9e, 0xb4, 0xb6, 0xff, 0x9a, 0xb9, 0xb9, 0xff, 0x79, 0xb2, 0x9a, 0xff, 0x00, 0x9f, 0x43, 0xff, 0x8f, 0xb8, 0x91, 0xff, 0x81, 0xaa, 0x83, 0xff, 0x2a, 0x77, 0x42, 0xff, 0x64, 0x94, 0x7f, 0xff, 0x43, 0xb3, 0x55, 0xff, 0x2d, 0xaf, 0x43, 0xff, 0x90, 0xc3, 0x94, 0xff, 0x9b, 0xc6, 0xa4, 0xff, 0x6a, 0xb4, 0x7b, 0xff, 0x39, 0xad, 0x50, 0xff, 0x2e, 0xae, 0x48, 0xff, 0x2b, 0xac, 0x46, 0xff, 0x28, 0xad, 0x43, 0xff, 0x32, 0xaf, 0x46, 0xff, 0x32, 0xaf, 0x44, 0xff, 0x3c, 0xb1, 0x40, 0xff, 0x58, 0xba, 0x39, 0xff, 0x6a, 0xc1, 0x31, 0xff, 0x6d, 0xc2, 0x2f, 0xff, 0x6c, 0xc3, 0x2e, 0xff, 0x6d, 0xc4, 0x2d, 0xff, 0x6e, 0xc5, 0x2b, 0xff, 0x6e, 0xc5, 0x2a, 0xff, 0x6f, 0xc5, 0x2c, 0xff, 0x70, 0xc4, 0x2d, 0xff, 0x6c, 0xc5, 0x2b, 0xff, 0xae, 0xa6, 0x12, 0xff, 0xc5, 0x6c, 0x27, 0xff, 0x4d, 0xa9, 0x4e, 0xff, 0x6c, 0xc8, 0x47, 0xff, 0x6b, 0xc5, 0x46, 0xff, 0x5e, 0xa9, 0x32, 0xff, 0x19, 0x25, 0x8d, 0xff, 0x00, 0x59, 0xef, 0xff, 0x00, 0xe3, 0xf3, 0xff, 0x00, 0xc5, 0xbf, 0xff, 0x0b, 0x20, 0x00, 0xff, 0x2d, 0x82, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0x8f, 0x76, 0xff, 0x1f, 0x4d, 0xb1, 0xff, 0x14, 0x2a, 0xde, 0xff, 0x00, 0x17, 0xf8, 0xff, 0x00, 0x03, 0xef, 0xff, 0x15, 0x00, 0xbe, 0xff, 0x22, 0x1c, 0xa6, 0xff, 0x00, 0x31, 0xa3, 0xff, 0x00, 0x42, 0x87, 0xff, 0x00, 0x34, 0xa1, 0xff, 0x00, 0x00, 0xa0, 0xff, 0x42, 0x33, 0xa5, 0xff, 0x87, 0x6a, 0xb1, 0xff, 0xba, 0xa4, 0xd7, 0xff, 0xd8, 0xd0, 0xf3, 0xff, 0xc7, 0xc1, 0xf7, 0xff, 0x94, 0x8e, 0xf6, 0xff, 0x3b, 0x54, 0xab, 0xff, 0x00, 0x54, 0x95, 0xff, 0x00, 0x72, 0xa4, 0xff, 0x1a, 0x67, 0x9b, 0xff, 0x57, 0x7c, 0xb5, 0xff, 0x60, 0x8b, 0x9c, 0xff, 0x72, 0xab, 0x8a, 0xff, 0x5d, 0xae, 0x87, 0xff, 0x19, 0xa3, 0x5f, 0xff, 0x72, 0xa0, 0x9b, 0xff, 0x88, 0xa8, 0xb0, 0xff, 0x64, 0xa3, 0xb6, 0xff, 0x59, 0x9f, 0x7f, 0xff, 0x0a, 0xa9, 0x4d, 0xff, 0x5f, 0xae, 0x73, 0xff, 0xab, 0xbe, 0xa8, 0xff, 0x9b, 0xa8, 0x9d, 0xff, 0x7b, 0x99, 0x97, 0xff, 0x36, 0xae, 0x51, 0xff, 0x33, 0xb1, 0x4b, 0xff, 0x38, 0xb0, 0x4d, 0xff, 0x2a, 0xb0, 0x47, 0xff, 0x22, 0xae, 0x45, 0xff, 0x2e, 0xad, 0x4c, 0xff, 0x2f, 0xad, 0x4b, 0xff, 0x2e, 0xab, 0x49, 0xff, 0x2f, 0xad, 0x47, 0xff, 0x30, 0xae, 0x45, 0xff, 0x45, 0xb4, 0x40, 0xff, 0x63, 0xbf, 0x38, 0xff, 0x6c, 0xc3, 0x33, 0xff, 0x6b, 0xc3, 0x33, 0xff, 0x6a, 0xc3, 0x31, 0xff, 0x6b, 0xc4, 0x2e, 0xff, 0x6d, 0xc6, 0x2d, 0xff, 0x6d, 0xc6, 0x2b, 0xff, 0x6e, 0xc6, 0x2b, 0xff, 0x6f, 0xc7, 0x2d, 0xff, 0x6f, 0xc7, 0x2d, 0xff, 0x69, 0xc5, 0x2c, 0xff, 0xa7, 0xaa, 0x12, 0xff, 0x94, 0x74, 0x3d, 0xff, 0x5c, 0xbb, 0x4f, 0xff, 0x6d, 0xc8, 0x47, 0xff, 0x6b, 0xc6, 0x47, 0xff, 0x66, 0xb7, 0x3c, 0xff, 0x24, 0x54, 0x68, 0xff, 0x00, 0x00, 0xd5, 0xff, 0x00, 0x5f, 0xf5, 0xff, 0x00, 0x86, 0xe0, 0xff, 0x06, 0x24, 0x35, 0xff, 0x23, 0x72, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x20, 0x6b, 0xb4, 0xff, 0x44, 0x71, 0x9e, 0xff, 0x54, 0x83, 0x3c, 0xff, 0x27, 0x30, 0xa2, 0xff, 0x16, 0x0f, 0xe2, 0xff, 0x05, 0x14, 0xf0, 0xff, 0x00, 0x16, 0xe0, 0xff, 0x0f, 0x1e, 0xd8, 0xff, 0x40, 0x2c, 0xc0, 0xff, 0x72, 0x4d, 0xa6, 0xff, 0x8d, 0x62, 0xbc, 0xff, 0x9b, 0x7a, 0xc8, 0xff, 0x9a, 0x88, 0xbb, 0xff, 0x6f, 0x73, 0xc8, 0xff, 0x34, 0x45, 0xeb, 0xff, 0x00, 0x00, 0xe2, 0xff, 0x00, 0x00, 0xdb, 0xff, 0x3a, 0x7b, 0xa7, 0xff, 0x46, 0x8f, 0x88, 0xff, 0x45, 0xa0, 0x85, 0xff, 0x4f, 0x9e, 0x81, 0xff, 0x94, 0xb2, 0xb3, 0xff, 0x90, 0xb9, 0xb2, 0xff, 0x8d, 0xbd, 0xb9, 0xff, 0x54, 0xb1, 0x87, 0xff, 0x00, 0xa6, 0x63, 0xff, 0x63, 0xa9, 0x90, 0xff, 0x41, 0x7b, 0x62, 0xff, 0x1f, 0x58, 0x47, 0xff, 0x40, 0x7e, 0x83, 0xff, 0x1e, 0xb0, 0x59, 0xff, 0x2f, 0xac, 0x5c, 0xff, 0x8e, 0xc0, 0x9b, 0xff, 0x72, 0xb6, 0x81, 0xff, 0x35, 0xad, 0x54, 0xff, 0x2c, 0xaf, 0x4b, 0xff, 0x2f, 0xb0, 0x4c, 0xff, 0x2d, 0xae, 0x4c, 0xff, 0x2d, 0xae, 0x4d, 0xff, 0x2e, 0xae, 0x4d, 0xff, 0x2f, 0xac, 0x4d, 0xff, 0x2f, 0xac, 0x4c, 0xff, 0x2c, 0xab, 0x4a, 0xff, 0x31, 0xad, 0x44, 0xff, 0x51, 0xb8, 0x3b, 0xff, 0x6a, 0xc1, 0x37, 0xff, 0x6e, 0xc4, 0x35, 0xff, 0x6a, 0xc3, 0x34, 0xff, 0x6a, 0xc3, 0x34, 0xff, 0x69, 0xc3, 0x32, 0xff, 0x6a, 0xc4, 0x2f, 0xff, 0x6b, 0xc5, 0x2e, 0xff, 0x6c, 0xc6, 0x2c, 0xff, 0x6e, 0xc7, 0x2d, 0xff, 0x6f, 0xc7, 0x2d, 0xff, 0x6f, 0xc8, 0x2c, 0xff, 0x68, 0xc3, 0x2d, 0xff, 0x72, 0xa4, 0x1d, 0xff, 0x54, 0x86, 0x46, 0xff, 0x70, 0xc8, 0x4b, 0xff, 0x6f, 0xc9, 0x47, 0xff, 0x6c, 0xc7, 0x4a, 0xff, 0x6c, 0xc0, 0x44, 0xff, 0x36, 0x6c, 0x49, 0xff, 0x00, 0x00, 0xad, 0xff, 0x00, 0x00, 0xd7, 0xff, 0x00, 0x00, 0xd7, 0xff, 0x02, 0x37, 0x4d, 0xff, 0x1d, 0x71, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x57, 0x8e, 0xff, 0x1e, 0x46, 0xb9, 0xff, 0x58, 0x8e, 0x42, 0xff, 0x48, 0x6f, 0x00, 0xff, 0x27, 0x2d, 0xcc, 0xff, 0x00, 0x36, 0xf4, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x69, 0x3f, 0xbd, 0xff, 0x87, 0x54, 0xc4, 0xff, 0x7a, 0x54, 0xbe, 0xff, 0x4c, 0x40, 0xc3, 0xff, 0x00, 0x32, 0xbc, 0xff, 0x00, 0x38, 0x9b, 0xff, 0x00, 0x27, 0xae, 0xff, 0x00, 0x4c, 0xd6, 0xff, 0x3b, 0x74, 0xb9, 0xff, 0x61, 0x94, 0xab, 0xff, 0x55, 0xa1, 0xa8, 0xff, 0x58, 0xb2, 0xb8, 0xff, 0x3f, 0xa8, 0x83, 0xff, 0x30, 0x98, 0x77, 0xff, 0x70, 0x9b, 0x98, 0xff, 0x6d, 0x9f, 0x9a, 0xff, 0x54, 0x82, 0x92, 0xff, 0x2f, 0x9e, 0x7f, 0xff, 0x00, 0xac, 0x69, 0xff, 0x63, 0xb2, 0x92, 0xff, 0x85, 0xa0, 0xad, 0xff, 0x5e, 0x92, 0xa1, 0xff, 0x3a, 0x9d, 0x96, 0xff, 0x01, 0xb2, 0x68, 0xff, 0x1b, 0xad, 0x51, 0xff, 0x06, 0xaa, 0x46, 0xff, 0x17, 0xac, 0x47, 0xff, 0x29, 0xac, 0x4c, 0xff, 0x2c, 0xad, 0x4d, 0xff, 0x2c, 0xae, 0x4c, 0xff, 0x2d, 0xae, 0x4e, 0xff, 0x2d, 0xae, 0x4d, 0xff, 0x2c, 0xad, 0x4c, 0xff, 0x2a, 0xac, 0x4b, 0xff, 0x27, 0xab, 0x4a, 0xff, 0x3a, 0xb0, 0x46, 0xff, 0x5d, 0xbd, 0x39, 0xff, 0x6c, 0xc4, 0x34, 0xff, 0x6d, 0xc4, 0x35, 0xff, 0x6c, 0xc4, 0x35, 0xff, 0x6c, 0xc3, 0x34, 0xff, 0x6b, 0xc2, 0x33, 0xff, 0x68, 0xc3, 0x33, 0xff, 0x69, 0xc4, 0x31, 0xff, 0x6a, 0xc5, 0x30, 0xff, 0x6c, 0xc7, 0x2f, 0xff, 0x6e, 0xc8, 0x2e, 0xff, 0x6f, 0xc8, 0x2e, 0xff, 0x6e, 0xc9, 0x2e, 0xff, 0x68, 0xb6, 0x25, 0xff, 0x73, 0x85, 0x1a, 0xff, 0x59, 0x9e, 0x46, 0xff, 0x6d, 0xc4, 0x50, 0xff, 0x63, 0xbd, 0x51, 0xff, 0x6f, 0xc7, 0x47, 0xff, 0x70, 0xc4, 0x46, 0xff, 0x43, 0x81, 0x3d, 0xff, 0x00, 0x00, 0x7b, 0xff, 0x00, 0x07, 0xab, 0xff, 0x00, 0x0f, 0xb4, 0xff, 0x00, 0x49, 0x51, 0xff, 0x1a, 0x7a, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xbf, 0x00, 0xff, 0x25, 0x43, 0x77, 0xff, 0x06, 0x5a, 0x7d, 0xff, 0x2f, 0x7b, 0x67, 0xff, 0x29, 0x70, 0x5b, 0xff, 0x12, 0x24, 0xe9, 0xff, 0x00, 0x00, 0xd3, 0xff, 0x0d, 0x00, 0x95, 0xff, 0x26, 0x3e, 0xe9, 0xff, 0x00, 0x36, 0xf2, 0xff, 0x00, 0x00, 0xa9, 0xff, 0x3c, 0x01, 0xb0, 0xff, 0x8c, 0x29, 0xc9, 0xff, 0x65, 0x1e, 0x9d, 0xff, 0x00, 0x53, 0x7c, 0xff, 0x00, 0x9e, 0x78, 0xff, 0x5d, 0x80, 0x8a, 0xff, 0x8c, 0xa8, 0xc8, 0xff, 0x71, 0xb4, 0xc0, 0xff, 0x61, 0xa8, 0xac, 0xff, 0x19, 0xa1, 0x72, 0xff, 0x30, 0xa1, 0x78, 0xff, 0x81, 0xa8, 0xa5, 0xff, 0x4c, 0x69, 0x64, 0xff, 0x56, 0x54, 0x7f, 0xff, 0x3b, 0x8e, 0x81, 0xff, 0x00, 0xb2, 0x79, 0xff, 0x2d, 0xb4, 0x88, 0xff, 0x4e, 0xb5, 0x9f, 0xff, 0x0b, 0xb2, 0x8f, 0xff, 0x05, 0xb4, 0x8b, 0xff, 0x05, 0xb0, 0x71, 0xff, 0x20, 0xac, 0x4e, 0xff, 0x27, 0xac, 0x4e, 0xff, 0x2a, 0xab, 0x4e, 0xff, 0x2c, 0xab, 0x4e, 0xff, 0x2b, 0xac, 0x4e, 0xff, 0x2c, 0xac, 0x4d, 0xff, 0x2b, 0xad, 0x4e, 0xff, 0x2a, 0xad, 0x4d, 0xff, 0x28, 0xad, 0x4c, 0xff, 0x28, 0xac, 0x4a, 0xff, 0x49, 0xb5, 0x44, 0xff, 0x66, 0xc2, 0x39, 0xff, 0x6c, 0xc5, 0x35, 0xff, 0x69, 0xc5, 0x36, 0xff, 0x6a, 0xc4, 0x37, 0xff, 0x6c, 0xc4, 0x37, 0xff, 0x6c, 0xc3, 0x35, 0xff, 0x6b, 0xc2, 0x33, 0xff, 0x6a, 0xc3, 0x32, 0xff, 0x6b, 0xc5, 0x31, 0xff, 0x6c, 0xc6, 0x31, 0xff, 0x6e, 0xc8, 0x31, 0xff, 0x71, 0xc9, 0x30, 0xff, 0x71, 0xc9, 0x2f, 0xff, 0x6c, 0xc8, 0x2f, 0xff, 0x78, 0xa6, 0x17, 0xff, 0x80, 0x7f, 0x29, 0xff, 0x63, 0xb3, 0x48, 0xff, 0x5f, 0xb3, 0x5d, 0xff, 0x4f, 0xa8, 0x5d, 0xff, 0x6e, 0xc5, 0x46, 0xff, 0x6e, 0xc6, 0x47, 0xff, 0x4d, 0x94, 0x41, 0xff, 0x0b, 0x0f, 0x62, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x1a, 0x82, 0xff, 0x00, 0x60, 0x2f, 0xff, 0x12, 0x83, 0x00, 0xff, 0x3b, 0x9d, 0x27, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4a, 0x95, 0x35, 0xff, 0x17, 0x2f, 0x39, 0xff, 0x00, 0x6a, 0x23, 0xff, 0x14, 0xa8, 0x35, 0xff, 0x3b, 0x6c, 0x99, 0xff, 0x19, 0x4e, 0xcb, 0xff, 0x0d, 0x33, 0x93, 0xff, 0x49, 0x3e, 0x6b, 0xff, 0x3c, 0x3b, 0xd2, 0xff, 0x93, 0x30, 0xf0, 0xff, 0xca, 0x25, 0xc1, 0xff, 0xed, 0x22, 0xb0, 0xff, 0xf4, 0x1d, 0xa4, 0xff, 0x6a, 0x00, 0x73, 0xff, 0x00, 0x6c, 0x67, 0xff, 0x08, 0xb1, 0x7f, 0xff, 0x51, 0x89, 0x8e, 0xff, 0x5b, 0x84, 0x8d, 0xff, 0x4c, 0x80, 0x77, 0xff, 0x3f, 0x69, 0xb1, 0xff, 0x00, 0x97, 0x8b, 0xff, 0x00, 0xa5, 0x6e, 0xff, 0x8e, 0xb5, 0xb2, 0xff, 0x97, 0x9e, 0xc6, 0xff, 0x66, 0x99, 0xad, 0xff, 0x14, 0xa8, 0x83, 0xff, 0x00, 0xb2, 0x87, 0xff, 0x00, 0xb2, 0x89, 0xff, 0x00, 0xb2, 0x8a, 0xff, 0x00, 0xb2, 0x8f, 0xff, 0x00, 0xb2, 0x8c, 0xff, 0x0f, 0xae, 0x68, 0xff, 0x21, 0xac, 0x4d, 0xff, 0x26, 0xab, 0x4e, 0xff, 0x28, 0xab, 0x4e, 0xff, 0x2a, 0xab, 0x4e, 0xff, 0x2a, 0xab, 0x4f, 0xff, 0x2a, 0xac, 0x4f, 0xff, 0x2b, 0xab, 0x4f, 0xff, 0x28, 0xaa, 0x4d, 0xff, 0x31, 0xad, 0x49, 0xff, 0x56, 0xbb, 0x41, 0xff, 0x6d, 0xc6, 0x3b, 0xff, 0x6d, 0xc5, 0x38, 0xff, 0x6b, 0xc4, 0x36, 0xff, 0x6b, 0xc5, 0x37, 0xff, 0x6b, 0xc5, 0x37, 0xff, 0x6d, 0xc5, 0x36, 0xff, 0x6b, 0xc4, 0x35, 0xff, 0x6a, 0xc4, 0x33, 0xff, 0x6b, 0xc4, 0x32, 0xff, 0x6b, 0xc6, 0x32, 0xff, 0x6d, 0xc7, 0x32, 0xff, 0x71, 0xc8, 0x33, 0xff, 0x6f, 0xc4, 0x31, 0xff, 0x70, 0xc5, 0x31, 0xff, 0x6a, 0xc3, 0x2f, 0xff, 0x7e, 0x95, 0x06, 0xff, 0x6a, 0x81, 0x38, 0xff, 0x6a, 0xc1, 0x4a, 0xff, 0x69, 0xbc, 0x56, 0xff, 0x49, 0xa1, 0x68, 0xff, 0x6b, 0xc3, 0x4c, 0xff, 0x6c, 0xc6, 0x4a, 0xff, 0x55, 0xa5, 0x45, 0xff, 0x33, 0x32, 0x4d, 0xff, 0x07, 0x00, 0x73, 0xff, 0x00, 0x35, 0x59, 0xff, 0x00, 0x64, 0x02, 0xff, 0x0c, 0x85, 0x01, 0xff, 0x32, 0xb1, 0x11, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xb9, 0x8b, 0x2b, 0xff, 0x90, 0x34, 0x46, 0xff, 0x46, 0x14, 0x1a, 0xff, 0x3a, 0x86, 0x5f, 0xff, 0x8c, 0x8b, 0x79, 0xff, 0x2f, 0x89, 0xac, 0xff, 0x00, 0x83, 0xce, 0xff, 0x00, 0x54, 0xae, 0xff, 0x00, 0x06, 0xa3, 0xff, 0xb6, 0x28, 0xac, 0xff, 0xff, 0x33, 0xb4, 0xff, 0xff, 0x31, 0xa8, 0xff, 0xca, 0x20, 0x94, 0xff, 0x00, 0x00, 0x6e, 0xff, 0x00, 0x83, 0x72, 0xff, 0x00, 0xb5, 0x82, 0xff, 0x37, 0x97, 0x89, 0xff, 0x64, 0x7e, 0x80, 0xff, 0x50, 0x6b, 0x7b, 0xff, 0x55, 0x60, 0xb6, 0xff, 0x26, 0x95, 0x96, 0xff, 0x00, 0xac, 0x7b, 0xff, 0x24, 0xae, 0x8a, 0xff, 0x22, 0xae, 0x8a, 0xff, 0x00, 0xaf, 0x85, 0xff, 0x00, 0xaf, 0x8a, 0xff, 0x00, 0xb0, 0x8b, 0xff, 0x00, 0xb0, 0x8c, 0xff, 0x00, 0xb1, 0x8e, 0xff, 0x00, 0xb3, 0x91, 0xff, 0x00, 0xb1, 0x86, 0xff, 0x17, 0xad, 0x5b, 0xff, 0x23, 0xab, 0x4f, 0xff, 0x24, 0xab, 0x4f, 0xff, 0x26, 0xab, 0x50, 0xff, 0x29, 0xab, 0x4f, 0xff, 0x29, 0xab, 0x4f, 0xff, 0x27, 0xaa, 0x4f, 0xff, 0x25, 0xaa, 0x4e, 0xff, 0x40, 0xb1, 0x49, 0xff, 0x61, 0xc0, 0x41, 0xff, 0x6d, 0xc7, 0x3d, 0xff, 0x6e, 0xc8, 0x3d, 0xff, 0x6b, 0xc7, 0x39, 0xff, 0x69, 0xc5, 0x37, 0xff, 0x6b, 0xc5, 0x38, 0xff, 0x6b, 0xc6, 0x38, 0xff, 0x6d, 0xc6, 0x36, 0xff, 0x6c, 0xc6, 0x34, 0xff, 0x6b, 0xc6, 0x34, 0xff, 0x6b, 0xc6, 0x33, 0xff, 0x6c, 0xc7, 0x33, 0xff, 0x6e, 0xc8, 0x33, 0xff, 0x6d, 0xc4, 0x32, 0xff, 0x5a, 0xaa, 0x27, 0xff, 0x67, 0xb8, 0x30, 0xff, 0x6c, 0xbc, 0x2d, 0xff, 0x51, 0x83, 0x0f, 0xff, 0x49, 0x8f, 0x3d, 0xff, 0x6e, 0xc8, 0x4a, 0xff, 0x6e, 0xc5, 0x4e, 0xff, 0x68, 0xc1, 0x52, 0xff, 0x6b, 0xc5, 0x4a, 0xff, 0x6a, 0xc4, 0x4b, 0xff, 0x5e, 0xb4, 0x4a, 0xff, 0x4d, 0x53, 0x34, 0xff, 0x20, 0x00, 0x61, 0xff, 0x00, 0x49, 0x45, 0xff, 0x00, 0x6f, 0x00, 0xff, 0x07, 0x63, 0x02, 0xff, 0x2b, 0x9e, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x81, 0x78, 0x80, 0xff, 0xa2, 0x22, 0x71, 0xff, 0x7a, 0x02, 0x92, 0xff, 0x24, 0x2d, 0xcf, 0xff, 0x1f, 0x7e, 0xcb, 0xff, 0x58, 0x7e, 0xa4, 0xff, 0x48, 0x87, 0xbd, 0xff, 0x97, 0x6a, 0x79, 0xff, 0x6d, 0x26, 0x71, 0xff, 0x5f, 0x00, 0x53, 0xff, 0xad, 0x1c, 0x92, 0xff, 0xf2, 0x31, 0xac, 0xff, 0x81, 0x11, 0x82, 0xff, 0x00, 0x00, 0x68, 0xff, 0x01, 0x97, 0x7c, 0xff, 0x00, 0xb4, 0x85, 0xff, 0x3c, 0xa9, 0x93, 0xff, 0xa0, 0xac, 0xbc, 0xff, 0x75, 0xa5, 0xcb, 0xff, 0x45, 0xa3, 0xae, 0xff, 0x0e, 0xa9, 0x8c, 0xff, 0x00, 0xac, 0x87, 0xff, 0x00, 0xad, 0x89, 0xff, 0x00, 0xad, 0x89, 0xff, 0x00, 0xad, 0x8a, 0xff, 0x00, 0xaf, 0x8c, 0xff, 0x00, 0xb0, 0x8d, 0xff, 0x00, 0xb0, 0x8e, 0xff, 0x00, 0xb1, 0x8f, 0xff, 0x00, 0xb2, 0x91, 0xff, 0x02, 0xaf, 0x7c, 0xff, 0x1c, 0xac, 0x55, 0xff, 0x23, 0xa9, 0x53, 0xff, 0x22, 0xaa, 0x51, 0xff, 0x24, 0xaa, 0x51, 0xff, 0x27, 0xa9, 0x50, 0xff, 0x26, 0xa9, 0x50, 0xff, 0x28, 0xaa, 0x4e, 0xff, 0x4e, 0xb7, 0x46, 0xff, 0x6a, 0xc6, 0x40, 0xff, 0x6c, 0xc8, 0x3e, 0xff, 0x6b, 0xc8, 0x3e, 0xff, 0x6d, 0xc9, 0x3d, 0xff, 0x6a, 0xc7, 0x3b, 0xff, 0x69, 0xc6, 0x38, 0xff, 0x6a, 0xc6, 0x38, 0xff, 0x6b, 0xc7, 0x3a, 0xff, 0x6c, 0xc7, 0x38, 0xff, 0x6c, 0xc4, 0x35, 0xff, 0x6b, 0xc7, 0x35, 0xff, 0x6c, 0xc9, 0x35, 0xff, 0x6e, 0xc8, 0x34, 0xff, 0x6f, 0xca, 0x34, 0xff, 0x71, 0xc7, 0x33, 0xff, 0x66, 0xb5, 0x2e, 0xff, 0x69, 0xb6, 0x30, 0xff, 0x67, 0xb2, 0x29, 0xff, 0x40, 0x7d, 0x29, 0xff, 0x50, 0xa3, 0x3f, 0xff, 0x6c, 0xc9, 0x4a, 0xff, 0x69, 0xc4, 0x49, 0xff, 0x66, 0xc0, 0x47, 0xff, 0x65, 0xc0, 0x49, 0xff, 0x69, 0xc4, 0x4e, 0xff, 0x62, 0xbc, 0x4e, 0xff, 0x44, 0x70, 0x30, 0xff, 0x26, 0x0c, 0x4c, 0xff, 0x00, 0x5b, 0x30, 0xff, 0x05, 0x7c, 0x00, 0xff, 0x04, 0x47, 0x01, 0xff, 0x24, 0x73, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x95, 0xff, 0x00, 0xff, 0x42, 0x76, 0xc3, 0xff, 0x00, 0x22, 0xcd, 0xff, 0x0c, 0x44, 0xe9, 0xff, 0x00, 0x31, 0xcd, 0xff, 0x00, 0x56, 0xa5, 0xff, 0x53, 0x75, 0x83, 0xff, 0x78, 0x7e, 0xc1, 0xff, 0xb7, 0x75, 0x8a, 0xff, 0x80, 0x3a, 0x8b, 0xff, 0x3b, 0x00, 0x65, 0xff, 0x3c, 0x00, 0x8b, 0xff, 0x71, 0x15, 0xa7, 0xff, 0x24, 0x00, 0x76, 0xff, 0x00, 0x25, 0x67, 0xff, 0x00, 0xa5, 0x86, 0xff, 0x00, 0xb3, 0x8b, 0xff, 0x0b, 0xb0, 0x8d, 0xff, 0x27, 0xae, 0x93, 0xff, 0x00, 0xad, 0x8c, 0xff, 0x00, 0xac, 0x8a, 0xff, 0x00, 0xab, 0x8c, 0xff, 0x00, 0xab, 0x8a, 0xff, 0x00, 0xac, 0x8b, 0xff, 0x00, 0xad, 0x8b, 0xff, 0x00, 0xad, 0x8b, 0xff, 0x00, 0xaf, 0x8e, 0xff, 0x00, 0xb1, 0x8f, 0xff, 0x00, 0xb0, 0x8f, 0xff, 0x00, 0xb1, 0x8f, 0xff, 0x00, 0xb1, 0x8d, 0xff, 0x0b, 0xad, 0x6d, 0xff, 0x1c, 0xaa, 0x55, 0xff, 0x1f, 0xa8, 0x55, 0xff, 0x21, 0xa8, 0x54, 0xff, 0x22, 0xa9, 0x51, 0xff, 0x22, 0xa8, 0x51, 0xff, 0x32, 0xae, 0x4e, 0xff, 0x5a, 0xbf, 0x43, 0xff, 0x70, 0xca, 0x3e, 0xff, 0x6f, 0xca, 0x3e, 0xff, 0x6b, 0xca, 0x3e, 0xff, 0x6b, 0xc9, 0x3e, 0xff, 0x6c, 0xc9, 0x3e, 0xff, 0x6a, 0xc7, 0x3c, 0xff, 0x69, 0xc6, 0x3a, 0xff, 0x6b, 0xc8, 0x3a, 0xff, 0x6e, 0xca, 0x3b, 0xff, 0x68, 0xbc, 0x34, 0xff, 0x5b, 0xa3, 0x26, 0xff, 0x68, 0xbe, 0x32, 0xff, 0x6f, 0xcb, 0x37, 0xff, 0x6d, 0xca, 0x35, 0xff, 0x6f, 0xca, 0x35, 0xff, 0x71, 0xc8, 0x34, 0xff, 0x6d, 0xbe, 0x31, 0xff, 0x76, 0xc4, 0x34, 0xff, 0x63, 0xa7, 0x2b, 0xff, 0x3f, 0x7e, 0x3a, 0xff, 0x55, 0xab, 0x3e, 0xff, 0x68, 0xc3, 0x48, 0xff, 0x67, 0xc3, 0x4a, 0xff, 0x67, 0xc6, 0x4d, 0xff, 0x6a, 0xc8, 0x4e, 0xff, 0x69, 0xc7, 0x51, 0xff, 0x63, 0xc1, 0x52, 0xff, 0x3c, 0x83, 0x3b, 0xff, 0x20, 0x33, 0x3b, 0xff, 0x03, 0x6c, 0x1d, 0xff, 0x10, 0x82, 0x00, 0xff, 0x00, 0x46, 0x00, 0xff, 0x23, 0x6c, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x6b, 0xd7, 0x00, 0xff, 0x27, 0x79, 0xa6, 0xff, 0x13, 0x1f, 0xbe, 0xff, 0x2a, 0x31, 0xd6, 0xff, 0x25, 0x29, 0xc1, 0xff, 0x25, 0x71, 0x93, 0xff, 0x29, 0x8a, 0x84, 0xff, 0x50, 0x32, 0xe6, 0xff, 0x4d, 0x35, 0xd3, 0xff, 0x00, 0x00, 0x8c, 0xff, 0x09, 0x00, 0x67, 0xff, 0x91, 0x00, 0x95, 0xff, 0x6c, 0x04, 0x9f, 0xff, 0x00, 0x00, 0x6f, 0xff, 0x02, 0x4f, 0x63, 0xff, 0x00, 0xac, 0x87, 0xff, 0x00, 0xb1, 0x8e, 0xff, 0x00, 0xaf, 0x8d, 0xff, 0x00, 0xae, 0x8d, 0xff, 0x00, 0xad, 0x8e, 0xff, 0x00, 0xac, 0x8f, 0xff, 0x00, 0xab, 0x8d, 0xff, 0x00, 0xab, 0x8c, 0xff, 0x00, 0xac, 0x8b, 0xff, 0x00, 0xad, 0x8b, 0xff, 0x00, 0xae, 0x8d, 0xff, 0x00, 0xae, 0x90, 0xff, 0x00, 0xaf, 0x90, 0xff, 0x00, 0xb0, 0x8e, 0xff, 0x00, 0xb0, 0x8f, 0xff, 0x00, 0xae, 0x86, 0xff, 0x12, 0xaa, 0x5f, 0xff, 0x1a, 0xa9, 0x55, 0xff, 0x1c, 0xa8, 0x56, 0xff, 0x1d, 0xa7, 0x55, 0xff, 0x1d, 0xa7, 0x53, 0xff, 0x40, 0xb3, 0x4b, 0xff, 0x65, 0xc5, 0x41, 0xff, 0x70, 0xcc, 0x3c, 0xff, 0x6e, 0xcc, 0x3d, 0xff, 0x6d, 0xcb, 0x3d, 0xff, 0x6c, 0xc9, 0x3e, 0xff, 0x6c, 0xca, 0x3e, 0xff, 0x6b, 0xca, 0x3f, 0xff, 0x6b, 0xc9, 0x3e, 0xff, 0x6a, 0xc7, 0x3c, 0xff, 0x6b, 0xc8, 0x3b, 0xff, 0x6e, 0xcb, 0x3d, 0xff, 0x67, 0xb8, 0x35, 0xff, 0x52, 0x94, 0x22, 0xff, 0x64, 0xb3, 0x32, 0xff, 0x71, 0xcd, 0x39, 0xff, 0x6d, 0xcb, 0x36, 0xff, 0x6d, 0xca, 0x36, 0xff, 0x6f, 0xc8, 0x36, 0xff, 0x70, 0xc6, 0x35, 0xff, 0x6e, 0xbd, 0x2f, 0xff, 0x5b, 0x98, 0x30, 0xff, 0x48, 0x88, 0x41, 0xff, 0x5d, 0xb9, 0x44, 0xff, 0x6a, 0xc8, 0x4e, 0xff, 0x6a, 0xca, 0x50, 0xff, 0x66, 0xc8, 0x51, 0xff, 0x61, 0xc3, 0x55, 0xff, 0x66, 0xc6, 0x53, 0xff, 0x65, 0xc4, 0x54, 0xff, 0x41, 0x90, 0x45, 0xff, 0x27, 0x4c, 0x23, 0xff, 0x15, 0x73, 0x02, 0xff, 0x16, 0x84, 0x00, 0xff, 0x02, 0x4f, 0x00, 0xff, 0x1c, 0x5d, 0x04, 0xff, 0x49, 0xc8, 0x12, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xad, 0x00, 0xff, 0x02, 0x9e, 0x50, 0xff, 0x32, 0x4f, 0x90, 0xff, 0x6c, 0x00, 0x7e, 0xff, 0x95, 0x20, 0x96, 0xff, 0x3e, 0x85, 0x7e, 0xff, 0x2e, 0x9a, 0x59, 0xff, 0x00, 0x2d, 0xd1, 0xff, 0x00, 0x00, 0xc9, 0xff, 0x00, 0x1c, 0xcf, 0xff, 0x00, 0x21, 0xb1, 0xff, 0x43, 0x08, 0x8b, 0xff, 0x4c, 0x1e, 0xa1, 0xff, 0x00, 0x70, 0x5f, 0xff, 0x10, 0xa8, 0x3e, 0xff, 0x05, 0xb6, 0x64, 0xff, 0x00, 0xaf, 0x7f, 0xff, 0x00, 0xaf, 0x8e, 0xff, 0x00, 0xae, 0x91, 0xff, 0x00, 0xae, 0x90, 0xff, 0x00, 0xad, 0x8f, 0xff, 0x00, 0xac, 0x8e, 0xff, 0x00, 0xac, 0x8e, 0xff, 0x00, 0xac, 0x8e, 0xff, 0x00, 0xad, 0x8d, 0xff, 0x00, 0xae, 0x8e, 0xff, 0x00, 0xae, 0x90, 0xff, 0x00, 0xaf, 0x8e, 0xff, 0x00, 0xaf, 0x8e, 0xff, 0x00, 0xb0, 0x8e, 0xff, 0x02, 0xad, 0x79, 0xff, 0x15, 0xa9, 0x59, 0xff, 0x19, 0xa9, 0x57, 0xff, 0x13, 0xa7, 0x55, 0xff, 0x22, 0xaa, 0x53, 0xff, 0x53, 0xba, 0x4a, 0xff, 0x6f, 0xca, 0x3f, 0xff, 0x70, 0xcc, 0x3e, 0xff, 0x6c, 0xcb, 0x3e, 0xff, 0x6c, 0xcb, 0x3e, 0xff, 0x6c, 0xcb, 0x3e, 0xff, 0x6d, 0xc9, 0x3d, 0xff, 0x66, 0xbd, 0x3b, 0xff, 0x67, 0xbb, 0x3d, 0xff, 0x6d, 0xc9, 0x3f, 0xff, 0x6b, 0xc7, 0x3d, 0xff, 0x6a, 0xc7, 0x3d, 0xff, 0x6d, 0xc9, 0x3e, 0xff, 0x6c, 0xc2, 0x3a, 0xff, 0x5c, 0xa6, 0x2e, 0xff, 0x6a, 0xbd, 0x36, 0xff, 0x72, 0xcc, 0x3a, 0xff, 0x6e, 0xca, 0x36, 0xff, 0x6c, 0xc6, 0x34, 0xff, 0x6a, 0xc2, 0x33, 0xff, 0x6c, 0xc2, 0x32, 0xff, 0x68, 0xb8, 0x2b, 0xff, 0x5c, 0x91, 0x3b, 0xff, 0x51, 0x9a, 0x41, 0xff, 0x60, 0xc2, 0x49, 0xff, 0x66, 0xc7, 0x50, 0xff, 0x6a, 0xcb, 0x4f, 0xff, 0x5a, 0xb6, 0x61, 0xff, 0x3b, 0x93, 0x73, 0xff, 0x62, 0xc0, 0x5a, 0xff, 0x6a, 0xc8, 0x56, 0xff, 0x4c, 0x9e, 0x48, 0xff, 0x41, 0x57, 0x18, 0xff, 0x37, 0x64, 0x00, 0xff, 0x1e, 0x81, 0x00, 0xff, 0x0a, 0x5e, 0x00, 0xff, 0x11, 0x50, 0x04, 0xff, 0x40, 0xac, 0x13, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x96, 0x0a, 0xff, 0x00, 0x98, 0x1e, 0xff, 0x2d, 0x7e, 0x7c, 0xff, 0x52, 0x38, 0xa9, 0xff, 0x50, 0x90, 0xca, 0xff, 0x1d, 0x99, 0x55, 0xff, 0x3a, 0x99, 0x3f, 0xff, 0x1a, 0x4c, 0xb4, 0xff, 0x36, 0x2c, 0xc5, 0xff, 0x20, 0x2a, 0xc7, 0xff, 0x00, 0x1c, 0xc3, 0xff, 0x00, 0x00, 0xd1, 0xff, 0x00, 0x43, 0xa5, 0xff, 0x12, 0xaa, 0x2b, 0xff, 0x19, 0xbd, 0x3d, 0xff, 0x14, 0xbd, 0x51, 0xff, 0x00, 0xae, 0x58, 0xff, 0x00, 0xad, 0x6d, 0xff, 0x00, 0xae, 0x88, 0xff, 0x00, 0xae, 0x90, 0xff, 0x00, 0xad, 0x8f, 0xff, 0x00, 0xac, 0x8f, 0xff, 0x00, 0xad, 0x8f, 0xff, 0x00, 0xad, 0x8f, 0xff, 0x00, 0xab, 0x8d, 0xff, 0x00, 0xac, 0x8d, 0xff, 0x00, 0xae, 0x8e, 0xff, 0x00, 0xaf, 0x8d, 0xff, 0x00, 0xaf, 0x8f, 0xff, 0x00, 0xaf, 0x8b, 0xff, 0x06, 0xab, 0x6a, 0xff, 0x14, 0xa8, 0x56, 0xff, 0x0c, 0xa7, 0x57, 0xff, 0x30, 0xaf, 0x50, 0xff, 0x62, 0xc2, 0x45, 0xff, 0x77, 0xcc, 0x42, 0xff, 0x75, 0xce, 0x41, 0xff, 0x70, 0xcc, 0x41, 0xff, 0x6c, 0xca, 0x3f, 0xff, 0x6b, 0xcb, 0x3f, 0xff, 0x6c, 0xcb, 0x3f, 0xff, 0x6f, 0xc9, 0x3e, 0xff, 0x66, 0xb4, 0x3a, 0xff, 0x68, 0xb5, 0x3c, 0xff, 0x70, 0xc8, 0x3f, 0xff, 0x6d, 0xc8, 0x3d, 0xff, 0x6b, 0xc7, 0x3d, 0xff, 0x6e, 0xc8, 0x3d, 0xff, 0x70, 0xc9, 0x3c, 0xff, 0x71, 0xc8, 0x3a, 0xff, 0x6f, 0xc6, 0x38, 0xff, 0x6d, 0xc4, 0x37, 0xff, 0x6f, 0xc5, 0x37, 0xff, 0x70, 0xc7, 0x3a, 0xff, 0x72, 0xcb, 0x3a, 0xff, 0x6f, 0xc9, 0x33, 0xff, 0x63, 0xb3, 0x2d, 0xff, 0x57, 0x88, 0x4b, 0xff, 0x55, 0xa7, 0x42, 0xff, 0x61, 0xc6, 0x4d, 0xff, 0x64, 0xc7, 0x51, 0xff, 0x69, 0xca, 0x53, 0xff, 0x63, 0xbe, 0x5f, 0xff, 0x48, 0x99, 0x6e, 0xff, 0x5e, 0xba, 0x5e, 0xff, 0x6b, 0xca, 0x56, 0xff, 0x56, 0xad, 0x4e, 0xff, 0x40, 0x5c, 0x24, 0xff, 0x51, 0x59, 0x00, 0xff, 0x39, 0x6b, 0x00, 0xff, 0x00, 0x61, 0x01, 0xff, 0x3e, 0x37, 0x17, 0xff, 0x49, 0x83, 0x23, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x54, 0xc5, 0x08, 0xff, 0x3c, 0xac, 0x00, 0xff, 0x5e, 0xa3, 0x36, 0xff, 0x5e, 0xae, 0xd2, 0xff, 0x00, 0xa3, 0xc9, 0xff, 0x24, 0x9a, 0x2b, 0xff, 0x3c, 0x8e, 0x4e, 0xff, 0x2f, 0x5c, 0xac, 0xff, 0x33, 0x25, 0xd0, 0xff, 0x21, 0x26, 0xdb, 0xff, 0x42, 0x0c, 0xdf, 0xff, 0x25, 0x00, 0xdb, 0xff, 0x00, 0x1a, 0x4b, 0xff, 0x0e, 0xa0, 0x2a, 0xff, 0x1c, 0xc1, 0x4a, 0xff, 0x1c, 0xc2, 0x51, 0xff, 0x0b, 0xb7, 0x52, 0xff, 0x00, 0xad, 0x52, 0xff, 0x00, 0xae, 0x5c, 0xff, 0x00, 0xae, 0x73, 0xff, 0x00, 0xad, 0x89, 0xff, 0x00, 0xac, 0x91, 0xff, 0x00, 0xac, 0x91, 0xff, 0x00, 0xac, 0x90, 0xff, 0x00, 0xac, 0x8e, 0xff, 0x00, 0xac, 0x8e, 0xff, 0x00, 0xad, 0x8e, 0xff, 0x00, 0xaf, 0x8e, 0xff, 0x00, 0xaf, 0x90, 0xff, 0x00, 0xad, 0x84, 0xff, 0x05, 0xa8, 0x62, 0xff, 0x10, 0xa8, 0x58, 0xff, 0x46, 0xb6, 0x50, 0xff, 0x6c, 0xc6, 0x46, 0xff, 0x77, 0xcc, 0x43, 0xff, 0x76, 0xcd, 0x43, 0xff, 0x73, 0xc6, 0x41, 0xff, 0x70, 0xc7, 0x42, 0xff, 0x6d, 0xcb, 0x42, 0xff, 0x6c, 0xca, 0x40, 0xff, 0x6c, 0xc9, 0x3f, 0xff, 0x71, 0xcb, 0x3f, 0xff, 0x6f, 0xbc, 0x3d, 0xff, 0x68, 0xb0, 0x3a, 0xff, 0x6f, 0xc4, 0x3d, 0xff, 0x70, 0xc9, 0x3e, 0xff, 0x6e, 0xc7, 0x3d, 0xff, 0x6d, 0xc5, 0x3b, 0xff, 0x6a, 0xc2, 0x3b, 0xff, 0x6a, 0xc2, 0x38, 0xff, 0x6d, 0xc5, 0x38, 0xff, 0x72, 0xcb, 0x39, 0xff, 0x72, 0xcc, 0x3a, 0xff, 0x71, 0xca, 0x3c, 0xff, 0x72, 0xcb, 0x38, 0xff, 0x6b, 0xc6, 0x2e, 0xff, 0x55, 0xa1, 0x2a, 0xff, 0x50, 0x87, 0x4d, 0xff, 0x5b, 0xb8, 0x48, 0xff, 0x62, 0xcb, 0x50, 0xff, 0x62, 0xc6, 0x5a, 0xff, 0x68, 0xc8, 0x57, 0xff, 0x63, 0xc1, 0x5a, 0xff, 0x31, 0x8a, 0x7b, 0xff, 0x51, 0xb0, 0x67, 0xff, 0x69, 0xca, 0x53, 0xff, 0x5b, 0xb9, 0x51, 0xff, 0x3f, 0x66, 0x31, 0xff, 0x55, 0x5b, 0x06, 0xff, 0x7d, 0x53, 0x00, 0xff, 0x82, 0x47, 0x03, 0xff, 0x6e, 0x25, 0x18, 0xff, 0x45, 0x71, 0x1e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x55, 0xff, 0x1f, 0xb0, 0x23, 0xff, 0x91, 0xdf, 0x00, 0xff, 0xbd, 0xdd, 0x00, 0xff, 0xa5, 0xa5, 0x8b, 0xff, 0x00, 0x8c, 0x90, 0xff, 0x29, 0xa3, 0x37, 0xff, 0x48, 0x7a, 0x69, 0xff, 0x42, 0x65, 0x92, 0xff, 0x00, 0x22, 0xc0, 0xff, 0x52, 0x0c, 0xcb, 0xff, 0xad, 0x0d, 0xa5, 0xff, 0x40, 0x02, 0x78, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x90, 0x34, 0xff, 0x1f, 0xc5, 0x4f, 0xff, 0x20, 0xc2, 0x4e, 0xff, 0x1a, 0xbf, 0x4e, 0xff, 0x05, 0xb3, 0x54, 0xff, 0x00, 0xae, 0x55, 0xff, 0x00, 0xaf, 0x54, 0xff, 0x00, 0xae, 0x61, 0xff, 0x00, 0xae, 0x7b, 0xff, 0x00, 0xad, 0x8f, 0xff, 0x00, 0xad, 0x94, 0xff, 0x00, 0xae, 0x91, 0xff, 0x00, 0xad, 0x8f, 0xff, 0x00, 0xad, 0x90, 0xff, 0x00, 0xae, 0x90, 0xff, 0x00, 0xae, 0x90, 0xff, 0x00, 0xaa, 0x7c, 0xff, 0x1c, 0xaa, 0x5a, 0xff, 0x52, 0xbc, 0x4b, 0xff, 0x72, 0xca, 0x45, 0xff, 0x76, 0xcb, 0x45, 0xff, 0x74, 0xcc, 0x45, 0xff, 0x71, 0xc7, 0x42, 0xff, 0x65, 0xa9, 0x3e, 0xff, 0x71, 0xc2, 0x44, 0xff, 0x71, 0xcb, 0x42, 0xff, 0x6e, 0xcb, 0x41, 0xff, 0x6c, 0xc9, 0x3f, 0xff, 0x6f, 0xcb, 0x3f, 0xff, 0x6f, 0xc5, 0x3e, 0xff, 0x71, 0xc6, 0x3f, 0xff, 0x70, 0xc7, 0x3d, 0xff, 0x6c, 0xc2, 0x3b, 0xff, 0x6b, 0xc1, 0x3a, 0xff, 0x6b, 0xc4, 0x38, 0xff, 0x6c, 0xc8, 0x3a, 0xff, 0x6e, 0xcb, 0x3d, 0xff, 0x70, 0xcc, 0x3b, 0xff, 0x71, 0xcc, 0x39, 0xff, 0x71, 0xcb, 0x39, 0xff, 0x6f, 0xc8, 0x3b, 0xff, 0x70, 0xca, 0x36, 0xff, 0x67, 0xc1, 0x2f, 0xff, 0x42, 0x88, 0x30, 0xff, 0x43, 0x8b, 0x3e, 0xff, 0x5e, 0xc5, 0x4d, 0xff, 0x61, 0xcc, 0x52, 0xff, 0x64, 0xc6, 0x53, 0xff, 0x68, 0xc7, 0x57, 0xff, 0x64, 0xc3, 0x5a, 0xff, 0x52, 0xb0, 0x67, 0xff, 0x5a, 0xbe, 0x60, 0xff, 0x64, 0xc8, 0x56, 0xff, 0x5e, 0xc1, 0x54, 0xff, 0x3e, 0x75, 0x3c, 0xff, 0x71, 0x4e, 0x13, 0xff, 0xce, 0x43, 0x00, 0xff, 0xe8, 0x37, 0x01, 0xff, 0x7b, 0x1c, 0x06, 0xff, 0x00, 0x64, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x69, 0xb4, 0x00, 0xff, 0x8b, 0xd6, 0x00, 0xff, 0x7b, 0xc3, 0x66, 0xff, 0x70, 0x8a, 0x7e, 0xff, 0x97, 0x55, 0x4b, 0xff, 0x39, 0x8d, 0x63, 0xff, 0x2e, 0xa2, 0x45, 0xff, 0x5d, 0x72, 0x66, 0xff, 0x58, 0x67, 0x8b, 0xff, 0x00, 0x23, 0xa4, 0xff, 0x69, 0x0b, 0xcd, 0xff, 0x75, 0x08, 0x7a, 0xff, 0x00, 0x00, 0x2a, 0xff, 0x00, 0x04, 0x6b, 0xff, 0x0b, 0x86, 0xaf, 0xff, 0x1e, 0xc4, 0x48, 0xff, 0x21, 0xc1, 0x4d, 0xff, 0x20, 0xc0, 0x4d, 0xff, 0x18, 0xbc, 0x4f, 0xff, 0x01, 0xb1, 0x56, 0xff, 0x00, 0xae, 0x57, 0xff, 0x00, 0xad, 0x56, 0xff, 0x00, 0xae, 0x59, 0xff, 0x00, 0xad, 0x6c, 0xff, 0x00, 0xac, 0x84, 0xff, 0x00, 0xad, 0x90, 0xff, 0x00, 0xb0, 0x91, 0xff, 0x00, 0xb0, 0x91, 0xff, 0x00, 0xaf, 0x92, 0xff, 0x00, 0xad, 0x8d, 0xff, 0x29, 0xaf, 0x6b, 0xff, 0x5f, 0xc3, 0x48, 0xff, 0x71, 0xce, 0x42, 0xff, 0x72, 0xcc, 0x43, 0xff, 0x71, 0xcb, 0x44, 0xff, 0x72, 0xcd, 0x44, 0xff, 0x74, 0xca, 0x43, 0xff, 0x6b, 0xb5, 0x3f, 0xff, 0x67, 0xb3, 0x3e, 0xff, 0x71, 0xca, 0x42, 0xff, 0x6f, 0xcb, 0x40, 0xff, 0x6d, 0xca, 0x3f, 0xff, 0x6c, 0xc8, 0x3d, 0xff, 0x6c, 0xc6, 0x3d, 0xff, 0x6d, 0xc4, 0x3e, 0xff, 0x6c, 0xc2, 0x3e, 0xff, 0x6c, 0xc4, 0x3c, 0xff, 0x6d, 0xc7, 0x3b, 0xff, 0x6e, 0xca, 0x3a, 0xff, 0x6b, 0xca, 0x3b, 0xff, 0x6b, 0xca, 0x3b, 0xff, 0x6e, 0xca, 0x39, 0xff, 0x70, 0xcb, 0x38, 0xff, 0x70, 0xcb, 0x38, 0xff, 0x6f, 0xc8, 0x39, 0xff, 0x6f, 0xc7, 0x35, 0xff, 0x61, 0xb8, 0x35, 0xff, 0x51, 0x9c, 0x43, 0xff, 0x40, 0x8f, 0x39, 0xff, 0x5f, 0xca, 0x50, 0xff, 0x61, 0xcc, 0x52, 0xff, 0x61, 0xc8, 0x5f, 0xff, 0x64, 0xc7, 0x5e, 0xff, 0x63, 0xc7, 0x5a, 0xff, 0x64, 0xc8, 0x5d, 0xff, 0x62, 0xc8, 0x5b, 0xff, 0x60, 0xc7, 0x59, 0xff, 0x5f, 0xc5, 0x57, 0xff, 0x3e, 0x8a, 0x44, 0xff, 0xac, 0x39, 0x18, 0xff, 0xec, 0x2b, 0x00, 0xff, 0xfd, 0x34, 0x00, 0xff, 0x83, 0x10, 0x3d, 0xff, 0x00, 0x5a, 0x49, 0xff, 0x55, 0xd5, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xa0, 0xd6, 0x63, 0xff, 0x96, 0xcf, 0x7c, 0xff, 0x3e, 0x99, 0xbd, 0xff, 0x00, 0x83, 0xaf, 0xff, 0x49, 0x92, 0x79, 0xff, 0x28, 0x95, 0x2d, 0xff, 0x3a, 0x9c, 0x4a, 0xff, 0x69, 0x6d, 0x5d, 0xff, 0x71, 0x74, 0x64, 0xff, 0x39, 0x44, 0x66, 0xff, 0x45, 0x00, 0xd8, 0xff, 0x08, 0x07, 0xda, 0xff, 0x00, 0x08, 0x5f, 0xff, 0x02, 0x6c, 0xd9, 0xff, 0x02, 0x89, 0xed, 0xff, 0x1c, 0xbe, 0x59, 0xff, 0x22, 0xc3, 0x48, 0xff, 0x22, 0xc1, 0x4d, 0xff, 0x21, 0xc1, 0x4e, 0xff, 0x14, 0xba, 0x52, 0xff, 0x00, 0xae, 0x58, 0xff, 0x00, 0xad, 0x5a, 0xff, 0x00, 0xad, 0x5c, 0xff, 0x00, 0xad, 0x5a, 0xff, 0x00, 0xae, 0x5e, 0xff, 0x00, 0xae, 0x70, 0xff, 0x00, 0xae, 0x86, 0xff, 0x00, 0xb1, 0x93, 0xff, 0x00, 0xb1, 0x93, 0xff, 0x37, 0xb8, 0x75, 0xff, 0x64, 0xc5, 0x49, 0xff, 0x6d, 0xc4, 0x41, 0xff, 0x69, 0xc0, 0x40, 0xff, 0x70, 0xcc, 0x43, 0xff, 0x6f, 0xcc, 0x41, 0xff, 0x71, 0xcd, 0x42, 0xff, 0x73, 0xcb, 0x41, 0xff, 0x72, 0xc5, 0x3f, 0xff, 0x74, 0xca, 0x40, 0xff, 0x72, 0xcb, 0x41, 0xff, 0x6d, 0xc7, 0x3f, 0xff, 0x6b, 0xc2, 0x3f, 0xff, 0x6a, 0xc1, 0x3f, 0xff, 0x69, 0xc3, 0x3e, 0xff, 0x6d, 0xc8, 0x3f, 0xff, 0x6e, 0xc9, 0x3e, 0xff, 0x6d, 0xc9, 0x3d, 0xff, 0x6a, 0xc6, 0x39, 0xff, 0x6e, 0xc9, 0x3a, 0xff, 0x6b, 0xc9, 0x3a, 0xff, 0x6a, 0xc9, 0x39, 0xff, 0x6d, 0xca, 0x37, 0xff, 0x6e, 0xcb, 0x36, 0xff, 0x6f, 0xcb, 0x37, 0xff, 0x6e, 0xc9, 0x37, 0xff, 0x6b, 0xc1, 0x37, 0xff, 0x5e, 0xb1, 0x39, 0xff, 0x5a, 0xa2, 0x41, 0xff, 0x43, 0x96, 0x3e, 0xff, 0x5e, 0xc9, 0x52, 0xff, 0x62, 0xcb, 0x50, 0xff, 0x5c, 0xc5, 0x83, 0xff, 0x5c, 0xc4, 0x7d, 0xff, 0x62, 0xc6, 0x56, 0xff, 0x61, 0xc6, 0x5b, 0xff, 0x62, 0xc4, 0x61, 0xff, 0x5f, 0xc3, 0x5b, 0xff, 0x5e, 0xc4, 0x59, 0xff, 0x44, 0x9c, 0x4b, 0xff, 0x7e, 0x30, 0x39, 0xff, 0xca, 0x0a, 0x11, 0xff, 0xdc, 0x1e, 0x00, 0xff, 0x51, 0x00, 0x53, 0xff, 0x13, 0x6c, 0x4a, 0xff, 0x4e, 0xc4, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x6d, 0xa5, 0xa9, 0xff, 0x4b, 0x97, 0xc1, 0xff, 0x00, 0xa4, 0x9e, 0xff, 0x00, 0xbf, 0xac, 0xff, 0x00, 0xaa, 0x87, 0xff, 0x0e, 0x9e, 0x31, 0xff, 0x23, 0x87, 0x59, 0xff, 0x42, 0x57, 0x6e, 0xff, 0x5b, 0x6c, 0x72, 0xff, 0x48, 0x68, 0x70, 0xff, 0x00, 0x00, 0xa0, 0xff, 0x00, 0x00, 0xdf, 0xff, 0x03, 0x53, 0xda, 0xff, 0x01, 0x94, 0xff, 0xff, 0x00, 0x89, 0xfb, 0xff, 0x16, 0xb2, 0x85, 0xff, 0x23, 0xc3, 0x3f, 0xff, 0x24, 0xc0, 0x4e, 0xff, 0x23, 0xc0, 0x50, 0xff, 0x23, 0xc0, 0x51, 0xff, 0x0e, 0xb6, 0x56, 0xff, 0x00, 0xac, 0x5c, 0xff, 0x00, 0xad, 0x5d, 0xff, 0x00, 0xad, 0x5d, 0xff, 0x00, 0xaf, 0x5c, 0xff, 0x00, 0xaf, 0x59, 0xff, 0x00, 0xae, 0x65, 0xff, 0x00, 0xb0, 0x7d, 0xff, 0x49, 0xbf, 0x70, 0xff, 0x6c, 0xcc, 0x4d, 0xff, 0x67, 0xc2, 0x43, 0xff, 0x60, 0xb5, 0x3d, 0xff, 0x6a, 0xc4, 0x40, 0xff, 0x70, 0xcd, 0x42, 0xff, 0x6e, 0xcc, 0x40, 0xff, 0x70, 0xcc, 0x40, 0xff, 0x72, 0xcc, 0x40, 0xff, 0x74, 0xca, 0x3f, 0xff, 0x6f, 0xc6, 0x3e, 0xff, 0x6b, 0xc2, 0x3d, 0xff, 0x6e, 0xc5, 0x40, 0xff, 0x6f, 0xc8, 0x41, 0xff, 0x6e, 0xc9, 0x40, 0xff, 0x6c, 0xc9, 0x3e, 0xff, 0x6c, 0xc9, 0x3d, 0xff, 0x6c, 0xc9, 0x3c, 0xff, 0x6c, 0xca, 0x3b, 0xff, 0x6b, 0xc7, 0x38, 0xff, 0x6e, 0xca, 0x39, 0xff, 0x6c, 0xca, 0x39, 0xff, 0x6c, 0xcb, 0x37, 0xff, 0x6d, 0xcc, 0x37, 0xff, 0x6d, 0xcb, 0x37, 0xff, 0x6e, 0xcc, 0x37, 0xff, 0x6d, 0xcb, 0x36, 0xff, 0x61, 0xbb, 0x3b, 0xff, 0x5d, 0xb0, 0x38, 0xff, 0x56, 0xa6, 0x43, 0xff, 0x56, 0xb9, 0x4d, 0xff, 0x5e, 0xc9, 0x55, 0xff, 0x60, 0xc9, 0x56, 0xff, 0x5f, 0xc7, 0x7b, 0xff, 0x5a, 0xc2, 0x90, 0xff, 0x5f, 0xc4, 0x53, 0xff, 0x5d, 0xc2, 0x5a, 0xff, 0x63, 0xc3, 0x68, 0xff, 0x60, 0xc4, 0x60, 0xff, 0x5e, 0xc4, 0x5d, 0xff, 0x50, 0xaa, 0x53, 0xff, 0x45, 0x3e, 0x47, 0xff, 0x88, 0x00, 0x41, 0xff, 0x95, 0x04, 0x29, 0xff, 0x0f, 0x11, 0x47, 0xff, 0x2a, 0x79, 0x1f, 0xff, 0x48, 0xb0, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x4a, 0x8a, 0xff, 0x00, 0x00, 0xd5, 0xff, 0x00, 0x67, 0xad, 0xff, 0x00, 0xba, 0xc3, 0xff, 0x05, 0xc4, 0xb2, 0xff, 0x12, 0x95, 0x3e, 0xff, 0x08, 0x6a, 0x6e, 0xff, 0x0e, 0x50, 0x7b, 0xff, 0x0f, 0x4e, 0x7a, 0xff, 0x43, 0x6a, 0x65, 0xff, 0x0f, 0x33, 0x85, 0xff, 0x00, 0x3f, 0xde, 0xff, 0x00, 0x45, 0xf4, 0xff, 0x01, 0x6b, 0xed, 0xff, 0x00, 0x73, 0xfa, 0xff, 0x07, 0x95, 0x97, 0xff, 0x22, 0xc4, 0x3d, 0xff, 0x24, 0xc0, 0x4f, 0xff, 0x24, 0xc0, 0x51, 0xff, 0x24, 0xc1, 0x52, 0xff, 0x22, 0xbe, 0x52, 0xff, 0x07, 0xb1, 0x5a, 0xff, 0x00, 0xac, 0x5e, 0xff, 0x00, 0xad, 0x5f, 0xff, 0x05, 0xa8, 0x58, 0xff, 0x20, 0xa0, 0x50, 0xff, 0x2a, 0xb4, 0x53, 0xff, 0x43, 0xbc, 0x4a, 0xff, 0x5b, 0xc4, 0x3e, 0xff, 0x67, 0xc9, 0x46, 0xff, 0x6a, 0xcb, 0x47, 0xff, 0x6c, 0xcc, 0x44, 0xff, 0x6d, 0xcb, 0x41, 0xff, 0x6c, 0xcb, 0x40, 0xff, 0x6b, 0xc9, 0x40, 0xff, 0x6b, 0xc6, 0x3e, 0xff, 0x6d, 0xc4, 0x3d, 0xff, 0x6f, 0xc7, 0x40, 0xff, 0x70, 0xca, 0x41, 0xff, 0x6d, 0xc7, 0x3f, 0xff, 0x6f, 0xc9, 0x40, 0xff, 0x6f, 0xca, 0x3f, 0xff, 0x6c, 0xca, 0x3e, 0xff, 0x6d, 0xc9, 0x3d, 0xff, 0x6d, 0xc9, 0x3c, 0xff, 0x6d, 0xcb, 0x3c, 0xff, 0x6c, 0xcb, 0x3b, 0xff, 0x6b, 0xc8, 0x37, 0xff, 0x6e, 0xcb, 0x38, 0xff, 0x6c, 0xcc, 0x39, 0xff, 0x6e, 0xcc, 0x37, 0xff, 0x6e, 0xcb, 0x36, 0xff, 0x6e, 0xcb, 0x36, 0xff, 0x70, 0xcd, 0x36, 0xff, 0x6b, 0xc8, 0x32, 0xff, 0x54, 0xb3, 0x40, 0xff, 0x5a, 0xb0, 0x37, 0xff, 0x4c, 0xaa, 0x45, 0xff, 0x5b, 0xc4, 0x4e, 0xff, 0x5d, 0xca, 0x54, 0xff, 0x5c, 0xc8, 0x57, 0xff, 0x5d, 0xc4, 0x63, 0xff, 0x5c, 0xc2, 0x74, 0xff, 0x5d, 0xc5, 0x5d, 0xff, 0x5f, 0xc7, 0x60, 0xff, 0x61, 0xc6, 0x5f, 0xff, 0x5f, 0xc4, 0x62, 0xff, 0x62, 0xc5, 0x61, 0xff, 0x5b, 0xb7, 0x5d, 0xff, 0x5e, 0x56, 0x44, 0xff, 0x4c, 0x00, 0x62, 0xff, 0x30, 0x00, 0x6f, 0xff, 0x25, 0x3b, 0x48, 0xff, 0x2a, 0x74, 0x00, 0xff, 0x3f, 0x9b, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x50, 0x9f, 0x00, 0xff, 0x10, 0x3d, 0x00, 0xff, 0x39, 0x00, 0xb9, 0xff, 0x49, 0x00, 0xbd, 0xff, 0x16, 0x00, 0x8a, 0xff, 0x46, 0x6f, 0x80, 0xff, 0x05, 0x8c, 0x5f, 0xff, 0x00, 0x61, 0x6d, 0xff, 0x00, 0x55, 0x70, 0xff, 0x00, 0x49, 0x6f, 0xff, 0x42, 0x68, 0x62, 0xff, 0x23, 0x41, 0xca, 0xff, 0x00, 0x3d, 0xff, 0xff, 0x00, 0x2e, 0xee, 0xff, 0x00, 0x00, 0xd2, 0xff, 0x11, 0x00, 0xd5, 0xff, 0x32, 0x76, 0xae, 0xff, 0x22, 0xc4, 0x47, 0xff, 0x24, 0xc1, 0x4f, 0xff, 0x24, 0xc2, 0x51, 0xff, 0x25, 0xc1, 0x52, 0xff, 0x26, 0xc1, 0x52, 0xff, 0x1b, 0xbd, 0x56, 0xff, 0x00, 0xb0, 0x5d, 0xff, 0x1e, 0xb2, 0x54, 0xff, 0x38, 0xa8, 0x42, 0xff, 0x36, 0x92, 0x42, 0xff, 0x4e, 0xb6, 0x3f, 0xff, 0x58, 0xc3, 0x3a, 0xff, 0x52, 0xc0, 0x39, 0xff, 0x55, 0xc0, 0x3a, 0xff, 0x60, 0xc5, 0x3f, 0xff, 0x66, 0xc9, 0x41, 0xff, 0x66, 0xc6, 0x3f, 0xff, 0x68, 0xc4, 0x3d, 0xff, 0x6d, 0xc5, 0x3e, 0xff, 0x70, 0xca, 0x3f, 0xff, 0x6f, 0xcd, 0x3f, 0xff, 0x6f, 0xce, 0x40, 0xff, 0x6f, 0xcd, 0x40, 0xff, 0x6d, 0xc9, 0x3f, 0xff, 0x6e, 0xc8, 0x40, 0xff, 0x6e, 0xcb, 0x3f, 0xff, 0x6d, 0xcb, 0x3e, 0xff, 0x6e, 0xcb, 0x3c, 0xff, 0x6f, 0xcb, 0x3c, 0xff, 0x6f, 0xcb, 0x3c, 0xff, 0x6e, 0xcd, 0x3a, 0xff, 0x6d, 0xc9, 0x37, 0xff, 0x6d, 0xca, 0x37, 0xff, 0x6d, 0xcd, 0x37, 0xff, 0x6c, 0xcd, 0x37, 0xff, 0x6d, 0xcc, 0x36, 0xff, 0x6e, 0xcc, 0x36, 0xff, 0x71, 0xce, 0x35, 0xff, 0x65, 0xc1, 0x32, 0xff, 0x51, 0xb1, 0x3e, 0xff, 0x57, 0xb0, 0x36, 0xff, 0x48, 0xae, 0x47, 0xff, 0x5b, 0xc7, 0x4b, 0xff, 0x59, 0xc6, 0x53, 0xff, 0x57, 0xc5, 0x55, 0xff, 0x59, 0xc7, 0x55, 0xff, 0x5d, 0xc7, 0x64, 0xff, 0x60, 0xc8, 0x66, 0xff, 0x5f, 0xc6, 0x62, 0xff, 0x56, 0xb9, 0x70, 0xff, 0x32, 0x95, 0x87, 0xff, 0x59, 0xbb, 0x6b, 0xff, 0x61, 0xc0, 0x62, 0xff, 0x6f, 0x6f, 0x49, 0xff, 0x6c, 0x00, 0x65, 0xff, 0x00, 0x00, 0x7b, 0xff, 0x22, 0x61, 0x4e, 0xff, 0x22, 0x6f, 0x00, 0xff, 0x35, 0x8f, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x39, 0x78, 0x1f, 0xff, 0x00, 0x2c, 0x00, 0xff, 0x5e, 0x00, 0x71, 0xff, 0xb7, 0x00, 0xc4, 0xff, 0xb2, 0x1f, 0x9b, 0xff, 0x5f, 0x6e, 0x96, 0xff, 0x00, 0x81, 0x64, 0xff, 0x00, 0x66, 0x60, 0xff, 0x00, 0x5e, 0x60, 0xff, 0x00, 0x52, 0x66, 0xff, 0x3e, 0x68, 0x60, 0xff, 0x39, 0x52, 0xaa, 0xff, 0x00, 0x35, 0xf7, 0xff, 0x18, 0x11, 0xf0, 0xff, 0x28, 0x00, 0xd9, 0xff, 0x4b, 0x00, 0xbc, 0xff, 0x72, 0x53, 0xb1, 0xff, 0x23, 0xbe, 0x57, 0xff, 0x23, 0xc2, 0x52, 0xff, 0x25, 0xc1, 0x55, 0xff, 0x26, 0xc1, 0x54, 0xff, 0x24, 0xc0, 0x54, 0xff, 0x2f, 0xc2, 0x4e, 0xff, 0x3c, 0xc0, 0x46, 0xff, 0x49, 0xbd, 0x39, 0xff, 0x4d, 0xba, 0x3d, 0xff, 0x3f, 0xa0, 0x4b, 0xff, 0x51, 0xba, 0x3a, 0xff, 0x58, 0xc6, 0x3b, 0xff, 0x54, 0xc1, 0x39, 0xff, 0x55, 0xbe, 0x37, 0xff, 0x58, 0xbd, 0x38, 0xff, 0x5d, 0xbe, 0x3c, 0xff, 0x70, 0xc9, 0x43, 0xff, 0x76, 0xcd, 0x42, 0xff, 0x74, 0xce, 0x40, 0xff, 0x70, 0xce, 0x3e, 0xff, 0x6a, 0xcd, 0x3e, 0xff, 0x6b, 0xcc, 0x3f, 0xff, 0x70, 0xcd, 0x3f, 0xff, 0x72, 0xcb, 0x40, 0xff, 0x6f, 0xc8, 0x41, 0xff, 0x70, 0xcc, 0x40, 0xff, 0x6e, 0xcc, 0x3e, 0xff, 0x6f, 0xcc, 0x3d, 0xff, 0x70, 0xcd, 0x3b, 0xff, 0x6f, 0xce, 0x3a, 0xff, 0x6f, 0xcd, 0x39, 0xff, 0x6f, 0xcb, 0x38, 0xff, 0x6c, 0xc9, 0x36, 0xff, 0x6c, 0xcd, 0x36, 0xff, 0x6c, 0xcd, 0x36, 0xff, 0x6d, 0xcd, 0x37, 0xff, 0x6f, 0xcd, 0x37, 0xff, 0x70, 0xcc, 0x35, 0xff, 0x5d, 0xbb, 0x32, 0xff, 0x52, 0xb1, 0x48, 0xff, 0x51, 0xac, 0x40, 0xff, 0x4b, 0xb6, 0x49, 0xff, 0x58, 0xc9, 0x54, 0xff, 0x58, 0xcb, 0x58, 0xff, 0x59, 0xcc, 0x5a, 0xff, 0x59, 0xcb, 0x57, 0xff, 0x5a, 0xc6, 0x8b, 0xff, 0x61, 0xc9, 0x70, 0xff, 0x44, 0xa6, 0x7b, 0xff, 0x47, 0xa4, 0x7d, 0xff, 0x3c, 0x9c, 0x82, 0xff, 0x51, 0xb3, 0x72, 0xff, 0x66, 0xc4, 0x65, 0xff, 0x63, 0x86, 0x4e, 0xff, 0x64, 0x1d, 0x62, 0xff, 0x00, 0x1a, 0x75, 0xff, 0x34, 0x89, 0x38, 0xff, 0x2f, 0x80, 0x00, 0xff, 0x28, 0x81, 0x03, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0x73, 0x1b, 0xff, 0x2b, 0x20, 0x00, 0xff, 0x66, 0x00, 0x0e, 0xff, 0xc1, 0x00, 0xae, 0xff, 0xd3, 0x2b, 0xc2, 0xff, 0x4a, 0x8e, 0x99, 0xff, 0x00, 0x88, 0x80, 0xff, 0x00, 0x64, 0x57, 0xff, 0x00, 0x66, 0x5f, 0xff, 0x00, 0x60, 0x5f, 0xff, 0x25, 0x68, 0x64, 0xff, 0x52, 0x6b, 0x70, 0xff, 0x70, 0x86, 0xb9, 0xff, 0xa5, 0x94, 0xd0, 0xff, 0x4f, 0x00, 0xff, 0xff, 0x16, 0x00, 0xe6, 0xff, 0x0b, 0x24, 0xbe, 0xff, 0x1f, 0xb1, 0x69, 0xff, 0x26, 0xc4, 0x53, 0xff, 0x24, 0xc1, 0x58, 0xff, 0x25, 0xc0, 0x53, 0xff, 0x36, 0xc1, 0x4b, 0xff, 0x51, 0xc5, 0x38, 0xff, 0x5c, 0xc7, 0x32, 0xff, 0x56, 0xc4, 0x36, 0xff, 0x54, 0xc4, 0x3a, 0xff, 0x56, 0xc5, 0x3c, 0xff, 0x57, 0xc6, 0x3b, 0xff, 0x54, 0xc0, 0x39, 0xff, 0x54, 0xbe, 0x37, 0xff, 0x58, 0xc0, 0x39, 0xff, 0x5c, 0xc4, 0x3b, 0xff, 0x5b, 0xc1, 0x39, 0xff, 0x65, 0xc6, 0x3b, 0xff, 0x70, 0xcd, 0x40, 0xff, 0x72, 0xce, 0x40, 0xff, 0x70, 0xcd, 0x3e, 0xff, 0x6e, 0xcc, 0x3e, 0xff, 0x6d, 0xcc, 0x3f, 0xff, 0x72, 0xcd, 0x3e, 0xff, 0x74, 0xcc, 0x40, 0xff, 0x6f, 0xc8, 0x40, 0xff, 0x72, 0xcd, 0x41, 0xff, 0x6f, 0xcd, 0x3f, 0xff, 0x6d, 0xcc, 0x3e, 0xff, 0x6e, 0xcd, 0x3b, 0xff, 0x6d, 0xce, 0x3a, 0xff, 0x6f, 0xcd, 0x3a, 0xff, 0x70, 0xcb, 0x3a, 0xff, 0x6a, 0xc7, 0x37, 0xff, 0x6b, 0xcd, 0x36, 0xff, 0x6b, 0xcd, 0x36, 0xff, 0x6c, 0xce, 0x38, 0xff, 0x70, 0xcf, 0x39, 0xff, 0x6a, 0xc6, 0x35, 0xff, 0x56, 0xb6, 0x30, 0xff, 0x58, 0xb6, 0x46, 0xff, 0x4c, 0xab, 0x50, 0xff, 0x55, 0xc4, 0x4e, 0xff, 0x5a, 0xcd, 0x5a, 0xff, 0x57, 0xc9, 0x58, 0xff, 0x54, 0xc4, 0x56, 0xff, 0x59, 0xcc, 0x5a, 0xff, 0x5e, 0xc8, 0x7a, 0xff, 0x64, 0xc8, 0x74, 0xff, 0x4f, 0xb3, 0x74, 0xff, 0x45, 0xa6, 0x7e, 0xff, 0x3e, 0xa1, 0x83, 0xff, 0x50, 0xb3, 0x76, 0xff, 0x65, 0xc6, 0x68, 0xff, 0x4f, 0x9e, 0x54, 0xff, 0x24, 0x3b, 0x6e, 0xff, 0x08, 0x49, 0x73, 0xff, 0x41, 0x9a, 0x0f, 0xff, 0x3a, 0x94, 0x00, 0xff, 0x0f, 0x81, 0x04, 0xff, 0x3a, 0xae, 0x17, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1d, 0x59, 0x0b, 0xff, 0x31, 0x2d, 0x01, 0xff, 0x4d, 0x00, 0x00, 0xff, 0x50, 0x56, 0x7d, 0xff, 0x50, 0x6b, 0x8b, 0xff, 0x22, 0xa2, 0x70, 0xff, 0x05, 0x89, 0x7d, 0xff, 0x00, 0x61, 0x5a, 0xff, 0x00, 0x6a, 0x63, 0xff, 0x00, 0x68, 0x62, 0xff, 0x00, 0x66, 0x63, 0xff, 0x83, 0x76, 0x54, 0xff, 0x88, 0x95, 0x60, 0xff, 0x61, 0x8f, 0x73, 0xff, 0x00, 0x00, 0xc5, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00, 0xc7, 0xff, 0x1f, 0x9e, 0x58, 0xff, 0x28, 0xc6, 0x56, 0xff, 0x2f, 0xc2, 0x53, 0xff, 0x47, 0xc5, 0x3f, 0xff, 0x56, 0xc7, 0x32, 0xff, 0x5a, 0xc6, 0x2e, 0xff, 0x5b, 0xc5, 0x30, 0xff, 0x5a, 0xc4, 0x35, 0xff, 0x54, 0xc1, 0x38, 0xff, 0x54, 0xc1, 0x39, 0xff, 0x55, 0xc1, 0x37, 0xff, 0x57, 0xc3, 0x36, 0xff, 0x59, 0xc6, 0x37, 0xff, 0x5a, 0xc8, 0x39, 0xff, 0x5b, 0xc7, 0x39, 0xff, 0x5a, 0xc4, 0x38, 0xff, 0x5a, 0xc2, 0x36, 0xff, 0x5f, 0xc7, 0x36, 0xff, 0x68, 0xca, 0x3a, 0xff, 0x70, 0xcd, 0x3e, 0xff, 0x71, 0xcd, 0x3f, 0xff, 0x71, 0xcd, 0x3e, 0xff, 0x72, 0xcd, 0x3f, 0xff, 0x73, 0xcd, 0x3e, 0xff, 0x70, 0xc8, 0x40, 0xff, 0x72, 0xcd, 0x42, 0xff, 0x6e, 0xcd, 0x40, 0xff, 0x6d, 0xcc, 0x3f, 0xff, 0x6d, 0xcb, 0x3d, 0xff, 0x6d, 0xcc, 0x3c, 0xff, 0x6e, 0xcd, 0x3c, 0xff, 0x6e, 0xcb, 0x3b, 0xff, 0x6a, 0xc7, 0x38, 0xff, 0x6d, 0xcc, 0x38, 0xff, 0x6a, 0xcb, 0x37, 0xff, 0x6b, 0xca, 0x36, 0xff, 0x6f, 0xcc, 0x37, 0xff, 0x5e, 0xbc, 0x35, 0xff, 0x59, 0xbb, 0x30, 0xff, 0x5a, 0xbc, 0x3b, 0xff, 0x48, 0xb1, 0x4e, 0xff, 0x5a, 0xc9, 0x52, 0xff, 0x51, 0xbb, 0x4f, 0xff, 0x48, 0xad, 0x48, 0xff, 0x38, 0x92, 0x37, 0xff, 0x54, 0xc3, 0x59, 0xff, 0x5c, 0xca, 0x65, 0xff, 0x63, 0xc9, 0x68, 0xff, 0x5b, 0xc2, 0x68, 0xff, 0x40, 0xa0, 0x88, 0xff, 0x34, 0x97, 0x8e, 0xff, 0x47, 0xaf, 0x7c, 0xff, 0x5f, 0xcb, 0x67, 0xff, 0x51, 0xb1, 0x57, 0xff, 0x36, 0x52, 0x61, 0xff, 0x1b, 0x6b, 0x66, 0xff, 0x2e, 0x99, 0x00, 0xff, 0x6e, 0xab, 0x00, 0xff, 0xbb, 0xd2, 0x02, 0xff, 0xba, 0xd8, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x06, 0x48, 0x01, 0xff, 0x00, 0x2d, 0x00, 0xff, 0x00, 0x4b, 0x00, 0xff, 0x00, 0x8e, 0x56, 0xff, 0x00, 0x9d, 0x69, 0xff, 0x10, 0xa4, 0x4a, 0xff, 0x0a, 0x7a, 0x62, 0xff, 0x00, 0x62, 0x60, 0xff, 0x00, 0x67, 0x61, 0xff, 0x00, 0x67, 0x62, 0xff, 0x00, 0x68, 0x63, 0xff, 0x00, 0x6c, 0x78, 0xff, 0x85, 0x90, 0x61, 0xff, 0x75, 0x87, 0x37, 0xff, 0x00, 0x24, 0x08, 0xff, 0x04, 0x20, 0x82, 0xff, 0x0d, 0x00, 0x86, 0xff, 0x1b, 0x84, 0x58, 0xff, 0x3b, 0xc8, 0x43, 0xff, 0x54, 0xc8, 0x36, 0xff, 0x5c, 0xc8, 0x2e, 0xff, 0x5c, 0xc8, 0x2f, 0xff, 0x5b, 0xc6, 0x30, 0xff, 0x5b, 0xc6, 0x2f, 0xff, 0x58, 0xc2, 0x33, 0xff, 0x58, 0xc3, 0x38, 0xff, 0x59, 0xc7, 0x38, 0xff, 0x5b, 0xc8, 0x38, 0xff, 0x5a, 0xc8, 0x37, 0xff, 0x59, 0xc7, 0x37, 0xff, 0x59, 0xc6, 0x37, 0xff, 0x5a, 0xc6, 0x37, 0xff, 0x5b, 0xc5, 0x38, 0xff, 0x59, 0xc2, 0x36, 0xff, 0x5c, 0xc5, 0x35, 0xff, 0x5b, 0xc4, 0x33, 0xff, 0x60, 0xc7, 0x35, 0xff, 0x6d, 0xcc, 0x3c, 0xff, 0x74, 0xcf, 0x3f, 0xff, 0x73, 0xce, 0x3f, 0xff, 0x72, 0xce, 0x3e, 0xff, 0x6f, 0xc9, 0x3e, 0xff, 0x71, 0xcc, 0x42, 0xff, 0x6f, 0xcc, 0x40, 0xff, 0x6c, 0xcc, 0x3f, 0xff, 0x6e, 0xcb, 0x3e, 0xff, 0x6f, 0xca, 0x3e, 0xff, 0x6e, 0xcb, 0x3e, 0xff, 0x6e, 0xcb, 0x3e, 0xff, 0x6c, 0xc8, 0x3a, 0xff, 0x6f, 0xc8, 0x38, 0xff, 0x6f, 0xca, 0x37, 0xff, 0x70, 0xce, 0x38, 0xff, 0x6b, 0xcc, 0x36, 0xff, 0x56, 0xbb, 0x35, 0xff, 0x5d, 0xc2, 0x2f, 0xff, 0x52, 0xb8, 0x31, 0xff, 0x49, 0xb8, 0x52, 0xff, 0x58, 0xca, 0x5a, 0xff, 0x3c, 0x9b, 0x40, 0xff, 0x41, 0x9e, 0x44, 0xff, 0x3f, 0x98, 0x3f, 0xff, 0x4c, 0xb6, 0x53, 0xff, 0x58, 0xc9, 0x67, 0xff, 0x61, 0xca, 0x6b, 0xff, 0x5e, 0xc8, 0x65, 0xff, 0x51, 0xbc, 0x75, 0xff, 0x57, 0xc5, 0x6f, 0xff, 0x5b, 0xca, 0x6a, 0xff, 0x5b, 0xcb, 0x62, 0xff, 0x52, 0xbc, 0x5e, 0xff, 0x50, 0x67, 0x52, 0xff, 0x4a, 0x8c, 0x47, 0xff, 0xa7, 0xcd, 0x00, 0xff, 0xed, 0xf5, 0x00, 0xff, 0xf6, 0xf8, 0x01, 0xff, 0xa3, 0xc3, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x1e, 0x00, 0xff, 0x05, 0x3a, 0x00, 0xff, 0x00, 0x76, 0x14, 0xff, 0x01, 0x91, 0x0e, 0xff, 0x00, 0x6c, 0x3a, 0xff, 0x0c, 0x98, 0x61, 0xff, 0x14, 0xa6, 0x51, 0xff, 0x03, 0x6e, 0x65, 0xff, 0x00, 0x66, 0x65, 0xff, 0x00, 0x65, 0x5f, 0xff, 0x00, 0x62, 0x57, 0xff, 0x00, 0x93, 0xa7, 0xff, 0x00, 0xa8, 0xc6, 0xff, 0x85, 0x97, 0x46, 0xff, 0x8c, 0xa8, 0x27, 0xff, 0x00, 0x43, 0x27, 0xff, 0x09, 0x32, 0x00, 0xff, 0x16, 0x31, 0x00, 0xff, 0x24, 0x6b, 0x2d, 0xff, 0x54, 0xc8, 0x2e, 0xff, 0x5d, 0xc8, 0x2d, 0xff, 0x5c, 0xc7, 0x2d, 0xff, 0x5c, 0xc8, 0x2f, 0xff, 0x5d, 0xc8, 0x31, 0xff, 0x5f, 0xc9, 0x32, 0xff, 0x5f, 0xc9, 0x34, 0xff, 0x5c, 0xc8, 0x35, 0xff, 0x5b, 0xc8, 0x37, 0xff, 0x5d, 0xc9, 0x38, 0xff, 0x5c, 0xc8, 0x38, 0xff, 0x5b, 0xc7, 0x38, 0xff, 0x5a, 0xc7, 0x37, 0xff, 0x59, 0xc6, 0x35, 0xff, 0x59, 0xc6, 0x35, 0xff, 0x59, 0xc3, 0x36, 0xff, 0x5c, 0xc6, 0x35, 0xff, 0x5b, 0xc6, 0x33, 0xff, 0x5a, 0xc6, 0x32, 0xff, 0x5e, 0xc7, 0x34, 0xff, 0x6b, 0xcb, 0x39, 0xff, 0x73, 0xcd, 0x3d, 0xff, 0x74, 0xce, 0x3e, 0xff, 0x70, 0xc9, 0x3d, 0xff, 0x70, 0xcb, 0x41, 0xff, 0x6f, 0xcd, 0x40, 0xff, 0x6e, 0xcc, 0x40, 0xff, 0x70, 0xcc, 0x3f, 0xff, 0x70, 0xca, 0x3f, 0xff, 0x6e, 0xc8, 0x3e, 0xff, 0x6d, 0xc8, 0x3e, 0xff, 0x6e, 0xc9, 0x3d, 0xff, 0x70, 0xcd, 0x3c, 0xff, 0x70, 0xcf, 0x3c, 0xff, 0x6e, 0xd0, 0x3b, 0xff, 0x64, 0xc4, 0x37, 0xff, 0x48, 0xa3, 0x2a, 0xff, 0x5c, 0xc0, 0x27, 0xff, 0x4b, 0xb5, 0x33, 0xff, 0x4c, 0xbf, 0x60, 0xff, 0x55, 0xcc, 0x69, 0xff, 0x49, 0xb6, 0x59, 0xff, 0x3e, 0x9e, 0x46, 0xff, 0x39, 0x8f, 0x39, 0xff, 0x4b, 0xb5, 0x57, 0xff, 0x58, 0xcb, 0x6a, 0xff, 0x59, 0xc8, 0x71, 0xff, 0x59, 0xc9, 0x6b, 0xff, 0x58, 0xca, 0x6a, 0xff, 0x55, 0xc8, 0x6a, 0xff, 0x5a, 0xc8, 0x73, 0xff, 0x65, 0xc9, 0x9f, 0xff, 0x57, 0xc2, 0x85, 0xff, 0x3e, 0x7d, 0x43, 0xff, 0xbd, 0xd1, 0x12, 0xff, 0xfc, 0xff, 0x00, 0xff, 0xfd, 0xff, 0x00, 0xff, 0xe4, 0xe8, 0x00, 0xff, 0x65, 0x91, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x26, 0xb2, 0x7b, 0xff, 0x09, 0x8c, 0x3f, 0xff, 0x00, 0x8f, 0x08, 0xff, 0x16, 0xa0, 0x00, 0xff, 0x1e, 0x7f, 0x1e, 0xff, 0x15, 0x97, 0x36, 0xff, 0x13, 0x9e, 0x5a, 0xff, 0x01, 0x67, 0x66, 0xff, 0x00, 0x66, 0x63, 0xff, 0x00, 0x61, 0x56, 0xff, 0x00, 0x92, 0xa3, 0xff, 0x00, 0xc1, 0xea, 0xff, 0x02, 0xbb, 0xdf, 0xff, 0x04, 0x90, 0x69, 0xff, 0x8d, 0xbb, 0x2c, 0xff, 0x56, 0x5e, 0x00, 0xff, 0x00, 0x3d, 0x00, 0xff, 0x09, 0x40, 0x00, 0xff, 0x6f, 0x64, 0x00, 0xff, 0x67, 0xc4, 0x2b, 0xff, 0x5a, 0xc8, 0x2f, 0xff, 0x5b, 0xc7, 0x2f, 0xff, 0x5c, 0xc8, 0x30, 0xff, 0x5d, 0xc8, 0x32, 0xff, 0x5f, 0xc8, 0x33, 0xff, 0x60, 0xc9, 0x35, 0xff, 0x5e, 0xc8, 0x34, 0xff, 0x5e, 0xc7, 0x35, 0xff, 0x5e, 0xc9, 0x37, 0xff, 0x5c, 0xc8, 0x37, 0xff, 0x5c, 0xc8, 0x38, 0xff, 0x5b, 0xc9, 0x37, 0xff, 0x59, 0xc7, 0x37, 0xff, 0x59, 0xc7, 0x35, 0xff, 0x5a, 0xc4, 0x35, 0xff, 0x5c, 0xc6, 0x36, 0xff, 0x5d, 0xc8, 0x35, 0xff, 0x5d, 0xc8, 0x34, 0xff, 0x5c, 0xc7, 0x33, 0xff, 0x5c, 0xc7, 0x33, 0xff, 0x64, 0xc9, 0x38, 0xff, 0x70, 0xcb, 0x3e, 0xff, 0x71, 0xca, 0x3e, 0xff, 0x6c, 0xc9, 0x3e, 0xff, 0x6e, 0xcc, 0x40, 0xff, 0x6e, 0xca, 0x3f, 0xff, 0x6d, 0xc8, 0x3d, 0xff, 0x6e, 0xc8, 0x3e, 0xff, 0x6f, 0xca, 0x40, 0xff, 0x6f, 0xcb, 0x40, 0xff, 0x6d, 0xca, 0x3e, 0xff, 0x6d, 0xcc, 0x3e, 0xff, 0x6f, 0xcf, 0x3e, 0xff, 0x5d, 0xb7, 0x34, 0xff, 0x53, 0xa9, 0x2e, 0xff, 0x3f, 0x86, 0x25, 0xff, 0x4b, 0xa8, 0x1c, 0xff, 0x46, 0xbb, 0x45, 0xff, 0x54, 0xcb, 0x5d, 0xff, 0x51, 0xc8, 0x6a, 0xff, 0x4a, 0xbb, 0x61, 0xff, 0x43, 0xa9, 0x53, 0xff, 0x46, 0xad, 0x58, 0xff, 0x53, 0xc4, 0x69, 0xff, 0x57, 0xc9, 0x6b, 0xff, 0x59, 0xca, 0x81, 0xff, 0x56, 0xc7, 0x73, 0xff, 0x5c, 0xc6, 0x6a, 0xff, 0x6a, 0xc8, 0x70, 0xff, 0x69, 0xca, 0x8c, 0xff, 0x62, 0xca, 0x95, 0xff, 0x4c, 0xc6, 0x72, 0xff, 0x13, 0x92, 0x47, 0xff, 0xc1, 0xd3, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xfb, 0xff, 0x00, 0xff, 0xd9, 0xde, 0x00, 0xff, 0x5b, 0x8f, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0xde, 0x99, 0xff, 0x1e, 0xd0, 0x66, 0xff, 0x31, 0x9f, 0x00, 0xff, 0x8f, 0xcc, 0x13, 0xff, 0x3d, 0xb2, 0x3f, 0xff, 0x0b, 0x9a, 0x40, 0xff, 0x12, 0x8d, 0x63, 0xff, 0x00, 0x60, 0x5c, 0xff, 0x00, 0x5f, 0x55, 0xff, 0x00, 0x96, 0xa8, 0xff, 0x00, 0xc4, 0xea, 0xff, 0x00, 0xc5, 0xee, 0xff, 0x00, 0xc1, 0xe3, 0xff, 0x05, 0x8c, 0x6c, 0xff, 0x76, 0x89, 0x00, 0xff, 0x85, 0x7a, 0x00, 0xff, 0x1b, 0x4c, 0x00, 0xff, 0x00, 0x2b, 0x00, 0xff, 0xc1, 0x9c, 0x00, 0xff, 0x8a, 0xc4, 0x26, 0xff, 0x52, 0xc7, 0x31, 0xff, 0x5c, 0xc5, 0x31, 0xff, 0x5c, 0xc5, 0x32, 0xff, 0x5c, 0xc6, 0x33, 0xff, 0x5f, 0xc7, 0x35, 0xff, 0x5f, 0xc7, 0x36, 0xff, 0x5f, 0xc7, 0x36, 0xff, 0x5e, 0xc8, 0x36, 0xff, 0x5d, 0xc7, 0x37, 0xff, 0x5d, 0xc8, 0x37, 0xff, 0x5e, 0xc9, 0x37, 0xff, 0x5d, 0xc9, 0x38, 0xff, 0x5e, 0xc9, 0x39, 0xff, 0x5d, 0xc8, 0x36, 0xff, 0x5b, 0xc5, 0x36, 0xff, 0x5b, 0xc4, 0x35, 0xff, 0x5f, 0xc8, 0x35, 0xff, 0x60, 0xc9, 0x34, 0xff, 0x61, 0xc9, 0x33, 0xff, 0x60, 0xc7, 0x34, 0xff, 0x60, 0xc6, 0x36, 0xff, 0x64, 0xc5, 0x39, 0xff, 0x69, 0xc5, 0x3b, 0xff, 0x6a, 0xc6, 0x3d, 0xff, 0x6d, 0xca, 0x3e, 0xff, 0x6f, 0xcc, 0x3e, 0xff, 0x6f, 0xcd, 0x3e, 0xff, 0x70, 0xcf, 0x41, 0xff, 0x6f, 0xcd, 0x41, 0xff, 0x6d, 0xcb, 0x40, 0xff, 0x6c, 0xca, 0x3e, 0xff, 0x6d, 0xcb, 0x3e, 0xff, 0x71, 0xce, 0x3e, 0xff, 0x4d, 0x9c, 0x2b, 0xff, 0x49, 0x95, 0x2b, 0xff, 0x4c, 0x9d, 0x32, 0xff, 0x3f, 0x98, 0x24, 0xff, 0x48, 0xc3, 0x4f, 0xff, 0x5a, 0xd4, 0x57, 0xff, 0x4d, 0xc5, 0x69, 0xff, 0x4e, 0xc3, 0x6b, 0xff, 0x4e, 0xc1, 0x6a, 0xff, 0x52, 0xc8, 0x6f, 0xff, 0x55, 0xc9, 0x6f, 0xff, 0x57, 0xc8, 0x6e, 0xff, 0x58, 0xc7, 0x81, 0xff, 0x59, 0xc7, 0x78, 0xff, 0x60, 0xc7, 0x70, 0xff, 0x5f, 0xca, 0x76, 0xff, 0x4c, 0xcd, 0x76, 0xff, 0x4c, 0xcb, 0x69, 0xff, 0x4b, 0xc9, 0x6a, 0xff, 0x26, 0xa4, 0x55, 0xff, 0x77, 0xaa, 0x01, 0xff, 0xe9, 0xf9, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xc3, 0xcf, 0x00, 0xff, 0x38, 0x8b, 0x03, 0xff, 0x55, 0xb8, 0x0e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x33, 0x9f, 0x00, 0xff, 0x2b, 0xbc, 0x04, 0xff, 0x30, 0xb6, 0x04, 0xff, 0x8e, 0xc7, 0x15, 0xff, 0x50, 0xa6, 0x4a, 0xff, 0x00, 0x9e, 0x53, 0xff, 0x0c, 0x7a, 0x5d, 0xff, 0x00, 0x5b, 0x52, 0xff, 0x00, 0x97, 0xab, 0xff, 0x00, 0xc5, 0xec, 0xff, 0x00, 0xc5, 0xed, 0xff, 0x00, 0xc3, 0xeb, 0xff, 0x07, 0xc5, 0xe6, 0xff, 0x1c, 0x93, 0x81, 0xff, 0x00, 0x56, 0x00, 0xff, 0x72, 0x77, 0x00, 0xff, 0x45, 0x56, 0x00, 0xff, 0x42, 0x43, 0x00, 0xff, 0xe8, 0xd9, 0x00, 0xff, 0xa1, 0xc4, 0x21, 0xff, 0x4f, 0xc7, 0x33, 0xff, 0x5d, 0xc5, 0x32, 0xff, 0x5e, 0xc5, 0x33, 0xff, 0x5e, 0xc6, 0x37, 0xff, 0x5f, 0xc6, 0x39, 0xff, 0x60, 0xc7, 0x39, 0xff, 0x60, 0xc8, 0x3a, 0xff, 0x5f, 0xc8, 0x37, 0xff, 0x5e, 0xc7, 0x38, 0xff, 0x5d, 0xc7, 0x37, 0xff, 0x5d, 0xc8, 0x37, 0xff, 0x5a, 0xc6, 0x36, 0xff, 0x5d, 0xc7, 0x38, 0xff, 0x60, 0xc9, 0x3a, 0xff, 0x5f, 0xc7, 0x39, 0xff, 0x5b, 0xc1, 0x36, 0xff, 0x60, 0xc5, 0x36, 0xff, 0x5f, 0xc8, 0x36, 0xff, 0x61, 0xc9, 0x35, 0xff, 0x61, 0xc9, 0x35, 0xff, 0x62, 0xc6, 0x38, 0xff, 0x65, 0xc5, 0x3b, 0xff, 0x69, 0xc6, 0x3e, 0xff, 0x6a, 0xc7, 0x3d, 0xff, 0x71, 0xcf, 0x3e, 0xff, 0x70, 0xd0, 0x3e, 0xff, 0x6d, 0xcf, 0x3c, 0xff, 0x66, 0xc4, 0x37, 0xff, 0x6c, 0xca, 0x3d, 0xff, 0x6e, 0xcd, 0x40, 0xff, 0x6d, 0xcc, 0x3e, 0xff, 0x6c, 0xcb, 0x3c, 0xff, 0x6e, 0xcb, 0x3b, 0xff, 0x53, 0xb1, 0x3b, 0xff, 0x4c, 0x98, 0x33, 0xff, 0x46, 0x92, 0x2c, 0xff, 0x37, 0x95, 0x24, 0xff, 0x49, 0xcd, 0x5a, 0xff, 0x52, 0xd3, 0x64, 0xff, 0x48, 0xc4, 0x6d, 0xff, 0x4e, 0xc4, 0x6e, 0xff, 0x50, 0xc3, 0x6e, 0xff, 0x52, 0xc5, 0x6d, 0xff, 0x54, 0xc6, 0x6f, 0xff, 0x54, 0xc5, 0x73, 0xff, 0x4e, 0xc4, 0x86, 0xff, 0x49, 0xca, 0x8c, 0xff, 0x45, 0xcf, 0x7f, 0xff, 0x45, 0xcd, 0x7a, 0xff, 0x3c, 0xba, 0x79, 0xff, 0x32, 0xac, 0x78, 0xff, 0x49, 0xca, 0x70, 0xff, 0x3c, 0xb5, 0x62, 0xff, 0x00, 0x8b, 0x17, 0xff, 0x68, 0xc8, 0x03, 0xff, 0xe1, 0xf8, 0x00, 0xff, 0xa1, 0xae, 0x00, 0xff, 0x00, 0x65, 0x02, 0xff, 0x52, 0xad, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x76, 0xd8, 0x62, 0xff, 0x59, 0x9b, 0x29, 0xff, 0x33, 0x88, 0x00, 0xff, 0x18, 0x9d, 0x10, 0xff, 0x00, 0x5f, 0x2d, 0xff, 0x00, 0x87, 0x68, 0xff, 0x15, 0xa3, 0x56, 0xff, 0x05, 0x68, 0x4f, 0xff, 0x00, 0x9b, 0xb0, 0xff, 0x00, 0xc4, 0xec, 0xff, 0x00, 0xc4, 0xee, 0xff, 0x00, 0xc3, 0xeb, 0xff, 0x00, 0xc3, 0xec, 0xff, 0x0b, 0xc4, 0xe5, 0xff, 0x37, 0xa2, 0x79, 0xff, 0x04, 0x61, 0x00, 0xff, 0x1d, 0x6f, 0x03, 0xff, 0x43, 0x45, 0x02, 0xff, 0x89, 0x87, 0x00, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xc0, 0xd4, 0x18, 0xff, 0x54, 0xc4, 0x33, 0xff, 0x62, 0xc8, 0x38, 0xff, 0x65, 0xc9, 0x3c, 0xff, 0x64, 0xc8, 0x3d, 0xff, 0x63, 0xc8, 0x3c, 0xff, 0x65, 0xc9, 0x3f, 0xff, 0x61, 0xc9, 0x3f, 0xff, 0x5e, 0xc8, 0x39, 0xff, 0x5d, 0xc6, 0x39, 0xff, 0x5d, 0xc7, 0x38, 0xff, 0x5c, 0xc6, 0x36, 0xff, 0x5b, 0xc4, 0x34, 0xff, 0x5a, 0xc3, 0x35, 0xff, 0x5c, 0xc5, 0x37, 0xff, 0x61, 0xc7, 0x3b, 0xff, 0x5f, 0xc3, 0x39, 0xff, 0x60, 0xc6, 0x36, 0xff, 0x5c, 0xc4, 0x35, 0xff, 0x5d, 0xc4, 0x36, 0xff, 0x63, 0xc8, 0x3a, 0xff, 0x6a, 0xcc, 0x3e, 0xff, 0x6d, 0xcf, 0x40, 0xff, 0x6c, 0xcf, 0x3f, 0xff, 0x67, 0xc9, 0x3b, 0xff, 0x6f, 0xcf, 0x3d, 0xff, 0x70, 0xd1, 0x3d, 0xff, 0x67, 0xc4, 0x35, 0xff, 0x46, 0x8a, 0x2c, 0xff, 0x5a, 0xa9, 0x30, 0xff, 0x71, 0xce, 0x3f, 0xff, 0x6e, 0xcd, 0x3d, 0xff, 0x6a, 0xca, 0x3a, 0xff, 0x66, 0xc7, 0x37, 0xff, 0x48, 0xb3, 0x4c, 0xff, 0x4d, 0xa8, 0x40, 0xff, 0x5b, 0xb3, 0x20, 0xff, 0x3d, 0xae, 0x38, 0xff, 0x2f, 0xd4, 0x8b, 0xff, 0x3f, 0xce, 0x76, 0xff, 0x44, 0xc4, 0x6f, 0xff, 0x4b, 0xc3, 0x70, 0xff, 0x4f, 0xc2, 0x70, 0xff, 0x51, 0xc3, 0x75, 0xff, 0x51, 0xc6, 0x7c, 0xff, 0x50, 0xc8, 0x7f, 0xff, 0x4a, 0xc7, 0x91, 0xff, 0x3d, 0xca, 0xac, 0xff, 0x42, 0xc7, 0x80, 0xff, 0x2e, 0xa8, 0x85, 0xff, 0x35, 0xaf, 0x7d, 0xff, 0x27, 0x9e, 0x84, 0xff, 0x44, 0xc9, 0x76, 0xff, 0x41, 0xc1, 0x6c, 0xff, 0x26, 0x8c, 0x2c, 0xff, 0x00, 0xb1, 0x05, 0xff, 0x47, 0xc5, 0x12, 0xff, 0x61, 0x75, 0x16, 0xff, 0x4e, 0x50, 0x00, 0xff, 0x40, 0x93, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4c, 0xc1, 0x5a, 0xff, 0x36, 0x99, 0x33, 0xff, 0x1e, 0x82, 0x20, 0xff, 0x05, 0x4a, 0x15, 0xff, 0x00, 0x10, 0x26, 0xff, 0x06, 0x99, 0x65, 0xff, 0x10, 0xa0, 0x61, 0xff, 0x01, 0xa0, 0xb7, 0xff, 0x00, 0xc5, 0xeb, 0xff, 0x00, 0xc3, 0xec, 0xff, 0x00, 0xc3, 0xec, 0xff, 0x00, 0xc3, 0xed, 0xff, 0x00, 0xc4, 0xef, 0xff, 0x0c, 0xc1, 0xdc, 0xff, 0x44, 0xaa, 0x4e, 0xff, 0x1c, 0x80, 0x00, 0xff, 0x00, 0x7d, 0x08, 0xff, 0x08, 0x6b, 0x19, 0xff, 0xcc, 0xc9, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xdf, 0xea, 0x0c, 0xff, 0x62, 0xc6, 0x36, 0xff, 0x67, 0xcb, 0x3e, 0xff, 0x69, 0xcc, 0x40, 0xff, 0x67, 0xca, 0x40, 0xff, 0x67, 0xca, 0x3f, 0xff, 0x67, 0xca, 0x40, 0xff, 0x62, 0xc8, 0x3e, 0xff, 0x5c, 0xc5, 0x39, 0xff, 0x5d, 0xc5, 0x3a, 0xff, 0x5d, 0xc6, 0x38, 0xff, 0x5b, 0xc5, 0x34, 0xff, 0x5c, 0xc4, 0x35, 0xff, 0x5b, 0xc3, 0x35, 0xff, 0x5a, 0xc3, 0x35, 0xff, 0x5f, 0xc5, 0x38, 0xff, 0x61, 0xc2, 0x3c, 0xff, 0x5f, 0xc3, 0x3d, 0xff, 0x5e, 0xc4, 0x3d, 0xff, 0x5f, 0xc5, 0x3a, 0xff, 0x62, 0xc7, 0x3a, 0xff, 0x67, 0xcd, 0x3b, 0xff, 0x6c, 0xd0, 0x3d, 0xff, 0x6d, 0xd1, 0x3e, 0xff, 0x6a, 0xce, 0x3b, 0xff, 0x6f, 0xcf, 0x3b, 0xff, 0x6f, 0xd1, 0x3b, 0xff, 0x69, 0xc6, 0x34, 0xff, 0x48, 0x86, 0x2b, 0xff, 0x4b, 0x8d, 0x28, 0xff, 0x70, 0xca, 0x3a, 0xff, 0x6d, 0xcb, 0x3b, 0xff, 0x69, 0xc9, 0x39, 0xff, 0x5c, 0xc1, 0x3c, 0xff, 0x42, 0xbb, 0x66, 0xff, 0x5c, 0xc9, 0x50, 0xff, 0x64, 0xc4, 0x00, 0xff, 0x30, 0xc0, 0x84, 0xff, 0x11, 0xda, 0xc2, 0xff, 0x3a, 0xc9, 0x75, 0xff, 0x45, 0xc2, 0x70, 0xff, 0x4a, 0xc4, 0x78, 0xff, 0x50, 0xc7, 0x80, 0xff, 0x54, 0xcb, 0x85, 0xff, 0x53, 0xca, 0x85, 0xff, 0x50, 0xc8, 0x81, 0xff, 0x4d, 0xc9, 0x86, 0xff, 0x41, 0xc5, 0xad, 0xff, 0x40, 0xc5, 0x81, 0xff, 0x23, 0xa0, 0x86, 0xff, 0x3b, 0xb9, 0x7a, 0xff, 0x2d, 0xac, 0x80, 0xff, 0x45, 0xca, 0x75, 0xff, 0x44, 0xc8, 0x73, 0xff, 0x32, 0x91, 0x40, 0xff, 0x1d, 0xb6, 0x00, 0xff, 0x00, 0xb3, 0x22, 0xff, 0x14, 0x5a, 0x4f, 0xff, 0x4a, 0x4f, 0x29, 0xff, 0x42, 0x7e, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1c, 0xde, 0x96, 0xff, 0x04, 0xbd, 0x7f, 0xff, 0x00, 0x55, 0x24, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x38, 0x4c, 0xff, 0x09, 0x9c, 0x6f, 0xff, 0x0a, 0xb6, 0xb5, 0xff, 0x00, 0xc4, 0xf3, 0xff, 0x00, 0xc2, 0xeb, 0xff, 0x00, 0xc1, 0xeb, 0xff, 0x00, 0xc2, 0xec, 0xff, 0x00, 0xc4, 0xee, 0xff, 0x00, 0xc4, 0xf1, 0xff, 0x16, 0xbd, 0xcc, 0xff, 0x4b, 0xb1, 0x24, 0xff, 0x37, 0x7f, 0x0a, 0xff, 0x31, 0x8e, 0x04, 0xff, 0x00, 0x8c, 0x1d, 0xff, 0xac, 0xbf, 0x02, 0xff, 0xfc, 0xfd, 0x00, 0xff, 0xf7, 0xfb, 0x02, 0xff, 0x7c, 0xce, 0x34, 0xff, 0x61, 0xc9, 0x3e, 0xff, 0x63, 0xca, 0x3c, 0xff, 0x62, 0xc9, 0x3d, 0xff, 0x62, 0xc7, 0x3d, 0xff, 0x61, 0xc7, 0x3c, 0xff, 0x5c, 0xc5, 0x39, 0xff, 0x5b, 0xc4, 0x37, 0xff, 0x5b, 0xc4, 0x38, 0xff, 0x5d, 0xc5, 0x37, 0xff, 0x5c, 0xc5, 0x36, 0xff, 0x5c, 0xc5, 0x36, 0xff, 0x5c, 0xc2, 0x35, 0xff, 0x5d, 0xc0, 0x36, 0xff, 0x5d, 0xc0, 0x37, 0xff, 0x5c, 0xc0, 0x3b, 0xff, 0x60, 0xc6, 0x41, 0xff, 0x61, 0xcb, 0x41, 0xff, 0x61, 0xc9, 0x3e, 0xff, 0x60, 0xc4, 0x39, 0xff, 0x5b, 0xbd, 0x34, 0xff, 0x63, 0xc9, 0x38, 0xff, 0x6a, 0xcf, 0x3b, 0xff, 0x6e, 0xd0, 0x3c, 0xff, 0x6f, 0xcf, 0x3c, 0xff, 0x6f, 0xd1, 0x3b, 0xff, 0x6d, 0xcc, 0x37, 0xff, 0x56, 0x9b, 0x32, 0xff, 0x53, 0x94, 0x31, 0xff, 0x6c, 0xc6, 0x38, 0xff, 0x6c, 0xca, 0x3d, 0xff, 0x67, 0xc7, 0x37, 0xff, 0x4e, 0xba, 0x56, 0xff, 0x43, 0xbf, 0x7a, 0xff, 0x66, 0xcf, 0x4d, 0xff, 0x59, 0xbb, 0x00, 0xff, 0x15, 0xc1, 0xab, 0xff, 0x28, 0xd0, 0xc2, 0xff, 0x40, 0xc5, 0x78, 0xff, 0x3f, 0xc4, 0x7f, 0xff, 0x48, 0xc8, 0x83, 0xff, 0x4e, 0xcb, 0x86, 0xff, 0x53, 0xca, 0x86, 0xff, 0x3d, 0xa6, 0x65, 0xff, 0x3e, 0xad, 0x67, 0xff, 0x50, 0xcd, 0x7e, 0xff, 0x4b, 0xc6, 0x87, 0xff, 0x42, 0xcc, 0x81, 0xff, 0x30, 0xb1, 0x85, 0xff, 0x2a, 0xa6, 0x89, 0xff, 0x18, 0x90, 0x93, 0xff, 0x39, 0xbe, 0x80, 0xff, 0x46, 0xcc, 0x76, 0xff, 0x38, 0x9e, 0x55, 0xff, 0x26, 0xb7, 0x00, 0xff, 0x00, 0xb0, 0x38, 0xff, 0x00, 0x56, 0x5b, 0xff, 0x00, 0x54, 0x6f, 0xff, 0x25, 0x80, 0x9a, 0xff, 0x55, 0xff, 0xaa, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x9b, 0x56, 0xff, 0x03, 0xb1, 0x80, 0xff, 0x00, 0xb8, 0x89, 0xff, 0x00, 0x9f, 0x76, 0xff, 0x01, 0x81, 0x9a, 0xff, 0x0d, 0x86, 0x9d, 0xff, 0x0b, 0xbb, 0xda, 0xff, 0x00, 0xc4, 0xf6, 0xff, 0x00, 0xbe, 0xeb, 0xff, 0x00, 0xc0, 0xeb, 0xff, 0x00, 0xc2, 0xed, 0xff, 0x00, 0xc4, 0xee, 0xff, 0x00, 0xc5, 0xf2, 0xff, 0x1e, 0xb7, 0xb6, 0xff, 0x45, 0xb2, 0x01, 0xff, 0x45, 0x86, 0x1a, 0xff, 0x62, 0x8c, 0x00, 0xff, 0x47, 0xa0, 0x06, 0xff, 0x00, 0x81, 0x02, 0xff, 0x92, 0xbe, 0x00, 0xff, 0xec, 0xf3, 0x02, 0xff, 0x88, 0xd0, 0x33, 0xff, 0x5b, 0xc8, 0x3b, 0xff, 0x60, 0xc8, 0x3a, 0xff, 0x5e, 0xc6, 0x3a, 0xff, 0x5c, 0xc5, 0x39, 0xff, 0x5a, 0xc5, 0x37, 0xff, 0x59, 0xc4, 0x36, 0xff, 0x5b, 0xc3, 0x36, 0xff, 0x5a, 0xc2, 0x37, 0xff, 0x5b, 0xc2, 0x38, 0xff, 0x5c, 0xc1, 0x37, 0xff, 0x5c, 0xc0, 0x36, 0xff, 0x5d, 0xc1, 0x37, 0xff, 0x5e, 0xc3, 0x38, 0xff, 0x5e, 0xc5, 0x3a, 0xff, 0x5d, 0xc3, 0x3a, 0xff, 0x5c, 0xc4, 0x3b, 0xff, 0x60, 0xc9, 0x3d, 0xff, 0x61, 0xc9, 0x3e, 0xff, 0x50, 0xa3, 0x32, 0xff, 0x40, 0x87, 0x29, 0xff, 0x60, 0xc6, 0x38, 0xff, 0x63, 0xcb, 0x37, 0xff, 0x64, 0xcb, 0x38, 0xff, 0x6b, 0xcb, 0x3a, 0xff, 0x71, 0xcf, 0x3c, 0xff, 0x70, 0xce, 0x3a, 0xff, 0x5d, 0xaa, 0x30, 0xff, 0x62, 0xb1, 0x34, 0xff, 0x6f, 0xcc, 0x3d, 0xff, 0x6d, 0xca, 0x3d, 0xff, 0x65, 0xc3, 0x37, 0xff, 0x41, 0xb6, 0x70, 0xff, 0x45, 0xc1, 0x7e, 0xff, 0x66, 0xc9, 0x41, 0xff, 0x42, 0xb4, 0x3a, 0xff, 0x00, 0xc7, 0xcf, 0xff, 0x25, 0xcc, 0xad, 0xff, 0x33, 0xc8, 0x83, 0xff, 0x35, 0xc5, 0x84, 0xff, 0x47, 0xc9, 0x85, 0xff, 0x3f, 0xb2, 0x71, 0xff, 0x42, 0xa2, 0x62, 0xff, 0x43, 0xa5, 0x61, 0xff, 0x37, 0x9e, 0x58, 0xff, 0x50, 0xcd, 0x7c, 0xff, 0x48, 0xca, 0x7f, 0xff, 0x3b, 0xcc, 0x83, 0xff, 0x33, 0xc1, 0x85, 0xff, 0x2d, 0xba, 0x88, 0xff, 0x35, 0xc3, 0x85, 0xff, 0x3c, 0xcb, 0x7e, 0xff, 0x43, 0xcb, 0x7b, 0xff, 0x36, 0xac, 0x62, 0xff, 0x14, 0xaa, 0x1c, 0xff, 0x00, 0x9a, 0x6b, 0xff, 0x00, 0x5b, 0x85, 0xff, 0x00, 0x46, 0xa5, 0xff, 0x16, 0x6b, 0xb2, 0xff, 0x49, 0xc8, 0x6d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x50, 0x00, 0xff, 0x01, 0x8a, 0x5a, 0xff, 0x00, 0xd0, 0xa8, 0xff, 0x01, 0xc9, 0xa3, 0xff, 0x06, 0x85, 0xc3, 0xff, 0x04, 0x66, 0xda, 0xff, 0x02, 0xbc, 0xf0, 0xff, 0x00, 0xc4, 0xfc, 0xff, 0x00, 0xbe, 0xf2, 0xff, 0x00, 0xbe, 0xec, 0xff, 0x00, 0xc0, 0xed, 0xff, 0x00, 0xc2, 0xee, 0xff, 0x00, 0xc3, 0xf0, 0xff, 0x27, 0xb1, 0x96, 0xff, 0x40, 0xb0, 0x04, 0xff, 0x54, 0x97, 0x20, 0xff, 0x59, 0x92, 0x00, 0xff, 0x9b, 0xd3, 0x00, 0xff, 0x5c, 0xac, 0x01, 0xff, 0x10, 0x8e, 0x00, 0xff, 0x63, 0x84, 0x07, 0xff, 0x5b, 0xb3, 0x38, 0xff, 0x60, 0xcb, 0x3c, 0xff, 0x60, 0xc7, 0x3c, 0xff, 0x5f, 0xc5, 0x3a, 0xff, 0x5b, 0xc4, 0x37, 0xff, 0x59, 0xc3, 0x35, 0xff, 0x59, 0xc3, 0x35, 0xff, 0x5b, 0xc3, 0x39, 0xff, 0x5b, 0xc2, 0x3b, 0xff, 0x5a, 0xbf, 0x3a, 0xff, 0x5d, 0xc0, 0x39, 0xff, 0x5e, 0xc2, 0x3a, 0xff, 0x5e, 0xc5, 0x3a, 0xff, 0x5d, 0xc5, 0x39, 0xff, 0x5d, 0xc6, 0x38, 0xff, 0x5d, 0xc5, 0x38, 0xff, 0x59, 0xc2, 0x3a, 0xff, 0x5c, 0xc7, 0x3c, 0xff, 0x5f, 0xc9, 0x3b, 0xff, 0x5f, 0xbf, 0x38, 0xff, 0x48, 0x97, 0x2d, 0xff, 0x64, 0xcc, 0x40, 0xff, 0x64, 0xcd, 0x3d, 0xff, 0x5f, 0xca, 0x37, 0xff, 0x5f, 0xc5, 0x34, 0xff, 0x69, 0xca, 0x37, 0xff, 0x6f, 0xcd, 0x39, 0xff, 0x72, 0xcf, 0x3c, 0xff, 0x74, 0xcf, 0x41, 0xff, 0x6e, 0xcc, 0x3f, 0xff, 0x6b, 0xca, 0x3e, 0xff, 0x5b, 0xbd, 0x43, 0xff, 0x3f, 0xb7, 0x6e, 0xff, 0x59, 0xc9, 0x63, 0xff, 0x63, 0xc5, 0x2e, 0xff, 0x25, 0xb4, 0x50, 0xff, 0x06, 0xc9, 0xa8, 0xff, 0x27, 0xca, 0x94, 0xff, 0x2f, 0xc9, 0x8a, 0xff, 0x32, 0xc6, 0x87, 0xff, 0x43, 0xc8, 0x86, 0xff, 0x3f, 0xba, 0x79, 0xff, 0x3d, 0x9c, 0x5c, 0xff, 0x54, 0xb8, 0x71, 0xff, 0x3b, 0x97, 0x52, 0xff, 0x48, 0xc6, 0x76, 0xff, 0x47, 0xcd, 0x80, 0xff, 0x35, 0xcb, 0x86, 0xff, 0x38, 0xce, 0x84, 0xff, 0x36, 0xce, 0x83, 0xff, 0x36, 0xcd, 0x82, 0xff, 0x39, 0xca, 0x80, 0xff, 0x3e, 0xc8, 0x7f, 0xff, 0x33, 0xb5, 0x66, 0xff, 0x3e, 0x8a, 0x8f, 0xff, 0x4b, 0x6b, 0xdb, 0xff, 0x00, 0x41, 0xc8, 0xff, 0x00, 0x1d, 0xb3, 0xff, 0x14, 0x49, 0x9f, 0xff, 0x3b, 0xa0, 0x71, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x44, 0xbb, 0x11, 0xff, 0x27, 0x7d, 0x00, 0xff, 0x00, 0x6c, 0x42, 0xff, 0x00, 0xb1, 0xa4, 0xff, 0x04, 0x6d, 0x66, 0xff, 0x01, 0x00, 0xc2, 0xff, 0x00, 0x77, 0xed, 0xff, 0x02, 0xc1, 0xfb, 0xff, 0x00, 0xc4, 0xfe, 0xff, 0x00, 0xc0, 0xfa, 0xff, 0x00, 0xbc, 0xee, 0xff, 0x00, 0xbd, 0xed, 0xff, 0x00, 0xbf, 0xf0, 0xff, 0x02, 0xbf, 0xe9, 0xff, 0x32, 0xaf, 0x6e, 0xff, 0x3b, 0xae, 0x18, 0xff, 0x67, 0xa7, 0x1f, 0xff, 0x59, 0x99, 0x05, 0xff, 0x9a, 0xd8, 0x00, 0xff, 0x6d, 0xab, 0x00, 0xff, 0x33, 0x7b, 0x00, 0xff, 0x00, 0x41, 0x00, 0xff, 0x30, 0x87, 0x23, 0xff, 0x63, 0xcb, 0x41, 0xff, 0x60, 0xc8, 0x40, 0xff, 0x5d, 0xc4, 0x39, 0xff, 0x5b, 0xc3, 0x36, 0xff, 0x5a, 0xc3, 0x37, 0xff, 0x5c, 0xc3, 0x41, 0xff, 0x5d, 0xc3, 0x45, 0xff, 0x5c, 0xc3, 0x3e, 0xff, 0x5c, 0xc3, 0x3d, 0xff, 0x5e, 0xc4, 0x3d, 0xff, 0x5f, 0xc6, 0x3c, 0xff, 0x5f, 0xc7, 0x3b, 0xff, 0x5d, 0xc6, 0x3a, 0xff, 0x5d, 0xc7, 0x3a, 0xff, 0x5f, 0xc7, 0x39, 0xff, 0x59, 0xc2, 0x39, 0xff, 0x5b, 0xc6, 0x3c, 0xff, 0x60, 0xca, 0x3d, 0xff, 0x5d, 0xbf, 0x36, 0xff, 0x33, 0x79, 0x1e, 0xff, 0x62, 0xc4, 0x43, 0xff, 0x68, 0xcd, 0x4c, 0xff, 0x63, 0xcc, 0x45, 0xff, 0x5e, 0xc6, 0x3a, 0xff, 0x62, 0xc7, 0x35, 0xff, 0x68, 0xca, 0x35, 0xff, 0x6c, 0xcc, 0x39, 0xff, 0x72, 0xce, 0x40, 0xff, 0x71, 0xce, 0x42, 0xff, 0x6a, 0xc9, 0x40, 0xff, 0x5a, 0xc1, 0x46, 0xff, 0x52, 0xc5, 0x56, 0xff, 0x6e, 0xd8, 0x47, 0xff, 0x56, 0xc2, 0x2a, 0xff, 0x1e, 0xb5, 0x60, 0xff, 0x1d, 0xad, 0x72, 0xff, 0x1d, 0x97, 0x62, 0xff, 0x2d, 0xc6, 0x8c, 0xff, 0x31, 0xc8, 0x8e, 0xff, 0x3f, 0xc8, 0x88, 0xff, 0x43, 0xc9, 0x89, 0xff, 0x39, 0xa1, 0x63, 0xff, 0x42, 0xab, 0x68, 0xff, 0x38, 0xa1, 0x5e, 0xff, 0x4a, 0xcb, 0x7e, 0xff, 0x49, 0xce, 0x80, 0xff, 0x36, 0xcb, 0x88, 0xff, 0x37, 0xcd, 0x87, 0xff, 0x37, 0xcb, 0x84, 0xff, 0x38, 0xc8, 0x84, 0xff, 0x3a, 0xc8, 0x88, 0xff, 0x3a, 0xc9, 0x83, 0xff, 0x1f, 0xbe, 0x6c, 0xff, 0x77, 0x80, 0x9a, 0xff, 0xe3, 0x6c, 0xfe, 0xff, 0xa4, 0x3b, 0xea, 0xff, 0x00, 0x00, 0xc3, 0xff, 0x00, 0x37, 0xb1, 0xff, 0x37, 0x8e, 0x8b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x9a, 0x00, 0xff, 0x0d, 0x92, 0x41, 0xff, 0x00, 0x9d, 0x76, 0xff, 0x00, 0x83, 0x56, 0xff, 0x07, 0x00, 0x20, 0xff, 0x27, 0x41, 0xe3, 0xff, 0x35, 0x8e, 0xf6, 0xff, 0x00, 0xc0, 0xfd, 0xff, 0x00, 0xc2, 0xfd, 0xff, 0x00, 0xc1, 0xfd, 0xff, 0x00, 0xbb, 0xf5, 0xff, 0x00, 0xbb, 0xef, 0xff, 0x00, 0xbe, 0xf4, 0xff, 0x0a, 0xba, 0xdd, 0xff, 0x3b, 0xae, 0x45, 0xff, 0x3d, 0xad, 0x25, 0xff, 0x5e, 0xb1, 0x2c, 0xff, 0x7b, 0xaf, 0x2a, 0xff, 0xa6, 0xd2, 0x01, 0xff, 0x5c, 0x9c, 0x00, 0xff, 0x00, 0x71, 0x00, 0xff, 0x0a, 0x70, 0x00, 0xff, 0x23, 0x7f, 0x16, 0xff, 0x60, 0xc8, 0x3e, 0xff, 0x60, 0xc9, 0x3e, 0xff, 0x5f, 0xc4, 0x3d, 0xff, 0x5f, 0xc2, 0x4a, 0xff, 0x5e, 0xc1, 0x55, 0xff, 0x5f, 0xc3, 0x52, 0xff, 0x5e, 0xc3, 0x4d, 0xff, 0x5c, 0xc4, 0x3e, 0xff, 0x5b, 0xc4, 0x3e, 0xff, 0x5d, 0xc6, 0x3e, 0xff, 0x5a, 0xba, 0x39, 0xff, 0x4d, 0xa3, 0x30, 0xff, 0x5b, 0xc2, 0x3b, 0xff, 0x5f, 0xc8, 0x3a, 0xff, 0x60, 0xc8, 0x39, 0xff, 0x58, 0xc1, 0x39, 0xff, 0x5a, 0xc6, 0x3d, 0xff, 0x5f, 0xc9, 0x3d, 0xff, 0x5e, 0xc3, 0x38, 0xff, 0x44, 0x95, 0x2a, 0xff, 0x5e, 0xc0, 0x3a, 0xff, 0x64, 0xc7, 0x43, 0xff, 0x66, 0xca, 0x53, 0xff, 0x66, 0xc9, 0x50, 0xff, 0x65, 0xc8, 0x38, 0xff, 0x66, 0xc7, 0x31, 0xff, 0x66, 0xc7, 0x35, 0xff, 0x6a, 0xca, 0x3d, 0xff, 0x70, 0xce, 0x42, 0xff, 0x68, 0xcb, 0x41, 0xff, 0x57, 0xc5, 0x43, 0xff, 0x65, 0xce, 0x45, 0xff, 0x74, 0xd3, 0x30, 0xff, 0x36, 0xaa, 0x2b, 0xff, 0x15, 0x8c, 0x54, 0xff, 0x26, 0xa8, 0x70, 0xff, 0x1f, 0x8e, 0x5b, 0xff, 0x2d, 0xc2, 0x8a, 0xff, 0x31, 0xcb, 0x93, 0xff, 0x39, 0xc7, 0x8b, 0xff, 0x40, 0xc9, 0x8a, 0xff, 0x3b, 0xb6, 0x76, 0xff, 0x45, 0xc5, 0x82, 0xff, 0x48, 0xcb, 0x87, 0xff, 0x49, 0xcd, 0x85, 0xff, 0x4a, 0xcb, 0x80, 0xff, 0x42, 0xc9, 0x86, 0xff, 0x3a, 0xc9, 0x85, 0xff, 0x35, 0xc9, 0x86, 0xff, 0x35, 0xc9, 0x88, 0xff, 0x35, 0xca, 0x86, 0xff, 0x34, 0xcb, 0x82, 0xff, 0x22, 0xc5, 0x73, 0xff, 0x5d, 0x90, 0x7f, 0xff, 0xf2, 0x89, 0xf6, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xc9, 0x51, 0xf2, 0xff, 0x46, 0x23, 0xd7, 0xff, 0x18, 0x7a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1d, 0xc9, 0x58, 0xff, 0x00, 0xb3, 0x70, 0xff, 0x50, 0xbb, 0x44, 0xff, 0x62, 0xd7, 0x54, 0xff, 0x00, 0x66, 0x8d, 0xff, 0x84, 0x5b, 0xe0, 0xff, 0x83, 0xae, 0xe8, 0xff, 0x00, 0xba, 0xff, 0xff, 0x00, 0xbc, 0xfe, 0xff, 0x00, 0xbd, 0xfe, 0xff, 0x00, 0xb9, 0xfc, 0xff, 0x00, 0xb7, 0xf4, 0xff, 0x00, 0xba, 0xf8, 0xff, 0x19, 0xb6, 0xcc, 0xff, 0x40, 0xb0, 0x1d, 0xff, 0x43, 0xb0, 0x28, 0xff, 0x4d, 0xb2, 0x3c, 0xff, 0x53, 0x85, 0x4d, 0xff, 0x6a, 0x96, 0x00, 0xff, 0xa7, 0xbf, 0x00, 0xff, 0x1d, 0x7d, 0x03, 0xff, 0x00, 0x77, 0x16, 0xff, 0x12, 0x78, 0x1a, 0xff, 0x60, 0xbc, 0x37, 0xff, 0x61, 0xca, 0x43, 0xff, 0x63, 0xc6, 0x4b, 0xff, 0x65, 0xc2, 0x5d, 0xff, 0x62, 0xc2, 0x5e, 0xff, 0x5f, 0xc6, 0x48, 0xff, 0x5e, 0xc4, 0x43, 0xff, 0x5d, 0xc4, 0x40, 0xff, 0x5d, 0xc4, 0x40, 0xff, 0x5e, 0xc7, 0x3f, 0xff, 0x4a, 0xa0, 0x2f, 0xff, 0x41, 0x91, 0x2c, 0xff, 0x5a, 0xc0, 0x3a, 0xff, 0x5e, 0xc7, 0x3a, 0xff, 0x5e, 0xc7, 0x38, 0xff, 0x5a, 0xc2, 0x38, 0xff, 0x5b, 0xc5, 0x3d, 0xff, 0x5d, 0xc7, 0x3d, 0xff, 0x5f, 0xc7, 0x3b, 0xff, 0x60, 0xc6, 0x3b, 0xff, 0x5f, 0xc4, 0x3a, 0xff, 0x60, 0xc3, 0x3a, 0xff, 0x61, 0xc4, 0x3e, 0xff, 0x65, 0xc4, 0x48, 0xff, 0x6a, 0xc8, 0x41, 0xff, 0x63, 0xcd, 0x4b, 0xff, 0x63, 0xcf, 0x47, 0xff, 0x6a, 0xd0, 0x41, 0xff, 0x6a, 0xcf, 0x41, 0xff, 0x5e, 0xc5, 0x3f, 0xff, 0x56, 0xc5, 0x42, 0xff, 0x68, 0xcf, 0x40, 0xff, 0x5b, 0xc1, 0x24, 0xff, 0x0d, 0xa8, 0x41, 0xff, 0x10, 0x8a, 0x4c, 0xff, 0x25, 0xaf, 0x76, 0xff, 0x1f, 0x9b, 0x63, 0xff, 0x2d, 0xc4, 0x8c, 0xff, 0x2d, 0xcc, 0x94, 0xff, 0x30, 0xc6, 0x8d, 0xff, 0x3e, 0xc9, 0x89, 0xff, 0x40, 0xcb, 0x89, 0xff, 0x41, 0xca, 0x87, 0xff, 0x40, 0xca, 0x86, 0xff, 0x40, 0xc8, 0x83, 0xff, 0x3f, 0xc8, 0x82, 0xff, 0x39, 0xc7, 0x88, 0xff, 0x32, 0xc9, 0x87, 0xff, 0x2f, 0xcb, 0x87, 0xff, 0x2e, 0xc8, 0x85, 0xff, 0x23, 0xb3, 0x81, 0xff, 0x22, 0xb4, 0x7d, 0xff, 0x2d, 0xca, 0x7a, 0xff, 0x1c, 0xa0, 0x66, 0xff, 0xc4, 0x7e, 0xe3, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xce, 0x62, 0xfd, 0xff, 0x29, 0x6a, 0xd1, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x55, 0xff, 0xff, 0xff, 0x14, 0x71, 0xa3, 0xff, 0x00, 0x6c, 0x4e, 0xff, 0x3e, 0x99, 0x28, 0xff, 0x5b, 0xd4, 0x5e, 0xff, 0x00, 0xa0, 0xaa, 0xff, 0x6f, 0x62, 0xb4, 0xff, 0x55, 0xa2, 0xe2, 0xff, 0x0b, 0xae, 0xff, 0xff, 0x16, 0xb0, 0xff, 0xff, 0x1c, 0xb0, 0xfe, 0xff, 0x26, 0xac, 0xfe, 0xff, 0x04, 0xae, 0xfb, 0xff, 0x00, 0xb6, 0xfa, 0xff, 0x26, 0xb2, 0xb1, 0xff, 0x42, 0xb0, 0x00, 0xff, 0x46, 0xb1, 0x2c, 0xff, 0x4e, 0xb5, 0x34, 0xff, 0x40, 0x83, 0x60, 0xff, 0x30, 0x6f, 0x5b, 0xff, 0xe5, 0xe7, 0x0d, 0xff, 0xa1, 0xc7, 0x05, 0xff, 0x00, 0x77, 0x1b, 0xff, 0x54, 0x4f, 0x03, 0xff, 0x85, 0xa8, 0x2c, 0xff, 0x5e, 0xcd, 0x43, 0xff, 0x63, 0xc8, 0x46, 0xff, 0x61, 0xc7, 0x43, 0xff, 0x60, 0xc7, 0x42, 0xff, 0x5f, 0xc7, 0x41, 0xff, 0x61, 0xc7, 0x3f, 0xff, 0x60, 0xc6, 0x41, 0xff, 0x5e, 0xc5, 0x41, 0xff, 0x5e, 0xc6, 0x40, 0xff, 0x54, 0xb0, 0x37, 0xff, 0x47, 0x8c, 0x2d, 0xff, 0x49, 0x9d, 0x2f, 0xff, 0x5f, 0xc7, 0x3a, 0xff, 0x5d, 0xc6, 0x37, 0xff, 0x59, 0xc2, 0x37, 0xff, 0x5a, 0xc1, 0x3c, 0xff, 0x5c, 0xc4, 0x3c, 0xff, 0x5e, 0xc5, 0x3c, 0xff, 0x5e, 0xc4, 0x3b, 0xff, 0x5c, 0xc2, 0x3a, 0xff, 0x5d, 0xc0, 0x39, 0xff, 0x5d, 0xc1, 0x39, 0xff, 0x5d, 0xc2, 0x3a, 0xff, 0x5d, 0xc6, 0x41, 0xff, 0x5d, 0xd4, 0x58, 0xff, 0x5d, 0xd5, 0x58, 0xff, 0x65, 0xd1, 0x47, 0xff, 0x53, 0xb2, 0x38, 0xff, 0x46, 0xa6, 0x34, 0xff, 0x4e, 0xbe, 0x3f, 0xff, 0x5a, 0xc7, 0x3d, 0xff, 0x49, 0xbb, 0x24, 0xff, 0x0c, 0xae, 0x48, 0xff, 0x07, 0x96, 0x57, 0xff, 0x1a, 0x96, 0x5c, 0xff, 0x0e, 0x7d, 0x46, 0xff, 0x1c, 0xb5, 0x7f, 0xff, 0x26, 0xcc, 0x95, 0xff, 0x27, 0xc5, 0x8e, 0xff, 0x39, 0xc9, 0x8c, 0xff, 0x3b, 0xc8, 0x89, 0xff, 0x39, 0xc5, 0x86, 0xff, 0x34, 0xc3, 0x85, 0xff, 0x2f, 0xc6, 0x88, 0xff, 0x2c, 0xc8, 0x8a, 0xff, 0x2b, 0xc8, 0x8a, 0xff, 0x2c, 0xcb, 0x87, 0xff, 0x1a, 0xb1, 0x85, 0xff, 0x12, 0x9d, 0x7f, 0xff, 0x14, 0xa2, 0x7b, 0xff, 0x14, 0xa7, 0x74, 0xff, 0x2b, 0xc7, 0x7f, 0xff, 0x1a, 0xac, 0x60, 0xff, 0x2b, 0x5a, 0xbf, 0xff, 0xb6, 0x67, 0xff, 0xff, 0xfd, 0x91, 0xff, 0xff, 0xe6, 0x82, 0xfa, 0xff, 0x36, 0x62, 0xb4, 0xff, 0x00, 0xbf, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x5e, 0xa1, 0x94, 0xff, 0x4a, 0x44, 0xb9, 0xff, 0x28, 0x00, 0x86, 0xff, 0x00, 0x00, 0xb3, 0xff, 0x00, 0x41, 0xd9, 0xff, 0x28, 0x55, 0xc5, 0xff, 0x00, 0x4f, 0xa8, 0xff, 0x00, 0x51, 0x92, 0xff, 0x2f, 0x74, 0xd5, 0xff, 0x56, 0x90, 0xfb, 0xff, 0x70, 0x99, 0xff, 0xff, 0x78, 0x98, 0xfe, 0xff, 0x5e, 0x9c, 0xfe, 0xff, 0x00, 0xab, 0xfb, 0xff, 0x32, 0xaf, 0x92, 0xff, 0x44, 0xb1, 0x00, 0xff, 0x46, 0xb0, 0x2d, 0xff, 0x4b, 0xb4, 0x25, 0xff, 0x48, 0x9d, 0x74, 0xff, 0x1e, 0x80, 0x90, 0xff, 0xad, 0xc1, 0x26, 0xff, 0x92, 0xa6, 0x00, 0xff, 0xa4, 0x9a, 0x00, 0xff, 0xbe, 0x68, 0x00, 0xff, 0xb9, 0x8d, 0x1f, 0xff, 0x5e, 0xcd, 0x3d, 0xff, 0x62, 0xca, 0x3a, 0xff, 0x5f, 0xc9, 0x3b, 0xff, 0x61, 0xc8, 0x3c, 0xff, 0x61, 0xc6, 0x41, 0xff, 0x58, 0xbb, 0x52, 0xff, 0x5f, 0xc5, 0x47, 0xff, 0x61, 0xc7, 0x42, 0xff, 0x5d, 0xc5, 0x40, 0xff, 0x5c, 0xbe, 0x3e, 0xff, 0x4c, 0x97, 0x31, 0xff, 0x4a, 0x9a, 0x31, 0xff, 0x61, 0xc7, 0x3b, 0xff, 0x5f, 0xc7, 0x39, 0xff, 0x5c, 0xc4, 0x3d, 0xff, 0x5a, 0xbf, 0x3e, 0xff, 0x5e, 0xc3, 0x3d, 0xff, 0x5e, 0xc2, 0x3d, 0xff, 0x5d, 0xc0, 0x3c, 0xff, 0x5b, 0xc0, 0x3b, 0xff, 0x5b, 0xc3, 0x3c, 0xff, 0x5d, 0xc5, 0x3e, 0xff, 0x5c, 0xc7, 0x3e, 0xff, 0x55, 0xc5, 0x40, 0xff, 0x59, 0xce, 0x49, 0xff, 0x50, 0xbc, 0x48, 0xff, 0x4c, 0xae, 0x43, 0xff, 0x43, 0x9c, 0x36, 0xff, 0x3f, 0x9b, 0x2f, 0xff, 0x3d, 0xb1, 0x38, 0xff, 0x48, 0xba, 0x33, 0xff, 0x47, 0xbb, 0x2c, 0xff, 0x0b, 0xb2, 0x66, 0xff, 0x00, 0xa6, 0x6c, 0xff, 0x04, 0xa0, 0x60, 0xff, 0x03, 0xbf, 0x92, 0xff, 0x15, 0xcb, 0x99, 0xff, 0x17, 0xca, 0x94, 0xff, 0x33, 0xc5, 0x8f, 0xff, 0x3e, 0xc3, 0x8c, 0xff, 0x2d, 0xc4, 0x8c, 0xff, 0x28, 0xc6, 0x8e, 0xff, 0x29, 0xc7, 0x8f, 0xff, 0x29, 0xc6, 0x8e, 0xff, 0x28, 0xc9, 0x8e, 0xff, 0x2e, 0xcc, 0x93, 0xff, 0x2c, 0xcb, 0x90, 0xff, 0x1a, 0xb7, 0x86, 0xff, 0x13, 0xa2, 0x81, 0xff, 0x17, 0xa2, 0x7b, 0xff, 0x12, 0xa6, 0x73, 0xff, 0x1f, 0xc3, 0x84, 0xff, 0x23, 0xb7, 0x6f, 0xff, 0x1a, 0x6d, 0x99, 0xff, 0x00, 0x54, 0xef, 0xff, 0x91, 0x7d, 0xfa, 0xff, 0xaf, 0x7c, 0xe6, 0xff, 0x16, 0x59, 0x89, 0xff, 0x24, 0xa4, 0x55, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x75, 0xa3, 0xff, 0x6f, 0x2e, 0xbd, 0xff, 0xa1, 0x00, 0xc2, 0xff, 0x62, 0x1b, 0xdd, 0xff, 0x18, 0x23, 0xc4, 0xff, 0x15, 0x14, 0xab, 0xff, 0x17, 0x46, 0xa0, 0xff, 0x00, 0x3d, 0x78, 0xff, 0x00, 0x3c, 0x7e, 0xff, 0x39, 0x52, 0xb1, 0xff, 0x91, 0x70, 0xee, 0xff, 0xbf, 0x80, 0xff, 0xff, 0xb6, 0x84, 0xff, 0xff, 0x64, 0x94, 0xf6, 0xff, 0x33, 0xad, 0x69, 0xff, 0x40, 0xaf, 0x15, 0xff, 0x41, 0xad, 0x2c, 0xff, 0x4e, 0xb1, 0x27, 0xff, 0x53, 0xa9, 0x45, 0xff, 0x8b, 0x9c, 0x11, 0xff, 0x9e, 0xab, 0x00, 0xff, 0x5b, 0x7c, 0x00, 0xff, 0x8a, 0x86, 0x00, 0xff, 0xf7, 0x79, 0x00, 0xff, 0xe3, 0x76, 0x11, 0xff, 0x6a, 0xca, 0x39, 0xff, 0x62, 0xcb, 0x3b, 0xff, 0x61, 0xca, 0x3a, 0xff, 0x57, 0xba, 0x53, 0xff, 0x5b, 0xaf, 0x5c, 0xff, 0x3a, 0x8f, 0x77, 0xff, 0x54, 0xb9, 0x56, 0xff, 0x61, 0xc8, 0x40, 0xff, 0x5e, 0xc5, 0x41, 0xff, 0x5d, 0xc2, 0x40, 0xff, 0x50, 0xa9, 0x37, 0xff, 0x5b, 0xbb, 0x3e, 0xff, 0x61, 0xc5, 0x40, 0xff, 0x62, 0xc6, 0x43, 0xff, 0x63, 0xc6, 0x4c, 0xff, 0x5b, 0xbf, 0x46, 0xff, 0x5d, 0xc1, 0x41, 0xff, 0x5e, 0xc3, 0x40, 0xff, 0x5f, 0xc4, 0x40, 0xff, 0x5e, 0xc5, 0x41, 0xff, 0x5a, 0xc6, 0x3f, 0xff, 0x58, 0xc5, 0x40, 0xff, 0x58, 0xc5, 0x3f, 0xff, 0x57, 0xc4, 0x41, 0xff, 0x5c, 0xcb, 0x46, 0xff, 0x4c, 0xb3, 0x3d, 0xff, 0x3a, 0x98, 0x3e, 0xff, 0x3f, 0xae, 0x52, 0xff, 0x1e, 0x8c, 0x48, 0xff, 0x20, 0xa0, 0x3c, 0xff, 0x3e, 0xbd, 0x2b, 0xff, 0x41, 0xbd, 0x32, 0xff, 0x00, 0xb7, 0x85, 0xff, 0x00, 0xb6, 0x7d, 0xff, 0x00, 0xb0, 0x7f, 0xff, 0x00, 0xce, 0xc7, 0xff, 0x14, 0xcd, 0xa8, 0xff, 0x1d, 0xc5, 0x9d, 0xff, 0x27, 0xc4, 0xa3, 0xff, 0x2b, 0xc4, 0x94, 0xff, 0x24, 0xc8, 0x93, 0xff, 0x21, 0xc6, 0x91, 0xff, 0x20, 0xc1, 0x8b, 0xff, 0x13, 0x98, 0x63, 0xff, 0x1a, 0xbe, 0x81, 0xff, 0x24, 0xd2, 0xa0, 0xff, 0x27, 0xcf, 0x9f, 0xff, 0x1e, 0xc0, 0x83, 0xff, 0x12, 0x9f, 0x84, 0xff, 0x17, 0xa7, 0x7f, 0xff, 0x07, 0xa1, 0x77, 0xff, 0x17, 0xc6, 0x88, 0xff, 0x1a, 0xbd, 0x7c, 0xff, 0x27, 0x82, 0x78, 0xff, 0x08, 0x7b, 0xd7, 0xff, 0x00, 0x78, 0xd8, 0xff, 0x00, 0x46, 0x88, 0xff, 0x07, 0x52, 0x6d, 0xff, 0x2b, 0x98, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1d, 0x63, 0xb9, 0xff, 0x1c, 0x16, 0xca, 0xff, 0x85, 0x00, 0xda, 0xff, 0x62, 0x2d, 0xe9, 0xff, 0x0e, 0x1e, 0xb6, 0xff, 0x12, 0x23, 0xc7, 0xff, 0x16, 0x48, 0x9c, 0xff, 0x00, 0x40, 0x80, 0xff, 0x00, 0x43, 0x84, 0xff, 0x00, 0x40, 0x81, 0xff, 0x1f, 0x44, 0x9b, 0xff, 0x8e, 0x58, 0xda, 0xff, 0xd5, 0x6c, 0xff, 0xff, 0xb4, 0x7f, 0xe7, 0xff, 0x1c, 0xac, 0x3c, 0xff, 0x49, 0xb0, 0x1e, 0xff, 0x63, 0xb1, 0x19, 0xff, 0x73, 0xb4, 0x07, 0xff, 0x6d, 0xaf, 0x1d, 0xff, 0x8b, 0xa9, 0x1f, 0xff, 0xa1, 0xb0, 0x00, 0xff, 0x8c, 0x98, 0x00, 0xff, 0x41, 0x58, 0x00, 0xff, 0xcb, 0x2d, 0x00, 0xff, 0xf3, 0x65, 0x03, 0xff, 0x8e, 0xc0, 0x33, 0xff, 0x5f, 0xcb, 0x3d, 0xff, 0x64, 0xcb, 0x3a, 0xff, 0x4b, 0xa7, 0x6c, 0xff, 0x54, 0x96, 0x6f, 0xff, 0x42, 0x8c, 0x7e, 0xff, 0x49, 0xa3, 0x71, 0xff, 0x60, 0xc6, 0x42, 0xff, 0x5e, 0xc5, 0x41, 0xff, 0x5e, 0xc4, 0x42, 0xff, 0x60, 0xc6, 0x43, 0xff, 0x5f, 0xc5, 0x43, 0xff, 0x61, 0xc4, 0x44, 0xff, 0x60, 0xc3, 0x48, 0xff, 0x5f, 0xc3, 0x49, 0xff, 0x5c, 0xc1, 0x47, 0xff, 0x62, 0xc7, 0x46, 0xff, 0x62, 0xc8, 0x43, 0xff, 0x61, 0xc8, 0x43, 0xff, 0x60, 0xc8, 0x42, 0xff, 0x4c, 0xad, 0x38, 0xff, 0x52, 0xbb, 0x3f, 0xff, 0x58, 0xc5, 0x41, 0xff, 0x55, 0xc2, 0x41, 0xff, 0x51, 0xc1, 0x46, 0xff, 0x43, 0xb4, 0x48, 0xff, 0x29, 0x8f, 0x3f, 0xff, 0x28, 0xa7, 0x59, 0xff, 0x13, 0x86, 0x45, 0xff, 0x16, 0xbd, 0x8c, 0xff, 0x21, 0xea, 0xcd, 0xff, 0x18, 0xc4, 0x9c, 0xff, 0x00, 0xa4, 0x6d, 0xff, 0x03, 0xae, 0xa4, 0xff, 0x02, 0xb0, 0xa7, 0xff, 0x03, 0xbc, 0xcb, 0xff, 0x0f, 0xc1, 0xbf, 0xff, 0x07, 0xc6, 0xa8, 0xff, 0x00, 0xc7, 0xa6, 0xff, 0x1a, 0xc7, 0x9a, 0xff, 0x22, 0xc8, 0x93, 0xff, 0x13, 0x9a, 0x6c, 0xff, 0x0e, 0x9a, 0x6c, 0xff, 0x11, 0x9b, 0x6d, 0xff, 0x0e, 0xae, 0x76, 0xff, 0x16, 0xcf, 0x96, 0xff, 0x1d, 0xcd, 0x97, 0xff, 0x17, 0xb5, 0x84, 0xff, 0x06, 0x93, 0x84, 0xff, 0x14, 0xbf, 0x88, 0xff, 0x11, 0xc6, 0x8b, 0xff, 0x11, 0xc7, 0x8b, 0xff, 0x11, 0xc1, 0x86, 0xff, 0x20, 0x93, 0x6c, 0xff, 0x14, 0x89, 0xc6, 0xff, 0x00, 0x69, 0xa8, 0xff, 0x00, 0x2c, 0x16, 0xff, 0x07, 0x50, 0x87, 0xff, 0x36, 0x8d, 0x99, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x69, 0xc9, 0xff, 0x00, 0x5f, 0xe7, 0xff, 0x1e, 0xa9, 0xf6, 0xff, 0x0e, 0x68, 0xf2, 0xff, 0x08, 0x12, 0xcc, 0xff, 0x14, 0x2c, 0xdc, 0xff, 0x0f, 0x45, 0x8b, 0xff, 0x00, 0x40, 0x7e, 0xff, 0x00, 0x45, 0x84, 0xff, 0x01, 0x47, 0x88, 0xff, 0x00, 0x44, 0x84, 0xff, 0x00, 0x3e, 0x8a, 0xff, 0x6d, 0x3a, 0xc2, 0xff, 0xb0, 0x7f, 0xb3, 0xff, 0x7a, 0xb4, 0x00, 0xff, 0x71, 0xb6, 0x00, 0xff, 0x7b, 0xb7, 0x00, 0xff, 0x7c, 0xb6, 0x00, 0xff, 0x74, 0xae, 0x1b, 0xff, 0x3d, 0x9e, 0x2c, 0xff, 0x81, 0xab, 0x00, 0xff, 0xbb, 0xb8, 0x00, 0xff, 0x99, 0x65, 0x00, 0xff, 0xd1, 0x00, 0x00, 0xff, 0xdd, 0x2d, 0x00, 0xff, 0x96, 0xb0, 0x32, 0xff, 0x5f, 0xcb, 0x3f, 0xff, 0x66, 0xc9, 0x3e, 0xff, 0x5e, 0xbd, 0x52, 0xff, 0x4c, 0x97, 0x71, 0xff, 0x45, 0x8e, 0x73, 0xff, 0x43, 0x99, 0x76, 0xff, 0x5f, 0xc6, 0x44, 0xff, 0x5f, 0xc6, 0x41, 0xff, 0x5e, 0xc5, 0x43, 0xff, 0x5d, 0xc3, 0x47, 0xff, 0x5d, 0xc0, 0x48, 0xff, 0x5f, 0xc1, 0x4f, 0xff, 0x5e, 0xc5, 0x5c, 0xff, 0x5e, 0xc8, 0x52, 0xff, 0x5e, 0xc5, 0x45, 0xff, 0x61, 0xc7, 0x44, 0xff, 0x60, 0xc6, 0x41, 0xff, 0x4d, 0xa8, 0x30, 0xff, 0x59, 0xc3, 0x42, 0xff, 0x37, 0x8b, 0x31, 0xff, 0x49, 0xa8, 0x3d, 0xff, 0x4e, 0xbd, 0x48, 0xff, 0x3b, 0xad, 0x4a, 0xff, 0x1d, 0x96, 0x51, 0xff, 0x00, 0x82, 0x56, 0xff, 0x00, 0x7a, 0x4c, 0xff, 0x03, 0x8e, 0x57, 0xff, 0x00, 0x8b, 0x5c, 0xff, 0x06, 0xc9, 0xae, 0xff, 0x0d, 0xfd, 0xf5, 0xff, 0x00, 0xcc, 0xce, 0xff, 0x00, 0x9c, 0x7f, 0xff, 0x14, 0xb7, 0xb2, 0xff, 0x0b, 0xcd, 0xe4, 0xff, 0x00, 0xaf, 0xb6, 0xff, 0x00, 0xb5, 0xb3, 0xff, 0x00, 0xc6, 0xb1, 0xff, 0x02, 0xcb, 0xa3, 0xff, 0x12, 0xce, 0xba, 0xff, 0x0c, 0xce, 0xbf, 0xff, 0x0a, 0xb1, 0x90, 0xff, 0x09, 0x99, 0x6f, 0xff, 0x11, 0x9a, 0x6c, 0xff, 0x0d, 0xa7, 0x72, 0xff, 0x12, 0xcd, 0x93, 0xff, 0x14, 0xca, 0x99, 0xff, 0x17, 0xc4, 0x85, 0xff, 0x13, 0xc7, 0x86, 0xff, 0x12, 0xca, 0x8b, 0xff, 0x13, 0xc8, 0x8f, 0xff, 0x0f, 0xc9, 0x94, 0xff, 0x12, 0xc7, 0x9a, 0xff, 0x0e, 0xa4, 0x75, 0xff, 0x0e, 0x7a, 0x99, 0xff, 0x00, 0x3b, 0x69, 0xff, 0x00, 0x2c, 0x44, 0xff, 0x0b, 0x46, 0x65, 0xff, 0x55, 0x86, 0x32, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x46, 0xc5, 0x46, 0xff, 0x1c, 0xc9, 0xdd, 0xff, 0x1b, 0xe4, 0xfa, 0xff, 0x26, 0xff, 0xfe, 0xff, 0x17, 0xa9, 0xed, 0xff, 0x0b, 0x00, 0xd1, 0xff, 0x22, 0x37, 0xcf, 0xff, 0x0b, 0x40, 0x79, 0xff, 0x00, 0x40, 0x79, 0xff, 0x00, 0x45, 0x7f, 0xff, 0x01, 0x47, 0x84, 0xff, 0x00, 0x40, 0x82, 0xff, 0x00, 0x3f, 0x84, 0xff, 0x28, 0x4b, 0x61, 0xff, 0xb9, 0x8b, 0x03, 0xff, 0xf3, 0xb1, 0x00, 0xff, 0xcd, 0xae, 0x00, 0xff, 0x9d, 0xb1, 0x02, 0xff, 0x86, 0xb1, 0x06, 0xff, 0x6a, 0xa7, 0x0e, 0xff, 0x6f, 0xa4, 0x1a, 0xff, 0x71, 0xa2, 0x08, 0xff, 0xd4, 0xd0, 0x01, 0xff, 0xda, 0x7c, 0x00, 0xff, 0xe9, 0x00, 0x00, 0xff, 0xb8, 0x21, 0x18, 0xff, 0x45, 0xa1, 0x4b, 0xff, 0x66, 0xca, 0x40, 0xff, 0x65, 0xc7, 0x40, 0xff, 0x63, 0xc4, 0x47, 0xff, 0x57, 0xb1, 0x5f, 0xff, 0x5d, 0xb9, 0x58, 0xff, 0x5d, 0xbf, 0x53, 0xff, 0x62, 0xc7, 0x43, 0xff, 0x60, 0xc5, 0x46, 0xff, 0x5d, 0xc1, 0x4d, 0xff, 0x61, 0xc0, 0x52, 0xff, 0x65, 0xc5, 0x52, 0xff, 0x66, 0xc7, 0x51, 0xff, 0x63, 0xc9, 0x58, 0xff, 0x61, 0xc9, 0x51, 0xff, 0x5c, 0xc5, 0x43, 0xff, 0x5c, 0xc6, 0x46, 0xff, 0x5c, 0xc5, 0x51, 0xff, 0x3e, 0x90, 0x50, 0xff, 0x51, 0xb2, 0x46, 0xff, 0x36, 0x8d, 0x3f, 0xff, 0x2d, 0x7f, 0x38, 0xff, 0x1f, 0x96, 0x50, 0xff, 0x00, 0x8b, 0x59, 0xff, 0x00, 0x83, 0x64, 0xff, 0x00, 0x7b, 0x63, 0xff, 0x00, 0x8f, 0x79, 0xff, 0x00, 0xa2, 0x90, 0xff, 0x00, 0x97, 0x75, 0xff, 0x00, 0x9d, 0x75, 0xff, 0x00, 0xbd, 0xb2, 0xff, 0x13, 0xac, 0xbd, 0xff, 0x12, 0x8c, 0x9a, 0xff, 0x00, 0x8e, 0x8a, 0xff, 0x00, 0xc3, 0xcd, 0xff, 0x00, 0xbb, 0xc7, 0xff, 0x00, 0x97, 0x98, 0xff, 0x00, 0xbc, 0xcf, 0xff, 0x04, 0xd5, 0xde, 0xff, 0x0a, 0xd6, 0xd9, 0xff, 0x00, 0xd2, 0xd7, 0xff, 0x01, 0xaa, 0x90, 0xff, 0x07, 0xa1, 0x75, 0xff, 0x05, 0x9c, 0x6f, 0xff, 0x0b, 0xb0, 0x7c, 0xff, 0x11, 0xcb, 0x93, 0xff, 0x10, 0xcc, 0xa5, 0xff, 0x18, 0xc7, 0x8c, 0xff, 0x13, 0xc8, 0x89, 0xff, 0x15, 0xc9, 0x94, 0xff, 0x25, 0xcd, 0x9e, 0xff, 0x0d, 0xc9, 0x9f, 0xff, 0x00, 0xc5, 0x9b, 0xff, 0x07, 0xb1, 0x84, 0xff, 0x29, 0x7a, 0x57, 0xff, 0x08, 0x11, 0x4e, 0xff, 0x00, 0x16, 0x6f, 0xff, 0x00, 0x52, 0x73, 0xff, 0x4a, 0x8d, 0x42, 0xff, 0x9f, 0xdf, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x42, 0xd0, 0x87, 0xff, 0x34, 0xf3, 0xef, 0xff, 0x2a, 0xfe, 0xff, 0xff, 0x32, 0xff, 0xff, 0xff, 0x31, 0xed, 0xf7, 0xff, 0x1d, 0x53, 0xe3, 0xff, 0x2f, 0x38, 0xb7, 0xff, 0x06, 0x3c, 0x71, 0xff, 0x00, 0x3e, 0x72, 0xff, 0x00, 0x40, 0x76, 0xff, 0x00, 0x3e, 0x7b, 0xff, 0x32, 0x43, 0x7b, 0xff, 0x6d, 0x5c, 0x4b, 0xff, 0x6c, 0x6a, 0x00, 0xff, 0xab, 0x88, 0x00, 0xff, 0xfb, 0xaa, 0x01, 0xff, 0xff, 0xab, 0x00, 0xff, 0xf8, 0xa7, 0x00, 0xff, 0xb1, 0xa8, 0x06, 0xff, 0x46, 0xa0, 0x0a, 0xff, 0x97, 0xa9, 0x0d, 0xff, 0x9b, 0x9c, 0x02, 0xff, 0xaf, 0xa4, 0x00, 0xff, 0xdb, 0x3d, 0x00, 0xff, 0xc9, 0x26, 0x00, 0xff, 0x40, 0x47, 0x2d, 0xff, 0x1f, 0x97, 0x68, 0xff, 0x63, 0xc7, 0x43, 0xff, 0x65, 0xc5, 0x42, 0xff, 0x64, 0xc4, 0x46, 0xff, 0x64, 0xc4, 0x49, 0xff, 0x63, 0xc3, 0x4d, 0xff, 0x60, 0xc1, 0x4d, 0xff, 0x5f, 0xc0, 0x52, 0xff, 0x60, 0xc2, 0x57, 0xff, 0x62, 0xc5, 0x56, 0xff, 0x69, 0xc9, 0x56, 0xff, 0x69, 0xca, 0x55, 0xff, 0x62, 0xc4, 0x4e, 0xff, 0x56, 0xba, 0x42, 0xff, 0x54, 0xc5, 0x47, 0xff, 0x46, 0xc1, 0x67, 0xff, 0x46, 0xc3, 0x8c, 0xff, 0x50, 0xce, 0xa3, 0xff, 0x48, 0xb1, 0x8b, 0xff, 0x41, 0x91, 0x40, 0xff, 0x29, 0x77, 0x30, 0xff, 0x1b, 0x68, 0x23, 0xff, 0x10, 0x8a, 0x4b, 0xff, 0x0c, 0x8f, 0x5c, 0xff, 0x1b, 0x8d, 0x6a, 0xff, 0x35, 0x95, 0x71, 0xff, 0x1e, 0xc5, 0xa8, 0xff, 0x00, 0xd9, 0xcc, 0xff, 0x59, 0xbe, 0x98, 0xff, 0xa4, 0x98, 0x5c, 0xff, 0x87, 0x89, 0xb0, 0xff, 0x79, 0x8a, 0xf1, 0xff, 0x5f, 0x7d, 0xdd, 0xff, 0x32, 0x75, 0x9d, 0xff, 0x02, 0x65, 0x67, 0xff, 0x01, 0x77, 0x81, 0xff, 0x01, 0x7a, 0x83, 0xff, 0x00, 0xa3, 0xbd, 0xff, 0x00, 0xcb, 0xe7, 0xff, 0x0a, 0xd8, 0xf5, 0xff, 0x00, 0xca, 0xeb, 0xff, 0x00, 0x96, 0x9b, 0xff, 0x02, 0xa2, 0x7c, 0xff, 0x03, 0xc3, 0x8e, 0xff, 0x08, 0xc7, 0x91, 0xff, 0x0c, 0xc6, 0x90, 0xff, 0x1f, 0xc8, 0xa3, 0xff, 0x21, 0xc9, 0xa1, 0xff, 0x14, 0xc8, 0x9b, 0xff, 0x05, 0xc7, 0xa0, 0xff, 0x04, 0xc6, 0x9d, 0xff, 0x00, 0xc5, 0x9b, 0xff, 0x00, 0xc4, 0x9b, 0xff, 0x00, 0xb9, 0x91, 0xff, 0x48, 0x89, 0x63, 0xff, 0x39, 0x23, 0x84, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x14, 0x62, 0xff, 0x1f, 0x5f, 0x9e, 0xff, 0x52, 0xad, 0x73, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2c, 0xdd, 0xb7, 0xff, 0x26, 0xfc, 0xfa, 0xff, 0x2f, 0xfc, 0xff, 0xff, 0x29, 0xde, 0xeb, 0xff, 0x1e, 0xa2, 0xd1, 0xff, 0x24, 0x46, 0xe8, 0xff, 0x34, 0x43, 0xad, 0xff, 0x00, 0x39, 0x70, 0xff, 0x00, 0x3c, 0x73, 0xff, 0x00, 0x38, 0x71, 0xff, 0x82, 0x44, 0x64, 0xff, 0xd3, 0x63, 0x35, 0xff, 0x9c, 0x6b, 0x00, 0xff, 0x6c, 0x69, 0x00, 0xff, 0xa5, 0x87, 0x00, 0xff, 0xe0, 0xa1, 0x00, 0xff, 0xf8, 0xa7, 0x00, 0xff, 0xf5, 0xa6, 0x00, 0xff, 0x83, 0xa0, 0x06, 0xff, 0x43, 0x9d, 0x07, 0xff, 0x89, 0xa8, 0x0e, 0xff, 0xc9, 0xa8, 0x00, 0xff, 0x96, 0x9c, 0x00, 0xff, 0xac, 0x64, 0x07, 0xff, 0x5f, 0x47, 0x16, 0xff, 0x00, 0x5b, 0x3e, 0xff, 0x15, 0x92, 0x80, 0xff, 0x5e, 0xc4, 0x4e, 0xff, 0x67, 0xc6, 0x43, 0xff, 0x64, 0xc3, 0x46, 0xff, 0x62, 0xbf, 0x4e, 0xff, 0x61, 0xbc, 0x5d, 0xff, 0x61, 0xbc, 0x67, 0xff, 0x64, 0xc0, 0x6f, 0xff, 0x67, 0xc5, 0x67, 0xff, 0x6c, 0xc9, 0x57, 0xff, 0x69, 0xc4, 0x51, 0xff, 0x56, 0xb2, 0x4c, 0xff, 0x53, 0xb4, 0x54, 0xff, 0x2c, 0x7f, 0x48, 0xff, 0x3f, 0xc3, 0x9b, 0xff, 0x3d, 0xc6, 0xbb, 0xff, 0x3a, 0xbf, 0xb1, 0xff, 0x32, 0xaf, 0x8e, 0xff, 0x2d, 0x92, 0x58, 0xff, 0x2d, 0x7e, 0x3f, 0xff, 0x36, 0x97, 0x5c, 0xff, 0x39, 0x98, 0x6f, 0xff, 0x37, 0x93, 0x68, 0xff, 0x4c, 0x9d, 0x7c, 0xff, 0x54, 0xa0, 0x79, 0xff, 0x4e, 0xa4, 0x6b, 0xff, 0x36, 0xb5, 0x6f, 0xff, 0x5c, 0xb8, 0x8b, 0xff, 0xdb, 0xbe, 0x83, 0xff, 0xfb, 0xa8, 0x67, 0xff, 0xa6, 0x95, 0xa1, 0xff, 0x59, 0x94, 0xd6, 0xff, 0x43, 0x8a, 0xd6, 0xff, 0x30, 0x7a, 0xab, 0xff, 0x22, 0x65, 0x90, 0xff, 0x0f, 0x4b, 0x65, 0xff, 0x00, 0x55, 0x63, 0xff, 0x10, 0x63, 0x76, 0xff, 0x2d, 0x90, 0xa5, 0xff, 0x00, 0xaf, 0xc4, 0xff, 0x00, 0xc7, 0xe8, 0xff, 0x01, 0xdb, 0xfb, 0xff, 0x00, 0xd5, 0xef, 0xff, 0x00, 0xc6, 0xbe, 0xff, 0x00, 0xc6, 0x94, 0xff, 0x21, 0xc7, 0x97, 0xff, 0x2c, 0xc9, 0xa5, 0xff, 0x11, 0xcc, 0xad, 0xff, 0x00, 0xc9, 0xa5, 0xff, 0x00, 0xc7, 0xa2, 0xff, 0x00, 0xc5, 0x9f, 0xff, 0x00, 0xc4, 0x9d, 0xff, 0x00, 0xc4, 0x9e, 0xff, 0x00, 0xbf, 0x99, 0xff, 0x16, 0x86, 0x77, 0xff, 0x1b, 0x22, 0xbf, 0xff, 0x00, 0x00, 0x95, 0xff, 0x00, 0x00, 0x86, 0xff, 0x0e, 0x40, 0xeb, 0xff, 0x3a, 0x96, 0xae, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x27, 0xc8, 0xc4, 0xff, 0x07, 0xcd, 0xdd, 0xff, 0x0b, 0x92, 0xd2, 0xff, 0x00, 0x30, 0xc7, 0xff, 0x00, 0x00, 0xc6, 0xff, 0x21, 0x2c, 0xdd, 0xff, 0x22, 0x3f, 0x8c, 0xff, 0x00, 0x33, 0x69, 0xff, 0x00, 0x3b, 0x75, 0xff, 0xae, 0x4f, 0x5a, 0xff, 0xf9, 0x5f, 0x0d, 0xff, 0xf7, 0x65, 0x00, 0xff, 0xa4, 0x6a, 0x00, 0xff, 0x75, 0x66, 0x00, 0xff, 0xb4, 0x89, 0x00, 0xff, 0xdd, 0xa0, 0x00, 0xff, 0xe8, 0xa0, 0x00, 0xff, 0xb9, 0x9e, 0x01, 0xff, 0x45, 0x9c, 0x08, 0xff, 0x58, 0x9f, 0x13, 0xff, 0x6f, 0xa7, 0x26, 0xff, 0x7d, 0x94, 0x62, 0xff, 0x36, 0x89, 0x92, 0xff, 0x1e, 0x65, 0x2a, 0xff, 0x00, 0x48, 0x1a, 0xff, 0x00, 0x64, 0x40, 0xff, 0x03, 0x7b, 0x5e, 0xff, 0x58, 0xb9, 0x4f, 0xff, 0x65, 0xc5, 0x51, 0xff, 0x60, 0xc0, 0x6b, 0xff, 0x63, 0xbc, 0x7b, 0xff, 0x6d, 0xbf, 0x85, 0xff, 0x77, 0xc4, 0x88, 0xff, 0x78, 0xc7, 0x7f, 0xff, 0x72, 0xc7, 0x62, 0xff, 0x6b, 0xc5, 0x57, 0xff, 0x56, 0xb3, 0x5d, 0xff, 0x3c, 0x88, 0x50, 0xff, 0x51, 0xac, 0x71, 0xff, 0x20, 0x7b, 0x6f, 0xff, 0x37, 0xaf, 0xa6, 0xff, 0x3a, 0xac, 0x87, 0xff, 0x2f, 0x9d, 0x5d, 0xff, 0x2d, 0x9d, 0x61, 0xff, 0x3d, 0xa9, 0x76, 0xff, 0x46, 0xb4, 0x8a, 0xff, 0x58, 0xc6, 0xc2, 0xff, 0x4f, 0xc9, 0xe4, 0xff, 0x45, 0xa4, 0xae, 0xff, 0x59, 0x92, 0x75, 0xff, 0x62, 0x99, 0x6a, 0xff, 0x76, 0xa5, 0x63, 0xff, 0x88, 0xab, 0x62, 0xff, 0x9d, 0xae, 0x6c, 0xff, 0xbe, 0xae, 0x75, 0xff, 0x9f, 0x8d, 0x67, 0xff, 0x61, 0x85, 0x70, 0xff, 0x48, 0x81, 0x6b, 0xff, 0x37, 0x7c, 0x73, 0xff, 0x20, 0x7e, 0x80, 0xff, 0x1f, 0x75, 0x92, 0xff, 0x2f, 0x54, 0x62, 0xff, 0x0b, 0x51, 0x64, 0xff, 0x74, 0x41, 0x55, 0xff, 0xce, 0x34, 0x4b, 0xff, 0xa7, 0x5a, 0x8e, 0xff, 0x3f, 0xa5, 0xd1, 0xff, 0x00, 0xc9, 0xec, 0xff, 0x0d, 0xcc, 0xf1, 0xff, 0x3b, 0xca, 0xf6, 0xff, 0x39, 0xc4, 0xea, 0xff, 0x0c, 0xbd, 0xbe, 0xff, 0x01, 0xc6, 0x9c, 0xff, 0x00, 0xc8, 0x9e, 0xff, 0x00, 0xc9, 0xa4, 0xff, 0x00, 0xca, 0xa9, 0xff, 0x00, 0xc8, 0xa9, 0xff, 0x00, 0xc5, 0xa5, 0xff, 0x00, 0xc4, 0xa1, 0xff, 0x00, 0xc3, 0x9f, 0xff, 0x0b, 0x8c, 0x7a, 0xff, 0x20, 0x0c, 0x9c, 0xff, 0x16, 0x00, 0xae, 0xff, 0x00, 0x2b, 0xcf, 0xff, 0x03, 0x51, 0xfd, 0xff, 0x28, 0x87, 0xc9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0x1c, 0x83, 0xa7, 0xff, 0x00, 0x25, 0x93, 0xff, 0x00, 0x00, 0xa8, 0xff, 0x00, 0x71, 0xdb, 0xff, 0x15, 0x71, 0xd3, 0xff, 0x15, 0x11, 0xe0, 0xff, 0x00, 0x2b, 0x76, 0xff, 0x4a, 0x2e, 0x65, 0xff, 0xcf, 0x49, 0x49, 0xff, 0xff, 0x62, 0x00, 0xff, 0xff, 0x65, 0x00, 0xff, 0xfc, 0x66, 0x00, 0xff, 0xc7, 0x67, 0x00, 0xff, 0x87, 0x64, 0x00, 0xff, 0xbf, 0x8a, 0x00, 0xff, 0xf3, 0xa5, 0x00, 0xff, 0xdc, 0xa1, 0x03, 0xff, 0x6e, 0x9d, 0x16, 0xff, 0x4e, 0x99, 0x08, 0xff, 0x59, 0x9c, 0x0d, 0xff, 0x62, 0x9f, 0x19, 0xff, 0x3a, 0xa5, 0xba, 0xff, 0x00, 0x8d, 0xb6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x1d, 0x00, 0xff, 0x00, 0x70, 0x4b, 0xff, 0x00, 0x61, 0x3b, 0xff, 0x51, 0x9e, 0x60, 0xff, 0x6a, 0xbf, 0x98, 0xff, 0x6c, 0xc0, 0xae, 0xff, 0x7d, 0xc9, 0xa8, 0xff, 0x84, 0xc7, 0x96, 0xff, 0x76, 0xb8, 0x83, 0xff, 0x5a, 0xa1, 0x86, 0xff, 0x5b, 0xb6, 0x78, 0xff, 0x3f, 0xb8, 0x90, 0xff, 0x3a, 0xb4, 0x87, 0xff, 0x3b, 0x95, 0x61, 0xff, 0x47, 0x8e, 0x66, 0xff, 0x3b, 0x70, 0x69, 0xff, 0x44, 0x87, 0x5a, 0xff, 0x65, 0xb2, 0x89, 0xff, 0x6f, 0xb8, 0x9c, 0xff, 0x57, 0xbc, 0x9c, 0xff, 0x4e, 0xb5, 0x8c, 0xff, 0x63, 0xb0, 0x91, 0xff, 0x73, 0xb8, 0xcd, 0xff, 0x4a, 0xcd, 0xf3, 0xff, 0x5a, 0xaf, 0xb2, 0xff, 0x7a, 0x9b, 0x60, 0xff, 0x8f, 0xad, 0x5e, 0xff, 0x94, 0xb3, 0x59, 0xff, 0x83, 0xa6, 0x53, 0xff, 0x5b, 0x84, 0x44, 0xff, 0x3f, 0x77, 0x41, 0xff, 0x2a, 0x63, 0x2b, 0xff, 0x72, 0x7f, 0x35, 0xff, 0x93, 0x8d, 0x33, 0xff, 0x84, 0x87, 0x43, 0xff, 0x63, 0x85, 0x65, 0xff, 0x33, 0x70, 0x66, 0xff, 0x27, 0x5a, 0x50, 0xff, 0x27, 0x67, 0x6f, 0xff, 0x75, 0x4b, 0x5f, 0xff, 0xd4, 0x2d, 0x5f, 0xff, 0xf1, 0x13, 0xa6, 0xff, 0xcf, 0x51, 0xbc, 0xff, 0x7a, 0x8b, 0xbd, 0xff, 0x20, 0x9a, 0xb4, 0xff, 0x31, 0xa6, 0xca, 0xff, 0x2c, 0xa6, 0xf2, 0xff, 0x10, 0x84, 0xea, 0xff, 0x00, 0x99, 0xc3, 0xff, 0x00, 0xb7, 0xa6, 0xff, 0x00, 0xc5, 0x9b, 0xff, 0x00, 0xc8, 0xa0, 0xff, 0x00, 0xc9, 0xa6, 0xff, 0x00, 0xca, 0xac, 0xff, 0x00, 0xcb, 0xae, 0xff, 0x00, 0xc9, 0xaa, 0xff, 0x28, 0x99, 0x8c, 0xff, 0x4d, 0x0c, 0x96, 0xff, 0x1f, 0x00, 0xbe, 0xff, 0x07, 0x3c, 0xf6, 0xff, 0x00, 0x60, 0xff, 0xff, 0x1a, 0x7f, 0xcd, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4d, 0xb3, 0x66, 0xff, 0x38, 0x82, 0xb5, 0xff, 0x00, 0x74, 0xc0, 0xff, 0x7f, 0x3a, 0x90, 0xff, 0xd1, 0x5f, 0x73, 0xff, 0x7d, 0x5f, 0xa6, 0xff, 0x00, 0x00, 0xcc, 0xff, 0x7a, 0x26, 0x65, 0xff, 0xe5, 0x47, 0x2d, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xfe, 0x45, 0x00, 0xff, 0xfe, 0x5d, 0x01, 0xff, 0xff, 0x66, 0x00, 0xff, 0xf4, 0x66, 0x00, 0xff, 0xbb, 0x5f, 0x00, 0xff, 0xd6, 0x7f, 0x00, 0xff, 0xff, 0x9b, 0x00, 0xff, 0xb5, 0x9c, 0x0d, 0xff, 0x46, 0x98, 0x1a, 0xff, 0x59, 0x9a, 0x16, 0xff, 0x58, 0x9a, 0x17, 0xff, 0x63, 0x9b, 0x00, 0xff, 0x46, 0xa3, 0xa7, 0xff, 0x00, 0xb1, 0xcd, 0xff, 0x00, 0x69, 0x5d, 0xff, 0x00, 0x1f, 0x00, 0xff, 0x00, 0x7c, 0x5b, 0xff, 0x00, 0x72, 0x44, 0xff, 0x4f, 0xa4, 0x8a, 0xff, 0x7d, 0xc9, 0xac, 0xff, 0x77, 0xc3, 0x94, 0xff, 0x6d, 0xba, 0x74, 0xff, 0x48, 0x91, 0x92, 0xff, 0x52, 0x92, 0x92, 0xff, 0x47, 0x7f, 0xa0, 0xff, 0x3f, 0x9a, 0x96, 0xff, 0x53, 0xac, 0x83, 0xff, 0x77, 0xb2, 0x92, 0xff, 0x77, 0xa3, 0x99, 0xff, 0x7f, 0xa3, 0xa7, 0xff, 0x98, 0xc0, 0xc8, 0xff, 0x8a, 0xba, 0xb0, 0xff, 0x89, 0xbb, 0xa7, 0xff, 0x7d, 0xaa, 0x92, 0xff, 0x7d, 0xa9, 0x98, 0xff, 0x9c, 0xb7, 0xb7, 0xff, 0xb0, 0xbe, 0xc6, 0xff, 0xa6, 0xb5, 0xab, 0xff, 0x9b, 0xb3, 0x8b, 0xff, 0x96, 0xb0, 0x6b, 0xff, 0x8e, 0xad, 0x5c, 0xff, 0x75, 0xa2, 0x4f, 0xff, 0x4f, 0x94, 0x43, 0xff, 0x33, 0x86, 0x3d, 0xff, 0x3a, 0x74, 0x34, 0xff, 0x42, 0x70, 0x2c, 0xff, 0x3f, 0x66, 0x2e, 0xff, 0x6d, 0x7e, 0x2e, 0xff, 0x93, 0x98, 0x2c, 0xff, 0x89, 0x8b, 0x2e, 0xff, 0x7a, 0x82, 0x30, 0xff, 0x56, 0x84, 0x51, 0xff, 0x3c, 0x8e, 0x6f, 0xff, 0x21, 0x90, 0x7e, 0xff, 0x29, 0x7c, 0x8c, 0xff, 0x70, 0x72, 0xb9, 0xff, 0x9b, 0x72, 0xc4, 0xff, 0xda, 0x7d, 0x7a, 0xff, 0xaa, 0x5e, 0x5b, 0xff, 0x26, 0x4c, 0x8a, 0xff, 0x00, 0x66, 0xb3, 0xff, 0x00, 0x73, 0xda, 0xff, 0x40, 0x58, 0xcb, 0xff, 0x10, 0x47, 0xc5, 0xff, 0x00, 0x5c, 0xbf, 0xff, 0x00, 0x87, 0xae, 0xff, 0x00, 0xb4, 0xa2, 0xff, 0x00, 0xc4, 0x9c, 0xff, 0x00, 0xc6, 0x9f, 0xff, 0x00, 0xc6, 0xa8, 0xff, 0x00, 0xca, 0xac, 0xff, 0x14, 0xac, 0x9b, 0xff, 0x35, 0x26, 0xd2, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x04, 0xd8, 0xff, 0x00, 0x2e, 0xc3, 0xff, 0x20, 0x65, 0xdd, 0xff, 0x4d, 0xcc, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x98, 0x84, 0x00, 0xff, 0x99, 0x60, 0x7c, 0xff, 0x31, 0x6a, 0x90, 0xff, 0x8c, 0x45, 0x5a, 0xff, 0xe6, 0x00, 0x5b, 0xff, 0x6f, 0x1f, 0xd2, 0xff, 0xa4, 0x87, 0xd2, 0xff, 0xf3, 0x90, 0x9d, 0xff, 0xff, 0x69, 0x58, 0xff, 0xfe, 0x3e, 0x05, 0xff, 0xfe, 0x27, 0x00, 0xff, 0xfe, 0x32, 0x00, 0xff, 0xfe, 0x52, 0x00, 0xff, 0xff, 0x61, 0x00, 0xff, 0xf2, 0x55, 0x00, 0xff, 0xf6, 0x6b, 0x00, 0xff, 0xea, 0x89, 0x05, 0xff, 0x65, 0x94, 0x1d, 0xff, 0x51, 0x93, 0x22, 0xff, 0x5e, 0x98, 0x2a, 0xff, 0x77, 0x9f, 0x38, 0xff, 0x8d, 0x9d, 0x0c, 0xff, 0x71, 0xab, 0x96, 0xff, 0x00, 0xc4, 0xea, 0xff, 0x00, 0xa4, 0x9e, 0xff, 0x01, 0x61, 0x51, 0xff, 0x00, 0x57, 0x2b, 0xff, 0x00, 0xb3, 0xab, 0xff, 0x34, 0xe8, 0xdf, 0xff, 0x64, 0xbc, 0x70, 0xff, 0x56, 0xb3, 0x62, 0xff, 0x48, 0xae, 0x63, 0xff, 0x3e, 0x94, 0x97, 0xff, 0x50, 0x89, 0xaa, 0xff, 0x50, 0x86, 0xa2, 0xff, 0x63, 0x8c, 0xa7, 0xff, 0xaa, 0xc5, 0xc8, 0xff, 0xb9, 0xd1, 0xe5, 0xff, 0xa9, 0xc5, 0xd4, 0xff, 0x8b, 0xb1, 0xac, 0xff, 0x76, 0xa6, 0x96, 0xff, 0x76, 0x9f, 0x8c, 0xff, 0x8d, 0xa7, 0x9d, 0xff, 0xa4, 0xb7, 0xba, 0xff, 0xb2, 0xbc, 0xc3, 0xff, 0xb0, 0xbe, 0xb2, 0xff, 0xa0, 0xb6, 0x88, 0xff, 0x98, 0xb3, 0x67, 0xff, 0x8e, 0xac, 0x56, 0xff, 0x69, 0x96, 0x49, 0xff, 0x3d, 0x8b, 0x42, 0xff, 0x2b, 0x85, 0x3d, 0xff, 0x44, 0x90, 0x44, 0xff, 0x5b, 0x97, 0x44, 0xff, 0x5c, 0x8f, 0x42, 0xff, 0x42, 0x6e, 0x2b, 0xff, 0x4c, 0x73, 0x32, 0xff, 0x56, 0x7f, 0x31, 0xff, 0x74, 0x9e, 0x2c, 0xff, 0x5e, 0x8e, 0x31, 0xff, 0x49, 0x83, 0x34, 0xff, 0x30, 0x7d, 0x3c, 0xff, 0x2e, 0x84, 0x49, 0xff, 0x3a, 0x97, 0x62, 0xff, 0x3d, 0xa3, 0xaf, 0xff, 0x0f, 0xbb, 0xf1, 0xff, 0x00, 0xa9, 0xd6, 0xff, 0x41, 0x69, 0x71, 0xff, 0x5c, 0x3b, 0x4c, 0xff, 0x62, 0x26, 0x50, 0xff, 0x91, 0x2f, 0x54, 0xff, 0xbc, 0x6d, 0x89, 0xff, 0x83, 0x5d, 0xae, 0xff, 0x00, 0x64, 0xc9, 0xff, 0x00, 0x5d, 0xc8, 0xff, 0x00, 0x35, 0xbd, 0xff, 0x00, 0x47, 0xb7, 0xff, 0x00, 0x85, 0xb1, 0xff, 0x00, 0xaf, 0xac, 0xff, 0x00, 0xbe, 0x9d, 0xff, 0x00, 0xc4, 0xa2, 0xff, 0x00, 0xb5, 0x9e, 0xff, 0x40, 0x41, 0xc6, 0xff, 0x2f, 0x00, 0xff, 0xff, 0x00, 0x00, 0xb3, 0xff, 0x00, 0x00, 0x93, 0xff, 0x23, 0x50, 0xcc, 0xff, 0x4c, 0xaa, 0x5e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xab, 0x8c, 0x4f, 0xff, 0xb9, 0x37, 0x36, 0xff, 0x52, 0x23, 0x24, 0xff, 0x00, 0x98, 0xb2, 0xff, 0x3b, 0x88, 0xdc, 0xff, 0x4d, 0x38, 0xc5, 0xff, 0xde, 0xcd, 0xf0, 0xff, 0xf3, 0xdf, 0xfc, 0xff, 0xf1, 0xd2, 0xee, 0xff, 0xf4, 0xbe, 0xd4, 0xff, 0xf8, 0xa3, 0xad, 0xff, 0xfb, 0x85, 0x81, 0xff, 0xfd, 0x62, 0x45, 0xff, 0xfe, 0x46, 0x00, 0xff, 0xfd, 0x39, 0x14, 0xff, 0xf5, 0x69, 0x6f, 0xff, 0xa5, 0x9a, 0x20, 0xff, 0x4f, 0x9a, 0x34, 0xff, 0x77, 0x97, 0x2d, 0xff, 0x85, 0x97, 0x28, 0xff, 0x9c, 0xa0, 0x3c, 0xff, 0xa1, 0x9f, 0x31, 0xff, 0x85, 0xa5, 0x74, 0xff, 0x0f, 0xba, 0xdc, 0xff, 0x00, 0xa7, 0xb4, 0xff, 0x02, 0x85, 0xb3, 0xff, 0x02, 0x57, 0xa1, 0xff, 0x00, 0xb5, 0xce, 0xff, 0x1e, 0xda, 0xe4, 0xff, 0x59, 0xb9, 0x76, 0xff, 0x5f, 0xb0, 0x7e, 0xff, 0x96, 0xbc, 0xa2, 0xff, 0x9b, 0xb0, 0xbe, 0xff, 0x96, 0xa9, 0xc0, 0xff, 0x7c, 0x9d, 0xd5, 0xff, 0x7a, 0x96, 0xd7, 0xff, 0xa5, 0xbf, 0xc9, 0xff, 0x81, 0xa6, 0xa0, 0xff, 0x6f, 0x99, 0x86, 0xff, 0x82, 0xa1, 0x92, 0xff, 0xa4, 0xb7, 0xb2, 0xff, 0xbb, 0xc7, 0xcb, 0xff, 0xbd, 0xc7, 0xc9, 0xff, 0xaa, 0xb7, 0xa7, 0xff, 0x96, 0xac, 0x7f, 0xff, 0x84, 0xad, 0x60, 0xff, 0x6f, 0x9f, 0x52, 0xff, 0x4f, 0x7c, 0x35, 0xff, 0x4b, 0x7f, 0x32, 0xff, 0x31, 0x6a, 0x2a, 0xff, 0x56, 0x95, 0x3a, 0xff, 0x6f, 0xa2, 0x39, 0xff, 0x7b, 0xaa, 0x50, 0xff, 0x68, 0x9d, 0x43, 0xff, 0x4b, 0x7f, 0x33, 0xff, 0x56, 0x82, 0x2f, 0xff, 0x7b, 0xa9, 0x33, 0xff, 0x82, 0xad, 0x2f, 0xff, 0x6f, 0xa0, 0x32, 0xff, 0x3b, 0x85, 0x39, 0xff, 0x48, 0x88, 0x37, 0xff, 0x48, 0x81, 0x2d, 0xff, 0x47, 0x7e, 0x2f, 0xff, 0x3a, 0x75, 0x22, 0xff, 0x21, 0x81, 0x71, 0xff, 0x00, 0xbb, 0xdf, 0xff, 0x00, 0xbe, 0xde, 0xff, 0x00, 0x89, 0x97, 0xff, 0x13, 0x71, 0x83, 0xff, 0x32, 0x44, 0x68, 0xff, 0xb3, 0x5d, 0x47, 0xff, 0xff, 0xe4, 0x00, 0xff, 0xd1, 0x9b, 0x1b, 0xff, 0x00, 0x03, 0x6b, 0xff, 0x00, 0x52, 0x9c, 0xff, 0x00, 0x67, 0xc2, 0xff, 0x00, 0x65, 0xd3, 0xff, 0x00, 0x5d, 0xe3, 0xff, 0x00, 0x6c, 0xf4, 0xff, 0x00, 0x7f, 0xcc, 0xff, 0x00, 0xa9, 0xac, 0xff, 0x00, 0xb8, 0x9f, 0xff, 0x40, 0x5b, 0xb9, 0xff, 0x6e, 0x00, 0xe8, 0xff, 0x0d, 0x0d, 0x8a, 0xff, 0x00, 0x00, 0x80, 0xff, 0x08, 0x42, 0x89, 0xff, 0x30, 0x95, 0x65, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x85, 0x7c, 0x7c, 0xff, 0xb0, 0x35, 0x5c, 0xff, 0x4d, 0xb7, 0xd4, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x4c, 0xbf, 0xeb, 0xff, 0x9a, 0x7f, 0xd1, 0xff, 0xe9, 0xda, 0xf8, 0xff, 0xef, 0xe0, 0xfb, 0xff, 0xee, 0xe1, 0xfb, 0xff, 0xee, 0xe3, 0xfc, 0xff, 0xef, 0xe4, 0xfb, 0xff, 0xf1, 0xe2, 0xf5, 0xff, 0xf6, 0xd9, 0xe6, 0xff, 0xf8, 0xc3, 0xcc, 0xff, 0xf1, 0x9e, 0xad, 0xff, 0xbc, 0x8f, 0x9c, 0xff, 0x80, 0xa0, 0x19, 0xff, 0x8a, 0x99, 0x1b, 0xff, 0x9c, 0x9a, 0x0f, 0xff, 0x8d, 0x91, 0x18, 0xff, 0x81, 0x91, 0x33, 0xff, 0x83, 0x91, 0x2c, 0xff, 0x8f, 0x93, 0x36, 0xff, 0x48, 0x8a, 0xb9, 0xff, 0x00, 0x93, 0xce, 0xff, 0x01, 0x97, 0xe7, 0xff, 0x04, 0x9a, 0xf9, 0xff, 0x1a, 0x96, 0xd4, 0xff, 0x11, 0x76, 0xc4, 0xff, 0x8e, 0xb5, 0xb3, 0xff, 0xc7, 0xd6, 0xdb, 0xff, 0xd4, 0xdf, 0xea, 0xff, 0x8f, 0xa5, 0xd1, 0xff, 0x5b, 0x7d, 0xb6, 0xff, 0x6a, 0x93, 0xa3, 0xff, 0x6a, 0x92, 0x8a, 0xff, 0x7d, 0xa1, 0x86, 0xff, 0x9b, 0xb5, 0xa8, 0xff, 0xb9, 0xc5, 0xc8, 0xff, 0xc2, 0xc9, 0xcd, 0xff, 0xb6, 0xc0, 0xbc, 0xff, 0x9b, 0xae, 0x9a, 0xff, 0x87, 0xa5, 0x79, 0xff, 0x78, 0x9d, 0x64, 0xff, 0x62, 0x9a, 0x5c, 0xff, 0x4f, 0x95, 0x4f, 0xff, 0x47, 0x8d, 0x41, 0xff, 0x49, 0x82, 0x31, 0xff, 0x5b, 0x90, 0x34, 0xff, 0x5c, 0x8a, 0x33, 0xff, 0x78, 0xa2, 0x32, 0xff, 0x77, 0xa4, 0x2f, 0xff, 0x6c, 0xa1, 0x3f, 0xff, 0x63, 0x9e, 0x33, 0xff, 0x6e, 0x9e, 0x2d, 0xff, 0x81, 0xab, 0x34, 0xff, 0x86, 0xb1, 0x34, 0xff, 0x81, 0xa9, 0x35, 0xff, 0x65, 0x96, 0x3f, 0xff, 0x51, 0x89, 0x38, 0xff, 0x61, 0x86, 0x26, 0xff, 0x5a, 0x78, 0x0e, 0xff, 0x56, 0x70, 0x00, 0xff, 0x5c, 0x71, 0x00, 0xff, 0x6d, 0x78, 0x00, 0xff, 0x84, 0x89, 0x30, 0xff, 0x59, 0x7f, 0x5a, 0xff, 0x00, 0x79, 0x78, 0xff, 0x00, 0x8d, 0x9e, 0xff, 0x00, 0x77, 0x88, 0xff, 0x43, 0x64, 0x78, 0xff, 0xc2, 0xa0, 0x74, 0xff, 0x9f, 0x6e, 0x68, 0xff, 0x00, 0x01, 0x29, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x20, 0x4b, 0xff, 0x00, 0x4b, 0x95, 0xff, 0x00, 0x72, 0xcf, 0xff, 0x00, 0x86, 0xf6, 0xff, 0x00, 0x86, 0xff, 0xff, 0x00, 0x82, 0xed, 0xff, 0x00, 0x80, 0xbf, 0xff, 0x14, 0x59, 0xba, 0xff, 0x45, 0x13, 0xa6, 0xff, 0x15, 0x1d, 0x28, 0xff, 0x17, 0x23, 0x47, 0xff, 0x23, 0x4e, 0x5f, 0xff, 0x34, 0x92, 0x62, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x7c, 0xc1, 0x74, 0xff, 0x69, 0x82, 0xd3, 0xff, 0x30, 0x22, 0xdb, 0xff, 0x00, 0x6d, 0xf4, 0xff, 0x21, 0xa0, 0xf7, 0xff, 0x5e, 0x80, 0xd1, 0xff, 0xb3, 0xa2, 0xd1, 0xff, 0xf1, 0xe1, 0xfe, 0xff, 0xed, 0xdf, 0xfb, 0xff, 0xee, 0xe1, 0xfa, 0xff, 0xef, 0xe1, 0xfa, 0xff, 0xf1, 0xe4, 0xfb, 0xff, 0xf3, 0xe8, 0xfd, 0xff, 0xed, 0xe8, 0xf7, 0xff, 0xd2, 0xdb, 0xe0, 0xff, 0x9c, 0xba, 0xac, 0xff, 0x5d, 0x90, 0x4d, 0xff, 0x7c, 0x98, 0x34, 0xff, 0x87, 0x9e, 0x39, 0xff, 0x84, 0x9f, 0x2e, 0xff, 0x6d, 0x8a, 0x21, 0xff, 0x95, 0x8d, 0x1d, 0xff, 0xcb, 0xa3, 0x4b, 0xff, 0xee, 0xc2, 0x86, 0xff, 0x92, 0x8a, 0xd6, 0xff, 0x00, 0x83, 0xed, 0xff, 0x00, 0x99, 0xe0, 0xff, 0x05, 0x7c, 0xbd, 0xff, 0x51, 0x73, 0xc9, 0xff, 0x4b, 0x3e, 0xda, 0xff, 0x94, 0xa7, 0xdc, 0xff, 0xb1, 0xcb, 0xc8, 0xff, 0x7a, 0xa2, 0x95, 0xff, 0x5b, 0x8a, 0x7b, 0xff, 0x79, 0x9a, 0x88, 0xff, 0x9b, 0xb4, 0xa7, 0xff, 0xb8, 0xca, 0xc8, 0xff, 0xc8, 0xd5, 0xd6, 0xff, 0xbf, 0xcb, 0xc8, 0xff, 0xa5, 0xb5, 0xa8, 0xff, 0x89, 0xa4, 0x85, 0xff, 0x75, 0x9b, 0x6d, 0xff, 0x65, 0x92, 0x5e, 0xff, 0x4c, 0x7e, 0x49, 0xff, 0x46, 0x8d, 0x4d, 0xff, 0x49, 0x95, 0x4f, 0xff, 0x62, 0xa5, 0x50, 0xff, 0x73, 0xb0, 0x54, 0xff, 0x5d, 0x91, 0x40, 0xff, 0x67, 0x9c, 0x39, 0xff, 0x64, 0x97, 0x33, 0xff, 0x5d, 0x92, 0x28, 0xff, 0x6c, 0xa1, 0x28, 0xff, 0x7b, 0xaa, 0x2f, 0xff, 0x80, 0xad, 0x2e, 0xff, 0x7e, 0xa7, 0x28, 0xff, 0x7d, 0xa3, 0x2f, 0xff, 0x80, 0xa5, 0x3f, 0xff, 0x88, 0xab, 0x4b, 0xff, 0x78, 0x9d, 0x3d, 0xff, 0x86, 0x89, 0x0a, 0xff, 0x8e, 0x84, 0x00, 0xff, 0x97, 0x88, 0x00, 0xff, 0x9e, 0x8c, 0x00, 0xff, 0xa5, 0x8f, 0x00, 0xff, 0xad, 0x91, 0x00, 0xff, 0xa2, 0x86, 0x00, 0xff, 0x69, 0x72, 0x40, 0xff, 0x47, 0x57, 0x27, 0xff, 0x00, 0x45, 0x33, 0xff, 0x05, 0x60, 0x58, 0xff, 0x00, 0x66, 0x65, 0xff, 0x00, 0x60, 0x79, 0xff, 0x00, 0x60, 0x7d, 0xff, 0x01, 0x5e, 0x70, 0xff, 0x00, 0x57, 0x69, 0xff, 0x00, 0x4d, 0x63, 0xff, 0x01, 0x3e, 0x54, 0xff, 0x00, 0x2b, 0x43, 0xff, 0x00, 0x40, 0x7d, 0xff, 0x00, 0x77, 0xcd, 0xff, 0x00, 0x97, 0xf4, 0xff, 0x00, 0x96, 0xf6, 0xff, 0x00, 0x98, 0xdb, 0xff, 0x00, 0x72, 0x93, 0xff, 0x3a, 0x47, 0x00, 0xff, 0x5c, 0x50, 0x00, 0xff, 0x45, 0x59, 0x00, 0xff, 0x34, 0x81, 0x38, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xac, 0x91, 0x8a, 0xff, 0xdf, 0x7f, 0xe7, 0xff, 0x8a, 0x58, 0xff, 0xff, 0x00, 0x22, 0xfb, 0xff, 0x33, 0x00, 0xd3, 0xff, 0x4c, 0x00, 0xb2, 0xff, 0xbd, 0xb9, 0xd7, 0xff, 0xf4, 0xe5, 0xff, 0xff, 0xee, 0xdf, 0xfc, 0xff, 0xf0, 0xe2, 0xfd, 0xff, 0xf0, 0xe3, 0xfe, 0xff, 0xe0, 0xdd, 0xf3, 0xff, 0xb9, 0xc9, 0xce, 0xff, 0x7c, 0xab, 0x96, 0xff, 0x4c, 0x9c, 0x71, 0xff, 0x51, 0x88, 0x41, 0xff, 0x50, 0x80, 0x23, 0xff, 0x51, 0x8a, 0x3d, 0xff, 0x67, 0x9c, 0x3d, 0xff, 0x90, 0xaf, 0x56, 0xff, 0xcb, 0xb1, 0x6e, 0xff, 0xf6, 0xcb, 0x91, 0xff, 0xf9, 0xe3, 0xcc, 0xff, 0xff, 0xf9, 0xeb, 0xff, 0xc1, 0xd7, 0xf5, 0xff, 0x00, 0x8a, 0xec, 0xff, 0x00, 0x6c, 0xa1, 0xff, 0x00, 0x1d, 0x5b, 0xff, 0x1d, 0x30, 0x96, 0xff, 0x3e, 0x3e, 0xb7, 0xff, 0x50, 0x72, 0xc5, 0xff, 0x69, 0x95, 0x7a, 0xff, 0x8d, 0xa6, 0x95, 0xff, 0xb9, 0xc8, 0xc3, 0xff, 0xcf, 0xdb, 0xdd, 0xff, 0xce, 0xd9, 0xdd, 0xff, 0xbb, 0xc9, 0xc5, 0xff, 0x99, 0xb1, 0x9b, 0xff, 0x78, 0xa0, 0x78, 0xff, 0x65, 0x9b, 0x71, 0xff, 0x57, 0x90, 0x66, 0xff, 0x46, 0x77, 0x46, 0xff, 0x45, 0x76, 0x41, 0xff, 0x4e, 0x6f, 0x36, 0xff, 0x5d, 0x94, 0x4b, 0xff, 0x74, 0xae, 0x57, 0xff, 0x7a, 0xb4, 0x5b, 0xff, 0x6b, 0xab, 0x54, 0xff, 0x45, 0x77, 0x2a, 0xff, 0x5e, 0x8e, 0x25, 0xff, 0x7a, 0xac, 0x2d, 0xff, 0x7c, 0xac, 0x26, 0xff, 0x79, 0xaa, 0x23, 0xff, 0x73, 0xa4, 0x2b, 0xff, 0x75, 0xa1, 0x2e, 0xff, 0x7d, 0xa1, 0x2c, 0xff, 0x89, 0xa7, 0x35, 0xff, 0x92, 0xab, 0x36, 0xff, 0x91, 0xad, 0x3a, 0xff, 0x81, 0x9d, 0x2b, 0xff, 0xb6, 0x97, 0x00, 0xff, 0xb7, 0x96, 0x00, 0xff, 0xb1, 0x94, 0x00, 0xff, 0xae, 0x93, 0x00, 0xff, 0xad, 0x92, 0x00, 0xff, 0xaf, 0x92, 0x00, 0xff, 0x81, 0x78, 0x35, 0xff, 0x89, 0x95, 0x75, 0xff, 0x65, 0x66, 0x36, 0xff, 0x00, 0x1a, 0x00, 0xff, 0x1b, 0x28, 0x00, 0xff, 0x19, 0x36, 0x17, 0xff, 0x5c, 0x4f, 0x36, 0xff, 0x3e, 0x5d, 0x52, 0xff, 0x00, 0x61, 0x66, 0xff, 0x00, 0x64, 0x6c, 0xff, 0x00, 0x66, 0x70, 0xff, 0x00, 0x64, 0x70, 0xff, 0x00, 0x62, 0x6e, 0xff, 0x00, 0x5b, 0x67, 0xff, 0x00, 0x48, 0x5e, 0xff, 0x01, 0x7c, 0x8f, 0xff, 0x01, 0xa4, 0xd6, 0xff, 0x00, 0xb1, 0xe7, 0xff, 0x00, 0xc3, 0xf2, 0xff, 0x0d, 0xab, 0xc9, 0xff, 0x2e, 0x6f, 0x53, 0xff, 0x1b, 0x4e, 0x5e, 0xff, 0x1e, 0x6a, 0x67, 0xff, 0xaa, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x8f, 0xad, 0xff, 0xf6, 0x40, 0xdb, 0xff, 0xe4, 0x4c, 0xf2, 0xff, 0x77, 0x34, 0xe8, 0xff, 0x3d, 0x00, 0xb1, 0xff, 0x41, 0x48, 0xa8, 0xff, 0xda, 0xd4, 0xee, 0xff, 0xf3, 0xe6, 0xff, 0xff, 0xeb, 0xe2, 0xfe, 0xff, 0xd5, 0xd6, 0xed, 0xff, 0xa5, 0xbc, 0xc3, 0xff, 0x5b, 0xad, 0x93, 0xff, 0x00, 0x9b, 0x6b, 0xff, 0x22, 0x90, 0x66, 0xff, 0x52, 0x92, 0x60, 0xff, 0x68, 0x89, 0x2d, 0xff, 0x6c, 0x8f, 0x2d, 0xff, 0x78, 0x98, 0x53, 0xff, 0xb7, 0xb6, 0x86, 0xff, 0xea, 0xce, 0xa4, 0xff, 0xeb, 0xd6, 0xc3, 0xff, 0xf9, 0xf8, 0xed, 0xff, 0xf8, 0xfd, 0xf6, 0xff, 0xe2, 0xf4, 0xf0, 0xff, 0xb5, 0xcb, 0xe7, 0xff, 0x3d, 0x64, 0xed, 0xff, 0x00, 0x64, 0xe1, 0xff, 0x00, 0x44, 0xac, 0xff, 0x00, 0x29, 0x89, 0xff, 0x00, 0x00, 0x65, 0xff, 0x45, 0x58, 0x8a, 0xff, 0xc9, 0xda, 0xd9, 0xff, 0xdd, 0xe7, 0xe7, 0xff, 0xcf, 0xd8, 0xd8, 0xff, 0xb0, 0xbe, 0xb3, 0xff, 0x91, 0xaa, 0x8e, 0xff, 0x79, 0xa1, 0x77, 0xff, 0x68, 0x9b, 0x6f, 0xff, 0x5e, 0x9a, 0x6b, 0xff, 0x57, 0x99, 0x6b, 0xff, 0x56, 0x8d, 0x55, 0xff, 0x59, 0x84, 0x44, 0xff, 0x4a, 0x78, 0x3f, 0xff, 0x5d, 0x82, 0x44, 0xff, 0x5e, 0x8f, 0x47, 0xff, 0x6d, 0xa9, 0x51, 0xff, 0x6b, 0xa7, 0x4b, 0xff, 0x6c, 0xa9, 0x3d, 0xff, 0x79, 0xae, 0x32, 0xff, 0x7d, 0xb2, 0x2e, 0xff, 0x75, 0xab, 0x2a, 0xff, 0x6c, 0xa2, 0x25, 0xff, 0x69, 0x9b, 0x22, 0xff, 0x75, 0x9e, 0x28, 0xff, 0x82, 0xa2, 0x2a, 0xff, 0x88, 0xa1, 0x1c, 0xff, 0x8b, 0xa1, 0x13, 0xff, 0x90, 0xa6, 0x18, 0xff, 0x8c, 0xab, 0x36, 0xff, 0x7e, 0x9a, 0x2a, 0xff, 0xb7, 0x96, 0x00, 0xff, 0xb8, 0x97, 0x00, 0xff, 0xb2, 0x96, 0x00, 0xff, 0xb1, 0x95, 0x00, 0xff, 0xb1, 0x95, 0x00, 0xff, 0xa6, 0x8b, 0x00, 0xff, 0x70, 0x80, 0x68, 0xff, 0xbb, 0xba, 0x88, 0xff, 0x76, 0x73, 0x3f, 0xff, 0x00, 0x13, 0x00, 0xff, 0x1f, 0x25, 0x00, 0xff, 0x51, 0x22, 0x00, 0xff, 0xde, 0x33, 0x00, 0xff, 0xa3, 0x2b, 0x00, 0xff, 0x00, 0x3c, 0x27, 0xff, 0x04, 0x4f, 0x40, 0xff, 0x00, 0x52, 0x49, 0xff, 0x00, 0x4b, 0x4d, 0xff, 0x00, 0x44, 0x55, 0xff, 0x01, 0x58, 0x59, 0xff, 0x03, 0x73, 0x4f, 0xff, 0x00, 0x5a, 0x40, 0xff, 0x00, 0x39, 0x3a, 0xff, 0x00, 0x18, 0x39, 0xff, 0x00, 0x66, 0x84, 0xff, 0x00, 0x8b, 0xb4, 0xff, 0x00, 0x68, 0x7d, 0xff, 0x00, 0x85, 0xb7, 0xff, 0x22, 0x6d, 0x84, 0xff, 0x52, 0xa3, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xcf, 0x7c, 0xc9, 0xff, 0xe8, 0x4b, 0xe5, 0xff, 0xd0, 0x55, 0xc2, 0xff, 0xa9, 0x00, 0x85, 0xff, 0xc3, 0x43, 0x96, 0xff, 0x74, 0x84, 0xb2, 0xff, 0xe3, 0xe0, 0xf8, 0xff, 0xcd, 0xd0, 0xe3, 0xff, 0x94, 0xaf, 0xb3, 0xff, 0x4a, 0x96, 0x7d, 0xff, 0x00, 0x88, 0x52, 0xff, 0x08, 0x98, 0x5f, 0xff, 0x2b, 0xac, 0x7e, 0xff, 0x5b, 0x9f, 0x78, 0xff, 0x79, 0x8f, 0x49, 0xff, 0x78, 0x90, 0x4a, 0xff, 0x96, 0xa5, 0x7c, 0xff, 0xbc, 0xbd, 0xa9, 0xff, 0xcf, 0xc3, 0xbd, 0xff, 0xa2, 0xb1, 0xbc, 0xff, 0x84, 0xcb, 0xdf, 0xff, 0xc2, 0xe4, 0xe9, 0xff, 0xda, 0xea, 0xeb, 0xff, 0xe1, 0xee, 0xed, 0xff, 0xe2, 0xe1, 0xe8, 0xff, 0x54, 0x49, 0xd0, 0xff, 0x38, 0x52, 0xe0, 0xff, 0x3e, 0x4d, 0xb5, 0xff, 0x00, 0x20, 0x86, 0xff, 0x00, 0x16, 0x6e, 0xff, 0x21, 0x48, 0x91, 0xff, 0xb4, 0xc7, 0xd3, 0xff, 0xb5, 0xc0, 0xae, 0xff, 0x92, 0xa9, 0x8c, 0xff, 0x7b, 0xa2, 0x7b, 0xff, 0x69, 0x96, 0x77, 0xff, 0x5a, 0x8d, 0x73, 0xff, 0x35, 0x6e, 0x87, 0xff, 0x51, 0x8d, 0x6e, 0xff, 0x6b, 0xa2, 0x5e, 0xff, 0x77, 0xa5, 0x5e, 0xff, 0x5f, 0x8c, 0x4b, 0xff, 0x5b, 0x8b, 0x47, 0xff, 0x4c, 0x75, 0x36, 0xff, 0x57, 0x8f, 0x3b, 0xff, 0x66, 0xa9, 0x40, 0xff, 0x75, 0xb0, 0x41, 0xff, 0x7a, 0xb3, 0x3b, 0xff, 0x71, 0xab, 0x35, 0xff, 0x66, 0xa3, 0x30, 0xff, 0x68, 0x9f, 0x2d, 0xff, 0x76, 0xa1, 0x25, 0xff, 0x80, 0xa1, 0x1a, 0xff, 0x7e, 0x9c, 0x0b, 0xff, 0x81, 0x9a, 0x01, 0xff, 0x84, 0x9d, 0x05, 0xff, 0x86, 0x9e, 0x09, 0xff, 0x8e, 0xa3, 0x0d, 0xff, 0x87, 0xa5, 0x25, 0xff, 0x72, 0x8e, 0x1b, 0xff, 0xba, 0x96, 0x00, 0xff, 0xbb, 0x98, 0x00, 0xff, 0xb7, 0x97, 0x00, 0xff, 0xb5, 0x97, 0x00, 0xff, 0xb6, 0x97, 0x00, 0xff, 0x8a, 0x7e, 0x36, 0xff, 0x96, 0xa5, 0x87, 0xff, 0xd4, 0xcf, 0x90, 0xff, 0x81, 0x7d, 0x4a, 0xff, 0x03, 0x07, 0x00, 0xff, 0x13, 0x23, 0x00, 0xff, 0x95, 0x25, 0x00, 0xff, 0xff, 0x48, 0x00, 0xff, 0xbb, 0x28, 0x00, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x18, 0x00, 0xff, 0x00, 0x3d, 0x22, 0xff, 0x1e, 0x52, 0x3f, 0xff, 0x33, 0x59, 0x45, 0xff, 0x10, 0x71, 0x14, 0xff, 0x05, 0x83, 0x0a, 0xff, 0x00, 0x74, 0x42, 0xff, 0x00, 0x62, 0x3b, 0xff, 0x00, 0x4d, 0x2b, 0xff, 0x05, 0x4c, 0x00, 0xff, 0x18, 0x5d, 0x00, 0xff, 0x00, 0x00, 0x45, 0xff, 0x01, 0x10, 0x77, 0xff, 0x19, 0x56, 0x89, 0xff, 0x40, 0xa6, 0x66, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x6a, 0xd5, 0x55, 0xff, 0xa9, 0x65, 0xc1, 0xff, 0x80, 0x00, 0xd2, 0xff, 0x16, 0x0f, 0xc1, 0xff, 0x2d, 0x1d, 0xc7, 0xff, 0x90, 0x6c, 0xb5, 0xff, 0x68, 0x94, 0xa1, 0xff, 0x81, 0x9d, 0xa3, 0xff, 0x41, 0x7c, 0x7f, 0xff, 0x21, 0x75, 0x6c, 0xff, 0x2f, 0x89, 0x68, 0xff, 0x22, 0xa0, 0x78, 0xff, 0x00, 0x91, 0x5b, 0xff, 0x12, 0x98, 0x69, 0xff, 0x92, 0x9d, 0x79, 0xff, 0xc2, 0xb9, 0xa7, 0xff, 0x8e, 0xa8, 0x9b, 0xff, 0x84, 0x98, 0x87, 0xff, 0x79, 0x96, 0x92, 0xff, 0x85, 0xb0, 0xc7, 0xff, 0x98, 0xba, 0xd0, 0xff, 0xbd, 0xc8, 0xc7, 0xff, 0xe0, 0xe5, 0xdf, 0xff, 0xeb, 0xf1, 0xf3, 0xff, 0xea, 0xf0, 0xf5, 0xff, 0xeb, 0xe6, 0xf2, 0xff, 0x88, 0x84, 0xb4, 0xff, 0x5b, 0x6e, 0x7c, 0xff, 0x63, 0x5e, 0xa6, 0xff, 0x38, 0x0c, 0xa1, 0xff, 0x20, 0x12, 0x91, 0xff, 0x00, 0x64, 0xd9, 0xff, 0x62, 0x9e, 0xca, 0xff, 0x83, 0xa8, 0x7c, 0xff, 0x67, 0x9c, 0x6d, 0xff, 0x48, 0x88, 0x6a, 0xff, 0x2c, 0x69, 0x82, 0xff, 0x39, 0x71, 0x87, 0xff, 0x50, 0x83, 0x79, 0xff, 0x50, 0x84, 0x7a, 0xff, 0x6d, 0xa3, 0x5d, 0xff, 0x5c, 0x98, 0x54, 0xff, 0x40, 0x71, 0x35, 0xff, 0x56, 0x89, 0x38, 0xff, 0x6a, 0xa5, 0x44, 0xff, 0x6d, 0xad, 0x41, 0xff, 0x63, 0xa9, 0x3b, 0xff, 0x60, 0xa5, 0x42, 0xff, 0x5e, 0xa3, 0x44, 0xff, 0x67, 0xa3, 0x3b, 0xff, 0x76, 0xa5, 0x32, 0xff, 0x81, 0xa5, 0x21, 0xff, 0x83, 0xa3, 0x08, 0xff, 0x80, 0x9e, 0x00, 0xff, 0x7c, 0x99, 0x00, 0xff, 0x80, 0x9d, 0x05, 0xff, 0x87, 0xa1, 0x0c, 0xff, 0x88, 0xa0, 0x0a, 0xff, 0x8e, 0xa3, 0x09, 0xff, 0x71, 0x98, 0x16, 0xff, 0x6b, 0x84, 0x0b, 0xff, 0xc7, 0x97, 0x00, 0xff, 0xc3, 0x98, 0x00, 0xff, 0xbc, 0x97, 0x00, 0xff, 0xba, 0x98, 0x00, 0xff, 0xb0, 0x92, 0x00, 0xff, 0x76, 0x85, 0x69, 0xff, 0xc4, 0xc8, 0x9a, 0xff, 0xda, 0xd4, 0x9a, 0xff, 0x86, 0x83, 0x52, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x21, 0x00, 0xff, 0xbf, 0x2e, 0x00, 0xff, 0xff, 0x5f, 0x00, 0xff, 0xc6, 0x36, 0x00, 0xff, 0x00, 0x0a, 0x00, 0xff, 0x40, 0x3c, 0x00, 0xff, 0x58, 0x57, 0x00, 0xff, 0x61, 0x5d, 0x00, 0xff, 0x55, 0x75, 0x00, 0xff, 0x03, 0x93, 0x1d, 0xff, 0x00, 0x5d, 0x15, 0xff, 0x00, 0x36, 0x16, 0xff, 0x00, 0x4d, 0x26, 0xff, 0x13, 0x5a, 0x32, 0xff, 0x23, 0x7e, 0x5a, 0xff, 0x48, 0xa0, 0x88, 0xff, 0x00, 0x56, 0xc2, 0xff, 0x00, 0x45, 0xc0, 0xff, 0x16, 0x70, 0x92, 0xff, 0x38, 0xbf, 0x50, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x40, 0xa8, 0x8b, 0xff, 0x34, 0x5c, 0xe8, 0xff, 0x00, 0x26, 0xec, 0xff, 0x00, 0x00, 0xc1, 0xff, 0x00, 0x37, 0xd9, 0xff, 0x41, 0x64, 0xb6, 0xff, 0x40, 0x96, 0x96, 0xff, 0x00, 0x63, 0x76, 0xff, 0x08, 0x4b, 0x8b, 0xff, 0x1e, 0x62, 0xa7, 0xff, 0x32, 0x8b, 0x9d, 0xff, 0x49, 0xbb, 0xb4, 0xff, 0x5b, 0xb4, 0x9b, 0xff, 0x6c, 0x9e, 0xaa, 0xff, 0x78, 0x8f, 0xac, 0xff, 0x84, 0x95, 0x97, 0xff, 0x72, 0x99, 0x99, 0xff, 0x8c, 0xac, 0xb6, 0xff, 0x9b, 0xb7, 0xc7, 0xff, 0x98, 0xb1, 0xb5, 0xff, 0xa5, 0xb8, 0xb9, 0xff, 0x9f, 0xa5, 0xa0, 0xff, 0xa8, 0xab, 0xac, 0xff, 0xe3, 0xde, 0xe3, 0xff, 0xfb, 0xd5, 0xd3, 0xff, 0xf5, 0xa6, 0x9f, 0xff, 0xaa, 0xa9, 0x9e, 0xff, 0x83, 0x83, 0x60, 0xff, 0x87, 0x4d, 0xb3, 0xff, 0x4c, 0x0a, 0xa7, 0xff, 0x57, 0x14, 0xa4, 0xff, 0x10, 0x5f, 0xd5, 0xff, 0x32, 0x95, 0xd1, 0xff, 0x49, 0x8c, 0x58, 0xff, 0x4a, 0x8a, 0x52, 0xff, 0x55, 0x91, 0x5e, 0xff, 0x4e, 0x88, 0x6c, 0xff, 0x43, 0x7e, 0x79, 0xff, 0x42, 0x78, 0x7e, 0xff, 0x3c, 0x77, 0x7d, 0xff, 0x50, 0x93, 0x4e, 0xff, 0x55, 0x98, 0x47, 0xff, 0x5e, 0x9d, 0x43, 0xff, 0x5f, 0xa2, 0x43, 0xff, 0x56, 0x9f, 0x41, 0xff, 0x4f, 0x9d, 0x40, 0xff, 0x4e, 0x9d, 0x42, 0xff, 0x5d, 0xa2, 0x45, 0xff, 0x74, 0xaa, 0x3c, 0xff, 0x7f, 0xaa, 0x24, 0xff, 0x82, 0xa8, 0x12, 0xff, 0x83, 0xa3, 0x07, 0xff, 0x82, 0xa2, 0x04, 0xff, 0x83, 0xa1, 0x01, 0xff, 0x80, 0x9b, 0x00, 0xff, 0x83, 0xa0, 0x08, 0xff, 0x8a, 0xa6, 0x0e, 0xff, 0x8d, 0xa7, 0x0e, 0xff, 0x88, 0xa4, 0x0f, 0xff, 0x4e, 0x8c, 0x16, 0xff, 0x74, 0x84, 0x07, 0xff, 0xd3, 0x99, 0x00, 0xff, 0xcc, 0x98, 0x00, 0xff, 0xc2, 0x97, 0x00, 0xff, 0xc1, 0x97, 0x00, 0xff, 0x98, 0x84, 0x2f, 0xff, 0x94, 0xa7, 0x8f, 0xff, 0xd9, 0xd8, 0xa2, 0xff, 0xdb, 0xd7, 0xa0, 0xff, 0x89, 0x87, 0x59, 0xff, 0x00, 0x00, 0x00, 0xff, 0x24, 0x1c, 0x00, 0xff, 0xc8, 0x31, 0x00, 0xff, 0xfd, 0x5f, 0x02, 0xff, 0xc8, 0x4c, 0x01, 0xff, 0x7b, 0x62, 0x00, 0xff, 0x90, 0x7b, 0x00, 0xff, 0x7e, 0x6f, 0x00, 0xff, 0x68, 0x5c, 0x00, 0xff, 0x3b, 0x8c, 0x18, 0xff, 0x00, 0x97, 0x28, 0xff, 0x00, 0x65, 0x23, 0xff, 0x00, 0x23, 0x00, 0xff, 0x08, 0x29, 0x25, 0xff, 0x37, 0x45, 0x5b, 0xff, 0x1b, 0x53, 0x97, 0xff, 0x07, 0x46, 0x80, 0xff, 0x00, 0x5c, 0x97, 0xff, 0x10, 0x8d, 0xb3, 0xff, 0x29, 0xb1, 0x88, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2f, 0x88, 0x82, 0xff, 0x00, 0x4b, 0xd7, 0xff, 0x00, 0x1a, 0xf4, 0xff, 0x92, 0x42, 0xda, 0xff, 0xb2, 0x6d, 0xdf, 0xff, 0x56, 0x66, 0xcf, 0xff, 0x5a, 0x9b, 0xd7, 0xff, 0x00, 0x66, 0xbb, 0xff, 0x00, 0x66, 0x9b, 0xff, 0x00, 0x4c, 0x66, 0xff, 0x50, 0x57, 0x9a, 0xff, 0x70, 0x89, 0xd1, 0xff, 0x9c, 0xbd, 0xb4, 0xff, 0x88, 0xab, 0x9d, 0xff, 0x7a, 0x99, 0xad, 0xff, 0x9d, 0xb8, 0xc5, 0xff, 0xa4, 0xbc, 0xc9, 0xff, 0x8f, 0xa8, 0xac, 0xff, 0x81, 0xa1, 0x9e, 0xff, 0x74, 0x81, 0x7b, 0xff, 0xa0, 0x80, 0x72, 0xff, 0xcc, 0x8a, 0x6d, 0xff, 0xd1, 0x8d, 0x67, 0xff, 0xce, 0x8a, 0x5c, 0xff, 0xd0, 0x77, 0x2c, 0xff, 0xa9, 0x69, 0x00, 0xff, 0xaa, 0xa1, 0x8d, 0xff, 0xef, 0x9d, 0x71, 0xff, 0xc9, 0x47, 0xaa, 0xff, 0x61, 0x0f, 0xad, 0xff, 0x5e, 0x16, 0x9f, 0xff, 0x47, 0x26, 0x9d, 0xff, 0xb2, 0x7e, 0xb4, 0xff, 0x67, 0x97, 0x62, 0xff, 0x60, 0x9c, 0x60, 0xff, 0x61, 0x9b, 0x59, 0xff, 0x3e, 0x75, 0x77, 0xff, 0x40, 0x77, 0x75, 0xff, 0x43, 0x7b, 0x78, 0xff, 0x4e, 0x8c, 0x6d, 0xff, 0x5b, 0x9f, 0x48, 0xff, 0x54, 0x9a, 0x46, 0xff, 0x4a, 0x96, 0x43, 0xff, 0x3f, 0x8f, 0x40, 0xff, 0x40, 0x8e, 0x40, 0xff, 0x49, 0x93, 0x45, 0xff, 0x4e, 0x96, 0x45, 0xff, 0x49, 0x90, 0x3a, 0xff, 0x57, 0x97, 0x28, 0xff, 0x6d, 0xa1, 0x1c, 0xff, 0x7c, 0xa6, 0x13, 0xff, 0x85, 0xa6, 0x08, 0xff, 0x86, 0xa5, 0x02, 0xff, 0x88, 0xa6, 0x02, 0xff, 0x81, 0x9d, 0x00, 0xff, 0x86, 0xa2, 0x0a, 0xff, 0x8c, 0xa7, 0x10, 0xff, 0x91, 0xaa, 0x0f, 0xff, 0x7b, 0x9f, 0x11, 0xff, 0x37, 0x87, 0x14, 0xff, 0x83, 0x88, 0x05, 0xff, 0xe0, 0x9c, 0x00, 0xff, 0xd6, 0x99, 0x00, 0xff, 0xcd, 0x97, 0x00, 0xff, 0xc1, 0x91, 0x00, 0xff, 0x79, 0x84, 0x6e, 0xff, 0xbe, 0xc7, 0xa4, 0xff, 0xdf, 0xdc, 0xa7, 0xff, 0xdf, 0xdb, 0xa6, 0xff, 0x90, 0x8b, 0x60, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2c, 0x37, 0x08, 0xff, 0x8d, 0x32, 0x10, 0xff, 0x89, 0x20, 0x14, 0xff, 0xbc, 0x22, 0x04, 0xff, 0x95, 0x49, 0x01, 0xff, 0x75, 0x60, 0x02, 0xff, 0x7c, 0x66, 0x00, 0xff, 0x65, 0x71, 0x00, 0xff, 0x15, 0xac, 0x18, 0xff, 0x00, 0x94, 0x20, 0xff, 0x59, 0x64, 0x00, 0xff, 0x40, 0x41, 0x40, 0xff, 0x00, 0x52, 0x72, 0xff, 0x09, 0x5e, 0xaf, 0xff, 0x00, 0x7f, 0xc7, 0xff, 0x02, 0x6f, 0x70, 0xff, 0x16, 0x82, 0x36, 0xff, 0x29, 0xad, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x90, 0xb5, 0xff, 0x00, 0x40, 0xcd, 0xff, 0x98, 0x76, 0xea, 0xff, 0xf1, 0x81, 0xe0, 0xff, 0xce, 0x72, 0xed, 0xff, 0x00, 0x34, 0xe8, 0xff, 0x00, 0x25, 0xce, 0xff, 0x00, 0x42, 0xcc, 0xff, 0x38, 0x9a, 0xe7, 0xff, 0x4d, 0x72, 0xbb, 0xff, 0x5b, 0x6f, 0xb4, 0xff, 0x65, 0x88, 0xb7, 0xff, 0x93, 0xae, 0xb6, 0xff, 0xa8, 0xbe, 0xc9, 0xff, 0x9a, 0xb1, 0xbe, 0xff, 0x71, 0x93, 0x9e, 0xff, 0x6a, 0x8a, 0x97, 0xff, 0x74, 0x73, 0x68, 0xff, 0x9d, 0x82, 0x73, 0xff, 0xbc, 0x85, 0x65, 0xff, 0xbc, 0x7d, 0x34, 0xff, 0xa0, 0x79, 0x1c, 0xff, 0x89, 0x7d, 0x27, 0xff, 0x88, 0x81, 0x24, 0xff, 0x83, 0x86, 0x30, 0xff, 0x69, 0x74, 0x0f, 0xff, 0xa4, 0x9c, 0x78, 0xff, 0xfa, 0xd4, 0x7f, 0xff, 0xcb, 0x8a, 0xb4, 0xff, 0x6c, 0x0b, 0xb8, 0xff, 0x4d, 0x00, 0x99, 0xff, 0xb8, 0x7a, 0xd3, 0xff, 0xe6, 0xa6, 0xea, 0xff, 0x77, 0x98, 0x6c, 0xff, 0x4e, 0x93, 0x54, 0xff, 0x51, 0x91, 0x54, 0xff, 0x3f, 0x79, 0x70, 0xff, 0x49, 0x86, 0x61, 0xff, 0x55, 0x9a, 0x42, 0xff, 0x4d, 0x95, 0x43, 0xff, 0x46, 0x91, 0x45, 0xff, 0x40, 0x8d, 0x43, 0xff, 0x45, 0x8f, 0x46, 0xff, 0x4c, 0x8f, 0x47, 0xff, 0x4f, 0x92, 0x48, 0xff, 0x43, 0x8d, 0x40, 0xff, 0x39, 0x87, 0x38, 0xff, 0x34, 0x86, 0x33, 0xff, 0x37, 0x8a, 0x33, 0xff, 0x39, 0x8d, 0x31, 0xff, 0x45, 0x91, 0x2e, 0xff, 0x5d, 0x97, 0x27, 0xff, 0x78, 0x9f, 0x17, 0xff, 0x89, 0xa6, 0x04, 0xff, 0x89, 0xa1, 0x00, 0xff, 0x8c, 0xa5, 0x07, 0xff, 0x8d, 0xa8, 0x0c, 0xff, 0x8d, 0xa7, 0x0d, 0xff, 0x5c, 0x92, 0x12, 0xff, 0x33, 0x85, 0x11, 0xff, 0x8d, 0x8c, 0x04, 0xff, 0xe9, 0x9f, 0x00, 0xff, 0xdd, 0x99, 0x00, 0xff, 0xd7, 0x98, 0x00, 0xff, 0xaa, 0x87, 0x3c, 0xff, 0x87, 0xa2, 0x9c, 0xff, 0xd7, 0xda, 0xad, 0xff, 0xde, 0xdf, 0xad, 0xff, 0xd2, 0xdc, 0xa1, 0xff, 0x7e, 0xb5, 0x57, 0xff, 0x00, 0x84, 0x00, 0xff, 0x08, 0x55, 0x09, 0xff, 0x2c, 0x18, 0x18, 0xff, 0x3a, 0x00, 0x0d, 0xff, 0xc4, 0x00, 0x01, 0xff, 0x83, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x24, 0x12, 0x00, 0xff, 0x37, 0x73, 0x4d, 0xff, 0x00, 0xb6, 0x8e, 0xff, 0x89, 0xb7, 0x7d, 0xff, 0x87, 0x68, 0x6f, 0xff, 0x3c, 0x32, 0x5f, 0xff, 0x00, 0x2c, 0x8b, 0xff, 0x00, 0x39, 0x98, 0xff, 0x03, 0x74, 0xac, 0xff, 0x1d, 0xb0, 0x80, 0xff, 0x66, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd5, 0x00, 0xff, 0x17, 0xa7, 0xe7, 0xff, 0x7d, 0xb5, 0xfb, 0xff, 0xdd, 0xd1, 0xfc, 0xff, 0xac, 0x8b, 0xf5, 0xff, 0x3e, 0x45, 0xe9, 0xff, 0x00, 0x38, 0xd6, 0xff, 0x45, 0x33, 0xe8, 0xff, 0x55, 0x54, 0xe2, 0xff, 0x77, 0x93, 0xd0, 0xff, 0x7b, 0x9d, 0xc0, 0xff, 0x92, 0xae, 0xc0, 0xff, 0x9c, 0xb3, 0xbd, 0xff, 0x83, 0xa4, 0xc3, 0xff, 0x51, 0x8a, 0xb9, 0xff, 0x4b, 0x5d, 0x64, 0xff, 0x86, 0x63, 0x5f, 0xff, 0xb4, 0x74, 0x68, 0xff, 0xbc, 0x74, 0x4f, 0xff, 0xa0, 0x72, 0x26, 0xff, 0x7c, 0x6c, 0x00, 0xff, 0x6d, 0x6e, 0x0f, 0xff, 0x6e, 0x75, 0x19, 0xff, 0x7c, 0x83, 0x28, 0xff, 0x7d, 0x81, 0x20, 0xff, 0x81, 0x81, 0x20, 0xff, 0x7f, 0x7c, 0x10, 0xff, 0x8d, 0x90, 0x5d, 0xff, 0x9b, 0xb2, 0xb1, 0xff, 0x8f, 0x91, 0xaa, 0xff, 0x96, 0x5e, 0x9c, 0xff, 0x91, 0x53, 0xbc, 0xff, 0xf1, 0xb1, 0xfc, 0xff, 0xec, 0xb5, 0xfa, 0xff, 0x8c, 0x94, 0x81, 0xff, 0x46, 0x96, 0x51, 0xff, 0x53, 0x99, 0x59, 0xff, 0x4e, 0x95, 0x4c, 0xff, 0x43, 0x90, 0x42, 0xff, 0x3c, 0x8a, 0x44, 0xff, 0x3f, 0x8a, 0x48, 0xff, 0x49, 0x8e, 0x4a, 0xff, 0x4f, 0x93, 0x4a, 0xff, 0x4d, 0x92, 0x46, 0xff, 0x47, 0x8e, 0x42, 0xff, 0x44, 0x8d, 0x40, 0xff, 0x42, 0x8c, 0x3e, 0xff, 0x40, 0x8a, 0x3a, 0xff, 0x43, 0x8c, 0x38, 0xff, 0x44, 0x90, 0x36, 0xff, 0x41, 0x90, 0x35, 0xff, 0x3e, 0x8f, 0x36, 0xff, 0x36, 0x8d, 0x35, 0xff, 0x3a, 0x8e, 0x32, 0xff, 0x4d, 0x92, 0x29, 0xff, 0x64, 0x95, 0x13, 0xff, 0x80, 0xa0, 0x00, 0xff, 0x95, 0xac, 0x11, 0xff, 0x7a, 0xa0, 0x09, 0xff, 0x3f, 0x8a, 0x00, 0xff, 0x2e, 0x85, 0x00, 0xff, 0x9b, 0x8e, 0x00, 0xff, 0xed, 0xa0, 0x00, 0xff, 0xe5, 0x9b, 0x00, 0xff, 0xd7, 0x96, 0x00, 0xff, 0x85, 0x8b, 0x85, 0xff, 0xb0, 0xc5, 0xab, 0xff, 0xc4, 0xd4, 0x9f, 0xff, 0x98, 0xb7, 0x7b, 0xff, 0x52, 0xb9, 0x44, 0xff, 0x00, 0xd9, 0x22, 0xff, 0x00, 0xd7, 0x1c, 0xff, 0x37, 0xa2, 0x07, 0xff, 0x64, 0x00, 0x0e, 0xff, 0x3e, 0x00, 0x07, 0xff, 0x93, 0x00, 0x02, 0xff, 0x67, 0x00, 0x00, 0xff, 0x53, 0x00, 0x20, 0xff, 0x78, 0x11, 0x9f, 0xff, 0x06, 0x50, 0xe0, 0xff, 0x00, 0x9c, 0xe9, 0xff, 0x58, 0x90, 0xdb, 0xff, 0x27, 0x38, 0xe8, 0xff, 0x00, 0x45, 0xc6, 0xff, 0x01, 0x2a, 0x81, 0xff, 0x00, 0x2e, 0x3f, 0xff, 0x00, 0x40, 0x00, 0xff, 0x14, 0x73, 0x00, 0xff, 0x2b, 0xa3, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x78, 0xc6, 0x95, 0xff, 0x40, 0xae, 0xed, 0xff, 0x66, 0xb3, 0xfe, 0xff, 0x62, 0x74, 0xe9, 0xff, 0x00, 0x00, 0xdf, 0xff, 0x0f, 0x5e, 0xea, 0xff, 0x20, 0x7b, 0xe0, 0xff, 0x6d, 0x8b, 0xd6, 0xff, 0x85, 0xa7, 0xcd, 0xff, 0x94, 0xb6, 0xca, 0xff, 0x84, 0xa9, 0xbe, 0xff, 0x58, 0x84, 0x9c, 0xff, 0x40, 0x5c, 0x7b, 0xff, 0x5e, 0x5d, 0x8c, 0xff, 0x82, 0x6e, 0x8c, 0xff, 0x9d, 0x6c, 0x51, 0xff, 0xa8, 0x67, 0x27, 0xff, 0x9c, 0x65, 0x00, 0xff, 0x96, 0x71, 0x00, 0xff, 0x8a, 0x7a, 0x0f, 0xff, 0x6b, 0x71, 0x17, 0xff, 0x72, 0x78, 0x1e, 0xff, 0x76, 0x78, 0x12, 0xff, 0x82, 0x7d, 0x02, 0xff, 0x90, 0x83, 0x01, 0xff, 0x94, 0x88, 0x0e, 0xff, 0x8b, 0x86, 0x1a, 0xff, 0x7d, 0x7f, 0x25, 0xff, 0x6e, 0x9d, 0x85, 0xff, 0x84, 0xad, 0x9d, 0xff, 0xbf, 0x89, 0x72, 0xff, 0xd7, 0x9a, 0xda, 0xff, 0xf9, 0xc1, 0xff, 0xff, 0xf5, 0xc2, 0xff, 0xff, 0xa9, 0xa5, 0xae, 0xff, 0x2e, 0x8f, 0x38, 0xff, 0x38, 0x8a, 0x43, 0xff, 0x3a, 0x89, 0x45, 0xff, 0x3b, 0x89, 0x48, 0xff, 0x47, 0x8f, 0x4f, 0xff, 0x4e, 0x92, 0x4f, 0xff, 0x49, 0x8e, 0x46, 0xff, 0x43, 0x8c, 0x40, 0xff, 0x45, 0x8f, 0x41, 0xff, 0x45, 0x8e, 0x41, 0xff, 0x44, 0x8c, 0x3f, 0xff, 0x48, 0x90, 0x3f, 0xff, 0x45, 0x8e, 0x39, 0xff, 0x4c, 0x93, 0x3b, 0xff, 0x47, 0x92, 0x38, 0xff, 0x45, 0x92, 0x38, 0xff, 0x43, 0x90, 0x36, 0xff, 0x3e, 0x8e, 0x33, 0xff, 0x39, 0x8b, 0x2a, 0xff, 0x37, 0x87, 0x22, 0xff, 0x5d, 0x94, 0x3d, 0xff, 0x86, 0xaa, 0x58, 0xff, 0x7f, 0xa9, 0x48, 0xff, 0x65, 0x9b, 0x2f, 0xff, 0x6b, 0x9e, 0x4f, 0xff, 0x43, 0x8c, 0x28, 0xff, 0x9d, 0x90, 0x0a, 0xff, 0xee, 0xa5, 0x1a, 0xff, 0xf0, 0xa0, 0x00, 0xff, 0xbb, 0x90, 0x39, 0xff, 0x54, 0x8f, 0x84, 0xff, 0x6f, 0x9c, 0x61, 0xff, 0x33, 0x7a, 0x27, 0xff, 0x00, 0x72, 0x00, 0xff, 0x00, 0xc7, 0x1a, 0xff, 0x00, 0xdb, 0x28, 0xff, 0x00, 0xde, 0x1d, 0xff, 0x64, 0x8b, 0x03, 0xff, 0x94, 0x00, 0x00, 0xff, 0xaa, 0x00, 0x02, 0xff, 0xbc, 0x12, 0x00, 0xff, 0x6e, 0x28, 0x00, 0xff, 0x9c, 0x21, 0xaa, 0xff, 0xc6, 0x79, 0xfb, 0xff, 0x1b, 0xd1, 0xfc, 0xff, 0x00, 0xeb, 0xf9, 0xff, 0x00, 0x83, 0xc3, 0xff, 0x09, 0x3f, 0xa4, 0xff, 0x00, 0x46, 0x93, 0xff, 0x00, 0x34, 0x14, 0xff, 0x04, 0x4b, 0x00, 0xff, 0x10, 0x6a, 0x00, 0xff, 0x1b, 0x83, 0x02, 0xff, 0x40, 0xbf, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x7b, 0xd3, 0xac, 0xff, 0x4e, 0x9a, 0xf2, 0xff, 0x6b, 0x62, 0xf9, 0xff, 0x3f, 0x36, 0xee, 0xff, 0x4c, 0x60, 0xed, 0xff, 0x3f, 0x88, 0xea, 0xff, 0x8b, 0xb3, 0xd8, 0xff, 0x8f, 0xab, 0xc3, 0xff, 0x65, 0x82, 0x93, 0xff, 0x48, 0x72, 0x86, 0xff, 0x68, 0x7d, 0xa5, 0xff, 0x9e, 0x65, 0x7b, 0xff, 0xaf, 0x6d, 0x59, 0xff, 0xab, 0x75, 0x22, 0xff, 0x8f, 0x6b, 0x00, 0xff, 0x7a, 0x66, 0x00, 0xff, 0x74, 0x65, 0x00, 0xff, 0x74, 0x67, 0x00, 0xff, 0x86, 0x72, 0x00, 0xff, 0x86, 0x78, 0x00, 0xff, 0x7d, 0x7c, 0x00, 0xff, 0x7c, 0x7b, 0x00, 0xff, 0x7c, 0x77, 0x00, 0xff, 0x86, 0x7c, 0x00, 0xff, 0xa7, 0x93, 0x00, 0xff, 0xa0, 0x90, 0x00, 0xff, 0x83, 0x7f, 0x03, 0xff, 0x70, 0x6e, 0x00, 0xff, 0x64, 0xb2, 0x94, 0xff, 0x77, 0xcf, 0xd6, 0xff, 0xa7, 0x5e, 0xc2, 0xff, 0x83, 0x45, 0xe6, 0xff, 0x9d, 0x77, 0xf5, 0xff, 0xe0, 0xae, 0xff, 0xff, 0xcb, 0xb0, 0xd3, 0xff, 0x34, 0x87, 0x34, 0xff, 0x35, 0x87, 0x3c, 0xff, 0x46, 0x8d, 0x49, 0xff, 0x4d, 0x90, 0x4f, 0xff, 0x43, 0x8a, 0x47, 0xff, 0x3f, 0x88, 0x41, 0xff, 0x40, 0x8a, 0x41, 0xff, 0x47, 0x90, 0x44, 0xff, 0x48, 0x91, 0x45, 0xff, 0x45, 0x8f, 0x43, 0xff, 0x43, 0x8c, 0x40, 0xff, 0x45, 0x8f, 0x3c, 0xff, 0x48, 0x92, 0x39, 0xff, 0x49, 0x93, 0x39, 0xff, 0x45, 0x91, 0x36, 0xff, 0x3f, 0x8f, 0x30, 0xff, 0x3a, 0x8f, 0x24, 0xff, 0x58, 0x98, 0x39, 0xff, 0x8b, 0xad, 0x6a, 0xff, 0xa4, 0xb9, 0x7e, 0xff, 0x9d, 0xb4, 0x70, 0xff, 0x8c, 0xac, 0x6f, 0xff, 0x96, 0xb5, 0x8d, 0xff, 0xa6, 0xbf, 0x9b, 0xff, 0x9e, 0xb4, 0x8a, 0xff, 0x9a, 0xac, 0x81, 0xff, 0xc4, 0xc3, 0xa3, 0xff, 0xe4, 0xd2, 0xb2, 0xff, 0xe5, 0xcf, 0xa9, 0xff, 0x9c, 0xab, 0x86, 0xff, 0x48, 0x82, 0x50, 0xff, 0x00, 0x62, 0x00, 0xff, 0x00, 0x5a, 0x00, 0xff, 0x00, 0xa8, 0x1a, 0xff, 0x00, 0xdc, 0x31, 0xff, 0x00, 0xde, 0x29, 0xff, 0x02, 0xd1, 0x15, 0xff, 0x89, 0x3d, 0x00, 0xff, 0xb3, 0x00, 0x00, 0xff, 0xa9, 0x35, 0x00, 0xff, 0x84, 0x49, 0x00, 0xff, 0x4c, 0x4d, 0x00, 0xff, 0x31, 0x19, 0xc0, 0xff, 0x2e, 0x1c, 0xfb, 0xff, 0x09, 0xa3, 0xf5, 0xff, 0x0a, 0xbf, 0xd1, 0xff, 0x00, 0x56, 0x72, 0xff, 0x00, 0x40, 0x00, 0xff, 0x09, 0x55, 0x00, 0xff, 0x12, 0x6f, 0x00, 0xff, 0x1e, 0x8d, 0x09, 0xff, 0x2e, 0xd1, 0x17, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0xbc, 0x00, 0xff, 0x4f, 0x77, 0xe1, 0xff, 0x54, 0x71, 0xff, 0xff, 0x23, 0x8e, 0xf7, 0xff, 0x31, 0x91, 0xdf, 0xff, 0x1a, 0x5f, 0xd1, 0xff, 0x60, 0x5a, 0xe3, 0xff, 0x6c, 0x55, 0xc6, 0xff, 0x14, 0x32, 0x88, 0xff, 0x3b, 0x4c, 0xaf, 0xff, 0x6d, 0x46, 0xa2, 0xff, 0x84, 0x3d, 0xb1, 0xff, 0x78, 0x3b, 0xb9, 0xff, 0x63, 0x47, 0xab, 0xff, 0x49, 0x4e, 0xa0, 0xff, 0x40, 0x4c, 0x9d, 0xff, 0x47, 0x5c, 0xa3, 0xff, 0x4a, 0x6d, 0xa8, 0xff, 0x4f, 0x53, 0x8a, 0xff, 0x7e, 0x54, 0x86, 0xff, 0x7c, 0x5d, 0x9e, 0xff, 0x68, 0x66, 0x9a, 0xff, 0x70, 0x6d, 0x93, 0xff, 0x76, 0x76, 0x8c, 0xff, 0xb0, 0xa8, 0x63, 0xff, 0xa4, 0x9d, 0x41, 0xff, 0x75, 0x75, 0x10, 0xff, 0x67, 0x64, 0x00, 0xff, 0x56, 0x84, 0x7a, 0xff, 0x3b, 0x7d, 0xb7, 0xff, 0x98, 0x00, 0xe7, 0xff, 0x97, 0x00, 0xf1, 0xff, 0x06, 0x00, 0xde, 0xff, 0x35, 0x14, 0xc1, 0xff, 0xb1, 0x75, 0x9b, 0xff, 0x70, 0x93, 0x59, 0xff, 0x34, 0x89, 0x3d, 0xff, 0x41, 0x8b, 0x44, 0xff, 0x42, 0x8a, 0x46, 0xff, 0x40, 0x89, 0x45, 0xff, 0x41, 0x8a, 0x46, 0xff, 0x42, 0x8c, 0x46, 0xff, 0x45, 0x8d, 0x44, 0xff, 0x48, 0x90, 0x48, 0xff, 0x4a, 0x91, 0x49, 0xff, 0x47, 0x90, 0x42, 0xff, 0x4a, 0x93, 0x3d, 0xff, 0x45, 0x91, 0x38, 0xff, 0x41, 0x91, 0x33, 0xff, 0x39, 0x8e, 0x29, 0xff, 0x56, 0x9a, 0x4d, 0xff, 0x9a, 0xbc, 0x86, 0xff, 0xc5, 0xd4, 0xac, 0xff, 0xb9, 0xc5, 0xa2, 0xff, 0xa2, 0xb5, 0x93, 0xff, 0xb1, 0xc2, 0xac, 0xff, 0xc3, 0xcd, 0xb7, 0xff, 0xb6, 0xc0, 0x9b, 0xff, 0xb6, 0xba, 0x94, 0xff, 0xce, 0xca, 0xaf, 0xff, 0xe5, 0xdb, 0xc7, 0xff, 0xec, 0xe1, 0xce, 0xff, 0xed, 0xe2, 0xcf, 0xff, 0xd6, 0xd5, 0xc8, 0xff, 0xb5, 0xc0, 0xba, 0xff, 0xb2, 0xbd, 0xb4, 0xff, 0xa0, 0xb1, 0xa6, 0xff, 0x7d, 0x9a, 0x80, 0xff, 0x29, 0xb6, 0x1e, 0xff, 0x00, 0xd6, 0x2c, 0xff, 0x00, 0xe3, 0x29, 0xff, 0x09, 0xa4, 0x19, 0xff, 0x55, 0x1d, 0x69, 0xff, 0x76, 0x62, 0x81, 0xff, 0x4d, 0x5a, 0x1f, 0xff, 0x33, 0x51, 0x00, 0xff, 0x4b, 0x4a, 0x63, 0xff, 0x3f, 0x18, 0xcd, 0xff, 0x00, 0x1b, 0xc0, 0xff, 0x00, 0x1e, 0x78, 0xff, 0x03, 0x37, 0x00, 0xff, 0x0a, 0x57, 0x00, 0xff, 0x17, 0x79, 0x00, 0xff, 0x21, 0x94, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x16, 0x77, 0x00, 0xff, 0x3a, 0x76, 0x77, 0xff, 0x48, 0x71, 0xee, 0xff, 0x2e, 0x3f, 0xf3, 0xff, 0x38, 0x1c, 0xe9, 0xff, 0x21, 0x00, 0xef, 0xff, 0x64, 0x00, 0xf9, 0xff, 0x5b, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xca, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xac, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x06, 0xe3, 0xff, 0x00, 0x09, 0xcc, 0xff, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x52, 0xe2, 0xff, 0x00, 0x7b, 0xeb, 0xff, 0x46, 0x07, 0xc7, 0xff, 0xa8, 0x00, 0xd8, 0xff, 0x57, 0x18, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x00, 0x46, 0xf6, 0xff, 0x24, 0x68, 0xbd, 0xff, 0xd6, 0xd7, 0xb2, 0xff, 0xf2, 0xea, 0xbe, 0xff, 0xde, 0xd7, 0xaa, 0xff, 0xc9, 0xc2, 0x8e, 0xff, 0xa5, 0xa0, 0x94, 0xff, 0x3c, 0x25, 0xba, 0xff, 0xb3, 0x00, 0xba, 0xff, 0xdf, 0x08, 0xc3, 0xff, 0x8c, 0x04, 0x69, 0xff, 0x20, 0x00, 0x06, 0xff, 0xe2, 0x46, 0x2f, 0xff, 0x9c, 0x98, 0x6d, 0xff, 0x2d, 0x8b, 0x41, 0xff, 0x48, 0x90, 0x4b, 0xff, 0x49, 0x90, 0x4d, 0xff, 0x43, 0x8b, 0x49, 0xff, 0x44, 0x8d, 0x4b, 0xff, 0x4a, 0x91, 0x4d, 0xff, 0x4a, 0x8e, 0x49, 0xff, 0x4b, 0x8f, 0x4a, 0xff, 0x49, 0x8e, 0x49, 0xff, 0x43, 0x8e, 0x41, 0xff, 0x3e, 0x91, 0x3a, 0xff, 0x41, 0x90, 0x3c, 0xff, 0x6a, 0xa1, 0x64, 0xff, 0x97, 0xb9, 0x91, 0xff, 0xae, 0xc3, 0xa8, 0xff, 0xae, 0xbe, 0xa6, 0xff, 0xaf, 0xbe, 0xab, 0xff, 0xbf, 0xca, 0xbd, 0xff, 0xcb, 0xd0, 0xc3, 0xff, 0xcd, 0xcc, 0xac, 0xff, 0x9a, 0xa4, 0x6c, 0xff, 0xc8, 0xc6, 0xab, 0xff, 0xe9, 0xdf, 0xcd, 0xff, 0xf2, 0xe6, 0xd5, 0xff, 0xf3, 0xe5, 0xd4, 0xff, 0xf1, 0xe4, 0xd1, 0xff, 0xec, 0xe1, 0xce, 0xff, 0xc1, 0xc5, 0xbb, 0xff, 0xb5, 0xbd, 0xb7, 0xff, 0xb7, 0xbf, 0xb9, 0xff, 0xba, 0xc3, 0xc0, 0xff, 0x9f, 0xa6, 0x93, 0xff, 0x52, 0x54, 0x00, 0xff, 0x71, 0x7f, 0x00, 0xff, 0x98, 0xbe, 0x0b, 0xff, 0x41, 0x85, 0x2f, 0xff, 0x00, 0x4c, 0x49, 0xff, 0x00, 0x5e, 0x7b, 0xff, 0x1a, 0x5f, 0x5b, 0xff, 0x33, 0x61, 0x24, 0xff, 0x32, 0x4c, 0x64, 0xff, 0x1f, 0x38, 0x6c, 0xff, 0x01, 0x4c, 0x00, 0xff, 0x0d, 0x65, 0x00, 0xff, 0x13, 0x7a, 0x00, 0xff, 0x2b, 0xaa, 0x0e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x40, 0x00, 0xff, 0x05, 0x48, 0x00, 0xff, 0x00, 0x43, 0x00, 0xff, 0x00, 0x30, 0x69, 0xff, 0x45, 0x2c, 0xcf, 0xff, 0x4a, 0x28, 0xff, 0xff, 0x10, 0x00, 0xe1, 0xff, 0x43, 0x00, 0xcb, 0xff, 0x29, 0x40, 0xe6, 0xff, 0x00, 0x96, 0xfe, 0xff, 0x00, 0xa6, 0xef, 0xff, 0x00, 0x80, 0xd9, 0xff, 0x08, 0x1f, 0xee, 0xff, 0x03, 0x00, 0xff, 0xff, 0x00, 0x01, 0xef, 0xff, 0x00, 0x10, 0xcb, 0xff, 0x00, 0x12, 0xcc, 0xff, 0x00, 0x2a, 0xce, 0xff, 0x00, 0x41, 0xd0, 0xff, 0x4f, 0x2f, 0xe1, 0xff, 0x58, 0x32, 0xfa, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x00, 0x3c, 0xf7, 0xff, 0x00, 0x56, 0xa5, 0xff, 0x59, 0x84, 0x3c, 0xff, 0xe2, 0xde, 0xb1, 0xff, 0xfb, 0xf2, 0xcb, 0xff, 0xf9, 0xf1, 0xc8, 0xff, 0xfd, 0xf3, 0xc9, 0xff, 0xef, 0xe8, 0xc2, 0xff, 0x65, 0x77, 0xda, 0xff, 0x63, 0x00, 0xb4, 0xff, 0xc6, 0x00, 0x5d, 0xff, 0x9a, 0x04, 0x4f, 0xff, 0x90, 0x13, 0x22, 0xff, 0xf7, 0x3e, 0x1f, 0xff, 0xa2, 0x93, 0x72, 0xff, 0x39, 0x8e, 0x4b, 0xff, 0x47, 0x8d, 0x4a, 0xff, 0x4c, 0x91, 0x4f, 0xff, 0x4a, 0x90, 0x4e, 0xff, 0x4b, 0x91, 0x4e, 0xff, 0x4e, 0x91, 0x4c, 0xff, 0x4e, 0x8e, 0x47, 0xff, 0x4b, 0x8e, 0x46, 0xff, 0x44, 0x8c, 0x44, 0xff, 0x54, 0x97, 0x56, 0xff, 0x74, 0xa6, 0x76, 0xff, 0x9f, 0xbb, 0x9d, 0xff, 0xac, 0xbf, 0xa8, 0xff, 0xa6, 0xb8, 0xa3, 0xff, 0xb0, 0xbf, 0xb0, 0xff, 0xc0, 0xcc, 0xc0, 0xff, 0xb8, 0xc2, 0xb5, 0xff, 0x93, 0x9d, 0x85, 0xff, 0xd5, 0xcc, 0xab, 0xff, 0xfa, 0xed, 0xc7, 0xff, 0xc4, 0xc2, 0x92, 0xff, 0x6c, 0x89, 0x38, 0xff, 0x87, 0x9a, 0x68, 0xff, 0xad, 0xb4, 0x93, 0xff, 0xd4, 0xd3, 0xb4, 0xff, 0xea, 0xe2, 0xcb, 0xff, 0xdb, 0xd7, 0xcb, 0xff, 0xad, 0xb8, 0xb9, 0xff, 0xb5, 0xbf, 0xb9, 0xff, 0xbb, 0xc3, 0xbd, 0xff, 0xb5, 0xbf, 0xb9, 0xff, 0x6f, 0x83, 0x55, 0xff, 0x65, 0x90, 0x4b, 0xff, 0xe6, 0xd2, 0x39, 0xff, 0xe2, 0xbc, 0x00, 0xff, 0x30, 0x53, 0x00, 0xff, 0x00, 0x62, 0x00, 0xff, 0x01, 0x6d, 0x36, 0xff, 0x00, 0x5e, 0x3d, 0xff, 0x00, 0x52, 0x22, 0xff, 0x00, 0x57, 0x00, 0xff, 0x09, 0x6d, 0x00, 0xff, 0x1a, 0x84, 0x00, 0xff, 0x2d, 0xb4, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x55, 0xff, 0x55, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x00, 0xff, 0x01, 0x35, 0x01, 0xff, 0x00, 0x2c, 0x00, 0xff, 0x01, 0x21, 0x00, 0xff, 0x00, 0x12, 0x2c, 0xff, 0x00, 0x17, 0xc6, 0xff, 0x20, 0x35, 0xf3, 0xff, 0x00, 0x39, 0xed, 0xff, 0x22, 0xae, 0xf1, 0xff, 0x3e, 0xf6, 0xfa, 0xff, 0x00, 0xed, 0xfe, 0xff, 0x00, 0xbc, 0xf5, 0xff, 0x01, 0x4e, 0xd7, 0xff, 0x01, 0x3e, 0xf2, 0xff, 0x01, 0x0e, 0xea, 0xff, 0x00, 0x00, 0xa8, 0xff, 0x00, 0x14, 0xc4, 0xff, 0x00, 0x39, 0xe4, 0xff, 0x00, 0x3f, 0xf1, 0xff, 0x00, 0x36, 0xff, 0xff, 0x00, 0x30, 0xff, 0xff, 0x05, 0x27, 0xf1, 0xff, 0x18, 0x3d, 0xc9, 0xff, 0x3f, 0x73, 0x6a, 0xff, 0xa0, 0xae, 0x31, 0xff, 0xe9, 0xe5, 0xb9, 0xff, 0xfe, 0xf4, 0xcd, 0xff, 0xf8, 0xf1, 0xc8, 0xff, 0xdb, 0xdc, 0xb1, 0xff, 0xa3, 0xb5, 0x82, 0xff, 0x59, 0x76, 0x9e, 0xff, 0x25, 0x1d, 0xdb, 0xff, 0x94, 0x00, 0xa6, 0xff, 0x76, 0x00, 0x45, 0xff, 0xd1, 0x25, 0x1a, 0xff, 0xab, 0x18, 0x00, 0xff, 0x85, 0x85, 0x69, 0xff, 0x5a, 0x95, 0x59, 0xff, 0x46, 0x8b, 0x48, 0xff, 0x4b, 0x8e, 0x4c, 0xff, 0x4d, 0x90, 0x4e, 0xff, 0x4d, 0x8f, 0x4b, 0xff, 0x47, 0x8a, 0x41, 0xff, 0x4f, 0x8f, 0x47, 0xff, 0x63, 0x9b, 0x61, 0xff, 0x77, 0xa3, 0x79, 0xff, 0x88, 0xa9, 0x8a, 0xff, 0x93, 0xa8, 0x8f, 0xff, 0xa6, 0xb0, 0x9c, 0xff, 0xb8, 0xc2, 0xb2, 0xff, 0xbd, 0xc8, 0xbc, 0xff, 0xa4, 0xb2, 0xa3, 0xff, 0x84, 0x96, 0x7d, 0xff, 0x66, 0x7d, 0x57, 0xff, 0xb8, 0xb5, 0x90, 0xff, 0xfd, 0xee, 0xcb, 0xff, 0xfb, 0xee, 0xca, 0xff, 0xfc, 0xef, 0xc9, 0xff, 0xc8, 0xc8, 0x90, 0xff, 0x50, 0x82, 0x00, 0xff, 0x1f, 0x6d, 0x00, 0xff, 0x5b, 0x88, 0x00, 0xff, 0xa0, 0xaf, 0x4c, 0xff, 0xeb, 0xea, 0x72, 0xff, 0xd6, 0xd8, 0x95, 0xff, 0xb9, 0xc3, 0xb8, 0xff, 0xa0, 0xb9, 0xbc, 0xff, 0x6e, 0x9a, 0x9c, 0xff, 0x1e, 0x65, 0x31, 0xff, 0x59, 0x8d, 0x54, 0xff, 0xad, 0xd6, 0x66, 0xff, 0x94, 0xc9, 0x3b, 0xff, 0x00, 0x5e, 0x00, 0xff, 0x00, 0x5d, 0x10, 0xff, 0x01, 0x52, 0x0d, 0xff, 0x06, 0x57, 0x00, 0xff, 0x12, 0x6f, 0x00, 0xff, 0x20, 0x8b, 0x04, 0xff, 0x80, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x00, 0xff, 0x00, 0x24, 0x00, 0xff, 0x00, 0x1e, 0x00, 0xff, 0x00, 0x0d, 0x00, 0xff, 0x00, 0x27, 0x5a, 0xff, 0x01, 0x38, 0x8f, 0xff, 0x12, 0x34, 0xa6, 0xff, 0x01, 0x5c, 0xe3, 0xff, 0x00, 0xaf, 0xff, 0xff, 0x47, 0xf9, 0xf9, 0xff, 0x47, 0xd1, 0xfc, 0xff, 0x00, 0x75, 0xea, 0xff, 0x00, 0x42, 0xa6, 0xff, 0x01, 0x72, 0xac, 0xff, 0x00, 0xb4, 0xe2, 0xff, 0x00, 0x87, 0xd5, 0xff, 0x00, 0x4a, 0xe6, 0xff, 0x00, 0x42, 0xf8, 0xff, 0x18, 0x2e, 0xf1, 0xff, 0x1d, 0x1a, 0xf8, 0xff, 0x10, 0x1e, 0xfc, 0xff, 0x2c, 0x2c, 0xd9, 0xff, 0x25, 0x3a, 0x9f, 0xff, 0x6c, 0x6a, 0x58, 0xff, 0xea, 0xe0, 0x2a, 0xff, 0xf9, 0xf4, 0xbe, 0xff, 0xe4, 0xe6, 0xc2, 0xff, 0xaa, 0xbf, 0x96, 0xff, 0x76, 0x9b, 0x6c, 0xff, 0x75, 0x96, 0x5b, 0xff, 0x66, 0x99, 0x9e, 0xff, 0x0f, 0x80, 0xde, 0xff, 0x45, 0x60, 0xda, 0xff, 0x60, 0x49, 0x71, 0xff, 0xaa, 0x4b, 0x47, 0xff, 0x37, 0x00, 0x54, 0xff, 0x74, 0x68, 0xb3, 0xff, 0x70, 0x96, 0x6d, 0xff, 0x48, 0x8c, 0x42, 0xff, 0x4c, 0x8d, 0x47, 0xff, 0x4b, 0x8d, 0x46, 0xff, 0x5b, 0x96, 0x5a, 0xff, 0x6a, 0x9c, 0x70, 0xff, 0x76, 0xa2, 0x83, 0xff, 0x7b, 0xa1, 0x88, 0xff, 0x87, 0xa1, 0x89, 0xff, 0xa3, 0xb0, 0x9f, 0xff, 0xb6, 0xc6, 0xbb, 0xff, 0xa7, 0xcd, 0xcb, 0xff, 0x82, 0xb6, 0xb5, 0xff, 0x6e, 0x90, 0x76, 0xff, 0x63, 0x86, 0x66, 0xff, 0x4c, 0x76, 0x4c, 0xff, 0x90, 0x9b, 0x77, 0xff, 0xf6, 0xe9, 0xc8, 0xff, 0xfe, 0xef, 0xcc, 0xff, 0xfb, 0xee, 0xc9, 0xff, 0xfc, 0xed, 0xc8, 0xff, 0xff, 0xef, 0xc8, 0xff, 0xcf, 0xce, 0x9a, 0xff, 0x61, 0x8b, 0x17, 0xff, 0x52, 0x83, 0x00, 0xff, 0xb1, 0xbb, 0x00, 0xff, 0xf5, 0xf5, 0x00, 0xff, 0xeb, 0xf0, 0x1c, 0xff, 0xca, 0xd0, 0x56, 0xff, 0x2a, 0x8b, 0x69, 0xff, 0x00, 0x7c, 0x65, 0xff, 0x1f, 0x69, 0x13, 0xff, 0xa3, 0x9f, 0x00, 0xff, 0xc3, 0xbe, 0x02, 0xff, 0x17, 0x73, 0x1f, 0xff, 0x00, 0x50, 0x04, 0xff, 0x09, 0x5a, 0x00, 0xff, 0x13, 0x6f, 0x00, 0xff, 0x1b, 0x8a, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x29, 0x00, 0xff, 0x00, 0x4d, 0x56, 0xff, 0x00, 0x76, 0xa1, 0xff, 0x00, 0x52, 0x8b, 0xff, 0x00, 0x35, 0x9a, 0xff, 0x00, 0x45, 0xb1, 0xff, 0x00, 0x3d, 0xaa, 0xff, 0x00, 0x83, 0xc2, 0xff, 0x1c, 0xdb, 0xf0, 0xff, 0x26, 0xbb, 0xff, 0xff, 0x33, 0xa2, 0xee, 0xff, 0x10, 0xae, 0xd6, 0xff, 0x00, 0xbc, 0xd9, 0xff, 0x00, 0xca, 0xe9, 0xff, 0xac, 0xa1, 0xf8, 0xff, 0xcd, 0x68, 0xf7, 0xff, 0x8b, 0x3c, 0xea, 0xff, 0x4a, 0x03, 0x8e, 0xff, 0x83, 0x05, 0x97, 0xff, 0xa4, 0x0f, 0xa6, 0xff, 0xae, 0x16, 0x8f, 0xff, 0xa2, 0x1e, 0x6d, 0xff, 0x62, 0x46, 0x61, 0xff, 0x98, 0xa8, 0x62, 0xff, 0xce, 0xcf, 0x86, 0xff, 0xb1, 0xaa, 0x5a, 0xff, 0x9d, 0x9e, 0x49, 0xff, 0xa1, 0x9f, 0x54, 0xff, 0xa3, 0x9c, 0x49, 0xff, 0x94, 0xa0, 0x8a, 0xff, 0x14, 0x90, 0xc8, 0xff, 0x00, 0x70, 0xb4, 0xff, 0x00, 0x56, 0xad, 0xff, 0x38, 0x3e, 0xcb, 0xff, 0x08, 0x00, 0xdb, 0xff, 0x46, 0x42, 0xea, 0xff, 0x6e, 0x8d, 0x7d, 0xff, 0x47, 0x8b, 0x31, 0xff, 0x61, 0x98, 0x69, 0xff, 0x77, 0xa6, 0x8c, 0xff, 0x7e, 0xa6, 0x92, 0xff, 0x76, 0x98, 0x84, 0xff, 0x83, 0x9b, 0x8a, 0xff, 0xa2, 0xb3, 0xa6, 0xff, 0xab, 0xc1, 0xb9, 0xff, 0x98, 0xcf, 0xd0, 0xff, 0x70, 0xe2, 0xe7, 0xff, 0x36, 0xea, 0xf9, 0xff, 0x19, 0xe0, 0xf7, 0xff, 0x3d, 0xb3, 0xb9, 0xff, 0x2f, 0x79, 0x50, 0xff, 0x6f, 0x8b, 0x60, 0xff, 0xec, 0xe4, 0xc6, 0xff, 0xff, 0xf3, 0xd1, 0xff, 0xff, 0xf0, 0xcd, 0xff, 0xfe, 0xf0, 0xcc, 0xff, 0xfc, 0xef, 0xca, 0xff, 0xfd, 0xee, 0xc9, 0xff, 0xff, 0xf1, 0xcb, 0xff, 0xdd, 0xd9, 0xa5, 0xff, 0x7c, 0x9f, 0x3f, 0xff, 0x60, 0x96, 0x41, 0xff, 0x4d, 0xa1, 0x66, 0xff, 0x6f, 0xaa, 0x46, 0xff, 0xb4, 0xc0, 0x00, 0xff, 0xb8, 0xc0, 0x00, 0xff, 0x9d, 0xbc, 0x26, 0xff, 0x32, 0x84, 0x00, 0xff, 0x57, 0x77, 0x00, 0xff, 0x3a, 0x61, 0x00, 0xff, 0x00, 0x56, 0x00, 0xff, 0x13, 0x70, 0x02, 0xff, 0x23, 0x95, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x3c, 0x1d, 0xff, 0x00, 0x63, 0x63, 0xff, 0x00, 0x8d, 0xab, 0xff, 0x00, 0x99, 0xd1, 0xff, 0x00, 0x7c, 0xdd, 0xff, 0x00, 0x4f, 0xb2, 0xff, 0x00, 0x54, 0xa3, 0xff, 0x00, 0x6d, 0xbe, 0xff, 0x00, 0x74, 0xcd, 0xff, 0x17, 0x8a, 0xd4, 0xff, 0x4d, 0xdb, 0xf5, 0xff, 0x0e, 0xbd, 0xef, 0xff, 0x00, 0x6e, 0xc1, 0xff, 0x65, 0x73, 0xd8, 0xff, 0xf3, 0x78, 0xfc, 0xff, 0xff, 0x88, 0xff, 0xff, 0xfd, 0x86, 0xfd, 0xff, 0xd4, 0x69, 0xe4, 0xff, 0x9d, 0x45, 0xa4, 0xff, 0x96, 0x35, 0x6a, 0xff, 0x88, 0x32, 0x26, 0xff, 0x6f, 0x4e, 0x3a, 0xff, 0x30, 0x74, 0x4c, 0xff, 0x00, 0x9e, 0x5c, 0xff, 0x5f, 0x9d, 0x2c, 0xff, 0xae, 0x8c, 0x00, 0xff, 0xd0, 0xa2, 0x00, 0xff, 0xd6, 0xa2, 0x00, 0xff, 0xd6, 0x9c, 0x00, 0xff, 0xcc, 0x91, 0x32, 0xff, 0x37, 0x62, 0xa0, 0xff, 0x1f, 0x68, 0xaa, 0xff, 0x8d, 0x49, 0xe6, 0xff, 0x33, 0x41, 0xf4, 0xff, 0x00, 0x4c, 0xdd, 0xff, 0x10, 0x4b, 0xb6, 0xff, 0x6f, 0x9c, 0x9e, 0xff, 0x82, 0xaf, 0xa2, 0xff, 0x82, 0xa8, 0xa0, 0xff, 0x7e, 0x9c, 0x90, 0xff, 0x93, 0xa7, 0x96, 0xff, 0xac, 0xbb, 0xaf, 0xff, 0xa2, 0xb6, 0xab, 0xff, 0x75, 0x97, 0x89, 0xff, 0x36, 0x77, 0x61, 0xff, 0x23, 0x8c, 0x7e, 0xff, 0x31, 0xa2, 0x9a, 0xff, 0x2f, 0xb7, 0xb9, 0xff, 0x1e, 0xbd, 0xbf, 0xff, 0x08, 0xb8, 0xbd, 0xff, 0x16, 0x8f, 0x7f, 0xff, 0xa8, 0xb5, 0x97, 0xff, 0xe5, 0xe3, 0xc5, 0xff, 0xe9, 0xe5, 0xc5, 0xff, 0xf1, 0xea, 0xc9, 0xff, 0xf7, 0xee, 0xcd, 0xff, 0xfa, 0xf0, 0xce, 0xff, 0xff, 0xf2, 0xce, 0xff, 0xf8, 0xec, 0xc7, 0xff, 0xd2, 0xd5, 0xb8, 0xff, 0x7b, 0x9d, 0x6e, 0xff, 0x7e, 0xae, 0x5e, 0xff, 0x87, 0xb4, 0x50, 0xff, 0x4c, 0x89, 0x0f, 0xff, 0x44, 0x98, 0x03, 0xff, 0xad, 0xdb, 0x34, 0xff, 0x78, 0x9b, 0x17, 0xff, 0x00, 0x56, 0x00, 0xff, 0x00, 0x5f, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x58, 0x40, 0xff, 0x00, 0x70, 0x6a, 0xff, 0x00, 0x48, 0x2f, 0xff, 0x00, 0x50, 0x50, 0xff, 0x00, 0x6e, 0x9f, 0xff, 0x00, 0x74, 0xce, 0xff, 0x00, 0x7f, 0xe6, 0xff, 0x00, 0x9a, 0xfa, 0xff, 0x00, 0x7f, 0xe4, 0xff, 0x00, 0x34, 0x80, 0xff, 0x00, 0x5a, 0x7c, 0xff, 0x00, 0x9a, 0xce, 0xff, 0x1c, 0x80, 0xe3, 0xff, 0xc8, 0x7d, 0xf3, 0xff, 0xff, 0x85, 0xff, 0xff, 0xf2, 0x8a, 0xf9, 0xff, 0xd7, 0x79, 0xec, 0xff, 0xaf, 0x66, 0xcd, 0xff, 0x63, 0x62, 0x9e, 0xff, 0x00, 0x4a, 0x56, 0xff, 0x00, 0x45, 0x2c, 0xff, 0x00, 0x68, 0x4d, 0xff, 0x04, 0x71, 0x45, 0xff, 0x23, 0xa4, 0x4e, 0xff, 0x3e, 0xaf, 0x45, 0xff, 0x57, 0x63, 0x00, 0xff, 0x76, 0x6f, 0x00, 0xff, 0xba, 0x92, 0x00, 0xff, 0xdf, 0x9a, 0x00, 0xff, 0xe0, 0x8f, 0x00, 0xff, 0x6c, 0x62, 0xa8, 0xff, 0x46, 0x74, 0xca, 0xff, 0xc7, 0x92, 0xed, 0xff, 0x67, 0x8a, 0xdd, 0xff, 0x00, 0x4d, 0x98, 0xff, 0x26, 0x60, 0x69, 0xff, 0x88, 0xa5, 0xa1, 0xff, 0x89, 0xa0, 0x95, 0xff, 0x95, 0xa8, 0x9a, 0xff, 0xa5, 0xb7, 0xae, 0xff, 0x96, 0xae, 0xa5, 0xff, 0x69, 0x89, 0x7e, 0xff, 0x47, 0x74, 0x62, 0xff, 0x45, 0x78, 0x5f, 0xff, 0x42, 0x75, 0x59, 0xff, 0x37, 0x77, 0x56, 0xff, 0x2b, 0x74, 0x52, 0xff, 0x32, 0x80, 0x62, 0xff, 0x51, 0x76, 0x44, 0xff, 0x71, 0x84, 0x46, 0xff, 0x55, 0x7c, 0x57, 0xff, 0x15, 0x4e, 0x34, 0xff, 0x2a, 0x66, 0x4a, 0xff, 0x46, 0x82, 0x61, 0xff, 0x58, 0x94, 0x6e, 0xff, 0x6f, 0xa0, 0x78, 0xff, 0xa3, 0xb6, 0x81, 0xff, 0xb1, 0xc2, 0x9d, 0xff, 0x85, 0x9c, 0x88, 0xff, 0x27, 0x77, 0x77, 0xff, 0x49, 0x91, 0x5b, 0xff, 0x70, 0xa2, 0x67, 0xff, 0xd6, 0xa0, 0x00, 0xff, 0x76, 0xa1, 0x14, 0xff, 0x00, 0xb7, 0x4b, 0xff, 0x00, 0xa9, 0x59, 0xff, 0x00, 0x71, 0x1c, 0xff, 0x19, 0x79, 0x00, 0xff, 0x33, 0xaa, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x9a, 0x70, 0xff, 0x00, 0xc2, 0xc6, 0xff, 0x00, 0x71, 0x7d, 0xff, 0x00, 0x38, 0x2c, 0xff, 0x00, 0x31, 0x23, 0xff, 0x00, 0x42, 0x59, 0xff, 0x00, 0x62, 0xa9, 0xff, 0x00, 0x70, 0xdc, 0xff, 0x00, 0x50, 0xc8, 0xff, 0x00, 0x33, 0x7f, 0xff, 0x00, 0x25, 0x3d, 0xff, 0x00, 0x2b, 0x23, 0xff, 0x21, 0x51, 0x7d, 0xff, 0xa7, 0x78, 0xca, 0xff, 0xb4, 0x5e, 0xf0, 0xff, 0x8e, 0x2f, 0xf2, 0xff, 0x1b, 0x11, 0xce, 0xff, 0x05, 0x3f, 0x9d, 0xff, 0x3c, 0x5d, 0x7f, 0xff, 0x16, 0x35, 0x72, 0xff, 0x00, 0x5d, 0x4e, 0xff, 0x00, 0x77, 0x5a, 0xff, 0x00, 0x7f, 0x4e, 0xff, 0x10, 0xa4, 0x3a, 0xff, 0x2c, 0x98, 0x36, 0xff, 0x71, 0x63, 0x00, 0xff, 0x57, 0x5c, 0x00, 0xff, 0x51, 0x5d, 0x01, 0xff, 0x99, 0x75, 0x00, 0xff, 0xe3, 0xaa, 0x62, 0xff, 0xb7, 0xa7, 0xa9, 0xff, 0x6e, 0x7a, 0x95, 0xff, 0x54, 0x8a, 0xbb, 0xff, 0x11, 0x75, 0xb1, 0xff, 0x47, 0x6f, 0x8b, 0xff, 0x8a, 0x9b, 0x99, 0xff, 0x9b, 0xaa, 0xa1, 0xff, 0x99, 0xad, 0xa9, 0xff, 0x7b, 0x9c, 0xa3, 0xff, 0x4e, 0x79, 0x78, 0xff, 0x40, 0x72, 0x62, 0xff, 0x49, 0x7c, 0x67, 0xff, 0x49, 0x78, 0x63, 0xff, 0x4b, 0x7b, 0x63, 0xff, 0x4b, 0x78, 0x5c, 0xff, 0x58, 0x80, 0x5e, 0xff, 0x69, 0x7f, 0x57, 0xff, 0x7c, 0x83, 0x53, 0xff, 0x85, 0x83, 0x46, 0xff, 0xad, 0xb5, 0xa6, 0xff, 0x85, 0xb1, 0xbf, 0xff, 0x00, 0x5e, 0x59, 0xff, 0x00, 0x37, 0x00, 0xff, 0x00, 0x3f, 0x2c, 0xff, 0x3f, 0x6a, 0x3b, 0xff, 0xad, 0xa9, 0x2f, 0xff, 0xd0, 0xc3, 0x00, 0xff, 0x78, 0x93, 0x64, 0xff, 0x97, 0x74, 0x77, 0xff, 0x47, 0x65, 0x47, 0xff, 0x6f, 0xa9, 0x42, 0xff, 0x44, 0x81, 0x2f, 0xff, 0x39, 0x65, 0x00, 0xff, 0x02, 0x73, 0x10, 0xff, 0x05, 0x89, 0x29, 0xff, 0x0f, 0x80, 0x00, 0xff, 0x40, 0x9f, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x00, 0xff, 0x00, 0x98, 0x5c, 0xff, 0x00, 0xbc, 0xab, 0xff, 0x00, 0x90, 0x97, 0xff, 0x00, 0x4b, 0x47, 0xff, 0x00, 0x3f, 0x43, 0xff, 0x00, 0x3d, 0x38, 0xff, 0x00, 0x5b, 0x48, 0xff, 0x00, 0x45, 0x58, 0xff, 0x00, 0x39, 0x77, 0xff, 0x00, 0x3b, 0x6f, 0xff, 0x00, 0x3b, 0x66, 0xff, 0x01, 0x40, 0x54, 0xff, 0x00, 0x49, 0x0f, 0xff, 0x00, 0x3f, 0x00, 0xff, 0x2a, 0x46, 0x85, 0xff, 0x5a, 0x3a, 0xd7, 0xff, 0x00, 0x31, 0xe9, 0xff, 0x4b, 0x48, 0xc8, 0xff, 0x7b, 0x55, 0x8c, 0xff, 0x51, 0x0d, 0x88, 0xff, 0x00, 0x60, 0x6c, 0xff, 0x00, 0x77, 0x64, 0xff, 0x38, 0x89, 0x5e, 0xff, 0x38, 0x7d, 0x23, 0xff, 0x00, 0x5a, 0x00, 0xff, 0x6b, 0x63, 0x02, 0xff, 0x79, 0x65, 0x01, 0xff, 0x75, 0x55, 0x00, 0xff, 0x93, 0x8a, 0x64, 0xff, 0xf0, 0xeb, 0xd9, 0xff, 0xd7, 0xd6, 0xcf, 0xff, 0x14, 0x3c, 0x56, 0xff, 0x20, 0x57, 0x53, 0xff, 0x27, 0x69, 0x7c, 0xff, 0x58, 0x73, 0x8c, 0xff, 0x86, 0x97, 0x9e, 0xff, 0x5e, 0x7e, 0x80, 0xff, 0x46, 0x78, 0x7d, 0xff, 0x65, 0x90, 0x9b, 0xff, 0x77, 0x90, 0x8d, 0xff, 0x54, 0x79, 0x67, 0xff, 0x4e, 0x7d, 0x63, 0xff, 0x5e, 0x7c, 0x64, 0xff, 0x70, 0x7c, 0x65, 0xff, 0x7c, 0x79, 0x5f, 0xff, 0x84, 0x79, 0x5a, 0xff, 0x84, 0x7a, 0x57, 0xff, 0x7d, 0x79, 0x47, 0xff, 0x9b, 0x9f, 0x8d, 0xff, 0xd8, 0xde, 0xe9, 0xff, 0xd5, 0xe1, 0xf1, 0xff, 0x94, 0xc4, 0xd2, 0xff, 0x0c, 0x7b, 0x7f, 0xff, 0x00, 0x76, 0x5a, 0xff, 0x85, 0x99, 0x4b, 0xff, 0x95, 0x8e, 0x32, 0xff, 0x57, 0x6f, 0x4d, 0xff, 0x79, 0x9e, 0x9b, 0xff, 0x8c, 0x87, 0x7b, 0xff, 0x27, 0x6e, 0x46, 0xff, 0x27, 0x61, 0x01, 0xff, 0x00, 0x52, 0x00, 0xff, 0x00, 0x68, 0x01, 0xff, 0x08, 0x7d, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x55, 0xff, 0x00, 0x95, 0x61, 0xff, 0x00, 0x9b, 0x6f, 0xff, 0x00, 0x6e, 0x56, 0xff, 0x00, 0x4f, 0x44, 0xff, 0x00, 0x41, 0x42, 0xff, 0x00, 0x3a, 0x36, 0xff, 0x00, 0x9e, 0x89, 0xff, 0x01, 0xcb, 0xbc, 0xff, 0x00, 0x9b, 0x8d, 0xff, 0x00, 0x61, 0x5b, 0xff, 0x00, 0x3e, 0x51, 0xff, 0x00, 0x4e, 0x53, 0xff, 0x00, 0x90, 0x52, 0xff, 0x04, 0xc2, 0x6a, 0xff, 0x00, 0x98, 0x17, 0xff, 0x00, 0x6a, 0x39, 0xff, 0x00, 0x57, 0x9b, 0xff, 0x4e, 0x38, 0xbf, 0xff, 0x8b, 0x00, 0x46, 0xff, 0xd3, 0x3e, 0x23, 0xff, 0x84, 0x48, 0x61, 0xff, 0x00, 0x60, 0x66, 0xff, 0xb7, 0xbb, 0x46, 0xff, 0xdc, 0xc8, 0x00, 0xff, 0x63, 0x70, 0x02, 0xff, 0x4f, 0x56, 0x06, 0xff, 0x8b, 0x5b, 0x00, 0xff, 0xb7, 0x8d, 0x65, 0xff, 0xf0, 0xe9, 0xdb, 0xff, 0xff, 0xfb, 0xef, 0xff, 0xee, 0xed, 0xe4, 0xff, 0x5e, 0x74, 0x83, 0xff, 0x3e, 0x66, 0x2f, 0xff, 0x3b, 0x74, 0x20, 0xff, 0x99, 0x98, 0x00, 0xff, 0xb2, 0xa6, 0x4b, 0xff, 0x50, 0x5e, 0x66, 0xff, 0x48, 0x6d, 0x6e, 0xff, 0x5c, 0x7b, 0x7a, 0xff, 0x75, 0x8b, 0x8e, 0xff, 0x6c, 0x78, 0x71, 0xff, 0x7e, 0x77, 0x63, 0xff, 0x8b, 0x76, 0x5e, 0xff, 0x93, 0x7b, 0x67, 0xff, 0x92, 0x7a, 0x64, 0xff, 0x85, 0x76, 0x59, 0xff, 0x7f, 0x75, 0x52, 0xff, 0x87, 0x86, 0x73, 0xff, 0xcc, 0xd5, 0xe4, 0xff, 0xda, 0xe1, 0xf3, 0xff, 0xc5, 0xd8, 0xe8, 0xff, 0x86, 0xba, 0xc5, 0xff, 0x1c, 0x9f, 0xa3, 0xff, 0x1d, 0xa9, 0x9d, 0xff, 0x4d, 0xa0, 0x70, 0xff, 0x2e, 0x6f, 0x4c, 0xff, 0x00, 0x70, 0x59, 0xff, 0x0f, 0x7e, 0x6c, 0xff, 0x00, 0x5c, 0x2d, 0xff, 0x0d, 0x5e, 0x00, 0xff, 0x1e, 0x7b, 0x06, 0xff, 0x1d, 0x82, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xaa, 0x55, 0xff, 0x00, 0x9e, 0x6b, 0xff, 0x00, 0x88, 0x59, 0xff, 0x00, 0x60, 0x36, 0xff, 0x00, 0x5d, 0x3f, 0xff, 0x00, 0x56, 0x44, 0xff, 0x00, 0x40, 0x3a, 0xff, 0x00, 0x57, 0x3a, 0xff, 0x00, 0xd0, 0xbc, 0xff, 0x00, 0xf3, 0xeb, 0xff, 0x00, 0xe3, 0xdd, 0xff, 0x00, 0xc2, 0xb9, 0xff, 0x00, 0x9b, 0x90, 0xff, 0x00, 0x8e, 0x70, 0xff, 0x06, 0xa1, 0x48, 0xff, 0x14, 0xc4, 0x36, 0xff, 0x0b, 0xb8, 0x10, 0xff, 0x03, 0x8c, 0x00, 0xff, 0x00, 0x6c, 0x35, 0xff, 0x7f, 0x66, 0x44, 0xff, 0xf5, 0x61, 0x1a, 0xff, 0xda, 0x12, 0x51, 0xff, 0x56, 0x72, 0x63, 0xff, 0xed, 0xe8, 0x17, 0xff, 0xff, 0xf6, 0x00, 0xff, 0xed, 0xe4, 0x00, 0xff, 0x9e, 0x9c, 0x00, 0xff, 0xbf, 0x94, 0x6b, 0xff, 0xf5, 0xea, 0xdc, 0xff, 0xfc, 0xfa, 0xef, 0xff, 0xfa, 0xf7, 0xec, 0xff, 0xfa, 0xf7, 0xee, 0xff, 0x8b, 0x90, 0x9f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x36, 0x3c, 0x23, 0xff, 0xc8, 0xab, 0x54, 0xff, 0xc5, 0xb2, 0x90, 0xff, 0x89, 0x10, 0xb7, 0xff, 0x8e, 0x26, 0x67, 0xff, 0x4d, 0x3d, 0x75, 0xff, 0x35, 0x47, 0x89, 0xff, 0x48, 0x4a, 0x91, 0xff, 0x5b, 0x51, 0x97, 0xff, 0x68, 0x5a, 0x94, 0xff, 0x77, 0x6a, 0x8c, 0xff, 0x81, 0x74, 0x6b, 0xff, 0x81, 0x76, 0x5b, 0xff, 0x7a, 0x77, 0x58, 0xff, 0xac, 0xbf, 0xd0, 0xff, 0xbb, 0xd0, 0xea, 0xff, 0x8a, 0xba, 0xdc, 0xff, 0x33, 0x90, 0xab, 0xff, 0x11, 0x7b, 0x5c, 0xff, 0x50, 0xb3, 0x9d, 0xff, 0x39, 0xba, 0xb1, 0xff, 0x2e, 0xa6, 0x86, 0xff, 0x19, 0x8f, 0x46, 0xff, 0x17, 0x83, 0x27, 0xff, 0x00, 0x46, 0x00, 0xff, 0x1a, 0x71, 0x00, 0xff, 0x41, 0xad, 0x14, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xaa, 0x55, 0xff, 0x00, 0x91, 0x56, 0xff, 0x00, 0x71, 0x3b, 0xff, 0x00, 0x5e, 0x2c, 0xff, 0x00, 0x61, 0x33, 0xff, 0x00, 0x61, 0x3a, 0xff, 0x00, 0x5f, 0x41, 0xff, 0x00, 0x4d, 0x2a, 0xff, 0x00, 0x78, 0x50, 0xff, 0x00, 0xe2, 0xce, 0xff, 0x00, 0xf6, 0xed, 0xff, 0x00, 0xf9, 0xf0, 0xff, 0x00, 0xf2, 0xe8, 0xff, 0x00, 0xcb, 0xb9, 0xff, 0x00, 0x8b, 0x72, 0xff, 0x00, 0x4c, 0x04, 0xff, 0x03, 0x7a, 0x00, 0xff, 0x0f, 0xab, 0x00, 0xff, 0x22, 0xb8, 0x00, 0xff, 0x04, 0x9a, 0x0c, 0xff, 0x5a, 0x72, 0x24, 0xff, 0xb4, 0x38, 0x3b, 0xff, 0xcc, 0xae, 0x3d, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xf5, 0xc9, 0x00, 0xff, 0xbd, 0x9f, 0x95, 0xff, 0xe7, 0xe7, 0xe5, 0xff, 0xfc, 0xfa, 0xf0, 0xff, 0xfb, 0xf9, 0xef, 0xff, 0xfe, 0xfb, 0xf3, 0xff, 0xba, 0xbe, 0xc6, 0xff, 0x00, 0x00, 0x00, 0xff, 0x35, 0x00, 0xa4, 0xff, 0x46, 0x00, 0xea, 0xff, 0x2b, 0x2e, 0xd5, 0xff, 0x1d, 0x52, 0xfc, 0xff, 0x52, 0x46, 0xea, 0xff, 0x1f, 0x10, 0xa5, 0xff, 0x00, 0x00, 0x82, 0xff, 0x00, 0x00, 0x93, 0xff, 0x00, 0x00, 0xab, 0xff, 0x00, 0x00, 0xc5, 0xff, 0x00, 0x05, 0x9c, 0xff, 0x17, 0x18, 0x56, 0xff, 0x2d, 0x2f, 0x60, 0xff, 0x46, 0x79, 0xa2, 0xff, 0x5b, 0xad, 0xe1, 0xff, 0x1e, 0x5c, 0x79, 0xff, 0x00, 0x8d, 0xb0, 0xff, 0x00, 0x67, 0x74, 0xff, 0x14, 0x90, 0x75, 0xff, 0x1d, 0xab, 0x9f, 0xff, 0x0c, 0x80, 0x61, 0xff, 0x00, 0x69, 0x1e, 0xff, 0x00, 0x6f, 0x00, 0xff, 0x11, 0x6e, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xaa, 0xaa, 0xff, 0x00, 0xa3, 0x65, 0xff, 0x00, 0x8e, 0x56, 0xff, 0x00, 0x83, 0x50, 0xff, 0x00, 0x89, 0x56, 0xff, 0x00, 0x8e, 0x5c, 0xff, 0x00, 0x8f, 0x5e, 0xff, 0x00, 0x8f, 0x5e, 0xff, 0x00, 0x79, 0x44, 0xff, 0x00, 0xa7, 0x80, 0xff, 0x00, 0xee, 0xdd, 0xff, 0x00, 0xf7, 0xe9, 0xff, 0x00, 0xeb, 0xd8, 0xff, 0x00, 0xe5, 0xcd, 0xff, 0x00, 0xde, 0xc8, 0xff, 0x00, 0xc3, 0xaf, 0xff, 0x00, 0x88, 0x73, 0xff, 0x00, 0x5b, 0x24, 0xff, 0x19, 0x94, 0x00, 0xff, 0x29, 0xbe, 0x11, 0xff, 0x00, 0xb2, 0x0a, 0xff, 0x00, 0x85, 0x11, 0xff, 0x7c, 0x8f, 0x1a, 0xff, 0xd7, 0xd8, 0x15, 0xff, 0xfd, 0xd4, 0x0a, 0xff, 0xff, 0xb3, 0x00, 0xff, 0xff, 0x87, 0x00, 0xff, 0xbb, 0x21, 0x31, 0xff, 0x44, 0x49, 0x84, 0xff, 0xb5, 0xb1, 0xd6, 0xff, 0xf2, 0xee, 0xef, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0x1e, 0x30, 0x91, 0xff, 0x2c, 0x00, 0xf5, 0xff, 0x4b, 0x00, 0xc2, 0xff, 0x3f, 0x28, 0x62, 0xff, 0x2f, 0x5e, 0xf2, 0xff, 0x00, 0x5f, 0xff, 0xff, 0x00, 0x57, 0xf6, 0xff, 0x01, 0x37, 0xbe, 0xff, 0x00, 0x00, 0x95, 0xff, 0x00, 0x00, 0xab, 0xff, 0x00, 0x00, 0xbf, 0xff, 0x00, 0x10, 0x94, 0xff, 0x00, 0x2e, 0x81, 0xff, 0x00, 0x3f, 0xba, 0xff, 0x3d, 0x8c, 0xc8, 0xff, 0x00, 0x93, 0xba, 0xff, 0x00, 0x7d, 0x91, 0xff, 0x00, 0x9f, 0xb6, 0xff, 0x0a, 0x6e, 0x4a, 0xff, 0x0a, 0x76, 0x59, 0xff, 0x00, 0x56, 0x1e, 0xff, 0x00, 0x49, 0x00, 0xff, 0x00, 0x1f, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xaa, 0xaa, 0xff, 0x00, 0xba, 0x80, 0xff, 0x00, 0xb4, 0x7b, 0xff, 0x00, 0xae, 0x77, 0xff, 0x00, 0xab, 0x70, 0xff, 0x00, 0xa9, 0x6f, 0xff, 0x00, 0xa8, 0x70, 0xff, 0x00, 0xa8, 0x71, 0xff, 0x00, 0xa8, 0x72, 0xff, 0x00, 0xa2, 0x6c, 0xff, 0x00, 0xc5, 0x9c, 0xff, 0x00, 0xc7, 0xa2, 0xff, 0x00, 0xb8, 0x95, 0xff, 0x00, 0xb5, 0x93, 0xff, 0x00, 0xb7, 0x96, 0xff, 0x00, 0xbb, 0x9d, 0xff, 0x00, 0xb5, 0x97, 0xff, 0x01, 0x87, 0x64, 0xff, 0x00, 0x42, 0x00, 0xff, 0x00, 0x57, 0x00, 0xff, 0x0f, 0x8f, 0x08, 0xff, 0x0e, 0xaa, 0x0a, 0xff, 0x00, 0x80, 0x00, 0xff, 0x00, 0x4f, 0x10, 0xff, 0x94, 0x51, 0x1c, 0xff, 0xe9, 0x9c, 0x09, 0xff, 0xff, 0x9a, 0x00, 0xff, 0xe6, 0x3c, 0x28, 0xff, 0x5d, 0x00, 0x78, 0xff, 0x44, 0x00, 0xc7, 0xff, 0x6d, 0x5d, 0xbc, 0xff, 0xc1, 0xbf, 0xea, 0xff, 0xee, 0xe9, 0xef, 0xff, 0x79, 0x6e, 0xec, 0xff, 0x3b, 0x00, 0xc8, 0xff, 0x32, 0x00, 0x34, 0xff, 0x39, 0x20, 0x38, 0xff, 0x55, 0x3d, 0xc4, 0xff, 0x00, 0x49, 0xe1, 0xff, 0x00, 0x5f, 0xf4, 0xff, 0x00, 0x65, 0xfe, 0xff, 0x00, 0x47, 0xd9, 0xff, 0x00, 0x0a, 0xb3, 0xff, 0x00, 0x21, 0xac, 0xff, 0x01, 0x37, 0x98, 0xff, 0x00, 0x29, 0x78, 0xff, 0x36, 0x56, 0x97, 0xff, 0x4a, 0x9d, 0xd4, 0xff, 0x00, 0xa6, 0xcd, 0xff, 0x06, 0x94, 0x9f, 0xff, 0x01, 0x6b, 0x62, 0xff, 0x03, 0x53, 0x00, 0xff, 0x03, 0x52, 0x00, 0xff, 0x03, 0x5c, 0x00, 0xff, 0x00, 0x92, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xaa, 0x55, 0xff, 0x00, 0x8f, 0x49, 0xff, 0x00, 0x91, 0x4b, 0xff, 0x00, 0x91, 0x4e, 0xff, 0x00, 0x93, 0x4f, 0xff, 0x00, 0x91, 0x4d, 0xff, 0x00, 0x93, 0x51, 0xff, 0x00, 0x98, 0x59, 0xff, 0x00, 0x9c, 0x5f, 0xff, 0x00, 0xa1, 0x65, 0xff, 0x00, 0xac, 0x70, 0xff, 0x00, 0xa3, 0x5f, 0xff, 0x00, 0x82, 0x32, 0xff, 0x00, 0x5d, 0x00, 0xff, 0x00, 0x44, 0x00, 0xff, 0x00, 0x3f, 0x00, 0xff, 0x00, 0x42, 0x00, 0xff, 0x00, 0x48, 0x0d, 0xff, 0x00, 0x44, 0x03, 0xff, 0x00, 0x40, 0x00, 0xff, 0x00, 0x3e, 0x01, 0xff, 0x00, 0x52, 0x00, 0xff, 0x00, 0x6e, 0x00, 0xff, 0x00, 0x68, 0x00, 0xff, 0x00, 0x52, 0x01, 0xff, 0x4e, 0x57, 0x00, 0xff, 0xaf, 0x6a, 0x1e, 0xff, 0xe2, 0x5e, 0x58, 0xff, 0xd5, 0x3f, 0x59, 0xff, 0x7f, 0x11, 0xaa, 0xff, 0x0b, 0x00, 0xd7, 0xff, 0x00, 0x28, 0xf2, 0xff, 0x6d, 0x77, 0xf7, 0xff, 0x82, 0x68, 0xde, 0xff, 0x98, 0x00, 0x60, 0xff, 0x5a, 0x00, 0x63, 0xff, 0x4f, 0x0a, 0x46, 0xff, 0x9d, 0x1d, 0x8c, 0xff, 0x00, 0x00, 0x8d, 0xff, 0x00, 0x18, 0x95, 0xff, 0x00, 0x37, 0xbe, 0xff, 0x01, 0x4e, 0xdd, 0xff, 0x01, 0x51, 0xdc, 0xff, 0x00, 0x3f, 0xa0, 0xff, 0x00, 0x1c, 0x5f, 0xff, 0x17, 0x30, 0xb7, 0xff, 0x53, 0x91, 0xcb, 0xff, 0x1d, 0x85, 0xa9, 0xff, 0x00, 0x65, 0x68, 0xff, 0x03, 0x50, 0x14, 0xff, 0x0f, 0x5b, 0x00, 0xff, 0x11, 0x6f, 0x00, 0xff, 0x1a, 0x99, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xaa, 0x00, 0xff, 0x00, 0x6b, 0x0a, 0xff, 0x00, 0x63, 0x05, 0xff, 0x00, 0x63, 0x11, 0xff, 0x00, 0x68, 0x1e, 0xff, 0x00, 0x6f, 0x27, 0xff, 0x00, 0x76, 0x30, 0xff, 0x00, 0x7e, 0x37, 0xff, 0x00, 0x81, 0x39, 0xff, 0x00, 0x96, 0x53, 0xff, 0x00, 0xa7, 0x67, 0xff, 0x00, 0xaa, 0x68, 0xff, 0x00, 0xa5, 0x5c, 0xff, 0x00, 0x98, 0x4a, 0xff, 0x00, 0x81, 0x34, 0xff, 0x00, 0x5d, 0x12, 0xff, 0x00, 0x43, 0x00, 0xff, 0x00, 0x3c, 0x00, 0xff, 0x00, 0x40, 0x00, 0xff, 0x00, 0x40, 0x00, 0xff, 0x00, 0x40, 0x00, 0xff, 0x17, 0x55, 0x36, 0xff, 0x1b, 0x59, 0x3f, 0xff, 0x00, 0x45, 0x00, 0xff, 0x00, 0x62, 0x00, 0xff, 0x00, 0x63, 0x02, 0xff, 0x00, 0x4a, 0x07, 0xff, 0x5f, 0x45, 0x27, 0xff, 0xc5, 0x5d, 0x00, 0xff, 0x87, 0x37, 0x95, 0xff, 0x00, 0x19, 0xfb, 0xff, 0x00, 0x58, 0xfc, 0xff, 0x98, 0xaa, 0xfa, 0xff, 0x8f, 0x95, 0xe8, 0xff, 0xc9, 0x00, 0x8e, 0xff, 0xe7, 0x00, 0x4f, 0xff, 0xc9, 0x47, 0x7c, 0xff, 0xc6, 0x4b, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x19, 0xa1, 0xff, 0x00, 0x1c, 0x85, 0xff, 0x00, 0x54, 0xa6, 0xff, 0x01, 0x80, 0xf1, 0xff, 0x01, 0x5d, 0xd2, 0xff, 0x00, 0x38, 0xa3, 0xff, 0x17, 0x47, 0xbe, 0xff, 0x36, 0x61, 0x71, 0xff, 0x00, 0x41, 0x00, 0xff, 0x0b, 0x52, 0x00, 0xff, 0x0e, 0x66, 0x00, 0xff, 0x49, 0xb6, 0x24, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xaa, 0x00, 0xff, 0x00, 0x5f, 0x05, 0xff, 0x00, 0x56, 0x02, 0xff, 0x00, 0x54, 0x01, 0xff, 0x00, 0x55, 0x03, 0xff, 0x00, 0x59, 0x09, 0xff, 0x00, 0x5e, 0x15, 0xff, 0x00, 0x63, 0x1b, 0xff, 0x00, 0x73, 0x2b, 0xff, 0x00, 0x8c, 0x47, 0xff, 0x00, 0x92, 0x51, 0xff, 0x00, 0x98, 0x55, 0xff, 0x00, 0x9e, 0x56, 0xff, 0x00, 0x9e, 0x50, 0xff, 0x00, 0x9c, 0x48, 0xff, 0x00, 0x97, 0x3e, 0xff, 0x00, 0x85, 0x2c, 0xff, 0x00, 0x63, 0x12, 0xff, 0x00, 0x47, 0x01, 0xff, 0x00, 0x3e, 0x00, 0xff, 0x00, 0x34, 0x00, 0xff, 0x3e, 0x88, 0x7d, 0xff, 0x65, 0xbd, 0xbd, 0xff, 0x57, 0xa3, 0x9e, 0xff, 0x31, 0x74, 0x66, 0xff, 0x00, 0x58, 0x07, 0xff, 0x00, 0x5f, 0x01, 0xff, 0x00, 0x46, 0x00, 0xff, 0x00, 0x32, 0x00, 0xff, 0x24, 0x2b, 0x42, 0xff, 0x20, 0x37, 0xc9, 0xff, 0xaf, 0xa3, 0xfc, 0xff, 0xed, 0xcb, 0xff, 0xff, 0xd2, 0xb8, 0xf8, 0xff, 0x63, 0x3b, 0xde, 0xff, 0xce, 0x02, 0xaa, 0xff, 0xf2, 0x58, 0x9f, 0xff, 0xb9, 0x43, 0xcf, 0xff, 0x00, 0x1f, 0xe2, 0xff, 0x00, 0x2a, 0x99, 0xff, 0x00, 0x35, 0x61, 0xff, 0x00, 0x7a, 0xce, 0xff, 0x00, 0x8c, 0xe8, 0xff, 0x00, 0x5c, 0xa8, 0xff, 0x00, 0x35, 0x55, 0xff, 0x04, 0x45, 0x00, 0xff, 0x0a, 0x5d, 0x00, 0xff, 0x2b, 0x8c, 0x09, 0xff, 0x4d, 0xd9, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x00, 0xff, 0x00, 0x52, 0x00, 0xff, 0x00, 0x51, 0x01, 0xff, 0x00, 0x53, 0x02, 0xff, 0x00, 0x53, 0x04, 0xff, 0x00, 0x53, 0x06, 0xff, 0x00, 0x52, 0x06, 0xff, 0x00, 0x54, 0x09, 0xff, 0x00, 0x6d, 0x25, 0xff, 0x00, 0x77, 0x2f, 0xff, 0x00, 0x78, 0x31, 0xff, 0x00, 0x76, 0x30, 0xff, 0x01, 0x6e, 0x29, 0xff, 0x00, 0x6d, 0x28, 0xff, 0x00, 0x75, 0x2a, 0xff, 0x00, 0x7e, 0x2d, 0xff, 0x00, 0x82, 0x2a, 0xff, 0x00, 0x78, 0x1f, 0xff, 0x00, 0x66, 0x14, 0xff, 0x00, 0x48, 0x04, 0xff, 0x00, 0x2f, 0x00, 0xff, 0x47, 0x97, 0x8c, 0xff, 0x6d, 0xca, 0xc8, 0xff, 0x7e, 0xd3, 0xd1, 0xff, 0x72, 0xcb, 0xc9, 0xff, 0x33, 0x92, 0x78, 0xff, 0x00, 0x54, 0x00, 0xff, 0x01, 0x55, 0x00, 0xff, 0x00, 0x50, 0x00, 0xff, 0x00, 0x3a, 0x00, 0xff, 0x00, 0x23, 0x00, 0xff, 0x85, 0x6c, 0x90, 0xff, 0xd7, 0xaa, 0xe1, 0xff, 0xf8, 0xc4, 0xff, 0xff, 0x9d, 0x80, 0xf4, 0xff, 0x76, 0x29, 0xe0, 0xff, 0x9e, 0x38, 0xbd, 0xff, 0x5c, 0x28, 0xab, 0xff, 0x00, 0x3e, 0xac, 0xff, 0x01, 0x36, 0x9e, 0xff, 0x01, 0x5b, 0xa1, 0xff, 0x00, 0x63, 0x92, 0xff, 0x00, 0x40, 0x45, 0xff, 0x07, 0x45, 0x00, 0xff, 0x1e, 0x6f, 0x00, 0xff, 0x2f, 0x93, 0x00, 0xff, 0x80, 0xff, 0x40, 0xff, 0xaa, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x00, 0xff, 0x00, 0x59, 0x00, 0xff, 0x00, 0x52, 0x00, 0xff, 0x00, 0x4d, 0x01, 0xff, 0x00, 0x4b, 0x01, 0xff, 0x00, 0x4b, 0x02, 0xff, 0x00, 0x4b, 0x02, 0xff, 0x01, 0x57, 0x12, 0xff, 0x02, 0x65, 0x21, 0xff, 0x04, 0x62, 0x1f, 0xff, 0x05, 0x61, 0x20, 0xff, 0x04, 0x5a, 0x1d, 0xff, 0x02, 0x52, 0x17, 0xff, 0x00, 0x4d, 0x14, 0xff, 0x00, 0x47, 0x0e, 0xff, 0x01, 0x43, 0x05, 0xff, 0x0c, 0x3e, 0x04, 0xff, 0x17, 0x36, 0x07, 0xff, 0x22, 0x34, 0x0d, 0xff, 0x35, 0x30, 0x1d, 0xff, 0x4b, 0x26, 0x31, 0xff, 0x40, 0x3d, 0x3b, 0xff, 0x1a, 0x4d, 0x34, 0xff, 0x23, 0x56, 0x3f, 0xff, 0x2a, 0x6a, 0x54, 0xff, 0x15, 0x70, 0x4b, 0xff, 0x00, 0x66, 0x1d, 0xff, 0x01, 0x71, 0x33, 0xff, 0x01, 0x64, 0x2a, 0xff, 0x01, 0x50, 0x04, 0xff, 0x00, 0x41, 0x00, 0xff, 0x00, 0x18, 0x00, 0xff, 0x1c, 0x1e, 0x21, 0xff, 0x9e, 0x7c, 0xa2, 0xff, 0xac, 0x8c, 0xe7, 0xff, 0x00, 0x11, 0xf1, 0xff, 0x23, 0x11, 0xdd, 0xff, 0x00, 0x49, 0xad, 0xff, 0x00, 0x57, 0x87, 0xff, 0x00, 0x40, 0x7a, 0xff, 0x03, 0x3c, 0x42, 0xff, 0x0a, 0x49, 0x00, 0xff, 0x17, 0x68, 0x00, 0xff, 0x2d, 0x98, 0x16, 0xff, 0x71, 0xff, 0x39, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x00, 0xff, 0x00, 0x40, 0x00, 0xff, 0x00, 0x3e, 0x00, 0xff, 0x00, 0x3c, 0x00, 0xff, 0x00, 0x3b, 0x00, 0xff, 0x00, 0x3b, 0x00, 0xff, 0x00, 0x41, 0x00, 0xff, 0x02, 0x54, 0x12, 0xff, 0x09, 0x55, 0x17, 0xff, 0x0f, 0x52, 0x14, 0xff, 0x13, 0x4f, 0x10, 0xff, 0x19, 0x4d, 0x0f, 0xff, 0x25, 0x4c, 0x0d, 0xff, 0x2e, 0x49, 0x08, 0xff, 0x3d, 0x4b, 0x04, 0xff, 0x45, 0x47, 0x01, 0xff, 0x42, 0x40, 0x01, 0xff, 0x3c, 0x34, 0x05, 0xff, 0x37, 0x28, 0x0f, 0xff, 0x3f, 0x1b, 0x1b, 0xff, 0x51, 0x19, 0x2d, 0xff, 0x48, 0x18, 0x27, 0xff, 0x14, 0x1e, 0x00, 0xff, 0x00, 0x1e, 0x00, 0xff, 0x00, 0x13, 0x00, 0xff, 0x00, 0x12, 0x00, 0xff, 0x00, 0x21, 0x00, 0xff, 0x00, 0x3b, 0x1d, 0xff, 0x01, 0x4b, 0x28, 0xff, 0x00, 0x2e, 0x02, 0xff, 0x01, 0x39, 0x01, 0xff, 0x01, 0x47, 0x3e, 0xff, 0x00, 0x27, 0x69, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x1a, 0x49, 0xff, 0x0f, 0x1d, 0xb4, 0xff, 0x47, 0x26, 0xd1, 0xff, 0x1d, 0x41, 0x81, 0xff, 0x00, 0x3a, 0x21, 0xff, 0x02, 0x44, 0x00, 0xff, 0x1a, 0x69, 0x00, 0xff, 0x3c, 0xa5, 0x17, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x00, 0xff, 0x00, 0x3a, 0x00, 0xff, 0x00, 0x39, 0x00, 0xff, 0x00, 0x38, 0x00, 0xff, 0x00, 0x39, 0x00, 0xff, 0x00, 0x3a, 0x00, 0xff, 0x00, 0x3c, 0x00, 0xff, 0x00, 0x41, 0x03, 0xff, 0x05, 0x43, 0x04, 0xff, 0x19, 0x48, 0x03, 0xff, 0x32, 0x51, 0x01, 0xff, 0x49, 0x59, 0x00, 0xff, 0x63, 0x63, 0x00, 0xff, 0x6a, 0x63, 0x00, 0xff, 0x6c, 0x60, 0x00, 0xff, 0x62, 0x56, 0x00, 0xff, 0x56, 0x4c, 0x00, 0xff, 0x40, 0x3a, 0x04, 0xff, 0x33, 0x28, 0x0b, 0xff, 0x3a, 0x1d, 0x14, 0xff, 0x43, 0x1b, 0x1a, 0xff, 0x2b, 0x1f, 0x05, 0xff, 0x0a, 0x22, 0x00, 0xff, 0x07, 0x25, 0x00, 0xff, 0x01, 0x26, 0x00, 0xff, 0x00, 0x25, 0x00, 0xff, 0x00, 0x22, 0x00, 0xff, 0x00, 0x19, 0x00, 0xff, 0x00, 0x0e, 0x00, 0xff, 0x00, 0x14, 0x00, 0xff, 0x00, 0x0e, 0x00, 0xff, 0x00, 0x14, 0x39, 0xff, 0x00, 0x25, 0x8a, 0xff, 0x00, 0x18, 0x49, 0xff, 0x00, 0x0a, 0x00, 0xff, 0x00, 0x21, 0x00, 0xff, 0x00, 0x34, 0x00, 0xff, 0x04, 0x48, 0x00, 0xff, 0x10, 0x60, 0x00, 0xff, 0x17, 0xa2, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x00, 0xff, 0x00, 0x3a, 0x00, 0xff, 0x00, 0x39, 0x00, 0xff, 0x00, 0x39, 0x00, 0xff, 0x00, 0x39, 0x00, 0xff, 0x00, 0x39, 0x00, 0xff, 0x00, 0x3a, 0x00, 0xff, 0x00, 0x3b, 0x00, 0xff, 0x00, 0x3c, 0x00, 0xff, 0x04, 0x3f, 0x00, 0xff, 0x1e, 0x49, 0x00, 0xff, 0x35, 0x53, 0x00, 0xff, 0x4d, 0x5d, 0x00, 0xff, 0x56, 0x5d, 0x00, 0xff, 0x5a, 0x5a, 0x00, 0xff, 0x4d, 0x4f, 0x00, 0xff, 0x3e, 0x45, 0x01, 0xff, 0x29, 0x32, 0x02, 0xff, 0x26, 0x23, 0x08, 0xff, 0x31, 0x1c, 0x0f, 0xff, 0x30, 0x1b, 0x0c, 0xff, 0x13, 0x1f, 0x00, 0xff, 0x01, 0x20, 0x00, 0xff, 0x00, 0x23, 0x00, 0xff, 0x00, 0x23, 0x00, 0xff, 0x00, 0x27, 0x00, 0xff, 0x00, 0x28, 0x00, 0xff, 0x01, 0x2a, 0x00, 0xff, 0x01, 0x2b, 0x00, 0xff, 0x01, 0x2c, 0x02, 0xff, 0x01, 0x2c, 0x05, 0xff, 0x01, 0x2b, 0x00, 0xff, 0x02, 0x2c, 0x00, 0xff, 0x04, 0x37, 0x00, 0xff, 0x06, 0x45, 0x03, 0xff, 0x11, 0x57, 0x00, 0xff, 0x12, 0x6d, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x00, 0xff, 0x00, 0x3a, 0x00, 0xff, 0x00, 0x38, 0x00, 0xff, 0x00, 0x38, 0x00, 0xff, 0x00, 0x37, 0x00, 0xff, 0x00, 0x38, 0x00, 0xff, 0x00, 0x39, 0x00, 0xff, 0x00, 0x39, 0x00, 0xff, 0x00, 0x3b, 0x00, 0xff, 0x00, 0x3c, 0x00, 0xff, 0x00, 0x3d, 0x00, 0xff, 0x02, 0x41, 0x00, 0xff, 0x0c, 0x45, 0x00, 0xff, 0x17, 0x47, 0x00, 0xff, 0x24, 0x49, 0x00, 0xff, 0x26, 0x48, 0x00, 0xff, 0x1c, 0x42, 0x00, 0xff, 0x14, 0x3d, 0x00, 0xff, 0x17, 0x3e, 0x01, 0xff, 0x1b, 0x41, 0x02, 0xff, 0x16, 0x44, 0x00, 0xff, 0x0c, 0x48, 0x00, 0xff, 0x09, 0x4a, 0x00, 0xff, 0x0a, 0x4d, 0x01, 0xff, 0x0f, 0x55, 0x01, 0xff, 0x05, 0x48, 0x00, 0xff, 0x0b, 0x53, 0x02, 0xff, 0x10, 0x5f, 0x02, 0xff, 0x0e, 0x5e, 0x02, 0xff, 0x0d, 0x5d, 0x05, 0xff, 0x0f, 0x60, 0x03, 0xff, 0x0e, 0x62, 0x00, 0xff, 0x11, 0x68, 0x00, 0xff, 0x17, 0x74, 0x00, 0xff, 0x2a, 0xaa, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x55, 0x00, 0xff, 0x00, 0x38, 0x00, 0xff, 0x00, 0x3a, 0x00, 0xff, 0x00, 0x3b, 0x00, 0xff, 0x01, 0x3d, 0x00, 0xff, 0x03, 0x43, 0x00, 0xff, 0x04, 0x48, 0x00, 0xff, 0x05, 0x4c, 0x00, 0xff, 0x07, 0x50, 0x00, 0xff, 0x0a, 0x56, 0x00, 0xff, 0x0e, 0x5c, 0x01, 0xff, 0x0f, 0x61, 0x01, 0xff, 0x10, 0x64, 0x01, 0xff, 0x13, 0x66, 0x01, 0xff, 0x17, 0x6a, 0x02, 0xff, 0x1b, 0x6a, 0x02, 0xff, 0x1b, 0x64, 0x00, 0xff, 0x20, 0x6b, 0x00, 0xff, 0x1f, 0x73, 0x03, 0xff, 0x21, 0x7b, 0x00, 0xff, 0x20, 0x86, 0x00, 0xff, 0x23, 0x8b, 0x00, 0xff, 0x2e, 0x8b, 0x00, 0xff, 0x24, 0x92, 0x00, 0xff, 0x40, 0xbf, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x80, 0x00, 0xff, 0x15, 0x67, 0x02, 0xff, 0x17, 0x6c, 0x01, 0xff, 0x1b, 0x73, 0x01, 0xff, 0x1c, 0x78, 0x02, 0xff, 0x1e, 0x7a, 0x02, 0xff, 0x1d, 0x7c, 0x00, 0xff, 0x21, 0x81, 0x00, 0xff, 0x24, 0x87, 0x00, 0xff, 0x2a, 0x8e, 0x00, 0xff, 0x30, 0x97, 0x08, 0xff, 0x36, 0xa1, 0x00, 0xff, 0x40, 0xbf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2a, 0xaa, 0x00, 0xff, 0x66, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x52, 0x4c, 0x45, 0x36, 0x78, 0x00, 0x78, 0x00, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0xfb, 0x01, 0x00, 0x00,
+  0xfe, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00,
+  0x2e, 0x02, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0x7e, 0x02, 0x00, 0x00, 0xb1, 0x02, 0x00, 0x00, 0xe6, 0x02, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0x6c, 0x03, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x0c, 0x04, 0x00, 0x00, 0x6b, 0x04, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0x3f, 0x05, 0x00, 0x00, 0xb4, 0x05, 0x00, 0x00, 0x2d, 0x06, 0x00, 0x00, 0xa6, 0x06, 0x00, 0x00, 0x27, 0x07, 0x00, 0x00,
+  0xae, 0x07, 0x00, 0x00, 0x39, 0x08, 0x00, 0x00, 0xc5, 0x08, 0x00, 0x00, 0x46, 0x09, 0x00, 0x00, 0xc7, 0x09, 0x00, 0x00, 0x4f, 0x0a, 0x00, 0x00, 0xd4, 0x0a, 0x00, 0x00, 0x5e, 0x0b, 0x00, 0x00,
+  0xe6, 0x0b, 0x00, 0x00, 0x6c, 0x0c, 0x00, 0x00, 0xf1, 0x0c, 0x00, 0x00, 0x74, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x8e, 0x0e, 0x00, 0x00, 0x26, 0x0f, 0x00, 0x00, 0xb6, 0x0f, 0x00, 0x00,
+  0x49, 0x10, 0x00, 0x00, 0xd0, 0x10, 0x00, 0x00, 0x5f, 0x11, 0x00, 0x00, 0xf1, 0x11, 0x00, 0x00, 0x85, 0x12, 0x00, 0x00, 0x1d, 0x13, 0x00, 0x00, 0xab, 0x13, 0x00, 0x00, 0x37, 0x14, 0x00, 0x00,
+  0xc5, 0x14, 0x00, 0x00, 0x52, 0x15, 0x00, 0x00, 0xde, 0x15, 0x00, 0x00, 0x67, 0x16, 0x00, 0x00, 0x09, 0x17, 0x00, 0x00, 0xa4, 0x17, 0x00, 0x00, 0x41, 0x18, 0x00, 0x00, 0xd8, 0x18, 0x00, 0x00,
+  0x76, 0x19, 0x00, 0x00, 0x17, 0x1a, 0x00, 0x00, 0xc0, 0x1a, 0x00, 0x00, 0x64, 0x1b, 0x00, 0x00, 0x0a, 0x1c, 0x00, 0x00, 0xb4, 0x1c, 0x00, 0x00, 0x5f, 0x1d, 0x00, 0x00, 0x08, 0x1e, 0x00, 0x00,
+  0xb9, 0x1e, 0x00, 0x00, 0x6c, 0x1f, 0x00, 0x00, 0x1d, 0x20, 0x00, 0x00, 0xce, 0x20, 0x00, 0x00, 0x81, 0x21, 0x00, 0x00, 0x38, 0x22, 0x00, 0x00, 0xef, 0x22, 0x00, 0x00, 0xa6, 0x23, 0x00, 0x00,
+  0x5d, 0x24, 0x00, 0x00, 0x11, 0x25, 0x00, 0x00, 0xc6, 0x25, 0x00, 0x00, 0x7c, 0x26, 0x00, 0x00, 0x37, 0x27, 0x00, 0x00, 0xec, 0x27, 0x00, 0x00, 0xa9, 0x28, 0x00, 0x00, 0x63, 0x29, 0x00, 0x00,
+  0x1c, 0x2a, 0x00, 0x00, 0xd3, 0x2a, 0x00, 0x00, 0x8c, 0x2b, 0x00, 0x00, 0x45, 0x2c, 0x00, 0x00, 0xfa, 0x2c, 0x00, 0x00, 0xa9, 0x2d, 0x00, 0x00, 0x58, 0x2e, 0x00, 0x00, 0x07, 0x2f, 0x00, 0x00,
+  0xaa, 0x2f, 0x00, 0x00, 0x49, 0x30, 0x00, 0x00, 0xdf, 0x30, 0x00, 0x00, 0x70, 0x31, 0x00, 0x00, 0x01, 0x32, 0x00, 0x00, 0x8e, 0x32, 0x00, 0x00, 0x17, 0x33, 0x00, 0x00, 0x9c, 0x33, 0x00, 0x00,
+  0x1f, 0x34, 0x00, 0x00, 0x9a, 0x34, 0x00, 0x00, 0x0f, 0x35, 0x00, 0x00, 0x80, 0x35, 0x00, 0x00, 0xf1, 0x35, 0x00, 0x00, 0x5c, 0x36, 0x00, 0x00, 0xc5, 0x36, 0x00, 0x00, 0x27, 0x37, 0x00, 0x00,
+  0x84, 0x37, 0x00, 0x00, 0xe0, 0x37, 0x00, 0x00, 0x34, 0x38, 0x00, 0x00, 0x7a, 0x38, 0x00, 0x00, 0xbc, 0x38, 0x00, 0x00, 0xf3, 0x38, 0x00, 0x00, 0x16, 0x39, 0x00, 0x00, 0x23, 0x39, 0x00, 0x00,
+  0x26, 0x39, 0x00, 0x00, 0x29, 0x39, 0x00, 0x00, 0x2c, 0x39, 0x00, 0x00, 0x2f, 0x39, 0x00, 0x00, 0x32, 0x39, 0x00, 0x00, 0x35, 0x39, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00,
+  0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x09, 0x40, 0x03, 0x80, 0x03, 0x8c, 0x2e, 0x6c, 0x06, 0x8d,
+  0x06, 0x4c, 0x26, 0x8d, 0x06, 0x0d, 0x1f, 0x6c, 0x3f, 0xe0, 0x07, 0x9b, 0x00, 0x00, 0xce, 0x00, 0x00, 0x0e, 0xa0, 0x02, 0xeb, 0x35, 0xa8, 0x5c, 0x08, 0x64, 0x27, 0x43, 0xab, 0x4c, 0x52, 0x86,
+  0xa8, 0x64, 0x23, 0x43, 0xa7, 0x83, 0x4b, 0x45, 0xe9, 0x25, 0xc0, 0x06, 0x80, 0x06, 0xeb, 0x07, 0x99, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x11, 0x08, 0x06, 0xc8, 0x5c, 0x09, 0x64, 0x46, 0x4b, 0x49,
+  0x54, 0x0f, 0x8d, 0x91, 0xa5, 0xee, 0x8c, 0x10, 0x8d, 0xb9, 0xc6, 0x13, 0xe5, 0x00, 0xa8, 0x00, 0xc0, 0x15, 0x68, 0x39, 0x02, 0x56, 0x5c, 0x32, 0x86, 0x6c, 0x3e, 0x99, 0x00, 0x00, 0xc7, 0x00,
+  0x00, 0x15, 0xc0, 0x03, 0x85, 0x33, 0x04, 0x2b, 0x09, 0x15, 0x6c, 0x5d, 0x2e, 0x8d, 0xed, 0x84, 0xf0, 0x6c, 0x33, 0x85, 0xdb, 0xce, 0xb2, 0xad, 0x22, 0x84, 0x70, 0x84, 0xf8, 0xb5, 0x77, 0xcd,
+  0x99, 0xda, 0x33, 0xca, 0xdc, 0xb4, 0x5f, 0xbe, 0x1e, 0xdf, 0xf7, 0xb5, 0x08, 0x0c, 0x99, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x16, 0x20, 0x3c, 0x89, 0x74, 0xac, 0x7c, 0x09, 0x5c, 0xea, 0x5b, 0x74,
+  0x95, 0x37, 0xa6, 0xf3, 0x04, 0x3a, 0x06, 0x93, 0x7d, 0x79, 0xc6, 0xb5, 0xa5, 0x37, 0x8d, 0x5c, 0xb6, 0x9b, 0xc6, 0x34, 0xa5, 0x1d, 0xce, 0x3e, 0xe7, 0xfb, 0xd6, 0xf5, 0xad, 0x90, 0x64, 0x8d,
+  0x0a, 0xe0, 0x01, 0x99, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x1a, 0x60, 0x44, 0x65, 0x4b, 0x05, 0x43, 0x88, 0x34, 0xed, 0x3c, 0xf6, 0x65, 0x8f, 0x44, 0xef, 0x44, 0x31, 0x85, 0x9a, 0xc6, 0x59, 0xb6,
+  0xf5, 0x24, 0x55, 0x35, 0xf2, 0x64, 0x33, 0x95, 0xb6, 0xb5, 0x3c, 0xe7, 0x78, 0xbe, 0x30, 0x6c, 0xac, 0x63, 0xd0, 0x84, 0x50, 0x64, 0xa7, 0x02, 0x68, 0x03, 0xce, 0x03, 0x87, 0x01, 0xe1, 0x11,
+  0x99, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x20, 0x00, 0x02, 0x48, 0x14, 0xca, 0x2c, 0x51, 0x3e, 0x16, 0x06, 0xb1, 0x3c, 0xf1, 0x4c, 0x09, 0x64, 0xec, 0x63, 0x75, 0x7d, 0xb7, 0x55, 0x33, 0x04, 0xd4,
+  0x4c, 0x6d, 0x54, 0x13, 0x8d, 0x35, 0x95, 0x59, 0xbe, 0x5d, 0xdf, 0xfb, 0xc6, 0xd1, 0x7c, 0x2d, 0x74, 0x91, 0x54, 0x31, 0x04, 0x91, 0x03, 0xae, 0x43, 0x0b, 0x74, 0x09, 0x44, 0xc8, 0x2b, 0x90,
+  0x04, 0x8d, 0x03, 0x04, 0x10, 0xc6, 0x09, 0xc7, 0x04, 0x98, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x21, 0x27, 0x54, 0x8a, 0x64, 0xc8, 0x4b, 0xa8, 0x53, 0x33, 0x4d, 0x9a, 0x26, 0x90, 0x34, 0x52, 0x2d,
+  0x72, 0x25, 0x33, 0x7d, 0x17, 0xae, 0x54, 0x95, 0x34, 0x3c, 0x59, 0x75, 0x39, 0xae, 0x18, 0xbe, 0xf8, 0xb5, 0xd6, 0xa5, 0x94, 0x85, 0x4f, 0x2c, 0x2f, 0x04, 0x8a, 0x33, 0x6f, 0x54, 0x92, 0x4c,
+  0x92, 0x5c, 0x32, 0x7d, 0xb2, 0x9d, 0xed, 0x64, 0x2a, 0x44, 0x91, 0x04, 0x49, 0x12, 0x05, 0x18, 0xc5, 0x99, 0x87, 0x9c, 0x98, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x26, 0x22, 0x2c, 0x86, 0x43, 0xe5,
+  0x32, 0x6a, 0x3c, 0x2c, 0x4d, 0xab, 0x44, 0xd3, 0x4d, 0x6b, 0x3c, 0x8c, 0x64, 0xf3, 0x84, 0xf7, 0xa5, 0x34, 0x65, 0x90, 0x3c, 0x93, 0x04, 0x92, 0x3c, 0x95, 0x9d, 0x96, 0xa5, 0xba, 0xc6, 0xd9,
+  0xc6, 0x56, 0xae, 0x0f, 0x75, 0x0f, 0x44, 0xed, 0x0b, 0x0f, 0x04, 0x8c, 0x0b, 0x31, 0x1c, 0xf0, 0x7c, 0x92, 0x8d, 0x73, 0x7d, 0x58, 0xce, 0x56, 0xb6, 0x71, 0x8d, 0x70, 0x4c, 0x2c, 0x53, 0x6c,
+  0x04, 0x87, 0x23, 0x2c, 0x22, 0xe0, 0x68, 0xa5, 0x6b, 0x98, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x2b, 0x40, 0x04, 0x26, 0x04, 0x09, 0x15, 0x2d, 0x07, 0x67, 0x34, 0xcc, 0x74, 0x69, 0x7c, 0x2a, 0x6c,
+  0x0e, 0x74, 0x12, 0x85, 0xb2, 0x75, 0x13, 0x2d, 0x19, 0x06, 0x1d, 0x07, 0x19, 0x9e, 0x59, 0xbe, 0xd7, 0x8d, 0x75, 0x7d, 0xf7, 0xa5, 0x99, 0xb6, 0xd5, 0xa5, 0x53, 0x8d, 0x30, 0x75, 0x90, 0x4d,
+  0xad, 0x04, 0x4b, 0x04, 0x4c, 0x3c, 0x0f, 0x55, 0x73, 0x55, 0xd6, 0x95, 0x59, 0xa6, 0x35, 0xbe, 0xf2, 0x85, 0x30, 0x55, 0x93, 0xad, 0x8d, 0x6c, 0xaf, 0x7c, 0x31, 0x44, 0xa7, 0x5a, 0x60, 0x3a,
+  0x34, 0x05, 0xfe, 0x05, 0x71, 0x03, 0xa0, 0x03, 0x98, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x81, 0x00, 0x00, 0x2c, 0x6c, 0x7d, 0x0d, 0x95, 0xe9, 0x63, 0x06, 0x3b, 0xab, 0x64, 0x6d,
+  0x84, 0x11, 0x9d, 0x6a, 0x54, 0xed, 0x44, 0xce, 0x8c, 0x95, 0xa5, 0x95, 0x9d, 0x37, 0x35, 0x1a, 0x06, 0x5c, 0x46, 0xf4, 0x84, 0xd6, 0xad, 0x75, 0xa5, 0x98, 0xb6, 0x14, 0x96, 0x8f, 0x65, 0xcc,
+  0x44, 0x6b, 0x3c, 0x8c, 0x3c, 0x4f, 0x2d, 0x51, 0x6d, 0x92, 0x8d, 0xf3, 0x85, 0xf1, 0x85, 0xae, 0x3d, 0x14, 0x9e, 0xf5, 0xad, 0x92, 0x8d, 0xd1, 0x5d, 0xcf, 0x35, 0xd3, 0x9d, 0xb4, 0xa5, 0xf6,
+  0xb5, 0x4f, 0x54, 0x46, 0x5b, 0x25, 0x58, 0xef, 0x02, 0xdd, 0x05, 0xfa, 0x04, 0xe0, 0x09, 0x98, 0x00, 0x00, 0xac, 0x00, 0x00, 0x32, 0x88, 0x1c, 0xe7, 0x5b, 0x04, 0x43, 0x44, 0x1b, 0xeb, 0x64,
+  0x8b, 0x8c, 0x11, 0x9d, 0x2b, 0x6c, 0x2f, 0x8c, 0x73, 0x94, 0x14, 0xbd, 0xaa, 0xb2, 0x09, 0x73, 0xea, 0x4b, 0xa0, 0x2b, 0xf0, 0x8c, 0xd3, 0x8c, 0x75, 0xa5, 0xf8, 0xb5, 0x38, 0xbe, 0xd3, 0xad,
+  0xce, 0x84, 0x8d, 0x5c, 0x6d, 0x5d, 0x6d, 0x35, 0x0c, 0x2d, 0xcd, 0x54, 0x0f, 0x6d, 0x90, 0x85, 0x8d, 0x45, 0xf3, 0x95, 0x56, 0xbe, 0x14, 0xb6, 0xf0, 0x85, 0xad, 0x05, 0x12, 0x8e, 0x10, 0x7d,
+  0xd2, 0x64, 0xd2, 0x65, 0xee, 0x05, 0x53, 0x8e, 0x75, 0x9e, 0x4f, 0x4c, 0xeb, 0x43, 0xaa, 0x4c, 0xea, 0x32, 0x80, 0x01, 0x2d, 0x02, 0x73, 0x03, 0xce, 0x0a, 0x71, 0x15, 0x97, 0x00, 0x00, 0xa8,
+  0x00, 0x00, 0x36, 0x84, 0x03, 0xa6, 0x13, 0x8c, 0x35, 0x09, 0x25, 0xa9, 0x74, 0xeb, 0x8c, 0x4d, 0x8c, 0xac, 0x7b, 0x50, 0x8c, 0x15, 0xa5, 0xf2, 0x7b, 0xa7, 0x91, 0x86, 0xb1, 0x32, 0xc4, 0x10,
+  0xbc, 0xf0, 0xcb, 0x45, 0xb8, 0x6f, 0xc3, 0x55, 0xcd, 0x13, 0xad, 0x35, 0xa5, 0x32, 0x9d, 0xf1, 0x9d, 0xac, 0x7d, 0x6b, 0x55, 0xab, 0x3c, 0xad, 0x3c, 0x4e, 0x5d, 0xaf, 0x55, 0xd4, 0x9d, 0x56,
+  0xc6, 0x55, 0xbe, 0x11, 0x96, 0x6a, 0x1d, 0x12, 0x8e, 0x4f, 0x75, 0x4a, 0x54, 0x4f, 0x7d, 0xac, 0x05, 0x32, 0x7e, 0x1a, 0xcf, 0x75, 0x9e, 0x0f, 0x4e, 0x0e, 0x26, 0x0e, 0x0e, 0x4c, 0x05, 0x4b,
+  0x03, 0x8a, 0x4c, 0x8c, 0x3d, 0x47, 0x2b, 0x82, 0x13, 0x6a, 0x02, 0x0b, 0x02, 0x94, 0x03, 0xef, 0x14, 0x97, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x2c, 0x44, 0x04, 0xc5, 0x6b, 0xc8, 0x73, 0x27, 0x5b,
+  0x26, 0x33, 0x8c, 0x74, 0x6c, 0x94, 0xad, 0x7b, 0x6d, 0x83, 0xad, 0x9b, 0x55, 0xbd, 0xb7, 0xc5, 0x11, 0xbc, 0x00, 0xb8, 0x00, 0xc0, 0x29, 0xd2, 0x73, 0xc4, 0xb4, 0xbc, 0x36, 0xe5, 0x55, 0xe5,
+  0x11, 0xc5, 0xcb, 0x7c, 0x27, 0x3c, 0x68, 0x4c, 0x8e, 0x5d, 0x90, 0x45, 0x6f, 0x5d, 0x50, 0x75, 0xd2, 0x95, 0xae, 0x7d, 0x4a, 0x45, 0xd3, 0x9d, 0xb2, 0xa5, 0x71, 0x9d, 0xaf, 0x7d, 0x68, 0x1d,
+  0x31, 0x76, 0xb8, 0xae, 0x77, 0xb6, 0xf2, 0x95, 0xcb, 0x1d, 0x0e, 0x36, 0x2f, 0x4e, 0x0d, 0x1e, 0x0e, 0x26, 0x81, 0x0e, 0x2e, 0x09, 0xec, 0x1c, 0x0a, 0x23, 0x4b, 0x4d, 0xed, 0x3d, 0x26, 0x33,
+  0x50, 0x0d, 0x19, 0x06, 0x8d, 0x02, 0xc8, 0x01, 0x05, 0x14, 0x97, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x2b, 0x0a, 0x07, 0xc9, 0x64, 0xec, 0x84, 0x6b, 0x55, 0xe8, 0x64, 0xcc, 0x73, 0x52, 0x94, 0xb8,
+  0xc5, 0x2b, 0xcb, 0x40, 0xda, 0x00, 0xd0, 0x6d, 0xdb, 0xf0, 0xb3, 0xf4, 0xcc, 0x73, 0xe4, 0x77, 0xe5, 0x76, 0xe5, 0x0f, 0xb4, 0xad, 0x9b, 0xeb, 0x9c, 0x86, 0x6d, 0xc5, 0x0d, 0x88, 0x1d, 0xeb,
+  0x4c, 0xee, 0x6c, 0x8f, 0x65, 0xaf, 0x75, 0x35, 0xb6, 0x75, 0xbe, 0x55, 0xbe, 0x8d, 0x6d, 0x47, 0x3d, 0xd1, 0x85, 0x6c, 0x54, 0x6f, 0x74, 0x70, 0x8d, 0x88, 0x35, 0xcb, 0x55, 0x94, 0x9e, 0x0f,
+  0x7e, 0xca, 0x45, 0xed, 0x2d, 0x2e, 0x2e, 0x2d, 0x26, 0x82, 0x2e, 0x2e, 0x0a, 0x0e, 0x2e, 0x4c, 0x14, 0x4a, 0x3b, 0xac, 0x4d, 0x0d, 0x46, 0x68, 0x33, 0xf1, 0x0d, 0xfd, 0x07, 0x38, 0x06, 0x00,
+  0x01, 0xa4, 0x13, 0x97, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x27, 0xff, 0x07, 0x2b, 0x46, 0xc7, 0x7c, 0x85, 0x9b, 0x67, 0x8b, 0xd0, 0x9c, 0x2f, 0x95, 0x85, 0x8c, 0x20, 0x9c, 0x4a, 0x8b, 0x76, 0xc5,
+  0x35, 0xd5, 0x4f, 0xf5, 0xc0, 0xfb, 0x8e, 0xfb, 0x70, 0xcb, 0xb4, 0xb4, 0x15, 0xb5, 0x75, 0xe5, 0x4e, 0xdc, 0x25, 0xdb, 0xa0, 0xaa, 0xa6, 0x5b, 0x89, 0x45, 0xea, 0x4d, 0x8d, 0x7d, 0xd2, 0xa5,
+  0xf4, 0x9d, 0xf3, 0xa5, 0x8a, 0x65, 0x8c, 0x6d, 0x91, 0x95, 0xcc, 0x74, 0x0e, 0x85, 0x8c, 0x6d, 0x65, 0x3d, 0xf0, 0x75, 0x97, 0xb6, 0x54, 0xa6, 0xac, 0x6d, 0x81, 0x88, 0x45, 0x03, 0x65, 0x2d,
+  0x88, 0x2d, 0xec, 0x35, 0x2e, 0x36, 0x83, 0x2e, 0x2e, 0x03, 0x2e, 0x36, 0xee, 0x2d, 0xcc, 0x1b, 0xea, 0x43, 0x81, 0x0d, 0x46, 0x06, 0xea, 0x33, 0xa6, 0x7d, 0xeb, 0xa7, 0xf5, 0x5f, 0x09, 0x04,
+  0x20, 0x0a, 0xff, 0x07, 0x96, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x28, 0xee, 0x07, 0x08, 0x75, 0x25, 0x84, 0x64, 0x73, 0xe4, 0x9a, 0x02, 0xba, 0xa0, 0xa0, 0xea, 0xa1, 0xb0, 0xb3, 0xa6, 0xcb, 0x60,
+  0xe9, 0x40, 0xeb, 0xe0, 0xc8, 0x49, 0xb2, 0x10, 0xc4, 0x97, 0xd5, 0xbb, 0xfe, 0xdc, 0xfe, 0xd5, 0xdc, 0x2c, 0xa3, 0x07, 0x9b, 0xe0, 0xda, 0x40, 0xd2, 0xe4, 0xd2, 0xca, 0x9b, 0x0f, 0x6d, 0x6e,
+  0x9d, 0xe6, 0x5c, 0x51, 0x95, 0xb4, 0xb5, 0x14, 0xbe, 0xd1, 0x9d, 0x88, 0x4d, 0x89, 0x5d, 0xd1, 0x95, 0xcd, 0x6c, 0xb0, 0x94, 0x6c, 0x6d, 0x86, 0x45, 0xa9, 0x5d, 0xcb, 0x6d, 0x81, 0x86, 0x45,
+  0x81, 0x87, 0x45, 0x03, 0xaa, 0x3d, 0x0d, 0x36, 0x0e, 0x36, 0x2e, 0x36, 0x82, 0x2e, 0x2e, 0x81, 0x2e, 0x36, 0x02, 0x90, 0x25, 0x53, 0x1b, 0xaa, 0x4c, 0x81, 0x2d, 0x4e, 0x06, 0xaa, 0x2c, 0xe2,
+  0xb2, 0x00, 0xef, 0xe0, 0xcf, 0x82, 0x75, 0x82, 0x01, 0x66, 0x15, 0x96, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x2a, 0x67, 0xa4, 0xa6, 0xd3, 0x44, 0xdc, 0xa2, 0xaa, 0x22, 0x59, 0x65, 0x40, 0x00, 0x60,
+  0x60, 0xb1, 0x00, 0x99, 0x23, 0xa1, 0x42, 0xb1, 0x00, 0xa8, 0x03, 0xb8, 0xee, 0xea, 0x16, 0xfd, 0x19, 0xee, 0xd6, 0xc4, 0x93, 0xbc, 0xf3, 0xd4, 0xa9, 0xc2, 0x20, 0xe0, 0xa2, 0xa2, 0xc6, 0x8b,
+  0xe8, 0xa3, 0x48, 0xa4, 0x51, 0xbd, 0xb4, 0xbd, 0xd3, 0xbd, 0xaf, 0x9d, 0x00, 0x45, 0xd2, 0x95, 0x70, 0x85, 0xc5, 0x43, 0xad, 0x84, 0xa8, 0x5d, 0x86, 0x45, 0x32, 0x9e, 0x53, 0xae, 0xad, 0x7d,
+  0x67, 0x55, 0x86, 0x4d, 0x65, 0x4d, 0x65, 0x45, 0x81, 0x86, 0x4d, 0x02, 0x88, 0x45, 0xeb, 0x3d, 0x0d, 0x36, 0x82, 0x2e, 0x36, 0x81, 0x2e, 0x2e, 0x81, 0x2e, 0x36, 0x0c, 0x2e, 0x2e, 0x56, 0x15,
+  0x79, 0x2b, 0x4a, 0x55, 0x4e, 0x4e, 0x2d, 0x4e, 0x4c, 0x35, 0x23, 0x91, 0xc0, 0xf2, 0x20, 0xf7, 0x20, 0xc6, 0x01, 0x01, 0x26, 0x04, 0x96, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x28, 0x87, 0x7c, 0x64,
+  0xb2, 0x63, 0xe1, 0xc0, 0xf8, 0x20, 0xf0, 0x03, 0xc0, 0xe4, 0xa8, 0x80, 0xa1, 0x20, 0x8a, 0xa0, 0xa1, 0x00, 0xa0, 0xa8, 0xa9, 0x71, 0xb3, 0x37, 0xdd, 0x9b, 0xf6, 0x19, 0xfe, 0x93, 0xfc, 0xa7,
+  0xaa, 0xa0, 0x9a, 0xa0, 0xab, 0x43, 0x9b, 0xeb, 0xbb, 0x6c, 0xa4, 0x6e, 0x8d, 0x8c, 0x8d, 0x23, 0x65, 0x0e, 0x9d, 0x51, 0xb5, 0x2d, 0xbd, 0x0b, 0x85, 0x41, 0x55, 0x8c, 0x75, 0x15, 0xae, 0x53,
+  0xa5, 0xcf, 0x9c, 0x87, 0x55, 0x86, 0x4d, 0x87, 0x55, 0x85, 0x4d, 0x84, 0x4d, 0x66, 0x55, 0x82, 0x66, 0x4d, 0x03, 0x86, 0x4d, 0xa9, 0x45, 0x0c, 0x3e, 0x2e, 0x36, 0x82, 0x2d, 0x36, 0x00, 0x4e,
+  0x36, 0x81, 0x4e, 0x2e, 0x81, 0x4e, 0x36, 0x0c, 0x2d, 0x36, 0x75, 0x15, 0xb3, 0x43, 0xec, 0x55, 0x4e, 0x4e, 0x4d, 0x4e, 0xcd, 0x45, 0xa5, 0x6a, 0x00, 0xd8, 0x00, 0xfb, 0x40, 0xe4, 0x21, 0x39,
+  0xa4, 0x03, 0x96, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x23, 0x64, 0xbb, 0x89, 0xa3, 0x2b, 0x44, 0x85, 0xa1, 0x83, 0xe0, 0xa1, 0xf0, 0xc0, 0xe0, 0x02, 0xd9, 0x68, 0xc1, 0x6e, 0xaa, 0x32, 0xc3, 0xf3,
+  0xcb, 0x53, 0xbc, 0xae, 0xcb, 0x27, 0xea, 0x00, 0xe0, 0x00, 0xd8, 0xe7, 0xab, 0x89, 0x8c, 0x09, 0x8d, 0x0a, 0x85, 0xb3, 0xb5, 0xd2, 0xb5, 0xf2, 0xbd, 0x8b, 0x8d, 0x40, 0x65, 0x4c, 0x95, 0xe8,
+  0x63, 0xc4, 0x4a, 0x08, 0x84, 0x84, 0x5d, 0x66, 0x65, 0x12, 0x9e, 0xce, 0x85, 0x67, 0x5d, 0x86, 0x4d, 0x83, 0x86, 0x55, 0x81, 0x66, 0x55, 0x81, 0x66, 0x4d, 0x02, 0xca, 0x3d, 0x0d, 0x3e, 0x2e,
+  0x3e, 0x81, 0x2d, 0x3e, 0x82, 0x2d, 0x36, 0x83, 0x4e, 0x36, 0x02, 0x2d, 0x36, 0x2e, 0x25, 0x4b, 0x4c, 0x82, 0x4e, 0x4e, 0x02, 0x0e, 0x4e, 0x67, 0x4b, 0x00, 0xb0, 0x81, 0x00, 0xd8, 0x01, 0xc0,
+  0x51, 0x84, 0x03, 0x96, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x23, 0xc4, 0x92, 0x44, 0xba, 0x8b, 0x44, 0x89, 0x03, 0x65, 0xd1, 0xc0, 0xf9, 0x00, 0xc0, 0x0d, 0xc2, 0xb1, 0xca, 0xaf, 0xc2, 0x0a, 0xc2,
+  0xa0, 0xc1, 0xc0, 0x99, 0x40, 0xb1, 0x60, 0xda, 0xa7, 0xbb, 0xac, 0xac, 0x0b, 0xad, 0xab, 0xbd, 0x48, 0x85, 0xc6, 0x7c, 0xee, 0x9c, 0x0e, 0x9d, 0x2b, 0x94, 0x06, 0x85, 0x60, 0x6d, 0xac, 0x95,
+  0x11, 0xb5, 0xac, 0xa4, 0xe7, 0x9c, 0xa0, 0x6d, 0x63, 0x55, 0x61, 0x4d, 0x63, 0x4d, 0x65, 0x55, 0x66, 0x55, 0x82, 0x86, 0x55, 0x00, 0x66, 0x55, 0x81, 0x65, 0x4d, 0x01, 0x87, 0x4d, 0xec, 0x3d,
+  0x83, 0x2e, 0x3e, 0x83, 0x2d, 0x36, 0x83, 0x4e, 0x36, 0x0c, 0xcd, 0x2d, 0x2e, 0x1c, 0x0b, 0x4d, 0x2e, 0x56, 0xec, 0x55, 0x4e, 0x4e, 0x2e, 0x4e, 0x08, 0x44, 0x00, 0x78, 0x40, 0xa8, 0x80, 0xb8,
+  0x40, 0x52, 0xe3, 0x03, 0x96, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x20, 0x10, 0x06, 0x25, 0x7a, 0xe1, 0x82, 0xe6, 0x6b, 0x85, 0x5b, 0x22, 0xe9, 0x00, 0xd0, 0x02, 0x98, 0x05, 0xea, 0xc0, 0xf1, 0x00,
+  0xa8, 0x08, 0xb0, 0x52, 0xc9, 0x0d, 0xa1, 0xa0, 0x82, 0x00, 0x7d, 0x0c, 0x8c, 0x52, 0xcd, 0xae, 0xc5, 0x4c, 0xb5, 0x03, 0x75, 0x06, 0x7d, 0x50, 0xad, 0x4a, 0x6b, 0xab, 0x82, 0x87, 0x84, 0xa0,
+  0x7d, 0xa6, 0x8d, 0xaa, 0xa5, 0xa1, 0x95, 0xa1, 0x8d, 0x81, 0x75, 0x64, 0x55, 0x81, 0x65, 0x55, 0x02, 0x66, 0x55, 0x65, 0x55, 0x66, 0x55, 0x82, 0x65, 0x55, 0x03, 0x65, 0x4d, 0xa9, 0x4d, 0x2d,
+  0x3e, 0x2e, 0x3e, 0x81, 0x2d, 0x3e, 0x81, 0x2e, 0x3e, 0x82, 0x2d, 0x36, 0x84, 0x4e, 0x36, 0x0d, 0x4f, 0x1d, 0x10, 0x2c, 0xac, 0x4d, 0xac, 0x65, 0x4a, 0x65, 0x2e, 0x4e, 0x4e, 0x4e, 0xaa, 0x44,
+  0x81, 0x60, 0x00, 0x80, 0xe0, 0x80, 0x00, 0x33, 0x22, 0x04, 0xe7, 0x2c, 0x95, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x19, 0xa9, 0x3c, 0x83, 0x39, 0x60, 0x23, 0x43, 0x3d, 0x67, 0x9b, 0x83, 0xca, 0xa2,
+  0x91, 0x09, 0x6a, 0xe8, 0xd1, 0x92, 0xf1, 0x39, 0xc1, 0x3e, 0xb1, 0xff, 0xa8, 0x0d, 0x70, 0x60, 0x6b, 0x81, 0x85, 0x4a, 0x94, 0x2b, 0x94, 0x0a, 0x7c, 0x48, 0xb3, 0xc0, 0x8c, 0x20, 0x75, 0xb2,
+  0xb5, 0x13, 0xcd, 0xcd, 0xb4, 0x43, 0x85, 0x82, 0xa0, 0x8d, 0x81, 0xa0, 0x95, 0x01, 0x82, 0x6d, 0x64, 0x55, 0x86, 0x65, 0x55, 0x03, 0x66, 0x4d, 0xeb, 0x45, 0x4e, 0x3e, 0x2e, 0x3e, 0x82, 0x2d,
+  0x3e, 0x01, 0x2e, 0x3e, 0x2d, 0x3e, 0x81, 0x2d, 0x36, 0x00, 0x4d, 0x36, 0x81, 0x4e, 0x36, 0x81, 0x2e, 0x36, 0x0e, 0x2d, 0x36, 0xb0, 0x0c, 0x0d, 0x3c, 0x0d, 0x4e, 0xed, 0x5d, 0x09, 0x6d, 0x2d,
+  0x56, 0x4e, 0x4e, 0x2b, 0x4d, 0xa6, 0x51, 0x01, 0x70, 0xa0, 0x59, 0x20, 0x03, 0x22, 0x04, 0x86, 0x15, 0x95, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x17, 0x77, 0x2c, 0xb2, 0x49, 0xa9, 0x18, 0x47, 0x64,
+  0x72, 0x7c, 0x46, 0xb4, 0x20, 0xd4, 0xa0, 0xb2, 0x40, 0xa0, 0x57, 0xb1, 0xbf, 0xb9, 0x9f, 0xa9, 0x19, 0x99, 0x00, 0x70, 0x20, 0x74, 0xa0, 0x85, 0xc7, 0x8c, 0x0d, 0x84, 0x6a, 0x7b, 0x0b, 0xbb,
+  0xa5, 0x9c, 0x60, 0x7d, 0x85, 0x8d, 0x84, 0x8d, 0x82, 0x80, 0x8d, 0x81, 0x80, 0x95, 0x03, 0xa0, 0x95, 0x80, 0x8d, 0x63, 0x5d, 0x64, 0x55, 0x85, 0x65, 0x55, 0x01, 0x88, 0x4d, 0x0c, 0x46, 0x81,
+  0x4e, 0x46, 0x00, 0x4d, 0x3e, 0x81, 0x2d, 0x3e, 0x00, 0x4d, 0x3e, 0x81, 0x4e, 0x3e, 0x01, 0x4d, 0x3e, 0x4d, 0x36, 0x81, 0x4e, 0x36, 0x08, 0x2e, 0x36, 0x6b, 0x2d, 0xcd, 0x35, 0xee, 0x35, 0x2a,
+  0x14, 0x89, 0x44, 0x4e, 0x4e, 0x2e, 0x56, 0x0d, 0x56, 0x81, 0x2d, 0x4e, 0x06, 0xac, 0x4d, 0xaa, 0x3a, 0x04, 0x60, 0x40, 0x4a, 0x80, 0x03, 0x21, 0x03, 0x05, 0x15, 0x95, 0x00, 0x00, 0x9a, 0x00,
+  0x00, 0x14, 0xd0, 0x83, 0x34, 0x71, 0x2f, 0x90, 0x65, 0xd1, 0x04, 0xcc, 0x0b, 0xac, 0x49, 0xc4, 0x73, 0x7b, 0x4e, 0x71, 0x0c, 0x50, 0xf6, 0x90, 0x9e, 0xb1, 0x90, 0x80, 0x00, 0x68, 0xc0, 0x84,
+  0xa0, 0x8d, 0x48, 0x95, 0x74, 0xc5, 0x2f, 0xcd, 0x29, 0xb5, 0x42, 0x95, 0x83, 0x60, 0x8d, 0x83, 0x80, 0x95, 0x05, 0xa0, 0x95, 0x80, 0x85, 0x64, 0x5d, 0x44, 0x55, 0x64, 0x55, 0x65, 0x55, 0x81,
+  0x45, 0x55, 0x05, 0x65, 0x55, 0xca, 0x4d, 0x4d, 0x46, 0x4e, 0x46, 0x4d, 0x46, 0x4e, 0x46, 0x83, 0x4d, 0x3e, 0x02, 0x4e, 0x3e, 0x2e, 0x3e, 0x4d, 0x3e, 0x81, 0x4e, 0x3e, 0x08, 0x6e, 0x3e, 0x4e,
+  0x36, 0xad, 0x35, 0xcd, 0x35, 0xad, 0x2d, 0xe8, 0x2b, 0x2a, 0x45, 0x4e, 0x4e, 0x2d, 0x4e, 0x81, 0x0d, 0x4e, 0x07, 0x2d, 0x56, 0xec, 0x55, 0x89, 0x33, 0x65, 0x50, 0xe0, 0x32, 0xe1, 0x03, 0x41,
+  0x02, 0xa5, 0x0b, 0x95, 0x00, 0x00, 0x99, 0x00, 0x00, 0x15, 0xf3, 0x07, 0xc8, 0xc3, 0x20, 0xd1, 0x22, 0xea, 0x80, 0xd1, 0xc0, 0xaa, 0xaa, 0x83, 0x0f, 0xc4, 0xb7, 0x8b, 0xf0, 0x89, 0x07, 0x68,
+  0x08, 0x88, 0xae, 0xa8, 0x05, 0x78, 0x20, 0x69, 0x20, 0x8d, 0xa0, 0x8d, 0x81, 0x95, 0x85, 0x95, 0x60, 0x95, 0x60, 0x8d, 0x60, 0x95, 0x83, 0x60, 0x8d, 0x84, 0x80, 0x95, 0x01, 0x61, 0x75, 0x64,
+  0x5d, 0x81, 0x44, 0x5d, 0x81, 0x44, 0x55, 0x01, 0x86, 0x55, 0x0b, 0x46, 0x81, 0x6e, 0x46, 0x03, 0x6d, 0x46, 0x4d, 0x46, 0x4e, 0x46, 0x4d, 0x46, 0x81, 0x4d, 0x3e, 0x03, 0x6e, 0x3e, 0xed, 0x3d,
+  0x2b, 0x2d, 0x0d, 0x36, 0x82, 0x6e, 0x3e, 0x05, 0x4e, 0x3e, 0x0e, 0x36, 0x2f, 0x3e, 0x4c, 0x2d, 0x08, 0x3c, 0x6b, 0x45, 0x81, 0x2d, 0x4e, 0x82, 0x4d, 0x56, 0x06, 0x0c, 0x56, 0x28, 0x3c, 0xa4,
+  0x39, 0x60, 0x23, 0x22, 0x04, 0x40, 0x02, 0x64, 0x0b, 0x95, 0x00, 0x00, 0x99, 0x00, 0x00, 0x0f, 0xcd, 0x06, 0xc5, 0xab, 0x02, 0xc1, 0x85, 0xd9, 0x45, 0xc1, 0x85, 0x93, 0x65, 0x8c, 0xaa, 0xe9,
+  0xaa, 0xd1, 0x00, 0x90, 0x01, 0x68, 0x12, 0x98, 0x2e, 0xa0, 0x00, 0x70, 0x80, 0x62, 0x60, 0x8d, 0x82, 0x80, 0x95, 0x83, 0x60, 0x95, 0x81, 0x60, 0x8d, 0x84, 0x80, 0x95, 0x02, 0x80, 0x8d, 0x62,
+  0x65, 0x43, 0x5d, 0x81, 0x44, 0x5d, 0x02, 0x44, 0x55, 0xa8, 0x4d, 0x2d, 0x46, 0x82, 0x6e, 0x46, 0x02, 0x4e, 0x46, 0x6e, 0x46, 0x6d, 0x46, 0x81, 0x4d, 0x46, 0x04, 0x4d, 0x3e, 0x6e, 0x46, 0xcd,
+  0x3d, 0xaa, 0x24, 0xad, 0x35, 0x82, 0x6e, 0x3e, 0x81, 0x4e, 0x3e, 0x10, 0xee, 0x35, 0xcb, 0x34, 0x49, 0x44, 0xcc, 0x4d, 0x4d, 0x56, 0x6d, 0x56, 0x4d, 0x56, 0x2c, 0x5e, 0x4d, 0x56, 0x2d, 0x5e,
+  0x88, 0x4c, 0x65, 0x22, 0xa3, 0x03, 0x23, 0x04, 0x80, 0x02, 0xe4, 0x0a, 0x49, 0x16, 0x94, 0x00, 0x00, 0x99, 0x00, 0x00, 0x10, 0x62, 0x05, 0x00, 0x55, 0x86, 0x92, 0x0e, 0x80, 0x13, 0x99, 0x28,
+  0x84, 0xe6, 0x5c, 0x60, 0xd1, 0x00, 0xc8, 0xe0, 0xd0, 0x00, 0xb1, 0x48, 0x88, 0x0a, 0xa1, 0x80, 0x63, 0x42, 0x45, 0xc1, 0x6d, 0x80, 0x85, 0x82, 0x80, 0x95, 0x84, 0x60, 0x95, 0x84, 0x80, 0x95,
+  0x00, 0x60, 0x7d, 0x81, 0x43, 0x5d, 0x02, 0x42, 0x5d, 0x64, 0x55, 0xea, 0x4d, 0x84, 0x6e, 0x46, 0x03, 0x4e, 0x46, 0xed, 0x3d, 0xed, 0x45, 0x4e, 0x46, 0x81, 0x4d, 0x46, 0x03, 0x4e, 0x46, 0x2e,
+  0x3e, 0x4c, 0x35, 0xed, 0x3d, 0x81, 0x6e, 0x3e, 0x13, 0x4e, 0x3e, 0x2d, 0x36, 0x2e, 0x36, 0xcd, 0x2d, 0x8c, 0x3c, 0xea, 0x44, 0x2c, 0x4e, 0x4d, 0x56, 0x6d, 0x56, 0xcb, 0x65, 0xa7, 0x74, 0x0c,
+  0x5e, 0x4d, 0x5e, 0x0a, 0x4d, 0xc8, 0x1a, 0x27, 0x03, 0x04, 0x04, 0x01, 0x03, 0x82, 0x0a, 0x68, 0x15, 0x94, 0x00, 0x00, 0x99, 0x00, 0x00, 0x13, 0xc2, 0x0c, 0xc0, 0x24, 0x06, 0x84, 0xca, 0xa9,
+  0x8a, 0xcc, 0xc4, 0x5c, 0xc7, 0x44, 0x63, 0xba, 0x67, 0xc9, 0x64, 0xc9, 0xe0, 0xc0, 0x00, 0xd0, 0x20, 0xaa, 0x62, 0x2d, 0xe3, 0x45, 0xe3, 0x55, 0x80, 0x5d, 0x60, 0x75, 0x80, 0x8d, 0x80, 0x95,
+  0x85, 0x60, 0x95, 0x82, 0x80, 0x95, 0x07, 0x80, 0x8d, 0x61, 0x6d, 0x43, 0x5d, 0x42, 0x5d, 0x86, 0x55, 0x2c, 0x4e, 0x6f, 0x46, 0x8f, 0x46, 0x81, 0x6e, 0x46, 0x04, 0x6d, 0x46, 0x6e, 0x46, 0x4e,
+  0x46, 0xad, 0x3d, 0xad, 0x45, 0x81, 0x4e, 0x46, 0x00, 0x4d, 0x46, 0x81, 0x4e, 0x46, 0x81, 0x4e, 0x3e, 0x81, 0x2e, 0x3e, 0x13, 0x4e, 0x3e, 0x6e, 0x3e, 0x4e, 0x36, 0xac, 0x35, 0x4b, 0x4c, 0x4b,
+  0x45, 0x4c, 0x56, 0x4d, 0x56, 0x6d, 0x56, 0x0c, 0x66, 0xc9, 0x74, 0xec, 0x65, 0x6d, 0x5e, 0x6b, 0x55, 0xe8, 0x2a, 0xca, 0x02, 0x67, 0x03, 0x00, 0x03, 0xc8, 0x19, 0x29, 0x24, 0x94, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x14, 0x2b, 0x0e, 0x68, 0x05, 0x2c, 0x3d, 0x8c, 0xd5, 0x20, 0xcd, 0xe5, 0x2c, 0x88, 0x54, 0xe6, 0xb2, 0x26, 0xd1, 0x44, 0xd9, 0x68, 0xe0, 0x05, 0xd8, 0xe0, 0x48, 0x02, 0x2d,
+  0x04, 0x4e, 0x24, 0x56, 0xc1, 0x55, 0x60, 0x55, 0x80, 0x65, 0x80, 0x75, 0x60, 0x8d, 0x85, 0x60, 0x95, 0x81, 0x80, 0x95, 0x04, 0x60, 0x8d, 0x41, 0x65, 0x42, 0x5d, 0xc9, 0x55, 0x4e, 0x4e, 0x81,
+  0x6f, 0x46, 0x81, 0x4e, 0x46, 0x81, 0x6e, 0x46, 0x04, 0x4e, 0x46, 0x6e, 0x46, 0xee, 0x45, 0x8d, 0x3d, 0x2e, 0x46, 0x81, 0x4e, 0x46, 0x00, 0x2e, 0x3e, 0x81, 0x2d, 0x3e, 0x00, 0x2e, 0x3e, 0x81,
+  0x6e, 0x3e, 0x13, 0x6e, 0x46, 0x6e, 0x3e, 0x4d, 0x36, 0x0b, 0x2d, 0x4a, 0x54, 0xcb, 0x4d, 0x6c, 0x56, 0x4c, 0x5e, 0x4d, 0x5e, 0x0c, 0x5e, 0x66, 0x7c, 0x8a, 0x6d, 0x6d, 0x56, 0xcb, 0x55, 0x48,
+  0x33, 0xeb, 0x0a, 0xb0, 0x02, 0x50, 0x02, 0x2e, 0x19, 0x89, 0x23, 0x94, 0x00, 0x00, 0x98, 0x00, 0x00, 0x0e, 0xa0, 0x5a, 0x84, 0x25, 0x12, 0x07, 0xf8, 0x06, 0x35, 0x8d, 0x60, 0x94, 0x25, 0x3d,
+  0xe9, 0x6b, 0x28, 0x93, 0x20, 0xc1, 0x6a, 0xc8, 0x76, 0xa8, 0x28, 0x78, 0x00, 0x00, 0x82, 0x3c, 0x81, 0x24, 0x56, 0x01, 0x03, 0x56, 0xa1, 0x5d, 0x81, 0x80, 0x5d, 0x04, 0x80, 0x65, 0x80, 0x7d,
+  0x60, 0x95, 0x60, 0x9d, 0x80, 0x95, 0x81, 0x60, 0x95, 0x81, 0x80, 0x95, 0x03, 0x60, 0x85, 0x64, 0x5d, 0xea, 0x4d, 0x6e, 0x4e, 0x81, 0x6f, 0x4e, 0x02, 0x4e, 0x46, 0x4d, 0x45, 0x2e, 0x4e, 0x81,
+  0x6e, 0x46, 0x02, 0x4e, 0x46, 0x6e, 0x46, 0x2e, 0x46, 0x81, 0x4e, 0x46, 0x04, 0x2e, 0x3e, 0x0d, 0x3e, 0x2d, 0x3e, 0x4e, 0x3e, 0x6e, 0x46, 0x82, 0x6e, 0x3e, 0x13, 0x4e, 0x3e, 0x6e, 0x3e, 0x0d,
+  0x36, 0x48, 0x34, 0x68, 0x44, 0x2c, 0x56, 0x6c, 0x56, 0x4d, 0x56, 0x4d, 0x5e, 0x2d, 0x5e, 0x8a, 0x6d, 0x0b, 0x66, 0x4d, 0x5e, 0x0c, 0x5e, 0xa8, 0x43, 0x8e, 0x12, 0x3a, 0x02, 0xdd, 0x01, 0xef,
+  0x08, 0x20, 0x0b, 0x94, 0x00, 0x00, 0x98, 0x00, 0x00, 0x0f, 0xad, 0x05, 0xd1, 0x06, 0x2f, 0x6e, 0x6e, 0x84, 0xb3, 0x4a, 0x67, 0x64, 0x26, 0x4d, 0xac, 0x6b, 0x4b, 0x8b, 0x20, 0xa9, 0x6d, 0xd0,
+  0x4f, 0x78, 0x00, 0x28, 0x20, 0x68, 0x41, 0xb4, 0x24, 0x4e, 0x81, 0x04, 0x56, 0x00, 0xe3, 0x55, 0x81, 0x80, 0x5d, 0x04, 0x60, 0x5d, 0x80, 0x5d, 0x60, 0x75, 0x60, 0x8d, 0x60, 0x95, 0x82, 0x80,
+  0x95, 0x04, 0x60, 0x95, 0x85, 0x6d, 0x2c, 0x4e, 0x8e, 0x46, 0x6e, 0x46, 0x81, 0x6e, 0x4e, 0x00, 0x6f, 0x46, 0x81, 0xad, 0x45, 0x82, 0x6e, 0x46, 0x81, 0x4e, 0x46, 0x82, 0x2e, 0x46, 0x01, 0x4e,
+  0x3e, 0x6e, 0x3e, 0x81, 0x6d, 0x3e, 0x82, 0x6e, 0x3e, 0x81, 0x4e, 0x3e, 0x02, 0xcc, 0x3d, 0xea, 0x44, 0x88, 0x3c, 0x81, 0x6c, 0x56, 0x03, 0x4c, 0x66, 0x4d, 0x66, 0x4c, 0x5e, 0x4d, 0x66, 0x81,
+  0x4c, 0x5e, 0x07, 0x2c, 0x5e, 0x68, 0x4c, 0xd6, 0x19, 0x7e, 0x01, 0xbf, 0x01, 0x90, 0x40, 0xe0, 0x4a, 0xab, 0x06, 0x93, 0x00, 0x00, 0x98, 0x00, 0x00, 0x10, 0xd4, 0x66, 0x93, 0x86, 0xc8, 0xc4,
+  0x20, 0xb4, 0xa9, 0x7c, 0xa5, 0x34, 0xe7, 0x4c, 0x6d, 0x63, 0xae, 0x6b, 0x27, 0x6a, 0x09, 0xd8, 0x41, 0xd8, 0x40, 0x60, 0x60, 0xdb, 0x40, 0xf4, 0x04, 0x5e, 0x24, 0x4e, 0x81, 0x04, 0x56, 0x07,
+  0xe3, 0x55, 0x80, 0x5d, 0x60, 0x5d, 0x60, 0x65, 0x60, 0x5d, 0x80, 0x65, 0x80, 0x75, 0x80, 0x8d, 0x81, 0x80, 0x95, 0x03, 0xc7, 0x7d, 0x2d, 0x4e, 0x2e, 0x46, 0x0d, 0x46, 0x83, 0x6e, 0x46, 0x06,
+  0x2e, 0x46, 0x6f, 0x46, 0x6e, 0x46, 0x4e, 0x46, 0x2d, 0x46, 0x0d, 0x46, 0x2d, 0x46, 0x82, 0x4e, 0x46, 0x01, 0x4d, 0x3e, 0x4e, 0x3e, 0x81, 0x4d, 0x3e, 0x82, 0x6e, 0x3e, 0x06, 0x4e, 0x3e, 0x0d,
+  0x3e, 0x8c, 0x3d, 0x2b, 0x45, 0xc8, 0x44, 0x4c, 0x56, 0x6c, 0x56, 0x81, 0x2c, 0x86, 0x81, 0x4c, 0x5e, 0x00, 0x2c, 0x66, 0x81, 0x2c, 0x5e, 0x06, 0xe9, 0x4c, 0x90, 0x39, 0x79, 0x10, 0x1c, 0x01,
+  0x0a, 0x50, 0x62, 0x4b, 0x2a, 0x06, 0x93, 0x00, 0x00, 0x98, 0x00, 0x00, 0x11, 0x2e, 0xad, 0xc9, 0xc4, 0x20, 0xa5, 0x00, 0xb6, 0x60, 0x8d, 0x02, 0x35, 0x44, 0x5c, 0xc8, 0x72, 0x6b, 0x73, 0x49,
+  0x73, 0x00, 0xa0, 0x00, 0xe0, 0xa0, 0xda, 0xa0, 0xfc, 0x40, 0xfc, 0xa3, 0x8d, 0x24, 0x46, 0x05, 0x56, 0x81, 0x04, 0x56, 0x00, 0xc2, 0x5d, 0x82, 0x60, 0x65, 0x08, 0x80, 0x65, 0x80, 0x5d, 0x80,
+  0x6d, 0x80, 0x85, 0x09, 0x76, 0x6e, 0x56, 0x2d, 0x46, 0xac, 0x45, 0x2d, 0x46, 0x83, 0x6e, 0x46, 0x03, 0x6f, 0x46, 0x4e, 0x46, 0x2d, 0x46, 0x2e, 0x46, 0x84, 0x4e, 0x46, 0x01, 0x6e, 0x3e, 0x4d,
+  0x3e, 0x86, 0x6e, 0x3e, 0x03, 0xec, 0x3d, 0x8c, 0x3d, 0x4b, 0x45, 0xcb, 0x55, 0x81, 0x4c, 0x5e, 0x04, 0x4c, 0x7e, 0x2b, 0x96, 0x2c, 0x56, 0x2c, 0x5e, 0x2c, 0x6e, 0x81, 0x2c, 0x66, 0x06, 0x6a,
+  0x55, 0x09, 0x4a, 0x11, 0x40, 0x33, 0x28, 0x82, 0x48, 0xc5, 0x23, 0x89, 0x05, 0x93, 0x00, 0x00, 0x98, 0x00, 0x00, 0x06, 0x64, 0x8a, 0x00, 0xd8, 0x40, 0xb3, 0xe0, 0xc5, 0x21, 0xb6, 0xa2, 0x44,
+  0x61, 0x73, 0x81, 0x82, 0x7a, 0x07, 0x68, 0x6b, 0xa2, 0x89, 0x00, 0xe2, 0x20, 0xfa, 0x60, 0xf3, 0xa0, 0xfb, 0xa1, 0x9c, 0x24, 0x46, 0x82, 0x05, 0x56, 0x01, 0x04, 0x56, 0x81, 0x5d, 0x81, 0x60,
+  0x65, 0x07, 0x41, 0x5d, 0x04, 0x55, 0xa5, 0x55, 0xe8, 0x4d, 0x2b, 0x46, 0x4d, 0x4e, 0x6d, 0x4e, 0x6e, 0x4e, 0x81, 0x6e, 0x46, 0x81, 0x4d, 0x46, 0x02, 0x2e, 0x46, 0x4e, 0x46, 0x6e, 0x46, 0x81,
+  0x4e, 0x46, 0x81, 0x6e, 0x46, 0x81, 0x4e, 0x46, 0x02, 0x6e, 0x46, 0x6e, 0x3e, 0x4d, 0x3e, 0x85, 0x6e, 0x3e, 0x09, 0x4d, 0x36, 0xab, 0x45, 0x8b, 0x3d, 0x6a, 0x4d, 0x2b, 0x56, 0x6c, 0x5e, 0x4c,
+  0x5e, 0x2c, 0x66, 0x2c, 0x7e, 0x2c, 0x66, 0x81, 0x4c, 0x66, 0x81, 0x2c, 0x66, 0x06, 0xcb, 0x65, 0xcc, 0x4a, 0x0a, 0x60, 0x06, 0x70, 0xe5, 0x49, 0xa5, 0x03, 0xe8, 0x04, 0x93, 0x00, 0x00, 0x97,
+  0x00, 0x00, 0x13, 0x0a, 0x05, 0xe2, 0x01, 0x07, 0xb8, 0x09, 0xc0, 0x03, 0x88, 0x89, 0x83, 0x61, 0x64, 0x00, 0x73, 0xa0, 0x72, 0x40, 0x72, 0x48, 0x63, 0x04, 0xca, 0xe0, 0xf9, 0x80, 0xf1, 0x00,
+  0xd0, 0x02, 0xd8, 0xc6, 0xb3, 0x24, 0x4e, 0x05, 0x56, 0x25, 0x56, 0x81, 0x05, 0x56, 0x09, 0xe3, 0x5d, 0x80, 0x65, 0xa4, 0x5d, 0x47, 0x45, 0xa7, 0x44, 0xca, 0x45, 0x2b, 0x3e, 0x0a, 0x3e, 0x0b,
+  0x3e, 0x2c, 0x46, 0x81, 0x4d, 0x46, 0x01, 0x2d, 0x46, 0x2e, 0x46, 0x81, 0x6e, 0x46, 0x01, 0x8e, 0x46, 0x6e, 0x46, 0x81, 0x4e, 0x46, 0x84, 0x6e, 0x46, 0x01, 0x6e, 0x3e, 0x4e, 0x3e, 0x84, 0x6e,
+  0x3e, 0x08, 0x8e, 0x3e, 0x0d, 0x36, 0x8a, 0x45, 0x8b, 0x3d, 0x89, 0x4d, 0x4b, 0x4e, 0x4b, 0x56, 0x2b, 0x5e, 0x4b, 0x5e, 0x81, 0x4c, 0x6e, 0x0a, 0x4c, 0x66, 0xcb, 0x75, 0xa6, 0x8c, 0xeb, 0x6d,
+  0x0c, 0x66, 0x8e, 0x4b, 0x0e, 0x68, 0x00, 0x78, 0x04, 0x53, 0x84, 0x03, 0x87, 0x04, 0x93, 0x00, 0x00, 0x97, 0x00, 0x00, 0x12, 0xc7, 0x23, 0x60, 0x01, 0x0c, 0x70, 0x17, 0xc8, 0x16, 0x99, 0x8c,
+  0x9b, 0x00, 0x6c, 0x40, 0x63, 0x00, 0x63, 0xa0, 0x6a, 0x48, 0x63, 0xa7, 0xaa, 0xa0, 0xf9, 0x83, 0xf0, 0x05, 0xd8, 0x09, 0xc0, 0xae, 0xb2, 0x04, 0x5e, 0x24, 0x56, 0x82, 0x05, 0x5e, 0x06, 0x26,
+  0x56, 0x08, 0x4e, 0xe9, 0x3d, 0xea, 0x45, 0x08, 0x4d, 0xea, 0x3d, 0x4b, 0x3e, 0x81, 0x0b, 0x3e, 0x05, 0xeb, 0x3d, 0x0c, 0x46, 0x4e, 0x46, 0x6f, 0x46, 0x8f, 0x46, 0x8e, 0x46, 0x81, 0x6d, 0x46,
+  0x81, 0x6e, 0x46, 0x00, 0x4e, 0x46, 0x82, 0x6e, 0x46, 0x01, 0x6e, 0x3e, 0x8e, 0x3e, 0x81, 0x6e, 0x3e, 0x00, 0x4e, 0x3e, 0x84, 0x6e, 0x3e, 0x04, 0xec, 0x35, 0x8a, 0x4d, 0x6a, 0x45, 0xc9, 0x4d,
+  0x4b, 0x5e, 0x82, 0x6b, 0x5e, 0x0d, 0x4b, 0x8e, 0x4c, 0x76, 0x49, 0x7d, 0x29, 0x85, 0xe8, 0x84, 0xaa, 0x75, 0x2d, 0x6e, 0x4c, 0x54, 0xed, 0x60, 0xe0, 0x78, 0x47, 0x3c, 0x06, 0x04, 0x05, 0x04,
+  0xee, 0x07, 0x92, 0x00, 0x00, 0x97, 0x00, 0x00, 0x17, 0xa7, 0x1b, 0x05, 0x01, 0x0d, 0x10, 0x18, 0xb0, 0x7a, 0xc1, 0x89, 0x9c, 0x40, 0x84, 0x20, 0x5b, 0x40, 0x63, 0x00, 0x63, 0x45, 0x6b, 0x6a,
+  0x73, 0x4e, 0xbc, 0xb5, 0xd4, 0x0a, 0xf8, 0x03, 0xe8, 0x21, 0xc1, 0x84, 0x6d, 0x25, 0x56, 0x05, 0x5e, 0x05, 0x56, 0x07, 0x4e, 0x2a, 0x3e, 0x4c, 0x36, 0x81, 0x2b, 0x3e, 0x01, 0x2b, 0x46, 0x4b,
+  0x3e, 0x82, 0x0b, 0x3e, 0x04, 0x2c, 0x3e, 0x0b, 0x3e, 0x4d, 0x3e, 0x6e, 0x46, 0x8e, 0x46, 0x83, 0x6e, 0x46, 0x01, 0x6f, 0x46, 0x4e, 0x46, 0x82, 0x6e, 0x46, 0x01, 0x6e, 0x3e, 0x8e, 0x3e, 0x81,
+  0x6e, 0x3e, 0x00, 0x4d, 0x3e, 0x81, 0x6d, 0x3e, 0x81, 0x8e, 0x3e, 0x16, 0x4d, 0x3e, 0xcb, 0x35, 0xcb, 0x4d, 0x6a, 0x55, 0x2b, 0x56, 0x6b, 0x5e, 0x4b, 0x5e, 0x2b, 0x5e, 0x6b, 0x5e, 0x4c, 0x7e,
+  0x4d, 0x7e, 0xaa, 0x7d, 0x49, 0x85, 0x08, 0x85, 0xaa, 0x7d, 0x4d, 0x6e, 0x0a, 0x5d, 0xe5, 0x71, 0x41, 0x72, 0xe8, 0x14, 0xa7, 0x04, 0x02, 0x0c, 0x87, 0x1d, 0x92, 0x00, 0x00, 0x97, 0x00, 0x00,
+  0x08, 0xc4, 0x0a, 0x66, 0x01, 0x0a, 0x00, 0xca, 0x82, 0x6a, 0x8b, 0x24, 0x75, 0x41, 0x84, 0x00, 0x5b, 0x60, 0x63, 0x81, 0x40, 0x63, 0x09, 0xd0, 0x5b, 0xb1, 0x64, 0x8c, 0x74, 0x00, 0xc8, 0x00,
+  0xf8, 0x00, 0xc8, 0x04, 0x5d, 0x45, 0x5e, 0x26, 0x56, 0x29, 0x46, 0x81, 0x4b, 0x36, 0x01, 0x2b, 0x36, 0x2b, 0x3e, 0x82, 0x0b, 0x3e, 0x00, 0x2b, 0x3e, 0x82, 0x4b, 0x3e, 0x81, 0x2b, 0x3e, 0x01,
+  0x4c, 0x3e, 0x6d, 0x3e, 0x84, 0x6e, 0x46, 0x00, 0x4e, 0x46, 0x85, 0x6e, 0x46, 0x02, 0x6e, 0x3e, 0x4d, 0x3e, 0x6e, 0x3e, 0x81, 0x6d, 0x3e, 0x17, 0x6e, 0x3e, 0xec, 0x3d, 0xeb, 0x35, 0xeb, 0x3d,
+  0x89, 0x55, 0x4b, 0x56, 0xea, 0x55, 0x69, 0x4d, 0xa7, 0x3c, 0x2b, 0x5e, 0x6c, 0x6e, 0x4c, 0x6e, 0x2b, 0x6e, 0x08, 0x8d, 0xc7, 0x94, 0x89, 0x85, 0x6c, 0x6e, 0x8a, 0x5d, 0xa7, 0x62, 0x63, 0x6b,
+  0xc6, 0x04, 0x6e, 0x05, 0xb7, 0x06, 0xd7, 0x0e, 0x92, 0x00, 0x00, 0x96, 0x00, 0x00, 0x08, 0xe0, 0x07, 0x41, 0x02, 0x60, 0x01, 0x60, 0x02, 0x80, 0x5c, 0xe0, 0x6c, 0x22, 0x4d, 0xe1, 0x63, 0x20,
+  0x63, 0x82, 0x40, 0x63, 0x08, 0x60, 0x7b, 0x91, 0x64, 0x4f, 0x3c, 0x20, 0x09, 0x01, 0x81, 0x02, 0x88, 0x23, 0x5c, 0x47, 0x46, 0x4b, 0x3e, 0x81, 0x4c, 0x36, 0x81, 0x4b, 0x36, 0x01, 0x2b, 0x36,
+  0x2b, 0x3e, 0x85, 0x4b, 0x3e, 0x81, 0x2b, 0x3e, 0x04, 0x2c, 0x3e, 0x2b, 0x36, 0x4c, 0x3e, 0x6e, 0x46, 0x8f, 0x46, 0x81, 0x8e, 0x46, 0x00, 0x4e, 0x46, 0x86, 0x6e, 0x46, 0x81, 0x4e, 0x3e, 0x19,
+  0x6e, 0x3e, 0x8e, 0x3e, 0x6d, 0x3e, 0xeb, 0x3d, 0x2c, 0x36, 0xca, 0x35, 0xc9, 0x55, 0x6b, 0x5e, 0xe8, 0x44, 0x08, 0x4d, 0xc8, 0x44, 0xca, 0x55, 0x4b, 0x6e, 0x6c, 0x6e, 0x4c, 0x6e, 0xea, 0x7d,
+  0x2b, 0x76, 0x6b, 0x6e, 0x6b, 0x66, 0xea, 0x65, 0x4a, 0x53, 0x69, 0x4c, 0x75, 0x06, 0xbe, 0x07, 0xdf, 0x07, 0x34, 0x0e, 0x92, 0x00, 0x00, 0x96, 0x00, 0x00, 0x13, 0x02, 0x01, 0xe1, 0x01, 0xc0,
+  0x1b, 0x80, 0x14, 0x60, 0x3b, 0xc2, 0x64, 0x43, 0x55, 0x80, 0x6b, 0x40, 0x6b, 0x20, 0x63, 0x20, 0x5b, 0xa0, 0xac, 0x40, 0xcd, 0xd1, 0x4c, 0x52, 0x2d, 0x20, 0x2a, 0xa1, 0x01, 0x83, 0x01, 0x65,
+  0x33, 0x4b, 0x36, 0x84, 0x4c, 0x36, 0x81, 0x4c, 0x3e, 0x00, 0x4b, 0x3e, 0x81, 0x4c, 0x3e, 0x83, 0x4b, 0x3e, 0x01, 0x2b, 0x3e, 0x4c, 0x3e, 0x81, 0x4b, 0x36, 0x04, 0x4c, 0x3e, 0x6d, 0x3e, 0x6e,
+  0x46, 0x8f, 0x46, 0x4e, 0x46, 0x84, 0x6e, 0x46, 0x82, 0x4e, 0x46, 0x16, 0x6e, 0x46, 0x8e, 0x46, 0x8e, 0x3e, 0x2d, 0x3e, 0x29, 0x2d, 0x0c, 0x2e, 0xa9, 0x35, 0x0a, 0x66, 0x6b, 0x6e, 0xc9, 0x5d,
+  0x08, 0x4d, 0x87, 0x3c, 0xa9, 0x5d, 0x6b, 0x6e, 0x4b, 0x76, 0x4b, 0x6e, 0x6b, 0x6e, 0x4b, 0x6e, 0x4b, 0x76, 0x4d, 0xa6, 0x2b, 0x8e, 0xe8, 0x43, 0x98, 0x16, 0x81, 0xff, 0x07, 0x01, 0x5d, 0x07,
+  0x8d, 0x0c, 0x92, 0x00, 0x00, 0x96, 0x00, 0x00, 0x13, 0xa5, 0x7d, 0x61, 0x44, 0x80, 0x0c, 0x03, 0x05, 0x04, 0x24, 0xc3, 0x3c, 0x02, 0x5d, 0x40, 0x6b, 0x40, 0x63, 0x00, 0x5b, 0xa0, 0xa4, 0x00,
+  0xee, 0xe0, 0xe5, 0x81, 0x6c, 0xf2, 0x35, 0x0b, 0x03, 0xe0, 0x01, 0x01, 0x02, 0x2e, 0x03, 0x2d, 0x2e, 0x81, 0x4b, 0x36, 0x82, 0x4c, 0x36, 0x85, 0x4c, 0x3e, 0x82, 0x4b, 0x3e, 0x00, 0x2b, 0x3e,
+  0x82, 0x4c, 0x3e, 0x81, 0x4c, 0x36, 0x00, 0x4d, 0x3e, 0x81, 0x6e, 0x46, 0x00, 0x4e, 0x46, 0x81, 0x6e, 0x46, 0x81, 0x4e, 0x46, 0x83, 0x6e, 0x46, 0x15, 0x8e, 0x46, 0xcc, 0x3d, 0x4a, 0x35, 0x48,
+  0x2c, 0x49, 0x25, 0xe9, 0x4d, 0x6b, 0x66, 0x4a, 0x6e, 0xe9, 0x65, 0x48, 0x55, 0x69, 0x5d, 0x2a, 0x6e, 0x4b, 0x6e, 0x6b, 0x86, 0x4b, 0x76, 0x4c, 0x6e, 0x4d, 0x76, 0x6d, 0x96, 0x6c, 0x9e, 0x4a,
+  0x76, 0xa2, 0x4c, 0xb8, 0x06, 0x81, 0xff, 0x07, 0x02, 0x1b, 0x07, 0x8b, 0x0c, 0xe0, 0x07, 0x91, 0x00, 0x00, 0x96, 0x00, 0x00, 0x14, 0x04, 0x9f, 0x84, 0x6e, 0x06, 0x05, 0x72, 0x16, 0xa8, 0x45,
+  0xe1, 0x44, 0x62, 0x64, 0x00, 0x63, 0x00, 0x5b, 0xc0, 0xac, 0x20, 0xee, 0x20, 0xf6, 0x00, 0xe6, 0x61, 0x74, 0x4f, 0x04, 0xf1, 0x03, 0x63, 0x02, 0x60, 0x01, 0xf8, 0x04, 0x31, 0x2e, 0x4a, 0x36,
+  0x81, 0x2c, 0x36, 0x00, 0x4c, 0x36, 0x89, 0x4c, 0x3e, 0x81, 0x2b, 0x3e, 0x81, 0x4c, 0x3e, 0x00, 0x4c, 0x36, 0x81, 0x4c, 0x3e, 0x81, 0x2d, 0x3e, 0x00, 0x4d, 0x46, 0x82, 0x6e, 0x46, 0x00, 0x8e,
+  0x46, 0x83, 0x6e, 0x46, 0x06, 0x8e, 0x46, 0xea, 0x2c, 0xa9, 0x2c, 0xea, 0x34, 0xc8, 0x2c, 0x29, 0x56, 0xab, 0x5e, 0x81, 0x2a, 0x6e, 0x01, 0x0a, 0x6e, 0x4a, 0x76, 0x81, 0x4b, 0x76, 0x0d, 0x4b,
+  0x86, 0x4b, 0x7e, 0x4c, 0x76, 0x6c, 0x7e, 0x6a, 0x7e, 0x6a, 0x6e, 0x49, 0x6e, 0x25, 0x5d, 0x6f, 0x05, 0xdd, 0x07, 0xff, 0x07, 0x98, 0x06, 0x67, 0x04, 0xcb, 0x15, 0x91, 0x00, 0x00, 0x96, 0x00,
+  0x00, 0x08, 0x06, 0x05, 0xe5, 0x0d, 0xc6, 0x0d, 0x52, 0x1e, 0x4a, 0x4d, 0x00, 0x55, 0xe2, 0x63, 0xe0, 0x52, 0xc0, 0xac, 0x81, 0x20, 0xf6, 0x09, 0x20, 0xee, 0x21, 0xee, 0xa4, 0x84, 0xc0, 0x02,
+  0xce, 0x03, 0xc9, 0x02, 0x28, 0x02, 0xdd, 0x06, 0x34, 0x26, 0x4a, 0x36, 0x81, 0x2c, 0x36, 0x87, 0x4c, 0x3e, 0x00, 0x4b, 0x3e, 0x82, 0x4c, 0x3e, 0x01, 0x0b, 0x3e, 0x2c, 0x3e, 0x83, 0x4c, 0x3e,
+  0x00, 0x2d, 0x3e, 0x81, 0x4d, 0x46, 0x82, 0x8e, 0x46, 0x00, 0x2d, 0x3e, 0x83, 0x6e, 0x46, 0x07, 0x6e, 0x3e, 0x8a, 0x3d, 0xca, 0x34, 0xa9, 0x34, 0xa7, 0x2c, 0x69, 0x5e, 0xaa, 0x6e, 0x29, 0x76,
+  0x82, 0x2a, 0x76, 0x0f, 0x4b, 0x76, 0x2b, 0x76, 0x2a, 0x8e, 0x69, 0x96, 0x89, 0x86, 0x69, 0x7e, 0xe8, 0x7d, 0x66, 0x7d, 0x69, 0x76, 0xa8, 0x65, 0x60, 0x1c, 0x4d, 0x06, 0xdc, 0x07, 0x94, 0x05,
+  0x20, 0x03, 0x6a, 0x15, 0x91, 0x00, 0x00, 0x95, 0x00, 0x00, 0x08, 0xcf, 0x66, 0xeb, 0x2c, 0x46, 0x04, 0xe3, 0x14, 0x00, 0x33, 0x40, 0x6c, 0x23, 0x5d, 0x41, 0x53, 0xe0, 0xb4, 0x81, 0x20, 0xf6,
+  0x0b, 0x20, 0xee, 0x20, 0xf6, 0x21, 0xee, 0x27, 0x7d, 0x01, 0x03, 0x84, 0x03, 0x28, 0x02, 0x51, 0x04, 0xff, 0x07, 0xb8, 0x1e, 0x2b, 0x36, 0x4c, 0x3e, 0x81, 0x4d, 0x46, 0x02, 0x4c, 0x46, 0x4d,
+  0x46, 0x4c, 0x46, 0x83, 0x4c, 0x3e, 0x81, 0x2b, 0x3e, 0x03, 0x2c, 0x3e, 0x4c, 0x3e, 0x2c, 0x3e, 0x4c, 0x3e, 0x81, 0x2c, 0x3e, 0x01, 0x4c, 0x3e, 0x6d, 0x46, 0x81, 0x8e, 0x46, 0x00, 0x4d, 0x3e,
+  0x81, 0x8e, 0x46, 0x0c, 0x2d, 0x3e, 0x69, 0x34, 0x4b, 0x35, 0x8e, 0x46, 0x6e, 0x46, 0x6d, 0x3e, 0x4d, 0x3e, 0xa9, 0x55, 0x4a, 0x45, 0xab, 0x25, 0x88, 0x3d, 0xa6, 0x8e, 0x88, 0x7e, 0x81, 0x29,
+  0x76, 0x01, 0x2a, 0x76, 0x2a, 0x7e, 0x81, 0x4a, 0x86, 0x0d, 0x49, 0x96, 0x68, 0xb6, 0x48, 0x86, 0x46, 0x8d, 0x87, 0x85, 0x05, 0x8d, 0x49, 0x7e, 0x08, 0x76, 0x65, 0x34, 0x80, 0x0d, 0x29, 0x16,
+  0xac, 0x1b, 0x8a, 0x02, 0xa8, 0x04, 0x91, 0x00, 0x00, 0x95, 0x00, 0x00, 0x08, 0x0a, 0x5e, 0xc7, 0x34, 0x24, 0x24, 0x61, 0x1a, 0x80, 0x28, 0xc1, 0x6c, 0x02, 0x65, 0x00, 0xbd, 0x20, 0xee, 0x83,
+  0x20, 0xf6, 0x08, 0x02, 0xe6, 0x69, 0x55, 0x04, 0x04, 0xe0, 0x0b, 0x61, 0x1b, 0x5a, 0x06, 0xff, 0x07, 0x7c, 0x17, 0x4c, 0x3e, 0x84, 0x6d, 0x46, 0x00, 0x4c, 0x46, 0x81, 0x2c, 0x3e, 0x02, 0x4c,
+  0x3e, 0x2b, 0x3e, 0x2c, 0x3e, 0x81, 0x2b, 0x3e, 0x00, 0x2c, 0x3e, 0x82, 0x2c, 0x46, 0x02, 0x2c, 0x3e, 0x4c, 0x3e, 0x6d, 0x3e, 0x81, 0x8e, 0x46, 0x00, 0x8d, 0x3e, 0x81, 0x8e, 0x3e, 0x02, 0x4d,
+  0x3e, 0x49, 0x2c, 0x69, 0x2c, 0x81, 0x6e, 0x3e, 0x1b, 0x4d, 0x3e, 0x0c, 0x46, 0xe8, 0x6d, 0x4c, 0x56, 0x2d, 0x06, 0x06, 0x8e, 0xe2, 0xc6, 0x47, 0x7e, 0x29, 0x76, 0x29, 0x7e, 0x4a, 0x86, 0x6b,
+  0x8e, 0x6a, 0x8e, 0x4a, 0x86, 0x4a, 0x8e, 0x28, 0xb6, 0x28, 0x86, 0x04, 0x8d, 0xc7, 0x7d, 0x66, 0x85, 0x69, 0x7e, 0x49, 0x76, 0x86, 0x44, 0xc4, 0x05, 0xa0, 0x25, 0xe3, 0x52, 0x89, 0x2a, 0x08,
+  0x04, 0x91, 0x00, 0x00, 0x95, 0x00, 0x00, 0x09, 0x04, 0x9f, 0xe1, 0x85, 0xa0, 0x2a, 0x00, 0x00, 0xc0, 0x51, 0xe1, 0x74, 0xc1, 0xbd, 0x20, 0xf6, 0x20, 0xee, 0x00, 0xee, 0x82, 0x20, 0xf6, 0x05,
+  0xe3, 0xd5, 0x89, 0x2d, 0x07, 0x0c, 0x86, 0x0c, 0x60, 0x24, 0x16, 0x06, 0x81, 0xff, 0x07, 0x02, 0x90, 0x3e, 0x4c, 0x46, 0x6c, 0x46, 0x82, 0x4c, 0x46, 0x00, 0x2c, 0x3e, 0x81, 0x2b, 0x3e, 0x83,
+  0x2c, 0x3e, 0x82, 0x0c, 0x3e, 0x06, 0x4c, 0x46, 0x6c, 0x46, 0x4c, 0x46, 0x2c, 0x3e, 0xeb, 0x3d, 0x4c, 0x3e, 0x8d, 0x3e, 0x81, 0x8e, 0x46, 0x0f, 0x8e, 0x3e, 0x6e, 0x3e, 0xeb, 0x34, 0xaa, 0x34,
+  0x4e, 0x3e, 0x6e, 0x46, 0x4d, 0x3e, 0xea, 0x5d, 0x08, 0x7e, 0x8d, 0x56, 0xeb, 0x05, 0x03, 0xae, 0x85, 0xc6, 0x28, 0x7e, 0x28, 0x86, 0x49, 0x86, 0x81, 0x6a, 0x8e, 0x10, 0x48, 0x6d, 0x68, 0x6d,
+  0x6a, 0x86, 0x49, 0x8e, 0x68, 0x86, 0x86, 0x8d, 0x45, 0x8d, 0x83, 0x94, 0x07, 0x86, 0x69, 0x7e, 0x07, 0x5d, 0xc5, 0x05, 0x80, 0x3d, 0xc0, 0x5a, 0xa0, 0x72, 0x05, 0x9c, 0xeb, 0xaf, 0x90, 0x00,
+  0x00, 0x95, 0x00, 0x00, 0x07, 0xe4, 0x5c, 0x80, 0x85, 0xc0, 0x8d, 0x00, 0x7d, 0x00, 0x9c, 0x42, 0xa4, 0xe1, 0xdd, 0x20, 0xfe, 0x81, 0x00, 0xee, 0x82, 0x20, 0xf6, 0x09, 0xc4, 0xbd, 0xa9, 0x05,
+  0x49, 0x1c, 0x6c, 0x04, 0x09, 0x0d, 0x00, 0x04, 0x12, 0x06, 0xbe, 0x07, 0x91, 0x36, 0x4b, 0x3e, 0x81, 0x4c, 0x3e, 0x00, 0x2c, 0x3e, 0x84, 0x2b, 0x3e, 0x82, 0x0c, 0x3e, 0x83, 0x2c, 0x3e, 0x81,
+  0x4c, 0x46, 0x03, 0x2a, 0x35, 0x48, 0x2c, 0x4c, 0x3e, 0x6c, 0x3e, 0x81, 0x6d, 0x3e, 0x03, 0x8e, 0x46, 0x8e, 0x3e, 0x6c, 0x35, 0x8c, 0x3d, 0x81, 0x6e, 0x46, 0x0a, 0x2d, 0x3e, 0xc8, 0x75, 0x09,
+  0x86, 0x4d, 0x46, 0xa8, 0x3d, 0x40, 0xd6, 0x65, 0xb6, 0x46, 0x86, 0x27, 0x8e, 0x49, 0x8e, 0xa8, 0x75, 0x81, 0x28, 0x65, 0x0f, 0x07, 0x5d, 0x6a, 0x86, 0x69, 0x86, 0x67, 0x86, 0x06, 0x8e, 0xe6,
+  0x8d, 0x27, 0x8e, 0x68, 0x86, 0x68, 0x7e, 0x67, 0x65, 0x63, 0x25, 0xe0, 0x6c, 0xe0, 0x8a, 0x40, 0xaa, 0x63, 0xb3, 0x49, 0x76, 0x90, 0x00, 0x00, 0x95, 0x00, 0x00, 0x07, 0x82, 0x02, 0x60, 0x5c,
+  0x80, 0xae, 0x40, 0xa6, 0x21, 0xc4, 0x41, 0xdb, 0xe0, 0xf5, 0x20, 0xfe, 0x82, 0x00, 0xf6, 0x81, 0x20, 0xf6, 0x0b, 0x85, 0x9d, 0x88, 0x0d, 0xcb, 0x24, 0xab, 0x04, 0xb3, 0x06, 0x6c, 0x05, 0x82,
+  0x04, 0x2c, 0x0c, 0xab, 0x3d, 0x6c, 0x46, 0x4c, 0x46, 0x2c, 0x3e, 0x84, 0x2b, 0x3e, 0x01, 0x0b, 0x3e, 0x0c, 0x3e, 0x82, 0x2c, 0x3e, 0x06, 0x4c, 0x3e, 0x2c, 0x3e, 0x2b, 0x3e, 0x4c, 0x46, 0x4c,
+  0x3e, 0x0c, 0x3e, 0xc9, 0x34, 0x81, 0x6d, 0x46, 0x0e, 0x6c, 0x3e, 0x2c, 0x3e, 0x6d, 0x3e, 0x6e, 0x3e, 0x8e, 0x46, 0x8f, 0x46, 0x6e, 0x46, 0x6d, 0x46, 0xeb, 0x45, 0xc8, 0x75, 0x4b, 0x66, 0x2c,
+  0x36, 0xa5, 0x55, 0x41, 0xae, 0x65, 0x9e, 0x81, 0x46, 0x8e, 0x09, 0x48, 0x8e, 0xe8, 0x7d, 0xe8, 0x64, 0xcb, 0x75, 0xc7, 0x54, 0x49, 0x7e, 0x69, 0x86, 0x67, 0x8e, 0x87, 0x8e, 0x87, 0x86, 0x81,
+  0x67, 0x86, 0x07, 0x48, 0x86, 0xa6, 0x6d, 0x68, 0x94, 0x69, 0xdb, 0x00, 0xca, 0xe0, 0xb0, 0x43, 0xa2, 0x07, 0x75, 0x90, 0x00, 0x00, 0x94, 0x00, 0x00, 0x09, 0xe9, 0x15, 0xe5, 0x03, 0x60, 0x43,
+  0x80, 0xad, 0x61, 0x6b, 0x00, 0xc0, 0xc0, 0xf3, 0x00, 0xfe, 0x20, 0xfe, 0x00, 0xfe, 0x81, 0xe0, 0xf5, 0x0d, 0x00, 0xf6, 0x00, 0xee, 0x86, 0x75, 0x87, 0x1d, 0x4d, 0x25, 0xcb, 0x0c, 0xd3, 0x06,
+  0x6e, 0x05, 0xe6, 0x03, 0x00, 0x02, 0x46, 0x24, 0x6c, 0x46, 0x4c, 0x46, 0x2c, 0x3e, 0x81, 0x2b, 0x3e, 0x01, 0x2c, 0x46, 0x2c, 0x4e, 0x82, 0x2c, 0x46, 0x00, 0x4c, 0x46, 0x83, 0x4c, 0x3e, 0x07,
+  0x2b, 0x3e, 0x4b, 0x46, 0x6c, 0x46, 0x0c, 0x3e, 0xc6, 0x23, 0x2c, 0x46, 0x6d, 0x56, 0x6c, 0x4e, 0x81, 0x4c, 0x3e, 0x01, 0x6d, 0x3e, 0x6e, 0x3e, 0x81, 0x8e, 0x46, 0x07, 0x4d, 0x46, 0x0b, 0x4e,
+  0x2a, 0x5e, 0xce, 0x4e, 0x2b, 0x2e, 0xa4, 0x65, 0x64, 0x75, 0xc4, 0x64, 0x81, 0x46, 0x96, 0x81, 0x48, 0x8e, 0x04, 0x07, 0x65, 0x68, 0x6d, 0x07, 0x65, 0x69, 0x86, 0x89, 0x86, 0x82, 0x67, 0x8e,
+  0x81, 0x47, 0x8e, 0x07, 0x47, 0x86, 0x04, 0x76, 0x0f, 0x9c, 0x7c, 0xfb, 0xf5, 0xe9, 0x00, 0xc0, 0xc0, 0xb1, 0x87, 0x8c, 0x90, 0x00, 0x00, 0x94, 0x00, 0x00, 0x16, 0xe3, 0x04, 0xa2, 0x44, 0xe0,
+  0x7c, 0x20, 0x5c, 0x01, 0x20, 0x05, 0xe2, 0x87, 0xfc, 0x00, 0xfe, 0x20, 0xfe, 0x00, 0xfe, 0xe0, 0xfd, 0xe0, 0xf5, 0x00, 0xfe, 0xe1, 0xe5, 0x87, 0x4d, 0x68, 0x2d, 0x8c, 0x35, 0x8f, 0x2d, 0xb5,
+  0x06, 0xec, 0x04, 0x80, 0x03, 0x81, 0x03, 0x04, 0x1c, 0x81, 0x4c, 0x46, 0x02, 0x2c, 0x46, 0x2c, 0x4e, 0x0c, 0x5e, 0x81, 0x2c, 0x56, 0x05, 0x2c, 0x46, 0x2b, 0x46, 0x4c, 0x46, 0xeb, 0x3d, 0x2a,
+  0x35, 0x2b, 0x3e, 0x81, 0x4c, 0x3e, 0x1b, 0x0b, 0x3e, 0x4b, 0x46, 0x4c, 0x46, 0x2c, 0x3e, 0xa9, 0x2c, 0x0c, 0x3e, 0x4d, 0x46, 0x6d, 0x56, 0x4d, 0x56, 0x4d, 0x3e, 0x4d, 0x36, 0x4d, 0x3e, 0x6d,
+  0x46, 0x8e, 0x46, 0x6d, 0x46, 0x2b, 0x46, 0x8d, 0x4e, 0xaf, 0x36, 0x67, 0x2d, 0x63, 0x5c, 0x45, 0x75, 0x84, 0x5c, 0x26, 0x8e, 0x66, 0x96, 0x47, 0x8e, 0x48, 0x8e, 0xc7, 0x7d, 0x29, 0x86, 0x81,
+  0x69, 0x8e, 0x01, 0x69, 0x86, 0x48, 0x8e, 0x82, 0x47, 0x8e, 0x08, 0x67, 0x8e, 0x67, 0x86, 0x24, 0x76, 0x8c, 0x84, 0x5e, 0xfc, 0x1f, 0xfc, 0x99, 0xf2, 0x29, 0xd9, 0xe3, 0xb3, 0x90, 0x00, 0x00,
+  0x94, 0x00, 0x00, 0x06, 0x44, 0x5e, 0xa0, 0x75, 0xea, 0x4d, 0xcc, 0x5e, 0x40, 0x93, 0xf1, 0xe2, 0x90, 0xed, 0x82, 0xe0, 0xfd, 0x81, 0xc0, 0xfd, 0x10, 0xe0, 0xfd, 0xc3, 0xd5, 0x88, 0x25, 0x88,
+  0x2d, 0xaa, 0x45, 0x2a, 0x54, 0xcd, 0x04, 0x15, 0x06, 0xe4, 0x03, 0xc0, 0x1b, 0xc2, 0x1b, 0xec, 0x3d, 0x6c, 0x46, 0x4c, 0x4e, 0x2d, 0x66, 0x2c, 0x66, 0x4c, 0x4e, 0x82, 0x2c, 0x46, 0x03, 0x4c,
+  0x46, 0x09, 0x35, 0x88, 0x34, 0x0b, 0x3e, 0x81, 0x4c, 0x3e, 0x02, 0x2b, 0x3e, 0x2b, 0x46, 0x4c, 0x46, 0x81, 0x4c, 0x3e, 0x81, 0x2c, 0x3e, 0x04, 0x2c, 0x46, 0x2d, 0x4e, 0x4d, 0x46, 0x6c, 0x4e,
+  0x8c, 0x4e, 0x81, 0x8d, 0x46, 0x0b, 0x2c, 0x46, 0x2b, 0x46, 0x8d, 0x46, 0x0b, 0x2e, 0x42, 0x45, 0x62, 0x54, 0x85, 0x7d, 0xe4, 0x64, 0x26, 0x96, 0x66, 0x9e, 0x46, 0x96, 0x48, 0x8e, 0x82, 0x68,
+  0x8e, 0x81, 0x48, 0x86, 0x03, 0x47, 0x8e, 0x46, 0x8e, 0x66, 0x8e, 0x46, 0x8e, 0x81, 0xa4, 0x85, 0x07, 0x66, 0x7e, 0x04, 0x6d, 0x19, 0xe4, 0x7f, 0xfc, 0x3f, 0xfc, 0x3a, 0xfb, 0x65, 0xd3, 0xe0,
+  0x07, 0x8f, 0x00, 0x00, 0x93, 0x00, 0x00, 0x1a, 0xeb, 0xff, 0x83, 0xa3, 0x60, 0x53, 0xc8, 0x2c, 0xab, 0x66, 0x00, 0xad, 0x2e, 0xbb, 0x2b, 0xe5, 0x81, 0xfd, 0x83, 0xfd, 0x84, 0xfd, 0x65, 0xfd,
+  0x81, 0xfd, 0xc0, 0xfd, 0xa5, 0xb5, 0x88, 0x05, 0x89, 0x35, 0xaa, 0x3d, 0x28, 0x64, 0x86, 0x5b, 0x5d, 0x17, 0x54, 0x0e, 0xc0, 0x1b, 0x8b, 0x02, 0x51, 0x35, 0x6c, 0x46, 0x4c, 0x4e, 0x84, 0x4c,
+  0x46, 0x04, 0x2c, 0x46, 0x4c, 0x46, 0x8b, 0x3d, 0x69, 0x34, 0xe9, 0x34, 0x81, 0x4c, 0x3e, 0x01, 0x2b, 0x3e, 0x0b, 0x46, 0x81, 0x2c, 0x46, 0x81, 0x2c, 0x3e, 0x81, 0x0c, 0x3e, 0x01, 0x2c, 0x3e,
+  0x4c, 0x46, 0x81, 0xac, 0x5e, 0x0e, 0x8d, 0x4e, 0xaa, 0x3d, 0x49, 0x3d, 0x0a, 0x46, 0x4b, 0x46, 0xe9, 0x2d, 0x82, 0x4d, 0xc1, 0x5c, 0xc3, 0x64, 0xe2, 0x4b, 0xa4, 0x85, 0x65, 0x9e, 0x25, 0x96,
+  0x47, 0x96, 0x47, 0x8e, 0x81, 0x27, 0x8e, 0x81, 0x46, 0x8e, 0x0d, 0x45, 0x8e, 0x66, 0x8e, 0x83, 0x8d, 0xe2, 0x84, 0x23, 0x7d, 0x43, 0x7d, 0x45, 0x86, 0x63, 0x65, 0xe5, 0xc2, 0x57, 0xfb, 0x9f,
+  0xfc, 0x3d, 0xfc, 0x27, 0xbb, 0x00, 0x06, 0x8f, 0x00, 0x00, 0x93, 0x00, 0x00, 0x1b, 0x0c, 0x9d, 0x29, 0xba, 0x05, 0x88, 0x00, 0xb0, 0x00, 0xda, 0xa5, 0xca, 0x80, 0xaa, 0x80, 0x92, 0xa6, 0xdb,
+  0x8b, 0xfc, 0xce, 0xfc, 0xcf, 0xfc, 0xec, 0xfc, 0x60, 0xfd, 0x86, 0x95, 0x89, 0x05, 0x89, 0x35, 0xa9, 0x2d, 0xe9, 0x7c, 0x04, 0x94, 0x16, 0x2e, 0x52, 0x05, 0xf5, 0x04, 0x58, 0x03, 0x77, 0x24,
+  0x6c, 0x46, 0x6c, 0x3e, 0x4c, 0x3e, 0x81, 0x4c, 0x46, 0x06, 0xeb, 0x55, 0x2c, 0x4e, 0x4c, 0x46, 0x2c, 0x46, 0x0c, 0x46, 0xca, 0x34, 0xe9, 0x34, 0x81, 0x4c, 0x3e, 0x01, 0x2c, 0x46, 0x0b, 0x46,
+  0x81, 0x2c, 0x46, 0x0b, 0x0c, 0x46, 0x0b, 0x3e, 0x2b, 0x46, 0x2c, 0x46, 0x4c, 0x46, 0x2b, 0x46, 0x8b, 0x4e, 0xea, 0x4d, 0x8a, 0x45, 0xe8, 0x3c, 0xe8, 0x34, 0x88, 0x3d, 0x81, 0xe9, 0x35, 0x03,
+  0xa1, 0x6d, 0x40, 0x75, 0x01, 0x65, 0x00, 0x96, 0x81, 0x63, 0x9e, 0x02, 0x26, 0x96, 0x28, 0x96, 0x26, 0x96, 0x83, 0x45, 0x96, 0x81, 0x66, 0x96, 0x0b, 0xc3, 0x8d, 0x22, 0x85, 0x23, 0x7d, 0x42,
+  0x75, 0x24, 0x8e, 0xc4, 0x75, 0x63, 0x9b, 0xa0, 0xf2, 0xf2, 0xfb, 0xf6, 0xeb, 0xc3, 0x8a, 0x25, 0x5d, 0x8f, 0x00, 0x00, 0x93, 0x00, 0x00, 0x19, 0xa0, 0xa3, 0x8e, 0xc1, 0x14, 0xc0, 0xec, 0xe0,
+  0x23, 0xc9, 0xa3, 0xa8, 0x43, 0xa2, 0xe0, 0x79, 0xe0, 0x81, 0xa7, 0xb2, 0x92, 0xf3, 0x18, 0xfc, 0x37, 0xfc, 0xad, 0xfc, 0x66, 0x6d, 0x88, 0x1d, 0x68, 0x35, 0x8a, 0x2d, 0x4a, 0x4d, 0xf1, 0x14,
+  0x74, 0x05, 0xeb, 0x03, 0x51, 0x04, 0xdf, 0x03, 0xdc, 0x13, 0x6d, 0x3e, 0x81, 0x6c, 0x3e, 0x04, 0xeb, 0x55, 0x8b, 0x65, 0x87, 0x7c, 0xcb, 0x5d, 0x4c, 0x46, 0x81, 0x2c, 0x46, 0x06, 0x4a, 0x3d,
+  0xeb, 0x45, 0x2c, 0x46, 0x4c, 0x46, 0x4c, 0x56, 0x0b, 0x4e, 0x0c, 0x46, 0x82, 0x2c, 0x46, 0x00, 0x4b, 0x46, 0x82, 0x2b, 0x46, 0x22, 0x6c, 0x4e, 0xaa, 0x45, 0xc7, 0x44, 0x88, 0x55, 0x64, 0x4c,
+  0x04, 0x45, 0xe8, 0x2d, 0xe8, 0x35, 0xc0, 0x8d, 0xc0, 0x85, 0x80, 0x85, 0x80, 0xce, 0x63, 0xae, 0x24, 0xa6, 0x25, 0xa6, 0x25, 0x9e, 0x45, 0x96, 0x44, 0x96, 0x04, 0x8e, 0xc2, 0x64, 0x03, 0x86,
+  0xa5, 0xa6, 0x85, 0xa6, 0x04, 0x86, 0x02, 0x8d, 0x43, 0x85, 0x01, 0x7d, 0x43, 0x8e, 0xe3, 0x85, 0x25, 0x7c, 0xe1, 0xdb, 0xc0, 0xdb, 0x40, 0x8a, 0xa1, 0x72, 0xc5, 0x84, 0x8f, 0x00, 0x00, 0x93,
+  0x00, 0x00, 0x20, 0x24, 0xbb, 0xc4, 0xc8, 0x11, 0xd8, 0x6c, 0xe9, 0x02, 0xb9, 0x22, 0xc9, 0x43, 0xa2, 0x00, 0x82, 0x20, 0x8a, 0x00, 0x82, 0x24, 0x9a, 0xd2, 0xda, 0x7b, 0xfb, 0x17, 0xec, 0x64,
+  0x45, 0x89, 0x25, 0x8c, 0x1d, 0xae, 0x0d, 0x8e, 0x25, 0x51, 0x25, 0x94, 0x05, 0xd2, 0x04, 0xc8, 0x02, 0x79, 0x01, 0x3e, 0x03, 0x12, 0x36, 0x6c, 0x46, 0x6d, 0x3e, 0x49, 0x75, 0xcb, 0x74, 0x68,
+  0x84, 0x29, 0x75, 0x4c, 0x46, 0x81, 0x2c, 0x46, 0x01, 0x4c, 0x46, 0x2c, 0x46, 0x82, 0x2c, 0x4e, 0x01, 0x0c, 0x4e, 0x4c, 0x4e, 0x82, 0x4c, 0x46, 0x01, 0x6a, 0x3d, 0xea, 0x45, 0x81, 0x2b, 0x46,
+  0x08, 0x0a, 0x4e, 0xa8, 0x4d, 0x85, 0x44, 0x45, 0x5d, 0x42, 0x4c, 0xe3, 0x95, 0x64, 0xd7, 0x23, 0xa6, 0x20, 0x75, 0x81, 0x80, 0xad, 0x05, 0xe0, 0xcd, 0x02, 0xc6, 0x41, 0xae, 0x40, 0xae, 0x43,
+  0x9e, 0x44, 0x96, 0x82, 0xe2, 0x74, 0x05, 0x82, 0x7d, 0x83, 0x9e, 0x64, 0x9e, 0xa3, 0x8d, 0xa1, 0x8c, 0x03, 0x8e, 0x81, 0x42, 0x8e, 0x06, 0x02, 0x8e, 0xa4, 0x74, 0x43, 0xcc, 0x40, 0xab, 0x60,
+  0x19, 0x81, 0x8a, 0x67, 0x9c, 0x8f, 0x00, 0x00, 0x93, 0x00, 0x00, 0x4b, 0x44, 0xcb, 0x00, 0xeb, 0x44, 0xfd, 0x42, 0xf3, 0xa1, 0xd0, 0x63, 0xe1, 0x22, 0x8a, 0x00, 0x82, 0x20, 0x8a, 0x40, 0x8a,
+  0x20, 0x8a, 0x00, 0x8a, 0xee, 0xc1, 0x16, 0xb4, 0xaf, 0x05, 0xce, 0x05, 0xcf, 0x05, 0xd0, 0x05, 0x8f, 0x1d, 0x08, 0x35, 0x70, 0x05, 0xd7, 0x05, 0x33, 0x03, 0x1a, 0x00, 0x7c, 0x01, 0x93, 0x35,
+  0x6c, 0x46, 0x4d, 0x46, 0xec, 0x55, 0xca, 0x74, 0x89, 0x74, 0xc8, 0x7c, 0x4c, 0x4e, 0x4c, 0x46, 0x2c, 0x46, 0x2c, 0x4e, 0x0c, 0x4e, 0x0c, 0x56, 0x2c, 0x66, 0x4c, 0x56, 0x2c, 0x4e, 0x4c, 0x4e,
+  0x4c, 0x46, 0x4a, 0x35, 0x2b, 0x46, 0x67, 0x34, 0x49, 0x45, 0xea, 0x4d, 0x67, 0x4d, 0xc4, 0x54, 0x20, 0x5c, 0xe0, 0x53, 0x80, 0x5c, 0x60, 0x64, 0x41, 0xb6, 0xe2, 0xff, 0x60, 0xd6, 0xe0, 0x84,
+  0xc3, 0xb5, 0x61, 0xee, 0x80, 0xbd, 0xa0, 0xb5, 0x40, 0xb6, 0x60, 0xa6, 0x82, 0xbe, 0x82, 0xc6, 0x81, 0x95, 0xc1, 0x74, 0xe2, 0x74, 0x42, 0x75, 0x62, 0x96, 0x63, 0x9e, 0x23, 0x8e, 0x42, 0x8e,
+  0x62, 0x8e, 0x42, 0x96, 0x81, 0x42, 0x9e, 0x06, 0x22, 0x7d, 0xe2, 0x9b, 0xe0, 0x69, 0x60, 0x49, 0x41, 0x6a, 0x4b, 0x34, 0xff, 0x07, 0x8e, 0x00, 0x00, 0x92, 0x00, 0x00, 0x22, 0x29, 0x4e, 0x44,
+  0xe6, 0x23, 0xff, 0xe5, 0xff, 0x43, 0xf5, 0x01, 0xd0, 0xc4, 0xd1, 0x01, 0x7a, 0x00, 0x7a, 0x20, 0x82, 0x40, 0x8a, 0x00, 0x82, 0x00, 0x8a, 0x65, 0x62, 0x77, 0x04, 0x9e, 0x05, 0x9a, 0x05, 0x94,
+  0x05, 0x91, 0x0d, 0x4d, 0x15, 0x2e, 0x1d, 0x2e, 0x0d, 0x9b, 0x06, 0xfb, 0x03, 0x1d, 0x00, 0x17, 0x19, 0x09, 0x4d, 0x6d, 0x46, 0x4d, 0x46, 0x2c, 0x4e, 0x8b, 0x65, 0xcc, 0x5d, 0x0c, 0x56, 0x4c,
+  0x46, 0x2c, 0x4e, 0x81, 0x0c, 0x56, 0x30, 0x2d, 0x56, 0x4d, 0x56, 0x4c, 0x5e, 0x4c, 0x56, 0x2c, 0x46, 0x4c, 0x4e, 0x2c, 0x56, 0x88, 0x54, 0xaa, 0x4d, 0x67, 0x44, 0x06, 0x3c, 0xc4, 0x54, 0x60,
+  0x5c, 0x20, 0x6c, 0xe0, 0x63, 0x80, 0x7c, 0x20, 0x95, 0xc0, 0x7c, 0xe0, 0x7c, 0xe0, 0xb5, 0x62, 0xc5, 0x62, 0x9c, 0x80, 0x8c, 0x20, 0xd6, 0xe0, 0xcd, 0xc0, 0x9c, 0xe0, 0xd5, 0xa1, 0xe6, 0xc1,
+  0xde, 0xa0, 0xde, 0x60, 0x95, 0x01, 0x7d, 0xe1, 0x74, 0x81, 0x85, 0x62, 0x96, 0x62, 0xae, 0x43, 0x96, 0x42, 0x8e, 0x43, 0x9e, 0x65, 0xa6, 0x42, 0xa6, 0x20, 0x9e, 0x81, 0x8d, 0xe5, 0x5b, 0x81,
+  0x50, 0xc0, 0x70, 0xa0, 0x72, 0x69, 0x44, 0x14, 0x07, 0x8e, 0x00, 0x00, 0x92, 0x00, 0x00, 0x08, 0x88, 0x8e, 0xa7, 0xf7, 0xe5, 0xff, 0xe6, 0xff, 0x66, 0xff, 0xa4, 0xe2, 0xc6, 0xb9, 0xe1, 0x71,
+  0x00, 0x72, 0x81, 0x00, 0x7a, 0x03, 0x26, 0x7a, 0xee, 0x4a, 0x6e, 0x03, 0x55, 0x04, 0x81, 0x7f, 0x05, 0x0b, 0x5f, 0x05, 0x56, 0x0d, 0x09, 0x0d, 0x53, 0x15, 0xf3, 0x04, 0x36, 0x05, 0xfb, 0x01,
+  0x59, 0x01, 0x48, 0x32, 0xc4, 0x6c, 0x4c, 0x46, 0x2d, 0x46, 0x81, 0x2d, 0x4e, 0x00, 0x2c, 0x56, 0x81, 0x0c, 0x56, 0x81, 0x2c, 0x5e, 0x23, 0x4d, 0x5e, 0x6d, 0x5e, 0x2c, 0x56, 0xeb, 0x45, 0x2b,
+  0x4e, 0x09, 0x6e, 0x29, 0x96, 0x8a, 0xa6, 0x89, 0x8d, 0x88, 0x44, 0xc5, 0x33, 0x43, 0x23, 0x62, 0x4c, 0x82, 0x64, 0x63, 0x6c, 0xa7, 0x74, 0x24, 0xae, 0xc0, 0xd6, 0x0b, 0x9e, 0xd5, 0x64, 0x51,
+  0xb4, 0x6f, 0xf4, 0xec, 0xe3, 0xa6, 0xa3, 0x20, 0x6b, 0xc0, 0x83, 0xe0, 0x83, 0x20, 0xc5, 0x60, 0xee, 0xc1, 0xfe, 0x60, 0xee, 0xc0, 0x9c, 0x20, 0x85, 0x20, 0x96, 0x41, 0x96, 0x42, 0x96, 0x81,
+  0x44, 0xa6, 0x00, 0x43, 0x9e, 0x81, 0x41, 0xa6, 0x81, 0x20, 0x9e, 0x06, 0xc0, 0x95, 0x49, 0x64, 0x27, 0x89, 0x00, 0x80, 0xa0, 0x60, 0x04, 0xa3, 0x6a, 0x75, 0x8e, 0x00, 0x00, 0x92, 0x00, 0x00,
+  0x0f, 0xe6, 0xbe, 0xe5, 0xff, 0xe6, 0xff, 0x05, 0xef, 0x24, 0xd5, 0x45, 0xea, 0x27, 0xb2, 0xc0, 0x71, 0xe0, 0x71, 0xc0, 0x71, 0x30, 0x6a, 0x3a, 0x3b, 0x74, 0x03, 0x4e, 0x03, 0x55, 0x04, 0x1c,
+  0x05, 0x81, 0x5f, 0x05, 0x39, 0x10, 0x0d, 0xe8, 0x0c, 0x51, 0x15, 0x59, 0x05, 0xf3, 0x04, 0x36, 0x0b, 0x4c, 0x1a, 0xe0, 0x42, 0xa3, 0x84, 0x2c, 0x56, 0x4d, 0x46, 0x2d, 0x4e, 0x0c, 0x56, 0xec,
+  0x65, 0xec, 0x6d, 0x0d, 0x76, 0x2d, 0x6e, 0x4e, 0x5e, 0x2d, 0x56, 0xab, 0x55, 0xaa, 0x5d, 0x06, 0x4c, 0x28, 0x9e, 0x48, 0xbe, 0x07, 0xb6, 0x86, 0x95, 0xa6, 0x5c, 0x06, 0x44, 0xc7, 0x64, 0xc7,
+  0x74, 0xa7, 0x6c, 0xea, 0x84, 0x0b, 0x7d, 0x2a, 0x6d, 0xa7, 0x75, 0xcc, 0x8d, 0x1b, 0x86, 0x5f, 0x6d, 0xb5, 0xa4, 0xab, 0xdc, 0x68, 0xdc, 0xe6, 0xab, 0x24, 0x93, 0x62, 0x6a, 0xa0, 0x62, 0x22,
+  0x7b, 0x86, 0xac, 0x80, 0xcd, 0x40, 0xee, 0xe0, 0xfe, 0xa0, 0xf6, 0x40, 0xc6, 0x40, 0x9e, 0x44, 0x9e, 0x46, 0xae, 0x62, 0xb6, 0x40, 0xae, 0x40, 0xa6, 0x82, 0x20, 0xa6, 0x06, 0x00, 0x9e, 0x43,
+  0x7c, 0x23, 0xc1, 0x00, 0x98, 0x00, 0x88, 0x02, 0xea, 0xc7, 0xb4, 0x8e, 0x00, 0x00, 0x92, 0x00, 0x00, 0x29, 0x45, 0xce, 0x61, 0xe6, 0xa1, 0xd4, 0x80, 0xc9, 0x00, 0xc8, 0x64, 0xe1, 0x04, 0x92,
+  0xa0, 0x69, 0xe0, 0x79, 0x96, 0x5a, 0x1f, 0x13, 0x3f, 0x03, 0x75, 0x03, 0x4f, 0x03, 0x57, 0x04, 0x1c, 0x05, 0x1d, 0x05, 0x17, 0x05, 0xe9, 0x0c, 0x0b, 0x15, 0x4e, 0x2d, 0xb0, 0x64, 0x47, 0x94,
+  0x24, 0x2b, 0x40, 0x1a, 0x20, 0x43, 0xe0, 0x63, 0xcb, 0x55, 0x2d, 0x56, 0x0c, 0x6e, 0xec, 0x7d, 0x0e, 0x8e, 0x2f, 0x8e, 0x4f, 0x86, 0x4e, 0x66, 0x2d, 0x5e, 0xab, 0x65, 0x48, 0x54, 0x6a, 0x75,
+  0xe4, 0x73, 0x87, 0xad, 0x67, 0x8d, 0x81, 0xe6, 0x64, 0x1b, 0x48, 0x7d, 0xa9, 0x8d, 0x4b, 0xc6, 0x4a, 0xee, 0x29, 0xb5, 0xab, 0x7c, 0xcc, 0x6c, 0x2f, 0x65, 0x71, 0x65, 0x94, 0x75, 0x98, 0x7d,
+  0x74, 0x6c, 0x2c, 0x74, 0x09, 0x6c, 0xe7, 0x73, 0x04, 0x84, 0xa4, 0x93, 0xa6, 0x62, 0x81, 0x6a, 0x0f, 0x5a, 0xba, 0x49, 0xf5, 0x92, 0x28, 0xd5, 0x40, 0xf6, 0x62, 0xf6, 0x67, 0xfe, 0x27, 0xee,
+  0xe2, 0xc5, 0x81, 0x40, 0xa6, 0x03, 0x40, 0xae, 0x60, 0xae, 0x40, 0xae, 0x20, 0xae, 0x81, 0x20, 0xa6, 0x05, 0x61, 0x7c, 0x64, 0xa0, 0x03, 0xb0, 0x60, 0xd1, 0x80, 0xfa, 0x45, 0xcc, 0x8e, 0x00,
+  0x00, 0x91, 0x00, 0x00, 0x09, 0xed, 0x07, 0x24, 0xac, 0x20, 0x91, 0x00, 0xa8, 0x80, 0xdb, 0x83, 0xd3, 0x83, 0xe0, 0x60, 0x79, 0x89, 0x69, 0x5a, 0x4a, 0x81, 0x3f, 0x03, 0x41, 0x5f, 0x03, 0x59,
+  0x03, 0x31, 0x03, 0x78, 0x04, 0x3e, 0x05, 0x1c, 0x05, 0xee, 0x1c, 0xca, 0x0c, 0xeb, 0x14, 0x0c, 0x1d, 0x27, 0xbd, 0x60, 0xbc, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x4b, 0x00, 0x3b, 0x0a, 0x65, 0x0d,
+  0x9e, 0x0e, 0xb6, 0x50, 0xae, 0x51, 0x9e, 0xcf, 0x85, 0x0b, 0x8d, 0xcb, 0x7d, 0xc8, 0x95, 0xa7, 0x8d, 0xa7, 0x64, 0x89, 0x6c, 0x87, 0x6b, 0x49, 0x5c, 0xad, 0x8d, 0xce, 0xa5, 0xeb, 0xa5, 0xaa,
+  0x95, 0x8c, 0x95, 0xce, 0xd5, 0x69, 0xf6, 0x8b, 0xb5, 0xef, 0x64, 0x72, 0x65, 0xb3, 0x5d, 0x50, 0x55, 0x2b, 0x4c, 0xc8, 0x43, 0x25, 0x2b, 0x0e, 0x3c, 0x72, 0x34, 0x51, 0x44, 0x2c, 0x6c, 0x86,
+  0x6b, 0xe5, 0x52, 0x45, 0x73, 0x6f, 0x62, 0x7b, 0x61, 0xbe, 0xa8, 0x9a, 0xc2, 0x6f, 0xc4, 0xe4, 0xbc, 0x46, 0xcd, 0x46, 0xf5, 0x22, 0xec, 0xc0, 0xc4, 0xc0, 0xad, 0x20, 0x9e, 0x40, 0xa6, 0x40,
+  0xae, 0x81, 0x60, 0xb6, 0x07, 0x40, 0xae, 0xc5, 0x94, 0x6a, 0x98, 0x04, 0xc0, 0xe1, 0xf9, 0x00, 0xfb, 0x03, 0xd4, 0xff, 0x07, 0x8d, 0x00, 0x00, 0x91, 0x00, 0x00, 0x0b, 0xaa, 0x6d, 0x27, 0xbc,
+  0xa0, 0xc3, 0xf0, 0x91, 0x1a, 0x73, 0x10, 0xab, 0x00, 0xd0, 0x4f, 0x69, 0x5d, 0x32, 0x1f, 0x02, 0x3f, 0x02, 0xff, 0x02, 0x81, 0x5f, 0x03, 0x04, 0x17, 0x03, 0x1b, 0x04, 0xff, 0x04, 0xf7, 0x14,
+  0xc9, 0x1c, 0x81, 0xeb, 0x1c, 0x42, 0xec, 0x04, 0x29, 0xad, 0x80, 0xd5, 0x40, 0x63, 0x00, 0x01, 0xe0, 0x5b, 0xa0, 0x4b, 0x2a, 0x8d, 0x50, 0xb6, 0x2f, 0x9e, 0xee, 0x7d, 0x89, 0x94, 0xaa, 0x94,
+  0x09, 0xa4, 0xe8, 0x9c, 0x6a, 0x85, 0xaf, 0x95, 0x2f, 0x9d, 0x30, 0xad, 0x13, 0xce, 0xf1, 0xb5, 0xf1, 0xad, 0x70, 0x95, 0x50, 0x9d, 0xd4, 0xbd, 0x16, 0xce, 0xb5, 0xad, 0xb3, 0x8d, 0x93, 0x6d,
+  0x72, 0x65, 0x2f, 0x55, 0xaa, 0x44, 0x46, 0x44, 0xa7, 0x3b, 0x88, 0x33, 0x48, 0x33, 0x0e, 0x34, 0xd2, 0x34, 0x71, 0x34, 0x2f, 0x34, 0x2b, 0x54, 0x88, 0x74, 0x84, 0x84, 0xe5, 0x93, 0xae, 0xbb,
+  0xb3, 0xcb, 0xfb, 0x7b, 0x15, 0x5b, 0x65, 0x8a, 0x40, 0xb3, 0xa0, 0xdb, 0xc8, 0xca, 0x42, 0xca, 0xe0, 0xc2, 0x40, 0xb4, 0xa0, 0xa5, 0x20, 0xa6, 0x40, 0xa6, 0x40, 0xae, 0x60, 0xb6, 0x63, 0x9d,
+  0x47, 0xd1, 0x00, 0xf8, 0x20, 0xd8, 0x80, 0xc1, 0x24, 0xe3, 0x6a, 0x06, 0x8d, 0x00, 0x00, 0x91, 0x00, 0x00, 0x57, 0x33, 0x04, 0x13, 0x83, 0x66, 0x93, 0x32, 0x5a, 0x1d, 0x58, 0x0e, 0xd1, 0x55,
+  0xd4, 0x9e, 0xa4, 0x5f, 0x5b, 0x1f, 0x0a, 0x5f, 0x01, 0xbf, 0x01, 0xbf, 0x02, 0x1f, 0x03, 0xbe, 0x02, 0x7f, 0x03, 0x5d, 0x0c, 0xad, 0x24, 0xaa, 0x24, 0xcc, 0x2c, 0x0f, 0x3d, 0xf2, 0x14, 0x6e,
+  0x9d, 0x20, 0xee, 0x20, 0xa5, 0x00, 0x53, 0xc0, 0x2a, 0xa0, 0xad, 0x47, 0xe7, 0xed, 0x75, 0xab, 0x65, 0x89, 0x65, 0xa8, 0x9c, 0x4a, 0xac, 0x4a, 0xa4, 0x6c, 0xac, 0x35, 0xce, 0x97, 0xee, 0x35,
+  0xde, 0x91, 0xb5, 0x4f, 0x9d, 0x0f, 0x95, 0x52, 0xa5, 0xd5, 0xbd, 0xf6, 0xc5, 0x16, 0xb6, 0xd4, 0x8d, 0xb3, 0x6d, 0x72, 0x5d, 0xcd, 0x4c, 0x68, 0x44, 0x25, 0x44, 0x89, 0x4c, 0xcb, 0x4c, 0x8c,
+  0x44, 0x88, 0x2b, 0xaa, 0x33, 0x0b, 0x34, 0x0f, 0x35, 0x8c, 0x34, 0x29, 0x3c, 0xe6, 0x43, 0x26, 0x4c, 0xc7, 0x64, 0x28, 0xb5, 0xe2, 0xf5, 0x40, 0xdd, 0x48, 0x73, 0xec, 0x51, 0x4c, 0x51, 0x92,
+  0x59, 0x78, 0x8b, 0xf0, 0xb2, 0x20, 0xcb, 0xe0, 0xca, 0xa0, 0xc1, 0x40, 0xba, 0x20, 0xb4, 0x80, 0xb5, 0x00, 0xa6, 0x20, 0xa6, 0xa0, 0xa5, 0x08, 0xca, 0x06, 0xf8, 0x00, 0xb0, 0x00, 0x90, 0x84,
+  0xd2, 0x6a, 0x65, 0x8d, 0x00, 0x00, 0x91, 0x00, 0x00, 0x3c, 0x75, 0x54, 0xd7, 0x39, 0x2a, 0x29, 0xc0, 0xb4, 0x47, 0xe4, 0xca, 0xc9, 0x7c, 0xf6, 0x1e, 0xff, 0xbe, 0xf6, 0x1f, 0xde, 0x3f, 0xb5,
+  0x3f, 0x84, 0x3f, 0x4b, 0x5f, 0x02, 0xdf, 0x19, 0x5f, 0x73, 0xf5, 0x24, 0xea, 0x3c, 0xcf, 0x34, 0xd1, 0x2c, 0x14, 0x45, 0x14, 0x35, 0x31, 0x7d, 0xe2, 0xe5, 0x40, 0xbd, 0x20, 0xb4, 0xc0, 0xa2,
+  0xa0, 0xd5, 0xe4, 0xee, 0xcb, 0x7d, 0x8c, 0x85, 0xf3, 0xa5, 0x93, 0xc5, 0x53, 0xc5, 0xf0, 0xdc, 0xcf, 0xdc, 0x15, 0xce, 0x50, 0xa5, 0xce, 0x8c, 0x10, 0x95, 0xd5, 0xb5, 0x57, 0xce, 0x58, 0xce,
+  0xd5, 0xad, 0x73, 0x85, 0x71, 0x65, 0x0e, 0x55, 0xea, 0x3b, 0x09, 0x34, 0x66, 0x2b, 0xab, 0x3c, 0x2e, 0x3d, 0x6f, 0x55, 0xed, 0x44, 0x09, 0x34, 0x2b, 0x34, 0x4f, 0x35, 0x70, 0x35, 0x0e, 0x35,
+  0x27, 0x3c, 0x49, 0x3c, 0x81, 0x09, 0x34, 0x18, 0xa7, 0x23, 0x04, 0x74, 0xe0, 0xe5, 0x00, 0xe6, 0x40, 0x9c, 0x82, 0x83, 0x26, 0x6a, 0xf6, 0x4a, 0x3f, 0x07, 0xfa, 0x1c, 0x20, 0x68, 0xa0, 0xa2,
+  0x40, 0xc3, 0x20, 0xd3, 0xe0, 0xe2, 0x60, 0xfb, 0x00, 0xd4, 0x40, 0xb5, 0xc0, 0xa5, 0xe8, 0xba, 0x0e, 0xe8, 0x62, 0x88, 0x00, 0x80, 0x21, 0x8a, 0xa6, 0x6c, 0x8d, 0x00, 0x00, 0x91, 0x00, 0x00,
+  0x06, 0xf1, 0x83, 0xb6, 0x61, 0xca, 0xdd, 0x80, 0xff, 0x0a, 0xee, 0x13, 0xd4, 0xfd, 0xfe, 0x81, 0x1e, 0xff, 0x82, 0x3e, 0xff, 0x07, 0xdf, 0xee, 0x3f, 0xd6, 0x1e, 0xb5, 0x98, 0xa4, 0x10, 0x1d,
+  0xd1, 0x1c, 0xf4, 0x14, 0x92, 0x1c, 0x81, 0x90, 0x34, 0x1b, 0xb2, 0x3c, 0x69, 0xbc, 0xa0, 0xd4, 0xc0, 0xec, 0xe1, 0xfc, 0xc3, 0xdc, 0xc2, 0xcb, 0xb2, 0xb5, 0xd9, 0xde, 0x1b, 0xef, 0x32, 0xd5,
+  0xeb, 0xbb, 0xad, 0xa4, 0xad, 0x8c, 0x10, 0x8d, 0xb3, 0xad, 0x37, 0xce, 0x58, 0xd6, 0x17, 0xc6, 0x93, 0x9d, 0x31, 0x7d, 0xef, 0x6c, 0xec, 0x64, 0xaa, 0x54, 0x69, 0x44, 0x29, 0x34, 0x8b, 0x3c,
+  0x6c, 0x34, 0x81, 0x2f, 0x35, 0x19, 0x0e, 0x45, 0x0c, 0x35, 0x0e, 0x35, 0x70, 0x3d, 0x91, 0x3d, 0x50, 0x3d, 0xcd, 0x44, 0x4a, 0x3c, 0x4c, 0x2c, 0xcb, 0x13, 0x8b, 0x03, 0x8c, 0x03, 0xce, 0x03,
+  0x51, 0x34, 0x0b, 0x5c, 0xc0, 0x7b, 0x60, 0xa4, 0xc0, 0x8b, 0x28, 0x7b, 0x18, 0x7d, 0x94, 0x6b, 0x00, 0x28, 0x00, 0x00, 0x00, 0x49, 0x60, 0x9a, 0xa0, 0xd3, 0x81, 0x40, 0xfc, 0x07, 0x20, 0xf4,
+  0x00, 0xc4, 0xc3, 0xba, 0xa9, 0xa8, 0xe3, 0x28, 0x23, 0x49, 0x84, 0x62, 0xa7, 0x64, 0x8d, 0x00, 0x00, 0x90, 0x00, 0x00, 0x06, 0x10, 0x7e, 0x2d, 0xd4, 0x26, 0xd9, 0x60, 0xfb, 0x04, 0xfd, 0x0c,
+  0xd4, 0x36, 0xd5, 0x83, 0x1e, 0xff, 0x00, 0x3e, 0xff, 0x81, 0x5e, 0xff, 0x42, 0xfa, 0xe6, 0xf4, 0xb5, 0x8c, 0x54, 0xd0, 0x3c, 0x11, 0x3d, 0x11, 0x35, 0x6e, 0x24, 0x73, 0x24, 0x39, 0x4d, 0x3e,
+  0x8e, 0x72, 0xdc, 0x20, 0xf4, 0xc0, 0xe4, 0xe1, 0xc3, 0xaa, 0xcb, 0x09, 0xda, 0x53, 0xe5, 0x76, 0xce, 0x2f, 0x9d, 0x6b, 0x7c, 0xef, 0x8c, 0xb3, 0xad, 0x77, 0xce, 0xb9, 0xde, 0x78, 0xce, 0xb5,
+  0xad, 0x31, 0x8d, 0xef, 0x74, 0xad, 0x64, 0x0a, 0x4c, 0x69, 0x54, 0xa9, 0x54, 0x2c, 0x55, 0x8e, 0x5d, 0x8c, 0x44, 0xed, 0x3c, 0xcd, 0x34, 0xac, 0x2c, 0x0e, 0x2d, 0x6f, 0x35, 0x70, 0x35, 0x50,
+  0x2d, 0x30, 0x35, 0x30, 0x45, 0x71, 0x4d, 0xef, 0x44, 0x51, 0x0c, 0x32, 0x04, 0x53, 0x04, 0x74, 0x04, 0x95, 0x04, 0x96, 0x04, 0x54, 0x04, 0xad, 0x43, 0xc9, 0x2a, 0x20, 0x32, 0x01, 0x5b, 0x40,
+  0x6b, 0x00, 0x7b, 0x00, 0x83, 0x00, 0x73, 0xc0, 0x6a, 0x60, 0x62, 0x00, 0x5a, 0x60, 0x41, 0x00, 0x82, 0xc0, 0xd3, 0x81, 0xc0, 0xfc, 0x05, 0xc0, 0xdc, 0xa0, 0x93, 0x47, 0x02, 0x8c, 0x02, 0xc9,
+  0x02, 0x07, 0x3c, 0x8d, 0x00, 0x00, 0x90, 0x00, 0x00, 0x08, 0x96, 0x8c, 0x1c, 0xec, 0xd1, 0xfa, 0x20, 0xf9, 0x06, 0xd0, 0x0a, 0xb0, 0xd8, 0xdd, 0x3f, 0xff, 0x1e, 0xff, 0x81, 0x3e, 0xff, 0x2d,
+  0xfc, 0xf6, 0x57, 0xd6, 0x70, 0x9d, 0xea, 0x74, 0x4a, 0x44, 0x0a, 0x24, 0x6a, 0x44, 0xed, 0x44, 0x92, 0x5d, 0x99, 0x75, 0x7f, 0x96, 0x3f, 0xd7, 0xdf, 0xef, 0xd8, 0xfe, 0x60, 0xf4, 0x60, 0xa3,
+  0xe0, 0x58, 0x84, 0x99, 0x08, 0xba, 0xaa, 0xcb, 0xad, 0x7c, 0x52, 0x9d, 0x57, 0xc6, 0xfa, 0xe6, 0xda, 0xe6, 0x57, 0xce, 0x93, 0x9d, 0x0f, 0x7d, 0xed, 0x74, 0x8b, 0x6c, 0xc9, 0x4b, 0xc9, 0x43,
+  0x8a, 0x3b, 0xac, 0x4c, 0x8f, 0x5d, 0xaf, 0x5d, 0x6d, 0x5d, 0xc9, 0x2b, 0x8c, 0x2c, 0x6f, 0x35, 0x70, 0x2d, 0x6f, 0x25, 0x2e, 0x2d, 0x0f, 0x35, 0x10, 0x35, 0x51, 0x3d, 0x81, 0x72, 0x3d, 0x00,
+  0xf0, 0x2c, 0x81, 0xd7, 0x04, 0x83, 0xb6, 0x04, 0x0a, 0xd0, 0x3b, 0xb1, 0x7c, 0x4d, 0x3b, 0xe0, 0x00, 0x43, 0x01, 0xc3, 0x19, 0x8c, 0x3a, 0xe8, 0x52, 0x00, 0x6b, 0x20, 0x73, 0x40, 0x73, 0x81,
+  0x20, 0x73, 0x0a, 0xe0, 0x6a, 0x40, 0x62, 0xe0, 0x93, 0x20, 0xdd, 0x80, 0xed, 0x20, 0xf6, 0x62, 0xcd, 0x86, 0x53, 0x83, 0x62, 0x64, 0x6b, 0xf5, 0x07, 0x8c, 0x00, 0x00, 0x90, 0x00, 0x00, 0x3b,
+  0x9a, 0xb4, 0x1f, 0xda, 0x7d, 0xf2, 0xaf, 0xe9, 0x08, 0xb0, 0x48, 0xaa, 0xbb, 0xf6, 0x5e, 0xff, 0x3d, 0xff, 0xdb, 0xf6, 0xf5, 0xc5, 0x6b, 0x95, 0xe0, 0x6c, 0x84, 0x6c, 0xaa, 0x64, 0x4d, 0x34,
+  0x8e, 0x34, 0xcf, 0x54, 0xd7, 0x8d, 0x9d, 0xae, 0xdd, 0xc6, 0xdf, 0xf7, 0xff, 0xff, 0xbc, 0xf7, 0x77, 0xee, 0x28, 0xf3, 0x20, 0xe3, 0x20, 0xb2, 0x40, 0x89, 0x00, 0x68, 0xc9, 0x8a, 0xf9, 0xde,
+  0x5c, 0xef, 0xda, 0xde, 0x16, 0xb6, 0x72, 0x95, 0x0f, 0x7d, 0xed, 0x74, 0xec, 0x6c, 0xcb, 0x6c, 0x6b, 0x5c, 0x2b, 0x4c, 0xc9, 0x43, 0x2c, 0x4c, 0x8c, 0x4c, 0x4e, 0x55, 0x4d, 0x4d, 0x4e, 0x45,
+  0x8f, 0x35, 0xb0, 0x35, 0x6f, 0x2d, 0x2e, 0x2d, 0xed, 0x24, 0x0f, 0x2d, 0x30, 0x2d, 0x11, 0x25, 0x11, 0x15, 0x52, 0x1d, 0x72, 0x3d, 0xf0, 0x2c, 0x81, 0xd7, 0x04, 0x00, 0xd6, 0x04, 0x81, 0xb6,
+  0x04, 0x18, 0x75, 0x04, 0x0e, 0x6c, 0xf7, 0x8d, 0xaf, 0x43, 0xa0, 0x00, 0x24, 0x01, 0x2a, 0x01, 0xbc, 0x01, 0x74, 0x01, 0xe0, 0x29, 0x81, 0x42, 0xa0, 0x4a, 0x60, 0x52, 0x20, 0x5a, 0xc0, 0x5a,
+  0xa0, 0x53, 0xe0, 0x42, 0xc0, 0x39, 0xc0, 0x38, 0x40, 0x8b, 0x60, 0xbc, 0x40, 0x83, 0x20, 0xbc, 0x64, 0x8b, 0x2a, 0x05, 0x8c, 0x00, 0x00, 0x90, 0x00, 0x00, 0x0d, 0xfa, 0xcb, 0x7d, 0xea, 0xba,
+  0xc2, 0x15, 0x88, 0x38, 0x9a, 0x2f, 0xb4, 0x1c, 0xff, 0x9a, 0xe6, 0x93, 0xb5, 0xc9, 0x84, 0x40, 0x54, 0xc1, 0x64, 0x65, 0x85, 0x0b, 0x7d, 0x81, 0x8f, 0x4c, 0x2b, 0x33, 0x85, 0xf8, 0xad, 0x3a,
+  0xc6, 0x94, 0xc5, 0x71, 0xe6, 0x38, 0xef, 0x7b, 0xef, 0x9c, 0xf7, 0x1c, 0xef, 0x4b, 0xd2, 0xa7, 0xe2, 0x68, 0xba, 0x00, 0x89, 0xc0, 0x70, 0x44, 0x92, 0x57, 0xd6, 0x17, 0xb6, 0x52, 0x95, 0x2f,
+  0x7d, 0xcd, 0x7c, 0x6b, 0x74, 0x87, 0x8b, 0x6a, 0x74, 0x2d, 0x65, 0x2f, 0x65, 0x6c, 0x4c, 0x6b, 0x4c, 0xaa, 0x3b, 0x8b, 0x3c, 0x4d, 0x45, 0x8f, 0x45, 0xaf, 0x3d, 0x6e, 0x3d, 0x2d, 0x35, 0x0d,
+  0x35, 0x0f, 0x2d, 0x10, 0x1d, 0xf0, 0x0c, 0xf0, 0x04, 0xf1, 0x0c, 0x11, 0x0d, 0x32, 0x15, 0x31, 0x2d, 0x8e, 0x1c, 0x84, 0xd7, 0x04, 0x18, 0x11, 0x3c, 0x33, 0x8d, 0x9b, 0x96, 0xf0, 0x4b, 0x40,
+  0x00, 0x22, 0x01, 0x33, 0x01, 0x5f, 0x02, 0x57, 0x01, 0x00, 0x00, 0xc0, 0x00, 0xe0, 0x21, 0xa4, 0x42, 0xc6, 0x4a, 0x82, 0x1b, 0x21, 0x0c, 0xa0, 0x43, 0x20, 0x3b, 0x60, 0x2a, 0x61, 0x02, 0xe3,
+  0x02, 0x00, 0x48, 0x80, 0x78, 0xc3, 0x8a, 0x48, 0x6d, 0x8c, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x25, 0xad, 0x5e, 0x35, 0xc3, 0x10, 0xd0, 0x83, 0xc0, 0xe6, 0xc8, 0x72, 0xbb, 0xad, 0xa4, 0xf0, 0xa4,
+  0xe8, 0x83, 0xa4, 0x73, 0x46, 0x6c, 0x04, 0x7d, 0x80, 0x5c, 0xc2, 0x6c, 0xf2, 0x7c, 0xd8, 0xad, 0x52, 0x9d, 0xd1, 0x8c, 0xcf, 0x94, 0x91, 0xcd, 0xf3, 0xd5, 0x58, 0xce, 0x3c, 0xe7, 0x9d, 0xf7,
+  0x9d, 0xff, 0x5d, 0xf7, 0x31, 0xbc, 0x8b, 0x83, 0x0c, 0xab, 0x67, 0xa0, 0xa4, 0x90, 0x20, 0xdb, 0x0c, 0xcd, 0x50, 0x85, 0xed, 0x74, 0x49, 0x6c, 0x46, 0x83, 0x87, 0x8b, 0x81, 0x2a, 0x7c, 0x15,
+  0x2e, 0x65, 0xcc, 0x5c, 0x88, 0x3b, 0x4b, 0x3c, 0x2d, 0x4d, 0x6e, 0x45, 0x4c, 0x3d, 0x2c, 0x45, 0x2c, 0x4d, 0x2d, 0x3d, 0x2f, 0x35, 0x30, 0x25, 0x30, 0x0d, 0x10, 0x05, 0xd0, 0x04, 0xf0, 0x0c,
+  0x11, 0x15, 0x11, 0x0d, 0x32, 0x0d, 0xce, 0x1c, 0x2d, 0x0c, 0xd9, 0x04, 0x81, 0xd8, 0x04, 0x1a, 0xd7, 0x04, 0xb6, 0x04, 0x2f, 0x6c, 0x59, 0x9e, 0xbb, 0x9e, 0x31, 0x54, 0x00, 0x00, 0x02, 0x01,
+  0x98, 0x01, 0x1f, 0x03, 0xd9, 0x01, 0x60, 0x00, 0xe8, 0x01, 0xcb, 0x02, 0xec, 0x02, 0xab, 0x03, 0xa0, 0x24, 0xe0, 0x1a, 0xc0, 0x19, 0x60, 0x2a, 0xe2, 0x32, 0x04, 0x5c, 0x09, 0x8d, 0xc0, 0xc2,
+  0x20, 0xc2, 0x83, 0x93, 0x07, 0x56, 0x8c, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x25, 0x48, 0x8d, 0xe7, 0xea, 0x40, 0xf1, 0x00, 0xc0, 0xc0, 0xd9, 0x28, 0xbb, 0xc8, 0x9c, 0x20, 0x7b, 0x61, 0x8a, 0x24,
+  0xab, 0x66, 0xa4, 0xe9, 0xbd, 0xab, 0x9d, 0x0e, 0xad, 0x8f, 0xb4, 0xb1, 0x9c, 0xce, 0x9c, 0x72, 0xbd, 0xd3, 0xcd, 0x93, 0xbd, 0xd5, 0xbd, 0x34, 0xa5, 0x75, 0xb5, 0x1c, 0xe7, 0xbf, 0xd6, 0x5f,
+  0xa5, 0x55, 0xa5, 0x30, 0x64, 0x71, 0xb2, 0x6a, 0xa8, 0xab, 0xa8, 0x02, 0xdb, 0xa6, 0xd4, 0x69, 0x5c, 0x69, 0x54, 0x8b, 0x64, 0x4a, 0x74, 0x08, 0x7c, 0x81, 0xc8, 0x83, 0x04, 0xaa, 0x54, 0xcb,
+  0x4c, 0xec, 0x44, 0x2c, 0x45, 0x0b, 0x45, 0x81, 0xea, 0x44, 0x03, 0x2c, 0x4d, 0x6f, 0x45, 0x70, 0x2d, 0x50, 0x15, 0x81, 0x30, 0x0d, 0x07, 0x10, 0x05, 0xf0, 0x04, 0x10, 0x0d, 0x51, 0x15, 0x52,
+  0x15, 0x31, 0x15, 0x6a, 0x1c, 0x2f, 0x0c, 0x81, 0xda, 0x04, 0x81, 0xd8, 0x04, 0x01, 0x33, 0x34, 0x53, 0x95, 0x81, 0xdb, 0xa6, 0x14, 0x51, 0x5c, 0x00, 0x00, 0xe5, 0x00, 0x99, 0x01, 0x1f, 0x03,
+  0x79, 0x02, 0x2f, 0x03, 0xf2, 0x03, 0x90, 0x03, 0xed, 0x02, 0x67, 0x1c, 0xc0, 0x2c, 0x20, 0x23, 0x20, 0x01, 0x41, 0x29, 0x27, 0x5a, 0xa3, 0x9a, 0x41, 0x82, 0xe0, 0x9a, 0x62, 0xb4, 0x85, 0x8d,
+  0x8d, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x2a, 0x46, 0x84, 0x60, 0xda, 0xe0, 0xf8, 0x32, 0xda, 0x76, 0xe3, 0x4b, 0xd3, 0xeb, 0xdc, 0x40, 0xbb, 0x40, 0x9b, 0x60, 0x6a, 0xca, 0x9a, 0x4e, 0xd4, 0xf4,
+  0xbd, 0x71, 0xa5, 0xcf, 0xb4, 0xd4, 0xcd, 0xf5, 0xcd, 0x52, 0xb5, 0x10, 0xa5, 0x0f, 0x7c, 0x14, 0x74, 0x7a, 0x74, 0x7a, 0x6c, 0x7a, 0x64, 0xda, 0x33, 0x55, 0x03, 0x15, 0x95, 0xfe, 0x74, 0x59,
+  0xaa, 0x8c, 0xb0, 0xcc, 0xa0, 0x49, 0xa1, 0x16, 0xbc, 0xcd, 0x64, 0xec, 0x64, 0xec, 0x5c, 0xa8, 0x7b, 0xc8, 0x7b, 0xe8, 0x7b, 0x6a, 0x74, 0x0b, 0x4d, 0xeb, 0x4c, 0xc9, 0x44, 0x81, 0x88, 0x44,
+  0x15, 0xa9, 0x4c, 0xca, 0x4c, 0x89, 0x3c, 0xcb, 0x2c, 0x0e, 0x25, 0x50, 0x15, 0x51, 0x0d, 0x31, 0x05, 0x51, 0x05, 0xf0, 0x04, 0x31, 0x0d, 0x52, 0x15, 0x72, 0x15, 0x0f, 0x15, 0x47, 0x1c, 0x50,
+  0x0c, 0xfc, 0x04, 0xdb, 0x04, 0xda, 0x04, 0x98, 0x04, 0x2f, 0x74, 0x58, 0xae, 0x81, 0xfc, 0xae, 0x13, 0x72, 0x64, 0x00, 0x00, 0xc6, 0x09, 0xb2, 0x11, 0x11, 0x19, 0x38, 0x09, 0x53, 0x02, 0x0f,
+  0x03, 0x50, 0x03, 0x8d, 0x03, 0x63, 0x1d, 0xa0, 0x24, 0x2b, 0x03, 0x08, 0x42, 0xa0, 0x72, 0x01, 0xb3, 0x00, 0xcc, 0x80, 0x73, 0x23, 0x3c, 0x65, 0x0d, 0x8e, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x2f,
+  0x82, 0xbc, 0x00, 0xd2, 0xd3, 0xeb, 0x1e, 0xe4, 0xba, 0xf3, 0xa0, 0xe9, 0x20, 0xd1, 0x20, 0xd2, 0xe7, 0xec, 0xaa, 0xbb, 0x8b, 0xbb, 0x4d, 0xbc, 0x92, 0xbd, 0x15, 0xce, 0x93, 0xc5, 0xae, 0xa4,
+  0x6d, 0x9c, 0xaf, 0x6b, 0x34, 0x74, 0x38, 0x6c, 0xf8, 0x3b, 0xd4, 0x23, 0xf1, 0x2b, 0x11, 0x2c, 0x50, 0x34, 0xad, 0x13, 0xf5, 0x7c, 0xbf, 0x86, 0x79, 0xbc, 0x6e, 0xb8, 0x0a, 0x98, 0xf7, 0xd3,
+  0x5d, 0xed, 0xcf, 0x74, 0xaa, 0x5c, 0x8a, 0x5c, 0xc8, 0x73, 0x49, 0x64, 0xeb, 0x44, 0xaa, 0x44, 0x89, 0x4c, 0x68, 0x44, 0x89, 0x4c, 0x8a, 0x4c, 0xaa, 0x4c, 0x68, 0x44, 0x47, 0x3c, 0x47, 0x34,
+  0x81, 0x67, 0x34, 0x05, 0x89, 0x34, 0xcc, 0x2c, 0x0f, 0x1d, 0x51, 0x0d, 0x11, 0x05, 0x32, 0x0d, 0x81, 0x52, 0x15, 0x1d, 0xac, 0x14, 0x26, 0x14, 0x72, 0x0c, 0x1d, 0x05, 0xdc, 0x04, 0xdb, 0x04,
+  0x55, 0x44, 0x31, 0xa5, 0xfb, 0xb6, 0x1c, 0xb7, 0xfa, 0xa6, 0xb0, 0x5d, 0x20, 0x04, 0xa1, 0x0a, 0xc6, 0x18, 0x07, 0x10, 0x19, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa5, 0x00, 0xa7, 0x53, 0xc0, 0x95,
+  0xd1, 0x85, 0x51, 0x73, 0xa8, 0x61, 0x60, 0x89, 0xc0, 0x99, 0xa0, 0xb3, 0x84, 0x85, 0xed, 0x07, 0x8f, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x17, 0xb0, 0x06, 0x43, 0xed, 0xb0, 0xfd, 0x9c, 0xfe, 0x76,
+  0xfc, 0x28, 0xea, 0xc0, 0xd9, 0xa9, 0xe9, 0xab, 0xe2, 0xaf, 0xd4, 0xef, 0xc4, 0x92, 0xc5, 0xb4, 0xc5, 0x30, 0xc5, 0x6a, 0xbc, 0xe9, 0x6a, 0x31, 0x63, 0xb7, 0x6b, 0xb8, 0x53, 0xb4, 0x2b, 0x70,
+  0x03, 0x8e, 0x13, 0xae, 0x1b, 0x30, 0x2c, 0x81, 0x10, 0x24, 0x0c, 0xf0, 0x13, 0x92, 0x64, 0xb3, 0xb5, 0x92, 0xac, 0x13, 0xa3, 0xb2, 0xc2, 0x9e, 0xfd, 0xbe, 0xfd, 0xb2, 0x84, 0xc9, 0x54, 0xca,
+  0x5c, 0xaa, 0x54, 0x88, 0x44, 0x81, 0x68, 0x4c, 0x00, 0x89, 0x4c, 0x81, 0xaa, 0x4c, 0x02, 0x89, 0x44, 0x69, 0x44, 0x68, 0x44, 0x81, 0x68, 0x3c, 0x00, 0x89, 0x3c, 0x81, 0x88, 0x3c, 0x11, 0x67,
+  0x3c, 0x87, 0x34, 0xaa, 0x2c, 0xad, 0x14, 0x10, 0x05, 0x73, 0x15, 0x0f, 0x0d, 0x68, 0x04, 0x26, 0x04, 0x93, 0x04, 0x1e, 0x05, 0xfd, 0x04, 0xdb, 0x04, 0x71, 0x8c, 0x36, 0xae, 0xb9, 0xa6, 0xd3,
+  0x7d, 0xca, 0x4d, 0x81, 0xc0, 0x26, 0x10, 0x27, 0x0d, 0x0d, 0x10, 0x08, 0x08, 0x12, 0x00, 0x0d, 0x00, 0x0a, 0x20, 0x8f, 0xa0, 0x81, 0xe2, 0xe0, 0xec, 0x8b, 0xdc, 0xc5, 0xe9, 0x20, 0xca, 0x60,
+  0x81, 0x80, 0x41, 0x00, 0x02, 0xa3, 0x03, 0x25, 0x05, 0x8f, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x24, 0x4f, 0x9e, 0x88, 0xf5, 0xad, 0xfd, 0xac, 0xeb, 0x00, 0xe0, 0x02, 0xeb, 0xe4, 0xe3, 0x6e, 0xdc,
+  0x51, 0xd5, 0xd3, 0xcd, 0x51, 0xc5, 0x2b, 0xa4, 0xe8, 0x7a, 0xec, 0x92, 0x90, 0x93, 0x74, 0x53, 0x55, 0x2b, 0x34, 0x03, 0x93, 0x03, 0xf1, 0x13, 0x8d, 0x1b, 0xce, 0x23, 0xcf, 0x13, 0xf0, 0x03,
+  0x32, 0x04, 0x53, 0x14, 0x51, 0x1c, 0x10, 0x2c, 0xee, 0x8c, 0x71, 0xa5, 0x58, 0x74, 0xfb, 0xdc, 0x1f, 0xfe, 0x3f, 0xfe, 0x35, 0xb5, 0x86, 0x3c, 0x67, 0x44, 0x81, 0x47, 0x4c, 0x03, 0x89, 0x54,
+  0xaa, 0x54, 0x89, 0x4c, 0x68, 0x44, 0x81, 0x89, 0x44, 0x03, 0x69, 0x44, 0x89, 0x44, 0x89, 0x3c, 0xaa, 0x3c, 0x81, 0xa9, 0x3c, 0x25, 0x88, 0x3c, 0x88, 0x34, 0x67, 0x2c, 0x47, 0x24, 0xac, 0x44,
+  0x71, 0x5d, 0x50, 0x4d, 0xed, 0x34, 0x0d, 0x55, 0x68, 0x2c, 0x94, 0x0c, 0x3e, 0x1d, 0x1e, 0x05, 0x97, 0x3c, 0x8b, 0x8c, 0xee, 0x64, 0xe6, 0x2b, 0xa0, 0x03, 0x40, 0x1e, 0xe0, 0x2e, 0x00, 0x27,
+  0x6d, 0x04, 0x13, 0x00, 0x15, 0x00, 0xb8, 0x00, 0x4e, 0x01, 0x14, 0xa9, 0xd9, 0xfb, 0x83, 0xfe, 0x60, 0xff, 0x20, 0xc4, 0x01, 0xaa, 0x40, 0x92, 0xa0, 0x19, 0x61, 0x02, 0x62, 0x03, 0x23, 0x04,
+  0x08, 0x06, 0x8f, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x13, 0xaf, 0xb6, 0xea, 0xf4, 0x2d, 0xfb, 0xc8, 0xf1, 0x0a, 0xf3, 0x48, 0xec, 0xb1, 0xdd, 0x72, 0xc5, 0x2d, 0x94, 0xa9, 0x8b, 0xed, 0xab, 0x34,
+  0x7b, 0x76, 0x5b, 0xb5, 0x23, 0x72, 0x03, 0x4f, 0x03, 0x2f, 0x03, 0x4f, 0x03, 0xb1, 0x03, 0xd1, 0x03, 0x81, 0xf0, 0x03, 0x13, 0xd0, 0x03, 0xf1, 0x03, 0xb5, 0x04, 0x94, 0x04, 0x10, 0x04, 0x8e,
+  0x03, 0xad, 0x9d, 0x8f, 0xde, 0x15, 0xc3, 0x30, 0xea, 0xd4, 0xfb, 0x9c, 0xfd, 0x99, 0xd5, 0x47, 0x3c, 0x47, 0x44, 0x69, 0x4c, 0x8a, 0x54, 0x68, 0x4c, 0x48, 0x44, 0x68, 0x44, 0x81, 0x89, 0x4c,
+  0x02, 0x89, 0x44, 0x68, 0x44, 0x89, 0x44, 0x81, 0xa9, 0x3c, 0x25, 0x89, 0x3c, 0x88, 0x34, 0x87, 0x2c, 0xcb, 0x3c, 0x71, 0x6d, 0xd5, 0x85, 0xb4, 0x75, 0x72, 0x75, 0xb3, 0x95, 0x15, 0x9e, 0xb4,
+  0x8d, 0x73, 0x85, 0x39, 0xa6, 0xbd, 0xb6, 0x9d, 0xae, 0x74, 0x8d, 0x29, 0x54, 0x20, 0x03, 0xe0, 0x02, 0x40, 0x1d, 0xe0, 0x36, 0x00, 0x2f, 0x80, 0x1e, 0xf1, 0x01, 0x16, 0x00, 0xb5, 0x01, 0x51,
+  0x02, 0x6a, 0x02, 0xc6, 0xc0, 0xe6, 0xf8, 0x21, 0xfd, 0x01, 0xd6, 0xc0, 0x72, 0x00, 0x02, 0xa1, 0x02, 0x82, 0x03, 0x64, 0x0c, 0x86, 0x1e, 0x91, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x24, 0xe5, 0x05,
+  0xca, 0xe3, 0x8b, 0xfb, 0x84, 0xfc, 0x86, 0xe4, 0x03, 0xd3, 0xec, 0xe2, 0xae, 0xca, 0xa3, 0x89, 0x67, 0xb2, 0x4e, 0xa2, 0xf1, 0xb1, 0xef, 0xb9, 0x4c, 0xaa, 0x89, 0xa2, 0x68, 0xa2, 0xe9, 0xa2,
+  0x69, 0xab, 0xaa, 0x8a, 0xb0, 0x8a, 0xf0, 0xa2, 0x4d, 0x9b, 0x6e, 0x93, 0xcf, 0x93, 0x56, 0x65, 0xf5, 0x44, 0xaf, 0x13, 0x2d, 0x03, 0x2b, 0x7c, 0xe7, 0xbb, 0x13, 0xe8, 0x13, 0xf0, 0x01, 0xe0,
+  0xa7, 0xc0, 0xb6, 0x9b, 0xae, 0x5c, 0x47, 0x44, 0x81, 0x68, 0x4c, 0x00, 0x48, 0x4c, 0x81, 0x68, 0x4c, 0x00, 0x69, 0x4c, 0x81, 0x89, 0x4c, 0x26, 0x89, 0x44, 0xa9, 0x44, 0x89, 0x3c, 0x88, 0x34,
+  0x87, 0x2c, 0xeb, 0x54, 0xf3, 0x8d, 0xb9, 0xb6, 0x37, 0xa6, 0xb4, 0x95, 0x36, 0xb6, 0x78, 0xbe, 0x17, 0x9e, 0xf7, 0x9d, 0x7a, 0xb6, 0xfd, 0xce, 0x1e, 0xd7, 0x3e, 0xd7, 0xbb, 0xce, 0x17, 0xbe,
+  0xf6, 0xbd, 0x94, 0xad, 0xf0, 0x84, 0xc5, 0x25, 0xc0, 0x36, 0x20, 0x2f, 0x21, 0x1d, 0xeb, 0x68, 0x2f, 0x83, 0xea, 0x22, 0x86, 0x02, 0x69, 0x62, 0xc8, 0xd0, 0xe0, 0xc0, 0x00, 0x79, 0xc0, 0x01,
+  0xc1, 0x02, 0xc3, 0x03, 0xa4, 0x0c, 0x94, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x08, 0xe0, 0x07, 0xc3, 0x03, 0xc7, 0x7b, 0x89, 0xf3, 0x06, 0xf2, 0xe7, 0xe8, 0x04, 0xf0, 0x0d, 0xf8, 0x0b, 0xf8, 0x81,
+  0x00, 0xc8, 0x1f, 0x00, 0xb0, 0x00, 0xc0, 0x00, 0xe8, 0x40, 0xe0, 0x40, 0xd0, 0x00, 0xc8, 0xa0, 0xe2, 0xe0, 0xeb, 0x49, 0xc8, 0x15, 0xd8, 0xcb, 0xf8, 0x80, 0xf9, 0x40, 0xfa, 0x45, 0xc3, 0xdb,
+  0xb6, 0x7e, 0xc7, 0xdc, 0xae, 0x39, 0x96, 0x15, 0x9d, 0x28, 0xb9, 0x16, 0xb8, 0x5c, 0xc0, 0x32, 0x68, 0x04, 0x08, 0x5c, 0x32, 0xd4, 0x74, 0x66, 0x44, 0x89, 0x4c, 0x89, 0x54, 0x68, 0x4c, 0x69,
+  0x4c, 0x89, 0x54, 0x82, 0x89, 0x4c, 0x05, 0x88, 0x44, 0x88, 0x3c, 0x88, 0x44, 0x0d, 0x6d, 0xd3, 0x95, 0x36, 0xae, 0x81, 0x16, 0xae, 0x1e, 0x78, 0xc6, 0x99, 0xc6, 0x7a, 0xb6, 0x33, 0x75, 0x59,
+  0xae, 0x1d, 0xd7, 0x5e, 0xdf, 0x3e, 0xdf, 0x3e, 0xd7, 0x1e, 0xd7, 0x38, 0xbe, 0xf7, 0xbd, 0x17, 0xbe, 0x37, 0xc6, 0x54, 0x95, 0xaa, 0x02, 0x0e, 0x04, 0x13, 0x0e, 0x28, 0x34, 0x60, 0x4a, 0x00,
+  0x7b, 0x03, 0x5b, 0x06, 0x2b, 0x66, 0x6a, 0xc4, 0x71, 0x60, 0x02, 0x22, 0x03, 0xe2, 0x03, 0x65, 0x15, 0x00, 0x00, 0xf0, 0x87, 0x94, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x14, 0x00, 0x02, 0x41, 0x02,
+  0x20, 0x02, 0x80, 0x69, 0x69, 0xd1, 0x49, 0xf9, 0x02, 0xe0, 0x08, 0xc8, 0x05, 0xea, 0xc0, 0xfc, 0x40, 0xf5, 0x00, 0xdc, 0x01, 0xf1, 0x00, 0xf8, 0x00, 0xf0, 0x80, 0xc8, 0xa0, 0xd0, 0x60, 0xd1,
+  0x00, 0xd2, 0x8a, 0xe1, 0xab, 0xf9, 0x81, 0xe0, 0xf9, 0x10, 0xc0, 0xaa, 0x2b, 0x44, 0x1c, 0xb7, 0xbf, 0xcf, 0x9f, 0xcf, 0xbf, 0xcf, 0x5e, 0xc7, 0xcd, 0xdb, 0x0c, 0xb8, 0x19, 0x60, 0x33, 0x50,
+  0xb2, 0x20, 0x1f, 0x22, 0xb4, 0x74, 0x87, 0x4c, 0x69, 0x4c, 0x8a, 0x54, 0x81, 0x89, 0x54, 0x26, 0x8a, 0x54, 0x8a, 0x4c, 0x89, 0x4c, 0x69, 0x4c, 0xcb, 0x5c, 0x4f, 0x7d, 0xf4, 0xa5, 0x16, 0xae,
+  0xd5, 0xa5, 0x16, 0xb6, 0x78, 0xc6, 0x37, 0xbe, 0xf2, 0x8c, 0x7b, 0xae, 0x7f, 0xcf, 0x39, 0x96, 0x4e, 0x3c, 0xf1, 0x6c, 0xb6, 0x95, 0xbb, 0xbe, 0x3d, 0xcf, 0xdb, 0xce, 0xd6, 0xbd, 0x17, 0xbe,
+  0x37, 0xc6, 0x17, 0xbe, 0x2e, 0x5c, 0x8d, 0x4c, 0xbd, 0x3e, 0xfc, 0x05, 0xa6, 0x02, 0x20, 0x03, 0x60, 0x3b, 0x00, 0x43, 0xa0, 0x22, 0xc0, 0x02, 0x61, 0x03, 0x23, 0x04, 0xa6, 0x15, 0x82, 0x00,
+  0x00, 0x00, 0xeb, 0x5f, 0x94, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x36, 0xa0, 0x02, 0xa0, 0x01, 0x60, 0x01, 0x00, 0x01, 0xa0, 0x30, 0xc0, 0xc8, 0xa4, 0xf1, 0xc0, 0xf1, 0x84, 0xf5, 0xc8, 0xff, 0x60,
+  0xff, 0xe0, 0xfd, 0x80, 0xda, 0x00, 0xf2, 0x80, 0xe8, 0x00, 0xa8, 0xa0, 0xc8, 0xc0, 0xe9, 0x00, 0xf2, 0xc0, 0xf9, 0x80, 0xf9, 0x41, 0xf1, 0xe3, 0xc9, 0xa8, 0x6b, 0x94, 0x35, 0x3d, 0xbf, 0xbf,
+  0xd7, 0x9f, 0xcf, 0xfb, 0xb6, 0xb4, 0x85, 0xcb, 0xa3, 0xe5, 0xd8, 0x13, 0xa8, 0x0f, 0x48, 0x3a, 0x19, 0xd5, 0x00, 0x31, 0x6c, 0xab, 0x5c, 0x69, 0x4c, 0x89, 0x54, 0x8a, 0x54, 0x8a, 0x4c, 0x69,
+  0x44, 0x8a, 0x4c, 0xec, 0x64, 0x2f, 0x7d, 0x51, 0x8d, 0x52, 0x95, 0x95, 0xa5, 0x37, 0xb6, 0x58, 0xc6, 0xb5, 0xa5, 0xd1, 0x84, 0xed, 0x5b, 0xb7, 0x95, 0x82, 0x9f, 0xcf, 0x14, 0x59, 0x96, 0x2a,
+  0x04, 0x64, 0x03, 0x4b, 0x04, 0x94, 0x55, 0x7d, 0x77, 0xdb, 0x9e, 0x37, 0xbe, 0xd4, 0xc5, 0xee, 0xa4, 0x24, 0x33, 0x6b, 0x5c, 0xd6, 0x6e, 0x53, 0x3e, 0x00, 0x03, 0xe0, 0x12, 0xa0, 0x12, 0xc1,
+  0x02, 0x82, 0x03, 0x64, 0x0c, 0xf0, 0x07, 0x9a, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x4b, 0xa0, 0x02, 0x20, 0x01, 0x00, 0x01, 0x60, 0x00, 0x40, 0x59, 0xc0, 0x91, 0xa2, 0xa9, 0xe0, 0xe2, 0x80, 0xfd,
+  0xc9, 0xff, 0x89, 0xfe, 0xa0, 0xeb, 0x20, 0xaa, 0xa0, 0xb3, 0xa0, 0xe5, 0x40, 0xdc, 0x60, 0xea, 0x20, 0xfa, 0x83, 0xf1, 0xe4, 0xf8, 0x02, 0xf9, 0x66, 0xd9, 0xe5, 0xa1, 0x6e, 0x5b, 0x1d, 0x2f,
+  0xbf, 0xc7, 0x5d, 0xc7, 0x15, 0x9e, 0xef, 0x74, 0xcf, 0x5c, 0xcd, 0xa4, 0x02, 0xe4, 0x09, 0xdb, 0x4c, 0x72, 0x75, 0x4a, 0x07, 0x58, 0x4f, 0xb3, 0xce, 0x74, 0x69, 0x44, 0x6a, 0x4c, 0x69, 0x4c,
+  0xcb, 0x5c, 0xed, 0x74, 0x2f, 0x85, 0x0f, 0x8d, 0x11, 0x8d, 0x94, 0xa5, 0x57, 0xbe, 0x75, 0xce, 0xd0, 0xbd, 0x8e, 0x7c, 0x4c, 0x6c, 0xca, 0x53, 0xf2, 0x7c, 0x5f, 0xcf, 0x9f, 0xd7, 0x9f, 0xcf,
+  0x7f, 0xcf, 0x9f, 0xcf, 0x9a, 0x9e, 0x6c, 0x1c, 0x2a, 0x04, 0xf6, 0x05, 0xbf, 0x07, 0x9d, 0x27, 0x99, 0x5e, 0x65, 0x6c, 0xe0, 0x6b, 0x44, 0x13, 0x14, 0x05, 0x18, 0x06, 0xa3, 0x23, 0x80, 0x0a,
+  0xe1, 0x02, 0x82, 0x03, 0x63, 0x0c, 0x9d, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x35, 0x40, 0x01, 0x60, 0x5a, 0xc0, 0xa3, 0xa0, 0x8a, 0xa0, 0x99, 0x20, 0xb2, 0xe0, 0xa9, 0x20, 0xc4, 0xe4, 0xf6, 0xe5,
+  0xfd, 0x26, 0xf5, 0x82, 0xdd, 0xe0, 0xdd, 0x60, 0xee, 0x16, 0xfd, 0x5a, 0xfb, 0xf1, 0xe9, 0x29, 0x90, 0x30, 0x98, 0x95, 0xa8, 0xd6, 0x90, 0x14, 0x71, 0x4c, 0x62, 0x53, 0x65, 0x9a, 0x8e, 0x76,
+  0x5d, 0x14, 0x4d, 0x14, 0x5d, 0xf4, 0x4c, 0x13, 0x8d, 0x83, 0xcc, 0x80, 0xbb, 0xc0, 0xb2, 0x07, 0xca, 0x01, 0xd8, 0x29, 0xea, 0x6e, 0x84, 0x69, 0x34, 0xcc, 0x6c, 0x4f, 0x95, 0x50, 0x95, 0xcf,
+  0x8c, 0xf0, 0x8c, 0xb4, 0xad, 0x15, 0xbe, 0x93, 0xd6, 0x2e, 0xef, 0x67, 0xff, 0x03, 0xff, 0xa8, 0xbd, 0xc6, 0x53, 0x6e, 0x64, 0x3e, 0xcf, 0xbf, 0xd7, 0x81, 0x9f, 0xd7, 0x82, 0x9f, 0xcf, 0x04,
+  0xdc, 0xae, 0x10, 0x45, 0xcc, 0x44, 0x0a, 0x6d, 0x6e, 0x4d, 0x81, 0x17, 0x06, 0x06, 0xf4, 0x2d, 0x26, 0x04, 0xcb, 0x03, 0x07, 0x03, 0xc0, 0x02, 0x82, 0x03, 0xa4, 0x0c, 0x9f, 0x00, 0x00, 0x8e,
+  0x00, 0x00, 0x0e, 0xe0, 0x21, 0x20, 0x63, 0x60, 0xac, 0xc0, 0xd4, 0xe0, 0xe3, 0x80, 0xb2, 0xa0, 0xa2, 0x60, 0xc3, 0xa0, 0xd3, 0x63, 0xdc, 0xea, 0xfe, 0xe2, 0xf5, 0x80, 0xc3, 0xad, 0xdb, 0xde,
+  0xfb, 0x81, 0x5f, 0xfc, 0x22, 0x5b, 0xeb, 0x34, 0xaa, 0xb3, 0x69, 0xb1, 0x29, 0x8e, 0x3a, 0xa6, 0x53, 0x00, 0x65, 0xec, 0x34, 0x76, 0x04, 0x3a, 0x05, 0x3b, 0x05, 0xfb, 0x04, 0x9a, 0x34, 0x27,
+  0xa3, 0x44, 0xab, 0x52, 0xea, 0x06, 0xfa, 0x60, 0xe2, 0x62, 0xba, 0xee, 0xa4, 0x90, 0xa5, 0x50, 0xa5, 0xf0, 0x94, 0x52, 0x9d, 0xf6, 0xb5, 0xd4, 0xad, 0xcf, 0x8c, 0xc7, 0x63, 0x64, 0x84, 0x26,
+  0x9d, 0xc6, 0xbd, 0xe4, 0xc5, 0xc1, 0xc5, 0x83, 0x84, 0xb5, 0x9d, 0x81, 0x3d, 0xcf, 0x00, 0x7e, 0xcf, 0x81, 0x9f, 0xd7, 0x0b, 0xbf, 0xd7, 0x7f, 0xcf, 0xba, 0xbe, 0xef, 0x74, 0x90, 0x65, 0xb1,
+  0x55, 0x4a, 0x14, 0xc9, 0x04, 0xf6, 0x3e, 0xef, 0x1c, 0xc0, 0x02, 0x00, 0x03, 0xa3, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x44, 0xc0, 0x42, 0x80, 0x6b, 0x40, 0x32, 0x80, 0x52, 0x80, 0xa3, 0xa0, 0xd3,
+  0x00, 0xec, 0xe0, 0xfc, 0x00, 0xec, 0xa0, 0x81, 0xe0, 0x82, 0xe0, 0xd4, 0x04, 0xe4, 0xf9, 0xf3, 0x3f, 0xfc, 0x7e, 0xfc, 0xdb, 0xf3, 0x56, 0xd3, 0x2c, 0xa3, 0x60, 0x5a, 0x20, 0x32, 0x40, 0x53,
+  0x81, 0x4b, 0x24, 0x55, 0x88, 0x4d, 0x2b, 0x03, 0x8f, 0x03, 0xb7, 0x04, 0xfc, 0x04, 0x9c, 0x04, 0x2e, 0xab, 0xa9, 0xcb, 0xb9, 0xf4, 0x6d, 0xe4, 0x60, 0x9a, 0x05, 0x6b, 0x31, 0xa5, 0x11, 0x9d,
+  0x53, 0x9d, 0xd5, 0xb5, 0x93, 0xad, 0x4d, 0x84, 0xa9, 0x63, 0xc9, 0x63, 0xa8, 0x5b, 0xc7, 0x5b, 0xa5, 0x53, 0x06, 0x64, 0xca, 0x4b, 0x2e, 0x4c, 0xeb, 0x5b, 0x83, 0x3a, 0x45, 0x4b, 0x29, 0x64,
+  0xab, 0x74, 0x0e, 0x7d, 0xd4, 0x85, 0x36, 0xa6, 0xf1, 0x8c, 0xc5, 0x7b, 0x89, 0x5c, 0x2e, 0x6d, 0x1b, 0x05, 0x0f, 0x1d, 0xc0, 0x4d, 0x40, 0x5d, 0x80, 0x23, 0xc3, 0x03, 0x66, 0x05, 0xa3, 0x00,
+  0x00, 0x8e, 0x00, 0x00, 0x42, 0xe0, 0x74, 0x20, 0xce, 0x80, 0x83, 0xc0, 0x31, 0x80, 0x21, 0x20, 0x5a, 0x20, 0xab, 0x80, 0xe3, 0x80, 0xca, 0xa0, 0x81, 0x20, 0x41, 0x60, 0x21, 0x84, 0x82, 0xd5,
+  0xcb, 0x17, 0xf3, 0x92, 0xf1, 0x83, 0xd0, 0x01, 0xa2, 0xe8, 0x82, 0xa3, 0x71, 0xe0, 0x52, 0xc0, 0x5b, 0x00, 0x54, 0x22, 0x3d, 0xc6, 0x3c, 0x2e, 0x03, 0xeb, 0x02, 0xea, 0x02, 0xb3, 0x03, 0x7c,
+  0x65, 0x57, 0xad, 0xee, 0x9b, 0x6b, 0xbc, 0xa2, 0xb3, 0x89, 0x8b, 0xf1, 0x9c, 0x73, 0xa5, 0x73, 0xad, 0xef, 0xa4, 0xca, 0x7b, 0xa8, 0x63, 0xe9, 0x6b, 0xc9, 0x63, 0xe9, 0x63, 0xc9, 0x63, 0x0b,
+  0x64, 0x0d, 0x5c, 0x30, 0x54, 0x31, 0x4c, 0xb6, 0xad, 0x91, 0xc5, 0x00, 0x5b, 0xc0, 0x01, 0x00, 0x32, 0x68, 0x3b, 0x56, 0x35, 0x3a, 0x06, 0xaf, 0x6c, 0xb3, 0x7b, 0x29, 0x4b, 0x4e, 0x45, 0x09,
+  0x34, 0x27, 0x03, 0xa0, 0x13, 0x41, 0x2c, 0x02, 0x04, 0x08, 0x05, 0xa5, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x40, 0xa0, 0x02, 0xc0, 0x64, 0xe0, 0xad, 0x80, 0x9c, 0x60, 0x4a, 0x00, 0x42, 0xe0, 0x39,
+  0xe0, 0x4a, 0x20, 0x5a, 0xc0, 0x79, 0xe0, 0x71, 0xe0, 0x69, 0x00, 0x5a, 0x40, 0x12, 0x00, 0x02, 0x45, 0x8a, 0xeb, 0xd9, 0x80, 0xe9, 0x49, 0xca, 0xaf, 0x92, 0x6a, 0x88, 0x00, 0x73, 0xc0, 0x6b,
+  0x47, 0x64, 0xe7, 0x23, 0xe0, 0x02, 0x2d, 0x03, 0x2f, 0x03, 0xaf, 0x02, 0x72, 0x6c, 0x7e, 0xdf, 0xdb, 0xd6, 0xe3, 0x59, 0xc4, 0x52, 0x45, 0x83, 0xab, 0x93, 0xd1, 0xa4, 0x0c, 0x84, 0xc9, 0x83,
+  0x8d, 0x9c, 0x8f, 0x94, 0xcb, 0x6b, 0xea, 0x63, 0xec, 0x6b, 0xee, 0x6b, 0xd0, 0x63, 0xd1, 0x5b, 0xf1, 0x5b, 0xd0, 0x4b, 0x13, 0x95, 0x1b, 0xef, 0x1b, 0xf7, 0x33, 0xd6, 0xe2, 0x83, 0xc0, 0x5b,
+  0xd1, 0x4c, 0x93, 0x34, 0x8b, 0x53, 0x0f, 0x9d, 0x52, 0x7c, 0x85, 0x4b, 0x05, 0x03, 0xa0, 0x02, 0x40, 0x03, 0xe1, 0x03, 0xa8, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x2b, 0xa0, 0x5a, 0xa0, 0x64, 0xe0,
+  0x74, 0x80, 0x5b, 0x80, 0x4a, 0x00, 0x42, 0xe0, 0x39, 0x00, 0x8d, 0x60, 0xc6, 0xe0, 0x94, 0x00, 0x5b, 0x00, 0x52, 0x80, 0x52, 0x80, 0x54, 0x21, 0x6e, 0xc0, 0x1c, 0x60, 0x3b, 0xc0, 0x9a, 0xca,
+  0xc1, 0x11, 0x48, 0x1a, 0x22, 0x51, 0x62, 0x00, 0x6b, 0xf7, 0x4d, 0x5c, 0x06, 0x8c, 0x03, 0xca, 0x0a, 0xf1, 0x02, 0x77, 0x6c, 0x5e, 0xdf, 0xff, 0xf7, 0x7e, 0xef, 0xac, 0x83, 0x48, 0x33, 0xa7,
+  0x23, 0xd3, 0x04, 0x56, 0x4d, 0x0a, 0x6b, 0x69, 0x73, 0xec, 0x7b, 0x6f, 0x94, 0xce, 0x73, 0xd0, 0x63, 0xd1, 0x63, 0x81, 0xf2, 0x6b, 0x10, 0xd1, 0x5b, 0xb0, 0x53, 0x51, 0x74, 0xba, 0xee, 0x1b,
+  0xf7, 0xd9, 0xee, 0xf1, 0xcd, 0x04, 0xa5, 0x44, 0xa5, 0x0a, 0x75, 0x86, 0x53, 0x80, 0x5b, 0x02, 0x74, 0xe0, 0x32, 0x02, 0x03, 0xe4, 0x0b, 0x24, 0x0c, 0xaa, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x1d,
+  0x60, 0x5d, 0x00, 0x6d, 0x40, 0x5c, 0x00, 0x3b, 0xe0, 0x42, 0xc0, 0x4a, 0x00, 0x3a, 0xc0, 0x3a, 0x80, 0xc6, 0xa0, 0xef, 0x20, 0xe7, 0x20, 0xbe, 0xe0, 0x94, 0x80, 0x74, 0x01, 0x4d, 0x23, 0x3e,
+  0xc1, 0x15, 0x60, 0x04, 0x60, 0x3b, 0x50, 0x4b, 0x1f, 0x1b, 0xbb, 0x50, 0xab, 0x63, 0x5e, 0x1f, 0xdf, 0x07, 0x3e, 0x07, 0xf4, 0x04, 0xb8, 0x6c, 0x7f, 0xe7, 0xff, 0xf7, 0x81, 0xdf, 0xf7, 0x1d,
+  0x91, 0xa4, 0x00, 0x00, 0xe7, 0x21, 0x79, 0x5d, 0xb9, 0x95, 0x91, 0xb8, 0x52, 0x69, 0xea, 0x79, 0x47, 0x8a, 0x69, 0x92, 0x8b, 0x9a, 0xed, 0x9a, 0x6f, 0x93, 0xb0, 0x6b, 0xd0, 0x5b, 0xcf, 0x5b,
+  0x16, 0xd6, 0x97, 0xee, 0xf1, 0xe5, 0x86, 0xac, 0xe2, 0x63, 0xaa, 0xa5, 0xe7, 0xb5, 0x46, 0x8d, 0x83, 0x4c, 0x23, 0x2c, 0x40, 0x02, 0x83, 0x03, 0x68, 0x1d, 0xff, 0x07, 0xab, 0x00, 0x00, 0x8d,
+  0x00, 0x00, 0x02, 0x60, 0x5d, 0x80, 0x5c, 0x80, 0x3b, 0x81, 0x00, 0x33, 0x04, 0x00, 0x3b, 0x00, 0x43, 0x60, 0x2a, 0xc0, 0x53, 0x20, 0xd7, 0x81, 0xc0, 0xf7, 0x0a, 0xa0, 0xef, 0x60, 0xbe, 0x60,
+  0x74, 0x60, 0x0a, 0xe0, 0x03, 0x62, 0x05, 0xc4, 0x05, 0xe1, 0x14, 0xab, 0x2b, 0xd7, 0x39, 0x9a, 0x45, 0x81, 0xff, 0x07, 0x20, 0xdf, 0x07, 0x5f, 0x06, 0x18, 0x9d, 0x5d, 0xef, 0xff, 0xf7, 0xdf,
+  0xf7, 0xff, 0xf7, 0x17, 0xce, 0x00, 0x00, 0x07, 0xa8, 0x09, 0xe8, 0x85, 0xd9, 0xa4, 0xfa, 0x4a, 0xea, 0x84, 0xa8, 0x00, 0x80, 0x00, 0x90, 0x00, 0xa8, 0x00, 0xc8, 0x20, 0xa0, 0xc3, 0x58, 0x86,
+  0x61, 0xc9, 0xa3, 0x6b, 0xe5, 0xe4, 0x7a, 0x60, 0xb4, 0x40, 0x7b, 0x83, 0x7c, 0x64, 0xa5, 0x02, 0x64, 0x40, 0x23, 0x80, 0x03, 0x82, 0x03, 0xaf, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x04, 0x60, 0xad,
+  0x20, 0x6d, 0x80, 0x5c, 0x20, 0x54, 0x40, 0x5c, 0x82, 0x80, 0x64, 0x2f, 0xc0, 0x4b, 0x40, 0x85, 0x80, 0xe7, 0xc0, 0xef, 0x60, 0xdf, 0x20, 0xd7, 0x00, 0xcf, 0x20, 0xb6, 0x40, 0x74, 0xe0, 0x2a,
+  0xa3, 0x04, 0x05, 0x16, 0xa0, 0x0d, 0x20, 0x14, 0x90, 0x1c, 0xdb, 0x1e, 0xbf, 0x0e, 0xbf, 0x05, 0x5f, 0x04, 0x17, 0x31, 0x49, 0x8a, 0x97, 0xdd, 0x9e, 0xf7, 0xff, 0xff, 0x1c, 0xe7, 0x84, 0x91,
+  0x06, 0xf8, 0x09, 0xc0, 0x48, 0x61, 0x06, 0xf3, 0x00, 0xfb, 0xc0, 0xfa, 0xc0, 0xc1, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xc0, 0x80, 0x98, 0x80, 0x81, 0x00, 0xba, 0x68, 0xcc, 0xa0, 0xbc, 0xe0, 0x93,
+  0x00, 0xbd, 0x81, 0x4b, 0xc1, 0x5b, 0xc0, 0x22, 0x40, 0x02, 0x00, 0x01, 0xb1, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x04, 0x60, 0xad, 0xe0, 0x85, 0xa0, 0x7d, 0x80, 0x7d, 0x60, 0x75, 0x83, 0x40, 0x75,
+  0x29, 0x20, 0x75, 0x20, 0xa6, 0x40, 0xa6, 0xc0, 0x9d, 0xa0, 0x95, 0xc0, 0x9d, 0xe0, 0xa5, 0xa0, 0x9d, 0x40, 0x6c, 0x20, 0x02, 0xc0, 0x02, 0x82, 0x0c, 0x62, 0x0d, 0x00, 0x04, 0x80, 0x12, 0x93,
+  0x22, 0xfd, 0x0c, 0xff, 0x04, 0xfd, 0x29, 0x0c, 0x78, 0x09, 0xc8, 0xee, 0xc2, 0x18, 0xee, 0x5e, 0xf7, 0x8f, 0xf3, 0x07, 0xc8, 0x06, 0x38, 0x07, 0x39, 0xeb, 0xc9, 0x40, 0xe2, 0x00, 0xfb, 0x20,
+  0xfb, 0x40, 0xda, 0x60, 0xb0, 0x00, 0xb1, 0xc0, 0x99, 0x40, 0x79, 0xc7, 0x9a, 0xe9, 0xdc, 0x40, 0xd5, 0xa1, 0xa4, 0x60, 0x63, 0x81, 0xa0, 0x02, 0x01, 0xe0, 0x02, 0xa0, 0x04, 0xb2, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x00, 0x60, 0x5d, 0x81, 0x80, 0x4c, 0x0f, 0x80, 0x54, 0xa0, 0x54, 0x80, 0x54, 0xa0, 0x54, 0xc0, 0x5c, 0xe0, 0x64, 0x00, 0x6d, 0x60, 0x75, 0x20, 0x65, 0x20, 0x34, 0xe0, 0x02,
+  0x20, 0x02, 0x00, 0x02, 0x20, 0x02, 0x40, 0x12, 0x20, 0x02, 0x81, 0x00, 0x02, 0x13, 0xa0, 0x02, 0x80, 0x03, 0x40, 0x03, 0xa0, 0x02, 0xca, 0x02, 0x76, 0x23, 0x1c, 0x5b, 0x1b, 0x5a, 0x90, 0xa8,
+  0x01, 0xd8, 0x40, 0xf1, 0xce, 0xfb, 0x50, 0xe3, 0x13, 0x60, 0x0b, 0x60, 0x6a, 0x48, 0xf4, 0x90, 0x00, 0x90, 0xc0, 0x98, 0xc0, 0xc1, 0x81, 0x80, 0xe2, 0x09, 0x00, 0xa2, 0xe0, 0x60, 0x83, 0xb9,
+  0x8a, 0xcc, 0x24, 0xac, 0x20, 0x6b, 0x80, 0x1a, 0xe2, 0x02, 0x82, 0x03, 0xc3, 0x04, 0xb4, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x06, 0x60, 0x05, 0x60, 0x0b, 0x20, 0x0b, 0x20, 0x13, 0x40, 0x23, 0x80,
+  0x2b, 0xc0, 0x33, 0x81, 0x00, 0x3c, 0x08, 0xc0, 0x54, 0x40, 0x6d, 0x60, 0x6d, 0x20, 0x65, 0xc0, 0x4c, 0x00, 0x3c, 0xe0, 0x12, 0x20, 0x02, 0xe0, 0x01, 0x82, 0x00, 0x02, 0x02, 0xa3, 0x3a, 0xc3,
+  0x42, 0x20, 0x02, 0x81, 0x20, 0x03, 0x18, 0x60, 0x0a, 0x2c, 0x2a, 0xf9, 0x02, 0xd1, 0x99, 0xc0, 0xf8, 0xc0, 0xfa, 0x73, 0xfd, 0xb2, 0xec, 0x19, 0x90, 0x1d, 0x50, 0x59, 0x82, 0x79, 0xc2, 0x00,
+  0xa8, 0xc0, 0xa0, 0xe0, 0x88, 0xa0, 0xaa, 0x00, 0xf4, 0xe0, 0xd2, 0xc0, 0xa1, 0x43, 0xc2, 0x07, 0x73, 0x00, 0x02, 0xa1, 0x02, 0x42, 0x03, 0xc9, 0x2d, 0xb6, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x02,
+  0x60, 0x05, 0x00, 0x0b, 0xc0, 0x02, 0x81, 0xa0, 0x02, 0x2b, 0xc0, 0x0a, 0x00, 0x1b, 0x20, 0x1b, 0xa0, 0x2b, 0x60, 0x4c, 0xa0, 0x54, 0xc0, 0x5c, 0x00, 0x5d, 0x00, 0x55, 0xe0, 0x4c, 0xc0, 0x44,
+  0x20, 0x34, 0x20, 0x13, 0x40, 0x02, 0x00, 0x02, 0xa0, 0x01, 0x48, 0x84, 0xed, 0xc5, 0x2b, 0xa5, 0xa6, 0x6b, 0xc0, 0x0a, 0x00, 0x03, 0x40, 0x02, 0xa0, 0x01, 0x65, 0x41, 0xc4, 0xc9, 0x36, 0xfd,
+  0x7e, 0xfe, 0xda, 0xfd, 0xec, 0xe1, 0x3a, 0xa8, 0xde, 0xa2, 0x37, 0xd2, 0x00, 0xe1, 0x60, 0x99, 0xa0, 0x61, 0xe0, 0xd3, 0x60, 0xec, 0xe0, 0xaa, 0xa0, 0x59, 0x21, 0x02, 0xe1, 0x02, 0x65, 0x0c,
+  0xca, 0x36, 0xb8, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x81, 0xa0, 0x02, 0x01, 0x80, 0x02, 0xa0, 0x02, 0x83, 0xa0, 0x0a, 0x00, 0x60, 0x2b, 0x82, 0xc0, 0x33, 0x0d, 0x80, 0x2b, 0x60, 0x2b, 0xa0, 0x2b,
+  0x00, 0x34, 0x20, 0x2c, 0xc0, 0x23, 0x40, 0x1b, 0x40, 0x0a, 0x80, 0x01, 0xc9, 0x94, 0x6e, 0xce, 0xb0, 0xd6, 0x6e, 0xce, 0xa6, 0x7c, 0x81, 0xa0, 0x02, 0x14, 0x80, 0x02, 0xe0, 0x01, 0x20, 0x01,
+  0x71, 0x93, 0x7b, 0xe5, 0x3f, 0xfe, 0x14, 0xfc, 0x4f, 0xe1, 0xd4, 0xc1, 0x4c, 0xa9, 0x00, 0xb2, 0xc0, 0xa1, 0xe0, 0xa2, 0x20, 0x93, 0x00, 0x4a, 0x21, 0x02, 0x84, 0x03, 0xa6, 0x04, 0xf0, 0x47,
+  0xf5, 0x5f, 0xe8, 0x47, 0xb8, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x02, 0xa0, 0x02, 0xc0, 0x02, 0xa0, 0x02, 0x83, 0x60, 0x02, 0x25, 0xc0, 0x12, 0x20, 0x23, 0x21, 0x23, 0x01, 0x23, 0xe1, 0x22, 0xa0,
+  0x1a, 0x60, 0x1a, 0x40, 0x12, 0x20, 0x0a, 0x02, 0x0a, 0xc3, 0x09, 0xa4, 0x11, 0x87, 0x21, 0x49, 0x31, 0xe8, 0x39, 0x63, 0x3a, 0xc4, 0x42, 0x65, 0x5b, 0x83, 0x4b, 0x40, 0x23, 0x80, 0x33, 0x20,
+  0x2b, 0x80, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0x04, 0x21, 0xf4, 0xa3, 0x76, 0xec, 0x80, 0xf0, 0x84, 0xe0, 0x40, 0xb2, 0xc0, 0x8a, 0x00, 0x7a, 0xe0, 0x41, 0x41, 0x02, 0x43, 0x03, 0xc6, 0x1c, 0xee,
+  0x3f, 0xbc, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x81, 0x00, 0x02, 0x82, 0xe0, 0x01, 0x11, 0x00, 0x02, 0xa0, 0x12, 0xa1, 0x1a, 0xa2, 0x1a, 0x82, 0x12, 0x63, 0x12, 0x65, 0x12, 0x46,
+  0x0a, 0x68, 0x0a, 0x49, 0x02, 0x08, 0x02, 0xa8, 0x09, 0x47, 0x11, 0xe8, 0x18, 0xca, 0x30, 0xc9, 0x28, 0x03, 0x01, 0x00, 0x01, 0x81, 0xa0, 0x00, 0x11, 0x00, 0x01, 0xe0, 0x21, 0x60, 0x2a, 0x80,
+  0x01, 0xc0, 0x01, 0x40, 0x42, 0x40, 0x69, 0x00, 0x00, 0xe2, 0x48, 0xe2, 0xb8, 0x49, 0xd1, 0x04, 0x82, 0xe0, 0x21, 0x20, 0x02, 0x43, 0x03, 0x28, 0x1d, 0x00, 0x00, 0xf0, 0x87, 0xbd, 0x00, 0x00,
+  0x8d, 0x00, 0x00, 0x01, 0xa0, 0x02, 0xe0, 0x01, 0x82, 0xc0, 0x01, 0x81, 0xe0, 0x01, 0x0e, 0x00, 0x02, 0x21, 0x0a, 0x43, 0x02, 0x86, 0x02, 0xc9, 0x02, 0x2c, 0x03, 0x2d, 0x03, 0x0e, 0x03, 0xcc,
+  0x02, 0x6b, 0x02, 0xe8, 0x09, 0x46, 0x09, 0xe7, 0x18, 0xe8, 0x18, 0x05, 0x09, 0x81, 0x21, 0x01, 0x00, 0x40, 0x01, 0x81, 0x20, 0x01, 0x0c, 0xc0, 0x00, 0x80, 0x00, 0xa0, 0x00, 0x80, 0x00, 0xa0,
+  0x38, 0x20, 0x89, 0xc0, 0x48, 0x60, 0x00, 0x00, 0x01, 0xa0, 0x01, 0x41, 0x02, 0x02, 0x03, 0x23, 0x05, 0xc1, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x01, 0xa0, 0x02, 0xe0, 0x01, 0x83, 0xc0, 0x01, 0x82,
+  0xe0, 0x01, 0x03, 0x01, 0x02, 0x44, 0x02, 0xa7, 0x02, 0xea, 0x02, 0x81, 0xeb, 0x02, 0x03, 0x8a, 0x02, 0x28, 0x02, 0xa5, 0x01, 0x25, 0x09, 0x81, 0xe6, 0x10, 0x01, 0x02, 0x01, 0x00, 0x01, 0x81,
+  0x20, 0x01, 0x81, 0x40, 0x01, 0x82, 0x60, 0x01, 0x00, 0x60, 0x09, 0x81, 0x60, 0x01, 0x03, 0xc1, 0x01, 0x21, 0x02, 0xc2, 0x02, 0x62, 0x03, 0xc4, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x01, 0xa0, 0x02,
+  0xe0, 0x01, 0x85, 0xc0, 0x01, 0x82, 0xe0, 0x01, 0x02, 0x00, 0x02, 0x22, 0x02, 0x43, 0x02, 0x81, 0x45, 0x02, 0x01, 0x24, 0x02, 0xe3, 0x01, 0x81, 0x03, 0x02, 0x01, 0x23, 0x02, 0x42, 0x02, 0x81,
+  0x61, 0x02, 0x02, 0xa2, 0x02, 0x41, 0x02, 0xa1, 0x02, 0x81, 0x02, 0x03, 0x05, 0xe2, 0x0a, 0x02, 0x03, 0x22, 0x03, 0x42, 0x03, 0xa3, 0x03, 0x65, 0x05, 0xc6, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x01,
+  0xa0, 0x02, 0xc0, 0x01, 0x82, 0xe0, 0x01, 0x08, 0x20, 0x02, 0x41, 0x02, 0x61, 0x02, 0x81, 0x02, 0xc1, 0x02, 0xe2, 0x02, 0x02, 0x03, 0x22, 0x03, 0x42, 0x03, 0x81, 0x63, 0x03, 0x08, 0x23, 0x03,
+  0x64, 0x03, 0xa4, 0x03, 0xe4, 0x03, 0x44, 0x04, 0x64, 0x04, 0x66, 0x04, 0xa5, 0x04, 0x08, 0x06, 0xd0, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x04, 0x00, 0x04, 0x43, 0x03, 0x63, 0x03, 0xa3, 0x03, 0xc4,
+  0x03, 0x81, 0xe4, 0x03, 0x06, 0x04, 0x04, 0x45, 0x04, 0x85, 0x04, 0xc6, 0x0c, 0x07, 0x05, 0x08, 0x06, 0xe0, 0x07, 0xdb, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x02, 0x65, 0x05, 0xed, 0x07, 0xff, 0x07,
+  0xe5, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xf7, 0x00, 0x00,
 #endif
 };
 
 const lv_img_dsc_t calendar = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR,
+  .header.cf = LV_IMG_CF_USER_ENCODED_0,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 120,
   .header.h = 120,
-  .data_size = 14400 * LV_COLOR_SIZE / 8,
+  .data_size = 14648,
   .data = calendar_map,
 };
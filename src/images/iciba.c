@@ -1,3 +1,4 @@
+/* 由tools/image_converter.py生成，请勿手工修改：256色调色板索引图像，与母版相比PSNR 35.9 dB */
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -12,7 +13,6 @@
     #include "lvgl/lvgl.h"
 #endif
 
-
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
@@ -22,346 +22,249 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_ICIBA uint8_t iciba_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xb6, 0xf9, 0xd9, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x57, 0x97, 0x96, 0x97, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x96, 0xd9, 0xf9, 0xfd, 0xda, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x96, 0xf9, 0xfd, 0xfa, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xb6, 0xf9, 0xfc, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xff, 0xd9, 0xf9, 0xfc, 0xfc, 0xf9, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xba, 0xfc, 0xf8, 0xfc, 0xfd, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf9, 0xfc, 0xfc, 0xf8, 0xf9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xb6, 0xf9, 0xf8, 0xfc, 0xf9, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf8, 0xfc, 0xfc, 0xf8, 0xf4, 0xf9, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xd6, 0xf9, 0xf8, 0xfc, 0xf9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xf8, 0xfc, 0xf8, 0xf8, 0xf8, 0xf9, 0xb7, 0x53, 0x33, 0x33, 0x53, 0x53, 0x53, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xb6, 0xf9, 0xf8, 0xfc, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xfc, 0xfc, 0xf8, 0xf8, 0xf4, 0xf4, 0xf9, 0x96, 0x73, 0x57, 0x57, 0x77, 0x77, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xba, 0xf8, 0xf8, 0xfc, 0xfd, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xfd, 0xfc, 0xf8, 0xd4, 0xd4, 0xd5, 0xd5, 0xda, 0xbb, 0x9b, 0x7b, 0x7b, 0x9b, 0x9b, 0x97, 0x77, 0x77, 0x77, 0x53, 0x53, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xba, 0xf8, 0xf8, 0xfc, 0xf9, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xf9, 0xf9, 0xd5, 0xd5, 0xd9, 0xfa, 0xfa, 0xfe, 0xbb, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xd6, 0xf8, 0xf8, 0xfd, 0xf9, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0xd9, 0xd5, 0xda, 0xfa, 0xfa, 0xfe, 0xfe, 0xfe, 0xfe, 0xbb, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xda, 0xf8, 0xf8, 0xfc, 0xf9, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xd8, 0xd5, 0xd9, 0xfe, 0xfe, 0xfa, 0xfa, 0xfa, 0xfa, 0xda, 0xda, 0xb7, 0x77, 0x77, 0x97, 0x77, 0x97, 0x97, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x77, 0x57, 0x53, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x96, 0xd9, 0xf8, 0xf8, 0xfc, 0xf9, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xd9, 0xd9, 0xfe, 0xfe, 0xfe, 0xfa, 0xda, 0xda, 0xd6, 0xd6, 0xd5, 0xda, 0xb7, 0x97, 0x97, 0x97, 0x97, 0x77, 0x73, 0x73, 0x73, 0x97, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x73, 0xb6, 0xda, 0xf8, 0xf8, 0xfc, 0xf9, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xb5, 0xda, 0xfe, 0xfe, 0xfa, 0xda, 0xda, 0xda, 0xda, 0xfa, 0xfe, 0xfe, 0xfe, 0xff, 0xdf, 0xdf, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x97, 0x77, 0x73, 0x77, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x73, 0x96, 0xf5, 0xf8, 0xf8, 0xfc, 0xf9, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xb4, 0xda, 0xfe, 0xfe, 0xfa, 0xfa, 0xd6, 0xda, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xdf, 0xdf, 0xdf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x97, 0x77, 0x53, 0x77, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x96, 0xd9, 0xf8, 0xf8, 0xfc, 0xd9, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xb5, 0xda, 0xfe, 0xfe, 0xda, 0xda, 0xda, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xdf, 0xdf, 0xdf, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x9b, 0x97, 0x77, 0x73, 0x73, 0x97, 0x9b, 0x9b, 0x9b, 0x9b, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd6, 0xf9, 0xf8, 0xf8, 0xf8, 0xfa, 0xfb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xb5, 0xda, 0xfe, 0xfe, 0xda, 0xda, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xdf, 0xdf, 0xdf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x9b, 0x9b, 0x97, 0x77, 0x53, 0x53, 0x77, 0x9b, 0x9b, 0x9b, 0x9b, 0x77, 0x53, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0xf9, 0xf8, 0xf8, 0xf8, 0xf9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xd9, 0xd9, 0xfe, 0xfe, 0xda, 0xda, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x9b, 0x9b, 0x97, 0x77, 0x53, 0x53, 0x77, 0x9b, 0x9b, 0x9b, 0x9b, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf9, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0xfa, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xd8, 0xd5, 0xfe, 0xfe, 0xda, 0xd6, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xf9, 0xfe, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x77, 0x53, 0x53, 0x77, 0x9b, 0x9b, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf9, 0xfd, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd5, 0xda, 0xfe, 0xfe, 0xda, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xf9, 0xf8, 0xfd, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x9b, 0x9b, 0x9b, 0x97, 0x97, 0x77, 0x53, 0x53, 0x77, 0x77, 0x77, 0x77, 0x57, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xfd, 0xfd, 0xf9, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xd6, 0xfe, 0xfe, 0xda, 0xb6, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xf8, 0xf8, 0xfd, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0xbf, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x77, 0x77, 0x77, 0x33, 0x53, 0x77, 0x77, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd5, 0xda, 0xfe, 0xde, 0xb6, 0xd6, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfc, 0xf8, 0xf8, 0xf8, 0xfd, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x9b, 0x9b, 0x77, 0x77, 0x77, 0x57, 0x57, 0x53, 0x33, 0x57, 0x77, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf9, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd9, 0xde, 0xde, 0xda, 0x92, 0xff, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xfd, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x9b, 0x77, 0x57, 0x57, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x53, 0x77, 0x77, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf9, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xd9, 0xda, 0xfe, 0xde, 0xb5, 0xd6, 0xfe, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0xbf, 0xbf, 0xbb, 0x97, 0x77, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x57, 0x77, 0x77, 0x77, 0x53, 0x53, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xd9, 0xda, 0xfe, 0xda, 0xb1, 0xfa, 0xfd, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0xbb, 0x9b, 0x57, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x53, 0x77, 0x77, 0x77, 0x53, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xd9, 0xfe, 0xfe, 0xda, 0xb5, 0xfe, 0xfd, 0xfc, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0xff, 0xdf, 0xdf, 0xdf, 0x9b, 0x77, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x77, 0x77, 0x77, 0x57, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xf9, 0xd9, 0xfe, 0xda, 0xb5, 0xd6, 0xfe, 0xfc, 0xfc, 0xf8, 0xf8, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xff, 0xdf, 0xbf, 0x9b, 0x53, 0x53, 0x53, 0x57, 0x53, 0x53, 0x33, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x77, 0x77, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf9, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xd9, 0xd9, 0xfe, 0xda, 0xb5, 0xfa, 0xfd, 0xf8, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0xff, 0xbb, 0x77, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x77, 0x77, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf9, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xd9, 0xde, 0xfe, 0xda, 0xb5, 0xfa, 0xfd, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0xdb, 0x77, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x57, 0x77, 0x77, 0x77, 0x53, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xd9, 0xde, 0xfe, 0xda, 0xb5, 0xfe, 0xfd, 0xf8, 0xf8, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0x96, 0x53, 0x33, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x77, 0x77, 0x77, 0x53, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xd9, 0xde, 0xfe, 0xda, 0xb5, 0xfe, 0xfd, 0xf8, 0xf8, 0xf8, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x96, 0x33, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x77, 0x77, 0x77, 0x53, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xd9, 0xde, 0xfe, 0xda, 0xb5, 0xfd, 0xfd, 0xf8, 0xf8, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x96, 0x33, 0x53, 0x57, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x73, 0x77, 0x77, 0x77, 0x53, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xd9, 0xda, 0xfe, 0xda, 0xd5, 0xf9, 0xfd, 0xf8, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x96, 0x53, 0x53, 0x57, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x53, 0x53, 0x33, 0x33, 0x53, 0x53, 0x77, 0x77, 0x77, 0x77, 0x53, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf9, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xd9, 0xd9, 0xfe, 0xda, 0xb5, 0xf9, 0xfd, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x97, 0x53, 0x53, 0x57, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x53, 0x77, 0x73, 0x77, 0x77, 0x77, 0x77, 0x53, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf9, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xd9, 0xde, 0xda, 0xd5, 0xf9, 0xfd, 0xfc, 0xf8, 0xf8, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x97, 0x33, 0x53, 0x57, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x77, 0x9b, 0x73, 0x77, 0x77, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xd9, 0xda, 0xde, 0xda, 0xd9, 0xfd, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x97, 0x33, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x77, 0xbb, 0x9b, 0x53, 0x77, 0x77, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xd9, 0xda, 0xde, 0xda, 0xd5, 0xf9, 0xfd, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x97, 0x33, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x33, 0x33, 0x33, 0x53, 0x57, 0x9b, 0xbf, 0x77, 0x73, 0x7b, 0x77, 0x77, 0x53, 0x53, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xd9, 0xd9, 0xda, 0xde, 0xd5, 0xf9, 0xfd, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x96, 0x33, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x53, 0x9b, 0xbb, 0xbb, 0x53, 0x77, 0x77, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xd9, 0xda, 0xfe, 0xd9, 0xd5, 0xfd, 0xf8, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x97, 0x33, 0x53, 0x53, 0x53, 0x33, 0x53, 0x53, 0x33, 0x33, 0x53, 0x53, 0x33, 0x33, 0x33, 0x53, 0x9b, 0xbb, 0xbb, 0x97, 0x53, 0x7b, 0x77, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xd9, 0xd9, 0xfe, 0xde, 0xd5, 0xf9, 0xfd, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x97, 0x33, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x53, 0x9b, 0xbb, 0xbb, 0xbb, 0x73, 0x77, 0x77, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xd8, 0xd5, 0xda, 0xfe, 0xda, 0xd5, 0xf9, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x97, 0x33, 0x53, 0x53, 0x53, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x77, 0x9b, 0xbb, 0xbb, 0x9b, 0x77, 0x53, 0x7b, 0x77, 0x77, 0x77, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf9, 0xd5, 0xd9, 0xfe, 0xfe, 0xd9, 0xf9, 0xfd, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x97, 0x33, 0x53, 0x53, 0x53, 0x53, 0x53, 0x33, 0x33, 0x33, 0x33, 0x53, 0x77, 0xbb, 0xbb, 0xbb, 0xbb, 0x77, 0x53, 0x77, 0x77, 0x77, 0x77, 0x53, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf9, 0xd4, 0xd9, 0xd9, 0xfe, 0xda, 0xd9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x96, 0x33, 0x53, 0x53, 0x53, 0x33, 0x53, 0x33, 0x33, 0x53, 0x77, 0x9b, 0xbf, 0xdf, 0xdf, 0xdf, 0x9b, 0x53, 0x77, 0x7b, 0x77, 0x77, 0x77, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf9, 0xd4, 0xd8, 0xd9, 0xd9, 0xfe, 0xda, 0xd9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xfa, 0x96, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x73, 0x77, 0x97, 0xbb, 0xdf, 0xdf, 0xff, 0xff, 0xbf, 0x77, 0x97, 0x97, 0x77, 0x77, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xd8, 0xf8, 0xd4, 0xd9, 0xda, 0xde, 0xda, 0xd9, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf4, 0xd0, 0xd1, 0xae, 0x8e, 0x6e, 0x6e, 0x8e, 0x6e, 0x8e, 0x92, 0x92, 0xb7, 0xb7, 0xdb, 0xff, 0xff, 0xfb, 0xb7, 0x97, 0xb3, 0xb3, 0x93, 0x93, 0x8e, 0xae, 0x8e, 0xae, 0xae, 0xae, 0xae, 0x8e, 0x92, 0x8e, 0xae, 0xae, 0x8e, 0x8e, 0xae, 0xae, 0xae, 0xae, 0x8e, 0xae, 0x8e, 0xae, 0x8e, 0x00, 
-  0x00, 0x00, 0x00, 0xf5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xf8, 0xf8, 0xf4, 0xd4, 0xd9, 0xde, 0xde, 0xda, 0xd9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf4, 0xcc, 0xc9, 0xed, 0xee, 0xce, 0xce, 0xce, 0xce, 0xce, 0xae, 0xae, 0xae, 0xb2, 0xd7, 0xfb, 0xff, 0xfb, 0xd7, 0xd7, 0xd7, 0xd6, 0xf6, 0xd6, 0x92, 0xb2, 0xf2, 0xf6, 0xf3, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf6, 0xf3, 0xf6, 0xf6, 0xf7, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf2, 0xaa, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xf8, 0xfc, 0xf8, 0xf4, 0xd4, 0xd9, 0xde, 0xfe, 0xda, 0xd5, 0xd8, 0xf9, 0xf9, 0xf4, 0xc8, 0xc9, 0xee, 0xee, 0xee, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xce, 0xf2, 0xf2, 0xf2, 0xf7, 0xd6, 0xd6, 0xd6, 0xf6, 0xf2, 0xf2, 0xf6, 0xd6, 0xd7, 0xd7, 0xd7, 0xd6, 0xd2, 0xd2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf6, 0xf2, 0xe9, 0x89, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xf8, 0xfc, 0xfc, 0xf8, 0xd4, 0xd4, 0xd9, 0xd9, 0xd9, 0xb9, 0xb9, 0xd9, 0xd5, 0xac, 0xcd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xd2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xd2, 0xd2, 0xd2, 0xd2, 0xf6, 0xf2, 0xed, 0xcd, 0xd2, 0xd7, 0xff, 0xff, 0xdb, 0xb7, 0x92, 0x6d, 0xb2, 0xf6, 0xf6, 0xf6, 0xf2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf2, 0xf6, 0xf6, 0xf2, 0xf6, 0xf6, 0xf2, 0xc5, 0xaa, 0x8e, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xf8, 0xfc, 0xfc, 0xf8, 0xf8, 0xf4, 0xd4, 0xd8, 0xd9, 0xd9, 0xd9, 0xb1, 0x8d, 0xad, 0xce, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xf2, 0xf2, 0xee, 0xed, 0xc9, 0xad, 0x92, 0xbb, 0xff, 0xff, 0xdb, 0x96, 0xbb, 0x92, 0x49, 0xb2, 0xf6, 0xf2, 0xf2, 0xf2, 0xf6, 0xf6, 0xf2, 0xf2, 0xf6, 0xf2, 0xf2, 0xf6, 0xf2, 0xc5, 0xf2, 0x97, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xd4, 0xd5, 0xd9, 0xb5, 0xad, 0xce, 0xce, 0xce, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xce, 0xce, 0xce, 0xd2, 0xd2, 0xf2, 0xf2, 0xf2, 0xce, 0xed, 0xe9, 0xe9, 0xc5, 0xad, 0xb2, 0xb6, 0xdb, 0xdf, 0xbb, 0xdb, 0xbb, 0xb6, 0x92, 0x69, 0xae, 0xf6, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xf2, 0xc5, 0xf2, 0xfb, 0x97, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xd4, 0xb0, 0xa8, 0xcd, 0xce, 0xce, 0xcd, 0xcd, 0xcd, 0xce, 0xce, 0xce, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xe9, 0xe9, 0xed, 0xe9, 0xc9, 0xc9, 0xc5, 0xc0, 0xe0, 0xe4, 0xcd, 0xb6, 0xb2, 0x92, 0xbb, 0xff, 0xdb, 0xb7, 0xb7, 0x72, 0x6d, 0xae, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xc1, 0xf2, 0xff, 0xff, 0x97, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xd0, 0xa4, 0xc4, 0xc5, 0xc5, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xe5, 0xc4, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0xc4, 0xad, 0x8d, 0x92, 0x72, 0xb7, 0xff, 0xdb, 0x96, 0x92, 0x92, 0x69, 0x8e, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xee, 0xc1, 0xf2, 0xfb, 0xff, 0xff, 0x9b, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xd0, 0xc8, 0xe9, 0xe9, 0xe5, 0xe5, 0xc4, 0xc0, 0xc4, 0xc5, 0xc5, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc5, 0xc4, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xc5, 0x8d, 0x6e, 0x6e, 0x8e, 0xb7, 0xdb, 0xbb, 0xb2, 0xb2, 0x92, 0x49, 0x8d, 0xf2, 0xf2, 0xf2, 0xf2, 0xee, 0xc5, 0xf2, 0xfb, 0xff, 0xff, 0xff, 0x9b, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xd0, 0xc8, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe5, 0xe5, 0xc4, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xa9, 0x6d, 0x6e, 0x8e, 0x6e, 0xb7, 0xdf, 0xbb, 0xb6, 0xb6, 0x92, 0x69, 0x8d, 0xf2, 0xf2, 0xed, 0xc5, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xf8, 0xd0, 0xc8, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xad, 0x6e, 0x6e, 0x8e, 0x92, 0x96, 0xdf, 0xdb, 0xb2, 0xb2, 0x92, 0x49, 0x8d, 0xce, 0xc5, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xf9, 0xf8, 0xfc, 0xfc, 0xf8, 0xd0, 0xc4, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe5, 0xe5, 0xe4, 0xe4, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xa9, 0x8d, 0x6e, 0x6e, 0x72, 0x96, 0xdb, 0xd7, 0xb2, 0x92, 0x92, 0x6d, 0x85, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xf9, 0xf8, 0xfc, 0xf8, 0xd0, 0xc4, 0xe5, 0xe5, 0xe5, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe5, 0xe5, 0xe5, 0xe4, 0xe4, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xc9, 0x8d, 0x6e, 0x6e, 0x6e, 0xb6, 0xdb, 0xbb, 0x96, 0xb2, 0x8e, 0x69, 0x8e, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x8d, 0x6e, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xd0, 0xc4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe9, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe5, 0xe5, 0xe4, 0xe4, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xa9, 0x8d, 0x6e, 0x72, 0x6e, 0x92, 0xbb, 0xbb, 0x92, 0x92, 0x92, 0x69, 0x8e, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xa1, 0xc9, 0xaa, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xfd, 0xd0, 0xcc, 0xc4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe5, 0xe5, 0xe4, 0xe4, 0xe0, 0xe0, 0xa9, 0x8d, 0x6e, 0x6e, 0x6e, 0x92, 0xdb, 0xbb, 0x92, 0x92, 0x92, 0x49, 0x72, 0xff, 0xff, 0xdb, 0xa9, 0xe9, 0xe9, 0xa9, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc, 0xd4, 0xa8, 0xc5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xed, 0xed, 0xe9, 0xe9, 0xe5, 0xe4, 0xa9, 0x8d, 0x6e, 0x8e, 0x6e, 0x92, 0xbb, 0xbb, 0x92, 0x92, 0x92, 0x49, 0x92, 0xd6, 0xa9, 0xe9, 0xed, 0xc9, 0x8e, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xf8, 0xcc, 0xc4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe5, 0xe0, 0xc0, 0xa5, 0x69, 0x6e, 0x72, 0x6e, 0x92, 0xdb, 0xbb, 0x92, 0xb2, 0x6e, 0x4d, 0x45, 0xcd, 0xee, 0xa9, 0x6e, 0x73, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xd4, 0xa8, 0xe5, 0xe9, 0xe9, 0xe5, 0xe9, 0xe9, 0xe5, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xc9, 0xe5, 0xc4, 0x65, 0x69, 0x6e, 0x8e, 0x6d, 0x92, 0xbb, 0xb7, 0x92, 0x92, 0x72, 0x6d, 0x89, 0xa9, 0x6e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd0, 0xc9, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xed, 0xc4, 0xad, 0x92, 0x69, 0x6d, 0x72, 0x6e, 0x92, 0xbb, 0xbb, 0x92, 0x92, 0x8e, 0x69, 0x69, 0x52, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xcc, 0xe9, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xed, 0xc0, 0xd6, 0xff, 0xb2, 0x69, 0x6d, 0x6e, 0x6e, 0x72, 0xb7, 0xb7, 0x92, 0x8e, 0x72, 0x4d, 0x4e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf4, 0xa8, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xed, 0xc0, 0xdb, 0xff, 0xdf, 0xb7, 0x49, 0x6e, 0x72, 0x6e, 0x72, 0xb7, 0xb7, 0x92, 0x92, 0x92, 0x72, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf4, 0xa8, 0xee, 0xf2, 0xf2, 0xee, 0xee, 0xee, 0xf2, 0xf2, 0xf2, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xe9, 0xc5, 0xfb, 0xff, 0xff, 0xff, 0xdb, 0x49, 0x6d, 0x6e, 0x6e, 0x8e, 0xb6, 0xb6, 0x92, 0x92, 0x72, 0x53, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf4, 0xc8, 0xee, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xed, 0xc5, 0xfb, 0xff, 0xff, 0xff, 0xd6, 0x89, 0x69, 0x8e, 0x6e, 0x6d, 0x72, 0x92, 0x97, 0x72, 0x4e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xd4, 0xc8, 0xee, 0xee, 0xed, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf2, 0xee, 0xe9, 0xc5, 0xfb, 0xff, 0xff, 0xf2, 0xc5, 0xed, 0xa9, 0x69, 0x6d, 0x72, 0x92, 0x92, 0x72, 0x53, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xf4, 0xc8, 0xe5, 0xe5, 0xe9, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xf7, 0xff, 0xd6, 0xc5, 0xe9, 0xc9, 0xa9, 0x6e, 0x4e, 0x6e, 0x92, 0x72, 0x73, 0x53, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xf8, 0xc8, 0xe5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe9, 0xe9, 0xe9, 0xe9, 0xee, 0xf2, 0xe5, 0xe9, 0xc9, 0x89, 0x6e, 0x53, 0x2e, 0x4f, 0x73, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xb1, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xf8, 0xcc, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xc9, 0xe4, 0xe5, 0xc5, 0x85, 0x4f, 0x53, 0x00, 0x00, 0x53, 0x4f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x6e, 0xd5, 0xf8, 0xf8, 0xf8, 0xf8, 0xf4, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xf0, 0xc8, 0xe9, 0xe5, 0xe9, 0xe9, 0xe5, 0xe5, 0xe9, 0xe9, 0xe5, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe4, 0xc4, 0xa4, 0x69, 0x4e, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x4e, 0x91, 0xd5, 0xf9, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfd, 0xf9, 0xcc, 0xe8, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe5, 0xa4, 0x89, 0x4e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x53, 0x4f, 0x4d, 0x91, 0xd5, 0xf5, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xd9, 0xb5, 0x89, 0xa5, 0xc9, 0xa9, 0xa9, 0xa9, 0xc9, 0xa9, 0xa9, 0xc9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xa9, 0xa9, 0xa9, 0xa9, 0xc9, 0xc9, 0x8a, 0x4e, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x2a, 0x0e, 0x2e, 0x6e, 0x71, 0x72, 0x92, 0x8d, 0x6e, 0x2e, 0x0e, 0x0a, 0x29, 0x49, 0x29, 0x09, 0x29, 0x29, 0x29, 0x09, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x09, 0x29, 0x29, 0x29, 0x29, 0x29, 0x09, 0x09, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x09, 0x4a, 0x4a, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x0e, 0x0a, 0x02, 0x0f, 0x33, 0x13, 0x06, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x74, 0x6e, 0xad, 0x47, 0xe6, 0x47, 0xce, 0x4e, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x44, 0x9a, 0x4c, 0x34, 0x75, 0x11, 0x85, 0x15, 0x7d, 0x37, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x5c, 0x51, 0x95, 0x2a, 0xd6, 0x27, 0xf6, 0xc6, 0xee, 0x8e, 0xc6, 0xc0, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x31, 0x95, 0x69, 0xd6, 0xa6, 0xee, 0x6e, 0xd6, 0x91, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x54, 0x71, 0x95, 0x48, 0xde, 0xe0, 0xfe, 0xa0, 0xfe, 0x85, 0xf6, 0xb0, 0xe6, 0x5a, 0xe7, 0x7f, 0xdf, 0x1d, 0xc7, 0x1e, 0xcf, 0x3f, 0xd7, 0x7f, 0xcf, 0x3f, 0xcf, 0xdb, 0xde, 0xca, 0xcd, 0x48, 0xde, 0xe3, 0xfe, 0x80, 0xfe, 0x6a, 0xf6, 0x8c, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x54, 0xae, 0x95, 0x84, 0xe6, 0x60, 0xfe, 0xc3, 0xfe, 0x88, 0xe6, 0x51, 0xd6, 0x7a, 0xef, 0xbe, 0xff, 0x9f, 0xf7, 0xbf, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xdf, 0xef, 0x9c, 0xef, 0x93, 0xe6, 0x66, 0xee, 0xc0, 0xfe, 0x84, 0xfe, 0xe0, 0xfd, 0x2a, 0xee, 0x4b, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x6c, 0x6f, 0xad, 0x67, 0xee, 0x60, 0xfe, 0x80, 0xfe, 0x66, 0xee, 0x72, 0xce, 0x7c, 0xe7, 0xff, 0xf7, 0x7f, 0xff, 0x1e, 0xff, 0xbe, 0xff, 0xdf, 0xf7, 0xff, 0xf7, 0x7c, 0xff, 0x91, 0xf6, 0x44, 0xfe, 0xa1, 0xfe, 0x83, 0xfe, 0xc1, 0xfd, 0x80, 0xfd, 0x2a, 0xf6, 0x36, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x6c, 0x6d, 0xbd, 0x26, 0xf6, 0x21, 0xfe, 0xa3, 0xfe, 0x46, 0xee, 0x50, 0xde, 0x5b, 0xf7, 0xbf, 0xf7, 0x9d, 0xef, 0xbf, 0xff, 0xbf, 0xff, 0x9d, 0xf7, 0xdf, 0xef, 0xdc, 0xf7, 0xd2, 0xf6, 0x44, 0xf6, 0x80, 0xfe, 0xa2, 0xfe, 0x42, 0xfe, 0xc0, 0xfd, 0x80, 0xfd, 0xea, 0xf5, 0xd6, 0x94, 0xdb, 0x3b, 0x99, 0x24, 0x99, 0x23, 0x99, 0x3b, 0x99, 0x3c, 0x99, 0x3c, 0x9c, 0x3c, 0x1c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x6c, 0x4f, 0xad, 0x45, 0xf6, 0x41, 0xfe, 0xc0, 0xf6, 0x85, 0xe6, 0x33, 0xde, 0x3c, 0xf7, 0x9e, 0xf7, 0x3f, 0xf7, 0x9f, 0xff, 0xdc, 0xf7, 0xdc, 0xef, 0xdf, 0xf7, 0xdc, 0xff, 0xf2, 0xee, 0x41, 0xee, 0xe0, 0xfe, 0xe2, 0xfe, 0x82, 0xf6, 0xa1, 0xed, 0x62, 0xed, 0x41, 0xe5, 0x89, 0xd5, 0xd3, 0x8c, 0x9a, 0x5c, 0xfa, 0x4c, 0xdc, 0x4c, 0xba, 0x54, 0xb9, 0x54, 0x99, 0x4c, 0x7a, 0x4c, 0x7b, 0x44, 0x59, 0x3c, 0x5b, 0x44, 0x1f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x6c, 0xad, 0xa5, 0x44, 0xee, 0x61, 0xfe, 0xc4, 0xfe, 0xa4, 0xd6, 0x51, 0xce, 0x1d, 0xef, 0x9f, 0xf7, 0x7c, 0xe7, 0x9c, 0xf7, 0x9e, 0xf7, 0xbe, 0xf7, 0x7f, 0xf7, 0xbe, 0xff, 0xf4, 0xf6, 0x48, 0xee, 0xa4, 0xfe, 0xa4, 0xfe, 0x43, 0xee, 0x60, 0xcd, 0xc4, 0xcc, 0xc8, 0xc4, 0x29, 0xc5, 0xed, 0xbd, 0xd5, 0x95, 0xda, 0x7d, 0x3c, 0x76, 0xfe, 0x75, 0xbb, 0x7d, 0xba, 0x7d, 0x9b, 0x75, 0x5b, 0x6d, 0x1b, 0x65, 0xdb, 0x54, 0x9a, 0x4c, 0x5a, 0x44, 0x5a, 0x44, 0x5c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x74, 0x8c, 0xb5, 0x61, 0xf6, 0x40, 0xfe, 0x83, 0xfe, 0x48, 0xde, 0x53, 0xd6, 0x1c, 0xf7, 0x3e, 0xf7, 0x5d, 0xef, 0x7b, 0xef, 0x9b, 0xe7, 0x7d, 0xef, 0x7f, 0xf7, 0x5e, 0xff, 0x15, 0xf7, 0x88, 0xe6, 0x84, 0xee, 0x44, 0xee, 0xa6, 0xdd, 0x06, 0xbd, 0x68, 0xbd, 0x0c, 0xce, 0x6e, 0xde, 0x6e, 0xe6, 0xf3, 0xde, 0x5a, 0xae, 0xdd, 0x8d, 0x3e, 0x7e, 0xfe, 0x85, 0xdc, 0x85, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x85, 0xdc, 0x7d, 0x9b, 0x75, 0x3b, 0x6d, 0xba, 0x54, 0x59, 0x44, 0x3a, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x7c, 0x6c, 0xcd, 0xe3, 0xfd, 0x60, 0xfe, 0xc4, 0xfe, 0xea, 0xd5, 0x32, 0xce, 0x39, 0xef, 0x3c, 0xef, 0x5e, 0xef, 0x3e, 0xe7, 0x5d, 0xe7, 0x7c, 0xef, 0x7d, 0xf7, 0x7d, 0xff, 0x36, 0xff, 0x48, 0xde, 0x44, 0xde, 0xa5, 0xcd, 0x88, 0xc5, 0xcc, 0xc5, 0x2e, 0xde, 0x6f, 0xe6, 0x90, 0xee, 0x90, 0xe6, 0x8e, 0xe6, 0xd2, 0xde, 0x39, 0xae, 0xfd, 0x8d, 0x1e, 0x8e, 0x3e, 0x96, 0x3e, 0x8e, 0x1e, 0x86, 0xfd, 0x85, 0xfd, 0x85, 0xdd, 0x85, 0xdc, 0x85, 0xfd, 0x85, 0xfd, 0x85, 0xdc, 0x7d, 0x5b, 0x6d, 0xb9, 0x54, 0x58, 0x44, 0x5a, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x74, 0xcd, 0xcd, 0xe4, 0xfd, 0x20, 0xfe, 0xa2, 0xf6, 0x08, 0xd6, 0x33, 0xd6, 0x1b, 0xe7, 0x3b, 0xe7, 0x1b, 0xe7, 0x3d, 0xe7, 0x3e, 0xe7, 0x3d, 0xe7, 0x3d, 0xef, 0x3d, 0xff, 0x36, 0xf7, 0x28, 0xce, 0xe4, 0xcd, 0x86, 0xc5, 0x29, 0xce, 0xaf, 0xde, 0xb2, 0xe6, 0x72, 0xe6, 0x71, 0xe6, 0x30, 0xe6, 0x10, 0xde, 0xee, 0xd5, 0xf0, 0xc5, 0x35, 0x95, 0x18, 0x75, 0x39, 0x75, 0x38, 0x75, 0x39, 0x75, 0x5b, 0x75, 0x9c, 0x85, 0xdd, 0x8d, 0xfd, 0x8d, 0x1d, 0x8e, 0xfd, 0x85, 0xbc, 0x7d, 0xdd, 0x7d, 0xdd, 0x7d, 0xbc, 0x7d, 0x5a, 0x6d, 0x9a, 0x4c, 0x3a, 0x3c, 0x1b, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0xf0, 0x84, 0xcb, 0xcd, 0x01, 0xfe, 0x40, 0xfe, 0x83, 0xfe, 0x0a, 0xde, 0x33, 0xce, 0xda, 0xe6, 0xfd, 0xe6, 0x1d, 0xe7, 0xfd, 0xde, 0xfc, 0xde, 0x3d, 0xe7, 0xfd, 0xe6, 0x3d, 0xff, 0xf8, 0xf6, 0xec, 0xc5, 0x84, 0xb5, 0xc9, 0xc5, 0x8e, 0xe6, 0xee, 0xe6, 0xd0, 0xde, 0x90, 0xd6, 0x30, 0xd6, 0xcf, 0xcd, 0x6f, 0xc5, 0x2d, 0xbd, 0x4a, 0xbd, 0xae, 0xc5, 0x55, 0x9d, 0x18, 0x7d, 0xf8, 0x7c, 0xf8, 0x7c, 0xf9, 0x7c, 0xd9, 0x74, 0x98, 0x6c, 0x77, 0x64, 0x97, 0x64, 0x3a, 0x75, 0xdc, 0x85, 0x1d, 0x8e, 0xfd, 0x85, 0xfd, 0x85, 0xfd, 0x85, 0xfc, 0x85, 0x9b, 0x75, 0xb8, 0x54, 0x39, 0x44, 0x7b, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x54, 0xf1, 0x94, 0xac, 0xd5, 0x02, 0xfe, 0x60, 0xfe, 0xc0, 0xfe, 0x0a, 0xde, 0xf6, 0xcd, 0xdc, 0xde, 0x1c, 0xe7, 0xfa, 0xde, 0xfc, 0xde, 0xde, 0xde, 0xfe, 0xde, 0xfb, 0xde, 0x5d, 0xf7, 0xf7, 0xee, 0xcc, 0xc5, 0x67, 0xb5, 0xed, 0xc5, 0xf1, 0xe6, 0xd0, 0xe6, 0x70, 0xde, 0x4f, 0xd6, 0x0e, 0xc6, 0xcc, 0xbd, 0xce, 0xc5, 0x33, 0xde, 0xb4, 0xee, 0xf1, 0xf6, 0x14, 0xf7, 0xfb, 0xd6, 0xde, 0xbe, 0xbe, 0xb6, 0x7d, 0xb6, 0x7e, 0xae, 0x3e, 0xa6, 0xfd, 0x9d, 0xbc, 0x95, 0x3a, 0x7d, 0x98, 0x6c, 0x77, 0x5c, 0xf8, 0x64, 0xbc, 0x7d, 0xfd, 0x85, 0xbc, 0x85, 0xdc, 0x85, 0xdc, 0x85, 0xbb, 0x7d, 0x19, 0x6d, 0x39, 0x44, 0x7a, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x5c, 0xd3, 0x8c, 0x8a, 0xdd, 0xe3, 0xfd, 0x60, 0xf6, 0x03, 0xef, 0x28, 0xde, 0xf4, 0xc5, 0xfc, 0xd6, 0xfc, 0xde, 0xdb, 0xde, 0x1a, 0xe7, 0xfa, 0xde, 0xdc, 0xde, 0xdd, 0xe6, 0x3d, 0xf7, 0x18, 0xe7, 0xcd, 0xbd, 0x43, 0xa5, 0x8c, 0xce, 0x30, 0xe7, 0x10, 0xdf, 0x90, 0xde, 0xd1, 0xd5, 0x91, 0xc5, 0xd3, 0xcd, 0xd7, 0xe6, 0x99, 0xf7, 0x97, 0xff, 0x54, 0xff, 0x0e, 0xff, 0xf1, 0xf6, 0x98, 0xd6, 0xbd, 0xbe, 0x9e, 0xb6, 0x5e, 0xb6, 0x3d, 0xae, 0x1d, 0xa6, 0x1e, 0xa6, 0x1e, 0x9e, 0xfd, 0x95, 0xdd, 0x8d, 0x5b, 0x7d, 0xb8, 0x64, 0x57, 0x54, 0xf9, 0x6c, 0xdd, 0x85, 0xdd, 0x85, 0xbd, 0x85, 0xdc, 0x85, 0xdc, 0x7d, 0x19, 0x65, 0x58, 0x44, 0x7b, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x84, 0x8a, 0xd5, 0xa1, 0xfd, 0x00, 0xfe, 0xe0, 0xf6, 0x47, 0xd6, 0xd5, 0xcd, 0xfd, 0xde, 0x19, 0xcf, 0xfa, 0xde, 0xbc, 0xde, 0xbb, 0xde, 0xfa, 0xde, 0xfa, 0xde, 0xda, 0xee, 0xf8, 0xf6, 0xee, 0xc5, 0x46, 0xad, 0x6d, 0xce, 0x51, 0xe7, 0x2f, 0xe7, 0x6e, 0xce, 0xf0, 0xc5, 0xb2, 0xc5, 0x98, 0xe6, 0x7d, 0xff, 0xde, 0xff, 0xba, 0xff, 0x55, 0xff, 0x10, 0xff, 0xcc, 0xfe, 0xd0, 0xfe, 0x99, 0xde, 0xbe, 0xbe, 0x9e, 0xbe, 0xbe, 0xbe, 0xbe, 0xb6, 0x7e, 0xae, 0x5e, 0xa6, 0x1e, 0x9e, 0xfd, 0x95, 0xfe, 0x95, 0xbd, 0x85, 0x7d, 0x7d, 0x1b, 0x75, 0x57, 0x54, 0x78, 0x54, 0x7d, 0x7d, 0xde, 0x85, 0xbc, 0x7d, 0xdc, 0x7d, 0xfc, 0x7d, 0xf9, 0x5c, 0x59, 0x44, 0x7c, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xb5, 0x65, 0xf6, 0xe0, 0xfd, 0xe1, 0xfd, 0x40, 0xf6, 0x2e, 0xe6, 0x9b, 0xde, 0xdd, 0xd6, 0xda, 0xd6, 0xfa, 0xd6, 0xdc, 0xde, 0xdd, 0xde, 0xdc, 0xde, 0xfa, 0xe6, 0x17, 0xf7, 0xcd, 0xcd, 0x26, 0xad, 0x2c, 0xce, 0x12, 0xe7, 0xf3, 0xde, 0x71, 0xce, 0xb1, 0xc5, 0xd3, 0xc5, 0x39, 0xe7, 0xfe, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xb9, 0xff, 0x73, 0xff, 0x0e, 0xff, 0xe9, 0xfe, 0xce, 0xfe, 0xb8, 0xde, 0xdf, 0xc6, 0xdf, 0xbe, 0x9f, 0xb6, 0x9e, 0xae, 0x7e, 0xa6, 0x7e, 0xa6, 0x7e, 0xa6, 0x3e, 0x9e, 0xfe, 0x8d, 0xfe, 0x8d, 0xbf, 0x85, 0x9e, 0x85, 0x1b, 0x6d, 0x17, 0x4c, 0xf6, 0x43, 0x5b, 0x6d, 0xfd, 0x85, 0xbb, 0x7d, 0xbc, 0x7d, 0xbd, 0x7d, 0xdb, 0x5c, 0x39, 0x44, 0x9b, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xde, 0x24, 0xf6, 0x01, 0xf6, 0x20, 0xfe, 0x02, 0xf6, 0x29, 0xee, 0x92, 0xee, 0xb8, 0xee, 0xb9, 0xe6, 0xf9, 0xe6, 0xd9, 0xe6, 0x9b, 0xe6, 0x99, 0xee, 0x92, 0xee, 0x4a, 0xd6, 0x85, 0xbd, 0xaa, 0xc5, 0xf2, 0xe6, 0xf3, 0xe6, 0x92, 0xd6, 0x91, 0xbd, 0xd3, 0xbd, 0x9b, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xda, 0xff, 0x97, 0xff, 0x52, 0xff, 0xec, 0xfe, 0xa7, 0xfe, 0xed, 0xf6, 0xd7, 0xd6, 0xfe, 0xbe, 0xdf, 0xbe, 0xbf, 0xbe, 0xbf, 0xb6, 0x9f, 0xae, 0x7e, 0xa6, 0x5e, 0xa6, 0x3e, 0x9e, 0x1e, 0x96, 0xff, 0x8d, 0xff, 0x8d, 0xbf, 0x85, 0x7e, 0x75, 0x3c, 0x6d, 0x17, 0x4c, 0xd6, 0x43, 0x5b, 0x6d, 0xfd, 0x85, 0xbd, 0x7d, 0xbd, 0x7d, 0x9c, 0x75, 0x98, 0x4c, 0x38, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xde, 0x65, 0xfe, 0xa1, 0xfd, 0xe0, 0xfd, 0x00, 0xfe, 0x01, 0xfe, 0x05, 0xf6, 0x2a, 0xf6, 0x4e, 0xf6, 0x50, 0xee, 0x6e, 0xee, 0x2c, 0xee, 0x49, 0xee, 0x65, 0xee, 0xe0, 0xd5, 0x86, 0xbd, 0xb0, 0xe6, 0xf2, 0xe6, 0x72, 0xd6, 0x90, 0xb5, 0x92, 0xbd, 0x5a, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xb7, 0xff, 0x53, 0xff, 0x0e, 0xff, 0xa9, 0xfe, 0x84, 0xfe, 0xcc, 0xf6, 0xd8, 0xd6, 0xfe, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0xbf, 0xb6, 0xbf, 0xae, 0x9f, 0xa6, 0x7f, 0xa6, 0x5f, 0x9e, 0x3f, 0x96, 0xfe, 0x8d, 0xde, 0x8d, 0xbe, 0x85, 0x9e, 0x85, 0x7d, 0x75, 0x3c, 0x6d, 0x18, 0x4c, 0xf6, 0x43, 0x7c, 0x75, 0xdd, 0x7d, 0x9d, 0x75, 0x7c, 0x6d, 0x1a, 0x65, 0x38, 0x3c, 0x5c, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd6, 0xa4, 0xfe, 0x21, 0xfe, 0xc1, 0xfd, 0xc0, 0xfd, 0xe0, 0xfd, 0x00, 0xfe, 0xe0, 0xfd, 0xc0, 0xfd, 0x00, 0xfe, 0x20, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x22, 0xee, 0x45, 0xc5, 0xed, 0xcd, 0x11, 0xe7, 0xd0, 0xd6, 0xcf, 0xbd, 0x4f, 0xb5, 0x57, 0xf7, 0xda, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xda, 0xff, 0x96, 0xff, 0x72, 0xff, 0x0e, 0xff, 0xc9, 0xfe, 0x85, 0xfe, 0x60, 0xfe, 0xcc, 0xfe, 0xd8, 0xde, 0xff, 0xce, 0xdf, 0xc6, 0xbe, 0xc6, 0xde, 0xbe, 0xbf, 0xae, 0x7e, 0xae, 0x5f, 0xa6, 0x3f, 0x9e, 0x3e, 0x9e, 0x1e, 0x96, 0xfe, 0x8d, 0xbd, 0x8d, 0xbe, 0x85, 0x7d, 0x7d, 0x7e, 0x75, 0x3d, 0x65, 0xf8, 0x3b, 0x58, 0x44, 0x7d, 0x6d, 0x5c, 0x65, 0x3b, 0x65, 0x3b, 0x65, 0xda, 0x54, 0x3a, 0x44, 0x5c, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xd5, 0xa4, 0xfe, 0xa7, 0xfe, 0x67, 0xfe, 0x26, 0xfe, 0x23, 0xfe, 0x00, 0xfe, 0xe0, 0xfd, 0xe0, 0xfd, 0x20, 0xfe, 0x20, 0xfe, 0x41, 0xfe, 0x43, 0xfe, 0xa6, 0xdd, 0x4d, 0xbd, 0xb3, 0xde, 0x10, 0xdf, 0x50, 0xc6, 0xad, 0x9c, 0x95, 0xde, 0xd6, 0xff, 0x74, 0xff, 0x95, 0xff, 0x95, 0xff, 0x73, 0xff, 0x30, 0xff, 0x0c, 0xff, 0xc8, 0xfe, 0x85, 0xfe, 0x62, 0xfe, 0x60, 0xfe, 0xcc, 0xfe, 0xd9, 0xe6, 0xff, 0xce, 0xdf, 0xc6, 0xde, 0xc6, 0xde, 0xbe, 0xbe, 0xb6, 0x7e, 0xae, 0x5e, 0xae, 0x3e, 0xa6, 0x3e, 0x9e, 0x1e, 0x96, 0xfd, 0x8d, 0xde, 0x8d, 0xde, 0x85, 0xdf, 0x85, 0x7e, 0x75, 0x5e, 0x65, 0xdc, 0x54, 0xf8, 0x33, 0x79, 0x44, 0x5c, 0x5d, 0xfa, 0x54, 0x5b, 0x5d, 0x1b, 0x5d, 0x18, 0x3c, 0x19, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xd5, 0xa4, 0xfe, 0x07, 0xff, 0x28, 0xff, 0x27, 0xff, 0x05, 0xff, 0xc5, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xa9, 0xf6, 0x69, 0xc5, 0xf0, 0xc5, 0x34, 0xdf, 0xb1, 0xce, 0xee, 0x9c, 0x71, 0xbd, 0x76, 0xff, 0x31, 0xff, 0x2f, 0xff, 0x50, 0xff, 0x2e, 0xff, 0x0c, 0xff, 0xe9, 0xfe, 0xa6, 0xfe, 0xa3, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x80, 0xfe, 0xcc, 0xfe, 0xd9, 0xe6, 0xff, 0xce, 0xfe, 0xc6, 0xde, 0xc6, 0xde, 0xbe, 0xbe, 0xb6, 0x7e, 0xae, 0x5e, 0xae, 0x5e, 0xa6, 0x5f, 0x9e, 0x3f, 0x8e, 0xff, 0x85, 0xdf, 0x7d, 0x7d, 0x6d, 0x3d, 0x65, 0xfd, 0x54, 0xbc, 0x4c, 0xbc, 0x4c, 0x3a, 0x3c, 0xb7, 0x23, 0xfb, 0x54, 0x5c, 0x5d, 0x1b, 0x5d, 0x1b, 0x5d, 0x78, 0x4c, 0xf6, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xd5, 0xa2, 0xfe, 0x03, 0xff, 0x64, 0xff, 0x64, 0xff, 0x45, 0xff, 0x46, 0xff, 0x48, 0xff, 0x49, 0xff, 0x8a, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xe9, 0xe6, 0xc9, 0xbd, 0xcf, 0xce, 0x4f, 0xd7, 0xee, 0xb5, 0x2d, 0x94, 0xf5, 0xf6, 0x0f, 0xff, 0xe9, 0xfe, 0xea, 0xfe, 0xcb, 0xfe, 0xc9, 0xfe, 0xc6, 0xfe, 0xa5, 0xfe, 0x83, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0xcc, 0xfe, 0xd8, 0xe6, 0x1f, 0xcf, 0xff, 0xce, 0xde, 0xc6, 0xbe, 0xbe, 0x9e, 0xb6, 0x7e, 0xae, 0x7e, 0xae, 0x7f, 0xa6, 0x3f, 0x8e, 0xdf, 0x7d, 0x5e, 0x65, 0xfd, 0x4c, 0x9c, 0x44, 0x5c, 0x3c, 0x7c, 0x3c, 0x7c, 0x44, 0x5c, 0x3c, 0x5b, 0x3c, 0xf9, 0x2b, 0x39, 0x34, 0x7d, 0x5d, 0x3c, 0x55, 0x1b, 0x5d, 0xd9, 0x5c, 0x38, 0x44, 0x1a, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xd5, 0xa2, 0xfe, 0x02, 0xff, 0x43, 0xff, 0x43, 0xff, 0x23, 0xff, 0x23, 0xff, 0x43, 0xff, 0x63, 0xff, 0xa4, 0xff, 0xa4, 0xff, 0x86, 0xf7, 0x67, 0xce, 0x0c, 0xbe, 0x11, 0xd7, 0xd0, 0xce, 0xcc, 0x9c, 0x71, 0xc5, 0x31, 0xff, 0xc7, 0xfe, 0xa4, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xa5, 0xfe, 0x83, 0xfe, 0x82, 0xfe, 0x61, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0xac, 0xfe, 0xd9, 0xde, 0xfe, 0xce, 0xfe, 0xce, 0xde, 0xc6, 0x9e, 0xbe, 0xbf, 0xb6, 0xbf, 0xae, 0x3f, 0x96, 0x9d, 0x7d, 0xfc, 0x5c, 0x7b, 0x44, 0x7c, 0x3c, 0x5c, 0x34, 0x7c, 0x3c, 0x9d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7c, 0x44, 0x3b, 0x3c, 0xd8, 0x2b, 0xdb, 0x4c, 0x5c, 0x65, 0x1a, 0x5d, 0x1b, 0x5d, 0x59, 0x44, 0x1a, 0x34, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xd5, 0xa2, 0xfe, 0x02, 0xff, 0x23, 0xff, 0x23, 0xff, 0x24, 0xff, 0x23, 0xff, 0x23, 0xff, 0x63, 0xff, 0x84, 0xff, 0x85, 0xff, 0x27, 0xef, 0x29, 0xc6, 0x6f, 0xc6, 0xf2, 0xde, 0x50, 0xc6, 0x4c, 0x94, 0x71, 0xe6, 0x0c, 0xff, 0xa0, 0xfe, 0x82, 0xfe, 0x83, 0xfe, 0xa1, 0xfe, 0x81, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0xac, 0xfe, 0xd8, 0xde, 0x1e, 0xcf, 0xfd, 0xc6, 0xfe, 0xc6, 0xdf, 0xbe, 0x7f, 0x9e, 0x9d, 0x7d, 0xbc, 0x54, 0x5c, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x9d, 0x3c, 0x9d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7c, 0x3c, 0xd9, 0x33, 0x9a, 0x4c, 0x5c, 0x65, 0x1a, 0x5d, 0x3c, 0x5d, 0x7a, 0x4c, 0x3a, 0x3c, 0x1d, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xd5, 0xa2, 0xfe, 0x02, 0xff, 0x23, 0xff, 0x23, 0xff, 0x23, 0xff, 0x03, 0xff, 0x23, 0xff, 0x63, 0xff, 0x84, 0xff, 0x65, 0xff, 0xc6, 0xe6, 0x09, 0xc6, 0xd1, 0xd6, 0xd2, 0xd6, 0xae, 0xbd, 0xcc, 0xac, 0xef, 0xf6, 0xc8, 0xf6, 0x80, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0xcd, 0xfe, 0xd7, 0xe6, 0xfd, 0xc6, 0x1e, 0xbf, 0x1f, 0xbf, 0x1f, 0x8e, 0xfd, 0x5c, 0x7c, 0x44, 0x5c, 0x3c, 0x7d, 0x3c, 0x7e, 0x3c, 0x7e, 0x34, 0x7d, 0x34, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x34, 0x7d, 0x34, 0x7d, 0x34, 0x7d, 0x34, 0x7d, 0x3c, 0x7c, 0x3c, 0x1a, 0x34, 0x39, 0x3c, 0x3c, 0x65, 0x3b, 0x65, 0x3c, 0x5d, 0xba, 0x54, 0x39, 0x44, 0x1a, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xd5, 0xa2, 0xfe, 0xe3, 0xfe, 0x23, 0xff, 0x03, 0xff, 0x23, 0xff, 0x03, 0xff, 0x23, 0xff, 0x63, 0xff, 0x84, 0xff, 0x65, 0xff, 0x85, 0xd6, 0x2a, 0xbe, 0xf2, 0xde, 0x71, 0xce, 0x2c, 0xad, 0x8d, 0xc5, 0x2d, 0xff, 0x83, 0xfe, 0x80, 0xfe, 0x61, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x62, 0xfe, 0x8c, 0xfe, 0xb7, 0xde, 0x3f, 0xcf, 0xdf, 0xae, 0xbd, 0x7d, 0x7b, 0x44, 0x5b, 0x34, 0x7b, 0x34, 0x9c, 0x3c, 0x9d, 0x3c, 0x7c, 0x34, 0x9c, 0x34, 0x9c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x3b, 0x3c, 0xf8, 0x33, 0x1b, 0x5d, 0x5c, 0x65, 0x3c, 0x5d, 0xfa, 0x5c, 0x38, 0x44, 0x1a, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xd5, 0xa1, 0xfe, 0xe3, 0xfe, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x02, 0xff, 0x22, 0xff, 0x43, 0xff, 0x64, 0xff, 0x65, 0xf7, 0x65, 0xce, 0x4c, 0xbe, 0x33, 0xdf, 0x50, 0xc6, 0x0b, 0xa5, 0x0e, 0xde, 0xeb, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x43, 0xfe, 0x8d, 0xfe, 0xd9, 0xde, 0x9f, 0xae, 0x5c, 0x6d, 0x3b, 0x3c, 0x5c, 0x3c, 0x9c, 0x3c, 0x9c, 0x3c, 0x7c, 0x34, 0x7b, 0x34, 0x9c, 0x3c, 0x9c, 0x3c, 0x7c, 0x34, 0x7c, 0x3c, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x3c, 0x5b, 0x3c, 0xd8, 0x33, 0xda, 0x54, 0x7c, 0x65, 0x1c, 0x5d, 0x1a, 0x65, 0x37, 0x4c, 0x16, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xd5, 0x81, 0xfe, 0xc3, 0xfe, 0x03, 0xff, 0x02, 0xff, 0x02, 0xff, 0x02, 0xff, 0x02, 0xff, 0x43, 0xff, 0x44, 0xff, 0x24, 0xef, 0x66, 0xc6, 0x8d, 0xc6, 0x33, 0xdf, 0x50, 0xc6, 0x0b, 0xad, 0x6e, 0xe6, 0xca, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x60, 0xfe, 0x81, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x42, 0xfe, 0xce, 0xfe, 0x58, 0xbe, 0xba, 0x54, 0x5a, 0x34, 0x9d, 0x3c, 0x7e, 0x3c, 0x7d, 0x3c, 0x9d, 0x3c, 0x7c, 0x34, 0x7c, 0x3c, 0x7d, 0x3c, 0x5c, 0x3c, 0x7c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x34, 0x7c, 0x3c, 0x5c, 0x3c, 0xd8, 0x33, 0x9a, 0x4c, 0x7d, 0x65, 0x3c, 0x5d, 0x1a, 0x65, 0x37, 0x4c, 0x56, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xd5, 0x81, 0xfe, 0xc2, 0xfe, 0x02, 0xff, 0x02, 0xff, 0x02, 0xff, 0xe2, 0xfe, 0x02, 0xff, 0x23, 0xff, 0x43, 0xff, 0xe4, 0xee, 0x46, 0xc6, 0xae, 0xce, 0x13, 0xdf, 0x50, 0xc6, 0x0a, 0xad, 0xac, 0xee, 0xc9, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0xa0, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x63, 0xfe, 0x8d, 0xee, 0x34, 0x8d, 0x59, 0x34, 0x9c, 0x34, 0x9e, 0x3c, 0x7e, 0x3c, 0x7c, 0x3c, 0x7c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x5c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x5c, 0x3c, 0x5c, 0x3c, 0x5c, 0x3c, 0x5c, 0x34, 0x7d, 0x3c, 0x5c, 0x3c, 0xf9, 0x3b, 0x79, 0x4c, 0x7d, 0x65, 0x3d, 0x5d, 0x3b, 0x6d, 0x17, 0x4c, 0x95, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x81, 0xfe, 0xc2, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0x02, 0xff, 0xe2, 0xfe, 0x02, 0xff, 0x23, 0xff, 0x43, 0xff, 0xe3, 0xee, 0x25, 0xc6, 0xce, 0xce, 0x33, 0xd7, 0x2f, 0xc6, 0x2a, 0xad, 0xcc, 0xee, 0x07, 0xff, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0xa0, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x42, 0xfe, 0x22, 0xfe, 0x41, 0xfe, 0x4a, 0xee, 0xf3, 0x84, 0x7b, 0x34, 0x7d, 0x3c, 0x9d, 0x3c, 0x7d, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7b, 0x34, 0x7b, 0x3c, 0x7b, 0x3c, 0x5b, 0x34, 0x7b, 0x34, 0x5b, 0x3c, 0x5c, 0x3c, 0x7c, 0x3c, 0xf9, 0x33, 0x79, 0x4c, 0x7d, 0x6d, 0x5d, 0x5d, 0x1b, 0x65, 0x57, 0x4c, 0x3a, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x81, 0xfe, 0xa2, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0x23, 0xff, 0x43, 0xff, 0xe3, 0xf6, 0x25, 0xce, 0xad, 0xc6, 0x13, 0xd7, 0x2f, 0xc6, 0x4b, 0xb5, 0xab, 0xee, 0xe7, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x62, 0xfe, 0x42, 0xfe, 0x02, 0xfe, 0x00, 0xf6, 0x2a, 0xee, 0xf4, 0x8c, 0x7b, 0x34, 0x7d, 0x3c, 0x9d, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x5c, 0x3c, 0x5c, 0x3c, 0x5b, 0x3c, 0x7b, 0x3c, 0x5b, 0x3c, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x7c, 0x3c, 0x5b, 0x3c, 0xf9, 0x3b, 0x9a, 0x54, 0x7d, 0x6d, 0x5d, 0x5d, 0x3b, 0x65, 0x37, 0x4c, 0xb7, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x81, 0xfe, 0xa2, 0xfe, 0xc2, 0xfe, 0xc2, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0x03, 0xff, 0x44, 0xff, 0xe3, 0xf6, 0x45, 0xce, 0x6c, 0xc6, 0x13, 0xd7, 0x30, 0xc6, 0x4b, 0xb5, 0x8b, 0xee, 0xc7, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0xa1, 0xfe, 0x60, 0xfe, 0x81, 0xfe, 0x80, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x42, 0xfe, 0x03, 0xfe, 0xc2, 0xfd, 0xc0, 0xed, 0x0a, 0xee, 0xf4, 0x8c, 0x5b, 0x34, 0x7d, 0x3c, 0x9c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7b, 0x3c, 0x7b, 0x3c, 0x7b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5c, 0x3c, 0x5b, 0x3c, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x3b, 0x34, 0x5a, 0x3c, 0x39, 0x44, 0x99, 0x54, 0x7d, 0x6d, 0x3d, 0x5d, 0x1b, 0x65, 0x37, 0x4c, 0x56, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x81, 0xfe, 0xa2, 0xfe, 0xc2, 0xfe, 0xc2, 0xfe, 0xc1, 0xfe, 0xc1, 0xfe, 0xe2, 0xfe, 0x03, 0xff, 0x44, 0xff, 0xe3, 0xf6, 0x44, 0xce, 0x2b, 0xc6, 0xf2, 0xd6, 0x50, 0xce, 0x4b, 0xb5, 0x4a, 0xe6, 0xe8, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x81, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x42, 0xfe, 0x43, 0xfe, 0xe3, 0xfd, 0xa2, 0xf5, 0xc0, 0xed, 0x0a, 0xee, 0xf4, 0x8c, 0x5b, 0x34, 0x5c, 0x3c, 0x9c, 0x34, 0x9c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x34, 0x7c, 0x34, 0x5b, 0x3c, 0x7b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x34, 0x5b, 0x2c, 0x5b, 0x2c, 0x7b, 0x34, 0x7a, 0x34, 0x3a, 0x34, 0x5a, 0x3c, 0x3d, 0x65, 0x79, 0x54, 0xba, 0x5c, 0x7d, 0x6d, 0x3d, 0x5d, 0x1b, 0x65, 0x17, 0x4c, 0x56, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x61, 0xfe, 0xa2, 0xfe, 0xc2, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xc1, 0xfe, 0xc1, 0xfe, 0x02, 0xff, 0x23, 0xff, 0xe3, 0xf6, 0x44, 0xd6, 0x2a, 0xc6, 0xd1, 0xd6, 0x90, 0xce, 0x8b, 0xb5, 0x0a, 0xde, 0xc9, 0xfe, 0x81, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0xa1, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x42, 0xfe, 0x42, 0xfe, 0x23, 0xfe, 0xc2, 0xf5, 0x82, 0xf5, 0xc0, 0xed, 0x0b, 0xe6, 0xf4, 0x8c, 0x5b, 0x34, 0x5c, 0x3c, 0x9c, 0x3c, 0x9c, 0x34, 0x7d, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x5c, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x2c, 0x5b, 0x2c, 0x7b, 0x2c, 0x5b, 0x2c, 0x39, 0x2c, 0x18, 0x34, 0x5c, 0x6d, 0x5f, 0x8e, 0x78, 0x54, 0x1b, 0x65, 0x5d, 0x6d, 0x3c, 0x65, 0xfb, 0x5c, 0x18, 0x44, 0x1a, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x61, 0xfe, 0x82, 0xfe, 0xa2, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xc1, 0xfe, 0x02, 0xff, 0x23, 0xff, 0x02, 0xff, 0x63, 0xde, 0x08, 0xc6, 0x8f, 0xce, 0xd0, 0xd6, 0xec, 0xbd, 0x8a, 0xcd, 0xaa, 0xfe, 0xa3, 0xfe, 0x80, 0xfe, 0x81, 0xfe, 0x81, 0xfe, 0x60, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x42, 0xfe, 0x42, 0xfe, 0x02, 0xf6, 0xa2, 0xf5, 0x82, 0xf5, 0xc0, 0xed, 0x0b, 0xe6, 0xf4, 0x84, 0x5b, 0x2c, 0x5c, 0x3c, 0x7c, 0x3c, 0x7b, 0x3c, 0x7c, 0x34, 0x7c, 0x34, 0x5b, 0x34, 0x5b, 0x3c, 0x5b, 0x3c, 0x5a, 0x3c, 0x5b, 0x3c, 0x5b, 0x34, 0x5b, 0x2c, 0x7b, 0x2c, 0x5b, 0x2c, 0x3a, 0x2c, 0x38, 0x2c, 0xd9, 0x54, 0x5e, 0x96, 0x1d, 0x8e, 0x36, 0x54, 0x5c, 0x6d, 0x3c, 0x65, 0x3c, 0x65, 0xba, 0x54, 0x3a, 0x3c, 0x1a, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x61, 0xfe, 0x82, 0xfe, 0x82, 0xfe, 0x81, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xe2, 0xfe, 0x23, 0xff, 0x02, 0xff, 0x63, 0xe6, 0x07, 0xc6, 0x4d, 0xc6, 0xf0, 0xd6, 0x4e, 0xc6, 0x49, 0xbd, 0x8a, 0xf6, 0xa4, 0xfe, 0xa0, 0xfe, 0x81, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x41, 0xfe, 0x42, 0xfe, 0x42, 0xfe, 0x22, 0xfe, 0xe1, 0xf5, 0xa1, 0xf5, 0xa2, 0xf5, 0xc0, 0xed, 0x0b, 0xe6, 0xf5, 0x84, 0x7b, 0x2c, 0x7c, 0x3c, 0x7b, 0x3c, 0x5b, 0x3c, 0x7c, 0x34, 0x7b, 0x3c, 0x5b, 0x3c, 0x5a, 0x3c, 0x5a, 0x3c, 0x5a, 0x3c, 0x5a, 0x3c, 0x3b, 0x34, 0x3a, 0x2c, 0x5b, 0x2c, 0x3b, 0x34, 0x39, 0x34, 0x9a, 0x4c, 0x1d, 0x8e, 0xbe, 0xae, 0xf8, 0x74, 0x77, 0x54, 0x9d, 0x75, 0x3c, 0x65, 0x5c, 0x6d, 0x59, 0x4c, 0x3b, 0x3c, 0x1b, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x41, 0xfe, 0x41, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x81, 0xfe, 0xc2, 0xfe, 0x02, 0xff, 0x02, 0xff, 0x81, 0xee, 0x45, 0xce, 0xea, 0xbd, 0x8f, 0xc6, 0xd0, 0xce, 0x6b, 0xb5, 0x28, 0xe6, 0xc6, 0xfe, 0x82, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x42, 0xfe, 0x02, 0xfe, 0xc2, 0xf5, 0xc2, 0xf5, 0xc2, 0xed, 0xc0, 0xed, 0xeb, 0xe5, 0xf4, 0x8c, 0x5b, 0x2c, 0x7c, 0x34, 0x7b, 0x34, 0x5b, 0x3c, 0x5b, 0x3c, 0x7b, 0x3c, 0x5a, 0x3c, 0x5a, 0x34, 0x5a, 0x34, 0x5a, 0x34, 0x3a, 0x34, 0x5a, 0x34, 0x5b, 0x2c, 0x3b, 0x2c, 0x19, 0x34, 0x58, 0x4c, 0xbc, 0x85, 0x9e, 0xae, 0x1c, 0x96, 0x77, 0x4c, 0x3b, 0x5d, 0x7b, 0x6d, 0x3a, 0x6d, 0x3b, 0x65, 0x39, 0x44, 0x1a, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x40, 0xfe, 0x61, 0xfe, 0xa1, 0xfe, 0xe2, 0xfe, 0x01, 0xff, 0xc0, 0xf6, 0x43, 0xd6, 0xc8, 0xbd, 0x4d, 0xc6, 0x10, 0xd7, 0x0c, 0xc6, 0x87, 0xcd, 0xa7, 0xfe, 0x43, 0xfe, 0x81, 0xfe, 0xa0, 0xfe, 0x41, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x22, 0xfe, 0xe2, 0xf5, 0xc2, 0xf5, 0xc2, 0xf5, 0xc2, 0xed, 0xc0, 0xed, 0xeb, 0xe5, 0xf4, 0x84, 0x5b, 0x2c, 0x5c, 0x34, 0x7a, 0x3c, 0x5b, 0x34, 0x5b, 0x34, 0x5a, 0x34, 0x5a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x1a, 0x2c, 0x5a, 0x2c, 0x39, 0x2c, 0x78, 0x44, 0xbb, 0x85, 0x3c, 0xae, 0x5b, 0xae, 0x58, 0x75, 0x78, 0x44, 0xbe, 0x65, 0x5d, 0x65, 0x3b, 0x65, 0xf9, 0x5c, 0x19, 0x3c, 0x5b, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x20, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0xc1, 0xfe, 0x01, 0xff, 0x00, 0xff, 0x82, 0xe6, 0x85, 0xbd, 0xca, 0xbd, 0xee, 0xd6, 0x8d, 0xce, 0x8a, 0xc5, 0x28, 0xee, 0x86, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x82, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x21, 0xfe, 0xe2, 0xf5, 0xc2, 0xed, 0xc2, 0xed, 0xc2, 0xed, 0xc0, 0xed, 0x0b, 0xe6, 0xf4, 0x84, 0x5c, 0x24, 0x5c, 0x34, 0x7a, 0x3c, 0x5b, 0x3c, 0x7b, 0x34, 0x5a, 0x34, 0x5a, 0x34, 0x5b, 0x2c, 0x5b, 0x2c, 0x3a, 0x2c, 0x5a, 0x34, 0x39, 0x34, 0x18, 0x34, 0x78, 0x44, 0xdb, 0x7d, 0x5b, 0x9e, 0x39, 0xa6, 0xf9, 0x95, 0x76, 0x54, 0x5c, 0x65, 0x5e, 0x5d, 0x3d, 0x5d, 0x1c, 0x65, 0x78, 0x4c, 0xf8, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x41, 0xfe, 0x21, 0xfe, 0x41, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0xc1, 0xfe, 0x01, 0xff, 0x20, 0xff, 0xc2, 0xf6, 0x84, 0xcd, 0x28, 0xb5, 0x8c, 0xd6, 0xee, 0xd6, 0x0d, 0xce, 0x48, 0xcd, 0x67, 0xfe, 0xc3, 0xfe, 0x60, 0xfe, 0x82, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x21, 0xf6, 0x02, 0xf6, 0xe2, 0xf5, 0xc2, 0xed, 0xc2, 0xed, 0xc0, 0xed, 0xeb, 0xdd, 0xf5, 0x84, 0x5c, 0x2c, 0x7c, 0x34, 0x7a, 0x3c, 0x5b, 0x3c, 0x5b, 0x34, 0x3b, 0x34, 0x5b, 0x34, 0x7b, 0x2c, 0x5b, 0x2c, 0x5a, 0x2c, 0x39, 0x2c, 0x17, 0x34, 0xd9, 0x5c, 0xfc, 0x8d, 0x3c, 0x9e, 0x3b, 0x96, 0x5b, 0x96, 0x38, 0x6d, 0x78, 0x54, 0x9d, 0x6d, 0x3c, 0x5d, 0x3d, 0x65, 0xdc, 0x5c, 0xd9, 0x3b, 0x1a, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0x40, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x20, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0xc1, 0xfe, 0x01, 0xff, 0x40, 0xff, 0x02, 0xff, 0xe4, 0xdd, 0xe5, 0xb4, 0x09, 0xce, 0xcd, 0xd6, 0x8f, 0xde, 0xab, 0xc5, 0xa6, 0xd5, 0xa5, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x21, 0xf6, 0x01, 0xf6, 0xe2, 0xf5, 0xc2, 0xed, 0xc2, 0xe5, 0xc0, 0xe5, 0xeb, 0xdd, 0xf4, 0x84, 0x5b, 0x2c, 0x5b, 0x34, 0x7a, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x3b, 0x34, 0x3a, 0x34, 0x3a, 0x2c, 0x18, 0x2c, 0x17, 0x2c, 0x57, 0x3c, 0x59, 0x6d, 0x1b, 0x9e, 0x1b, 0xa6, 0xfa, 0x9d, 0x5c, 0x96, 0x9b, 0x6d, 0x78, 0x44, 0x7d, 0x6d, 0x5c, 0x6d, 0x1a, 0x65, 0x3c, 0x65, 0x3a, 0x44, 0x99, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xd5, 0x20, 0xfe, 0x21, 0xfe, 0x41, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x20, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0xc1, 0xfe, 0x01, 0xff, 0x40, 0xff, 0x22, 0xff, 0x44, 0xee, 0x04, 0xbd, 0xa6, 0xc5, 0x29, 0xce, 0xcf, 0xde, 0x8d, 0xd6, 0xa8, 0xcd, 0xc4, 0xe5, 0x62, 0xfe, 0x82, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x20, 0xf6, 0x01, 0xf6, 0x02, 0xf6, 0xe2, 0xed, 0xc2, 0xe5, 0xe2, 0xe5, 0x0b, 0xe6, 0xf4, 0x84, 0x5b, 0x2c, 0x7b, 0x34, 0x7a, 0x34, 0x7b, 0x34, 0x7b, 0x34, 0x3a, 0x34, 0x19, 0x34, 0x18, 0x2c, 0x58, 0x44, 0xf9, 0x64, 0xbb, 0x8d, 0x9d, 0xae, 0xdc, 0xbe, 0x9a, 0xb6, 0xdc, 0xb6, 0xbb, 0x85, 0x79, 0x44, 0x3c, 0x55, 0xbd, 0x6d, 0x3a, 0x65, 0x3b, 0x6d, 0xdb, 0x5c, 0xb8, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xd5, 0x00, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x20, 0xfe, 0x81, 0xfe, 0xe1, 0xfe, 0x00, 0xff, 0x20, 0xff, 0x42, 0xff, 0x65, 0xf6, 0x43, 0xc5, 0xc3, 0xcd, 0xc6, 0xc5, 0x6b, 0xd6, 0xce, 0xde, 0x6d, 0xd6, 0xa7, 0xcd, 0xe3, 0xe5, 0x43, 0xfe, 0x41, 0xfe, 0x20, 0xf6, 0x20, 0xf6, 0x22, 0xf6, 0x02, 0xee, 0xc2, 0xed, 0xe3, 0xf5, 0xe5, 0xe5, 0x0e, 0xe6, 0xb2, 0x8c, 0x17, 0x44, 0x39, 0x44, 0x39, 0x3c, 0x59, 0x3c, 0x59, 0x3c, 0x18, 0x3c, 0x58, 0x54, 0xb9, 0x74, 0x7a, 0x8d, 0x3b, 0xa6, 0xbc, 0xbe, 0x1d, 0xd7, 0x3d, 0xdf, 0xbf, 0xdf, 0xbb, 0xae, 0xb6, 0x64, 0xfa, 0x74, 0x5c, 0x7d, 0x1a, 0x5d, 0x19, 0x6d, 0xda, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xd5, 0xe1, 0xfd, 0x20, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x81, 0xfe, 0xc1, 0xfe, 0xe0, 0xfe, 0x00, 0xff, 0x42, 0xff, 0xa6, 0xf6, 0xa3, 0xd5, 0x01, 0xde, 0x83, 0xc5, 0xa6, 0xcd, 0x6c, 0xd6, 0xef, 0xd6, 0x8c, 0xce, 0xe8, 0xcd, 0xc5, 0xe5, 0x42, 0xfe, 0x60, 0xfe, 0x21, 0xfe, 0x23, 0xf6, 0xe2, 0xed, 0xc3, 0xfd, 0x04, 0xed, 0x04, 0xcc, 0x2a, 0xbc, 0x4d, 0x9b, 0x10, 0x7b, 0x33, 0x73, 0x33, 0x73, 0x33, 0x73, 0x12, 0x6b, 0x73, 0x73, 0xb3, 0x7b, 0x14, 0x8c, 0x95, 0x9c, 0x56, 0xb5, 0x39, 0xc6, 0x5d, 0xef, 0x5f, 0xf7, 0x7c, 0xd6, 0xf5, 0x94, 0x95, 0x94, 0x97, 0xa4, 0x16, 0xa4, 0x76, 0x8c, 0x75, 0x84, 0x31, 0x7b, 0xf0, 0x92, 0x31, 0x93, 0x12, 0x9b, 0xf2, 0x9a, 0x32, 0x9b, 0x32, 0x93, 0x52, 0x8b, 0x93, 0x8b, 0x53, 0x8b, 0x33, 0x93, 0x53, 0xa3, 0x12, 0x93, 0x33, 0x93, 0x33, 0x9b, 0x53, 0xa3, 0x33, 0xa3, 0x12, 0x9b, 0x93, 0x8b, 0x32, 0x9b, 0x11, 0x8b, 0x73, 0x9b, 0x13, 0x83, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd5, 0xe0, 0xfd, 0x00, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x81, 0xfe, 0xc1, 0xfe, 0x00, 0xff, 0x20, 0xff, 0x62, 0xff, 0xc6, 0xf6, 0xe3, 0xe5, 0x62, 0xee, 0x62, 0xd5, 0x42, 0xc5, 0x07, 0xc6, 0xac, 0xce, 0xee, 0xce, 0x8d, 0xce, 0xea, 0xcd, 0xa4, 0xdd, 0x41, 0xf6, 0x43, 0xfe, 0xc3, 0xfd, 0xe3, 0xfd, 0xc3, 0xec, 0xc2, 0xc2, 0x66, 0xca, 0x0a, 0xdb, 0x0d, 0xd3, 0x0e, 0xcb, 0x2f, 0xc3, 0x2f, 0xc3, 0xee, 0xba, 0xee, 0xba, 0x0e, 0xb3, 0x0e, 0xa3, 0x0e, 0xa3, 0xf1, 0xab, 0x36, 0xd5, 0x7a, 0xe6, 0xbb, 0xee, 0xd9, 0xdd, 0xf6, 0xcc, 0xf5, 0xd4, 0xd4, 0xd4, 0xb3, 0xd4, 0xd4, 0xdc, 0xb3, 0xbc, 0x12, 0x94, 0xd1, 0xab, 0x93, 0xe4, 0x93, 0xec, 0x74, 0xf4, 0x34, 0xf4, 0x53, 0xf4, 0x93, 0xf4, 0x93, 0xec, 0xb3, 0xec, 0xb3, 0xec, 0x94, 0xf4, 0x94, 0xf4, 0xd4, 0xec, 0xf4, 0xec, 0x94, 0xf4, 0x74, 0xf4, 0x93, 0xf4, 0x72, 0xf4, 0x72, 0xf4, 0x32, 0xec, 0xb3, 0xf4, 0xaf, 0xeb, 0x2c, 0x9a, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd5, 0xe0, 0xfd, 0x00, 0xfe, 0x21, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x61, 0xfe, 0xa1, 0xfe, 0x00, 0xff, 0x40, 0xff, 0x62, 0xff, 0xc5, 0xf6, 0x02, 0xe6, 0xc1, 0xfe, 0xe1, 0xed, 0x60, 0xd5, 0x84, 0xc5, 0xe7, 0xbd, 0xac, 0xce, 0xce, 0xd6, 0x4c, 0xce, 0x85, 0xb5, 0xa2, 0xc5, 0xe4, 0xdd, 0xe5, 0xf5, 0xa2, 0xe4, 0x61, 0xb2, 0x69, 0xd2, 0xed, 0xea, 0xcc, 0xea, 0xec, 0xe2, 0xeb, 0xd2, 0x0b, 0xc3, 0x2b, 0xc3, 0x2b, 0xbb, 0x2c, 0xc3, 0x4d, 0xcb, 0xaf, 0xd3, 0x32, 0xe4, 0x93, 0xdc, 0xf5, 0xd4, 0xf4, 0xcc, 0xd3, 0xcc, 0xb2, 0xcc, 0xb2, 0xe4, 0x71, 0xec, 0x50, 0xe4, 0xd0, 0xdc, 0xf2, 0xcc, 0x55, 0xbd, 0x96, 0xb5, 0x14, 0xb5, 0xd3, 0xcc, 0x71, 0xcc, 0xf0, 0xd3, 0xd3, 0xfc, 0xf3, 0xfc, 0x91, 0xfc, 0xd1, 0xfc, 0xb1, 0xfc, 0xd2, 0xfc, 0xf4, 0xfc, 0xb2, 0xfc, 0xf2, 0xfc, 0x13, 0xfd, 0xb2, 0xfc, 0xd3, 0xfc, 0xd2, 0xfc, 0xb1, 0xfc, 0x70, 0xfc, 0xb2, 0xfc, 0xee, 0xfb, 0xa7, 0xd1, 0xcb, 0x79, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd5, 0xc0, 0xfd, 0x01, 0xfe, 0x21, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x20, 0xfe, 0x61, 0xfe, 0xa1, 0xfe, 0xe1, 0xfe, 0x40, 0xff, 0x62, 0xff, 0xc4, 0xf6, 0x01, 0xe6, 0x01, 0xff, 0xa0, 0xfe, 0xe0, 0xed, 0x61, 0xcd, 0x43, 0xbd, 0xe7, 0xc5, 0x4a, 0xd6, 0x29, 0xc6, 0x07, 0xae, 0xc7, 0xad, 0xa6, 0xbd, 0xa4, 0xbc, 0xc4, 0xa2, 0xaa, 0xc2, 0x0e, 0xe3, 0xee, 0xea, 0xcd, 0xe2, 0x0d, 0xeb, 0x2d, 0xdb, 0x6d, 0xd3, 0x8e, 0xcb, 0xf0, 0xd3, 0xf0, 0xd3, 0x11, 0xdc, 0x12, 0xdc, 0x12, 0xd4, 0x11, 0xcc, 0x11, 0xbc, 0x11, 0xbc, 0x72, 0xd4, 0x92, 0xe4, 0xce, 0xe3, 0xeb, 0xda, 0x0c, 0xd3, 0xf0, 0xc3, 0x76, 0xc5, 0x3c, 0xef, 0xfa, 0xe6, 0x18, 0xd6, 0xb4, 0xa4, 0xd0, 0x83, 0xeb, 0x72, 0xae, 0xa3, 0xf3, 0xe4, 0xf3, 0xfc, 0xb2, 0xfc, 0x92, 0xfc, 0xb2, 0xfc, 0xf4, 0xf4, 0xf3, 0xfc, 0xb2, 0xfc, 0x72, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0x72, 0xfc, 0x92, 0xfc, 0xb2, 0xfc, 0xae, 0xf3, 0x67, 0xd1, 0x2e, 0x9a, 0x13, 0x7b, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd5, 0xc0, 0xfd, 0x00, 0xfe, 0x21, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x20, 0xfe, 0x61, 0xfe, 0xa1, 0xfe, 0xe1, 0xfe, 0x21, 0xff, 0x62, 0xff, 0xa4, 0xf6, 0x01, 0xe6, 0x00, 0xff, 0xc0, 0xfe, 0x81, 0xfe, 0x01, 0xee, 0x80, 0xd5, 0x40, 0xcd, 0x83, 0xcd, 0xc5, 0xc5, 0x08, 0xb6, 0xca, 0xbd, 0x87, 0xa4, 0xe6, 0x92, 0xeb, 0xb2, 0x4e, 0xcb, 0x4e, 0xd3, 0x2d, 0xd3, 0x2e, 0xe3, 0x4e, 0xe3, 0x4e, 0xdb, 0xb0, 0xe3, 0x90, 0xdb, 0xd1, 0xdb, 0xd1, 0xd3, 0xf0, 0xc3, 0xf0, 0xbb, 0xf0, 0xbb, 0x11, 0xc4, 0x51, 0xc4, 0x52, 0xd4, 0xd1, 0xdb, 0x4e, 0xdb, 0x8a, 0xda, 0x49, 0xd2, 0xab, 0xb2, 0xd0, 0x93, 0x97, 0xad, 0x7d, 0xef, 0xfe, 0xff, 0x58, 0xce, 0xd3, 0x8c, 0xb7, 0xa5, 0x70, 0x84, 0x27, 0x52, 0xae, 0xa3, 0xd3, 0xec, 0x92, 0xfc, 0x72, 0xfc, 0x92, 0xfc, 0xb2, 0xfc, 0xd3, 0xfc, 0x92, 0xfc, 0x72, 0xfc, 0xb2, 0xfc, 0x71, 0xf4, 0x71, 0xfc, 0xb2, 0xfc, 0xaf, 0xeb, 0x27, 0xd1, 0xd1, 0xeb, 0xd9, 0x8c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd5, 0xc0, 0xfd, 0x00, 0xfe, 0x21, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x00, 0xfe, 0x20, 0xfe, 0x60, 0xfe, 0xa1, 0xfe, 0xe1, 0xfe, 0x00, 0xff, 0x42, 0xff, 0x84, 0xf6, 0x02, 0xe6, 0x01, 0xff, 0xc1, 0xfe, 0xa1, 0xfe, 0xa0, 0xfe, 0x40, 0xf6, 0xa0, 0xdd, 0x41, 0xc5, 0x44, 0xbd, 0x87, 0xbd, 0xa6, 0xb4, 0xe7, 0x9a, 0x0d, 0xb3, 0x4f, 0xc3, 0x8d, 0xbb, 0xac, 0xbb, 0xad, 0xbb, 0x8d, 0xc3, 0xae, 0xcb, 0xae, 0xcb, 0x8e, 0xc3, 0x8f, 0xc3, 0x8f, 0xcb, 0x8f, 0xcb, 0x8f, 0xcb, 0xaf, 0xcb, 0xaf, 0xd3, 0xaf, 0xd3, 0x8f, 0xd3, 0x6d, 0xd3, 0x0b, 0xd3, 0x4a, 0xda, 0xa7, 0xd9, 0x25, 0xb9, 0xab, 0xb2, 0x30, 0xa4, 0xf4, 0x9c, 0x7a, 0xc6, 0xba, 0xc6, 0xb5, 0x9d, 0x58, 0xb6, 0xb6, 0xad, 0x14, 0xa5, 0xef, 0x83, 0x68, 0x6a, 0x4d, 0xab, 0xb3, 0xf4, 0xb2, 0xfc, 0x71, 0xfc, 0x71, 0xfc, 0x71, 0xfc, 0x92, 0xfc, 0x71, 0xfc, 0x30, 0xfc, 0x50, 0xfc, 0xb1, 0xfc, 0xaf, 0xeb, 0xe7, 0xc0, 0x71, 0xe4, 0x39, 0xf6, 0x7d, 0x85, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd5, 0xa0, 0xfd, 0xe1, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x41, 0xfe, 0xa1, 0xfe, 0xc0, 0xfe, 0x00, 0xff, 0x43, 0xff, 0x85, 0xf6, 0x02, 0xde, 0x21, 0xff, 0xc1, 0xfe, 0xa0, 0xfe, 0xc0, 0xfe, 0xc1, 0xfe, 0x61, 0xf6, 0xe0, 0xe5, 0x62, 0xcd, 0xa2, 0xa3, 0x21, 0x92, 0xaa, 0xba, 0x0d, 0xcb, 0x2c, 0xc3, 0x6c, 0xbb, 0x2b, 0xbb, 0x0c, 0xc3, 0x0c, 0xc3, 0x0c, 0xc3, 0x0c, 0xcb, 0x0c, 0xc3, 0x0b, 0xc3, 0xeb, 0xca, 0xcb, 0xd2, 0x8a, 0xd2, 0x8a, 0xd2, 0x8a, 0xd2, 0x8a, 0xda, 0x89, 0xd2, 0x68, 0xd2, 0x07, 0xca, 0x24, 0xc9, 0x82, 0xc8, 0x00, 0xd8, 0xe3, 0xd8, 0x4b, 0xcb, 0x8f, 0xb4, 0x71, 0x94, 0xd1, 0x7b, 0xb9, 0xa5, 0xfc, 0xde, 0xb7, 0xcd, 0x35, 0xad, 0x54, 0x9d, 0xee, 0x73, 0xca, 0x62, 0x8e, 0xa3, 0xb3, 0xec, 0x93, 0xfc, 0x50, 0xfc, 0x51, 0xfc, 0x52, 0xfc, 0x51, 0xfc, 0x70, 0xf4, 0x71, 0xfc, 0x2e, 0xf3, 0x45, 0xc0, 0x92, 0xd4, 0xd9, 0xee, 0xb9, 0xde, 0x5a, 0x8d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd5, 0xa0, 0xfd, 0xe1, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x41, 0xfe, 0x81, 0xfe, 0xc1, 0xfe, 0xe1, 0xfe, 0x43, 0xff, 0x85, 0xf6, 0x02, 0xe6, 0x22, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc1, 0xfe, 0xa1, 0xfe, 0xe2, 0xfe, 0x24, 0xf6, 0xe2, 0xc3, 0x60, 0xa9, 0x23, 0xb9, 0x46, 0xc1, 0x66, 0xb9, 0xc7, 0xb9, 0x49, 0xca, 0x49, 0xca, 0x29, 0xca, 0x29, 0xca, 0x29, 0xca, 0x29, 0xca, 0x49, 0xca, 0x48, 0xca, 0x28, 0xca, 0x28, 0xca, 0x28, 0xd2, 0x28, 0xd2, 0x28, 0xd2, 0xc7, 0xd1, 0x85, 0xd1, 0x04, 0xc9, 0x61, 0xd0, 0x21, 0xd8, 0x20, 0xe0, 0x20, 0xf8, 0x00, 0xe8, 0x64, 0xc9, 0xea, 0xaa, 0xec, 0x82, 0xd1, 0x83, 0xf1, 0x73, 0x96, 0xad, 0xdb, 0xe6, 0xf8, 0xbd, 0xf4, 0x94, 0x51, 0x8c, 0xae, 0x83, 0x8a, 0x62, 0x4d, 0x93, 0xb3, 0xe4, 0x30, 0xfc, 0xf0, 0xfb, 0x31, 0xfc, 0x30, 0xf4, 0xb2, 0xfc, 0x2d, 0xf3, 0x06, 0xc0, 0x72, 0xe4, 0x9b, 0xfe, 0xfa, 0xde, 0x1a, 0xd7, 0xba, 0x85, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd5, 0xc1, 0xfd, 0xe1, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x41, 0xfe, 0x81, 0xfe, 0xa1, 0xfe, 0xe1, 0xfe, 0x22, 0xff, 0x84, 0xf6, 0xe2, 0xe5, 0x23, 0xff, 0x01, 0xff, 0xe0, 0xfe, 0xa0, 0xfe, 0xa1, 0xfe, 0x62, 0xf6, 0x21, 0xcc, 0xc2, 0xc1, 0xc7, 0xe9, 0xe8, 0xf1, 0x67, 0xe1, 0x04, 0xd1, 0xc3, 0xc0, 0x63, 0xc0, 0xe4, 0xc0, 0x45, 0xb9, 0x66, 0xc1, 0x87, 0xc9, 0xa7, 0xc9, 0xc7, 0xd1, 0xc7, 0xd1, 0xc7, 0xd1, 0xc7, 0xd1, 0xa6, 0xc9, 0x65, 0xc9, 0x03, 0xc9, 0x81, 0xc8, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0xf8, 0x41, 0xf8, 0x00, 0xf8, 0x41, 0xe0, 0x25, 0xb9, 0xab, 0x82, 0x6d, 0x6b, 0x6e, 0x6b, 0x8e, 0x73, 0x75, 0xad, 0x5a, 0xce, 0x96, 0xb5, 0x92, 0x94, 0x52, 0x9c, 0xf0, 0x83, 0x89, 0x42, 0x2c, 0x8b, 0x31, 0xe4, 0xf0, 0xfb, 0xef, 0xfb, 0x50, 0xfc, 0x2c, 0xeb, 0xa6, 0xc8, 0x93, 0xe4, 0x7a, 0xf6, 0x9c, 0xde, 0xdb, 0xd6, 0x1b, 0xdf, 0xdc, 0x8d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd5, 0xa0, 0xfd, 0xe1, 0xfd, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0x82, 0xfe, 0xc1, 0xfe, 0x22, 0xff, 0x83, 0xf6, 0xe2, 0xe5, 0x03, 0xff, 0xe3, 0xfe, 0xc1, 0xfe, 0x02, 0xff, 0x42, 0xee, 0x21, 0xc4, 0xc1, 0xb9, 0xc7, 0xe9, 0x0a, 0xfa, 0xe9, 0xf9, 0xe8, 0xf9, 0x07, 0xf2, 0xc6, 0xe9, 0x66, 0xe1, 0x05, 0xd9, 0xa3, 0xd0, 0x82, 0xc8, 0x41, 0xc8, 0x21, 0xc8, 0x21, 0xc8, 0x21, 0xc8, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe8, 0x20, 0xf0, 0x20, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x00, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x00, 0xf8, 0xa3, 0xd8, 0x48, 0xa2, 0x6c, 0x6b, 0x6e, 0x63, 0x6f, 0x73, 0x2d, 0x6b, 0x15, 0xad, 0xb9, 0xce, 0x94, 0xad, 0x93, 0xa4, 0xb3, 0xa4, 0xf0, 0x7b, 0x8b, 0x5a, 0xcc, 0x8a, 0x10, 0xe4, 0x71, 0xfc, 0x0c, 0xeb, 0xc4, 0xc0, 0xb1, 0xd4, 0xb9, 0xee, 0xbb, 0xe6, 0xbd, 0xde, 0x5d, 0xe7, 0xfc, 0xe6, 0x7d, 0x8d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xcd, 0xa0, 0xf5, 0xe1, 0xfd, 0x01, 0xfe, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x41, 0xfe, 0x61, 0xfe, 0xa1, 0xfe, 0xe1, 0xfe, 0x22, 0xff, 0x83, 0xf6, 0xe2, 0xe5, 0x03, 0xff, 0x01, 0xff, 0x00, 0xff, 0x01, 0xee, 0x01, 0xbc, 0xc0, 0xb1, 0xc6, 0xe1, 0xea, 0xf9, 0xa9, 0xf9, 0xc8, 0xf9, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0xe8, 0xf9, 0xc8, 0xf9, 0xa7, 0xf9, 0x66, 0xf1, 0x25, 0xe9, 0xe4, 0xe8, 0xc4, 0xe0, 0x83, 0xe0, 0x62, 0xd8, 0x41, 0xe0, 0x21, 0xe8, 0x00, 0xf0, 0x00, 0xf8, 0x00, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x00, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x21, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0xe4, 0xd8, 0xaa, 0xaa, 0x4d, 0x6b, 0x0d, 0x5b, 0x6f, 0x7b, 0x31, 0x94, 0x12, 0x8d, 0x98, 0xbe, 0xd6, 0xbd, 0x73, 0xa4, 0x73, 0xa4, 0x90, 0x7b, 0x6a, 0x4a, 0x0c, 0x93, 0x2d, 0xcb, 0x67, 0xb9, 0xb1, 0xdc, 0xb8, 0xe6, 0xfa, 0xde, 0xdb, 0xde, 0xfc, 0xe6, 0x3c, 0xe7, 0x5e, 0xe7, 0x7b, 0x85, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd5, 0xa1, 0xfd, 0xe1, 0xfd, 0x01, 0xfe, 0xe0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0x00, 0xfe, 0x21, 0xfe, 0x61, 0xfe, 0xa0, 0xfe, 0xe0, 0xfe, 0x22, 0xff, 0x84, 0xf6, 0xe2, 0xe5, 0x22, 0xff, 0x21, 0xff, 0x00, 0xf6, 0xa0, 0xcb, 0x42, 0xb9, 0xa6, 0xe9, 0xc8, 0xf9, 0x89, 0xf9, 0x88, 0xf9, 0xc7, 0xf9, 0xe7, 0xf9, 0xc6, 0xf9, 0xc7, 0xf9, 0xc7, 0xf9, 0xc7, 0xf9, 0xe7, 0xf1, 0xe7, 0xf9, 0x07, 0xfa, 0xe7, 0xf9, 0xe7, 0xf9, 0xa7, 0xf9, 0x86, 0xf1, 0x45, 0xf9, 0x04, 0xf9, 0xc3, 0xf8, 0x82, 0xf8, 0x61, 0xf0, 0x20, 0xf0, 0x20, 0xf0, 0x20, 0xf8, 0x20, 0xf0, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x20, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0xc4, 0xd8, 0x8a, 0xb2, 0xaa, 0x7a, 0xec, 0x72, 0x6e, 0x73, 0xce, 0x63, 0x13, 0x95, 0x59, 0xce, 0x96, 0xbd, 0x73, 0x9c, 0x31, 0x8c, 0xcf, 0x7b, 0xaa, 0x5a, 0x46, 0x79, 0x72, 0xd4, 0xfa, 0xee, 0xda, 0xd6, 0xfb, 0xd6, 0x1d, 0xdf, 0x1d, 0xef, 0x7e, 0xef, 0x9e, 0xff, 0xf5, 0x9c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd5, 0xa1, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0x00, 0xfe, 0x21, 0xfe, 0x41, 0xfe, 0xa0, 0xfe, 0x00, 0xff, 0x42, 0xff, 0x85, 0xf6, 0x02, 0xe6, 0x22, 0xff, 0x22, 0xe6, 0xc0, 0xb3, 0x43, 0xc1, 0x48, 0xf1, 0x48, 0xf9, 0x67, 0xf9, 0x86, 0xf9, 0xa6, 0xf9, 0xc6, 0xf1, 0xa6, 0xf1, 0xc7, 0xf9, 0xa7, 0xf9, 0xa6, 0xf1, 0xc7, 0xf1, 0xc7, 0xf1, 0xc7, 0xf1, 0xc7, 0xf1, 0xc7, 0xf1, 0xc7, 0xf9, 0xc7, 0xf9, 0xe7, 0xf9, 0xe7, 0xf9, 0xc7, 0xf9, 0xc7, 0xf9, 0xc6, 0xf9, 0x85, 0xf9, 0x25, 0xf9, 0xe4, 0xf8, 0xc3, 0xf0, 0x82, 0xe8, 0x41, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x20, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x00, 0xf8, 0x83, 0xe0, 0x08, 0xb2, 0xca, 0x72, 0x4e, 0x6b, 0x6f, 0x6b, 0x6f, 0x6b, 0x92, 0x94, 0x58, 0xce, 0xd6, 0xad, 0xb1, 0x94, 0x30, 0x94, 0x8e, 0x83, 0x69, 0x5a, 0x8e, 0x8b, 0x59, 0xd6, 0x3d, 0xd7, 0x1d, 0xdf, 0x1e, 0xe7, 0x7e, 0xef, 0x7e, 0xf7, 0xb6, 0xe5, 0x8b, 0x8a, 0xd0, 0x62, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd5, 0xa0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0x00, 0xfe, 0x21, 0xfe, 0x41, 0xfe, 0xa0, 0xfe, 0xe1, 0xfe, 0x22, 0xff, 0xa4, 0xf6, 0xe2, 0xe5, 0x02, 0xe6, 0xc2, 0xb3, 0xe1, 0xc0, 0x47, 0xf1, 0x47, 0xf9, 0x25, 0xf9, 0x66, 0xf9, 0x65, 0xf1, 0x84, 0xf1, 0x85, 0xf1, 0x86, 0xf1, 0x86, 0xf1, 0x86, 0xf1, 0x86, 0xf1, 0x66, 0xf1, 0x66, 0xf9, 0x66, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x87, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xc7, 0xf9, 0x08, 0xfa, 0x28, 0xf2, 0x49, 0xf2, 0x29, 0xfa, 0x28, 0xfa, 0x09, 0xfa, 0xe8, 0xf9, 0xa7, 0xf9, 0x66, 0xf1, 0x24, 0xf9, 0xe3, 0xf8, 0x82, 0xf8, 0x21, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x20, 0xe8, 0xc3, 0xd0, 0xe8, 0xa9, 0xeb, 0x82, 0x4c, 0x63, 0xcf, 0x6b, 0x6e, 0x63, 0x71, 0x84, 0x97, 0xae, 0xd5, 0xad, 0x51, 0x94, 0x31, 0x8c, 0xaf, 0x7b, 0x4a, 0x52, 0x4f, 0x7b, 0x7c, 0xde, 0x5e, 0xef, 0xbe, 0xe7, 0xfe, 0xef, 0x75, 0xdd, 0x85, 0xa8, 0xc9, 0xc9, 0x8e, 0x9a, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xd5, 0xa0, 0xfd, 0xc0, 0xfd, 0xe0, 0xfd, 0xe0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe0, 0xfd, 0x00, 0xfe, 0x40, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0x01, 0xff, 0x84, 0xee, 0x62, 0xbc, 0x82, 0xc3, 0xe2, 0xc8, 0x44, 0xe9, 0x45, 0xf1, 0x45, 0xf1, 0x45, 0xf1, 0x45, 0xf1, 0x45, 0xe9, 0x44, 0xf1, 0x25, 0xf1, 0x45, 0xf1, 0x45, 0xf1, 0x25, 0xf9, 0x45, 0xf1, 0x25, 0xf9, 0x25, 0xf9, 0x25, 0xf9, 0x25, 0xf9, 0x45, 0xf9, 0x45, 0xf9, 0x65, 0xf9, 0x86, 0xf9, 0xa6, 0xf1, 0xc7, 0xf1, 0xe8, 0xf1, 0x08, 0xf2, 0x08, 0xfa, 0x28, 0xfa, 0x49, 0xfa, 0x4a, 0xfa, 0x69, 0xfa, 0x69, 0xfa, 0x49, 0xfa, 0x09, 0xfa, 0xc8, 0xf9, 0x87, 0xf9, 0x24, 0xf9, 0x03, 0xf1, 0xa1, 0xe8, 0x02, 0xe8, 0x64, 0xd8, 0xa6, 0xa9, 0xa9, 0x7a, 0x4c, 0x63, 0x6e, 0x6b, 0x4e, 0x73, 0x51, 0x84, 0x17, 0xb6, 0xb6, 0xad, 0x71, 0x84, 0x30, 0x84, 0xce, 0x73, 0x49, 0x52, 0x8e, 0x73, 0xbb, 0xde, 0x9e, 0xff, 0x95, 0xd5, 0xe5, 0x91, 0xc7, 0xd9, 0x4b, 0xf2, 0x2c, 0xa2, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xd5, 0xa0, 0xfd, 0xc0, 0xfd, 0xe1, 0xfd, 0xe0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe0, 0xfd, 0x00, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0xa1, 0xfe, 0xc2, 0xfe, 0x43, 0xd5, 0x41, 0xa2, 0x45, 0xc1, 0x27, 0xe9, 0x46, 0xf9, 0x44, 0xf1, 0x65, 0xe9, 0x65, 0xf1, 0x25, 0xf9, 0x45, 0xf9, 0x45, 0xf9, 0x45, 0xf9, 0x46, 0xf9, 0x46, 0xf9, 0x45, 0xf9, 0x45, 0xf9, 0x45, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x85, 0xf1, 0x86, 0xf1, 0xa6, 0xf1, 0xc6, 0xf1, 0xe7, 0xf1, 0x07, 0xf2, 0x08, 0xf2, 0x28, 0xf2, 0x49, 0xfa, 0x69, 0xfa, 0x89, 0xfa, 0xaa, 0xfa, 0xaa, 0xfa, 0xcb, 0xfa, 0xeb, 0xfa, 0x0c, 0xfb, 0x0c, 0xfb, 0x0d, 0xfb, 0xec, 0xfa, 0xcb, 0xfa, 0x89, 0xfa, 0x68, 0xfa, 0xa7, 0xf9, 0xe5, 0xf8, 0xc3, 0xd8, 0xa6, 0xa9, 0x89, 0x7a, 0x2d, 0x6b, 0x4f, 0x7b, 0xed, 0x6a, 0x31, 0x84, 0xf7, 0xb5, 0xb6, 0xad, 0x91, 0x84, 0x50, 0x7c, 0xae, 0x83, 0x68, 0x4a, 0xee, 0x7b, 0xd3, 0xbc, 0xe8, 0xa1, 0x49, 0xda, 0x0c, 0xf3, 0x4b, 0xba, 0xae, 0x72, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xd5, 0xa0, 0xfd, 0xc1, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xc1, 0xfd, 0xe0, 0xfd, 0x20, 0xfe, 0x40, 0xfe, 0x61, 0xfe, 0xc1, 0xfe, 0x23, 0xe6, 0x21, 0xb3, 0x41, 0xc1, 0x25, 0xd9, 0x46, 0xd9, 0x04, 0xe9, 0x44, 0xe9, 0x45, 0xe9, 0xe5, 0xe8, 0xe4, 0xe8, 0x24, 0xe9, 0x25, 0xe9, 0x25, 0xe9, 0x25, 0xe9, 0x25, 0xe9, 0x25, 0xe9, 0x25, 0xe9, 0x45, 0xe1, 0x45, 0xe1, 0x65, 0xe1, 0x65, 0xe1, 0x85, 0xe1, 0x86, 0xe1, 0xa6, 0xe1, 0xa6, 0xe1, 0xa6, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xc7, 0xe1, 0xc7, 0xe1, 0xe7, 0xe1, 0x08, 0xe2, 0xe8, 0xe9, 0x08, 0xe2, 0x08, 0xe2, 0x28, 0xe2, 0x29, 0xe2, 0x49, 0xea, 0x4a, 0xe2, 0x49, 0xea, 0x28, 0xea, 0x28, 0xea, 0xe7, 0xe1, 0x45, 0xe1, 0x83, 0xd8, 0x01, 0xc8, 0x25, 0xa1, 0x49, 0x6a, 0x4d, 0x5b, 0x8e, 0x6b, 0x2c, 0x63, 0x0f, 0x84, 0xd7, 0xb5, 0xb5, 0xa5, 0x50, 0x84, 0x10, 0x94, 0x6d, 0x73, 0xa9, 0x4a, 0x24, 0x49, 0xab, 0xba, 0x2e, 0xf3, 0x2c, 0xa2, 0x12, 0x6b, 0x18, 0x5c, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xd5, 0xa1, 0xfd, 0xc1, 0xfd, 0xe1, 0xfd, 0xc1, 0xfd, 0xc1, 0xfd, 0xc1, 0xfd, 0xe0, 0xfd, 0x00, 0xfe, 0x20, 0xfe, 0x60, 0xfe, 0xc2, 0xfe, 0x03, 0xcd, 0x81, 0xa9, 0x64, 0xe1, 0xa5, 0xe1, 0x86, 0xd9, 0x65, 0xe1, 0x86, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0xa6, 0xe1, 0xa5, 0xd9, 0xa6, 0xe1, 0xa6, 0xe1, 0xa6, 0xe1, 0xa6, 0xe1, 0xa6, 0xe1, 0xc6, 0xd9, 0xa6, 0xe1, 0x87, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xd9, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa8, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xc8, 0xe1, 0xe8, 0xd9, 0xc7, 0xd9, 0xa7, 0xd9, 0xa8, 0xe1, 0xc8, 0xe1, 0xc7, 0xd1, 0x65, 0xd9, 0xc3, 0xb8, 0x45, 0x69, 0x49, 0x52, 0xec, 0x6a, 0x6d, 0x7b, 0x4c, 0x63, 0xef, 0x73, 0xf7, 0xb5, 0x54, 0xa5, 0x11, 0x94, 0x10, 0x84, 0xcf, 0x73, 0xab, 0x62, 0x49, 0x82, 0x4c, 0xa2, 0xf1, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xcd, 0xa0, 0xfd, 0xc1, 0xfd, 0xe1, 0xfd, 0xc0, 0xfd, 0xc1, 0xfd, 0xc1, 0xfd, 0xc0, 0xfd, 0x00, 0xfe, 0x21, 0xfe, 0x61, 0xfe, 0x40, 0xfe, 0xa0, 0xbb, 0xc5, 0xc1, 0xcb, 0xfa, 0xcb, 0xfa, 0xec, 0xfa, 0xcc, 0xfa, 0xeb, 0xfa, 0x0c, 0xfb, 0x0c, 0xfb, 0x0c, 0xfb, 0x0c, 0xfb, 0x0c, 0xfb, 0x0c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x2c, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x4d, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0xae, 0xfb, 0x4b, 0xfb, 0x23, 0xc1, 0xab, 0xaa, 0x10, 0x8c, 0x29, 0x5a, 0xcb, 0x72, 0xad, 0x6b, 0x6d, 0x6b, 0xcf, 0x7b, 0x95, 0xad, 0x96, 0xad, 0x11, 0x7c, 0xd0, 0x7b, 0x6e, 0x7b, 0x6a, 0x5a, 0x29, 0x5a, 0xb4, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xcd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0x00, 0xfe, 0x21, 0xfe, 0x81, 0xfe, 0xe2, 0xed, 0xe0, 0xb2, 0x69, 0xda, 0x2e, 0xfb, 0x0d, 0xfb, 0x2e, 0xfb, 0x2d, 0xfb, 0x4c, 0xfb, 0x6d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xae, 0xfb, 0xce, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xaf, 0xfb, 0xef, 0xfb, 0x2b, 0xfb, 0x40, 0xb8, 0xb2, 0xcc, 0x9a, 0xd6, 0x92, 0x94, 0x29, 0x5a, 0xec, 0x62, 0x6e, 0x73, 0x6d, 0x6b, 0xee, 0x6b, 0x75, 0x9d, 0x76, 0xad, 0x32, 0x8c, 0x8e, 0x7b, 0x8d, 0x6b, 0xcb, 0x42, 0x31, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xcd, 0x80, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0x00, 0xfe, 0x20, 0xfe, 0x61, 0xfe, 0x62, 0xdd, 0x60, 0xaa, 0xab, 0xea, 0x4e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6e, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xae, 0xfb, 0xaf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xaf, 0xfb, 0xcf, 0xfb, 0xce, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xd0, 0xfb, 0xd0, 0xfb, 0xaa, 0xf2, 0x80, 0xb0, 0xb5, 0xd5, 0x1c, 0xdf, 0xba, 0xce, 0x95, 0xa5, 0x4a, 0x52, 0x2d, 0x63, 0xae, 0x6b, 0x6d, 0x63, 0xaf, 0x73, 0x14, 0xa5, 0x14, 0xad, 0x2f, 0x8c, 0xad, 0x73, 0xcf, 0x73, 0xb1, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xcd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc1, 0xfd, 0xa1, 0xfd, 0xc1, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0x01, 0xfe, 0x41, 0xfe, 0x82, 0xfe, 0x22, 0xdd, 0x41, 0xb2, 0x0d, 0xfb, 0x8f, 0xfb, 0xae, 0xfb, 0x8e, 0xfb, 0x6d, 0xfb, 0x8d, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xfb, 0x10, 0xfc, 0xf0, 0xfb, 0x6a, 0xea, 0xe5, 0xb8, 0xf7, 0xdd, 0x1c, 0xe7, 0x3c, 0xdf, 0x9d, 0xe7, 0xb7, 0xbd, 0x09, 0x52, 0xcb, 0x5a, 0x6e, 0x6b, 0x4e, 0x6b, 0x6e, 0x73, 0x13, 0xa5, 0x33, 0xad, 0x30, 0x8c, 0x53, 0x8c, 0xb2, 0x63, 0xd6, 0x43, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xcd, 0x80, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0x01, 0xfe, 0x20, 0xfe, 0x62, 0xfe, 0x01, 0xd5, 0x23, 0xba, 0x2e, 0xfb, 0xaf, 0xfb, 0xce, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x10, 0xfc, 0x10, 0xfc, 0x10, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x10, 0xfc, 0x51, 0xfc, 0x0f, 0xfc, 0x89, 0xea, 0x05, 0xc1, 0xf9, 0xed, 0x1e, 0xef, 0x5d, 0xef, 0x5d, 0xff, 0xb3, 0xcc, 0xc7, 0x81, 0xe8, 0x71, 0xec, 0x72, 0x6e, 0x73, 0x4c, 0x63, 0xad, 0x73, 0x92, 0x94, 0xb4, 0x94, 0xd3, 0x63, 0x53, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xcd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0x01, 0xfe, 0x41, 0xfe, 0x82, 0xfe, 0x01, 0xd5, 0x22, 0xba, 0xad, 0xfa, 0x2e, 0xfb, 0x4c, 0xf3, 0x0c, 0xfb, 0x0d, 0xfb, 0x0d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x0d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x8e, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x8e, 0xfb, 0x6d, 0xfb, 0x8e, 0xfb, 0x6d, 0xfb, 0x48, 0xea, 0x26, 0xc9, 0xf8, 0xed, 0xbf, 0xf7, 0x5d, 0xf7, 0x92, 0xd4, 0x46, 0xb9, 0x8a, 0xd2, 0x28, 0xaa, 0xc7, 0x61, 0xeb, 0x5a, 0x8c, 0x6b, 0xad, 0x73, 0x11, 0x84, 0xf3, 0x73, 0xb4, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xcd, 0xa0, 0xfd, 0xa1, 0xfd, 0xc1, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xe1, 0xfd, 0x21, 0xfe, 0xa1, 0xfe, 0x41, 0xdd, 0x21, 0xba, 0x28, 0xe9, 0x88, 0xe1, 0xa5, 0xd9, 0x66, 0xf1, 0x67, 0xf1, 0x47, 0xf1, 0x66, 0xe9, 0x66, 0xe9, 0x66, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xf1, 0x67, 0xf1, 0x67, 0xf1, 0x67, 0xf1, 0x67, 0xf1, 0x67, 0xf1, 0x87, 0xe9, 0x86, 0xe9, 0x87, 0xe9, 0x87, 0xe9, 0x86, 0xe9, 0x86, 0xe9, 0x87, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xf1, 0xa7, 0xf1, 0xa7, 0xe9, 0xc7, 0xe9, 0xe6, 0xe9, 0xe7, 0xf1, 0xa8, 0xd9, 0x76, 0xed, 0x3c, 0xff, 0xb2, 0xc4, 0x46, 0xb9, 0x49, 0xe2, 0x6a, 0xd2, 0x0a, 0x92, 0xcf, 0x52, 0xee, 0x3a, 0x0d, 0x5b, 0xd1, 0x73, 0xd4, 0x6b, 0xb4, 0x53, 0x17, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc5, 0xa0, 0xfd, 0x82, 0xfd, 0xa2, 0xfd, 0xa1, 0xfd, 0xc1, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xe1, 0xfd, 0x21, 0xfe, 0xa0, 0xfe, 0xa1, 0xe5, 0x61, 0xca, 0xc6, 0xe8, 0x47, 0xe9, 0x85, 0xe9, 0x64, 0xf1, 0x45, 0xf1, 0x45, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x66, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf9, 0x66, 0xf9, 0x66, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x66, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x66, 0xf9, 0x86, 0xf9, 0x86, 0xf1, 0x85, 0xf1, 0xc5, 0xf1, 0x08, 0xfa, 0xa9, 0xd9, 0x6e, 0xd3, 0xcf, 0xe3, 0x45, 0xd9, 0xc7, 0xe9, 0xe7, 0xd1, 0xab, 0x89, 0xf3, 0x52, 0xb4, 0x4b, 0x32, 0x33, 0x74, 0x4b, 0x95, 0x53, 0xd7, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x9c, 0x07, 0xf6, 0xc1, 0xfd, 0xc2, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0x01, 0xfe, 0x41, 0xfe, 0x80, 0xfe, 0x02, 0xfe, 0x00, 0xcb, 0x04, 0xd9, 0x67, 0xf9, 0x45, 0xf9, 0x65, 0xf1, 0x67, 0xf1, 0x67, 0xf1, 0x86, 0xf1, 0xa5, 0xe9, 0xa5, 0xe9, 0x85, 0xf1, 0xa5, 0xf1, 0x85, 0xf1, 0x85, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa6, 0xf1, 0xa6, 0xf1, 0xa6, 0xf1, 0xa5, 0xf1, 0xa6, 0xf1, 0xa6, 0xf1, 0xa6, 0xf1, 0xa6, 0xf1, 0xa5, 0xf1, 0xa6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf9, 0xa6, 0xf9, 0xa6, 0xf9, 0x86, 0xf9, 0xea, 0xf9, 0xa9, 0xe1, 0x86, 0xc9, 0xc0, 0xd8, 0x64, 0xf1, 0x87, 0xc9, 0x6b, 0x79, 0x15, 0x53, 0xd9, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x99, 0x3b, 0x56, 0x53, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x63, 0x07, 0xbd, 0x43, 0xf6, 0x21, 0xfe, 0xe0, 0xfd, 0xa0, 0xfd, 0x81, 0xfd, 0x81, 0xfd, 0xc2, 0xfd, 0x40, 0xfe, 0xe0, 0xfe, 0xc2, 0xfe, 0x82, 0xd4, 0xe3, 0xc1, 0xc6, 0xe9, 0x86, 0xf1, 0x86, 0xf1, 0x87, 0xe9, 0x68, 0xf1, 0x87, 0xf1, 0xa6, 0xf1, 0x86, 0xf1, 0x67, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa8, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xc7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0x29, 0xfa, 0x08, 0xfa, 0xc2, 0xd8, 0xc0, 0xc8, 0x23, 0xb1, 0x8a, 0x69, 0xf4, 0x4a, 0x98, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x43, 0xab, 0x73, 0x44, 0xc5, 0xe6, 0xe5, 0x04, 0xfe, 0xc2, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0x20, 0xfe, 0xa1, 0xfe, 0xc0, 0xfe, 0x04, 0xff, 0xe7, 0xf5, 0xa2, 0xba, 0xa4, 0xe1, 0xa6, 0xf9, 0xe6, 0xf9, 0xe7, 0xf1, 0xc7, 0xf9, 0xc7, 0xf9, 0xe7, 0xf9, 0xc8, 0xf9, 0xa9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0x09, 0xfa, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0x09, 0xfa, 0x09, 0xfa, 0x29, 0xfa, 0x29, 0xfa, 0x29, 0xfa, 0x69, 0xfa, 0x48, 0xfa, 0x44, 0xe1, 0xc2, 0xb0, 0xca, 0x71, 0xd2, 0x4a, 0x98, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x44, 0x34, 0x3b, 0xcc, 0x4a, 0xeb, 0x8b, 0xe8, 0xbc, 0x66, 0xd5, 0xa5, 0xe5, 0xc3, 0xe5, 0xe4, 0xed, 0xc6, 0xed, 0xe5, 0xdd, 0xc6, 0xcd, 0xc7, 0xac, 0x67, 0x7a, 0x88, 0x99, 0xa9, 0xb9, 0xe9, 0xa9, 0xe9, 0xa1, 0xe9, 0xa9, 0xc8, 0xb1, 0xe8, 0xa9, 0xe9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xea, 0xb1, 0xea, 0xb1, 0xea, 0xb1, 0xe9, 0xa9, 0x09, 0xb2, 0x2b, 0xb2, 0x2d, 0x7a, 0xf2, 0x42, 0x76, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x43, 0x6f, 0x22, 0xd4, 0x0a, 0x13, 0x2b, 0x6e, 0x53, 0xac, 0x6b, 0xad, 0x6b, 0xce, 0x73, 0x6c, 0x73, 0x4d, 0x5b, 0x30, 0x33, 0x13, 0x03, 0x4d, 0x02, 0xcc, 0x19, 0xab, 0x41, 0xab, 0x29, 0xab, 0x01, 0xab, 0x19, 0xaa, 0x29, 0xaa, 0x19, 0xab, 0x11, 0xaa, 0x19, 0xaa, 0x29, 0xaa, 0x29, 0xaa, 0x29, 0xaa, 0x29, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x29, 0xaa, 0x29, 0xaa, 0x29, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x11, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x11, 0xaa, 0x01, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x29, 0xab, 0x29, 0xaa, 0x19, 0xaa, 0x01, 0x0d, 0x52, 0x72, 0x42, 0xb7, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x56, 0x03, 0xb2, 0x02, 0xce, 0x01, 0x0e, 0x00, 0x56, 0x03, 0xd7, 0x23, 0x96, 0x03, 0x70, 0x01, 0x99, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x95, 0xad, 0x6e, 0xe6, 0x47, 0xce, 0x47, 0xae, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x1c, 0x4c, 0x9a, 0x75, 0x34, 0x85, 0x11, 0x7d, 0x15, 0x7d, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x57, 0x95, 0x51, 0xd6, 0x2a, 0xf6, 0x27, 0xee, 0xc6, 0xc6, 0x8e, 0x6c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x18, 0x95, 0x31, 0xd6, 0x69, 0xee, 0xa6, 0xd6, 0x6e, 0xbe, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xd1, 0x95, 0x71, 0xde, 0x48, 0xfe, 0xe0, 0xfe, 0xa0, 0xf6, 0x85, 0xe6, 0xb0, 0xe7, 0x5a, 0xdf, 0x7f, 0xc7, 0x1d, 0xcf, 0x1e, 0xd7, 0x3f, 0xcf, 0x7f, 0xcf, 0x3f, 0xde, 0xdb, 0xcd, 0xca, 0xde, 0x48, 0xfe, 0xe3, 0xfe, 0x80, 0xf6, 0x6a, 0xd6, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x54, 0x95, 0xae, 0xe6, 0x84, 0xfe, 0x60, 0xfe, 0xc3, 0xe6, 0x88, 0xd6, 0x51, 0xef, 0x7a, 0xff, 0xbe, 0xf7, 0x9f, 0xf7, 0xbf, 0xef, 0xbf, 0xef, 0xbf, 0xef, 0xdf, 0xef, 0x9c, 0xe6, 0x93, 0xee, 0x66, 0xfe, 0xc0, 0xfe, 0x84, 0xfd, 0xe0, 0xee, 0x2a, 0xe6, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x32, 0xad, 0x6f, 0xee, 0x67, 0xfe, 0x60, 0xfe, 0x80, 0xee, 0x66, 0xce, 0x72, 0xe7, 0x7c, 0xf7, 0xff, 0xff, 0x7f, 0xff, 0x1e, 0xff, 0xbe, 0xf7, 0xdf, 0xf7, 0xff, 0xff, 0x7c, 0xf6, 0x91, 0xfe, 0x44, 0xfe, 0xa1, 0xfe, 0x83, 0xfd, 0xc1, 0xfd, 0x80, 0xf6, 0x2a, 0x95, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x52, 0xbd, 0x6d, 0xf6, 0x26, 0xfe, 0x21, 0xfe, 0xa3, 0xee, 0x46, 0xde, 0x50, 0xf7, 0x5b, 0xf7, 0xbf, 0xef, 0x9d, 0xff, 0xbf, 0xff, 0xbf, 0xf7, 0x9d, 0xef, 0xdf, 0xf7, 0xdc, 0xf6, 0xd2, 0xf6, 0x44, 0xfe, 0x80, 0xfe, 0xa2, 0xfe, 0x42, 0xfd, 0xc0, 0xfd, 0x80, 0xf5, 0xea, 0x94, 0xd6, 0x3b, 0xdb, 0x24, 0x99, 0x23, 0x99, 0x3b, 0x99, 0x3c, 0x99, 0x3c, 0x99, 0x3c, 0x9c, 0x44, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xb3, 0xad, 0x4f, 0xf6, 0x45, 0xfe, 0x41, 0xf6, 0xc0, 0xe6, 0x85, 0xde, 0x33, 0xf7, 0x3c, 0xf7, 0x9e, 0xf7, 0x3f, 0xff, 0x9f, 0xf7, 0xdc, 0xef, 0xdc, 0xf7, 0xdf, 0xff, 0xdc, 0xee, 0xf2, 0xee, 0x41, 0xfe, 0xe0, 0xfe, 0xe2, 0xf6, 0x82, 0xed, 0xa1, 0xed, 0x62, 0xe5, 0x41, 0xd5, 0x89, 0x8c, 0xd3, 0x5c, 0x9a, 0x4c, 0xfa, 0x4c, 0xdc, 0x54, 0xba, 0x54, 0xb9, 0x4c, 0x99, 0x4c, 0x7a, 0x44, 0x7b, 0x3c, 0x59, 0x44, 0x5b, 0x44, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf2, 0xa5, 0xad, 0xee, 0x44, 0xfe, 0x61, 0xfe, 0xc4, 0xd6, 0xa4, 0xce, 0x51, 0xef, 0x1d, 0xf7, 0x9f, 0xe7, 0x7c, 0xf7, 0x9c, 0xf7, 0x9e, 0xf7, 0xbe, 0xf7, 0x7f, 0xff, 0xbe, 0xf6, 0xf4, 0xee, 0x48, 0xfe, 0xa4, 0xfe, 0xa4, 0xee, 0x43, 0xcd, 0x60, 0xcc, 0xc4, 0xc4, 0xc8, 0xc5, 0x29, 0xbd, 0xed, 0x95, 0xd5, 0x7d, 0xda, 0x76, 0x3c, 0x75, 0xfe, 0x7d, 0xbb, 0x7d, 0xba, 0x75, 0x9b, 0x6d, 0x5b, 0x65, 0x1b, 0x54, 0xdb, 0x4c, 0x9a, 0x44, 0x5a, 0x44, 0x5a, 0x44, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xd2, 0xb5, 0x8c, 0xf6, 0x61, 0xfe, 0x40, 0xfe, 0x83, 0xde, 0x48, 0xd6, 0x53, 0xf7, 0x1c, 0xf7, 0x3e, 0xef, 0x5d, 0xef, 0x7b, 0xe7, 0x9b, 0xef, 0x7d, 0xf7, 0x7f, 0xff, 0x5e, 0xf7, 0x15, 0xe6, 0x88, 0xee, 0x84, 0xee, 0x44, 0xdd, 0xa6, 0xbd, 0x06, 0xbd, 0x68, 0xce, 0x0c, 0xde, 0x6e, 0xe6, 0x6e, 0xde, 0xf3, 0xae, 0x5a, 0x8d, 0xdd, 0x7e, 0x3e, 0x85, 0xfe, 0x85, 0xdc, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x85, 0xfd, 0x7d, 0xdc, 0x75, 0x9b, 0x6d, 0x3b, 0x54, 0xba, 0x44, 0x59, 0x44, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xd2, 0xcd, 0x6c, 0xfd, 0xe3, 0xfe, 0x60, 0xfe, 0xc4, 0xd5, 0xea, 0xce, 0x32, 0xef, 0x39, 0xef, 0x3c, 0xef, 0x5e, 0xe7, 0x3e, 0xe7, 0x5d, 0xef, 0x7c, 0xf7, 0x7d, 0xff, 0x7d, 0xff, 0x36, 0xde, 0x48, 0xde, 0x44, 0xcd, 0xa5, 0xc5, 0x88, 0xc5, 0xcc, 0xde, 0x2e, 0xe6, 0x6f, 0xee, 0x90, 0xe6, 0x90, 0xe6, 0x8e, 0xde, 0xd2, 0xae, 0x39, 0x8d, 0xfd, 0x8e, 0x1e, 0x96, 0x3e, 0x8e, 0x3e, 0x86, 0x1e, 0x85, 0xfd, 0x85, 0xfd, 0x85, 0xdd, 0x85, 0xdc, 0x85, 0xfd, 0x85, 0xfd, 0x7d, 0xdc, 0x6d, 0x5b, 0x54, 0xb9, 0x44, 0x58, 0x44, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xf1, 0xcd, 0xcd, 0xfd, 0xe4, 0xfe, 0x20, 0xf6, 0xa2, 0xd6, 0x08, 0xd6, 0x33, 0xe7, 0x1b, 0xe7, 0x3b, 0xe7, 0x1b, 0xe7, 0x3d, 0xe7, 0x3e, 0xe7, 0x3d, 0xef, 0x3d, 0xff, 0x3d, 0xf7, 0x36, 0xce, 0x28, 0xcd, 0xe4, 0xc5, 0x86, 0xce, 0x29, 0xde, 0xaf, 0xe6, 0xb2, 0xe6, 0x72, 0xe6, 0x71, 0xe6, 0x30, 0xde, 0x10, 0xd5, 0xee, 0xc5, 0xf0, 0x95, 0x35, 0x75, 0x18, 0x75, 0x39, 0x75, 0x38, 0x75, 0x39, 0x75, 0x5b, 0x85, 0x9c, 0x8d, 0xdd, 0x8d, 0xfd, 0x8e, 0x1d, 0x85, 0xfd, 0x7d, 0xbc, 0x7d, 0xdd, 0x7d, 0xdd, 0x7d, 0xbc, 0x6d, 0x5a, 0x4c, 0x9a, 0x3c, 0x3a, 0x2c, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x84, 0xf0, 0xcd, 0xcb, 0xfe, 0x01, 0xfe, 0x40, 0xfe, 0x83, 0xde, 0x0a, 0xce, 0x33, 0xe6, 0xda, 0xe6, 0xfd, 0xe7, 0x1d, 0xde, 0xfd, 0xde, 0xfc, 0xe7, 0x3d, 0xe6, 0xfd, 0xff, 0x3d, 0xf6, 0xf8, 0xc5, 0xec, 0xb5, 0x84, 0xc5, 0xc9, 0xe6, 0x8e, 0xe6, 0xee, 0xde, 0xd0, 0xd6, 0x90, 0xd6, 0x30, 0xcd, 0xcf, 0xc5, 0x6f, 0xbd, 0x2d, 0xbd, 0x4a, 0xc5, 0xae, 0x9d, 0x55, 0x7d, 0x18, 0x7c, 0xf8, 0x7c, 0xf8, 0x7c, 0xf9, 0x74, 0xd9, 0x6c, 0x98, 0x64, 0x77, 0x64, 0x97, 0x75, 0x3a, 0x85, 0xdc, 0x8e, 0x1d, 0x85, 0xfd, 0x85, 0xfd, 0x85, 0xfd, 0x85, 0xfc, 0x75, 0x9b, 0x54, 0xb8, 0x44, 0x39, 0x44, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x78, 0x94, 0xf1, 0xd5, 0xac, 0xfe, 0x02, 0xfe, 0x60, 0xfe, 0xc0, 0xde, 0x0a, 0xcd, 0xf6, 0xde, 0xdc, 0xe7, 0x1c, 0xde, 0xfa, 0xde, 0xfc, 0xde, 0xde, 0xde, 0xfe, 0xde, 0xfb, 0xf7, 0x5d, 0xee, 0xf7, 0xc5, 0xcc, 0xb5, 0x67, 0xc5, 0xed, 0xe6, 0xf1, 0xe6, 0xd0, 0xde, 0x70, 0xd6, 0x4f, 0xc6, 0x0e, 0xbd, 0xcc, 0xc5, 0xce, 0xde, 0x33, 0xee, 0xb4, 0xf6, 0xf1, 0xf7, 0x14, 0xd6, 0xfb, 0xbe, 0xde, 0xb6, 0xbe, 0xb6, 0x7d, 0xae, 0x7e, 0xa6, 0x3e, 0x9d, 0xfd, 0x95, 0xbc, 0x7d, 0x3a, 0x6c, 0x98, 0x5c, 0x77, 0x64, 0xf8, 0x7d, 0xbc, 0x85, 0xfd, 0x85, 0xbc, 0x85, 0xdc, 0x85, 0xdc, 0x7d, 0xbb, 0x6d, 0x19, 0x44, 0x39, 0x44, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x58, 0x8c, 0xd3, 0xdd, 0x8a, 0xfd, 0xe3, 0xf6, 0x60, 0xef, 0x03, 0xde, 0x28, 0xc5, 0xf4, 0xd6, 0xfc, 0xde, 0xfc, 0xde, 0xdb, 0xe7, 0x1a, 0xde, 0xfa, 0xde, 0xdc, 0xe6, 0xdd, 0xf7, 0x3d, 0xe7, 0x18, 0xbd, 0xcd, 0xa5, 0x43, 0xce, 0x8c, 0xe7, 0x30, 0xdf, 0x10, 0xde, 0x90, 0xd5, 0xd1, 0xc5, 0x91, 0xcd, 0xd3, 0xe6, 0xd7, 0xf7, 0x99, 0xff, 0x97, 0xff, 0x54, 0xff, 0x0e, 0xf6, 0xf1, 0xd6, 0x98, 0xbe, 0xbd, 0xb6, 0x9e, 0xb6, 0x5e, 0xae, 0x3d, 0xa6, 0x1d, 0xa6, 0x1e, 0x9e, 0x1e, 0x95, 0xfd, 0x8d, 0xdd, 0x7d, 0x5b, 0x64, 0xb8, 0x54, 0x57, 0x6c, 0xf9, 0x85, 0xdd, 0x85, 0xdd, 0x85, 0xbd, 0x85, 0xdc, 0x7d, 0xdc, 0x65, 0x19, 0x44, 0x58, 0x44, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xb4, 0xd5, 0x8a, 0xfd, 0xa1, 0xfe, 0x00, 0xf6, 0xe0, 0xd6, 0x47, 0xcd, 0xd5, 0xde, 0xfd, 0xcf, 0x19, 0xde, 0xfa, 0xde, 0xbc, 0xde, 0xbb, 0xde, 0xfa, 0xde, 0xfa, 0xee, 0xda, 0xf6, 0xf8, 0xc5, 0xee, 0xad, 0x46, 0xce, 0x6d, 0xe7, 0x51, 0xe7, 0x2f, 0xce, 0x6e, 0xc5, 0xf0, 0xc5, 0xb2, 0xe6, 0x98, 0xff, 0x7d, 0xff, 0xde, 0xff, 0xba, 0xff, 0x55, 0xff, 0x10, 0xfe, 0xcc, 0xfe, 0xd0, 0xde, 0x99, 0xbe, 0xbe, 0xbe, 0x9e, 0xbe, 0xbe, 0xb6, 0xbe, 0xae, 0x7e, 0xa6, 0x5e, 0x9e, 0x1e, 0x95, 0xfd, 0x95, 0xfe, 0x85, 0xbd, 0x7d, 0x7d, 0x75, 0x1b, 0x54, 0x57, 0x54, 0x78, 0x7d, 0x7d, 0x85, 0xde, 0x7d, 0xbc, 0x7d, 0xdc, 0x7d, 0xfc, 0x5c, 0xf9, 0x44, 0x59, 0x4c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x4f, 0xf6, 0x65, 0xfd, 0xe0, 0xfd, 0xe1, 0xf6, 0x40, 0xe6, 0x2e, 0xde, 0x9b, 0xd6, 0xdd, 0xd6, 0xda, 0xd6, 0xfa, 0xde, 0xdc, 0xde, 0xdd, 0xde, 0xdc, 0xe6, 0xfa, 0xf7, 0x17, 0xcd, 0xcd, 0xad, 0x26, 0xce, 0x2c, 0xe7, 0x12, 0xde, 0xf3, 0xce, 0x71, 0xc5, 0xb1, 0xc5, 0xd3, 0xe7, 0x39, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xb9, 0xff, 0x73, 0xff, 0x0e, 0xfe, 0xe9, 0xfe, 0xce, 0xde, 0xb8, 0xc6, 0xdf, 0xbe, 0xdf, 0xb6, 0x9f, 0xae, 0x9e, 0xa6, 0x7e, 0xa6, 0x7e, 0xa6, 0x7e, 0x9e, 0x3e, 0x8d, 0xfe, 0x8d, 0xfe, 0x85, 0xbf, 0x85, 0x9e, 0x6d, 0x1b, 0x4c, 0x17, 0x43, 0xf6, 0x6d, 0x5b, 0x85, 0xfd, 0x7d, 0xbb, 0x7d, 0xbc, 0x7d, 0xbd, 0x5c, 0xdb, 0x44, 0x39, 0x4c, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x2c, 0xf6, 0x24, 0xf6, 0x01, 0xfe, 0x20, 0xf6, 0x02, 0xee, 0x29, 0xee, 0x92, 0xee, 0xb8, 0xe6, 0xb9, 0xe6, 0xf9, 0xe6, 0xd9, 0xe6, 0x9b, 0xee, 0x99, 0xee, 0x92, 0xd6, 0x4a, 0xbd, 0x85, 0xc5, 0xaa, 0xe6, 0xf2, 0xe6, 0xf3, 0xd6, 0x92, 0xbd, 0x91, 0xbd, 0xd3, 0xf7, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xda, 0xff, 0x97, 0xff, 0x52, 0xfe, 0xec, 0xfe, 0xa7, 0xf6, 0xed, 0xd6, 0xd7, 0xbe, 0xfe, 0xbe, 0xdf, 0xbe, 0xbf, 0xb6, 0xbf, 0xae, 0x9f, 0xa6, 0x7e, 0xa6, 0x5e, 0x9e, 0x3e, 0x96, 0x1e, 0x8d, 0xff, 0x8d, 0xff, 0x85, 0xbf, 0x75, 0x7e, 0x6d, 0x3c, 0x4c, 0x17, 0x43, 0xd6, 0x6d, 0x5b, 0x85, 0xfd, 0x7d, 0xbd, 0x7d, 0xbd, 0x75, 0x9c, 0x4c, 0x98, 0x3c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x0b, 0xfe, 0x65, 0xfd, 0xa1, 0xfd, 0xe0, 0xfe, 0x00, 0xfe, 0x01, 0xf6, 0x05, 0xf6, 0x2a, 0xf6, 0x4e, 0xee, 0x50, 0xee, 0x6e, 0xee, 0x2c, 0xee, 0x49, 0xee, 0x65, 0xd5, 0xe0, 0xbd, 0x86, 0xe6, 0xb0, 0xe6, 0xf2, 0xd6, 0x72, 0xb5, 0x90, 0xbd, 0x92, 0xf7, 0x5a, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xb7, 0xff, 0x53, 0xff, 0x0e, 0xfe, 0xa9, 0xfe, 0x84, 0xf6, 0xcc, 0xd6, 0xd8, 0xc6, 0xfe, 0xc6, 0xdf, 0xc6, 0xbf, 0xb6, 0xbf, 0xae, 0xbf, 0xa6, 0x9f, 0xa6, 0x7f, 0x9e, 0x5f, 0x96, 0x3f, 0x8d, 0xfe, 0x8d, 0xde, 0x85, 0xbe, 0x85, 0x9e, 0x75, 0x7d, 0x6d, 0x3c, 0x4c, 0x18, 0x43, 0xf6, 0x75, 0x7c, 0x7d, 0xdd, 0x75, 0x9d, 0x6d, 0x7c, 0x65, 0x1a, 0x3c, 0x38, 0x4c, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x0a, 0xfe, 0xa4, 0xfe, 0x21, 0xfd, 0xc1, 0xfd, 0xc0, 0xfd, 0xe0, 0xfe, 0x00, 0xfd, 0xe0, 0xfd, 0xc0, 0xfe, 0x00, 0xfe, 0x20, 0xfe, 0x40, 0xfe, 0x40, 0xee, 0x22, 0xc5, 0x45, 0xcd, 0xed, 0xe7, 0x11, 0xd6, 0xd0, 0xbd, 0xcf, 0xb5, 0x4f, 0xf7, 0x57, 0xff, 0xda, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xda, 0xff, 0x96, 0xff, 0x72, 0xff, 0x0e, 0xfe, 0xc9, 0xfe, 0x85, 0xfe, 0x60, 0xfe, 0xcc, 0xde, 0xd8, 0xce, 0xff, 0xc6, 0xdf, 0xc6, 0xbe, 0xbe, 0xde, 0xae, 0xbf, 0xae, 0x7e, 0xa6, 0x5f, 0x9e, 0x3f, 0x9e, 0x3e, 0x96, 0x1e, 0x8d, 0xfe, 0x8d, 0xbd, 0x85, 0xbe, 0x7d, 0x7d, 0x75, 0x7e, 0x65, 0x3d, 0x3b, 0xf8, 0x44, 0x58, 0x6d, 0x7d, 0x65, 0x5c, 0x65, 0x3b, 0x65, 0x3b, 0x54, 0xda, 0x44, 0x3a, 0x4c, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc8, 0xfe, 0xa4, 0xfe, 0xa7, 0xfe, 0x67, 0xfe, 0x26, 0xfe, 0x23, 0xfe, 0x00, 0xfd, 0xe0, 0xfd, 0xe0, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x41, 0xfe, 0x43, 0xdd, 0xa6, 0xbd, 0x4d, 0xde, 0xb3, 0xdf, 0x10, 0xc6, 0x50, 0x9c, 0xad, 0xde, 0x95, 0xff, 0xd6, 0xff, 0x74, 0xff, 0x95, 0xff, 0x95, 0xff, 0x73, 0xff, 0x30, 0xff, 0x0c, 0xfe, 0xc8, 0xfe, 0x85, 0xfe, 0x62, 0xfe, 0x60, 0xfe, 0xcc, 0xe6, 0xd9, 0xce, 0xff, 0xc6, 0xdf, 0xc6, 0xde, 0xbe, 0xde, 0xb6, 0xbe, 0xae, 0x7e, 0xae, 0x5e, 0xa6, 0x3e, 0x9e, 0x3e, 0x96, 0x1e, 0x8d, 0xfd, 0x8d, 0xde, 0x85, 0xde, 0x85, 0xdf, 0x75, 0x7e, 0x65, 0x5e, 0x54, 0xdc, 0x33, 0xf8, 0x44, 0x79, 0x5d, 0x5c, 0x54, 0xfa, 0x5d, 0x5b, 0x5d, 0x1b, 0x3c, 0x18, 0x3c, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc8, 0xfe, 0xa4, 0xff, 0x07, 0xff, 0x28, 0xff, 0x27, 0xff, 0x05, 0xfe, 0xc5, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xf6, 0xa9, 0xc5, 0x69, 0xc5, 0xf0, 0xdf, 0x34, 0xce, 0xb1, 0x9c, 0xee, 0xbd, 0x71, 0xff, 0x76, 0xff, 0x31, 0xff, 0x2f, 0xff, 0x50, 0xff, 0x2e, 0xff, 0x0c, 0xfe, 0xe9, 0xfe, 0xa6, 0xfe, 0xa3, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x80, 0xfe, 0xcc, 0xe6, 0xd9, 0xce, 0xff, 0xc6, 0xfe, 0xc6, 0xde, 0xbe, 0xde, 0xb6, 0xbe, 0xae, 0x7e, 0xae, 0x5e, 0xa6, 0x5e, 0x9e, 0x5f, 0x8e, 0x3f, 0x85, 0xff, 0x7d, 0xdf, 0x6d, 0x7d, 0x65, 0x3d, 0x54, 0xfd, 0x4c, 0xbc, 0x4c, 0xbc, 0x3c, 0x3a, 0x23, 0xb7, 0x54, 0xfb, 0x5d, 0x5c, 0x5d, 0x1b, 0x5d, 0x1b, 0x4c, 0x78, 0x3b, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xe8, 0xfe, 0xa2, 0xff, 0x03, 0xff, 0x64, 0xff, 0x64, 0xff, 0x45, 0xff, 0x46, 0xff, 0x48, 0xff, 0x49, 0xff, 0x8a, 0xff, 0xa9, 0xff, 0xa9, 0xe6, 0xe9, 0xbd, 0xc9, 0xce, 0xcf, 0xd7, 0x4f, 0xb5, 0xee, 0x94, 0x2d, 0xf6, 0xf5, 0xff, 0x0f, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xcb, 0xfe, 0xc9, 0xfe, 0xc6, 0xfe, 0xa5, 0xfe, 0x83, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0xcc, 0xe6, 0xd8, 0xcf, 0x1f, 0xce, 0xff, 0xc6, 0xde, 0xbe, 0xbe, 0xb6, 0x9e, 0xae, 0x7e, 0xae, 0x7e, 0xa6, 0x7f, 0x8e, 0x3f, 0x7d, 0xdf, 0x65, 0x5e, 0x4c, 0xfd, 0x44, 0x9c, 0x3c, 0x5c, 0x3c, 0x7c, 0x44, 0x7c, 0x3c, 0x5c, 0x3c, 0x5b, 0x2b, 0xf9, 0x34, 0x39, 0x5d, 0x7d, 0x55, 0x3c, 0x5d, 0x1b, 0x5c, 0xd9, 0x44, 0x38, 0x34, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xe7, 0xfe, 0xa2, 0xff, 0x02, 0xff, 0x43, 0xff, 0x43, 0xff, 0x23, 0xff, 0x23, 0xff, 0x43, 0xff, 0x63, 0xff, 0xa4, 0xff, 0xa4, 0xf7, 0x86, 0xce, 0x67, 0xbe, 0x0c, 0xd7, 0x11, 0xce, 0xd0, 0x9c, 0xcc, 0xc5, 0x71, 0xff, 0x31, 0xfe, 0xc7, 0xfe, 0xa4, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xa5, 0xfe, 0x83, 0xfe, 0x82, 0xfe, 0x61, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0xac, 0xde, 0xd9, 0xce, 0xfe, 0xce, 0xfe, 0xc6, 0xde, 0xbe, 0x9e, 0xb6, 0xbf, 0xae, 0xbf, 0x96, 0x3f, 0x7d, 0x9d, 0x5c, 0xfc, 0x44, 0x7b, 0x3c, 0x7c, 0x34, 0x5c, 0x3c, 0x7c, 0x3c, 0x9d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x44, 0x7c, 0x3c, 0x3b, 0x2b, 0xd8, 0x4c, 0xdb, 0x65, 0x5c, 0x5d, 0x1a, 0x5d, 0x1b, 0x44, 0x59, 0x34, 0x1a, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xe6, 0xfe, 0xa2, 0xff, 0x02, 0xff, 0x23, 0xff, 0x23, 0xff, 0x24, 0xff, 0x23, 0xff, 0x23, 0xff, 0x63, 0xff, 0x84, 0xff, 0x85, 0xef, 0x27, 0xc6, 0x29, 0xc6, 0x6f, 0xde, 0xf2, 0xc6, 0x50, 0x94, 0x4c, 0xe6, 0x71, 0xff, 0x0c, 0xfe, 0xa0, 0xfe, 0x82, 0xfe, 0x83, 0xfe, 0xa1, 0xfe, 0x81, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0xac, 0xde, 0xd8, 0xcf, 0x1e, 0xc6, 0xfd, 0xc6, 0xfe, 0xbe, 0xdf, 0x9e, 0x7f, 0x7d, 0x9d, 0x54, 0xbc, 0x3c, 0x5c, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x9d, 0x3c, 0x9d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x3c, 0x7c, 0x33, 0xd9, 0x4c, 0x9a, 0x65, 0x5c, 0x5d, 0x1a, 0x5d, 0x3c, 0x4c, 0x7a, 0x3c, 0x3a, 0x34, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xe6, 0xfe, 0xa2, 0xff, 0x02, 0xff, 0x23, 0xff, 0x23, 0xff, 0x23, 0xff, 0x03, 0xff, 0x23, 0xff, 0x63, 0xff, 0x84, 0xff, 0x65, 0xe6, 0xc6, 0xc6, 0x09, 0xd6, 0xd1, 0xd6, 0xd2, 0xbd, 0xae, 0xac, 0xcc, 0xf6, 0xef, 0xf6, 0xc8, 0xfe, 0x80, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0xcd, 0xe6, 0xd7, 0xc6, 0xfd, 0xbf, 0x1e, 0xbf, 0x1f, 0x8e, 0x1f, 0x5c, 0xfd, 0x44, 0x7c, 0x3c, 0x5c, 0x3c, 0x7d, 0x3c, 0x7e, 0x34, 0x7e, 0x34, 0x7d, 0x3c, 0x7d, 0x3c, 0x7d, 0x34, 0x7d, 0x34, 0x7d, 0x34, 0x7d, 0x34, 0x7d, 0x3c, 0x7d, 0x3c, 0x7c, 0x34, 0x1a, 0x3c, 0x39, 0x65, 0x3c, 0x65, 0x3b, 0x5d, 0x3c, 0x54, 0xba, 0x44, 0x39, 0x34, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xe7, 0xfe, 0xa2, 0xfe, 0xe3, 0xff, 0x23, 0xff, 0x03, 0xff, 0x23, 0xff, 0x03, 0xff, 0x23, 0xff, 0x63, 0xff, 0x84, 0xff, 0x65, 0xd6, 0x85, 0xbe, 0x2a, 0xde, 0xf2, 0xce, 0x71, 0xad, 0x2c, 0xc5, 0x8d, 0xff, 0x2d, 0xfe, 0x83, 0xfe, 0x80, 0xfe, 0x61, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x62, 0xfe, 0x8c, 0xde, 0xb7, 0xcf, 0x3f, 0xae, 0xdf, 0x7d, 0xbd, 0x44, 0x7b, 0x34, 0x5b, 0x34, 0x7b, 0x3c, 0x9c, 0x3c, 0x9d, 0x34, 0x7c, 0x34, 0x9c, 0x34, 0x9c, 0x3c, 0x7c, 0x3c, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x3b, 0x33, 0xf8, 0x5d, 0x1b, 0x65, 0x5c, 0x5d, 0x3c, 0x5c, 0xfa, 0x44, 0x38, 0x34, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xe7, 0xfe, 0xa1, 0xfe, 0xe3, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x02, 0xff, 0x22, 0xff, 0x43, 0xff, 0x64, 0xf7, 0x65, 0xce, 0x65, 0xbe, 0x4c, 0xdf, 0x33, 0xc6, 0x50, 0xa5, 0x0b, 0xde, 0x0e, 0xfe, 0xeb, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x43, 0xfe, 0x8d, 0xde, 0xd9, 0xae, 0x9f, 0x6d, 0x5c, 0x3c, 0x3b, 0x3c, 0x5c, 0x3c, 0x9c, 0x3c, 0x9c, 0x34, 0x7c, 0x34, 0x7b, 0x3c, 0x9c, 0x3c, 0x9c, 0x34, 0x7c, 0x3c, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x5b, 0x33, 0xd8, 0x54, 0xda, 0x65, 0x7c, 0x5d, 0x1c, 0x65, 0x1a, 0x4c, 0x37, 0x34, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xe6, 0xfe, 0x81, 0xfe, 0xc3, 0xff, 0x03, 0xff, 0x02, 0xff, 0x02, 0xff, 0x02, 0xff, 0x02, 0xff, 0x43, 0xff, 0x44, 0xef, 0x24, 0xc6, 0x66, 0xc6, 0x8d, 0xdf, 0x33, 0xc6, 0x50, 0xad, 0x0b, 0xe6, 0x6e, 0xfe, 0xca, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x60, 0xfe, 0x81, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x42, 0xfe, 0xce, 0xbe, 0x58, 0x54, 0xba, 0x34, 0x5a, 0x3c, 0x9d, 0x3c, 0x7e, 0x3c, 0x7d, 0x3c, 0x9d, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x7d, 0x3c, 0x5c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x5c, 0x33, 0xd8, 0x4c, 0x9a, 0x65, 0x7d, 0x5d, 0x3c, 0x65, 0x1a, 0x4c, 0x37, 0x1b, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc6, 0xfe, 0x81, 0xfe, 0xc2, 0xff, 0x02, 0xff, 0x02, 0xff, 0x02, 0xfe, 0xe2, 0xff, 0x02, 0xff, 0x23, 0xff, 0x43, 0xee, 0xe4, 0xc6, 0x46, 0xce, 0xae, 0xdf, 0x13, 0xc6, 0x50, 0xad, 0x0a, 0xee, 0xac, 0xfe, 0xc9, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0xa0, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x63, 0xee, 0x8d, 0x8d, 0x34, 0x34, 0x59, 0x34, 0x9c, 0x3c, 0x9e, 0x3c, 0x7e, 0x3c, 0x7c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x5c, 0x3c, 0x7c, 0x3c, 0x7c, 0x34, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x5c, 0x3c, 0x5c, 0x3c, 0x5c, 0x34, 0x5c, 0x3c, 0x7d, 0x3c, 0x5c, 0x3b, 0xf9, 0x4c, 0x79, 0x65, 0x7d, 0x5d, 0x3d, 0x6d, 0x3b, 0x4c, 0x17, 0x03, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x81, 0xfe, 0xc2, 0xfe, 0xe2, 0xfe, 0xe2, 0xff, 0x02, 0xfe, 0xe2, 0xff, 0x02, 0xff, 0x23, 0xff, 0x43, 0xee, 0xe3, 0xc6, 0x25, 0xce, 0xce, 0xd7, 0x33, 0xc6, 0x2f, 0xad, 0x2a, 0xee, 0xcc, 0xff, 0x07, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0xa0, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x42, 0xfe, 0x22, 0xfe, 0x41, 0xee, 0x4a, 0x84, 0xf3, 0x34, 0x7b, 0x3c, 0x7d, 0x3c, 0x9d, 0x3c, 0x7d, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x34, 0x7b, 0x3c, 0x7b, 0x3c, 0x7b, 0x34, 0x5b, 0x34, 0x7b, 0x3c, 0x5b, 0x3c, 0x5c, 0x3c, 0x7c, 0x33, 0xf9, 0x4c, 0x79, 0x6d, 0x7d, 0x5d, 0x5d, 0x65, 0x1b, 0x4c, 0x57, 0x34, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x81, 0xfe, 0xa2, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xff, 0x23, 0xff, 0x43, 0xf6, 0xe3, 0xce, 0x25, 0xc6, 0xad, 0xd7, 0x13, 0xc6, 0x2f, 0xb5, 0x4b, 0xee, 0xab, 0xfe, 0xe7, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x62, 0xfe, 0x42, 0xfe, 0x02, 0xf6, 0x00, 0xee, 0x2a, 0x8c, 0xf4, 0x34, 0x7b, 0x3c, 0x7d, 0x3c, 0x9d, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x5c, 0x3c, 0x5c, 0x3c, 0x5b, 0x3c, 0x7b, 0x3c, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x3c, 0x7c, 0x3c, 0x5b, 0x3b, 0xf9, 0x54, 0x9a, 0x6d, 0x7d, 0x5d, 0x5d, 0x65, 0x3b, 0x4c, 0x37, 0x1b, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x81, 0xfe, 0xa2, 0xfe, 0xc2, 0xfe, 0xc2, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe2, 0xff, 0x03, 0xff, 0x44, 0xf6, 0xe3, 0xce, 0x45, 0xc6, 0x6c, 0xd7, 0x13, 0xc6, 0x30, 0xb5, 0x4b, 0xee, 0x8b, 0xfe, 0xc7, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0xa1, 0xfe, 0x60, 0xfe, 0x81, 0xfe, 0x80, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x42, 0xfe, 0x03, 0xfd, 0xc2, 0xed, 0xc0, 0xee, 0x0a, 0x8c, 0xf4, 0x34, 0x5b, 0x3c, 0x7d, 0x34, 0x9c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7c, 0x3c, 0x7b, 0x3c, 0x7b, 0x3c, 0x7b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5c, 0x3c, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x3b, 0x3c, 0x5a, 0x44, 0x39, 0x54, 0x99, 0x6d, 0x7d, 0x5d, 0x3d, 0x65, 0x1b, 0x4c, 0x37, 0x1b, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x81, 0xfe, 0xa2, 0xfe, 0xc2, 0xfe, 0xc2, 0xfe, 0xc1, 0xfe, 0xc1, 0xfe, 0xe2, 0xff, 0x03, 0xff, 0x44, 0xf6, 0xe3, 0xce, 0x44, 0xc6, 0x2b, 0xd6, 0xf2, 0xce, 0x50, 0xb5, 0x4b, 0xe6, 0x4a, 0xfe, 0xe8, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x81, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x42, 0xfe, 0x43, 0xfd, 0xe3, 0xf5, 0xa2, 0xed, 0xc0, 0xee, 0x0a, 0x8c, 0xf4, 0x34, 0x5b, 0x3c, 0x5c, 0x34, 0x9c, 0x34, 0x9c, 0x3c, 0x7c, 0x3c, 0x7c, 0x34, 0x7c, 0x34, 0x7c, 0x3c, 0x5b, 0x3c, 0x7b, 0x3c, 0x5b, 0x3c, 0x5b, 0x34, 0x5b, 0x2c, 0x5b, 0x2c, 0x5b, 0x34, 0x7b, 0x34, 0x7a, 0x34, 0x3a, 0x3c, 0x5a, 0x65, 0x3d, 0x54, 0x79, 0x5c, 0xba, 0x6d, 0x7d, 0x5d, 0x3d, 0x65, 0x1b, 0x4c, 0x17, 0x1b, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x61, 0xfe, 0xa2, 0xfe, 0xc2, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xc1, 0xfe, 0xc1, 0xff, 0x02, 0xff, 0x23, 0xf6, 0xe3, 0xd6, 0x44, 0xc6, 0x2a, 0xd6, 0xd1, 0xce, 0x90, 0xb5, 0x8b, 0xde, 0x0a, 0xfe, 0xc9, 0xfe, 0x81, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0xa1, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x42, 0xfe, 0x42, 0xfe, 0x23, 0xf5, 0xc2, 0xf5, 0x82, 0xed, 0xc0, 0xe6, 0x0b, 0x8c, 0xf4, 0x34, 0x5b, 0x3c, 0x5c, 0x3c, 0x9c, 0x34, 0x9c, 0x34, 0x7d, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x5c, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5b, 0x2c, 0x5b, 0x2c, 0x5b, 0x2c, 0x7b, 0x2c, 0x5b, 0x2c, 0x39, 0x34, 0x18, 0x6d, 0x5c, 0x8e, 0x5f, 0x54, 0x78, 0x65, 0x1b, 0x6d, 0x5d, 0x65, 0x3c, 0x5c, 0xfb, 0x44, 0x18, 0x34, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x61, 0xfe, 0x82, 0xfe, 0xa2, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xc1, 0xff, 0x02, 0xff, 0x23, 0xff, 0x02, 0xde, 0x63, 0xc6, 0x08, 0xce, 0x8f, 0xd6, 0xd0, 0xbd, 0xec, 0xcd, 0x8a, 0xfe, 0xaa, 0xfe, 0xa3, 0xfe, 0x80, 0xfe, 0x81, 0xfe, 0x81, 0xfe, 0x60, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x42, 0xfe, 0x42, 0xf6, 0x02, 0xf5, 0xa2, 0xf5, 0x82, 0xed, 0xc0, 0xe6, 0x0b, 0x84, 0xf4, 0x2c, 0x5b, 0x3c, 0x5c, 0x3c, 0x7c, 0x3c, 0x7b, 0x34, 0x7c, 0x34, 0x7c, 0x34, 0x5b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x5a, 0x3c, 0x5b, 0x34, 0x5b, 0x2c, 0x5b, 0x2c, 0x7b, 0x2c, 0x5b, 0x2c, 0x3a, 0x2c, 0x38, 0x54, 0xd9, 0x96, 0x5e, 0x8e, 0x1d, 0x54, 0x36, 0x6d, 0x5c, 0x65, 0x3c, 0x65, 0x3c, 0x54, 0xba, 0x3c, 0x3a, 0x34, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x61, 0xfe, 0x82, 0xfe, 0x82, 0xfe, 0x81, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xe2, 0xff, 0x23, 0xff, 0x02, 0xe6, 0x63, 0xc6, 0x07, 0xc6, 0x4d, 0xd6, 0xf0, 0xc6, 0x4e, 0xbd, 0x49, 0xf6, 0x8a, 0xfe, 0xa4, 0xfe, 0xa0, 0xfe, 0x81, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x41, 0xfe, 0x42, 0xfe, 0x42, 0xfe, 0x22, 0xf5, 0xe1, 0xf5, 0xa1, 0xf5, 0xa2, 0xed, 0xc0, 0xe6, 0x0b, 0x84, 0xf5, 0x2c, 0x7b, 0x3c, 0x7c, 0x3c, 0x7b, 0x3c, 0x5b, 0x34, 0x7c, 0x3c, 0x7b, 0x3c, 0x5b, 0x3c, 0x5a, 0x3c, 0x5a, 0x3c, 0x5a, 0x3c, 0x5a, 0x34, 0x3b, 0x2c, 0x3a, 0x2c, 0x5b, 0x34, 0x3b, 0x34, 0x39, 0x4c, 0x9a, 0x8e, 0x1d, 0xae, 0xbe, 0x74, 0xf8, 0x54, 0x77, 0x75, 0x9d, 0x65, 0x3c, 0x6d, 0x5c, 0x4c, 0x59, 0x3c, 0x3b, 0x5c, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x81, 0xfe, 0xc2, 0xff, 0x02, 0xff, 0x02, 0xee, 0x81, 0xce, 0x45, 0xbd, 0xea, 0xc6, 0x8f, 0xce, 0xd0, 0xb5, 0x6b, 0xe6, 0x28, 0xfe, 0xc6, 0xfe, 0x82, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x42, 0xfe, 0x02, 0xf5, 0xc2, 0xf5, 0xc2, 0xed, 0xc2, 0xed, 0xc0, 0xe5, 0xeb, 0x8c, 0xf4, 0x2c, 0x5b, 0x34, 0x7c, 0x34, 0x7b, 0x3c, 0x5b, 0x3c, 0x5b, 0x3c, 0x7b, 0x3c, 0x5a, 0x34, 0x5a, 0x34, 0x5a, 0x34, 0x5a, 0x34, 0x3a, 0x34, 0x5a, 0x2c, 0x5b, 0x2c, 0x3b, 0x34, 0x19, 0x4c, 0x58, 0x85, 0xbc, 0xae, 0x9e, 0x96, 0x1c, 0x4c, 0x77, 0x5d, 0x3b, 0x6d, 0x7b, 0x6d, 0x3a, 0x65, 0x3b, 0x44, 0x39, 0x34, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x40, 0xfe, 0x61, 0xfe, 0xa1, 0xfe, 0xe2, 0xff, 0x01, 0xf6, 0xc0, 0xd6, 0x43, 0xbd, 0xc8, 0xc6, 0x4d, 0xd7, 0x10, 0xc6, 0x0c, 0xcd, 0x87, 0xfe, 0xa7, 0xfe, 0x43, 0xfe, 0x81, 0xfe, 0xa0, 0xfe, 0x41, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x22, 0xf5, 0xe2, 0xf5, 0xc2, 0xf5, 0xc2, 0xed, 0xc2, 0xed, 0xc0, 0xe5, 0xeb, 0x84, 0xf4, 0x2c, 0x5b, 0x34, 0x5c, 0x3c, 0x7a, 0x34, 0x5b, 0x34, 0x5b, 0x34, 0x5a, 0x34, 0x5a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x34, 0x3a, 0x2c, 0x1a, 0x2c, 0x5a, 0x2c, 0x39, 0x44, 0x78, 0x85, 0xbb, 0xae, 0x3c, 0xae, 0x5b, 0x75, 0x58, 0x44, 0x78, 0x65, 0xbe, 0x65, 0x5d, 0x65, 0x3b, 0x5c, 0xf9, 0x3c, 0x19, 0x3c, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x20, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0xc1, 0xff, 0x01, 0xff, 0x00, 0xe6, 0x82, 0xbd, 0x85, 0xbd, 0xca, 0xd6, 0xee, 0xce, 0x8d, 0xc5, 0x8a, 0xee, 0x28, 0xfe, 0x86, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x82, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x21, 0xf5, 0xe2, 0xed, 0xc2, 0xed, 0xc2, 0xed, 0xc2, 0xed, 0xc0, 0xe6, 0x0b, 0x84, 0xf4, 0x24, 0x5c, 0x34, 0x5c, 0x3c, 0x7a, 0x3c, 0x5b, 0x34, 0x7b, 0x34, 0x5a, 0x34, 0x5a, 0x2c, 0x5b, 0x2c, 0x5b, 0x2c, 0x3a, 0x34, 0x5a, 0x34, 0x39, 0x34, 0x18, 0x44, 0x78, 0x7d, 0xdb, 0x9e, 0x5b, 0xa6, 0x39, 0x95, 0xf9, 0x54, 0x76, 0x65, 0x5c, 0x5d, 0x5e, 0x5d, 0x3d, 0x65, 0x1c, 0x4c, 0x78, 0x3b, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x41, 0xfe, 0x21, 0xfe, 0x41, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0xc1, 0xff, 0x01, 0xff, 0x20, 0xf6, 0xc2, 0xcd, 0x84, 0xb5, 0x28, 0xd6, 0x8c, 0xd6, 0xee, 0xce, 0x0d, 0xcd, 0x48, 0xfe, 0x67, 0xfe, 0xc3, 0xfe, 0x60, 0xfe, 0x82, 0xfe, 0x61, 0xfe, 0x41, 0xf6, 0x21, 0xf6, 0x02, 0xf5, 0xe2, 0xed, 0xc2, 0xed, 0xc2, 0xed, 0xc0, 0xdd, 0xeb, 0x84, 0xf5, 0x2c, 0x5c, 0x34, 0x7c, 0x3c, 0x7a, 0x3c, 0x5b, 0x34, 0x5b, 0x34, 0x3b, 0x34, 0x5b, 0x2c, 0x7b, 0x2c, 0x5b, 0x2c, 0x5a, 0x2c, 0x39, 0x34, 0x17, 0x5c, 0xd9, 0x8d, 0xfc, 0x9e, 0x3c, 0x96, 0x3b, 0x96, 0x5b, 0x6d, 0x38, 0x54, 0x78, 0x6d, 0x9d, 0x5d, 0x3c, 0x65, 0x3d, 0x5c, 0xdc, 0x3b, 0xd9, 0x44, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xc7, 0xfe, 0x40, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x20, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0xc1, 0xff, 0x01, 0xff, 0x40, 0xff, 0x02, 0xdd, 0xe4, 0xb4, 0xe5, 0xce, 0x09, 0xd6, 0xcd, 0xde, 0x8f, 0xc5, 0xab, 0xd5, 0xa6, 0xfe, 0xa5, 0xfe, 0x81, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x41, 0xf6, 0x21, 0xf6, 0x01, 0xf5, 0xe2, 0xed, 0xc2, 0xe5, 0xc2, 0xe5, 0xc0, 0xdd, 0xeb, 0x84, 0xf4, 0x2c, 0x5b, 0x34, 0x5b, 0x3c, 0x7a, 0x3c, 0x5b, 0x3c, 0x5b, 0x34, 0x3b, 0x34, 0x3a, 0x2c, 0x3a, 0x2c, 0x18, 0x2c, 0x17, 0x3c, 0x57, 0x6d, 0x59, 0x9e, 0x1b, 0xa6, 0x1b, 0x9d, 0xfa, 0x96, 0x5c, 0x6d, 0x9b, 0x44, 0x78, 0x6d, 0x7d, 0x6d, 0x5c, 0x65, 0x1a, 0x65, 0x3c, 0x44, 0x3a, 0x2b, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xa7, 0xfe, 0x20, 0xfe, 0x21, 0xfe, 0x41, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x20, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0xc1, 0xff, 0x01, 0xff, 0x40, 0xff, 0x22, 0xee, 0x44, 0xbd, 0x04, 0xc5, 0xa6, 0xce, 0x29, 0xde, 0xcf, 0xd6, 0x8d, 0xcd, 0xa8, 0xe5, 0xc4, 0xfe, 0x62, 0xfe, 0x82, 0xfe, 0x60, 0xfe, 0x40, 0xf6, 0x20, 0xf6, 0x01, 0xf6, 0x02, 0xed, 0xe2, 0xe5, 0xc2, 0xe5, 0xe2, 0xe6, 0x0b, 0x84, 0xf4, 0x2c, 0x5b, 0x34, 0x7b, 0x34, 0x7a, 0x34, 0x7b, 0x34, 0x7b, 0x34, 0x3a, 0x34, 0x19, 0x2c, 0x18, 0x44, 0x58, 0x64, 0xf9, 0x8d, 0xbb, 0xae, 0x9d, 0xbe, 0xdc, 0xb6, 0x9a, 0xb6, 0xdc, 0x85, 0xbb, 0x44, 0x79, 0x55, 0x3c, 0x6d, 0xbd, 0x65, 0x3a, 0x6d, 0x3b, 0x5c, 0xdb, 0x33, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x87, 0xfe, 0x00, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x20, 0xfe, 0x81, 0xfe, 0xe1, 0xff, 0x00, 0xff, 0x20, 0xff, 0x42, 0xf6, 0x65, 0xc5, 0x43, 0xcd, 0xc3, 0xc5, 0xc6, 0xd6, 0x6b, 0xde, 0xce, 0xd6, 0x6d, 0xcd, 0xa7, 0xe5, 0xe3, 0xfe, 0x43, 0xfe, 0x41, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x22, 0xee, 0x02, 0xed, 0xc2, 0xf5, 0xe3, 0xe5, 0xe5, 0xe6, 0x0e, 0x8c, 0xb2, 0x44, 0x17, 0x44, 0x39, 0x3c, 0x39, 0x3c, 0x59, 0x3c, 0x59, 0x3c, 0x18, 0x54, 0x58, 0x74, 0xb9, 0x8d, 0x7a, 0xa6, 0x3b, 0xbe, 0xbc, 0xd7, 0x1d, 0xdf, 0x3d, 0xdf, 0xbf, 0xae, 0xbb, 0x64, 0xb6, 0x74, 0xfa, 0x7d, 0x5c, 0x5d, 0x1a, 0x6d, 0x19, 0x74, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x87, 0xfd, 0xe1, 0xfe, 0x20, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x81, 0xfe, 0xc1, 0xfe, 0xe0, 0xff, 0x00, 0xff, 0x42, 0xf6, 0xa6, 0xd5, 0xa3, 0xde, 0x01, 0xc5, 0x83, 0xcd, 0xa6, 0xd6, 0x6c, 0xd6, 0xef, 0xce, 0x8c, 0xcd, 0xe8, 0xe5, 0xc5, 0xfe, 0x42, 0xfe, 0x60, 0xfe, 0x21, 0xf6, 0x23, 0xed, 0xe2, 0xfd, 0xc3, 0xed, 0x04, 0xcc, 0x04, 0xbc, 0x2a, 0x9b, 0x4d, 0x7b, 0x10, 0x73, 0x33, 0x73, 0x33, 0x73, 0x33, 0x6b, 0x12, 0x73, 0x73, 0x7b, 0xb3, 0x8c, 0x14, 0x9c, 0x95, 0xb5, 0x56, 0xc6, 0x39, 0xef, 0x5d, 0xf7, 0x5f, 0xd6, 0x7c, 0x94, 0xf5, 0x94, 0x95, 0xa4, 0x97, 0xa4, 0x16, 0x8c, 0x76, 0x84, 0x75, 0x7b, 0x31, 0x92, 0xf0, 0x93, 0x31, 0x9b, 0x12, 0x9a, 0xf2, 0x9b, 0x32, 0x93, 0x32, 0x8b, 0x52, 0x8b, 0x93, 0x8b, 0x53, 0x93, 0x33, 0xa3, 0x53, 0x93, 0x12, 0x93, 0x33, 0x9b, 0x33, 0xa3, 0x53, 0xa3, 0x33, 0x9b, 0x12, 0x8b, 0x93, 0x9b, 0x32, 0x8b, 0x11, 0x9b, 0x73, 0x83, 0x13, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x67, 0xfd, 0xe0, 0xfe, 0x00, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x21, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x81, 0xfe, 0xc1, 0xff, 0x00, 0xff, 0x20, 0xff, 0x62, 0xf6, 0xc6, 0xe5, 0xe3, 0xee, 0x62, 0xd5, 0x62, 0xc5, 0x42, 0xc6, 0x07, 0xce, 0xac, 0xce, 0xee, 0xce, 0x8d, 0xcd, 0xea, 0xdd, 0xa4, 0xf6, 0x41, 0xfe, 0x43, 0xfd, 0xc3, 0xfd, 0xe3, 0xec, 0xc3, 0xc2, 0xc2, 0xca, 0x66, 0xdb, 0x0a, 0xd3, 0x0d, 0xcb, 0x0e, 0xc3, 0x2f, 0xc3, 0x2f, 0xba, 0xee, 0xba, 0xee, 0xb3, 0x0e, 0xa3, 0x0e, 0xa3, 0x0e, 0xab, 0xf1, 0xd5, 0x36, 0xe6, 0x7a, 0xee, 0xbb, 0xdd, 0xd9, 0xcc, 0xf6, 0xd4, 0xf5, 0xd4, 0xd4, 0xd4, 0xb3, 0xdc, 0xd4, 0xbc, 0xb3, 0x94, 0x12, 0xab, 0xd1, 0xe4, 0x93, 0xec, 0x93, 0xf4, 0x74, 0xf4, 0x34, 0xf4, 0x53, 0xf4, 0x93, 0xec, 0x93, 0xec, 0xb3, 0xec, 0xb3, 0xf4, 0x94, 0xf4, 0x94, 0xec, 0xd4, 0xec, 0xf4, 0xf4, 0x94, 0xf4, 0x74, 0xf4, 0x93, 0xf4, 0x72, 0xf4, 0x72, 0xec, 0x32, 0xf4, 0xb3, 0xeb, 0xaf, 0x9a, 0x2c, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x67, 0xfd, 0xe0, 0xfe, 0x00, 0xfe, 0x21, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x61, 0xfe, 0xa1, 0xff, 0x00, 0xff, 0x40, 0xff, 0x62, 0xf6, 0xc5, 0xe6, 0x02, 0xfe, 0xc1, 0xed, 0xe1, 0xd5, 0x60, 0xc5, 0x84, 0xbd, 0xe7, 0xce, 0xac, 0xd6, 0xce, 0xce, 0x4c, 0xb5, 0x85, 0xc5, 0xa2, 0xdd, 0xe4, 0xf5, 0xe5, 0xe4, 0xa2, 0xb2, 0x61, 0xd2, 0x69, 0xea, 0xed, 0xea, 0xcc, 0xe2, 0xec, 0xd2, 0xeb, 0xc3, 0x0b, 0xc3, 0x2b, 0xbb, 0x2b, 0xc3, 0x2c, 0xcb, 0x4d, 0xd3, 0xaf, 0xe4, 0x32, 0xdc, 0x93, 0xd4, 0xf5, 0xcc, 0xf4, 0xcc, 0xd3, 0xcc, 0xb2, 0xe4, 0xb2, 0xec, 0x71, 0xe4, 0x50, 0xdc, 0xd0, 0xcc, 0xf2, 0xbd, 0x55, 0xb5, 0x96, 0xb5, 0x14, 0xcc, 0xd3, 0xcc, 0x71, 0xd3, 0xf0, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x91, 0xfc, 0xd1, 0xfc, 0xb1, 0xfc, 0xd2, 0xfc, 0xf4, 0xfc, 0xb2, 0xfc, 0xf2, 0xfd, 0x13, 0xfc, 0xb2, 0xfc, 0xd3, 0xfc, 0xd2, 0xfc, 0xb1, 0xfc, 0x70, 0xfc, 0xb2, 0xfb, 0xee, 0xd1, 0xa7, 0x79, 0xcb, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x67, 0xfd, 0xc0, 0xfe, 0x01, 0xfe, 0x21, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x20, 0xfe, 0x61, 0xfe, 0xa1, 0xfe, 0xe1, 0xff, 0x40, 0xff, 0x62, 0xf6, 0xc4, 0xe6, 0x01, 0xff, 0x01, 0xfe, 0xa0, 0xed, 0xe0, 0xcd, 0x61, 0xbd, 0x43, 0xc5, 0xe7, 0xd6, 0x4a, 0xc6, 0x29, 0xae, 0x07, 0xad, 0xc7, 0xbd, 0xa6, 0xbc, 0xa4, 0xa2, 0xc4, 0xc2, 0xaa, 0xe3, 0x0e, 0xea, 0xee, 0xe2, 0xcd, 0xeb, 0x0d, 0xdb, 0x2d, 0xd3, 0x6d, 0xcb, 0x8e, 0xd3, 0xf0, 0xd3, 0xf0, 0xdc, 0x11, 0xdc, 0x12, 0xd4, 0x12, 0xcc, 0x11, 0xbc, 0x11, 0xbc, 0x11, 0xd4, 0x72, 0xe4, 0x92, 0xe3, 0xce, 0xda, 0xeb, 0xd3, 0x0c, 0xc3, 0xf0, 0xc5, 0x76, 0xef, 0x3c, 0xe6, 0xfa, 0xd6, 0x18, 0xa4, 0xb4, 0x83, 0xd0, 0x72, 0xeb, 0xa3, 0xae, 0xe4, 0xf3, 0xfc, 0xf3, 0xfc, 0xb2, 0xfc, 0x92, 0xfc, 0xb2, 0xf4, 0xf4, 0xfc, 0xf3, 0xfc, 0xb2, 0xfc, 0x72, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0x72, 0xfc, 0x92, 0xfc, 0xb2, 0xf3, 0xae, 0xd1, 0x67, 0x9a, 0x2e, 0x7b, 0x13, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x67, 0xfd, 0xc0, 0xfe, 0x00, 0xfe, 0x21, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x20, 0xfe, 0x61, 0xfe, 0xa1, 0xfe, 0xe1, 0xff, 0x21, 0xff, 0x62, 0xf6, 0xa4, 0xe6, 0x01, 0xff, 0x00, 0xfe, 0xc0, 0xfe, 0x81, 0xee, 0x01, 0xd5, 0x80, 0xcd, 0x40, 0xcd, 0x83, 0xc5, 0xc5, 0xb6, 0x08, 0xbd, 0xca, 0xa4, 0x87, 0x92, 0xe6, 0xb2, 0xeb, 0xcb, 0x4e, 0xd3, 0x4e, 0xd3, 0x2d, 0xe3, 0x2e, 0xe3, 0x4e, 0xdb, 0x4e, 0xe3, 0xb0, 0xdb, 0x90, 0xdb, 0xd1, 0xd3, 0xd1, 0xc3, 0xf0, 0xbb, 0xf0, 0xbb, 0xf0, 0xc4, 0x11, 0xc4, 0x51, 0xd4, 0x52, 0xdb, 0xd1, 0xdb, 0x4e, 0xda, 0x8a, 0xd2, 0x49, 0xb2, 0xab, 0x93, 0xd0, 0xad, 0x97, 0xef, 0x7d, 0xff, 0xfe, 0xce, 0x58, 0x8c, 0xd3, 0xa5, 0xb7, 0x84, 0x70, 0x52, 0x27, 0xa3, 0xae, 0xec, 0xd3, 0xfc, 0x92, 0xfc, 0x72, 0xfc, 0x92, 0xfc, 0xb2, 0xfc, 0xd3, 0xfc, 0x92, 0xfc, 0x72, 0xfc, 0xb2, 0xf4, 0x71, 0xfc, 0x71, 0xfc, 0xb2, 0xeb, 0xaf, 0xd1, 0x27, 0xeb, 0xd1, 0x8c, 0xd9, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x67, 0xfd, 0xc0, 0xfe, 0x00, 0xfe, 0x21, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x00, 0xfe, 0x20, 0xfe, 0x60, 0xfe, 0xa1, 0xfe, 0xe1, 0xff, 0x00, 0xff, 0x42, 0xf6, 0x84, 0xe6, 0x02, 0xff, 0x01, 0xfe, 0xc1, 0xfe, 0xa1, 0xfe, 0xa0, 0xf6, 0x40, 0xdd, 0xa0, 0xc5, 0x41, 0xbd, 0x44, 0xbd, 0x87, 0xb4, 0xa6, 0x9a, 0xe7, 0xb3, 0x0d, 0xc3, 0x4f, 0xbb, 0x8d, 0xbb, 0xac, 0xbb, 0xad, 0xc3, 0x8d, 0xcb, 0xae, 0xcb, 0xae, 0xc3, 0x8e, 0xc3, 0x8f, 0xcb, 0x8f, 0xcb, 0x8f, 0xcb, 0x8f, 0xcb, 0xaf, 0xd3, 0xaf, 0xd3, 0xaf, 0xd3, 0x8f, 0xd3, 0x6d, 0xd3, 0x0b, 0xda, 0x4a, 0xd9, 0xa7, 0xb9, 0x25, 0xb2, 0xab, 0xa4, 0x30, 0x9c, 0xf4, 0xc6, 0x7a, 0xc6, 0xba, 0x9d, 0xb5, 0xb6, 0x58, 0xad, 0xb6, 0xa5, 0x14, 0x83, 0xef, 0x6a, 0x68, 0xab, 0x4d, 0xf4, 0xb3, 0xfc, 0xb2, 0xfc, 0x71, 0xfc, 0x71, 0xfc, 0x71, 0xfc, 0x92, 0xfc, 0x71, 0xfc, 0x30, 0xfc, 0x50, 0xfc, 0xb1, 0xeb, 0xaf, 0xc0, 0xe7, 0xe4, 0x71, 0xf6, 0x39, 0x85, 0x7d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x66, 0xfd, 0xa0, 0xfd, 0xe1, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x41, 0xfe, 0xa1, 0xfe, 0xc0, 0xff, 0x00, 0xff, 0x43, 0xf6, 0x85, 0xde, 0x02, 0xff, 0x21, 0xfe, 0xc1, 0xfe, 0xa0, 0xfe, 0xc0, 0xfe, 0xc1, 0xf6, 0x61, 0xe5, 0xe0, 0xcd, 0x62, 0xa3, 0xa2, 0x92, 0x21, 0xba, 0xaa, 0xcb, 0x0d, 0xc3, 0x2c, 0xbb, 0x6c, 0xbb, 0x2b, 0xc3, 0x0c, 0xc3, 0x0c, 0xc3, 0x0c, 0xcb, 0x0c, 0xc3, 0x0c, 0xc3, 0x0b, 0xca, 0xeb, 0xd2, 0xcb, 0xd2, 0x8a, 0xd2, 0x8a, 0xd2, 0x8a, 0xda, 0x8a, 0xd2, 0x89, 0xd2, 0x68, 0xca, 0x07, 0xc9, 0x24, 0xc8, 0x82, 0xd8, 0x00, 0xd8, 0xe3, 0xcb, 0x4b, 0xb4, 0x8f, 0x94, 0x71, 0x7b, 0xd1, 0xa5, 0xb9, 0xde, 0xfc, 0xcd, 0xb7, 0xad, 0x35, 0x9d, 0x54, 0x73, 0xee, 0x62, 0xca, 0xa3, 0x8e, 0xec, 0xb3, 0xfc, 0x93, 0xfc, 0x50, 0xfc, 0x51, 0xfc, 0x52, 0xfc, 0x51, 0xf4, 0x70, 0xfc, 0x71, 0xf3, 0x2e, 0xc0, 0x45, 0xd4, 0x92, 0xee, 0xd9, 0xde, 0xb9, 0x8d, 0x5a, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x66, 0xfd, 0xa0, 0xfd, 0xe1, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x41, 0xfe, 0x81, 0xfe, 0xc1, 0xfe, 0xe1, 0xff, 0x43, 0xf6, 0x85, 0xe6, 0x02, 0xff, 0x22, 0xff, 0x00, 0xff, 0x00, 0xfe, 0xc1, 0xfe, 0xa1, 0xfe, 0xe2, 0xf6, 0x24, 0xc3, 0xe2, 0xa9, 0x60, 0xb9, 0x23, 0xc1, 0x46, 0xb9, 0x66, 0xb9, 0xc7, 0xca, 0x49, 0xca, 0x49, 0xca, 0x29, 0xca, 0x29, 0xca, 0x29, 0xca, 0x29, 0xca, 0x49, 0xca, 0x48, 0xca, 0x28, 0xca, 0x28, 0xd2, 0x28, 0xd2, 0x28, 0xd2, 0x28, 0xd1, 0xc7, 0xd1, 0x85, 0xc9, 0x04, 0xd0, 0x61, 0xd8, 0x21, 0xe0, 0x20, 0xf8, 0x20, 0xe8, 0x00, 0xc9, 0x64, 0xaa, 0xea, 0x82, 0xec, 0x83, 0xd1, 0x73, 0xf1, 0xad, 0x96, 0xe6, 0xdb, 0xbd, 0xf8, 0x94, 0xf4, 0x8c, 0x51, 0x83, 0xae, 0x62, 0x8a, 0x93, 0x4d, 0xe4, 0xb3, 0xfc, 0x30, 0xfb, 0xf0, 0xfc, 0x31, 0xf4, 0x30, 0xfc, 0xb2, 0xf3, 0x2d, 0xc0, 0x06, 0xe4, 0x72, 0xfe, 0x9b, 0xde, 0xfa, 0xd7, 0x1a, 0x85, 0xba, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x66, 0xfd, 0xc1, 0xfd, 0xe1, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x41, 0xfe, 0x81, 0xfe, 0xa1, 0xfe, 0xe1, 0xff, 0x22, 0xf6, 0x84, 0xe5, 0xe2, 0xff, 0x23, 0xff, 0x01, 0xfe, 0xe0, 0xfe, 0xa0, 0xfe, 0xa1, 0xf6, 0x62, 0xcc, 0x21, 0xc1, 0xc2, 0xe9, 0xc7, 0xf1, 0xe8, 0xe1, 0x67, 0xd1, 0x04, 0xc0, 0xc3, 0xc0, 0x63, 0xc0, 0xe4, 0xb9, 0x45, 0xc1, 0x66, 0xc9, 0x87, 0xc9, 0xa7, 0xd1, 0xc7, 0xd1, 0xc7, 0xd1, 0xc7, 0xd1, 0xc7, 0xc9, 0xa6, 0xc9, 0x65, 0xc9, 0x03, 0xc8, 0x81, 0xd0, 0x00, 0xd8, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x41, 0xf8, 0x00, 0xe0, 0x41, 0xb9, 0x25, 0x82, 0xab, 0x6b, 0x6d, 0x6b, 0x6e, 0x73, 0x8e, 0xad, 0x75, 0xce, 0x5a, 0xb5, 0x96, 0x94, 0x92, 0x9c, 0x52, 0x83, 0xf0, 0x42, 0x89, 0x8b, 0x2c, 0xe4, 0x31, 0xfb, 0xf0, 0xfb, 0xef, 0xfc, 0x50, 0xeb, 0x2c, 0xc8, 0xa6, 0xe4, 0x93, 0xf6, 0x7a, 0xde, 0x9c, 0xd6, 0xdb, 0xdf, 0x1b, 0x8d, 0xdc, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x66, 0xfd, 0xa0, 0xfd, 0xe1, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0x82, 0xfe, 0xc1, 0xff, 0x22, 0xf6, 0x83, 0xe5, 0xe2, 0xff, 0x03, 0xfe, 0xe3, 0xfe, 0xc1, 0xff, 0x02, 0xee, 0x42, 0xc4, 0x21, 0xb9, 0xc1, 0xe9, 0xc7, 0xfa, 0x0a, 0xf9, 0xe9, 0xf9, 0xe8, 0xf2, 0x07, 0xe9, 0xc6, 0xe1, 0x66, 0xd9, 0x05, 0xd0, 0xa3, 0xc8, 0x82, 0xc8, 0x41, 0xc8, 0x21, 0xc8, 0x21, 0xc8, 0x21, 0xc0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd8, 0x00, 0xe8, 0x00, 0xf0, 0x20, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x00, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x00, 0xd8, 0xa3, 0xa2, 0x48, 0x6b, 0x6c, 0x63, 0x6e, 0x73, 0x6f, 0x6b, 0x2d, 0xad, 0x15, 0xce, 0xb9, 0xad, 0x94, 0xa4, 0x93, 0xa4, 0xb3, 0x7b, 0xf0, 0x5a, 0x8b, 0x8a, 0xcc, 0xe4, 0x10, 0xfc, 0x71, 0xeb, 0x0c, 0xc0, 0xc4, 0xd4, 0xb1, 0xee, 0xb9, 0xe6, 0xbb, 0xde, 0xbd, 0xe7, 0x5d, 0xe6, 0xfc, 0x8d, 0x7d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x66, 0xf5, 0xa0, 0xfd, 0xe1, 0xfe, 0x01, 0xfe, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x01, 0xfe, 0x41, 0xfe, 0x61, 0xfe, 0xa1, 0xfe, 0xe1, 0xff, 0x22, 0xf6, 0x83, 0xe5, 0xe2, 0xff, 0x03, 0xff, 0x01, 0xff, 0x00, 0xee, 0x01, 0xbc, 0x01, 0xb1, 0xc0, 0xe1, 0xc6, 0xf9, 0xea, 0xf9, 0xa9, 0xf9, 0xc8, 0xfa, 0x07, 0xfa, 0x07, 0xfa, 0x07, 0xf9, 0xe8, 0xf9, 0xc8, 0xf9, 0xa7, 0xf1, 0x66, 0xe9, 0x25, 0xe8, 0xe4, 0xe0, 0xc4, 0xe0, 0x83, 0xd8, 0x62, 0xe0, 0x41, 0xe8, 0x21, 0xf0, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x00, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x21, 0xf8, 0x00, 0xf8, 0x00, 0xd8, 0xe4, 0xaa, 0xaa, 0x6b, 0x4d, 0x5b, 0x0d, 0x7b, 0x6f, 0x94, 0x31, 0x8d, 0x12, 0xbe, 0x98, 0xbd, 0xd6, 0xa4, 0x73, 0xa4, 0x73, 0x7b, 0x90, 0x4a, 0x6a, 0x93, 0x0c, 0xcb, 0x2d, 0xb9, 0x67, 0xdc, 0xb1, 0xe6, 0xb8, 0xde, 0xfa, 0xde, 0xdb, 0xe6, 0xfc, 0xe7, 0x3c, 0xe7, 0x5e, 0x85, 0x7b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x66, 0xfd, 0xa1, 0xfd, 0xe1, 0xfe, 0x01, 0xfd, 0xe0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfe, 0x00, 0xfe, 0x21, 0xfe, 0x61, 0xfe, 0xa0, 0xfe, 0xe0, 0xff, 0x22, 0xf6, 0x84, 0xe5, 0xe2, 0xff, 0x22, 0xff, 0x21, 0xf6, 0x00, 0xcb, 0xa0, 0xb9, 0x42, 0xe9, 0xa6, 0xf9, 0xc8, 0xf9, 0x89, 0xf9, 0x88, 0xf9, 0xc7, 0xf9, 0xe7, 0xf9, 0xc6, 0xf9, 0xc7, 0xf9, 0xc7, 0xf9, 0xc7, 0xf1, 0xe7, 0xf9, 0xe7, 0xfa, 0x07, 0xf9, 0xe7, 0xf9, 0xe7, 0xf9, 0xa7, 0xf1, 0x86, 0xf9, 0x45, 0xf9, 0x04, 0xf8, 0xc3, 0xf8, 0x82, 0xf0, 0x61, 0xf0, 0x20, 0xf0, 0x20, 0xf8, 0x20, 0xf0, 0x20, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x20, 0xf8, 0x00, 0xf8, 0x00, 0xd8, 0xc4, 0xb2, 0x8a, 0x7a, 0xaa, 0x72, 0xec, 0x73, 0x6e, 0x63, 0xce, 0x95, 0x13, 0xce, 0x59, 0xbd, 0x96, 0x9c, 0x73, 0x8c, 0x31, 0x7b, 0xcf, 0x5a, 0xaa, 0x79, 0x46, 0xd4, 0x72, 0xee, 0xfa, 0xd6, 0xda, 0xd6, 0xfb, 0xdf, 0x1d, 0xef, 0x1d, 0xef, 0x7e, 0xff, 0x9e, 0x9c, 0xf5, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x67, 0xfd, 0xa1, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfe, 0x00, 0xfe, 0x21, 0xfe, 0x41, 0xfe, 0xa0, 0xff, 0x00, 0xff, 0x42, 0xf6, 0x85, 0xe6, 0x02, 0xff, 0x22, 0xe6, 0x22, 0xb3, 0xc0, 0xc1, 0x43, 0xf1, 0x48, 0xf9, 0x48, 0xf9, 0x67, 0xf9, 0x86, 0xf9, 0xa6, 0xf1, 0xc6, 0xf1, 0xa6, 0xf9, 0xc7, 0xf9, 0xa7, 0xf1, 0xa6, 0xf1, 0xc7, 0xf1, 0xc7, 0xf1, 0xc7, 0xf1, 0xc7, 0xf1, 0xc7, 0xf9, 0xc7, 0xf9, 0xc7, 0xf9, 0xe7, 0xf9, 0xe7, 0xf9, 0xc7, 0xf9, 0xc7, 0xf9, 0xc6, 0xf9, 0x85, 0xf9, 0x25, 0xf8, 0xe4, 0xf0, 0xc3, 0xe8, 0x82, 0xf0, 0x41, 0xf0, 0x00, 0xf0, 0x00, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x00, 0xe0, 0x83, 0xb2, 0x08, 0x72, 0xca, 0x6b, 0x4e, 0x6b, 0x6f, 0x6b, 0x6f, 0x94, 0x92, 0xce, 0x58, 0xad, 0xd6, 0x94, 0xb1, 0x94, 0x30, 0x83, 0x8e, 0x5a, 0x69, 0x8b, 0x8e, 0xd6, 0x59, 0xd7, 0x3d, 0xdf, 0x1d, 0xe7, 0x1e, 0xef, 0x7e, 0xf7, 0x7e, 0xe5, 0xb6, 0x8a, 0x8b, 0x62, 0xd0, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x67, 0xfd, 0xa0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfe, 0x00, 0xfe, 0x21, 0xfe, 0x41, 0xfe, 0xa0, 0xfe, 0xe1, 0xff, 0x22, 0xf6, 0xa4, 0xe5, 0xe2, 0xe6, 0x02, 0xb3, 0xc2, 0xc0, 0xe1, 0xf1, 0x47, 0xf9, 0x47, 0xf9, 0x25, 0xf9, 0x66, 0xf1, 0x65, 0xf1, 0x84, 0xf1, 0x85, 0xf1, 0x86, 0xf1, 0x86, 0xf1, 0x86, 0xf1, 0x86, 0xf1, 0x66, 0xf9, 0x66, 0xf9, 0x66, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x87, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xc7, 0xfa, 0x08, 0xf2, 0x28, 0xf2, 0x49, 0xfa, 0x29, 0xfa, 0x28, 0xfa, 0x09, 0xf9, 0xe8, 0xf9, 0xa7, 0xf1, 0x66, 0xf9, 0x24, 0xf8, 0xe3, 0xf8, 0x82, 0xf8, 0x21, 0xf8, 0x00, 0xf8, 0x00, 0xe8, 0x20, 0xd0, 0xc3, 0xa9, 0xe8, 0x82, 0xeb, 0x63, 0x4c, 0x6b, 0xcf, 0x63, 0x6e, 0x84, 0x71, 0xae, 0x97, 0xad, 0xd5, 0x94, 0x51, 0x8c, 0x31, 0x7b, 0xaf, 0x52, 0x4a, 0x7b, 0x4f, 0xde, 0x7c, 0xef, 0x5e, 0xe7, 0xbe, 0xef, 0xfe, 0xdd, 0x75, 0xa8, 0x85, 0xc9, 0xc9, 0x9a, 0x8e, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x47, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xe0, 0xfd, 0xe0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe0, 0xfe, 0x00, 0xfe, 0x40, 0xfe, 0xa1, 0xfe, 0xa1, 0xff, 0x01, 0xee, 0x84, 0xbc, 0x62, 0xc3, 0x82, 0xc8, 0xe2, 0xe9, 0x44, 0xf1, 0x45, 0xf1, 0x45, 0xf1, 0x45, 0xf1, 0x45, 0xe9, 0x45, 0xf1, 0x44, 0xf1, 0x25, 0xf1, 0x45, 0xf1, 0x45, 0xf9, 0x25, 0xf1, 0x45, 0xf9, 0x25, 0xf9, 0x25, 0xf9, 0x25, 0xf9, 0x25, 0xf9, 0x45, 0xf9, 0x45, 0xf9, 0x65, 0xf9, 0x86, 0xf1, 0xa6, 0xf1, 0xc7, 0xf1, 0xe8, 0xf2, 0x08, 0xfa, 0x08, 0xfa, 0x28, 0xfa, 0x49, 0xfa, 0x4a, 0xfa, 0x69, 0xfa, 0x69, 0xfa, 0x49, 0xfa, 0x09, 0xf9, 0xc8, 0xf9, 0x87, 0xf9, 0x24, 0xf1, 0x03, 0xe8, 0xa1, 0xe8, 0x02, 0xd8, 0x64, 0xa9, 0xa6, 0x7a, 0xa9, 0x63, 0x4c, 0x6b, 0x6e, 0x73, 0x4e, 0x84, 0x51, 0xb6, 0x17, 0xad, 0xb6, 0x84, 0x71, 0x84, 0x30, 0x73, 0xce, 0x52, 0x49, 0x73, 0x8e, 0xde, 0xbb, 0xff, 0x9e, 0xd5, 0x95, 0x91, 0xe5, 0xd9, 0xc7, 0xf2, 0x4b, 0xa2, 0x2c, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x47, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xe1, 0xfd, 0xe0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe0, 0xfe, 0x00, 0xfe, 0x40, 0xfe, 0x81, 0xfe, 0xa1, 0xfe, 0xc2, 0xd5, 0x43, 0xa2, 0x41, 0xc1, 0x45, 0xe9, 0x27, 0xf9, 0x46, 0xf1, 0x44, 0xe9, 0x65, 0xf1, 0x65, 0xf9, 0x25, 0xf9, 0x45, 0xf9, 0x45, 0xf9, 0x45, 0xf9, 0x46, 0xf9, 0x46, 0xf9, 0x45, 0xf9, 0x45, 0xf1, 0x45, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x85, 0xf1, 0x86, 0xf1, 0xa6, 0xf1, 0xc6, 0xf1, 0xe7, 0xf2, 0x07, 0xf2, 0x08, 0xf2, 0x28, 0xfa, 0x49, 0xfa, 0x69, 0xfa, 0x89, 0xfa, 0xaa, 0xfa, 0xaa, 0xfa, 0xcb, 0xfa, 0xeb, 0xfb, 0x0c, 0xfb, 0x0c, 0xfb, 0x0d, 0xfa, 0xec, 0xfa, 0xcb, 0xfa, 0x89, 0xfa, 0x68, 0xf9, 0xa7, 0xf8, 0xe5, 0xd8, 0xc3, 0xa9, 0xa6, 0x7a, 0x89, 0x6b, 0x2d, 0x7b, 0x4f, 0x6a, 0xed, 0x84, 0x31, 0xb5, 0xf7, 0xad, 0xb6, 0x84, 0x91, 0x7c, 0x50, 0x83, 0xae, 0x4a, 0x68, 0x7b, 0xee, 0xbc, 0xd3, 0xa1, 0xe8, 0xda, 0x49, 0xf3, 0x0c, 0xba, 0x4b, 0x72, 0xae, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x47, 0xfd, 0xa0, 0xfd, 0xc1, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xc1, 0xfd, 0xe0, 0xfe, 0x20, 0xfe, 0x40, 0xfe, 0x61, 0xfe, 0xc1, 0xe6, 0x23, 0xb3, 0x21, 0xc1, 0x41, 0xd9, 0x25, 0xd9, 0x46, 0xe9, 0x04, 0xe9, 0x44, 0xe9, 0x45, 0xe8, 0xe5, 0xe8, 0xe4, 0xe9, 0x24, 0xe9, 0x25, 0xe9, 0x25, 0xe9, 0x25, 0xe9, 0x25, 0xe9, 0x25, 0xe9, 0x25, 0xe1, 0x45, 0xe1, 0x45, 0xe1, 0x65, 0xe1, 0x65, 0xe1, 0x85, 0xe1, 0x86, 0xe1, 0xa6, 0xe1, 0xa6, 0xe1, 0xa6, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xc7, 0xe1, 0xc7, 0xe1, 0xe7, 0xe2, 0x08, 0xe9, 0xe8, 0xe2, 0x08, 0xe2, 0x08, 0xe2, 0x28, 0xe2, 0x29, 0xea, 0x49, 0xe2, 0x4a, 0xea, 0x49, 0xea, 0x28, 0xea, 0x28, 0xe1, 0xe7, 0xe1, 0x45, 0xd8, 0x83, 0xc8, 0x01, 0xa1, 0x25, 0x6a, 0x49, 0x5b, 0x4d, 0x6b, 0x8e, 0x63, 0x2c, 0x84, 0x0f, 0xb5, 0xd7, 0xa5, 0xb5, 0x84, 0x50, 0x94, 0x10, 0x73, 0x6d, 0x4a, 0xa9, 0x49, 0x24, 0xba, 0xab, 0xf3, 0x2e, 0xa2, 0x2c, 0x6b, 0x12, 0x5c, 0x18, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x47, 0xfd, 0xa1, 0xfd, 0xc1, 0xfd, 0xe1, 0xfd, 0xc1, 0xfd, 0xc1, 0xfd, 0xc1, 0xfd, 0xe0, 0xfe, 0x00, 0xfe, 0x20, 0xfe, 0x60, 0xfe, 0xc2, 0xcd, 0x03, 0xa9, 0x81, 0xe1, 0x64, 0xe1, 0xa5, 0xd9, 0x86, 0xe1, 0x65, 0xe1, 0x86, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0xa6, 0xd9, 0xa5, 0xe1, 0xa6, 0xe1, 0xa6, 0xe1, 0xa6, 0xe1, 0xa6, 0xe1, 0xa6, 0xd9, 0xc6, 0xe1, 0xa6, 0xe1, 0x87, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xd9, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa8, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xa7, 0xe1, 0xc8, 0xd9, 0xe8, 0xd9, 0xc7, 0xd9, 0xa7, 0xe1, 0xa8, 0xe1, 0xc8, 0xd1, 0xc7, 0xd9, 0x65, 0xb8, 0xc3, 0x69, 0x45, 0x52, 0x49, 0x6a, 0xec, 0x7b, 0x6d, 0x63, 0x4c, 0x73, 0xef, 0xb5, 0xf7, 0xa5, 0x54, 0x94, 0x11, 0x84, 0x10, 0x73, 0xcf, 0x62, 0xab, 0x82, 0x49, 0xa2, 0x4c, 0x6a, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x26, 0xfd, 0xa0, 0xfd, 0xc1, 0xfd, 0xe1, 0xfd, 0xc0, 0xfd, 0xc1, 0xfd, 0xc1, 0xfd, 0xc0, 0xfe, 0x00, 0xfe, 0x21, 0xfe, 0x61, 0xfe, 0x40, 0xbb, 0xa0, 0xc1, 0xc5, 0xfa, 0xcb, 0xfa, 0xcb, 0xfa, 0xec, 0xfa, 0xcc, 0xfa, 0xeb, 0xfb, 0x0c, 0xfb, 0x0c, 0xfb, 0x0c, 0xfb, 0x0c, 0xfb, 0x0c, 0xfb, 0x0c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x2c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb, 0x2c, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x4d, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0xae, 0xfb, 0x4b, 0xc1, 0x23, 0xaa, 0xab, 0x8c, 0x10, 0x5a, 0x29, 0x72, 0xcb, 0x6b, 0xad, 0x6b, 0x6d, 0x7b, 0xcf, 0xad, 0x95, 0xad, 0x96, 0x7c, 0x11, 0x7b, 0xd0, 0x7b, 0x6e, 0x5a, 0x6a, 0x5a, 0x29, 0x43, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x26, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfe, 0x00, 0xfe, 0x21, 0xfe, 0x81, 0xed, 0xe2, 0xb2, 0xe0, 0xda, 0x69, 0xfb, 0x2e, 0xfb, 0x0d, 0xfb, 0x2e, 0xfb, 0x2d, 0xfb, 0x4c, 0xfb, 0x6d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xae, 0xfb, 0xce, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xaf, 0xfb, 0xef, 0xfb, 0x2b, 0xb8, 0x40, 0xcc, 0xb2, 0xd6, 0x9a, 0x94, 0x92, 0x5a, 0x29, 0x62, 0xec, 0x73, 0x6e, 0x6b, 0x6d, 0x6b, 0xee, 0x9d, 0x75, 0xad, 0x76, 0x8c, 0x32, 0x7b, 0x8e, 0x6b, 0x8d, 0x42, 0xcb, 0x33, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x47, 0xfd, 0x80, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfe, 0x00, 0xfe, 0x20, 0xfe, 0x61, 0xdd, 0x62, 0xaa, 0x60, 0xea, 0xab, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6e, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xae, 0xfb, 0xaf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xaf, 0xfb, 0xcf, 0xfb, 0xce, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xd0, 0xfb, 0xd0, 0xf2, 0xaa, 0xb0, 0x80, 0xd5, 0xb5, 0xdf, 0x1c, 0xce, 0xba, 0xa5, 0x95, 0x52, 0x4a, 0x63, 0x2d, 0x6b, 0xae, 0x63, 0x6d, 0x73, 0xaf, 0xa5, 0x14, 0xad, 0x14, 0x8c, 0x2f, 0x73, 0xad, 0x73, 0xcf, 0x63, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x26, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc1, 0xfd, 0xa1, 0xfd, 0xc1, 0xfd, 0xc0, 0xfd, 0xc0, 0xfe, 0x01, 0xfe, 0x41, 0xfe, 0x82, 0xdd, 0x22, 0xb2, 0x41, 0xfb, 0x0d, 0xfb, 0x8f, 0xfb, 0xae, 0xfb, 0x8e, 0xfb, 0x6d, 0xfb, 0x8d, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0x8e, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xfc, 0x10, 0xfb, 0xf0, 0xea, 0x6a, 0xb8, 0xe5, 0xdd, 0xf7, 0xe7, 0x1c, 0xdf, 0x3c, 0xe7, 0x9d, 0xbd, 0xb7, 0x52, 0x09, 0x5a, 0xcb, 0x6b, 0x6e, 0x6b, 0x4e, 0x73, 0x6e, 0xa5, 0x13, 0xad, 0x33, 0x8c, 0x30, 0x8c, 0x53, 0x63, 0xb2, 0x43, 0xd6, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x46, 0xfd, 0x80, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfe, 0x01, 0xfe, 0x20, 0xfe, 0x62, 0xd5, 0x01, 0xba, 0x23, 0xfb, 0x2e, 0xfb, 0xaf, 0xfb, 0xce, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xae, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x10, 0xfc, 0x10, 0xfc, 0x10, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x10, 0xfc, 0x51, 0xfc, 0x0f, 0xea, 0x89, 0xc1, 0x05, 0xed, 0xf9, 0xef, 0x1e, 0xef, 0x5d, 0xff, 0x5d, 0xcc, 0xb3, 0x81, 0xc7, 0x71, 0xe8, 0x72, 0xec, 0x73, 0x6e, 0x63, 0x4c, 0x73, 0xad, 0x94, 0x92, 0x94, 0xb4, 0x63, 0xd3, 0x3b, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x46, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfe, 0x01, 0xfe, 0x41, 0xfe, 0x82, 0xd5, 0x01, 0xba, 0x22, 0xfa, 0xad, 0xfb, 0x2e, 0xf3, 0x4c, 0xfb, 0x0c, 0xfb, 0x0d, 0xfb, 0x0d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x0d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x2d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x4d, 0xfb, 0x4d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x8e, 0xfb, 0x6d, 0xfb, 0x6d, 0xfb, 0x8e, 0xfb, 0x6d, 0xfb, 0x8e, 0xfb, 0x6d, 0xea, 0x48, 0xc9, 0x26, 0xed, 0xf8, 0xf7, 0xbf, 0xf7, 0x5d, 0xd4, 0x92, 0xb9, 0x46, 0xd2, 0x8a, 0xaa, 0x28, 0x61, 0xc7, 0x5a, 0xeb, 0x6b, 0x8c, 0x73, 0xad, 0x84, 0x11, 0x73, 0xf3, 0x43, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x26, 0xfd, 0xa0, 0xfd, 0xa1, 0xfd, 0xc1, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xe1, 0xfe, 0x21, 0xfe, 0xa1, 0xdd, 0x41, 0xba, 0x21, 0xe9, 0x28, 0xe1, 0x88, 0xd9, 0xa5, 0xf1, 0x66, 0xf1, 0x67, 0xf1, 0x47, 0xe9, 0x66, 0xe9, 0x66, 0xe9, 0x66, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xe9, 0x67, 0xf1, 0x67, 0xf1, 0x67, 0xf1, 0x67, 0xf1, 0x67, 0xf1, 0x67, 0xf1, 0x67, 0xe9, 0x87, 0xe9, 0x86, 0xe9, 0x87, 0xe9, 0x87, 0xe9, 0x86, 0xe9, 0x86, 0xe9, 0x87, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa7, 0xf1, 0xa7, 0xf1, 0xa7, 0xe9, 0xa7, 0xe9, 0xc7, 0xe9, 0xe6, 0xf1, 0xe7, 0xd9, 0xa8, 0xed, 0x76, 0xff, 0x3c, 0xc4, 0xb2, 0xb9, 0x46, 0xe2, 0x49, 0xd2, 0x6a, 0x92, 0x0a, 0x52, 0xcf, 0x3a, 0xee, 0x5b, 0x0d, 0x73, 0xd1, 0x6b, 0xd4, 0x53, 0xb4, 0x44, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x06, 0xfd, 0xa0, 0xfd, 0x82, 0xfd, 0xa2, 0xfd, 0xa1, 0xfd, 0xc1, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xe1, 0xfe, 0x21, 0xfe, 0xa0, 0xe5, 0xa1, 0xca, 0x61, 0xe8, 0xc6, 0xe9, 0x47, 0xe9, 0x85, 0xf1, 0x64, 0xf1, 0x45, 0xf1, 0x45, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x66, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x65, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf1, 0x66, 0xf9, 0x66, 0xf9, 0x66, 0xf9, 0x66, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x66, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x66, 0xf9, 0x86, 0xf1, 0x86, 0xf1, 0x85, 0xf1, 0xc5, 0xfa, 0x08, 0xd9, 0xa9, 0xd3, 0x6e, 0xe3, 0xcf, 0xd9, 0x45, 0xe9, 0xc7, 0xd1, 0xe7, 0x89, 0xab, 0x52, 0xf3, 0x4b, 0xb4, 0x33, 0x32, 0x4b, 0x74, 0x53, 0x95, 0x43, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x49, 0xf6, 0x07, 0xfd, 0xc1, 0xfd, 0xc2, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0xc0, 0xfe, 0x01, 0xfe, 0x41, 0xfe, 0x80, 0xfe, 0x02, 0xcb, 0x00, 0xd9, 0x04, 0xf9, 0x67, 0xf9, 0x45, 0xf1, 0x65, 0xf1, 0x67, 0xf1, 0x67, 0xf1, 0x86, 0xe9, 0xa5, 0xe9, 0xa5, 0xf1, 0x85, 0xf1, 0xa5, 0xf1, 0x85, 0xf1, 0x85, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xa6, 0xf1, 0xa6, 0xf1, 0xa6, 0xf1, 0xa5, 0xf1, 0xa6, 0xf1, 0xa6, 0xf1, 0xa6, 0xf1, 0xa6, 0xf1, 0xa5, 0xf1, 0xa6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf1, 0xc6, 0xf9, 0xc6, 0xf9, 0xa6, 0xf9, 0xa6, 0xf9, 0x86, 0xf9, 0xea, 0xe1, 0xa9, 0xc9, 0x86, 0xd8, 0xc0, 0xf1, 0x64, 0xc9, 0x87, 0x79, 0x6b, 0x53, 0x15, 0x3b, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x99, 0x53, 0x56, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6e, 0xbd, 0x07, 0xf6, 0x43, 0xfe, 0x21, 0xfd, 0xe0, 0xfd, 0xa0, 0xfd, 0x81, 0xfd, 0x81, 0xfd, 0xc2, 0xfe, 0x40, 0xfe, 0xe0, 0xfe, 0xc2, 0xd4, 0x82, 0xc1, 0xe3, 0xe9, 0xc6, 0xf1, 0x86, 0xf1, 0x86, 0xe9, 0x87, 0xf1, 0x68, 0xf1, 0x87, 0xf1, 0xa6, 0xf1, 0x86, 0xf9, 0x67, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0x86, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa8, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xc7, 0xf9, 0xa7, 0xf9, 0xa7, 0xfa, 0x29, 0xfa, 0x08, 0xd8, 0xc2, 0xc8, 0xc0, 0xb1, 0x23, 0x69, 0x8a, 0x4a, 0xf4, 0x43, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x13, 0x73, 0xab, 0xc5, 0x44, 0xe5, 0xe6, 0xfe, 0x04, 0xfd, 0xc2, 0xfd, 0xa0, 0xfd, 0xc0, 0xfe, 0x20, 0xfe, 0xa1, 0xfe, 0xc0, 0xff, 0x04, 0xf5, 0xe7, 0xba, 0xa2, 0xe1, 0xa4, 0xf9, 0xa6, 0xf9, 0xe6, 0xf1, 0xe7, 0xf9, 0xc7, 0xf9, 0xc7, 0xf9, 0xe7, 0xf9, 0xc8, 0xf9, 0xa9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xfa, 0x09, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xf9, 0xe9, 0xfa, 0x09, 0xfa, 0x09, 0xfa, 0x29, 0xfa, 0x29, 0xfa, 0x29, 0xfa, 0x69, 0xfa, 0x48, 0xe1, 0x44, 0xb0, 0xc2, 0x71, 0xca, 0x4a, 0xd2, 0x53, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x18, 0x3b, 0x34, 0x4a, 0xcc, 0x8b, 0xeb, 0xbc, 0xe8, 0xd5, 0x66, 0xe5, 0xa5, 0xe5, 0xc3, 0xed, 0xe4, 0xed, 0xc6, 0xdd, 0xe5, 0xcd, 0xc6, 0xac, 0xc7, 0x7a, 0x67, 0x99, 0x88, 0xb9, 0xa9, 0xa9, 0xe9, 0xa1, 0xe9, 0xa9, 0xe9, 0xb1, 0xc8, 0xa9, 0xe8, 0xb1, 0xe9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xc9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xe9, 0xb1, 0xea, 0xb1, 0xea, 0xb1, 0xea, 0xa9, 0xe9, 0xb2, 0x09, 0xb2, 0x2b, 0x7a, 0x2d, 0x42, 0xf2, 0x3b, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xb8, 0x22, 0x6f, 0x0a, 0xd4, 0x2b, 0x13, 0x53, 0x6e, 0x6b, 0xac, 0x6b, 0xad, 0x73, 0xce, 0x73, 0x6c, 0x5b, 0x4d, 0x33, 0x30, 0x03, 0x13, 0x02, 0x4d, 0x19, 0xcc, 0x41, 0xab, 0x29, 0xab, 0x01, 0xab, 0x19, 0xab, 0x29, 0xaa, 0x19, 0xaa, 0x11, 0xab, 0x19, 0xaa, 0x29, 0xaa, 0x29, 0xaa, 0x29, 0xaa, 0x29, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x29, 0xaa, 0x29, 0xaa, 0x29, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x11, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x11, 0xaa, 0x01, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x29, 0xaa, 0x29, 0xab, 0x19, 0xaa, 0x01, 0xaa, 0x52, 0x0d, 0x42, 0x72, 0x33, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x03, 0x56, 0x02, 0xb2, 0x01, 0xce, 0x00, 0x0e, 0x03, 0x56, 0x23, 0xd7, 0x03, 0x96, 0x01, 0x70, 0x03, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x8e, 0x71, 0xff, 0x71, 0xaa, 0xaa, 0xff, 0x39, 0xc6, 0xe3, 0xff, 0x39, 0xc6, 0xc6, 0xff, 0x71, 0xc6, 0xaa, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x80, 0x40, 0xff, 0xcd, 0x91, 0x4a, 0xff, 0xa3, 0xa2, 0x71, 0xff, 0x8b, 0xa0, 0x81, 0xff, 0xa4, 0x9e, 0x78, 0xff, 0xb9, 0xa2, 0x74, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xb6, 0x86, 0x55, 0xff, 0x8b, 0xa7, 0x8d, 0xff, 0x52, 0xc4, 0xcd, 0xff, 0x34, 0xc4, 0xed, 0xff, 0x33, 0xd6, 0xea, 0xff, 0x6f, 0xce, 0xc3, 0xff, 0x00, 0x99, 0x66, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x40, 0x00, 0xff, 0x85, 0xa3, 0x8d, 0xff, 0x46, 0xcb, 0xd1, 0xff, 0x30, 0xd5, 0xe7, 0xff, 0x6f, 0xcc, 0xd1, 0xff, 0x8b, 0xd1, 0xb9, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x89, 0x96, 0x4e, 0xff, 0x87, 0xaa, 0x92, 0xff, 0x3c, 0xc9, 0xd8, 0xff, 0x00, 0xda, 0xfb, 0xff, 0x00, 0xd3, 0xff, 0xff, 0x27, 0xd0, 0xf0, 0xff, 0x7c, 0xd5, 0xdd, 0xff, 0xd1, 0xe8, 0xdf, 0xff, 0xf7, 0xea, 0xd6, 0xff, 0xeb, 0xdf, 0xc3, 0xff, 0xf3, 0xdf, 0xcb, 0xff, 0xf7, 0xe3, 0xcf, 0xff, 0xf7, 0xeb, 0xc7, 0xff, 0xff, 0xe3, 0xc7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0x4d, 0xb7, 0xcb, 0xff, 0x3c, 0xc8, 0xdb, 0xff, 0x18, 0xda, 0xfe, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x4c, 0xcc, 0xec, 0xff, 0x5d, 0xd1, 0xd1, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x9e, 0x87, 0x51, 0xff, 0x71, 0xb3, 0x92, 0xff, 0x1f, 0xd1, 0xde, 0xff, 0x00, 0xca, 0xf5, 0xff, 0x14, 0xd8, 0xfc, 0xff, 0x3c, 0xd0, 0xe1, 0xff, 0x88, 0xc6, 0xcf, 0xff, 0xd1, 0xeb, 0xeb, 0xff, 0xf0, 0xf4, 0xf5, 0xff, 0xf4, 0xef, 0xef, 0xff, 0xf7, 0xf5, 0xed, 0xff, 0xfa, 0xf2, 0xe7, 0xff, 0xf7, 0xf5, 0xe4, 0xff, 0xf5, 0xf8, 0xe5, 0xff, 0xe3, 0xef, 0xeb, 0xff, 0x95, 0xce, 0xde, 0xff, 0x2c, 0xcc, 0xeb, 0xff, 0x03, 0xd6, 0xfe, 0xff, 0x1c, 0xd1, 0xfc, 0xff, 0x03, 0xba, 0xfb, 0xff, 0x4f, 0xc2, 0xe8, 0xff, 0x55, 0xc6, 0xe3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x90, 0x85, 0x69, 0xff, 0x77, 0xaa, 0xa6, 0xff, 0x3a, 0xcd, 0xe8, 0xff, 0x00, 0xca, 0xfd, 0xff, 0x00, 0xd0, 0xfd, 0xff, 0x33, 0xcc, 0xe6, 0xff, 0x90, 0xca, 0xc8, 0xff, 0xde, 0xed, 0xe0, 0xff, 0xf5, 0xfe, 0xf2, 0xff, 0xfe, 0xeb, 0xf7, 0xff, 0xf0, 0xe1, 0xf8, 0xff, 0xef, 0xf5, 0xfe, 0xff, 0xfb, 0xf6, 0xee, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xe3, 0xed, 0xfb, 0xff, 0x89, 0xcf, 0xf1, 0xff, 0x1c, 0xc9, 0xf4, 0xff, 0x06, 0xd2, 0xff, 0xff, 0x15, 0xd1, 0xfd, 0xff, 0x06, 0xb8, 0xf4, 0xff, 0x00, 0xaf, 0xfc, 0xff, 0x53, 0xc3, 0xf2, 0xff, 0xb0, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x8e, 0x88, 0x64, 0xff, 0x6a, 0xad, 0xb5, 0xff, 0x30, 0xc5, 0xf0, 0xff, 0x09, 0xc3, 0xfc, 0xff, 0x14, 0xd2, 0xfe, 0xff, 0x2f, 0xc6, 0xea, 0xff, 0x81, 0xc7, 0xd9, 0xff, 0xdb, 0xe9, 0xee, 0xff, 0xf8, 0xf5, 0xf3, 0xff, 0xeb, 0xf1, 0xeb, 0xff, 0xf5, 0xf4, 0xf8, 0xff, 0xf8, 0xf5, 0xfb, 0xff, 0xeb, 0xf0, 0xec, 0xff, 0xf4, 0xf9, 0xea, 0xff, 0xdf, 0xf8, 0xef, 0xff, 0x8d, 0xd8, 0xed, 0xff, 0x21, 0xc7, 0xf0, 0xff, 0x00, 0xcf, 0xf9, 0xff, 0x13, 0xd2, 0xff, 0xff, 0x0d, 0xc6, 0xfa, 0xff, 0x00, 0xb6, 0xf7, 0xff, 0x00, 0xb0, 0xff, 0xff, 0x4f, 0xbd, 0xf2, 0xff, 0xb1, 0x99, 0x92, 0xff, 0xd8, 0x76, 0x3b, 0xff, 0xc6, 0x8e, 0x1c, 0xff, 0xc6, 0x71, 0x1c, 0xff, 0xc6, 0x71, 0x39, 0xff, 0xc6, 0x8e, 0x39, 0xff, 0xc6, 0x8e, 0x39, 0xff, 0xe3, 0x8e, 0x39, 0xff, 0xdf, 0x80, 0x40, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x95, 0x95, 0x6a, 0xff, 0x75, 0xa9, 0xaa, 0xff, 0x27, 0xc7, 0xf0, 0xff, 0x06, 0xc9, 0xff, 0xff, 0x00, 0xd7, 0xf3, 0xff, 0x2b, 0xd1, 0xdf, 0xff, 0x98, 0xc3, 0xd4, 0xff, 0xe1, 0xe2, 0xed, 0xff, 0xf1, 0xf0, 0xf3, 0xff, 0xf4, 0xe4, 0xf0, 0xff, 0xfb, 0xee, 0xf6, 0xff, 0xdd, 0xf7, 0xef, 0xff, 0xe3, 0xf6, 0xe8, 0xff, 0xf7, 0xf6, 0xf2, 0xff, 0xe1, 0xf8, 0xfa, 0xff, 0x8e, 0xdd, 0xeb, 0xff, 0x09, 0xc8, 0xe6, 0xff, 0x00, 0xda, 0xfd, 0xff, 0x10, 0xdd, 0xff, 0xff, 0x11, 0xce, 0xf3, 0xff, 0x08, 0xb4, 0xe9, 0xff, 0x0c, 0xab, 0xe9, 0xff, 0x07, 0xa7, 0xe3, 0xff, 0x47, 0xb1, 0xd2, 0xff, 0x99, 0x99, 0x87, 0xff, 0xcc, 0x8f, 0x54, 0xff, 0xd3, 0x9b, 0x48, 0xff, 0xdd, 0x97, 0x48, 0xff, 0xcf, 0x93, 0x52, 0xff, 0xc7, 0x92, 0x51, 0xff, 0xcb, 0x8e, 0x4b, 0xff, 0xd0, 0x8c, 0x44, 0xff, 0xd6, 0x8b, 0x3f, 0xff, 0xc9, 0x86, 0x36, 0xff, 0xdb, 0x86, 0x3d, 0xff, 0xff, 0x80, 0x40, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x8f, 0x9a, 0x68, 0xff, 0x68, 0xb2, 0x9f, 0xff, 0x1c, 0xc6, 0xea, 0xff, 0x08, 0xca, 0xfa, 0xff, 0x1e, 0xd6, 0xf7, 0xff, 0x20, 0xd2, 0xd2, 0xff, 0x85, 0xc8, 0xc5, 0xff, 0xe8, 0xe0, 0xe7, 0xff, 0xfb, 0xee, 0xee, 0xff, 0xe2, 0xec, 0xe3, 0xff, 0xdf, 0xef, 0xee, 0xff, 0xef, 0xef, 0xf1, 0xff, 0xf1, 0xf2, 0xef, 0xff, 0xf9, 0xed, 0xf0, 0xff, 0xf0, 0xf2, 0xff, 0xff, 0x9f, 0xda, 0xf1, 0xff, 0x3c, 0xc6, 0xea, 0xff, 0x21, 0xd4, 0xfa, 0xff, 0x1f, 0xd3, 0xfb, 0xff, 0x17, 0xc6, 0xe7, 0xff, 0x00, 0xaa, 0xc9, 0xff, 0x1c, 0x99, 0xc6, 0xff, 0x40, 0x97, 0xc3, 0xff, 0x49, 0xa4, 0xbc, 0xff, 0x67, 0xbb, 0xba, 0xff, 0xa9, 0xb7, 0x91, 0xff, 0xd1, 0xb7, 0x78, 0xff, 0xde, 0xc2, 0x6d, 0xff, 0xec, 0xba, 0x6c, 0xff, 0xdb, 0xb3, 0x76, 0xff, 0xd3, 0xb2, 0x75, 0xff, 0xd5, 0xae, 0x70, 0xff, 0xd7, 0xa8, 0x69, 0xff, 0xd7, 0xa1, 0x60, 0xff, 0xd5, 0x97, 0x52, 0xff, 0xd3, 0x8e, 0x45, 0xff, 0xd0, 0x89, 0x40, 0xff, 0xcf, 0x86, 0x41, 0xff, 0xdc, 0x89, 0x43, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x8f, 0x99, 0x72, 0xff, 0x61, 0xb1, 0xaf, 0xff, 0x07, 0xca, 0xec, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x15, 0xd1, 0xf6, 0xff, 0x43, 0xc6, 0xd4, 0xff, 0x9b, 0xc7, 0xce, 0xff, 0xe2, 0xdf, 0xf0, 0xff, 0xf0, 0xe4, 0xec, 0xff, 0xe6, 0xe9, 0xe5, 0xff, 0xd9, 0xed, 0xe9, 0xff, 0xdb, 0xef, 0xe3, 0xff, 0xe9, 0xed, 0xe4, 0xff, 0xf8, 0xea, 0xee, 0xff, 0xed, 0xe9, 0xfb, 0xff, 0xa8, 0xde, 0xed, 0xff, 0x3f, 0xd0, 0xdf, 0xff, 0x21, 0xd0, 0xeb, 0xff, 0x23, 0xc6, 0xe5, 0xff, 0x2c, 0xb3, 0xd5, 0xff, 0x32, 0x9f, 0xbb, 0xff, 0x43, 0xac, 0xbb, 0xff, 0x5e, 0xc0, 0xc6, 0xff, 0x71, 0xcb, 0xd4, 0xff, 0x70, 0xcd, 0xdc, 0xff, 0x94, 0xdb, 0xd4, 0xff, 0xce, 0xc7, 0xa6, 0xff, 0xe9, 0xb9, 0x88, 0xff, 0xec, 0xc2, 0x7b, 0xff, 0xee, 0xbc, 0x7c, 0xff, 0xe0, 0xb9, 0x81, 0xff, 0xe4, 0xbd, 0x79, 0xff, 0xe4, 0xbc, 0x79, 0xff, 0xe6, 0xbc, 0x7b, 0xff, 0xe6, 0xbc, 0x7c, 0xff, 0xe3, 0xb7, 0x79, 0xff, 0xdb, 0xaf, 0x73, 0xff, 0xd4, 0xa5, 0x66, 0xff, 0xcc, 0x95, 0x52, 0xff, 0xca, 0x87, 0x42, 0xff, 0xd0, 0x84, 0x3d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x92, 0x97, 0x75, 0xff, 0x61, 0xad, 0xc9, 0xff, 0x16, 0xbd, 0xf9, 0xff, 0x00, 0xcd, 0xfe, 0xff, 0x21, 0xd7, 0xf5, 0xff, 0x4e, 0xbd, 0xd1, 0xff, 0x92, 0xc5, 0xca, 0xff, 0xc9, 0xe4, 0xe6, 0xff, 0xdd, 0xe2, 0xe9, 0xff, 0xee, 0xe6, 0xeb, 0xff, 0xef, 0xe3, 0xe2, 0xff, 0xe9, 0xe9, 0xe3, 0xff, 0xdc, 0xea, 0xe7, 0xff, 0xe8, 0xeb, 0xf0, 0xff, 0xe5, 0xeb, 0xf7, 0xff, 0xad, 0xe5, 0xf4, 0xff, 0x42, 0xc8, 0xd5, 0xff, 0x1f, 0xc6, 0xd6, 0xff, 0x29, 0xb5, 0xc9, 0xff, 0x41, 0xae, 0xbc, 0xff, 0x61, 0xb6, 0xc3, 0xff, 0x73, 0xc3, 0xd8, 0xff, 0x78, 0xcc, 0xe3, 0xff, 0x7d, 0xd0, 0xe4, 0xff, 0x7d, 0xd0, 0xdf, 0xff, 0x71, 0xd0, 0xe0, 0xff, 0x93, 0xd6, 0xda, 0xff, 0xcb, 0xc3, 0xab, 0xff, 0xe9, 0xbc, 0x8a, 0xff, 0xf1, 0xc1, 0x8a, 0xff, 0xf2, 0xc3, 0x8e, 0xff, 0xee, 0xc2, 0x8a, 0xff, 0xec, 0xc0, 0x82, 0xff, 0xe8, 0xbb, 0x81, 0xff, 0xe8, 0xbc, 0x82, 0xff, 0xe4, 0xb8, 0x7e, 0xff, 0xe1, 0xb6, 0x7c, 0xff, 0xe5, 0xbc, 0x81, 0xff, 0xe6, 0xbd, 0x80, 0xff, 0xdf, 0xb6, 0x76, 0xff, 0xd4, 0xa7, 0x68, 0xff, 0xc6, 0x94, 0x53, 0xff, 0xbf, 0x89, 0x41, 0xff, 0xd1, 0x88, 0x3e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x88, 0x9a, 0x73, 0xff, 0x66, 0xb6, 0xc6, 0xff, 0x1f, 0xbc, 0xf8, 0xff, 0x00, 0xc5, 0xfe, 0xff, 0x10, 0xd2, 0xf1, 0xff, 0x3c, 0xc0, 0xd0, 0xff, 0x98, 0xc2, 0xcf, 0xff, 0xd5, 0xdf, 0xe3, 0xff, 0xd8, 0xe4, 0xe3, 0xff, 0xd4, 0xdf, 0xde, 0xff, 0xe6, 0xe2, 0xe0, 0xff, 0xed, 0xe2, 0xde, 0xff, 0xe8, 0xe4, 0xe3, 0xff, 0xe5, 0xe2, 0xea, 0xff, 0xe5, 0xe4, 0xf4, 0xff, 0xb2, 0xe3, 0xef, 0xff, 0x40, 0xc5, 0xca, 0xff, 0x1d, 0xbb, 0xc6, 0xff, 0x2e, 0xae, 0xbf, 0xff, 0x47, 0xc2, 0xca, 0xff, 0x78, 0xd3, 0xd9, 0xff, 0x92, 0xd4, 0xdc, 0xff, 0x90, 0xcc, 0xdd, 0xff, 0x87, 0xca, 0xe1, 0xff, 0x81, 0xc4, 0xdd, 0xff, 0x7c, 0xbf, 0xd4, 0xff, 0x6d, 0xbd, 0xcf, 0xff, 0x7d, 0xba, 0xc2, 0xff, 0xaa, 0xa5, 0x90, 0xff, 0xc3, 0xa0, 0x6e, 0xff, 0xc6, 0xa3, 0x6f, 0xff, 0xc3, 0xa2, 0x71, 0xff, 0xc9, 0xa2, 0x6e, 0xff, 0xd7, 0xa8, 0x72, 0xff, 0xde, 0xaf, 0x7c, 0xff, 0xe4, 0xb8, 0x84, 0xff, 0xe8, 0xbc, 0x88, 0xff, 0xeb, 0xc0, 0x89, 0xff, 0xe5, 0xbb, 0x82, 0xff, 0xdf, 0xb4, 0x79, 0xff, 0xe4, 0xb8, 0x79, 0xff, 0xe4, 0xb8, 0x79, 0xff, 0xdd, 0xb3, 0x74, 0xff, 0xd3, 0xa6, 0x64, 0xff, 0xce, 0x90, 0x4a, 0xff, 0xd1, 0x83, 0x3a, 0xff, 0xd5, 0x80, 0x2a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x83, 0x9c, 0x83, 0xff, 0x54, 0xb7, 0xca, 0xff, 0x04, 0xc1, 0xfc, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x17, 0xd0, 0xf4, 0xff, 0x4e, 0xc0, 0xd4, 0xff, 0x9a, 0xc2, 0xc9, 0xff, 0xd3, 0xd9, 0xde, 0xff, 0xe6, 0xdd, 0xdf, 0xff, 0xe7, 0xde, 0xdd, 0xff, 0xe7, 0xdc, 0xd9, 0xff, 0xe1, 0xdc, 0xd5, 0xff, 0xe4, 0xe5, 0xdd, 0xff, 0xe4, 0xdc, 0xe2, 0xff, 0xe8, 0xe5, 0xf4, 0xff, 0xc0, 0xdc, 0xec, 0xff, 0x5e, 0xba, 0xc3, 0xff, 0x21, 0xb1, 0xb3, 0xff, 0x4b, 0xb6, 0xc0, 0xff, 0x6e, 0xd1, 0xdc, 0xff, 0x72, 0xdd, 0xe2, 0xff, 0x7c, 0xd6, 0xd7, 0xff, 0x83, 0xcf, 0xd0, 0xff, 0x80, 0xc5, 0xcc, 0xff, 0x77, 0xb7, 0xc7, 0xff, 0x76, 0xaa, 0xc0, 0xff, 0x6b, 0xa3, 0xba, 0xff, 0x4f, 0xa8, 0xbb, 0xff, 0x71, 0xb4, 0xbf, 0xff, 0xa5, 0xa9, 0x9a, 0xff, 0xbd, 0xa1, 0x7a, 0xff, 0xbe, 0x9c, 0x76, 0xff, 0xc1, 0x9a, 0x78, 0xff, 0xc4, 0x9b, 0x74, 0xff, 0xc5, 0x96, 0x6d, 0xff, 0xbe, 0x8f, 0x67, 0xff, 0xb9, 0x8a, 0x5e, 0xff, 0xba, 0x8f, 0x5f, 0xff, 0xcf, 0xa4, 0x72, 0xff, 0xe0, 0xb7, 0x82, 0xff, 0xe8, 0xbe, 0x84, 0xff, 0xe8, 0xbd, 0x7e, 0xff, 0xe7, 0xbb, 0x7e, 0xff, 0xe7, 0xbd, 0x81, 0xff, 0xe1, 0xbb, 0x7d, 0xff, 0xd9, 0xb0, 0x71, 0xff, 0xc2, 0x93, 0x52, 0xff, 0xc4, 0x82, 0x3c, 0xff, 0xd7, 0x8a, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xc1, 0x8c, 0x52, 0xff, 0x84, 0x9d, 0x91, 0xff, 0x63, 0xb3, 0xce, 0xff, 0x10, 0xc1, 0xf8, 0xff, 0x00, 0xcc, 0xf9, 0xff, 0x00, 0xd8, 0xf5, 0xff, 0x51, 0xbe, 0xd4, 0xff, 0xac, 0xba, 0xc8, 0xff, 0xdc, 0xd6, 0xd6, 0xff, 0xdd, 0xde, 0xde, 0xff, 0xd3, 0xda, 0xd9, 0xff, 0xe2, 0xdc, 0xdb, 0xff, 0xf3, 0xd9, 0xdb, 0xff, 0xec, 0xdc, 0xdb, 0xff, 0xdb, 0xdc, 0xd9, 0xff, 0xe6, 0xe8, 0xed, 0xff, 0xbb, 0xdc, 0xe6, 0xff, 0x5c, 0xb7, 0xbe, 0xff, 0x36, 0xac, 0xad, 0xff, 0x69, 0xbc, 0xbf, 0xff, 0x89, 0xdb, 0xde, 0xff, 0x81, 0xd7, 0xdf, 0xff, 0x80, 0xcb, 0xdb, 0xff, 0x79, 0xc7, 0xcf, 0xff, 0x6d, 0xbf, 0xc2, 0xff, 0x62, 0xb7, 0xb8, 0xff, 0x71, 0xb6, 0xbf, 0xff, 0x95, 0xc4, 0xd4, 0xff, 0x9f, 0xd2, 0xe6, 0xff, 0x84, 0xda, 0xf2, 0xff, 0x9d, 0xe1, 0xf3, 0xff, 0xd4, 0xdb, 0xd0, 0xff, 0xed, 0xd8, 0xb5, 0xff, 0xec, 0xd3, 0xb0, 0xff, 0xe8, 0xcd, 0xad, 0xff, 0xed, 0xca, 0xa8, 0xff, 0xf3, 0xc3, 0x9f, 0xff, 0xe8, 0xbb, 0x96, 0xff, 0xe1, 0xb4, 0x8d, 0xff, 0xd0, 0xa3, 0x7a, 0xff, 0xbe, 0x91, 0x64, 0xff, 0xb7, 0x8b, 0x59, 0xff, 0xc3, 0x9a, 0x62, 0xff, 0xdd, 0xb3, 0x77, 0xff, 0xe9, 0xbd, 0x82, 0xff, 0xe2, 0xb5, 0x7d, 0xff, 0xe3, 0xb8, 0x7e, 0xff, 0xe0, 0xb8, 0x7d, 0xff, 0xd8, 0xb4, 0x78, 0xff, 0xcb, 0xa0, 0x64, 0xff, 0xc4, 0x85, 0x42, 0xff, 0xd0, 0x8d, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x86, 0x58, 0xff, 0x9a, 0x96, 0x89, 0xff, 0x53, 0xae, 0xdb, 0xff, 0x16, 0xba, 0xf7, 0xff, 0x00, 0xcc, 0xf0, 0xff, 0x17, 0xe0, 0xea, 0xff, 0x42, 0xc3, 0xd4, 0xff, 0x9e, 0xba, 0xc3, 0xff, 0xdd, 0xdd, 0xd1, 0xff, 0xdd, 0xdb, 0xd7, 0xff, 0xd9, 0xd7, 0xd7, 0xff, 0xd2, 0xde, 0xdd, 0xff, 0xd0, 0xdd, 0xdb, 0xff, 0xde, 0xd8, 0xda, 0xff, 0xe6, 0xd8, 0xe2, 0xff, 0xe5, 0xe2, 0xec, 0xff, 0xc1, 0xde, 0xe2, 0xff, 0x64, 0xb9, 0xba, 0xff, 0x1a, 0xa6, 0xa2, 0xff, 0x61, 0xcf, 0xc8, 0xff, 0x83, 0xe5, 0xdf, 0xff, 0x83, 0xe0, 0xdb, 0xff, 0x81, 0xce, 0xd4, 0xff, 0x8b, 0xb9, 0xd1, 0xff, 0x87, 0xaf, 0xc3, 0xff, 0x99, 0xb9, 0xc5, 0xff, 0xb8, 0xd8, 0xdf, 0xff, 0xc4, 0xf0, 0xf2, 0xff, 0xba, 0xf0, 0xfc, 0xff, 0xa0, 0xe8, 0xfd, 0xff, 0x6e, 0xde, 0xf9, 0xff, 0x86, 0xdb, 0xf0, 0xff, 0xc3, 0xd0, 0xcd, 0xff, 0xe9, 0xd2, 0xb6, 0xff, 0xf0, 0xd0, 0xb2, 0xff, 0xed, 0xc9, 0xae, 0xff, 0xea, 0xc5, 0xa5, 0xff, 0xeb, 0xc1, 0x9f, 0xff, 0xec, 0xc1, 0x9d, 0xff, 0xee, 0xc1, 0x9b, 0xff, 0xeb, 0xbd, 0x93, 0xff, 0xe6, 0xb6, 0x88, 0xff, 0xd9, 0xa9, 0x78, 0xff, 0xc2, 0x94, 0x5f, 0xff, 0xb4, 0x87, 0x4e, 0xff, 0xca, 0x9c, 0x65, 0xff, 0xe8, 0xb6, 0x7e, 0xff, 0xeb, 0xb7, 0x7f, 0xff, 0xe6, 0xb3, 0x7c, 0xff, 0xe1, 0xb7, 0x7e, 0xff, 0xdf, 0xb8, 0x7b, 0xff, 0xc8, 0xa0, 0x5f, 0xff, 0xbc, 0x86, 0x3e, 0xff, 0xd4, 0x8c, 0x40, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x9d, 0x92, 0x81, 0xff, 0x4f, 0xb1, 0xcd, 0xff, 0x0a, 0xb4, 0xff, 0xff, 0x00, 0xc1, 0xfc, 0xff, 0x00, 0xda, 0xf2, 0xff, 0x3a, 0xc7, 0xce, 0xff, 0xaa, 0xb7, 0xca, 0xff, 0xe5, 0xdb, 0xda, 0xff, 0xc5, 0xe0, 0xc6, 0xff, 0xce, 0xdb, 0xd5, 0xff, 0xdf, 0xd5, 0xd7, 0xff, 0xd8, 0xd5, 0xd6, 0xff, 0xd0, 0xdd, 0xd9, 0xff, 0xce, 0xdb, 0xda, 0xff, 0xcc, 0xd8, 0xe7, 0xff, 0xc1, 0xdc, 0xed, 0xff, 0x72, 0xba, 0xc0, 0xff, 0x2e, 0xa7, 0xa8, 0xff, 0x68, 0xca, 0xc6, 0xff, 0x89, 0xe6, 0xe0, 0xff, 0x7a, 0xe5, 0xdc, 0xff, 0x72, 0xcc, 0xc9, 0xff, 0x83, 0xba, 0xc1, 0xff, 0x91, 0xb3, 0xbf, 0xff, 0xc1, 0xce, 0xdd, 0xff, 0xeb, 0xea, 0xf7, 0xff, 0xf1, 0xf6, 0xfe, 0xff, 0xcf, 0xf2, 0xfa, 0xff, 0xa5, 0xe9, 0xfb, 0xff, 0x83, 0xe1, 0xfd, 0xff, 0x60, 0xd9, 0xfb, 0xff, 0x81, 0xd9, 0xf5, 0xff, 0xc6, 0xd1, 0xd4, 0xff, 0xec, 0xd2, 0xbb, 0xff, 0xee, 0xd1, 0xb4, 0xff, 0xee, 0xd2, 0xb5, 0xff, 0xee, 0xd2, 0xad, 0xff, 0xf0, 0xcc, 0xa4, 0xff, 0xef, 0xc8, 0xa1, 0xff, 0xed, 0xc1, 0x99, 0xff, 0xeb, 0xbc, 0x90, 0xff, 0xef, 0xbd, 0x8c, 0xff, 0xea, 0xb5, 0x82, 0xff, 0xe4, 0xac, 0x78, 0xff, 0xd8, 0xa0, 0x6d, 0xff, 0xb8, 0x87, 0x50, 0xff, 0xbe, 0x8a, 0x53, 0xff, 0xe6, 0xad, 0x76, 0xff, 0xef, 0xb8, 0x80, 0xff, 0xe0, 0xb3, 0x79, 0xff, 0xde, 0xb9, 0x7b, 0xff, 0xdf, 0xbb, 0x79, 0xff, 0xc8, 0x9a, 0x58, 0xff, 0xc8, 0x86, 0x40, 0xff, 0xdd, 0x8d, 0x46, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x77, 0xa8, 0xb2, 0xff, 0x26, 0xca, 0xf3, 0xff, 0x01, 0xbb, 0xf9, 0xff, 0x07, 0xbd, 0xf7, 0xff, 0x03, 0xc7, 0xf1, 0xff, 0x6f, 0xc4, 0xdc, 0xff, 0xd9, 0xce, 0xd7, 0xff, 0xe8, 0xd7, 0xd2, 0xff, 0xce, 0xd9, 0xcd, 0xff, 0xce, 0xdb, 0xd2, 0xff, 0xde, 0xd7, 0xd6, 0xff, 0xe6, 0xd6, 0xd8, 0xff, 0xe0, 0xd8, 0xd8, 0xff, 0xd1, 0xdb, 0xdf, 0xff, 0xb6, 0xdf, 0xec, 0xff, 0x6b, 0xb9, 0xca, 0xff, 0x32, 0xa2, 0xaa, 0xff, 0x62, 0xc3, 0xc8, 0xff, 0x8f, 0xe0, 0xe0, 0xff, 0x94, 0xda, 0xd7, 0xff, 0x8a, 0xcd, 0xcb, 0xff, 0x84, 0xb4, 0xbd, 0xff, 0x9a, 0xb8, 0xbe, 0xff, 0xca, 0xe3, 0xe0, 0xff, 0xee, 0xfa, 0xfb, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xe4, 0xf5, 0xf9, 0xff, 0xc4, 0xf2, 0xfc, 0xff, 0x9b, 0xeb, 0xff, 0xff, 0x72, 0xe0, 0xff, 0xff, 0x49, 0xda, 0xfd, 0xff, 0x72, 0xd8, 0xf4, 0xff, 0xc1, 0xd3, 0xd5, 0xff, 0xf4, 0xd8, 0xc0, 0xff, 0xfa, 0xd6, 0xb9, 0xff, 0xf6, 0xd0, 0xb3, 0xff, 0xf1, 0xcf, 0xaa, 0xff, 0xef, 0xcc, 0xa1, 0xff, 0xee, 0xca, 0x9e, 0xff, 0xf3, 0xca, 0x9d, 0xff, 0xf3, 0xc2, 0x94, 0xff, 0xf0, 0xbc, 0x8a, 0xff, 0xf2, 0xba, 0x86, 0xff, 0xf4, 0xb5, 0x82, 0xff, 0xee, 0xae, 0x7c, 0xff, 0xd7, 0xa1, 0x6b, 0xff, 0xb6, 0x80, 0x47, 0xff, 0xb3, 0x7a, 0x41, 0xff, 0xdb, 0xa6, 0x6b, 0xff, 0xe8, 0xbc, 0x7d, 0xff, 0xd7, 0xb4, 0x74, 0xff, 0xde, 0xb5, 0x75, 0xff, 0xea, 0xb3, 0x75, 0xff, 0xd5, 0x97, 0x59, 0xff, 0xc5, 0x85, 0x3e, 0xff, 0xd7, 0x91, 0x46, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x60, 0xc2, 0xd6, 0xff, 0x20, 0xc3, 0xf2, 0xff, 0x04, 0xbf, 0xf2, 0xff, 0x00, 0xc2, 0xf8, 0xff, 0x0d, 0xc1, 0xf3, 0xff, 0x4b, 0xc5, 0xe8, 0xff, 0x90, 0xcf, 0xe4, 0xff, 0xbc, 0xd4, 0xe4, 0xff, 0xc9, 0xd5, 0xe1, 0xff, 0xc5, 0xda, 0xdc, 0xff, 0xc6, 0xd9, 0xdd, 0xff, 0xd4, 0xd1, 0xdf, 0xff, 0xca, 0xd1, 0xe7, 0xff, 0x8f, 0xd1, 0xe7, 0xff, 0x4c, 0xc6, 0xd3, 0xff, 0x27, 0xb0, 0xb8, 0xff, 0x4e, 0xb3, 0xbd, 0xff, 0x92, 0xdd, 0xe2, 0xff, 0x99, 0xdd, 0xdd, 0xff, 0x8f, 0xce, 0xce, 0xff, 0x88, 0xb1, 0xb5, 0xff, 0x9a, 0xb6, 0xb9, 0xff, 0xda, 0xf0, 0xee, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xec, 0xfd, 0xfa, 0xff, 0xcf, 0xf7, 0xfc, 0xff, 0xb6, 0xee, 0xff, 0xff, 0x90, 0xe6, 0xff, 0xff, 0x62, 0xdc, 0xff, 0xff, 0x37, 0xd4, 0xfd, 0xff, 0x67, 0xda, 0xf2, 0xff, 0xba, 0xd7, 0xce, 0xff, 0xef, 0xdb, 0xbb, 0xff, 0xf9, 0xd8, 0xbb, 0xff, 0xfb, 0xd4, 0xbb, 0xff, 0xf8, 0xd2, 0xb1, 0xff, 0xf6, 0xce, 0xa6, 0xff, 0xf3, 0xcb, 0xa2, 0xff, 0xf2, 0xc8, 0x9d, 0xff, 0xf2, 0xc4, 0x97, 0xff, 0xf3, 0xc0, 0x90, 0xff, 0xf5, 0xbb, 0x87, 0xff, 0xf7, 0xba, 0x84, 0xff, 0xf4, 0xb5, 0x7d, 0xff, 0xec, 0xad, 0x73, 0xff, 0xe2, 0xa3, 0x68, 0xff, 0xb9, 0x80, 0x44, 0xff, 0xae, 0x79, 0x3c, 0xff, 0xd5, 0xa6, 0x69, 0xff, 0xe8, 0xba, 0x7d, 0xff, 0xe7, 0xb3, 0x77, 0xff, 0xeb, 0xb3, 0x78, 0xff, 0xe2, 0xb0, 0x72, 0xff, 0xbf, 0x8e, 0x4a, 0xff, 0xbd, 0x83, 0x3a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x5a, 0xc1, 0xd5, 0xff, 0x26, 0xca, 0xfb, 0xff, 0x09, 0xb4, 0xfa, 0xff, 0x03, 0xbd, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x04, 0xbe, 0xf7, 0xff, 0x29, 0xbf, 0xf0, 0xff, 0x4e, 0xc2, 0xef, 0xff, 0x6d, 0xc6, 0xf1, 0xff, 0x7e, 0xc9, 0xe9, 0xff, 0x6f, 0xcb, 0xea, 0xff, 0x61, 0xc5, 0xe7, 0xff, 0x4b, 0xc6, 0xea, 0xff, 0x28, 0xca, 0xe5, 0xff, 0x00, 0xba, 0xcc, 0xff, 0x33, 0xae, 0xba, 0xff, 0x7f, 0xd2, 0xdc, 0xff, 0x90, 0xdd, 0xe0, 0xff, 0x8d, 0xcd, 0xce, 0xff, 0x7c, 0xaf, 0xb3, 0xff, 0x8e, 0xb0, 0xb9, 0xff, 0xd3, 0xe7, 0xee, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xfe, 0xff, 0xf3, 0xfe, 0xff, 0xff, 0xd9, 0xfa, 0xfe, 0xff, 0xb7, 0xf3, 0xfd, 0xff, 0x99, 0xe9, 0xff, 0xff, 0x73, 0xde, 0xfe, 0xff, 0x4a, 0xd4, 0xfc, 0xff, 0x22, 0xcf, 0xfa, 0xff, 0x63, 0xd9, 0xf2, 0xff, 0xbe, 0xd8, 0xd3, 0xff, 0xf3, 0xdd, 0xc0, 0xff, 0xf9, 0xd9, 0xbd, 0xff, 0xf7, 0xd4, 0xbc, 0xff, 0xf5, 0xd4, 0xb1, 0xff, 0xf8, 0xd2, 0xa5, 0xff, 0xf7, 0xce, 0xa2, 0xff, 0xf6, 0xcb, 0x9e, 0xff, 0xf6, 0xc7, 0x99, 0xff, 0xf5, 0xc2, 0x92, 0xff, 0xf2, 0xbd, 0x89, 0xff, 0xf1, 0xb8, 0x86, 0xff, 0xf2, 0xb5, 0x83, 0xff, 0xf0, 0xb1, 0x7d, 0xff, 0xea, 0xab, 0x73, 0xff, 0xe1, 0xa3, 0x68, 0xff, 0xbd, 0x81, 0x45, 0xff, 0xb3, 0x7b, 0x3c, 0xff, 0xdf, 0xac, 0x6d, 0xff, 0xeb, 0xb6, 0x76, 0xff, 0xe7, 0xb0, 0x70, 0xff, 0xdf, 0xab, 0x6b, 0xff, 0xd2, 0xa0, 0x5c, 0xff, 0xbf, 0x83, 0x3a, 0xff, 0xdd, 0x88, 0x44, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4f, 0xbe, 0xd2, 0xff, 0x23, 0xd4, 0xff, 0xff, 0x06, 0xc2, 0xff, 0xff, 0x04, 0xb9, 0xfd, 0xff, 0x01, 0xb6, 0xfd, 0xff, 0x00, 0xbb, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xff, 0x00, 0xba, 0xfe, 0xff, 0x00, 0xb9, 0xfa, 0xff, 0x00, 0xc1, 0xf6, 0xff, 0x00, 0xc3, 0xf9, 0xff, 0x00, 0xc9, 0xfb, 0xff, 0x00, 0xc7, 0xf6, 0xff, 0x0d, 0xc2, 0xea, 0xff, 0x27, 0xa6, 0xc1, 0xff, 0x64, 0xbc, 0xc9, 0xff, 0x88, 0xdf, 0xe0, 0xff, 0x82, 0xd6, 0xd3, 0xff, 0x78, 0xb6, 0xb5, 0xff, 0x78, 0xa6, 0xae, 0xff, 0xb4, 0xe6, 0xef, 0xff, 0xce, 0xf7, 0xff, 0xff, 0xd6, 0xf6, 0xfb, 0xff, 0xd4, 0xf9, 0xfe, 0xff, 0xcc, 0xf7, 0xfe, 0xff, 0xb1, 0xf1, 0xfd, 0xff, 0x8e, 0xea, 0xfe, 0xff, 0x6d, 0xe0, 0xff, 0xff, 0x4b, 0xd6, 0xff, 0xff, 0x2a, 0xcf, 0xfb, 0xff, 0x02, 0xcd, 0xf8, 0xff, 0x5e, 0xd8, 0xf5, 0xff, 0xc2, 0xd8, 0xd8, 0xff, 0xf6, 0xdd, 0xc4, 0xff, 0xf8, 0xd9, 0xc0, 0xff, 0xf3, 0xd5, 0xc0, 0xff, 0xf2, 0xd7, 0xb5, 0xff, 0xf6, 0xd5, 0xa8, 0xff, 0xf3, 0xcd, 0xa4, 0xff, 0xf4, 0xc7, 0x9f, 0xff, 0xf5, 0xc4, 0x9a, 0xff, 0xf2, 0xc2, 0x95, 0xff, 0xf0, 0xc1, 0x8f, 0xff, 0xec, 0xba, 0x8b, 0xff, 0xeb, 0xb3, 0x86, 0xff, 0xee, 0xb3, 0x82, 0xff, 0xea, 0xaa, 0x74, 0xff, 0xee, 0xad, 0x70, 0xff, 0xe4, 0xa3, 0x63, 0xff, 0xbd, 0x7d, 0x3a, 0xff, 0xc0, 0x86, 0x42, 0xff, 0xe5, 0xad, 0x66, 0xff, 0xdf, 0xa8, 0x60, 0xff, 0xd7, 0xa3, 0x5d, 0xff, 0xd7, 0xa5, 0x5e, 0xff, 0xcf, 0x96, 0x4d, 0xff, 0xcc, 0x83, 0x3d, 0xff, 0xe2, 0x89, 0x45, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x43, 0xb9, 0xcd, 0xff, 0x22, 0xd4, 0xff, 0xff, 0x34, 0xd5, 0xfe, 0xff, 0x36, 0xcb, 0xfb, 0xff, 0x2d, 0xc5, 0xfb, 0xff, 0x16, 0xc2, 0xfb, 0xff, 0x02, 0xbe, 0xf9, 0xff, 0x02, 0xbc, 0xf8, 0xff, 0x02, 0xbc, 0xf6, 0xff, 0x00, 0xc4, 0xfa, 0xff, 0x00, 0xc2, 0xfa, 0xff, 0x06, 0xc9, 0xfd, 0xff, 0x19, 0xc6, 0xf6, 0xff, 0x30, 0xb2, 0xd6, 0xff, 0x65, 0xa6, 0xb9, 0xff, 0x99, 0xd3, 0xd7, 0xff, 0x83, 0xdf, 0xd5, 0xff, 0x7c, 0xc8, 0xc0, 0xff, 0x66, 0x94, 0x95, 0xff, 0xa5, 0xcf, 0xdb, 0xff, 0xb2, 0xf6, 0xff, 0xff, 0x9d, 0xea, 0xf5, 0xff, 0xab, 0xef, 0xfd, 0xff, 0xa7, 0xee, 0xfe, 0xff, 0x96, 0xeb, 0xfd, 0xff, 0x7d, 0xe5, 0xfd, 0xff, 0x5f, 0xde, 0xfd, 0xff, 0x3d, 0xd8, 0xff, 0xff, 0x24, 0xd1, 0xff, 0xff, 0x13, 0xcd, 0xfd, 0xff, 0x00, 0xcd, 0xfc, 0xff, 0x5e, 0xd8, 0xfa, 0xff, 0xc4, 0xd8, 0xdc, 0xff, 0xf7, 0xdc, 0xc7, 0xff, 0xf6, 0xd9, 0xc2, 0xff, 0xf0, 0xd7, 0xc1, 0xff, 0xee, 0xd8, 0xb8, 0xff, 0xf0, 0xd4, 0xad, 0xff, 0xee, 0xcd, 0xa9, 0xff, 0xf0, 0xc8, 0xa5, 0xff, 0xf2, 0xc5, 0x9f, 0xff, 0xf1, 0xc3, 0x98, 0xff, 0xec, 0xbf, 0x8d, 0xff, 0xeb, 0xbc, 0x89, 0xff, 0xed, 0xb9, 0x85, 0xff, 0xf1, 0xb8, 0x81, 0xff, 0xfa, 0xb9, 0x7d, 0xff, 0xf0, 0xad, 0x6c, 0xff, 0xec, 0xa7, 0x62, 0xff, 0xde, 0x99, 0x53, 0xff, 0xbc, 0x7a, 0x2e, 0xff, 0xc9, 0x8c, 0x40, 0xff, 0xe1, 0xa6, 0x5a, 0xff, 0xd2, 0x9c, 0x50, 0xff, 0xd8, 0xa6, 0x5b, 0xff, 0xd5, 0x9f, 0x57, 0xff, 0xbf, 0x80, 0x3b, 0xff, 0xc4, 0x80, 0x3b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0xb8, 0xcd, 0xff, 0x1d, 0xd3, 0xfc, 0xff, 0x3a, 0xdf, 0xfa, 0xff, 0x3e, 0xe3, 0xfc, 0xff, 0x37, 0xe3, 0xfe, 0xff, 0x2a, 0xde, 0xfe, 0xff, 0x29, 0xd7, 0xfc, 0xff, 0x38, 0xd5, 0xfb, 0xff, 0x3d, 0xd4, 0xfa, 0xff, 0x35, 0xd4, 0xfa, 0xff, 0x39, 0xd6, 0xfc, 0xff, 0x39, 0xd9, 0xfc, 0xff, 0x47, 0xd4, 0xf0, 0xff, 0x4a, 0xac, 0xbe, 0xff, 0x7c, 0xbd, 0xbc, 0xff, 0x9f, 0xe4, 0xd8, 0xff, 0x87, 0xd4, 0xc8, 0xff, 0x6f, 0x9d, 0x9a, 0xff, 0x8b, 0xab, 0xb8, 0xff, 0xb0, 0xea, 0xfb, 0xff, 0x87, 0xe5, 0xfd, 0xff, 0x77, 0xe2, 0xf8, 0xff, 0x81, 0xe7, 0xfe, 0xff, 0x72, 0xe4, 0xff, 0xff, 0x5c, 0xe1, 0xfe, 0xff, 0x4a, 0xda, 0xfd, 0xff, 0x33, 0xd5, 0xfd, 0xff, 0x17, 0xd2, 0xff, 0xff, 0x0a, 0xcf, 0xff, 0xff, 0x06, 0xcc, 0xff, 0xff, 0x00, 0xce, 0xff, 0xff, 0x5e, 0xd8, 0xfb, 0xff, 0xc5, 0xd8, 0xdc, 0xff, 0xf5, 0xdd, 0xc8, 0xff, 0xf3, 0xdb, 0xc3, 0xff, 0xf1, 0xd7, 0xc1, 0xff, 0xf0, 0xd7, 0xb9, 0xff, 0xef, 0xd4, 0xb1, 0xff, 0xec, 0xcc, 0xab, 0xff, 0xed, 0xc8, 0xa5, 0xff, 0xf2, 0xc7, 0x9f, 0xff, 0xf8, 0xc6, 0x96, 0xff, 0xf8, 0xc2, 0x8b, 0xff, 0xf6, 0xbd, 0x80, 0xff, 0xf5, 0xb8, 0x77, 0xff, 0xeb, 0xaa, 0x67, 0xff, 0xea, 0xa3, 0x5d, 0xff, 0xe6, 0x9c, 0x53, 0xff, 0xdf, 0x93, 0x48, 0xff, 0xe0, 0x94, 0x48, 0xff, 0xce, 0x84, 0x37, 0xff, 0xba, 0x74, 0x23, 0xff, 0xdb, 0x9b, 0x4c, 0xff, 0xe1, 0xa8, 0x57, 0xff, 0xd7, 0xa1, 0x54, 0xff, 0xd5, 0x9f, 0x57, 0xff, 0xbf, 0x8a, 0x46, 0xff, 0xb2, 0x7b, 0x37, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x40, 0xbb, 0xd0, 0xff, 0x0f, 0xd4, 0xfd, 0xff, 0x19, 0xe1, 0xfd, 0xff, 0x1c, 0xea, 0xfc, 0xff, 0x1e, 0xec, 0xfb, 0xff, 0x24, 0xe9, 0xfc, 0xff, 0x30, 0xe9, 0xfe, 0xff, 0x3c, 0xe9, 0xfc, 0xff, 0x44, 0xe9, 0xfa, 0xff, 0x4e, 0xf0, 0xfc, 0xff, 0x4b, 0xf3, 0xfb, 0xff, 0x44, 0xf5, 0xfb, 0xff, 0x44, 0xdc, 0xe2, 0xff, 0x4b, 0xb6, 0xb6, 0xff, 0x74, 0xd8, 0xc7, 0xff, 0x7a, 0xe6, 0xce, 0xff, 0x72, 0xba, 0xb2, 0xff, 0x6a, 0x85, 0x8d, 0xff, 0xa7, 0xdc, 0xed, 0xff, 0x7b, 0xe1, 0xfd, 0xff, 0x4b, 0xda, 0xfc, 0xff, 0x53, 0xdd, 0xff, 0xff, 0x55, 0xd8, 0xfd, 0xff, 0x44, 0xd9, 0xfe, 0xff, 0x2d, 0xd7, 0xfd, 0xff, 0x24, 0xd3, 0xfd, 0xff, 0x17, 0xd0, 0xff, 0xff, 0x01, 0xcf, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x02, 0xca, 0xff, 0xff, 0x00, 0xcc, 0xfe, 0xff, 0x5d, 0xd6, 0xfa, 0xff, 0xc3, 0xd7, 0xdd, 0xff, 0xf4, 0xdf, 0xc9, 0xff, 0xf4, 0xdc, 0xc4, 0xff, 0xf3, 0xd7, 0xc1, 0xff, 0xf2, 0xd4, 0xb6, 0xff, 0xf0, 0xcf, 0xad, 0xff, 0xef, 0xcd, 0xab, 0xff, 0xf0, 0xcc, 0xa7, 0xff, 0xf8, 0xca, 0x9d, 0xff, 0xfa, 0xc2, 0x8a, 0xff, 0xf7, 0xb6, 0x76, 0xff, 0xee, 0xa7, 0x5f, 0xff, 0xe5, 0x9b, 0x4b, 0xff, 0xe1, 0x91, 0x42, 0xff, 0xdc, 0x87, 0x37, 0xff, 0xe0, 0x8b, 0x3b, 0xff, 0xe0, 0x8a, 0x3c, 0xff, 0xdc, 0x88, 0x3a, 0xff, 0xd9, 0x87, 0x3a, 0xff, 0xc7, 0x7b, 0x2a, 0xff, 0xc8, 0x85, 0x31, 0xff, 0xe6, 0xaa, 0x57, 0xff, 0xdc, 0xa2, 0x52, 0xff, 0xd6, 0xa0, 0x57, 0xff, 0xc5, 0x99, 0x54, 0xff, 0xc1, 0x82, 0x3d, 0xff, 0xcf, 0x80, 0x30, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3b, 0xbd, 0xd0, 0xff, 0x0e, 0xd3, 0xfd, 0xff, 0x0d, 0xdf, 0xfe, 0xff, 0x14, 0xe7, 0xfe, 0xff, 0x17, 0xe6, 0xfb, 0xff, 0x19, 0xe4, 0xfb, 0xff, 0x18, 0xe4, 0xfc, 0xff, 0x15, 0xe7, 0xf9, 0xff, 0x17, 0xec, 0xf7, 0xff, 0x21, 0xf3, 0xfa, 0xff, 0x22, 0xf4, 0xf7, 0xff, 0x33, 0xf1, 0xef, 0xff, 0x3b, 0xcb, 0xc5, 0xff, 0x63, 0xc1, 0xb7, 0xff, 0x8b, 0xe1, 0xd1, 0xff, 0x80, 0xd9, 0xc9, 0xff, 0x5e, 0x98, 0x99, 0xff, 0x84, 0xad, 0xbd, 0xff, 0x88, 0xe4, 0xf8, 0xff, 0x3a, 0xd7, 0xf8, 0xff, 0x1d, 0xd4, 0xfd, 0xff, 0x2f, 0xd8, 0xff, 0xff, 0x31, 0xd4, 0xfe, 0xff, 0x25, 0xd2, 0xfd, 0xff, 0x14, 0xd1, 0xfc, 0xff, 0x0e, 0xce, 0xfc, 0xff, 0x05, 0xcd, 0xfd, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x00, 0xc9, 0xfe, 0xff, 0x00, 0xcb, 0xff, 0xff, 0x61, 0xd5, 0xf7, 0xff, 0xc6, 0xd9, 0xda, 0xff, 0xf1, 0xdc, 0xc4, 0xff, 0xee, 0xdb, 0xc4, 0xff, 0xed, 0xd6, 0xc0, 0xff, 0xf0, 0xd1, 0xb4, 0xff, 0xf6, 0xd3, 0xad, 0xff, 0xfa, 0xd3, 0xa6, 0xff, 0xf4, 0xc5, 0x92, 0xff, 0xe8, 0xaf, 0x77, 0xff, 0xde, 0x9b, 0x59, 0xff, 0xd9, 0x8d, 0x40, 0xff, 0xdc, 0x8a, 0x36, 0xff, 0xdf, 0x88, 0x31, 0xff, 0xe3, 0x8c, 0x34, 0xff, 0xe7, 0x8e, 0x36, 0xff, 0xe7, 0x8d, 0x37, 0xff, 0xe7, 0x8c, 0x39, 0xff, 0xe6, 0x8c, 0x3b, 0xff, 0xe2, 0x8b, 0x3c, 0xff, 0xd5, 0x85, 0x34, 0xff, 0xc2, 0x79, 0x28, 0xff, 0xd9, 0x99, 0x4a, 0xff, 0xe1, 0xa8, 0x5d, 0xff, 0xd3, 0x9e, 0x56, 0xff, 0xd4, 0xa1, 0x5b, 0xff, 0xc8, 0x86, 0x41, 0xff, 0xd1, 0x81, 0x31, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x31, 0xbc, 0xce, 0xff, 0x10, 0xd2, 0xfc, 0xff, 0x12, 0xde, 0xfd, 0xff, 0x17, 0xe3, 0xfe, 0xff, 0x1a, 0xe3, 0xfe, 0xff, 0x1c, 0xe4, 0xff, 0xff, 0x18, 0xe3, 0xfe, 0xff, 0x17, 0xe5, 0xfb, 0xff, 0x1b, 0xea, 0xfe, 0xff, 0x1e, 0xee, 0xff, 0xff, 0x26, 0xf1, 0xfd, 0xff, 0x39, 0xe4, 0xe8, 0xff, 0x48, 0xc4, 0xbe, 0xff, 0x78, 0xcd, 0xc3, 0xff, 0x91, 0xdd, 0xd4, 0xff, 0x80, 0xc6, 0xc1, 0xff, 0x5d, 0x88, 0x91, 0xff, 0x87, 0xcb, 0xe0, 0xff, 0x5c, 0xde, 0xfa, 0xff, 0x00, 0xd3, 0xf8, 0xff, 0x0f, 0xd1, 0xff, 0xff, 0x14, 0xd1, 0xfc, 0xff, 0x09, 0xd2, 0xfc, 0xff, 0x0a, 0xd1, 0xfe, 0xff, 0x0a, 0xcf, 0xfd, 0xff, 0x04, 0xcd, 0xfd, 0xff, 0x00, 0xcc, 0xfd, 0xff, 0x01, 0xcc, 0xfe, 0xff, 0x02, 0xcc, 0xff, 0xff, 0x00, 0xca, 0xfe, 0xff, 0x02, 0xcb, 0xfe, 0xff, 0x61, 0xd2, 0xf5, 0xff, 0xc1, 0xd8, 0xd8, 0xff, 0xf2, 0xde, 0xc5, 0xff, 0xea, 0xdd, 0xc3, 0xff, 0xef, 0xdc, 0xc1, 0xff, 0xfb, 0xd7, 0xb4, 0xff, 0xfa, 0xcc, 0x9b, 0xff, 0xeb, 0xb0, 0x75, 0xff, 0xdd, 0x95, 0x4f, 0xff, 0xdd, 0x89, 0x3b, 0xff, 0xe5, 0x8b, 0x3a, 0xff, 0xe7, 0x8c, 0x36, 0xff, 0xe6, 0x8c, 0x35, 0xff, 0xe6, 0x8c, 0x35, 0xff, 0xe6, 0x8e, 0x34, 0xff, 0xe6, 0x8e, 0x34, 0xff, 0xe6, 0x8d, 0x34, 0xff, 0xe6, 0x8c, 0x36, 0xff, 0xe7, 0x8c, 0x38, 0xff, 0xe4, 0x8d, 0x3a, 0xff, 0xdc, 0x8a, 0x38, 0xff, 0xc6, 0x79, 0x2c, 0xff, 0xcf, 0x8e, 0x45, 0xff, 0xdd, 0xa6, 0x5f, 0xff, 0xd3, 0x9f, 0x58, 0xff, 0xdc, 0xa2, 0x5b, 0xff, 0xd0, 0x8d, 0x46, 0xff, 0xd3, 0x84, 0x36, 0xff, 0xe6, 0x80, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x33, 0xbd, 0xcf, 0xff, 0x0e, 0xd3, 0xfd, 0xff, 0x12, 0xde, 0xfe, 0xff, 0x17, 0xe2, 0xff, 0xff, 0x18, 0xe2, 0xfd, 0xff, 0x18, 0xe2, 0xff, 0xff, 0x17, 0xe1, 0xfe, 0xff, 0x15, 0xe4, 0xfc, 0xff, 0x1b, 0xea, 0xfe, 0xff, 0x21, 0xee, 0xff, 0xff, 0x27, 0xed, 0xfa, 0xff, 0x2f, 0xd7, 0xdc, 0xff, 0x4b, 0xc1, 0xbe, 0xff, 0x84, 0xd6, 0xd0, 0xff, 0x8e, 0xd6, 0xd3, 0xff, 0x6f, 0xb4, 0xb5, 0xff, 0x5c, 0x98, 0xa6, 0xff, 0x77, 0xdc, 0xf2, 0xff, 0x3c, 0xd6, 0xf3, 0xff, 0x00, 0xd1, 0xf8, 0xff, 0x07, 0xcf, 0xfe, 0xff, 0x04, 0xcb, 0xfa, 0xff, 0x01, 0xcf, 0xfc, 0xff, 0x01, 0xd0, 0xfe, 0xff, 0x01, 0xd0, 0xfe, 0xff, 0x01, 0xd0, 0xfe, 0xff, 0x02, 0xce, 0xfe, 0xff, 0x03, 0xcc, 0xfd, 0xff, 0x06, 0xcb, 0xfc, 0xff, 0x02, 0xc9, 0xfb, 0xff, 0x00, 0xc7, 0xfa, 0xff, 0x64, 0xd7, 0xfe, 0xff, 0xba, 0xd9, 0xdf, 0xff, 0xea, 0xda, 0xc1, 0xff, 0xf0, 0xde, 0xba, 0xff, 0xff, 0xe1, 0xb5, 0xff, 0xf8, 0xbe, 0x89, 0xff, 0xe6, 0x9a, 0x59, 0xff, 0xdd, 0x8c, 0x40, 0xff, 0xe1, 0x88, 0x34, 0xff, 0xea, 0x8a, 0x36, 0xff, 0xed, 0x8a, 0x35, 0xff, 0xec, 0x8b, 0x30, 0xff, 0xe8, 0x8b, 0x32, 0xff, 0xe4, 0x8c, 0x35, 0xff, 0xe5, 0x8c, 0x34, 0xff, 0xe5, 0x8d, 0x33, 0xff, 0xe4, 0x8c, 0x32, 0xff, 0xe4, 0x8c, 0x32, 0xff, 0xe4, 0x8b, 0x33, 0xff, 0xe5, 0x8d, 0x38, 0xff, 0xdf, 0x8b, 0x3a, 0xff, 0xcc, 0x80, 0x31, 0xff, 0xc7, 0x83, 0x3a, 0xff, 0xdc, 0xa2, 0x5c, 0xff, 0xd9, 0xa3, 0x5c, 0xff, 0xdd, 0xa2, 0x5b, 0xff, 0xd0, 0x93, 0x4f, 0xff, 0xc9, 0x83, 0x3d, 0xff, 0xcc, 0x80, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x34, 0xbd, 0xcf, 0xff, 0x0e, 0xd3, 0xfe, 0xff, 0x14, 0xdd, 0xff, 0xff, 0x17, 0xe2, 0xfe, 0xff, 0x16, 0xe1, 0xfc, 0xff, 0x15, 0xe2, 0xfe, 0xff, 0x14, 0xe1, 0xfd, 0xff, 0x15, 0xe3, 0xfc, 0xff, 0x1a, 0xea, 0xfe, 0xff, 0x22, 0xee, 0xff, 0xff, 0x2a, 0xed, 0xf8, 0xff, 0x2a, 0xcf, 0xd0, 0xff, 0x53, 0xc3, 0xbb, 0xff, 0x8f, 0xdd, 0xd6, 0xff, 0x86, 0xcd, 0xca, 0xff, 0x5e, 0xa2, 0xa6, 0xff, 0x66, 0xae, 0xc1, 0xff, 0x69, 0xe4, 0xff, 0xff, 0x17, 0xd1, 0xf5, 0xff, 0x00, 0xd1, 0xfd, 0xff, 0x07, 0xcd, 0xff, 0xff, 0x03, 0xcc, 0xfd, 0xff, 0x00, 0xd0, 0xfe, 0xff, 0x00, 0xce, 0xfe, 0xff, 0x00, 0xcf, 0xfe, 0xff, 0x00, 0xce, 0xfe, 0xff, 0x00, 0xce, 0xfe, 0xff, 0x03, 0xcc, 0xfd, 0xff, 0x03, 0xcb, 0xfc, 0xff, 0x07, 0xcc, 0xfc, 0xff, 0x0e, 0xca, 0xfd, 0xff, 0x5c, 0xce, 0xf9, 0xff, 0xb7, 0xd2, 0xdb, 0xff, 0xfa, 0xe3, 0xc6, 0xff, 0xfb, 0xd7, 0xa6, 0xff, 0xe8, 0xb2, 0x76, 0xff, 0xda, 0x8d, 0x43, 0xff, 0xd5, 0x88, 0x31, 0xff, 0xdb, 0x8c, 0x32, 0xff, 0xe2, 0x90, 0x34, 0xff, 0xe4, 0x8f, 0x35, 0xff, 0xe2, 0x8d, 0x32, 0xff, 0xe1, 0x8e, 0x2f, 0xff, 0xe2, 0x8e, 0x33, 0xff, 0xe2, 0x8b, 0x35, 0xff, 0xe2, 0x8c, 0x34, 0xff, 0xe2, 0x8d, 0x33, 0xff, 0xe2, 0x8d, 0x33, 0xff, 0xe1, 0x8c, 0x32, 0xff, 0xe1, 0x8c, 0x31, 0xff, 0xe3, 0x8d, 0x35, 0xff, 0xe0, 0x8b, 0x37, 0xff, 0xd5, 0x85, 0x37, 0xff, 0xbe, 0x7a, 0x31, 0xff, 0xd7, 0x9e, 0x56, 0xff, 0xdf, 0xa7, 0x60, 0xff, 0xde, 0xa2, 0x58, 0xff, 0xce, 0x9a, 0x58, 0xff, 0xbe, 0x84, 0x43, 0xff, 0xcc, 0x80, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x35, 0xbd, 0xd0, 0xff, 0x0b, 0xd2, 0xfe, 0xff, 0x15, 0xdc, 0xff, 0xff, 0x16, 0xe1, 0xff, 0xff, 0x14, 0xe1, 0xfd, 0xff, 0x14, 0xe1, 0xff, 0xff, 0x13, 0xe0, 0xff, 0xff, 0x13, 0xe2, 0xfc, 0xff, 0x19, 0xe8, 0xfe, 0xff, 0x1f, 0xec, 0xfd, 0xff, 0x29, 0xeb, 0xf1, 0xff, 0x2b, 0xcc, 0xc5, 0xff, 0x5d, 0xc9, 0xbb, 0xff, 0x96, 0xe2, 0xd5, 0xff, 0x81, 0xc7, 0xc1, 0xff, 0x59, 0x9e, 0xa2, 0xff, 0x6e, 0xbf, 0xd5, 0xff, 0x5b, 0xdd, 0xfe, 0xff, 0x00, 0xce, 0xfb, 0xff, 0x00, 0xd1, 0xff, 0xff, 0x09, 0xcb, 0xff, 0xff, 0x07, 0xcd, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x02, 0xcd, 0xff, 0xff, 0x01, 0xcd, 0xfe, 0xff, 0x00, 0xcd, 0xfd, 0xff, 0x00, 0xcd, 0xfd, 0xff, 0x00, 0xcd, 0xfd, 0xff, 0x00, 0xcd, 0xfc, 0xff, 0x05, 0xca, 0xf9, 0xff, 0x14, 0xc7, 0xf8, 0xff, 0x64, 0xd0, 0xf8, 0xff, 0xc6, 0xd6, 0xd7, 0xff, 0xf4, 0xcf, 0xa5, 0xff, 0xe0, 0xa9, 0x68, 0xff, 0xd4, 0x83, 0x34, 0xff, 0xe3, 0x87, 0x34, 0xff, 0xdf, 0x8e, 0x36, 0xff, 0xe0, 0x8f, 0x34, 0xff, 0xdd, 0x8c, 0x30, 0xff, 0xdb, 0x8b, 0x31, 0xff, 0xde, 0x8e, 0x35, 0xff, 0xde, 0x8f, 0x34, 0xff, 0xde, 0x8c, 0x33, 0xff, 0xdf, 0x8a, 0x34, 0xff, 0xdf, 0x8b, 0x33, 0xff, 0xdf, 0x8b, 0x33, 0xff, 0xdf, 0x8b, 0x33, 0xff, 0xdf, 0x8c, 0x31, 0xff, 0xdf, 0x8c, 0x31, 0xff, 0xe1, 0x8c, 0x31, 0xff, 0xe1, 0x8a, 0x34, 0xff, 0xda, 0x88, 0x39, 0xff, 0xbd, 0x77, 0x2e, 0xff, 0xd3, 0x98, 0x50, 0xff, 0xe2, 0xaa, 0x61, 0xff, 0xdf, 0xa1, 0x54, 0xff, 0xcf, 0x9e, 0x5f, 0xff, 0xb7, 0x83, 0x47, 0xff, 0xb3, 0x80, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x33, 0xbb, 0xd0, 0xff, 0x08, 0xd1, 0xfc, 0xff, 0x14, 0xd9, 0xfe, 0xff, 0x15, 0xdf, 0xff, 0xff, 0x13, 0xe0, 0xfe, 0xff, 0x12, 0xdf, 0xff, 0xff, 0x11, 0xdf, 0xfe, 0xff, 0x12, 0xe1, 0xfc, 0xff, 0x17, 0xe6, 0xff, 0xff, 0x1c, 0xe8, 0xfd, 0xff, 0x23, 0xe4, 0xeb, 0xff, 0x2c, 0xcb, 0xc2, 0xff, 0x67, 0xd0, 0xbf, 0xff, 0x99, 0xe3, 0xd4, 0xff, 0x81, 0xc7, 0xc1, 0xff, 0x57, 0xa0, 0xa5, 0xff, 0x6c, 0xcb, 0xe1, 0xff, 0x4e, 0xd7, 0xfb, 0xff, 0x00, 0xcc, 0xfc, 0xff, 0x01, 0xce, 0xff, 0xff, 0x05, 0xcd, 0xfd, 0xff, 0x04, 0xcd, 0xfe, 0xff, 0x01, 0xcb, 0xff, 0xff, 0x04, 0xce, 0xff, 0xff, 0x02, 0xcd, 0xfe, 0xff, 0x00, 0xcc, 0xfc, 0xff, 0x00, 0xcb, 0xfc, 0xff, 0x01, 0xca, 0xfc, 0xff, 0x03, 0xcb, 0xfe, 0xff, 0x09, 0xca, 0xfb, 0xff, 0x0d, 0xc6, 0xf6, 0xff, 0x71, 0xd6, 0xf6, 0xff, 0xc0, 0xc7, 0xbb, 0xff, 0xcc, 0x93, 0x53, 0xff, 0xd3, 0x89, 0x31, 0xff, 0xe9, 0x8e, 0x36, 0xff, 0xef, 0x8b, 0x35, 0xff, 0xe7, 0x8d, 0x37, 0xff, 0xe7, 0x8e, 0x35, 0xff, 0xe3, 0x8c, 0x33, 0xff, 0xe3, 0x8c, 0x37, 0xff, 0xe4, 0x8c, 0x3a, 0xff, 0xe2, 0x89, 0x34, 0xff, 0xe0, 0x8a, 0x31, 0xff, 0xe1, 0x8c, 0x35, 0xff, 0xe1, 0x8b, 0x36, 0xff, 0xe1, 0x8b, 0x36, 0xff, 0xe1, 0x8b, 0x36, 0xff, 0xe0, 0x8b, 0x34, 0xff, 0xe0, 0x8c, 0x34, 0xff, 0xe1, 0x8b, 0x31, 0xff, 0xe3, 0x8b, 0x34, 0xff, 0xdc, 0x89, 0x39, 0xff, 0xc2, 0x79, 0x30, 0xff, 0xce, 0x90, 0x49, 0xff, 0xe5, 0xab, 0x62, 0xff, 0xe2, 0xa2, 0x54, 0xff, 0xd2, 0xa1, 0x62, 0xff, 0xb5, 0x82, 0x49, 0xff, 0xb3, 0x66, 0x1a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x33, 0xb9, 0xce, 0xff, 0x05, 0xd0, 0xfb, 0xff, 0x12, 0xd7, 0xfd, 0xff, 0x13, 0xde, 0xff, 0xff, 0x12, 0xdf, 0xfd, 0xff, 0x10, 0xdf, 0xff, 0xff, 0x0e, 0xdd, 0xfd, 0xff, 0x10, 0xde, 0xfa, 0xff, 0x16, 0xe4, 0xfd, 0xff, 0x1b, 0xe8, 0xff, 0xff, 0x1c, 0xdc, 0xe9, 0xff, 0x2c, 0xc8, 0xc3, 0xff, 0x6e, 0xd4, 0xc4, 0xff, 0x99, 0xe1, 0xd6, 0xff, 0x82, 0xc7, 0xc3, 0xff, 0x50, 0xa1, 0xa7, 0xff, 0x63, 0xd3, 0xe5, 0xff, 0x46, 0xd9, 0xfd, 0xff, 0x00, 0xcc, 0xfd, 0xff, 0x00, 0xcc, 0xfc, 0xff, 0x00, 0xd2, 0xfe, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x00, 0xcb, 0xfe, 0xff, 0x01, 0xce, 0xfe, 0xff, 0x00, 0xce, 0xfd, 0xff, 0x01, 0xcc, 0xfc, 0xff, 0x04, 0xca, 0xfe, 0xff, 0x07, 0xc8, 0xfd, 0xff, 0x0a, 0xc7, 0xfe, 0xff, 0x08, 0xc9, 0xfb, 0xff, 0x18, 0xcc, 0xfa, 0xff, 0x6a, 0xd0, 0xe7, 0xff, 0x9e, 0xa3, 0x8a, 0xff, 0xcb, 0x87, 0x30, 0xff, 0xdf, 0x8e, 0x2c, 0xff, 0xee, 0x8f, 0x35, 0xff, 0xf0, 0x8c, 0x38, 0xff, 0xe1, 0x8c, 0x36, 0xff, 0xde, 0x8b, 0x32, 0xff, 0xde, 0x8c, 0x35, 0xff, 0xde, 0x8a, 0x37, 0xff, 0xde, 0x87, 0x36, 0xff, 0xe2, 0x8a, 0x35, 0xff, 0xe2, 0x8d, 0x34, 0xff, 0xdf, 0x8c, 0x33, 0xff, 0xdf, 0x8c, 0x36, 0xff, 0xdf, 0x8a, 0x37, 0xff, 0xde, 0x89, 0x37, 0xff, 0xdd, 0x89, 0x36, 0xff, 0xdd, 0x89, 0x35, 0xff, 0xe0, 0x89, 0x30, 0xff, 0xe5, 0x8d, 0x35, 0xff, 0xdc, 0x88, 0x39, 0xff, 0xc7, 0x7c, 0x34, 0xff, 0xca, 0x8b, 0x45, 0xff, 0xe6, 0xab, 0x62, 0xff, 0xe6, 0xa5, 0x55, 0xff, 0xd6, 0xa4, 0x65, 0xff, 0xb6, 0x81, 0x48, 0xff, 0xaa, 0x71, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x37, 0xb9, 0xcf, 0xff, 0x05, 0xd0, 0xfd, 0xff, 0x10, 0xd6, 0xff, 0xff, 0x11, 0xdc, 0xff, 0xff, 0x10, 0xdc, 0xff, 0xff, 0x10, 0xde, 0xff, 0xff, 0x10, 0xdd, 0xff, 0xff, 0x11, 0xde, 0xfc, 0xff, 0x16, 0xe3, 0xfe, 0xff, 0x18, 0xe6, 0xff, 0xff, 0x17, 0xdb, 0xeb, 0xff, 0x25, 0xc5, 0xc2, 0xff, 0x6f, 0xd7, 0xc4, 0xff, 0x98, 0xe3, 0xd2, 0xff, 0x7b, 0xc3, 0xbd, 0xff, 0x52, 0xa4, 0xaa, 0xff, 0x60, 0xd6, 0xe7, 0xff, 0x39, 0xe0, 0xfe, 0xff, 0x00, 0xce, 0xfd, 0xff, 0x02, 0xce, 0xfe, 0xff, 0x00, 0xce, 0xfb, 0xff, 0x00, 0xd2, 0xff, 0xff, 0x00, 0xcc, 0xfe, 0xff, 0x00, 0xcc, 0xff, 0xff, 0x01, 0xca, 0xfd, 0xff, 0x04, 0xca, 0xfc, 0xff, 0x07, 0xcc, 0xfe, 0xff, 0x09, 0xcb, 0xfe, 0xff, 0x0f, 0xc7, 0xfe, 0xff, 0x11, 0xc4, 0xfc, 0xff, 0x05, 0xc6, 0xf8, 0xff, 0x52, 0xc6, 0xe6, 0xff, 0x9a, 0x9d, 0x82, 0xff, 0xd7, 0x8c, 0x2e, 0xff, 0xe8, 0x8d, 0x36, 0xff, 0xe9, 0x8e, 0x37, 0xff, 0xe5, 0x8b, 0x3a, 0xff, 0xde, 0x8a, 0x39, 0xff, 0xde, 0x8b, 0x37, 0xff, 0xde, 0x8c, 0x36, 0xff, 0xdd, 0x8a, 0x35, 0xff, 0xde, 0x8a, 0x35, 0xff, 0xe0, 0x8a, 0x36, 0xff, 0xe2, 0x8d, 0x37, 0xff, 0xdf, 0x8d, 0x34, 0xff, 0xd8, 0x8a, 0x33, 0xff, 0xd9, 0x8b, 0x35, 0xff, 0xdb, 0x8b, 0x36, 0xff, 0xda, 0x89, 0x33, 0xff, 0xd8, 0x8b, 0x33, 0xff, 0xda, 0x89, 0x35, 0xff, 0xdf, 0x88, 0x36, 0xff, 0xdd, 0x8a, 0x39, 0xff, 0xc5, 0x7c, 0x31, 0xff, 0xc9, 0x8b, 0x49, 0xff, 0xe4, 0xaa, 0x66, 0xff, 0xe5, 0xa7, 0x55, 0xff, 0xd6, 0xa1, 0x61, 0xff, 0xbb, 0x86, 0x4b, 0xff, 0xd0, 0x85, 0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0xb9, 0xcf, 0xff, 0x05, 0xcf, 0xff, 0xff, 0x0f, 0xd5, 0xff, 0xff, 0x10, 0xda, 0xff, 0xff, 0x0f, 0xdb, 0xfe, 0xff, 0x0f, 0xdc, 0xff, 0xff, 0x10, 0xdc, 0xff, 0xff, 0x10, 0xdd, 0xfc, 0xff, 0x15, 0xe2, 0xfd, 0xff, 0x1a, 0xe6, 0xff, 0xff, 0x19, 0xdc, 0xec, 0xff, 0x25, 0xc5, 0xc4, 0xff, 0x69, 0xd2, 0xc1, 0xff, 0x97, 0xe1, 0xd0, 0xff, 0x7b, 0xc4, 0xbd, 0xff, 0x54, 0xa6, 0xad, 0xff, 0x5b, 0xd3, 0xe6, 0xff, 0x34, 0xdd, 0xfd, 0xff, 0x00, 0xcd, 0xfb, 0xff, 0x01, 0xcf, 0xff, 0xff, 0x00, 0xd0, 0xfe, 0xff, 0x01, 0xce, 0xfc, 0xff, 0x02, 0xcf, 0xff, 0xff, 0x00, 0xcd, 0xff, 0xff, 0x04, 0xcb, 0xfd, 0xff, 0x07, 0xca, 0xfc, 0xff, 0x07, 0xca, 0xfc, 0xff, 0x0d, 0xca, 0xfd, 0xff, 0x13, 0xc6, 0xfe, 0xff, 0x13, 0xc0, 0xf9, 0xff, 0x00, 0xbe, 0xef, 0xff, 0x4f, 0xc2, 0xe5, 0xff, 0x9d, 0x9d, 0x86, 0xff, 0xd7, 0x8a, 0x2f, 0xff, 0xe9, 0x8d, 0x3a, 0xff, 0xe8, 0x91, 0x37, 0xff, 0xe1, 0x8c, 0x3a, 0xff, 0xdc, 0x8a, 0x3b, 0xff, 0xdd, 0x8b, 0x39, 0xff, 0xdc, 0x8b, 0x37, 0xff, 0xdc, 0x8b, 0x36, 0xff, 0xdc, 0x8b, 0x37, 0xff, 0xdc, 0x8a, 0x38, 0xff, 0xdd, 0x89, 0x37, 0xff, 0xdc, 0x89, 0x34, 0xff, 0xd8, 0x89, 0x36, 0xff, 0xd8, 0x8a, 0x35, 0xff, 0xdb, 0x89, 0x35, 0xff, 0xd9, 0x88, 0x33, 0xff, 0xd7, 0x89, 0x32, 0xff, 0xd9, 0x87, 0x32, 0xff, 0xe1, 0x8a, 0x36, 0xff, 0xda, 0x88, 0x38, 0xff, 0xc4, 0x7c, 0x34, 0xff, 0xcc, 0x8f, 0x50, 0xff, 0xe5, 0xac, 0x68, 0xff, 0xe4, 0xa6, 0x55, 0xff, 0xd6, 0xa3, 0x62, 0xff, 0xb8, 0x84, 0x4a, 0xff, 0xb9, 0x74, 0x17, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0xb9, 0xcf, 0xff, 0x05, 0xce, 0xff, 0xff, 0x0e, 0xd4, 0xff, 0xff, 0x0f, 0xd8, 0xfe, 0xff, 0x0d, 0xd9, 0xfc, 0xff, 0x0d, 0xda, 0xfe, 0xff, 0x0e, 0xda, 0xff, 0xff, 0x0f, 0xdc, 0xfc, 0xff, 0x14, 0xe0, 0xfd, 0xff, 0x1d, 0xe7, 0xff, 0xff, 0x1a, 0xdd, 0xec, 0xff, 0x25, 0xc6, 0xc7, 0xff, 0x61, 0xcb, 0xbe, 0xff, 0x96, 0xdf, 0xd2, 0xff, 0x7f, 0xc5, 0xc1, 0xff, 0x55, 0xa8, 0xb0, 0xff, 0x54, 0xce, 0xe4, 0xff, 0x37, 0xd9, 0xfc, 0xff, 0x00, 0xcc, 0xfb, 0xff, 0x00, 0xd0, 0xff, 0xff, 0x04, 0xd2, 0xff, 0xff, 0x02, 0xcc, 0xfb, 0xff, 0x04, 0xcf, 0xff, 0xff, 0x01, 0xcf, 0xfe, 0xff, 0x06, 0xce, 0xfe, 0xff, 0x08, 0xca, 0xfb, 0xff, 0x0b, 0xc8, 0xfb, 0xff, 0x12, 0xc7, 0xfe, 0xff, 0x17, 0xc1, 0xfd, 0xff, 0x13, 0xb9, 0xf4, 0xff, 0x00, 0xb8, 0xe9, 0xff, 0x4f, 0xbf, 0xe5, 0xff, 0x9f, 0x9b, 0x89, 0xff, 0xd7, 0x89, 0x31, 0xff, 0xe5, 0x8b, 0x38, 0xff, 0xe3, 0x91, 0x33, 0xff, 0xde, 0x8d, 0x36, 0xff, 0xdd, 0x8a, 0x3a, 0xff, 0xdc, 0x8b, 0x38, 0xff, 0xdb, 0x8b, 0x37, 0xff, 0xdb, 0x8b, 0x37, 0xff, 0xda, 0x8a, 0x36, 0xff, 0xd9, 0x89, 0x36, 0xff, 0xdb, 0x88, 0x39, 0xff, 0xdc, 0x88, 0x39, 0xff, 0xd9, 0x89, 0x36, 0xff, 0xd6, 0x86, 0x31, 0xff, 0xd9, 0x86, 0x2f, 0xff, 0xd9, 0x87, 0x30, 0xff, 0xd5, 0x88, 0x30, 0xff, 0xd8, 0x87, 0x2f, 0xff, 0xd7, 0x83, 0x2d, 0xff, 0xd3, 0x87, 0x3b, 0xff, 0xc7, 0x84, 0x42, 0xff, 0xca, 0x90, 0x53, 0xff, 0xe7, 0xac, 0x6a, 0xff, 0xe5, 0xa4, 0x55, 0xff, 0xd5, 0xa1, 0x61, 0xff, 0xb6, 0x82, 0x49, 0xff, 0xb3, 0x66, 0x1a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0xb9, 0xd0, 0xff, 0x07, 0xce, 0xff, 0xff, 0x0f, 0xd3, 0xff, 0xff, 0x0f, 0xd7, 0xfe, 0xff, 0x0c, 0xd6, 0xfc, 0xff, 0x0b, 0xd8, 0xfe, 0xff, 0x0b, 0xd8, 0xff, 0xff, 0x0d, 0xda, 0xfd, 0xff, 0x15, 0xdf, 0xfd, 0xff, 0x1d, 0xe6, 0xfe, 0xff, 0x18, 0xdc, 0xed, 0xff, 0x22, 0xc6, 0xcb, 0xff, 0x56, 0xc5, 0xbd, 0xff, 0x90, 0xdd, 0xd2, 0xff, 0x81, 0xc9, 0xc5, 0xff, 0x55, 0xa8, 0xaf, 0xff, 0x52, 0xc8, 0xe0, 0xff, 0x41, 0xda, 0xfe, 0xff, 0x00, 0xcd, 0xfd, 0xff, 0x00, 0xce, 0xfe, 0xff, 0x03, 0xcf, 0xfe, 0xff, 0x06, 0xcf, 0xfe, 0xff, 0x01, 0xcd, 0xfe, 0xff, 0x03, 0xcf, 0xfe, 0xff, 0x09, 0xcd, 0xfd, 0xff, 0x0b, 0xc9, 0xfa, 0xff, 0x10, 0xc8, 0xfc, 0xff, 0x16, 0xc6, 0xfe, 0xff, 0x17, 0xbb, 0xf9, 0xff, 0x12, 0xb3, 0xee, 0xff, 0x00, 0xb7, 0xe9, 0xff, 0x52, 0xbe, 0xe5, 0xff, 0xa1, 0x9a, 0x89, 0xff, 0xd6, 0x86, 0x30, 0xff, 0xe2, 0x89, 0x36, 0xff, 0xde, 0x90, 0x30, 0xff, 0xdd, 0x8e, 0x32, 0xff, 0xe0, 0x8b, 0x34, 0xff, 0xe0, 0x8b, 0x34, 0xff, 0xdd, 0x8a, 0x33, 0xff, 0xdc, 0x8a, 0x33, 0xff, 0xdb, 0x89, 0x34, 0xff, 0xd9, 0x8a, 0x34, 0xff, 0xda, 0x88, 0x36, 0xff, 0xd9, 0x87, 0x36, 0xff, 0xd6, 0x87, 0x30, 0xff, 0xd6, 0x86, 0x2a, 0xff, 0xda, 0x88, 0x2a, 0xff, 0xda, 0x8a, 0x2d, 0xff, 0xd2, 0x8a, 0x2c, 0xff, 0xcf, 0x85, 0x2c, 0xff, 0xd1, 0x86, 0x35, 0xff, 0xe6, 0xa4, 0x60, 0xff, 0xc8, 0x8d, 0x51, 0xff, 0xcc, 0x93, 0x58, 0xff, 0xe6, 0xab, 0x6a, 0xff, 0xe6, 0xa5, 0x5a, 0xff, 0xd4, 0xa0, 0x5e, 0xff, 0xb8, 0x81, 0x44, 0xff, 0xb3, 0x66, 0x1a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0xb8, 0xd0, 0xff, 0x07, 0xcd, 0xff, 0xff, 0x0f, 0xd2, 0xff, 0xff, 0x0e, 0xd6, 0xfe, 0xff, 0x0b, 0xd5, 0xfd, 0xff, 0x0a, 0xd5, 0xff, 0xff, 0x0a, 0xd6, 0xff, 0xff, 0x0a, 0xd8, 0xfd, 0xff, 0x13, 0xdf, 0xff, 0xff, 0x1b, 0xe4, 0xfe, 0xff, 0x14, 0xdc, 0xf1, 0xff, 0x1e, 0xc8, 0xd1, 0xff, 0x4d, 0xc3, 0xbe, 0xff, 0x84, 0xd8, 0xce, 0xff, 0x82, 0xcf, 0xc9, 0xff, 0x5b, 0xae, 0xb1, 0xff, 0x52, 0xbf, 0xd6, 0xff, 0x4a, 0xd9, 0xfe, 0xff, 0x08, 0xd0, 0xfe, 0xff, 0x00, 0xcf, 0xfd, 0xff, 0x02, 0xcd, 0xfa, 0xff, 0x0b, 0xd2, 0xff, 0xff, 0x01, 0xca, 0xfd, 0xff, 0x06, 0xcd, 0xfd, 0xff, 0x09, 0xc9, 0xfb, 0xff, 0x0e, 0xc8, 0xfb, 0xff, 0x13, 0xc9, 0xfd, 0xff, 0x15, 0xc3, 0xfc, 0xff, 0x13, 0xb6, 0xf3, 0xff, 0x10, 0xb0, 0xec, 0xff, 0x00, 0xb8, 0xea, 0xff, 0x54, 0xbe, 0xe3, 0xff, 0xa2, 0x9a, 0x86, 0xff, 0xd6, 0x87, 0x2d, 0xff, 0xe1, 0x89, 0x36, 0xff, 0xdc, 0x90, 0x34, 0xff, 0xde, 0x8e, 0x33, 0xff, 0xe4, 0x8c, 0x30, 0xff, 0xe2, 0x8b, 0x31, 0xff, 0xdf, 0x8a, 0x31, 0xff, 0xdc, 0x89, 0x32, 0xff, 0xda, 0x89, 0x32, 0xff, 0xd9, 0x89, 0x32, 0xff, 0xd8, 0x89, 0x32, 0xff, 0xd6, 0x87, 0x30, 0xff, 0xd4, 0x88, 0x2a, 0xff, 0xd8, 0x89, 0x28, 0xff, 0xda, 0x8b, 0x29, 0xff, 0xd4, 0x88, 0x29, 0xff, 0xc8, 0x84, 0x27, 0xff, 0xbf, 0x80, 0x2c, 0xff, 0xe2, 0xa8, 0x66, 0xff, 0xfd, 0xc7, 0x8a, 0xff, 0xbe, 0x8a, 0x52, 0xff, 0xd6, 0x9e, 0x61, 0xff, 0xe4, 0xa8, 0x65, 0xff, 0xe2, 0xa5, 0x5e, 0xff, 0xd4, 0x9d, 0x5a, 0xff, 0xc1, 0x81, 0x3c, 0xff, 0xcc, 0x80, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x39, 0xb7, 0xcf, 0xff, 0x06, 0xcc, 0xfe, 0xff, 0x0f, 0xd1, 0xff, 0xff, 0x0e, 0xd3, 0xfe, 0xff, 0x0a, 0xd3, 0xfc, 0xff, 0x09, 0xd4, 0xfe, 0xff, 0x09, 0xd4, 0xff, 0xff, 0x09, 0xd6, 0xfe, 0xff, 0x11, 0xde, 0xff, 0xff, 0x16, 0xe4, 0xff, 0xff, 0x11, 0xde, 0xf6, 0xff, 0x19, 0xca, 0xd7, 0xff, 0x41, 0xc0, 0xbd, 0xff, 0x74, 0xcf, 0xc4, 0xff, 0x80, 0xd6, 0xcd, 0xff, 0x63, 0xbb, 0xba, 0xff, 0x4d, 0xb1, 0xc5, 0xff, 0x4c, 0xd3, 0xf6, 0xff, 0x19, 0xd2, 0xfd, 0xff, 0x00, 0xd0, 0xfc, 0xff, 0x04, 0xce, 0xfb, 0xff, 0x08, 0xcf, 0xff, 0xff, 0x02, 0xca, 0xff, 0xff, 0x09, 0xc9, 0xfe, 0xff, 0x0b, 0xc7, 0xfa, 0xff, 0x10, 0xc8, 0xfc, 0xff, 0x11, 0xc7, 0xfb, 0xff, 0x0d, 0xbe, 0xf3, 0xff, 0x0d, 0xb4, 0xee, 0xff, 0x10, 0xb1, 0xed, 0xff, 0x00, 0xb7, 0xea, 0xff, 0x54, 0xbf, 0xe0, 0xff, 0xa2, 0x9c, 0x82, 0xff, 0xd8, 0x89, 0x2a, 0xff, 0xe3, 0x89, 0x37, 0xff, 0xdc, 0x8c, 0x38, 0xff, 0xdb, 0x8b, 0x36, 0xff, 0xe1, 0x8c, 0x30, 0xff, 0xde, 0x8b, 0x31, 0xff, 0xdb, 0x89, 0x33, 0xff, 0xd9, 0x89, 0x36, 0xff, 0xd6, 0x88, 0x35, 0xff, 0xd3, 0x88, 0x34, 0xff, 0xd5, 0x89, 0x34, 0xff, 0xd7, 0x88, 0x2f, 0xff, 0xd5, 0x88, 0x29, 0xff, 0xd9, 0x8b, 0x2a, 0xff, 0xd8, 0x88, 0x29, 0xff, 0xcd, 0x83, 0x2a, 0xff, 0xc3, 0x82, 0x2a, 0xff, 0xc7, 0x96, 0x53, 0xff, 0xf0, 0xc8, 0x91, 0xff, 0xe7, 0xbe, 0x89, 0xff, 0xb3, 0x84, 0x4f, 0xff, 0xe3, 0xa9, 0x6a, 0xff, 0xe0, 0xa4, 0x5e, 0xff, 0xde, 0xa5, 0x61, 0xff, 0xd0, 0x93, 0x51, 0xff, 0xce, 0x82, 0x37, 0xff, 0xcc, 0x80, 0x33, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0xb7, 0xcf, 0xff, 0x07, 0xcb, 0xfe, 0xff, 0x0f, 0xcf, 0xff, 0xff, 0x0d, 0xd1, 0xfd, 0xff, 0x08, 0xd1, 0xfb, 0xff, 0x08, 0xd2, 0xfe, 0xff, 0x08, 0xd2, 0xff, 0xff, 0x08, 0xd4, 0xfe, 0xff, 0x10, 0xdc, 0xff, 0xff, 0x15, 0xe3, 0xfe, 0xff, 0x11, 0xdf, 0xfa, 0xff, 0x15, 0xcd, 0xdd, 0xff, 0x38, 0xbf, 0xbf, 0xff, 0x66, 0xc7, 0xbc, 0xff, 0x81, 0xda, 0xcc, 0xff, 0x6e, 0xc7, 0xc1, 0xff, 0x4b, 0xa6, 0xb7, 0xff, 0x4c, 0xce, 0xef, 0xff, 0x23, 0xd3, 0xfd, 0xff, 0x00, 0xd2, 0xfb, 0xff, 0x04, 0xcf, 0xfc, 0xff, 0x02, 0xcb, 0xfc, 0xff, 0x03, 0xcc, 0xff, 0xff, 0x09, 0xc8, 0xfd, 0xff, 0x0c, 0xc6, 0xfc, 0xff, 0x12, 0xc8, 0xfd, 0xff, 0x0f, 0xc4, 0xf8, 0xff, 0x08, 0xba, 0xef, 0xff, 0x0b, 0xb5, 0xed, 0xff, 0x0e, 0xb4, 0xee, 0xff, 0x00, 0xb7, 0xea, 0xff, 0x54, 0xbf, 0xe0, 0xff, 0xa4, 0x9d, 0x81, 0xff, 0xda, 0x8b, 0x2a, 0xff, 0xe2, 0x8a, 0x37, 0xff, 0xda, 0x8a, 0x37, 0xff, 0xda, 0x87, 0x37, 0xff, 0xdd, 0x8c, 0x33, 0xff, 0xd9, 0x8a, 0x35, 0xff, 0xd6, 0x88, 0x37, 0xff, 0xd3, 0x88, 0x37, 0xff, 0xd1, 0x88, 0x37, 0xff, 0xce, 0x87, 0x36, 0xff, 0xd1, 0x86, 0x34, 0xff, 0xd4, 0x85, 0x2d, 0xff, 0xd1, 0x83, 0x27, 0xff, 0xd5, 0x87, 0x28, 0xff, 0xd5, 0x85, 0x2c, 0xff, 0xcb, 0x82, 0x30, 0xff, 0xcf, 0x91, 0x44, 0xff, 0xe6, 0xbe, 0x89, 0xff, 0xf2, 0xd3, 0xa4, 0xff, 0xbe, 0x9c, 0x6d, 0xff, 0xb8, 0x8b, 0x52, 0xff, 0xe6, 0xb1, 0x6e, 0xff, 0xde, 0xa4, 0x5e, 0xff, 0xe0, 0xa9, 0x67, 0xff, 0xc9, 0x89, 0x46, 0xff, 0xd5, 0x82, 0x35, 0xff, 0xd5, 0x80, 0x55, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x39, 0xb7, 0xcf, 0xff, 0x06, 0xc9, 0xfc, 0xff, 0x08, 0xc9, 0xfc, 0xff, 0x08, 0xcb, 0xfc, 0xff, 0x06, 0xcb, 0xfe, 0xff, 0x08, 0xcb, 0xff, 0xff, 0x06, 0xcb, 0xff, 0xff, 0x08, 0xd0, 0xff, 0xff, 0x0f, 0xd9, 0xff, 0xff, 0x13, 0xde, 0xff, 0xff, 0x12, 0xe0, 0xfe, 0xff, 0x08, 0xd1, 0xe6, 0xff, 0x25, 0xc6, 0xcb, 0xff, 0x50, 0xbd, 0xb7, 0xff, 0x78, 0xcf, 0xc0, 0xff, 0x7f, 0xd8, 0xca, 0xff, 0x56, 0xab, 0xb3, 0xff, 0x43, 0xc3, 0xe0, 0xff, 0x2c, 0xd6, 0xff, 0xff, 0x0c, 0xcf, 0xfd, 0xff, 0x02, 0xcf, 0xfd, 0xff, 0x00, 0xcf, 0xfb, 0xff, 0x02, 0xce, 0xfc, 0xff, 0x03, 0xcb, 0xfb, 0xff, 0x0a, 0xcb, 0xfd, 0xff, 0x0f, 0xc6, 0xfa, 0xff, 0x11, 0xbf, 0xf4, 0xff, 0x0f, 0xb8, 0xef, 0xff, 0x10, 0xb6, 0xed, 0xff, 0x0f, 0xb6, 0xea, 0xff, 0x02, 0xb8, 0xe6, 0xff, 0x57, 0xbc, 0xe1, 0xff, 0x9e, 0x9b, 0x84, 0xff, 0xd7, 0x87, 0x2a, 0xff, 0xdc, 0x8b, 0x33, 0xff, 0xd5, 0x8d, 0x33, 0xff, 0xdb, 0x87, 0x34, 0xff, 0xdb, 0x89, 0x34, 0xff, 0xd4, 0x8a, 0x37, 0xff, 0xcf, 0x89, 0x36, 0xff, 0xcf, 0x88, 0x31, 0xff, 0xd0, 0x88, 0x2e, 0xff, 0xd1, 0x87, 0x31, 0xff, 0xcd, 0x84, 0x2f, 0xff, 0xd2, 0x87, 0x2e, 0xff, 0xd5, 0x86, 0x2a, 0xff, 0xd6, 0x85, 0x29, 0xff, 0xca, 0x80, 0x2d, 0xff, 0xbf, 0x87, 0x47, 0xff, 0xdc, 0xb2, 0x82, 0xff, 0xec, 0xcf, 0xa8, 0xff, 0xde, 0xc1, 0x92, 0xff, 0xb8, 0x8b, 0x4a, 0xff, 0xd5, 0xa5, 0x59, 0xff, 0xd7, 0xac, 0x66, 0xff, 0xcf, 0xa4, 0x64, 0xff, 0xd5, 0xa5, 0x63, 0xff, 0xc8, 0x84, 0x3c, 0xff, 0xcf, 0x80, 0x30, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0xb7, 0xcf, 0xff, 0x05, 0xc8, 0xfb, 0xff, 0x07, 0xc7, 0xfc, 0xff, 0x07, 0xc9, 0xfc, 0xff, 0x04, 0xc7, 0xfd, 0xff, 0x05, 0xc7, 0xff, 0xff, 0x03, 0xc7, 0xff, 0xff, 0x04, 0xcb, 0xfd, 0xff, 0x09, 0xd3, 0xfe, 0xff, 0x0c, 0xdb, 0xff, 0xff, 0x0b, 0xe1, 0xff, 0xff, 0x03, 0xd8, 0xec, 0xff, 0x18, 0xc9, 0xd1, 0xff, 0x3e, 0xb6, 0xb6, 0xff, 0x69, 0xc7, 0xbe, 0xff, 0x7d, 0xde, 0xd2, 0xff, 0x5c, 0xbf, 0xbd, 0xff, 0x3b, 0xae, 0xc7, 0xff, 0x36, 0xd5, 0xf9, 0xff, 0x15, 0xc9, 0xf9, 0xff, 0x04, 0xd1, 0xff, 0xff, 0x02, 0xd2, 0xff, 0xff, 0x06, 0xc9, 0xfb, 0xff, 0x06, 0xcc, 0xfb, 0xff, 0x09, 0xc9, 0xfa, 0xff, 0x0d, 0xc3, 0xf6, 0xff, 0x0e, 0xbc, 0xf1, 0xff, 0x0f, 0xb7, 0xed, 0xff, 0x12, 0xb6, 0xec, 0xff, 0x0f, 0xb6, 0xea, 0xff, 0x00, 0xb8, 0xe7, 0xff, 0x57, 0xbd, 0xdf, 0xff, 0xa0, 0x9b, 0x81, 0xff, 0xdb, 0x87, 0x26, 0xff, 0xdd, 0x89, 0x32, 0xff, 0xd3, 0x8a, 0x34, 0xff, 0xd8, 0x87, 0x33, 0xff, 0xd6, 0x88, 0x2f, 0xff, 0xd0, 0x89, 0x33, 0xff, 0xce, 0x87, 0x32, 0xff, 0xcf, 0x85, 0x2d, 0xff, 0xd0, 0x84, 0x2c, 0xff, 0xd1, 0x84, 0x30, 0xff, 0xd2, 0x84, 0x31, 0xff, 0xcf, 0x80, 0x29, 0xff, 0xd0, 0x86, 0x2a, 0xff, 0xc5, 0x82, 0x26, 0xff, 0xbd, 0x8a, 0x3e, 0xff, 0xd6, 0xb3, 0x7e, 0xff, 0xdc, 0xc4, 0xa5, 0xff, 0xd9, 0xc7, 0xa4, 0xff, 0xc3, 0xa8, 0x72, 0xff, 0xbf, 0x8a, 0x42, 0xff, 0xf3, 0xb2, 0x63, 0xff, 0xe6, 0xa7, 0x5e, 0xff, 0xda, 0xa5, 0x61, 0xff, 0xc7, 0x9a, 0x56, 0xff, 0xc6, 0x80, 0x37, 0xff, 0xd7, 0x86, 0x36, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0xb6, 0xce, 0xff, 0x05, 0xc8, 0xfc, 0xff, 0x07, 0xc6, 0xfe, 0xff, 0x08, 0xc8, 0xfe, 0xff, 0x07, 0xc6, 0xfe, 0xff, 0x05, 0xc6, 0xff, 0xff, 0x02, 0xc4, 0xff, 0xff, 0x02, 0xc7, 0xfc, 0xff, 0x08, 0xd1, 0xfe, 0xff, 0x08, 0xd9, 0xff, 0xff, 0x06, 0xe1, 0xfe, 0xff, 0x00, 0xe0, 0xf4, 0xff, 0x0f, 0xcf, 0xdd, 0xff, 0x28, 0xb0, 0xba, 0xff, 0x53, 0xb6, 0xb9, 0xff, 0x73, 0xdb, 0xd2, 0xff, 0x66, 0xd1, 0xc6, 0xff, 0x4f, 0xaf, 0xbf, 0xff, 0x3d, 0xc2, 0xe6, 0xff, 0x2d, 0xd1, 0xfd, 0xff, 0x05, 0xce, 0xfc, 0xff, 0x05, 0xcd, 0xfb, 0xff, 0x11, 0xce, 0xfe, 0xff, 0x07, 0xcc, 0xfc, 0xff, 0x08, 0xc8, 0xf9, 0xff, 0x0b, 0xc2, 0xf4, 0xff, 0x0c, 0xbb, 0xee, 0xff, 0x0f, 0xb7, 0xeb, 0xff, 0x13, 0xb6, 0xea, 0xff, 0x0e, 0xb6, 0xea, 0xff, 0x00, 0xb8, 0xe7, 0xff, 0x58, 0xbe, 0xde, 0xff, 0xa3, 0x9c, 0x80, 0xff, 0xde, 0x89, 0x23, 0xff, 0xde, 0x89, 0x31, 0xff, 0xd1, 0x8a, 0x37, 0xff, 0xd8, 0x88, 0x38, 0xff, 0xd9, 0x8a, 0x31, 0xff, 0xd3, 0x88, 0x31, 0xff, 0xd2, 0x87, 0x2e, 0xff, 0xd4, 0x87, 0x29, 0xff, 0xd5, 0x86, 0x28, 0xff, 0xd3, 0x85, 0x2b, 0xff, 0xd2, 0x86, 0x2e, 0xff, 0xcb, 0x83, 0x2c, 0xff, 0xc0, 0x81, 0x2d, 0xff, 0xbd, 0x8c, 0x43, 0xff, 0xd6, 0xb7, 0x79, 0xff, 0xdb, 0xc7, 0x98, 0xff, 0xcb, 0xc3, 0xa3, 0xff, 0xca, 0xba, 0x92, 0xff, 0xb1, 0x8d, 0x50, 0xff, 0xe0, 0xa6, 0x5d, 0xff, 0xf1, 0xa8, 0x5b, 0xff, 0xeb, 0xa2, 0x58, 0xff, 0xe2, 0xa1, 0x5c, 0xff, 0xc2, 0x8a, 0x46, 0xff, 0xbf, 0x7d, 0x36, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x39, 0xb7, 0xcf, 0xff, 0x04, 0xc7, 0xfc, 0xff, 0x06, 0xc5, 0xff, 0xff, 0x08, 0xc7, 0xff, 0xff, 0x07, 0xc5, 0xff, 0xff, 0x08, 0xc5, 0xff, 0xff, 0x04, 0xc4, 0xff, 0xff, 0x02, 0xc7, 0xfc, 0xff, 0x08, 0xd1, 0xff, 0xff, 0x09, 0xd8, 0xfe, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x01, 0xe5, 0xfa, 0xff, 0x0d, 0xd7, 0xec, 0xff, 0x1f, 0xb1, 0xc6, 0xff, 0x3c, 0xa4, 0xb3, 0xff, 0x63, 0xcf, 0xce, 0xff, 0x72, 0xdc, 0xd2, 0xff, 0x6a, 0xbf, 0xc7, 0xff, 0x3e, 0xa9, 0xc5, 0xff, 0x39, 0xcd, 0xf5, 0xff, 0x17, 0xd6, 0xfe, 0xff, 0x03, 0xcb, 0xf8, 0xff, 0x0d, 0xce, 0xfd, 0xff, 0x08, 0xcc, 0xfc, 0xff, 0x08, 0xc7, 0xf8, 0xff, 0x0a, 0xc2, 0xf3, 0xff, 0x0c, 0xbe, 0xef, 0xff, 0x0f, 0xba, 0xec, 0xff, 0x13, 0xb7, 0xe9, 0xff, 0x0e, 0xb6, 0xe6, 0xff, 0x00, 0xb8, 0xe4, 0xff, 0x57, 0xbd, 0xdb, 0xff, 0xa4, 0x9b, 0x7e, 0xff, 0xde, 0x89, 0x24, 0xff, 0xdc, 0x8a, 0x32, 0xff, 0xd1, 0x8a, 0x38, 0xff, 0xd7, 0x87, 0x3a, 0xff, 0xd9, 0x87, 0x31, 0xff, 0xd5, 0x84, 0x2f, 0xff, 0xd6, 0x87, 0x2d, 0xff, 0xd9, 0x8a, 0x29, 0xff, 0xd5, 0x89, 0x25, 0xff, 0xd0, 0x89, 0x27, 0xff, 0xc4, 0x84, 0x28, 0xff, 0xb7, 0x80, 0x2f, 0xff, 0xc4, 0x96, 0x58, 0xff, 0xdd, 0xba, 0x8b, 0xff, 0xdc, 0xc3, 0x97, 0xff, 0xd6, 0xc3, 0x92, 0xff, 0xd8, 0xc8, 0x8e, 0xff, 0xc2, 0xa3, 0x69, 0xff, 0xc1, 0x8b, 0x4d, 0xff, 0xea, 0xb0, 0x6b, 0xff, 0xe1, 0xa2, 0x5b, 0xff, 0xe8, 0xa3, 0x5e, 0xff, 0xe1, 0x99, 0x57, 0xff, 0xc6, 0x78, 0x36, 0xff, 0xcc, 0x80, 0x3d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0xb6, 0xce, 0xff, 0x03, 0xc6, 0xfb, 0xff, 0x04, 0xc4, 0xff, 0xff, 0x08, 0xc5, 0xfe, 0xff, 0x08, 0xc4, 0xfe, 0xff, 0x07, 0xc4, 0xff, 0xff, 0x03, 0xc3, 0xff, 0xff, 0x01, 0xc6, 0xfc, 0xff, 0x06, 0xd0, 0xfe, 0xff, 0x0a, 0xd8, 0xfd, 0xff, 0x06, 0xde, 0xfb, 0xff, 0x03, 0xe6, 0xfd, 0xff, 0x12, 0xdf, 0xfa, 0xff, 0x20, 0xbb, 0xd9, 0xff, 0x28, 0x9c, 0xb1, 0xff, 0x48, 0xc0, 0xc5, 0xff, 0x68, 0xd6, 0xd0, 0xff, 0x7a, 0xd1, 0xd4, 0xff, 0x55, 0xb5, 0xc2, 0xff, 0x33, 0xb4, 0xd1, 0xff, 0x24, 0xd2, 0xf9, 0xff, 0x06, 0xd0, 0xfa, 0xff, 0x08, 0xcb, 0xf9, 0xff, 0x06, 0xcb, 0xfb, 0xff, 0x06, 0xc7, 0xf7, 0xff, 0x07, 0xc3, 0xf2, 0xff, 0x0b, 0xc0, 0xee, 0xff, 0x0f, 0xbd, 0xec, 0xff, 0x12, 0xb8, 0xe8, 0xff, 0x10, 0xb6, 0xe3, 0xff, 0x00, 0xb8, 0xdf, 0xff, 0x57, 0xbc, 0xda, 0xff, 0xa0, 0x9a, 0x7f, 0xff, 0xd9, 0x87, 0x27, 0xff, 0xd9, 0x89, 0x32, 0xff, 0xd0, 0x8a, 0x35, 0xff, 0xd8, 0x87, 0x37, 0xff, 0xda, 0x88, 0x34, 0xff, 0xd5, 0x85, 0x32, 0xff, 0xd3, 0x85, 0x2f, 0xff, 0xd0, 0x84, 0x29, 0xff, 0xc3, 0x80, 0x25, 0xff, 0xb9, 0x80, 0x27, 0xff, 0xb5, 0x88, 0x3b, 0xff, 0xc7, 0xa6, 0x6a, 0xff, 0xd9, 0xc0, 0x94, 0xff, 0xd5, 0xc1, 0xa2, 0xff, 0xcf, 0xba, 0x99, 0xff, 0xe2, 0xc6, 0x92, 0xff, 0xd4, 0xaf, 0x67, 0xff, 0xbf, 0x8a, 0x3c, 0xff, 0xe6, 0xab, 0x6a, 0xff, 0xde, 0xa8, 0x69, 0xff, 0xd3, 0x9f, 0x60, 0xff, 0xe1, 0xa3, 0x63, 0xff, 0xcf, 0x82, 0x3f, 0xff, 0xc5, 0x70, 0x2a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x36, 0xb5, 0xcc, 0xff, 0x01, 0xc5, 0xf9, 0xff, 0x05, 0xc5, 0xfe, 0xff, 0x08, 0xc6, 0xfd, 0xff, 0x09, 0xc3, 0xfd, 0xff, 0x09, 0xc3, 0xff, 0xff, 0x03, 0xc2, 0xfe, 0xff, 0x01, 0xc6, 0xfb, 0xff, 0x04, 0xd1, 0xfe, 0xff, 0x06, 0xd9, 0xfe, 0xff, 0x05, 0xdf, 0xfa, 0xff, 0x02, 0xe7, 0xfd, 0xff, 0x13, 0xe4, 0xff, 0xff, 0x22, 0xc7, 0xea, 0xff, 0x1c, 0x9e, 0xb7, 0xff, 0x2f, 0xb5, 0xbf, 0xff, 0x4b, 0xc5, 0xc4, 0xff, 0x75, 0xd8, 0xd5, 0xff, 0x6a, 0xce, 0xce, 0xff, 0x43, 0xb3, 0xc7, 0xff, 0x1c, 0xb9, 0xdd, 0xff, 0x0c, 0xca, 0xf5, 0xff, 0x0c, 0xce, 0xfc, 0xff, 0x03, 0xcc, 0xfa, 0xff, 0x02, 0xc6, 0xf5, 0xff, 0x02, 0xc2, 0xef, 0xff, 0x07, 0xc0, 0xee, 0xff, 0x0e, 0xbf, 0xec, 0xff, 0x12, 0xba, 0xe9, 0xff, 0x13, 0xb9, 0xe1, 0xff, 0x10, 0xbd, 0xde, 0xff, 0x59, 0xc0, 0xde, 0xff, 0x9f, 0x9d, 0x83, 0xff, 0xd6, 0x89, 0x27, 0xff, 0xd8, 0x8a, 0x32, 0xff, 0xd1, 0x8c, 0x33, 0xff, 0xd8, 0x8a, 0x33, 0xff, 0xd5, 0x8b, 0x2e, 0xff, 0xcf, 0x85, 0x30, 0xff, 0xca, 0x81, 0x2f, 0xff, 0xc2, 0x7e, 0x2b, 0xff, 0xbf, 0x86, 0x3d, 0xff, 0xc5, 0x9a, 0x60, 0xff, 0xd4, 0xb3, 0x87, 0xff, 0xe7, 0xd1, 0xaa, 0xff, 0xe0, 0xd7, 0xb5, 0xff, 0xd3, 0xd1, 0xb3, 0xff, 0xe2, 0xd6, 0xb2, 0xff, 0xd5, 0xb2, 0x7f, 0xff, 0xc6, 0x8a, 0x43, 0xff, 0xdf, 0xa5, 0x52, 0xff, 0xe6, 0xb5, 0x65, 0xff, 0xd3, 0xa3, 0x61, 0xff, 0xd9, 0xa3, 0x67, 0xff, 0xd6, 0x98, 0x58, 0xff, 0xc1, 0x75, 0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0xb1, 0xce, 0xff, 0x02, 0xc1, 0xfa, 0xff, 0x04, 0xc4, 0xfe, 0xff, 0x07, 0xc5, 0xfd, 0xff, 0x07, 0xc4, 0xfe, 0xff, 0x08, 0xc3, 0xff, 0xff, 0x04, 0xc2, 0xfe, 0xff, 0x01, 0xc5, 0xfb, 0xff, 0x05, 0xd0, 0xfd, 0xff, 0x05, 0xda, 0xfe, 0xff, 0x03, 0xdf, 0xfc, 0xff, 0x00, 0xe4, 0xfe, 0xff, 0x13, 0xe6, 0xff, 0xff, 0x2a, 0xcd, 0xee, 0xff, 0x16, 0xa6, 0xc0, 0xff, 0x1b, 0xb7, 0xc5, 0xff, 0x2d, 0xb7, 0xbd, 0xff, 0x59, 0xcc, 0xce, 0xff, 0x72, 0xd7, 0xd5, 0xff, 0x6a, 0xcd, 0xcf, 0xff, 0x3b, 0xb5, 0xc7, 0xff, 0x19, 0xbd, 0xdf, 0xff, 0x14, 0xc8, 0xf7, 0xff, 0x05, 0xc9, 0xfc, 0xff, 0x00, 0xc4, 0xf3, 0xff, 0x02, 0xc2, 0xed, 0xff, 0x12, 0xc4, 0xec, 0xff, 0x11, 0xbe, 0xe7, 0xff, 0x0e, 0xb8, 0xea, 0xff, 0x1a, 0xbb, 0xec, 0xff, 0x26, 0xba, 0xe0, 0xff, 0x6c, 0xbf, 0xdc, 0xff, 0x90, 0x95, 0x89, 0xff, 0xb9, 0x7e, 0x40, 0xff, 0xca, 0x85, 0x41, 0xff, 0xc6, 0x83, 0x36, 0xff, 0xca, 0x86, 0x39, 0xff, 0xc5, 0x86, 0x37, 0xff, 0xbe, 0x81, 0x3b, 0xff, 0xc0, 0x86, 0x50, 0xff, 0xc6, 0x95, 0x6f, 0xff, 0xcf, 0xab, 0x8b, 0xff, 0xd9, 0xc2, 0xa3, 0xff, 0xe3, 0xd5, 0xb9, 0xff, 0xe9, 0xe0, 0xcc, 0xff, 0xeb, 0xe5, 0xd6, 0xff, 0xf5, 0xf4, 0xd9, 0xff, 0xd9, 0xd4, 0xa6, 0xff, 0xb0, 0x95, 0x5d, 0xff, 0xd1, 0x9a, 0x72, 0xff, 0xe2, 0xa8, 0x74, 0xff, 0xcc, 0xa0, 0x58, 0xff, 0xc9, 0x9f, 0x64, 0xff, 0xcc, 0x98, 0x70, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3b, 0xae, 0xd1, 0xff, 0x04, 0xbd, 0xfc, 0xff, 0x03, 0xc2, 0xfd, 0xff, 0x06, 0xc3, 0xfe, 0xff, 0x05, 0xc3, 0xfe, 0xff, 0x06, 0xc3, 0xff, 0xff, 0x02, 0xc2, 0xfe, 0xff, 0x00, 0xc5, 0xfa, 0xff, 0x07, 0xd0, 0xfd, 0xff, 0x08, 0xd9, 0xff, 0xff, 0x02, 0xdd, 0xff, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x13, 0xe7, 0xff, 0xff, 0x31, 0xd2, 0xef, 0xff, 0x16, 0xb2, 0xce, 0xff, 0x0b, 0xc1, 0xd7, 0xff, 0x15, 0xae, 0xc2, 0xff, 0x2e, 0xb4, 0xc5, 0xff, 0x61, 0xcd, 0xcf, 0xff, 0x77, 0xdb, 0xcf, 0xff, 0x61, 0xce, 0xc5, 0xff, 0x3c, 0xbd, 0xca, 0xff, 0x26, 0xb8, 0xdf, 0xff, 0x12, 0xc6, 0xf8, 0xff, 0x03, 0xca, 0xfb, 0xff, 0x08, 0xc2, 0xf4, 0xff, 0x19, 0xc2, 0xf0, 0xff, 0x10, 0xbb, 0xea, 0xff, 0x1a, 0xb8, 0xf6, 0xff, 0x1d, 0xa0, 0xe8, 0xff, 0x1c, 0x80, 0xc4, 0xff, 0x53, 0x84, 0xb9, 0xff, 0x64, 0x69, 0x94, 0xff, 0x83, 0x61, 0x7b, 0xff, 0x99, 0x65, 0x6f, 0xff, 0x9a, 0x63, 0x6d, 0xff, 0x98, 0x65, 0x70, 0xff, 0x8f, 0x61, 0x6b, 0xff, 0x95, 0x6a, 0x71, 0xff, 0x9a, 0x75, 0x7a, 0xff, 0x9e, 0x81, 0x87, 0xff, 0xa4, 0x91, 0x99, 0xff, 0xae, 0xa6, 0xac, 0xff, 0xc5, 0xc4, 0xc0, 0xff, 0xeb, 0xe7, 0xe4, 0xff, 0xf6, 0xe7, 0xf2, 0xff, 0xde, 0xcc, 0xd0, 0xff, 0xaa, 0x9b, 0x91, 0xff, 0xa9, 0x91, 0x8f, 0xff, 0xb7, 0x8e, 0xa2, 0xff, 0xae, 0x7f, 0x9d, 0xff, 0xae, 0x8a, 0x89, 0xff, 0xaa, 0x8a, 0x7c, 0xff, 0x8b, 0x64, 0x79, 0xff, 0x7d, 0x5a, 0x90, 0xff, 0x84, 0x65, 0x8e, 0xff, 0x8e, 0x61, 0x94, 0xff, 0x90, 0x5d, 0x98, 0xff, 0x8e, 0x63, 0x96, 0xff, 0x92, 0x65, 0x90, 0xff, 0x8e, 0x67, 0x84, 0xff, 0x98, 0x71, 0x88, 0xff, 0x94, 0x69, 0x88, 0xff, 0x94, 0x65, 0x92, 0xff, 0x9a, 0x67, 0x9c, 0xff, 0x90, 0x5f, 0x8e, 0xff, 0x94, 0x65, 0x8e, 0xff, 0x94, 0x65, 0x96, 0xff, 0x96, 0x67, 0xa0, 0xff, 0x94, 0x65, 0x9e, 0xff, 0x8c, 0x61, 0x98, 0xff, 0x94, 0x6f, 0x88, 0xff, 0x8e, 0x65, 0x94, 0xff, 0x8a, 0x61, 0x84, 0xff, 0x95, 0x6a, 0x95, 0xff, 0x98, 0x60, 0x83, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3b, 0xad, 0xd0, 0xff, 0x02, 0xbc, 0xfa, 0xff, 0x03, 0xc1, 0xfd, 0xff, 0x06, 0xc3, 0xfe, 0xff, 0x06, 0xc2, 0xfe, 0xff, 0x06, 0xc3, 0xff, 0xff, 0x02, 0xc2, 0xfe, 0xff, 0x00, 0xc5, 0xfa, 0xff, 0x06, 0xce, 0xfc, 0xff, 0x08, 0xd7, 0xff, 0xff, 0x02, 0xde, 0xfe, 0xff, 0x00, 0xe4, 0xfb, 0xff, 0x10, 0xea, 0xff, 0xff, 0x2d, 0xd6, 0xf2, 0xff, 0x16, 0xbc, 0xdc, 0xff, 0x0f, 0xcd, 0xeb, 0xff, 0x0c, 0xad, 0xd0, 0xff, 0x11, 0xa9, 0xc2, 0xff, 0x3b, 0xbe, 0xc2, 0xff, 0x61, 0xd3, 0xc6, 0xff, 0x70, 0xdb, 0xc9, 0xff, 0x69, 0xcf, 0xc9, 0xff, 0x4f, 0xbc, 0xca, 0xff, 0x1e, 0xb5, 0xd7, 0xff, 0x05, 0xc7, 0xee, 0xff, 0x1b, 0xc6, 0xfb, 0xff, 0x18, 0xb7, 0xf5, 0xff, 0x15, 0xba, 0xfd, 0xff, 0x16, 0x97, 0xe7, 0xff, 0x10, 0x56, 0xbc, 0xff, 0x30, 0x4b, 0xc4, 0xff, 0x52, 0x5f, 0xd7, 0xff, 0x65, 0x60, 0xd0, 0xff, 0x72, 0x5f, 0xc4, 0xff, 0x7a, 0x63, 0xbf, 0xff, 0x78, 0x63, 0xbd, 0xff, 0x6e, 0x5b, 0xb9, 0xff, 0x6f, 0x5d, 0xb9, 0xff, 0x70, 0x5f, 0xad, 0xff, 0x70, 0x5f, 0xa0, 0xff, 0x71, 0x61, 0x9c, 0xff, 0x86, 0x7a, 0xab, 0xff, 0xad, 0xa4, 0xcc, 0xff, 0xcd, 0xca, 0xe3, 0xff, 0xd7, 0xd2, 0xe6, 0xff, 0xc9, 0xb8, 0xd9, 0xff, 0xb1, 0x9b, 0xca, 0xff, 0xab, 0x9a, 0xce, 0xff, 0xa1, 0x97, 0xcd, 0xff, 0x99, 0x93, 0xcd, 0xff, 0x9d, 0x96, 0xd4, 0xff, 0x9a, 0x92, 0xb7, 0xff, 0x8c, 0x81, 0x8e, 0xff, 0x87, 0x79, 0xa6, 0xff, 0x96, 0x8e, 0xdc, 0xff, 0x94, 0x90, 0xe8, 0xff, 0xa2, 0x8d, 0xf1, 0xff, 0x9c, 0x85, 0xf1, 0xff, 0x96, 0x89, 0xf1, 0xff, 0x96, 0x8e, 0xf1, 0xff, 0x94, 0x90, 0xea, 0xff, 0x9a, 0x95, 0xe8, 0xff, 0x9b, 0x93, 0xeb, 0xff, 0xa0, 0x8f, 0xf1, 0xff, 0x9f, 0x91, 0xf2, 0xff, 0x9e, 0x97, 0xeb, 0xff, 0xa2, 0x9a, 0xea, 0xff, 0x9e, 0x8f, 0xf1, 0xff, 0x9d, 0x8c, 0xf2, 0xff, 0x98, 0x8e, 0xee, 0xff, 0x93, 0x8a, 0xee, 0xff, 0x92, 0x8c, 0xf0, 0xff, 0x8f, 0x85, 0xeb, 0xff, 0x97, 0x92, 0xef, 0xff, 0x7b, 0x75, 0xe4, 0xff, 0x63, 0x44, 0x97, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x39, 0xac, 0xce, 0xff, 0x01, 0xba, 0xf9, 0xff, 0x03, 0xc0, 0xfc, 0xff, 0x07, 0xc3, 0xfe, 0xff, 0x06, 0xc1, 0xfe, 0xff, 0x05, 0xc1, 0xff, 0xff, 0x02, 0xc2, 0xfe, 0xff, 0x01, 0xc4, 0xfa, 0xff, 0x06, 0xcc, 0xfc, 0xff, 0x09, 0xd5, 0xff, 0xff, 0x03, 0xdf, 0xfd, 0xff, 0x00, 0xe6, 0xf9, 0xff, 0x0d, 0xeb, 0xfc, 0xff, 0x25, 0xd6, 0xf2, 0xff, 0x0f, 0xbf, 0xe3, 0xff, 0x08, 0xd6, 0xfc, 0xff, 0x04, 0xbd, 0xe9, 0xff, 0x02, 0xad, 0xd0, 0xff, 0x1c, 0xaf, 0xbf, 0xff, 0x3b, 0xbb, 0xb8, 0xff, 0x62, 0xd2, 0xc6, 0xff, 0x73, 0xd9, 0xd0, 0xff, 0x61, 0xc7, 0xc4, 0xff, 0x2b, 0xaf, 0xb2, 0xff, 0x11, 0xb5, 0xbf, 0xff, 0x20, 0xbc, 0xd8, 0xff, 0x2b, 0xbc, 0xee, 0xff, 0x13, 0x94, 0xdd, 0xff, 0x0a, 0x4b, 0xb2, 0xff, 0x4a, 0x4b, 0xcc, 0xff, 0x67, 0x5d, 0xeb, 0xff, 0x60, 0x58, 0xe5, 0xff, 0x60, 0x5b, 0xde, 0xff, 0x5b, 0x5d, 0xcf, 0xff, 0x5a, 0x61, 0xc3, 0xff, 0x59, 0x62, 0xbc, 0xff, 0x58, 0x62, 0xb9, 0xff, 0x5d, 0x64, 0xbd, 0xff, 0x68, 0x68, 0xc5, 0xff, 0x7b, 0x74, 0xd3, 0xff, 0x8e, 0x82, 0xdd, 0xff, 0x9b, 0x8f, 0xd9, 0xff, 0xa5, 0x9d, 0xd0, 0xff, 0x9f, 0x9d, 0xc7, 0xff, 0x96, 0x97, 0xc4, 0xff, 0x92, 0x93, 0xc9, 0xff, 0x90, 0x92, 0xdc, 0xff, 0x87, 0x8c, 0xe8, 0xff, 0x7d, 0x88, 0xdf, 0xff, 0x81, 0x96, 0xd5, 0xff, 0x92, 0x9d, 0xc6, 0xff, 0xa6, 0xa8, 0xb8, 0xff, 0xad, 0xaf, 0xb0, 0xff, 0xa0, 0x9e, 0xb3, 0xff, 0x97, 0x97, 0xc7, 0xff, 0x86, 0x8a, 0xc8, 0xff, 0x7f, 0x7c, 0xce, 0xff, 0x97, 0x96, 0xf4, 0xff, 0x94, 0x9b, 0xff, 0xff, 0x88, 0x91, 0xff, 0xff, 0x89, 0x96, 0xff, 0xff, 0x89, 0x95, 0xff, 0xff, 0x92, 0x99, 0xfe, 0xff, 0x9c, 0x9b, 0xfe, 0xff, 0x8e, 0x95, 0xf9, 0xff, 0x8e, 0x9d, 0xfa, 0xff, 0x94, 0x9e, 0xfb, 0xff, 0x93, 0x95, 0xfd, 0xff, 0x94, 0x96, 0xff, 0xff, 0x91, 0x96, 0xfd, 0xff, 0x89, 0x93, 0xfc, 0xff, 0x80, 0x8a, 0xff, 0xff, 0x8c, 0x95, 0xff, 0xff, 0x72, 0x7c, 0xfa, 0xff, 0x36, 0x34, 0xd0, 0xff, 0x56, 0x38, 0x7b, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x39, 0xab, 0xce, 0xff, 0x00, 0xb9, 0xf8, 0xff, 0x04, 0xc0, 0xfc, 0xff, 0x08, 0xc3, 0xff, 0xff, 0x05, 0xc1, 0xfd, 0xff, 0x05, 0xbf, 0xfe, 0xff, 0x04, 0xc1, 0xff, 0xff, 0x02, 0xc4, 0xfc, 0xff, 0x06, 0xcc, 0xfc, 0xff, 0x09, 0xd4, 0xff, 0xff, 0x05, 0xdd, 0xfd, 0xff, 0x01, 0xe7, 0xfa, 0xff, 0x0c, 0xeb, 0xfd, 0xff, 0x22, 0xd6, 0xf2, 0xff, 0x0a, 0xc0, 0xe3, 0xff, 0x04, 0xdf, 0xff, 0xff, 0x02, 0xd2, 0xfa, 0xff, 0x02, 0xbc, 0xe4, 0xff, 0x0a, 0xad, 0xca, 0xff, 0x19, 0xa9, 0xbb, 0xff, 0x37, 0xbb, 0xc3, 0xff, 0x4c, 0xc9, 0xcf, 0xff, 0x46, 0xc4, 0xc1, 0xff, 0x3b, 0xbe, 0xa9, 0xff, 0x36, 0xb6, 0xa7, 0xff, 0x31, 0xb4, 0xb5, 0xff, 0x22, 0x95, 0xb4, 0xff, 0x1d, 0x56, 0xa3, 0xff, 0x50, 0x52, 0xc0, 0xff, 0x6f, 0x5f, 0xe0, 0xff, 0x6d, 0x5a, 0xe4, 0xff, 0x64, 0x57, 0xe2, 0xff, 0x67, 0x61, 0xe4, 0xff, 0x64, 0x64, 0xd8, 0xff, 0x6b, 0x6d, 0xd1, 0xff, 0x72, 0x70, 0xca, 0xff, 0x7e, 0x7a, 0xd2, 0xff, 0x80, 0x7c, 0xd3, 0xff, 0x86, 0x7f, 0xd5, 0xff, 0x8c, 0x81, 0xd7, 0xff, 0x8d, 0x80, 0xd3, 0xff, 0x8a, 0x7e, 0xc6, 0xff, 0x88, 0x7f, 0xb5, 0xff, 0x8b, 0x81, 0xb9, 0xff, 0x93, 0x8d, 0xce, 0xff, 0x8d, 0x91, 0xdd, 0xff, 0x6e, 0x77, 0xe0, 0xff, 0x55, 0x5c, 0xdb, 0xff, 0x5f, 0x61, 0xce, 0xff, 0x7c, 0x7a, 0xbd, 0xff, 0xb2, 0xad, 0xc2, 0xff, 0xe0, 0xe2, 0xe7, 0xff, 0xd2, 0xda, 0xe2, 0xff, 0xc1, 0xc0, 0xce, 0xff, 0xa0, 0x95, 0xa1, 0xff, 0x81, 0x79, 0x7f, 0xff, 0x58, 0x5c, 0x6e, 0xff, 0x6e, 0x75, 0xa2, 0xff, 0x98, 0x9b, 0xde, 0xff, 0x99, 0x9b, 0xf9, 0xff, 0x90, 0x92, 0xff, 0xff, 0x8e, 0x8f, 0xfe, 0xff, 0x92, 0x94, 0xf8, 0xff, 0x9e, 0x9d, 0xf0, 0xff, 0x98, 0x9c, 0xf5, 0xff, 0x91, 0x92, 0xff, 0xff, 0x91, 0x8d, 0xfd, 0xff, 0x99, 0x97, 0xfb, 0xff, 0x98, 0x97, 0xfa, 0xff, 0x90, 0x8d, 0xf9, 0xff, 0x8e, 0x90, 0xf5, 0xff, 0x93, 0x94, 0xfd, 0xff, 0x73, 0x75, 0xf1, 0xff, 0x3a, 0x2c, 0xcc, 0xff, 0x6d, 0x44, 0x99, 0xff, 0x98, 0x60, 0x75, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0xab, 0xcd, 0xff, 0x00, 0xb9, 0xf8, 0xff, 0x03, 0xbe, 0xfc, 0xff, 0x08, 0xc2, 0xff, 0xff, 0x06, 0xbf, 0xfd, 0xff, 0x05, 0xbf, 0xff, 0xff, 0x04, 0xc0, 0xff, 0xff, 0x02, 0xc3, 0xfc, 0xff, 0x04, 0xca, 0xfa, 0xff, 0x06, 0xd3, 0xfd, 0xff, 0x05, 0xdc, 0xfd, 0xff, 0x04, 0xe5, 0xfd, 0xff, 0x10, 0xea, 0xff, 0xff, 0x23, 0xd5, 0xf2, 0xff, 0x0b, 0xc1, 0xe2, 0xff, 0x03, 0xdf, 0xff, 0xff, 0x00, 0xd6, 0xfd, 0xff, 0x08, 0xcf, 0xf7, 0xff, 0x08, 0xc1, 0xe7, 0xff, 0x01, 0xae, 0xd1, 0xff, 0x03, 0xa9, 0xc4, 0xff, 0x19, 0xb1, 0xc7, 0xff, 0x2b, 0xb8, 0xbf, 0xff, 0x3e, 0xbe, 0xb1, 0xff, 0x4c, 0xb9, 0xb6, 0xff, 0x36, 0x8f, 0x9c, 0xff, 0x2e, 0x5b, 0x8c, 0xff, 0x5b, 0x5d, 0xaf, 0xff, 0x6f, 0x66, 0xc8, 0xff, 0x6f, 0x69, 0xd0, 0xff, 0x6b, 0x64, 0xd2, 0xff, 0x6e, 0x65, 0xdd, 0xff, 0x6f, 0x68, 0xdf, 0xff, 0x70, 0x69, 0xdb, 0xff, 0x7e, 0x74, 0xdf, 0xff, 0x81, 0x70, 0xdb, 0xff, 0x88, 0x76, 0xdb, 0xff, 0x88, 0x79, 0xd0, 0xff, 0x83, 0x7a, 0xc3, 0xff, 0x7f, 0x7b, 0xb7, 0xff, 0x7f, 0x7c, 0xb5, 0xff, 0x84, 0x81, 0xbc, 0xff, 0x8a, 0x89, 0xc3, 0xff, 0x91, 0x89, 0xd3, 0xff, 0x85, 0x79, 0xd7, 0xff, 0x6e, 0x68, 0xd7, 0xff, 0x52, 0x50, 0xd6, 0xff, 0x49, 0x47, 0xcd, 0xff, 0x5a, 0x54, 0xac, 0xff, 0x82, 0x77, 0x8c, 0xff, 0xb8, 0xb1, 0xab, 0xff, 0xe6, 0xeb, 0xe7, 0xff, 0xf2, 0xfd, 0xfe, 0xff, 0xc1, 0xc8, 0xc6, 0xff, 0x9a, 0x98, 0x88, 0xff, 0xb4, 0xb2, 0x9f, 0xff, 0x83, 0x8b, 0x7d, 0xff, 0x36, 0x44, 0x4d, 0xff, 0x70, 0x72, 0xa1, 0xff, 0x99, 0x98, 0xeb, 0xff, 0x93, 0x8f, 0xfe, 0xff, 0x8e, 0x8a, 0xff, 0xff, 0x8f, 0x8e, 0xfe, 0xff, 0x93, 0x94, 0xf7, 0xff, 0x96, 0x99, 0xf9, 0xff, 0x90, 0x8f, 0xfd, 0xff, 0x8c, 0x8a, 0xff, 0xff, 0x90, 0x93, 0xfd, 0xff, 0x87, 0x8c, 0xf2, 0xff, 0x8a, 0x8b, 0xf8, 0xff, 0x92, 0x93, 0xfd, 0xff, 0x79, 0x74, 0xeb, 0xff, 0x38, 0x25, 0xce, 0xff, 0x8b, 0x79, 0xe4, 0xff, 0xca, 0x98, 0x87, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0xab, 0xcd, 0xff, 0x00, 0xb9, 0xf8, 0xff, 0x03, 0xbe, 0xfd, 0xff, 0x08, 0xc2, 0xff, 0xff, 0x05, 0xbe, 0xfd, 0xff, 0x05, 0xbe, 0xff, 0xff, 0x03, 0xc0, 0xff, 0xff, 0x02, 0xc3, 0xfb, 0xff, 0x03, 0xcb, 0xf9, 0xff, 0x05, 0xd4, 0xfb, 0xff, 0x05, 0xda, 0xfc, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x10, 0xe6, 0xff, 0xff, 0x23, 0xd1, 0xf1, 0xff, 0x0c, 0xc0, 0xdf, 0xff, 0x06, 0xde, 0xfd, 0xff, 0x06, 0xd6, 0xff, 0xff, 0x05, 0xd5, 0xfd, 0xff, 0x02, 0xd2, 0xfa, 0xff, 0x00, 0xc7, 0xef, 0xff, 0x00, 0xb3, 0xd5, 0xff, 0x08, 0xa8, 0xc3, 0xff, 0x21, 0xa9, 0xba, 0xff, 0x35, 0xb1, 0xbb, 0xff, 0x32, 0x95, 0xac, 0xff, 0x34, 0x5d, 0x94, 0xff, 0x6b, 0x5e, 0xb3, 0xff, 0x78, 0x68, 0xc3, 0xff, 0x69, 0x6e, 0xbb, 0xff, 0x62, 0x73, 0xb5, 0xff, 0x6a, 0x73, 0xba, 0xff, 0x6b, 0x71, 0xc0, 0xff, 0x70, 0x73, 0xc7, 0xff, 0x72, 0x72, 0xc5, 0xff, 0x73, 0x70, 0xc1, 0xff, 0x75, 0x6f, 0xc3, 0xff, 0x78, 0x6e, 0xc9, 0xff, 0x7a, 0x6f, 0xcb, 0xff, 0x78, 0x71, 0xc8, 0xff, 0x76, 0x72, 0xca, 0xff, 0x76, 0x73, 0xd0, 0xff, 0x76, 0x72, 0xd3, 0xff, 0x74, 0x71, 0xd0, 0xff, 0x6a, 0x6c, 0xcf, 0xff, 0x59, 0x5e, 0xd2, 0xff, 0x4c, 0x49, 0xd9, 0xff, 0x3b, 0x32, 0xd9, 0xff, 0x2b, 0x24, 0xbb, 0xff, 0x55, 0x52, 0xad, 0xff, 0x80, 0x82, 0x9f, 0xff, 0x9d, 0x9c, 0x94, 0xff, 0xcd, 0xcc, 0xc2, 0xff, 0xce, 0xd3, 0xc3, 0xff, 0xa8, 0xb5, 0x98, 0xff, 0xbc, 0xc8, 0xb1, 0xff, 0xb0, 0xb5, 0xab, 0xff, 0x9f, 0xa0, 0x9f, 0xff, 0x78, 0x7c, 0x83, 0xff, 0x40, 0x4a, 0x69, 0xff, 0x68, 0x68, 0xa9, 0xff, 0x96, 0x94, 0xf1, 0xff, 0x93, 0x92, 0xfe, 0xff, 0x88, 0x8c, 0xfc, 0xff, 0x86, 0x8c, 0xff, 0xff, 0x8b, 0x8c, 0xfb, 0xff, 0x8d, 0x8f, 0xfb, 0xff, 0x86, 0x8c, 0xfe, 0xff, 0x7d, 0x85, 0xff, 0xff, 0x7d, 0x87, 0xfa, 0xff, 0x8a, 0x92, 0xff, 0xff, 0x74, 0x73, 0xea, 0xff, 0x37, 0x1d, 0xc3, 0xff, 0x85, 0x8d, 0xdd, 0xff, 0xcb, 0xc4, 0xf0, 0xff, 0xe4, 0xab, 0x82, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x30, 0xaa, 0xcc, 0xff, 0x02, 0xb4, 0xf4, 0xff, 0x06, 0xbd, 0xfc, 0xff, 0x05, 0xbf, 0xff, 0xff, 0x04, 0xbe, 0xfe, 0xff, 0x06, 0xc0, 0xfe, 0xff, 0x06, 0xc0, 0xfc, 0xff, 0x04, 0xc1, 0xfb, 0xff, 0x06, 0xc8, 0xfd, 0xff, 0x09, 0xd2, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x15, 0xe6, 0xff, 0xff, 0x28, 0xd0, 0xee, 0xff, 0x0c, 0xc0, 0xda, 0xff, 0x0a, 0xe4, 0xfb, 0xff, 0x09, 0xd8, 0xfc, 0xff, 0x03, 0xd4, 0xff, 0xff, 0x02, 0xd6, 0xf9, 0xff, 0x08, 0xd6, 0xf6, 0xff, 0x0b, 0xcb, 0xf3, 0xff, 0x03, 0xba, 0xdd, 0xff, 0x11, 0xac, 0xc8, 0xff, 0x13, 0x73, 0xa3, 0xff, 0x0b, 0x42, 0x93, 0xff, 0x50, 0x52, 0xbb, 0xff, 0x69, 0x61, 0xc7, 0xff, 0x62, 0x65, 0xbd, 0xff, 0x5d, 0x6a, 0xba, 0xff, 0x58, 0x62, 0xb9, 0xff, 0x5e, 0x60, 0xc2, 0xff, 0x60, 0x5f, 0xc1, 0xff, 0x62, 0x5f, 0xc3, 0xff, 0x61, 0x61, 0xc4, 0xff, 0x5c, 0x60, 0xc2, 0xff, 0x56, 0x5e, 0xbf, 0xff, 0x54, 0x5a, 0xc4, 0xff, 0x54, 0x56, 0xcc, 0xff, 0x53, 0x51, 0xcf, 0xff, 0x50, 0x4e, 0xd2, 0xff, 0x50, 0x4f, 0xd3, 0xff, 0x4d, 0x50, 0xd4, 0xff, 0x47, 0x4e, 0xd3, 0xff, 0x40, 0x4b, 0xcf, 0xff, 0x35, 0x3f, 0xcb, 0xff, 0x23, 0x23, 0xc5, 0xff, 0x10, 0x0f, 0xc6, 0xff, 0x00, 0x00, 0xd6, 0xff, 0x1b, 0x1c, 0xd7, 0xff, 0x54, 0x68, 0xc5, 0xff, 0x7b, 0x91, 0xac, 0xff, 0x8a, 0x8b, 0x92, 0xff, 0x88, 0x78, 0x74, 0xff, 0xc5, 0xb3, 0xa0, 0xff, 0xe3, 0xda, 0xd8, 0xff, 0xba, 0xb3, 0xc8, 0xff, 0xa8, 0xa5, 0xa9, 0xff, 0xa2, 0xa6, 0x9a, 0xff, 0x71, 0x7a, 0x6f, 0xff, 0x4e, 0x56, 0x60, 0xff, 0x70, 0x6f, 0xa1, 0xff, 0x9b, 0x92, 0xea, 0xff, 0x96, 0x8f, 0xff, 0xff, 0x82, 0x87, 0xff, 0xff, 0x89, 0x87, 0xf8, 0xff, 0x91, 0x89, 0xfc, 0xff, 0x86, 0x87, 0xf9, 0xff, 0x80, 0x8a, 0xee, 0xff, 0x88, 0x8c, 0xff, 0xff, 0x6c, 0x64, 0xf0, 0xff, 0x24, 0x08, 0xc1, 0xff, 0x90, 0x8e, 0xd2, 0xff, 0xc6, 0xd7, 0xea, 0xff, 0xc9, 0xd4, 0xda, 0xff, 0xd1, 0xa9, 0x89, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x30, 0xac, 0xcd, 0xff, 0x03, 0xb5, 0xf4, 0xff, 0x06, 0xbd, 0xfc, 0xff, 0x05, 0xbf, 0xff, 0xff, 0x04, 0xbe, 0xfe, 0xff, 0x06, 0xc0, 0xfe, 0xff, 0x06, 0xc0, 0xfc, 0xff, 0x05, 0xc1, 0xfc, 0xff, 0x05, 0xc7, 0xfe, 0xff, 0x08, 0xd0, 0xfd, 0xff, 0x05, 0xd6, 0xfd, 0xff, 0x04, 0xdd, 0xfe, 0xff, 0x14, 0xe6, 0xff, 0xff, 0x26, 0xd0, 0xef, 0xff, 0x0f, 0xbf, 0xdd, 0xff, 0x0c, 0xe4, 0xfd, 0xff, 0x01, 0xe1, 0xfb, 0xff, 0x00, 0xde, 0xfe, 0xff, 0x05, 0xd8, 0xff, 0xff, 0x04, 0xd4, 0xfb, 0xff, 0x0c, 0xda, 0xfc, 0xff, 0x1d, 0xc5, 0xf1, 0xff, 0x0c, 0x7c, 0xc0, 0xff, 0x00, 0x2b, 0xab, 0xff, 0x1a, 0x25, 0xb7, 0xff, 0x33, 0x29, 0xc2, 0xff, 0x33, 0x2b, 0xba, 0xff, 0x38, 0x39, 0xb9, 0xff, 0x46, 0x47, 0xc7, 0xff, 0x4a, 0x48, 0xcb, 0xff, 0x48, 0x45, 0xc7, 0xff, 0x4a, 0x44, 0xc9, 0xff, 0x4a, 0x44, 0xc9, 0xff, 0x4a, 0x45, 0xca, 0xff, 0x47, 0x46, 0xca, 0xff, 0x42, 0x46, 0xcb, 0xff, 0x40, 0x45, 0xc9, 0xff, 0x40, 0x43, 0xc9, 0xff, 0x42, 0x44, 0xcc, 0xff, 0x42, 0x45, 0xce, 0xff, 0x3f, 0x42, 0xce, 0xff, 0x34, 0x39, 0xce, 0xff, 0x2b, 0x2e, 0xd1, 0xff, 0x1c, 0x1f, 0xcb, 0xff, 0x0a, 0x0b, 0xcc, 0xff, 0x08, 0x02, 0xd4, 0xff, 0x03, 0x03, 0xde, 0xff, 0x01, 0x03, 0xf4, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x1e, 0x2c, 0xca, 0xff, 0x51, 0x5b, 0xa7, 0xff, 0x5d, 0x5a, 0x7e, 0xff, 0x86, 0x77, 0x81, 0xff, 0x86, 0x7b, 0x6c, 0xff, 0xae, 0xae, 0xa8, 0xff, 0xd7, 0xd7, 0xe0, 0xff, 0xbe, 0xbb, 0xb8, 0xff, 0x9c, 0x9b, 0x8f, 0xff, 0x86, 0x88, 0x88, 0xff, 0x73, 0x72, 0x7d, 0xff, 0x4d, 0x4e, 0x5e, 0xff, 0x66, 0x66, 0x8f, 0xff, 0x96, 0x95, 0xe1, 0xff, 0x83, 0x84, 0xfb, 0xff, 0x82, 0x7d, 0xff, 0xff, 0x89, 0x85, 0xfe, 0xff, 0x7c, 0x84, 0xed, 0xff, 0x8d, 0x95, 0xfe, 0xff, 0x6a, 0x63, 0xf2, 0xff, 0x31, 0x00, 0xc3, 0xff, 0x93, 0x8b, 0xde, 0xff, 0xd8, 0xce, 0xf4, 0xff, 0xcf, 0xdb, 0xdb, 0xff, 0xcc, 0xde, 0xd3, 0xff, 0xd0, 0xb4, 0x7f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x31, 0xad, 0xce, 0xff, 0x04, 0xb6, 0xf6, 0xff, 0x07, 0xbd, 0xfe, 0xff, 0x05, 0xbf, 0xff, 0xff, 0x04, 0xbe, 0xfe, 0xff, 0x06, 0xbf, 0xff, 0xff, 0x06, 0xc0, 0xfd, 0xff, 0x05, 0xc1, 0xfc, 0xff, 0x04, 0xc7, 0xfd, 0xff, 0x05, 0xcf, 0xfd, 0xff, 0x0b, 0xd2, 0xfd, 0xff, 0x0a, 0xdb, 0xfc, 0xff, 0x0f, 0xe5, 0xff, 0xff, 0x1e, 0xcf, 0xf1, 0xff, 0x11, 0xbd, 0xe0, 0xff, 0x16, 0xe3, 0xff, 0xff, 0x0b, 0xde, 0xf8, 0xff, 0x03, 0xdc, 0xf7, 0xff, 0x01, 0xd5, 0xfe, 0xff, 0x05, 0xd4, 0xfa, 0xff, 0x0d, 0xca, 0xee, 0xff, 0x08, 0x85, 0xc9, 0xff, 0x13, 0x39, 0xc1, 0xff, 0x34, 0x39, 0xe9, 0xff, 0x41, 0x3c, 0xf3, 0xff, 0x36, 0x2b, 0xe3, 0xff, 0x23, 0x20, 0xd0, 0xff, 0x19, 0x18, 0xc3, 0xff, 0x19, 0x0d, 0xc2, 0xff, 0x1f, 0x1a, 0xc0, 0xff, 0x24, 0x27, 0xb9, 0xff, 0x2c, 0x2c, 0xc1, 0xff, 0x34, 0x31, 0xc7, 0xff, 0x36, 0x35, 0xca, 0xff, 0x36, 0x36, 0xcd, 0xff, 0x34, 0x37, 0xce, 0xff, 0x35, 0x37, 0xcf, 0xff, 0x36, 0x38, 0xce, 0xff, 0x31, 0x32, 0xcb, 0xff, 0x28, 0x2c, 0xc6, 0xff, 0x1b, 0x1f, 0xc4, 0xff, 0x0b, 0x0e, 0xc9, 0xff, 0x02, 0x00, 0xd3, 0xff, 0x00, 0x00, 0xdb, 0xff, 0x01, 0x01, 0xea, 0xff, 0x03, 0x00, 0xf4, 0xff, 0x03, 0x01, 0xf6, 0xff, 0x04, 0x06, 0xff, 0xff, 0x03, 0x01, 0xfc, 0xff, 0x07, 0x06, 0xe3, 0xff, 0x2b, 0x25, 0xb4, 0xff, 0x56, 0x54, 0x82, 0xff, 0x68, 0x6a, 0x66, 0xff, 0x6e, 0x6c, 0x64, 0xff, 0x6c, 0x6e, 0x72, 0xff, 0xa7, 0xac, 0xa8, 0xff, 0xcc, 0xc8, 0xc7, 0xff, 0xb3, 0xb1, 0xaf, 0xff, 0x8c, 0x8f, 0x93, 0xff, 0x8d, 0x87, 0x99, 0xff, 0x7f, 0x7d, 0x80, 0xff, 0x4a, 0x4f, 0x40, 0xff, 0x5e, 0x63, 0x87, 0xff, 0x88, 0x85, 0xe2, 0xff, 0x80, 0x7c, 0xff, 0xff, 0x77, 0x7a, 0xfc, 0xff, 0x7e, 0x89, 0xfe, 0xff, 0x60, 0x64, 0xe8, 0xff, 0x32, 0x14, 0xc6, 0xff, 0x97, 0x8e, 0xde, 0xff, 0xd3, 0xca, 0xed, 0xff, 0xe2, 0xd1, 0xd8, 0xff, 0xd5, 0xd8, 0xd0, 0xff, 0xd5, 0xde, 0xd8, 0xff, 0xdd, 0xb7, 0x88, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x31, 0xab, 0xcd, 0xff, 0x03, 0xb4, 0xf4, 0xff, 0x07, 0xbd, 0xfe, 0xff, 0x06, 0xbf, 0xff, 0xff, 0x04, 0xbe, 0xff, 0xff, 0x06, 0xc0, 0xff, 0xff, 0x06, 0xc0, 0xfd, 0xff, 0x05, 0xc1, 0xfc, 0xff, 0x03, 0xc7, 0xfe, 0xff, 0x04, 0xce, 0xfe, 0xff, 0x0e, 0xd1, 0xfc, 0xff, 0x0b, 0xd9, 0xfb, 0xff, 0x0c, 0xe3, 0xff, 0xff, 0x19, 0xce, 0xf1, 0xff, 0x11, 0xbb, 0xe1, 0xff, 0x1b, 0xdf, 0xfe, 0xff, 0x14, 0xda, 0xf8, 0xff, 0x0a, 0xd9, 0xfa, 0xff, 0x0d, 0xde, 0xfa, 0xff, 0x12, 0xc9, 0xe9, 0xff, 0x06, 0x82, 0xc0, 0xff, 0x04, 0x39, 0xb9, 0xff, 0x36, 0x38, 0xe4, 0xff, 0x4f, 0x3f, 0xff, 0xff, 0x48, 0x3d, 0xfa, 0xff, 0x3f, 0x3d, 0xf6, 0xff, 0x38, 0x40, 0xf1, 0xff, 0x2e, 0x36, 0xe6, 0xff, 0x2d, 0x2a, 0xdf, 0xff, 0x27, 0x21, 0xd9, 0xff, 0x15, 0x14, 0xcf, 0xff, 0x10, 0x0e, 0xcb, 0xff, 0x0b, 0x07, 0xc7, 0xff, 0x08, 0x05, 0xc6, 0xff, 0x07, 0x02, 0xc4, 0xff, 0x05, 0x02, 0xc4, 0xff, 0x01, 0x01, 0xc2, 0xff, 0x00, 0x00, 0xc4, 0xff, 0x00, 0x00, 0xcc, 0xff, 0x00, 0x00, 0xd3, 0xff, 0x00, 0x00, 0xda, 0xff, 0x00, 0x00, 0xe5, 0xff, 0x01, 0x02, 0xf1, 0xff, 0x01, 0x04, 0xf4, 0xff, 0x02, 0x04, 0xfb, 0xff, 0x01, 0x02, 0xff, 0xff, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x03, 0xf9, 0xff, 0x02, 0x03, 0xfd, 0xff, 0x02, 0x00, 0xf4, 0xff, 0x19, 0x12, 0xd6, 0xff, 0x3f, 0x46, 0x9e, 0xff, 0x5f, 0x6a, 0x69, 0xff, 0x6c, 0x6a, 0x5e, 0xff, 0x74, 0x6a, 0x73, 0xff, 0x66, 0x65, 0x67, 0xff, 0xa4, 0xa0, 0xa8, 0xff, 0xca, 0xd2, 0xcb, 0xff, 0xa3, 0xb1, 0xa6, 0xff, 0x94, 0x91, 0x9f, 0xff, 0x9b, 0x92, 0x9d, 0xff, 0x83, 0x7b, 0x7a, 0xff, 0x54, 0x4f, 0x55, 0xff, 0x5c, 0x57, 0x84, 0xff, 0x7f, 0x7f, 0xdf, 0xff, 0x85, 0x8a, 0xfb, 0xff, 0x5f, 0x61, 0xe9, 0xff, 0x21, 0x18, 0xc3, 0xff, 0x87, 0x95, 0xd0, 0xff, 0xc8, 0xd2, 0xe6, 0xff, 0xd7, 0xd2, 0xdc, 0xff, 0xe4, 0xd5, 0xd8, 0xff, 0xe6, 0xe8, 0xdf, 0xff, 0xe0, 0xda, 0xdc, 0xff, 0xe7, 0xab, 0x88, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x31, 0xaa, 0xcb, 0xff, 0x03, 0xb2, 0xf3, 0xff, 0x06, 0xbc, 0xfd, 0xff, 0x05, 0xbf, 0xff, 0xff, 0x03, 0xbe, 0xff, 0xff, 0x06, 0xbf, 0xff, 0xff, 0x05, 0xbf, 0xfc, 0xff, 0x04, 0xc0, 0xfb, 0xff, 0x04, 0xc6, 0xfe, 0xff, 0x06, 0xcd, 0xff, 0xff, 0x0b, 0xd2, 0xfd, 0xff, 0x07, 0xda, 0xfb, 0xff, 0x0c, 0xe3, 0xff, 0xff, 0x1b, 0xce, 0xef, 0xff, 0x10, 0xbb, 0xe0, 0xff, 0x14, 0xde, 0xfc, 0xff, 0x06, 0xe0, 0xf9, 0xff, 0x02, 0xde, 0xff, 0xff, 0x0a, 0xc1, 0xe5, 0xff, 0x05, 0x80, 0xb8, 0xff, 0x00, 0x36, 0xb2, 0xff, 0x2d, 0x36, 0xe3, 0xff, 0x4c, 0x3c, 0xfd, 0xff, 0x4b, 0x35, 0xfc, 0xff, 0x3e, 0x36, 0xf6, 0xff, 0x3b, 0x3f, 0xf8, 0xff, 0x36, 0x40, 0xf5, 0xff, 0x39, 0x40, 0xf8, 0xff, 0x3f, 0x3d, 0xfa, 0xff, 0x3c, 0x38, 0xfb, 0xff, 0x35, 0x34, 0xfb, 0xff, 0x2e, 0x2c, 0xf3, 0xff, 0x26, 0x23, 0xeb, 0xff, 0x21, 0x1d, 0xe8, 0xff, 0x1d, 0x17, 0xe3, 0xff, 0x16, 0x10, 0xdf, 0xff, 0x0f, 0x0c, 0xda, 0xff, 0x09, 0x09, 0xdd, 0xff, 0x07, 0x04, 0xea, 0xff, 0x02, 0x00, 0xf3, 0xff, 0x01, 0x00, 0xf7, 0xff, 0x00, 0x01, 0xf6, 0xff, 0x01, 0x04, 0xf7, 0xff, 0x00, 0x03, 0xf6, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x01, 0x02, 0xff, 0xff, 0x01, 0x02, 0xfd, 0xff, 0x02, 0x02, 0xfa, 0xff, 0x05, 0x04, 0xff, 0xff, 0x02, 0x01, 0xfe, 0xff, 0x00, 0x00, 0xf5, 0xff, 0x1c, 0x1d, 0xd6, 0xff, 0x51, 0x55, 0xa5, 0xff, 0x66, 0x69, 0x6a, 0xff, 0x65, 0x5e, 0x5a, 0xff, 0x74, 0x6a, 0x7b, 0xff, 0x84, 0x82, 0x8d, 0xff, 0x8f, 0xa1, 0x8a, 0xff, 0xbe, 0xd0, 0xbb, 0xff, 0xb0, 0xb6, 0xb9, 0xff, 0x95, 0x8d, 0xa0, 0xff, 0x9a, 0x8a, 0x9c, 0xff, 0x7c, 0x70, 0x79, 0xff, 0x51, 0x4d, 0x46, 0xff, 0x5c, 0x61, 0x8c, 0xff, 0x64, 0x62, 0xc6, 0xff, 0x39, 0x2a, 0xb8, 0xff, 0x8a, 0x94, 0xd9, 0xff, 0xbe, 0xd5, 0xdf, 0xff, 0xcd, 0xdc, 0xd4, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xe2, 0xda, 0xe2, 0xff, 0xe0, 0xe2, 0xdc, 0xff, 0xef, 0xe8, 0xe3, 0xff, 0xda, 0xad, 0x83, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x31, 0xab, 0xcc, 0xff, 0x04, 0xb3, 0xf4, 0xff, 0x06, 0xbb, 0xfe, 0xff, 0x05, 0xbe, 0xff, 0xff, 0x03, 0xbd, 0xfe, 0xff, 0x05, 0xbd, 0xff, 0xff, 0x04, 0xbd, 0xfd, 0xff, 0x03, 0xbf, 0xfb, 0xff, 0x05, 0xc3, 0xfe, 0xff, 0x09, 0xcb, 0xff, 0xff, 0x03, 0xd3, 0xfc, 0xff, 0x00, 0xdc, 0xfb, 0xff, 0x0e, 0xe5, 0xff, 0xff, 0x23, 0xce, 0xee, 0xff, 0x0d, 0xbb, 0xde, 0xff, 0x0e, 0xe5, 0xff, 0xff, 0x06, 0xe2, 0xf8, 0xff, 0x00, 0xc0, 0xec, 0xff, 0x00, 0x75, 0xc4, 0xff, 0x13, 0x27, 0xb7, 0xff, 0x31, 0x34, 0xe8, 0xff, 0x3c, 0x37, 0xfa, 0xff, 0x44, 0x31, 0xfb, 0xff, 0x3d, 0x30, 0xfb, 0xff, 0x3b, 0x39, 0xfb, 0xff, 0x36, 0x3b, 0xf8, 0xff, 0x32, 0x36, 0xf5, 0xff, 0x36, 0x36, 0xf8, 0xff, 0x3a, 0x38, 0xfc, 0xff, 0x39, 0x39, 0xf8, 0xff, 0x39, 0x3c, 0xf3, 0xff, 0x3a, 0x3d, 0xf5, 0xff, 0x3a, 0x3e, 0xf7, 0xff, 0x3b, 0x3d, 0xf9, 0xff, 0x38, 0x3a, 0xf8, 0xff, 0x34, 0x35, 0xf4, 0xff, 0x2f, 0x30, 0xf2, 0xff, 0x29, 0x29, 0xf6, 0xff, 0x20, 0x21, 0xf9, 0xff, 0x17, 0x16, 0xfa, 0xff, 0x0f, 0x10, 0xf7, 0xff, 0x07, 0x0a, 0xf2, 0xff, 0x01, 0x04, 0xed, 0xff, 0x01, 0x02, 0xf3, 0xff, 0x02, 0x02, 0xf7, 0xff, 0x00, 0x02, 0xf3, 0xff, 0x01, 0x00, 0xf5, 0xff, 0x00, 0x00, 0xf7, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x01, 0x02, 0xff, 0xff, 0x00, 0x01, 0xfe, 0xff, 0x02, 0x00, 0xfc, 0xff, 0x1f, 0x19, 0xd7, 0xff, 0x4c, 0x4e, 0xad, 0xff, 0x50, 0x52, 0x77, 0xff, 0x60, 0x5a, 0x6f, 0xff, 0x70, 0x6a, 0x6f, 0xff, 0x72, 0x77, 0x61, 0xff, 0x96, 0x9e, 0x8e, 0xff, 0xc5, 0xc9, 0xcb, 0xff, 0xaf, 0xae, 0xb9, 0xff, 0x95, 0x8d, 0x9a, 0xff, 0x8b, 0x84, 0x8a, 0xff, 0x7a, 0x78, 0x78, 0xff, 0x4e, 0x54, 0x55, 0xff, 0x32, 0x28, 0x77, 0xff, 0x92, 0x8a, 0xcc, 0xff, 0xd1, 0xdd, 0xe4, 0xff, 0xce, 0xd8, 0xd3, 0xff, 0xd8, 0xda, 0xd2, 0xff, 0xe4, 0xde, 0xd8, 0xff, 0xe7, 0xdf, 0xea, 0xff, 0xec, 0xec, 0xe4, 0xff, 0xee, 0xef, 0xf4, 0xff, 0xab, 0x9c, 0x94, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x34, 0xac, 0xce, 0xff, 0x04, 0xb3, 0xf5, 0xff, 0x05, 0xbb, 0xfe, 0xff, 0x04, 0xbd, 0xff, 0xff, 0x02, 0xbc, 0xfd, 0xff, 0x05, 0xbc, 0xff, 0xff, 0x04, 0xbd, 0xfd, 0xff, 0x01, 0xbe, 0xfb, 0xff, 0x06, 0xc3, 0xfe, 0xff, 0x0a, 0xc9, 0xff, 0xff, 0x00, 0xd3, 0xfc, 0xff, 0x00, 0xde, 0xfa, 0xff, 0x11, 0xe6, 0xff, 0xff, 0x25, 0xcf, 0xee, 0xff, 0x0f, 0xbf, 0xe0, 0xff, 0x0d, 0xe2, 0xfb, 0xff, 0x0e, 0xc4, 0xdc, 0xff, 0x01, 0x78, 0xb1, 0xff, 0x18, 0x27, 0xbd, 0xff, 0x3d, 0x26, 0xf2, 0xff, 0x42, 0x29, 0xff, 0xff, 0x37, 0x2d, 0xf8, 0xff, 0x31, 0x30, 0xf7, 0xff, 0x33, 0x33, 0xf7, 0xff, 0x31, 0x36, 0xf3, 0xff, 0x2f, 0x34, 0xef, 0xff, 0x36, 0x36, 0xf4, 0xff, 0x36, 0x32, 0xf5, 0xff, 0x32, 0x32, 0xf2, 0xff, 0x36, 0x37, 0xf2, 0xff, 0x39, 0x38, 0xf1, 0xff, 0x37, 0x38, 0xf1, 0xff, 0x36, 0x38, 0xf1, 0xff, 0x36, 0x37, 0xf3, 0xff, 0x37, 0x38, 0xf6, 0xff, 0x39, 0x39, 0xfa, 0xff, 0x3b, 0x3c, 0xfa, 0xff, 0x3a, 0x3b, 0xf9, 0xff, 0x38, 0x39, 0xfb, 0xff, 0x35, 0x38, 0xfb, 0xff, 0x31, 0x36, 0xfb, 0xff, 0x2b, 0x2e, 0xfa, 0xff, 0x25, 0x24, 0xfb, 0xff, 0x21, 0x1d, 0xfb, 0xff, 0x1a, 0x16, 0xf1, 0xff, 0x0f, 0x10, 0xe7, 0xff, 0x09, 0x08, 0xed, 0xff, 0x03, 0x01, 0xf1, 0xff, 0x00, 0x00, 0xf3, 0xff, 0x00, 0x02, 0xf6, 0xff, 0x00, 0x03, 0xf7, 0xff, 0x00, 0x02, 0xfe, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x18, 0x10, 0xe0, 0xff, 0x3f, 0x3f, 0xb1, 0xff, 0x53, 0x56, 0x71, 0xff, 0x6e, 0x66, 0x67, 0xff, 0x78, 0x6d, 0x68, 0xff, 0x74, 0x6c, 0x66, 0xff, 0x90, 0x90, 0x90, 0xff, 0xc2, 0xc7, 0xc5, 0xff, 0xac, 0xb6, 0xa9, 0xff, 0x8b, 0x92, 0x8d, 0xff, 0x82, 0x83, 0x90, 0xff, 0x70, 0x6f, 0x81, 0xff, 0x4b, 0x4c, 0x56, 0xff, 0x72, 0x6f, 0x84, 0xff, 0xcb, 0xc6, 0xd1, 0xff, 0xe7, 0xe5, 0xd3, 0xff, 0xeb, 0xdf, 0xd8, 0xff, 0xf0, 0xdf, 0xdc, 0xff, 0xf2, 0xea, 0xe8, 0xff, 0xf2, 0xed, 0xef, 0xff, 0xb1, 0xb2, 0xdc, 0xff, 0x57, 0x50, 0x87, 0xff, 0x82, 0x58, 0x5e, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x39, 0xaa, 0xce, 0xff, 0x02, 0xb2, 0xf6, 0xff, 0x04, 0xba, 0xfe, 0xff, 0x04, 0xbc, 0xff, 0xff, 0x03, 0xbb, 0xff, 0xff, 0x05, 0xbb, 0xff, 0xff, 0x06, 0xbc, 0xfd, 0xff, 0x00, 0xbf, 0xfc, 0xff, 0x05, 0xc3, 0xff, 0xff, 0x08, 0xc7, 0xfe, 0xff, 0x00, 0xd3, 0xf7, 0xff, 0x04, 0xda, 0xf5, 0xff, 0x10, 0xe3, 0xfe, 0xff, 0x1f, 0xd3, 0xf1, 0xff, 0x13, 0xbd, 0xdf, 0xff, 0x11, 0xc1, 0xe1, 0xff, 0x0d, 0x76, 0xb1, 0xff, 0x08, 0x1d, 0xc0, 0xff, 0x37, 0x26, 0xf2, 0xff, 0x38, 0x27, 0xfd, 0xff, 0x28, 0x24, 0xfb, 0xff, 0x2d, 0x2c, 0xf9, 0xff, 0x28, 0x2d, 0xf1, 0xff, 0x23, 0x30, 0xf1, 0xff, 0x29, 0x2e, 0xf1, 0xff, 0x2e, 0x2e, 0xf1, 0xff, 0x30, 0x2f, 0xf2, 0xff, 0x2f, 0x2e, 0xf2, 0xff, 0x2e, 0x2e, 0xf2, 0xff, 0x2f, 0x2d, 0xf3, 0xff, 0x31, 0x2d, 0xf5, 0xff, 0x32, 0x2d, 0xf5, 0xff, 0x32, 0x2e, 0xf5, 0xff, 0x32, 0x2e, 0xf5, 0xff, 0x34, 0x30, 0xf7, 0xff, 0x36, 0x32, 0xf9, 0xff, 0x36, 0x34, 0xf9, 0xff, 0x38, 0x38, 0xf8, 0xff, 0x3d, 0x3e, 0xf4, 0xff, 0x43, 0x45, 0xf2, 0xff, 0x45, 0x47, 0xf2, 0xff, 0x44, 0x44, 0xf6, 0xff, 0x42, 0x42, 0xfc, 0xff, 0x45, 0x40, 0xfd, 0xff, 0x43, 0x3b, 0xf8, 0xff, 0x37, 0x34, 0xf4, 0xff, 0x2c, 0x2d, 0xf2, 0xff, 0x23, 0x25, 0xf5, 0xff, 0x19, 0x1b, 0xf7, 0xff, 0x10, 0x10, 0xf6, 0xff, 0x06, 0x04, 0xf8, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xf6, 0xff, 0x00, 0x03, 0xe8, 0xff, 0x1a, 0x18, 0xd1, 0xff, 0x3e, 0x3c, 0xab, 0xff, 0x55, 0x5a, 0x7c, 0xff, 0x61, 0x68, 0x63, 0xff, 0x74, 0x77, 0x64, 0xff, 0x6f, 0x6c, 0x60, 0xff, 0x87, 0x8b, 0x7f, 0xff, 0xb9, 0xce, 0xab, 0xff, 0xa6, 0xb7, 0xa4, 0xff, 0x86, 0x89, 0x8d, 0xff, 0x8a, 0x85, 0x86, 0xff, 0x79, 0x72, 0x75, 0xff, 0x4e, 0x46, 0x50, 0xff, 0x76, 0x66, 0x77, 0xff, 0xdc, 0xcb, 0xd9, 0xff, 0xf3, 0xe7, 0xe7, 0xff, 0xf3, 0xf3, 0xde, 0xff, 0xf1, 0xfa, 0xe7, 0xff, 0xaa, 0xaa, 0xd8, 0xff, 0x26, 0x0e, 0xaa, 0xff, 0x49, 0x36, 0xc9, 0xff, 0x6d, 0x4e, 0x98, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x37, 0xa8, 0xcc, 0xff, 0x02, 0xb2, 0xf6, 0xff, 0x03, 0xb8, 0xfd, 0xff, 0x03, 0xbb, 0xff, 0xff, 0x03, 0xba, 0xff, 0xff, 0x05, 0xbb, 0xff, 0xff, 0x04, 0xba, 0xfd, 0xff, 0x00, 0xbd, 0xfc, 0xff, 0x01, 0xc1, 0xfe, 0xff, 0x03, 0xc8, 0xfb, 0xff, 0x07, 0xd4, 0xf6, 0xff, 0x05, 0xd5, 0xfc, 0xff, 0x0b, 0xe1, 0xff, 0xff, 0x22, 0xd1, 0xe8, 0xff, 0x12, 0x8c, 0xb6, 0xff, 0x0f, 0x6f, 0xc0, 0xff, 0x0d, 0x1c, 0xc7, 0xff, 0x20, 0x26, 0xe8, 0xff, 0x29, 0x26, 0xf3, 0xff, 0x25, 0x28, 0xed, 0xff, 0x24, 0x27, 0xed, 0xff, 0x29, 0x27, 0xec, 0xff, 0x27, 0x27, 0xeb, 0xff, 0x21, 0x26, 0xf2, 0xff, 0x25, 0x25, 0xf2, 0xff, 0x29, 0x26, 0xf3, 0xff, 0x2a, 0x26, 0xf3, 0xff, 0x2a, 0x25, 0xf4, 0xff, 0x28, 0x26, 0xf3, 0xff, 0x26, 0x25, 0xf4, 0xff, 0x27, 0x24, 0xf5, 0xff, 0x27, 0x25, 0xf4, 0xff, 0x28, 0x25, 0xf4, 0xff, 0x28, 0x27, 0xf4, 0xff, 0x29, 0x28, 0xf5, 0xff, 0x2b, 0x2b, 0xf6, 0xff, 0x2e, 0x2e, 0xf5, 0xff, 0x32, 0x32, 0xf1, 0xff, 0x37, 0x37, 0xf0, 0xff, 0x3d, 0x3c, 0xf0, 0xff, 0x40, 0x40, 0xf2, 0xff, 0x42, 0x41, 0xf5, 0xff, 0x42, 0x43, 0xfb, 0xff, 0x48, 0x46, 0xfd, 0xff, 0x4c, 0x49, 0xfe, 0xff, 0x4a, 0x4a, 0xfe, 0xff, 0x49, 0x4b, 0xff, 0xff, 0x48, 0x47, 0xfe, 0xff, 0x44, 0x40, 0xfc, 0xff, 0x41, 0x38, 0xf8, 0xff, 0x36, 0x2e, 0xf8, 0xff, 0x23, 0x24, 0xf8, 0xff, 0x14, 0x1e, 0xee, 0xff, 0x0a, 0x15, 0xe6, 0xff, 0x0e, 0x00, 0xea, 0xff, 0x1e, 0x0b, 0xd9, 0xff, 0x2d, 0x34, 0xa5, 0xff, 0x4a, 0x54, 0x75, 0xff, 0x63, 0x68, 0x60, 0xff, 0x71, 0x6b, 0x64, 0xff, 0x72, 0x66, 0x6e, 0xff, 0x86, 0x88, 0x80, 0xff, 0xb8, 0xbe, 0xb3, 0xff, 0xb0, 0xb3, 0xa9, 0xff, 0x89, 0x8a, 0x83, 0xff, 0x7f, 0x83, 0x7d, 0xff, 0x71, 0x77, 0x71, 0xff, 0x46, 0x48, 0x4c, 0xff, 0x72, 0x70, 0x6f, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xef, 0xee, 0xff, 0xff, 0xaa, 0xb0, 0xcd, 0xff, 0x27, 0x3a, 0x91, 0xff, 0x36, 0x39, 0xd8, 0xff, 0x54, 0x48, 0xf2, 0xff, 0x5f, 0x44, 0xa2, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x35, 0xa8, 0xcc, 0xff, 0x01, 0xb3, 0xf6, 0xff, 0x03, 0xb8, 0xfd, 0xff, 0x04, 0xbb, 0xff, 0xff, 0x03, 0xba, 0xff, 0xff, 0x07, 0xbb, 0xff, 0xff, 0x04, 0xba, 0xfc, 0xff, 0x01, 0xbb, 0xfc, 0xff, 0x00, 0xc1, 0xfe, 0xff, 0x01, 0xc9, 0xfc, 0xff, 0x0a, 0xd1, 0xfa, 0xff, 0x06, 0xd4, 0xfc, 0xff, 0x0e, 0xd7, 0xf9, 0xff, 0x17, 0xa9, 0xcf, 0xff, 0x09, 0x49, 0x9f, 0xff, 0x26, 0x27, 0xc0, 0xff, 0x38, 0x25, 0xea, 0xff, 0x2c, 0x28, 0xf9, 0xff, 0x1f, 0x27, 0xef, 0xff, 0x25, 0x2d, 0xea, 0xff, 0x2b, 0x2a, 0xf1, 0xff, 0x2a, 0x24, 0xf4, 0xff, 0x2a, 0x26, 0xf5, 0xff, 0x28, 0x26, 0xf6, 0xff, 0x2a, 0x26, 0xf5, 0xff, 0x2c, 0x26, 0xf5, 0xff, 0x2c, 0x27, 0xf6, 0xff, 0x2b, 0x27, 0xf6, 0xff, 0x29, 0x28, 0xf5, 0xff, 0x28, 0x28, 0xf2, 0xff, 0x28, 0x2a, 0xee, 0xff, 0x2a, 0x2d, 0xef, 0xff, 0x2b, 0x2f, 0xef, 0xff, 0x2c, 0x30, 0xee, 0xff, 0x2d, 0x33, 0xef, 0xff, 0x30, 0x36, 0xf1, 0xff, 0x34, 0x3a, 0xf0, 0xff, 0x3b, 0x3f, 0xef, 0xff, 0x3f, 0x40, 0xf0, 0xff, 0x43, 0x42, 0xf2, 0xff, 0x47, 0x47, 0xf4, 0xff, 0x49, 0x4b, 0xf4, 0xff, 0x4b, 0x50, 0xf6, 0xff, 0x4f, 0x52, 0xf9, 0xff, 0x52, 0x54, 0xfc, 0xff, 0x55, 0x58, 0xfb, 0xff, 0x59, 0x5d, 0xfb, 0xff, 0x5f, 0x5f, 0xfb, 0xff, 0x62, 0x5f, 0xfa, 0xff, 0x66, 0x5f, 0xfa, 0xff, 0x62, 0x5d, 0xfc, 0xff, 0x57, 0x57, 0xfe, 0xff, 0x4a, 0x51, 0xfb, 0xff, 0x40, 0x4b, 0xf4, 0xff, 0x34, 0x35, 0xf8, 0xff, 0x24, 0x1a, 0xf4, 0xff, 0x17, 0x16, 0xd8, 0xff, 0x2d, 0x33, 0xa7, 0xff, 0x4a, 0x50, 0x7a, 0xff, 0x67, 0x64, 0x6b, 0xff, 0x79, 0x69, 0x75, 0xff, 0x6b, 0x5d, 0x6a, 0xff, 0x84, 0x84, 0x7f, 0xff, 0xb8, 0xbd, 0xae, 0xff, 0xb0, 0xb4, 0xa9, 0xff, 0x84, 0x8e, 0x7f, 0xff, 0x7c, 0x87, 0x7a, 0xff, 0x70, 0x75, 0x7c, 0xff, 0x43, 0x4b, 0x45, 0xff, 0x72, 0x7b, 0x7b, 0xff, 0x95, 0x96, 0xb9, 0xff, 0x40, 0x3a, 0xa3, 0xff, 0x46, 0x46, 0xdb, 0xff, 0x5f, 0x5f, 0xed, 0xff, 0x54, 0x46, 0xb4, 0xff, 0x70, 0x54, 0x72, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x35, 0xa8, 0xcd, 0xff, 0x03, 0xb4, 0xf8, 0xff, 0x04, 0xb8, 0xfd, 0xff, 0x05, 0xbb, 0xff, 0xff, 0x04, 0xba, 0xff, 0xff, 0x08, 0xba, 0xff, 0xff, 0x04, 0xb9, 0xfe, 0xff, 0x01, 0xbb, 0xfd, 0xff, 0x01, 0xc2, 0xff, 0xff, 0x03, 0xc9, 0xff, 0xff, 0x04, 0xcb, 0xff, 0xff, 0x09, 0xd7, 0xf5, 0xff, 0x19, 0xc2, 0xde, 0xff, 0x06, 0x63, 0xb0, 0xff, 0x09, 0x27, 0xbc, 0xff, 0x27, 0x24, 0xd4, 0xff, 0x33, 0x27, 0xdb, 0xff, 0x20, 0x21, 0xe5, 0xff, 0x20, 0x27, 0xe7, 0xff, 0x28, 0x26, 0xe4, 0xff, 0x27, 0x1b, 0xe6, 0xff, 0x22, 0x1d, 0xeb, 0xff, 0x20, 0x23, 0xea, 0xff, 0x25, 0x22, 0xe5, 0xff, 0x26, 0x22, 0xe6, 0xff, 0x26, 0x23, 0xe6, 0xff, 0x26, 0x24, 0xe5, 0xff, 0x25, 0x24, 0xe5, 0xff, 0x24, 0x24, 0xe5, 0xff, 0x25, 0x26, 0xe3, 0xff, 0x28, 0x29, 0xe0, 0xff, 0x29, 0x2a, 0xe0, 0xff, 0x2a, 0x2c, 0xe0, 0xff, 0x2b, 0x2f, 0xdf, 0xff, 0x2c, 0x31, 0xdf, 0xff, 0x2e, 0x32, 0xe0, 0xff, 0x2f, 0x33, 0xdf, 0xff, 0x30, 0x33, 0xdf, 0xff, 0x34, 0x33, 0xe2, 0xff, 0x36, 0x34, 0xe3, 0xff, 0x38, 0x36, 0xe3, 0xff, 0x38, 0x38, 0xe0, 0xff, 0x39, 0x3c, 0xde, 0xff, 0x3d, 0x3e, 0xe1, 0xff, 0x41, 0x3d, 0xe5, 0xff, 0x40, 0x3f, 0xe3, 0xff, 0x40, 0x40, 0xe1, 0xff, 0x42, 0x42, 0xdf, 0xff, 0x47, 0x44, 0xe1, 0xff, 0x4b, 0x46, 0xe4, 0xff, 0x4d, 0x48, 0xe3, 0xff, 0x49, 0x48, 0xe4, 0xff, 0x42, 0x45, 0xe7, 0xff, 0x3d, 0x43, 0xe5, 0xff, 0x38, 0x3a, 0xe2, 0xff, 0x2b, 0x27, 0xdf, 0xff, 0x17, 0x0f, 0xd5, 0xff, 0x0b, 0x01, 0xc5, 0xff, 0x25, 0x23, 0x9c, 0xff, 0x47, 0x49, 0x65, 0xff, 0x69, 0x66, 0x5b, 0xff, 0x73, 0x70, 0x69, 0xff, 0x62, 0x64, 0x61, 0xff, 0x7b, 0x7f, 0x82, 0xff, 0xb5, 0xb8, 0xb3, 0xff, 0xa9, 0xb2, 0xa0, 0xff, 0x80, 0x88, 0x80, 0xff, 0x7e, 0x7f, 0x90, 0xff, 0x67, 0x6b, 0x6d, 0xff, 0x47, 0x52, 0x46, 0xff, 0x21, 0x25, 0x45, 0xff, 0x59, 0x52, 0xb8, 0xff, 0x72, 0x64, 0xee, 0xff, 0x5d, 0x45, 0xa3, 0xff, 0x8e, 0x60, 0x68, 0xff, 0xbf, 0x80, 0x5a, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x34, 0xa7, 0xcc, 0xff, 0x04, 0xb5, 0xf8, 0xff, 0x06, 0xb8, 0xfc, 0xff, 0x05, 0xbb, 0xff, 0xff, 0x04, 0xb9, 0xff, 0xff, 0x06, 0xb9, 0xff, 0xff, 0x06, 0xb9, 0xfe, 0xff, 0x01, 0xba, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x03, 0xc4, 0xfd, 0xff, 0x02, 0xca, 0xff, 0xff, 0x0e, 0xd8, 0xf4, 0xff, 0x1a, 0xa0, 0xc6, 0xff, 0x09, 0x30, 0xa6, 0xff, 0x23, 0x2b, 0xdc, 0xff, 0x2b, 0x33, 0xe3, 0xff, 0x30, 0x31, 0xd7, 0xff, 0x2a, 0x2b, 0xe0, 0xff, 0x31, 0x31, 0xe2, 0xff, 0x35, 0x30, 0xdc, 0xff, 0x36, 0x2f, 0xe0, 0xff, 0x2f, 0x33, 0xdd, 0xff, 0x2a, 0x33, 0xd7, 0xff, 0x31, 0x32, 0xdc, 0xff, 0x31, 0x33, 0xdc, 0xff, 0x32, 0x33, 0xdd, 0xff, 0x32, 0x35, 0xdc, 0xff, 0x32, 0x35, 0xdc, 0xff, 0x32, 0x36, 0xda, 0xff, 0x33, 0x34, 0xdc, 0xff, 0x35, 0x31, 0xdf, 0xff, 0x35, 0x32, 0xde, 0xff, 0x36, 0x33, 0xde, 0xff, 0x35, 0x33, 0xdd, 0xff, 0x35, 0x33, 0xdc, 0xff, 0x35, 0x34, 0xdb, 0xff, 0x36, 0x34, 0xdd, 0xff, 0x36, 0x33, 0xe0, 0xff, 0x39, 0x33, 0xe2, 0xff, 0x3a, 0x32, 0xe3, 0xff, 0x3a, 0x31, 0xe1, 0xff, 0x38, 0x31, 0xde, 0xff, 0x37, 0x33, 0xdc, 0xff, 0x3a, 0x33, 0xdd, 0xff, 0x3c, 0x32, 0xdf, 0xff, 0x3b, 0x33, 0xdf, 0xff, 0x3a, 0x33, 0xde, 0xff, 0x38, 0x33, 0xde, 0xff, 0x38, 0x32, 0xdd, 0xff, 0x39, 0x33, 0xdf, 0xff, 0x3c, 0x36, 0xdc, 0xff, 0x3d, 0x3a, 0xd8, 0xff, 0x3a, 0x38, 0xd7, 0xff, 0x3b, 0x34, 0xdb, 0xff, 0x43, 0x35, 0xe1, 0xff, 0x42, 0x38, 0xdd, 0xff, 0x36, 0x36, 0xce, 0xff, 0x27, 0x2d, 0xd4, 0xff, 0x14, 0x17, 0xb4, 0xff, 0x27, 0x26, 0x6b, 0xff, 0x48, 0x48, 0x50, 0xff, 0x60, 0x5c, 0x67, 0xff, 0x6b, 0x6d, 0x76, 0xff, 0x5e, 0x69, 0x61, 0xff, 0x75, 0x7a, 0x70, 0xff, 0xb5, 0xba, 0xaf, 0xff, 0xa1, 0xa6, 0xa3, 0xff, 0x84, 0x81, 0x8e, 0xff, 0x82, 0x7f, 0x81, 0xff, 0x75, 0x76, 0x6e, 0xff, 0x54, 0x52, 0x5d, 0xff, 0x4b, 0x46, 0x80, 0xff, 0x5c, 0x48, 0x9d, 0xff, 0x87, 0x5b, 0x66, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x30, 0xa4, 0xc9, 0xff, 0x02, 0xb3, 0xf6, 0xff, 0x05, 0xb8, 0xfc, 0xff, 0x04, 0xba, 0xff, 0xff, 0x03, 0xb7, 0xfe, 0xff, 0x05, 0xb7, 0xfe, 0xff, 0x05, 0xb7, 0xfe, 0xff, 0x00, 0xb8, 0xfd, 0xff, 0x01, 0xbf, 0xff, 0xff, 0x0a, 0xc5, 0xfe, 0xff, 0x07, 0xcc, 0xff, 0xff, 0x03, 0xc7, 0xf4, 0xff, 0x03, 0x74, 0xb8, 0xff, 0x2b, 0x38, 0xbd, 0xff, 0x58, 0x58, 0xfb, 0xff, 0x5b, 0x59, 0xff, 0xff, 0x5e, 0x5a, 0xff, 0xff, 0x5c, 0x57, 0xff, 0xff, 0x5b, 0x5a, 0xfa, 0xff, 0x5d, 0x61, 0xfa, 0xff, 0x5d, 0x5f, 0xff, 0xff, 0x5d, 0x5f, 0xfb, 0xff, 0x5d, 0x61, 0xf8, 0xff, 0x5c, 0x60, 0xfd, 0xff, 0x5d, 0x61, 0xfd, 0xff, 0x5d, 0x62, 0xfd, 0xff, 0x5e, 0x63, 0xfc, 0xff, 0x5f, 0x63, 0xfc, 0xff, 0x60, 0x64, 0xfa, 0xff, 0x60, 0x64, 0xfc, 0xff, 0x61, 0x63, 0xff, 0xff, 0x62, 0x64, 0xff, 0xff, 0x63, 0x65, 0xff, 0xff, 0x62, 0x65, 0xff, 0xff, 0x63, 0x66, 0xff, 0xff, 0x63, 0x66, 0xff, 0xff, 0x63, 0x66, 0xff, 0xff, 0x63, 0x63, 0xff, 0xff, 0x67, 0x64, 0xff, 0xff, 0x67, 0x65, 0xff, 0xff, 0x68, 0x63, 0xff, 0xff, 0x67, 0x62, 0xff, 0xff, 0x67, 0x63, 0xff, 0xff, 0x68, 0x65, 0xff, 0xff, 0x69, 0x66, 0xfe, 0xff, 0x69, 0x67, 0xff, 0xff, 0x6a, 0x68, 0xff, 0xff, 0x6c, 0x6a, 0xff, 0xff, 0x6e, 0x6a, 0xff, 0xff, 0x6f, 0x69, 0xfe, 0xff, 0x6e, 0x6b, 0xff, 0xff, 0x6c, 0x6b, 0xff, 0xff, 0x6b, 0x69, 0xff, 0xff, 0x6f, 0x6d, 0xfb, 0xff, 0x73, 0x6a, 0xfe, 0xff, 0x70, 0x67, 0xff, 0xff, 0x6c, 0x75, 0xfb, 0xff, 0x56, 0x67, 0xf7, 0xff, 0x1a, 0x22, 0xc0, 0xff, 0x56, 0x52, 0xa5, 0xff, 0x7c, 0x80, 0x89, 0xff, 0x45, 0x42, 0x55, 0xff, 0x5a, 0x57, 0x6d, 0xff, 0x6b, 0x73, 0x6a, 0xff, 0x65, 0x6b, 0x66, 0xff, 0x75, 0x78, 0x78, 0xff, 0xaa, 0xb1, 0xaa, 0xff, 0xac, 0xb0, 0xa6, 0xff, 0x85, 0x81, 0x79, 0xff, 0x80, 0x77, 0x78, 0xff, 0x73, 0x6a, 0x75, 0xff, 0x4c, 0x4d, 0x54, 0xff, 0x4b, 0x43, 0x55, 0xff, 0x9f, 0x74, 0x43, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x32, 0xa4, 0xc5, 0xff, 0x01, 0xb2, 0xf8, 0xff, 0x03, 0xb8, 0xfb, 0xff, 0x03, 0xb9, 0xff, 0xff, 0x02, 0xb6, 0xfe, 0xff, 0x03, 0xb7, 0xfe, 0xff, 0x02, 0xb6, 0xfe, 0xff, 0x00, 0xb8, 0xfc, 0xff, 0x00, 0xbf, 0xfe, 0xff, 0x05, 0xc4, 0xfd, 0xff, 0x09, 0xce, 0xfc, 0xff, 0x0c, 0xba, 0xeb, 0xff, 0x00, 0x5b, 0xb3, 0xff, 0x47, 0x4a, 0xda, 0xff, 0x6d, 0x65, 0xfd, 0xff, 0x6a, 0x60, 0xfa, 0xff, 0x6c, 0x63, 0xfe, 0xff, 0x67, 0x64, 0xfe, 0xff, 0x63, 0x68, 0xfa, 0xff, 0x66, 0x6d, 0xfa, 0xff, 0x66, 0x68, 0xfc, 0xff, 0x67, 0x66, 0xfd, 0xff, 0x68, 0x69, 0xff, 0xff, 0x67, 0x68, 0xff, 0xff, 0x67, 0x69, 0xfe, 0xff, 0x68, 0x6a, 0xff, 0xff, 0x69, 0x6a, 0xfe, 0xff, 0x6a, 0x6c, 0xfe, 0xff, 0x6b, 0x6c, 0xfd, 0xff, 0x6b, 0x6c, 0xfc, 0xff, 0x6a, 0x6b, 0xfd, 0xff, 0x6c, 0x6d, 0xfd, 0xff, 0x6d, 0x6f, 0xfd, 0xff, 0x6d, 0x6f, 0xfe, 0xff, 0x6e, 0x70, 0xfe, 0xff, 0x6e, 0x70, 0xff, 0xff, 0x6e, 0x71, 0xfd, 0xff, 0x6e, 0x72, 0xf9, 0xff, 0x70, 0x72, 0xfa, 0xff, 0x70, 0x73, 0xfa, 0xff, 0x70, 0x72, 0xfa, 0xff, 0x71, 0x72, 0xfa, 0xff, 0x71, 0x73, 0xfc, 0xff, 0x71, 0x74, 0xfb, 0xff, 0x70, 0x76, 0xfa, 0xff, 0x70, 0x76, 0xf9, 0xff, 0x72, 0x76, 0xfa, 0xff, 0x73, 0x77, 0xfb, 0xff, 0x76, 0x77, 0xfb, 0xff, 0x78, 0x77, 0xfa, 0xff, 0x76, 0x76, 0xfa, 0xff, 0x72, 0x75, 0xfd, 0xff, 0x72, 0x76, 0xfe, 0xff, 0x77, 0x7c, 0xf8, 0xff, 0x7a, 0x7a, 0xf8, 0xff, 0x78, 0x74, 0xfb, 0xff, 0x78, 0x7c, 0xfe, 0xff, 0x58, 0x64, 0xf6, 0xff, 0x00, 0x07, 0xb8, 0xff, 0x8d, 0x92, 0xc6, 0xff, 0xcd, 0xd1, 0xd0, 0xff, 0x90, 0x8f, 0x90, 0xff, 0x48, 0x43, 0x58, 0xff, 0x5d, 0x5b, 0x63, 0xff, 0x6f, 0x6d, 0x6f, 0xff, 0x6a, 0x6c, 0x67, 0xff, 0x72, 0x7a, 0x69, 0xff, 0xa6, 0xaa, 0x97, 0xff, 0xb2, 0xac, 0xa6, 0xff, 0x8d, 0x85, 0x8b, 0xff, 0x72, 0x6f, 0x78, 0xff, 0x68, 0x70, 0x66, 0xff, 0x56, 0x59, 0x42, 0xff, 0x85, 0x65, 0x32, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x35, 0xa6, 0xc6, 0xff, 0x01, 0xb1, 0xfc, 0xff, 0x01, 0xb8, 0xfb, 0xff, 0x03, 0xb8, 0xff, 0xff, 0x03, 0xb5, 0xff, 0xff, 0x03, 0xb6, 0xff, 0xff, 0x01, 0xb7, 0xff, 0xff, 0x00, 0xb9, 0xfc, 0xff, 0x01, 0xbf, 0xfe, 0xff, 0x00, 0xc5, 0xff, 0xff, 0x06, 0xca, 0xfa, 0xff, 0x0f, 0xaa, 0xd8, 0xff, 0x00, 0x4b, 0xa9, 0xff, 0x55, 0x52, 0xeb, 0xff, 0x71, 0x68, 0xfc, 0xff, 0x6e, 0x69, 0xfb, 0xff, 0x6f, 0x69, 0xff, 0xff, 0x65, 0x69, 0xfe, 0xff, 0x64, 0x6a, 0xfd, 0xff, 0x6a, 0x6b, 0xfb, 0xff, 0x6e, 0x6b, 0xfb, 0xff, 0x68, 0x69, 0xfd, 0xff, 0x67, 0x68, 0xff, 0xff, 0x6b, 0x68, 0xff, 0xff, 0x6b, 0x69, 0xff, 0xff, 0x6b, 0x69, 0xff, 0xff, 0x6c, 0x6b, 0xff, 0xff, 0x6c, 0x6b, 0xfe, 0xff, 0x6d, 0x6c, 0xfe, 0xff, 0x6d, 0x6c, 0xfe, 0xff, 0x6e, 0x6c, 0xfe, 0xff, 0x6f, 0x6d, 0xff, 0xff, 0x6f, 0x6e, 0xff, 0xff, 0x6f, 0x6e, 0xfe, 0xff, 0x70, 0x6f, 0xff, 0xff, 0x70, 0x70, 0xff, 0xff, 0x71, 0x71, 0xfe, 0xff, 0x72, 0x72, 0xfd, 0xff, 0x73, 0x72, 0xfd, 0xff, 0x73, 0x72, 0xfd, 0xff, 0x72, 0x72, 0xfd, 0xff, 0x72, 0x72, 0xfd, 0xff, 0x73, 0x72, 0xfd, 0xff, 0x73, 0x74, 0xfd, 0xff, 0x73, 0x76, 0xfd, 0xff, 0x73, 0x76, 0xfd, 0xff, 0x73, 0x75, 0xfd, 0xff, 0x75, 0x75, 0xfe, 0xff, 0x75, 0x76, 0xfe, 0xff, 0x75, 0x76, 0xfe, 0xff, 0x76, 0x75, 0xfd, 0xff, 0x74, 0x76, 0xfd, 0xff, 0x72, 0x77, 0xfe, 0xff, 0x74, 0x77, 0xfe, 0xff, 0x7b, 0x79, 0xfd, 0xff, 0x7f, 0x79, 0xfc, 0xff, 0x7e, 0x78, 0xff, 0xff, 0x53, 0x53, 0xee, 0xff, 0x00, 0x0e, 0xb1, 0xff, 0xab, 0xb5, 0xcc, 0xff, 0xdc, 0xde, 0xdb, 0xff, 0xd2, 0xd5, 0xcb, 0xff, 0xa6, 0xae, 0x9e, 0xff, 0x4f, 0x49, 0x4c, 0xff, 0x64, 0x62, 0x5c, 0xff, 0x70, 0x73, 0x67, 0xff, 0x69, 0x6b, 0x5d, 0xff, 0x77, 0x74, 0x6e, 0xff, 0xa3, 0x9e, 0xa2, 0xff, 0xa0, 0xa1, 0xa9, 0xff, 0x78, 0x83, 0x88, 0xff, 0x68, 0x72, 0x71, 0xff, 0x79, 0x79, 0x72, 0xff, 0x87, 0x72, 0x5e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x33, 0xa5, 0xc7, 0xff, 0x00, 0xb2, 0xfb, 0xff, 0x02, 0xb8, 0xfc, 0xff, 0x05, 0xb8, 0xff, 0xff, 0x04, 0xb5, 0xff, 0xff, 0x05, 0xb6, 0xff, 0xff, 0x02, 0xb6, 0xfd, 0xff, 0x02, 0xb7, 0xfc, 0xff, 0x04, 0xbf, 0xfe, 0xff, 0x04, 0xc8, 0xff, 0xff, 0x10, 0xce, 0xfe, 0xff, 0x0e, 0xa4, 0xd5, 0xff, 0x09, 0x48, 0xaf, 0xff, 0x66, 0x5e, 0xf5, 0xff, 0x78, 0x71, 0xfd, 0xff, 0x6f, 0x72, 0xf7, 0xff, 0x70, 0x6e, 0xfc, 0xff, 0x69, 0x6d, 0xfd, 0xff, 0x6a, 0x6f, 0xfc, 0xff, 0x6d, 0x71, 0xf9, 0xff, 0x6f, 0x71, 0xfa, 0xff, 0x6d, 0x70, 0xfc, 0xff, 0x6c, 0x6f, 0xfe, 0xff, 0x6e, 0x70, 0xfd, 0xff, 0x6e, 0x71, 0xfd, 0xff, 0x6f, 0x71, 0xfd, 0xff, 0x6f, 0x72, 0xfc, 0xff, 0x70, 0x73, 0xfd, 0xff, 0x70, 0x73, 0xfc, 0xff, 0x70, 0x74, 0xfb, 0xff, 0x71, 0x74, 0xf9, 0xff, 0x71, 0x76, 0xf9, 0xff, 0x72, 0x76, 0xf9, 0xff, 0x72, 0x77, 0xf9, 0xff, 0x73, 0x78, 0xf9, 0xff, 0x73, 0x79, 0xf9, 0xff, 0x75, 0x78, 0xfb, 0xff, 0x76, 0x76, 0xfe, 0xff, 0x77, 0x77, 0xfe, 0xff, 0x77, 0x77, 0xfe, 0xff, 0x76, 0x77, 0xfd, 0xff, 0x76, 0x77, 0xfe, 0xff, 0x77, 0x77, 0xfe, 0xff, 0x77, 0x79, 0xfe, 0xff, 0x78, 0x7a, 0xfe, 0xff, 0x78, 0x7a, 0xfe, 0xff, 0x78, 0x7a, 0xfe, 0xff, 0x7b, 0x7a, 0xff, 0xff, 0x7b, 0x7a, 0xff, 0xff, 0x7b, 0x7a, 0xff, 0xff, 0x7c, 0x7b, 0xfe, 0xff, 0x79, 0x7b, 0xfc, 0xff, 0x78, 0x7b, 0xff, 0xff, 0x7a, 0x7c, 0xff, 0xff, 0x80, 0x7c, 0xfd, 0xff, 0x82, 0x7f, 0xff, 0xff, 0x7c, 0x7a, 0xfe, 0xff, 0x4f, 0x4d, 0xe8, 0xff, 0x24, 0x1d, 0xbb, 0xff, 0xb7, 0xbb, 0xd9, 0xff, 0xdf, 0xde, 0xe3, 0xff, 0xdc, 0xe3, 0xd7, 0xff, 0xe4, 0xf1, 0xdc, 0xff, 0xb4, 0xb4, 0xbb, 0xff, 0x44, 0x3f, 0x4c, 0xff, 0x57, 0x59, 0x57, 0xff, 0x6e, 0x6a, 0x6b, 0xff, 0x6c, 0x67, 0x69, 0xff, 0x6d, 0x6c, 0x70, 0xff, 0x9a, 0xa0, 0xa2, 0xff, 0x9b, 0xa5, 0xa4, 0xff, 0x81, 0x83, 0x85, 0xff, 0x96, 0x89, 0x8b, 0xff, 0x92, 0x73, 0x60, 0xff, 0xb0, 0x79, 0x40, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x32, 0xa6, 0xc9, 0xff, 0x00, 0xb1, 0xf9, 0xff, 0x01, 0xb7, 0xfc, 0xff, 0x03, 0xb8, 0xff, 0xff, 0x02, 0xb6, 0xff, 0xff, 0x02, 0xb7, 0xff, 0xff, 0x02, 0xb6, 0xfd, 0xff, 0x02, 0xb8, 0xfc, 0xff, 0x04, 0xbe, 0xfd, 0xff, 0x01, 0xc3, 0xfd, 0xff, 0x11, 0xcd, 0xff, 0xff, 0x0a, 0x9e, 0xd0, 0xff, 0x14, 0x45, 0xb6, 0xff, 0x71, 0x62, 0xfd, 0xff, 0x7a, 0x74, 0xfe, 0xff, 0x6e, 0x77, 0xf5, 0xff, 0x72, 0x74, 0xfa, 0xff, 0x71, 0x73, 0xfb, 0xff, 0x72, 0x74, 0xfc, 0xff, 0x74, 0x78, 0xfb, 0xff, 0x76, 0x79, 0xfb, 0xff, 0x75, 0x79, 0xfd, 0xff, 0x75, 0x78, 0xfe, 0xff, 0x76, 0x7a, 0xfc, 0xff, 0x76, 0x7a, 0xfc, 0xff, 0x76, 0x7a, 0xfc, 0xff, 0x76, 0x7b, 0xfc, 0xff, 0x77, 0x7c, 0xfc, 0xff, 0x77, 0x7c, 0xfc, 0xff, 0x77, 0x7c, 0xfb, 0xff, 0x77, 0x7d, 0xf9, 0xff, 0x77, 0x7e, 0xfa, 0xff, 0x78, 0x7f, 0xfa, 0xff, 0x78, 0x7f, 0xfa, 0xff, 0x78, 0x7f, 0xfa, 0xff, 0x79, 0x80, 0xfb, 0xff, 0x79, 0x80, 0xfc, 0xff, 0x79, 0x7e, 0xfc, 0xff, 0x79, 0x7f, 0xfd, 0xff, 0x7a, 0x7f, 0xfd, 0xff, 0x79, 0x7e, 0xfc, 0xff, 0x79, 0x7f, 0xfd, 0xff, 0x7a, 0x7f, 0xfd, 0xff, 0x7b, 0x80, 0xfd, 0xff, 0x7d, 0x81, 0xfc, 0xff, 0x7c, 0x81, 0xfc, 0xff, 0x7d, 0x81, 0xfc, 0xff, 0x7f, 0x82, 0xfd, 0xff, 0x7f, 0x82, 0xfd, 0xff, 0x7f, 0x82, 0xfd, 0xff, 0x82, 0x85, 0xfd, 0xff, 0x7e, 0x82, 0xfb, 0xff, 0x7d, 0x83, 0xff, 0xff, 0x7f, 0x84, 0xff, 0xff, 0x80, 0x81, 0xfa, 0xff, 0x84, 0x86, 0xfe, 0xff, 0x7a, 0x7f, 0xfa, 0xff, 0x4b, 0x50, 0xe5, 0xff, 0x2a, 0x1f, 0xc3, 0xff, 0xc5, 0xbb, 0xea, 0xff, 0xec, 0xdf, 0xeb, 0xff, 0xeb, 0xe8, 0xeb, 0xff, 0xe5, 0xe9, 0xfd, 0xff, 0x96, 0x94, 0xc9, 0xff, 0x37, 0x36, 0x7f, 0xff, 0x3c, 0x3b, 0x6e, 0xff, 0x63, 0x5b, 0x72, 0xff, 0x70, 0x6c, 0x6e, 0xff, 0x5f, 0x66, 0x5f, 0xff, 0x6b, 0x73, 0x6c, 0xff, 0x8e, 0x8f, 0x8c, 0xff, 0xa2, 0x94, 0x8c, 0xff, 0x95, 0x77, 0x62, 0xff, 0x9b, 0x66, 0x39, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x32, 0xa6, 0xc9, 0xff, 0x00, 0xb3, 0xf9, 0xff, 0x00, 0xb6, 0xfd, 0xff, 0x00, 0xb7, 0xff, 0xff, 0x00, 0xb5, 0xfe, 0xff, 0x00, 0xb8, 0xfe, 0xff, 0x00, 0xb7, 0xfd, 0xff, 0x00, 0xb8, 0xfc, 0xff, 0x04, 0xbe, 0xfd, 0xff, 0x06, 0xc6, 0xff, 0xff, 0x0f, 0xd0, 0xfe, 0xff, 0x07, 0x9f, 0xcf, 0xff, 0x12, 0x42, 0xb9, 0xff, 0x66, 0x52, 0xf7, 0xff, 0x6d, 0x64, 0xf7, 0xff, 0x5f, 0x69, 0xf3, 0xff, 0x61, 0x60, 0xf9, 0xff, 0x64, 0x5e, 0xfa, 0xff, 0x65, 0x5f, 0xfa, 0xff, 0x64, 0x62, 0xf9, 0xff, 0x64, 0x64, 0xf9, 0xff, 0x65, 0x62, 0xf9, 0xff, 0x66, 0x61, 0xf9, 0xff, 0x65, 0x63, 0xf9, 0xff, 0x65, 0x63, 0xf9, 0xff, 0x65, 0x63, 0xf9, 0xff, 0x65, 0x64, 0xf9, 0xff, 0x66, 0x65, 0xf9, 0xff, 0x66, 0x65, 0xf9, 0xff, 0x66, 0x64, 0xf9, 0xff, 0x66, 0x64, 0xfa, 0xff, 0x67, 0x65, 0xfa, 0xff, 0x67, 0x66, 0xfa, 0xff, 0x67, 0x66, 0xfa, 0xff, 0x67, 0x66, 0xfa, 0xff, 0x68, 0x67, 0xfa, 0xff, 0x67, 0x68, 0xf9, 0xff, 0x67, 0x69, 0xf9, 0xff, 0x68, 0x6a, 0xf9, 0xff, 0x68, 0x6a, 0xf9, 0xff, 0x67, 0x69, 0xf9, 0xff, 0x67, 0x69, 0xf9, 0xff, 0x68, 0x6a, 0xf9, 0xff, 0x68, 0x6b, 0xf9, 0xff, 0x69, 0x6c, 0xf9, 0xff, 0x69, 0x6c, 0xf9, 0xff, 0x6a, 0x6c, 0xf9, 0xff, 0x6a, 0x6c, 0xf9, 0xff, 0x6b, 0x6d, 0xf9, 0xff, 0x6b, 0x6d, 0xf9, 0xff, 0x6d, 0x6e, 0xf9, 0xff, 0x6a, 0x6b, 0xf7, 0xff, 0x69, 0x6b, 0xf9, 0xff, 0x6c, 0x6e, 0xfa, 0xff, 0x6b, 0x6c, 0xf7, 0xff, 0x6e, 0x71, 0xfa, 0xff, 0x64, 0x6d, 0xf6, 0xff, 0x3e, 0x48, 0xe5, 0xff, 0x2c, 0x23, 0xcb, 0xff, 0xc3, 0xba, 0xe9, 0xff, 0xfb, 0xf3, 0xec, 0xff, 0xeb, 0xe9, 0xf3, 0xff, 0x8f, 0x8e, 0xd2, 0xff, 0x2e, 0x29, 0xb8, 0xff, 0x4d, 0x51, 0xd0, 0xff, 0x41, 0x42, 0xa5, 0xff, 0x3b, 0x39, 0x61, 0xff, 0x59, 0x5d, 0x5b, 0xff, 0x63, 0x70, 0x68, 0xff, 0x6b, 0x72, 0x70, 0xff, 0x88, 0x7e, 0x80, 0xff, 0x99, 0x7c, 0x6c, 0xff, 0xa3, 0x74, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x32, 0xa5, 0xc6, 0xff, 0x02, 0xb4, 0xf9, 0xff, 0x05, 0xb2, 0xfe, 0xff, 0x04, 0xb6, 0xff, 0xff, 0x02, 0xb5, 0xfd, 0xff, 0x01, 0xb7, 0xfd, 0xff, 0x00, 0xb8, 0xfc, 0xff, 0x00, 0xb8, 0xfc, 0xff, 0x05, 0xbd, 0xfe, 0xff, 0x04, 0xc5, 0xff, 0xff, 0x05, 0xd2, 0xfc, 0xff, 0x05, 0xa8, 0xd5, 0xff, 0x06, 0x42, 0xb9, 0xff, 0x3e, 0x25, 0xe4, 0xff, 0x3c, 0x2f, 0xdd, 0xff, 0x2b, 0x34, 0xdb, 0xff, 0x2f, 0x2d, 0xec, 0xff, 0x35, 0x2a, 0xee, 0xff, 0x37, 0x29, 0xed, 0xff, 0x32, 0x2b, 0xea, 0xff, 0x2f, 0x2c, 0xe8, 0xff, 0x32, 0x2b, 0xe9, 0xff, 0x35, 0x2a, 0xe9, 0xff, 0x34, 0x2c, 0xe8, 0xff, 0x34, 0x2c, 0xe8, 0xff, 0x34, 0x2c, 0xe8, 0xff, 0x34, 0x2b, 0xe8, 0xff, 0x34, 0x2c, 0xe9, 0xff, 0x34, 0x2c, 0xe9, 0xff, 0x35, 0x2b, 0xea, 0xff, 0x35, 0x2b, 0xed, 0xff, 0x36, 0x2b, 0xed, 0xff, 0x36, 0x2b, 0xee, 0xff, 0x36, 0x2c, 0xec, 0xff, 0x36, 0x2c, 0xec, 0xff, 0x37, 0x2d, 0xec, 0xff, 0x35, 0x2e, 0xeb, 0xff, 0x33, 0x30, 0xe8, 0xff, 0x34, 0x31, 0xea, 0xff, 0x34, 0x30, 0xe9, 0xff, 0x33, 0x30, 0xe8, 0xff, 0x33, 0x30, 0xe9, 0xff, 0x34, 0x31, 0xe9, 0xff, 0x35, 0x32, 0xea, 0xff, 0x34, 0x32, 0xe9, 0xff, 0x34, 0x32, 0xea, 0xff, 0x36, 0x32, 0xea, 0xff, 0x37, 0x32, 0xeb, 0xff, 0x37, 0x32, 0xeb, 0xff, 0x37, 0x32, 0xeb, 0xff, 0x39, 0x34, 0xea, 0xff, 0x38, 0x32, 0xea, 0xff, 0x36, 0x33, 0xed, 0xff, 0x3a, 0x35, 0xee, 0xff, 0x3a, 0x35, 0xea, 0xff, 0x38, 0x39, 0xea, 0xff, 0x31, 0x3a, 0xea, 0xff, 0x34, 0x3a, 0xec, 0xff, 0x3e, 0x34, 0xd8, 0xff, 0xad, 0xaa, 0xe8, 0xff, 0xe3, 0xe5, 0xfa, 0xff, 0x90, 0x93, 0xc2, 0xff, 0x2c, 0x26, 0xbb, 0xff, 0x4a, 0x48, 0xe2, 0xff, 0x50, 0x4b, 0xce, 0xff, 0x50, 0x3f, 0x91, 0xff, 0x74, 0x58, 0x51, 0xff, 0x70, 0x5b, 0x3b, 0xff, 0x67, 0x60, 0x54, 0xff, 0x85, 0x76, 0x71, 0xff, 0x9c, 0x79, 0x66, 0xff, 0xa0, 0x74, 0x51, 0xff, 0xb9, 0x80, 0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2f, 0xa0, 0xc2, 0xff, 0x02, 0xb5, 0xf8, 0xff, 0x0d, 0xb0, 0xff, 0xff, 0x0c, 0xb4, 0xff, 0xff, 0x07, 0xb4, 0xfd, 0xff, 0x05, 0xb6, 0xfc, 0xff, 0x03, 0xb7, 0xfc, 0xff, 0x03, 0xb7, 0xfc, 0xff, 0x07, 0xbb, 0xff, 0xff, 0x04, 0xc4, 0xfe, 0xff, 0x02, 0xd5, 0xfa, 0xff, 0x08, 0xb5, 0xe0, 0xff, 0x07, 0x4d, 0xc6, 0xff, 0x33, 0x18, 0xe8, 0xff, 0x36, 0x26, 0xe7, 0xff, 0x26, 0x2f, 0xe6, 0xff, 0x1f, 0x2a, 0xee, 0xff, 0x28, 0x26, 0xf1, 0xff, 0x2b, 0x26, 0xf2, 0xff, 0x26, 0x2a, 0xf0, 0xff, 0x24, 0x2c, 0xee, 0xff, 0x28, 0x2b, 0xee, 0xff, 0x2c, 0x2a, 0xef, 0xff, 0x2b, 0x2b, 0xef, 0xff, 0x2b, 0x2a, 0xef, 0xff, 0x2b, 0x2a, 0xef, 0xff, 0x2b, 0x2a, 0xef, 0xff, 0x2b, 0x2a, 0xef, 0xff, 0x2b, 0x2a, 0xef, 0xff, 0x2b, 0x2a, 0xf0, 0xff, 0x2b, 0x2a, 0xf2, 0xff, 0x2c, 0x2b, 0xf3, 0xff, 0x2d, 0x2c, 0xf2, 0xff, 0x2c, 0x2b, 0xf0, 0xff, 0x2c, 0x2b, 0xf1, 0xff, 0x2d, 0x2c, 0xf1, 0xff, 0x2e, 0x2c, 0xf2, 0xff, 0x30, 0x2b, 0xf2, 0xff, 0x30, 0x2c, 0xf3, 0xff, 0x30, 0x2c, 0xf3, 0xff, 0x30, 0x2c, 0xf3, 0xff, 0x30, 0x2c, 0xf3, 0xff, 0x30, 0x2c, 0xf3, 0xff, 0x30, 0x2d, 0xf4, 0xff, 0x2f, 0x2d, 0xf4, 0xff, 0x2f, 0x2d, 0xf4, 0xff, 0x30, 0x2e, 0xf5, 0xff, 0x32, 0x2e, 0xf5, 0xff, 0x32, 0x2e, 0xf5, 0xff, 0x31, 0x2d, 0xf5, 0xff, 0x33, 0x2e, 0xf4, 0xff, 0x33, 0x2e, 0xf5, 0xff, 0x30, 0x2c, 0xf7, 0xff, 0x32, 0x2e, 0xf7, 0xff, 0x32, 0x2f, 0xf2, 0xff, 0x2b, 0x30, 0xed, 0xff, 0x25, 0x37, 0xf3, 0xff, 0x42, 0x3f, 0xf8, 0xff, 0x46, 0x34, 0xd9, 0xff, 0x70, 0x6d, 0xd2, 0xff, 0x78, 0x79, 0xe2, 0xff, 0x29, 0x27, 0xd4, 0xff, 0x39, 0x36, 0xe5, 0xff, 0x36, 0x3a, 0xcf, 0xff, 0x55, 0x34, 0x86, 0xff, 0x94, 0x5b, 0x51, 0xff, 0xa2, 0x74, 0x4b, 0xff, 0x90, 0x64, 0x2c, 0xff, 0xa1, 0x6c, 0x44, 0xff, 0xa9, 0x71, 0x52, 0xff, 0xb5, 0x76, 0x43, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x45, 0x88, 0x94, 0xff, 0x39, 0xc1, 0xed, 0xff, 0x04, 0xb8, 0xf7, 0xff, 0x0c, 0xb9, 0xfc, 0xff, 0x03, 0xb4, 0xfd, 0xff, 0x01, 0xb5, 0xfe, 0xff, 0x01, 0xb7, 0xfe, 0xff, 0x03, 0xb8, 0xfd, 0xff, 0x0a, 0xbe, 0xfe, 0xff, 0x06, 0xc7, 0xfd, 0xff, 0x00, 0xd1, 0xfc, 0xff, 0x0e, 0xc1, 0xfd, 0xff, 0x03, 0x5e, 0xcb, 0xff, 0x21, 0x21, 0xd8, 0xff, 0x3b, 0x2d, 0xfc, 0xff, 0x29, 0x27, 0xf7, 0xff, 0x2a, 0x2d, 0xee, 0xff, 0x37, 0x2b, 0xec, 0xff, 0x3a, 0x2a, 0xf0, 0xff, 0x2e, 0x2e, 0xed, 0xff, 0x25, 0x34, 0xe6, 0xff, 0x27, 0x33, 0xe8, 0xff, 0x2a, 0x30, 0xee, 0xff, 0x29, 0x32, 0xee, 0xff, 0x29, 0x31, 0xee, 0xff, 0x29, 0x31, 0xee, 0xff, 0x29, 0x32, 0xee, 0xff, 0x2a, 0x32, 0xef, 0xff, 0x2a, 0x32, 0xef, 0xff, 0x2a, 0x33, 0xef, 0xff, 0x2b, 0x33, 0xf0, 0xff, 0x2b, 0x33, 0xf0, 0xff, 0x2b, 0x33, 0xf0, 0xff, 0x2b, 0x34, 0xf0, 0xff, 0x2c, 0x34, 0xf0, 0xff, 0x2c, 0x34, 0xf1, 0xff, 0x2c, 0x34, 0xf0, 0xff, 0x2b, 0x33, 0xf0, 0xff, 0x2c, 0x33, 0xf0, 0xff, 0x2c, 0x33, 0xf0, 0xff, 0x2c, 0x33, 0xf0, 0xff, 0x2c, 0x33, 0xf0, 0xff, 0x2b, 0x33, 0xf0, 0xff, 0x2d, 0x35, 0xf1, 0xff, 0x2f, 0x36, 0xf0, 0xff, 0x30, 0x37, 0xf1, 0xff, 0x30, 0x37, 0xf1, 0xff, 0x30, 0x37, 0xf2, 0xff, 0x31, 0x38, 0xf2, 0xff, 0x31, 0x38, 0xf2, 0xff, 0x2f, 0x38, 0xf1, 0xff, 0x2d, 0x38, 0xf1, 0xff, 0x2d, 0x37, 0xf2, 0xff, 0x2f, 0x36, 0xf4, 0xff, 0x31, 0x34, 0xf5, 0xff, 0x33, 0x32, 0xf6, 0xff, 0x32, 0x31, 0xf8, 0xff, 0x4c, 0x3c, 0xf9, 0xff, 0x49, 0x35, 0xdf, 0xff, 0x30, 0x30, 0xcb, 0xff, 0x00, 0x18, 0xd6, 0xff, 0x20, 0x2d, 0xec, 0xff, 0x35, 0x2e, 0xca, 0xff, 0x55, 0x2d, 0x7b, 0xff, 0xa8, 0x5e, 0x4c, 0xff, 0xc4, 0x76, 0x3b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xc6, 0x71, 0x39, 0xff, 0xb3, 0x66, 0x4d, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x6d, 0x6c, 0x5e, 0xff, 0x37, 0xa1, 0xb8, 0xff, 0x17, 0xc6, 0xf3, 0xff, 0x04, 0xc2, 0xf6, 0xff, 0x00, 0xba, 0xfd, 0xff, 0x03, 0xb5, 0xff, 0xff, 0x0a, 0xaf, 0xfe, 0xff, 0x0a, 0xb0, 0xfd, 0xff, 0x0c, 0xb8, 0xfc, 0xff, 0x03, 0xc9, 0xf6, 0xff, 0x00, 0xdb, 0xfc, 0xff, 0x10, 0xd6, 0xfb, 0xff, 0x11, 0x8e, 0xd2, 0xff, 0x14, 0x3d, 0xbc, 0xff, 0x33, 0x38, 0xe9, 0xff, 0x2c, 0x2e, 0xf3, 0xff, 0x2d, 0x31, 0xed, 0xff, 0x39, 0x30, 0xeb, 0xff, 0x3c, 0x2d, 0xf2, 0xff, 0x34, 0x2e, 0xf3, 0xff, 0x2f, 0x33, 0xed, 0xff, 0x33, 0x30, 0xef, 0xff, 0x36, 0x2d, 0xf4, 0xff, 0x32, 0x30, 0xf4, 0xff, 0x32, 0x30, 0xf4, 0xff, 0x33, 0x31, 0xf5, 0xff, 0x33, 0x31, 0xf5, 0xff, 0x33, 0x31, 0xf5, 0xff, 0x33, 0x31, 0xf5, 0xff, 0x34, 0x32, 0xf6, 0xff, 0x35, 0x33, 0xf8, 0xff, 0x35, 0x33, 0xf7, 0xff, 0x34, 0x33, 0xf7, 0xff, 0x35, 0x33, 0xf7, 0xff, 0x34, 0x33, 0xf7, 0xff, 0x34, 0x33, 0xf7, 0xff, 0x34, 0x33, 0xf7, 0xff, 0x34, 0x32, 0xf6, 0xff, 0x34, 0x32, 0xf6, 0xff, 0x34, 0x32, 0xf6, 0xff, 0x34, 0x32, 0xf6, 0xff, 0x34, 0x32, 0xf6, 0xff, 0x34, 0x32, 0xf6, 0xff, 0x36, 0x33, 0xf6, 0xff, 0x37, 0x34, 0xf6, 0xff, 0x37, 0x33, 0xf6, 0xff, 0x37, 0x33, 0xf6, 0xff, 0x37, 0x33, 0xf6, 0xff, 0x37, 0x34, 0xf6, 0xff, 0x37, 0x34, 0xf6, 0xff, 0x3a, 0x34, 0xf8, 0xff, 0x3c, 0x34, 0xf9, 0xff, 0x3b, 0x35, 0xf8, 0xff, 0x39, 0x35, 0xf8, 0xff, 0x39, 0x36, 0xf9, 0xff, 0x3b, 0x35, 0xf8, 0xff, 0x3b, 0x34, 0xf8, 0xff, 0x48, 0x43, 0xfc, 0xff, 0x42, 0x40, 0xf6, 0xff, 0x13, 0x17, 0xd4, 0xff, 0x02, 0x17, 0xcb, 0xff, 0x14, 0x22, 0xae, 0xff, 0x53, 0x31, 0x69, 0xff, 0x9e, 0x5b, 0x46, 0xff, 0xbf, 0x70, 0x40, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x98, 0x60, 0x3c, 0xff, 0x55, 0x73, 0x70, 0xff, 0x21, 0xa7, 0xc1, 0xff, 0x2f, 0xbd, 0xe2, 0xff, 0x23, 0xc0, 0xf7, 0xff, 0x0f, 0xb7, 0xfe, 0xff, 0x03, 0xb4, 0xff, 0xff, 0x00, 0xb9, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x09, 0xd3, 0xff, 0xff, 0x00, 0xd9, 0xfd, 0xff, 0x20, 0xe1, 0xfd, 0xff, 0x35, 0xbd, 0xec, 0xff, 0x0e, 0x54, 0xb8, 0xff, 0x1f, 0x32, 0xe2, 0xff, 0x2d, 0x34, 0xff, 0xff, 0x30, 0x3c, 0xf5, 0xff, 0x37, 0x3d, 0xf2, 0xff, 0x39, 0x38, 0xf9, 0xff, 0x34, 0x37, 0xfc, 0xff, 0x35, 0x3a, 0xfb, 0xff, 0x3c, 0x36, 0xfc, 0xff, 0x44, 0x34, 0xfc, 0xff, 0x45, 0x38, 0xf9, 0xff, 0x45, 0x38, 0xf9, 0xff, 0x45, 0x38, 0xf9, 0xff, 0x45, 0x38, 0xf9, 0xff, 0x46, 0x38, 0xfa, 0xff, 0x46, 0x38, 0xfa, 0xff, 0x46, 0x39, 0xfa, 0xff, 0x46, 0x3a, 0xfb, 0xff, 0x46, 0x3a, 0xfb, 0xff, 0x47, 0x3a, 0xfb, 0xff, 0x47, 0x3a, 0xfb, 0xff, 0x47, 0x3b, 0xfc, 0xff, 0x47, 0x3b, 0xfc, 0xff, 0x48, 0x3b, 0xfc, 0xff, 0x4a, 0x3c, 0xfc, 0xff, 0x4a, 0x3c, 0xfc, 0xff, 0x4a, 0x3c, 0xfc, 0xff, 0x4a, 0x3c, 0xfc, 0xff, 0x4a, 0x3c, 0xfc, 0xff, 0x49, 0x3c, 0xfc, 0xff, 0x4b, 0x3d, 0xfc, 0xff, 0x4b, 0x3e, 0xfd, 0xff, 0x4b, 0x3d, 0xfd, 0xff, 0x4b, 0x3d, 0xfd, 0xff, 0x4b, 0x3d, 0xfd, 0xff, 0x4b, 0x3d, 0xfd, 0xff, 0x4b, 0x3d, 0xfd, 0xff, 0x4b, 0x3d, 0xfd, 0xff, 0x4a, 0x3d, 0xfd, 0xff, 0x48, 0x3e, 0xfd, 0xff, 0x46, 0x41, 0xfc, 0xff, 0x44, 0x42, 0xfc, 0xff, 0x44, 0x43, 0xfa, 0xff, 0x44, 0x43, 0xf8, 0xff, 0x44, 0x4b, 0xf7, 0xff, 0x3d, 0x49, 0xfe, 0xff, 0x20, 0x29, 0xe3, 0xff, 0x10, 0x19, 0xaf, 0xff, 0x4c, 0x37, 0x73, 0xff, 0x92, 0x58, 0x47, 0xff, 0xbf, 0x70, 0x50, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x80, 0x40, 0xff, 0xa0, 0x65, 0x38, 0xff, 0x5f, 0x56, 0x49, 0xff, 0x55, 0x7c, 0x86, 0xff, 0x3e, 0x9b, 0xb7, 0xff, 0x32, 0xab, 0xd2, 0xff, 0x24, 0xb3, 0xde, 0xff, 0x17, 0xb8, 0xe1, 0xff, 0x21, 0xbc, 0xe5, 0xff, 0x30, 0xb9, 0xe5, 0xff, 0x2a, 0xbd, 0xdb, 0xff, 0x31, 0xb9, 0xc5, 0xff, 0x39, 0x99, 0xa6, 0xff, 0x3a, 0x4d, 0x75, 0xff, 0x40, 0x2f, 0x97, 0xff, 0x49, 0x34, 0xb8, 0xff, 0x46, 0x3a, 0xa7, 0xff, 0x46, 0x3d, 0xa2, 0xff, 0x44, 0x3b, 0xa9, 0xff, 0x40, 0x38, 0xb0, 0xff, 0x41, 0x3b, 0xab, 0xff, 0x46, 0x3a, 0xac, 0xff, 0x48, 0x38, 0xb0, 0xff, 0x46, 0x38, 0xae, 0xff, 0x46, 0x38, 0xae, 0xff, 0x46, 0x38, 0xae, 0xff, 0x46, 0x38, 0xae, 0xff, 0x46, 0x38, 0xae, 0xff, 0x46, 0x38, 0xae, 0xff, 0x45, 0x37, 0xad, 0xff, 0x45, 0x38, 0xac, 0xff, 0x46, 0x39, 0xac, 0xff, 0x47, 0x39, 0xad, 0xff, 0x47, 0x3a, 0xad, 0xff, 0x48, 0x3b, 0xaf, 0xff, 0x49, 0x3b, 0xaf, 0xff, 0x49, 0x3b, 0xaf, 0xff, 0x48, 0x3b, 0xaf, 0xff, 0x48, 0x3b, 0xaf, 0xff, 0x48, 0x3b, 0xaf, 0xff, 0x48, 0x3b, 0xaf, 0xff, 0x48, 0x3b, 0xaf, 0xff, 0x48, 0x3b, 0xaf, 0xff, 0x47, 0x3b, 0xaf, 0xff, 0x47, 0x3c, 0xb0, 0xff, 0x48, 0x3c, 0xb0, 0xff, 0x48, 0x3c, 0xb0, 0xff, 0x48, 0x3c, 0xb0, 0xff, 0x48, 0x3c, 0xb1, 0xff, 0x48, 0x3c, 0xb1, 0xff, 0x4a, 0x3b, 0xb1, 0xff, 0x4b, 0x3b, 0xb1, 0xff, 0x4a, 0x3c, 0xb1, 0xff, 0x4a, 0x3c, 0xb0, 0xff, 0x4c, 0x3c, 0xaf, 0xff, 0x4c, 0x3c, 0xad, 0xff, 0x4e, 0x3c, 0xad, 0xff, 0x49, 0x3d, 0xa8, 0xff, 0x47, 0x3e, 0xb2, 0xff, 0x57, 0x42, 0xb2, 0xff, 0x69, 0x42, 0x79, 0xff, 0x92, 0x5a, 0x42, 0xff, 0xad, 0x6d, 0x37, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x73, 0x40, 0xff, 0x78, 0x4b, 0x1e, 0xff, 0x9f, 0x57, 0x07, 0xff, 0x95, 0x5e, 0x2b, 0xff, 0x73, 0x6d, 0x53, 0xff, 0x5d, 0x73, 0x64, 0xff, 0x65, 0x75, 0x68, 0xff, 0x71, 0x77, 0x71, 0xff, 0x5f, 0x6b, 0x70, 0xff, 0x6a, 0x68, 0x5a, 0xff, 0x80, 0x62, 0x2e, 0xff, 0x99, 0x5f, 0x00, 0xff, 0x68, 0x46, 0x00, 0xff, 0x5e, 0x36, 0x1b, 0xff, 0x59, 0x33, 0x40, 0xff, 0x59, 0x33, 0x26, 0xff, 0x59, 0x33, 0x00, 0xff, 0x59, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x26, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x59, 0x33, 0x0d, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x26, 0xff, 0x4d, 0x33, 0x26, 0xff, 0x4d, 0x33, 0x26, 0xff, 0x4d, 0x33, 0x26, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x26, 0xff, 0x4d, 0x33, 0x26, 0xff, 0x4d, 0x33, 0x26, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x0d, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x0d, 0xff, 0x4d, 0x33, 0x00, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x26, 0xff, 0x59, 0x33, 0x26, 0xff, 0x4d, 0x33, 0x1a, 0xff, 0x4d, 0x33, 0x00, 0xff, 0x66, 0x40, 0x4d, 0xff, 0x8c, 0x4d, 0x40, 0xff, 0xb9, 0x74, 0x2e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xb3, 0x66, 0x00, 0xff, 0x8e, 0x55, 0x00, 0xff, 0x71, 0x39, 0x00, 0xff, 0x6d, 0x00, 0x00, 0xff, 0xb0, 0x67, 0x00, 0xff, 0xb9, 0x76, 0x1e, 0xff, 0xb1, 0x70, 0x00, 0xff, 0x80, 0x2a, 0x00, 0xff, 0xc6, 0x71, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
-#endif
+  /*调色板（B, G, R, A）*/
+  0x00, 0x00, 0x00, 0xff, 0x39, 0x34, 0xff, 0xff, 0xe7, 0x8a, 0x39, 0xff, 0x29, 0x2c, 0xf7, 0xff, 0xe7, 0x92, 0x42, 0xff, 0x52, 0x34, 0x29, 0xff, 0x31, 0x34, 0xf7, 0xff, 0x08, 0xd3, 0xff, 0xff,
+  0xde, 0xf7, 0xff, 0xff, 0xce, 0xa2, 0x6b, 0xff, 0xce, 0x79, 0x29, 0xff, 0xef, 0xaa, 0x5a, 0xff, 0x8c, 0xa6, 0x8c, 0xff, 0x29, 0x30, 0xe7, 0xff, 0xb5, 0xb2, 0xb5, 0xff, 0x52, 0xc7, 0xef, 0xff,
+  0xce, 0x92, 0x52, 0xff, 0x00, 0xc7, 0xff, 0xff, 0x08, 0xc7, 0xff, 0xff, 0xde, 0xaa, 0x6b, 0xff, 0xde, 0x8a, 0x39, 0xff, 0x18, 0xf3, 0xff, 0xff, 0x73, 0x6d, 0xff, 0xff, 0xad, 0xa2, 0xa5, 0xff,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xcf, 0xad, 0xff, 0x52, 0x34, 0x10, 0xff, 0x21, 0x24, 0x5a, 0xff, 0x21, 0xcf, 0xd6, 0xff, 0x84, 0xc7, 0xc6, 0xff, 0x7b, 0xdf, 0xd6, 0xff, 0x00, 0xba, 0xef, 0xff,
+  0x29, 0xba, 0xef, 0xff, 0xe7, 0x8e, 0x31, 0xff, 0xe7, 0x8e, 0x39, 0xff, 0xd6, 0x96, 0x4a, 0xff, 0x7b, 0x6d, 0xce, 0xff, 0x5a, 0xcf, 0xd6, 0xff, 0x31, 0xdb, 0xff, 0xff, 0x08, 0x49, 0xbd, 0xff,
+  0x08, 0x79, 0xc6, 0xff, 0x52, 0xa6, 0xb5, 0xff, 0x6b, 0x71, 0xc6, 0xff, 0x9c, 0x92, 0xf7, 0xff, 0x08, 0xd7, 0xff, 0xff, 0x10, 0xd7, 0xff, 0xff, 0x73, 0x75, 0xce, 0xff, 0xef, 0x9e, 0x52, 0xff,
+  0xff, 0xff, 0x00, 0xff, 0x4a, 0x38, 0xb5, 0xff, 0x42, 0x45, 0xd6, 0xff, 0x39, 0x3c, 0xff, 0xff, 0x31, 0x51, 0xf7, 0xff, 0x52, 0x55, 0x73, 0xff, 0x21, 0x38, 0x8c, 0xff, 0x52, 0x38, 0x7b, 0xff,
+  0x94, 0x9a, 0x6b, 0xff, 0x94, 0x92, 0x9c, 0xff, 0x4a, 0xba, 0xbd, 0xff, 0x6b, 0xba, 0xc6, 0xff, 0x31, 0x2c, 0xf7, 0xff, 0x31, 0x2c, 0xff, 0xff, 0x94, 0x96, 0xc6, 0xff, 0x94, 0xb6, 0xc6, 0xff,
+  0x18, 0xcf, 0xe7, 0xff, 0x18, 0xe3, 0xff, 0xff, 0x10, 0xeb, 0xff, 0xff, 0x39, 0x34, 0xef, 0xff, 0x94, 0x86, 0xe7, 0xff, 0x94, 0x92, 0xde, 0xff, 0x08, 0xcf, 0xef, 0xff, 0x52, 0x45, 0x52, 0xff,
+  0x00, 0xba, 0xff, 0xff, 0x08, 0xba, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0x10, 0xdb, 0xf7, 0xff, 0x08, 0xc3, 0xe7, 0xff, 0x08, 0xc3, 0xf7, 0xff, 0x73, 0x69, 0xde, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xc6, 0x75, 0x18, 0xff, 0x94, 0xdb, 0xef, 0xff, 0xb5, 0xdf, 0xf7, 0xff, 0x94, 0xcf, 0xd6, 0xff, 0xc6, 0xc7, 0xb5, 0xff, 0xb5, 0x65, 0x08, 0xff, 0xef, 0xe3, 0xde, 0xff, 0xff, 0xef, 0xde, 0xff,
+  0x7b, 0x75, 0xd6, 0xff, 0x7b, 0x79, 0xff, 0xff, 0x7b, 0x7d, 0xff, 0xff, 0x9c, 0xe3, 0xde, 0xff, 0xbd, 0xd3, 0xde, 0xff, 0x4a, 0x3c, 0xff, 0xff, 0x4a, 0x49, 0xff, 0xff, 0x18, 0xb6, 0xc6, 0xff,
+  0x31, 0xae, 0xce, 0xff, 0x18, 0xa6, 0xc6, 0xff, 0x31, 0xa6, 0xb5, 0xff, 0x29, 0x14, 0xc6, 0xff, 0x29, 0x28, 0xbd, 0xff, 0x08, 0xbe, 0xff, 0xff, 0x18, 0xbe, 0xff, 0xff, 0x7b, 0x61, 0x5a, 0xff,
+  0xa5, 0x69, 0x4a, 0xff, 0x6b, 0x59, 0x73, 0xff, 0x6b, 0x49, 0xa5, 0xff, 0x08, 0xaa, 0xd6, 0xff, 0x18, 0x9a, 0xef, 0xff, 0xf7, 0xdb, 0xbd, 0xff, 0xff, 0xdf, 0xce, 0xff, 0x00, 0x08, 0xce, 0xff,
+  0x10, 0x20, 0xbd, 0xff, 0x39, 0x28, 0xf7, 0xff, 0x39, 0x34, 0xe7, 0xff, 0xce, 0x8e, 0x4a, 0xff, 0xc6, 0x8e, 0x63, 0xff, 0xd6, 0xcf, 0xce, 0xff, 0xd6, 0xdf, 0xd6, 0xff, 0x08, 0xa2, 0x8c, 0xff,
+  0x6b, 0xa6, 0xa5, 0xff, 0x84, 0x86, 0xff, 0xff, 0x94, 0x92, 0xff, 0xff, 0xef, 0xeb, 0xef, 0xff, 0xef, 0xeb, 0xff, 0xff, 0xa5, 0x9a, 0xd6, 0xff, 0xb5, 0xb2, 0xd6, 0xff, 0xef, 0xae, 0x6b, 0xff,
+  0xef, 0xb6, 0x7b, 0xff, 0x9c, 0xeb, 0xff, 0xff, 0xb5, 0xf3, 0xff, 0xff, 0x08, 0xcf, 0xff, 0xff, 0x10, 0xcb, 0xff, 0xff, 0x39, 0xae, 0xd6, 0xff, 0x39, 0xba, 0xd6, 0xff, 0x00, 0x00, 0xf7, 0xff,
+  0x21, 0x20, 0xef, 0xff, 0xc6, 0x9e, 0x7b, 0xff, 0xbd, 0xb6, 0x9c, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xb5, 0x7d, 0x39, 0xff, 0xd6, 0x8a, 0x42, 0xff, 0xce, 0x79, 0x39, 0xff,
+  0xd6, 0x8a, 0x39, 0xff, 0x6b, 0x6d, 0x6b, 0xff, 0x5a, 0x86, 0x94, 0xff, 0x31, 0xc7, 0xce, 0xff, 0x4a, 0xc7, 0xce, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x10, 0xc3, 0xff, 0xff, 0x84, 0x71, 0xde, 0xff,
+  0xd6, 0x8a, 0x29, 0xff, 0xde, 0x8a, 0x29, 0xff, 0xde, 0x9e, 0x5a, 0xff, 0xde, 0xa6, 0x63, 0xff, 0x52, 0x55, 0xb5, 0xff, 0x4a, 0x4d, 0xd6, 0xff, 0x21, 0xcb, 0xf7, 0xff, 0x39, 0xcb, 0xef, 0xff,
+  0xde, 0xb6, 0x84, 0xff, 0xde, 0xc7, 0xa5, 0xff, 0x73, 0x79, 0x73, 0xff, 0x94, 0x7d, 0x6b, 0xff, 0x42, 0x34, 0xe7, 0xff, 0x42, 0x45, 0xef, 0xff, 0x52, 0xbe, 0xd6, 0xff, 0x8c, 0x7d, 0xde, 0xff,
+  0xbd, 0x86, 0x4a, 0xff, 0xe7, 0x8a, 0x42, 0xff, 0x29, 0xef, 0xff, 0xff, 0x4a, 0xe7, 0xff, 0xff, 0x21, 0xd7, 0xf7, 0xff, 0x39, 0xdf, 0xef, 0xff, 0x00, 0xcf, 0xff, 0xff, 0x08, 0xcb, 0xff, 0xff,
+  0x4a, 0x49, 0x5a, 0xff, 0x63, 0x61, 0x5a, 0xff, 0x21, 0xbe, 0xde, 0xff, 0x42, 0xcb, 0xde, 0xff, 0x63, 0x61, 0xff, 0xff, 0x6b, 0x65, 0xff, 0xff, 0xce, 0x8a, 0x39, 0xff, 0xc6, 0x8a, 0x42, 0xff,
+  0xf7, 0x8e, 0x39, 0xff, 0xff, 0x82, 0x42, 0xff, 0x73, 0x69, 0xa5, 0xff, 0x8c, 0x86, 0x94, 0xff, 0x94, 0x65, 0x9c, 0xff, 0xa5, 0x79, 0x94, 0xff, 0x00, 0x04, 0xde, 0xff, 0x18, 0x14, 0xde, 0xff,
+  0xef, 0xb2, 0x84, 0xff, 0xff, 0xba, 0x84, 0xff, 0x6b, 0x69, 0xff, 0xff, 0x6b, 0x6d, 0xff, 0xff, 0xef, 0xbe, 0x84, 0xff, 0xff, 0xc3, 0x8c, 0xff, 0x73, 0x71, 0x7b, 0xff, 0x94, 0x65, 0x84, 0xff,
+  0x52, 0x55, 0xde, 0xff, 0x52, 0x4d, 0xf7, 0xff, 0xef, 0xbe, 0x8c, 0xff, 0xff, 0xc7, 0x9c, 0xff, 0xde, 0x8a, 0x31, 0xff, 0xde, 0x8e, 0x31, 0xff, 0xd6, 0xcb, 0xf7, 0xff, 0xce, 0xdf, 0xef, 0xff,
+  0x63, 0x65, 0xc6, 0xff, 0x73, 0x61, 0xc6, 0xff, 0x6b, 0x65, 0xd6, 0xff, 0x6b, 0x61, 0xef, 0xff, 0x63, 0xc3, 0xc6, 0xff, 0x6b, 0xd3, 0xce, 0xff, 0xce, 0x86, 0x29, 0xff, 0xd6, 0x82, 0x31, 0xff,
+  0x73, 0x6d, 0x6b, 0xff, 0x94, 0x65, 0x73, 0xff, 0x84, 0x7d, 0x84, 0xff, 0x8c, 0x8a, 0x84, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x10, 0xdb, 0xff, 0xff, 0x31, 0x59, 0x94, 0xff, 0x5a, 0x59, 0x8c, 0xff,
+  0x8c, 0x7d, 0xbd, 0xff, 0x7b, 0xaa, 0xb5, 0xff, 0x29, 0x30, 0xce, 0xff, 0x39, 0x34, 0xde, 0xff, 0x52, 0xdb, 0xff, 0xff, 0x63, 0xdb, 0xff, 0xff, 0x10, 0x14, 0xff, 0xff, 0x29, 0x24, 0xff, 0xff,
+  0x7b, 0xcb, 0xde, 0xff, 0x7b, 0xd3, 0xef, 0xff, 0x7b, 0xdf, 0xe7, 0xff, 0x7b, 0xe3, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x10, 0xe3, 0xff, 0xff, 0xd6, 0xdf, 0xde, 0xff, 0xe7, 0xdb, 0xe7, 0xff,
+  0x9c, 0x9a, 0xff, 0xff, 0xad, 0xa2, 0xf7, 0xff, 0x7b, 0x75, 0xef, 0xff, 0x73, 0x75, 0xff, 0xff, 0x73, 0x28, 0x00, 0xff, 0x4a, 0x51, 0x42, 0xff, 0x29, 0x28, 0xe7, 0xff, 0x39, 0x30, 0xd6, 0xff,
+  0xad, 0x9e, 0x84, 0xff, 0xa5, 0x9e, 0x8c, 0xff, 0x94, 0x55, 0x08, 0xff, 0x94, 0x5d, 0x39, 0xff, 0x42, 0x34, 0xff, 0xff, 0x42, 0x41, 0xff, 0xff, 0x29, 0xcf, 0xff, 0xff, 0x21, 0xd7, 0xff, 0xff,
+
+  /*像素索引*/
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf8, 0xe1, 0x9f, 0x93, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x23, 0xf8, 0x0c, 0xf8, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0c, 0xa6, 0x9f, 0xad, 0xd5, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x0c,
+  0x94, 0xad, 0xd5, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+  0x0c, 0xb3, 0xdc, 0x4a, 0xac, 0xea, 0xee, 0x57, 0x6d, 0x6e, 0x57, 0x57, 0x6e, 0xee, 0xa6, 0xb3, 0x41, 0x4a, 0x0f, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x78, 0x40, 0xae, 0x41, 0xb3, 0x53, 0xcf, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x7b, 0x51, 0x9f, 0x4a,
+  0xff, 0x48, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xe1, 0x9f,
+  0xae, 0x4a, 0x9f, 0x53, 0x7b, 0x8b, 0x8b, 0x7c, 0x8c, 0x8b, 0x8b, 0x7c, 0x51, 0x9e, 0x2c, 0x2d, 0x49, 0x48, 0x0f, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x3b, 0x9f, 0x12, 0x2d, 0x9f, 0xe8, 0x08, 0x8b, 0x7b, 0x8c, 0x8c, 0x7b, 0x8b, 0x08, 0x51, 0x9e, 0x4a, 0x2d, 0x84,
+  0x48, 0x48, 0x0f, 0xf8, 0xd7, 0x98, 0x0a, 0x8f, 0xb6, 0xb6, 0x22, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xe1, 0x9e, 0xaf, 0x4a,
+  0x40, 0x53, 0x7b, 0x8b, 0x8b, 0x8c, 0x08, 0x7b, 0x8b, 0x08, 0x51, 0x46, 0xdc, 0xdd, 0x4b, 0x1f, 0x1f, 0x6b, 0xa6, 0xf9, 0x10, 0x23, 0x04, 0x23, 0x10, 0x73, 0x23, 0x8e, 0xb6, 0x8e, 0xb9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x78, 0x9e, 0x83, 0xff, 0x1c, 0x1d, 0x7b, 0x8b, 0x7b, 0x08, 0x8b, 0x8b, 0x8b, 0x8c, 0x52, 0x9f, 0xff, 0xff, 0x40, 0x6b, 0x61,
+  0x29, 0x29, 0x3b, 0x8a, 0xa0, 0x80, 0x80, 0xa0, 0xa0, 0x13, 0x13, 0x9b, 0x9a, 0x23, 0x8e, 0x8e, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x3b, 0x46, 0x11, 0x2d, 0xb3, 0x53,
+  0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x8b, 0x7c, 0x52, 0xb3, 0xac, 0x9e, 0x86, 0x62, 0x3a, 0xd4, 0xe8, 0xe9, 0x5b, 0xa1, 0xca, 0xc4, 0xc4, 0xc4, 0x80, 0x80, 0x80, 0xc4, 0x80, 0x13, 0x13, 0x23,
+  0x8e, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x3b, 0x66, 0xae, 0xff, 0xa6, 0x53, 0xcf, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x52, 0xb3, 0x1c, 0x60, 0x3a, 0x3b, 0xe8, 0xe9, 0xe9,
+  0xe9, 0xe9, 0x5b, 0x54, 0xca, 0xc5, 0xcb, 0xc5, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0x80, 0x13, 0x10, 0xb7, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x3b, 0x66, 0x11, 0x4b, 0xb3, 0x53, 0xef, 0xee,
+  0xef, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x52, 0x94, 0x5f, 0x60, 0x94, 0x1e, 0x51, 0x51, 0x51, 0xe8, 0xe8, 0xe8, 0x1d, 0xf9, 0x89, 0x09, 0x89, 0x09, 0x13, 0xc0, 0xca, 0xca, 0xca, 0xc4, 0x80, 0x80,
+  0x80, 0x80, 0x13, 0x23, 0x90, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x0c, 0xa6, 0x12, 0x11, 0x2d, 0xa6, 0x53, 0xee, 0xef, 0x56, 0x56, 0x56, 0x7b, 0xef, 0x7c, 0xcf, 0xd4, 0x5f, 0x3a, 0xe9, 0xea, 0x1e, 0xe8, 0xe8, 0x1d, 0xe1,
+  0xe1, 0x29, 0x3b, 0x17, 0x89, 0x89, 0x89, 0x89, 0x09, 0x74, 0x74, 0x74, 0x09, 0xc4, 0xca, 0xc4, 0xc4, 0xc4, 0xc4, 0x13, 0x10, 0x8e, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0c, 0x3b, 0x96, 0xae, 0x4a, 0xa6, 0x7e, 0xef, 0xef, 0xee, 0x56,
+  0x56, 0x56, 0xee, 0x7b, 0x52, 0x3b, 0x62, 0x3b, 0x51, 0xea, 0xe8, 0xe8, 0x3b, 0x3b, 0x3b, 0x53, 0x51, 0x51, 0x81, 0x76, 0x6d, 0x6d, 0x6d, 0x19, 0xcb, 0xca, 0xca, 0x89, 0x74, 0x74, 0x09, 0x80,
+  0xc4, 0xc0, 0xc4, 0xc4, 0xa0, 0x09, 0x8e, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x74, 0xf9, 0xa6, 0x66, 0xae, 0x4b, 0xb3, 0x3f, 0x56, 0x56, 0xee, 0xee, 0xee, 0xef, 0xef, 0x7b, 0xcf, 0x3b, 0x62, 0xd5, 0xea, 0x1e, 0xe8, 0x3f, 0x3f, 0x3f, 0x5c, 0x08, 0x82,
+  0x81, 0xeb, 0x51, 0x5c, 0x6d, 0x6d, 0x19, 0x19, 0xa1, 0xcb, 0xcb, 0xca, 0xca, 0xa0, 0x74, 0xa8, 0x09, 0xc4, 0xc4, 0xc0, 0xc4, 0x80, 0x09, 0xb7, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xa6, 0x49, 0x95, 0xdc, 0x93, 0x7e, 0x56, 0x76, 0xee, 0xef, 0xee, 0xee,
+  0xee, 0xcf, 0xcf, 0x3b, 0x62, 0xd5, 0x51, 0xea, 0xd5, 0x1d, 0x3f, 0x5c, 0x7c, 0x8c, 0x08, 0x82, 0xeb, 0xe5, 0xeb, 0xee, 0x6d, 0x6d, 0x6d, 0x6d, 0x19, 0x19, 0xcb, 0xca, 0xca, 0xc0, 0x80, 0x13,
+  0xa8, 0x10, 0x80, 0xc1, 0x80, 0x80, 0x80, 0x10, 0x8e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe1, 0xfe, 0x48, 0x65, 0x11, 0xe8, 0xee, 0x56, 0x76, 0x76, 0xef, 0x56, 0xef, 0xee, 0x52, 0x3b, 0x62, 0xd4, 0x51, 0x5b, 0x53, 0x3f, 0x3f, 0xcf, 0x8c, 0x8c, 0x7c, 0x08, 0x81,
+  0xeb, 0xab, 0xeb, 0x5c, 0x6e, 0x6d, 0x19, 0x19, 0x19, 0x19, 0x19, 0xcb, 0xca, 0xca, 0xc1, 0xc0, 0x13, 0xa8, 0x8d, 0x13, 0xc4, 0xa0, 0x80, 0x80, 0x9a, 0x8e, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x9e, 0x4d, 0x11, 0x4d, 0x0f, 0x51, 0xcf, 0xcf, 0xcf, 0xcf, 0xef, 0xcf,
+  0x51, 0x25, 0x62, 0x3a, 0x51, 0x5b, 0x53, 0x3f, 0x3f, 0x08, 0x8c, 0x8c, 0x8c, 0x08, 0x82, 0x81, 0xe5, 0x26, 0xe5, 0x5c, 0x6d, 0x6d, 0x6d, 0x19, 0x19, 0x19, 0x19, 0xcb, 0xc5, 0xc5, 0xc5, 0xc1,
+  0x7f, 0x13, 0xa8, 0x8d, 0x13, 0xc4, 0x80, 0x80, 0x7f, 0x73, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xa6, 0xfe, 0x49, 0x48, 0x95, 0x12, 0x9e, 0x0f, 0xe9, 0xe9, 0xe9, 0x0f, 0x0f, 0x9e, 0x4c, 0x62, 0xea, 0x51, 0x53, 0xe1, 0x3f, 0x08, 0x8c, 0x8c, 0x8c, 0x08, 0x82, 0x81, 0xeb,
+  0xe4, 0xff, 0xe5, 0x5c, 0x6d, 0x6e, 0x6e, 0x19, 0x19, 0x19, 0x19, 0xcb, 0xcb, 0xca, 0xca, 0xc0, 0xc0, 0x7f, 0x13, 0xa8, 0x8d, 0x7f, 0x80, 0x7f, 0x7f, 0x9b, 0xb6, 0xa9, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0x12, 0x49, 0x48, 0x48, 0x95, 0x48, 0x48, 0x95, 0x11, 0x11, 0x11,
+  0x46, 0x60, 0x3b, 0x51, 0x1e, 0xe1, 0xe1, 0x82, 0x08, 0x08, 0x08, 0x08, 0x82, 0x81, 0xeb, 0xe4, 0xfe, 0xae, 0xe5, 0x5c, 0x6e, 0x6e, 0x6d, 0x6d, 0x19, 0x19, 0x19, 0xcb, 0xcb, 0xc5, 0xca, 0xca,
+  0xc0, 0x80, 0x7f, 0x0b, 0x8f, 0xb7, 0x7f, 0x9b, 0x9b, 0x9b, 0x23, 0x8e, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0xff, 0x26, 0x26, 0xfe, 0x84, 0x95, 0x48, 0x48, 0x11, 0x11, 0xaf, 0x84, 0x86, 0xe1, 0x5b, 0x1e, 0x1d, 0x78, 0x5c, 0x82, 0x81, 0x82, 0x82, 0x81, 0xeb, 0xe5, 0xab, 0xfe,
+  0x84, 0xae, 0xe5, 0xcf, 0x6e, 0x6e, 0x6d, 0x6d, 0x6d, 0x19, 0x19, 0xcb, 0xcb, 0xc5, 0xca, 0xca, 0xc1, 0xc1, 0x7f, 0x7f, 0x2f, 0x0a, 0x73, 0x0b, 0x23, 0x9b, 0x9a, 0xb6, 0xb6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0x26, 0xab, 0x26, 0x26, 0x26, 0x26, 0xe4, 0x26, 0x26, 0x26, 0xe4,
+  0x3a, 0x1d, 0x5b, 0x53, 0x78, 0x3f, 0x82, 0x81, 0xeb, 0xeb, 0xeb, 0xe5, 0xab, 0x26, 0x2d, 0x07, 0x83, 0x4a, 0xe5, 0xcf, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x19, 0x19, 0x19, 0xcb, 0xc5, 0xc1, 0xc1,
+  0x7f, 0x0b, 0x2f, 0x04, 0x04, 0x90, 0x50, 0x9a, 0x0b, 0x9a, 0x9a, 0x73, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0x2d, 0x41, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xab, 0xab, 0xad, 0x3a, 0x1e, 0x1e, 0x3b, 0x92, 0x52, 0xeb, 0xab, 0xe4, 0xe4, 0xe4, 0x26, 0xfe, 0x2d, 0x4a, 0xae,
+  0xae, 0xae, 0xe5, 0xcf, 0x6e, 0x6e, 0x6d, 0x6d, 0x6d, 0x19, 0x19, 0x19, 0xc5, 0xc1, 0x7f, 0x2f, 0x04, 0x02, 0x22, 0x04, 0x02, 0x14, 0x0a, 0xd6, 0x0b, 0x2f, 0x9a, 0x10, 0xb7, 0xd7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x2d, 0xed, 0x15, 0x15, 0x41, 0x41, 0x15, 0x15, 0x15, 0x15, 0xaa, 0x93,
+  0xd4, 0x1e, 0x1e, 0x78, 0x3f, 0x81, 0x26, 0xff, 0x26, 0x26, 0xfe, 0x2d, 0x2d, 0x83, 0xae, 0xae, 0x11, 0xae, 0xe5, 0xee, 0x6e, 0x6e, 0x6d, 0x6d, 0x19, 0x19, 0xcb, 0x80, 0x9a, 0x8e, 0x22, 0x21,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x04, 0x14, 0x0a, 0x23, 0x9b, 0x9a, 0x9a, 0x8e, 0xd7, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0x2d, 0xed, 0x41, 0x41, 0x41, 0x41, 0x41, 0x15, 0xaa, 0xaa, 0xad, 0x94, 0x1d, 0x5b, 0x1d, 0x92, 0x51, 0xe5, 0x4a, 0x2d, 0x2d, 0x2c, 0x07, 0x07, 0x83, 0xae, 0xae, 0xae,
+  0xae, 0xae, 0xe5, 0x5c, 0x6e, 0x6d, 0x6d, 0x6d, 0xcb, 0x80, 0x2f, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0a, 0x23, 0x9b, 0x9a, 0x0b, 0x23, 0x90, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x2d, 0xed, 0x41, 0x41, 0x41, 0x41, 0x41, 0x15, 0xaa, 0xaa, 0xad, 0x94,
+  0x53, 0x53, 0x3b, 0x78, 0xeb, 0xad, 0x4a, 0x07, 0x83, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0xae, 0x83, 0x11, 0x11, 0xe5, 0x5c, 0x6d, 0x6d, 0x6d, 0xc5, 0x2f, 0x04, 0x02, 0x22, 0xb8, 0xb8, 0x21, 0x22,
+  0x22, 0x21, 0x21, 0x21, 0x21, 0x22, 0x22, 0xd7, 0xb6, 0x9b, 0x9b, 0x0b, 0x23, 0x8e, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0x2d, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x15, 0xaa, 0xaa, 0x1c, 0x3a, 0x5b, 0x53, 0x78, 0x3b, 0xe5, 0x2d, 0x4a, 0x83, 0xae, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0xae, 0xae,
+  0x83, 0x84, 0xe5, 0x5c, 0x6e, 0x19, 0x80, 0x8e, 0xcc, 0xcd, 0x22, 0x22, 0x21, 0x21, 0x21, 0x22, 0x22, 0x21, 0x21, 0x21, 0x21, 0x22, 0x22, 0x14, 0x0a, 0x9a, 0x9b, 0x0b, 0x9a, 0xb7, 0xd7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x2c, 0x41, 0x41, 0x41, 0x41, 0xed, 0x42, 0x15, 0xaa, 0xaa, 0x1c, 0xd4,
+  0x5b, 0x1d, 0x78, 0xe8, 0xe4, 0x4a, 0x4a, 0x83, 0x83, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x83, 0x84, 0xe5, 0xee, 0x19, 0x7f, 0x14, 0x02, 0x22, 0x22, 0x21, 0xcd, 0x22, 0x22, 0x21, 0x22,
+  0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x22, 0x14, 0x0a, 0x23, 0x7f, 0x9a, 0x9b, 0xa8, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0x07, 0x41, 0x41, 0xed, 0xed, 0xed, 0xed, 0x15, 0xaa, 0xac, 0x93, 0xd5, 0x5b, 0x1d, 0x29, 0xe9, 0xe4, 0xae, 0x4a, 0x83, 0x83, 0xae, 0x07, 0xae, 0xae, 0xae, 0xae, 0xae,
+  0x83, 0x84, 0xeb, 0x54, 0x23, 0x90, 0x22, 0xb8, 0x22, 0x22, 0x21, 0x22, 0x22, 0x02, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x22, 0x02, 0x0a, 0x23, 0x7f, 0x0b, 0x9b, 0xa8, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x07, 0xdd, 0xed, 0xed, 0xed, 0xdd, 0xed, 0x41, 0x15, 0xac, 0x93, 0xd5,
+  0x5b, 0x1d, 0x29, 0xe5, 0xe4, 0xae, 0xae, 0x4a, 0x4a, 0xae, 0x4a, 0x4a, 0xae, 0x83, 0xaf, 0xaf, 0xaf, 0x84, 0xe9, 0xf9, 0xb6, 0x21, 0xb8, 0xb8, 0x22, 0x21, 0x22, 0x22, 0x02, 0x22, 0x22, 0x21,
+  0x22, 0x22, 0x02, 0x02, 0x02, 0x21, 0x22, 0x02, 0x8f, 0x73, 0x7f, 0x0b, 0x13, 0xa8, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0x07, 0xdd, 0xdd, 0xdd, 0xed, 0xdd, 0xed, 0x41, 0x15, 0x4b, 0x93, 0xd5, 0x5b, 0x1d, 0x29, 0xe5, 0x26, 0x4a, 0x4a, 0x4a, 0x4a, 0xae, 0xae, 0xae, 0x83, 0x83, 0x83, 0x84,
+  0x84, 0xaf, 0x0f, 0xf9, 0xcd, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xcd, 0x14, 0x14, 0xcc, 0xcd, 0x14, 0x02, 0x22, 0x0a, 0x73, 0x7f, 0x0b, 0x9b, 0xa8, 0xd7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x07, 0x2d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x41, 0x15, 0x41, 0x93, 0xd5,
+  0x5b, 0x1d, 0x29, 0x0f, 0x26, 0xae, 0x4a, 0x4a, 0x4a, 0x4a, 0xae, 0x83, 0x83, 0x83, 0x84, 0x84, 0x96, 0x4d, 0x0f, 0xf9, 0xcd, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x02, 0x02,
+  0x14, 0x14, 0x14, 0xcc, 0xcc, 0xcc, 0x22, 0x14, 0x8f, 0x10, 0x7f, 0x0b, 0x9b, 0xa8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0x07, 0x2d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x41, 0xaa, 0x41, 0x93, 0xd4, 0x5b, 0x1d, 0x29, 0x0f, 0x26, 0xae, 0x4a, 0x2c, 0xae, 0x07, 0x4a, 0x07, 0x83, 0xaf, 0x84, 0x66,
+  0x49, 0x1f, 0x0f, 0xf9, 0xcc, 0x22, 0x21, 0x22, 0x22, 0x22, 0x14, 0x14, 0x14, 0x14, 0x14, 0x02, 0x14, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x90, 0x8e, 0x10, 0x7f, 0x0b, 0x9b, 0xa8, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x07, 0x2d, 0xdd, 0xdd, 0x2c, 0x2c, 0xdd, 0x41, 0xaa, 0x41, 0x1c, 0xd4,
+  0x5b, 0x1d, 0x29, 0x0f, 0xab, 0xae, 0x4a, 0x4a, 0x07, 0xae, 0x4a, 0x83, 0xaf, 0x84, 0x84, 0x66, 0x49, 0x1f, 0x0f, 0xf9, 0xcc, 0x02, 0x21, 0x21, 0x22, 0x22, 0x21, 0x21, 0x14, 0x14, 0x14, 0x14,
+  0xcc, 0x99, 0x99, 0xcd, 0xcd, 0xd7, 0x90, 0x0b, 0x10, 0x9a, 0x7f, 0x0b, 0x9b, 0xa8, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0x83, 0x2d, 0xdd, 0x2c, 0x2c, 0x2c, 0x2c, 0xed, 0x41, 0x41, 0x1c, 0x94, 0x53, 0x1d, 0x29, 0xa6, 0xe4, 0x07, 0x4a, 0xae, 0x2c, 0xae, 0x83, 0xaf, 0x84, 0x84, 0x84, 0x49,
+  0x49, 0x1f, 0x0f, 0xf9, 0xcc, 0x02, 0x22, 0x21, 0x21, 0x21, 0x21, 0x21, 0xcc, 0xcc, 0xcc, 0xcc, 0x99, 0x99, 0x99, 0x99, 0xd6, 0xd6, 0x7f, 0xc5, 0x10, 0x9b, 0x7f, 0x9b, 0x9a, 0xb7, 0xd7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x83, 0x2d, 0x2d, 0x2c, 0x2c, 0x2c, 0x2c, 0xed, 0x41, 0xed, 0x40, 0x94,
+  0x1e, 0x1e, 0xd4, 0xa6, 0xe4, 0x2d, 0x4a, 0x07, 0x07, 0xae, 0xaf, 0xaf, 0x84, 0x84, 0x4d, 0x49, 0x49, 0x1f, 0x0f, 0xf8, 0x99, 0x02, 0x22, 0x14, 0x21, 0x21, 0xcc, 0x14, 0x14, 0x90, 0x14, 0xcc,
+  0x99, 0x99, 0x99, 0x98, 0xd6, 0x10, 0xcb, 0xca, 0xa8, 0x7f, 0x9b, 0x9b, 0x23, 0x90, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0x83, 0x2d, 0x2d, 0x07, 0x2c, 0x2c, 0x2c, 0xdd, 0x41, 0xed, 0x40, 0x93, 0xd4, 0x1e, 0xd5, 0x29, 0xe4, 0xff, 0x4a, 0x07, 0xae, 0xae, 0xaf, 0x84, 0x84, 0x84, 0x4d, 0x49,
+  0x49, 0x1f, 0x0f, 0xf8, 0x99, 0x22, 0x14, 0x14, 0x21, 0x14, 0x14, 0x90, 0x90, 0x90, 0x90, 0xcc, 0x98, 0x99, 0xcc, 0xd6, 0x23, 0xca, 0x19, 0x89, 0xa8, 0x7f, 0x9b, 0x7f, 0x73, 0x14, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xaf, 0xaf, 0x83, 0x83, 0x83, 0x83, 0x07, 0xdd, 0xed, 0xed, 0x46, 0x93,
+  0x3a, 0x1d, 0x1e, 0x29, 0xb3, 0x26, 0x2d, 0x4a, 0x4a, 0x4a, 0xae, 0x83, 0x84, 0x96, 0x49, 0x49, 0x4c, 0x1f, 0x0f, 0xf9, 0x99, 0x21, 0xcd, 0x14, 0x14, 0x14, 0x90, 0x90, 0x90, 0x90, 0xd7, 0x90,
+  0x99, 0x99, 0xd7, 0xb7, 0xc0, 0x19, 0xca, 0xa8, 0x9a, 0x13, 0x09, 0x9b, 0x8e, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0x11, 0x83, 0x2c, 0xdd, 0xed, 0x4a, 0x1c, 0x3a, 0xd4, 0x1e, 0xd4, 0x60, 0x26, 0x84, 0x07, 0x4a, 0xaf, 0x83, 0xaf, 0x84, 0x4d, 0x49, 0x49,
+  0x4c, 0x1f, 0x0f, 0xf8, 0x99, 0x21, 0x90, 0xcc, 0xcc, 0x90, 0x90, 0xd7, 0xd7, 0xd7, 0xd7, 0x98, 0x98, 0xd6, 0xb7, 0xa0, 0xa1, 0xa1, 0x09, 0xb7, 0x7f, 0x7f, 0x9b, 0x10, 0xb6, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0x11, 0x11, 0x07, 0x2c, 0xed, 0xdc, 0x40,
+  0x62, 0x3a, 0x1e, 0xd5, 0x3a, 0x9f, 0x26, 0x07, 0x83, 0x2d, 0x83, 0xaf, 0x12, 0x4d, 0x4c, 0x4c, 0x4c, 0x1f, 0x0f, 0xf8, 0x99, 0x21, 0x90, 0x14, 0xcd, 0x90, 0x90, 0x99, 0x99, 0x98, 0x90, 0xd6,
+  0xd6, 0xb7, 0xa0, 0xa1, 0xa1, 0x8a, 0xa8, 0x9b, 0x0b, 0x0b, 0x9b, 0x73, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0xaf, 0x12, 0xaf, 0x12, 0x12, 0x12, 0x11, 0x07, 0x2c, 0xed, 0xec, 0x4b, 0x5f, 0x29, 0x25, 0x1e, 0xd4, 0x85, 0x26, 0x41, 0xae, 0x2d, 0x83, 0xaf, 0x4d, 0x4d, 0x4d, 0x4c,
+  0x4c, 0x1f, 0xa6, 0xf8, 0x21, 0x21, 0x90, 0x14, 0xcc, 0xcc, 0xcc, 0x99, 0x99, 0x98, 0xd6, 0x8d, 0x10, 0xca, 0xa1, 0xa1, 0xa1, 0x09, 0x10, 0x7f, 0x0b, 0x0b, 0x9a, 0x8f, 0x8e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x11, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x07, 0x2c, 0xed, 0xec, 0xed,
+  0xb2, 0x62, 0x94, 0xd5, 0xe8, 0xd4, 0x86, 0xfe, 0x07, 0x83, 0x83, 0xaf, 0x4d, 0x4d, 0x4d, 0x4c, 0x4c, 0x1f, 0xa6, 0xf8, 0x99, 0xcc, 0x90, 0x14, 0x14, 0xcc, 0xd7, 0x98, 0xd6, 0xd6, 0xb7, 0x09,
+  0xa1, 0xa1, 0xa1, 0xca, 0x13, 0xb7, 0x7f, 0x7f, 0x9b, 0x9b, 0x8e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0x11, 0x12, 0xaf, 0x12, 0x12, 0x11, 0x11, 0x07, 0x2c, 0xed, 0xec, 0x42, 0x9e, 0x61, 0x60, 0x94, 0x1e, 0xd5, 0x86, 0xb2, 0x84, 0x2d, 0xae, 0x11, 0x11, 0x4d, 0x4d, 0x4c,
+  0x4c, 0x4c, 0x0f, 0xf8, 0x99, 0xcd, 0xcd, 0xcd, 0xcd, 0xd7, 0xd7, 0xd6, 0xb7, 0x09, 0xa0, 0x19, 0x6d, 0x54, 0x6d, 0xa0, 0x73, 0x2f, 0x7f, 0x9b, 0x13, 0x9a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x95, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x07, 0x2c, 0xdc, 0xec, 0x42,
+  0xfe, 0x61, 0x5f, 0x60, 0x25, 0x1e, 0xd5, 0x86, 0xb2, 0x84, 0xaf, 0x11, 0x11, 0x4d, 0x4c, 0x4c, 0x66, 0x20, 0xe8, 0x39, 0xa8, 0x8e, 0xb6, 0xb6, 0xb6, 0xb6, 0x10, 0x89, 0xa0, 0xa1, 0x6d, 0x56,
+  0x56, 0x57, 0xa1, 0x74, 0x09, 0x80, 0x9a, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x85, 0x65, 0x11, 0x12, 0x12, 0x12, 0x11, 0x11, 0x07, 0x2c, 0xdc, 0xdc, 0x42, 0x26, 0xb2, 0x4c, 0x5f, 0x60, 0x25, 0x1e, 0xd5, 0x94, 0x20, 0x84, 0xae, 0x12, 0x9e, 0x4c, 0x66,
+  0x6c, 0x28, 0x29, 0xba, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xa3, 0xbd, 0x17, 0x0e, 0x75, 0x7b, 0x8b, 0x75, 0xf9, 0xf9, 0x17, 0xbd, 0xf8, 0xf8, 0xd9, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xc7,
+  0xbd, 0xc7, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbd, 0xbc, 0xc7, 0xbc, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x85, 0x48, 0x95, 0x12, 0x12, 0x12, 0x11, 0x11, 0x07, 0x2c, 0xdc, 0xec, 0x42,
+  0x26, 0xb2, 0x46, 0x6b, 0x61, 0x93, 0xd5, 0x1e, 0xd5, 0xa6, 0xb2, 0x4d, 0x84, 0x66, 0x66, 0x6c, 0x27, 0x32, 0xc8, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xba, 0xba, 0xe0, 0x7e, 0xce, 0xef,
+  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x3e, 0xbb, 0xe0, 0x45, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0xf1, 0xf1, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x44, 0x2b, 0xf2, 0x6a, 0x00,
+  0x00, 0x00, 0x00, 0x85, 0x48, 0x95, 0x12, 0x12, 0x12, 0x11, 0x11, 0x83, 0x2c, 0xdc, 0xec, 0x42, 0xac, 0x4c, 0x2c, 0x1f, 0x6b, 0x5f, 0x3a, 0xd5, 0x1e, 0xd4, 0x62, 0x5f, 0xb2, 0x20, 0x6c, 0x27,
+  0x9d, 0xd3, 0xd3, 0xd3, 0xc8, 0xd0, 0xd0, 0xd0, 0xd0, 0xd2, 0x58, 0x44, 0x45, 0x7d, 0x7d, 0x3e, 0x3e, 0x45, 0x44, 0x44, 0x45, 0x3e, 0x0e, 0x0e, 0x17, 0x3e, 0x3e, 0xa7, 0xf0, 0xf0, 0x7a, 0x7a,
+  0x7a, 0x7a, 0xf0, 0x7a, 0xf0, 0xf0, 0x7a, 0xf0, 0x7a, 0x7a, 0x79, 0x7a, 0x5a, 0xf7, 0x37, 0x00, 0x00, 0x00, 0x00, 0x85, 0x48, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x83, 0x2c, 0x2c, 0xec, 0x42,
+  0xac, 0x4c, 0xed, 0x4a, 0x1f, 0x6b, 0x61, 0x93, 0x25, 0x94, 0x3a, 0x62, 0x62, 0x61, 0xde, 0x9c, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2, 0xd2, 0x2e, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xe0, 0xe0, 0x45,
+  0x45, 0xf2, 0xc8, 0xd2, 0xe0, 0x7e, 0x7b, 0xee, 0x5c, 0x17, 0xda, 0x35, 0xba, 0x45, 0xf0, 0x7a, 0x7a, 0x7a, 0xf1, 0xf0, 0x7a, 0x7a, 0xf0, 0xf0, 0x7a, 0x7a, 0x7a, 0xf3, 0xf7, 0x6a, 0xd9, 0x00,
+  0x00, 0x00, 0x00, 0x85, 0x48, 0x95, 0x12, 0x12, 0x12, 0x12, 0x11, 0x83, 0x2c, 0x2c, 0xec, 0x42, 0xac, 0x4c, 0xdc, 0x4a, 0x07, 0x4c, 0x6b, 0x6b, 0x5f, 0x60, 0x3a, 0x3a, 0x62, 0xde, 0x9c, 0x24,
+  0x4e, 0xd2, 0x4e, 0x4e, 0x4e, 0x97, 0x97, 0xa7, 0xa7, 0xe0, 0xe0, 0xe0, 0xe0, 0x3e, 0x45, 0xa7, 0x4e, 0xc8, 0x9d, 0x9c, 0xbb, 0x0e, 0x7b, 0x8c, 0x75, 0xf9, 0x8a, 0xdb, 0xb0, 0xba, 0x2b, 0x7a,
+  0x7a, 0x7a, 0x7a, 0xf0, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xf2, 0xf7, 0x44, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x48, 0x95, 0x12, 0x12, 0x12, 0x95, 0x11, 0xae, 0x2c, 0x2c, 0xdc, 0x42,
+  0xac, 0x4c, 0xed, 0x2c, 0x2c, 0x4a, 0x11, 0x6b, 0x6b, 0x61, 0x62, 0x62, 0xde, 0xd1, 0x24, 0x2a, 0x2a, 0x2a, 0x2a, 0x2e, 0x2e, 0x2a, 0x24, 0x24, 0x24, 0x24, 0x24, 0x58, 0x58, 0x58, 0xd2, 0xc8,
+  0x9d, 0xe3, 0x64, 0x9c, 0xbb, 0x17, 0x75, 0x75, 0x8a, 0x54, 0x0e, 0x17, 0xda, 0xb0, 0xba, 0x2b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x7a, 0xf2, 0x63, 0x44, 0xce, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x60, 0x48, 0x65, 0x12, 0x12, 0x12, 0x12, 0x12, 0xaf, 0x2c, 0x4a, 0xdc, 0x15, 0xac, 0x4c, 0xec, 0x2c, 0x4a, 0x4a, 0x2c, 0x46, 0x1f, 0x6b, 0x28, 0x36, 0x9c, 0xd2, 0xd0, 0xd0,
+  0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xc8, 0x9d, 0x9d, 0x9d, 0xc8, 0x9d, 0x32, 0x32, 0xe2, 0x6f, 0xbe, 0xbf, 0xd0, 0xe1, 0xbb, 0xda, 0x8a, 0x56, 0x7e, 0x17, 0x17, 0xa2, 0x35, 0xba,
+  0x2b, 0x2b, 0x79, 0x79, 0x7a, 0x79, 0x79, 0x7a, 0x16, 0x63, 0x45, 0xcf, 0xee, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x48, 0x65, 0x12, 0x12, 0x12, 0x12, 0x12, 0xaf, 0x07, 0x2c, 0x2c, 0x15,
+  0xac, 0x4c, 0x42, 0xdc, 0xdc, 0x2c, 0x2c, 0xdd, 0x9e, 0x28, 0x70, 0x70, 0x64, 0x64, 0x31, 0x9d, 0x9d, 0x32, 0x32, 0x32, 0x32, 0x9d, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xf7, 0xe2, 0x63, 0x6f,
+  0xbe, 0xbe, 0x18, 0x87, 0xe2, 0x9c, 0xdf, 0xda, 0xa3, 0x0e, 0xef, 0x54, 0xf9, 0xdb, 0xc6, 0xb0, 0xba, 0x45, 0x79, 0x5a, 0x79, 0x79, 0x7a, 0xb5, 0x63, 0x44, 0xce, 0xee, 0x76, 0xa0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x60, 0x49, 0x65, 0x12, 0x12, 0x12, 0x12, 0x12, 0xaf, 0x07, 0x2c, 0x2c, 0x42, 0xac, 0x4c, 0x41, 0xed, 0xdc, 0x4a, 0x2c, 0x84, 0x28, 0x27, 0x43, 0xfd, 0x72, 0xbf, 0x70, 0x63,
+  0x63, 0x64, 0xe2, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xe2, 0xe2, 0x70, 0x6f, 0xbe, 0xbe, 0x87, 0x18, 0x18, 0x18, 0x18, 0xbe, 0x64, 0xdf, 0x91, 0xd8, 0xa2, 0x0e, 0x75, 0x0e, 0x39, 0x39, 0xda,
+  0xf5, 0xdf, 0x44, 0x5a, 0x5a, 0x79, 0xd3, 0x63, 0x45, 0xce, 0xef, 0x76, 0xee, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x48, 0x65, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x07, 0x2d, 0x2c, 0x42,
+  0xac, 0x4c, 0x41, 0x41, 0x2c, 0xed, 0x46, 0x28, 0x27, 0x43, 0x5d, 0x5d, 0xfd, 0x33, 0x06, 0x0d, 0xf6, 0xbf, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0xbe, 0xbe, 0xbe, 0x87, 0x87, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0xbf, 0x31, 0x91, 0xd8, 0xd8, 0x91, 0x17, 0x75, 0x0e, 0x39, 0x39, 0xda, 0x47, 0xdf, 0xa7, 0x7a, 0xd3, 0x63, 0x45, 0xcf, 0xef, 0x56, 0x7b, 0xef, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x60, 0x1f, 0x65, 0x12, 0x95, 0x12, 0x12, 0x12, 0xaf, 0x83, 0x2c, 0x2c, 0x42, 0xac, 0x4c, 0x41, 0xed, 0xdc, 0x4c, 0x28, 0x27, 0x72, 0x5d, 0x5d, 0xfc, 0x33, 0x33, 0x33, 0xfd,
+  0xfc, 0x01, 0x3c, 0x88, 0x88, 0x88, 0xbf, 0xbf, 0xbe, 0x87, 0x87, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xbf, 0x9c, 0x91, 0xb1, 0xc6, 0xbb, 0x0c, 0x54, 0x0e, 0x39,
+  0x39, 0xda, 0x47, 0xdf, 0xd2, 0x64, 0x45, 0x5c, 0xee, 0xee, 0xef, 0x7b, 0x7b, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x49, 0x65, 0x12, 0x48, 0x65, 0x65, 0x95, 0x12, 0x83, 0x4a, 0xdc, 0x42,
+  0xac, 0x4c, 0x42, 0xec, 0x4d, 0x28, 0x70, 0x06, 0xfc, 0xfc, 0xfc, 0x01, 0x33, 0x01, 0x01, 0x01, 0x01, 0x33, 0x33, 0x33, 0x33, 0x33, 0x01, 0x06, 0xe7, 0xe7, 0xe6, 0xe6, 0xe6, 0x87, 0x87, 0x18,
+  0x87, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xbf, 0x9c, 0x35, 0x69, 0xd8, 0xd8, 0xf9, 0x75, 0x0e, 0x39, 0xbb, 0xa2, 0xb0, 0x36, 0x45, 0xcf, 0x76, 0x76, 0x56, 0x7b, 0x7b, 0x7c, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x85, 0x49, 0x65, 0x65, 0x48, 0x65, 0x65, 0x95, 0x12, 0xaf, 0x4a, 0xdc, 0x42, 0xac, 0x4c, 0x42, 0x4c, 0x28, 0x70, 0x71, 0xfc, 0x01, 0x3d, 0x01, 0x06, 0x06, 0x01, 0x01, 0x06,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x33, 0x33, 0x01, 0x01, 0x01, 0x03, 0xe7, 0xe7, 0xe6, 0xe6, 0x87, 0x87, 0x87, 0x18, 0x18, 0x18, 0x18, 0xbf, 0x31, 0x35, 0xd8, 0xd8, 0xd8, 0x39, 0x75,
+  0x0e, 0x39, 0xbb, 0xc6, 0xb0, 0xc6, 0x75, 0x56, 0x56, 0x56, 0x7b, 0x8b, 0x7e, 0xdf, 0x67, 0x00, 0x00, 0x00, 0x00, 0x85, 0x48, 0x65, 0x65, 0x48, 0x65, 0x65, 0x95, 0x12, 0xaf, 0x4a, 0x2c, 0x42,
+  0xac, 0x4c, 0x4c, 0x28, 0x70, 0x71, 0x71, 0xe7, 0x3d, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0xfd, 0xa5, 0x5e, 0x5e, 0xfd, 0x5d, 0xfd,
+  0x01, 0x3c, 0xe7, 0xe6, 0xe6, 0x18, 0x18, 0x18, 0x87, 0xbf, 0x31, 0xdf, 0x91, 0xa2, 0xd8, 0xdb, 0x54, 0x0e, 0xbb, 0xbb, 0xc6, 0x47, 0xc6, 0xef, 0x7b, 0x57, 0x8b, 0x7e, 0x63, 0x32, 0x6a, 0x00,
+  0x00, 0x00, 0x00, 0x85, 0x48, 0x48, 0x48, 0x48, 0x65, 0x65, 0x48, 0x95, 0x11, 0x2c, 0x2c, 0xed, 0xac, 0x28, 0x28, 0x70, 0x88, 0x03, 0x03, 0x03, 0x03, 0xf6, 0x03, 0x03, 0x03, 0x03, 0xe7, 0x03,
+  0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x03, 0x3d, 0x06, 0x01, 0xfd, 0xfd, 0xfd, 0xfd, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5d, 0xfc, 0x01, 0xe7, 0x88, 0xe6, 0x87, 0xbf, 0x64, 0x35, 0x91, 0xd8, 0xd8,
+  0xdb, 0x54, 0x0e, 0xdb, 0xdb, 0xa2, 0xb0, 0xa2, 0xee, 0x7c, 0x7e, 0x36, 0xe3, 0xc9, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x85, 0x48, 0x48, 0x65, 0x48, 0x65, 0x65, 0x48, 0x95, 0x11, 0x07, 0x2c, 0xdd,
+  0x6b, 0x27, 0x64, 0x71, 0x3d, 0x03, 0x03, 0x03, 0xe7, 0xe7, 0xe7, 0xe7, 0x3d, 0x3d, 0xe7, 0xe7, 0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x33, 0x33, 0xfd, 0xa5, 0x5e, 0x5e, 0x5e, 0xc9, 0xc9,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb4, 0xb4, 0x5e, 0x5e, 0x01, 0xe7, 0xbf, 0x64, 0x35, 0x91, 0xc6, 0x69, 0xdb, 0x54, 0x0e, 0xdb, 0xdb, 0xc6, 0xf5, 0xa2, 0x3e, 0x31, 0x9d, 0xb4, 0x9c, 0x69, 0x00,
+  0x00, 0x00, 0x00, 0x85, 0x48, 0x49, 0x65, 0x65, 0x65, 0x49, 0x48, 0x11, 0x11, 0x83, 0x2c, 0x40, 0x28, 0x70, 0xf6, 0xf6, 0x88, 0x88, 0xf6, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0xf6, 0xf6, 0x0d, 0x0d, 0x0d, 0x0d, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xa5, 0xc8, 0xa5, 0xa5, 0xa5, 0x72, 0xf6, 0xbf, 0x6f, 0x64, 0x35, 0xb1,
+  0xd8, 0xb1, 0xda, 0x0e, 0x0e, 0xdb, 0xbb, 0x91, 0xf5, 0x1b, 0x9c, 0x16, 0x6a, 0xd9, 0x74, 0x00, 0x00, 0x00, 0x00, 0x85, 0x49, 0x49, 0x65, 0x49, 0x49, 0x49, 0x48, 0x95, 0x11, 0xae, 0xdd, 0x61,
+  0x70, 0x0d, 0x0d, 0xe3, 0x0d, 0x0d, 0x72, 0x72, 0x72, 0x0d, 0x72, 0x72, 0x72, 0x72, 0x72, 0xe3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xe3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xa4,
+  0x72, 0x72, 0x72, 0x72, 0x72, 0xa4, 0x32, 0xe3, 0xe3, 0xa4, 0xa4, 0xf7, 0x0d, 0x70, 0x1b, 0xb0, 0x69, 0xc6, 0x91, 0xa2, 0x54, 0x17, 0xbb, 0xda, 0xa2, 0xb1, 0x37, 0x6a, 0xd9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x60, 0x48, 0x49, 0x65, 0x48, 0x49, 0x49, 0x48, 0x95, 0x12, 0x83, 0x11, 0x28, 0xe2, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xc2, 0xc2, 0xc2, 0x16, 0x16, 0x16, 0x16, 0x16, 0xc2, 0x16, 0x16, 0x16, 0xf3, 0xb4, 0x70, 0x9c, 0xda,
+  0xb0, 0x35, 0x91, 0x91, 0xa2, 0x0e, 0x0e, 0xdb, 0xda, 0xc6, 0xb0, 0xb0, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x95, 0x12, 0x07, 0x4c, 0x27,
+  0x9d, 0x16, 0xb5, 0x16, 0xb5, 0xb4, 0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
+  0xf3, 0xf3, 0xf3, 0x59, 0x59, 0x59, 0xf3, 0xf3, 0x5a, 0x5a, 0x59, 0x5a, 0xb4, 0x6f, 0x3e, 0x75, 0x39, 0xb0, 0xb1, 0xd8, 0x91, 0xa2, 0x17, 0x0e, 0xbb, 0xc6, 0x91, 0xf5, 0xfb, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x60, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x95, 0x11, 0x83, 0x6b, 0x27, 0xc9, 0x16, 0x16, 0x16, 0xc2, 0xc3, 0xc3, 0x16, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0x16, 0x16, 0x16,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x59, 0x59, 0x59, 0x59, 0x59, 0xf3, 0x59, 0x59, 0x59, 0x59, 0xc9, 0x70, 0x7e, 0x56,
+  0x75, 0x17, 0x47, 0x91, 0xd8, 0x91, 0xa2, 0x17, 0x17, 0xda, 0xa2, 0xa2, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x48, 0x48, 0x49, 0x49, 0x49, 0x48, 0x48, 0x12, 0xaf, 0x2d, 0x6b, 0x27,
+  0xb5, 0x59, 0xf3, 0x16, 0xc3, 0xc3, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a,
+  0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x79, 0x5a, 0xc9, 0x64, 0x7e, 0xef, 0x56, 0x7b, 0x0e, 0x47, 0xb1, 0xd8, 0xd8, 0xd8, 0x17, 0x17, 0xbb, 0xdb, 0xa3, 0x8d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x60, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x12, 0x11, 0x84, 0x6b, 0x27, 0x16, 0x59, 0xf3, 0xf3, 0xf3, 0xf3, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
+  0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x5a, 0xc9, 0x63, 0xce, 0x7b,
+  0x7b, 0x7c, 0x3e, 0x36, 0x37, 0x69, 0xd8, 0x91, 0xa2, 0x39, 0xf9, 0xa3, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x12, 0xaf, 0x2d, 0x6b, 0x27,
+  0xb4, 0x16, 0xb4, 0xb4, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc3, 0xc3, 0xc2, 0xc2, 0xc3, 0xc3, 0xc3,
+  0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x16, 0xc3, 0xc3, 0x16, 0xc3, 0x16, 0xc3, 0xa5, 0xe2, 0xce, 0x8b, 0x7b, 0x45, 0x64, 0x9d, 0x31, 0xb0, 0xb1, 0x91, 0xa2, 0xdb, 0xa3, 0x68, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x60, 0x48, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x65, 0x12, 0x2c, 0x6b, 0x27, 0x71, 0xa4, 0x0d, 0x3c, 0x71, 0x71, 0x3c, 0x3c, 0x3c, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x43, 0x06, 0x43, 0x43, 0x06, 0x06, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x01, 0x01, 0x43, 0x43, 0x06, 0x33, 0xa4, 0xf1, 0x7c,
+  0x3e, 0x64, 0xa5, 0x9d, 0xdf, 0x67, 0xfb, 0xb1, 0xa3, 0xa3, 0x68, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x48, 0x49, 0x49, 0x49, 0x49, 0x48, 0x48, 0x65, 0x12, 0x4a, 0x1f, 0x27,
+  0x88, 0x71, 0x0d, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3c, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x06, 0x03, 0x06, 0xfd, 0xa4, 0x4e, 0xf2, 0xf6, 0x43, 0xe3, 0x37, 0x68, 0x68, 0xfb, 0x68, 0x68, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x92, 0x9f, 0x49, 0x49, 0x48, 0x48, 0x48, 0x48, 0x12, 0xaf, 0x4a, 0x96, 0x28, 0xf6, 0x01, 0xe7, 0x03, 0x71, 0x71, 0x06, 0x0d, 0x0d, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x06, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x01, 0x01, 0x01, 0x3d, 0x5d, 0xa4, 0xe2, 0xbe,
+  0x03, 0xf7, 0x37, 0x68, 0x8f, 0x00, 0x00, 0x8f, 0x68, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x62, 0x9e, 0x12, 0x48, 0x48, 0x49, 0x49, 0x49, 0x11, 0xdc, 0xdd, 0x6b,
+  0xe2, 0x06, 0x06, 0x06, 0x43, 0x71, 0x71, 0x06, 0x06, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfc, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5e, 0xfd, 0xbf, 0x6f, 0x70, 0x37, 0x68, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfb, 0x91, 0x61, 0x20, 0x66, 0x49, 0x48, 0x48, 0x11, 0x2c, 0x4a, 0x41, 0x9f, 0x27, 0x0d, 0x01, 0x33, 0x33, 0x01, 0x01, 0x33, 0xfc, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0xf6, 0x70,
+  0x37, 0xfb, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x68, 0xb1, 0x92, 0x29, 0x60, 0x20, 0xb2, 0x20, 0x20, 0xb2, 0x86, 0x62,
+  0x35, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x9c, 0x69, 0xfb, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8f, 0xfa, 0xfa, 0xfb, 0x67, 0x91, 0x91, 0xa2, 0x91, 0xb1, 0xfb, 0xfa, 0xf4, 0x1a, 0x47, 0x05, 0x1a, 0x1a, 0x05, 0x1a, 0x1a, 0x1a, 0x05, 0x05, 0x05, 0x05, 0x1a, 0x1a,
+  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x05, 0x05, 0x05, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x05, 0x05, 0x1a, 0x1a, 0x47, 0xfb,
+  0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x55, 0xfa, 0xf4, 0xf4, 0x55, 0x50, 0x55, 0xf4, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
 const lv_img_dsc_t iciba = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR,
+  .header.cf = LV_IMG_CF_INDEXED_8BIT,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 80,
   .header.h = 80,
-  .data_size = 6400 * LV_COLOR_SIZE / 8,
+  .data_size = 7424,
   .data = iciba_map,
 };
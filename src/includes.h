@@ -14,10 +14,20 @@
 #include "manager/time_manager.h"
 #include "manager/data_manager.h"
 #include "manager/button_manager.h"
+#include "manager/job_scheduler.h"
 // UI模块
 #include "ui/display_manager.h"
 // 初始化模块
 #include "ui/init_ui.h"
+#include "ui/screen_lifecycle.h"
+#include "ui/layout_engine.h"
+#include "ui/news_list.h"
+#include "ui/quote_bitmap_cache.h"
+#include "ui/screen_capture.h"
+#include "network/screen_mirror.h"
+#include "manager/benchmark_manager.h"
+#include "manager/night_mode_manager.h"
+#include "manager/touch_manager.h"
 // 网络模块
 #include "network/net_http.h"
 // mDNS支持
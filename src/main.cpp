@@ -23,6 +23,10 @@ unsigned long lastScreenChangeTime = 0;
 // 光线传感器相关变量
 unsigned long lastBrightnessUpdateTime = 0;
 
+// 主程序创建的任务（性能测试中读取栈的最低剩余量）
+TaskHandle_t webConfigTaskHandle = NULL;
+TaskHandle_t mainDataTaskHandle = NULL;
+
 // Web配置服务器相关变量
 bool webConfigMode = false;
 unsigned long webConfigStartTime = 0;
@@ -153,6 +157,8 @@ void updateBrightness() {
     brightness = constrain(brightness, 1, 255);
     // 设置屏幕亮度
     ledcWrite(LED_CHANNEL, brightness);
+    // 光线读数同时用于判断是否进入夜间模式
+    NightModeManager::getInstance()->onLightSample(lightValue, brightness);
     lastBrightnessUpdateTime = millis();
   }
 }
@@ -160,6 +166,10 @@ void updateBrightness() {
 // 处理按钮事件
 void handleButtonEvents() {
   ButtonEvent event = ButtonManager::getInstance()->check();
+  // 从夜间模式唤醒的那次按键不再触发其他操作
+  if (event != NONE && NightModeManager::getInstance()->shouldIgnoreButton()) {
+    return;
+  }
   
   switch (event) {
     case SHORT_PRESS:
@@ -181,6 +191,12 @@ void handleButtonEvents() {
         );
       break;
       
+    case TRIPLE_CLICK:
+      // 三击运行设备端性能测试（测试期间会依次切换各屏幕）
+      Serial.println("三击: 开始性能测试");
+      BenchmarkManager::getInstance()->requestRun();
+      break;
+      
     case LONG_PRESS:
       if (!webConfigMode) {
         // 长按开启Web配置模式
@@ -229,6 +245,25 @@ void handleButtonEvents() {
   }
 }
 
+// 处理触摸滑动手势：左滑切换到下一个屏幕，右滑返回上一个屏幕
+void handleTouchGestures() {
+  SwipeDirection swipe = TouchManager::getInstance()->update();
+  switch (swipe) {
+    case SWIPE_LEFT:
+      ScreenManager::getInstance()->toggleScreen();
+      lastScreenChangeTime = millis(); // 重置自动换屏计时器
+      break;
+      
+    case SWIPE_RIGHT:
+      ScreenManager::getInstance()->showPreviousScreen();
+      lastScreenChangeTime = millis();
+      break;
+      
+    default:
+      break;
+  }
+}
+
 // 处理自动换屏
 void handleAutoScreenChange() {
   if (autoScreenChangeEnabled) {
@@ -303,6 +338,18 @@ void initSystem() {
     Serial.println("警告：配置管理器初始化失败");
   }
   
+  // 加载网页上传的屏幕布局字节码
+  LayoutEngine::getInstance()->init();
+  
+  // 初始化屏幕对象生命周期管理器（读取内存预算，需在配置管理器之后）
+  ScreenLifecycle::getInstance()->init();
+  
+  // 初始化夜间模式（读取阈值和时间段，需在配置管理器之后）
+  NightModeManager::getInstance()->init(LED_CHANNEL);
+  
+  // 初始化触摸屏（读取校准参数，需在配置管理器之后）
+  TouchManager::getInstance()->init();
+  
   // 初始化Web配置服务器
   WebConfigServer::getInstance()->init();
   
@@ -325,9 +372,24 @@ void displayTask(void *pvParameters) {
   Serial.println("显示任务启动在CORE_0");
   
   while (true) {
+    NightModeManager* nightMode = NightModeManager::getInstance();
+    // 夜间模式下只等待按钮中断或定期检查光线，不处理LVGL和自动换屏
+    if (nightMode->isSleeping()) {
+      nightMode->sleepTick();
+      if (!nightMode->isSleeping()) {
+        // 唤醒后重新计算自动换屏间隔
+        lastScreenChangeTime = millis();
+      }
+      continue;
+    }
+    unsigned long loopStart = micros();
+    
     // 处理按钮事件
     handleButtonEvents();
     
+    // 处理触摸手势和网页请求的触摸校准
+    handleTouchGestures();
+    
     // 更新亮度（非配置模式下）
     if (!webConfigMode) {
       updateBrightness();
@@ -425,6 +487,15 @@ void displayTask(void *pvParameters) {
       // 处理自动换屏
       handleAutoScreenChange();
       
+      // 利用换屏间隔的空闲时间预先准备下一个屏幕（按键换屏同样受益）
+      ScreenManager::getInstance()->prepareNextScreen();
+      
+      // 执行网页请求的屏幕元素创建耗时对比测试
+      ScreenLifecycle::getInstance()->runPendingBenchmark();
+      
+      // 执行网页请求的新闻列表性能测试
+      NewsList::runPendingBenchmark();
+      
       // 清除状态标签显示内容
       TimeManager::getInstance()->clearStatusInfo();
       
@@ -437,8 +508,24 @@ void displayTask(void *pvParameters) {
       }
     }
     
+    // 执行网页请求的截图（正常模式和配置模式下均可使用）
+    ScreenCapture::getInstance()->runPending();
+    
+    // 按推送间隔交换屏幕镜像的缓冲区
+    ScreenMirror::getInstance()->update();
+    
+    // 执行三击或网页请求的性能测试
+    BenchmarkManager::getInstance()->runPending();
+    
+    // 在每帧时间预算内执行分片作业（如预先准备下一个屏幕时的文件读取和JSON解析）
+    JobScheduler::getInstance()->runSlices();
+    
     // LVGL处理
     lv_task_handler();
+    nightMode->accountBusy(micros() - loopStart);
+    
+    // 判断是否进入夜间模式
+    nightMode->update(webConfigMode);
     
     // 短暂延迟
     delay(10);
@@ -491,7 +578,7 @@ void setup() {
   xTaskCreatePinnedToCore(
     displayTask,    // 任务函数
     "DisplayTask",  // 任务名称
-    4096,           // 任务堆栈大小
+    DISPLAY_TASK_STACK_SIZE, // 任务堆栈大小
     NULL,           // 传递给任务的参数
     1,              // 任务优先级
     NULL,           // 任务句柄
@@ -502,10 +589,10 @@ void setup() {
   xTaskCreatePinnedToCore(
     webConfigTask,  // 任务函数
     "WebConfigTask", // 任务名称
-    4096,           // 任务堆栈大小
+    WEB_CONFIG_TASK_STACK_SIZE, // 任务堆栈大小
     NULL,           // 传递给任务的参数
     1,              // 任务优先级
-    NULL,           // 任务句柄
+    &webConfigTaskHandle, // 任务句柄
     1               // 核心编号 (1)
   );
   
@@ -513,10 +600,10 @@ void setup() {
   xTaskCreatePinnedToCore(
     dataTask,       // 任务函数
     "DataTask",     // 任务名称
-    4096,           // 任务堆栈大小
+    DATA_TASK_STACK_SIZE, // 任务堆栈大小
     NULL,           // 传递给任务的参数
     1,              // 任务优先级
-    NULL,           // 任务句柄
+    &mainDataTaskHandle, // 任务句柄
     1               // 核心编号 (1)
   );
 }
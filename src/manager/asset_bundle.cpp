@@ -0,0 +1,355 @@
+#include "asset_bundle.h"
+#include <string.h>
+#ifdef ARDUINO
+#include <ArduinoJson.h>
+#include <esp_partition.h>
+#include <rom/crc.h>
+#define ASSET_LOG(...) Serial.printf(__VA_ARGS__)
+#else
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#define ASSET_LOG(...) printf(__VA_ARGS__)
+#endif
+
+// 定义单例实例
+AssetBundle* AssetBundle::instance = nullptr;
+
+// 按字节读取小端整数（与rle_image相同，避免非对齐访问）
+static inline uint16_t readU16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+static inline uint32_t readU32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+#ifdef ARDUINO
+static inline uint32_t bundleCrc32(const uint8_t* data, size_t length) {
+    return crc32_le(0, data, length);
+}
+static inline uint32_t nowMicros() {
+    return micros();
+}
+#else
+static uint32_t bundleCrc32(const uint8_t* data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+static uint32_t nowMicros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000UL + ts.tv_nsec / 1000;
+}
+#endif
+
+// 字体条目在内存中的描述符（一次分配）
+struct AssetFont {
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t dsc;
+    lv_font_fmt_txt_glyph_cache_t cache;
+    lv_font_fmt_txt_kern_classes_t kern;
+    lv_font_fmt_txt_cmap_t cmaps[1];   // 实际长度为cmap数
+};
+
+//*** 私有构造函数
+AssetBundle::AssetBundle() {
+    base = nullptr;
+    size = 0;
+    mapMicros = 0;
+    ready = false;
+    memset(entries, 0, sizeof(entries));
+    entryCount = 0;
+}
+//*** 获取单例实例
+AssetBundle* AssetBundle::getInstance() {
+    if (instance == nullptr) {
+        instance = new AssetBundle();
+    }
+    return instance;
+}
+#ifdef ARDUINO
+//*** 映射资源分区并打开资源包
+bool AssetBundle::init() {
+    if (ready) {
+        return true;
+    }
+    uint32_t startTime = micros();
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                                ASSET_PARTITION_NAME);
+    if (partition == nullptr) {
+        Serial.println("分区表中没有assets分区，使用编译进固件的图像和字体");
+        return false;
+    }
+    // 先读取头部得到资源包长度，只映射实际使用的部分
+    uint8_t header[ASSET_BUNDLE_HEADER_SIZE];
+    if (esp_partition_read(partition, 0, header, sizeof(header)) != ESP_OK ||
+        memcmp(header, "ASB1", 4) != 0) {
+        Serial.println("assets分区中没有资源包，使用编译进固件的图像和字体");
+        return false;
+    }
+    uint32_t length = readU32(header + 8);
+    if (length < ASSET_BUNDLE_HEADER_SIZE || length > partition->size) {
+        Serial.printf("资源包长度错误: %u\n", length);
+        return false;
+    }
+    const void* mapped = nullptr;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(partition, 0, length, ESP_PARTITION_MMAP_DATA, &mapped, &handle) != ESP_OK) {
+        Serial.println("资源分区映射失败");
+        return false;
+    }
+    // 映射在整个运行期间保持有效，不需要保存句柄
+    if (!open((const uint8_t*)mapped, length)) {
+        spi_flash_munmap(handle);
+        return false;
+    }
+    mapMicros = micros() - startTime;
+    Serial.printf("资源包已映射: %u字节, %d个条目, 耗时%u us\n", length, entryCount, mapMicros);
+    return true;
+}
+#else
+//*** 映射资源包文件
+bool AssetBundle::init() {
+    return ready;
+}
+//*** 映射资源包文件（Linux）
+bool AssetBundle::mapFile(const char* path) {
+    uint32_t startTime = nowMicros();
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        ASSET_LOG("无法打开资源包文件: %s\n", path);
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)ASSET_BUNDLE_HEADER_SIZE) {
+        close(fd);
+        return false;
+    }
+    void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+    if (!open((const uint8_t*)mapped, info.st_size)) {
+        munmap(mapped, info.st_size);
+        return false;
+    }
+    mapMicros = nowMicros() - startTime;
+    return true;
+}
+#endif
+//*** 打开内存中的资源包
+bool AssetBundle::open(const uint8_t* data, size_t length) {
+    if (length < ASSET_BUNDLE_HEADER_SIZE || memcmp(data, "ASB1", 4) != 0) {
+        ASSET_LOG("资源包格式错误\n");
+        return false;
+    }
+    uint16_t version = readU16(data + 4);
+    uint16_t count = readU16(data + 6);
+    uint32_t total = readU32(data + 8);
+    if (version != ASSET_BUNDLE_VERSION || total > length || count > ASSET_MAX_ENTRIES ||
+        ASSET_BUNDLE_HEADER_SIZE + count * ASSET_ENTRY_SIZE > total) {
+        ASSET_LOG("资源包版本或长度错误: 版本%u, %u个条目, %u字节\n", version, count, total);
+        return false;
+    }
+    if (bundleCrc32(data + ASSET_BUNDLE_HEADER_SIZE, total - ASSET_BUNDLE_HEADER_SIZE) != readU32(data + 12)) {
+        ASSET_LOG("资源包CRC校验失败\n");
+        return false;
+    }
+    base = data;
+    size = total;
+    entryCount = 0;
+    for (int i = 0; i < count; i++) {
+        const uint8_t* record = data + ASSET_BUNDLE_HEADER_SIZE + i * ASSET_ENTRY_SIZE;
+        Entry& entry = entries[entryCount];
+        memset(&entry, 0, sizeof(Entry));
+        memcpy(entry.name, record, ASSET_NAME_SIZE);
+        entry.name[ASSET_NAME_SIZE - 1] = '\0';
+        entry.type = record[20];
+        uint32_t offset = readU32(record + 24);
+        entry.length = readU32(record + 28);
+        if (offset % 4 != 0 || offset + entry.length > total) {
+            ASSET_LOG("资源条目%s的位置错误\n", entry.name);
+            continue;
+        }
+        entry.data = data + offset;
+        // 轮廓字体原样使用，由TtfLoader在打开时校验
+        bool ok = entry.type == ASSET_IMAGE ? parseImage(entry) : entry.type == ASSET_FONT ? parseFont(entry) :
+                  entry.type == ASSET_OUTLINE;
+        if (ok) {
+            entryCount++;
+        } else {
+            ASSET_LOG("资源条目%s无法解析，已跳过\n", entry.name);
+        }
+    }
+    ready = true;
+    return true;
+}
+//*** 解析图像条目
+bool AssetBundle::parseImage(Entry& entry) {
+    if (entry.length < ASSET_IMAGE_HEADER_SIZE) {
+        return false;
+    }
+    const uint8_t* p = entry.data;
+    uint32_t dataSize = readU32(p + 8);
+    if (ASSET_IMAGE_HEADER_SIZE + dataSize > entry.length) {
+        return false;
+    }
+    entry.image.header.cf = p[0];
+    entry.image.header.always_zero = 0;
+    entry.image.header.reserved = 0;
+    entry.image.header.w = readU16(p + 2);
+    entry.image.header.h = readU16(p + 4);
+    entry.image.data_size = dataSize;
+    entry.image.data = p + ASSET_IMAGE_HEADER_SIZE;
+    return true;
+}
+//*** 解析字体条目
+bool AssetBundle::parseFont(Entry& entry) {
+    if (entry.length < ASSET_FONT_HEADER_SIZE) {
+        return false;
+    }
+    const uint8_t* p = entry.data;
+    uint8_t glyphDscSize = p[9];
+    uint16_t cmapCount = readU16(p + 10);
+    uint32_t glyphCount = readU32(p + 12);
+    uint32_t glyphOffset = readU32(p + 20);
+    uint32_t bitmapOffset = readU32(p + 24);
+    uint32_t cmapOffset = readU32(p + 28);
+    uint32_t kernOffset = readU32(p + 32);
+    uint32_t bitmapSize = readU32(p + 36);
+    // glyph_dsc直接使用映射中的数组，布局必须与本固件的LV_FONT_FMT_TXT_LARGE一致
+    if (glyphDscSize != sizeof(lv_font_fmt_txt_glyph_dsc_t)) {
+        ASSET_LOG("字体%s的glyph_dsc为%u字节，本固件为%u字节（LV_FONT_FMT_TXT_LARGE不一致）\n",
+                  entry.name, glyphDscSize, (unsigned)sizeof(lv_font_fmt_txt_glyph_dsc_t));
+        return false;
+    }
+    if (cmapCount == 0 || glyphOffset % 4 != 0 || glyphOffset + glyphCount * glyphDscSize > entry.length ||
+        bitmapOffset + bitmapSize > entry.length || cmapOffset + cmapCount * ASSET_CMAP_RECORD_SIZE > entry.length ||
+        (kernOffset != 0 && kernOffset + ASSET_KERN_RECORD_SIZE > entry.length)) {
+        return false;
+    }
+    size_t allocSize = sizeof(AssetFont) + (cmapCount - 1) * sizeof(lv_font_fmt_txt_cmap_t);
+    AssetFont* font = (AssetFont*)lv_mem_alloc(allocSize);
+    if (font == nullptr) {
+        return false;
+    }
+    memset(font, 0, allocSize);
+    for (int i = 0; i < cmapCount; i++) {
+        const uint8_t* record = p + cmapOffset + i * ASSET_CMAP_RECORD_SIZE;
+        lv_font_fmt_txt_cmap_t& cmap = font->cmaps[i];
+        uint32_t unicodeOffset = readU32(record + 8);
+        uint32_t idOffset = readU32(record + 12);
+        cmap.range_start = readU32(record);
+        cmap.range_length = readU16(record + 4);
+        cmap.glyph_id_start = readU16(record + 6);
+        cmap.unicode_list = unicodeOffset ? (const uint16_t*)(p + unicodeOffset) : nullptr;
+        cmap.glyph_id_ofs_list = idOffset ? (const void*)(p + idOffset) : nullptr;
+        cmap.list_length = readU16(record + 16);
+        cmap.type = record[18];
+    }
+    font->dsc.glyph_bitmap = p + bitmapOffset;
+    font->dsc.glyph_dsc = (const lv_font_fmt_txt_glyph_dsc_t*)(p + glyphOffset);
+    font->dsc.cmaps = font->cmaps;
+    font->dsc.kern_scale = readU16(p + 16);
+    font->dsc.cmap_num = cmapCount;
+    font->dsc.bpp = p[7];
+    font->dsc.bitmap_format = p[8];
+    font->dsc.cache = &font->cache;
+    if (kernOffset != 0) {
+        const uint8_t* record = p + kernOffset;
+        font->kern.class_pair_values = (const int8_t*)(p + readU32(record));
+        font->kern.left_class_mapping = p + readU32(record + 4);
+        font->kern.right_class_mapping = p + readU32(record + 8);
+        font->kern.left_class_cnt = record[12];
+        font->kern.right_class_cnt = record[13];
+        font->dsc.kern_dsc = &font->kern;
+        font->dsc.kern_classes = 1;
+    }
+    font->font.get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font->font.get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    font->font.line_height = (int16_t)readU16(p);
+    font->font.base_line = (int16_t)readU16(p + 2);
+    font->font.underline_position = (int8_t)p[4];
+    font->font.underline_thickness = (int8_t)p[5];
+    font->font.subpx = p[6];
+    font->font.dsc = &font->dsc;
+    entry.font = &font->font;
+    return true;
+}
+//*** 查找条目
+AssetBundle::Entry* AssetBundle::find(const char* name, uint8_t type) {
+    for (int i = 0; i < entryCount; i++) {
+        if (entries[i].type == type && strcmp(entries[i].name, name) == 0) {
+            entries[i].lookups++;
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+//*** 获取资源包中的图像
+const lv_img_dsc_t* AssetBundle::getImage(const char* name) {
+    Entry* entry = find(name, ASSET_IMAGE);
+    return entry != nullptr ? &entry->image : nullptr;
+}
+//*** 获取资源包中的字体
+const lv_font_t* AssetBundle::getFont(const char* name) {
+    Entry* entry = find(name, ASSET_FONT);
+    return entry != nullptr ? entry->font : nullptr;
+}
+//*** 获取资源包中的TrueType字体文件
+const uint8_t* AssetBundle::getOutline(const char* name, uint32_t& length) {
+    Entry* entry = find(name, ASSET_OUTLINE);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    length = entry->length;
+    return entry->data;
+}
+//*** 获取图像，资源包中没有时使用编译进固件的版本
+const lv_img_dsc_t* AssetBundle::image(const char* name, const lv_img_dsc_t* fallback) {
+    const lv_img_dsc_t* dsc = getImage(name);
+    return dsc != nullptr ? dsc : fallback;
+}
+//*** 获取字体，资源包中没有时使用编译进固件的版本
+const lv_font_t* AssetBundle::font(const char* name, const lv_font_t* fallback) {
+    const lv_font_t* result = getFont(name);
+    return result != nullptr ? result : fallback;
+}
+#ifdef ARDUINO
+//*** 生成统计JSON
+String AssetBundle::getStatsJson() {
+    JsonDocument doc;
+    doc["ready"] = ready;
+    doc["bytes"] = size;
+    doc["map_us"] = mapMicros;
+    JsonArray items = doc["entries"].to<JsonArray>();
+    for (int i = 0; i < entryCount; i++) {
+        const Entry& entry = entries[i];
+        JsonObject item = items.add<JsonObject>();
+        item["name"] = entry.name;
+        item["type"] = entry.type == ASSET_IMAGE ? "image" : (entry.type == ASSET_FONT ? "font" : "outline");
+        item["bytes"] = entry.length;
+        item["lookups"] = entry.lookups;
+        if (entry.type == ASSET_IMAGE) {
+            item["width"] = entry.image.header.w;
+            item["height"] = entry.image.header.h;
+            item["cf"] = entry.image.header.cf;
+        } else if (entry.type == ASSET_FONT) {
+            item["line_height"] = entry.font->line_height;
+        }
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+#endif
@@ -0,0 +1,106 @@
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+#include <lvgl.h>
+
+// 资源分区的名称（user_huge_app.csv）
+#define ASSET_PARTITION_NAME "assets"
+// 资源包格式（与tools/asset_packer.py一致）
+const uint16_t ASSET_BUNDLE_VERSION = 1;
+const size_t ASSET_BUNDLE_HEADER_SIZE = 16;
+const size_t ASSET_ENTRY_SIZE = 32;
+const int ASSET_NAME_SIZE = 20;
+const size_t ASSET_IMAGE_HEADER_SIZE = 12;
+const size_t ASSET_FONT_HEADER_SIZE = 40;
+const size_t ASSET_CMAP_RECORD_SIZE = 20;
+const size_t ASSET_KERN_RECORD_SIZE = 16;
+// 资源包中最多的条目数
+const int ASSET_MAX_ENTRIES = 32;
+
+// 资源类型
+enum AssetType {
+    ASSET_IMAGE = 1,
+    ASSET_FONT = 2,
+    ASSET_OUTLINE = 3   // TrueType字体文件（原样打包，由TtfLoader读取）
+};
+
+/**
+ * 只读资源包类
+ * 启动时把assets分区整个映射到地址空间（Linux上映射资源包文件，便于在主机上测试），
+ * 图像和字体描述符直接指向映射的数据，只有描述符本身（每幅图像约20字节，每个字体约百字节）占用内存。
+ * 资源包中的同名资源优先于编译进固件的图像和字体，更换图片或字体只需重新烧录资源分区
+ */
+class AssetBundle {
+private:
+    static AssetBundle* instance;  // 单例实例
+
+    const uint8_t* base;           // 映射的资源包
+    size_t size;                   // 资源包长度
+    uint32_t mapMicros;            // 映射和校验的耗时
+    bool ready;                    // 资源包是否可用
+
+    // 资源条目（描述符在打开资源包时一次性建立）
+    struct Entry {
+        char name[ASSET_NAME_SIZE];
+        uint8_t type;
+        const uint8_t* data;       // 条目数据（指向映射）
+        uint32_t length;
+        lv_img_dsc_t image;        // 图像描述符
+        lv_font_t* font;           // 字体描述符（lv_font_t、lv_font_fmt_txt_dsc_t和cmap表，内部RAM）
+        uint32_t lookups;          // 被使用的次数
+    };
+    Entry entries[ASSET_MAX_ENTRIES];
+    int entryCount;
+
+    // 私有构造函数（单例模式）
+    AssetBundle();
+
+    // 解析图像和字体条目
+    bool parseImage(Entry& entry);
+    bool parseFont(Entry& entry);
+
+    // 查找条目
+    Entry* find(const char* name, uint8_t type);
+
+public:
+    // 获取单例实例
+    static AssetBundle* getInstance();
+
+    // 映射资源分区并打开资源包（须在创建使用资源的界面元素之前调用），分区为空时返回false
+    bool init();
+
+#ifndef ARDUINO
+    // 映射资源包文件（Linux上测试使用）
+    bool mapFile(const char* path);
+#endif
+
+    // 打开内存中的资源包（数据须在资源包使用期间保持有效），校验失败时返回false
+    bool open(const uint8_t* data, size_t length);
+
+    // 获取资源包中的图像或字体，不存在时返回nullptr
+    const lv_img_dsc_t* getImage(const char* name);
+    const lv_font_t* getFont(const char* name);
+
+    // 获取资源包中的TrueType字体文件（指向映射的数据），不存在时返回nullptr
+    const uint8_t* getOutline(const char* name, uint32_t& length);
+
+    // 获取资源包中的图像或字体，不存在时返回编译进固件的版本
+    const lv_img_dsc_t* image(const char* name, const lv_img_dsc_t* fallback);
+    const lv_font_t* font(const char* name, const lv_font_t* fallback);
+
+    // 资源包是否可用
+    bool isReady() const { return ready; }
+
+#ifdef ARDUINO
+    // 生成统计JSON：资源包大小、映射耗时和各条目的使用次数
+    String getStatsJson();
+#endif
+};
+
+#endif // ASSET_BUNDLE_H
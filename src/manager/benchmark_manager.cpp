@@ -0,0 +1,808 @@
+#include "benchmark_manager.h"
+#include <SPIFFS.h>
+#include <algorithm>
+#include <esp_heap_caps.h>
+#include "config/config.h"
+#include "manager/screen_manager.h"
+#include "manager/time_manager.h"
+#include "manager/data_manager.h"
+#include "ui/transition_manager.h"
+#include "images/images.h"
+#include "ui/image_cache.h"
+#include "ui/jpeg_image.h"
+#include "ui/png_image.h"
+#include "ui/font_loader.h"
+#include "ui/ttf_loader.h"
+
+extern const lv_font_t lvgl_font_digital_24;
+extern const lv_font_t lvgl_font_digital_48;
+extern const lv_font_t lvgl_font_digital_108;
+
+// 定义单例实例
+BenchmarkManager* BenchmarkManager::instance = nullptr;
+
+//*** 私有构造函数
+BenchmarkManager::BenchmarkManager() {
+    requested = false;
+    running = false;
+    sampleCount = 0;
+    resultLabel = nullptr;
+    hideTimer = nullptr;
+}
+//*** 获取单例实例
+BenchmarkManager* BenchmarkManager::getInstance() {
+    if (instance == nullptr) {
+        instance = new BenchmarkManager();
+    }
+    return instance;
+}
+//*** 请求运行测试
+void BenchmarkManager::requestRun() {
+    if (!running) {
+        requested = true;
+    }
+}
+//*** 记录一个样本
+void BenchmarkManager::addSample(uint32_t elapsed) {
+    if (sampleCount < BENCHMARK_MAX_SAMPLES) {
+        samples[sampleCount++] = elapsed;
+    }
+}
+//*** 刷新一帧并返回耗时
+uint32_t BenchmarkManager::measureFrame() {
+    unsigned long startTime = micros();
+    lv_refr_now(NULL);
+    return micros() - startTime;
+}
+//*** 统计当前测试项
+void BenchmarkManager::finishItem(JsonArray items, const char* name, bool frames, String& summary) {
+    JsonObject item = items.add<JsonObject>();
+    item["name"] = name;
+    item["samples"] = sampleCount;
+    if (sampleCount == 0) {
+        summary += String(name) + ": 无数据\n";
+        sampleCount = 0;
+        return;
+    }
+    std::sort(samples, samples + sampleCount);
+    uint64_t total = 0;
+    for (int i = 0; i < sampleCount; i++) {
+        total += samples[i];
+    }
+    uint32_t avg = total / sampleCount;
+    uint32_t p50 = samples[(sampleCount - 1) * 50 / 100];
+    uint32_t p90 = samples[(sampleCount - 1) * 90 / 100];
+    uint32_t p99 = samples[(sampleCount - 1) * 99 / 100];
+    uint32_t maxValue = samples[sampleCount - 1];
+    item["avg_us"] = avg;
+    item["p50_us"] = p50;
+    item["p90_us"] = p90;
+    item["p99_us"] = p99;
+    item["max_us"] = maxValue;
+    char line[96];
+    if (frames) {
+        float fps = avg > 0 ? 1000000.0f / avg : 0;
+        item["fps"] = fps;
+        snprintf(line, sizeof(line), "%s: %.1f FPS, P50/90/99 %.1f/%.1f/%.1f ms\n",
+                 name, fps, p50 / 1000.0f, p90 / 1000.0f, p99 / 1000.0f);
+    } else {
+        snprintf(line, sizeof(line), "%s: 平均 %.1f ms, P50/90/99 %.1f/%.1f/%.1f ms\n",
+                 name, avg / 1000.0f, p50 / 1000.0f, p90 / 1000.0f, p99 / 1000.0f);
+    }
+    summary += line;
+    Serial.print(line);
+    sampleCount = 0;
+}
+//*** 整屏切换：切换后第一帧的耗时（包括创建元素、填充内容和整屏重绘）
+void BenchmarkManager::runScreenSwitch(JsonArray items, String& summary) {
+    static const ScreenState order[] = {NEWS_SCREEN, CALENDAR_SCREEN, ICIBA_SCREEN, ASTRONAUTS_SCREEN,
+                                        MAO_SELECT_SCREEN, TOXIC_SOUL_SCREEN, SOUL_SCREEN};
+    ScreenManager* screenManager = ScreenManager::getInstance();
+    for (int round = 0; round < BENCHMARK_SWITCH_ROUNDS; round++) {
+        for (size_t i = 0; i < sizeof(order) / sizeof(order[0]); i++) {
+            unsigned long startTime = micros();
+            screenManager->switchToScreen(order[i]);
+            lv_refr_now(NULL);
+            addSample(micros() - startTime);
+            // 过渡动画的后续帧不计入样本，等其结束后再切换下一个屏幕
+            unsigned long waitStart = millis();
+            while (TransitionManager::getInstance()->isActive() && millis() - waitStart < BENCHMARK_TRANSITION_TIMEOUT) {
+                lv_timer_handler();
+                delay(5);
+            }
+        }
+    }
+    finishItem(items, "screen_switch", true, summary);
+}
+//*** 过渡步骤测试回调：显示一个对象，并模拟较重的步骤（如创建屏幕元素）
+static void transitionStepCallback(void* userData) {
+    lv_obj_clear_flag((lv_obj_t*)userData, LV_OBJ_FLAG_HIDDEN);
+    delayMicroseconds(BENCHMARK_STEP_WORK_US);
+}
+//*** 过渡：依次运行每种过渡，像显示任务一样更新时钟并推进LVGL，记录每帧耗时；过渡期间时钟停顿或过渡超时则该项失败
+void BenchmarkManager::runTransitions(JsonArray items, String& summary) {
+    static const char* const names[] = {
+        "transition_fade_in", "transition_fade_out", "transition_slide_left", "transition_slide_right",
+        "transition_slide_top", "transition_slide_bottom", "transition_staged", "transition_steps",
+    };
+    static const lv_dir_t slideDirs[] = {LV_DIR_LEFT, LV_DIR_RIGHT, LV_DIR_TOP, LV_DIR_BOTTOM};
+    static const uint32_t colors[] = {0x1E88E5, 0x43A047, 0xFB8C00, 0x8E24AA};
+    TransitionManager* transitions = TransitionManager::getInstance();
+    TimeManager* timeManager = TimeManager::getInstance();
+    lv_obj_t* boxes[BENCHMARK_TRANSITION_OBJECTS];
+    lv_coord_t boxHeight = screenHeight / BENCHMARK_TRANSITION_OBJECTS;
+    for (int i = 0; i < BENCHMARK_TRANSITION_OBJECTS; i++) {
+        boxes[i] = lv_obj_create(lv_layer_top());
+        lv_obj_set_size(boxes[i], screenWidth, boxHeight);
+        lv_obj_set_pos(boxes[i], 0, boxHeight * i);
+        lv_obj_set_style_bg_color(boxes[i], lv_color_hex(colors[i % 4]), 0);
+        lv_obj_set_style_bg_opa(boxes[i], LV_OPA_COVER, 0);
+        lv_obj_set_style_border_width(boxes[i], 0, 0);
+        lv_obj_set_style_radius(boxes[i], 0, 0);
+    }
+    int failures = 0;
+    for (size_t kind = 0; kind < sizeof(names) / sizeof(names[0]); kind++) {
+        // 淡出从显示状态开始，其余过渡从隐藏状态开始
+        for (int i = 0; i < BENCHMARK_TRANSITION_OBJECTS; i++) {
+            if (kind == 1) {
+                lv_obj_clear_flag(boxes[i], LV_OBJ_FLAG_HIDDEN);
+            } else {
+                lv_obj_add_flag(boxes[i], LV_OBJ_FLAG_HIDDEN);
+            }
+        }
+        // 之前的测试项没有推进LVGL和时钟：先让秒显示追上，并让调度定时器在空闲时暂停，停顿不计入本项
+        timeManager->updateTimeDisplay();
+        lv_timer_handler();
+        uint32_t stallsBefore = transitions->getClockStallCount();
+        uint32_t deferredBefore = transitions->getDeferredSteps();
+        switch (kind) {
+            case 0:
+                for (int i = 0; i < BENCHMARK_TRANSITION_OBJECTS; i++) {
+                    transitions->fadeIn(boxes[i], BENCHMARK_TRANSITION_DURATION);
+                }
+                break;
+            case 1:
+                for (int i = 0; i < BENCHMARK_TRANSITION_OBJECTS; i++) {
+                    transitions->fadeOut(boxes[i], BENCHMARK_TRANSITION_DURATION);
+                }
+                break;
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+                for (int i = 0; i < BENCHMARK_TRANSITION_OBJECTS; i++) {
+                    transitions->slideIn(boxes[i], slideDirs[kind - 2], BENCHMARK_TRANSITION_DURATION);
+                }
+                break;
+            case 6:
+                transitions->stagedReveal(boxes, BENCHMARK_TRANSITION_OBJECTS, BENCHMARK_REVEAL_INTERVAL,
+                                          BENCHMARK_TRANSITION_DURATION);
+                break;
+            default:
+                // 所有步骤同时到期，每帧的时间预算只够执行其中一部分，其余顺延到后续帧
+                for (int i = 0; i < BENCHMARK_TRANSITION_OBJECTS; i++) {
+                    transitions->addStep(i == 0 ? BENCHMARK_TRANSITION_DURATION : 0, transitionStepCallback, boxes[i]);
+                }
+                break;
+        }
+        unsigned long waitStart = millis();
+        bool timedOut = false;
+        while (transitions->isActive()) {
+            if (millis() - waitStart >= BENCHMARK_TRANSITION_TIMEOUT) {
+                timedOut = true;
+                transitions->cancel();
+                break;
+            }
+            timeManager->updateTimeDisplay();
+            unsigned long startTime = micros();
+            lv_timer_handler();
+            addSample(micros() - startTime);
+            delay(5);
+        }
+        uint32_t stalls = transitions->getClockStallCount() - stallsBefore;
+        finishItem(items, names[kind], true, summary);
+        JsonObject item = items[items.size() - 1];
+        item["clock_stalls"] = stalls;
+        item["deferred_steps"] = transitions->getDeferredSteps() - deferredBefore;
+        item["timed_out"] = timedOut;
+        item["passed"] = stalls == 0 && !timedOut;
+        if (stalls != 0 || timedOut) {
+            failures++;
+            char line[96];
+            snprintf(line, sizeof(line), "%s: 失败，时钟停顿 %u 次%s\n", names[kind], (unsigned)stalls, timedOut ? "，过渡超时" : "");
+            summary += line;
+            Serial.print(line);
+        }
+    }
+    for (int i = 0; i < BENCHMARK_TRANSITION_OBJECTS; i++) {
+        lv_obj_del(boxes[i]);
+    }
+    if (failures == 0) {
+        summary += "过渡测试: 全部通过，时钟未停顿\n";
+    }
+}
+//*** 文本滚动：长文本容器每帧滚动4像素
+void BenchmarkManager::runScrollText(JsonArray items, String& summary) {
+    String text;
+    for (int i = 0; text.length() < 3000; i++) {
+        text += MaoSelect[i % MaoSelectCount];
+        text += "\n\n";
+    }
+    lv_obj_t* box = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(box, screenWidth, screenHeight);
+    lv_obj_set_style_bg_color(box, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_opa(box, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(box, 0, 0);
+    lv_obj_set_style_radius(box, 0, 0);
+    lv_obj_set_scrollbar_mode(box, LV_SCROLLBAR_MODE_OFF);
+    lv_obj_t* label = lv_label_create(box);
+    lv_obj_set_width(label, lv_pct(100));
+    lv_obj_set_style_text_font(label, GBFont, 0);
+    lv_obj_set_style_text_color(label, lv_color_hex(0xFFFFFF), 0);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+    lv_label_set_text(label, text.c_str());
+    // 第一帧整屏绘制，不计入样本
+    lv_obj_update_layout(box);
+    measureFrame();
+    for (int i = 0; i < BENCHMARK_SCROLL_FRAMES; i++) {
+        unsigned long startTime = micros();
+        if (lv_obj_get_scroll_bottom(box) <= 0) {
+            lv_obj_scroll_to_y(box, 0, LV_ANIM_OFF);
+        } else {
+            lv_obj_scroll_by(box, 0, -4, LV_ANIM_OFF);
+        }
+        lv_refr_now(NULL);
+        addSample(micros() - startTime);
+        delay(1);
+    }
+    lv_obj_del(box);
+    finishItem(items, "scroll_text", true, summary);
+}
+//*** 时钟跳动：大号数字时钟每帧走一秒
+void BenchmarkManager::runClockTicks(JsonArray items, String& summary) {
+    lv_obj_t* label = lv_label_create(lv_layer_top());
+    lv_obj_set_style_text_font(label, &lvgl_font_digital_48, 0);
+    lv_obj_set_style_text_color(label, lv_color_hex(0xFFFFFF), 0);
+    lv_obj_set_style_bg_color(label, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_opa(label, LV_OPA_COVER, 0);
+    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 20);
+    char timeText[16];
+    for (int i = 0; i <= BENCHMARK_CLOCK_FRAMES; i++) {
+        unsigned long startTime = micros();
+        snprintf(timeText, sizeof(timeText), "12:%02d:%02d", (i / 60) % 60, i % 60);
+        lv_label_set_text(label, timeText);
+        lv_refr_now(NULL);
+        // 第一帧包括标签创建后的首次绘制，不计入样本
+        if (i > 0) {
+            addSample(micros() - startTime);
+        }
+        delay(1);
+    }
+    lv_obj_del(label);
+    finishItem(items, "clock_tick", true, summary);
+}
+//*** JSON缓存加载：读取并解析显示用的缓存文件
+void BenchmarkManager::runJsonLoads(JsonArray items, String& summary) {
+    static const char* files[] = {"/iciba.json", "/astronauts.json", "/news.json", "/note.json"};
+    for (size_t f = 0; f < sizeof(files) / sizeof(files[0]); f++) {
+        if (!SPIFFS.exists(files[f])) {
+            continue;
+        }
+        for (int i = 0; i < BENCHMARK_JSON_LOADS; i++) {
+            unsigned long startTime = micros();
+            File file = SPIFFS.open(files[f], "r");
+            if (!file) {
+                break;
+            }
+            JsonDocument doc;
+            deserializeJson(doc, file);
+            file.close();
+            addSample(micros() - startTime);
+        }
+    }
+    finishItem(items, "json_load", false, summary);
+}
+//*** 图像绘制：整屏宽的背景图像每帧上下移动
+void BenchmarkManager::runImageBlits(JsonArray items, String& summary) {
+    lv_obj_t* backdrop = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(backdrop, screenWidth, screenHeight);
+    lv_obj_set_style_bg_color(backdrop, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_opa(backdrop, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(backdrop, 0, 0);
+    lv_obj_set_style_radius(backdrop, 0, 0);
+    lv_obj_t* img = lv_img_create(backdrop);
+    lv_img_set_src(img, &maoselect);
+    lv_obj_set_pos(img, 0, 0);
+    measureFrame();
+    lv_coord_t y = 0;
+    lv_coord_t step = 8;
+    lv_coord_t maxY = screenHeight - maoselect.header.h;
+    for (int i = 0; i < BENCHMARK_IMAGE_FRAMES; i++) {
+        unsigned long startTime = micros();
+        y += step;
+        if (y <= 0 || y >= maxY) {
+            y = LV_CLAMP(0, y, maxY);
+            step = -step;
+        }
+        lv_obj_set_y(img, y);
+        lv_refr_now(NULL);
+        addSample(micros() - startTime);
+        delay(1);
+    }
+    lv_obj_del(backdrop);
+    finishItem(items, "image_blit", true, summary);
+}
+//*** 背景图像绘制：逐幅整幅重绘所有背景图像（压缩图像包括逐行解压），记录每幅的吞吐量
+void BenchmarkManager::runBackgroundBlits(JsonArray items, String& summary) {
+    static const struct {
+        const char* name;
+        const lv_img_dsc_t* src;
+    } backgrounds[] = {
+        {"blit_iciba", &iciba}, {"blit_soul", &soul}, {"blit_maoselect", &maoselect},
+        {"blit_taxicsoul", &taxicsoul}, {"blit_astronauts", &astronauts}, {"blit_calendar", &calendar},
+    };
+    lv_obj_t* backdrop = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(backdrop, screenWidth, screenHeight);
+    lv_obj_set_style_bg_color(backdrop, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_opa(backdrop, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(backdrop, 0, 0);
+    lv_obj_set_style_radius(backdrop, 0, 0);
+    lv_obj_t* img = lv_img_create(backdrop);
+    lv_obj_set_pos(img, 0, 0);
+    for (size_t i = 0; i < sizeof(backgrounds) / sizeof(backgrounds[0]); i++) {
+        lv_img_set_src(img, backgrounds[i].src);
+        blitFrames(img, BENCHMARK_BACKGROUND_FRAMES);
+        finishItem(items, backgrounds[i].name, true, summary);
+        // 吞吐量：每秒百万像素（包括刷新到屏幕的时间）
+        JsonObject item = items[items.size() - 1];
+        uint32_t avg = item["avg_us"] | 0;
+        uint32_t pixels = backgrounds[i].src->header.w * backgrounds[i].src->header.h;
+        item["mpix_s"] = avg > 0 ? (float)pixels / avg : 0;
+        item["bytes"] = backgrounds[i].src->data_size;
+        switch (backgrounds[i].src->header.cf) {
+            case LV_IMG_CF_TRUE_COLOR:     item["format"] = "raw"; break;
+            case LV_IMG_CF_INDEXED_4BIT:   item["format"] = "indexed4"; break;
+            case LV_IMG_CF_INDEXED_8BIT:   item["format"] = "indexed8"; break;
+            default:                       item["format"] = "rle"; break;
+        }
+    }
+    // SPIFFS中的JPEG背景：逐MCU行流式解码，记录吞吐量和条带缓冲区（解码时的峰值内存）
+    lv_img_header_t header;
+    if (SPIFFS.exists(BENCHMARK_JPEG_IMAGE) && lv_img_decoder_get_info("S:" BENCHMARK_JPEG_IMAGE, &header) == LV_RES_OK) {
+        File file = SPIFFS.open(BENCHMARK_JPEG_IMAGE, "r");
+        size_t bytes = file ? file.size() : 0;
+        file.close();
+        lv_img_set_src(img, "S:" BENCHMARK_JPEG_IMAGE);
+        blitFrames(img, BENCHMARK_BACKGROUND_FRAMES);
+        finishItem(items, "blit_jpeg_soul", true, summary);
+        JsonObject item = items[items.size() - 1];
+        uint32_t avg = item["avg_us"] | 0;
+        item["mpix_s"] = avg > 0 ? (float)(header.w * header.h) / avg : 0;
+        item["bytes"] = bytes;
+        item["raw_bytes"] = header.w * header.h * 2;
+        item["ram_bytes"] = JpegImage::getStripBytes();
+        item["format"] = "jpeg";
+    }
+    lv_obj_del(backdrop);
+}
+//*** 整幅重绘图像指定的帧数，每帧记录一个样本（第一帧不计入）
+void BenchmarkManager::blitFrames(lv_obj_t* img, int frames) {
+    measureFrame();
+    for (int frame = 0; frame < frames; frame++) {
+        unsigned long startTime = micros();
+        lv_obj_invalidate(img);
+        lv_refr_now(NULL);
+        addSample(micros() - startTime);
+        delay(1);
+    }
+}
+//*** 文件图像：从SPIFFS中的PNG创建图像并显示，先在每次显示前使缓存失效（逐行解码到缓存），再重复显示命中缓存
+void BenchmarkManager::runFileImageShows(JsonArray items, String& summary) {
+    if (!SPIFFS.exists(BENCHMARK_FILE_IMAGE)) {
+        Serial.println("SPIFFS中没有测试图像 " BENCHMARK_FILE_IMAGE "，跳过文件图像测试");
+        return;
+    }
+    lv_obj_t* backdrop = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(backdrop, screenWidth, screenHeight);
+    lv_obj_set_style_bg_color(backdrop, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_opa(backdrop, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(backdrop, 0, 0);
+    lv_obj_set_style_radius(backdrop, 0, 0);
+    measureFrame();
+    for (int pass = 0; pass < 2; pass++) {
+        bool cold = pass == 0;
+        for (int i = 0; i < BENCHMARK_FILE_IMAGE_SHOWS; i++) {
+            if (cold) {
+                ImageCache::getInstance()->invalidate(BENCHMARK_FILE_IMAGE);
+            }
+            unsigned long startTime = micros();
+            lv_obj_t* img = lv_img_create(backdrop);
+            lv_img_set_src(img, "S:" BENCHMARK_FILE_IMAGE);
+            lv_obj_set_pos(img, 0, 0);
+            lv_refr_now(NULL);
+            addSample(micros() - startTime);
+            // 删除图像后的背景重绘不计入样本
+            lv_obj_del(img);
+            measureFrame();
+            delay(1);
+        }
+        finishItem(items, cold ? "file_image_cold" : "file_image_cached", true, summary);
+        if (cold) {
+            // 缓存失效时PNG逐行解码，记录解码时的峰值内存
+            JsonObject item = items[items.size() - 1];
+            item["ram_bytes"] = PngImage::getStreamBytes();
+        }
+    }
+    lv_obj_del(backdrop);
+}
+//*** 运行时字体：新闻和名言屏幕切换后第一帧的耗时，先在每次切换前清空字形缓存，再重复切换命中缓存
+void BenchmarkManager::runFontScreens(JsonArray items, String& summary) {
+    static const ScreenState screens[] = {NEWS_SCREEN, MAO_SELECT_SCREEN};
+    static const char* names[][2] = {{"font_news_cold", "font_news_cached"}, {"font_quote_cold", "font_quote_cached"}};
+    FontLoader* fontLoader = FontLoader::getInstance();
+    if (!fontLoader->usesGlyphCache(GBFont)) {
+        Serial.println("GBFont没有使用字形缓存（SPIFFS中没有" FONT_LOADER_DIR "song16.bin，也不是压缩字体），跳过运行时字体测试");
+        return;
+    }
+    ScreenManager* screenManager = ScreenManager::getInstance();
+    for (size_t s = 0; s < sizeof(screens) / sizeof(screens[0]); s++) {
+        for (int pass = 0; pass < 2; pass++) {
+            bool cold = pass == 0;
+            uint32_t hitsBefore, missesBefore;
+            fontLoader->getCacheCounts(hitsBefore, missesBefore);
+            for (int i = 0; i < BENCHMARK_FONT_ROUNDS; i++) {
+                // 先切换到日历屏幕，使每次都重新创建并绘制文字屏幕
+                screenManager->switchToScreen(CALENDAR_SCREEN);
+                lv_refr_now(NULL);
+                unsigned long waitStart = millis();
+                while (TransitionManager::getInstance()->isActive() && millis() - waitStart < BENCHMARK_TRANSITION_TIMEOUT) {
+                    lv_timer_handler();
+                    delay(5);
+                }
+                if (cold) {
+                    fontLoader->clearCache();
+                }
+                unsigned long startTime = micros();
+                screenManager->switchToScreen(screens[s]);
+                lv_refr_now(NULL);
+                addSample(micros() - startTime);
+                waitStart = millis();
+                while (TransitionManager::getInstance()->isActive() && millis() - waitStart < BENCHMARK_TRANSITION_TIMEOUT) {
+                    lv_timer_handler();
+                    delay(5);
+                }
+            }
+            uint32_t hits, misses;
+            fontLoader->getCacheCounts(hits, misses);
+            hits -= hitsBefore;
+            misses -= missesBefore;
+            finishItem(items, names[s][pass], true, summary);
+            // 字形缓存在本项中的命中率
+            JsonObject item = items[items.size() - 1];
+            item["glyph_hits"] = hits;
+            item["glyph_misses"] = misses;
+            item["glyph_hit_rate"] = hits + misses > 0 ? (float)hits / (hits + misses) : 0;
+        }
+    }
+}
+//*** 文字绘制吞吐量：整屏汉字分别在清空字形缓存、命中缓存和LVGL每次解压（压缩字体）时重绘
+void BenchmarkManager::runTextDraw(JsonArray items, String& summary) {
+    FontLoader* fontLoader = FontLoader::getInstance();
+    const lv_font_t* font = GBFont;
+    if (!fontLoader->usesGlyphCache(font)) {
+        Serial.println("GBFont没有使用字形缓存，跳过文字绘制测试");
+        return;
+    }
+    String text;
+    for (int i = 0; text.length() < 1500; i++) {
+        text += MaoSelect[i % MaoSelectCount];
+    }
+    lv_obj_t* box = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(box, screenWidth, screenHeight);
+    lv_obj_set_style_bg_color(box, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_opa(box, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(box, 0, 0);
+    lv_obj_set_style_radius(box, 0, 0);
+    lv_obj_set_scrollbar_mode(box, LV_SCROLLBAR_MODE_OFF);
+    lv_obj_t* label = lv_label_create(box);
+    lv_obj_set_width(label, lv_pct(100));
+    lv_obj_set_style_text_color(label, lv_color_hex(0xFFFFFF), 0);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+    lv_label_set_text(label, text.c_str());
+    // 压缩字体包装前的字体：LVGL每次绘制字形都重新解压
+    const lv_font_t* source = fontLoader->getSourceFont(font);
+    uint32_t glyphsPerFrame = 0;
+    for (int pass = 0; pass < 3; pass++) {
+        const char* name = pass == 0 ? "text_draw_cold" : (pass == 1 ? "text_draw_cached" : "text_draw_direct");
+        if (pass == 2 && source == nullptr) {
+            break;
+        }
+        lv_obj_set_style_text_font(label, pass == 2 ? source : font, 0);
+        lv_obj_update_layout(box);
+        measureFrame();
+        uint32_t hitsBefore, missesBefore;
+        fontLoader->getCacheCounts(hitsBefore, missesBefore);
+        for (int i = 0; i < BENCHMARK_TEXT_FRAMES; i++) {
+            if (pass == 0) {
+                fontLoader->clearCache();
+            }
+            unsigned long startTime = micros();
+            lv_obj_invalidate(box);
+            lv_refr_now(NULL);
+            addSample(micros() - startTime);
+            delay(1);
+        }
+        uint32_t hits, misses;
+        fontLoader->getCacheCounts(hits, misses);
+        hits -= hitsBefore;
+        misses -= missesBefore;
+        if (pass == 0) {
+            glyphsPerFrame = (hits + misses) / BENCHMARK_TEXT_FRAMES;
+        }
+        finishItem(items, name, true, summary);
+        // 每帧获取的字形数相同（同一段文字），由帧耗时得到每秒绘制的字形数
+        JsonObject item = items[items.size() - 1];
+        uint32_t avg = item["avg_us"] | 0;
+        item["glyphs_per_frame"] = glyphsPerFrame;
+        item["glyphs_per_s"] = avg > 0 ? (uint32_t)((uint64_t)glyphsPerFrame * 1000000 / avg) : 0;
+        if (pass < 2) {
+            item["glyph_hit_rate"] = hits + misses > 0 ? (float)hits / (hits + misses) : 0;
+        }
+    }
+    lv_obj_del(box);
+}
+//*** 字符查找：新闻标题的每个字符（连同下一个字符，与测量和绘制文字相同）分别用二分查找和cmap直接索引获取字形描述
+void BenchmarkManager::runGlyphLookup(JsonArray items, String& summary) {
+    FontLoader* fontLoader = FontLoader::getInstance();
+    const lv_font_t* font = GBFont;
+    if (!fontLoader->isLoaded(font) || ((const lv_font_fmt_txt_dsc_t*)font->dsc)->cmap_index == nullptr) {
+        Serial.println("GBFont没有cmap直接索引，跳过字符查找测试");
+        return;
+    }
+    // 使用缓存的新闻标题，没有时使用语录
+    String text;
+    File file = SPIFFS.open("/news.json", "r");
+    if (file) {
+        JsonDocument doc;
+        if (!deserializeJson(doc, file)) {
+            for (JsonVariantConst headline : doc["result"].as<JsonArrayConst>()) {
+                const char* title = headline.as<const char*>();
+                if (title != nullptr && text.length() < BENCHMARK_LOOKUP_TEXT_SIZE) {
+                    text += title;
+                }
+            }
+        }
+        file.close();
+    }
+    for (int i = 0; text.length() < BENCHMARK_LOOKUP_TEXT_SIZE; i++) {
+        text += MaoSelect[i % MaoSelectCount];
+    }
+    uint32_t* letters = (uint32_t*)heap_caps_malloc((text.length() + 1) * sizeof(uint32_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (letters == nullptr) {
+        return;
+    }
+    uint32_t count = 0;
+    uint32_t offset = 0;
+    while (offset < text.length()) {
+        letters[count++] = _lv_txt_encoded_next(text.c_str(), &offset);
+    }
+    letters[count] = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        fontLoader->enableCmapIndex(pass == 1);
+        uint32_t found = 0;
+        for (int i = 0; i < BENCHMARK_LOOKUP_ROUNDS; i++) {
+            unsigned long startTime = micros();
+            for (uint32_t k = 0; k < count; k++) {
+                lv_font_glyph_dsc_t glyph;
+                if (lv_font_get_glyph_dsc(font, &glyph, letters[k], letters[k + 1])) {
+                    found++;
+                }
+            }
+            addSample(micros() - startTime);
+        }
+        finishItem(items, pass == 0 ? "glyph_lookup_search" : "glyph_lookup_index", false, summary);
+        JsonObject item = items[items.size() - 1];
+        uint32_t avg = item["avg_us"] | 0;
+        item["lookups"] = count;
+        item["found"] = found / BENCHMARK_LOOKUP_ROUNDS;
+        item["ns_per_lookup"] = count > 0 ? (uint32_t)((uint64_t)avg * 1000 / count) : 0;
+    }
+    fontLoader->enableCmapIndex(true);
+    free(letters);
+}
+//*** 轮廓字体绘制：时钟数字分别在清空字形缓存（每帧重新光栅化）和命中缓存时重绘，并与同样大小的编译字体对比
+void BenchmarkManager::runTtfDraw(JsonArray items, String& summary) {
+    TtfLoader* ttfLoader = TtfLoader::getInstance();
+    if (!ttfLoader->hasFace(BENCHMARK_TTF_FACE)) {
+        Serial.println("没有轮廓字体" BENCHMARK_TTF_FACE "，跳过轮廓字体绘制测试");
+        return;
+    }
+    static const uint16_t sizes[] = {24, 48, 108};
+    static const lv_font_t* const bitmapFonts[] = {&lvgl_font_digital_24, &lvgl_font_digital_48, &lvgl_font_digital_108};
+    static const char* const names[][3] = {
+        {"ttf_24_first", "ttf_24_cached", "ttf_24_bitmap"},
+        {"ttf_48_first", "ttf_48_cached", "ttf_48_bitmap"},
+        {"ttf_108_first", "ttf_108_cached", "ttf_108_bitmap"},
+    };
+    lv_obj_t* label = lv_label_create(lv_layer_top());
+    lv_obj_set_style_text_color(label, lv_color_hex(0xFFFFFF), 0);
+    lv_obj_set_style_bg_color(label, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_opa(label, LV_OPA_COVER, 0);
+    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 20);
+    for (int s = 0; s < 3; s++) {
+        const lv_font_t* font = ttfLoader->font(BENCHMARK_TTF_FACE, sizes[s], bitmapFonts[s]);
+        if (font == bitmapFonts[s]) {
+            continue;
+        }
+        // 108像素的一行只能放下时和分
+        lv_label_set_text(label, sizes[s] < 108 ? "12:34:56" : "12:34");
+        for (int pass = 0; pass < 3; pass++) {
+            lv_obj_set_style_text_font(label, pass == 2 ? bitmapFonts[s] : font, 0);
+            lv_obj_update_layout(label);
+            measureFrame();
+            uint32_t hitsBefore, missesBefore;
+            ttfLoader->getCacheCounts(hitsBefore, missesBefore);
+            for (int i = 0; i < BENCHMARK_TTF_FRAMES; i++) {
+                if (pass == 0) {
+                    ttfLoader->clearCache();
+                }
+                unsigned long startTime = micros();
+                lv_obj_invalidate(label);
+                lv_refr_now(NULL);
+                addSample(micros() - startTime);
+                delay(1);
+            }
+            uint32_t hits, misses;
+            ttfLoader->getCacheCounts(hits, misses);
+            finishItem(items, names[s][pass], false, summary);
+            if (pass < 2) {
+                JsonObject item = items[items.size() - 1];
+                item["rasterized_per_frame"] = (misses - missesBefore) / BENCHMARK_TTF_FRAMES;
+                item["cached_per_frame"] = (hits - hitsBefore) / BENCHMARK_TTF_FRAMES;
+            }
+        }
+    }
+    lv_obj_del(label);
+}
+//*** 运行已请求的测试
+void BenchmarkManager::runPending() {
+    if (!requested || running) {
+        return;
+    }
+    requested = false;
+    running = true;
+    Serial.println("开始性能测试...");
+    if (resultLabel != nullptr && lv_obj_is_valid(resultLabel)) {
+        lv_obj_add_flag(resultLabel, LV_OBJ_FLAG_HIDDEN);
+    }
+
+    size_t internalBefore = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    size_t psramBefore = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    unsigned long startTime = millis();
+    ScreenState originalScreen = ScreenManager::getInstance()->getCurrentScreen();
+
+    JsonDocument doc;
+    doc["version"] = SOFTWARE_VERSION;
+    doc["build"] = __DATE__ " " __TIME__;
+    doc["uptime_s"] = millis() / 1000;
+    JsonArray items = doc["items"].to<JsonArray>();
+    String summary = "性能测试 " SOFTWARE_VERSION "\n";
+
+    runScreenSwitch(items, summary);
+    runTransitions(items, summary);
+    runScrollText(items, summary);
+    runClockTicks(items, summary);
+    runJsonLoads(items, summary);
+    runImageBlits(items, summary);
+    runBackgroundBlits(items, summary);
+    runFileImageShows(items, summary);
+    runFontScreens(items, summary);
+    runTextDraw(items, summary);
+    runGlyphLookup(items, summary);
+    runTtfDraw(items, summary);
+
+    // 恢复测试前的屏幕
+    ScreenManager::getInstance()->switchToScreen(originalScreen);
+
+    size_t internalAfter = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    JsonObject heap = doc["heap"].to<JsonObject>();
+    heap["internal_free_before"] = internalBefore;
+    heap["internal_free_after"] = internalAfter;
+    heap["internal_min_free"] = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    heap["internal_largest_block"] = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    heap["psram_free_before"] = psramBefore;
+    heap["psram_free_after"] = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    doc["duration_ms"] = millis() - startTime;
+
+    char line[96];
+    snprintf(line, sizeof(line), "内部堆: 空闲 %u KB, 最低 %u KB, 最大块 %u KB\n",
+             (unsigned)(internalAfter / 1024),
+             (unsigned)(heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL) / 1024),
+             (unsigned)(heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL) / 1024));
+    summary += line;
+    snprintf(line, sizeof(line), "PSRAM: 空闲 %u KB\n", (unsigned)(heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 1024));
+    summary += line;
+    recordStackUsage(doc, summary);
+
+    File file = SPIFFS.open(BENCHMARK_RESULT_FILE, "w");
+    if (file) {
+        serializeJson(doc, file);
+        file.close();
+        Serial.println("性能测试结果已保存到 " BENCHMARK_RESULT_FILE);
+    } else {
+        Serial.println("性能测试结果保存失败");
+    }
+    Serial.printf("性能测试完成，耗时 %lu ms\n", millis() - startTime);
+    showResult(summary);
+    running = false;
+}
+//*** 记录各任务栈的最低剩余量（字节），低于TASK_STACK_MIN_FREE时报警
+void BenchmarkManager::recordStackUsage(JsonDocument& doc, String& summary) {
+    static const char* const names[] = {"display", "web_config", "data", "data_manager"};
+    static const uint32_t sizes[] = {DISPLAY_TASK_STACK_SIZE, WEB_CONFIG_TASK_STACK_SIZE, DATA_TASK_STACK_SIZE,
+                                     DATA_TASK_STACK_SIZE};
+    // 测试在显示任务中运行，刚执行完各项绘制和解码，显示任务的最低剩余量即为这些代码的实际占用
+    TaskHandle_t tasks[] = {xTaskGetCurrentTaskHandle(), webConfigTaskHandle, mainDataTaskHandle,
+                            DataManager::getInstance()->getTaskHandle()};
+    JsonObject stack = doc["stack_free"].to<JsonObject>();
+    String line = "栈最低剩余(字节):";
+    for (int i = 0; i < 4; i++) {
+        if (tasks[i] == NULL) {
+            continue;
+        }
+        // ESP32上的栈以字节为单位
+        uint32_t freeBytes = uxTaskGetStackHighWaterMark(tasks[i]);
+        JsonObject task = stack[names[i]].to<JsonObject>();
+        task["size"] = sizes[i];
+        task["min_free"] = freeBytes;
+        line += String(" ") + names[i] + " " + freeBytes;
+        if (freeBytes < TASK_STACK_MIN_FREE) {
+            Serial.printf("警告：任务%s的栈最低只剩 %u 字节（共 %u 字节），应加大栈\n", names[i], freeBytes, sizes[i]);
+            line += "(不足)";
+        }
+    }
+    line += "\n";
+    summary += line;
+    Serial.print(line);
+}
+//*** 在屏幕上显示结果
+void BenchmarkManager::showResult(const String& summary) {
+    if (resultLabel == nullptr || !lv_obj_is_valid(resultLabel)) {
+        resultLabel = lv_label_create(lv_layer_top());
+        lv_obj_set_width(resultLabel, screenWidth);
+        lv_obj_set_style_text_font(resultLabel, GBFont, 0);
+        lv_obj_set_style_text_color(resultLabel, lv_color_hex(0x00FF00), 0);
+        lv_obj_set_style_bg_color(resultLabel, lv_color_hex(0x000000), 0);
+        lv_obj_set_style_bg_opa(resultLabel, LV_OPA_80, 0);
+        lv_obj_set_style_pad_all(resultLabel, 8, 0);
+        lv_label_set_long_mode(resultLabel, LV_LABEL_LONG_WRAP);
+        lv_obj_align(resultLabel, LV_ALIGN_CENTER, 0, 0);
+    }
+    lv_label_set_text(resultLabel, summary.c_str());
+    lv_obj_clear_flag(resultLabel, LV_OBJ_FLAG_HIDDEN);
+    if (hideTimer == nullptr) {
+        hideTimer = lv_timer_create(hideTimerCallback, BENCHMARK_RESULT_SHOW_TIME, this);
+        lv_timer_set_repeat_count(hideTimer, 1);
+    } else {
+        lv_timer_reset(hideTimer);
+    }
+}
+//*** 隐藏结果的定时器回调
+void BenchmarkManager::hideTimerCallback(lv_timer_t* timer) {
+    BenchmarkManager* manager = (BenchmarkManager*)timer->user_data;
+    if (manager->resultLabel != nullptr && lv_obj_is_valid(manager->resultLabel)) {
+        lv_obj_add_flag(manager->resultLabel, LV_OBJ_FLAG_HIDDEN);
+    }
+    // 只执行一次的定时器在回调返回后自动删除
+    manager->hideTimer = nullptr;
+}
+//*** 读取上次保存的测试结果
+String BenchmarkManager::getResultJson() {
+    File file = SPIFFS.open(BENCHMARK_RESULT_FILE, "r");
+    if (!file) {
+        return "{}";
+    }
+    String json = file.readString();
+    file.close();
+    return json;
+}
@@ -0,0 +1,110 @@
+#ifndef BENCHMARK_MANAGER_H
+#define BENCHMARK_MANAGER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <ArduinoJson.h>
+
+// 测试结果保存的文件
+#define BENCHMARK_RESULT_FILE "/benchmark.json"
+// 每个测试项最多记录的样本数
+const int BENCHMARK_MAX_SAMPLES = 120;
+// 各测试项的帧数或次数
+const int BENCHMARK_SWITCH_ROUNDS = 2;    // 依次切换所有屏幕的轮数
+const int BENCHMARK_SCROLL_FRAMES = 90;   // 滚动文本帧数
+const int BENCHMARK_CLOCK_FRAMES = 60;    // 时钟跳动帧数
+const int BENCHMARK_JSON_LOADS = 10;      // 每个JSON缓存文件的加载次数
+const int BENCHMARK_IMAGE_FRAMES = 60;    // 图像移动帧数
+const int BENCHMARK_BACKGROUND_FRAMES = 10; // 每幅背景图像的整幅重绘帧数
+const int BENCHMARK_FILE_IMAGE_SHOWS = 10;  // 文件图像在缓存失效和命中时各显示的次数
+const int BENCHMARK_FONT_ROUNDS = 5;        // 文字屏幕在字形缓存清空和命中时各切换的次数
+const int BENCHMARK_TEXT_FRAMES = 20;       // 整屏文字在每种字形获取方式下的重绘帧数
+const int BENCHMARK_LOOKUP_ROUNDS = 50;     // 字符查找测试在每种查找方式下遍历文字的次数
+const unsigned int BENCHMARK_LOOKUP_TEXT_SIZE = 2000; // 字符查找测试使用的文字长度（字节）
+const int BENCHMARK_TTF_FRAMES = 20;        // 轮廓字体时钟在每种字形获取方式下的重绘帧数
+// 轮廓字体测试使用的字体文件（资源分区或SPIFFS中的/fonts/digital.ttf）
+#define BENCHMARK_TTF_FACE "digital"
+// 文件图像测试使用的SPIFFS中的PNG（由data/目录上传）
+#define BENCHMARK_FILE_IMAGE "/images/soul.png"
+// 流式解码测试使用的SPIFFS中的JPEG（与soul背景图像内容相同）
+#define BENCHMARK_JPEG_IMAGE "/images/soul.jpg"
+// 等待换屏过渡动画结束的最长时间（毫秒）
+const unsigned long BENCHMARK_TRANSITION_TIMEOUT = 3000;
+// 过渡测试：每种过渡的动画时长（毫秒）、分阶段显示的间隔（毫秒）、参与过渡的对象数和每个步骤模拟的耗时（微秒）
+const uint32_t BENCHMARK_TRANSITION_DURATION = 400;
+const uint32_t BENCHMARK_REVEAL_INTERVAL = 150;
+const int BENCHMARK_TRANSITION_OBJECTS = 4;
+const uint32_t BENCHMARK_STEP_WORK_US = 3000;
+// 结果在屏幕上显示的时间（毫秒）
+const uint32_t BENCHMARK_RESULT_SHOW_TIME = 20000;
+
+/**
+ * 设备端性能测试管理器类
+ * 三击按钮（或在网页上提交）后，在显示任务中依次运行整屏切换、文本滚动、时钟跳动、JSON缓存加载和图像绘制测试，
+ * 统计每项的帧率、帧耗时分位数和内存占用，结果显示在屏幕上并保存为JSON，便于在实际设备上对比不同版本的固件
+ */
+class BenchmarkManager {
+private:
+    static BenchmarkManager* instance; // 单例实例
+
+    volatile bool requested;       // 已请求运行测试
+    bool running;                  // 正在运行测试
+    uint32_t samples[BENCHMARK_MAX_SAMPLES]; // 当前测试项的耗时样本（微秒）
+    int sampleCount;               // 当前测试项的样本数
+    lv_obj_t* resultLabel;         // 屏幕上的结果标签
+    lv_timer_t* hideTimer;         // 隐藏结果的定时器
+
+    // 私有构造函数（单例模式）
+    BenchmarkManager();
+
+    // 记录一个样本
+    void addSample(uint32_t elapsed);
+
+    // 统计当前测试项并写入结果，同时追加到屏幕显示文本
+    void finishItem(JsonArray items, const char* name, bool frames, String& summary);
+
+    // 各测试项
+    void runScreenSwitch(JsonArray items, String& summary);
+    void runTransitions(JsonArray items, String& summary);
+    void runScrollText(JsonArray items, String& summary);
+    void runClockTicks(JsonArray items, String& summary);
+    void runJsonLoads(JsonArray items, String& summary);
+    void runImageBlits(JsonArray items, String& summary);
+    void runBackgroundBlits(JsonArray items, String& summary);
+    void blitFrames(lv_obj_t* img, int frames);
+    void runFileImageShows(JsonArray items, String& summary);
+    void runFontScreens(JsonArray items, String& summary);
+    void runTextDraw(JsonArray items, String& summary);
+    void runGlyphLookup(JsonArray items, String& summary);
+    void runTtfDraw(JsonArray items, String& summary);
+
+    // 记录各任务栈的最低剩余量
+    void recordStackUsage(JsonDocument& doc, String& summary);
+
+    // 刷新一帧并返回耗时（微秒）
+    static uint32_t measureFrame();
+
+    // 在屏幕上显示结果
+    void showResult(const String& summary);
+
+    // 隐藏结果的定时器回调
+    static void hideTimerCallback(lv_timer_t* timer);
+
+public:
+    // 获取单例实例
+    static BenchmarkManager* getInstance();
+
+    // 请求运行测试（可在按钮处理或Web任务中调用）
+    void requestRun();
+
+    // 在显示任务中调用：运行已请求的测试
+    void runPending();
+
+    // 是否正在运行测试
+    bool isRunning() { return running; }
+
+    // 读取上次保存的测试结果（JSON），没有结果时返回空对象
+    static String getResultJson();
+};
+
+#endif // BENCHMARK_MANAGER_H
@@ -5,6 +5,8 @@
 #include "config/config.h"
 #include "config/config_manager.h"
 #include "network/net_http.h"
+#include "manager/screen_manager.h"
+#include "manager/image_ingest.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
 #include <SPIFFS.h>
@@ -71,11 +73,14 @@ void DataManager::init() {
     // 加载缓存数据
     loadCacheData();
     
-    // 创建数据任务
+    // 加载已导入的远程图像（须在显示任务启动之前）
+    ImageIngest::getInstance()->init();
+    
+    // 创建数据任务（导入图片时需要HTTPS和PNG解码的栈空间）
     xTaskCreatePinnedToCore(
         dataTask,
         "dataTask",
-        4096,
+        DATA_TASK_STACK_SIZE,
         this,
         1,
         &dataTaskHandle,
@@ -164,6 +169,7 @@ bool DataManager::checkAndUpdateCache(DataType type) {
                     forceICIBARefresh = false;
                     Serial.println("每日一句更新成功");
                     saveCacheData();
+                    ingestIcibaImage();
                 }
             }
             break;
@@ -263,9 +269,9 @@ bool DataManager::fetchData(DataType type, String &result) {
     String url = "";
     
     switch (type) {
-        case ICIBA_DATA:     url = ICIBA_API_URL;     break;// 实现每日一句数据获取逻辑 
-        case ASTRONAUTS_DATA:url = ASTRONAUTS_API_URL;break;// 实现宇航员数据获取逻辑 
-        case NEWS_DATA:      url = NEWS_API_URL;      break;// 实现新闻数据获取逻辑 
+        case ICIBA_DATA:     url = ConfigManager::getInstance()->getApiUrl("iciba", ICIBA_API_URL);          break;// 实现每日一句数据获取逻辑 
+        case ASTRONAUTS_DATA:url = ConfigManager::getInstance()->getApiUrl("astronauts", ASTRONAUTS_API_URL);break;// 实现宇航员数据获取逻辑 
+        case NEWS_DATA:      url = ConfigManager::getInstance()->getApiUrl("news", NEWS_API_URL);            break;// 实现新闻数据获取逻辑 
         default:
             Serial.println("DataManager: 未知的数据类型");
             return false;
@@ -280,6 +286,27 @@ bool DataManager::fetchData(DataType type, String &result) {
     return false;
 }
 
+/**
+ * 导入每日一句的分享图片
+ * 下载fenxiang_img指向的PNG，缩放并转换为屏幕原生格式保存，图片地址不变时不重复下载
+ */
+void DataManager::ingestIcibaImage() {
+    ImageIngestConfig ingestConfig;
+    ConfigManager::getInstance()->getImageIngestConfig(ingestConfig);
+    if (!ingestConfig.enabled) {
+        return;
+    }
+    JsonDocument doc;
+    if (deserializeJson(doc, icibaData)) {
+        return;
+    }
+    const char* url = doc["fenxiang_img"] | "";
+    if (url[0] == '\0') {
+        return;
+    }
+    ImageIngest::getInstance()->ingest(ICIBA_IMAGE_NAME, url, ICIBA_IMAGE_WIDTH, ICIBA_IMAGE_HEIGHT, ingestConfig.compress);
+}
+
 /**
  * 数据任务函数（在第二个核心运行）
  */
@@ -369,6 +396,8 @@ void DataManager::internalSaveCacheData() {
         saveDataToJsonFile("/news.json", newsData, false);
     }
     
+    // 数据文件已更新，预先准备的下一个屏幕需要重新生成
+    ScreenManager::getInstance()->invalidatePreparedScreen();
     Serial.println("缓存数据保存完成");
 }
 
@@ -13,6 +13,11 @@
 #define ICIBA_API_URL      "https://open.iciba.com/dsapi/"
 #define NEWS_API_URL       "http://YOU_NEWS_API"
 
+// 每日一句分享图片导入后的名称和尺寸（与每日一句屏幕的图像区域相同）
+#define ICIBA_IMAGE_NAME   "iciba"
+#define ICIBA_IMAGE_WIDTH  80
+#define ICIBA_IMAGE_HEIGHT 80
+
 // 缓存时间定义（毫秒）
 #define CACHE_TIME_2HOURS 2 * 60 * 60 * 1000 // 2小时
 #define CACHE_TIME_30MIN 30 * 60 * 1000     // 30分钟
@@ -71,6 +76,9 @@ private:
     // 通用HTTP请求函数
     String httpGetRequest(const char* url);    
     
+    // 导入每日一句的分享图片（fenxiang_img）
+    void ingestIcibaImage();
+    
     // 数据任务函数（在第二个核心运行）
     static void dataTask(void *pvParameters);
     
@@ -108,6 +116,9 @@ public:
     
     // 通用数据获取接口
     
+    // 获取数据任务的句柄（性能测试中读取栈的最低剩余量）
+    TaskHandle_t getTaskHandle() { return dataTaskHandle; }
+    
     // 获取是否首次启动状态
     bool getIsFirstStartup() { return isFirstStartup; }
     
@@ -0,0 +1,787 @@
+#include "image_ingest.h"
+#include "../ui/rle_image.h"
+#include "../ui/png_stream.h"
+#ifdef ARDUINO
+#include "../ui/image_cache.h"
+#include <HTTPClient.h>
+#include <SPIFFS.h>
+#include <ArduinoJson.h>
+#else
+#include <dirent.h>
+#include <netdb.h>
+#include <stdlib.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+// LVGL自带的PNG解码库（C代码，内存通过lv_mem_alloc分配），只用于隔行扫描的PNG
+#define LODEPNG_NO_COMPILE_CPP
+extern "C" {
+#include "src/extra/libs/png/lodepng.h"
+}
+
+// 定义单例实例
+ImageIngest* ImageIngest::instance = nullptr;
+
+// 导入目录中的文件名的最大长度（名称加扩展名）
+static const int INGEST_FILE_NAME_SIZE = IMAGE_INGEST_NAME_SIZE + 8;
+
+// 下载的PNG的读取位置
+struct IngestPngReader {
+    const uint8_t* data;
+    size_t length;
+    size_t pos;
+};
+
+#ifdef ARDUINO
+// 图像数据放在PSRAM中
+static inline void* ingestMalloc(size_t size) {
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+}
+static inline void* ingestRealloc(void* data, size_t size) {
+    return heap_caps_realloc(data, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+}
+static inline void ingestFree(void* data) {
+    heap_caps_free(data);
+}
+// 把HTTP响应体写入PSRAM缓冲区的流（支持分块传输，超过上限时写入失败）
+class IngestBufferStream : public Stream {
+public:
+    uint8_t* data = nullptr;
+    size_t length = 0;
+    size_t capacity = 0;
+
+    size_t write(uint8_t c) override {
+        return write(&c, 1);
+    }
+    size_t write(const uint8_t* buffer, size_t size) override {
+        if (length + size > capacity) {
+            if (length + size > IMAGE_INGEST_MAX_DOWNLOAD) {
+                return 0;
+            }
+            size_t newCapacity = capacity > 0 ? capacity * 2 : 32 * 1024;
+            if (newCapacity < length + size) {
+                newCapacity = length + size;
+            }
+            if (newCapacity > IMAGE_INGEST_MAX_DOWNLOAD) {
+                newCapacity = IMAGE_INGEST_MAX_DOWNLOAD;
+            }
+            uint8_t* grown = (uint8_t*)ingestRealloc(data, newCapacity);
+            if (grown == nullptr) {
+                return 0;
+            }
+            data = grown;
+            capacity = newCapacity;
+        }
+        memcpy(data + length, buffer, size);
+        length += size;
+        return size;
+    }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+};
+
+//*** 读取SPIFFS中的文件（PSRAM），失败时返回nullptr
+static uint8_t* readStored(const char* path, size_t& length) {
+    File file = SPIFFS.open(path, "r");
+    if (!file) {
+        return nullptr;
+    }
+    length = file.size();
+    uint8_t* data = (uint8_t*)ingestMalloc(length + 1);
+    if (data != nullptr && file.read(data, length) != length) {
+        ingestFree(data);
+        data = nullptr;
+    }
+    file.close();
+    return data;
+}
+//*** 写入SPIFFS中的文件
+static bool writeStored(const char* path, const uint8_t* data, size_t length) {
+    File file = SPIFFS.open(path, "w");
+    if (!file) {
+        return false;
+    }
+    bool ok = file.write(data, length) == length;
+    file.close();
+    return ok;
+}
+//*** 用临时文件代替原来的文件
+static bool replaceStored(const char* tempPath, const char* path) {
+    SPIFFS.remove(path);
+    return SPIFFS.rename(tempPath, path);
+}
+//*** 删除SPIFFS中的文件
+static void removeStored(const char* path) {
+    SPIFFS.remove(path);
+}
+//*** 列出导入目录中的文件名，返回文件数
+static int listStored(char names[][INGEST_FILE_NAME_SIZE], int maxNames) {
+    File dir = SPIFFS.open("/img");
+    if (!dir || !dir.isDirectory()) {
+        return 0;
+    }
+    int count = 0;
+    File file = dir.openNextFile();
+    while (file && count < maxNames) {
+        // 新版本返回文件名，旧版本返回完整路径
+        const char* fileName = strrchr(file.name(), '/');
+        fileName = fileName != nullptr ? fileName + 1 : file.name();
+        if (strlen(fileName) < INGEST_FILE_NAME_SIZE) {
+            strcpy(names[count++], fileName);
+        }
+        file.close();
+        file = dir.openNextFile();
+    }
+    dir.close();
+    return count;
+}
+#else
+// Linux上测试使用：SPIFFS由目录代替（见setStorageDir），下载使用套接字
+static inline void* ingestMalloc(size_t size) {
+    return malloc(size);
+}
+static inline void* ingestRealloc(void* data, size_t size) {
+    return realloc(data, size);
+}
+static inline void ingestFree(void* data) {
+    free(data);
+}
+// 代替SPIFFS的目录
+static char storageDir[128] = ".";
+
+//*** SPIFFS中的路径对应的文件路径
+static const char* hostPath(const char* path, char* buf, size_t size) {
+    snprintf(buf, size, "%s%s", storageDir, path);
+    return buf;
+}
+//*** 读取文件，失败时返回nullptr
+static uint8_t* readStored(const char* path, size_t& length) {
+    char buf[192];
+    FILE* file = fopen(hostPath(path, buf, sizeof(buf)), "rb");
+    if (file == nullptr) {
+        return nullptr;
+    }
+    fseek(file, 0, SEEK_END);
+    length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t* data = (uint8_t*)ingestMalloc(length + 1);
+    if (data != nullptr && fread(data, 1, length, file) != length) {
+        ingestFree(data);
+        data = nullptr;
+    }
+    fclose(file);
+    return data;
+}
+//*** 写入文件
+static bool writeStored(const char* path, const uint8_t* data, size_t length) {
+    char buf[192];
+    FILE* file = fopen(hostPath(path, buf, sizeof(buf)), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = fwrite(data, 1, length, file) == length;
+    fclose(file);
+    return ok;
+}
+//*** 用临时文件代替原来的文件
+static bool replaceStored(const char* tempPath, const char* path) {
+    char from[192];
+    char to[192];
+    return rename(hostPath(tempPath, from, sizeof(from)), hostPath(path, to, sizeof(to))) == 0;
+}
+//*** 删除文件
+static void removeStored(const char* path) {
+    char buf[192];
+    remove(hostPath(path, buf, sizeof(buf)));
+}
+//*** 列出导入目录中的文件名，返回文件数
+static int listStored(char names[][INGEST_FILE_NAME_SIZE], int maxNames) {
+    char buf[192];
+    DIR* dir = opendir(hostPath("/img", buf, sizeof(buf)));
+    if (dir == nullptr) {
+        return 0;
+    }
+    int count = 0;
+    while (struct dirent* entry = readdir(dir)) {
+        if (count < maxNames && entry->d_name[0] != '.' && strlen(entry->d_name) < INGEST_FILE_NAME_SIZE) {
+            strcpy(names[count++], entry->d_name);
+        }
+    }
+    closedir(dir);
+    return count;
+}
+#endif
+
+//*** 私有构造函数
+ImageIngest::ImageIngest() {
+    memset(slots, 0, sizeof(slots));
+}
+//*** 获取单例实例
+ImageIngest* ImageIngest::getInstance() {
+    if (instance == nullptr) {
+        instance = new ImageIngest();
+    }
+    return instance;
+}
+//*** 查找图像
+ImageIngest::Slot* ImageIngest::findSlot(const char* name, bool create) {
+    Slot* freeSlot = nullptr;
+    for (int i = 0; i < IMAGE_INGEST_MAX_SLOTS; i++) {
+        if (slots[i].name[0] == '\0') {
+            if (freeSlot == nullptr) {
+                freeSlot = &slots[i];
+            }
+        } else if (strcmp(slots[i].name, name) == 0) {
+            return &slots[i];
+        }
+    }
+    if (!create || freeSlot == nullptr || strlen(name) >= IMAGE_INGEST_NAME_SIZE) {
+        return nullptr;
+    }
+    // 名称最后写入：显示任务只查找不新建，看到名称时其余字段已就绪
+    strcpy(freeSlot->name, name);
+    return freeSlot;
+}
+//*** 读取已导入的图像
+void ImageIngest::init() {
+    char fileNames[IMAGE_INGEST_MAX_SLOTS * 3][INGEST_FILE_NAME_SIZE];
+    int count = listStored(fileNames, IMAGE_INGEST_MAX_SLOTS * 3);
+    for (int i = 0; i < count; i++) {
+        const char* fileName = fileNames[i];
+        const char* ext = strrchr(fileName, '.');
+        char name[IMAGE_INGEST_NAME_SIZE];
+        int nameLength = ext != nullptr ? ext - fileName : 0;
+        if (ext == nullptr || strcmp(ext, ".bin") != 0 || nameLength <= 0 || nameLength >= IMAGE_INGEST_NAME_SIZE) {
+            continue;
+        }
+        memcpy(name, fileName, nameLength);
+        name[nameLength] = '\0';
+        char path[40];
+        snprintf(path, sizeof(path), IMAGE_INGEST_DIR "%s.bin", name);
+        lv_img_dsc_t dsc;
+        uint8_t* data = loadFile(path, dsc);
+        Slot* slot = data != nullptr ? findSlot(name, true) : nullptr;
+        if (slot == nullptr) {
+            ingestFree(data);
+            continue;
+        }
+        slot->dsc = dsc;
+        slot->data = data;
+        slot->storedBytes = dsc.data_size + sizeof(lv_img_header_t);
+        slot->result.cf = dsc.header.cf;
+        snprintf(path, sizeof(path), IMAGE_INGEST_DIR "%s.url", name);
+        size_t length = 0;
+        uint8_t* url = readStored(path, length);
+        if (url != nullptr) {
+            length = LV_MIN(length, (size_t)IMAGE_INGEST_URL_SIZE - 1);
+            memcpy(slot->url, url, length);
+            slot->url[length] = '\0';
+            ingestFree(url);
+        }
+        Serial.printf("已加载导入的图像%s：%dx%d，%u字节\n", name, dsc.header.w, dsc.header.h,
+                      (unsigned)slot->storedBytes);
+    }
+}
+//*** 由图像文件内容建立图像描述符
+bool ImageIngest::parseFile(uint8_t* data, size_t length, lv_img_dsc_t& dsc) {
+    if (length <= sizeof(lv_img_header_t)) {
+        return false;
+    }
+    memset(&dsc, 0, sizeof(dsc));
+    memcpy(&dsc.header, data, sizeof(lv_img_header_t));
+    dsc.data = data + sizeof(lv_img_header_t);
+    dsc.data_size = length - sizeof(lv_img_header_t);
+    if (dsc.header.w == 0 || dsc.header.h == 0) {
+        return false;
+    }
+    if (dsc.header.cf == LV_IMG_CF_TRUE_COLOR) {
+        return dsc.data_size >= (uint32_t)dsc.header.w * dsc.header.h * LV_COLOR_SIZE / 8;
+    }
+    return dsc.header.cf == RLE_IMAGE_CF && dsc.data_size > RLE_IMAGE_HEADER_SIZE && memcmp(dsc.data, "RLE6", 4) == 0;
+}
+//*** 读取已保存的图像文件
+uint8_t* ImageIngest::loadFile(const char* path, lv_img_dsc_t& dsc) {
+    size_t length = 0;
+    uint8_t* data = readStored(path, length);
+    if (data != nullptr && !parseFile(data, length, dsc)) {
+        Serial.printf("导入的图像文件%s无效\n", path);
+        ingestFree(data);
+        data = nullptr;
+    }
+    return data;
+}
+#ifdef ARDUINO
+//*** 下载文件到PSRAM缓冲区
+bool ImageIngest::download(const char* url, uint8_t*& data, size_t& length) {
+    HTTPClient http;
+    http.begin(url);
+    http.setTimeout(10000);
+    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+    int httpCode = http.GET();
+    if (httpCode != HTTP_CODE_OK) {
+        Serial.printf("图片下载失败，错误码: %d\n", httpCode);
+        http.end();
+        return false;
+    }
+    int size = http.getSize();
+    if (size > (int)IMAGE_INGEST_MAX_DOWNLOAD) {
+        Serial.printf("图片过大（%d字节），不下载\n", size);
+        http.end();
+        return false;
+    }
+    IngestBufferStream stream;
+    int written = http.writeToStream(&stream);
+    http.end();
+    if (written <= 0 || stream.length == 0) {
+        Serial.printf("图片下载失败，错误: %s\n", http.errorToString(written).c_str());
+        ingestFree(stream.data);
+        return false;
+    }
+    data = stream.data;
+    length = stream.length;
+    return true;
+}
+#else
+//*** 下载文件到缓冲区（Linux上测试使用：HTTP/1.1 GET，支持Content-Length和分块传输，不支持重定向和HTTPS）
+bool ImageIngest::download(const char* url, uint8_t*& data, size_t& length) {
+    char host[64];
+    char port[8] = "80";
+    const char* path = "/";
+    if (strncmp(url, "http://", 7) != 0) {
+        Serial.printf("图片下载失败，不支持的地址: %s\n", url);
+        return false;
+    }
+    const char* start = url + 7;
+    const char* end = start + strcspn(start, ":/");
+    if (end - start <= 0 || end - start >= (int)sizeof(host)) {
+        return false;
+    }
+    memcpy(host, start, end - start);
+    host[end - start] = '\0';
+    if (*end == ':') {
+        size_t portLength = strcspn(end + 1, "/");
+        if (portLength == 0 || portLength >= sizeof(port)) {
+            return false;
+        }
+        memcpy(port, end + 1, portLength);
+        port[portLength] = '\0';
+        end += 1 + portLength;
+    }
+    if (*end == '/') {
+        path = end;
+    }
+    struct addrinfo hints;
+    struct addrinfo* address = nullptr;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(host, port, &hints, &address) != 0) {
+        Serial.printf("图片下载失败，无法解析: %s\n", host);
+        return false;
+    }
+    int fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+    bool connected = fd >= 0 && connect(fd, address->ai_addr, address->ai_addrlen) == 0;
+    freeaddrinfo(address);
+    if (!connected) {
+        Serial.printf("图片下载失败，无法连接: %s:%s\n", host, port);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+    char request[IMAGE_INGEST_URL_SIZE + 128];
+    int requestLength =
+        snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: %s:%s\r\nConnection: close\r\n\r\n", path, host, port);
+    bool ok = send(fd, request, requestLength, 0) == requestLength;
+    // 读取整个响应（头部另外最多占用64KB）
+    const size_t maxResponse = IMAGE_INGEST_MAX_DOWNLOAD + 64 * 1024;
+    uint8_t* response = nullptr;
+    size_t responseLength = 0;
+    size_t capacity = 0;
+    while (ok) {
+        if (responseLength == capacity) {
+            capacity = capacity > 0 ? capacity * 2 : 32 * 1024;
+            uint8_t* grown = capacity <= maxResponse * 2 ? (uint8_t*)ingestRealloc(response, capacity + 1) : nullptr;
+            if (grown == nullptr) {
+                ok = false;
+                break;
+            }
+            response = grown;
+        }
+        ssize_t n = recv(fd, response + responseLength, capacity - responseLength, 0);
+        if (n <= 0) {
+            ok = n == 0;
+            break;
+        }
+        responseLength += n;
+        ok = responseLength <= maxResponse;
+    }
+    close(fd);
+    int httpCode = 0;
+    uint8_t* body = nullptr;
+    if (ok) {
+        response[responseLength] = '\0';
+        sscanf((const char*)response, "HTTP/%*s %d", &httpCode);
+        body = (uint8_t*)strstr((const char*)response, "\r\n\r\n");
+    }
+    if (httpCode != 200 || body == nullptr) {
+        Serial.printf("图片下载失败，错误码: %d\n", httpCode);
+        ingestFree(response);
+        return false;
+    }
+    *body = '\0';
+    body += 4;
+    size_t bodyLength = response + responseLength - body;
+    bool chunked = false;
+    for (const char* line = strstr((const char*)response, "\r\n"); line != nullptr; line = strstr(line + 2, "\r\n")) {
+        chunked = chunked || (strncasecmp(line + 2, "Transfer-Encoding:", 18) == 0 && strstr(line + 2, "chunked") != nullptr);
+    }
+    data = (uint8_t*)ingestMalloc(LV_MAX(bodyLength, (size_t)1));
+    length = 0;
+    if (!chunked) {
+        memcpy(data, body, bodyLength);
+        length = bodyLength;
+    } else {
+        // 分块传输：每块为十六进制长度行、数据和换行，长度为0的块结束
+        const uint8_t* p = body;
+        const uint8_t* bodyEnd = body + bodyLength;
+        while (p < bodyEnd) {
+            char* next = nullptr;
+            unsigned long chunk = strtoul((const char*)p, &next, 16);
+            const uint8_t* chunkData = (const uint8_t*)strstr(next, "\r\n");
+            if (chunkData == nullptr || chunk == 0 || chunk > (size_t)(bodyEnd - chunkData - 2)) {
+                ok = chunk == 0 && chunkData != nullptr;
+                break;
+            }
+            memcpy(data + length, chunkData + 2, chunk);
+            length += chunk;
+            p = chunkData + 2 + chunk + 2;
+        }
+    }
+    ingestFree(response);
+    if (!ok || length == 0 || length > IMAGE_INGEST_MAX_DOWNLOAD) {
+        Serial.printf("图片下载失败，响应无效（%u字节）\n", (unsigned)length);
+        ingestFree(data);
+        return false;
+    }
+    return true;
+}
+#endif
+//*** 读取函数：下载到PSRAM中的PNG
+static size_t readDownloaded(void* context, uint8_t* buf, size_t length) {
+    IngestPngReader* reader = (IngestPngReader*)context;
+    size_t n = LV_MIN(length, reader->length - reader->pos);
+    memcpy(buf, reader->data + reader->pos, n);
+    reader->pos += n;
+    return n;
+}
+//*** 把PNG转换为LVGL图像文件内容
+uint8_t* ImageIngest::convertPng(const uint8_t* png, size_t length, uint16_t width, uint16_t height, bool compress,
+                                 const char* name, size_t& outLength, ImageIngestResult& result) {
+    memset(&result, 0, sizeof(result));
+    // 逐行解码：源图像只保存最近解码的一行
+    IngestPngReader reader = {png, length, 0};
+    PngStream stream;
+    unsigned long startTime = micros();
+    PngError streamError = stream.begin(readDownloaded, &reader);
+    uint32_t decodeMicros = micros() - startTime;
+    unsigned sourceWidth = 0;
+    unsigned sourceHeight = 0;
+    if (streamError == PNG_OK) {
+        sourceWidth = stream.header().width;
+        sourceHeight = stream.header().height;
+    } else if (streamError == PNG_ERROR_INTERLACED) {
+        LodePNGState state;
+        lodepng_state_init(&state);
+        unsigned error = lodepng_inspect(&sourceWidth, &sourceHeight, &state, png, length);
+        lodepng_state_cleanup(&state);
+        if (error != 0) {
+            Serial.printf("PNG文件头无效（错误%u）\n", error);
+            return nullptr;
+        }
+    } else {
+        Serial.printf("PNG文件无效（错误%d）\n", streamError);
+        return nullptr;
+    }
+    if ((uint32_t)sourceWidth * sourceHeight > IMAGE_INGEST_MAX_PIXELS || sourceWidth > 0xFFFF || sourceHeight > 0xFFFF) {
+        Serial.printf("PNG尺寸%ux%u过大，不导入\n", sourceWidth, sourceHeight);
+        return nullptr;
+    }
+    result.sourceWidth = sourceWidth;
+    result.sourceHeight = sourceHeight;
+    // 隔行扫描的PNG不能逐行解码，仍由lodepng整幅解码为RGBA（透明像素按lodepng的默认方式丢弃Alpha）
+    unsigned char* whole = nullptr;
+    if (streamError == PNG_ERROR_INTERLACED) {
+#ifdef ARDUINO
+        size_t decodedBytes = (size_t)sourceWidth * sourceHeight * 4;
+        if (decodedBytes > heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM) ||
+            decodedBytes * 2 > heap_caps_get_free_size(MALLOC_CAP_SPIRAM)) {
+            Serial.printf("PSRAM不足，无法解码%ux%u的隔行扫描PNG\n", sourceWidth, sourceHeight);
+            return nullptr;
+        }
+#endif
+        startTime = micros();
+        unsigned error = lodepng_decode32(&whole, &sourceWidth, &sourceHeight, png, length);
+        decodeMicros += micros() - startTime;
+        if (error != 0) {
+            Serial.printf("PNG解码失败（错误%u）\n", error);
+            if (whole != nullptr) {
+                lv_mem_free(whole);
+            }
+            return nullptr;
+        }
+    }
+    // 居中裁剪到目标宽高比，目标像素取对应源区域的平均值（缩小时相当于盒式滤波）
+    unsigned long scaleStart = micros();
+    size_t rawBytes = (size_t)width * height * sizeof(lv_color_t);
+    lv_color_t* pixels = (lv_color_t*)ingestMalloc(rawBytes);
+    uint32_t* sums = (uint32_t*)ingestMalloc(width * 3 * sizeof(uint32_t));
+    uint8_t* line = whole == nullptr ?
+                    (uint8_t*)ingestMalloc(sourceWidth * 4) : nullptr;
+    bool ok = pixels != nullptr && sums != nullptr && (whole != nullptr || line != nullptr);
+    uint32_t cropWidth = sourceWidth;
+    uint32_t cropHeight = sourceHeight;
+    if ((uint64_t)sourceWidth * height > (uint64_t)sourceHeight * width) {
+        cropWidth = (uint64_t)sourceHeight * width / height;
+    } else {
+        cropHeight = (uint64_t)sourceWidth * height / width;
+    }
+    uint32_t cropX = (sourceWidth - cropWidth) / 2;
+    uint32_t cropY = (sourceHeight - cropHeight) / 2;
+    int32_t lineY = -1;
+    uint32_t streamMicros = 0;
+    for (uint32_t ty = 0; ty < height && ok; ty++) {
+        uint32_t y0 = cropY + ty * cropHeight / height;
+        uint32_t y1 = cropY + (ty + 1) * cropHeight / height;
+        if (y1 <= y0) {
+            y1 = y0 + 1;
+        }
+        memset(sums, 0, width * 3 * sizeof(uint32_t));
+        for (uint32_t y = y0; y < y1 && ok; y++) {
+            const uint8_t* row = line;
+            if (whole != nullptr) {
+                row = whole + (size_t)y * sourceWidth * 4;
+            } else {
+                // 各目标行对应的源行号单调不减，向下解码到需要的行即可
+                unsigned long rowStart = micros();
+                while (lineY < (int32_t)y && ok) {
+                    ok = stream.readRow(line) == PNG_OK;
+                    lineY++;
+                }
+                streamMicros += micros() - rowStart;
+                if (!ok) {
+                    Serial.printf("PNG解码失败（第%d行）\n", lineY);
+                    break;
+                }
+            }
+            uint32_t* sum = sums;
+            for (uint32_t tx = 0; tx < width; tx++, sum += 3) {
+                uint32_t x0 = cropX + tx * cropWidth / width;
+                uint32_t x1 = cropX + (tx + 1) * cropWidth / width;
+                if (x1 <= x0) {
+                    x1 = x0 + 1;
+                }
+                const uint8_t* px = row + x0 * 4;
+                for (uint32_t x = x0; x < x1; x++, px += 4) {
+                    sum[0] += px[0];
+                    sum[1] += px[1];
+                    sum[2] += px[2];
+                }
+            }
+        }
+        const uint32_t* sum = sums;
+        for (uint32_t tx = 0; tx < width && ok; tx++, sum += 3) {
+            uint32_t x0 = cropX + tx * cropWidth / width;
+            uint32_t x1 = cropX + (tx + 1) * cropWidth / width;
+            uint32_t count = (x1 > x0 ? x1 - x0 : 1) * (y1 - y0);
+            pixels[ty * width + tx] = lv_color_make(sum[0] / count, sum[1] / count, sum[2] / count);
+        }
+    }
+    stream.end();
+    if (whole != nullptr) {
+        lv_mem_free(whole);
+    }
+    if (line != nullptr) {
+        ingestFree(line);
+    }
+    if (sums != nullptr) {
+        ingestFree(sums);
+    }
+    result.decodeMicros = decodeMicros + streamMicros;
+    result.scaleMicros = micros() - scaleStart - streamMicros;
+    if (!ok) {
+        if (pixels != nullptr) {
+            ingestFree(pixels);
+        }
+        return nullptr;
+    }
+    // 文件内容：LVGL图像头加像素数据；压缩后不小于原始数据的90%时保存原始数据
+    uint8_t* out = (uint8_t*)ingestMalloc(sizeof(lv_img_header_t) + rawBytes);
+    if (out == nullptr) {
+        ingestFree(pixels);
+        return nullptr;
+    }
+    lv_img_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.w = width;
+    header.h = height;
+    size_t dataBytes = 0;
+    if (compress) {
+        startTime = micros();
+        dataBytes = RleImage::encode(pixels, width, height, name, out + sizeof(header), rawBytes * 9 / 10);
+        result.encodeMicros = micros() - startTime;
+    }
+    if (dataBytes > 0) {
+        header.cf = RLE_IMAGE_CF;
+    } else {
+        header.cf = LV_IMG_CF_TRUE_COLOR;
+        memcpy(out + sizeof(header), pixels, rawBytes);
+        dataBytes = rawBytes;
+    }
+    ingestFree(pixels);
+    memcpy(out, &header, sizeof(header));
+    result.cf = header.cf;
+    outLength = sizeof(header) + dataBytes;
+    return out;
+}
+//*** 下载并导入图片
+bool ImageIngest::ingest(const char* name, const char* url, uint16_t width, uint16_t height, bool compress) {
+    if (strlen(url) >= IMAGE_INGEST_URL_SIZE) {
+        Serial.println("图片地址过长，不导入");
+        return false;
+    }
+    Slot* slot = findSlot(name, true);
+    if (slot == nullptr) {
+        Serial.printf("无法导入图像%s：没有空闲位置\n", name);
+        return false;
+    }
+    if (slot->storedBytes > 0 && strcmp(slot->url, url) == 0) {
+        return true;
+    }
+    Serial.printf("导入图像%s: %s\n", name, url);
+    // 下载
+    unsigned long startTime = millis();
+    uint8_t* png = nullptr;
+    size_t pngLength = 0;
+    if (!download(url, png, pngLength)) {
+        slot->failures++;
+        return false;
+    }
+    slot->downloadMillis = millis() - startTime;
+    slot->downloadBytes = pngLength;
+    // 解码、缩放并转换为原生格式
+    size_t outLength = 0;
+    uint8_t* out = convertPng(png, pngLength, width, height, compress, name, outLength, slot->result);
+    ingestFree(png);
+    if (out == nullptr) {
+        slot->failures++;
+        return false;
+    }
+    // 先写临时文件再改名，写入中断时保留原来的图像
+    char path[40];
+    char tempPath[40];
+    snprintf(path, sizeof(path), IMAGE_INGEST_DIR "%s.bin", name);
+    snprintf(tempPath, sizeof(tempPath), IMAGE_INGEST_DIR "%s.tmp", name);
+    bool saved = writeStored(tempPath, out, outLength) && replaceStored(tempPath, path);
+    if (!saved) {
+        Serial.printf("保存导入的图像%s失败\n", path);
+        removeStored(tempPath);
+        ingestFree(out);
+        slot->failures++;
+        return false;
+    }
+    snprintf(tempPath, sizeof(tempPath), IMAGE_INGEST_DIR "%s.url", name);
+    writeStored(tempPath, (const uint8_t*)url, strlen(url));
+    strcpy(slot->url, url);
+    slot->storedBytes = outLength;
+    slot->ingests++;
+#ifdef ARDUINO
+    ImageCache::getInstance()->invalidate(path);
+#endif
+    // 交给显示任务：上一幅新图像还未被采用时只保存文件，下次启动时加载
+    if (!slot->pendingReady && parseFile(out, outLength, slot->pendingDsc)) {
+        slot->pendingData = out;
+        slot->pendingReady = true;
+    } else {
+        ingestFree(out);
+    }
+    Serial.printf("图像%s导入完成：%ux%u -> %ux%u，%u字节，下载%lu ms，解码%lu us，缩放%lu us\n", name,
+                  slot->result.sourceWidth, slot->result.sourceHeight, width, height, (unsigned)outLength,
+                  (unsigned long)slot->downloadMillis, (unsigned long)slot->result.decodeMicros,
+                  (unsigned long)slot->result.scaleMicros);
+    return true;
+}
+//*** 获取导入的图像
+const lv_img_dsc_t* ImageIngest::image(const char* name, const lv_img_dsc_t* fallback) {
+    Slot* slot = findSlot(name, false);
+    if (slot == nullptr) {
+        return fallback;
+    }
+    if (slot->pendingReady) {
+        // 采用新图像：已创建的图像对象引用的是同一个描述符，更新后直接使用新的像素
+        uint8_t* old = slot->data;
+        slot->dsc = slot->pendingDsc;
+        slot->data = slot->pendingData;
+        slot->pendingData = nullptr;
+        slot->pendingReady = false;
+        if (old != nullptr) {
+            ingestFree(old);
+        }
+    }
+    if (slot->data == nullptr) {
+        return fallback;
+    }
+    slot->shows++;
+    return &slot->dsc;
+}
+#ifndef ARDUINO
+//*** 设置代替SPIFFS的目录
+void ImageIngest::setStorageDir(const char* dir) {
+    snprintf(storageDir, sizeof(storageDir), "%s", dir);
+}
+//*** 模拟重启：释放所有导入的图像
+void ImageIngest::reset() {
+    for (int i = 0; i < IMAGE_INGEST_MAX_SLOTS; i++) {
+        ingestFree(slots[i].data);
+        ingestFree(slots[i].pendingData);
+    }
+    memset(slots, 0, sizeof(slots));
+}
+#else
+//*** 生成统计JSON
+String ImageIngest::getStatsJson() {
+    JsonDocument doc;
+    doc["max_download_bytes"] = IMAGE_INGEST_MAX_DOWNLOAD;
+    doc["max_source_pixels"] = IMAGE_INGEST_MAX_PIXELS;
+    JsonArray images = doc["images"].to<JsonArray>();
+    for (int i = 0; i < IMAGE_INGEST_MAX_SLOTS; i++) {
+        const Slot& slot = slots[i];
+        if (slot.name[0] == '\0') {
+            continue;
+        }
+        JsonObject image = images.add<JsonObject>();
+        image["name"] = slot.name;
+        image["url"] = slot.url;
+        image["format"] = slot.result.cf == RLE_IMAGE_CF ? "rle" : "rgb565";
+        image["width"] = slot.dsc.header.w;
+        image["height"] = slot.dsc.header.h;
+        image["stored_bytes"] = slot.storedBytes;
+        image["source_width"] = slot.result.sourceWidth;
+        image["source_height"] = slot.result.sourceHeight;
+        image["download_bytes"] = slot.downloadBytes;
+        image["download_ms"] = slot.downloadMillis;
+        image["decode_us"] = slot.result.decodeMicros;
+        image["scale_us"] = slot.result.scaleMicros;
+        image["encode_us"] = slot.result.encodeMicros;
+        image["ingests"] = slot.ingests;
+        image["failures"] = slot.failures;
+        image["shows"] = slot.shows;
+        image["pending"] = (bool)slot.pendingReady;
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+#endif
@@ -0,0 +1,103 @@
+#ifndef IMAGE_INGEST_H
+#define IMAGE_INGEST_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// 导入的图像在SPIFFS中的位置：<目录><名称>.bin（LVGL图像文件）和<名称>.url（来源地址）
+#define IMAGE_INGEST_DIR "/img/"
+// 下载的图片文件的最大字节数
+const size_t IMAGE_INGEST_MAX_DOWNLOAD = 512 * 1024;
+// 可解码的最大像素数；PNG逐行解码，内存只与宽度有关，此限制用于控制解码耗时
+// （隔行扫描的PNG仍整幅解码为RGBA，空闲的PSRAM不足时不导入）
+const uint32_t IMAGE_INGEST_MAX_PIXELS = 1024 * 1024;
+// 最多导入的图像数量
+const int IMAGE_INGEST_MAX_SLOTS = 4;
+const int IMAGE_INGEST_NAME_SIZE = 16;
+const int IMAGE_INGEST_URL_SIZE = 192;
+
+// 一次转换的结果
+struct ImageIngestResult {
+    uint16_t sourceWidth;        // 原图宽高
+    uint16_t sourceHeight;
+    uint8_t cf;                  // 保存的颜色格式（RGB565原始数据或按行游程编码）
+    uint32_t decodeMicros;       // PNG解码耗时（逐行解码时为各行的解码时间之和）
+    uint32_t scaleMicros;        // 缩放、裁剪和颜色转换耗时
+    uint32_t encodeMicros;       // 游程编码耗时
+};
+
+/**
+ * 远程图像导入类
+ * 在数据任务中下载远程PNG图片（如每日一句的分享图片fenxiang_img），解码后按目标尺寸居中裁剪并缩小，
+ * 转换为屏幕原生的RGB565格式（可选按行游程编码），作为LVGL图像文件保存到SPIFFS。
+ * 启动时把已保存的图像读入PSRAM，显示任务直接使用内存中的图像，显示时不需要任何解码
+ */
+class ImageIngest {
+private:
+    static ImageIngest* instance;  // 单例实例
+
+    // 导入的图像
+    struct Slot {
+        char name[IMAGE_INGEST_NAME_SIZE]; // 名称（为空表示空闲）
+        char url[IMAGE_INGEST_URL_SIZE];   // 已导入的图片地址
+        lv_img_dsc_t dsc;          // 显示任务使用的图像
+        uint8_t* data;             // 图像文件内容（PSRAM，dsc.data指向其中的像素数据）
+        lv_img_dsc_t pendingDsc;   // 数据任务新导入、尚未被显示任务采用的图像
+        uint8_t* pendingData;
+        volatile bool pendingReady;
+        // 统计
+        ImageIngestResult result;  // 最近一次转换
+        uint32_t downloadBytes;    // 最近一次下载的字节数
+        uint32_t downloadMillis;   // 最近一次下载耗时
+        uint32_t storedBytes;      // 保存的文件大小
+        uint32_t ingests;          // 成功导入次数
+        uint32_t failures;         // 失败次数
+        uint32_t shows;            // 显示次数
+    };
+    Slot slots[IMAGE_INGEST_MAX_SLOTS];
+
+    // 私有构造函数（单例模式）
+    ImageIngest();
+
+    // 查找图像，create为true时在没有找到时分配空闲位置
+    Slot* findSlot(const char* name, bool create);
+
+    // 下载文件到PSRAM缓冲区
+    bool download(const char* url, uint8_t*& data, size_t& length);
+
+    // 读取已保存的图像文件
+    static uint8_t* loadFile(const char* path, lv_img_dsc_t& dsc);
+
+    // 由图像文件内容建立图像描述符
+    static bool parseFile(uint8_t* data, size_t length, lv_img_dsc_t& dsc);
+
+public:
+    // 获取单例实例
+    static ImageIngest* getInstance();
+
+    // 读取SPIFFS中已导入的图像（须在数据任务和显示任务启动之前调用）
+    void init();
+
+    // 下载并导入图片（在数据任务中调用），地址与上次相同时直接返回true
+    bool ingest(const char* name, const char* url, uint16_t width, uint16_t height, bool compress);
+
+    // 把PNG转换为LVGL图像文件内容（4字节图像头加像素数据，PSRAM），失败时返回nullptr
+    static uint8_t* convertPng(const uint8_t* png, size_t length, uint16_t width, uint16_t height, bool compress,
+                               const char* name, size_t& outLength, ImageIngestResult& result);
+
+    // 获取导入的图像（在显示任务中调用），没有时返回fallback
+    const lv_img_dsc_t* image(const char* name, const lv_img_dsc_t* fallback);
+
+#ifndef ARDUINO
+    // 设置代替SPIFFS的目录（Linux上测试使用），导入的图像保存在<目录>/img/中
+    static void setStorageDir(const char* dir);
+
+    // 模拟重启：释放所有导入的图像（Linux上测试使用，之后调用init重新读取）
+    void reset();
+#else
+    // 生成统计JSON：各图像的来源、尺寸、格式和导入耗时
+    String getStatsJson();
+#endif
+};
+
+#endif // IMAGE_INGEST_H
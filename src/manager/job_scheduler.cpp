@@ -0,0 +1,194 @@
+#include "job_scheduler.h"
+#include <ArduinoJson.h>
+
+// 定义单例实例
+JobScheduler* JobScheduler::instance = nullptr;
+
+// 切片耗时直方图的分档上限（微秒）
+static const uint32_t sliceBucketLimits[JOB_SLICE_BUCKETS] = {250, 500, 1000, 2000, 4000, 8000, 16000};
+
+//*** 私有构造函数
+JobScheduler::JobScheduler() {
+    memset(queue, 0, sizeof(queue));
+    queueCount = 0;
+    cursor = 0;
+    memset(sliceHistogram, 0, sizeof(sliceHistogram));
+    totalSlices = 0;
+    maxSliceMicros = 0;
+    overBudgetSlices = 0;
+    frames = 0;
+    syncFinishes = 0;
+    completedJobs = 0;
+    cancelledJobs = 0;
+    memset(history, 0, sizeof(history));
+    historyCount = 0;
+}
+//*** 获取单例实例
+JobScheduler* JobScheduler::getInstance() {
+    if (instance == nullptr) {
+        instance = new JobScheduler();
+    }
+    return instance;
+}
+//*** 提交作业
+bool JobScheduler::submit(Job* job) {
+    if (job->queued) {
+        return true;
+    }
+    if (queueCount >= JOB_MAX_QUEUED) {
+        Serial.printf("作业队列已满，无法提交: %s\n", job->name);
+        return false;
+    }
+    job->queued = true;
+    job->resumeLine = 0;
+    job->submitTime = millis();
+    job->slices = 0;
+    job->busyMicros = 0;
+    job->maxSliceMicros = 0;
+    queue[queueCount++] = job;
+    return true;
+}
+//*** 执行作业的一个切片
+bool JobScheduler::runSlice(Job* job) {
+    unsigned long startTime = micros();
+    JobStatus status = job->step();
+    uint32_t elapsed = micros() - startTime;
+    // 记录切片耗时
+    int bucket = 0;
+    while (bucket < JOB_SLICE_BUCKETS && elapsed > sliceBucketLimits[bucket]) {
+        bucket++;
+    }
+    sliceHistogram[bucket]++;
+    totalSlices++;
+    if (elapsed > maxSliceMicros) {
+        maxSliceMicros = elapsed;
+    }
+    if (elapsed > JOB_FRAME_BUDGET) {
+        overBudgetSlices++;
+    }
+    job->slices++;
+    job->busyMicros += elapsed;
+    if (elapsed > job->maxSliceMicros) {
+        job->maxSliceMicros = elapsed;
+    }
+    if (status == JOB_CONTINUE) {
+        return false;
+    }
+    retire(job, status);
+    return true;
+}
+//*** 从队列中移除作业
+void JobScheduler::removeFromQueue(Job* job) {
+    for (int i = 0; i < queueCount; i++) {
+        if (queue[i] == job) {
+            for (int j = i; j < queueCount - 1; j++) {
+                queue[j] = queue[j + 1];
+            }
+            queueCount--;
+            queue[queueCount] = nullptr;
+            if (cursor > i) {
+                cursor--;
+            }
+            break;
+        }
+    }
+    job->queued = false;
+}
+//*** 作业结束
+void JobScheduler::retire(Job* job, JobStatus status) {
+    removeFromQueue(job);
+    job->result = status;
+    job->resumeLine = 0;
+    job->cleanup();
+    completedJobs++;
+    JobRecord& record = history[historyCount % JOB_HISTORY_SIZE];
+    record.name = job->name;
+    record.ok = status == JOB_DONE;
+    record.slices = job->slices;
+    record.busyMicros = job->busyMicros;
+    record.maxSliceMicros = job->maxSliceMicros;
+    record.wallMillis = millis() - job->submitTime;
+    historyCount++;
+}
+//*** 在时间预算内轮流执行排队作业的切片
+void JobScheduler::runSlices(uint32_t budgetMicros) {
+    if (queueCount == 0) {
+        return;
+    }
+    frames++;
+    unsigned long startTime = micros();
+    // 至少执行一个切片，之后只在预算剩余时继续；多个作业轮流执行，避免长作业饿死短作业
+    do {
+        if (cursor >= queueCount) {
+            cursor = 0;
+        }
+        Job* job = queue[cursor];
+        if (!runSlice(job)) {
+            cursor++;
+        }
+    } while (queueCount > 0 && micros() - startTime < budgetMicros);
+}
+//*** 立即执行作业的剩余切片
+bool JobScheduler::finish(Job* job) {
+    if (!job->queued && !submit(job)) {
+        // 队列已满时也要得到结果，绕过队列直接执行
+        job->resumeLine = 0;
+        JobStatus status;
+        do {
+            status = job->step();
+        } while (status == JOB_CONTINUE);
+        job->result = status;
+        job->resumeLine = 0;
+        job->cleanup();
+        return status == JOB_DONE;
+    }
+    syncFinishes++;
+    while (!runSlice(job)) {
+    }
+    return job->result == JOB_DONE;
+}
+//*** 取消排队的作业
+void JobScheduler::cancel(Job* job) {
+    if (!job->queued) {
+        return;
+    }
+    removeFromQueue(job);
+    job->result = JOB_FAILED;
+    job->resumeLine = 0;
+    job->cleanup();
+    cancelledJobs++;
+}
+//*** 生成统计JSON
+String JobScheduler::getStatsJson() {
+    JsonDocument doc;
+    doc["queued"] = queueCount;
+    doc["frame_budget_us"] = JOB_FRAME_BUDGET;
+    doc["frames"] = frames;
+    doc["slices"] = totalSlices;
+    doc["max_slice_us"] = maxSliceMicros;
+    doc["over_budget_slices"] = overBudgetSlices;
+    doc["sync_finishes"] = syncFinishes;
+    doc["completed"] = completedJobs;
+    doc["cancelled"] = cancelledJobs;
+    JsonObject histogram = doc["slice_histogram_us"].to<JsonObject>();
+    for (int i = 0; i <= JOB_SLICE_BUCKETS; i++) {
+        String label = i < JOB_SLICE_BUCKETS ? "<=" + String(sliceBucketLimits[i]) : ">" + String(sliceBucketLimits[JOB_SLICE_BUCKETS - 1]);
+        histogram[label] = sliceHistogram[i];
+    }
+    JsonArray recent = doc["recent_jobs"].to<JsonArray>();
+    int count = min(historyCount, JOB_HISTORY_SIZE);
+    for (int i = 0; i < count; i++) {
+        // 从最近完成的作业开始
+        const JobRecord& record = history[(historyCount - 1 - i) % JOB_HISTORY_SIZE];
+        JsonObject item = recent.add<JsonObject>();
+        item["name"] = record.name;
+        item["ok"] = record.ok;
+        item["slices"] = record.slices;
+        item["busy_us"] = record.busyMicros;
+        item["max_slice_us"] = record.maxSliceMicros;
+        item["wall_ms"] = record.wallMillis;
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
@@ -0,0 +1,139 @@
+#ifndef JOB_SCHEDULER_H
+#define JOB_SCHEDULER_H
+
+#include <Arduino.h>
+
+// 同时排队的作业数
+const int JOB_MAX_QUEUED = 8;
+// 每次显示循环中所有作业可使用的时间（微秒），超出后留到下一次循环，保证时钟和动画按时刷新
+const uint32_t JOB_FRAME_BUDGET = 4000;
+// 切片耗时直方图的分档上限（微秒），最后一档为超过最大值的切片
+const int JOB_SLICE_BUCKETS = 7;
+// 保留最近完成的作业记录数
+const int JOB_HISTORY_SIZE = 8;
+
+// 作业单步执行的结果
+enum JobStatus {
+    JOB_CONTINUE = 0,   // 还有剩余工作，下一个切片继续
+    JOB_DONE,           // 已完成
+    JOB_FAILED          // 出错结束
+};
+
+/*
+ * 无栈协程宏：在step()中把长任务拆成多个切片，JOB_YIELD()处返回，下次调用从该处继续。
+ * 跨越JOB_YIELD()的状态必须保存在成员变量中（局部变量在返回后失效），
+ * JOB_BEGIN()和JOB_END()之间不能再使用switch语句
+ */
+#define JOB_BEGIN() switch (resumeLine) { case 0:
+#define JOB_YIELD() do { resumeLine = __LINE__; return JOB_CONTINUE; case __LINE__:; } while (0)
+#define JOB_END() } resumeLine = 0; return JOB_DONE
+
+/**
+ * 可分片执行的作业基类
+ * 作业对象由提交者持有（通常为静态对象），调度器只保存指针，不分配和释放内存
+ */
+class Job {
+    friend class JobScheduler;
+
+private:
+    const char* name;             // 作业名称（统计中使用）
+    bool queued;                  // 是否在调度队列中
+    JobStatus result;             // 最近一次运行的结果
+    unsigned long submitTime;     // 提交时间（毫秒）
+    uint32_t slices;              // 本次运行的切片数
+    uint32_t busyMicros;          // 本次运行的累计耗时
+    uint32_t maxSliceMicros;      // 本次运行的最长切片
+
+protected:
+    int resumeLine;               // 协程的恢复位置（0表示从头开始）
+
+    // 执行一个切片，每个切片应在1ms左右完成
+    virtual JobStatus step() = 0;
+
+    // 作业完成、出错或被取消后释放资源（打开的文件、缓冲区等）
+    virtual void cleanup() {}
+
+public:
+    Job(const char* jobName) : name(jobName), queued(false), result(JOB_DONE), submitTime(0),
+                               slices(0), busyMicros(0), maxSliceMicros(0), resumeLine(0) {}
+    virtual ~Job() {}
+
+    // 是否已提交且尚未完成
+    bool isPending() const { return queued; }
+
+    // 最近一次运行是否成功完成
+    bool succeeded() const { return !queued && result == JOB_DONE; }
+
+    // 作业名称
+    const char* getName() const { return name; }
+};
+
+/**
+ * 协作式作业调度器类
+ * 读取文件、解析JSON、拼接长文本等耗时工作拆成切片，在显示任务的两次lv_task_handler之间按每帧时间预算轮流执行，
+ * 避免一次读取Flash就让时钟停顿；需要立即得到结果时可以把作业剩余的切片一次执行完。
+ * 统计每个切片的耗时分布、超出预算的次数和每个作业的总耗时
+ */
+class JobScheduler {
+private:
+    static JobScheduler* instance;   // 单例实例
+
+    Job* queue[JOB_MAX_QUEUED];      // 排队的作业
+    int queueCount;                  // 排队的作业数
+    int cursor;                      // 轮转执行的位置
+
+    // 统计（只在显示任务中写入）
+    uint32_t sliceHistogram[JOB_SLICE_BUCKETS + 1]; // 切片耗时直方图
+    uint32_t totalSlices;            // 切片总数
+    uint32_t maxSliceMicros;         // 最长切片
+    uint32_t overBudgetSlices;       // 单个切片就超出每帧预算的次数
+    uint32_t frames;                 // 执行过作业的显示循环数
+    uint32_t syncFinishes;           // 因需要立即得到结果而一次执行完的次数
+    uint32_t completedJobs;          // 已完成的作业数
+    uint32_t cancelledJobs;          // 被取消的作业数
+
+    // 最近完成的作业记录
+    struct JobRecord {
+        const char* name;
+        bool ok;
+        uint32_t slices;
+        uint32_t busyMicros;
+        uint32_t maxSliceMicros;
+        uint32_t wallMillis;         // 从提交到完成的时间
+    };
+    JobRecord history[JOB_HISTORY_SIZE];
+    int historyCount;                // 已记录的作业数（环形覆盖）
+
+    // 私有构造函数（单例模式）
+    JobScheduler();
+
+    // 执行作业的一个切片并记录耗时，作业结束时返回true
+    bool runSlice(Job* job);
+
+    // 作业结束：移出队列、释放资源并记录
+    void retire(Job* job, JobStatus status);
+
+    // 从队列中移除作业
+    void removeFromQueue(Job* job);
+
+public:
+    // 获取单例实例
+    static JobScheduler* getInstance();
+
+    // 提交作业（已在队列中的作业保持原进度），队列已满时返回false
+    bool submit(Job* job);
+
+    // 在显示任务中调用：在时间预算内轮流执行排队作业的切片
+    void runSlices(uint32_t budgetMicros = JOB_FRAME_BUDGET);
+
+    // 立即执行作业的剩余切片直到结束（未提交的作业从头开始），返回是否成功
+    bool finish(Job* job);
+
+    // 取消排队的作业
+    void cancel(Job* job);
+
+    // 生成统计JSON：切片耗时分布、预算超出次数和最近完成的作业
+    String getStatsJson();
+};
+
+#endif // JOB_SCHEDULER_H
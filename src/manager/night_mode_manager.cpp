@@ -0,0 +1,249 @@
+#include "night_mode_manager.h"
+#include <ArduinoJson.h>
+#include <time.h>
+#include "config/config.h"
+#include "manager/time_manager.h"
+#include "ui/init_ui.h"
+
+// 定义单例实例
+NightModeManager* NightModeManager::instance = nullptr;
+
+// 电源状态名称（统计JSON中使用）
+static const char* stateNames[NightModeManager::STATE_COUNT] = {"awake", "sleeping"};
+
+//*** 私有构造函数
+NightModeManager::NightModeManager() {
+    memset(&config, 0, sizeof(config));
+    config.startMinute = -1;
+    config.endMinute = -1;
+    backlightChannel = 0;
+    state = STATE_AWAKE;
+    displayTaskHandle = nullptr;
+    lastLight = -1;
+    lastBrightness = 255;
+    darkSince = 0;
+    wasInSchedule = false;
+    sleepBySchedule = false;
+    buttonWake = false;
+    wakeTime = 0;
+    wokeByButton = false;
+    savedCpuFreq = 240;
+    stateSince = millis();
+    memset(residencyMs, 0, sizeof(residencyMs));
+    memset(busyMicros, 0, sizeof(busyMicros));
+    sleepCount = 0;
+    wakeByButtonCount = 0;
+    wakeByLightCount = 0;
+    wakeByScheduleCount = 0;
+}
+//*** 获取单例实例
+NightModeManager* NightModeManager::getInstance() {
+    if (instance == nullptr) {
+        instance = new NightModeManager();
+    }
+    return instance;
+}
+//*** 读取配置
+void NightModeManager::init(uint8_t channel) {
+    backlightChannel = channel;
+    ConfigManager::getInstance()->getNightModeConfig(config);
+    // 启动时已处于时间段内则不立即休眠，等下一次进入时间段或环境变暗
+    wasInSchedule = inSchedule();
+    stateSince = millis();
+    if (!config.enabled) {
+        Serial.println("夜间模式已禁用");
+    } else if (config.startMinute >= 0) {
+        Serial.printf("夜间模式: 光线低于 %d 持续 %u 秒或在 %02d:%02d-%02d:%02d 休眠，高于 %d 唤醒\n",
+                      config.darkThreshold, config.darkDelay,
+                      config.startMinute / 60, config.startMinute % 60, config.endMinute / 60, config.endMinute % 60,
+                      config.lightThreshold);
+    } else {
+        Serial.printf("夜间模式: 光线低于 %d 持续 %u 秒后休眠，高于 %d 唤醒\n",
+                      config.darkThreshold, config.darkDelay, config.lightThreshold);
+    }
+}
+//*** 当前是否处于夜间时间段
+bool NightModeManager::inSchedule() {
+    if (config.startMinute < 0) {
+        return false;
+    }
+    time_t now;
+    struct tm timeinfo;
+    time(&now);
+    localtime_r(&now, &timeinfo);
+    // 时间尚未同步时不按时间段休眠
+    if (timeinfo.tm_year < (2020 - 1900)) {
+        return false;
+    }
+    int minute = timeinfo.tm_hour * 60 + timeinfo.tm_min;
+    if (config.startMinute < config.endMinute) {
+        return minute >= config.startMinute && minute < config.endMinute;
+    }
+    // 时间段跨越午夜
+    return minute >= config.startMinute || minute < config.endMinute;
+}
+//*** 亮度更新时记录光线读数
+void NightModeManager::onLightSample(int light, uint8_t brightness) {
+    lastLight = light;
+    lastBrightness = brightness;
+}
+//*** 判断是否应进入休眠
+void NightModeManager::update(bool configMode) {
+    static unsigned long lastCheck = 0;
+    // 光线每200ms采样一次，时间段按分钟变化，不需要每次循环都判断
+    if (millis() - lastCheck < 200) {
+        return;
+    }
+    lastCheck = millis();
+    bool schedule = inSchedule();
+    // 配置模式下需要显示配置信息和响应网页，不休眠
+    if (!config.enabled || configMode) {
+        wasInSchedule = schedule;
+        darkSince = 0;
+        return;
+    }
+    // 时间段只在进入时触发休眠，时间段内被按钮或光线唤醒后不会立即再次休眠
+    if (schedule && !wasInSchedule) {
+        wasInSchedule = true;
+        enterSleep("到达夜间时间段", true);
+        return;
+    }
+    wasInSchedule = schedule;
+    if (lastLight >= 0 && lastLight < config.darkThreshold) {
+        if (darkSince == 0) {
+            darkSince = millis() | 1;
+        } else if (millis() - darkSince >= config.darkDelay * 1000UL) {
+            enterSleep("环境变暗", false);
+        }
+    } else {
+        darkSince = 0;
+    }
+}
+//*** 进入休眠
+void NightModeManager::enterSleep(const char* reason, bool bySchedule) {
+    accountResidency();
+    state = STATE_SLEEPING;
+    sleepBySchedule = bySchedule;
+    sleepCount++;
+    darkSince = 0;
+    // 关闭背光并让屏幕控制器睡眠，之后显示任务不再调用lv_task_handler，LVGL停止刷新和所有动画
+    ledcWrite(backlightChannel, 0);
+    setPanelSleep(true);
+    // 按钮中断唤醒显示任务
+    displayTaskHandle = xTaskGetCurrentTaskHandle();
+    buttonWake = false;
+    attachInterrupt(digitalPinToInterrupt(BUTTON_PIN), buttonIsr, FALLING);
+    savedCpuFreq = getCpuFrequencyMhz();
+    setCpuFrequencyMhz(NIGHT_CPU_FREQ_MHZ);
+    Serial.printf("进入夜间模式（%s），光线 %d\n", reason, lastLight);
+}
+//*** 退出休眠
+void NightModeManager::wake(const char* reason) {
+    setCpuFrequencyMhz(savedCpuFreq);
+    detachInterrupt(digitalPinToInterrupt(BUTTON_PIN));
+    setPanelSleep(false);
+    accountResidency();
+    state = STATE_AWAKE;
+    wakeTime = millis();
+    darkSince = 0;
+    // 屏幕状态未改变，只需更新时钟并整屏重绘一次，再打开背光，避免看到休眠前的旧画面
+    TimeManager::getInstance()->updateTimeDisplay();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    ledcWrite(backlightChannel, lastBrightness);
+    Serial.printf("退出夜间模式（%s），光线 %d\n", reason, lastLight);
+}
+//*** 等待按钮中断或检查间隔
+void NightModeManager::sleepTick() {
+    uint32_t notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(NIGHT_POLL_INTERVAL));
+    unsigned long startTime = micros();
+    if (notified > 0 || buttonWake) {
+        wokeByButton = true;
+        wakeByButtonCount++;
+        wake("按钮");
+        return;
+    }
+    int light = analogRead(LIGHT_SENSOR_PIN);
+    lastLight = light;
+    bool schedule = inSchedule();
+    if (schedule && !wasInSchedule) {
+        // 环境变暗休眠期间到达时间段：之后按时间段引起的休眠处理
+        sleepBySchedule = true;
+    }
+    if (sleepBySchedule) {
+        // 时间段内只由按钮唤醒；时间段结束时环境仍暗则继续休眠，改为在光线变亮时唤醒
+        if (!schedule) {
+            if (light >= config.darkThreshold) {
+                wokeByButton = false;
+                wakeByScheduleCount++;
+                wake("夜间时间段结束");
+            } else {
+                sleepBySchedule = false;
+            }
+        }
+    } else if (light >= config.lightThreshold) {
+        wokeByButton = false;
+        wakeByLightCount++;
+        wake("光线变亮");
+    }
+    wasInSchedule = schedule;
+    busyMicros[STATE_SLEEPING] += micros() - startTime;
+}
+//*** 唤醒后一段时间内的按钮事件应忽略
+bool NightModeManager::shouldIgnoreButton() {
+    return wokeByButton && millis() - wakeTime < NIGHT_WAKE_BUTTON_GUARD;
+}
+//*** 结算当前状态的驻留时间
+void NightModeManager::accountResidency() {
+    unsigned long now = millis();
+    residencyMs[state] += now - stateSince;
+    stateSince = now;
+}
+//*** 按钮中断服务程序
+void IRAM_ATTR NightModeManager::buttonIsr() {
+    if (instance == nullptr || instance->displayTaskHandle == nullptr) {
+        return;
+    }
+    instance->buttonWake = true;
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(instance->displayTaskHandle, &higherPriorityTaskWoken);
+    if (higherPriorityTaskWoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+//*** 生成统计JSON
+String NightModeManager::getStatsJson() {
+    JsonDocument doc;
+    PowerState current = state;
+    doc["state"] = stateNames[current];
+    if (current == STATE_SLEEPING) {
+        doc["sleep_reason"] = sleepBySchedule ? "schedule" : "dark";
+    }
+    doc["enabled"] = config.enabled;
+    doc["light"] = lastLight;
+    doc["sleep_count"] = sleepCount;
+    doc["wake_by_button"] = wakeByButtonCount;
+    doc["wake_by_light"] = wakeByLightCount;
+    doc["wake_by_schedule"] = wakeByScheduleCount;
+    // 当前状态的驻留时间只读取不结算，统计可以在Web任务中生成
+    uint64_t totalMs = 0;
+    uint64_t stateMs[STATE_COUNT];
+    for (int i = 0; i < STATE_COUNT; i++) {
+        stateMs[i] = residencyMs[i];
+        if (i == current) {
+            stateMs[i] += millis() - stateSince;
+        }
+        totalMs += stateMs[i];
+    }
+    JsonObject states = doc["states"].to<JsonObject>();
+    for (int i = 0; i < STATE_COUNT; i++) {
+        JsonObject item = states[stateNames[i]].to<JsonObject>();
+        item["seconds"] = stateMs[i] / 1000;
+        item["residency_pct"] = totalMs > 0 ? stateMs[i] * 100.0f / totalMs : 0;
+        // 显示任务的CPU占用：工作时间占驻留时间的比例
+        item["display_cpu_pct"] = stateMs[i] > 0 ? busyMicros[i] / 10.0f / stateMs[i] : 0;
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
@@ -0,0 +1,104 @@
+#ifndef NIGHT_MODE_MANAGER_H
+#define NIGHT_MODE_MANAGER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "config/config_manager.h"
+
+// 休眠期间显示任务两次检查之间的间隔（毫秒），按钮中断会提前唤醒
+const uint32_t NIGHT_POLL_INTERVAL = 2000;
+// 唤醒后忽略按钮事件的时间（毫秒），避免唤醒的那次按键又触发换屏
+const unsigned long NIGHT_WAKE_BUTTON_GUARD = 1500;
+// 休眠期间的CPU频率（MHz），WiFi要求不低于80MHz
+const uint32_t NIGHT_CPU_FREQ_MHZ = 80;
+
+/**
+ * 夜间模式管理器类
+ * 环境持续变暗或到达设定的时间段时让屏幕进入睡眠（SLPIN）、关闭背光、暂停LVGL刷新和自动换屏，
+ * 显示任务只以很低的频率检查光线和时间；按下按钮（中断唤醒）时恢复到原来的屏幕。
+ * 环境变暗引起的休眠在光线变亮时结束；时间段引起的休眠只在时间段结束时结束，期间光线变亮（如路灯）不会唤醒。
+ * 同时统计各状态的驻留时间和显示任务的CPU占用
+ */
+class NightModeManager {
+public:
+    // 电源状态
+    enum PowerState {
+        STATE_AWAKE = 0,
+        STATE_SLEEPING,
+        STATE_COUNT
+    };
+
+private:
+    static NightModeManager* instance; // 单例实例
+
+    NightModeConfig config;          // 阈值和时间段配置
+    uint8_t backlightChannel;        // 背光PWM通道
+    PowerState state;                // 当前状态
+    TaskHandle_t displayTaskHandle;  // 显示任务（按钮中断通知的目标）
+    int lastLight;                   // 最近一次光线传感器读数
+    uint8_t lastBrightness;          // 最近一次设置的背光亮度（唤醒时恢复）
+    unsigned long darkSince;         // 开始持续变暗的时间（0表示当前不暗）
+    bool wasInSchedule;              // 上次检查时是否处于夜间时间段
+    bool sleepBySchedule;            // 当前休眠由夜间时间段引起（光线变亮不唤醒）
+    volatile bool buttonWake;        // 按钮中断已触发
+    unsigned long wakeTime;          // 上次唤醒的时间
+    bool wokeByButton;               // 上次是否由按钮唤醒
+    uint32_t savedCpuFreq;           // 休眠前的CPU频率
+
+    // 统计
+    unsigned long stateSince;                    // 进入当前状态的时间
+    uint64_t residencyMs[STATE_COUNT];           // 各状态的累计驻留时间
+    uint64_t busyMicros[STATE_COUNT];            // 各状态下显示任务的累计工作时间
+    uint32_t sleepCount;                         // 进入休眠的次数
+    uint32_t wakeByButtonCount;                  // 按钮唤醒次数
+    uint32_t wakeByLightCount;                   // 光线唤醒次数
+    uint32_t wakeByScheduleCount;                // 时间段结束唤醒次数
+
+    // 私有构造函数（单例模式）
+    NightModeManager();
+
+    // 当前是否处于夜间时间段
+    bool inSchedule();
+
+    // 进入和退出休眠
+    void enterSleep(const char* reason, bool bySchedule);
+    void wake(const char* reason);
+
+    // 结算当前状态的驻留时间
+    void accountResidency();
+
+    // 按钮中断服务程序
+    static void IRAM_ATTR buttonIsr();
+
+public:
+    // 获取单例实例
+    static NightModeManager* getInstance();
+
+    // 读取配置（在ConfigManager初始化之后调用）
+    void init(uint8_t channel);
+
+    // 亮度更新时记录光线读数和设置的亮度
+    void onLightSample(int light, uint8_t brightness);
+
+    // 在显示任务中调用（唤醒状态）：判断是否应进入休眠
+    void update(bool configMode);
+
+    // 在显示任务中调用（休眠状态）：等待按钮中断或检查间隔，判断是否应唤醒
+    void sleepTick();
+
+    // 是否处于休眠状态
+    bool isSleeping() { return state == STATE_SLEEPING; }
+
+    // 唤醒后一段时间内的按钮事件应忽略
+    bool shouldIgnoreButton();
+
+    // 记录显示任务一次循环的工作时间
+    void accountBusy(uint32_t elapsed) { busyMicros[state] += elapsed; }
+
+    // 生成统计JSON：各状态驻留时间、CPU占用和唤醒原因
+    String getStatsJson();
+};
+
+#endif // NIGHT_MODE_MANAGER_H
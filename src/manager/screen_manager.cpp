@@ -5,6 +5,9 @@
 #include "content/soul.h"
 #include "lvgl.h"
 #include "ui/display_manager.h"
+#include "ui/transition_manager.h"
+#include "ui/screen_lifecycle.h"
+#include "ui/quote_bitmap_cache.h"
 #include <SPIFFS.h>
 #include <WiFi.h>
 #include <ArduinoJson.h>
@@ -16,6 +19,13 @@ ScreenManager::ScreenManager() : currentScreen(MAO_SELECT_SCREEN) {
     screen_symbol_label = nullptr;
     screen_title_btn = nullptr;
     title_label = nullptr;
+    // 初始化预渲染状态
+    preparedScreen = MAO_SELECT_SCREEN;
+    nextScreenPrepared = false;
+    prepareJob = nullptr;
+    preparedDirty = false;
+    lastSwitchTime = 0;
+    lastSwitchLatency = 0;
 }
 //*** 获取单例实例
 ScreenManager* ScreenManager::getInstance() {
@@ -47,9 +57,18 @@ void ScreenManager::init() {
         lv_obj_align(title_label, LV_ALIGN_CENTER, 0, 0); // 标题居中对齐
     }
 }
+//*** 金山词霸屏幕分阶段显示：图片展示后再把文字移到顶层
+static void bringIcibaLabelToFront(void* userData) {
+    extern lv_obj_t* iciba_label;
+    if (iciba_label && lv_obj_is_valid(iciba_label)) {
+        lv_obj_move_foreground(iciba_label);
+    }
+}
 //*** 隐藏所有屏幕元素
 void ScreenManager::hideAllScreens() {
     Serial.print("隐藏所有屏幕元素。");   
+    // 取消上一个屏幕未完成的过渡，避免作用到新屏幕上
+    TransitionManager::getInstance()->cancel();
     // 隐藏毛选标签和背景图像
 extern lv_obj_t* mao_select_label;
 extern lv_obj_t* maoselect_img;
@@ -124,11 +143,11 @@ if (today_date_label) {
 //*** 显示留言板屏幕
 void ScreenManager::showNoteScreen() {
     Serial.println("切换到留言板屏幕");   
+    // 确保note内容已加载（已预先准备时直接使用）
+    ensureScreenContent(NOTE_SCREEN);
     // 确保note_label被创建并显示
 extern lv_obj_t* note_label;
 if (note_label && lv_obj_is_valid(note_label)) {
-    // 从文件加载并显示note内容
-    ::displayNoteDataFromFile();
     lv_obj_clear_flag(note_label, LV_OBJ_FLAG_HIDDEN);
     lv_obj_move_foreground(note_label);
 }   
@@ -177,6 +196,8 @@ void ScreenManager::showCurrentScreen() {
 //*** 显示日历屏幕
 void ScreenManager::showCalendarScreen() {
     Serial.println("切换到日历屏幕：");
+    // 确保日历内容已就绪（已预先准备时直接使用）
+    ensureScreenContent(CALENDAR_SCREEN);
     // 确保calendar_img被创建并显示在底部
     extern lv_obj_t* calendar_img;
     if (calendar_img && lv_obj_is_valid(calendar_img)) {
@@ -192,22 +213,9 @@ void ScreenManager::showCalendarScreen() {
     // 确保today_date_label被创建并显示
     extern lv_obj_t* today_date_label;
     if (today_date_label && lv_obj_is_valid(today_date_label)) {
-        // 获取当前日期
-        time_t now;
-        struct tm timeinfo;
-        time(&now);
-        localtime_r(&now, &timeinfo);
-        int day = timeinfo.tm_mday;
-        // 格式化日期为两位数字（如01, 02）
-        char dateStr[3];
-        sprintf(dateStr, "%02d", day);   
-        // 设置标签文本并显示
-        lv_label_set_text(today_date_label, dateStr);
         lv_obj_clear_flag(today_date_label, LV_OBJ_FLAG_HIDDEN);
         lv_obj_move_foreground(today_date_label);
     }
-    // 显示日历信息
-    ::displayCalendar();   
     // 更新屏幕标题和符号
     if (screen_symbol_label && screen_title_btn && title_label) {
       // 更新标题文本
@@ -216,64 +224,238 @@ void ScreenManager::showCalendarScreen() {
         lv_obj_set_style_bg_color(screen_title_btn, lv_color_hex(0x800080), 0); // 紫色
     }
 }
-//*** 切换到下一个屏幕
-void ScreenManager::toggleScreen() {
-    // 隐藏所有屏幕元素
-    hideAllScreens();
-    // 首先检查note.json文件是否存在且有内容
-    bool hasNoteContent = false;
-    String noteContent = "";
+//*** 检查留言板是否有内容
+bool ScreenManager::hasNoteContent() {
     // 检查note.json文件是否存在
-    if (SPIFFS.exists("/note.json")) {
-        File noteFile = SPIFFS.open("/note.json", "r");
-        if (noteFile) {
-            DynamicJsonDocument doc(1024);
-            DeserializationError error = deserializeJson(doc, noteFile);
-            noteFile.close();       
-            if (!error && doc.containsKey("note")) {
-                noteContent = doc["note"].as<String>();
-                // 检查note内容是否不为空
-                if (!noteContent.isEmpty()) {
-                    hasNoteContent = true;
-                }
-            }
+    if (!SPIFFS.exists("/note.json")) {
+        return false;
+    }
+    File noteFile = SPIFFS.open("/note.json", "r");
+    if (!noteFile) {
+        return false;
+    }
+    DynamicJsonDocument doc(1024);
+    DeserializationError error = deserializeJson(doc, noteFile);
+    noteFile.close();
+    if (error || !doc.containsKey("note")) {
+        return false;
+    }
+    // 检查note内容是否不为空
+    return !doc["note"].as<String>().isEmpty();
+}
+// 定义屏幕切换顺序：新闻 -> 日历 -> 金山词霸 -> 太空宇航员 -> 毛选 -> 乌鸡汤 -> 禅语哲言 -> 新闻...
+static const ScreenState screenOrder[] = {NEWS_SCREEN, CALENDAR_SCREEN, ICIBA_SCREEN, ASTRONAUTS_SCREEN, MAO_SELECT_SCREEN, TOXIC_SOUL_SCREEN, SOUL_SCREEN};
+static const int SCREEN_ORDER_COUNT = sizeof(screenOrder) / sizeof(screenOrder[0]);
+// 查找屏幕在切换顺序中的索引，不在顺序中的屏幕（留言板）视为第一个
+static int findScreenOrderIndex(ScreenState screenState) {
+    for (int i = 0; i < SCREEN_ORDER_COUNT; i++) {
+        if (screenOrder[i] == screenState) {
+            return i;
         }
-    }    
+    }
+    return 0;
+}
+//*** 计算下一个要显示的屏幕
+ScreenState ScreenManager::computeNextScreen() {
     // 如果有note内容，并且当前不是已经在留言板屏幕，则切换到留言板屏幕
-    if (hasNoteContent && currentScreen != NOTE_SCREEN) {
-        Serial.println("检测到note.json有内容，切换到留言板屏幕");
-        currentScreen = NOTE_SCREEN;
-    } else {
-        // 定义屏幕切换顺序：新闻 -> 日历 -> 金山词霸 -> 太空宇航员 -> 毛选 -> 乌鸡汤 -> 禅语哲言 -> 新闻...
-        static const ScreenState screenOrder[] = {NEWS_SCREEN, CALENDAR_SCREEN, ICIBA_SCREEN, ASTRONAUTS_SCREEN, MAO_SELECT_SCREEN, TOXIC_SOUL_SCREEN, SOUL_SCREEN};
-        // 查找当前屏幕在顺序数组中的索引
-        int currentIndex = 0;
-        for (int i = 0; i < 7; i++) {
-            if (screenOrder[i] == currentScreen) {
-                currentIndex = i;
-                break;
+    if (currentScreen != NOTE_SCREEN && hasNoteContent()) {
+        Serial.println("检测到note.json有内容，下一个屏幕为留言板屏幕");
+        return NOTE_SCREEN;
+    }
+    // 查找当前屏幕在顺序数组中的索引
+    int currentIndex = findScreenOrderIndex(currentScreen);
+    // 计算下一个屏幕的索引（循环）
+    int nextIndex = (currentIndex + 1) % SCREEN_ORDER_COUNT;
+    return screenOrder[nextIndex];
+}
+//*** 从语录数组中随机选择一条设置到标签
+void ScreenManager::setRandomQuote(lv_obj_t* label, const char** quotes, int count) {
+    if (label && lv_obj_is_valid(label) && count > 0) {
+        const char* quote = quotes[random(count)];
+        QuoteBitmapCache* bitmapCache = QuoteBitmapCache::getInstance();
+        bitmapCache->registerCorpus(quotes, count);
+        // 优先显示预渲染的文本位图，重复显示同一条语录时不再逐字光栅化
+        if (bitmapCache->show(label, quote)) {
+            return;
+        }
+        // 位图不可用时回退为普通文本：语录编译在固件中，直接引用而不复制
+        lv_label_set_text_static(label, quote);
+    }
+}
+//*** 在隐藏状态下为指定屏幕填充内容
+void ScreenManager::prepareScreenContent(ScreenState screenState) {
+    extern lv_obj_t* news_label;
+    extern lv_obj_t* iciba_label;
+    extern lv_obj_t* note_label;
+    extern lv_obj_t* mao_select_label;
+    extern lv_obj_t* toxic_soul_label;
+    extern lv_obj_t* soul_label;
+    // 按需创建该屏幕的元素（已创建时只更新使用顺序）
+    ScreenLifecycle::getInstance()->ensureBuilt(screenState);
+    // 标签保持隐藏状态，设置文本时LVGL即完成换行和尺寸计算，显示时只需切换可见性
+    String text;
+    switch (screenState) {
+        case NEWS_SCREEN:
+        case CALENDAR_SCREEN:
+            // 与后台分片准备使用同一个作业，这里一次执行完
+            JobScheduler::getInstance()->finish(getPrepareJob(screenState));
+            break;
+        case ICIBA_SCREEN:
+            if (iciba_label && lv_obj_is_valid(iciba_label)) {
+                buildIcibaText(text);
+                lv_label_set_text(iciba_label, text.c_str());
+            }
+            break;
+        case ASTRONAUTS_SCREEN:
+            if (astronauts_label && lv_obj_is_valid(astronauts_label)) {
+                buildAstronautsText(text);
+                lv_label_set_text(astronauts_label, text.c_str());
+            }
+            break;
+        case NOTE_SCREEN:
+            if (note_label && lv_obj_is_valid(note_label)) {
+                buildNoteText(text);
+                lv_label_set_text(note_label, text.c_str());
             }
+            break;
+        case MAO_SELECT_SCREEN:
+            setRandomQuote(mao_select_label, MaoSelect, sizeof(MaoSelect) / sizeof(MaoSelect[0]));
+            break;
+        case TOXIC_SOUL_SCREEN:
+            setRandomQuote(toxic_soul_label, ToxicSoul, sizeof(ToxicSoul) / sizeof(ToxicSoul[0]));
+            break;
+        case SOUL_SCREEN:
+            setRandomQuote(soul_label, Soul, sizeof(Soul) / sizeof(Soul[0]));
+            break;
+        default:
+            break;
+    }
+    // 文本更新后重新统计该屏幕的内存占用
+    ScreenLifecycle::getInstance()->refreshStats(screenState);
+}
+//*** 获取分片准备指定屏幕的作业
+Job* ScreenManager::getPrepareJob(ScreenState screenState) {
+    switch (screenState) {
+        case NEWS_SCREEN:
+            return getNewsLoadJob();
+        case CALENDAR_SCREEN:
+            return getCalendarJob();
+        default:
+            return nullptr;
+    }
+}
+//*** 确保指定屏幕的内容已就绪
+void ScreenManager::ensureScreenContent(ScreenState screenState) {
+    if (prepareJob != nullptr) {
+        if (preparedScreen == screenState && !preparedDirty) {
+            // 正要显示的屏幕还在分片准备，把剩余切片一次执行完
+            if (prepareJob->isPending()) {
+                JobScheduler::getInstance()->finish(prepareJob);
+            }
+            nextScreenPrepared = true;
+        } else {
+            JobScheduler::getInstance()->cancel(prepareJob);
+        }
+        prepareJob = nullptr;
+    }
+    bool usePrepared = nextScreenPrepared && preparedScreen == screenState && !preparedDirty;
+    // 预先准备的内容只使用一次，显示后需要为新的下一个屏幕重新准备
+    nextScreenPrepared = false;
+    if (!usePrepared) {
+        prepareScreenContent(screenState);
+    }
+}
+//*** 预先准备下一个屏幕
+void ScreenManager::prepareNextScreen() {
+    // 已提交的准备作业在显示循环中分片执行，完成后才算准备好
+    if (prepareJob != nullptr) {
+        if (prepareJob->isPending() && !preparedDirty) {
+            return;
         }
-        // 计算下一个屏幕的索引（循环）
-        int nextIndex = (currentIndex + 1) % 7;
-        // 设置下一个屏幕
-        currentScreen = screenOrder[nextIndex];
-    }   
+        // 数据文件已更新时取消（未完成的）作业，重新准备
+        JobScheduler::getInstance()->cancel(prepareJob);
+        bool done = !preparedDirty;
+        prepareJob = nullptr;
+        if (done) {
+            ScreenLifecycle::getInstance()->refreshStats(preparedScreen);
+            nextScreenPrepared = true;
+            Serial.printf("已分片准备下一个屏幕: %d\n", preparedScreen);
+            return;
+        }
+    }
+    // 已准备好且数据未更新时无需重复准备
+    if (nextScreenPrepared && !preparedDirty) {
+        return;
+    }
+    // 换屏后先让当前屏幕完成渲染，再利用空闲时间准备下一个屏幕
+    if (millis() - lastSwitchTime < SCREEN_PREPARE_DELAY) {
+        return;
+    }
+    unsigned long startMicros = micros();
+    preparedDirty = false;
+    ScreenState nextScreen = computeNextScreen();
+    // 先标记为预先准备的屏幕，避免其元素在预算检查时被释放
+    ScreenLifecycle::getInstance()->setPreparedScreen(nextScreen);
+    // 读取文件和解析JSON较慢的屏幕提交作业分片执行，避免阻塞时钟刷新
+    Job* job = getPrepareJob(nextScreen);
+    if (job != nullptr) {
+        ScreenLifecycle::getInstance()->ensureBuilt(nextScreen);
+        if (JobScheduler::getInstance()->submit(job)) {
+            prepareJob = job;
+            preparedScreen = nextScreen;
+            return;
+        }
+    }
+    prepareScreenContent(nextScreen);
+    preparedScreen = nextScreen;
+    nextScreenPrepared = true;
+    Serial.printf("已预先准备下一个屏幕: %d，耗时: %lu us\n", nextScreen, micros() - startMicros);
+}
+//*** 使已预先准备的屏幕内容失效
+void ScreenManager::invalidatePreparedScreen() {
+    preparedDirty = true;
+}
+//*** 切换到下一个屏幕
+void ScreenManager::toggleScreen() {
+    unsigned long startMicros = micros();
+    // 已预先准备好下一个屏幕时直接使用，否则现场读取数据并构建
+    bool usePrepared = nextScreenPrepared && !preparedDirty;
+    ScreenState nextScreen = usePrepared ? preparedScreen : computeNextScreen();
+    // 隐藏所有屏幕元素
+    hideAllScreens();
+    currentScreen = nextScreen;
+    ScreenLifecycle::getInstance()->enterScreen(currentScreen);
     // 先清空标题文本，实现"每次清空后再显示下一个"的效果
     if (title_label) {
         lv_label_set_text(title_label, "");
     }
     // 显示当前屏幕
     showCurrentScreen();
+    lastSwitchTime = millis();
+    lastSwitchLatency = micros() - startMicros;
+    Serial.printf("换屏耗时: %lu us（%s）\n", lastSwitchLatency, usePrepared ? "已预先准备" : "未预先准备");
+}
+//*** 按切换顺序返回上一个屏幕
+void ScreenManager::showPreviousScreen() {
+    int currentIndex = findScreenOrderIndex(currentScreen);
+    int previousIndex = (currentIndex + SCREEN_ORDER_COUNT - 1) % SCREEN_ORDER_COUNT;
+    // 留言板不在切换顺序中，从留言板返回时回到顺序中的第一个屏幕
+    ScreenState previousScreen = currentScreen == NOTE_SCREEN ? screenOrder[0] : screenOrder[previousIndex];
+    switchToScreen(previousScreen);
+    Serial.printf("返回上一个屏幕耗时: %lu us\n", lastSwitchLatency);
 }
 //*** 直接切换到指定屏幕
 void ScreenManager::switchToScreen(ScreenState screenState) {
+    unsigned long startMicros = micros();
     // 隐藏所有屏幕元素
     hideAllScreens();
     // 更新当前屏幕状态
     currentScreen = screenState;  
+    ScreenLifecycle::getInstance()->enterScreen(currentScreen);
     // 显示当前屏幕
     showCurrentScreen();
+    lastSwitchTime = millis();
+    lastSwitchLatency = micros() - startMicros;
 }
 //*** 刷新当前屏幕数据
 void ScreenManager::refreshCurrentScreenData() {
@@ -308,14 +490,14 @@ void ScreenManager::refreshCurrentScreenData() {
 //*** 显示新闻屏幕
 void ScreenManager::showNewsScreen() {
     Serial.println("切换到新闻屏幕：");
+    // 确保新闻内容已就绪（已预先准备时直接使用）
+    ensureScreenContent(NEWS_SCREEN);
     // 确保news_label被创建并显示
     extern lv_obj_t* news_label;
     if (news_label && lv_obj_is_valid(news_label)) {
         lv_obj_clear_flag(news_label, LV_OBJ_FLAG_HIDDEN);
         lv_obj_move_foreground(news_label);
     }
-    // 从文件加载并显示新闻数据
-    ::displayNewsDataFromFile();
     // 更新屏幕标题和符号
     if (screen_symbol_label && screen_title_btn && title_label) {
       // 更新标题文本
@@ -327,8 +509,11 @@ void ScreenManager::showNewsScreen() {
 //*** 显示主席语录屏幕
 void ScreenManager::showMaoSelectScreen() {
     Serial.println("切换到主席语录屏幕：");
-    // 显示随机的主席语录
-    showRandomMaoSelect();   
+    // 显示主席语录（已预先准备时直接使用）
+    extern lv_obj_t* maoselect_img;
+    extern lv_obj_t* mao_select_label;
+    ensureScreenContent(MAO_SELECT_SCREEN);
+    revealQuoteScreen(maoselect_img, mao_select_label);
     // 更新屏幕标题和符号
     if (screen_symbol_label && screen_title_btn && title_label) {
       // 更新标题文本
@@ -340,8 +525,11 @@ void ScreenManager::showMaoSelectScreen() {
 //*** 显示乌鸡汤屏幕
 void ScreenManager::showToxicSoulScreen() {
     Serial.println("切换到乌鸡汤屏幕：");
-    // 显示随机的乌鸡汤
-    showRandomToxicSoul();
+    // 显示乌鸡汤（已预先准备时直接使用）
+    extern lv_obj_t* toxic_soul_img;
+    extern lv_obj_t* toxic_soul_label;
+    ensureScreenContent(TOXIC_SOUL_SCREEN);
+    revealQuoteScreen(toxic_soul_img, toxic_soul_label);
     // 更新屏幕标题和符号
     if (screen_symbol_label && screen_title_btn && title_label) {
       // 更新标题文本
@@ -353,6 +541,8 @@ void ScreenManager::showToxicSoulScreen() {
 //*** 显示金山词霸每日信息屏幕
 void ScreenManager::showIcibaScreen() {
     Serial.println("切换到金山词霸每日信息屏幕");
+    // 确保金山词霸内容已就绪（已预先准备时直接使用）
+    ensureScreenContent(ICIBA_SCREEN);
     // 显示金山词霸标签和图片
     extern lv_obj_t* iciba_label;
     extern lv_obj_t* iciba_img;
@@ -367,14 +557,8 @@ void ScreenManager::showIcibaScreen() {
         // 确保图片在顶层显示以便调试
         lv_obj_move_foreground(iciba_img);
     } 
-    // 暂停一会儿让用户能看到图片
-    delay(1000);
-    // 再把文字移到顶层
-    if (iciba_label) {
-        lv_obj_move_foreground(iciba_label);
-    }
-    // 首先尝试从文件显示金山词霸数据
-    ::displayIcibaDataFromFile();
+    // 图片展示一会儿后再把文字移到顶层（由LVGL定时器推进，不阻塞显示任务）
+    TransitionManager::getInstance()->addStep(1000, bringIcibaLabelToFront);
     // 更新屏幕标题和符号
     if (screen_symbol_label && screen_title_btn && title_label) {
       // 更新标题文本
@@ -386,6 +570,8 @@ void ScreenManager::showIcibaScreen() {
 //*** 显示宇航员信息屏幕
 void ScreenManager::showAstronautsScreen() {
     Serial.println("切换到宇航员信息屏幕：");
+    // 确保宇航员内容已就绪（已预先准备时直接使用）
+    ensureScreenContent(ASTRONAUTS_SCREEN);
     // 确保astronauts_img被创建并显示在底部
     extern lv_obj_t* astronauts_img;
     if (astronauts_img && lv_obj_is_valid(astronauts_img)) {
@@ -398,8 +584,6 @@ void ScreenManager::showAstronautsScreen() {
         // 确保标签显示在最上层
         lv_obj_move_foreground(astronauts_label);
     }
-    // 从文件加载并显示宇航员数据
-    ::displayAstronautsDataFromFile();
     // 更新屏幕标题和符号
     if (screen_symbol_label && screen_title_btn && title_label) {
       // 更新标题文本
@@ -408,33 +592,35 @@ void ScreenManager::showAstronautsScreen() {
         lv_obj_set_style_bg_color(screen_title_btn, lv_color_hex(0x4B0082), 0); // 靛蓝色
     }
 }
+//*** 显示语录类屏幕的背景图像和标签
+void ScreenManager::revealQuoteScreen(lv_obj_t* img, lv_obj_t* label) {
+    if (img && lv_obj_is_valid(img)) {
+        // 显示背景图像
+        lv_obj_clear_flag(img, LV_OBJ_FLAG_HIDDEN);
+    }
+    if (label && lv_obj_is_valid(label)) {
+        // 确保标签可见
+        lv_obj_clear_flag(label, LV_OBJ_FLAG_HIDDEN);
+        // 确保标签显示在最上层
+        lv_obj_move_foreground(label);
+    }
+}
 //*** 显示随机的毛主席语录
 void ScreenManager::showRandomMaoSelect() {
-    // 确保maoselect_img被创建并显示在上方
     extern lv_obj_t* maoselect_img;
-    if (maoselect_img && lv_obj_is_valid(maoselect_img)) {
-        // 显示上方图像
-        lv_obj_clear_flag(maoselect_img, LV_OBJ_FLAG_HIDDEN);
-    }  
-    // 确保mao_select_label被创建并显示
-extern lv_obj_t* mao_select_label;
-if (mao_select_label && lv_obj_is_valid(mao_select_label)) {
+    extern lv_obj_t* mao_select_label;
     // 从数组中随机选择一条毛主席语录
-    int count = sizeof(MaoSelect) / sizeof(MaoSelect[0]);
-    int randomIndex = random(count);
-    // 设置语录文本
-    lv_label_set_text(mao_select_label, MaoSelect[randomIndex]);
-    // 确保标签可见
-    lv_obj_clear_flag(mao_select_label, LV_OBJ_FLAG_HIDDEN);
-    // 确保标签显示在最上层
-    lv_obj_move_foreground(mao_select_label);
-}
+    setRandomQuote(mao_select_label, MaoSelect, sizeof(MaoSelect) / sizeof(MaoSelect[0]));
+    revealQuoteScreen(maoselect_img, mao_select_label);
 }
 //*** 显示禅语哲言屏幕
 void ScreenManager::showSoulScreen() {
     Serial.println("切换到禅语哲言屏幕：");   
-    // 显示随机的禅语哲言
-    showRandomSoul();
+    // 显示禅语哲言（已预先准备时直接使用）
+    extern lv_obj_t* soul_img;
+    extern lv_obj_t* soul_label;
+    ensureScreenContent(SOUL_SCREEN);
+    revealQuoteScreen(soul_img, soul_label);
     // 更新屏幕标题和符号
     if (screen_symbol_label && screen_title_btn && title_label) {
       // 更新标题文本
@@ -443,53 +629,19 @@ void ScreenManager::showSoulScreen() {
     lv_obj_set_style_bg_color(screen_title_btn, lv_color_hex(0x808000), 0); // 橄榄绿
     }
 }
-
-/**
 //*** 显示随机的乌鸡汤
 void ScreenManager::showRandomToxicSoul() {
-    // 确保toxic_soul_img被创建并显示在底部
     extern lv_obj_t* toxic_soul_img;
-    if (toxic_soul_img && lv_obj_is_valid(toxic_soul_img)) {
-        // 显示底部图像
-        lv_obj_clear_flag(toxic_soul_img, LV_OBJ_FLAG_HIDDEN);
-    }  
-    // 确保toxic_soul_label被创建并显示
-extern lv_obj_t* toxic_soul_label;
-if (toxic_soul_label && lv_obj_is_valid(toxic_soul_label)) {
+    extern lv_obj_t* toxic_soul_label;
     // 从数组中随机选择一条乌鸡汤
-    int count = sizeof(ToxicSoul) / sizeof(ToxicSoul[0]);
-    int randomIndex = random(count);
-    // 设置乌鸡汤文本
-    lv_label_set_text(toxic_soul_label, ToxicSoul[randomIndex]);
-    // 确保标签可见
-    lv_obj_clear_flag(toxic_soul_label, LV_OBJ_FLAG_HIDDEN);
-    // 确保标签显示在最上层
-    lv_obj_move_foreground(toxic_soul_label);
-  }
+    setRandomQuote(toxic_soul_label, ToxicSoul, sizeof(ToxicSoul) / sizeof(ToxicSoul[0]));
+    revealQuoteScreen(toxic_soul_img, toxic_soul_label);
 }
 //*** 显示随机的禅语哲言
 void ScreenManager::showRandomSoul() {
-    // 确保soul_img被创建并显示在底部
     extern lv_obj_t* soul_img;
-    if (soul_img && lv_obj_is_valid(soul_img)) {
-        // 显示底部图像
-        lv_obj_clear_flag(soul_img, LV_OBJ_FLAG_HIDDEN);
-    }
-    
-    // 确保soul_label被创建并显示
-extern lv_obj_t* soul_label;
-if (soul_label && lv_obj_is_valid(soul_label)) {
+    extern lv_obj_t* soul_label;
     // 从数组中随机选择一条禅语哲言
-    int count = sizeof(Soul) / sizeof(Soul[0]);
-    int randomIndex = random(count);
-    
-    // 设置禅语哲言文本
-    lv_label_set_text(soul_label, Soul[randomIndex]);
-    
-    // 确保标签可见
-    lv_obj_clear_flag(soul_label, LV_OBJ_FLAG_HIDDEN);
-    
-    // 确保标签显示在最上层
-    lv_obj_move_foreground(soul_label);
-  }
+    setRandomQuote(soul_label, Soul, sizeof(Soul) / sizeof(Soul[0]));
+    revealQuoteScreen(soul_img, soul_label);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define SCREEN_MANAGER_H
 #include <lvgl.h>
 #include "config/config.h"
+#include "manager/job_scheduler.h"
 // 屏幕状态枚举已在config.h中定义
 /**
  * 屏幕管理器类：负责管理所有屏幕的切换和显示
@@ -14,6 +15,13 @@ private:
     lv_obj_t* screen_symbol_label;  // 屏幕主题符号标签
     lv_obj_t* screen_title_btn;     // 屏幕标题按钮
     lv_obj_t* title_label;          // 屏幕标题文本标签
+    // 预渲染相关状态
+    ScreenState preparedScreen;     // 已在后台准备好的下一个屏幕
+    bool nextScreenPrepared;        // 下一个屏幕内容是否已准备好
+    volatile bool preparedDirty;    // 数据文件已更新，预先准备的内容需要重新生成
+    Job* prepareJob;                // 正在分片准备下一个屏幕的作业（nullptr表示没有）
+    unsigned long lastSwitchTime;   // 上次换屏时间（毫秒）
+    unsigned long lastSwitchLatency; // 上次换屏耗时（微秒）
     // 私有构造函数（单例模式）
     ScreenManager();
     // 隐藏所有屏幕元素
@@ -30,6 +38,20 @@ private:
     
     // 显示当前屏幕
     void showCurrentScreen();
+    // 检查留言板是否有内容
+    bool hasNoteContent();
+    // 计算下一个要显示的屏幕
+    ScreenState computeNextScreen();
+    // 在隐藏状态下为指定屏幕填充内容（读取数据、构建文本、完成布局）
+    void prepareScreenContent(ScreenState screenState);
+    // 获取分片准备指定屏幕的作业，准备工作很快的屏幕返回nullptr
+    Job* getPrepareJob(ScreenState screenState);
+    // 确保指定屏幕的内容已就绪，已预先准备的直接使用
+    void ensureScreenContent(ScreenState screenState);
+    // 从语录数组中随机选择一条设置到标签（不改变可见性）
+    void setRandomQuote(lv_obj_t* label, const char** quotes, int count);
+    // 显示语录类屏幕的背景图像和标签
+    void revealQuoteScreen(lv_obj_t* img, lv_obj_t* label);
 public:
     // 获取单例实例
     static ScreenManager* getInstance();
@@ -37,12 +59,20 @@ public:
     void init();
     // 切换到下一个屏幕
     void toggleScreen();
+    // 按切换顺序返回上一个屏幕（触摸右滑）
+    void showPreviousScreen();
     // 直接切换到指定屏幕
     void switchToScreen(ScreenState screenState);
     // 获取当前屏幕状态
     inline ScreenState getCurrentScreen() { return currentScreen; }
     // 刷新当前屏幕数据
     void refreshCurrentScreenData();
+    // 利用换屏间隔的空闲时间预先准备下一个屏幕
+    void prepareNextScreen();
+    // 使已预先准备的屏幕内容失效（数据文件更新后调用，可跨任务调用）
+    void invalidatePreparedScreen();
+    // 获取上次换屏耗时（微秒）
+    inline unsigned long getLastSwitchLatency() { return lastSwitchLatency; }
     // 显示特定类型的信息
     void showRandomMaoSelect();
     void showRandomToxicSoul();
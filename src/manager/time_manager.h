@@ -80,6 +80,9 @@ public:
     
     // 强制更新所有时间显示
     void forceUpdateAll();
+    
+    // 获取上次秒显示更新时间（毫秒）
+    unsigned long getLastSecondUpdate() { return lastSecondUpdate; }
 };
 
 #endif // TIME_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include "touch_gesture.h"
+
+//*** 把原始读数换算为屏幕坐标
+bool touchMapToScreen(const TouchCalibration& cal, uint16_t rawX, uint16_t rawY,
+                      uint16_t width, uint16_t height, int16_t& x, int16_t& y) {
+    if (cal.xMax == cal.xMin || cal.yMax == cal.yMin) {
+        return false;
+    }
+    int32_t rx = cal.swapXY ? rawY : rawX;
+    int32_t ry = cal.swapXY ? rawX : rawY;
+    int32_t sx = (rx - cal.xMin) * (int32_t)(width - 1) / (cal.xMax - cal.xMin);
+    int32_t sy = (ry - cal.yMin) * (int32_t)(height - 1) / (cal.yMax - cal.yMin);
+    // 触摸屏边缘的读数可能超出校准范围
+    x = (int16_t)(sx < 0 ? 0 : (sx >= width ? width - 1 : sx));
+    y = (int16_t)(sy < 0 ? 0 : (sy >= height ? height - 1 : sy));
+    return true;
+}
+//*** 由两个校准点推算校准参数
+bool touchCalibrateFromPoints(int16_t x1, int16_t y1, uint16_t rawX1, uint16_t rawY1,
+                              int16_t x2, int16_t y2, uint16_t rawX2, uint16_t rawY2,
+                              uint16_t width, uint16_t height, bool swapXY, TouchCalibration& cal) {
+    if (x1 == x2 || y1 == y2) {
+        return false;
+    }
+    float rx1 = swapXY ? rawY1 : rawX1;
+    float ry1 = swapXY ? rawX1 : rawY1;
+    float rx2 = swapXY ? rawY2 : rawX2;
+    float ry2 = swapXY ? rawX2 : rawY2;
+    // 每像素对应的原始读数变化，两点读数几乎相同说明没有真正点到或XY方向设置错误
+    float scaleX = (rx2 - rx1) / (x2 - x1);
+    float scaleY = (ry2 - ry1) / (y2 - y1);
+    if (scaleX > -0.5f && scaleX < 0.5f) {
+        return false;
+    }
+    if (scaleY > -0.5f && scaleY < 0.5f) {
+        return false;
+    }
+    // 外推到屏幕边缘
+    cal.xMin = (int16_t)(rx1 - x1 * scaleX);
+    cal.xMax = (int16_t)(rx1 + (width - 1 - x1) * scaleX);
+    cal.yMin = (int16_t)(ry1 - y1 * scaleY);
+    cal.yMax = (int16_t)(ry1 + (height - 1 - y1) * scaleY);
+    cal.swapXY = swapXY;
+    return true;
+}
+//*** 对一组采样值取中值
+uint16_t touchMedian(uint16_t* values, int count) {
+    // 样本数很少，插入排序即可
+    for (int i = 1; i < count; i++) {
+        uint16_t value = values[i];
+        int j = i - 1;
+        while (j >= 0 && values[j] > value) {
+            values[j + 1] = values[j];
+            j--;
+        }
+        values[j + 1] = value;
+    }
+    return values[count / 2];
+}
+//*** 对新坐标滤波
+void TouchFilter::apply(int16_t& x, int16_t& y) {
+    if (!hasLast) {
+        // 按下的第一个点直接使用，避免从上次抬起的位置拖过来
+        hasLast = true;
+        lastX = x;
+        lastY = y;
+        return;
+    }
+    int16_t dx = x - lastX;
+    int16_t dy = y - lastY;
+    if (dx >= -TOUCH_JITTER_PIXELS && dx <= TOUCH_JITTER_PIXELS &&
+        dy >= -TOUCH_JITTER_PIXELS && dy <= TOUCH_JITTER_PIXELS) {
+        x = lastX;
+        y = lastY;
+        return;
+    }
+    // 一阶平滑：新旧坐标各占一半，快速滑动时滞后不超过一次读取
+    lastX = (int16_t)((lastX + x) / 2);
+    lastY = (int16_t)((lastY + y) / 2);
+    x = lastX;
+    y = lastY;
+}
+//*** 输入一次读取结果，识别滑动
+SwipeDirection SwipeDetector::feed(bool pressed, int16_t x, int16_t y, uint32_t nowMs) {
+    if (!pressed) {
+        tracking = false;
+        reported = false;
+        return SWIPE_NONE;
+    }
+    if (!tracking) {
+        tracking = true;
+        reported = false;
+        startX = x;
+        startY = y;
+        startTime = nowMs;
+        return SWIPE_NONE;
+    }
+    if (reported || nowMs - startTime > SWIPE_MAX_DURATION) {
+        return SWIPE_NONE;
+    }
+    int16_t dx = x - startX;
+    int16_t dy = y - startY;
+    int16_t adx = dx < 0 ? -dx : dx;
+    int16_t ady = dy < 0 ? -dy : dy;
+    // 主方向的位移须达到阈值且明显大于另一方向，斜向滑动不触发
+    if (adx >= SWIPE_MIN_DISTANCE && adx >= ady * 2) {
+        reported = true;
+        return dx < 0 ? SWIPE_LEFT : SWIPE_RIGHT;
+    }
+    if (ady >= SWIPE_MIN_DISTANCE && ady >= adx * 2) {
+        reported = true;
+        return dy < 0 ? SWIPE_UP : SWIPE_DOWN;
+    }
+    return SWIPE_NONE;
+}
+//*** 读取一次触摸状态
+TouchReading TouchTracker::read(TouchSource& source, const TouchCalibration& cal, uint16_t width, uint16_t height,
+                                uint32_t nowMs) {
+    TouchReading reading;
+    reading.sampled = false;
+    bool down = false;
+    int16_t x = lastX;
+    int16_t y = lastY;
+    // 没有中断也没有按下时不读取触摸源，直接报告抬起
+    if (source.hasActivity()) {
+        reading.sampled = true;
+        uint16_t rawX, rawY, rawZ;
+        down = source.readRaw(rawX, rawY, rawZ) && touchMapToScreen(cal, rawX, rawY, width, height, x, y);
+    }
+    if (down) {
+        filter.apply(x, y);
+        lastX = x;
+        lastY = y;
+    } else {
+        filter.reset();
+    }
+    pressed = down;
+    reading.pressed = down;
+    reading.x = lastX;
+    reading.y = lastY;
+    reading.swipe = detector.feed(down, lastX, lastY, nowMs);
+    return reading;
+}
+//*** 重置为抬起状态
+void TouchTracker::reset() {
+    filter.reset();
+    detector.feed(false, 0, 0, 0);
+    pressed = false;
+}
+//*** 脚本是否处于活动状态
+bool MockTouchSource::hasActivity() {
+    return !finished();
+}
+//*** 按脚本时间读取坐标
+bool MockTouchSource::readRaw(uint16_t& x, uint16_t& y, uint16_t& z) {
+    // 找到当前时间所在的步骤
+    int index = -1;
+    for (int i = 0; i < stepCount && steps[i].atMs <= now; i++) {
+        index = i;
+    }
+    if (index < 0 || !steps[index].down) {
+        z = 0;
+        return false;
+    }
+    const TouchScriptStep& step = steps[index];
+    x = step.x;
+    y = step.y;
+    // 下一步仍为按下时按时间插值，模拟连续滑动
+    if (index + 1 < stepCount && steps[index + 1].down && steps[index + 1].atMs > step.atMs) {
+        const TouchScriptStep& next = steps[index + 1];
+        int32_t span = next.atMs - step.atMs;
+        int32_t elapsed = now - step.atMs;
+        x = (uint16_t)(step.x + ((int32_t)next.x - step.x) * elapsed / span);
+        y = (uint16_t)(step.y + ((int32_t)next.y - step.y) * elapsed / span);
+    }
+    z = pressure;
+    return true;
+}
@@ -0,0 +1,173 @@
+#ifndef TOUCH_GESTURE_H
+#define TOUCH_GESTURE_H
+
+// 本文件只依赖标准C++，触摸的滤波、校准换算和手势识别可以在PC上用脚本化的触摸源单独编译测试
+#include <stdint.h>
+
+// 每次读取坐标时连续采样的次数（取中值）
+const int TOUCH_SAMPLE_COUNT = 5;
+// 连续两次读取的坐标变化小于该值（像素）时视为抖动，保持原坐标
+const int16_t TOUCH_JITTER_PIXELS = 2;
+// 滑动手势的最小距离（像素）
+const int16_t SWIPE_MIN_DISTANCE = 60;
+// 滑动手势从按下到达到最小距离的最长时间（毫秒），超过视为拖动而不是滑动
+const uint32_t SWIPE_MAX_DURATION = 700;
+
+// 触摸校准：原始读数（交换XY后）对应屏幕左右、上下边缘的值
+// min大于max表示该方向反向，换算公式相同，因此不需要单独的反向标志
+struct TouchCalibration {
+    int16_t xMin;   // 屏幕x=0处的原始读数
+    int16_t xMax;   // 屏幕x=宽度-1处的原始读数
+    int16_t yMin;   // 屏幕y=0处的原始读数
+    int16_t yMax;   // 屏幕y=高度-1处的原始读数
+    bool swapXY;    // 触摸屏与显示屏的XY方向是否交换
+};
+
+// 把原始读数换算为屏幕坐标（限制在屏幕范围内），校准无效时返回false
+bool touchMapToScreen(const TouchCalibration& cal, uint16_t rawX, uint16_t rawY,
+                      uint16_t width, uint16_t height, int16_t& x, int16_t& y);
+
+// 由两个校准点（屏幕坐标和对应的原始读数）推算校准参数，两点过近时返回false
+bool touchCalibrateFromPoints(int16_t x1, int16_t y1, uint16_t rawX1, uint16_t rawY1,
+                              int16_t x2, int16_t y2, uint16_t rawX2, uint16_t rawY2,
+                              uint16_t width, uint16_t height, bool swapXY, TouchCalibration& cal);
+
+// 对一组采样值取中值（会改变数组顺序）
+uint16_t touchMedian(uint16_t* values, int count);
+
+/**
+ * 触摸坐标滤波器
+ * 对连续读取的坐标做一阶平滑并抑制小幅抖动，抬起后重置
+ */
+class TouchFilter {
+private:
+    bool hasLast;     // 是否已有上一次的坐标
+    int16_t lastX;    // 上一次输出的坐标
+    int16_t lastY;
+
+public:
+    TouchFilter() { reset(); }
+
+    // 抬起时重置
+    void reset() { hasLast = false; lastX = 0; lastY = 0; }
+
+    // 对新坐标滤波（原地修改）
+    void apply(int16_t& x, int16_t& y);
+};
+
+// 滑动方向
+enum SwipeDirection {
+    SWIPE_NONE = 0,
+    SWIPE_LEFT,
+    SWIPE_RIGHT,
+    SWIPE_UP,
+    SWIPE_DOWN
+};
+
+/**
+ * 滑动手势识别器
+ * 按下时记录起点，移动距离达到阈值时立即报告方向（不等抬起，降低换屏延迟），每次按下最多报告一次
+ */
+class SwipeDetector {
+private:
+    bool tracking;       // 正在跟踪一次按下
+    bool reported;       // 本次按下已报告过手势
+    int16_t startX;      // 按下的起点
+    int16_t startY;
+    uint32_t startTime;  // 按下的时间（毫秒）
+
+public:
+    SwipeDetector() : tracking(false), reported(false), startX(0), startY(0), startTime(0) {}
+
+    // 输入一次读取结果，识别到滑动时返回方向
+    SwipeDirection feed(bool pressed, int16_t x, int16_t y, uint32_t nowMs);
+
+    // 本次按下开始的时间（毫秒），未按下时为0
+    uint32_t getStartTime() const { return tracking ? startTime : 0; }
+};
+
+/**
+ * 触摸源接口
+ * 硬件驱动（XPT2046）和脚本化的模拟触摸源都实现该接口
+ */
+class TouchSource {
+public:
+    virtual ~TouchSource() {}
+
+    // 是否有需要采样的触摸活动（中断已触发或仍在按下），没有活动时不进行采样
+    virtual bool hasActivity() = 0;
+
+    // 读取一次原始坐标和压力，未按下时返回false
+    virtual bool readRaw(uint16_t& x, uint16_t& y, uint16_t& z) = 0;
+};
+
+// 一次读取的结果
+struct TouchReading {
+    bool sampled;            // 是否实际读取了触摸源（没有触摸活动时不读取）
+    bool pressed;            // 是否按下
+    int16_t x;               // 滤波后的屏幕坐标（抬起时为最后一次按下的坐标）
+    int16_t y;
+    SwipeDirection swipe;    // 本次读取识别到的滑动手势
+};
+
+/**
+ * 触摸跟踪器
+ * 把触摸源的读取、校准换算、滤波和手势识别串成一次读取：没有触摸活动时不读取触摸源，直接报告抬起。
+ * LVGL读取回调和PC上的测试使用同一流程
+ */
+class TouchTracker {
+private:
+    TouchFilter filter;      // 坐标滤波器
+    SwipeDetector detector;  // 滑动手势识别器
+    bool pressed;            // 上一次读取是否按下
+    int16_t lastX;           // 上一次按下的坐标
+    int16_t lastY;
+
+public:
+    TouchTracker() : pressed(false), lastX(0), lastY(0) {}
+
+    // 读取一次触摸状态
+    TouchReading read(TouchSource& source, const TouchCalibration& cal, uint16_t width, uint16_t height,
+                      uint32_t nowMs);
+
+    // 重置为抬起状态（校准等直接读取触摸源之后）
+    void reset();
+
+    // 本次按下开始的时间（毫秒），未按下时为0
+    uint32_t getPressStart() const { return detector.getStartTime(); }
+};
+
+// 模拟触摸脚本的一步：从atMs开始处于该状态，相邻两个按下的步骤之间按时间线性插值
+struct TouchScriptStep {
+    uint32_t atMs;   // 相对脚本开始的时间（毫秒）
+    uint16_t x;      // 原始读数
+    uint16_t y;
+    bool down;       // 是否按下
+};
+
+/**
+ * 脚本化的模拟触摸源
+ * 按预先写好的步骤回放触摸，时间由调用方设置，便于在PC上确定性地测试滤波和手势识别
+ */
+class MockTouchSource : public TouchSource {
+private:
+    const TouchScriptStep* steps;  // 脚本步骤（按时间递增）
+    int stepCount;                 // 步骤数
+    uint32_t now;                  // 当前脚本时间（毫秒）
+    uint16_t pressure;             // 按下时报告的压力
+
+public:
+    MockTouchSource(const TouchScriptStep* scriptSteps, int count, uint16_t z = 1000)
+        : steps(scriptSteps), stepCount(count), now(0), pressure(z) {}
+
+    // 设置当前脚本时间
+    void setTime(uint32_t ms) { now = ms; }
+
+    // 脚本是否已全部回放完毕
+    bool finished() const { return stepCount == 0 || now >= steps[stepCount - 1].atMs; }
+
+    bool hasActivity() override;
+    bool readRaw(uint16_t& x, uint16_t& y, uint16_t& z) override;
+};
+
+#endif // TOUCH_GESTURE_H
@@ -0,0 +1,280 @@
+#include "touch_manager.h"
+#include <SPI.h>
+#include <ArduinoJson.h>
+#include "config/config.h"
+
+// 定义单例实例
+TouchManager* TouchManager::instance = nullptr;
+
+// 手势名称（统计和日志中使用）
+static const char* swipeNames[] = {"none", "left", "right", "up", "down"};
+
+/**
+ * XPT2046触摸控制器
+ * 屏幕使用8位并口，TFT_eSPI在并口模式下不提供触摸功能，因此直接通过独立的SPI总线读取。
+ * PENIRQ的下降沿中断只设置标志，读取回调据此决定是否采样
+ */
+class Xpt2046Source : public TouchSource {
+private:
+    SPIClass spi;                  // 触摸专用SPI总线
+    SPISettings settings;          // SPI参数
+    uint16_t threshold;            // 压力阈值
+    static volatile bool irqFlag;  // 中断已触发
+
+    // PENIRQ中断服务程序
+    static void IRAM_ATTR penIsr() { irqFlag = true; }
+
+public:
+    Xpt2046Source(uint16_t pressureThreshold)
+        : spi(HSPI), settings(TOUCH_SPI_FREQUENCY, MSBFIRST, SPI_MODE0), threshold(pressureThreshold) {}
+
+    // 初始化SPI和中断
+    void begin() {
+        pinMode(TOUCH_CS_PIN, OUTPUT);
+        digitalWrite(TOUCH_CS_PIN, HIGH);
+        // GPIO34只能输入且没有内部上拉，PENIRQ的上拉电阻在触摸模块上
+        pinMode(TOUCH_IRQ_PIN, INPUT);
+        spi.begin(TOUCH_SCLK_PIN, TOUCH_MISO_PIN, TOUCH_MOSI_PIN, TOUCH_CS_PIN);
+        attachInterrupt(digitalPinToInterrupt(TOUCH_IRQ_PIN), penIsr, FALLING);
+    }
+
+    bool hasActivity() override {
+        // 仍在按下时PENIRQ保持低电平，读取引脚电平不需要访问SPI
+        return irqFlag || digitalRead(TOUCH_IRQ_PIN) == LOW;
+    }
+
+    bool readRaw(uint16_t& x, uint16_t& y, uint16_t& z) override {
+        irqFlag = false;
+        uint16_t xs[TOUCH_SAMPLE_COUNT];
+        uint16_t ys[TOUCH_SAMPLE_COUNT];
+        spi.beginTransaction(settings);
+        digitalWrite(TOUCH_CS_PIN, LOW);
+        // 每次传输读取上一次转换的结果并开始下一次转换；采样期间PD=01，关闭PENIRQ
+        spi.transfer(0xB1);                          // 开始Z1
+        uint16_t z1 = spi.transfer16(0xC1) >> 3;     // 读取Z1，开始Z2
+        uint16_t z2 = spi.transfer16(0xD1) >> 3;     // 读取Z2，开始X
+        z = z1 + 4095 - z2;
+        bool down = z >= threshold;
+        if (down) {
+            // 第一次X转换受Z测量影响不稳定，丢弃
+            spi.transfer16(0xD1);
+            for (int i = 0; i < TOUCH_SAMPLE_COUNT; i++) {
+                xs[i] = spi.transfer16(0x91) >> 3;   // 读取X，开始Y
+                ys[i] = spi.transfer16(0xD1) >> 3;   // 读取Y，开始X
+            }
+        }
+        // 最后一次转换使用PD=00，结束后重新打开PENIRQ
+        spi.transfer16(0xD0);
+        spi.transfer16(0);
+        digitalWrite(TOUCH_CS_PIN, HIGH);
+        spi.endTransaction();
+        if (!down) {
+            return false;
+        }
+        x = touchMedian(xs, TOUCH_SAMPLE_COUNT);
+        y = touchMedian(ys, TOUCH_SAMPLE_COUNT);
+        return true;
+    }
+};
+
+volatile bool Xpt2046Source::irqFlag = false;
+
+//*** 私有构造函数
+TouchManager::TouchManager() {
+    memset(&config, 0, sizeof(config));
+    source = nullptr;
+    indev = nullptr;
+    pendingSwipe = SWIPE_NONE;
+    swipeDetectedAt = 0;
+    calibrationRequested = false;
+    readCount = 0;
+    sampleCount = 0;
+    sampleMicros = 0;
+    swipeCount = 0;
+    dispatchMicros = 0;
+    gestureMillis = 0;
+}
+//*** 获取单例实例
+TouchManager* TouchManager::getInstance() {
+    if (instance == nullptr) {
+        instance = new TouchManager();
+    }
+    return instance;
+}
+//*** 读取配置并注册LVGL输入设备
+void TouchManager::init() {
+    ConfigManager::getInstance()->getTouchConfig(config);
+    if (!config.enabled) {
+        Serial.println("触摸屏已禁用");
+        return;
+    }
+    if (source == nullptr) {
+        Xpt2046Source* xpt = new Xpt2046Source(config.pressureThreshold);
+        xpt->begin();
+        source = xpt;
+    }
+    lv_indev_drv_init(&indevDrv);
+    indevDrv.type = LV_INDEV_TYPE_POINTER;
+    indevDrv.read_cb = readCallback;
+    indev = lv_indev_drv_register(&indevDrv);
+    Serial.printf("触摸屏已启用，校准 X %d-%d Y %d-%d%s，压力阈值 %u\n",
+                  config.calibration.xMin, config.calibration.xMax,
+                  config.calibration.yMin, config.calibration.yMax,
+                  config.calibration.swapXY ? "（XY交换）" : "", config.pressureThreshold);
+}
+//*** LVGL读取回调
+void TouchManager::readCallback(lv_indev_drv_t* drv, lv_indev_data_t* data) {
+    getInstance()->read(data);
+}
+//*** 读取一次触摸状态
+void TouchManager::read(lv_indev_data_t* data) {
+    readCount++;
+    unsigned long startTime = micros();
+    // 没有中断也没有按下时跟踪器直接报告抬起，不访问SPI
+    TouchReading reading = tracker.read(*source, config.calibration, screenWidth, screenHeight, millis());
+    if (reading.sampled) {
+        sampleMicros += micros() - startTime;
+        sampleCount++;
+    }
+    data->state = reading.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    data->point.x = reading.x;
+    data->point.y = reading.y;
+    SwipeDirection swipe = reading.swipe;
+    if (swipe != SWIPE_NONE && pendingSwipe == SWIPE_NONE) {
+        gestureMillis += millis() - tracker.getPressStart();
+        pendingSwipe = swipe;
+        swipeDetectedAt = micros();
+        swipeCount++;
+    }
+}
+//*** 在显示任务中处理中断和手势
+SwipeDirection TouchManager::update() {
+    if (indev == nullptr) {
+        calibrationRequested = false;
+        return SWIPE_NONE;
+    }
+    if (calibrationRequested) {
+        calibrationRequested = false;
+        runCalibration();
+        return SWIPE_NONE;
+    }
+    // 有触摸活动时不等读取周期（30ms），让本次lv_task_handler立即读取
+    if (source->hasActivity() && indevDrv.read_timer != nullptr) {
+        lv_timer_ready(indevDrv.read_timer);
+    }
+    SwipeDirection swipe = pendingSwipe;
+    if (swipe != SWIPE_NONE) {
+        pendingSwipe = SWIPE_NONE;
+        dispatchMicros += micros() - swipeDetectedAt;
+        Serial.printf("触摸手势: %s\n", swipeNames[swipe]);
+    }
+    return swipe;
+}
+//*** 等待点击一个十字
+bool TouchManager::waitCalibrationPoint(lv_obj_t* cross, int16_t x, int16_t y, uint16_t& rawX, uint16_t& rawY) {
+    lv_obj_set_pos(cross, x - lv_obj_get_width(cross) / 2, y - lv_obj_get_height(cross) / 2);
+    lv_refr_now(NULL);
+    uint16_t xs[32];
+    uint16_t ys[32];
+    int count = 0;
+    unsigned long startTime = millis();
+    while (millis() - startTime < TOUCH_CALIBRATION_TIMEOUT) {
+        uint16_t sampleX, sampleY, sampleZ;
+        bool down = source->hasActivity() && source->readRaw(sampleX, sampleY, sampleZ);
+        if (down) {
+            if (count < 32) {
+                xs[count] = sampleX;
+                ys[count] = sampleY;
+                count++;
+            }
+        } else if (count >= 3) {
+            // 按下足够长时间后抬起，本点完成
+            rawX = touchMedian(xs, count);
+            rawY = touchMedian(ys, count);
+            return true;
+        } else {
+            // 过短的按下视为噪声
+            count = 0;
+        }
+        delay(10);
+    }
+    return false;
+}
+//*** 运行两点校准
+void TouchManager::runCalibration() {
+    Serial.println("开始触摸校准");
+    lv_obj_t* hint = lv_label_create(lv_layer_top());
+    lv_obj_set_style_text_font(hint, GBFont, 0);
+    lv_obj_set_style_text_color(hint, lv_color_hex(0xFFFFFF), 0);
+    lv_obj_set_style_bg_color(hint, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_opa(hint, LV_OPA_COVER, 0);
+    lv_label_set_text(hint, "触摸校准：请依次点击红色十字中心");
+    lv_obj_align(hint, LV_ALIGN_CENTER, 0, 0);
+    // 十字由两条细矩形组成
+    lv_obj_t* cross = lv_obj_create(lv_layer_top());
+    lv_obj_remove_style_all(cross);
+    lv_obj_set_size(cross, 31, 31);
+    lv_obj_t* bar = lv_obj_create(cross);
+    lv_obj_remove_style_all(bar);
+    lv_obj_set_style_bg_color(bar, lv_color_hex(0xFF0000), 0);
+    lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, 0);
+    lv_obj_set_size(bar, 31, 3);
+    lv_obj_center(bar);
+    bar = lv_obj_create(cross);
+    lv_obj_remove_style_all(bar);
+    lv_obj_set_style_bg_color(bar, lv_color_hex(0xFF0000), 0);
+    lv_obj_set_style_bg_opa(bar, LV_OPA_COVER, 0);
+    lv_obj_set_size(bar, 3, 31);
+    lv_obj_center(bar);
+
+    int16_t x1 = TOUCH_CALIBRATION_INSET;
+    int16_t y1 = TOUCH_CALIBRATION_INSET;
+    int16_t x2 = screenWidth - 1 - TOUCH_CALIBRATION_INSET;
+    int16_t y2 = screenHeight - 1 - TOUCH_CALIBRATION_INSET;
+    uint16_t rawX1, rawY1, rawX2, rawY2;
+    TouchCalibration calibration;
+    bool ok = waitCalibrationPoint(cross, x1, y1, rawX1, rawY1) &&
+              waitCalibrationPoint(cross, x2, y2, rawX2, rawY2) &&
+              touchCalibrateFromPoints(x1, y1, rawX1, rawY1, x2, y2, rawX2, rawY2,
+                                       screenWidth, screenHeight, config.calibration.swapXY, calibration);
+    if (ok) {
+        config.calibration = calibration;
+        ConfigManager::getInstance()->setTouchCalibration(calibration);
+        Serial.printf("触摸校准完成: X %d-%d Y %d-%d\n", calibration.xMin, calibration.xMax,
+                      calibration.yMin, calibration.yMax);
+        lv_label_set_text(hint, "触摸校准完成");
+    } else {
+        Serial.println("触摸校准失败或超时，保留原校准参数");
+        lv_label_set_text(hint, "触摸校准失败");
+    }
+    lv_obj_add_flag(cross, LV_OBJ_FLAG_HIDDEN);
+    lv_refr_now(NULL);
+    delay(1500);
+    lv_obj_del(cross);
+    lv_obj_del(hint);
+    // 校准期间的触摸不交给LVGL和手势识别
+    tracker.reset();
+    pendingSwipe = SWIPE_NONE;
+}
+//*** 生成统计JSON
+String TouchManager::getStatsJson() {
+    JsonDocument doc;
+    doc["enabled"] = indev != nullptr;
+    doc["reads"] = readCount;
+    doc["samples"] = sampleCount;
+    // 空闲时读取回调不访问SPI的比例
+    doc["idle_skip_pct"] = readCount > 0 ? (readCount - sampleCount) * 100.0f / readCount : 0;
+    doc["avg_sample_us"] = sampleCount > 0 ? sampleMicros / sampleCount : 0;
+    doc["swipes"] = swipeCount;
+    doc["avg_gesture_ms"] = swipeCount > 0 ? gestureMillis / swipeCount : 0;
+    doc["avg_dispatch_us"] = swipeCount > 0 ? dispatchMicros / swipeCount : 0;
+    JsonObject cal = doc["calibration"].to<JsonObject>();
+    cal["x_min"] = config.calibration.xMin;
+    cal["x_max"] = config.calibration.xMax;
+    cal["y_min"] = config.calibration.yMin;
+    cal["y_max"] = config.calibration.yMax;
+    cal["swap_xy"] = config.calibration.swapXY;
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
@@ -0,0 +1,76 @@
+#ifndef TOUCH_MANAGER_H
+#define TOUCH_MANAGER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "config/config_manager.h"
+#include "manager/touch_gesture.h"
+
+// 触摸SPI时钟频率（XPT2046最高2.5MHz）
+const uint32_t TOUCH_SPI_FREQUENCY = 2500000;
+// 校准时十字中心距屏幕边缘的距离（像素）
+const int16_t TOUCH_CALIBRATION_INSET = 30;
+// 校准时等待点击每个十字的最长时间（毫秒）
+const unsigned long TOUCH_CALIBRATION_TIMEOUT = 15000;
+
+/**
+ * 触摸屏管理器类
+ * 把XPT2046触摸控制器注册为LVGL指针输入设备：只有PENIRQ中断到来或仍在按下时才通过SPI采样，
+ * 空闲时读取回调不访问SPI；采样结果经过中值滤波、压力判断、校准换算和平滑后交给LVGL，
+ * 同时识别左右滑动手势，由显示任务转换为换屏操作
+ */
+class TouchManager {
+private:
+    static TouchManager* instance; // 单例实例
+
+    TouchConfig config;            // 启用状态、压力阈值和校准参数
+    TouchSource* source;           // 触摸源（默认为XPT2046，可替换为模拟触摸源）
+    lv_indev_drv_t indevDrv;       // LVGL输入设备驱动
+    lv_indev_t* indev;             // 已注册的输入设备
+    TouchTracker tracker;          // 校准换算、滤波和手势识别
+    SwipeDirection pendingSwipe;   // 已识别、等待显示任务处理的手势
+    uint32_t swipeDetectedAt;      // 识别到手势的时间（微秒）
+    volatile bool calibrationRequested; // 已请求校准
+
+    // 统计
+    uint32_t readCount;            // LVGL读取回调的调用次数
+    uint32_t sampleCount;          // 实际通过SPI采样的次数
+    uint32_t sampleMicros;         // 采样累计耗时（微秒）
+    uint32_t swipeCount;           // 识别到的手势数
+    uint32_t dispatchMicros;       // 手势从识别到交给显示任务的累计耗时（微秒）
+    uint32_t gestureMillis;        // 手势从按下到识别的累计耗时（毫秒）
+
+    // 私有构造函数（单例模式）
+    TouchManager();
+
+    // LVGL读取回调
+    static void readCallback(lv_indev_drv_t* drv, lv_indev_data_t* data);
+    void read(lv_indev_data_t* data);
+
+    // 校准时等待点击一个十字并返回按下期间的原始读数中值
+    bool waitCalibrationPoint(lv_obj_t* cross, int16_t x, int16_t y, uint16_t& rawX, uint16_t& rawY);
+
+    // 运行两点校准
+    void runCalibration();
+
+public:
+    // 获取单例实例
+    static TouchManager* getInstance();
+
+    // 替换触摸源（须在init之前调用，用于模拟触摸）
+    void setSource(TouchSource* touchSource) { source = touchSource; }
+
+    // 读取配置并注册LVGL输入设备（在ConfigManager初始化之后调用）
+    void init();
+
+    // 在显示任务中调用：中断到来时让LVGL立即读取，执行已请求的校准，返回待处理的滑动手势
+    SwipeDirection update();
+
+    // 请求校准（可在Web任务中调用）
+    void requestCalibration() { calibrationRequested = true; }
+
+    // 生成统计JSON
+    String getStatsJson();
+};
+
+#endif // TOUCH_MANAGER_H
@@ -0,0 +1,104 @@
+#include "mirror_codec.h"
+#include <string.h>
+
+//*** 按小端序读写
+static void putLe16(uint8_t* p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+static void putLe32(uint8_t* p, uint32_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = v >> 24;
+}
+static uint16_t getLe16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+static uint32_t getLe32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+//*** 编码一个矩形
+size_t mirrorEncodeRect(uint8_t* out, size_t capacity, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                        const uint16_t* pixels) {
+    size_t pixelCount = (size_t)w * h;
+    size_t rawBytes = pixelCount * 2;
+    if (pixelCount == 0 || capacity < MIRROR_RECT_HEADER_SIZE + rawBytes) {
+        return 0;
+    }
+    putLe16(out, x);
+    putLe16(out + 2, y);
+    putLe16(out + 4, w);
+    putLe16(out + 6, h);
+    out[9] = 0;
+
+    // 先尝试RLE，一旦超过原始像素的长度就放弃
+    uint8_t* data = out + MIRROR_RECT_HEADER_SIZE;
+    size_t length = 0;
+    size_t i = 0;
+    while (i < pixelCount && length + 3 <= rawBytes) {
+        uint16_t color = pixels[i];
+        uint8_t run = 1;
+        while (i + run < pixelCount && run < 255 && pixels[i + run] == color) {
+            run++;
+        }
+        data[length] = run;
+        putLe16(data + length + 1, color);
+        length += 3;
+        i += run;
+    }
+    if (i < pixelCount || length > rawBytes) {
+        // 直接保存原始像素
+        out[8] = MIRROR_ENCODING_RAW;
+        for (size_t k = 0; k < pixelCount; k++) {
+            putLe16(data + k * 2, pixels[k]);
+        }
+        length = rawBytes;
+    } else {
+        out[8] = MIRROR_ENCODING_RLE;
+    }
+    putLe32(out + 10, (uint32_t)length);
+    return MIRROR_RECT_HEADER_SIZE + length;
+}
+
+//*** 解码一个矩形到整帧缓冲区
+size_t mirrorDecodeRect(const uint8_t* in, size_t length, uint16_t* frame, uint16_t frameWidth, uint16_t frameHeight) {
+    if (length < MIRROR_RECT_HEADER_SIZE) {
+        return 0;
+    }
+    uint16_t x = getLe16(in);
+    uint16_t y = getLe16(in + 2);
+    uint16_t w = getLe16(in + 4);
+    uint16_t h = getLe16(in + 6);
+    uint8_t encoding = in[8];
+    uint32_t dataLength = getLe32(in + 10);
+    if (dataLength > length - MIRROR_RECT_HEADER_SIZE || (uint32_t)x + w > frameWidth || (uint32_t)y + h > frameHeight) {
+        return 0;
+    }
+    const uint8_t* data = in + MIRROR_RECT_HEADER_SIZE;
+    size_t pixelCount = (size_t)w * h;
+    size_t pixel = 0;
+    if (encoding == MIRROR_ENCODING_RAW) {
+        if (dataLength != pixelCount * 2) {
+            return 0;
+        }
+        for (; pixel < pixelCount; pixel++) {
+            frame[(size_t)(y + pixel / w) * frameWidth + x + pixel % w] = getLe16(data + pixel * 2);
+        }
+    } else if (encoding == MIRROR_ENCODING_RLE) {
+        for (size_t pos = 0; pos + 3 <= dataLength; pos += 3) {
+            uint8_t run = data[pos];
+            uint16_t color = getLe16(data + pos + 1);
+            for (uint8_t k = 0; k < run && pixel < pixelCount; k++, pixel++) {
+                frame[(size_t)(y + pixel / w) * frameWidth + x + pixel % w] = color;
+            }
+        }
+        if (pixel != pixelCount) {
+            return 0;
+        }
+    } else {
+        return 0;
+    }
+    return MIRROR_RECT_HEADER_SIZE + dataLength;
+}
@@ -0,0 +1,38 @@
+#ifndef MIRROR_CODEC_H
+#define MIRROR_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * 屏幕镜像的矩形编码
+ * 只依赖标准C头文件，可以在PC上单独编译，用于验证编码与解码结果一致。
+ *
+ * 每个矩形记录由14字节的头和像素数据组成（均为小端序）：
+ *   x(2) y(2) w(2) h(2) 编码方式(1) 保留(1) 数据长度(4)
+ * 编码方式为RLE时，数据为若干个 [重复次数(1)][RGB565颜色(2)]；
+ * RLE结果比原始像素更长时（如照片类图像），改为直接保存RGB565像素
+ */
+
+// 矩形记录头长度
+const size_t MIRROR_RECT_HEADER_SIZE = 14;
+
+// 编码方式
+enum MirrorEncoding {
+    MIRROR_ENCODING_RAW = 0,
+    MIRROR_ENCODING_RLE = 1
+};
+
+// 编码一个矩形所需的最大字节数
+inline size_t mirrorRectWorstCase(uint16_t w, uint16_t h) {
+    return MIRROR_RECT_HEADER_SIZE + (size_t)w * h * 2;
+}
+
+// 编码一个矩形（像素按行连续存放），返回写入的字节数，空间不足时返回0
+size_t mirrorEncodeRect(uint8_t* out, size_t capacity, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                        const uint16_t* pixels);
+
+// 把一个矩形记录解码到整帧缓冲区，返回该记录占用的字节数，数据无效时返回0
+size_t mirrorDecodeRect(const uint8_t* in, size_t length, uint16_t* frame, uint16_t frameWidth, uint16_t frameHeight);
+
+#endif // MIRROR_CODEC_H
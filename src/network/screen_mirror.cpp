@@ -0,0 +1,179 @@
+#include "screen_mirror.h"
+#include "mirror_codec.h"
+#include <ArduinoJson.h>
+#include <esp_heap_caps.h>
+
+// 定义单例实例
+ScreenMirror* ScreenMirror::instance = nullptr;
+
+//*** 私有构造函数
+ScreenMirror::ScreenMirror() {
+    socket = nullptr;
+    clientCount = 0;
+    buffers[0] = nullptr;
+    buffers[1] = nullptr;
+    fillIndex = 0;
+    fillLength = 0;
+    sendIndex = 1;
+    sendLength = 0;
+    sendPending = false;
+    resyncRequested = false;
+    resyncRow = -1;
+    lastSwap = 0;
+    batches = 0;
+    sentBytes = 0;
+    pixelBytes = 0;
+    droppedRects = 0;
+    encodeMicros = 0;
+}
+//*** 获取单例实例
+ScreenMirror* ScreenMirror::getInstance() {
+    if (instance == nullptr) {
+        instance = new ScreenMirror();
+    }
+    return instance;
+}
+//*** 启动WebSocket服务器
+void ScreenMirror::begin() {
+    if (socket != nullptr) {
+        return;
+    }
+    socket = new WebSocketsServer(MIRROR_PORT);
+    socket->onEvent(socketEvent);
+    socket->begin();
+    Serial.printf("屏幕镜像WebSocket已启动，端口 %u\n", MIRROR_PORT);
+}
+//*** 停止WebSocket服务器
+void ScreenMirror::end() {
+    if (socket == nullptr) {
+        return;
+    }
+    // 先让刷新回调停止编码，缓冲区保留以免显示任务正在写入
+    clientCount.store(0, std::memory_order_release);
+    socket->close();
+    delete socket;
+    socket = nullptr;
+}
+//*** WebSocket事件回调
+void ScreenMirror::socketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
+    ScreenMirror* mirror = getInstance();
+    if (type == WStype_CONNECTED) {
+        // 缓冲区在第一个客户端连接时才分配，分配后不再释放（显示任务可能正在写入）
+        if (mirror->buffers[0] == nullptr) {
+            mirror->buffers[0] = (uint8_t*)heap_caps_malloc(MIRROR_BUFFER_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            mirror->buffers[1] = (uint8_t*)heap_caps_malloc(MIRROR_BUFFER_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        }
+        if (mirror->buffers[0] == nullptr || mirror->buffers[1] == nullptr) {
+            Serial.println("屏幕镜像缓冲区分配失败");
+            free(mirror->buffers[0]);
+            free(mirror->buffers[1]);
+            mirror->buffers[0] = nullptr;
+            mirror->buffers[1] = nullptr;
+            mirror->socket->disconnect(num);
+            return;
+        }
+        // 新客户端需要完整画面；release顺序保证显示任务看到客户端时缓冲区指针已经写好
+        mirror->resyncRequested.store(true, std::memory_order_release);
+        uint8_t clients = mirror->clientCount.fetch_add(1, std::memory_order_release) + 1;
+        Serial.printf("屏幕镜像客户端 %u 已连接，共 %u 个\n", num, clients);
+    } else if (type == WStype_DISCONNECTED) {
+        // 客户端数量只在Web任务中修改
+        uint8_t clients = mirror->clientCount.load(std::memory_order_relaxed);
+        if (clients > 0) {
+            mirror->clientCount.store(--clients, std::memory_order_release);
+        }
+        Serial.printf("屏幕镜像客户端 %u 已断开，剩余 %u 个\n", num, clients);
+    }
+}
+//*** 处理WebSocket连接并推送数据
+void ScreenMirror::loop() {
+    if (socket == nullptr) {
+        return;
+    }
+    socket->loop();
+    // acquire：读到待发送标志后，显示任务写入的缓冲区内容、sendIndex和sendLength都已可见
+    if (sendPending.load(std::memory_order_acquire)) {
+        size_t length = sendLength.load(std::memory_order_relaxed);
+        if (clientCount.load(std::memory_order_relaxed) > 0) {
+            socket->broadcastBIN(buffers[sendIndex.load(std::memory_order_relaxed)], length);
+            batches++;
+            sentBytes += length;
+        }
+        // release：发送完成（不再读取缓冲区）之后显示任务才能重新写入
+        sendPending.store(false, std::memory_order_release);
+    }
+}
+//*** 交换缓冲区和重新同步
+void ScreenMirror::update() {
+    if (clientCount.load(std::memory_order_acquire) == 0) {
+        fillLength = 0;
+        resyncRow = -1;
+        return;
+    }
+    if (resyncRequested.exchange(false, std::memory_order_acq_rel)) {
+        // 之前累积的矩形已不完整，丢弃后从第一行开始逐条带重绘
+        fillLength = 0;
+        resyncRow = 0;
+    }
+    unsigned long now = millis();
+    bool pending = sendPending.load(std::memory_order_acquire);
+    if (fillLength > 0 && !pending && now - lastSwap >= MIRROR_FRAME_INTERVAL) {
+        sendIndex.store(fillIndex, std::memory_order_relaxed);
+        sendLength.store(fillLength, std::memory_order_relaxed);
+        fillIndex ^= 1;
+        fillLength = 0;
+        lastSwap = now;
+        // release：Web任务读到标志时，缓冲区内容和上面两个字段都已写好
+        sendPending.store(true, std::memory_order_release);
+        pending = true;
+    }
+    // 每批只重绘一个条带，重新同步的额外绘制量受推送间隔限制
+    if (resyncRow >= 0 && fillLength == 0 && !pending) {
+        lv_disp_t* disp = lv_disp_get_default();
+        lv_coord_t height = lv_disp_get_ver_res(disp);
+        lv_area_t band;
+        band.x1 = 0;
+        band.x2 = lv_disp_get_hor_res(disp) - 1;
+        band.y1 = resyncRow;
+        band.y2 = LV_MIN(resyncRow + MIRROR_RESYNC_ROWS, height) - 1;
+        lv_obj_invalidate_area(lv_scr_act(), &band);
+        resyncRow += MIRROR_RESYNC_ROWS;
+        if (resyncRow >= height) {
+            resyncRow = -1;
+        }
+    }
+}
+//*** 编码一个脏矩形
+void ScreenMirror::onFlush(const lv_area_t* area, const lv_color_t* pixels) {
+    if (resyncRequested.load(std::memory_order_relaxed)) {
+        return;
+    }
+    uint16_t w = area->x2 - area->x1 + 1;
+    uint16_t h = area->y2 - area->y1 + 1;
+    if (fillLength + mirrorRectWorstCase(w, h) > MIRROR_BUFFER_SIZE) {
+        // 上一批还没发出、这一批已满：丢弃矩形并在之后重新同步，显示任务不等待网络
+        droppedRects++;
+        resyncRequested.store(true, std::memory_order_relaxed);
+        return;
+    }
+    unsigned long startTime = micros();
+    // LV_COLOR_16_SWAP为0时lv_color_t即为RGB565
+    fillLength += mirrorEncodeRect(buffers[fillIndex] + fillLength, MIRROR_BUFFER_SIZE - fillLength,
+                                   area->x1, area->y1, w, h, (const uint16_t*)pixels);
+    encodeMicros += micros() - startTime;
+    pixelBytes += (uint32_t)w * h * 2;
+}
+//*** 生成统计JSON
+String ScreenMirror::getStatsJson() {
+    JsonDocument doc;
+    doc["clients"] = clientCount.load(std::memory_order_relaxed);
+    doc["batches"] = batches;
+    doc["sent_bytes"] = sentBytes;
+    doc["pixel_bytes"] = pixelBytes;
+    doc["compression_ratio"] = sentBytes > 0 ? (float)pixelBytes / sentBytes : 0;
+    doc["dropped_rects"] = droppedRects;
+    doc["encode_us"] = encodeMicros;
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
@@ -0,0 +1,81 @@
+#ifndef SCREEN_MIRROR_H
+#define SCREEN_MIRROR_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <WebSocketsServer.h>
+#include <atomic>
+
+// WebSocket端口（Web配置服务器使用80端口）
+const uint16_t MIRROR_PORT = 81;
+// 每个发送缓冲区的大小（共两个，分配在PSRAM中）
+const size_t MIRROR_BUFFER_SIZE = 64 * 1024;
+// 两批推送之间的最小间隔（毫秒），即最多每秒推送10批
+const unsigned long MIRROR_FRAME_INTERVAL = 100;
+// 重新同步时每批重绘的行数（一批的原始像素约30KB，不会超过发送缓冲区）
+const lv_coord_t MIRROR_RESYNC_ROWS = 48;
+
+/**
+ * 屏幕镜像类
+ * 在my_disp_flush中截取送往屏幕的脏矩形，用RLE编码后追加到发送缓冲区，
+ * Web任务按固定间隔把整批矩形以二进制消息推送给所有WebSocket客户端，浏览器在/mirror页面还原画面。
+ * 没有客户端连接时刷新回调只做一次判断，不复制任何像素；
+ * 有客户端时发送缓冲区写满或上一批尚未发出就丢弃矩形，随后按条带逐步重绘整屏重新同步，显示任务从不等待网络。
+ * 显示任务（CORE_0）和Web任务（CORE_1）之间的交接只通过原子变量：显示任务写好sendIndex和sendLength后
+ * 以release顺序置位sendPending，Web任务以acquire顺序读到后才读取这两个字段和缓冲区，发送完再以release顺序清除，
+ * 显示任务读到清除后才会重新写入该缓冲区
+ */
+class ScreenMirror {
+private:
+    static ScreenMirror* instance; // 单例实例
+
+    WebSocketsServer* socket;      // WebSocket服务器
+    std::atomic<uint8_t> clientCount; // 已连接的客户端数量（Web任务修改，连接时先分配缓冲区再以release顺序增加）
+    uint8_t* buffers[2];           // 双缓冲：显示任务写入一个，Web任务发送另一个
+    int fillIndex;                 // 显示任务正在写入的缓冲区（只由显示任务访问）
+    size_t fillLength;             // 写入缓冲区中已有的字节数（只由显示任务访问）
+    std::atomic<int> sendIndex;    // 等待发送的缓冲区
+    std::atomic<size_t> sendLength; // 等待发送的字节数
+    std::atomic<bool> sendPending; // 有一批数据等待Web任务发送（发布上面两个字段和缓冲区内容）
+    std::atomic<bool> resyncRequested; // 需要重新同步整屏（新客户端连接或丢弃了矩形）
+    lv_coord_t resyncRow;          // 逐条带重新同步的下一行（-1表示不在同步中）
+    unsigned long lastSwap;        // 上次交换缓冲区的时间
+
+    // 统计
+    uint32_t batches;              // 已推送的批数
+    uint64_t sentBytes;            // 已推送的字节数
+    uint64_t pixelBytes;           // 编码前的像素字节数
+    uint32_t droppedRects;         // 因缓冲区已满丢弃的矩形数
+    uint64_t encodeMicros;         // 显示任务中编码的总耗时（微秒）
+
+    // 私有构造函数（单例模式）
+    ScreenMirror();
+
+    // WebSocket事件回调（在Web任务中执行）
+    static void socketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
+
+public:
+    // 获取单例实例
+    static ScreenMirror* getInstance();
+
+    // 启动和停止WebSocket服务器（随Web配置服务器启动和停止）
+    void begin();
+    void end();
+
+    // 在Web任务中调用：处理WebSocket连接并推送待发送的一批数据
+    void loop();
+
+    // 在显示任务中调用：按间隔交换缓冲区，重新同步时逐条带标记重绘
+    void update();
+
+    // 在刷新回调中调用：编码一个脏矩形
+    void onFlush(const lv_area_t* area, const lv_color_t* pixels);
+
+    // 是否有客户端在观看（刷新回调中的快速判断）
+    bool isMirroring() { return clientCount.load(std::memory_order_acquire) > 0; }
+
+    // 生成统计JSON
+    String getStatsJson();
+};
+
+#endif // SCREEN_MIRROR_H
@@ -1,6 +1,26 @@
 #include "web_config_server.h"
 #include <ArduinoJson.h>
 #include "config/config.h"
+#include "manager/screen_manager.h"
+#include "ui/screen_lifecycle.h"
+#include "ui/layout_engine.h"
+#include "ui/news_list.h"
+#include "ui/quote_bitmap_cache.h"
+#include "ui/screen_capture.h"
+#include "network/screen_mirror.h"
+#include "manager/benchmark_manager.h"
+#include "manager/night_mode_manager.h"
+#include "manager/touch_manager.h"
+#include "ui/gif_background.h"
+#include "manager/job_scheduler.h"
+#include "ui/rle_image.h"
+#include "manager/asset_bundle.h"
+#include "ui/image_cache.h"
+#include "ui/jpeg_image.h"
+#include "ui/png_image.h"
+#include "manager/image_ingest.h"
+#include "ui/font_loader.h"
+#include "ui/ttf_loader.h"
 
 // 定义单例实例
 WebConfigServer* WebConfigServer::instance = nullptr;
@@ -54,6 +74,31 @@ void WebConfigServer::init() {
     server.on("/json-files", HTTP_GET, std::bind(&WebConfigServer::handleJsonFile, this));
     server.on("/json-file", HTTP_GET, std::bind(&WebConfigServer::handleJsonFileContent, this));
     server.on("/note", HTTP_POST, std::bind(&WebConfigServer::handleNote, this));
+    server.on("/screen-stats", HTTP_GET, std::bind(&WebConfigServer::handleScreenStats, this));
+    server.on("/layout", HTTP_GET, std::bind(&WebConfigServer::handleLayoutPage, this));
+    server.on("/layout", HTTP_POST, std::bind(&WebConfigServer::handleLayout, this));
+    server.on("/layout-bench", HTTP_POST, std::bind(&WebConfigServer::handleLayoutBenchmark, this));
+    server.on("/news-bench", HTTP_POST, std::bind(&WebConfigServer::handleNewsBenchmark, this));
+    server.on("/news-bench", HTTP_GET, std::bind(&WebConfigServer::handleNewsBenchmarkResult, this));
+    server.on("/quote-cache", HTTP_GET, std::bind(&WebConfigServer::handleQuoteCacheStats, this));
+    server.on("/screenshot", HTTP_GET, std::bind(&WebConfigServer::handleScreenshot, this));
+    server.on("/mirror", HTTP_GET, std::bind(&WebConfigServer::handleMirrorPage, this));
+    server.on("/mirror-stats", HTTP_GET, std::bind(&WebConfigServer::handleMirrorStats, this));
+    server.on("/benchmark", HTTP_POST, std::bind(&WebConfigServer::handleBenchmark, this));
+    server.on("/benchmark", HTTP_GET, std::bind(&WebConfigServer::handleBenchmarkResult, this));
+    server.on("/night-stats", HTTP_GET, std::bind(&WebConfigServer::handleNightStats, this));
+    server.on("/touch-calibrate", HTTP_POST, std::bind(&WebConfigServer::handleTouchCalibrate, this));
+    server.on("/touch-stats", HTTP_GET, std::bind(&WebConfigServer::handleTouchStats, this));
+    server.on("/gif-stats", HTTP_GET, std::bind(&WebConfigServer::handleGifStats, this));
+    server.on("/job-stats", HTTP_GET, std::bind(&WebConfigServer::handleJobStats, this));
+    server.on("/image-stats", HTTP_GET, std::bind(&WebConfigServer::handleImageStats, this));
+    server.on("/asset-stats", HTTP_GET, std::bind(&WebConfigServer::handleAssetStats, this));
+    server.on("/image-cache-stats", HTTP_GET, std::bind(&WebConfigServer::handleImageCacheStats, this));
+    server.on("/jpeg-stats", HTTP_GET, std::bind(&WebConfigServer::handleJpegStats, this));
+    server.on("/ingest-stats", HTTP_GET, std::bind(&WebConfigServer::handleIngestStats, this));
+    server.on("/font-stats", HTTP_GET, std::bind(&WebConfigServer::handleFontStats, this));
+    server.on("/ttf-stats", HTTP_GET, std::bind(&WebConfigServer::handleTtfStats, this));
+    server.on("/png-stats", HTTP_GET, std::bind(&WebConfigServer::handlePngStats, this));
     server.onNotFound(std::bind(&WebConfigServer::handleNotFound, this));
 }
 
@@ -86,6 +131,8 @@ bool WebConfigServer::start(bool useAPMode) {
     
     // 开始Web服务器
     server.begin();
+    // 启动屏幕镜像的WebSocket服务器
+    ScreenMirror::getInstance()->begin();
     isRunning = true;
     
     return true;
@@ -103,6 +150,7 @@ void WebConfigServer::stop() {
     if (isRunning) {
         Serial.println("停止Web配置服务器...");
         server.stop();
+        ScreenMirror::getInstance()->end();
         WiFi.softAPdisconnect(true);
         isRunning = false;
         Serial.println("Web配置服务器已停止");
@@ -115,6 +163,7 @@ void WebConfigServer::stop() {
 void WebConfigServer::handleClient() {
     if (isRunning) {
         server.handleClient();
+        ScreenMirror::getInstance()->loop();
     }
 }
 
@@ -209,6 +258,12 @@ void WebConfigServer::handleRoot() {
     html += "<input type='submit' value='保存留言内容'>";
     html += "</form>";
     
+    html += "<p><a href='/layout'>屏幕布局设置</a></p>";
+    html += "<p><a href='/screenshot'>查看当前屏幕截图</a></p>";
+    html += "<p><a href='/mirror'>实时屏幕镜像</a></p>";
+    html += "<form action='/benchmark' method='post'><input type='submit' value='运行性能测试'> <a href='/benchmark'>查看上次测试结果</a></form>";
+    html += "<form action='/touch-calibrate' method='post'><input type='submit' value='校准触摸屏'> <a href='/touch-stats'>触摸统计</a></form>";
+    
     html += "</body></html>";
     
     server.send(200, "text/html", html);
@@ -234,6 +289,8 @@ void WebConfigServer::handleNote() {
             noteFile.close();
             
             Serial.println("留言内容保存成功");
+            // 留言内容变化会影响下一个屏幕的选择，使预先准备的屏幕失效
+            ScreenManager::getInstance()->invalidatePreparedScreen();
             server.send(200, "text/html", "<!DOCTYPE html><html><head><meta charset='UTF-8'></head><body><h1>留言内容保存成功!</h1><p>下次切换屏幕时将显示新的留言内容。</p><p><a href='/'>返回首页</a></p></body></html>");
         } else {
             Serial.println("无法创建或打开note.json文件");
@@ -301,6 +358,298 @@ void WebConfigServer::handleJsonFile() {
     server.send(200, "text/html", html);
 }
 
+/**
+ * 处理屏幕对象内存统计请求
+ * 返回各屏幕是否已创建、对象数量、内存占用及创建/释放次数
+ */
+void WebConfigServer::handleScreenStats() {
+    // 统计数据由显示任务更新，这里只读取，不访问LVGL对象
+    server.send(200, "application/json", ScreenLifecycle::getInstance()->getStatsJson());
+}
+
+/**
+ * 处理屏幕布局编辑页面请求
+ * 显示当前布局的JSON源文件，没有自定义布局时显示内置布局
+ */
+void WebConfigServer::handleLayoutPage() {
+    String layoutJson = "";
+    bool customLayout = SPIFFS.exists(LAYOUT_BIN_FILE);
+    if (customLayout) {
+        File layoutFile = SPIFFS.open(LAYOUT_JSON_FILE, "r");
+        if (layoutFile) {
+            layoutJson = layoutFile.readString();
+            layoutFile.close();
+        }
+    }
+    if (layoutJson.isEmpty()) {
+        layoutJson = LayoutEngine::getBuiltinLayoutJson();
+    }
+    layoutJson.replace("&", "&amp;");
+    layoutJson.replace("<", "&lt;");
+    
+    String html = "";
+    html += "<!DOCTYPE html><html><head><meta charset='UTF-8'><title>屏幕布局设置</title>";
+    html += "<style>body{font-family:Arial,sans-serif;margin:20px;}";
+    html += "h1{color:#333;}";
+    html += "textarea{width:100%;height:400px;padding:10px;margin:8px 0;font-family:monospace;";
+    html += "border:1px solid #ccc;border-radius:4px;box-sizing:border-box;resize:vertical;}";
+    html += "input[type=submit]{background-color:#4CAF50;color:white;padding:14px 20px;margin:8px 0;border:none;";
+    html += "border-radius:4px;cursor:pointer;}</style></head><body>";
+    
+    html += "<h1>屏幕布局设置</h1>";
+    html += "<p>当前使用" + String(customLayout ? "自定义布局" : "内置布局") + "。";
+    html += "上传时布局会被编译为字节码保存，各屏幕下次创建时生效；清空内容后保存可恢复内置布局。</p>";
+    html += "<p>元素类型: label（font, size, color, x, y, h, bg, bg_opa, wrap）和image（image, w, h, x, y），";
+    html += "label指定size时使用同一系列的轮廓字体/fonts/&lt;系列&gt;.ttf（如digital.ttf）按该字号绘制，";
+    html += "每个元素必须通过role绑定到所在屏幕的一个对象。</p>";
+    html += "<form action='/layout' method='post'>";
+    html += "<textarea name='layout'>" + layoutJson + "</textarea><br>";
+    html += "<input type='submit' value='编译并保存布局'>";
+    html += "</form>";
+    
+    html += "<form action='/layout-bench' method='post'>";
+    html += "<input type='submit' value='对比创建耗时'>";
+    html += "</form>";
+    html += "<p>对比结果见<a href='/screen-stats'>屏幕对象统计</a>中的bench_builtin_us和bench_layout_us。</p>";
+    
+    html += "<p><a href='/'>返回首页</a></p>";
+    html += "</body></html>";
+    
+    server.send(200, "text/html", html);
+}
+
+/**
+ * 处理屏幕布局上传请求
+ * JSON在上传时一次性编译为字节码，显示任务创建屏幕时不再解析JSON
+ */
+void WebConfigServer::handleLayout() {
+    if (!server.hasArg("layout")) {
+        server.send(400, "text/html", "<!DOCTYPE html><html><head><meta charset='UTF-8'></head><body><h1>参数错误!</h1><p>缺少layout参数</p><p><a href='/layout'>返回</a></p></body></html>");
+        return;
+    }
+    String layoutJson = server.arg("layout");
+    layoutJson.trim();
+    LayoutEngine* layoutEngine = LayoutEngine::getInstance();
+    
+    if (layoutJson.isEmpty()) {
+        layoutEngine->clear();
+        Serial.println("已删除自定义屏幕布局");
+        server.send(200, "text/html", "<!DOCTYPE html><html><head><meta charset='UTF-8'></head><body><h1>已恢复内置布局!</h1><p><a href='/layout'>返回</a></p></body></html>");
+        return;
+    }
+    
+    String error;
+    if (layoutEngine->compile(layoutJson, error)) {
+        server.send(200, "text/html", "<!DOCTYPE html><html><head><meta charset='UTF-8'></head><body><h1>布局保存成功!</h1><p>各屏幕下次创建时将使用新布局。</p><p><a href='/layout'>返回</a></p></body></html>");
+    } else {
+        Serial.println("布局编译失败: " + error);
+        error.replace("<", "&lt;");
+        server.send(400, "text/html", "<!DOCTYPE html><html><head><meta charset='UTF-8'></head><body><h1>布局编译失败!</h1><p>" + error + "</p><p><a href='/layout'>返回</a></p></body></html>");
+    }
+}
+
+/**
+ * 处理屏幕元素创建耗时对比测试请求
+ * 测试需要访问LVGL对象，这里只提交请求，由显示任务执行
+ */
+void WebConfigServer::handleLayoutBenchmark() {
+    ScreenLifecycle::getInstance()->requestBenchmark();
+    server.send(200, "text/html", "<!DOCTYPE html><html><head><meta charset='UTF-8'></head><body><h1>已提交对比测试!</h1><p>稍后在<a href='/screen-stats'>屏幕对象统计</a>或串口日志中查看结果。</p><p><a href='/layout'>返回</a></p></body></html>");
+}
+
+/**
+ * 处理新闻列表性能测试请求
+ * 测试需要访问LVGL对象，这里只提交请求，由显示任务执行
+ */
+void WebConfigServer::handleNewsBenchmark() {
+    NewsList::requestBenchmark();
+    server.send(200, "text/html", "<!DOCTYPE html><html><head><meta charset='UTF-8'></head><body><h1>已提交新闻列表性能测试!</h1><p>测试期间屏幕会短暂显示测试列表，稍后<a href='/news-bench'>查看结果</a>。</p><p><a href='/'>返回首页</a></p></body></html>");
+}
+
+/**
+ * 返回新闻列表性能测试结果
+ */
+void WebConfigServer::handleNewsBenchmarkResult() {
+    server.send(200, "application/json", NewsList::getBenchmarkJson());
+}
+
+/**
+ * 处理语录位图缓存统计请求
+ * 返回位图占用的PSRAM、全部语录预渲染的估算大小以及每次显示节省的渲染耗时
+ */
+void WebConfigServer::handleQuoteCacheStats() {
+    server.send(200, "application/json", QuoteBitmapCache::getInstance()->getStatsJson());
+}
+
+/**
+ * 处理截图请求
+ * 显示任务逐条带重绘当前屏幕，每条带直接以分块传输发送，返回BMP图像
+ */
+void WebConfigServer::handleScreenshot() {
+    if (!ScreenCapture::getInstance()->stream(server)) {
+        server.send(503, "text/html", "<!DOCTYPE html><html><head><meta charset='UTF-8'></head><body><h1>截图失败!</h1><p>正在进行另一次截图或显示任务未响应，请稍后重试。</p><p><a href='/'>返回首页</a></p></body></html>");
+    }
+}
+
+/**
+ * 处理性能测试请求
+ * 与三击按钮相同，测试在显示任务中运行，结果保存到/benchmark.json
+ */
+void WebConfigServer::handleBenchmark() {
+    BenchmarkManager::getInstance()->requestRun();
+    server.send(200, "text/html", "<!DOCTYPE html><html><head><meta charset='UTF-8'></head><body><h1>已提交性能测试!</h1><p>测试期间屏幕会依次切换并显示测试画面，完成后结果显示在屏幕上，稍后<a href='/benchmark'>查看结果</a>。</p><p><a href='/'>返回首页</a></p></body></html>");
+}
+
+/**
+ * 返回上次保存的性能测试结果
+ */
+void WebConfigServer::handleBenchmarkResult() {
+    server.send(200, "application/json", BenchmarkManager::getResultJson());
+}
+
+/**
+ * 处理夜间模式统计请求
+ * 返回唤醒和休眠状态的驻留时间、显示任务CPU占用和各唤醒原因的次数
+ */
+void WebConfigServer::handleNightStats() {
+    server.send(200, "application/json", NightModeManager::getInstance()->getStatsJson());
+}
+
+/**
+ * 处理触摸屏校准请求
+ * 校准在显示任务中运行：依次点击屏幕左上和右下的十字，结果保存到config.json
+ */
+void WebConfigServer::handleTouchCalibrate() {
+    TouchManager::getInstance()->requestCalibration();
+    server.send(200, "text/html", "<!DOCTYPE html><html><head><meta charset='UTF-8'></head><body><h1>已开始触摸校准!</h1><p>请依次点击屏幕上出现的红色十字中心，完成后校准参数自动保存。</p><p><a href='/touch-stats'>查看校准参数</a></p><p><a href='/'>返回首页</a></p></body></html>");
+}
+
+/**
+ * 处理触摸统计请求
+ * 返回采样次数、空闲时跳过采样的比例、手势识别和处理的耗时及当前校准参数
+ */
+void WebConfigServer::handleTouchStats() {
+    server.send(200, "application/json", TouchManager::getInstance()->getStatsJson());
+}
+
+/**
+ * 处理动画背景统计请求
+ * 返回每个GIF动画背景的帧数、每帧解码耗时、平均重绘比例和内存占用
+ */
+void WebConfigServer::handleGifStats() {
+    server.send(200, "application/json", GifBackground::getStatsJson());
+}
+
+/**
+ * 处理分片作业统计请求
+ * 返回切片耗时分布、超出每帧预算的次数和最近完成的作业
+ */
+void WebConfigServer::handleJobStats() {
+    server.send(200, "application/json", JobScheduler::getInstance()->getStatsJson());
+}
+
+/**
+ * 处理压缩图像统计请求
+ * 返回每幅压缩背景图像的压缩率、解压和绘制吞吐量
+ */
+void WebConfigServer::handleImageStats() {
+    server.send(200, "application/json", RleImage::getStatsJson());
+}
+
+/**
+ * 处理资源包统计请求
+ * 返回资源分区的映射耗时以及各图像和字体条目的大小和使用次数
+ */
+void WebConfigServer::handleAssetStats() {
+    server.send(200, "application/json", AssetBundle::getInstance()->getStatsJson());
+}
+
+/**
+ * 处理文件图像解码缓存统计请求
+ * 返回命中率、占用的PSRAM以及每幅缓存图像的解码耗时和命中次数
+ */
+void WebConfigServer::handleImageCacheStats() {
+    server.send(200, "application/json", ImageCache::getInstance()->getStatsJson());
+}
+
+/**
+ * 处理JPEG图像统计请求
+ * 返回每幅JPEG图像的压缩率、解码吞吐量、从头解码的次数和条带缓冲区大小
+ */
+void WebConfigServer::handleJpegStats() {
+    server.send(200, "application/json", JpegImage::getStatsJson());
+}
+
+/**
+ * 处理远程图像导入统计请求
+ * 返回每幅导入图像的来源地址、原图和保存的尺寸、格式，以及下载、解码和缩放耗时
+ */
+void WebConfigServer::handleIngestStats() {
+    server.send(200, "application/json", ImageIngest::getInstance()->getStatsJson());
+}
+
+/**
+ * 处理运行时字体统计请求
+ * 返回每个加载的字体的内存占用和加载耗时，以及字形缓存的占用、命中率和从文件读取字形的平均耗时
+ */
+void WebConfigServer::handleFontStats() {
+    server.send(200, "application/json", FontLoader::getInstance()->getStatsJson());
+}
+
+/**
+ * 处理轮廓字体统计请求
+ * 返回打开的TrueType字体文件、各字号字体的字形缓存命中率和平均光栅化耗时，以及字形缓存的占用
+ */
+void WebConfigServer::handleTtfStats() {
+    server.send(200, "application/json", TtfLoader::getInstance()->getStatsJson());
+}
+
+/**
+ * 处理PNG图像统计请求
+ * 返回每幅PNG图像的压缩率、逐行解码的吞吐量、从头解码的次数和解码时的峰值内存
+ */
+void WebConfigServer::handlePngStats() {
+    server.send(200, "application/json", PngImage::getStatsJson());
+}
+
+/**
+ * 处理屏幕镜像页面请求
+ * 页面通过81端口的WebSocket接收脏矩形并在画布上还原屏幕画面
+ */
+void WebConfigServer::handleMirrorPage() {
+    String html = "<!DOCTYPE html><html><head><meta charset='UTF-8'><title>屏幕镜像</title></head><body>";
+    html += "<h1>屏幕镜像</h1>";
+    html += "<canvas id='screen' width='" + String(screenWidth) + "' height='" + String(screenHeight) + "' style='border:1px solid #888;background:#000'></canvas>";
+    html += "<p id='state'>连接中...</p>";
+    html += "<p><a href='/mirror-stats'>镜像统计</a> <a href='/'>返回首页</a></p>";
+    // 矩形记录格式见mirror_codec.h：x y w h（各2字节） 编码方式（1字节） 保留（1字节） 数据长度（4字节）
+    html += "<script>";
+    html += "var ctx=document.getElementById('screen').getContext('2d');";
+    html += "var ws=new WebSocket('ws://'+location.hostname+':" + String(MIRROR_PORT) + "/');";
+    html += "ws.binaryType='arraybuffer';";
+    html += "ws.onopen=function(){document.getElementById('state').textContent='已连接';};";
+    html += "ws.onclose=function(){document.getElementById('state').textContent='已断开';};";
+    html += "ws.onmessage=function(e){var d=new DataView(e.data),p=0;";
+    html += "while(p+14<=d.byteLength){var x=d.getUint16(p,true),y=d.getUint16(p+2,true),w=d.getUint16(p+4,true),h=d.getUint16(p+6,true);";
+    html += "var enc=d.getUint8(p+8),len=d.getUint32(p+10,true);p+=14;";
+    html += "var img=ctx.createImageData(w,h),px=img.data,i=0;";
+    html += "function put(c){px[i++]=(c>>11)*255/31;px[i++]=((c>>5)&63)*255/63;px[i++]=(c&31)*255/31;px[i++]=255;}";
+    html += "if(enc==0){for(var k=0;k<len;k+=2)put(d.getUint16(p+k,true));}";
+    html += "else{for(var q=p;q<p+len;q+=3){var n=d.getUint8(q),c=d.getUint16(q+1,true);for(var k=0;k<n;k++)put(c);}}";
+    html += "ctx.putImageData(img,x,y);p+=len;}};";
+    html += "</script>";
+    html += "</body></html>";
+    server.send(200, "text/html", html);
+}
+
+/**
+ * 处理屏幕镜像统计请求
+ * 返回推送批数、字节数、压缩比和丢弃的矩形数
+ */
+void WebConfigServer::handleMirrorStats() {
+    server.send(200, "application/json", ScreenMirror::getInstance()->getStatsJson());
+}
+
 /**
  * 处理404错误
  */
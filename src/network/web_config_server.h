@@ -40,6 +40,77 @@ private:
     // 处理留言板内容请求
     void handleNote();
 
+    // 处理屏幕对象内存统计请求
+    void handleScreenStats();
+
+    // 处理屏幕布局编辑页面请求
+    void handleLayoutPage();
+
+    // 处理屏幕布局上传请求（编译为字节码）
+    void handleLayout();
+
+    // 处理屏幕元素创建耗时对比测试请求
+    void handleLayoutBenchmark();
+
+    // 处理新闻列表性能测试请求（POST提交测试，GET查看结果）
+    void handleNewsBenchmark();
+    void handleNewsBenchmarkResult();
+
+    // 处理语录位图缓存统计请求
+    void handleQuoteCacheStats();
+
+    // 处理截图请求（BMP格式，逐条带发送）
+    void handleScreenshot();
+
+    // 处理屏幕镜像页面请求
+    void handleMirrorPage();
+
+    // 处理屏幕镜像统计请求
+    void handleMirrorStats();
+
+    // 处理性能测试请求（POST提交测试，GET查看结果）
+    void handleBenchmark();
+    void handleBenchmarkResult();
+
+    // 处理夜间模式统计请求
+    void handleNightStats();
+
+    // 处理触摸屏校准请求
+    void handleTouchCalibrate();
+
+    // 处理触摸统计请求
+    void handleTouchStats();
+
+    // 处理动画背景统计请求
+    void handleGifStats();
+
+    // 处理分片作业统计请求
+    void handleJobStats();
+
+    // 处理压缩图像统计请求
+    void handleImageStats();
+
+    // 处理资源包统计请求
+    void handleAssetStats();
+
+    // 处理文件图像解码缓存统计请求
+    void handleImageCacheStats();
+
+    // 处理JPEG图像统计请求
+    void handleJpegStats();
+
+    // 处理远程图像导入统计请求
+    void handleIngestStats();
+
+    // 处理运行时字体统计请求
+    void handleFontStats();
+
+    // 处理轮廓字体统计请求
+    void handleTtfStats();
+
+    // 处理PNG图像统计请求
+    void handlePngStats();
+
     // 读取WiFi配置
     void readWiFiConfig(String& ssid, String& password);
 
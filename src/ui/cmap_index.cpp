@@ -0,0 +1,78 @@
+#include "cmap_index.h"
+#include <string.h>
+
+//*** 为字体建立直接索引
+size_t cmapIndexBuild(const lv_font_fmt_txt_dsc_t& dsc, lv_font_fmt_txt_cmap_index_t& index, int& usedPages,
+                      CmapIndexAlloc alloc, CmapIndexFree release) {
+    const uint32_t pageSize = LV_FONT_FMT_TXT_CMAP_INDEX_PAGE_SIZE;
+    memset(&index, 0, sizeof(index));
+    usedPages = 0;
+    // 只索引基本多文种平面，其余字符仍在cmap表中查找
+    uint32_t end = 0;
+    for (int i = 0; i < dsc.cmap_num; i++) {
+        uint32_t cmapEnd = dsc.cmaps[i].range_start + dsc.cmaps[i].range_length;
+        end = cmapEnd > end ? cmapEnd : end;
+    }
+    end = end < 0x10000u ? end : 0x10000u;
+    uint16_t pageNum = (end + pageSize - 1) / pageSize;
+    if (pageNum == 0) {
+        return 0;
+    }
+    uint16_t** pages = (uint16_t**)alloc(pageNum * sizeof(uint16_t*));
+    if (pages == nullptr) {
+        return 0;
+    }
+    index.pages = pages;
+    index.page_num = pageNum;
+    size_t bytes = pageNum * sizeof(uint16_t*);
+    for (int i = 0; i < dsc.cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t& cmap = dsc.cmaps[i];
+        bool format0 = cmap.type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY || cmap.type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL;
+        uint32_t count = format0 ? cmap.range_length : cmap.list_length;
+        for (uint32_t k = 0; k < count; k++) {
+            uint32_t letter = cmap.range_start + (format0 ? k : cmap.unicode_list[k]);
+            uint32_t glyphId = cmap.glyph_id_start;
+            switch (cmap.type) {
+                case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+                case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+                    glyphId += k;
+                    break;
+                case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+                    glyphId += ((const uint8_t*)cmap.glyph_id_ofs_list)[k];
+                    break;
+                case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+                    glyphId += ((const uint16_t*)cmap.glyph_id_ofs_list)[k];
+                    break;
+            }
+            if (letter >= end) {
+                continue;
+            }
+            uint16_t*& page = pages[letter / pageSize];
+            if (page == nullptr) {
+                page = (uint16_t*)alloc(pageSize * sizeof(uint16_t));
+                if (page == nullptr) {
+                    cmapIndexRelease(index, release);
+                    usedPages = 0;
+                    return 0;
+                }
+                bytes += pageSize * sizeof(uint16_t);
+                usedPages++;
+            }
+            // 同一字符在多个cmap表中时使用第一个（与LVGL的查找顺序相同）
+            if (page[letter % pageSize] == 0) {
+                page[letter % pageSize] = (uint16_t)glyphId;
+            }
+        }
+    }
+    return bytes;
+}
+//*** 释放直接索引
+void cmapIndexRelease(lv_font_fmt_txt_cmap_index_t& index, CmapIndexFree release) {
+    if (index.pages != nullptr) {
+        for (int i = 0; i < index.page_num; i++) {
+            release((void*)index.pages[i]);
+        }
+        release((void*)index.pages);
+    }
+    memset(&index, 0, sizeof(index));
+}
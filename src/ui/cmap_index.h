@@ -0,0 +1,27 @@
+#ifndef CMAP_INDEX_H
+#define CMAP_INDEX_H
+
+// 本文件只依赖LVGL和标准C头文件，建立索引和比较查找结果可以在PC上单独编译测试
+#include <stdint.h>
+#include <stddef.h>
+#include <lvgl.h>
+
+// 分配清零的内存（失败时返回空）和释放内存，由调用方决定放在PSRAM还是普通堆中
+typedef void* (*CmapIndexAlloc)(size_t bytes);
+typedef void (*CmapIndexFree)(void* ptr);
+
+/**
+ * cmap表的直接索引
+ * LVGL每次测量和绘制字形都要遍历cmap表并在稀疏表中二分查找字符。
+ * 直接索引把基本多文种平面按每256个字符分页，页内直接存字形编号，只为有字形的页分配内存，
+ * 查找一个字符只需两次数组访问；其余字符仍在cmap表中查找
+ */
+
+// 为字体建立直接索引，返回占用的字节数（分配失败时释放已分配的页并返回0），usedPages为有字形的页数
+size_t cmapIndexBuild(const lv_font_fmt_txt_dsc_t& dsc, lv_font_fmt_txt_cmap_index_t& index, int& usedPages,
+                      CmapIndexAlloc alloc, CmapIndexFree release);
+
+// 释放直接索引
+void cmapIndexRelease(lv_font_fmt_txt_cmap_index_t& index, CmapIndexFree release);
+
+#endif // CMAP_INDEX_H
@@ -6,12 +6,14 @@
 #include <ArduinoJson.h>
 #include <lvgl.h>
 #include <time.h>
+#include <esp_heap_caps.h>
 
 // 外部变量声明
 extern lv_obj_t* iciba_label;
 extern lv_obj_t* astronauts_label;
 extern lv_obj_t* news_label;
 extern lv_obj_t* calendar_label;
+extern lv_obj_t* today_date_label;
 
 // 全局变量
 extern const uint32_t screenWidth;
@@ -68,46 +70,16 @@ lv_obj_t* displayImageFromSPIFFS(const char* filename, int x, int y) {
   return img;
 }
 
-/**
- * 创建并初始化通用标签
- * @param label 标签指针的引用
- * @param labelName 标签名称，用于调试
- */
-void createAndInitLabel(lv_obj_t* &label, const char* labelName) {
-  if (label == NULL || !lv_obj_is_valid(label)) {
-    if (label != NULL) {
-      // 确保旧标签被正确清理
-      lv_obj_del(label);
-    }
-    label = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(label, GBFont, 0);
-    lv_obj_set_style_text_color(label, lv_color_hex(0xFFFFFF), 0); // 白色文字，适配黑色背景
-    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_LEFT, 0);
-    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP); // 设置自动换行
-    lv_obj_set_width(label, screenWidth - 40); // 设置标签宽度
-    lv_obj_set_height(label, screenHeight - 120); // 固定高度
-    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 100); // 顶部居中对齐，顶部离屏幕顶部100px
-    
-    // 不添加背景和边框效果
-    lv_obj_set_style_bg_opa(label, 0, 0); // 完全透明背景
-    lv_obj_set_style_border_width(label, 0, 0); // 无边框
-    lv_obj_set_style_radius(label, 0, 0); // 无圆角
-    lv_obj_set_style_pad_all(label, 10, 0); // 内边距
-    
-    Serial.println("创建或重新创建了" + String(labelName));
-  }
-}
-
-//*** 显示日历信息
-void displayCalendar() {
-  Serial.print("显示日历信息");
-  
-  // 检查calendar_label是否已创建和有效
-  if (!calendar_label || !lv_obj_is_valid(calendar_label)) {
-    Serial.println("calendar_label无效，无法显示日历");
-    return;
-  }
-  
+// 日历所需的当月信息
+struct CalendarMonth {
+  int year;            // 年份
+  int month;           // 月份
+  int day;             // 今天的日期
+  int firstWeekday;    // 当月第一天是星期几
+  int daysInMonth;     // 当月天数
+};
+//*** 计算当月信息
+static void computeCalendarMonth(CalendarMonth& calendarMonth) {
   // 获取当前时间
   time_t now;
   struct tm timeinfo;
@@ -115,15 +87,15 @@ void displayCalendar() {
   localtime_r(&now, &timeinfo);
   
   // 获取当前年份、月份和日期
-  int year = timeinfo.tm_year + 1900;
-  int month = timeinfo.tm_mon + 1;
-  int day = timeinfo.tm_mday;
+  calendarMonth.year = timeinfo.tm_year + 1900;
+  calendarMonth.month = timeinfo.tm_mon + 1;
+  calendarMonth.day = timeinfo.tm_mday;
   
   // 计算当月第一天是星期几
   struct tm firstDayOfMonth = timeinfo;
   firstDayOfMonth.tm_mday = 1;
   mktime(&firstDayOfMonth);
-  int firstDayWeekday = firstDayOfMonth.tm_wday;
+  calendarMonth.firstWeekday = firstDayOfMonth.tm_wday;
   
   // 计算当月有多少天
   struct tm lastDayOfMonth = timeinfo;
@@ -132,28 +104,27 @@ void displayCalendar() {
   mktime(&lastDayOfMonth);
   lastDayOfMonth.tm_mday = 0; // 设置为0，回退到上个月的最后一天
   mktime(&lastDayOfMonth);
-  int daysInMonth = lastDayOfMonth.tm_mday;
-  
-  // 构建日历文本
-  String calendarText = "";
-  
+  calendarMonth.daysInMonth = lastDayOfMonth.tm_mday;
+}
+//*** 添加日历标题
+static void appendCalendarHeader(String& calendarText, const CalendarMonth& calendarMonth) {
   // 添加月份标题
-  calendarText += String(year) + "年" + String(month) + "月日历\n\n";
+  calendarText += String(calendarMonth.year) + "年" + String(calendarMonth.month) + "月日历\n\n";
   
   // 添加星期标题
   calendarText += "日  一  二  三  四  五  六\n";
-  
-  // 添加日期，确保当前日期突出显示
-  int dayCount = 1;
-  
-  // 填充第一行的空格
-  for (int i = 0; i < firstDayWeekday; i++) {
+}
+//*** 添加一周的日期（dayCount为本周第一天，添加后指向下一周第一天）
+static void appendCalendarWeek(String& calendarText, const CalendarMonth& calendarMonth, int& dayCount) {
+  // 第一周前面填充空格
+  int start = dayCount == 1 ? calendarMonth.firstWeekday : 0;
+  for (int i = 0; i < start; i++) {
     calendarText += "     "; // 五个空格
   }
   
-  // 填充日期
-  for (int i = firstDayWeekday; i < 7; i++) {
-    if (dayCount == day) {
+  // 填充日期，确保当前日期突出显示
+  for (int i = start; i < 7 && dayCount <= calendarMonth.daysInMonth; i++) {
+    if (dayCount == calendarMonth.day) {
       // 突出显示当前日期
       calendarText += "【";
       if (dayCount < 10) {
@@ -169,28 +140,83 @@ void displayCalendar() {
     dayCount++;
   }
   calendarText += "\n";
+}
+//*** 构建日历文本
+void buildCalendarText(String& calendarText) {
+  CalendarMonth calendarMonth;
+  computeCalendarMonth(calendarMonth);
   
-  // 填充剩余的日期
-  while (dayCount <= daysInMonth) {
-    for (int i = 0; i < 7 && dayCount <= daysInMonth; i++) {
-      if (dayCount == day) {
-        // 突出显示当前日期
-        calendarText += "【";
-        if (dayCount < 10) {
-          calendarText += "0";
-        }
-        calendarText += String(dayCount) + "】";
-      } else {
-        if (dayCount < 10) {
-          calendarText += "0";
-        }
-        calendarText += String(dayCount) + "  ";
-      }
-      dayCount++;
+  // 构建日历文本
+  calendarText = "";
+  appendCalendarHeader(calendarText, calendarMonth);
+  int dayCount = 1;
+  while (dayCount <= calendarMonth.daysInMonth) {
+    appendCalendarWeek(calendarText, calendarMonth, dayCount);
+  }
+}
+/**
+ * 日历准备作业
+ * 标题和每一周各占一个切片，最后一个切片设置标签文本（LVGL在此完成换行排版）
+ */
+class CalendarJob : public Job {
+private:
+  String text;                  // 正在构建的日历文本
+  CalendarMonth calendarMonth;  // 当月信息
+  int dayCount;                 // 下一周的第一天
+
+protected:
+  JobStatus step() override {
+    JOB_BEGIN();
+    computeCalendarMonth(calendarMonth);
+    text = "";
+    appendCalendarHeader(text, calendarMonth);
+    dayCount = 1;
+    while (dayCount <= calendarMonth.daysInMonth) {
+      JOB_YIELD();
+      appendCalendarWeek(text, calendarMonth, dayCount);
     }
-    calendarText += "\n";
+    JOB_YIELD();
+    // 各切片之间屏幕元素可能已被生命周期管理器释放，设置文本前重新确认
+    ScreenLifecycle::getInstance()->ensureBuilt(CALENDAR_SCREEN);
+    if (calendar_label && lv_obj_is_valid(calendar_label)) {
+      lv_label_set_text(calendar_label, text.c_str());
+    }
+    if (today_date_label && lv_obj_is_valid(today_date_label)) {
+      // 格式化日期为两位数字（如01, 02）
+      char dateStr[3];
+      snprintf(dateStr, sizeof(dateStr), "%02d", calendarMonth.day);
+      lv_label_set_text(today_date_label, dateStr);
+    }
+    JOB_END();
+  }
+
+  void cleanup() override {
+    text = String();
+  }
+
+public:
+  CalendarJob() : Job("calendar"), dayCount(1) {
+    memset(&calendarMonth, 0, sizeof(calendarMonth));
+  }
+};
+static CalendarJob calendarJob;
+//*** 获取日历准备作业
+Job* getCalendarJob() {
+  return &calendarJob;
+}
+//*** 显示日历信息
+void displayCalendar() {
+  Serial.print("显示日历信息");
+  
+  // 检查calendar_label是否已创建和有效
+  if (!calendar_label || !lv_obj_is_valid(calendar_label)) {
+    Serial.println("calendar_label无效，无法显示日历");
+    return;
   }
   
+  String calendarText;
+  buildCalendarText(calendarText);
+  
   // 更新标签文本
   lv_label_set_text(calendar_label, calendarText.c_str());
   
@@ -226,17 +252,12 @@ bool readJsonFromFile(const char* fileName, JsonDocument& doc) {
   }
   return true;
 }
-//*** 显示金山词霸每日信息
-void displayIcibaDataFromFile() {
-  Serial.println("从文件显示金山词霸数据");
-  
+//*** 构建金山词霸显示文本
+bool buildIcibaText(String& icibaText) {
   JsonDocument doc;
   if (!readJsonFromFile("/iciba.json", doc)) {
-    if (iciba_label && lv_obj_is_valid(iciba_label)) {
-      lv_label_set_text(iciba_label, "无法读取金山词霸数据文件");
-      lv_obj_clear_flag(iciba_label, LV_OBJ_FLAG_HIDDEN); // 确保标签可见
-    }
-    return;
+    icibaText = "无法读取金山词霸数据文件";
+    return false;
   }
 
   // 获取更新时间
@@ -268,9 +289,7 @@ void displayIcibaDataFromFile() {
   }
   
   // 构建金山词霸显示文本，在第一行右边括号中显示更新时间
-  String icibaText = "";
-  // 保存图片URL变量
-  String fenxiangImgUrl = "";
+  icibaText = "";
 
     // 保持向后兼容，访问顶级字段
     if (doc.containsKey("content") && doc["content"].is<const char*>()) {
@@ -285,6 +304,14 @@ void displayIcibaDataFromFile() {
     } else {
       icibaText += "暂无翻译";
     }
+  return true;
+}
+//*** 显示金山词霸每日信息
+void displayIcibaDataFromFile() {
+  Serial.println("从文件显示金山词霸数据");
+  
+  String icibaText;
+  buildIcibaText(icibaText);
   
   // 更新金山词霸标签
   if (iciba_label && lv_obj_is_valid(iciba_label)) {
@@ -292,30 +319,16 @@ void displayIcibaDataFromFile() {
     lv_obj_clear_flag(iciba_label, LV_OBJ_FLAG_HIDDEN); // 确保标签可见
   }
 }
-//*** 显示留言板内容
-void displayNoteDataFromFile() {
-  Serial.println("从文件显示留言板内容");
-  
-  // 外部声明note_label
-  extern lv_obj_t* note_label;
-  
-  // 确保note_label已创建和初始化
-  if (!note_label || !lv_obj_is_valid(note_label)) {
-    Serial.println("note_label无效，无法显示留言板内容");
-    return;
-  }
-  
+//*** 构建留言板显示文本
+bool buildNoteText(String& noteText) {
   JsonDocument doc;
   if (!readJsonFromFile("/note.json", doc)) {
-    if (note_label && lv_obj_is_valid(note_label)) {
-      lv_label_set_text(note_label, "暂无留言内容");
-      lv_obj_clear_flag(note_label, LV_OBJ_FLAG_HIDDEN); // 确保标签可见
-    }
-    return;
+    noteText = "暂无留言内容";
+    return false;
   }
 
   // 构建留言板显示文本
-  String noteText = "";
+  noteText = "";
   
   // 检查是否包含note字段
   if (doc.containsKey("note") && doc["note"].is<const char*>()) {
@@ -331,36 +344,40 @@ void displayNoteDataFromFile() {
   } else {
     noteText += "暂无留言内容";
   }
-  // 更新留言板标签
-  if (note_label && lv_obj_is_valid(note_label)) {
-    lv_label_set_text(note_label, noteText.c_str());
-    lv_obj_clear_flag(note_label, LV_OBJ_FLAG_HIDDEN); // 确保标签可见
-    lv_obj_move_foreground(note_label); // 确保标签显示在最上层
-  }
+  return true;
 }
-//*** 显示宇航员信息
-void displayAstronautsDataFromFile() {
-  Serial.println("从文件显示宇航员数据");
+//*** 显示留言板内容
+void displayNoteDataFromFile() {
+  Serial.println("从文件显示留言板内容");
   
-  // 确保astronauts_label已创建和初始化
-  createAndInitLabel(astronauts_label, "astronauts_label");
+  // 外部声明note_label
+  extern lv_obj_t* note_label;
   
+  // 确保note_label已创建和初始化
+  if (!note_label || !lv_obj_is_valid(note_label)) {
+    Serial.println("note_label无效，无法显示留言板内容");
+    return;
+  }
+  
+  String noteText;
+  buildNoteText(noteText);
+  // 更新留言板标签
+  lv_label_set_text(note_label, noteText.c_str());
+  lv_obj_clear_flag(note_label, LV_OBJ_FLAG_HIDDEN); // 确保标签可见
+  lv_obj_move_foreground(note_label); // 确保标签显示在最上层
+}
+//*** 构建宇航员显示文本
+bool buildAstronautsText(String& astronautsText) {
   JsonDocument doc;
   if (!readJsonFromFile("/astronauts.json", doc)) {
-    if (astronauts_label && lv_obj_is_valid(astronauts_label)) {
-      lv_label_set_text(astronauts_label, "无法读取宇航员数据文件");
-      lv_obj_clear_flag(astronauts_label, LV_OBJ_FLAG_HIDDEN); // 确保标签可见
-    }
-    return;
+    astronautsText = "无法读取宇航员数据文件";
+    return false;
   }
 
   // 先检查doc是否包含"people"
   if (!doc.containsKey("people")) {
-    if (astronauts_label && lv_obj_is_valid(astronauts_label)) {
-      lv_label_set_text(astronauts_label, "JSON格式错误：缺少people字段");
-      lv_obj_clear_flag(astronauts_label, LV_OBJ_FLAG_HIDDEN); // 确保标签可见
-    }
-    return;
+    astronautsText = "JSON格式错误：缺少people字段";
+    return false;
   }
   
   // 检查"people"是否为JsonArray
@@ -368,7 +385,7 @@ void displayAstronautsDataFromFile() {
     JsonArray peopleArray = doc["people"].as<JsonArray>();
     
     // 构建宇航员显示文本
-    String astronautsText = "太空宇航员列表\n\n";
+    astronautsText = "太空宇航员列表\n\n";
     
     // 遍历宇航员数组
     for (JsonVariant astronaut : peopleArray) {
@@ -378,16 +395,10 @@ void displayAstronautsDataFromFile() {
         astronautsText += name + " - " + craft + "\n";
       }
     }
-    
-    // 更新宇航员标签
-    if (astronauts_label && lv_obj_is_valid(astronauts_label)) {
-      lv_label_set_text(astronauts_label, astronautsText.c_str());
-      lv_obj_clear_flag(astronauts_label, LV_OBJ_FLAG_HIDDEN); // 确保标签可见
-      lv_obj_move_foreground(astronauts_label); // 确保标签显示在最上层
-    }
+    return true;
   }
   // 如果不是数组，检查是否为对象
-  else if (doc["people"].is<JsonObject>()) {
+  if (doc["people"].is<JsonObject>()) {
     JsonObject result = doc["people"].as<JsonObject>();
     
     // 获取更新时间
@@ -397,7 +408,7 @@ void displayAstronautsDataFromFile() {
     }
     
     // 构建宇航员显示文本，在第一行右边括号中显示更新时间
-    String astronautsText = "太空宇航员总数:" + String(result["number"].as<int>());
+    astronautsText = "太空宇航员总数:" + String(result["number"].as<int>());
     if (!updateTime.isEmpty()) {
       astronautsText += " (" + updateTime + ")";
     }
@@ -428,87 +439,153 @@ void displayAstronautsDataFromFile() {
       }
       astronautsText += "\n";
     }
-
-    // 更新宇航员标签
-    if (astronauts_label && lv_obj_is_valid(astronauts_label)) {
-      lv_label_set_text(astronauts_label, astronautsText.c_str());
-      lv_obj_clear_flag(astronauts_label, LV_OBJ_FLAG_HIDDEN); // 确保标签可见
-      lv_obj_move_foreground(astronauts_label); // 确保标签显示在最上层
-    }
-  }
-  else {
-    if (astronauts_label && lv_obj_is_valid(astronauts_label)) {
-      lv_label_set_text(astronauts_label, "JSON格式错误：people字段格式不正确");
-      lv_obj_clear_flag(astronauts_label, LV_OBJ_FLAG_HIDDEN); // 确保标签可见
-    }
+    return true;
   }
+  astronautsText = "JSON格式错误：people字段格式不正确";
+  return false;
 }
-//*** 显示新闻信息
-void displayNewsDataFromFile() {
-  Serial.println("从文件显示新闻数据");
-  // 确保news_label已创建和初始化
-  if (!news_label) {
-    Serial.println("news_label未创建，创建并初始化");
-    news_label = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(news_label, GBFont, 0);
-    lv_obj_set_style_text_color(news_label, lv_color_hex(0xFFFFFF), 0);
-    lv_obj_set_width(news_label, screenWidth - 20);
-    lv_obj_set_height(news_label, screenHeight - 120);
-    lv_obj_align(news_label, LV_ALIGN_TOP_LEFT, 10, 100);
-    lv_label_set_long_mode(news_label, LV_LABEL_LONG_WRAP);
-    lv_obj_set_style_radius(news_label, 10, 0);
-    lv_obj_set_style_bg_color(news_label, lv_color_hex(0x000000), 0);
-    lv_obj_set_style_bg_opa(news_label, 100, 0);
-  }
+//*** 显示宇航员信息
+void displayAstronautsDataFromFile() {
+  Serial.println("从文件显示宇航员数据");
   
-  JsonDocument doc;
-  if (!readJsonFromFile("/news.json", doc)) {
-    if (news_label && lv_obj_is_valid(news_label)) {
-      lv_label_set_text(news_label, "无法读取新闻数据文件");
-      lv_obj_clear_flag(news_label, LV_OBJ_FLAG_HIDDEN);
+  // 确保astronauts_label已创建和初始化
+  ScreenLifecycle::getInstance()->ensureBuilt(ASTRONAUTS_SCREEN);
+  
+  String astronautsText;
+  bool ok = buildAstronautsText(astronautsText);
+  
+  // 更新宇航员标签
+  if (astronauts_label && lv_obj_is_valid(astronauts_label)) {
+    lv_label_set_text(astronauts_label, astronautsText.c_str());
+    lv_obj_clear_flag(astronauts_label, LV_OBJ_FLAG_HIDDEN); // 确保标签可见
+    if (ok) {
+      lv_obj_move_foreground(astronauts_label); // 确保标签显示在最上层
     }
+  }
+}
+//*** 加载新闻列表
+// 新闻屏幕使用虚拟化列表，news_label作为列表容器，只为可见行创建标签
+static NewsList newsList;
+// 在新闻列表中显示提示信息
+static void showNewsMessage(const char* message) {
+  if (!news_label || !lv_obj_is_valid(news_label)) {
     return;
   }
-  // 获取更新时间
-  String updateTime = "";
-  if (doc.containsKey("update_time")) {
-    if (doc["update_time"].is<unsigned long>()) {
-      // 将时间戳转换为可读格式
-      unsigned long timestamp = doc["update_time"].as<unsigned long>();
-      time_t now = timestamp / 1000;
-      struct tm *timeinfo = localtime(&now);
-      if (timeinfo != nullptr) {
-        char timeString[20];
-        strftime(timeString, sizeof(timeString), "%Y-%m-%d %H:%M:%S", timeinfo);
-        updateTime = String(timeString);
+  lv_label_set_text_static(news_label, "");
+  newsList.attach(news_label);
+  newsList.setMessage(message);
+}
+/**
+ * 新闻加载作业
+ * 每个切片从Flash读取一段文件到PSRAM缓冲区，读完后用一个切片解析JSON，再用一个切片填充新闻列表
+ */
+class NewsLoadJob : public Job {
+private:
+  File file;            // 新闻数据文件
+  char* buffer;         // 文件内容缓冲区（PSRAM）
+  size_t size;          // 文件大小
+  size_t filled;        // 已读取的字节数
+  JsonDocument doc;     // 解析结果
+
+protected:
+  JobStatus step() override {
+    JOB_BEGIN();
+    file = SPIFFS.open("/news.json", "r");
+    if (!file) {
+      Serial.println("打开文件失败: /news.json");
+      showNewsMessage("无法读取新闻数据文件");
+      return JOB_FAILED;
+    }
+    size = file.size();
+    buffer = (char*)heap_caps_malloc(size + 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (buffer == nullptr) {
+      Serial.printf("新闻数据缓冲区分配失败（%u字节）\n", (unsigned)size);
+      showNewsMessage("无法读取新闻数据文件");
+      return JOB_FAILED;
+    }
+    filled = 0;
+    // 每个切片只读取一段，读取Flash期间时钟和动画照常刷新
+    while (filled < size) {
+      JOB_YIELD();
+      {
+        size_t count = file.read((uint8_t*)buffer + filled, min(NEWS_READ_CHUNK, size - filled));
+        if (count == 0) {
+          Serial.println("读取新闻数据文件失败");
+          showNewsMessage("无法读取新闻数据文件");
+          return JOB_FAILED;
+        }
+        filled += count;
       }
-    } else if (doc["update_time"].is<const char*>()) {
-      updateTime = doc["update_time"].as<const char*>();
     }
-  }
-  String newsText = ""; 
-  // 检查是否有新闻列表
-  if (doc.containsKey("result") && doc["result"].is<JsonArray>()) {
-    JsonArray newsArray = doc["result"].as<JsonArray>();
-    // 显示前几条新闻
-    int displayCount = min(static_cast<int>(newsArray.size()), 18); // 最多显示18条新闻
-    for (int i = 0; i < displayCount; i++) {
-      String newsItem = newsArray[i].as<String>();      
-        newsText += "" + newsItem + "\n";
+    file.close();
+    JOB_YIELD();
+    {
+      // 以const char*传入时ArduinoJson复制字符串，解析后即可释放缓冲区
+      DeserializationError error = deserializeJson(doc, (const char*)buffer, filled);
+      free(buffer);
+      buffer = nullptr;
+      if (error) {
+        Serial.printf("解析JSON失败: /news.json, 错误: %s\n", error.f_str());
+        showNewsMessage("无法读取新闻数据文件");
+        return JOB_FAILED;
+      }
     }
-  } else {
-    // 处理简单的字符串格式新闻数据
-    if (doc.containsKey("result") && doc["result"].is<const char*>()) {
-      newsText += doc["result"].as<const char*>();
+    JOB_YIELD();
+    // 各切片之间屏幕元素可能已被生命周期管理器释放，填充列表前重新确认
+    ScreenLifecycle::getInstance()->ensureBuilt(NEWS_SCREEN);
+    if (!news_label || !lv_obj_is_valid(news_label)) {
+      return JOB_FAILED;
+    }
+    lv_label_set_text_static(news_label, "");
+    newsList.attach(news_label);
+    // 检查是否有新闻列表
+    if (doc.containsKey("result") && doc["result"].is<JsonArray>()) {
+      if (!newsList.loadFromArray(doc["result"].as<JsonArrayConst>())) {
+        return JOB_FAILED;
+      }
+    } else if (doc.containsKey("result") && doc["result"].is<const char*>()) {
+      // 处理简单的字符串格式新闻数据
+      newsList.setMessage(doc["result"].as<const char*>());
     } else {
-      newsText += "暂无新闻内容";
+      newsList.setMessage("暂无新闻内容");
     }
+    JOB_END();
   }
-  // 更新新闻标签
+
+  void cleanup() override {
+    if (file) {
+      file.close();
+    }
+    free(buffer);
+    buffer = nullptr;
+    doc.clear();
+  }
+
+public:
+  NewsLoadJob() : Job("news_load"), buffer(nullptr), size(0), filled(0) {}
+};
+static NewsLoadJob newsLoadJob;
+//*** 获取新闻加载作业
+Job* getNewsLoadJob() {
+  return &newsLoadJob;
+}
+bool loadNewsList() {
+  // 作业已在后台分片执行时直接完成剩余部分，否则从头一次执行完
+  return JobScheduler::getInstance()->finish(&newsLoadJob);
+}
+//*** 显示新闻信息
+void displayNewsDataFromFile() {
+  Serial.println("从文件显示新闻数据");
+  // 确保news_label已创建和初始化
+  ScreenLifecycle::getInstance()->ensureBuilt(NEWS_SCREEN);
+  
+  bool ok = loadNewsList();
+  // 显示新闻列表
   if (news_label && lv_obj_is_valid(news_label)) {
-    lv_label_set_text(news_label, newsText.c_str());
     lv_obj_clear_flag(news_label, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_move_foreground(news_label);
+    if (ok) {
+      lv_obj_move_foreground(news_label);
+    }
   }
 }
 //*** 初始化显示管理器
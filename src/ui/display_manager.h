@@ -2,6 +2,10 @@
 #define DISPLAY_MANAGER_H
 
 #include <Arduino.h>
+#include "manager/job_scheduler.h"
+
+// 新闻加载作业每个切片读取的字节数
+const size_t NEWS_READ_CHUNK = 2048;
 void displayIcibaDataFromFile();     //从文件读取JSON数据并显示金山词霸每日信息
 void displayAstronautsDataFromFile();//从文件读取JSON数据并显示宇航员信息
 void displayNewsDataFromFile();      //从文件读取JSON数据并显示新闻信息
@@ -9,6 +13,17 @@ void displayNoteDataFromFile();      //从文件读取JSON数据并显示留言
 void displayCalendar();              // 显示日历信息
 void initDisplayManager();           //初始化显示管理器
 
+// 构建各屏幕显示文本（只读取数据和拼接文本，不操作LVGL对象，可用于预先准备下一个屏幕）
+bool buildIcibaText(String& icibaText);           //构建金山词霸显示文本
+bool buildAstronautsText(String& astronautsText); //构建宇航员显示文本
+bool buildNoteText(String& noteText);             //构建留言板显示文本
+void buildCalendarText(String& calendarText);     //构建日历显示文本
+bool loadNewsList();                              //加载新闻列表（列表行对象按需复用，可用于预先准备）
+
+// 可分片执行的屏幕准备作业（提交给JobScheduler在换屏间隔中执行，或用JobScheduler::finish立即完成）
+Job* getNewsLoadJob();                            //新闻加载作业
+Job* getCalendarJob();                            //日历准备作业（同时设置日历和今日日期标签）
+
 /* 测试从URL显示图片的功能
  * @param url 图片的URL地址
  */
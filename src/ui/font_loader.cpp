@@ -0,0 +1,808 @@
+#include "font_loader.h"
+#include "cmap_index.h"
+#include <SPIFFS.h>
+#include <ArduinoJson.h>
+#include <algorithm>
+
+// 定义单例实例
+FontLoader* FontLoader::instance = nullptr;
+
+// 字体文件头（head表的内容，与lv_font_loader.c一致）
+struct FontFileHeader {
+    uint32_t version;
+    uint16_t tablesCount;
+    uint16_t fontSize;
+    uint16_t ascent;
+    int16_t descent;
+    uint16_t typoAscent;
+    int16_t typoDescent;
+    uint16_t typoLineGap;
+    int16_t minY;
+    int16_t maxY;
+    uint16_t defaultAdvanceWidth;
+    uint16_t kerningScale;
+    uint8_t indexToLocFormat;
+    uint8_t glyphIdFormat;
+    uint8_t advanceWidthFormat;
+    uint8_t bitsPerPixel;
+    uint8_t xyBits;
+    uint8_t whBits;
+    uint8_t advanceWidthBits;
+    uint8_t compressionId;
+    uint8_t subpixelsMode;
+    uint8_t padding;
+    int16_t underlinePosition;
+    uint16_t underlineThickness;
+};
+
+// cmap子表记录
+struct FontFileCmap {
+    uint32_t dataOffset;
+    uint32_t rangeStart;
+    uint16_t rangeLength;
+    uint16_t glyphIdStart;
+    uint16_t dataEntriesCount;
+    uint8_t formatType;
+    uint8_t padding;
+};
+
+// 按位读取字形记录开头的度量（高位在前）
+struct FontBitReader {
+    const uint8_t* data;
+    uint32_t bitPos;
+
+    uint32_t read(int bits) {
+        uint32_t value = 0;
+        while (bits-- > 0) {
+            value = (value << 1) | ((data[bitPos >> 3] >> (7 - (bitPos & 7))) & 1);
+            bitPos++;
+        }
+        return value;
+    }
+    int32_t readSigned(int bits) {
+        uint32_t value = read(bits);
+        if (bits > 0 && (value & (1u << (bits - 1)))) {
+            value |= ~0u << bits;
+        }
+        return (int32_t)value;
+    }
+};
+
+//*** 在PSRAM中分配并清零
+static void* allocTable(size_t bytes) {
+    void* table = heap_caps_malloc(bytes > 0 ? bytes : 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (table != nullptr) {
+        memset(table, 0, bytes);
+    }
+    return table;
+}
+//*** 私有构造函数
+FontLoader::FontLoader() {
+    fontCount = 0;
+    missingCount = 0;
+    for (int i = 0; i < FONT_GLYPH_CACHE_BUCKETS; i++) {
+        buckets[i] = -1;
+    }
+    for (int i = 0; i < FONT_GLYPH_CACHE_ENTRIES; i++) {
+        entries[i].bitmap = nullptr;
+        entries[i].next = i + 1 < FONT_GLYPH_CACHE_ENTRIES ? i + 1 : -1;
+    }
+    freeHead = 0;
+    lruHead = -1;
+    lruTail = -1;
+    cacheBytes = 0;
+    evictions = 0;
+}
+//*** 获取单例实例
+FontLoader* FontLoader::getInstance() {
+    if (instance == nullptr) {
+        instance = new FontLoader();
+    }
+    return instance;
+}
+//*** 读取表头
+int32_t FontLoader::readLabel(File& file, uint32_t start, const char* label) {
+    uint8_t buf[8];
+    if (!file.seek(start) || file.read(buf, 8) != 8 || memcmp(buf + 4, label, 4) != 0) {
+        return -1;
+    }
+    return buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+//*** 按名称获取字体
+const lv_font_t* FontLoader::font(const char* name, const lv_font_t* fallback) {
+    for (int i = 0; i < fontCount; i++) {
+        if (fonts[i].source == nullptr && strcmp(fonts[i].name, name) == 0) {
+            return &fonts[i].font;
+        }
+    }
+    // 压缩的字体使用解压字形缓存
+    fallback = wrap(name, fallback);
+    for (int i = 0; i < missingCount; i++) {
+        if (strcmp(missing[i], name) == 0) {
+            return fallback;
+        }
+    }
+    if (strlen(name) >= FONT_LOADER_NAME_SIZE) {
+        return fallback;
+    }
+    char path[40];
+    snprintf(path, sizeof(path), FONT_LOADER_DIR "%s.bin", name);
+    if (fontCount < FONT_LOADER_MAX_FONTS && SPIFFS.exists(path)) {
+        LoadedFont& loaded = fonts[fontCount];
+        unsigned long startTime = millis();
+        if (load(loaded, files[fontCount], path)) {
+            strcpy(loaded.name, name);
+            loaded.loadMillis = millis() - startTime;
+            // 字体中没有的字符使用原来的字体
+            loaded.font.fallback = fallback;
+            fontCount++;
+            loaded.rawBytes = measureRawBytes(loaded);
+            buildCmapIndex(loaded);
+            Serial.printf("已加载字体%s：%u个字形，表占用%u字节，耗时%lu ms\n", name, (unsigned)loaded.glyphCount,
+                          (unsigned)loaded.tableBytes, (unsigned long)loaded.loadMillis);
+            return &loaded.font;
+        }
+        Serial.printf("字体文件%s无效\n", path);
+    }
+    if (missingCount < FONT_LOADER_MAX_FONTS) {
+        strcpy(missing[missingCount++], name);
+    }
+    return fallback;
+}
+//*** 把压缩或字形多的字体包装为使用字形缓存或直接索引的字体
+const lv_font_t* FontLoader::wrap(const char* name, const lv_font_t* font) {
+    if (font == nullptr || font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt) {
+        return font;
+    }
+    const lv_font_fmt_txt_dsc_t* dsc = (const lv_font_fmt_txt_dsc_t*)font->dsc;
+    bool compressed = dsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN;
+    if (!compressed && countGlyphs(*dsc) < FONT_CMAP_INDEX_MIN_GLYPHS) {
+        return font;
+    }
+    for (int i = 0; i < fontCount; i++) {
+        if (fonts[i].source == font) {
+            return &fonts[i].font;
+        }
+    }
+    if (fontCount >= FONT_LOADER_MAX_FONTS) {
+        // 没有空闲位置时使用原字体（压缩的字体由LVGL在每次绘制时解压）
+        return font;
+    }
+    LoadedFont& loaded = fonts[fontCount];
+    memset(&loaded, 0, sizeof(LoadedFont));
+    strncpy(loaded.name, name, FONT_LOADER_NAME_SIZE - 1);
+    loaded.source = font;
+    // 共用原字体的cmap表、字形描述和位图，压缩的字体替换获取位图的回调
+    loaded.font = *font;
+    loaded.dsc = *dsc;
+    loaded.dsc.cache = &loaded.lookupCache;
+    loaded.font.dsc = &loaded.dsc;
+    if (compressed) {
+        loaded.font.get_glyph_bitmap = glyphBitmapCallback;
+    }
+    loaded.font.user_data = &loaded;
+    loaded.glyphCount = countGlyphs(loaded.dsc);
+    loaded.rawBytes = measureRawBytes(loaded);
+    // 位图的大小（最后一个字形位图的起始位置）
+    for (uint32_t i = 1; i < loaded.glyphCount; i++) {
+        loaded.glyfLength = std::max(loaded.glyfLength, (uint32_t)loaded.dsc.glyph_dsc[i].bitmap_index);
+    }
+    fontCount++;
+    if (compressed) {
+        Serial.printf("压缩字体%s使用解压字形缓存：%u个字形，位图%u字节，未压缩%u字节\n", name, (unsigned)loaded.glyphCount,
+                      (unsigned)loaded.glyfLength, (unsigned)loaded.rawBytes);
+    }
+    buildCmapIndex(loaded);
+    return &loaded.font;
+}
+//*** 建立cmap表的直接索引
+void FontLoader::buildCmapIndex(LoadedFont& loaded) {
+    if (loaded.glyphCount < FONT_CMAP_INDEX_MIN_GLYPHS) {
+        return;
+    }
+    unsigned long startTime = micros();
+    int usedPages = 0;
+    loaded.indexBytes = cmapIndexBuild(loaded.dsc, loaded.cmapIndex, usedPages, allocTable, heap_caps_free);
+    if (loaded.indexBytes == 0) {
+        return;
+    }
+    loaded.dsc.cmap_index = &loaded.cmapIndex;
+    Serial.printf("字体%s的cmap直接索引：%d页，占用%u字节，耗时%lu us\n", loaded.name, usedPages,
+                  (unsigned)loaded.indexBytes, micros() - startTime);
+}
+//*** 释放cmap表的直接索引
+void FontLoader::releaseCmapIndex(LoadedFont& loaded) {
+    cmapIndexRelease(loaded.cmapIndex, heap_caps_free);
+    loaded.dsc.cmap_index = nullptr;
+    loaded.indexBytes = 0;
+}
+//*** 由cmap表计算字形数量
+uint32_t FontLoader::countGlyphs(const lv_font_fmt_txt_dsc_t& dsc) {
+    uint32_t count = 0;
+    for (int i = 0; i < dsc.cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t& cmap = dsc.cmaps[i];
+        uint32_t end = cmap.glyph_id_start;
+        switch (cmap.type) {
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+                end += cmap.range_length;
+                break;
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+                end += cmap.list_length;
+                break;
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+                for (uint32_t k = 0; k < cmap.list_length; k++) {
+                    end = std::max(end, cmap.glyph_id_start + ((const uint8_t*)cmap.glyph_id_ofs_list)[k] + 1u);
+                }
+                break;
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+                for (uint32_t k = 0; k < cmap.list_length; k++) {
+                    end = std::max(end, cmap.glyph_id_start + ((const uint16_t*)cmap.glyph_id_ofs_list)[k] + 1u);
+                }
+                break;
+        }
+        count = std::max(count, end);
+    }
+    return count;
+}
+//*** 所有字形未压缩的位图大小
+uint32_t FontLoader::measureRawBytes(const LoadedFont& loaded) {
+    uint32_t bytes = 0;
+    for (uint32_t i = 1; i < loaded.glyphCount; i++) {
+        const lv_font_fmt_txt_glyph_dsc_t& glyph = loaded.dsc.glyph_dsc[i];
+        bytes += (glyph.box_w * glyph.box_h * loaded.dsc.bpp + 7) / 8;
+    }
+    return bytes;
+}
+//*** 从SPIFFS加载字体
+bool FontLoader::load(LoadedFont& loaded, File& file, const char* path) {
+    memset(&loaded, 0, sizeof(LoadedFont));
+    file = SPIFFS.open(path, "r");
+    loaded.file = &file;
+    if (!file) {
+        return false;
+    }
+    // head表
+    int32_t headLength = readLabel(*loaded.file, 0, "head");
+    uint8_t header[sizeof(FontFileHeader)];
+    if (headLength < (int32_t)(8 + sizeof(header)) || loaded.file->read(header, sizeof(header)) != sizeof(header)) {
+        release(loaded);
+        return false;
+    }
+    FontFileHeader head;
+    memcpy(&head, header, sizeof(head));
+    // 压缩方式：0未压缩，1游程编码加行间异或，2只有游程编码
+    if (head.compressionId > 2 || head.indexToLocFormat > 1) {
+        release(loaded);
+        return false;
+    }
+    loaded.font.get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    loaded.font.get_glyph_bitmap = glyphBitmapCallback;
+    loaded.font.line_height = head.ascent - head.descent;
+    loaded.font.base_line = -head.descent;
+    loaded.font.subpx = head.subpixelsMode;
+    loaded.font.underline_position = head.underlinePosition;
+    loaded.font.underline_thickness = head.underlineThickness;
+    loaded.font.dsc = &loaded.dsc;
+    loaded.font.user_data = &loaded;
+    loaded.dsc.bpp = head.bitsPerPixel;
+    loaded.dsc.kern_scale = head.kerningScale;
+    loaded.dsc.bitmap_format = head.compressionId;
+    loaded.dsc.cache = &loaded.lookupCache;
+    // cmap表
+    uint32_t cmapLength = 0;
+    if (!loadCmaps(loaded, headLength, cmapLength)) {
+        release(loaded);
+        return false;
+    }
+    // loca表和字形描述
+    if (!loadGlyphs(loaded, headLength + cmapLength, header)) {
+        release(loaded);
+        return false;
+    }
+    // 字距表
+    if (head.tablesCount >= 4 && !loadKern(loaded, loaded.glyfStart + loaded.glyfLength, head.glyphIdFormat)) {
+        release(loaded);
+        return false;
+    }
+    return true;
+}
+//*** 读取cmap表
+bool FontLoader::loadCmaps(LoadedFont& loaded, uint32_t start, uint32_t& length) {
+    int32_t tableLength = readLabel(*loaded.file, start, "cmap");
+    uint32_t count = 0;
+    if (tableLength < 0 || loaded.file->read((uint8_t*)&count, 4) != 4 || count == 0 || count > 256) {
+        return false;
+    }
+    length = tableLength;
+    lv_font_fmt_txt_cmap_t* cmaps = (lv_font_fmt_txt_cmap_t*)allocTable(sizeof(lv_font_fmt_txt_cmap_t) * count);
+    if (cmaps == nullptr) {
+        return false;
+    }
+    loaded.dsc.cmaps = cmaps;
+    loaded.dsc.cmap_num = count;
+    loaded.tableBytes += sizeof(lv_font_fmt_txt_cmap_t) * count;
+    for (uint32_t i = 0; i < count; i++) {
+        // 子表记录紧跟在子表数量之后，数据在各自的偏移处
+        FontFileCmap record;
+        if (!loaded.file->seek(start + 12 + sizeof(FontFileCmap) * i) ||
+            loaded.file->read((uint8_t*)&record, sizeof(record)) != sizeof(record)) {
+            return false;
+        }
+        lv_font_fmt_txt_cmap_t& cmap = cmaps[i];
+        cmap.range_start = record.rangeStart;
+        cmap.range_length = record.rangeLength;
+        cmap.glyph_id_start = record.glyphIdStart;
+        cmap.type = (lv_font_fmt_txt_cmap_type_t)record.formatType;
+        if (!loaded.file->seek(start + record.dataOffset)) {
+            return false;
+        }
+        size_t listBytes = 0;
+        switch (record.formatType) {
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+                break;
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: {
+                listBytes = record.dataEntriesCount;
+                uint8_t* ids = (uint8_t*)allocTable(listBytes);
+                cmap.glyph_id_ofs_list = ids;
+                cmap.list_length = cmap.range_length;
+                if (ids == nullptr || loaded.file->read(ids, listBytes) != listBytes) {
+                    return false;
+                }
+                break;
+            }
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL: {
+                listBytes = sizeof(uint16_t) * record.dataEntriesCount;
+                uint16_t* unicodes = (uint16_t*)allocTable(listBytes);
+                cmap.unicode_list = unicodes;
+                cmap.list_length = record.dataEntriesCount;
+                if (unicodes == nullptr || loaded.file->read((uint8_t*)unicodes, listBytes) != listBytes) {
+                    return false;
+                }
+                if (record.formatType == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+                    uint16_t* ids = (uint16_t*)allocTable(listBytes);
+                    cmap.glyph_id_ofs_list = ids;
+                    if (ids == nullptr || loaded.file->read((uint8_t*)ids, listBytes) != listBytes) {
+                        return false;
+                    }
+                    listBytes *= 2;
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+        loaded.tableBytes += listBytes;
+    }
+    return true;
+}
+//*** 读取loca表和每个字形的度量，字形位图留在文件中
+bool FontLoader::loadGlyphs(LoadedFont& loaded, uint32_t locaStart, const uint8_t* header) {
+    FontFileHeader head;
+    memcpy(&head, header, sizeof(head));
+    int32_t locaLength = readLabel(*loaded.file, locaStart, "loca");
+    uint32_t count = 0;
+    if (locaLength < 0 || loaded.file->read((uint8_t*)&count, 4) != 4 || count == 0) {
+        return false;
+    }
+    size_t offsetSize = head.indexToLocFormat == 0 ? 2 : 4;
+    uint8_t* offsets = (uint8_t*)allocTable(offsetSize * count);
+    if (offsets == nullptr || loaded.file->read(offsets, offsetSize * count) != offsetSize * count) {
+        heap_caps_free(offsets);
+        return false;
+    }
+    loaded.glyfStart = locaStart + locaLength;
+    int32_t glyfLength = readLabel(*loaded.file, loaded.glyfStart, "glyf");
+    lv_font_fmt_txt_glyph_dsc_t* glyphs =
+        (lv_font_fmt_txt_glyph_dsc_t*)allocTable(sizeof(lv_font_fmt_txt_glyph_dsc_t) * count);
+    if (glyfLength < 0 || glyphs == nullptr) {
+        heap_caps_free(offsets);
+        heap_caps_free(glyphs);
+        return false;
+    }
+    loaded.dsc.glyph_dsc = glyphs;
+    loaded.glyfLength = glyfLength;
+    loaded.glyphCount = count;
+    loaded.headerBits = head.advanceWidthBits + 2 * head.xyBits + 2 * head.whBits;
+    loaded.tableBytes += sizeof(lv_font_fmt_txt_glyph_dsc_t) * count;
+    // 顺序读取字形表，每次读取一块，只解析每个字形开头的度量
+    const uint32_t windowSize = 4096;
+    uint8_t* window = (uint8_t*)malloc(windowSize);
+    uint32_t windowStart = 0;
+    uint32_t windowLength = 0;
+    uint32_t headerBytes = (loaded.headerBits + 7) / 8;
+    bool ok = window != nullptr;
+    for (uint32_t i = 0; i < count && ok; i++) {
+        uint32_t offset = offsetSize == 2 ? ((uint16_t*)offsets)[i] : ((uint32_t*)offsets)[i];
+        uint32_t next = i + 1 < count ? (offsetSize == 2 ? ((uint16_t*)offsets)[i + 1] : ((uint32_t*)offsets)[i + 1])
+                                      : (uint32_t)glyfLength;
+        lv_font_fmt_txt_glyph_dsc_t& glyph = glyphs[i];
+        // 字形在文件中的位置（相对字形表），绘制时按需读取
+        glyph.bitmap_index = offset;
+        if (i == 0 || next <= offset) {
+            continue;
+        }
+        if (offset < windowStart || offset + headerBytes > windowStart + windowLength) {
+            windowStart = offset;
+            windowLength = loaded.file->seek(loaded.glyfStart + offset) ? loaded.file->read(window, windowSize) : 0;
+            if (windowLength < headerBytes) {
+                ok = false;
+                break;
+            }
+        }
+        FontBitReader reader = {window + (offset - windowStart), 0};
+        uint32_t advance = head.advanceWidthBits == 0 ? head.defaultAdvanceWidth : reader.read(head.advanceWidthBits);
+        glyph.adv_w = head.advanceWidthFormat == 0 ? advance * 16 : advance;
+        glyph.ofs_x = reader.readSigned(head.xyBits);
+        glyph.ofs_y = reader.readSigned(head.xyBits);
+        glyph.box_w = reader.read(head.whBits);
+        glyph.box_h = reader.read(head.whBits);
+    }
+    free(window);
+    heap_caps_free(offsets);
+    return ok;
+}
+//*** 读取字距表
+bool FontLoader::loadKern(LoadedFont& loaded, uint32_t start, uint8_t glyphIdFormat) {
+    int32_t kernLength = readLabel(*loaded.file, start, "kern");
+    uint8_t format[4];
+    if (kernLength < 0 || loaded.file->read(format, 4) != 4) {
+        return false;
+    }
+    if (format[0] == 0) {
+        // 排序的字形对
+        uint32_t pairCount = 0;
+        if (loaded.file->read((uint8_t*)&pairCount, 4) != 4) {
+            return false;
+        }
+        lv_font_fmt_txt_kern_pair_t* pairs = (lv_font_fmt_txt_kern_pair_t*)allocTable(sizeof(lv_font_fmt_txt_kern_pair_t));
+        if (pairs == nullptr) {
+            return false;
+        }
+        loaded.dsc.kern_dsc = pairs;
+        loaded.dsc.kern_classes = 0;
+        size_t idsBytes = (glyphIdFormat == 0 ? 2 : 4) * pairCount;
+        uint8_t* ids = (uint8_t*)allocTable(idsBytes);
+        int8_t* values = (int8_t*)allocTable(pairCount);
+        pairs->glyph_ids_size = glyphIdFormat;
+        pairs->pair_cnt = pairCount;
+        pairs->glyph_ids = ids;
+        pairs->values = values;
+        loaded.tableBytes += idsBytes + pairCount;
+        return ids != nullptr && values != nullptr && loaded.file->read(ids, idsBytes) == idsBytes &&
+               loaded.file->read((uint8_t*)values, pairCount) == pairCount;
+    }
+    if (format[0] == 3) {
+        // 字距分类表
+        uint8_t sizes[4];
+        if (loaded.file->read(sizes, 4) != 4) {
+            return false;
+        }
+        uint16_t mappingLength = sizes[0] | (sizes[1] << 8);
+        uint8_t rows = sizes[2];
+        uint8_t cols = sizes[3];
+        lv_font_fmt_txt_kern_classes_t* classes =
+            (lv_font_fmt_txt_kern_classes_t*)allocTable(sizeof(lv_font_fmt_txt_kern_classes_t));
+        if (classes == nullptr) {
+            return false;
+        }
+        loaded.dsc.kern_dsc = classes;
+        loaded.dsc.kern_classes = 1;
+        uint8_t* left = (uint8_t*)allocTable(mappingLength);
+        uint8_t* right = (uint8_t*)allocTable(mappingLength);
+        int8_t* values = (int8_t*)allocTable(rows * cols);
+        classes->left_class_mapping = left;
+        classes->right_class_mapping = right;
+        classes->left_class_cnt = rows;
+        classes->right_class_cnt = cols;
+        classes->class_pair_values = values;
+        loaded.tableBytes += mappingLength * 2 + rows * cols;
+        return left != nullptr && right != nullptr && values != nullptr &&
+               loaded.file->read(left, mappingLength) == mappingLength &&
+               loaded.file->read(right, mappingLength) == mappingLength &&
+               loaded.file->read((uint8_t*)values, rows * cols) == (size_t)(rows * cols);
+    }
+    return false;
+}
+//*** 释放字体占用的内存
+void FontLoader::release(LoadedFont& loaded) {
+    releaseCmapIndex(loaded);
+    lv_font_fmt_txt_dsc_t& dsc = loaded.dsc;
+    if (dsc.cmaps != nullptr) {
+        for (int i = 0; i < dsc.cmap_num; i++) {
+            heap_caps_free((void*)dsc.cmaps[i].unicode_list);
+            heap_caps_free((void*)dsc.cmaps[i].glyph_id_ofs_list);
+        }
+        heap_caps_free((void*)dsc.cmaps);
+    }
+    if (dsc.kern_dsc != nullptr) {
+        if (dsc.kern_classes) {
+            const lv_font_fmt_txt_kern_classes_t* classes = (const lv_font_fmt_txt_kern_classes_t*)dsc.kern_dsc;
+            heap_caps_free((void*)classes->left_class_mapping);
+            heap_caps_free((void*)classes->right_class_mapping);
+            heap_caps_free((void*)classes->class_pair_values);
+        } else {
+            const lv_font_fmt_txt_kern_pair_t* pairs = (const lv_font_fmt_txt_kern_pair_t*)dsc.kern_dsc;
+            heap_caps_free((void*)pairs->glyph_ids);
+            heap_caps_free((void*)pairs->values);
+        }
+        heap_caps_free((void*)dsc.kern_dsc);
+    }
+    heap_caps_free((void*)dsc.glyph_dsc);
+    if (loaded.file != nullptr && *loaded.file) {
+        loaded.file->close();
+    }
+    memset(&dsc, 0, sizeof(dsc));
+}
+//*** 字形缓存的哈希值
+uint32_t FontLoader::hashKey(uint8_t fontIndex, uint32_t glyphId) {
+    return (glyphId * 2654435761u + fontIndex) >> 16;
+}
+//*** 查找缓存的字形
+int16_t FontLoader::findGlyph(uint8_t fontIndex, uint32_t glyphId) {
+    int16_t index = buckets[hashKey(fontIndex, glyphId) & (FONT_GLYPH_CACHE_BUCKETS - 1)];
+    while (index >= 0) {
+        const GlyphEntry& entry = entries[index];
+        if (entry.glyphId == glyphId && entry.fontIndex == fontIndex) {
+            return index;
+        }
+        index = entry.hashNext;
+    }
+    return -1;
+}
+//*** 从最近使用链表中移除
+void FontLoader::unlinkGlyph(int16_t index) {
+    GlyphEntry& entry = entries[index];
+    if (entry.prev >= 0) {
+        entries[entry.prev].next = entry.next;
+    } else {
+        lruHead = entry.next;
+    }
+    if (entry.next >= 0) {
+        entries[entry.next].prev = entry.prev;
+    } else {
+        lruTail = entry.prev;
+    }
+}
+//*** 移到最近使用链表的头部
+void FontLoader::touchGlyph(int16_t index) {
+    if (lruHead == index) {
+        return;
+    }
+    unlinkGlyph(index);
+    GlyphEntry& entry = entries[index];
+    entry.prev = -1;
+    entry.next = lruHead;
+    if (lruHead >= 0) {
+        entries[lruHead].prev = index;
+    }
+    lruHead = index;
+    if (lruTail < 0) {
+        lruTail = index;
+    }
+}
+//*** 释放最久未使用的字形
+void FontLoader::evictOldest() {
+    int16_t index = lruTail;
+    if (index < 0) {
+        return;
+    }
+    GlyphEntry& entry = entries[index];
+    unlinkGlyph(index);
+    // 从哈希桶中移除
+    int16_t* link = &buckets[hashKey(entry.fontIndex, entry.glyphId) & (FONT_GLYPH_CACHE_BUCKETS - 1)];
+    while (*link != index) {
+        link = &entries[*link].hashNext;
+    }
+    *link = entry.hashNext;
+    heap_caps_free(entry.bitmap);
+    cacheBytes -= entry.size;
+    entry.bitmap = nullptr;
+    entry.next = freeHead;
+    freeHead = index;
+    evictions++;
+}
+//*** 把字形放入缓存，返回缓存中的位图
+const uint8_t* FontLoader::insertGlyph(uint8_t fontIndex, uint32_t glyphId, uint8_t* bitmap, uint32_t size) {
+    while (lruTail >= 0 && (freeHead < 0 || cacheBytes + size > FONT_GLYPH_CACHE_BUDGET)) {
+        evictOldest();
+    }
+    int16_t index = freeHead;
+    GlyphEntry& entry = entries[index];
+    freeHead = entry.next;
+    entry.bitmap = bitmap;
+    entry.size = size;
+    entry.glyphId = glyphId;
+    entry.fontIndex = fontIndex;
+    int16_t* bucket = &buckets[hashKey(fontIndex, glyphId) & (FONT_GLYPH_CACHE_BUCKETS - 1)];
+    entry.hashNext = *bucket;
+    *bucket = index;
+    entry.prev = -1;
+    entry.next = lruHead;
+    if (lruHead >= 0) {
+        entries[lruHead].prev = index;
+    }
+    lruHead = index;
+    if (lruTail < 0) {
+        lruTail = index;
+    }
+    cacheBytes += size;
+    return bitmap;
+}
+//*** 从文件读取字形位图
+uint8_t* FontLoader::readGlyph(LoadedFont& loaded, uint32_t glyphId, uint32_t& size) {
+    const lv_font_fmt_txt_glyph_dsc_t* glyphs = loaded.dsc.glyph_dsc;
+    uint32_t offset = glyphs[glyphId].bitmap_index;
+    uint32_t end = glyphId + 1 < loaded.glyphCount ? glyphs[glyphId + 1].bitmap_index : loaded.glyfLength;
+    uint32_t skip = loaded.headerBits / 8;
+    uint8_t shift = loaded.headerBits % 8;
+    if (end <= offset + skip) {
+        return nullptr;
+    }
+    uint32_t recordSize = end - offset;
+    size = recordSize - skip;
+    uint8_t* record = (uint8_t*)lv_mem_buf_get(recordSize);
+    // 多分配一个字节：解压压缩的位图时可能多读一个字节
+    uint8_t* bitmap = (uint8_t*)heap_caps_malloc(size + 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    bool ok = record != nullptr && bitmap != nullptr && loaded.file->seek(loaded.glyfStart + offset) &&
+              loaded.file->read(record, recordSize) == recordSize;
+    if (ok) {
+        // 位图紧跟在度量之后，不一定从字节边界开始
+        bitmap[size] = 0;
+        if (shift == 0) {
+            memcpy(bitmap, record + skip, size);
+        } else {
+            for (uint32_t i = 0; i < size; i++) {
+                uint8_t low = i + 1 < size ? record[skip + i + 1] >> (8 - shift) : 0;
+                bitmap[i] = (record[skip + i] << shift) | low;
+            }
+        }
+    } else {
+        heap_caps_free(bitmap);
+        bitmap = nullptr;
+    }
+    if (record != nullptr) {
+        lv_mem_buf_release(record);
+    }
+    loaded.bytesRead += recordSize;
+    return bitmap;
+}
+//*** 解压字形位图
+uint8_t* FontLoader::decompressGlyph(const LoadedFont& loaded, uint32_t glyphId, const uint8_t* data, uint32_t& size) {
+    const lv_font_fmt_txt_glyph_dsc_t& glyph = loaded.dsc.glyph_dsc[glyphId];
+    // 3位的字形解压为4位
+    uint8_t bpp = loaded.dsc.bpp == 3 ? 4 : loaded.dsc.bpp;
+    size = (glyph.box_w * glyph.box_h * bpp + 7) / 8;
+    if (size == 0) {
+        return nullptr;
+    }
+    uint8_t* bitmap = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (bitmap != nullptr) {
+        lv_font_decompress_fmt_txt(data, bitmap, glyph.box_w, glyph.box_h, loaded.dsc.bpp,
+                                   loaded.dsc.bitmap_format == LV_FONT_FMT_TXT_COMPRESSED);
+    }
+    return bitmap;
+}
+//*** 从缓存或文件获取字形位图
+const uint8_t* FontLoader::glyphBitmapCallback(const lv_font_t* font, uint32_t letter) {
+    FontLoader* self = getInstance();
+    LoadedFont* loaded = (LoadedFont*)font->user_data;
+    if (letter == '\t') {
+        letter = ' ';
+    }
+    uint32_t glyphId = lv_font_get_glyph_id_fmt_txt(font, letter);
+    if (glyphId == 0) {
+        return nullptr;
+    }
+    uint8_t fontIndex = loaded - self->fonts;
+    int16_t index = self->findGlyph(fontIndex, glyphId);
+    if (index >= 0) {
+        loaded->hits++;
+        self->touchGlyph(index);
+        return self->entries[index].bitmap;
+    }
+    // 未命中：从文件读取或从Flash解压，位图在下次获取字形前有效，LVGL取得后立即绘制
+    unsigned long startTime = micros();
+    uint32_t size = 0;
+    uint8_t* bitmap;
+    if (loaded->source != nullptr) {
+        const uint8_t* data = &loaded->dsc.glyph_bitmap[loaded->dsc.glyph_dsc[glyphId].bitmap_index];
+        bitmap = decompressGlyph(*loaded, glyphId, data, size);
+    } else {
+        bitmap = self->readGlyph(*loaded, glyphId, size);
+        if (bitmap != nullptr && loaded->dsc.bitmap_format != LV_FONT_FMT_TXT_PLAIN) {
+            uint8_t* compressed = bitmap;
+            bitmap = decompressGlyph(*loaded, glyphId, compressed, size);
+            heap_caps_free(compressed);
+        }
+    }
+    loaded->misses++;
+    loaded->missMicros += micros() - startTime;
+    if (bitmap == nullptr) {
+        return nullptr;
+    }
+    return self->insertGlyph(fontIndex, glyphId, bitmap, size);
+}
+//*** 字体是否为本类加载的字体
+bool FontLoader::isLoaded(const lv_font_t* font) {
+    for (int i = 0; i < fontCount; i++) {
+        if (font == &fonts[i].font) {
+            return true;
+        }
+    }
+    return false;
+}
+//*** 字体是否使用本类的字形缓存
+bool FontLoader::usesGlyphCache(const lv_font_t* font) {
+    return isLoaded(font) && font->get_glyph_bitmap == glyphBitmapCallback;
+}
+//*** 启用或停用cmap直接索引
+void FontLoader::enableCmapIndex(bool enable) {
+    for (int i = 0; i < fontCount; i++) {
+        if (fonts[i].cmapIndex.pages != nullptr) {
+            fonts[i].dsc.cmap_index = enable ? &fonts[i].cmapIndex : nullptr;
+        }
+    }
+}
+//*** 包装的原字体
+const lv_font_t* FontLoader::getSourceFont(const lv_font_t* font) {
+    for (int i = 0; i < fontCount; i++) {
+        if (font == &fonts[i].font) {
+            return fonts[i].source;
+        }
+    }
+    return nullptr;
+}
+//*** 清空字形缓存
+void FontLoader::clearCache() {
+    while (lruTail >= 0) {
+        evictOldest();
+    }
+}
+//*** 字形缓存的命中次数和未命中次数
+void FontLoader::getCacheCounts(uint32_t& hits, uint32_t& misses) {
+    hits = 0;
+    misses = 0;
+    for (int i = 0; i < fontCount; i++) {
+        hits += fonts[i].hits;
+        misses += fonts[i].misses;
+    }
+}
+//*** 生成统计JSON
+String FontLoader::getStatsJson() {
+    JsonDocument doc;
+    int cached = 0;
+    for (int16_t index = lruHead; index >= 0; index = entries[index].next) {
+        cached++;
+    }
+    JsonObject cache = doc["glyph_cache"].to<JsonObject>();
+    cache["budget_bytes"] = FONT_GLYPH_CACHE_BUDGET;
+    cache["used_bytes"] = cacheBytes;
+    cache["glyphs"] = cached;
+    cache["evictions"] = evictions;
+    JsonArray list = doc["fonts"].to<JsonArray>();
+    for (int i = 0; i < fontCount; i++) {
+        const LoadedFont& loaded = fonts[i];
+        uint32_t lookups = loaded.hits + loaded.misses;
+        JsonObject item = list.add<JsonObject>();
+        item["name"] = loaded.name;
+        item["glyphs"] = loaded.glyphCount;
+        item["bpp"] = loaded.dsc.bpp;
+        item["source"] = loaded.source != nullptr ? "flash" : "spiffs";
+        item["compressed"] = loaded.dsc.bitmap_format != LV_FONT_FMT_TXT_PLAIN;
+        item["line_height"] = loaded.font.line_height;
+        item["table_bytes"] = loaded.tableBytes;
+        item["cmap_index_bytes"] = loaded.indexBytes;
+        item["bitmap_bytes"] = loaded.glyfLength;
+        item["raw_bitmap_bytes"] = loaded.rawBytes;
+        item["load_ms"] = loaded.loadMillis;
+        item["hits"] = loaded.hits;
+        item["misses"] = loaded.misses;
+        item["hit_rate"] = lookups > 0 ? (float)loaded.hits / lookups : 0;
+        item["avg_miss_us"] = loaded.misses > 0 ? (uint32_t)(loaded.missMicros / loaded.misses) : 0;
+        item["bytes_read"] = loaded.bytesRead;
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
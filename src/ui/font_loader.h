@@ -0,0 +1,159 @@
+#ifndef FONT_LOADER_H
+#define FONT_LOADER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <FS.h>
+
+// SPIFFS中字体文件的位置：<目录><名称>.bin（lv_font_conv --format bin生成，与lv_font_load的格式相同）
+#define FONT_LOADER_DIR "/fonts/"
+// 最多加载的字体数量（包括使用解压字形缓存的压缩字体）
+const int FONT_LOADER_MAX_FONTS = 6;
+const int FONT_LOADER_NAME_SIZE = 16;
+// 字形位图缓存的PSRAM预算（字节），超出时按最近最少使用顺序释放
+const size_t FONT_GLYPH_CACHE_BUDGET = 96 * 1024;
+// 最多缓存的字形数量和哈希表大小（2的幂）
+const int FONT_GLYPH_CACHE_ENTRIES = 1024;
+const int FONT_GLYPH_CACHE_BUCKETS = 1024;
+// 字形数不少于此值的字体建立cmap直接索引（每256个字符一页，只为有字形的页分配）
+const uint32_t FONT_CMAP_INDEX_MIN_GLYPHS = 1000;
+
+/**
+ * 运行时字体加载类
+ * 从SPIFFS加载LVGL二进制字体：加载时只把cmap表和字形描述（度量和字形在文件中的位置）读入PSRAM，
+ * 字形位图在绘制时按需从文件读取，放入有预算的PSRAM缓存，按最近最少使用顺序释放。
+ * 常用汉字的位图很快都在缓存中，其余几千个字形不占用内存；按名称查找的字体不存在时使用资源分区或编译进固件的字体。
+ * 压缩的字体（lv_font_conv不加--no-compress生成）位图约小一半，但LVGL每次绘制字形都要重新解压；
+ * 这类字体包装为共用cmap表和字形描述的字体，字形第一次绘制时解压并放入同一个缓存，之后直接使用解压的位图。
+ * LVGL每次测量和绘制字形都要在cmap表中二分查找字符；字形多的汉字字体加载或包装时建立从字符到字形编号的直接索引
+ */
+class FontLoader {
+private:
+    static FontLoader* instance;   // 单例实例
+
+    // 加载的字体
+    struct LoadedFont {
+        char name[FONT_LOADER_NAME_SIZE];
+        lv_font_t font;            // 字体（get_glyph_bitmap为本类的回调）
+        const lv_font_t* source;   // 包装的压缩字体（资源分区或固件中），从SPIFFS加载的字体为空
+        lv_font_fmt_txt_dsc_t dsc; // cmap表和字形描述，与编译进固件的字体格式相同
+        lv_font_fmt_txt_glyph_cache_t lookupCache; // 最近查找的字符
+        lv_font_fmt_txt_cmap_index_t cmapIndex;    // cmap表的直接索引（页在PSRAM中），字形少的字体为空
+        uint32_t indexBytes;       // 直接索引占用的内存
+        File* file;                // 字体文件（保持打开，按需读取字形）
+        uint32_t glyfStart;        // 字形表在文件中的位置
+        uint32_t glyfLength;       // 字形表长度
+        uint32_t glyphCount;       // 字形数量
+        uint8_t headerBits;        // 每个字形记录开头的度量所占的位数
+        uint32_t tableBytes;       // cmap表和字形描述占用的内存
+        uint32_t rawBytes;         // 所有字形未压缩的位图大小
+        uint32_t loadMillis;       // 加载耗时
+        uint32_t hits;             // 字形缓存命中次数
+        uint32_t misses;           // 字形缓存未命中（从文件读取）次数
+        uint64_t missMicros;       // 从文件读取字形的累计耗时
+        uint32_t bytesRead;        // 从文件读取的字形字节数
+    };
+    LoadedFont fonts[FONT_LOADER_MAX_FONTS];
+    File files[FONT_LOADER_MAX_FONTS];
+    int fontCount;
+
+    // 找不到文件或加载失败的字体名称（不再重复尝试）
+    char missing[FONT_LOADER_MAX_FONTS][FONT_LOADER_NAME_SIZE];
+    int missingCount;
+
+    // 字形缓存条目（按字体和字形编号查找）
+    struct GlyphEntry {
+        uint8_t* bitmap;           // 字形位图（PSRAM），为空表示空闲条目
+        uint32_t size;
+        uint32_t glyphId;
+        uint8_t fontIndex;
+        int16_t hashNext;          // 同一哈希桶中的下一个条目
+        int16_t prev;              // 最近使用链表（头部最新）
+        int16_t next;
+    };
+    GlyphEntry entries[FONT_GLYPH_CACHE_ENTRIES];
+    int16_t buckets[FONT_GLYPH_CACHE_BUCKETS];
+    int16_t lruHead;
+    int16_t lruTail;
+    int16_t freeHead;              // 空闲条目链表（通过next连接）
+    size_t cacheBytes;             // 缓存占用的字节数
+    uint32_t evictions;            // 因预算释放的字形数
+
+    // 私有构造函数（单例模式）
+    FontLoader();
+
+    // 从SPIFFS加载字体（file为字体使用的文件对象）
+    bool load(LoadedFont& loaded, File& file, const char* path);
+
+    // 读取cmap表和字形描述
+    bool loadCmaps(LoadedFont& loaded, uint32_t start, uint32_t& length);
+    bool loadGlyphs(LoadedFont& loaded, uint32_t locaStart, const uint8_t* header);
+    bool loadKern(LoadedFont& loaded, uint32_t start, uint8_t glyphIdFormat);
+
+    // 压缩的字体包装为使用字形缓存的字体，字形多的字体包装为使用直接索引的字体，其他字体和没有空闲位置时原样返回
+    const lv_font_t* wrap(const char* name, const lv_font_t* font);
+
+    // 建立和释放cmap表的直接索引
+    static void buildCmapIndex(LoadedFont& loaded);
+    static void releaseCmapIndex(LoadedFont& loaded);
+
+    // 由cmap表计算字形数量
+    static uint32_t countGlyphs(const lv_font_fmt_txt_dsc_t& dsc);
+
+    // 所有字形未压缩的位图大小
+    static uint32_t measureRawBytes(const LoadedFont& loaded);
+
+    // 读取文件中的表头，返回表长度，标签不符时返回-1
+    static int32_t readLabel(File& file, uint32_t start, const char* label);
+
+    // 释放字体占用的内存
+    static void release(LoadedFont& loaded);
+
+    // 字形缓存操作
+    static uint32_t hashKey(uint8_t fontIndex, uint32_t glyphId);
+    int16_t findGlyph(uint8_t fontIndex, uint32_t glyphId);
+    void touchGlyph(int16_t index);
+    void unlinkGlyph(int16_t index);
+    void evictOldest();
+    const uint8_t* insertGlyph(uint8_t fontIndex, uint32_t glyphId, uint8_t* bitmap, uint32_t size);
+
+    // 从文件读取字形位图（跳过开头的度量，按位对齐），失败时返回nullptr
+    uint8_t* readGlyph(LoadedFont& loaded, uint32_t glyphId, uint32_t& size);
+
+    // 把压缩的字形位图解压到新分配的PSRAM缓冲区，失败时返回nullptr
+    static uint8_t* decompressGlyph(const LoadedFont& loaded, uint32_t glyphId, const uint8_t* data, uint32_t& size);
+
+    // LVGL字体回调：从缓存或文件获取字形位图
+    static const uint8_t* glyphBitmapCallback(const lv_font_t* font, uint32_t letter);
+
+public:
+    // 获取单例实例
+    static FontLoader* getInstance();
+
+    // 按名称获取字体（第一次使用时从SPIFFS加载<目录><名称>.bin），没有时返回fallback，
+    // fallback是压缩或字形多的字体时返回包装的字体（只在显示任务中调用）
+    const lv_font_t* font(const char* name, const lv_font_t* fallback);
+
+    // 包装的字体所包装的原字体，其他字体返回nullptr（性能测试中与LVGL每次解压比较）
+    const lv_font_t* getSourceFont(const lv_font_t* font);
+
+    // 字体是否为本类加载的字体
+    bool isLoaded(const lv_font_t* font);
+
+    // 字体是否使用本类的字形缓存（从SPIFFS加载或压缩的字体）
+    bool usesGlyphCache(const lv_font_t* font);
+
+    // 启用或停用所有字体的cmap直接索引（性能测试中与二分查找比较）
+    void enableCmapIndex(bool enable);
+
+    // 清空字形缓存（性能测试中测量冷缓存的绘制耗时）
+    void clearCache();
+
+    // 字形缓存的命中次数和未命中次数（所有字体合计）
+    void getCacheCounts(uint32_t& hits, uint32_t& misses);
+
+    // 生成统计JSON：各字体的内存占用、加载耗时，以及字形缓存的命中率和占用
+    String getStatsJson();
+};
+
+#endif // FONT_LOADER_H
@@ -0,0 +1,190 @@
+#include "gif_background.h"
+#include <SPIFFS.h>
+#include <ArduinoJson.h>
+
+// 统计表
+GifBackgroundStats GifBackground::stats[GIF_BACKGROUND_MAX_INSTANCES];
+
+//*** 私有构造函数
+GifBackground::GifBackground() {
+    memset(&imageDsc, 0, sizeof(imageDsc));
+    img = nullptr;
+    timer = nullptr;
+    statsSlot = -1;
+}
+//*** 析构函数
+GifBackground::~GifBackground() {
+    if (timer != nullptr) {
+        lv_timer_del(timer);
+    }
+    if (file) {
+        file.close();
+    }
+    if (statsSlot >= 0) {
+        stats[statsSlot].active = false;
+    }
+}
+//*** 解码器的读取函数：从SPIFFS文件读取
+size_t GifBackground::readFile(void* context, size_t offset, uint8_t* buf, size_t length) {
+    GifBackground* gif = (GifBackground*)context;
+    gif->file.seek(offset);
+    return gif->file.read(buf, length);
+}
+//*** 记录刚解码的帧需要的临时内存
+void GifBackground::recordFrameBytes() {
+    if (statsSlot >= 0 && decoder.frameBytes() > stats[statsSlot].maxFrameBytes) {
+        stats[statsSlot].maxFrameBytes = decoder.frameBytes();
+    }
+}
+//*** 解码器打开后解码第一帧并创建图像对象
+bool GifBackground::begin(const char* name, GifError error, int xOfs, int yOfs) {
+    if (error == GIF_ERROR_HEADER) {
+        Serial.printf("GIF文件头无效: %s\n", name);
+        return false;
+    }
+    uint32_t canvasBytes = decoder.canvasBytes();
+    if (error != GIF_OK) {
+        Serial.printf("GIF画布分配失败: %s（%u字节）\n", name, canvasBytes);
+        return false;
+    }
+    // 占用一个统计位置（优先使用已释放的）
+    for (int i = 0; i < GIF_BACKGROUND_MAX_INSTANCES; i++) {
+        if (!stats[i].active) {
+            statsSlot = i;
+            break;
+        }
+    }
+    if (statsSlot >= 0) {
+        GifBackgroundStats& slot = stats[statsSlot];
+        memset(&slot, 0, sizeof(slot));
+        strlcpy(slot.name, name, sizeof(slot.name));
+        slot.width = decoder.width();
+        slot.height = decoder.height();
+        slot.canvasBytes = canvasBytes;
+        slot.active = true;
+    }
+    if (!decoder.decodeNextFrame()) {
+        Serial.printf("GIF第一帧解码失败: %s\n", name);
+        return false;
+    }
+    recordFrameBytes();
+    imageDsc.header.always_zero = 0;
+    imageDsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    imageDsc.header.w = decoder.width();
+    imageDsc.header.h = decoder.height();
+    imageDsc.data_size = canvasBytes;
+    imageDsc.data = (const uint8_t*)decoder.canvas();
+    img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, &imageDsc);
+    lv_obj_set_pos(img, xOfs, yOfs);
+    lv_obj_add_flag(img, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_event_cb(img, deleteCallback, LV_EVENT_DELETE, this);
+    timer = lv_timer_create(timerCallback, decoder.frameDelay() > 0 ? decoder.frameDelay() : GIF_DEFAULT_FRAME_DELAY, this);
+    Serial.printf("已加载动画背景: %s（%ux%u，画布%u字节）\n", name, decoder.width(), decoder.height(), canvasBytes);
+    return true;
+}
+//*** 帧定时器回调
+void GifBackground::timerCallback(lv_timer_t* timer) {
+    ((GifBackground*)timer->user_data)->step();
+}
+//*** 解码并显示下一帧
+void GifBackground::step() {
+    // 所在屏幕未显示时不解码，回到该屏幕时从暂停处继续
+    if (!lv_obj_is_visible(img)) {
+        if (statsSlot >= 0) {
+            stats[statsSlot].skippedTicks++;
+        }
+        return;
+    }
+    unsigned long startTime = micros();
+    if (!decoder.decodeNextFrame()) {
+        Serial.println("GIF帧解码失败，停止播放");
+        lv_timer_pause(timer);
+        return;
+    }
+    uint32_t elapsed = micros() - startTime;
+    recordFrameBytes();
+    uint32_t dirty = 0;
+    lv_area_t area;
+    if (decoder.getDirtyArea(area)) {
+        // 只重绘本帧实际改变的矩形
+        dirty = lv_area_get_size(&area);
+        lv_area_move(&area, img->coords.x1, img->coords.y1);
+        lv_obj_invalidate_area(img, &area);
+    }
+    if (statsSlot >= 0) {
+        GifBackgroundStats& slot = stats[statsSlot];
+        slot.frames++;
+        slot.decodeMicros += elapsed;
+        if (elapsed > slot.maxDecodeMicros) {
+            slot.maxDecodeMicros = elapsed;
+        }
+        slot.dirtyPixels += dirty;
+    }
+    // 帧间隔不短于显示刷新周期，刷新不过来的帧没有意义
+    uint32_t period = decoder.frameDelay() > 0 ? decoder.frameDelay() : GIF_DEFAULT_FRAME_DELAY;
+    lv_disp_t* disp = lv_disp_get_default();
+    if (disp != nullptr && disp->refr_timer != nullptr && period < disp->refr_timer->period) {
+        period = disp->refr_timer->period;
+    }
+    lv_timer_set_period(timer, period);
+}
+//*** 图像对象删除时释放解码器
+void GifBackground::deleteCallback(lv_event_t* e) {
+    GifBackground* gif = (GifBackground*)lv_event_get_user_data(e);
+    delete gif;
+}
+//*** 从SPIFFS文件创建动画背景
+lv_obj_t* GifBackground::createFromFile(const char* path, int xOfs, int yOfs) {
+    if (!SPIFFS.exists(path)) {
+        return nullptr;
+    }
+    GifBackground* gif = new GifBackground();
+    gif->file = SPIFFS.open(path, "r");
+    if (!gif->file || !gif->begin(path, gif->decoder.begin(readFile, gif), xOfs, yOfs)) {
+        delete gif;
+        return nullptr;
+    }
+    return gif->img;
+}
+//*** 从内存数据创建动画背景
+lv_obj_t* GifBackground::createFromData(const uint8_t* gifData, size_t size, int xOfs, int yOfs) {
+    GifBackground* gif = new GifBackground();
+    if (!gif->begin("data", gif->decoder.begin(gifData, size), xOfs, yOfs)) {
+        delete gif;
+        return nullptr;
+    }
+    return gif->img;
+}
+//*** 生成统计JSON
+String GifBackground::getStatsJson() {
+    JsonDocument doc;
+    doc["lzw_table_bytes"] = GifDecoder::lzwTableBytes();
+    doc["read_buffer_bytes"] = GIF_READ_BUFFER_SIZE;
+    JsonArray items = doc["backgrounds"].to<JsonArray>();
+    for (int i = 0; i < GIF_BACKGROUND_MAX_INSTANCES; i++) {
+        const GifBackgroundStats& slot = stats[i];
+        if (slot.width == 0) {
+            continue;
+        }
+        JsonObject item = items.add<JsonObject>();
+        item["name"] = slot.name;
+        item["active"] = slot.active;
+        item["width"] = slot.width;
+        item["height"] = slot.height;
+        item["frames"] = slot.frames;
+        item["avg_decode_us"] = slot.frames > 0 ? (uint32_t)(slot.decodeMicros / slot.frames) : 0;
+        item["max_decode_us"] = slot.maxDecodeMicros;
+        // 平均每帧重绘面积占整幅图像的比例
+        uint32_t area = (uint32_t)slot.width * slot.height;
+        item["avg_dirty_pct"] = slot.frames > 0 ? slot.dirtyPixels * 100.0f / slot.frames / area : 0;
+        item["canvas_bytes"] = slot.canvasBytes;
+        // LVGL自带GIF控件需要的内存：3字节带透明度的画布加1字节索引帧
+        item["stock_decoder_bytes"] = area * 4;
+        item["max_frame_bytes"] = slot.maxFrameBytes;
+        item["skipped_ticks"] = slot.skippedTicks;
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
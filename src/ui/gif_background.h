@@ -0,0 +1,80 @@
+#ifndef GIF_BACKGROUND_H
+#define GIF_BACKGROUND_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <FS.h>
+#include "gif_decoder.h"
+
+// 动画背景GIF文件所在目录（SPIFFS），文件名与屏幕背景图像同名，如/gif/soul.gif
+#define GIF_BACKGROUND_DIR "/gif/"
+// 同时存在的动画背景数（统计表大小）
+const int GIF_BACKGROUND_MAX_INSTANCES = 8;
+// GIF未指定帧间隔时使用的间隔（毫秒）
+const uint32_t GIF_DEFAULT_FRAME_DELAY = 100;
+
+// 单个动画背景的统计（Web任务只读取这些计数，不访问解码器对象）
+struct GifBackgroundStats {
+    bool active;                 // 对应的动画背景是否仍存在
+    char name[32];               // 文件名或"data"
+    uint16_t width;              // 画布尺寸
+    uint16_t height;
+    uint32_t frames;             // 已解码的帧数
+    uint64_t decodeMicros;       // 解码累计耗时
+    uint32_t maxDecodeMicros;    // 单帧最长解码耗时
+    uint64_t dirtyPixels;        // 累计重绘的像素数
+    uint32_t canvasBytes;        // PSRAM画布占用
+    uint32_t maxFrameBytes;      // 单帧解码期间的最大临时内存（恢复到上一帧所需的备份）
+    uint32_t skippedTicks;       // 图像不可见而跳过解码的次数
+};
+
+/**
+ * 流式GIF动画背景类
+ * 由GifDecoder逐帧从Flash（编译进固件的数组或SPIFFS文件）读取并解码GIF，解码结果直接写入PSRAM中的RGB565画布，
+ * 不保存整幅的颜色索引帧；只使本帧实际改变的像素所在的矩形失效，帧间隔不短于显示刷新周期，
+ * 图像不可见（其他屏幕或夜间模式）时不解码。每帧的解码耗时和内存占用计入统计
+ */
+class GifBackground {
+private:
+    File file;                   // SPIFFS文件（从内存数据播放时不使用）
+    GifDecoder decoder;          // 逐帧解码器（画布和处置状态）
+    lv_img_dsc_t imageDsc;       // 指向画布的图像描述符
+    lv_obj_t* img;               // 显示画布的图像对象
+    lv_timer_t* timer;           // 帧定时器
+    int statsSlot;               // 统计表中的位置
+
+    // 统计表
+    static GifBackgroundStats stats[GIF_BACKGROUND_MAX_INSTANCES];
+
+    GifBackground();
+
+    // 解码器的读取函数：从SPIFFS文件读取
+    static size_t readFile(void* context, size_t offset, uint8_t* buf, size_t length);
+
+    // 解码器打开后解码第一帧并创建图像对象
+    bool begin(const char* name, GifError error, int xOfs, int yOfs);
+
+    // 记录刚解码的帧需要的临时内存
+    void recordFrameBytes();
+
+    // 帧定时器回调
+    static void timerCallback(lv_timer_t* timer);
+    void step();
+
+    // 图像对象删除时释放解码器
+    static void deleteCallback(lv_event_t* e);
+
+public:
+    ~GifBackground();
+
+    // 从SPIFFS中的GIF文件创建动画背景，文件不存在或内存不足时返回nullptr
+    static lv_obj_t* createFromFile(const char* path, int xOfs, int yOfs);
+
+    // 从内存中的GIF数据（编译进固件的数组）创建动画背景
+    static lv_obj_t* createFromData(const uint8_t* gifData, size_t size, int xOfs, int yOfs);
+
+    // 生成统计JSON：每个动画背景的帧数、每帧解码耗时、重绘比例和内存占用
+    static String getStatsJson();
+};
+
+#endif // GIF_BACKGROUND_H
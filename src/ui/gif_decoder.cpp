@@ -0,0 +1,447 @@
+#include "gif_decoder.h"
+#include <string.h>
+#include <stdlib.h>
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#endif
+
+// LZW编码最多12位
+#define LZW_MAX_CODES 4096
+
+// 共用的LZW解码表
+uint16_t* GifDecoder::lzwPrefix = nullptr;
+uint8_t* GifDecoder::lzwSuffix = nullptr;
+uint8_t* GifDecoder::lzwStack = nullptr;
+
+//*** 分配画布和备份（设备上放在PSRAM中）
+static void* allocPixels(size_t bytes) {
+#ifdef ARDUINO
+    return heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+    return malloc(bytes);
+#endif
+}
+
+//*** 构造函数
+GifDecoder::GifDecoder() {
+    data = nullptr;
+    dataSize = 0;
+    read = nullptr;
+    context = nullptr;
+    position = 0;
+    readBuffer = nullptr;
+    bufferStart = 0;
+    bufferLength = 0;
+    canvasWidth = 0;
+    canvasHeight = 0;
+    canvasPixels = nullptr;
+    hasGlobalPalette = false;
+    backgroundIndex = 0;
+    animationStart = 0;
+    frameX = frameY = frameW = frameH = 0;
+    disposal = 0;
+    transparent = false;
+    transparentIndex = 0;
+    delay = 0;
+    prevX = prevY = prevW = prevH = 0;
+    prevDisposal = 0;
+    prevTransparent = false;
+    backup = nullptr;
+    backupBytes = 0;
+    dirtyX1 = dirtyY1 = dirtyX2 = dirtyY2 = 0;
+}
+//*** 析构函数
+GifDecoder::~GifDecoder() {
+    free(readBuffer);
+    free(backup);
+    free(canvasPixels);
+}
+//*** 读取一个字节，数据结束时返回-1
+int GifDecoder::readByte() {
+    if (data != nullptr) {
+        return position < dataSize ? data[position++] : -1;
+    }
+    if (position < bufferStart || position >= bufferStart + bufferLength) {
+        // 缓冲区用完，读取下一段
+        bufferStart = position;
+        bufferLength = read(context, position, readBuffer, GIF_READ_BUFFER_SIZE);
+        if (bufferLength == 0) {
+            return -1;
+        }
+    }
+    return readBuffer[position++ - bufferStart];
+}
+//*** 读取多个字节
+bool GifDecoder::readBytes(uint8_t* buffer, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        int value = readByte();
+        if (value < 0) {
+            return false;
+        }
+        buffer[i] = value;
+    }
+    return true;
+}
+//*** 跳过多个字节
+void GifDecoder::skipBytes(size_t length) {
+    position += length;
+}
+//*** 移动读取位置
+void GifDecoder::seekTo(size_t offset) {
+    position = offset;
+}
+//*** 读取小端16位整数
+uint16_t GifDecoder::readWord() {
+    int low = readByte();
+    int high = readByte();
+    return (low < 0 || high < 0) ? 0 : (uint16_t)(low | (high << 8));
+}
+//*** 跳过数据子块直到结束块
+void GifDecoder::skipSubBlocks() {
+    int size = readByte();
+    while (size > 0) {
+        skipBytes(size);
+        size = readByte();
+    }
+}
+//*** 读取颜色表
+void GifDecoder::readPalette(lv_color_t* palette, int count) {
+    uint8_t rgb[3];
+    for (int i = 0; i < count; i++) {
+        if (!readBytes(rgb, 3)) {
+            rgb[0] = rgb[1] = rgb[2] = 0;
+        }
+        palette[i] = lv_color_make(rgb[0], rgb[1], rgb[2]);
+    }
+}
+//*** 分配共用的LZW解码表（只分配一次）
+bool GifDecoder::allocTables() {
+    if (lzwPrefix != nullptr) {
+        return true;
+    }
+    lzwPrefix = (uint16_t*)malloc(LZW_MAX_CODES * sizeof(uint16_t));
+    lzwSuffix = (uint8_t*)malloc(LZW_MAX_CODES);
+    lzwStack = (uint8_t*)malloc(LZW_MAX_CODES + 1);
+    if (lzwPrefix == nullptr || lzwSuffix == nullptr || lzwStack == nullptr) {
+        free(lzwPrefix);
+        free(lzwSuffix);
+        free(lzwStack);
+        lzwPrefix = nullptr;
+        lzwSuffix = nullptr;
+        lzwStack = nullptr;
+        return false;
+    }
+    return true;
+}
+//*** 共用的LZW解码表占用的内存
+size_t GifDecoder::lzwTableBytes() {
+    return lzwPrefix != nullptr ? LZW_MAX_CODES * 4 + 1 : 0;
+}
+//*** 从内存数据开始解码
+GifError GifDecoder::begin(const uint8_t* gifData, size_t size) {
+    data = gifData;
+    dataSize = size;
+    return open();
+}
+//*** 通过读取函数开始解码
+GifError GifDecoder::begin(GifReadFunc readFunc, void* readContext) {
+    read = readFunc;
+    context = readContext;
+    readBuffer = (uint8_t*)malloc(GIF_READ_BUFFER_SIZE);
+    if (readBuffer == nullptr) {
+        return GIF_ERROR_MEMORY;
+    }
+    return open();
+}
+//*** 解析文件头并分配画布
+GifError GifDecoder::open() {
+    if (!allocTables()) {
+        return GIF_ERROR_MEMORY;
+    }
+    uint8_t signature[6];
+    if (!readBytes(signature, 6) || memcmp(signature, "GIF", 3) != 0) {
+        return GIF_ERROR_HEADER;
+    }
+    canvasWidth = readWord();
+    canvasHeight = readWord();
+    int flags = readByte();
+    backgroundIndex = readByte();
+    readByte(); // 像素宽高比
+    if (canvasWidth == 0 || canvasHeight == 0 || flags < 0) {
+        return GIF_ERROR_HEADER;
+    }
+    memset(globalPalette, 0, sizeof(globalPalette));
+    memset(localPalette, 0, sizeof(localPalette));
+    hasGlobalPalette = flags & 0x80;
+    if (hasGlobalPalette) {
+        readPalette(globalPalette, 1 << ((flags & 0x07) + 1));
+    }
+    animationStart = position;
+    canvasPixels = (lv_color_t*)allocPixels(canvasBytes());
+    if (canvasPixels == nullptr) {
+        return GIF_ERROR_MEMORY;
+    }
+    lv_color_t background = hasGlobalPalette ? globalPalette[backgroundIndex] : lv_color_hex(0x000000);
+    for (uint32_t i = 0; i < (uint32_t)canvasWidth * canvasHeight; i++) {
+        canvasPixels[i] = background;
+    }
+    return GIF_OK;
+}
+//*** 记录改变的像素
+inline void GifDecoder::markDirty(int16_t x, int16_t y) {
+    if (dirtyX1 > dirtyX2) {
+        dirtyX1 = dirtyX2 = x;
+        dirtyY1 = dirtyY2 = y;
+        return;
+    }
+    if (x < dirtyX1) dirtyX1 = x;
+    if (x > dirtyX2) dirtyX2 = x;
+    if (y < dirtyY1) dirtyY1 = y;
+    if (y > dirtyY2) dirtyY2 = y;
+}
+//*** 本帧改变的像素所在的矩形
+bool GifDecoder::getDirtyArea(lv_area_t& area) const {
+    if (dirtyX1 > dirtyX2) {
+        return false;
+    }
+    area.x1 = dirtyX1;
+    area.y1 = dirtyY1;
+    area.x2 = dirtyX2;
+    area.y2 = dirtyY2;
+    return true;
+}
+//*** 填充画布上的矩形
+void GifDecoder::fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, lv_color_t color) {
+    for (uint16_t row = y; row < y + h && row < canvasHeight; row++) {
+        lv_color_t* line = canvasPixels + (uint32_t)row * canvasWidth;
+        for (uint16_t col = x; col < x + w && col < canvasWidth; col++) {
+            if (line[col].full != color.full) {
+                line[col] = color;
+                markDirty(col, row);
+            }
+        }
+    }
+}
+//*** 处置上一帧
+void GifDecoder::disposePrevious() {
+    if (prevDisposal == 2) {
+        // 恢复为背景色；带透明色的帧按屏幕的黑色背景处理
+        lv_color_t color = prevTransparent ? lv_color_hex(0x000000) : globalPalette[backgroundIndex];
+        fillRect(prevX, prevY, prevW, prevH, color);
+    } else if (prevDisposal == 3 && backup != nullptr) {
+        // 恢复为绘制上一帧之前的内容
+        for (uint16_t row = 0; row < prevH && prevY + row < canvasHeight; row++) {
+            lv_color_t* line = canvasPixels + (uint32_t)(prevY + row) * canvasWidth;
+            const lv_color_t* saved = backup + (uint32_t)row * prevW;
+            for (uint16_t col = 0; col < prevW && prevX + col < canvasWidth; col++) {
+                if (line[prevX + col].full != saved[col].full) {
+                    line[prevX + col] = saved[col];
+                    markDirty(prevX + col, prevY + row);
+                }
+            }
+        }
+    }
+    free(backup);
+    backup = nullptr;
+}
+//*** 解码一帧的图像数据
+bool GifDecoder::decodeImageData(const lv_color_t* palette, bool interlaced) {
+    int minCodeSize = readByte();
+    if (minCodeSize < 2 || minCodeSize > 8) {
+        return false;
+    }
+    const int clearCode = 1 << minCodeSize;
+    const int endCode = clearCode + 1;
+    int codeSize = minCodeSize + 1;
+    int nextCode = endCode + 1;
+    int oldCode = -1;
+    uint8_t firstChar = 0;
+    // 位读取状态
+    uint32_t bitBuffer = 0;
+    int bitCount = 0;
+    int blockRemaining = 0;
+    // 像素写入状态（交错存储时按4遍扫描）
+    static const uint8_t passStart[] = {0, 4, 2, 1};
+    static const uint8_t passStep[] = {8, 8, 4, 2};
+    int pass = 0;
+    uint32_t pixelsLeft = (uint32_t)frameW * frameH;
+    uint16_t col = 0;
+    uint16_t row = 0;
+    bool ok = true;
+
+    while (pixelsLeft > 0) {
+        // 读取一个编码
+        while (bitCount < codeSize) {
+            if (blockRemaining == 0) {
+                blockRemaining = readByte();
+                if (blockRemaining <= 0) {
+                    blockRemaining = 0;
+                    break;
+                }
+            }
+            int value = readByte();
+            if (value < 0) {
+                break;
+            }
+            bitBuffer |= (uint32_t)value << bitCount;
+            bitCount += 8;
+            blockRemaining--;
+        }
+        if (bitCount < codeSize) {
+            // 数据提前结束，已解码的部分仍然保留
+            break;
+        }
+        int code = bitBuffer & ((1 << codeSize) - 1);
+        bitBuffer >>= codeSize;
+        bitCount -= codeSize;
+
+        if (code == clearCode) {
+            codeSize = minCodeSize + 1;
+            nextCode = endCode + 1;
+            oldCode = -1;
+            continue;
+        }
+        if (code == endCode) {
+            break;
+        }
+        int stackSize = 0;
+        if (oldCode < 0) {
+            if (code >= clearCode) {
+                ok = false;
+                break;
+            }
+            firstChar = code;
+            lzwStack[stackSize++] = code;
+        } else {
+            int inCode = code;
+            if (code >= nextCode) {
+                if (code > nextCode) {
+                    ok = false;
+                    break;
+                }
+                lzwStack[stackSize++] = firstChar;
+                code = oldCode;
+            }
+            while (code >= clearCode && stackSize < LZW_MAX_CODES) {
+                lzwStack[stackSize++] = lzwSuffix[code];
+                code = lzwPrefix[code];
+            }
+            firstChar = code;
+            lzwStack[stackSize++] = firstChar;
+            if (nextCode < LZW_MAX_CODES) {
+                lzwPrefix[nextCode] = oldCode;
+                lzwSuffix[nextCode] = firstChar;
+                nextCode++;
+                if (nextCode == (1 << codeSize) && codeSize < 12) {
+                    codeSize++;
+                }
+            }
+            code = inCode;
+        }
+        oldCode = code;
+
+        // 按顺序输出像素（栈中为倒序）
+        while (stackSize > 0 && pixelsLeft > 0) {
+            uint8_t index = lzwStack[--stackSize];
+            uint16_t x = frameX + col;
+            uint16_t y = frameY + row;
+            if (!(transparent && index == transparentIndex) && x < canvasWidth && y < canvasHeight) {
+                lv_color_t* pixel = canvasPixels + (uint32_t)y * canvasWidth + x;
+                if (pixel->full != palette[index].full) {
+                    *pixel = palette[index];
+                    markDirty(x, y);
+                }
+            }
+            pixelsLeft--;
+            if (++col == frameW) {
+                col = 0;
+                if (interlaced) {
+                    row += passStep[pass];
+                    while (row >= frameH && pass < 3) {
+                        pass++;
+                        row = passStart[pass];
+                    }
+                } else {
+                    row++;
+                }
+            }
+        }
+    }
+    // 跳过本帧剩余的数据子块
+    skipBytes(blockRemaining);
+    skipSubBlocks();
+    return ok;
+}
+//*** 解码下一帧
+bool GifDecoder::decodeNextFrame() {
+    bool rewound = false;
+    while (true) {
+        int separator = readByte();
+        if (separator == '!') {
+            // 扩展块：只处理图形控制扩展，其余跳过
+            int label = readByte();
+            if (label == 0xF9) {
+                readByte(); // 块大小（4）
+                int flags = readByte();
+                delay = readWord() * 10;
+                transparentIndex = readByte();
+                disposal = (flags >> 2) & 0x07;
+                transparent = flags & 0x01;
+                skipSubBlocks();
+            } else {
+                skipSubBlocks();
+            }
+        } else if (separator == ',') {
+            break;
+        } else {
+            // 文件结束（';'或数据耗尽）：回到第一帧循环播放
+            if (rewound) {
+                return false;
+            }
+            rewound = true;
+            seekTo(animationStart);
+        }
+    }
+    // 图像描述符
+    frameX = readWord();
+    frameY = readWord();
+    frameW = readWord();
+    frameH = readWord();
+    int flags = readByte();
+    if (frameW == 0 || frameH == 0 || flags < 0) {
+        return false;
+    }
+    const lv_color_t* palette = globalPalette;
+    if (flags & 0x80) {
+        readPalette(localPalette, 1 << ((flags & 0x07) + 1));
+        palette = localPalette;
+    }
+    // 清空改变范围（x1大于x2表示没有改变）
+    dirtyX1 = 1;
+    dirtyX2 = 0;
+    disposePrevious();
+    // 本帧之后要恢复原内容时，先保存本帧矩形
+    backupBytes = 0;
+    if (disposal == 3) {
+        backupBytes = (uint32_t)frameW * frameH * sizeof(lv_color_t);
+        backup = (lv_color_t*)allocPixels(backupBytes);
+        if (backup != nullptr) {
+            for (uint16_t row = 0; row < frameH && frameY + row < canvasHeight; row++) {
+                for (uint16_t col = 0; col < frameW && frameX + col < canvasWidth; col++) {
+                    backup[(uint32_t)row * frameW + col] = canvasPixels[(uint32_t)(frameY + row) * canvasWidth + frameX + col];
+                }
+            }
+        }
+    }
+    bool ok = decodeImageData(palette, flags & 0x40);
+    // 图形控制扩展只作用于紧随其后的一帧
+    prevX = frameX;
+    prevY = frameY;
+    prevW = frameW;
+    prevH = frameH;
+    prevDisposal = disposal;
+    prevTransparent = transparent;
+    disposal = 0;
+    transparent = false;
+    return ok;
+}
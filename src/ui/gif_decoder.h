@@ -0,0 +1,128 @@
+#ifndef GIF_DECODER_H
+#define GIF_DECODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <lvgl.h>
+
+/**
+ * 逐帧GIF解码
+ * 不依赖Arduino和文件系统，可以在PC上单独编译，用于与参考画布逐帧比较（见test/host/gif_decoder_test.cpp）。
+ *
+ * 解码结果直接写入RGB565画布（每像素2字节），不保存整幅的颜色索引帧；数据从内存直接读取，
+ * 或通过读取函数每次读取一小段。每帧记录处置上一帧和绘制本帧时实际改变的像素所在的矩形，
+ * 调用方只需重绘该矩形。数据结束后回到第一帧循环播放；数据在帧中间截断时保留已解码的像素
+ */
+
+// 读取函数：从offset处读取最多length字节到buf，返回实际读取的字节数（0表示没有更多数据）
+typedef size_t (*GifReadFunc)(void* context, size_t offset, uint8_t* buf, size_t length);
+
+// 解码结果
+enum GifError {
+    GIF_OK = 0,
+    GIF_ERROR_HEADER,        // 不是GIF文件或逻辑屏幕尺寸无效
+    GIF_ERROR_MEMORY,        // 内存不足
+    GIF_ERROR_DATA           // 帧数据无效或文件中没有帧
+};
+
+// 通过读取函数读取时的缓冲区大小（字节）
+const size_t GIF_READ_BUFFER_SIZE = 512;
+
+class GifDecoder {
+private:
+    // 数据来源
+    const uint8_t* data;         // 内存中的GIF数据（为nullptr时通过读取函数读取）
+    size_t dataSize;             // 内存数据长度
+    GifReadFunc read;            // 读取函数
+    void* context;               // 读取函数的参数
+    size_t position;             // 当前读取位置
+    uint8_t* readBuffer;         // 读取缓冲区
+    size_t bufferStart;          // 缓冲区对应的数据位置
+    size_t bufferLength;         // 缓冲区中的有效字节数
+
+    // 画布
+    uint16_t canvasWidth;        // 逻辑屏幕尺寸
+    uint16_t canvasHeight;
+    lv_color_t* canvasPixels;    // RGB565画布（设备上在PSRAM中）
+
+    // 解码状态
+    lv_color_t globalPalette[256]; // 全局颜色表
+    lv_color_t localPalette[256];  // 当前帧的局部颜色表
+    bool hasGlobalPalette;         // 是否有全局颜色表
+    uint8_t backgroundIndex;       // 背景色索引
+    size_t animationStart;         // 第一帧数据的位置（循环播放时回到这里）
+    uint16_t frameX, frameY, frameW, frameH; // 当前帧的矩形
+    uint8_t disposal;              // 当前帧的处置方式
+    bool transparent;              // 当前帧是否有透明色
+    uint8_t transparentIndex;      // 透明色索引
+    uint16_t delay;                // 当前帧的显示时间（毫秒）
+    uint16_t prevX, prevY, prevW, prevH; // 上一帧的矩形
+    uint8_t prevDisposal;          // 上一帧的处置方式
+    bool prevTransparent;          // 上一帧是否有透明色
+    lv_color_t* backup;            // 处置方式为3时保存的上一帧矩形内容
+    uint32_t backupBytes;          // 本帧解码期间备份占用的内存
+
+    // 本帧改变的像素范围（画布坐标，x1大于x2表示没有改变）
+    int16_t dirtyX1, dirtyY1, dirtyX2, dirtyY2;
+
+    // LZW解码表（所有实例共用，只在显示任务中使用）
+    static uint16_t* lzwPrefix;
+    static uint8_t* lzwSuffix;
+    static uint8_t* lzwStack;
+
+    // 读取数据
+    int readByte();
+    bool readBytes(uint8_t* buffer, size_t length);
+    void skipBytes(size_t length);
+    void seekTo(size_t offset);
+    uint16_t readWord();
+    void skipSubBlocks();
+
+    // 分配共用的LZW解码表
+    static bool allocTables();
+    // 解析文件头并分配画布
+    GifError open();
+    // 读取颜色表
+    void readPalette(lv_color_t* palette, int count);
+    // 解码一帧的图像数据（LZW）到画布
+    bool decodeImageData(const lv_color_t* palette, bool interlaced);
+    // 处置上一帧
+    void disposePrevious();
+    // 填充画布上的矩形
+    void fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, lv_color_t color);
+    // 记录改变的像素
+    inline void markDirty(int16_t x, int16_t y);
+
+public:
+    GifDecoder();
+    ~GifDecoder();
+
+    // 从内存中的GIF数据开始解码：解析文件头，分配画布并填充背景色（数据须在解码期间保持有效）
+    GifError begin(const uint8_t* gifData, size_t size);
+
+    // 通过读取函数开始解码
+    GifError begin(GifReadFunc readFunc, void* readContext);
+
+    // 解码下一帧（数据结束后回到第一帧），返回false表示数据错误
+    bool decodeNextFrame();
+
+    // 本帧改变的像素所在的矩形（画布坐标），没有改变时返回false
+    bool getDirtyArea(lv_area_t& area) const;
+
+    // 画布尺寸和像素
+    uint16_t width() const { return canvasWidth; }
+    uint16_t height() const { return canvasHeight; }
+    const lv_color_t* canvas() const { return canvasPixels; }
+    uint32_t canvasBytes() const { return (uint32_t)canvasWidth * canvasHeight * sizeof(lv_color_t); }
+
+    // 刚解码的帧的显示时间（毫秒），GIF未指定时为0
+    uint16_t frameDelay() const { return delay; }
+
+    // 刚解码的帧需要的临时内存（恢复到上一帧所需的备份）
+    uint32_t frameBytes() const { return backupBytes; }
+
+    // 共用的LZW解码表占用的内存（还未分配时为0）
+    static size_t lzwTableBytes();
+};
+
+#endif // GIF_DECODER_H
@@ -0,0 +1,325 @@
+#include "image_cache.h"
+#include <ArduinoJson.h>
+
+// 定义单例实例
+ImageCache* ImageCache::instance = nullptr;
+
+// 一次解码会话的状态
+struct ImageCacheSession {
+    void* entry;                  // 命中或新建的缓存条目（未缓存时为空）
+    lv_img_decoder_dsc_t inner;   // 未缓存时后面的解码器的会话
+    bool innerOpen;
+};
+
+//*** 私有构造函数
+ImageCache::ImageCache() {
+    memset(entries, 0, sizeof(entries));
+    totalBytes = 0;
+    useCounter = 0;
+    hits = 0;
+    misses = 0;
+    passThroughs = 0;
+    evictions = 0;
+    invalidations = 0;
+    missMicros = 0;
+    hitMicros = 0;
+    decoding = false;
+}
+//*** 获取单例实例
+ImageCache* ImageCache::getInstance() {
+    if (instance == nullptr) {
+        instance = new ImageCache();
+    }
+    return instance;
+}
+//*** 注册解码器
+void ImageCache::init() {
+    lv_img_decoder_t* decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, infoCallback);
+    lv_img_decoder_set_open_cb(decoder, openCallback);
+    lv_img_decoder_set_read_line_cb(decoder, readLineCallback);
+    lv_img_decoder_set_close_cb(decoder, closeCallback);
+    Serial.printf("文件图像解码缓存已注册，预算%u KB\n", (unsigned)(IMAGE_CACHE_BUDGET / 1024));
+}
+//*** 比较路径（忽略盘符前缀）
+bool ImageCache::pathMatches(const char* cached, const char* path) {
+    if (strcmp(cached, path) == 0) {
+        return true;
+    }
+    return cached[0] != '\0' && cached[1] == ':' && strcmp(cached + 2, path) == 0;
+}
+//*** 查找路径对应的有效条目
+ImageCache::CacheEntry* ImageCache::findEntry(const char* path) {
+    for (int i = 0; i < IMAGE_CACHE_MAX_ENTRIES; i++) {
+        if (entries[i].path[0] != '\0' && !entries[i].stale && strcmp(entries[i].path, path) == 0) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+//*** 释放一个缓存条目
+void ImageCache::eraseEntry(CacheEntry* entry) {
+    if (entry->data != nullptr) {
+        heap_caps_free(entry->data);
+        totalBytes -= entry->bytes;
+    }
+    memset(entry, 0, sizeof(CacheEntry));
+}
+//*** 释放已失效且未在绘制中的条目
+void ImageCache::releaseStale() {
+    for (int i = 0; i < IMAGE_CACHE_MAX_ENTRIES; i++) {
+        if (entries[i].path[0] != '\0' && entries[i].stale && entries[i].refCount == 0) {
+            eraseEntry(&entries[i]);
+            invalidations++;
+        }
+    }
+}
+//*** 释放最久未使用且未在绘制中的条目
+bool ImageCache::evictOldest() {
+    CacheEntry* oldest = nullptr;
+    for (int i = 0; i < IMAGE_CACHE_MAX_ENTRIES; i++) {
+        CacheEntry* entry = &entries[i];
+        if (entry->path[0] == '\0' || entry->refCount > 0) {
+            continue;
+        }
+        if (oldest == nullptr || entry->lastUsed < oldest->lastUsed) {
+            oldest = entry;
+        }
+    }
+    if (oldest == nullptr) {
+        return false;
+    }
+    eraseEntry(oldest);
+    evictions++;
+    return true;
+}
+//*** 解码后像素数据的字节数
+size_t ImageCache::decodedSize(const lv_img_header_t& header) {
+    uint32_t pixels = header.w * header.h;
+    switch (header.cf) {
+        // 原始格式由解码器转换为真彩色，绘制时按是否有Alpha通道解释
+        case LV_IMG_CF_RAW:
+        case LV_IMG_CF_RAW_CHROMA_KEYED:
+            return pixels * LV_COLOR_SIZE / 8;
+        case LV_IMG_CF_RAW_ALPHA:
+            return pixels * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        case LV_IMG_CF_TRUE_COLOR:
+        case LV_IMG_CF_TRUE_COLOR_ALPHA:
+        case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED:
+        case LV_IMG_CF_INDEXED_1BIT:
+        case LV_IMG_CF_INDEXED_2BIT:
+        case LV_IMG_CF_INDEXED_4BIT:
+        case LV_IMG_CF_INDEXED_8BIT:
+            return lv_img_buf_get_img_size(header.w, header.h, header.cf);
+        default:
+            // Alpha格式的解码结果与重新着色的颜色有关，自定义格式的大小未知，都不缓存
+            return 0;
+    }
+}
+//*** 为解码结果腾出空间并分配像素内存
+ImageCache::CacheEntry* ImageCache::insert(const char* path, const lv_img_header_t& header) {
+    size_t bytes = decodedSize(header);
+    if (bytes == 0 || bytes > IMAGE_CACHE_BUDGET || strlen(path) >= IMAGE_CACHE_PATH_SIZE) {
+        return nullptr;
+    }
+    CacheEntry* slot = nullptr;
+    while (true) {
+        slot = nullptr;
+        for (int i = 0; i < IMAGE_CACHE_MAX_ENTRIES && slot == nullptr; i++) {
+            if (entries[i].path[0] == '\0') {
+                slot = &entries[i];
+            }
+        }
+        if (slot != nullptr && totalBytes + bytes <= IMAGE_CACHE_BUDGET) {
+            break;
+        }
+        if (!evictOldest()) {
+            return nullptr;
+        }
+    }
+    uint8_t* data = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (data == nullptr) {
+        return nullptr;
+    }
+    strcpy(slot->path, path);
+    slot->header = header;
+    slot->data = data;
+    slot->bytes = bytes;
+    slot->stale = false;
+    totalBytes += bytes;
+    return slot;
+}
+//*** 从逐行解码的解码器读取整幅图像到缓存条目
+bool ImageCache::readLines(lv_img_decoder_dsc_t* decoded, CacheEntry* entry) {
+    lv_coord_t width = entry->header.w;
+    lv_coord_t height = entry->header.h;
+    size_t rowBytes = entry->bytes / height;
+    for (lv_coord_t y = 0; y < height; y++) {
+        if (lv_img_decoder_read_line(decoded, 0, y, width, entry->data + y * rowBytes) != LV_RES_OK) {
+            return false;
+        }
+    }
+    return true;
+}
+//*** 读取图像信息
+lv_res_t ImageCache::infoCallback(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header) {
+    LV_UNUSED(decoder);
+    ImageCache* self = getInstance();
+    if (self->decoding || lv_img_src_get_type(src) != LV_IMG_SRC_FILE) {
+        return LV_RES_INV;
+    }
+    CacheEntry* entry = self->findEntry((const char*)src);
+    if (entry != nullptr) {
+        *header = entry->header;
+        return LV_RES_OK;
+    }
+    // 未缓存：由后面的解码器读取图像信息
+    self->decoding = true;
+    lv_res_t res = lv_img_decoder_get_info(src, header);
+    self->decoding = false;
+    return res;
+}
+//*** 打开图像
+lv_res_t ImageCache::openCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    ImageCache* self = getInstance();
+    const char* path = (const char*)dsc->src;
+    unsigned long startTime = micros();
+    self->releaseStale();
+    ImageCacheSession* session = (ImageCacheSession*)lv_mem_alloc(sizeof(ImageCacheSession));
+    if (session == nullptr) {
+        return LV_RES_INV;
+    }
+    memset(session, 0, sizeof(ImageCacheSession));
+    CacheEntry* entry = self->findEntry(path);
+    if (entry != nullptr) {
+        // 命中：直接使用缓存的像素
+        self->hits++;
+        entry->hits++;
+        self->hitMicros += micros() - startTime;
+    } else {
+        // 未命中：调用后面的解码器解码整幅图像
+        self->decoding = true;
+        lv_res_t res = lv_img_decoder_open(&session->inner, path, dsc->color, dsc->frame_id);
+        self->decoding = false;
+        if (res != LV_RES_OK) {
+            lv_mem_free(session);
+            return LV_RES_INV;
+        }
+        const lv_img_header_t& header = session->inner.header;
+        if (session->inner.img_data != nullptr) {
+            entry = self->insert(path, header);
+            if (entry != nullptr) {
+                memcpy(entry->data, session->inner.img_data, entry->bytes);
+            }
+        } else if (strcmp(lv_fs_get_ext(path), "png") == 0 &&
+                   (header.cf == LV_IMG_CF_TRUE_COLOR || header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA)) {
+            // 逐行解码的PNG：逐行读取到缓存中，解码时不需要整幅RGBA的临时内存
+            // （JPEG文件的流式解码本来就是为了不保存整幅位图，仍交给后面的解码器）
+            entry = self->insert(path, header);
+            if (entry != nullptr && !readLines(&session->inner, entry)) {
+                self->eraseEntry(entry);
+                entry = nullptr;
+            }
+        }
+        uint32_t elapsed = micros() - startTime;
+        self->misses++;
+        self->missMicros += elapsed;
+        if (entry != nullptr) {
+            entry->decodeMicros = elapsed;
+            lv_img_decoder_close(&session->inner);
+        } else {
+            // 无法缓存：本次会话转交给后面的解码器
+            self->passThroughs++;
+            session->innerOpen = true;
+            dsc->header = session->inner.header;
+            dsc->img_data = session->inner.img_data;
+            dsc->user_data = session;
+            return LV_RES_OK;
+        }
+    }
+    entry->refCount++;
+    entry->lastUsed = ++self->useCounter;
+    session->entry = entry;
+    dsc->header = entry->header;
+    dsc->img_data = entry->data;
+    dsc->user_data = session;
+    return LV_RES_OK;
+}
+//*** 读取一行（只有转交给后面的解码器且其逐行解码时才会调用）
+lv_res_t ImageCache::readLineCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                      lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf) {
+    LV_UNUSED(decoder);
+    ImageCacheSession* session = (ImageCacheSession*)dsc->user_data;
+    if (session == nullptr || !session->innerOpen) {
+        return LV_RES_INV;
+    }
+    return lv_img_decoder_read_line(&session->inner, x, y, len, buf);
+}
+//*** 关闭图像
+void ImageCache::closeCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    ImageCacheSession* session = (ImageCacheSession*)dsc->user_data;
+    if (session == nullptr) {
+        return;
+    }
+    if (session->innerOpen) {
+        lv_img_decoder_close(&session->inner);
+    }
+    CacheEntry* entry = (CacheEntry*)session->entry;
+    if (entry != nullptr && entry->refCount > 0) {
+        entry->refCount--;
+    }
+    lv_mem_free(session);
+    dsc->user_data = nullptr;
+}
+//*** 文件内容改变后使缓存失效
+void ImageCache::invalidate(const char* path) {
+    // 只设置标志：条目可能正在显示任务中绘制，由显示任务在下次打开图像时释放
+    for (int i = 0; i < IMAGE_CACHE_MAX_ENTRIES; i++) {
+        if (entries[i].path[0] != '\0' && pathMatches(entries[i].path, path)) {
+            entries[i].stale = true;
+        }
+    }
+}
+//*** 使全部缓存失效
+void ImageCache::invalidateAll() {
+    for (int i = 0; i < IMAGE_CACHE_MAX_ENTRIES; i++) {
+        if (entries[i].path[0] != '\0') {
+            entries[i].stale = true;
+        }
+    }
+}
+//*** 生成统计JSON
+String ImageCache::getStatsJson() {
+    JsonDocument doc;
+    uint32_t lookups = hits + misses;
+    doc["budget_bytes"] = IMAGE_CACHE_BUDGET;
+    doc["used_bytes"] = totalBytes;
+    doc["hits"] = hits;
+    doc["misses"] = misses;
+    doc["hit_rate"] = lookups > 0 ? (float)hits / lookups : 0;
+    doc["pass_throughs"] = passThroughs;
+    doc["evictions"] = evictions;
+    doc["invalidations"] = invalidations;
+    doc["avg_miss_us"] = misses > 0 ? (uint32_t)(missMicros / misses) : 0;
+    doc["avg_hit_us"] = hits > 0 ? (uint32_t)(hitMicros / hits) : 0;
+    JsonArray images = doc["images"].to<JsonArray>();
+    for (int i = 0; i < IMAGE_CACHE_MAX_ENTRIES; i++) {
+        const CacheEntry& entry = entries[i];
+        if (entry.path[0] == '\0') {
+            continue;
+        }
+        JsonObject image = images.add<JsonObject>();
+        image["path"] = entry.path;
+        image["width"] = entry.header.w;
+        image["height"] = entry.header.h;
+        image["bytes"] = entry.bytes;
+        image["decode_us"] = entry.decodeMicros;
+        image["hits"] = entry.hits;
+        image["stale"] = (bool)entry.stale;
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
@@ -0,0 +1,100 @@
+#ifndef IMAGE_CACHE_H
+#define IMAGE_CACHE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// 解码图像缓存的PSRAM预算（字节），超出时按最近最少使用顺序释放
+const size_t IMAGE_CACHE_BUDGET = 1024 * 1024;
+// 最多缓存的图像数量
+const int IMAGE_CACHE_MAX_ENTRIES = 16;
+// 图像路径的最大长度（包括盘符，如"S:/images/iciba.png"）
+const int IMAGE_CACHE_PATH_SIZE = 48;
+
+/**
+ * 文件图像解码缓存类
+ * LV_IMG_CACHE_DEF_SIZE为0，LVGL每次绘制文件图像（如SPIFFS中的PNG）都会重新读取并解码整个文件。
+ * 本类注册为最先尝试的图像解码器：文件图像第一次打开时调用后面的解码器解码，把结果复制到PSRAM中按路径缓存，
+ * 之后的绘制直接使用缓存的像素；逐行解码的PNG文件逐行读取到缓存中；超出预算或无法缓存的图像原样交给后面的解码器
+ */
+class ImageCache {
+private:
+    static ImageCache* instance;   // 单例实例
+
+    // 缓存条目
+    struct CacheEntry {
+        char path[IMAGE_CACHE_PATH_SIZE]; // 图像路径（为空表示空闲条目）
+        lv_img_header_t header;   // 解码后的图像信息
+        uint8_t* data;            // 解码后的像素（PSRAM）
+        size_t bytes;             // 像素字节数
+        uint32_t lastUsed;        // 最近使用序号
+        uint16_t refCount;        // 正在绘制该图像的解码会话数量
+        volatile bool stale;      // 文件已改变，不再使用，空闲时释放
+        uint32_t decodeMicros;    // 解码耗时（微秒）
+        uint32_t hits;            // 命中次数
+    };
+
+    CacheEntry entries[IMAGE_CACHE_MAX_ENTRIES];
+    size_t totalBytes;            // 缓存占用的总字节数
+    uint32_t useCounter;          // 使用序号计数器
+    uint32_t hits;                // 命中次数
+    uint32_t misses;              // 未命中（需要解码）次数
+    uint32_t passThroughs;        // 未缓存、交给后面的解码器处理的次数
+    uint32_t evictions;           // 因预算释放的条目数
+    uint32_t invalidations;       // 因文件改变释放的条目数
+    uint64_t missMicros;          // 所有未命中的解码总耗时（微秒）
+    uint64_t hitMicros;           // 所有命中的查找总耗时（微秒）
+    bool decoding;                // 正在调用后面的解码器（防止递归进入本解码器）
+
+    // 私有构造函数（单例模式）
+    ImageCache();
+
+    // 查找路径对应的有效条目
+    CacheEntry* findEntry(const char* path);
+
+    // 释放一个缓存条目
+    void eraseEntry(CacheEntry* entry);
+
+    // 释放已失效且未在绘制中的条目
+    void releaseStale();
+
+    // 释放最久未使用且未在绘制中的条目，没有可释放的条目时返回false
+    bool evictOldest();
+
+    // 为解码结果腾出空间并分配像素内存，失败时返回nullptr
+    CacheEntry* insert(const char* path, const lv_img_header_t& header);
+
+    // 从逐行解码的解码器读取整幅图像到缓存条目
+    static bool readLines(lv_img_decoder_dsc_t* decoded, CacheEntry* entry);
+
+    // 解码后像素数据的字节数，无法确定时返回0
+    static size_t decodedSize(const lv_img_header_t& header);
+
+    // 比较路径（忽略盘符前缀"S:"）
+    static bool pathMatches(const char* cached, const char* path);
+
+    // LVGL解码器回调
+    static lv_res_t infoCallback(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header);
+    static lv_res_t openCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+    static lv_res_t readLineCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                     lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf);
+    static void closeCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+
+public:
+    // 获取单例实例
+    static ImageCache* getInstance();
+
+    // 注册解码器（须在所有其他图像解码器之后注册，使其最先被尝试）
+    void init();
+
+    // 文件内容改变后使缓存失效，路径可带或不带盘符（如"/images/iciba.png"）；可在任意任务中调用
+    void invalidate(const char* path);
+
+    // 使全部缓存失效
+    void invalidateAll();
+
+    // 生成统计JSON：命中率、占用的PSRAM和每幅图像的解码耗时
+    String getStatsJson();
+};
+
+#endif // IMAGE_CACHE_H
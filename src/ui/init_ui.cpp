@@ -5,11 +5,23 @@
 #include "lv_conf_internal.h"
 #include "../images/images.h"
 #include "ui_utils.h"
+#include "screen_capture.h"
+#include "network/screen_mirror.h"
+#include "gif_background.h"
+#include "rle_image.h"
+#include "jpeg_image.h"
+#include "png_image.h"
+#include "image_cache.h"
+#include "manager/asset_bundle.h"
+#include "manager/image_ingest.h"
+#include "font_loader.h"
 // 声明全局字体
 extern const lv_font_t lvgl_font_digital_24;
 extern const lv_font_t lvgl_font_digital_48;
 extern const lv_font_t lvgl_font_digital_108;
 extern const lv_font_t lvgl_font_digital_64;
+// 中文字体（initDisplayDriver中解析）
+const lv_font_t* GBFont = &lvgl_font_song_16;
 // LVGL对象定义
 lv_obj_t* mao_select_label = nullptr;
 lv_obj_t* toxic_soul_label = nullptr;
@@ -40,9 +52,30 @@ void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color
   tft.setAddrWindow(area->x1, area->y1, w, h);
   tft.pushColors((uint16_t *)&color_p->full, w * h, true);
   tft.endWrite();
+  // 截图期间把刚送往屏幕的条带交给Web任务发送
+  ScreenCapture* capture = ScreenCapture::getInstance();
+  if (capture->isActive()) {
+    capture->onFlush(area, color_p);
+  }
+  // 有客户端观看镜像时编码脏矩形，没有客户端时不做任何复制
+  ScreenMirror* mirror = ScreenMirror::getInstance();
+  if (mirror->isMirroring()) {
+    mirror->onFlush(area, color_p);
+  }
   lv_disp_flush_ready(disp);
 }
 
+// 屏幕控制器睡眠和唤醒
+void setPanelSleep(bool sleep) {
+  if (sleep) {
+    tft.writecommand(TFT_SLPIN);
+  } else {
+    tft.writecommand(TFT_SLPOUT);
+    // 退出睡眠后需等待120ms才能发送其他命令
+    delay(120);
+  }
+}
+
 // 初始化LVGL显示驱动
 void initDisplayDriver() {
   // 初始化显示屏
@@ -61,6 +94,18 @@ void initDisplayDriver() {
   disp_drv.draw_buf = &draw_buf;
   disp_drv.flush_cb = my_disp_flush;
   lv_disp_drv_register(&disp_drv);
+  // 注册压缩背景图像的解码器
+  RleImage::init();
+  // 注册JPEG图像的流式解码器
+  JpegImage::init();
+  // 注册PNG图像的流式解码器（先于LVGL自带的PNG解码器被尝试）
+  PngImage::init();
+  // 文件图像解码缓存（最后注册，最先被尝试）
+  ImageCache::getInstance()->init();
+  // 映射资源分区（须在创建使用图像和字体的元素之前）
+  AssetBundle::getInstance()->init();
+  // 解析中文字体，之后各处直接使用GBFont，不再按名称查找
+  GBFont = FontLoader::getInstance()->font("song16", AssetBundle::getInstance()->font("song16", &lvgl_font_song_16));
 }
 
 // 初始化UI元素
@@ -68,27 +113,55 @@ void initUI() {
   Serial.println("初始化UI元素...");
   // 初始化显示驱动
   initDisplayDriver();
+  // 创建截图的同步信号量（须在Web任务启动之前）
+  ScreenCapture::getInstance()->init();
   // 设置背景颜色
   lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(0x000000), 0);
   
-// 使用通用函数创建所有标签
+// 各屏幕的标签和图像不在启动时创建，由ScreenLifecycle在进入屏幕时按需创建
+Serial.println("UI元素初始化完成");
+}
+
+// 创建屏幕背景图像：SPIFFS中有同名GIF（/gif/<名称>.gif）时使用动画背景，
+// 否则依次使用同名的导入图像（如每日一句的分享图片）、资源分区中的图像和编译进固件的静态图像
+lv_obj_t* createBackground(const char* name, const lv_img_dsc_t* src, int width, int height, int xOfs, int yOfs) {
+  char path[32];
+  snprintf(path, sizeof(path), GIF_BACKGROUND_DIR "%s.gif", name);
+  lv_obj_t* gif = GifBackground::createFromFile(path, xOfs, yOfs);
+  return gif != nullptr ? gif : createImage(ImageIngest::getInstance()->image(name, AssetBundle::getInstance()->image(name, src)),
+                                             width, height, xOfs, yOfs);
+}
+
+// 各屏幕元素的创建函数：使用通用函数创建标签和图像（标签先于图像创建，保持原有层级）
+void buildNewsScreen() {
 news_label =       createLabel(GBFont,     lv_color_hex(0xFFFFFF),  0, 85,screenHeight-85,  lv_color_hex(0xdddddd));
+}
+void buildCalendarScreen() {
 calendar_label =   createLabel(GBFont,     lv_color_hex(0xFFFFFF), 120, 240);
 today_date_label = createLabel(&lvgl_font_digital_108, lv_color_hex(0xFF0000),  0, 85, 0, lv_color_hex(0x000000), LV_OPA_TRANSP, false);
+calendar_img   = createBackground("calendar", &calendar,  120, 120,   0, 360);
+}
+void buildIcibaScreen() {
 iciba_label =      createLabel(GBFont,     lv_color_hex(0xFFFFFF),  0, 85, screenHeight-85, lv_color_hex(0x3E92F2));
+iciba_img      = createBackground("iciba", &iciba,     80, 80,    0, 400);
+}
+void buildAstronautsScreen() {
 astronauts_label = createLabel(GBFont,     lv_color_hex(0xFFFFFF),  0, 85,screenHeight-85,  lv_color_hex(0x000080));
+astronauts_img = createBackground("astronauts", &astronauts,320, 80,   0, 400);
+}
+void buildMaoSelectScreen() {
 mao_select_label = createLabel(GBFont,     lv_color_hex(0xFFFFFF),  0, 220);  
+maoselect_img  = createBackground("maoselect", &maoselect, 320, 120,  0, 80);
+}
+void buildToxicSoulScreen() {
 toxic_soul_label = createLabel(GBFont,     lv_color_hex(0xFFFFFF),  0, 85, screenHeight-85, lv_color_hex(0xFFCF03));
+toxic_soul_img = createBackground("taxicsoul", &taxicsoul, 320, 160,  0, 320);
+}
+void buildSoulScreen() {
 soul_label =       createLabel(GBFont,     lv_color_hex(0xFFFFFF),  0, 85,screenHeight-85,  lv_color_hex(0xE49E00));
+soul_img       = createBackground("soul", &soul,      320, 120,  0, 360);
+}
+void buildNoteScreen() {
 // 创建留言板标签
 note_label =       createLabel(GBFont, lv_color_hex(0xFFFFFF),  0, 110);
-
-// 使用通用函数创建所有图像
-calendar_img   = createImage(&calendar,  120, 120,   0, 360);
-iciba_img      = createImage(&iciba,     80, 80,    0, 400);
-astronauts_img = createImage(&astronauts,320, 80,   0, 400);
-maoselect_img  = createImage(&maoselect, 320, 120,  0, 80);
-toxic_soul_img = createImage(&taxicsoul, 320, 160,  0, 320);
-soul_img       = createImage(&soul,      320, 120,  0, 360);
-Serial.println("UI元素初始化完成");
 }
\ No newline at end of file
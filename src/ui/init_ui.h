@@ -23,8 +23,26 @@ extern lv_obj_t* news_label;
 extern lv_obj_t* calendar_label;
 extern lv_obj_t* calendar_img;
 extern lv_obj_t* today_date_label;
+extern lv_obj_t* note_label;
 
 // 函数声明
 void initUI();
 
+// 让屏幕控制器进入或退出睡眠模式（SLPIN/SLPOUT），睡眠期间显存内容保持不变
+void setPanelSleep(bool sleep);
+
+// 创建屏幕背景图像：依次使用SPIFFS中的同名GIF、导入图像、资源分区中的图像和编译进固件的静态图像src
+// （内置创建函数和布局引擎共用）
+lv_obj_t* createBackground(const char* name, const lv_img_dsc_t* src, int width, int height, int xOfs, int yOfs);
+
+// 各屏幕元素的创建函数（由ScreenLifecycle在进入屏幕时调用）
+void buildNewsScreen();
+void buildCalendarScreen();
+void buildIcibaScreen();
+void buildAstronautsScreen();
+void buildMaoSelectScreen();
+void buildToxicSoulScreen();
+void buildSoulScreen();
+void buildNoteScreen();
+
 #endif // INIT_UI_H
\ No newline at end of file
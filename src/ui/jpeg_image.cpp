@@ -0,0 +1,260 @@
+#include "jpeg_image.h"
+#include <ArduinoJson.h>
+#include <JPEGDecoder.h>
+#include <SPIFFS.h>
+
+// 统计表
+JpegImageStats JpegImage::stats[JPEG_IMAGE_MAX_STATS];
+int JpegImage::statsCount = 0;
+
+/**
+ * JPEGDecoder提供的MCU来源（JPEGDecoder只有一个全局实例，同一时间只能解码一幅图像）
+ * 图像键为统计项：内存图像从描述符的数据解码，文件图像从SPIFFS解码
+ */
+class JpegDecoderSource : public JpegMcuSource {
+public:
+    bool start(const void* image, JpegStripInfo& info) override {
+        const JpegImageStats* item = (const JpegImageStats*)image;
+        int res;
+        if (item->data != nullptr) {
+            const lv_img_dsc_t* dsc = (const lv_img_dsc_t*)item->data;
+            res = JpegDec.decodeArray(dsc->data, dsc->data_size);
+        } else {
+            res = JpegDec.decodeFsFile(item->path + 2);
+        }
+        if (res != 1 || JpegDec.width != item->width || JpegDec.height != item->height) {
+            Serial.printf("JPEG图像解码失败: %s\n", item->data != nullptr ? "内存图像" : item->path);
+            JpegDec.abort();
+            return false;
+        }
+        info.width = JpegDec.width;
+        info.height = JpegDec.height;
+        info.mcuWidth = JpegDec.MCUWidth;
+        info.mcuHeight = JpegDec.MCUHeight;
+        return true;
+    }
+    bool readMcu(uint16_t& mcuX, const uint16_t*& pixels) override {
+        if (!JpegDec.read()) {
+            return false;
+        }
+        mcuX = JpegDec.MCUx;
+        pixels = JpegDec.pImage;
+        return true;
+    }
+    void abort() override {
+        JpegDec.abort();
+    }
+};
+static JpegDecoderSource decoderSource;
+// 条带（所有JPEG图像共用）
+static JpegStrip strip(&decoderSource);
+
+// JPEG段标记
+static const uint8_t JPEG_MARKER = 0xFF;
+static const uint8_t JPEG_SOI = 0xD8;
+
+// 检查段标记是否为帧开始（SOF0~SOF15，不包括DHT、JPG和DAC）
+static inline bool isSofMarker(uint8_t marker) {
+    return marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+}
+
+//*** 注册解码器
+void JpegImage::init() {
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+    lv_img_decoder_t* decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, infoCallback);
+    lv_img_decoder_set_open_cb(decoder, openCallback);
+    lv_img_decoder_set_read_line_cb(decoder, readLineCallback);
+    lv_img_decoder_set_close_cb(decoder, closeCallback);
+    Serial.println("JPEG图像解码器已注册");
+#else
+    Serial.println("JPEG图像只支持RGB565（LV_COLOR_16_SWAP = 0），解码器未注册");
+#endif
+}
+//*** 从JPEG数据中读取宽高
+bool JpegImage::parseSize(const uint8_t* data, size_t length, uint16_t& width, uint16_t& height) {
+    if (length < 4 || data[0] != JPEG_MARKER || data[1] != JPEG_SOI) {
+        return false;
+    }
+    size_t pos = 2;
+    while (pos + 4 <= length) {
+        if (data[pos] != JPEG_MARKER) {
+            return false;
+        }
+        uint8_t marker = data[pos + 1];
+        uint16_t segment = (data[pos + 2] << 8) | data[pos + 3];
+        if (isSofMarker(marker)) {
+            if (pos + 9 > length) {
+                return false;
+            }
+            height = (data[pos + 5] << 8) | data[pos + 6];
+            width = (data[pos + 7] << 8) | data[pos + 8];
+            return width > 0 && height > 0;
+        }
+        pos += 2 + segment;
+    }
+    return false;
+}
+//*** 从SPIFFS中的JPEG文件读取宽高（逐段跳过，不读取整个文件）
+static bool parseFileSize(const char* path, uint16_t& width, uint16_t& height, uint32_t& fileBytes) {
+    File file = SPIFFS.open(path, "r");
+    if (!file) {
+        return false;
+    }
+    fileBytes = file.size();
+    uint8_t buf[9];
+    bool found = false;
+    if (file.read(buf, 2) == 2 && buf[0] == JPEG_MARKER && buf[1] == JPEG_SOI) {
+        while (file.read(buf, 4) == 4 && buf[0] == JPEG_MARKER) {
+            uint16_t segment = (buf[2] << 8) | buf[3];
+            if (isSofMarker(buf[1])) {
+                if (file.read(buf + 4, 5) == 5) {
+                    height = (buf[5] << 8) | buf[6];
+                    width = (buf[7] << 8) | buf[8];
+                    found = width > 0 && height > 0;
+                }
+                break;
+            }
+            if (!file.seek(file.position() + segment - 2)) {
+                break;
+            }
+        }
+    }
+    file.close();
+    return found;
+}
+//*** 检查是否为JPEG图像源
+bool JpegImage::isJpegSource(const void* src) {
+    lv_img_src_t type = lv_img_src_get_type(src);
+    if (type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t* dsc = (const lv_img_dsc_t*)src;
+        return dsc->header.cf == JPEG_IMAGE_CF && dsc->data != nullptr && dsc->data_size > 2 &&
+               dsc->data[0] == JPEG_MARKER && dsc->data[1] == JPEG_SOI;
+    }
+    if (type == LV_IMG_SRC_FILE) {
+        // 只支持SPIFFS（S:盘符）中的文件
+        const char* path = (const char*)src;
+        const char* ext = lv_fs_get_ext(path);
+        return path[0] == 'S' && path[1] == ':' && (strcmp(ext, "jpg") == 0 || strcmp(ext, "jpeg") == 0);
+    }
+    return false;
+}
+//*** 查找图像的统计项
+JpegImageStats* JpegImage::findStats(const void* src) {
+    bool isFile = lv_img_src_get_type(src) == LV_IMG_SRC_FILE;
+    for (int i = 0; i < statsCount; i++) {
+        if (isFile ? strcmp(stats[i].path, (const char*)src) == 0 : stats[i].data == src) {
+            return &stats[i];
+        }
+    }
+    if (statsCount >= JPEG_IMAGE_MAX_STATS) {
+        return nullptr;
+    }
+    JpegImageStats item;
+    memset(&item, 0, sizeof(JpegImageStats));
+    if (isFile) {
+        const char* path = (const char*)src;
+        if (strlen(path) >= JPEG_IMAGE_PATH_SIZE || !parseFileSize(path + 2, item.width, item.height, item.jpegBytes)) {
+            return nullptr;
+        }
+        strcpy(item.path, path);
+    } else {
+        const lv_img_dsc_t* dsc = (const lv_img_dsc_t*)src;
+        item.data = src;
+        item.width = dsc->header.w;
+        item.height = dsc->header.h;
+        item.jpegBytes = dsc->data_size;
+    }
+    stats[statsCount] = item;
+    return &stats[statsCount++];
+}
+//*** 读取图像信息
+lv_res_t JpegImage::infoCallback(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header) {
+    LV_UNUSED(decoder);
+    if (!isJpegSource(src)) {
+        return LV_RES_INV;
+    }
+    JpegImageStats* item = findStats(src);
+    if (item == nullptr) {
+        return LV_RES_INV;
+    }
+    header->cf = LV_IMG_CF_TRUE_COLOR;
+    header->always_zero = 0;
+    header->w = item->width;
+    header->h = item->height;
+    return LV_RES_OK;
+}
+//*** 打开图像
+lv_res_t JpegImage::openCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    JpegImageStats* item = findStats(dsc->src);
+    if (item == nullptr) {
+        return LV_RES_INV;
+    }
+    item->draws++;
+    dsc->user_data = item;
+    // 不提供整幅图像，LVGL逐行调用readLineCallback
+    dsc->img_data = nullptr;
+    return LV_RES_OK;
+}
+//*** 读取一行
+lv_res_t JpegImage::readLineCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                     lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf) {
+    LV_UNUSED(decoder);
+    JpegImageStats* item = (JpegImageStats*)dsc->user_data;
+    if (item == nullptr || y < 0 || y >= item->height || x < 0 || len <= 0 || x + len > item->width) {
+        return LV_RES_INV;
+    }
+    // 只统计解码了MCU行的读取的耗时（从条带中复制一行可忽略）
+    uint32_t strips = item->decode.strips;
+    unsigned long startTime = micros();
+    if (!strip.readLine(item, &item->decode, x, y, len, buf)) {
+        return LV_RES_INV;
+    }
+    if (item->decode.strips != strips) {
+        item->decodeMicros += micros() - startTime;
+    }
+    return LV_RES_OK;
+}
+//*** 关闭图像（解码流保留给下一个绘制区域继续使用）
+void JpegImage::closeCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    dsc->user_data = nullptr;
+}
+//*** 条带缓冲区占用的字节数
+size_t JpegImage::getStripBytes() {
+    return strip.getStripBytes();
+}
+//*** 生成统计JSON
+String JpegImage::getStatsJson() {
+    JsonDocument doc;
+    doc["strip_bytes"] = strip.getStripBytes();
+    JsonArray images = doc["images"].to<JsonArray>();
+    for (int i = 0; i < statsCount; i++) {
+        const JpegImageStats& item = stats[i];
+        uint32_t rawBytes = item.width * item.height * 2;
+        JsonObject image = images.add<JsonObject>();
+        if (item.data != nullptr) {
+            char name[16];
+            snprintf(name, sizeof(name), "%p", item.data);
+            image["name"] = name;
+        } else {
+            image["name"] = item.path;
+        }
+        image["width"] = item.width;
+        image["height"] = item.height;
+        image["raw_bytes"] = rawBytes;
+        image["jpeg_bytes"] = item.jpegBytes;
+        image["ratio"] = item.jpegBytes > 0 ? (float)rawBytes / item.jpegBytes : 0;
+        image["draws"] = item.draws;
+        image["restarts"] = item.decode.restarts;
+        image["strips"] = item.decode.strips;
+        image["pixels"] = item.decode.pixels;
+        image["decode_us"] = item.decodeMicros;
+        // 吞吐量：每秒百万像素
+        image["decode_mpix_s"] = item.decodeMicros > 0 ? (float)item.decode.pixels / item.decodeMicros : 0;
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
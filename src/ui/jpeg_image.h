@@ -0,0 +1,65 @@
+#ifndef JPEG_IMAGE_H
+#define JPEG_IMAGE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "jpeg_strip.h"
+
+// 内存中的JPEG图像使用的颜色格式（数据为完整的JPEG文件，如资源包中的JPEG图像）
+#define JPEG_IMAGE_CF LV_IMG_CF_USER_ENCODED_1
+// 统计表大小（同时记录文件图像的宽高，避免每次绘制都重新解析文件头）
+const int JPEG_IMAGE_MAX_STATS = 8;
+// 文件图像路径的最大长度（包括盘符，如"S:/images/soul.jpg"）
+const int JPEG_IMAGE_PATH_SIZE = 40;
+
+// 单幅JPEG图像的统计
+struct JpegImageStats {
+    const void* data;            // 内存中的图像数据（文件图像为空）
+    char path[JPEG_IMAGE_PATH_SIZE]; // 文件图像的路径
+    uint16_t width;
+    uint16_t height;
+    uint32_t jpegBytes;          // JPEG数据大小
+    uint32_t draws;              // 绘制次数（每次打开解码器）
+    JpegStripCounters decode;    // 从头解码次数、解码的MCU行数和像素数
+    uint64_t decodeMicros;       // 解码累计耗时
+};
+
+/**
+ * 流式JPEG图像解码器类
+ * 逐行读取由JpegStrip完成（每次解码一行MCU到条带缓冲区，整幅图像每帧只解码一次，见jpeg_strip.h），
+ * 本类提供JPEGDecoder的MCU来源、LVGL解码器回调和统计。
+ * 支持SPIFFS中的JPEG文件（"S:/images/soul.jpg"）和内存中颜色格式为JPEG_IMAGE_CF的图像（如资源包中的JPEG）
+ */
+class JpegImage {
+private:
+    static JpegImageStats stats[JPEG_IMAGE_MAX_STATS]; // 统计表
+    static int statsCount;
+
+    // 检查是否为JPEG图像源
+    static bool isJpegSource(const void* src);
+
+    // 查找（或新建）图像的统计项，文件图像第一次出现时解析文件头得到宽高
+    static JpegImageStats* findStats(const void* src);
+
+    // LVGL解码器回调
+    static lv_res_t infoCallback(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header);
+    static lv_res_t openCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+    static lv_res_t readLineCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                     lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf);
+    static void closeCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+
+public:
+    // 注册解码器（须在lv_init之后调用）
+    static void init();
+
+    // 从JPEG数据中读取宽高（解析SOF段），成功返回true
+    static bool parseSize(const uint8_t* data, size_t length, uint16_t& width, uint16_t& height);
+
+    // 条带缓冲区占用的字节数（解码时的峰值内存）
+    static size_t getStripBytes();
+
+    // 生成统计JSON：每幅图像的压缩率、解码吞吐量和条带缓冲区大小
+    static String getStatsJson();
+};
+
+#endif // JPEG_IMAGE_H
@@ -0,0 +1,127 @@
+#include "jpeg_strip.h"
+#include <string.h>
+#include <stdlib.h>
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#endif
+
+//*** 分配条带缓冲区（设备上优先放在内部RAM中，逐行读取时比PSRAM快）
+static lv_color_t* allocStrip(size_t bytes) {
+#ifdef ARDUINO
+    lv_color_t* buffer = (lv_color_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (buffer == nullptr) {
+        buffer = (lv_color_t*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    return buffer;
+#else
+    return (lv_color_t*)malloc(bytes);
+#endif
+}
+
+//*** 构造函数
+JpegStrip::JpegStrip(JpegMcuSource* mcuSource) {
+    source = mcuSource;
+    image = nullptr;
+    counters = nullptr;
+    decoding = false;
+    memset(&info, 0, sizeof(info));
+    mcusPerRow = 0;
+    stripY = 0;
+    stripRows = 0;
+    strip = nullptr;
+    stripBytes = 0;
+}
+//*** 析构函数
+JpegStrip::~JpegStrip() {
+    end();
+    free(strip);
+}
+//*** 从头开始解码图像
+bool JpegStrip::start(const void* src, JpegStripCounters* imageCounters) {
+    end();
+    image = nullptr;
+    if (!source->start(src, info)) {
+        return false;
+    }
+    decoding = true;
+    if (info.width == 0 || info.height == 0 || info.mcuWidth == 0 || info.mcuHeight == 0) {
+        end();
+        return false;
+    }
+    size_t bytes = (size_t)info.width * info.mcuHeight * sizeof(lv_color_t);
+    if (strip == nullptr || stripBytes < bytes) {
+        free(strip);
+        strip = allocStrip(bytes);
+        stripBytes = strip != nullptr ? bytes : 0;
+        if (strip == nullptr) {
+            end();
+            return false;
+        }
+    }
+    image = src;
+    counters = imageCounters;
+    mcusPerRow = (info.width + info.mcuWidth - 1) / info.mcuWidth;
+    stripY = 0;
+    stripRows = 0;
+    counters->restarts++;
+    return true;
+}
+//*** 解码下一行MCU到条带缓冲区
+bool JpegStrip::decodeStrip() {
+    if (!decoding) {
+        return false;
+    }
+    lv_coord_t y = stripY + stripRows;
+    lv_coord_t rows = LV_MIN(info.mcuHeight, info.height - y);
+    for (int i = 0; i < mcusPerRow; i++) {
+        uint16_t mcuX = 0;
+        const uint16_t* block = nullptr;
+        if (!source->readMcu(mcuX, block) || mcuX >= mcusPerRow) {
+            end();
+            image = nullptr;
+            return false;
+        }
+        // MCU按行从左到右输出，右边缘的MCU只复制图像内的部分
+        lv_coord_t x = mcuX * info.mcuWidth;
+        lv_coord_t width = LV_MIN(info.mcuWidth, info.width - x);
+        for (lv_coord_t row = 0; row < rows; row++) {
+            memcpy(strip + row * info.width + x, block + row * info.mcuWidth, width * sizeof(lv_color_t));
+        }
+    }
+    stripY = y;
+    stripRows = rows;
+    if (y + rows >= info.height) {
+        // 最后一行MCU已解码：关闭来源，条带中的行仍可读取
+        end();
+    }
+    counters->strips++;
+    counters->pixels += (uint32_t)info.width * rows;
+    return true;
+}
+//*** 结束解码
+void JpegStrip::end() {
+    if (decoding) {
+        source->abort();
+        decoding = false;
+    }
+}
+//*** 读取一行
+bool JpegStrip::readLine(const void* src, JpegStripCounters* imageCounters, lv_coord_t x, lv_coord_t y,
+                         lv_coord_t len, uint8_t* buf) {
+    // 换了图像或需要条带之前的行时只能从头解码；同一次刷新中后续区域的行号递增，继续向下解码即可
+    if (image != src || y < stripY) {
+        if (!start(src, imageCounters)) {
+            return false;
+        }
+    }
+    if (y < 0 || y >= info.height || x < 0 || len <= 0 || x + len > info.width) {
+        return false;
+    }
+    while (y >= stripY + stripRows) {
+        if (!decodeStrip()) {
+            return false;
+        }
+    }
+    memcpy(buf, strip + (y - stripY) * info.width + x, len * sizeof(lv_color_t));
+    return true;
+}
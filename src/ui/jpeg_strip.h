@@ -0,0 +1,83 @@
+#ifndef JPEG_STRIP_H
+#define JPEG_STRIP_H
+
+// 本文件不依赖Arduino和JPEG库：MCU由JpegMcuSource提供（设备上为JPEGDecoder，PC上为测试中的替身），
+// 条带的续读和重新解码可以在PC上与LVGL一起测试（见test/host/jpeg_strip_test.cpp）
+#include <stdint.h>
+#include <stddef.h>
+#include <lvgl.h>
+
+// 一次解码的图像和MCU尺寸
+struct JpegStripInfo {
+    uint16_t width;
+    uint16_t height;
+    uint16_t mcuWidth;           // MCU尺寸（通常16×16或16×8像素）
+    uint16_t mcuHeight;
+};
+
+// 解码计数（每幅图像一份，由调用方保存）
+struct JpegStripCounters {
+    uint32_t restarts;           // 从头开始解码的次数
+    uint32_t strips;             // 解码的MCU行数
+    uint64_t pixels;             // 解码的像素数
+};
+
+/**
+ * MCU来源接口
+ * JPEG只能从头顺序解码：start()从头开始，readMcu()按行从左到右输出每个MCU
+ */
+class JpegMcuSource {
+public:
+    virtual ~JpegMcuSource() {}
+
+    // 从头开始解码图像，成功时填写尺寸
+    virtual bool start(const void* image, JpegStripInfo& info) = 0;
+
+    // 解码下一个MCU，返回其列号和像素（mcuWidth×mcuHeight个RGB565，右边和下边缘超出图像的部分为填充）
+    virtual bool readMcu(uint16_t& mcuX, const uint16_t*& pixels) = 0;
+
+    // 结束解码（关闭文件）
+    virtual void abort() = 0;
+};
+
+/**
+ * MCU行条带
+ * LVGL按绘制缓冲区的区域逐行读取图像，条带每次解码一行MCU，读取的行超出条带时继续解码下一行MCU；
+ * 同一次刷新中后续区域的行号递增，因此整幅图像每帧只解码一次，任何时候只保存一个条带
+ * （宽度×MCU高度×2字节）。换了图像或需要条带之前的行时才从头解码
+ */
+class JpegStrip {
+private:
+    JpegMcuSource* source;       // MCU来源
+    const void* image;           // 正在解码的图像（为nullptr表示没有解码流）
+    JpegStripCounters* counters; // 正在解码的图像的计数
+    bool decoding;               // 来源仍打开（还有MCU行没有解码）
+    JpegStripInfo info;
+    int mcusPerRow;
+    lv_coord_t stripY;           // 条带第一行的行号
+    lv_coord_t stripRows;        // 条带中的有效行数
+    lv_color_t* strip;           // 条带缓冲区（宽度×MCU高度）
+    size_t stripBytes;
+
+    // 从头开始解码图像
+    bool start(const void* src, JpegStripCounters* imageCounters);
+
+    // 解码下一行MCU到条带缓冲区
+    bool decodeStrip();
+
+    // 结束解码，条带缓冲区保留
+    void end();
+
+public:
+    explicit JpegStrip(JpegMcuSource* mcuSource);
+    ~JpegStrip();
+
+    // 读取图像第y行从x开始的len个像素（RGB565）到buf，失败时返回false
+    bool readLine(const void* src, JpegStripCounters* imageCounters, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                  uint8_t* buf);
+
+    // 条带缓冲区占用的字节数（解码时的峰值内存）
+    size_t getStripBytes() const { return stripBytes; }
+};
+
+#endif // JPEG_STRIP_H
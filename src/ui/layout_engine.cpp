@@ -0,0 +1,523 @@
+#include "layout_engine.h"
+#include "init_ui.h"
+#include "ui_utils.h"
+#include "../images/images.h"
+#include "../manager/asset_bundle.h"
+#include "font_loader.h"
+#include "ttf_loader.h"
+#include <SPIFFS.h>
+#include <ArduinoJson.h>
+
+// 声明布局中可用的字体
+extern const lv_font_t lvgl_font_song_16;
+extern const lv_font_t lvgl_font_digital_24;
+extern const lv_font_t lvgl_font_digital_48;
+extern const lv_font_t lvgl_font_digital_64;
+extern const lv_font_t lvgl_font_digital_108;
+
+// 定义单例实例
+LayoutEngine* LayoutEngine::instance = nullptr;
+
+// 字节码指令
+enum LayoutOpcode : uint8_t {
+    OP_LABEL = 0x01,
+    OP_IMAGE = 0x02
+};
+// 指令参数长度（不含操作码）
+const size_t LABEL_ARGS_SIZE = 17;
+const size_t IMAGE_ARGS_SIZE = 10;
+// 文件头和索引项长度
+const size_t LAYOUT_HEADER_SIZE = 5;
+const size_t LAYOUT_INDEX_SIZE = 5;
+
+// 布局中的屏幕名称
+struct LayoutScreenName {
+    const char* name;
+    ScreenState screen;
+};
+static const LayoutScreenName screenNames[] = {
+    {"news", NEWS_SCREEN}, {"calendar", CALENDAR_SCREEN}, {"maoselect", MAO_SELECT_SCREEN},
+    {"toxicsoul", TOXIC_SOUL_SCREEN}, {"iciba", ICIBA_SCREEN}, {"astronauts", ASTRONAUTS_SCREEN},
+    {"soul", SOUL_SCREEN}, {"note", NOTE_SCREEN},
+};
+
+// 元素角色：布局创建的对象绑定到其他模块使用的全局指针，且只能属于所在屏幕
+struct LayoutRole {
+    const char* name;
+    ScreenState screen;
+    bool isImage;
+    lv_obj_t** slot;
+};
+static const LayoutRole roles[] = {
+    {"news_label",       NEWS_SCREEN,       false, &news_label},
+    {"calendar_label",   CALENDAR_SCREEN,   false, &calendar_label},
+    {"today_date_label", CALENDAR_SCREEN,   false, &today_date_label},
+    {"calendar_img",     CALENDAR_SCREEN,   true,  &calendar_img},
+    {"mao_select_label", MAO_SELECT_SCREEN, false, &mao_select_label},
+    {"maoselect_img",    MAO_SELECT_SCREEN, true,  &maoselect_img},
+    {"toxic_soul_label", TOXIC_SOUL_SCREEN, false, &toxic_soul_label},
+    {"toxic_soul_img",   TOXIC_SOUL_SCREEN, true,  &toxic_soul_img},
+    {"iciba_label",      ICIBA_SCREEN,      false, &iciba_label},
+    {"iciba_img",        ICIBA_SCREEN,      true,  &iciba_img},
+    {"astronauts_label", ASTRONAUTS_SCREEN, false, &astronauts_label},
+    {"astronauts_img",   ASTRONAUTS_SCREEN, true,  &astronauts_img},
+    {"soul_label",       SOUL_SCREEN,       false, &soul_label},
+    {"soul_img",         SOUL_SCREEN,       true,  &soul_img},
+    {"note_label",       NOTE_SCREEN,       false, &note_label},
+};
+const int ROLE_COUNT = sizeof(roles) / sizeof(roles[0]);
+
+// 布局中可用的字体（字体系列对应轮廓字体文件<系列>.ttf，元素指定字号时使用）
+struct LayoutFont {
+    const char* name;
+    const lv_font_t* font;
+    const char* family;
+};
+static const LayoutFont fonts[] = {
+    {"song16", &lvgl_font_song_16, "song"}, {"digital24", &lvgl_font_digital_24, "digital"},
+    {"digital48", &lvgl_font_digital_48, "digital"}, {"digital64", &lvgl_font_digital_64, "digital"},
+    {"digital108", &lvgl_font_digital_108, "digital"},
+};
+const int FONT_COUNT = sizeof(fonts) / sizeof(fonts[0]);
+
+// 布局中可用的图像
+struct LayoutImage {
+    const char* name;
+    const lv_img_dsc_t* src;
+};
+static const LayoutImage images[] = {
+    {"iciba", &iciba}, {"soul", &soul}, {"maoselect", &maoselect},
+    {"taxicsoul", &taxicsoul}, {"astronauts", &astronauts}, {"calendar", &calendar},
+};
+const int IMAGE_COUNT = sizeof(images) / sizeof(images[0]);
+
+// 内置布局（与init_ui中的创建函数一致）
+static const char* BUILTIN_LAYOUT_JSON = R"({
+  "screens": {
+    "news": [
+      {"type": "label", "role": "news_label", "y": 85, "h": 395, "bg": "#DDDDDD"}
+    ],
+    "calendar": [
+      {"type": "label", "role": "calendar_label", "x": 120, "y": 240},
+      {"type": "label", "role": "today_date_label", "font": "digital108", "color": "#FF0000", "y": 85, "wrap": false},
+      {"type": "image", "role": "calendar_img", "image": "calendar", "w": 120, "h": 120, "x": 0, "y": 360}
+    ],
+    "iciba": [
+      {"type": "label", "role": "iciba_label", "y": 85, "h": 395, "bg": "#3E92F2"},
+      {"type": "image", "role": "iciba_img", "image": "iciba", "w": 80, "h": 80, "x": 0, "y": 400}
+    ],
+    "astronauts": [
+      {"type": "label", "role": "astronauts_label", "y": 85, "h": 395, "bg": "#000080"},
+      {"type": "image", "role": "astronauts_img", "image": "astronauts", "w": 320, "h": 80, "x": 0, "y": 400}
+    ],
+    "maoselect": [
+      {"type": "label", "role": "mao_select_label", "y": 220},
+      {"type": "image", "role": "maoselect_img", "image": "maoselect", "w": 320, "h": 120, "x": 0, "y": 80}
+    ],
+    "toxicsoul": [
+      {"type": "label", "role": "toxic_soul_label", "y": 85, "h": 395, "bg": "#FFCF03"},
+      {"type": "image", "role": "toxic_soul_img", "image": "taxicsoul", "w": 320, "h": 160, "x": 0, "y": 320}
+    ],
+    "soul": [
+      {"type": "label", "role": "soul_label", "y": 85, "h": 395, "bg": "#E49E00"},
+      {"type": "image", "role": "soul_img", "image": "soul", "w": 320, "h": 120, "x": 0, "y": 360}
+    ],
+    "note": [
+      {"type": "label", "role": "note_label", "y": 110}
+    ]
+  }
+})";
+
+//*** 按名称查找表项，未找到返回-1
+template <typename T, size_t N>
+static int findByName(const T (&table)[N], const char* name) {
+    if (name == nullptr) {
+        return -1;
+    }
+    for (size_t i = 0; i < N; i++) {
+        if (strcmp(table[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+//*** 解析颜色（"#RRGGBB"、"0xRRGGBB"或整数）
+static bool parseColor(JsonVariant value, uint32_t defaultColor, uint32_t& color) {
+    if (value.isNull()) {
+        color = defaultColor;
+        return true;
+    }
+    if (value.is<uint32_t>()) {
+        color = value.as<uint32_t>();
+        return color <= 0xFFFFFF;
+    }
+    const char* text = value.as<const char*>();
+    if (text == nullptr) {
+        return false;
+    }
+    if (text[0] == '#') {
+        text++;
+    } else if (text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        text += 2;
+    }
+    char* end = nullptr;
+    color = strtoul(text, &end, 16);
+    return end != text && *end == '\0' && color <= 0xFFFFFF;
+}
+//*** 字节码写入辅助函数
+static void putU8(uint8_t* out, size_t& pos, uint8_t value) {
+    out[pos++] = value;
+}
+static void putU16(uint8_t* out, size_t& pos, uint16_t value) {
+    out[pos++] = value & 0xFF;
+    out[pos++] = value >> 8;
+}
+static void putColor(uint8_t* out, size_t& pos, uint32_t color) {
+    out[pos++] = (color >> 16) & 0xFF;
+    out[pos++] = (color >> 8) & 0xFF;
+    out[pos++] = color & 0xFF;
+}
+//*** 字节码读取辅助函数
+static int16_t getI16(const uint8_t* code) {
+    return (int16_t)(code[0] | (code[1] << 8));
+}
+static uint16_t getU16(const uint8_t* code) {
+    return code[0] | (code[1] << 8);
+}
+static uint32_t getColor(const uint8_t* code) {
+    return ((uint32_t)code[0] << 16) | ((uint32_t)code[1] << 8) | code[2];
+}
+
+//*** 私有构造函数
+LayoutEngine::LayoutEngine() {
+    program = nullptr;
+    programSize = 0;
+    reloadPending = false;
+}
+//*** 获取单例实例
+LayoutEngine* LayoutEngine::getInstance() {
+    if (instance == nullptr) {
+        instance = new LayoutEngine();
+    }
+    return instance;
+}
+//*** 初始化（加载已编译的布局）
+void LayoutEngine::init() {
+    bool loaded = loadProgram();
+    // 字节码版本不一致（固件升级）时从保存的JSON源文件重新编译
+    if (!loaded && SPIFFS.exists(LAYOUT_JSON_FILE)) {
+        File file = SPIFFS.open(LAYOUT_JSON_FILE, "r");
+        String json = file ? file.readString() : String();
+        file.close();
+        String error;
+        if (json.length() > 0 && compile(json, error)) {
+            reloadPending = false;
+            loaded = loadProgram();
+        } else {
+            Serial.printf("重新编译屏幕布局失败: %s\n", error.c_str());
+        }
+    }
+    if (loaded) {
+        Serial.printf("已加载自定义屏幕布局，字节码 %u 字节\n", programSize);
+    } else {
+        Serial.println("未找到自定义屏幕布局，使用内置布局");
+    }
+}
+//*** 从SPIFFS加载字节码
+bool LayoutEngine::loadProgram() {
+    if (program) {
+        free(program);
+        program = nullptr;
+        programSize = 0;
+    }
+    if (!SPIFFS.exists(LAYOUT_BIN_FILE)) {
+        return false;
+    }
+    File file = SPIFFS.open(LAYOUT_BIN_FILE, "r");
+    if (!file) {
+        return false;
+    }
+    size_t size = file.size();
+    if (size < LAYOUT_HEADER_SIZE || size > MAX_LAYOUT_SIZE) {
+        Serial.println("布局字节码长度无效");
+        file.close();
+        return false;
+    }
+    uint8_t* buffer = (uint8_t*)malloc(size);
+    if (buffer == nullptr) {
+        file.close();
+        return false;
+    }
+    size_t readSize = file.read(buffer, size);
+    file.close();
+    // 校验文件头
+    if (readSize != size || buffer[0] != 'L' || buffer[1] != 'Y' || buffer[2] != 'T' ||
+        buffer[3] != LAYOUT_VERSION || LAYOUT_HEADER_SIZE + buffer[4] * LAYOUT_INDEX_SIZE > size) {
+        Serial.println("布局字节码格式无效");
+        free(buffer);
+        return false;
+    }
+    program = buffer;
+    programSize = size;
+    return true;
+}
+//*** 查找指定屏幕的指令段
+bool LayoutEngine::findScreen(ScreenState screen, const uint8_t*& code, size_t& length) {
+    if (program == nullptr) {
+        return false;
+    }
+    uint8_t screenCount = program[4];
+    for (int i = 0; i < screenCount; i++) {
+        const uint8_t* entry = program + LAYOUT_HEADER_SIZE + i * LAYOUT_INDEX_SIZE;
+        if (entry[0] != screen) {
+            continue;
+        }
+        uint16_t offset = getU16(entry + 1);
+        uint16_t size = getU16(entry + 3);
+        if ((size_t)offset + size > programSize) {
+            return false;
+        }
+        code = program + offset;
+        length = size;
+        return true;
+    }
+    return false;
+}
+//*** 将JSON布局编译为字节码并保存
+bool LayoutEngine::compile(const String& json, String& error) {
+    JsonDocument doc;
+    DeserializationError jsonError = deserializeJson(doc, json);
+    if (jsonError) {
+        error = String("JSON解析失败: ") + jsonError.c_str();
+        return false;
+    }
+    JsonObject screens = doc["screens"];
+    if (screens.isNull()) {
+        error = "缺少screens字段";
+        return false;
+    }
+    size_t screenCount = screens.size();
+    size_t codeStart = LAYOUT_HEADER_SIZE + screenCount * LAYOUT_INDEX_SIZE;
+    if (codeStart > MAX_LAYOUT_SIZE) {
+        error = "屏幕数量过多";
+        return false;
+    }
+    uint8_t* out = (uint8_t*)malloc(MAX_LAYOUT_SIZE);
+    if (out == nullptr) {
+        error = "内存不足";
+        return false;
+    }
+    size_t pos = 0;
+    putU8(out, pos, 'L');
+    putU8(out, pos, 'Y');
+    putU8(out, pos, 'T');
+    putU8(out, pos, LAYOUT_VERSION);
+    putU8(out, pos, screenCount);
+    size_t indexPos = LAYOUT_HEADER_SIZE;
+    pos = codeStart;
+    uint32_t usedScreens = 0;
+    bool ok = true;
+    for (JsonPair screenPair : screens) {
+        int screenIndex = findByName(screenNames, screenPair.key().c_str());
+        if (screenIndex < 0) {
+            error = String("未知屏幕: ") + screenPair.key().c_str();
+            ok = false;
+            break;
+        }
+        ScreenState screen = screenNames[screenIndex].screen;
+        if (usedScreens & (1UL << screen)) {
+            error = String("屏幕重复定义: ") + screenPair.key().c_str();
+            ok = false;
+            break;
+        }
+        usedScreens |= 1UL << screen;
+        size_t screenStart = pos;
+        uint32_t usedRoles = 0;
+        for (JsonObject element : screenPair.value().as<JsonArray>()) {
+            const char* type = element["type"] | "";
+            int roleIndex = findByName(roles, element["role"].as<const char*>());
+            // 每个元素必须绑定到本屏幕的一个角色，生命周期管理器据此释放对象
+            if (roleIndex < 0 || roles[roleIndex].screen != screen) {
+                error = String("屏幕") + screenPair.key().c_str() + "中的角色无效: " + (element["role"] | "");
+                ok = false;
+                break;
+            }
+            if (usedRoles & (1UL << roleIndex)) {
+                error = String("角色重复: ") + roles[roleIndex].name;
+                ok = false;
+                break;
+            }
+            usedRoles |= 1UL << roleIndex;
+            if (strcmp(type, "label") == 0 && !roles[roleIndex].isImage) {
+                int fontIndex = findByName(fonts, element["font"] | "song16");
+                uint32_t color, bgColor;
+                if (fontIndex < 0) {
+                    error = String("未知字体: ") + (element["font"] | "");
+                    ok = false;
+                    break;
+                }
+                if (!parseColor(element["color"], 0xFFFFFF, color) || !parseColor(element["bg"], 0x000000, bgColor)) {
+                    error = String("颜色格式无效: ") + roles[roleIndex].name;
+                    ok = false;
+                    break;
+                }
+                // 字号为0时使用字体本身的大小
+                int size = element["size"] | 0;
+                if (size != 0 && (size < TTF_MIN_SIZE || size > TTF_MAX_SIZE)) {
+                    error = String("字号无效: ") + roles[roleIndex].name;
+                    ok = false;
+                    break;
+                }
+                if (pos + 1 + LABEL_ARGS_SIZE > MAX_LAYOUT_SIZE) {
+                    error = "布局过大";
+                    ok = false;
+                    break;
+                }
+                putU8(out, pos, OP_LABEL);
+                putU8(out, pos, roleIndex);
+                putU8(out, pos, fontIndex);
+                putColor(out, pos, color);
+                putU16(out, pos, (int16_t)(element["x"] | 0));
+                putU16(out, pos, (int16_t)(element["y"] | 0));
+                putU16(out, pos, (int16_t)(element["h"] | 0));
+                putColor(out, pos, bgColor);
+                putU8(out, pos, element["bg_opa"] | (int)LV_OPA_TRANSP);
+                putU8(out, pos, (element["wrap"] | true) ? 1 : 0);
+                putU8(out, pos, size);
+            } else if (strcmp(type, "image") == 0 && roles[roleIndex].isImage) {
+                int imageIndex = findByName(images, element["image"].as<const char*>());
+                if (imageIndex < 0) {
+                    error = String("未知图像: ") + (element["image"] | "");
+                    ok = false;
+                    break;
+                }
+                if (pos + 1 + IMAGE_ARGS_SIZE > MAX_LAYOUT_SIZE) {
+                    error = "布局过大";
+                    ok = false;
+                    break;
+                }
+                putU8(out, pos, OP_IMAGE);
+                putU8(out, pos, roleIndex);
+                putU8(out, pos, imageIndex);
+                putU16(out, pos, (int16_t)(element["w"] | 0));
+                putU16(out, pos, (int16_t)(element["h"] | 0));
+                putU16(out, pos, (int16_t)(element["x"] | 0));
+                putU16(out, pos, (int16_t)(element["y"] | 0));
+            } else {
+                error = String("元素类型与角色不匹配: ") + roles[roleIndex].name;
+                ok = false;
+                break;
+            }
+        }
+        if (!ok) {
+            break;
+        }
+        // 写入索引项
+        putU8(out, indexPos, screen);
+        putU16(out, indexPos, screenStart);
+        putU16(out, indexPos, pos - screenStart);
+    }
+    if (ok) {
+        // 保存字节码和JSON源文件（源文件用于网页再次编辑）
+        File binFile = SPIFFS.open(LAYOUT_BIN_FILE, "w");
+        File jsonFile = SPIFFS.open(LAYOUT_JSON_FILE, "w");
+        if (!binFile || !jsonFile || binFile.write(out, pos) != pos || jsonFile.print(json) != json.length()) {
+            error = "保存布局文件失败";
+            ok = false;
+        }
+        if (binFile) {
+            binFile.close();
+        }
+        if (jsonFile) {
+            jsonFile.close();
+        }
+    }
+    free(out);
+    if (ok) {
+        Serial.printf("布局编译完成: JSON %u 字节 -> 字节码 %u 字节\n", json.length(), pos);
+        // 由显示任务在下次创建屏幕元素时重新加载
+        reloadPending = true;
+    }
+    return ok;
+}
+//*** 删除自定义布局，恢复内置布局
+bool LayoutEngine::clear() {
+    SPIFFS.remove(LAYOUT_BIN_FILE);
+    SPIFFS.remove(LAYOUT_JSON_FILE);
+    reloadPending = true;
+    return true;
+}
+//*** 显示任务中应用新上传的布局
+bool LayoutEngine::applyPendingReload() {
+    if (!reloadPending) {
+        return false;
+    }
+    reloadPending = false;
+    if (loadProgram()) {
+        Serial.printf("已重新加载屏幕布局，字节码 %u 字节\n", programSize);
+    } else {
+        Serial.println("已恢复内置屏幕布局");
+    }
+    return true;
+}
+//*** 布局中是否包含指定屏幕
+bool LayoutEngine::hasScreen(ScreenState screen) {
+    const uint8_t* code;
+    size_t length;
+    return findScreen(screen, code, length);
+}
+//*** 按字节码创建指定屏幕的元素
+bool LayoutEngine::buildScreen(ScreenState screen) {
+    const uint8_t* code;
+    size_t length;
+    if (!findScreen(screen, code, length)) {
+        return false;
+    }
+    size_t pc = 0;
+    bool ok = true;
+    while (pc < length) {
+        uint8_t opcode = code[pc++];
+        const uint8_t* args = code + pc;
+        if (opcode == OP_LABEL && pc + LABEL_ARGS_SIZE <= length &&
+            args[0] < ROLE_COUNT && args[1] < FONT_COUNT) {
+            const char* fontName = fonts[args[1]].name;
+            const lv_font_t* font = FontLoader::getInstance()->font(fontName, AssetBundle::getInstance()->font(fontName, fonts[args[1]].font));
+            // 指定字号时使用同一系列的轮廓字体，没有轮廓字体文件时仍使用上面的字体
+            if (args[16] != 0) {
+                font = TtfLoader::getInstance()->font(fonts[args[1]].family, args[16], font);
+            }
+            *roles[args[0]].slot = createLabel(font, lv_color_hex(getColor(args + 2)),
+                                               getI16(args + 5), getI16(args + 7), getI16(args + 9),
+                                               lv_color_hex(getColor(args + 11)), args[14], args[15] != 0);
+            pc += LABEL_ARGS_SIZE;
+        } else if (opcode == OP_IMAGE && pc + IMAGE_ARGS_SIZE <= length &&
+                   args[0] < ROLE_COUNT && args[1] < IMAGE_COUNT) {
+            // 与内置布局相同的背景查找顺序（GIF、导入图像、资源分区、固件中的图像）
+            *roles[args[0]].slot = createBackground(images[args[1]].name, images[args[1]].src, getI16(args + 2),
+                                                    getI16(args + 4), getI16(args + 6), getI16(args + 8));
+            pc += IMAGE_ARGS_SIZE;
+        } else {
+            ok = false;
+            break;
+        }
+    }
+    if (!ok) {
+        // 字节码损坏：删除已创建的对象，由调用方回退到内置布局
+        Serial.printf("屏幕%d的布局字节码无效，使用内置布局\n", screen);
+        for (int i = 0; i < ROLE_COUNT; i++) {
+            if (roles[i].screen != screen) {
+                continue;
+            }
+            lv_obj_t*& obj = *roles[i].slot;
+            if (obj && lv_obj_is_valid(obj)) {
+                lv_obj_del(obj);
+            }
+            obj = nullptr;
+        }
+    }
+    return ok;
+}
+//*** 内置布局对应的JSON示例
+const char* LayoutEngine::getBuiltinLayoutJson() {
+    return BUILTIN_LAYOUT_JSON;
+}
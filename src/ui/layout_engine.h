@@ -0,0 +1,75 @@
+#ifndef LAYOUT_ENGINE_H
+#define LAYOUT_ENGINE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "config/config.h"
+
+// 布局源文件（网页编辑的JSON）和编译后的字节码文件
+#define LAYOUT_JSON_FILE "/layout.json"
+#define LAYOUT_BIN_FILE  "/layout.bin"
+
+// 字节码文件的最大长度（字节）
+const size_t MAX_LAYOUT_SIZE = 2048;
+// 字节码格式版本
+const uint8_t LAYOUT_VERSION = 2;
+
+/**
+ * 声明式屏幕布局引擎类
+ * 网页上传的JSON布局在上传时一次性编译为紧凑的字节码保存到SPIFFS，
+ * 创建屏幕元素时只需顺序解释字节码调用createLabel/createImage，不再解析JSON；
+ * 没有布局或布局中不包含某个屏幕时，仍使用init_ui中的内置创建函数
+ *
+ * 字节码格式（小端）：
+ *   文件头: 'L' 'Y' 'T' 版本 屏幕数量
+ *   索引:   每个屏幕 {屏幕编号 u8, 偏移 u16, 长度 u16}
+ *   指令:   OP_LABEL 角色 字体 颜色[3] x y 高度(i16) 背景色[3] 背景不透明度 标志 字号（0为字体本身的大小）
+ *           OP_IMAGE 角色 图像 宽 高 x y(i16)
+ */
+class LayoutEngine {
+private:
+    static LayoutEngine* instance; // 单例实例
+
+    uint8_t* program;             // 已加载的字节码（为空表示使用内置布局）
+    size_t programSize;           // 字节码长度
+    volatile bool reloadPending;  // Web任务上传新布局后置位，由显示任务重新加载
+
+    // 私有构造函数（单例模式）
+    LayoutEngine();
+
+    // 从SPIFFS加载字节码
+    bool loadProgram();
+
+    // 查找指定屏幕的指令段
+    bool findScreen(ScreenState screen, const uint8_t*& code, size_t& length);
+
+public:
+    // 获取单例实例
+    static LayoutEngine* getInstance();
+
+    // 初始化（加载已编译的布局）
+    void init();
+
+    // 将JSON布局编译为字节码并保存（在Web任务中调用，不访问LVGL）
+    bool compile(const String& json, String& error);
+
+    // 删除自定义布局，恢复内置布局
+    bool clear();
+
+    // 显示任务中应用新上传的布局，返回是否发生了重新加载
+    bool applyPendingReload();
+
+    // 布局中是否包含指定屏幕
+    bool hasScreen(ScreenState screen);
+
+    // 按字节码创建指定屏幕的元素，布局中没有该屏幕或字节码无效时返回false
+    bool buildScreen(ScreenState screen);
+
+    // 已加载字节码的长度
+    size_t getProgramSize() { return programSize; }
+
+    // 内置布局对应的JSON示例（用于网页编辑）
+    static const char* getBuiltinLayoutJson();
+};
+
+#endif // LAYOUT_ENGINE_H
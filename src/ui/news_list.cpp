@@ -0,0 +1,390 @@
+#include "news_list.h"
+#include "ui_utils.h"
+#include "config/config.h"
+#include <esp_heap_caps.h>
+
+// 性能测试使用的新闻条数
+static const int benchmarkLengths[] = {18, 100, 500, 1000};
+const int BENCHMARK_LENGTH_COUNT = sizeof(benchmarkLengths) / sizeof(benchmarkLengths[0]);
+// 每种条数测量的滚动帧数
+const int BENCHMARK_SCROLL_FRAMES = 20;
+
+// 单项测试结果
+struct NewsListBenchmarkResult {
+    int headlines;              // 新闻条数
+    uint32_t listObjects;       // 虚拟化列表：LVGL对象数量
+    uint32_t listInternalBytes; // 虚拟化列表：内部堆占用
+    uint32_t listPsramBytes;    // 虚拟化列表：PSRAM占用
+    uint32_t listFrameAvg;      // 虚拟化列表：滚动帧平均耗时（微秒）
+    uint32_t listFrameMax;      // 虚拟化列表：滚动帧最长耗时（微秒）
+    bool labelOk;               // 单标签方式是否成功（长文本可能内存不足）
+    uint32_t labelInternalBytes; // 单标签方式：内部堆占用
+    uint32_t labelPsramBytes;   // 单标签方式：PSRAM占用（大块内存可能由malloc分配到PSRAM）
+    uint32_t labelFrameAvg;     // 单标签方式：滚动帧平均耗时（微秒）
+    uint32_t labelFrameMax;     // 单标签方式：滚动帧最长耗时（微秒）
+};
+static NewsListBenchmarkResult benchmarkResults[BENCHMARK_LENGTH_COUNT];
+static volatile bool benchmarkRequested = false;
+static volatile bool benchmarkDone = false;
+
+//*** 分配文本池内存（优先使用PSRAM）
+static void* allocPoolMemory(size_t bytes) {
+    void* memory = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (memory == nullptr) {
+        memory = malloc(bytes);
+    }
+    return memory;
+}
+
+//*** 构造函数
+NewsList::NewsList() {
+    container = nullptr;
+    memset(rows, 0, sizeof(rows));
+    rowCount = 0;
+    rowHeight = 0;
+    topRow = 0;
+    firstIndex = 0;
+    scrollTimer = nullptr;
+    textPool = nullptr;
+    offsets = nullptr;
+    headlineCount = 0;
+    poolSize = 0;
+}
+//*** 析构函数
+NewsList::~NewsList() {
+    detach();
+    free(textPool);
+    free(offsets);
+}
+//*** 绑定到容器对象并创建行对象
+void NewsList::attach(lv_obj_t* parent) {
+    if (parent == container && rowCount > 0) {
+        return;
+    }
+    detach();
+    if (parent == nullptr || !lv_obj_is_valid(parent)) {
+        return;
+    }
+    container = parent;
+    lv_obj_add_event_cb(container, containerDeletedCallback, LV_EVENT_DELETE, this);
+    createRows();
+    refreshRows();
+}
+//*** 删除行对象和定时器
+void NewsList::detach() {
+    if (scrollTimer) {
+        lv_timer_del(scrollTimer);
+        scrollTimer = nullptr;
+    }
+    if (container) {
+        lv_obj_remove_event_cb_with_user_data(container, containerDeletedCallback, this);
+        for (int i = 0; i < rowCount; i++) {
+            if (rows[i]) {
+                lv_obj_del(rows[i]);
+            }
+        }
+    }
+    memset(rows, 0, sizeof(rows));
+    rowCount = 0;
+    container = nullptr;
+}
+//*** 容器被删除时清理行对象引用（行对象作为子对象已随容器删除）
+void NewsList::containerDeletedCallback(lv_event_t* e) {
+    NewsList* self = static_cast<NewsList*>(lv_event_get_user_data(e));
+    if (self->scrollTimer) {
+        lv_timer_del(self->scrollTimer);
+        self->scrollTimer = nullptr;
+    }
+    memset(self->rows, 0, sizeof(self->rows));
+    self->rowCount = 0;
+    self->container = nullptr;
+}
+//*** 按可见区域创建行对象
+void NewsList::createRows() {
+    const lv_font_t* font = lv_obj_get_style_text_font(container, LV_PART_MAIN);
+    rowHeight = lv_font_get_line_height(font) * NEWS_ROW_LINES + NEWS_ROW_GAP;
+    // 可见行数由容器高度决定，与新闻条数无关
+    lv_obj_update_layout(container);
+    lv_coord_t width = lv_obj_get_content_width(container);
+    lv_coord_t height = lv_obj_get_content_height(container);
+    if (height < rowHeight) {
+        height = screenHeight - lv_obj_get_y(container);
+    }
+    rowCount = height / rowHeight;
+    if (rowCount > NEWS_LIST_MAX_ROWS) {
+        rowCount = NEWS_LIST_MAX_ROWS;
+    }
+    if (rowCount < 1) {
+        rowCount = 1;
+    }
+    for (int i = 0; i < rowCount; i++) {
+        // 字体和颜色从容器继承，布局中修改容器样式即可改变列表样式
+        lv_obj_t* row = lv_label_create(container);
+        lv_obj_set_size(row, width, rowHeight - NEWS_ROW_GAP);
+        lv_label_set_long_mode(row, LV_LABEL_LONG_DOT);
+        lv_label_set_text_static(row, "");
+        rows[i] = row;
+    }
+    topRow = 0;
+    placeRows();
+    scrollTimer = lv_timer_create(scrollTimerCallback, NEWS_SCROLL_INTERVAL, this);
+}
+//*** 按环形顺序设置行对象的位置
+void NewsList::placeRows() {
+    for (int i = 0; i < rowCount; i++) {
+        int slot = (i - topRow + rowCount) % rowCount;
+        lv_obj_set_y(rows[i], slot * rowHeight);
+    }
+}
+//*** 将所有行对象重新指向当前窗口中的新闻
+void NewsList::refreshRows() {
+    for (int slot = 0; slot < rowCount; slot++) {
+        lv_obj_t* row = rows[(topRow + slot) % rowCount];
+        if (slot < headlineCount) {
+            lv_label_set_text_static(row, textPool + offsets[(firstIndex + slot) % headlineCount]);
+            lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+}
+//*** 分配新的文本池
+bool NewsList::allocPool(int count, size_t bytes, char*& pool, uint32_t*& poolOffsets) {
+    pool = (char*)allocPoolMemory(bytes);
+    poolOffsets = (uint32_t*)allocPoolMemory(count * sizeof(uint32_t));
+    if (pool == nullptr || poolOffsets == nullptr) {
+        Serial.printf("新闻文本池内存不足: %u 字节\n", bytes);
+        free(pool);
+        free(poolOffsets);
+        return false;
+    }
+    return true;
+}
+//*** 替换旧的文本池
+void NewsList::installPool(char* pool, uint32_t* poolOffsets, int count, size_t bytes) {
+    char* oldPool = textPool;
+    uint32_t* oldOffsets = offsets;
+    textPool = pool;
+    offsets = poolOffsets;
+    headlineCount = count;
+    poolSize = bytes;
+    firstIndex = 0;
+    topRow = 0;
+    // 行对象使用静态文本，必须先指向新文本池再释放旧文本池
+    if (rowCount > 0) {
+        placeRows();
+        refreshRows();
+    }
+    free(oldPool);
+    free(oldOffsets);
+}
+//*** 从JSON数组加载新闻标题
+bool NewsList::loadFromArray(JsonArrayConst headlines) {
+    int count = min((int)headlines.size(), NEWS_LIST_MAX_HEADLINES);
+    if (count == 0) {
+        setMessage("暂无新闻内容");
+        return false;
+    }
+    // JSON数组按链表存储，使用迭代器遍历而不是按下标访问
+    size_t bytes = 0;
+    int index = 0;
+    for (JsonVariantConst headline : headlines) {
+        if (index++ >= count) {
+            break;
+        }
+        const char* text = headline.as<const char*>();
+        bytes += (text ? strlen(text) : 0) + 1;
+    }
+    char* pool;
+    uint32_t* poolOffsets;
+    if (!allocPool(count, bytes, pool, poolOffsets)) {
+        return false;
+    }
+    size_t pos = 0;
+    index = 0;
+    for (JsonVariantConst headline : headlines) {
+        if (index >= count) {
+            break;
+        }
+        const char* text = headline.as<const char*>();
+        size_t length = text ? strlen(text) : 0;
+        poolOffsets[index++] = pos;
+        memcpy(pool + pos, text ? text : "", length);
+        pool[pos + length] = '\0';
+        pos += length + 1;
+    }
+    installPool(pool, poolOffsets, count, bytes);
+    return true;
+}
+//*** 显示一条提示信息
+void NewsList::setMessage(const char* message) {
+    size_t bytes = strlen(message) + 1;
+    char* pool;
+    uint32_t* poolOffsets;
+    if (!allocPool(1, bytes, pool, poolOffsets)) {
+        return;
+    }
+    memcpy(pool, message, bytes);
+    poolOffsets[0] = 0;
+    installPool(pool, poolOffsets, 1, bytes);
+}
+//*** 向下滚动一行
+void NewsList::scrollStep() {
+    if (rowCount == 0 || headlineCount <= rowCount) {
+        return;
+    }
+    // 顶部行对象移到底部并指向下一条新闻，其余行对象只移动位置，不重新排版文本
+    lv_obj_t* recycled = rows[topRow];
+    topRow = (topRow + 1) % rowCount;
+    firstIndex = (firstIndex + 1) % headlineCount;
+    lv_label_set_text_static(recycled, textPool + offsets[(firstIndex + rowCount - 1) % headlineCount]);
+    placeRows();
+}
+//*** 翻到下一页
+void NewsList::nextPage() {
+    if (rowCount == 0 || headlineCount <= rowCount) {
+        return;
+    }
+    firstIndex = (firstIndex + rowCount) % headlineCount;
+    refreshRows();
+}
+//*** 自动滚动定时器回调
+void NewsList::scrollTimerCallback(lv_timer_t* timer) {
+    NewsList* self = static_cast<NewsList*>(timer->user_data);
+    // 新闻屏幕隐藏时不滚动
+    if (self->container && !lv_obj_has_flag(self->container, LV_OBJ_FLAG_HIDDEN)) {
+        self->scrollStep();
+    }
+}
+//*** 请求一次列表性能测试
+void NewsList::requestBenchmark() {
+    benchmarkRequested = true;
+}
+//*** 测量一帧的刷新耗时
+static uint32_t measureFrame() {
+    unsigned long startMicros = micros();
+    lv_refr_now(NULL);
+    return micros() - startMicros;
+}
+//*** 执行已请求的列表性能测试
+void NewsList::runPendingBenchmark() {
+    if (!benchmarkRequested) {
+        return;
+    }
+    benchmarkRequested = false;
+    Serial.println("新闻列表性能测试（虚拟化列表 / 单标签）:");
+    for (int n = 0; n < BENCHMARK_LENGTH_COUNT; n++) {
+        NewsListBenchmarkResult& result = benchmarkResults[n];
+        memset(&result, 0, sizeof(result));
+        result.headlines = benchmarkLengths[n];
+        // 生成测试新闻
+        JsonDocument doc;
+        JsonArray headlines = doc.to<JsonArray>();
+        char text[96];
+        for (int i = 0; i < result.headlines; i++) {
+            snprintf(text, sizeof(text), "第%d条测试新闻：用于测量新闻列表在不同条数下的内存占用和滚动帧耗时", i + 1);
+            headlines.add(text);
+        }
+
+        // 虚拟化列表
+        size_t internalBefore = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+        size_t psramBefore = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+        lv_obj_t* box = createLabel(GBFont, lv_color_hex(0xFFFFFF), 0, 85, screenHeight - 85,
+                                    lv_color_hex(0x000000), LV_OPA_COVER, false, false);
+        lv_label_set_text_static(box, "");
+        lv_obj_move_foreground(box);
+        NewsList* list = new NewsList();
+        list->attach(box);
+        list->loadFromArray(headlines);
+        result.listInternalBytes = internalBefore - heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+        result.listPsramBytes = psramBefore - heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+        result.listObjects = lv_obj_get_child_cnt(box) + 1;
+        measureFrame();
+        uint32_t total = 0;
+        for (int i = 0; i < BENCHMARK_SCROLL_FRAMES; i++) {
+            unsigned long startMicros = micros();
+            list->scrollStep();
+            lv_refr_now(NULL);
+            uint32_t frame = micros() - startMicros;
+            total += frame;
+            result.listFrameMax = max(result.listFrameMax, frame);
+        }
+        result.listFrameAvg = total / BENCHMARK_SCROLL_FRAMES;
+        delete list;
+        lv_obj_del(box);
+
+        // 单标签方式：所有新闻拼接为一个字符串，滚动时重新设置文本
+        internalBefore = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+        psramBefore = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+        String joined;
+        result.labelOk = joined.reserve(result.headlines * 100);
+        if (result.labelOk) {
+            for (JsonVariant headline : headlines) {
+                joined += headline.as<const char*>();
+                joined += "\n";
+            }
+            box = createLabel(GBFont, lv_color_hex(0xFFFFFF), 0, 85, screenHeight - 85,
+                              lv_color_hex(0x000000), LV_OPA_COVER, true, false);
+            lv_obj_move_foreground(box);
+            lv_label_set_text(box, joined.c_str());
+            result.labelInternalBytes = internalBefore - heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+            result.labelPsramBytes = psramBefore - heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+            measureFrame();
+            total = 0;
+            int start = 0;
+            for (int i = 0; i < BENCHMARK_SCROLL_FRAMES; i++) {
+                unsigned long startMicros = micros();
+                int next = joined.indexOf('\n', start);
+                start = next >= 0 ? next + 1 : 0;
+                lv_label_set_text(box, joined.c_str() + start);
+                lv_refr_now(NULL);
+                uint32_t frame = micros() - startMicros;
+                total += frame;
+                result.labelFrameMax = max(result.labelFrameMax, frame);
+            }
+            result.labelFrameAvg = total / BENCHMARK_SCROLL_FRAMES;
+            lv_obj_del(box);
+        }
+
+        Serial.printf("  %4d条: 对象 %u，内部堆 %u + PSRAM %u 字节，帧 %u/%u us | ",
+                      result.headlines, result.listObjects, result.listInternalBytes, result.listPsramBytes,
+                      result.listFrameAvg, result.listFrameMax);
+        if (result.labelOk) {
+            Serial.printf("内部堆 %u + PSRAM %u 字节，帧 %u/%u us\n", result.labelInternalBytes,
+                          result.labelPsramBytes, result.labelFrameAvg, result.labelFrameMax);
+        } else {
+            Serial.println("内存不足");
+        }
+    }
+    // 测试对象已删除，重绘当前屏幕
+    lv_obj_invalidate(lv_scr_act());
+    benchmarkDone = true;
+}
+//*** 最近一次测试结果
+String NewsList::getBenchmarkJson() {
+    JsonDocument doc;
+    doc["done"] = (bool)benchmarkDone;
+    doc["pending"] = (bool)benchmarkRequested;
+    JsonArray results = doc["results"].to<JsonArray>();
+    if (benchmarkDone) {
+        for (int n = 0; n < BENCHMARK_LENGTH_COUNT; n++) {
+            const NewsListBenchmarkResult& result = benchmarkResults[n];
+            JsonObject item = results.add<JsonObject>();
+            item["headlines"] = result.headlines;
+            item["list_objects"] = result.listObjects;
+            item["list_internal_bytes"] = result.listInternalBytes;
+            item["list_psram_bytes"] = result.listPsramBytes;
+            item["list_frame_avg_us"] = result.listFrameAvg;
+            item["list_frame_max_us"] = result.listFrameMax;
+            if (result.labelOk) {
+                item["label_internal_bytes"] = result.labelInternalBytes;
+                item["label_psram_bytes"] = result.labelPsramBytes;
+                item["label_frame_avg_us"] = result.labelFrameAvg;
+                item["label_frame_max_us"] = result.labelFrameMax;
+            }
+        }
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
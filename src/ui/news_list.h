@@ -0,0 +1,95 @@
+#ifndef NEWS_LIST_H
+#define NEWS_LIST_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <ArduinoJson.h>
+
+// 行对象池的最大行数（只为可见行创建标签）
+const int NEWS_LIST_MAX_ROWS = 16;
+// 最多保存的新闻条数
+const int NEWS_LIST_MAX_HEADLINES = 1000;
+// 每条新闻最多显示的行数（超出部分以省略号结尾）
+const int NEWS_ROW_LINES = 2;
+// 行间距（像素）
+const lv_coord_t NEWS_ROW_GAP = 6;
+// 自动滚动一行的间隔（毫秒）
+const uint32_t NEWS_SCROLL_INTERVAL = 3000;
+
+/**
+ * 虚拟化新闻列表类
+ * 所有新闻标题连续保存在一块文本池中（优先使用PSRAM），只为可见行创建固定数量的标签，
+ * 滚动或翻页时复用行对象并以静态文本指向文本池，新闻条数增加时LVGL对象数量和内部堆占用保持不变
+ */
+class NewsList {
+private:
+    lv_obj_t* container;              // 列表容器（行标签的父对象）
+    lv_obj_t* rows[NEWS_LIST_MAX_ROWS]; // 行对象池
+    int rowCount;                     // 可见行数（即行对象数量）
+    lv_coord_t rowHeight;             // 行高
+    int topRow;                       // 位于顶部的行对象下标（行对象按环形复用）
+    int firstIndex;                   // 顶部显示的新闻下标
+    lv_timer_t* scrollTimer;          // 自动滚动定时器
+
+    char* textPool;                   // 新闻文本池（以'\0'分隔）
+    uint32_t* offsets;                // 每条新闻在文本池中的偏移
+    int headlineCount;                // 新闻条数
+    size_t poolSize;                  // 文本池大小（字节）
+
+    // 按可见区域创建行对象
+    void createRows();
+
+    // 将所有行对象重新指向当前窗口中的新闻
+    void refreshRows();
+
+    // 按环形顺序设置行对象的位置
+    void placeRows();
+
+    // 分配新的文本池并替换旧的文本池
+    bool allocPool(int count, size_t bytes, char*& pool, uint32_t*& poolOffsets);
+    void installPool(char* pool, uint32_t* poolOffsets, int count, size_t bytes);
+
+    // 容器被删除（如被生命周期管理器释放）时清理行对象引用
+    static void containerDeletedCallback(lv_event_t* e);
+
+    // 自动滚动定时器回调
+    static void scrollTimerCallback(lv_timer_t* timer);
+
+public:
+    NewsList();
+    ~NewsList();
+
+    // 绑定到容器对象并创建行对象（容器未变化时不重复创建）
+    void attach(lv_obj_t* parent);
+
+    // 删除行对象和定时器
+    void detach();
+
+    // 从JSON数组加载新闻标题
+    bool loadFromArray(JsonArrayConst headlines);
+
+    // 显示一条提示信息（无数据或读取失败时使用）
+    void setMessage(const char* message);
+
+    // 向下滚动一行：只有移出顶部的行对象需要更新文本
+    void scrollStep();
+
+    // 翻到下一页
+    void nextPage();
+
+    // 统计信息
+    int getHeadlineCount() { return headlineCount; }
+    size_t getPoolSize() { return poolSize; }
+    int getRowCount() { return rowCount; }
+
+    // 请求一次列表性能测试（可在Web任务中调用）
+    static void requestBenchmark();
+
+    // 在显示任务中执行已请求的测试：按不同新闻条数对比虚拟化列表与单标签方式的内存和滚动帧耗时
+    static void runPendingBenchmark();
+
+    // 最近一次测试结果（JSON）
+    static String getBenchmarkJson();
+};
+
+#endif // NEWS_LIST_H
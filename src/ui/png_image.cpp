@@ -0,0 +1,302 @@
+#include "png_image.h"
+#include "png_stream.h"
+#include <ArduinoJson.h>
+#include <SPIFFS.h>
+
+// 统计表
+PngImageStats PngImage::stats[PNG_IMAGE_MAX_STATS];
+int PngImage::statsCount = 0;
+
+// 内存图像的读取位置
+struct PngMemoryReader {
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+};
+
+// 解码流的状态（同一时间只解码一幅图像）
+struct PngImageStream {
+    PngImageStats* item;         // 正在解码的图像（为空表示没有解码流）
+    bool decoding;               // 解码器仍打开（还有行没有解码）
+    File file;                   // 文件图像
+    PngMemoryReader memory;      // 内存图像
+    lv_coord_t rowY;             // 行缓冲区中的行号（-1表示还没有解码）
+    uint8_t* rgba;               // 行缓冲区（宽度×4字节）
+    size_t rgbaBytes;
+    size_t peakBytes;            // 解码时的峰值内存
+};
+static PngImageStream stream;
+static PngStream png;
+
+//*** 读取函数：SPIFFS文件
+static size_t readFile(void* context, uint8_t* buf, size_t length) {
+    return ((File*)context)->read(buf, length);
+}
+//*** 读取函数：内存图像
+static size_t readMemory(void* context, uint8_t* buf, size_t length) {
+    PngMemoryReader* reader = (PngMemoryReader*)context;
+    size_t n = LV_MIN(length, reader->size - reader->pos);
+    memcpy(buf, reader->data + reader->pos, n);
+    reader->pos += n;
+    return n;
+}
+
+//*** 注册解码器
+void PngImage::init() {
+    lv_img_decoder_t* decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, infoCallback);
+    lv_img_decoder_set_open_cb(decoder, openCallback);
+    lv_img_decoder_set_read_line_cb(decoder, readLineCallback);
+    lv_img_decoder_set_close_cb(decoder, closeCallback);
+    Serial.println("PNG图像流式解码器已注册");
+}
+//*** 检查是否为PNG图像源
+bool PngImage::isPngSource(const void* src) {
+    lv_img_src_t type = lv_img_src_get_type(src);
+    if (type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t* dsc = (const lv_img_dsc_t*)src;
+        return dsc->data != nullptr && PngStream::isPng(dsc->data, dsc->data_size);
+    }
+    if (type == LV_IMG_SRC_FILE) {
+        // 只支持SPIFFS（S:盘符）中的文件
+        const char* path = (const char*)src;
+        return path[0] == 'S' && path[1] == ':' && strcmp(lv_fs_get_ext(path), "png") == 0;
+    }
+    return false;
+}
+//*** 查找图像的统计项
+PngImageStats* PngImage::findStats(const void* src) {
+    bool isFile = lv_img_src_get_type(src) == LV_IMG_SRC_FILE;
+    for (int i = 0; i < statsCount; i++) {
+        if (isFile ? strcmp(stats[i].path, (const char*)src) == 0 : stats[i].data == src) {
+            return &stats[i];
+        }
+    }
+    if (statsCount >= PNG_IMAGE_MAX_STATS) {
+        return nullptr;
+    }
+    PngImageStats item;
+    memset(&item, 0, sizeof(PngImageStats));
+    PngHeader header;
+    PngError error;
+    if (isFile) {
+        const char* path = (const char*)src;
+        if (strlen(path) >= PNG_IMAGE_PATH_SIZE) {
+            return nullptr;
+        }
+        File file = SPIFFS.open(path + 2, "r");
+        if (!file) {
+            return nullptr;
+        }
+        item.pngBytes = file.size();
+        error = PngStream::readHeader(readFile, &file, header);
+        file.close();
+        strcpy(item.path, path);
+    } else {
+        const lv_img_dsc_t* dsc = (const lv_img_dsc_t*)src;
+        PngMemoryReader reader = {dsc->data, dsc->data_size, 0};
+        error = PngStream::readHeader(readMemory, &reader, header);
+        item.data = src;
+        item.pngBytes = dsc->data_size;
+    }
+    if (error == PNG_ERROR_INTERLACED) {
+        // 记录下来，之后直接交给LVGL的PNG解码器，不再解析文件头
+        item.interlaced = true;
+    } else if (error != PNG_OK || header.width > PNG_IMAGE_MAX_SIZE || header.height > PNG_IMAGE_MAX_SIZE) {
+        return nullptr;
+    } else {
+        item.width = header.width;
+        item.height = header.height;
+        item.hasAlpha = header.hasAlpha;
+    }
+    stats[statsCount] = item;
+    return &stats[statsCount++];
+}
+//*** 读取图像信息
+lv_res_t PngImage::infoCallback(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header) {
+    LV_UNUSED(decoder);
+    if (!isPngSource(src)) {
+        return LV_RES_INV;
+    }
+    PngImageStats* item = findStats(src);
+    if (item == nullptr || item->interlaced) {
+        return LV_RES_INV;
+    }
+    // 不透明的图像解码为真彩色，绘制时不需要混合，缓存时每像素也少一个字节
+    header->cf = item->hasAlpha ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    header->always_zero = 0;
+    header->w = item->width;
+    header->h = item->height;
+    return LV_RES_OK;
+}
+//*** 打开图像
+lv_res_t PngImage::openCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    PngImageStats* item = findStats(dsc->src);
+    if (item == nullptr || item->interlaced) {
+        return LV_RES_INV;
+    }
+    item->draws++;
+    dsc->user_data = item;
+    // 不提供整幅图像，LVGL逐行调用readLineCallback
+    dsc->img_data = nullptr;
+    return LV_RES_OK;
+}
+//*** 开始从头解码图像
+bool PngImage::startStream(const void* src, PngImageStats* item) {
+    endStream();
+    stream.item = nullptr;
+    PngError error;
+    if (item->data != nullptr) {
+        const lv_img_dsc_t* dsc = (const lv_img_dsc_t*)src;
+        stream.memory = {dsc->data, dsc->data_size, 0};
+        error = png.begin(readMemory, &stream.memory);
+    } else {
+        stream.file = SPIFFS.open(item->path + 2, "r");
+        error = stream.file ? png.begin(readFile, &stream.file) : PNG_ERROR_READ;
+    }
+    const PngHeader& header = png.header();
+    if (error != PNG_OK || header.width != item->width || header.height != item->height ||
+        header.hasAlpha != item->hasAlpha) {
+        Serial.printf("PNG图像解码失败(%d): %s\n", error, item->data != nullptr ? "内存图像" : item->path);
+        png.end();
+        if (stream.file) {
+            stream.file.close();
+        }
+        return false;
+    }
+    size_t bytes = item->width * 4;
+    if (stream.rgba == nullptr || stream.rgbaBytes < bytes) {
+        if (stream.rgba != nullptr) {
+            heap_caps_free(stream.rgba);
+        }
+        // 行缓冲区优先放在内部RAM中，逐行读取时比PSRAM快
+        stream.rgba = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (stream.rgba == nullptr) {
+            stream.rgba = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        }
+        stream.rgbaBytes = stream.rgba != nullptr ? bytes : 0;
+        if (stream.rgba == nullptr) {
+            png.end();
+            if (stream.file) {
+                stream.file.close();
+            }
+            return false;
+        }
+    }
+    stream.item = item;
+    stream.decoding = true;
+    stream.rowY = -1;
+    stream.peakBytes = LV_MAX(stream.peakBytes, png.getMemoryBytes() + stream.rgbaBytes);
+    item->restarts++;
+    return true;
+}
+//*** 解码下一行到行缓冲区
+bool PngImage::decodeRow() {
+    if (!stream.decoding) {
+        return false;
+    }
+    unsigned long startTime = micros();
+    PngError error = png.readRow(stream.rgba);
+    if (error != PNG_OK) {
+        Serial.printf("PNG图像数据无效(%d)，第%d行\n", error, stream.rowY + 1);
+        endStream();
+        stream.item = nullptr;
+        return false;
+    }
+    stream.rowY++;
+    if (stream.rowY + 1 >= stream.item->height) {
+        // 最后一行已解码：释放解压窗口并关闭文件，行缓冲区中的行仍可读取
+        endStream();
+    }
+    stream.item->rows++;
+    stream.item->decodeMicros += micros() - startTime;
+    return true;
+}
+//*** 结束解码
+void PngImage::endStream() {
+    if (stream.decoding) {
+        png.end();
+        if (stream.file) {
+            stream.file.close();
+        }
+        stream.decoding = false;
+    }
+}
+//*** 读取一行
+lv_res_t PngImage::readLineCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                    lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf) {
+    LV_UNUSED(decoder);
+    PngImageStats* item = (PngImageStats*)dsc->user_data;
+    if (item == nullptr || y < 0 || y >= item->height || x < 0 || len <= 0 || x + len > item->width) {
+        return LV_RES_INV;
+    }
+    // 换了图像或需要已解码行之前的行时只能从头解码；同一次刷新中后续区域的行号递增，继续向下解码即可
+    if (stream.item != item || y < stream.rowY) {
+        if (!startStream(dsc->src, item)) {
+            return LV_RES_INV;
+        }
+    }
+    while (stream.rowY < y) {
+        if (!decodeRow()) {
+            return LV_RES_INV;
+        }
+    }
+    // RGBA转换为LVGL的颜色格式（有Alpha时每个像素后面跟一个Alpha字节）
+    const uint8_t* pixel = stream.rgba + x * 4;
+    for (lv_coord_t i = 0; i < len; i++, pixel += 4) {
+        lv_color_t color = lv_color_make(pixel[0], pixel[1], pixel[2]);
+        memcpy(buf, &color, sizeof(lv_color_t));
+        buf += sizeof(lv_color_t);
+        if (item->hasAlpha) {
+            *buf++ = pixel[3];
+        }
+    }
+    return LV_RES_OK;
+}
+//*** 关闭图像（解码流保留给下一个绘制区域继续使用）
+void PngImage::closeCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    dsc->user_data = nullptr;
+}
+//*** 解码时的峰值内存
+size_t PngImage::getStreamBytes() {
+    return stream.peakBytes;
+}
+//*** 生成统计JSON
+String PngImage::getStatsJson() {
+    JsonDocument doc;
+    doc["stream_bytes"] = stream.peakBytes;
+    JsonArray images = doc["images"].to<JsonArray>();
+    for (int i = 0; i < statsCount; i++) {
+        const PngImageStats& item = stats[i];
+        uint32_t rawBytes = item.width * item.height * (item.hasAlpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t));
+        JsonObject image = images.add<JsonObject>();
+        if (item.data != nullptr) {
+            char name[16];
+            snprintf(name, sizeof(name), "%p", item.data);
+            image["name"] = name;
+        } else {
+            image["name"] = item.path;
+        }
+        if (item.interlaced) {
+            image["interlaced"] = true;
+            continue;
+        }
+        image["width"] = item.width;
+        image["height"] = item.height;
+        image["alpha"] = item.hasAlpha;
+        image["raw_bytes"] = rawBytes;
+        image["png_bytes"] = item.pngBytes;
+        image["ratio"] = item.pngBytes > 0 ? (float)rawBytes / item.pngBytes : 0;
+        image["draws"] = item.draws;
+        image["restarts"] = item.restarts;
+        image["rows"] = item.rows;
+        image["decode_us"] = item.decodeMicros;
+        // 吞吐量：每秒百万像素
+        image["decode_mpix_s"] = item.decodeMicros > 0 ? (float)(item.rows * item.width) / item.decodeMicros : 0;
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
@@ -0,0 +1,75 @@
+#ifndef PNG_IMAGE_H
+#define PNG_IMAGE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// 统计表大小（同时记录文件图像的宽高和是否透明，避免每次绘制都重新解析文件头；表满后的新图像交给LVGL的PNG解码器）
+const int PNG_IMAGE_MAX_STATS = 16;
+// 文件图像路径的最大长度（包括盘符，如"S:/images/soul.png"）
+const int PNG_IMAGE_PATH_SIZE = 40;
+// LVGL图像头中宽高的最大值（11位）
+const uint32_t PNG_IMAGE_MAX_SIZE = 2047;
+
+// 单幅PNG图像的统计
+struct PngImageStats {
+    const void* data;            // 内存中的图像（文件图像为空）
+    char path[PNG_IMAGE_PATH_SIZE]; // 文件图像的路径
+    uint16_t width;
+    uint16_t height;
+    bool hasAlpha;               // 有Alpha通道或透明色（解码为带Alpha的真彩色）
+    bool interlaced;             // 隔行扫描的图像，交给LVGL的PNG解码器
+    uint32_t pngBytes;           // PNG数据大小
+    uint32_t draws;              // 绘制次数（每次打开解码器）
+    uint32_t restarts;           // 从头开始解码的次数
+    uint64_t rows;               // 解码的行数
+    uint64_t decodeMicros;       // 解码累计耗时
+};
+
+/**
+ * 流式PNG图像解码器类
+ * LVGL自带的PNG解码器（lodepng）把整幅图像解码为RGBA，320x480的图像需要约600KB内存。
+ * 本解码器使用PngStream逐行解压和反滤波，LVGL逐行读取图像时按需向下解码；同一次刷新中各区域的行号递增，
+ * 整幅图像每帧只解码一次，解码时只占用解压窗口、两行原始数据和一行RGBA。
+ * 支持SPIFFS中的PNG文件（"S:/images/soul.png"）和数据以PNG签名开头的内存图像，
+ * 隔行扫描的PNG仍由LVGL的PNG解码器处理
+ */
+class PngImage {
+private:
+    static PngImageStats stats[PNG_IMAGE_MAX_STATS]; // 统计表
+    static int statsCount;
+
+    // 检查是否为PNG图像源
+    static bool isPngSource(const void* src);
+
+    // 查找（或新建）图像的统计项，第一次出现时解析文件头得到宽高和是否透明
+    static PngImageStats* findStats(const void* src);
+
+    // 开始从头解码图像
+    static bool startStream(const void* src, PngImageStats* item);
+
+    // 解码下一行到行缓冲区
+    static bool decodeRow();
+
+    // 结束解码（释放解压窗口，关闭文件），行缓冲区保留
+    static void endStream();
+
+    // LVGL解码器回调
+    static lv_res_t infoCallback(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header);
+    static lv_res_t openCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+    static lv_res_t readLineCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                     lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf);
+    static void closeCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+
+public:
+    // 注册解码器（须在lv_init之后调用，使其先于LVGL的PNG解码器被尝试）
+    static void init();
+
+    // 解码时的峰值内存（解压窗口、哈夫曼表和行缓冲区，字节）
+    static size_t getStreamBytes();
+
+    // 生成统计JSON：每幅图像的压缩率、解码吞吐量和解码时的内存
+    static String getStatsJson();
+};
+
+#endif // PNG_IMAGE_H
@@ -0,0 +1,699 @@
+#include "png_stream.h"
+#include <string.h>
+#ifdef ARDUINO
+#include <esp_heap_caps.h>
+#else
+#include <stdlib.h>
+#endif
+
+// PNG文件签名
+static const uint8_t PNG_SIGNATURE[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+
+// 长度符号257~285的基础长度和附加位数
+static const uint16_t LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                         35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                         3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+// 距离符号0~29的基础距离和附加位数
+static const uint16_t DISTANCE_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                           257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                           8193, 12289, 16385, 24577};
+static const uint8_t DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                           7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+// 动态块头中码长编码的码长顺序
+static const uint8_t CODE_LENGTH_ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+//*** 分配解码缓冲区（preferInternal为true时优先使用内部RAM，否则优先使用PSRAM）
+static void* allocBuffer(size_t bytes, bool preferInternal) {
+#ifdef ARDUINO
+    uint32_t first = preferInternal ? MALLOC_CAP_INTERNAL : MALLOC_CAP_SPIRAM;
+    uint32_t second = preferInternal ? MALLOC_CAP_SPIRAM : MALLOC_CAP_INTERNAL;
+    void* buffer = heap_caps_malloc(bytes, first | MALLOC_CAP_8BIT);
+    if (buffer == nullptr) {
+        buffer = heap_caps_malloc(bytes, second | MALLOC_CAP_8BIT);
+    }
+    return buffer;
+#else
+    (void)preferInternal;
+    return malloc(bytes);
+#endif
+}
+static void freeBuffer(void* buffer) {
+#ifdef ARDUINO
+    heap_caps_free(buffer);
+#else
+    free(buffer);
+#endif
+}
+
+//*** 按大端序读取
+static uint32_t getBe32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+//*** 读取指定的字节数
+static bool readExact(PngReadFunc read, void* context, uint8_t* buf, size_t length) {
+    while (length > 0) {
+        size_t got = read(context, buf, length);
+        if (got == 0) {
+            return false;
+        }
+        buf += got;
+        length -= got;
+    }
+    return true;
+}
+//*** 跳过指定的字节数（读取函数不支持定位）
+static bool skipBytes(PngReadFunc read, void* context, uint32_t length) {
+    uint8_t buf[64];
+    while (length > 0) {
+        size_t n = length < sizeof(buf) ? length : sizeof(buf);
+        if (!readExact(read, context, buf, n)) {
+            return false;
+        }
+        length -= n;
+    }
+    return true;
+}
+//*** 16位反序（哈夫曼编码在数据流中从低位开始存放）
+static inline uint32_t reverse16(uint32_t v) {
+    v = ((v & 0xAAAA) >> 1) | ((v & 0x5555) << 1);
+    v = ((v & 0xCCCC) >> 2) | ((v & 0x3333) << 2);
+    v = ((v & 0xF0F0) >> 4) | ((v & 0x0F0F) << 4);
+    return ((v & 0xFF00) >> 8) | ((v & 0x00FF) << 8);
+}
+//*** Paeth预测
+static inline uint8_t paeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = p > a ? p - a : a - p;
+    int pb = p > b ? p - b : b - p;
+    int pc = p > c ? p - c : c - p;
+    if (pa <= pb && pa <= pc) {
+        return a;
+    }
+    return pb <= pc ? b : c;
+}
+
+//*** 构造函数
+PngStream::PngStream() {
+    work = nullptr;
+    window = nullptr;
+    rows = nullptr;
+    memoryBytes = 0;
+    row = 0;
+    memset(&info, 0, sizeof(info));
+}
+//*** 析构函数
+PngStream::~PngStream() {
+    end();
+}
+//*** 检查PNG文件签名
+bool PngStream::isPng(const uint8_t* data, size_t length) {
+    return length >= sizeof(PNG_SIGNATURE) && memcmp(data, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) == 0;
+}
+//*** 读取第一个IDAT之前的数据块（palette不为空时保存调色板和调色板的透明度）
+PngError PngStream::parseHeader(PngReadFunc read, void* context, PngHeader& header, uint8_t* palette,
+                                uint32_t& idatLength) {
+    uint8_t buf[13];
+    memset(&header, 0, sizeof(header));
+    if (!readExact(read, context, buf, 8)) {
+        return PNG_ERROR_READ;
+    }
+    if (!isPng(buf, 8)) {
+        return PNG_ERROR_SIGNATURE;
+    }
+    bool first = true;
+    while (true) {
+        // 数据块：长度 类型 数据 CRC
+        if (!readExact(read, context, buf, 8)) {
+            return PNG_ERROR_READ;
+        }
+        uint32_t length = getBe32(buf);
+        const char* type = (const char*)buf + 4;
+        if (length > 0x7FFFFFFF || first != (memcmp(type, "IHDR", 4) == 0)) {
+            return PNG_ERROR_HEADER;
+        }
+        first = false;
+        if (memcmp(type, "IHDR", 4) == 0) {
+            if (length != 13 || !readExact(read, context, buf, 13)) {
+                return PNG_ERROR_HEADER;
+            }
+            header.width = getBe32(buf);
+            header.height = getBe32(buf + 4);
+            header.bitDepth = buf[8];
+            header.colorType = buf[9];
+            // 各颜色类型允许的位深度
+            uint8_t depth = header.bitDepth;
+            bool valid;
+            switch (header.colorType) {
+                case 0:  valid = depth == 1 || depth == 2 || depth == 4 || depth == 8 || depth == 16; break;
+                case 3:  valid = depth == 1 || depth == 2 || depth == 4 || depth == 8; break;
+                case 2:
+                case 4:
+                case 6:  valid = depth == 8 || depth == 16; break;
+                default: valid = false; break;
+            }
+            if (!valid || header.width == 0 || header.height == 0 || header.width > PNG_STREAM_MAX_WIDTH ||
+                header.height > 0x7FFFFFFF || buf[10] != 0 || buf[11] != 0 || buf[12] > 1) {
+                return PNG_ERROR_HEADER;
+            }
+            if (buf[12] != 0) {
+                return PNG_ERROR_INTERLACED;
+            }
+            header.hasAlpha = header.colorType == 4 || header.colorType == 6;
+        } else if (memcmp(type, "PLTE", 4) == 0) {
+            if (length == 0 || length > 256 * 3 || length % 3 != 0) {
+                return PNG_ERROR_HEADER;
+            }
+            header.paletteSize = length / 3;
+            for (uint16_t i = 0; i < header.paletteSize; i++) {
+                if (!readExact(read, context, buf, 3)) {
+                    return PNG_ERROR_READ;
+                }
+                if (palette != nullptr) {
+                    memcpy(palette + i * 4, buf, 3);
+                }
+            }
+        } else if (memcmp(type, "tRNS", 4) == 0) {
+            if (header.colorType == 3) {
+                // 调色板各项的Alpha
+                if (length > header.paletteSize) {
+                    return PNG_ERROR_HEADER;
+                }
+                for (uint32_t i = 0; i < length; i++) {
+                    if (!readExact(read, context, buf, 1)) {
+                        return PNG_ERROR_READ;
+                    }
+                    if (palette != nullptr) {
+                        palette[i * 4 + 3] = buf[0];
+                    }
+                }
+            } else if (header.colorType == 0 || header.colorType == 2) {
+                // 透明色：灰度2字节，RGB各2字节
+                uint32_t expected = header.colorType == 0 ? 2 : 6;
+                if (length != expected || !readExact(read, context, buf, length)) {
+                    return PNG_ERROR_HEADER;
+                }
+                for (uint32_t i = 0; i < length / 2; i++) {
+                    header.key[i] = (buf[i * 2] << 8) | buf[i * 2 + 1];
+                }
+                header.hasKey = true;
+            } else {
+                return PNG_ERROR_HEADER;
+            }
+            header.hasAlpha = true;
+        } else if (memcmp(type, "IDAT", 4) == 0) {
+            if (header.colorType == 3 && header.paletteSize == 0) {
+                return PNG_ERROR_HEADER;
+            }
+            idatLength = length;
+            return PNG_OK;
+        } else if (memcmp(type, "IEND", 4) == 0) {
+            return PNG_ERROR_HEADER;
+        } else if (!skipBytes(read, context, length)) {
+            return PNG_ERROR_READ;
+        }
+        // 跳过CRC（不校验）
+        if (!skipBytes(read, context, 4)) {
+            return PNG_ERROR_READ;
+        }
+    }
+}
+//*** 只读取图像信息
+PngError PngStream::readHeader(PngReadFunc read, void* context, PngHeader& header) {
+    uint32_t idatLength;
+    return parseHeader(read, context, header, nullptr, idatLength);
+}
+//*** 读取图像信息并分配解码缓冲区
+PngError PngStream::begin(PngReadFunc read, void* context) {
+    end();
+    // 哈夫曼表和调色板每个字节都频繁访问，优先放在内部RAM中
+    work = (Work*)allocBuffer(sizeof(Work), true);
+    if (work == nullptr) {
+        return PNG_ERROR_MEMORY;
+    }
+    // 调色板中没有的颜色为不透明的黑色
+    for (int i = 0; i < 256; i++) {
+        uint8_t* entry = work->palette + i * 4;
+        entry[0] = entry[1] = entry[2] = 0;
+        entry[3] = 255;
+    }
+    uint32_t idatLength = 0;
+    PngError error = parseHeader(read, context, info, work->palette, idatLength);
+    if (error != PNG_OK) {
+        end();
+        return error;
+    }
+    static const uint8_t CHANNELS[7] = {1, 0, 3, 1, 2, 0, 4};
+    uint32_t bitsPerPixel = CHANNELS[info.colorType] * info.bitDepth;
+    rowBytes = ((size_t)info.width * bitsPerPixel + 7) / 8;
+    filterBytes = bitsPerPixel >= 8 ? bitsPerPixel / 8 : 1;
+    // 解压窗口不需要超过整幅图像的原始数据
+    uint64_t rawBytes = (uint64_t)info.height * (rowBytes + 1);
+    size_t windowSize = 256;
+    while (windowSize < PNG_STREAM_WINDOW_SIZE && windowSize < rawBytes) {
+        windowSize <<= 1;
+    }
+    // 窗口按匹配距离向前读取，放在PSRAM中也有缓存，内部RAM留给网络等任务
+    size_t bufferBytes = windowSize + (rowBytes + 1) * 2;
+    window = (uint8_t*)allocBuffer(bufferBytes, false);
+    if (window == nullptr) {
+        end();
+        return PNG_ERROR_MEMORY;
+    }
+    memoryBytes = sizeof(Work) + bufferBytes;
+    windowMask = windowSize - 1;
+    rows = window + windowSize;
+    previous = rows;
+    current = rows + rowBytes + 1;
+    // 每行开始时交换两行缓冲区，第一行的上一行为全零
+    memset(rows, 0, (rowBytes + 1) * 2);
+    this->read = read;
+    this->context = context;
+    row = 0;
+    inputPos = 0;
+    inputLength = 0;
+    chunkRemaining = idatLength;
+    chunksEnded = false;
+    padding = 0;
+    bitBuffer = 0;
+    bitCount = 0;
+    finalBlock = false;
+    blockType = -1;
+    storedRemaining = 0;
+    copyLength = 0;
+    copyDistance = 0;
+    totalOut = 0;
+    // zlib头：压缩方法8（deflate），不使用预设字典
+    uint8_t cmf = nextByte();
+    uint8_t flg = nextByte();
+    if (padding > 0 || (cmf & 0x0F) != 8 || (cmf >> 4) > 7 || (flg & 0x20) != 0 || ((cmf << 8) | flg) % 31 != 0) {
+        end();
+        return padding > 0 ? PNG_ERROR_READ : PNG_ERROR_DATA;
+    }
+    return PNG_OK;
+}
+//*** 释放解码缓冲区
+void PngStream::end() {
+    if (work != nullptr) {
+        freeBuffer(work);
+        work = nullptr;
+    }
+    if (window != nullptr) {
+        freeBuffer(window);
+        window = nullptr;
+    }
+    rows = nullptr;
+    memoryBytes = 0;
+}
+//*** 从后续的IDAT块读取压缩数据，数据结束后返回零
+uint8_t PngStream::refill() {
+    while (chunkRemaining == 0) {
+        uint8_t buf[12];
+        // 上一块的CRC，下一块的长度和类型；压缩数据可以分在多个连续的IDAT块中
+        if (chunksEnded || !readExact(read, context, buf, 12) || memcmp(buf + 8, "IDAT", 4) != 0) {
+            chunksEnded = true;
+            padding++;
+            return 0;
+        }
+        chunkRemaining = getBe32(buf + 4);
+    }
+    size_t n = chunkRemaining < PNG_STREAM_INPUT_SIZE ? chunkRemaining : PNG_STREAM_INPUT_SIZE;
+    size_t got = read(context, work->input, n);
+    if (got == 0) {
+        chunksEnded = true;
+        chunkRemaining = 0;
+        padding++;
+        return 0;
+    }
+    chunkRemaining -= got;
+    inputLength = got;
+    inputPos = 1;
+    return work->input[0];
+}
+//*** 按码长构造哈夫曼解码表
+bool PngStream::buildHuffman(Huffman& table, const uint8_t* sizes, int count) {
+    int counts[16];
+    int nextCode[16];
+    memset(counts, 0, sizeof(counts));
+    memset(table.fast, 0, sizeof(table.fast));
+    for (int i = 0; i < count; i++) {
+        counts[sizes[i]]++;
+    }
+    counts[0] = 0;
+    int code = 0;
+    int symbol = 0;
+    for (int length = 1; length < 16; length++) {
+        if (counts[length] > (1 << length)) {
+            return false;
+        }
+        nextCode[length] = code;
+        table.firstCode[length] = code;
+        table.firstSymbol[length] = symbol;
+        code += counts[length];
+        if (counts[length] > 0 && code - 1 >= (1 << length)) {
+            return false;
+        }
+        table.maxCode[length] = code << (16 - length);
+        code <<= 1;
+        symbol += counts[length];
+    }
+    table.maxCode[16] = 0x10000;
+    for (int i = 0; i < count; i++) {
+        int length = sizes[i];
+        if (length == 0) {
+            continue;
+        }
+        int index = nextCode[length] - table.firstCode[length] + table.firstSymbol[length];
+        table.size[index] = length;
+        table.value[index] = i;
+        if (length <= 9) {
+            // 短编码：填充查找表中低length位相同的所有项
+            uint16_t entry = (length << 9) | i;
+            for (int j = reverse16(nextCode[length]) >> (16 - length); j < 512; j += 1 << length) {
+                table.fast[j] = entry;
+            }
+        }
+        nextCode[length]++;
+    }
+    return true;
+}
+//*** 解码一个哈夫曼符号，无效编码返回-1
+int PngStream::decodeSymbol(const Huffman& table) {
+    if (bitCount < 16) {
+        fillBits();
+    }
+    uint16_t entry = table.fast[bitBuffer & 511];
+    if (entry != 0) {
+        int length = entry >> 9;
+        bitBuffer >>= length;
+        bitCount -= length;
+        return entry & 511;
+    }
+    // 长编码：按码长逐个比较规范编码的范围
+    int32_t code = reverse16(bitBuffer & 0xFFFF);
+    int length;
+    for (length = 10; length < 16; length++) {
+        if (code < table.maxCode[length]) {
+            break;
+        }
+    }
+    if (length >= 16) {
+        return -1;
+    }
+    int index = (code >> (16 - length)) - table.firstCode[length] + table.firstSymbol[length];
+    if (index >= 288 || table.size[index] != length) {
+        return -1;
+    }
+    bitBuffer >>= length;
+    bitCount -= length;
+    return table.value[index];
+}
+//*** 读取动态哈夫曼块的编码表
+PngError PngStream::readDynamicTables() {
+    int literalCount = getBits(5) + 257;
+    int distanceCount = getBits(5) + 1;
+    int codeLengthCount = getBits(4) + 4;
+    if (literalCount > 286 || distanceCount > 30) {
+        return PNG_ERROR_DATA;
+    }
+    uint8_t codeSizes[19];
+    memset(codeSizes, 0, sizeof(codeSizes));
+    for (int i = 0; i < codeLengthCount; i++) {
+        codeSizes[CODE_LENGTH_ORDER[i]] = getBits(3);
+    }
+    if (!buildHuffman(work->distances, codeSizes, 19)) {
+        return PNG_ERROR_DATA;
+    }
+    // 字面量/长度和距离的码长连续编码，重复符号可以跨越两部分
+    uint8_t sizes[286 + 30];
+    int total = literalCount + distanceCount;
+    int n = 0;
+    while (n < total) {
+        int symbol = decodeSymbol(work->distances);
+        if (symbol < 0 || symbol > 18) {
+            return PNG_ERROR_DATA;
+        }
+        if (symbol < 16) {
+            sizes[n++] = symbol;
+            continue;
+        }
+        int repeat;
+        uint8_t fill = 0;
+        if (symbol == 16) {
+            if (n == 0) {
+                return PNG_ERROR_DATA;
+            }
+            repeat = getBits(2) + 3;
+            fill = sizes[n - 1];
+        } else if (symbol == 17) {
+            repeat = getBits(3) + 3;
+        } else {
+            repeat = getBits(7) + 11;
+        }
+        if (n + repeat > total) {
+            return PNG_ERROR_DATA;
+        }
+        memset(sizes + n, fill, repeat);
+        n += repeat;
+    }
+    if (sizes[256] == 0 || !buildHuffman(work->lengths, sizes, literalCount) ||
+        !buildHuffman(work->distances, sizes + literalCount, distanceCount)) {
+        return PNG_ERROR_DATA;
+    }
+    return PNG_OK;
+}
+//*** 读取下一个deflate块头
+PngError PngStream::readBlockHeader() {
+    finalBlock = getBits(1) != 0;
+    int type = getBits(2);
+    if (type == 0) {
+        // 存储块：跳到字节边界，长度和长度的反码
+        getBits(bitCount & 7);
+        uint32_t length = getBits(16);
+        uint32_t inverse = getBits(16);
+        if (length != (~inverse & 0xFFFF)) {
+            return PNG_ERROR_DATA;
+        }
+        storedRemaining = length;
+    } else if (type == 1) {
+        // 固定哈夫曼编码
+        uint8_t sizes[288];
+        memset(sizes, 8, 144);
+        memset(sizes + 144, 9, 112);
+        memset(sizes + 256, 7, 24);
+        memset(sizes + 280, 8, 8);
+        buildHuffman(work->lengths, sizes, 288);
+        memset(sizes, 5, 30);
+        buildHuffman(work->distances, sizes, 30);
+    } else if (type == 2) {
+        PngError error = readDynamicTables();
+        if (error != PNG_OK) {
+            return error;
+        }
+    } else {
+        return PNG_ERROR_DATA;
+    }
+    blockType = type;
+    return PNG_OK;
+}
+//*** 解压指定的字节数（可以停在块中间，下次继续）
+PngError PngStream::inflate(uint8_t* out, size_t length) {
+    size_t produced = 0;
+    while (produced < length) {
+        if (copyLength > 0) {
+            // 未完成的匹配：从窗口中距离之前的位置复制（可以与正在写入的数据重叠）
+            uint32_t n = length - produced < copyLength ? length - produced : copyLength;
+            copyLength -= n;
+            while (n-- > 0) {
+                uint8_t value = window[(totalOut - copyDistance) & windowMask];
+                window[totalOut++ & windowMask] = value;
+                out[produced++] = value;
+            }
+            continue;
+        }
+        if (blockType < 0) {
+            if (finalBlock) {
+                // 压缩数据已结束，但图像数据还不够
+                return PNG_ERROR_DATA;
+            }
+            PngError error = readBlockHeader();
+            if (error != PNG_OK) {
+                return error;
+            }
+            continue;
+        }
+        if (blockType == 0) {
+            if (storedRemaining == 0) {
+                blockType = -1;
+                continue;
+            }
+            storedRemaining--;
+            uint8_t value = getBits(8);
+            window[totalOut++ & windowMask] = value;
+            out[produced++] = value;
+            continue;
+        }
+        int symbol = decodeSymbol(work->lengths);
+        if (symbol < 256) {
+            if (symbol < 0) {
+                return PNG_ERROR_DATA;
+            }
+            window[totalOut++ & windowMask] = symbol;
+            out[produced++] = symbol;
+        } else if (symbol == 256) {
+            blockType = -1;
+        } else {
+            symbol -= 257;
+            if (symbol >= 29) {
+                return PNG_ERROR_DATA;
+            }
+            copyLength = LENGTH_BASE[symbol] + getBits(LENGTH_EXTRA[symbol]);
+            int distance = decodeSymbol(work->distances);
+            if (distance < 0 || distance >= 30) {
+                return PNG_ERROR_DATA;
+            }
+            copyDistance = DISTANCE_BASE[distance] + getBits(DISTANCE_EXTRA[distance]);
+            if (copyDistance > totalOut) {
+                return PNG_ERROR_DATA;
+            }
+        }
+    }
+    return PNG_OK;
+}
+//*** 解码下一行
+PngError PngStream::readRow(uint8_t* rgba) {
+    if (work == nullptr) {
+        return PNG_ERROR_MEMORY;
+    }
+    if (row >= info.height) {
+        return PNG_ERROR_END;
+    }
+    uint8_t* swap = previous;
+    previous = current;
+    current = swap;
+    PngError error = inflate(current, rowBytes + 1);
+    if (error != PNG_OK) {
+        return error;
+    }
+    // 用到了数据结束后补充的零：压缩数据不完整
+    if (padding * 8 > (uint32_t)bitCount) {
+        return PNG_ERROR_READ;
+    }
+    // 反滤波
+    uint8_t* cur = current + 1;
+    const uint8_t* prev = previous + 1;
+    size_t fb = filterBytes;
+    switch (current[0]) {
+        case 0:
+            break;
+        case 1:
+            for (size_t i = fb; i < rowBytes; i++) {
+                cur[i] += cur[i - fb];
+            }
+            break;
+        case 2:
+            for (size_t i = 0; i < rowBytes; i++) {
+                cur[i] += prev[i];
+            }
+            break;
+        case 3:
+            for (size_t i = 0; i < fb; i++) {
+                cur[i] += prev[i] >> 1;
+            }
+            for (size_t i = fb; i < rowBytes; i++) {
+                cur[i] += (cur[i - fb] + prev[i]) >> 1;
+            }
+            break;
+        case 4:
+            for (size_t i = 0; i < fb; i++) {
+                cur[i] += prev[i];
+            }
+            for (size_t i = fb; i < rowBytes; i++) {
+                cur[i] += paeth(cur[i - fb], prev[i], prev[i - fb]);
+            }
+            break;
+        default:
+            return PNG_ERROR_DATA;
+    }
+    convertRow(cur, rgba);
+    row++;
+    return PNG_OK;
+}
+//*** 把一行原始数据转换为RGBA（与lodepng的转换结果相同）
+void PngStream::convertRow(const uint8_t* raw, uint8_t* rgba) const {
+    uint32_t width = info.width;
+    uint8_t depth = info.bitDepth;
+    switch (info.colorType) {
+        case 0:
+            for (uint32_t i = 0; i < width; i++, rgba += 4) {
+                uint32_t value;
+                uint8_t gray;
+                if (depth == 16) {
+                    value = (raw[i * 2] << 8) | raw[i * 2 + 1];
+                    gray = raw[i * 2];
+                } else if (depth == 8) {
+                    value = raw[i];
+                    gray = value;
+                } else {
+                    // 低位深度：每字节从高位开始存放多个像素，按比例扩展到0~255
+                    uint32_t bit = i * depth;
+                    uint32_t highest = (1 << depth) - 1;
+                    value = (raw[bit >> 3] >> (8 - depth - (bit & 7))) & highest;
+                    gray = value * 255 / highest;
+                }
+                rgba[0] = rgba[1] = rgba[2] = gray;
+                rgba[3] = info.hasKey && value == info.key[0] ? 0 : 255;
+            }
+            break;
+        case 2:
+            for (uint32_t i = 0; i < width; i++, rgba += 4) {
+                if (depth == 8) {
+                    const uint8_t* p = raw + i * 3;
+                    rgba[0] = p[0];
+                    rgba[1] = p[1];
+                    rgba[2] = p[2];
+                    rgba[3] = info.hasKey && p[0] == info.key[0] && p[1] == info.key[1] && p[2] == info.key[2] ? 0 : 255;
+                } else {
+                    const uint8_t* p = raw + i * 6;
+                    rgba[0] = p[0];
+                    rgba[1] = p[2];
+                    rgba[2] = p[4];
+                    rgba[3] = info.hasKey && ((p[0] << 8) | p[1]) == info.key[0] &&
+                              ((p[2] << 8) | p[3]) == info.key[1] && ((p[4] << 8) | p[5]) == info.key[2] ? 0 : 255;
+                }
+            }
+            break;
+        case 3:
+            for (uint32_t i = 0; i < width; i++, rgba += 4) {
+                uint32_t index;
+                if (depth == 8) {
+                    index = raw[i];
+                } else {
+                    uint32_t bit = i * depth;
+                    index = (raw[bit >> 3] >> (8 - depth - (bit & 7))) & ((1 << depth) - 1);
+                }
+                memcpy(rgba, work->palette + index * 4, 4);
+            }
+            break;
+        case 4:
+            for (uint32_t i = 0; i < width; i++, rgba += 4) {
+                const uint8_t* p = depth == 8 ? raw + i * 2 : raw + i * 4;
+                rgba[0] = rgba[1] = rgba[2] = p[0];
+                rgba[3] = p[depth == 8 ? 1 : 2];
+            }
+            break;
+        case 6:
+            if (depth == 8) {
+                memcpy(rgba, raw, width * 4);
+                break;
+            }
+            for (uint32_t i = 0; i < width; i++, rgba += 4) {
+                const uint8_t* p = raw + i * 8;
+                rgba[0] = p[0];
+                rgba[1] = p[2];
+                rgba[2] = p[4];
+                rgba[3] = p[6];
+            }
+            break;
+    }
+}
@@ -0,0 +1,166 @@
+#ifndef PNG_STREAM_H
+#define PNG_STREAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * 逐行PNG解码
+ * 只依赖标准C头文件，可以在PC上单独编译，用于与lodepng的解码结果逐像素比较。
+ *
+ * lodepng先把整个IDAT解压，再把整幅图像转换为RGBA（每像素4字节）；本类从读取函数按需读取压缩数据，
+ * 每次只解压一行（滤波类型加一行的原始数据），用上一行反滤波后转换为RGBA输出。
+ * 解压使用自带的inflate（存储、固定和动态哈夫曼块），需要的内存只有解压窗口（最大32KB）、
+ * 两行原始数据、调色板和哈夫曼表。不校验CRC和Adler-32；不支持隔行扫描（Adam7）的图像
+ */
+
+// 读取函数：读取最多length字节到buf，返回实际读取的字节数（0表示没有更多数据）
+typedef size_t (*PngReadFunc)(void* context, uint8_t* buf, size_t length);
+
+// 解码结果
+enum PngError {
+    PNG_OK = 0,
+    PNG_ERROR_READ,          // 数据不完整
+    PNG_ERROR_SIGNATURE,     // 不是PNG文件
+    PNG_ERROR_HEADER,        // 文件头或数据块无效
+    PNG_ERROR_INTERLACED,    // 隔行扫描的图像（不支持）
+    PNG_ERROR_MEMORY,        // 内存不足
+    PNG_ERROR_DATA,          // 压缩数据或滤波类型无效
+    PNG_ERROR_END            // 所有行已读取
+};
+
+// 最大宽度（像素），限制行缓冲区的大小
+const uint32_t PNG_STREAM_MAX_WIDTH = 8192;
+// 最大解压窗口（字节），原始数据较少的图像使用更小的窗口
+const size_t PNG_STREAM_WINDOW_SIZE = 32768;
+// 每次从读取函数读取的压缩数据的字节数
+const size_t PNG_STREAM_INPUT_SIZE = 1024;
+
+// 图像信息（第一个IDAT之前的数据块）
+struct PngHeader {
+    uint32_t width;
+    uint32_t height;
+    uint8_t bitDepth;        // 1, 2, 4, 8或16
+    uint8_t colorType;       // 0灰度, 2 RGB, 3调色板, 4灰度+Alpha, 6 RGBA
+    bool hasAlpha;           // 有Alpha通道或tRNS块
+    bool hasKey;             // 灰度或RGB图像的tRNS透明色
+    uint16_t key[3];         // 透明色（与原始数据同样的位深度）
+    uint16_t paletteSize;
+};
+
+class PngStream {
+private:
+    // 哈夫曼解码表：9位查找表加按码长的规范编码范围
+    struct Huffman {
+        uint16_t fast[512];      // 码长<<9 | 符号，0表示码长超过9位
+        uint16_t firstCode[16];
+        uint16_t firstSymbol[16];
+        int32_t maxCode[17];     // 每个码长最大编码的下一个值（左移到16位）
+        uint8_t size[288];
+        uint16_t value[288];
+    };
+
+    // 解码时使用的表和缓冲区（一次分配）
+    struct Work {
+        Huffman lengths;         // 字面量/长度编码
+        Huffman distances;       // 距离编码（读取动态块头时先用作码长编码）
+        uint8_t palette[256 * 4];
+        uint8_t input[PNG_STREAM_INPUT_SIZE];
+    };
+
+    PngReadFunc read;
+    void* context;
+    PngHeader info;
+    Work* work;
+    uint8_t* window;             // 解压窗口（最近解压的数据）
+    size_t windowMask;
+    uint8_t* rows;               // 两行原始数据（每行包括滤波类型字节）
+    uint8_t* previous;           // 上一行（反滤波后）
+    uint8_t* current;
+    size_t rowBytes;             // 每行原始数据的字节数（不包括滤波类型）
+    uint8_t filterBytes;         // 滤波时相邻像素的字节距离
+    size_t memoryBytes;
+    uint32_t row;                // 下一行的行号
+
+    // 压缩数据的读取位置
+    size_t inputPos;
+    size_t inputLength;
+    uint32_t chunkRemaining;     // 当前IDAT块中未读取的字节数
+    bool chunksEnded;            // 已读到最后一个IDAT块之后
+    uint32_t padding;            // 数据结束后补充的零字节数
+    uint32_t bitBuffer;
+    int bitCount;
+
+    // 解压状态
+    bool finalBlock;
+    int blockType;               // -1表示需要读取下一个块头
+    uint32_t storedRemaining;    // 存储块中剩余的字节数
+    uint32_t copyLength;         // 未完成的匹配复制
+    uint32_t copyDistance;
+    uint32_t totalOut;           // 已解压的字节数（检查距离）
+
+    // 读取第一个IDAT之前的数据块
+    static PngError parseHeader(PngReadFunc read, void* context, PngHeader& header, uint8_t* palette,
+                                uint32_t& idatLength);
+
+    // 压缩数据的读取
+    uint8_t refill();
+    inline uint8_t nextByte() {
+        return inputPos < inputLength ? work->input[inputPos++] : refill();
+    }
+    inline void fillBits() {
+        while (bitCount <= 24) {
+            bitBuffer |= (uint32_t)nextByte() << bitCount;
+            bitCount += 8;
+        }
+    }
+    inline uint32_t getBits(int n) {
+        if (bitCount < n) {
+            fillBits();
+        }
+        uint32_t value = bitBuffer & ((1u << n) - 1);
+        bitBuffer >>= n;
+        bitCount -= n;
+        return value;
+    }
+
+    // 解压
+    static bool buildHuffman(Huffman& table, const uint8_t* sizes, int count);
+    int decodeSymbol(const Huffman& table);
+    PngError readBlockHeader();
+    PngError readDynamicTables();
+    PngError inflate(uint8_t* out, size_t length);
+
+    // 把一行原始数据转换为RGBA
+    void convertRow(const uint8_t* raw, uint8_t* rgba) const;
+
+public:
+    PngStream();
+    ~PngStream();
+
+    // 只读取图像信息（不分配内存），读取函数停在第一个IDAT块的数据处
+    static PngError readHeader(PngReadFunc read, void* context, PngHeader& header);
+
+    // 读取图像信息并分配解码缓冲区，之后用readRow逐行读取
+    PngError begin(PngReadFunc read, void* context);
+
+    // 解码下一行，输出宽度×4字节的RGBA（8位，16位深度取高字节）
+    PngError readRow(uint8_t* rgba);
+
+    // 释放解码缓冲区
+    void end();
+
+    // 图像信息（begin成功后有效）
+    const PngHeader& header() const { return info; }
+
+    // 下一行的行号
+    uint32_t getRow() const { return row; }
+
+    // 解码缓冲区占用的字节数（解码时的峰值内存）
+    size_t getMemoryBytes() const { return memoryBytes; }
+
+    // 检查数据开头是否为PNG文件签名
+    static bool isPng(const uint8_t* data, size_t length);
+};
+
+#endif // PNG_STREAM_H
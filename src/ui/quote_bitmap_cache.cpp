@@ -0,0 +1,391 @@
+#include "quote_bitmap_cache.h"
+#include <ArduinoJson.h>
+#include <esp_heap_caps.h>
+
+// 定义单例实例
+QuoteBitmapCache* QuoteBitmapCache::instance = nullptr;
+
+// 绘制时把4位Alpha展开为8位蒙版的行缓冲区（只在显示任务中使用）
+static lv_opa_t stripMask[QUOTE_BITMAP_MAX_WIDTH * QUOTE_BITMAP_STRIP_ROWS];
+
+//*** 私有构造函数
+QuoteBitmapCache::QuoteBitmapCache() {
+    memset(entries, 0, sizeof(entries));
+    memset(bindings, 0, sizeof(bindings));
+    memset(corpora, 0, sizeof(corpora));
+    memset(corpusSizes, 0, sizeof(corpusSizes));
+    totalBytes = 0;
+    useCounter = 0;
+    hits = 0;
+    misses = 0;
+    renderFailures = 0;
+    renderMicros = 0;
+    retiredSavedMicros = 0;
+}
+//*** 获取单例实例
+QuoteBitmapCache* QuoteBitmapCache::getInstance() {
+    if (instance == nullptr) {
+        instance = new QuoteBitmapCache();
+    }
+    return instance;
+}
+//*** 登记语录库
+void QuoteBitmapCache::registerCorpus(const char** quotes, int count) {
+    for (int i = 0; i < QUOTE_BITMAP_MAX_CORPORA; i++) {
+        if (corpora[i] == quotes) {
+            return;
+        }
+        if (corpora[i] == nullptr) {
+            corpora[i] = quotes;
+            corpusSizes[i] = count;
+            return;
+        }
+    }
+}
+//*** 把语录渲染为位图
+bool QuoteBitmapCache::render(lv_obj_t* label, const char* quote, BitmapEntry& entry) {
+    unsigned long startTime = micros();
+    // 按标签当前的样式和宽度排版，与标签自己绘制文本时一致
+    lv_obj_update_layout(label);
+    lv_coord_t width = lv_obj_get_content_width(label);
+    if (width <= 0 || width > QUOTE_BITMAP_MAX_WIDTH) {
+        return false;
+    }
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(label, LV_PART_MAIN, &dsc);
+    lv_bidi_calculate_align(&dsc.align, &dsc.bidi_dir, quote);
+    lv_point_t size;
+    lv_txt_get_size(&size, quote, dsc.font, dsc.letter_space, dsc.line_space, width, dsc.flag);
+    if (size.y <= 0) {
+        return false;
+    }
+    // 临时画布放在PSRAM中，渲染完成后立即释放
+    lv_color_t* canvasBuf = (lv_color_t*)heap_caps_malloc(LV_CANVAS_BUF_SIZE_TRUE_COLOR(width, size.y),
+                                                          MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (canvasBuf == nullptr) {
+        return false;
+    }
+    lv_obj_t* canvas = lv_canvas_create(lv_scr_act());
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_buffer(canvas, canvasBuf, width, size.y, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+    // 黑底白字绘制，像素亮度即为字形的覆盖率
+    dsc.color = lv_color_white();
+    dsc.opa = LV_OPA_COVER;
+    unsigned long textStart = micros();
+    lv_canvas_draw_text(canvas, 0, 0, width, &dsc, quote);
+    entry.textMicros = micros() - textStart;
+
+    // 裁掉底部没有笔画的行（最后一行的行距等）
+    lv_coord_t inkHeight = 0;
+    for (lv_coord_t y = size.y - 1; y >= 0 && inkHeight == 0; y--) {
+        const lv_color_t* row = canvasBuf + (uint32_t)y * width;
+        for (lv_coord_t x = 0; x < width; x++) {
+            if (lv_color_brightness(row[x]) >= 16) {
+                inkHeight = y + 1;
+                break;
+            }
+        }
+    }
+    uint32_t stride = (width + 1) / 2;
+    size_t bytes = stride * inkHeight;
+    uint8_t* data = nullptr;
+    if (bytes > 0) {
+        data = (uint8_t*)heap_caps_calloc(1, bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (data != nullptr) {
+        // 压缩为4位Alpha：每字节两个像素，高4位在前
+        for (lv_coord_t y = 0; y < inkHeight; y++) {
+            const lv_color_t* row = canvasBuf + (uint32_t)y * width;
+            uint8_t* out = data + y * stride;
+            for (lv_coord_t x = 0; x < width; x++) {
+                uint8_t a4 = lv_color_brightness(row[x]) >> 4;
+                out[x >> 1] |= (x & 1) ? a4 : (uint8_t)(a4 << 4);
+            }
+        }
+    }
+    lv_obj_del(canvas);
+    free(canvasBuf);
+    if (data == nullptr) {
+        return false;
+    }
+
+    entry.quote = quote;
+    entry.data = data;
+    entry.width = width;
+    entry.height = inkHeight;
+    entry.textHeight = size.y;
+    entry.font = dsc.font;
+    entry.lastUsed = 0;
+    entry.refCount = 0;
+    entry.shows = 0;
+    entry.blitMicros = 0;
+    totalBytes += bytes;
+    unsigned long elapsed = micros() - startTime;
+    renderMicros += elapsed;
+    Serial.printf("语录位图已渲染: %dx%d，%u 字节，文本光栅化 %u us，总耗时 %lu us，缓存共 %u 字节\n",
+                  width, inkHeight, (unsigned)bytes, (unsigned)entry.textMicros, elapsed, (unsigned)totalBytes);
+    return true;
+}
+//*** 查找或创建标签绑定
+QuoteBitmapCache::LabelBinding* QuoteBitmapCache::findBinding(lv_obj_t* label, bool create) {
+    LabelBinding* freeSlot = nullptr;
+    for (int i = 0; i < QUOTE_BITMAP_MAX_LABELS; i++) {
+        if (bindings[i].label == label) {
+            return &bindings[i];
+        }
+        if (bindings[i].label == nullptr && freeSlot == nullptr) {
+            freeSlot = &bindings[i];
+        }
+    }
+    if (!create || freeSlot == nullptr) {
+        return nullptr;
+    }
+    freeSlot->label = label;
+    freeSlot->quote = nullptr;
+    freeSlot->entry = nullptr;
+    // 事件回调只注册一次，解除绑定后回调不做任何处理
+    lv_obj_add_event_cb(label, labelEventCallback, LV_EVENT_ALL, nullptr);
+    return freeSlot;
+}
+//*** 释放绑定中的位图引用
+void QuoteBitmapCache::unbind(LabelBinding* binding) {
+    if (binding->entry != nullptr && binding->entry->refCount > 0) {
+        binding->entry->refCount--;
+    }
+    binding->entry = nullptr;
+    binding->quote = nullptr;
+}
+//*** 查找语录对应的条目
+QuoteBitmapCache::BitmapEntry* QuoteBitmapCache::findEntry(const char* quote) {
+    for (int i = 0; i < QUOTE_BITMAP_MAX_ENTRIES; i++) {
+        if (entries[i].quote == quote) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+//*** 释放一个缓存条目
+void QuoteBitmapCache::eraseEntry(BitmapEntry* entry) {
+    totalBytes -= ((entry->width + 1) / 2) * entry->height;
+    retiredSavedMicros += savedMicros(*entry);
+    free(entry->data);
+    memset(entry, 0, sizeof(BitmapEntry));
+}
+//*** 释放最久未使用且未显示的条目
+bool QuoteBitmapCache::evictOldest() {
+    BitmapEntry* victim = nullptr;
+    for (int i = 0; i < QUOTE_BITMAP_MAX_ENTRIES; i++) {
+        // 空闲条目和正在显示的位图跳过
+        if (entries[i].quote == nullptr || entries[i].refCount > 0) {
+            continue;
+        }
+        if (victim == nullptr || entries[i].lastUsed < victim->lastUsed) {
+            victim = &entries[i];
+        }
+    }
+    if (victim == nullptr) {
+        return false;
+    }
+    eraseEntry(victim);
+    return true;
+}
+//*** 超出预算时释放未显示的位图
+void QuoteBitmapCache::enforceBudget() {
+    while (totalBytes > QUOTE_BITMAP_CACHE_BUDGET && evictOldest()) {
+    }
+}
+//*** 条目节省的耗时
+int64_t QuoteBitmapCache::savedMicros(const BitmapEntry& entry) {
+    return (int64_t)entry.shows * entry.textMicros - (int64_t)entry.blitMicros;
+}
+//*** 以位图方式在标签中显示语录
+bool QuoteBitmapCache::show(lv_obj_t* label, const char* quote) {
+    if (label == nullptr || quote == nullptr || !lv_obj_is_valid(label)) {
+        return false;
+    }
+    LabelBinding* binding = findBinding(label, true);
+    if (binding == nullptr) {
+        return false;
+    }
+    // 先解除旧的绑定，未命中时预算检查可以释放旧位图
+    unbind(binding);
+    lv_obj_update_layout(label);
+    const lv_font_t* font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+    lv_coord_t width = lv_obj_get_content_width(label);
+
+    BitmapEntry* entry = findEntry(quote);
+    if (entry != nullptr && (entry->font != font || entry->width != width)) {
+        // 标签字体或宽度已改变，旧位图不再适用
+        if (entry->refCount > 0) {
+            renderFailures++;
+            return false;
+        }
+        eraseEntry(entry);
+        entry = nullptr;
+    }
+    if (entry == nullptr) {
+        // 条目表已满时先释放最久未使用的条目
+        entry = findEntry(nullptr);
+        if (entry == nullptr && evictOldest()) {
+            entry = findEntry(nullptr);
+        }
+        if (entry == nullptr || !render(label, quote, *entry)) {
+            renderFailures++;
+            return false;
+        }
+        misses++;
+    } else {
+        hits++;
+    }
+
+    entry->lastUsed = ++useCounter;
+    entry->shows++;
+    entry->refCount++;
+    binding->entry = entry;
+    binding->quote = quote;
+    enforceBudget();
+
+    // 标签本身不再排版和绘制文本，只绘制背景，文本由绘制事件中的位图混合完成
+    lv_label_set_text_static(label, "");
+    lv_obj_refresh_self_size(label);
+    lv_obj_invalidate(label);
+    return true;
+}
+//*** 解除标签的位图显示
+void QuoteBitmapCache::release(lv_obj_t* label) {
+    LabelBinding* binding = findBinding(label, false);
+    if (binding == nullptr || binding->entry == nullptr) {
+        return;
+    }
+    unbind(binding);
+    if (lv_obj_is_valid(label)) {
+        lv_obj_refresh_self_size(label);
+        lv_obj_invalidate(label);
+    }
+}
+//*** 标签事件回调
+void QuoteBitmapCache::labelEventCallback(lv_event_t* e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code != LV_EVENT_DRAW_MAIN && code != LV_EVENT_GET_SELF_SIZE && code != LV_EVENT_DELETE) {
+        return;
+    }
+    QuoteBitmapCache* cache = getInstance();
+    lv_obj_t* label = lv_event_get_target(e);
+    LabelBinding* binding = cache->findBinding(label, false);
+    if (binding == nullptr) {
+        return;
+    }
+    if (code == LV_EVENT_DELETE) {
+        // 标签被释放（如屏幕生命周期管理器回收内存），归还绑定位置
+        cache->unbind(binding);
+        binding->label = nullptr;
+        return;
+    }
+    BitmapEntry* entry = binding->entry;
+    if (entry == nullptr) {
+        return;
+    }
+    if (code == LV_EVENT_GET_SELF_SIZE) {
+        // 标签文本为空，按位图对应的文本尺寸撑开标签（未固定高度的标签依赖此尺寸）
+        lv_point_t* selfSize = (lv_point_t*)lv_event_get_param(e);
+        selfSize->x = LV_MAX(selfSize->x, entry->width);
+        selfSize->y = LV_MAX(selfSize->y, entry->textHeight);
+        return;
+    }
+
+    // LV_EVENT_DRAW_MAIN：标签类已绘制完背景，在其上混合位图
+    unsigned long startTime = micros();
+    lv_draw_ctx_t* drawCtx = lv_event_get_draw_ctx(e);
+    lv_area_t bitmapArea;
+    lv_obj_get_content_coords(label, &bitmapArea);
+    bitmapArea.x2 = bitmapArea.x1 + entry->width - 1;
+    bitmapArea.y2 = bitmapArea.y1 + entry->height - 1;
+    lv_area_t drawArea;
+    if (!_lv_area_intersect(&drawArea, &bitmapArea, drawCtx->clip_area)) {
+        return;
+    }
+    // 颜色和透明度每次从样式读取，位图只保存覆盖率，换色不需要重新渲染
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(label, LV_PART_MAIN, &dsc);
+
+    lv_draw_sw_blend_dsc_t blendDsc;
+    memset(&blendDsc, 0, sizeof(blendDsc));
+    blendDsc.color = dsc.color;
+    blendDsc.opa = dsc.opa;
+    blendDsc.blend_mode = dsc.blend_mode;
+    blendDsc.mask_buf = stripMask;
+    blendDsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+
+    uint32_t stride = (entry->width + 1) / 2;
+    for (lv_coord_t y1 = drawArea.y1; y1 <= drawArea.y2; y1 += QUOTE_BITMAP_STRIP_ROWS) {
+        lv_area_t strip = drawArea;
+        strip.y1 = y1;
+        strip.y2 = LV_MIN(drawArea.y2, y1 + QUOTE_BITMAP_STRIP_ROWS - 1);
+        // 把这几行的4位Alpha展开为8位蒙版
+        lv_opa_t* maskOut = stripMask;
+        for (lv_coord_t y = strip.y1; y <= strip.y2; y++) {
+            const uint8_t* row = entry->data + (uint32_t)(y - bitmapArea.y1) * stride;
+            for (lv_coord_t x = drawArea.x1 - bitmapArea.x1; x <= drawArea.x2 - bitmapArea.x1; x++) {
+                uint8_t a4 = (x & 1) ? (row[x >> 1] & 0x0F) : (row[x >> 1] >> 4);
+                *maskOut++ = a4 * 17;
+            }
+        }
+        blendDsc.blend_area = &strip;
+        blendDsc.mask_area = &strip;
+        lv_draw_sw_blend(drawCtx, &blendDsc);
+    }
+    entry->blitMicros += micros() - startTime;
+}
+//*** 生成统计JSON
+String QuoteBitmapCache::getStatsJson() {
+    JsonDocument doc;
+    uint64_t textMicros = 0;
+    uint64_t blitMicros = 0;
+    uint32_t shows = 0;
+    int64_t saved = retiredSavedMicros - (int64_t)renderMicros;
+    JsonArray items = doc["entries"].to<JsonArray>();
+    uint32_t cached = 0;
+    for (int i = 0; i < QUOTE_BITMAP_MAX_ENTRIES; i++) {
+        const BitmapEntry& entry = entries[i];
+        if (entry.quote == nullptr) {
+            continue;
+        }
+        cached++;
+        JsonObject item = items.add<JsonObject>();
+        item["width"] = entry.width;
+        item["height"] = entry.height;
+        item["bytes"] = ((entry.width + 1) / 2) * entry.height;
+        item["shows"] = entry.shows;
+        item["text_us"] = entry.textMicros;
+        item["blit_us_avg"] = entry.shows > 0 ? (uint32_t)(entry.blitMicros / entry.shows) : 0;
+        item["in_use"] = entry.refCount > 0;
+        textMicros += entry.textMicros;
+        blitMicros += entry.blitMicros;
+        shows += entry.shows;
+        saved += savedMicros(entry);
+    }
+    int corpusTotal = 0;
+    for (int i = 0; i < QUOTE_BITMAP_MAX_CORPORA; i++) {
+        corpusTotal += corpusSizes[i];
+    }
+    doc["cached"] = cached;
+    doc["psram_bytes"] = totalBytes;
+    doc["budget_bytes"] = QUOTE_BITMAP_CACHE_BUDGET;
+    doc["hits"] = hits;
+    doc["misses"] = misses;
+    doc["failures"] = renderFailures;
+    doc["render_us"] = renderMicros;
+    // 每次显示：不使用位图时的文本光栅化耗时与使用位图时的混合耗时
+    doc["text_us_avg"] = cached > 0 ? (uint32_t)(textMicros / cached) : 0;
+    doc["blit_us_avg"] = shows > 0 ? (uint32_t)(blitMicros / shows) : 0;
+    doc["saved_us"] = saved;
+    // 按已缓存语录的平均大小估算全部语录预渲染后需要的存储空间
+    doc["corpus_quotes"] = corpusTotal;
+    doc["corpus_bytes_estimate"] = cached > 0 ? (uint64_t)totalBytes * corpusTotal / cached : 0;
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
@@ -0,0 +1,110 @@
+#ifndef QUOTE_BITMAP_CACHE_H
+#define QUOTE_BITMAP_CACHE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// 位图缓存的PSRAM预算（字节），超出时按最近最少使用顺序释放
+const size_t QUOTE_BITMAP_CACHE_BUDGET = 1024 * 1024;
+// 最多缓存的语录条数
+const int QUOTE_BITMAP_MAX_ENTRIES = 96;
+// 可同时绑定位图的语录标签数量
+const int QUOTE_BITMAP_MAX_LABELS = 4;
+// 位图最大宽度（屏幕长边）和绘制时每次混合的行数
+const lv_coord_t QUOTE_BITMAP_MAX_WIDTH = 480;
+const int QUOTE_BITMAP_STRIP_ROWS = 10;
+// 登记的语录库数量（用于估算全部语录预渲染后的存储空间）
+const int QUOTE_BITMAP_MAX_CORPORA = 4;
+
+/**
+ * 语录文本位图缓存类
+ * 语录首次显示时，按标签的字体、宽度和对齐方式把整段文本渲染为4位Alpha位图保存在PSRAM中，
+ * 之后再显示同一条语录时，标签不再逐字光栅化CJK字形，而是在绘制事件中用文本颜色对位图做一次混合
+ */
+class QuoteBitmapCache {
+private:
+    static QuoteBitmapCache* instance; // 单例实例
+
+    // 缓存条目
+    struct BitmapEntry {
+        const char* quote;        // 语录字符串指针（为空表示空闲条目）
+        uint8_t* data;            // 4位Alpha位图（每字节两个像素，高4位在前）
+        lv_coord_t width;         // 位图宽度
+        lv_coord_t height;        // 位图高度（已裁掉底部空白）
+        lv_coord_t textHeight;    // 文本排版高度（用于标签自身尺寸）
+        const lv_font_t* font;    // 渲染时使用的字体
+        uint32_t lastUsed;        // 最近使用序号
+        uint16_t refCount;        // 正在显示该位图的标签数量
+        uint32_t textMicros;      // 渲染时逐字光栅化文本的耗时（微秒）
+        uint32_t shows;           // 显示次数
+        uint64_t blitMicros;      // 所有显示中混合位图的总耗时（微秒）
+    };
+
+    // 标签与正在显示的位图的绑定
+    struct LabelBinding {
+        lv_obj_t* label;
+        const char* quote;
+        BitmapEntry* entry;
+    };
+
+    // 固定大小的条目表：Web任务读取统计时不会遇到正在重新分配的容器
+    BitmapEntry entries[QUOTE_BITMAP_MAX_ENTRIES];
+    LabelBinding bindings[QUOTE_BITMAP_MAX_LABELS];
+    size_t totalBytes;            // 位图占用的总字节数
+    uint32_t useCounter;          // 使用序号计数器
+    uint32_t hits;                // 命中次数
+    uint32_t misses;              // 未命中（需要渲染）次数
+    uint32_t renderFailures;      // 渲染失败次数（回退为普通文本）
+    uint64_t renderMicros;        // 所有渲染（包括光栅化、压缩）的总耗时（微秒）
+    int64_t retiredSavedMicros;   // 已释放条目累计节省的耗时（微秒）
+    const char** corpora[QUOTE_BITMAP_MAX_CORPORA]; // 已登记的语录库
+    int corpusSizes[QUOTE_BITMAP_MAX_CORPORA];
+
+    // 私有构造函数（单例模式）
+    QuoteBitmapCache();
+
+    // 把语录渲染为位图
+    bool render(lv_obj_t* label, const char* quote, BitmapEntry& entry);
+
+    // 查找或创建标签绑定
+    LabelBinding* findBinding(lv_obj_t* label, bool create);
+
+    // 释放绑定中的位图引用
+    void unbind(LabelBinding* binding);
+
+    // 查找语录对应的条目
+    BitmapEntry* findEntry(const char* quote);
+
+    // 释放一个缓存条目
+    void eraseEntry(BitmapEntry* entry);
+
+    // 释放最久未使用且未显示的条目，没有可释放的条目时返回false
+    bool evictOldest();
+
+    // 超出预算时释放未显示的位图
+    void enforceBudget();
+
+    // 条目节省的耗时：每次显示省去的文本光栅化耗时减去混合耗时（渲染开销另计）
+    static int64_t savedMicros(const BitmapEntry& entry);
+
+    // 标签事件：绘制位图、调整自身尺寸、标签删除时解除绑定
+    static void labelEventCallback(lv_event_t* e);
+
+public:
+    // 获取单例实例
+    static QuoteBitmapCache* getInstance();
+
+    // 登记语录库（只用于统计全部语录预渲染所需的存储空间）
+    void registerCorpus(const char** quotes, int count);
+
+    // 以位图方式在标签中显示语录，失败时返回false（调用方回退为普通文本）
+    bool show(lv_obj_t* label, const char* quote);
+
+    // 解除标签的位图显示（标签改为显示普通文本前调用）
+    void release(lv_obj_t* label);
+
+    // 生成统计JSON：位图占用的存储空间与每次显示节省的渲染时间
+    String getStatsJson();
+};
+
+#endif // QUOTE_BITMAP_CACHE_H
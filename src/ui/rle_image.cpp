@@ -0,0 +1,259 @@
+#include "rle_image.h"
+#include <string.h>
+#ifdef ARDUINO
+#include <ArduinoJson.h>
+#endif
+
+// 统计表
+RleImageStats RleImage::stats[RLE_IMAGE_MAX_STATS];
+int RleImage::statsCount = 0;
+
+// 打开的图像的状态
+struct RleOpenState {
+    RleImageStats* stats;
+    unsigned long openTime;
+};
+
+// 按字节读取小端整数（压缩数据不保证4字节对齐，Flash中的非对齐32位读取会异常）
+static inline uint16_t readU16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+static inline uint32_t readU32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+//*** 注册解码器
+void RleImage::init() {
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+    lv_img_decoder_t* decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, infoCallback);
+    lv_img_decoder_set_open_cb(decoder, openCallback);
+    lv_img_decoder_set_read_line_cb(decoder, readLineCallback);
+    lv_img_decoder_set_close_cb(decoder, closeCallback);
+    Serial.println("压缩图像解码器已注册");
+#else
+    Serial.println("压缩图像只支持RGB565（LV_COLOR_16_SWAP = 0），解码器未注册");
+#endif
+}
+//*** 检查是否为压缩图像
+bool RleImage::isRleImage(const void* src) {
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) {
+        return false;
+    }
+    const lv_img_dsc_t* dsc = (const lv_img_dsc_t*)src;
+    if (dsc->header.cf != RLE_IMAGE_CF || dsc->data == nullptr) {
+        return false;
+    }
+    if (dsc->data_size < RLE_IMAGE_HEADER_SIZE + dsc->header.h * 4) {
+        return false;
+    }
+    const uint8_t* data = dsc->data;
+    return data[0] == 'R' && data[1] == 'L' && data[2] == 'E' && data[3] == '6' &&
+           readU16(data + 4) == dsc->header.w && readU16(data + 6) == dsc->header.h;
+}
+//*** 查找图像的统计项
+RleImageStats* RleImage::findStats(const uint8_t* data) {
+    for (int i = 0; i < statsCount; i++) {
+        if (stats[i].data == data) {
+            return &stats[i];
+        }
+    }
+    if (statsCount >= RLE_IMAGE_MAX_STATS) {
+        return nullptr;
+    }
+    RleImageStats* item = &stats[statsCount++];
+    memset(item, 0, sizeof(RleImageStats));
+    item->data = data;
+    memcpy(item->name, data + 8, RLE_IMAGE_NAME_SIZE);
+    item->name[RLE_IMAGE_NAME_SIZE - 1] = '\0';
+    return item;
+}
+//*** 读取图像信息
+lv_res_t RleImage::infoCallback(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header) {
+    LV_UNUSED(decoder);
+    if (!isRleImage(src)) {
+        return LV_RES_INV;
+    }
+    const lv_img_dsc_t* dsc = (const lv_img_dsc_t*)src;
+    header->cf = LV_IMG_CF_TRUE_COLOR;
+    header->always_zero = 0;
+    header->w = dsc->header.w;
+    header->h = dsc->header.h;
+    return LV_RES_OK;
+}
+//*** 打开图像
+lv_res_t RleImage::openCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    if (!isRleImage(dsc->src)) {
+        return LV_RES_INV;
+    }
+    const lv_img_dsc_t* img = (const lv_img_dsc_t*)dsc->src;
+    RleOpenState* state = (RleOpenState*)lv_mem_alloc(sizeof(RleOpenState));
+    if (state == nullptr) {
+        return LV_RES_INV;
+    }
+    state->stats = findStats(img->data);
+    state->openTime = micros();
+    if (state->stats != nullptr) {
+        state->stats->width = img->header.w;
+        state->stats->height = img->header.h;
+        state->stats->compressedBytes = img->data_size;
+        state->stats->draws++;
+    }
+    dsc->user_data = state;
+    // 不提供整幅图像，LVGL逐行调用readLineCallback
+    dsc->img_data = nullptr;
+    return LV_RES_OK;
+}
+//*** 解压一行
+lv_res_t RleImage::readLineCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                    lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf) {
+    LV_UNUSED(decoder);
+    const lv_img_dsc_t* img = (const lv_img_dsc_t*)dsc->src;
+    RleOpenState* state = (RleOpenState*)dsc->user_data;
+    unsigned long startTime = micros();
+    if (!decodeLine(img->data, x, y, len, (lv_color_t*)buf)) {
+        return LV_RES_INV;
+    }
+    if (state != nullptr && state->stats != nullptr) {
+        state->stats->decodeMicros += micros() - startTime;
+        state->stats->lines++;
+        state->stats->pixels += len;
+    }
+    return LV_RES_OK;
+}
+//*** 关闭图像
+void RleImage::closeCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    RleOpenState* state = (RleOpenState*)dsc->user_data;
+    if (state == nullptr) {
+        return;
+    }
+    if (state->stats != nullptr) {
+        state->stats->blitMicros += micros() - state->openTime;
+    }
+    lv_mem_free(state);
+    dsc->user_data = nullptr;
+}
+//*** 解压一行中从x开始的len个像素
+bool RleImage::decodeLine(const uint8_t* data, lv_coord_t x, lv_coord_t y, lv_coord_t len, lv_color_t* out) {
+    uint16_t width = readU16(data + 4);
+    uint16_t height = readU16(data + 6);
+    if (y < 0 || y >= height || x < 0 || len <= 0 || x + len > width) {
+        return false;
+    }
+    const uint8_t* p = data + readU32(data + RLE_IMAGE_HEADER_SIZE + y * 4);
+    // 跳过x之前的段
+    lv_coord_t skip = x;
+    while (len > 0) {
+        uint8_t control = *p++;
+        lv_coord_t count = (control & 0x7F) + 1;
+        bool repeat = control & 0x80;
+        if (skip >= count) {
+            skip -= count;
+            p += repeat ? 2 : count * 2;
+            continue;
+        }
+        lv_coord_t n = LV_MIN(count - skip, len);
+        if (repeat) {
+            lv_color_t color;
+            color.full = readU16(p);
+            lv_color_fill(out, color, n);
+            p += 2;
+        } else {
+            // RGB565原样段与lv_color_t的内存布局相同
+            memcpy(out, p + skip * 2, n * 2);
+            p += count * 2;
+        }
+        out += n;
+        len -= n;
+        skip = 0;
+    }
+    return true;
+}
+//*** 按行游程编码RGB565像素
+size_t RleImage::encode(const lv_color_t* pixels, uint16_t width, uint16_t height, const char* name,
+                        uint8_t* out, size_t capacity) {
+    const int maxSegment = 128;
+    size_t pos = RLE_IMAGE_HEADER_SIZE + height * 4;
+    if (pos > capacity) {
+        return 0;
+    }
+    memset(out, 0, RLE_IMAGE_HEADER_SIZE);
+    memcpy(out, "RLE6", 4);
+    out[4] = width & 0xFF;
+    out[5] = width >> 8;
+    out[6] = height & 0xFF;
+    out[7] = height >> 8;
+    strncpy((char*)out + 8, name, RLE_IMAGE_NAME_SIZE - 1);
+    for (uint16_t y = 0; y < height; y++) {
+        const lv_color_t* row = pixels + y * width;
+        uint8_t* offset = out + RLE_IMAGE_HEADER_SIZE + y * 4;
+        for (int i = 0; i < 4; i++) {
+            offset[i] = (pos >> (i * 8)) & 0xFF;
+        }
+        int i = 0;
+        while (i < width) {
+            // 重复段：至少2个相同像素
+            int j = i + 1;
+            while (j < width && row[j].full == row[i].full && j - i < maxSegment) {
+                j++;
+            }
+            if (j - i >= 2) {
+                if (pos + 3 > capacity) {
+                    return 0;
+                }
+                out[pos++] = 0x80 | (j - i - 1);
+                out[pos++] = row[i].full & 0xFF;
+                out[pos++] = row[i].full >> 8;
+                i = j;
+                continue;
+            }
+            // 原样段：直到出现两个相同的相邻像素，重复段的第一个像素留给下一个重复段
+            j = i + 1;
+            while (j < width && j - i < maxSegment && row[j].full != row[j - 1].full) {
+                j++;
+            }
+            if (j < width && row[j].full == row[j - 1].full && j - 1 > i) {
+                j--;
+            }
+            if (pos + 1 + (j - i) * 2 > capacity) {
+                return 0;
+            }
+            out[pos++] = j - i - 1;
+            memcpy(out + pos, row + i, (j - i) * 2);
+            pos += (j - i) * 2;
+            i = j;
+        }
+    }
+    return pos;
+}
+#ifdef ARDUINO
+//*** 生成统计JSON
+String RleImage::getStatsJson() {
+    JsonDocument doc;
+    JsonArray images = doc["images"].to<JsonArray>();
+    for (int i = 0; i < statsCount; i++) {
+        const RleImageStats& item = stats[i];
+        uint32_t rawBytes = item.width * item.height * 2;
+        JsonObject image = images.add<JsonObject>();
+        image["name"] = item.name;
+        image["width"] = item.width;
+        image["height"] = item.height;
+        image["raw_bytes"] = rawBytes;
+        image["compressed_bytes"] = item.compressedBytes;
+        image["ratio"] = item.compressedBytes > 0 ? (float)rawBytes / item.compressedBytes : 0;
+        image["draws"] = item.draws;
+        image["lines"] = item.lines;
+        image["pixels"] = item.pixels;
+        image["decode_us"] = item.decodeMicros;
+        image["blit_us"] = item.blitMicros;
+        // 吞吐量：每秒百万像素
+        image["decode_mpix_s"] = item.decodeMicros > 0 ? (float)item.pixels / item.decodeMicros : 0;
+        image["blit_mpix_s"] = item.blitMicros > 0 ? (float)item.pixels / item.blitMicros : 0;
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+#endif
@@ -0,0 +1,70 @@
+#ifndef RLE_IMAGE_H
+#define RLE_IMAGE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// 压缩图像使用的颜色格式（tools/image_converter.py生成）
+#define RLE_IMAGE_CF LV_IMG_CF_USER_ENCODED_0
+// 压缩数据的头部：魔数、宽高和名称，之后是每行的偏移表
+const uint32_t RLE_IMAGE_HEADER_SIZE = 24;
+const int RLE_IMAGE_NAME_SIZE = 16;
+// 统计表大小（编译进固件的压缩图像数）
+const int RLE_IMAGE_MAX_STATS = 8;
+
+// 单幅压缩图像的统计
+struct RleImageStats {
+    const uint8_t* data;         // 压缩数据（标识图像）
+    char name[RLE_IMAGE_NAME_SIZE];
+    uint16_t width;
+    uint16_t height;
+    uint32_t compressedBytes;    // 压缩数据大小
+    uint32_t draws;              // 绘制次数（每次打开解码器）
+    uint32_t lines;              // 解压的行数
+    uint64_t pixels;             // 解压的像素数
+    uint64_t decodeMicros;       // 解压累计耗时
+    uint64_t blitMicros;         // 从打开到关闭的累计耗时（解压加混合到绘制缓冲区）
+};
+
+/**
+ * 按行游程编码的图像解码器类
+ * 背景图像以每行独立编码的RGB565游程数据编译进固件（约为原始数据的一半），
+ * 绘制时LVGL逐行调用解码器，只解压可见区域所在的行，直接写入绘制用的行缓冲区，不需要整幅图像的内存；
+ * 每幅图像的压缩率、解压和绘制吞吐量计入统计
+ */
+class RleImage {
+private:
+    static RleImageStats stats[RLE_IMAGE_MAX_STATS]; // 统计表
+    static int statsCount;
+
+    // 检查是否为压缩图像
+    static bool isRleImage(const void* src);
+
+    // 查找（或新建）图像的统计项
+    static RleImageStats* findStats(const uint8_t* data);
+
+    // LVGL解码器回调
+    static lv_res_t infoCallback(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header);
+    static lv_res_t openCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+    static lv_res_t readLineCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                     lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf);
+    static void closeCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+
+public:
+    // 注册解码器（须在lv_init之后调用）
+    static void init();
+
+    // 解压一行中从x开始的len个像素，成功返回true
+    static bool decodeLine(const uint8_t* data, lv_coord_t x, lv_coord_t y, lv_coord_t len, lv_color_t* out);
+
+    // 按行游程编码RGB565像素（与tools/image_converter.py的格式相同），返回编码后的字节数，超出capacity时返回0
+    static size_t encode(const lv_color_t* pixels, uint16_t width, uint16_t height, const char* name,
+                         uint8_t* out, size_t capacity);
+
+#ifdef ARDUINO
+    // 生成统计JSON：每幅图像的压缩率、解压和绘制吞吐量
+    static String getStatsJson();
+#endif
+};
+
+#endif // RLE_IMAGE_H
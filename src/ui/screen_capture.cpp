@@ -0,0 +1,194 @@
+#include "screen_capture.h"
+#include <esp_heap_caps.h>
+
+// 定义单例实例
+ScreenCapture* ScreenCapture::instance = nullptr;
+
+//*** 按小端序写入整数
+static void putLe16(uint8_t* p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+static void putLe32(uint8_t* p, uint32_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = v >> 24;
+}
+
+//*** 私有构造函数
+ScreenCapture::ScreenCapture() {
+    stripeReady = nullptr;
+    stripeSent = nullptr;
+    requested = false;
+    active = false;
+    aborted = false;
+    finished = false;
+    stripeCopy = nullptr;
+    stripeCapacity = 0;
+    stripeRows = 0;
+    nextRow = 0;
+    width = 0;
+    height = 0;
+}
+//*** 获取单例实例
+ScreenCapture* ScreenCapture::getInstance() {
+    if (instance == nullptr) {
+        instance = new ScreenCapture();
+    }
+    return instance;
+}
+//*** 创建同步信号量
+void ScreenCapture::init() {
+    if (stripeReady == nullptr) {
+        stripeReady = xSemaphoreCreateBinary();
+        stripeSent = xSemaphoreCreateBinary();
+    }
+}
+//*** 生成BMP文件头
+void ScreenCapture::buildBmpHeader(uint8_t* header) {
+    uint32_t imageBytes = (uint32_t)width * height * sizeof(lv_color_t);
+    memset(header, 0, SCREEN_CAPTURE_BMP_HEADER_SIZE);
+    // 文件头
+    header[0] = 'B';
+    header[1] = 'M';
+    putLe32(header + 2, SCREEN_CAPTURE_BMP_HEADER_SIZE + imageBytes);
+    putLe32(header + 10, SCREEN_CAPTURE_BMP_HEADER_SIZE);
+    // 信息头：高度取负值表示自上而下存储，与LVGL的刷新顺序一致
+    putLe32(header + 14, 40);
+    putLe32(header + 18, width);
+    putLe32(header + 22, (uint32_t)(-(int32_t)height));
+    putLe16(header + 26, 1);
+    putLe16(header + 28, 16);
+    putLe32(header + 30, 3);  // BI_BITFIELDS
+    putLe32(header + 34, imageBytes);
+    putLe32(header + 38, 2835);
+    putLe32(header + 42, 2835);
+    // RGB565位掩码（LV_COLOR_16_SWAP为0时缓冲区即为小端RGB565）
+    putLe32(header + 54, 0xF800);
+    putLe32(header + 58, 0x07E0);
+    putLe32(header + 62, 0x001F);
+}
+//*** 请求截图并发送BMP
+bool ScreenCapture::stream(WebServer& server) {
+    if (stripeReady == nullptr || requested || active) {
+        return false;
+    }
+    // 清除上次中止的截图可能残留的信号，副本开始时可以写入
+    xSemaphoreTake(stripeReady, 0);
+    xSemaphoreTake(stripeSent, 0);
+    xSemaphoreGive(stripeSent);
+    aborted = false;
+    finished = false;
+    requested = true;
+    // 等待显示任务交付第一条带，超时则还未发送任何响应，可由调用方返回错误
+    if (xSemaphoreTake(stripeReady, pdMS_TO_TICKS(SCREEN_CAPTURE_TIMEOUT)) != pdTRUE || finished) {
+        requested = false;
+        aborted = true;
+        return false;
+    }
+
+    unsigned long startTime = millis();
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "image/bmp", "");
+    uint8_t header[SCREEN_CAPTURE_BMP_HEADER_SIZE];
+    buildBmpHeader(header);
+    server.sendContent((const char*)header, sizeof(header));
+
+    size_t sentBytes = sizeof(header);
+    while (true) {
+        // 每行字节数（宽度 x 2）在宽度为偶数时已是4的倍数，条带可以直接作为BMP的像素行发送
+        size_t bytes = (size_t)stripeRows * width * sizeof(lv_color_t);
+        server.sendContent((const char*)stripeCopy, bytes);
+        sentBytes += bytes;
+        if (!server.client().connected()) {
+            aborted = true;
+        }
+        // 副本已发送，显示任务可以写入下一条带
+        xSemaphoreGive(stripeSent);
+        if (aborted) {
+            break;
+        }
+        if (xSemaphoreTake(stripeReady, pdMS_TO_TICKS(SCREEN_CAPTURE_TIMEOUT)) != pdTRUE) {
+            aborted = true;
+            break;
+        }
+        if (finished) {
+            break;
+        }
+    }
+    // 结束分块传输
+    server.sendContent("");
+    Serial.printf("截图已发送: %u 字节，耗时 %lu ms%s\n", (unsigned)sentBytes, millis() - startTime,
+                  aborted ? "（已中止）" : "");
+    return true;
+}
+//*** 执行已请求的截图
+void ScreenCapture::runPending() {
+    if (!requested) {
+        return;
+    }
+    requested = false;
+    lv_disp_t* disp = lv_disp_get_default();
+    width = lv_disp_get_hor_res(disp);
+    height = lv_disp_get_ver_res(disp);
+    nextRow = 0;
+    stripeRows = 0;
+    finished = false;
+    // 条带副本与绘制缓冲区一样大，第一次截图时分配
+    if (stripeCopy == nullptr) {
+        uint32_t pixels = disp->driver->draw_buf->size;
+        stripeCopy = (lv_color_t*)heap_caps_malloc(pixels * sizeof(lv_color_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        stripeCapacity = stripeCopy != nullptr ? pixels : 0;
+    }
+    if (stripeCopy == nullptr) {
+        Serial.println("截图中止: 无法分配条带副本");
+        aborted = true;
+    } else {
+        active = true;
+        // 整屏标记为需要重绘并立即刷新，LVGL按绘制缓冲区大小自上而下逐条带渲染
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(disp);
+        active = false;
+    }
+    if (!aborted && nextRow != height) {
+        Serial.printf("截图不完整: 只刷新了 %d/%d 行\n", nextRow, height);
+    }
+    // 等待最后一条带发送完毕后再通知Web任务刷新已结束，以免Web任务在发送最后一条带之前就看到结束标志
+    if (!aborted && xSemaphoreTake(stripeSent, pdMS_TO_TICKS(SCREEN_CAPTURE_TIMEOUT)) != pdTRUE) {
+        Serial.println("截图中止: 等待发送超时");
+        aborted = true;
+    }
+    finished = true;
+    xSemaphoreGive(stripeReady);
+}
+//*** 刷新回调中交付条带
+void ScreenCapture::onFlush(const lv_area_t* area, const lv_color_t* pixels) {
+    if (aborted) {
+        return;
+    }
+    // 整屏刷新时每条带都应占满整行并紧接上一条带
+    if (area->x1 != 0 || area->x2 != width - 1 || area->y1 != nextRow) {
+        Serial.println("截图中止: 刷新区域不是连续的整行条带");
+        aborted = true;
+        return;
+    }
+    lv_coord_t rows = area->y2 - area->y1 + 1;
+    if ((uint32_t)rows * width > stripeCapacity) {
+        Serial.println("截图中止: 条带大于副本");
+        aborted = true;
+        return;
+    }
+    // 等待Web任务发送完上一条带的副本（发送与本条带的渲染同时进行，通常无需等待）
+    if (xSemaphoreTake(stripeSent, pdMS_TO_TICKS(SCREEN_CAPTURE_TIMEOUT)) != pdTRUE) {
+        Serial.println("截图中止: 等待发送超时");
+        aborted = true;
+        return;
+    }
+    // 复制后立即返回，LVGL可以继续使用绘制缓冲区，Web任务只读取副本
+    memcpy(stripeCopy, pixels, (size_t)rows * width * sizeof(lv_color_t));
+    stripeRows = rows;
+    nextRow += rows;
+    xSemaphoreGive(stripeReady);
+}
@@ -0,0 +1,65 @@
+#ifndef SCREEN_CAPTURE_H
+#define SCREEN_CAPTURE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <WebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// 等待显示任务开始截图或交付下一条带的超时时间（毫秒）
+const uint32_t SCREEN_CAPTURE_TIMEOUT = 3000;
+// BMP文件头长度：文件头14字节 + 信息头40字节 + RGB565位掩码12字节
+const size_t SCREEN_CAPTURE_BMP_HEADER_SIZE = 66;
+
+/**
+ * 屏幕截图类
+ * Web任务发起截图请求后，显示任务将当前屏幕整体标记为需要重绘并立即刷新，
+ * LVGL按绘制缓冲区的大小逐条带渲染，刷新回调把每条带复制到一条带大小的副本中交给Web任务以分块传输发送，
+ * 复制后立即返回，LVGL渲染下一条带的同时Web任务发送副本。
+ * 绘制缓冲区中的RGB565像素与BMP的位域格式一致，副本直接作为像素行发送，不额外分配整帧内存
+ */
+class ScreenCapture {
+private:
+    static ScreenCapture* instance; // 单例实例
+
+    SemaphoreHandle_t stripeReady;   // 显示任务：副本中已有一条带可供发送（或刷新已结束）
+    SemaphoreHandle_t stripeSent;    // Web任务：副本已发送完毕，可以写入下一条带
+    volatile bool requested;         // Web任务已请求截图
+    volatile bool active;            // 显示任务正在截图刷新
+    volatile bool aborted;           // 截图已中止（超时或客户端断开）
+    volatile bool finished;          // 刷新已结束
+    lv_color_t* stripeCopy;          // 条带副本（第一次截图时按绘制缓冲区大小分配，之后保留）
+    uint32_t stripeCapacity;         // 副本能容纳的像素数
+    lv_coord_t stripeRows;           // 副本中条带的行数
+    lv_coord_t nextRow;              // 下一条带应从哪一行开始
+    lv_coord_t width;                // 截图宽度
+    lv_coord_t height;               // 截图高度
+
+    // 私有构造函数（单例模式）
+    ScreenCapture();
+
+    // 生成BMP文件头（自上而下的16位RGB565位图）
+    void buildBmpHeader(uint8_t* header);
+
+public:
+    // 获取单例实例
+    static ScreenCapture* getInstance();
+
+    // 创建同步信号量（在启动显示和Web任务之前调用）
+    void init();
+
+    // 在Web任务中调用：请求截图并以分块传输发送BMP，显示任务未响应时返回false
+    bool stream(WebServer& server);
+
+    // 在显示任务中调用：执行已请求的截图
+    void runPending();
+
+    // 在刷新回调中调用：截图期间把条带复制到副本交给Web任务发送，复制后即返回
+    void onFlush(const lv_area_t* area, const lv_color_t* pixels);
+
+    // 是否正在截图（刷新回调中的快速判断）
+    bool isActive() { return active; }
+};
+
+#endif // SCREEN_CAPTURE_H
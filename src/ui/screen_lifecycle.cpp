@@ -0,0 +1,290 @@
+#include "screen_lifecycle.h"
+#include "init_ui.h"
+#include "layout_engine.h"
+#include "config/config_manager.h"
+#include <ArduinoJson.h>
+#include <esp_heap_caps.h>
+
+// 定义单例实例
+ScreenLifecycle* ScreenLifecycle::instance = nullptr;
+
+// 各屏幕拥有的元素及创建函数
+const ScreenLifecycle::ScreenResourceDef ScreenLifecycle::resourceDefs[SCREEN_COUNT] = {
+    {NEWS_SCREEN,       "news",       buildNewsScreen,       {&news_label}},
+    {CALENDAR_SCREEN,   "calendar",   buildCalendarScreen,   {&calendar_label, &today_date_label, &calendar_img}},
+    {MAO_SELECT_SCREEN, "maoselect",  buildMaoSelectScreen,  {&mao_select_label, &maoselect_img}},
+    {TOXIC_SOUL_SCREEN, "toxicsoul",  buildToxicSoulScreen,  {&toxic_soul_label, &toxic_soul_img}},
+    {ICIBA_SCREEN,      "iciba",      buildIcibaScreen,      {&iciba_label, &iciba_img}},
+    {ASTRONAUTS_SCREEN, "astronauts", buildAstronautsScreen, {&astronauts_label, &astronauts_img}},
+    {SOUL_SCREEN,       "soul",       buildSoulScreen,       {&soul_label, &soul_img}},
+    {NOTE_SCREEN,       "note",       buildNoteScreen,       {&note_label}},
+};
+
+//*** 私有构造函数
+ScreenLifecycle::ScreenLifecycle() {
+    memset(states, 0, sizeof(states));
+    useCounter = 0;
+    heapBudget = DEFAULT_SCREEN_HEAP_BUDGET;
+    activeScreen = NEWS_SCREEN;
+    preparedScreen = NEWS_SCREEN;
+    benchmarkRequested = false;
+}
+//*** 获取单例实例
+ScreenLifecycle* ScreenLifecycle::getInstance() {
+    if (instance == nullptr) {
+        instance = new ScreenLifecycle();
+    }
+    return instance;
+}
+//*** 初始化（读取配置中的内存预算）
+void ScreenLifecycle::init() {
+    ConfigManager* configManager = ConfigManager::getInstance();
+    heapBudget = configManager->getScreenHeapBudget(DEFAULT_SCREEN_HEAP_BUDGET);
+    Serial.printf("屏幕对象内存预算: %u 字节\n", heapBudget);
+}
+//*** 查找屏幕资源定义
+const ScreenLifecycle::ScreenResourceDef* ScreenLifecycle::findDef(ScreenState screen) {
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        if (resourceDefs[i].screen == screen) {
+            return &resourceDefs[i];
+        }
+    }
+    return nullptr;
+}
+//*** 递归统计对象数量
+uint16_t ScreenLifecycle::countObjects(lv_obj_t* obj) {
+    uint16_t count = 1;
+    uint32_t childCount = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < childCount; i++) {
+        count += countObjects(lv_obj_get_child(obj, i));
+    }
+    return count;
+}
+//*** 调用布局字节码或内置创建函数创建元素
+bool ScreenLifecycle::buildObjects(const ScreenResourceDef* def) {
+    if (LayoutEngine::getInstance()->buildScreen(def->screen)) {
+        return true;
+    }
+    def->build();
+    return false;
+}
+//*** 确保指定屏幕的元素已创建
+void ScreenLifecycle::ensureBuilt(ScreenState screen) {
+    // 网页上传了新布局时，释放未显示的屏幕，使其下次按新布局创建
+    if (LayoutEngine::getInstance()->applyPendingReload()) {
+        evictInactive();
+    }
+    const ScreenResourceDef* def = findDef(screen);
+    if (def == nullptr) {
+        return;
+    }
+    ScreenResourceState& state = states[screen];
+    state.lastUsed = ++useCounter;
+    if (state.built) {
+        return;
+    }
+    // 通过创建前后的空闲堆内存差值测量该屏幕元素的内存占用
+    size_t freeBefore = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    unsigned long startMicros = micros();
+    state.fromLayout = buildObjects(def);
+    unsigned long buildTime = micros() - startMicros;
+    size_t freeAfter = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    state.built = true;
+    state.objectBytes = freeBefore > freeAfter ? freeBefore - freeAfter : 0;
+    state.buildCount++;
+    state.buildMicros = buildTime;
+    refreshStats(screen);
+    Serial.printf("创建屏幕元素: %s，对象数: %u，内存: %u 字节，耗时: %lu us（%s）\n",
+                  def->name, state.objectCount, state.objectBytes, buildTime,
+                  state.fromLayout ? "布局字节码" : "内置布局");
+    enforceBudget();
+    printStats();
+}
+//*** 进入屏幕
+void ScreenLifecycle::enterScreen(ScreenState screen) {
+    activeScreen = screen;
+    ensureBuilt(screen);
+}
+//*** 标记预先准备的下一个屏幕
+void ScreenLifecycle::setPreparedScreen(ScreenState screen) {
+    preparedScreen = screen;
+    ensureBuilt(screen);
+}
+//*** 更新指定屏幕的对象数量和文本内存统计
+void ScreenLifecycle::refreshStats(ScreenState screen) {
+    const ScreenResourceDef* def = findDef(screen);
+    if (def == nullptr) {
+        return;
+    }
+    ScreenResourceState& state = states[screen];
+    uint16_t objectCount = 0;
+    uint32_t textBytes = 0;
+    for (int i = 0; i < MAX_SCREEN_OBJECTS && def->objects[i]; i++) {
+        lv_obj_t* obj = *def->objects[i];
+        if (obj && lv_obj_is_valid(obj)) {
+            objectCount += countObjects(obj);
+            // 静态文本（如语录）直接引用常量字符串，不占用堆内存
+            if (lv_obj_check_type(obj, &lv_label_class) && !((lv_label_t*)obj)->static_txt) {
+                textBytes += strlen(lv_label_get_text(obj)) + 1;
+            }
+        }
+    }
+    state.objectCount = objectCount;
+    state.textBytes = textBytes;
+}
+//*** 删除屏幕资源定义中的所有对象
+void ScreenLifecycle::releaseObjects(const ScreenResourceDef* def) {
+    for (int i = 0; i < MAX_SCREEN_OBJECTS && def->objects[i]; i++) {
+        lv_obj_t*& obj = *def->objects[i];
+        if (obj && lv_obj_is_valid(obj)) {
+            lv_obj_del(obj);
+        }
+        // 全局指针置空，其他模块通过空指针检查即可感知元素已释放
+        obj = nullptr;
+    }
+}
+//*** 释放指定屏幕的元素
+void ScreenLifecycle::evict(ScreenState screen) {
+    const ScreenResourceDef* def = findDef(screen);
+    if (def == nullptr) {
+        return;
+    }
+    releaseObjects(def);
+    ScreenResourceState& state = states[screen];
+    Serial.printf("释放屏幕元素: %s，回收约 %u 字节\n", def->name, state.objectBytes + state.textBytes);
+    state.built = false;
+    state.objectBytes = 0;
+    state.textBytes = 0;
+    state.objectCount = 0;
+    state.evictCount++;
+}
+//*** 释放除当前屏幕和预先准备屏幕以外的所有屏幕
+void ScreenLifecycle::evictInactive() {
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        ScreenState screen = resourceDefs[i].screen;
+        if (states[screen].built && screen != activeScreen && screen != preparedScreen) {
+            evict(screen);
+        }
+    }
+}
+//*** 超出预算时按LRU顺序释放屏幕元素
+void ScreenLifecycle::enforceBudget() {
+    while (getTotalBytes() > heapBudget) {
+        // 查找最久未使用且不在显示或预先准备中的屏幕
+        ScreenState victim = NEWS_SCREEN;
+        uint32_t oldest = UINT32_MAX;
+        for (int i = 0; i < SCREEN_COUNT; i++) {
+            ScreenState screen = resourceDefs[i].screen;
+            const ScreenResourceState& state = states[screen];
+            if (state.built && screen != activeScreen && screen != preparedScreen && state.lastUsed < oldest) {
+                oldest = state.lastUsed;
+                victim = screen;
+            }
+        }
+        if (oldest == UINT32_MAX) {
+            // 只剩当前屏幕和下一个屏幕，无法继续释放
+            break;
+        }
+        evict(victim);
+    }
+}
+//*** 设置堆内存预算
+void ScreenLifecycle::setHeapBudget(uint32_t bytes) {
+    heapBudget = bytes;
+    enforceBudget();
+}
+//*** 已创建屏幕占用的总内存
+uint32_t ScreenLifecycle::getTotalBytes() {
+    uint32_t total = 0;
+    for (int i = 1; i <= SCREEN_COUNT; i++) {
+        if (states[i].built) {
+            total += states[i].objectBytes + states[i].textBytes;
+        }
+    }
+    return total;
+}
+//*** 生成各屏幕对象数量和内存占用的统计JSON
+String ScreenLifecycle::getStatsJson() {
+    JsonDocument doc;
+    doc["budget"] = heapBudget;
+    doc["total_bytes"] = getTotalBytes();
+    doc["active"] = (int)activeScreen;
+    doc["prepared"] = (int)preparedScreen;
+    JsonArray screens = doc["screens"].to<JsonArray>();
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        const ScreenResourceState& state = states[resourceDefs[i].screen];
+        JsonObject item = screens.add<JsonObject>();
+        item["name"] = resourceDefs[i].name;
+        item["built"] = state.built;
+        item["objects"] = state.objectCount;
+        item["object_bytes"] = state.objectBytes;
+        item["text_bytes"] = state.textBytes;
+        item["builds"] = state.buildCount;
+        item["evictions"] = state.evictCount;
+        item["build_us"] = state.buildMicros;
+        item["from_layout"] = state.fromLayout;
+        if (state.benchBuiltinMicros > 0) {
+            item["bench_builtin_us"] = state.benchBuiltinMicros;
+            item["bench_layout_us"] = state.benchLayoutMicros;
+        }
+    }
+    String result;
+    serializeJson(doc, result);
+    return result;
+}
+//*** 打印统计信息到串口
+void ScreenLifecycle::printStats() {
+    Serial.printf("屏幕对象统计（预算 %u 字节，已用 %u 字节）:\n", heapBudget, getTotalBytes());
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        const ScreenResourceState& state = states[resourceDefs[i].screen];
+        if (state.built) {
+            Serial.printf("  %-10s 对象: %u，内存: %u + 文本 %u 字节\n", resourceDefs[i].name,
+                          state.objectCount, state.objectBytes, state.textBytes);
+        }
+    }
+}
+//*** 执行已请求的创建耗时对比测试
+void ScreenLifecycle::runPendingBenchmark() {
+    if (!benchmarkRequested) {
+        return;
+    }
+    benchmarkRequested = false;
+    LayoutEngine* layoutEngine = LayoutEngine::getInstance();
+    layoutEngine->applyPendingReload();
+    Serial.println("屏幕元素创建耗时对比（内置代码 / 布局字节码）:");
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        const ScreenResourceDef* def = &resourceDefs[i];
+        ScreenResourceState& state = states[def->screen];
+        // 暂存已创建的对象，测试期间全局指针只指向测试对象
+        lv_obj_t* saved[MAX_SCREEN_OBJECTS] = {nullptr};
+        for (int j = 0; j < MAX_SCREEN_OBJECTS && def->objects[j]; j++) {
+            saved[j] = *def->objects[j];
+            *def->objects[j] = nullptr;
+        }
+        uint32_t builtinTotal = 0;
+        uint32_t layoutTotal = 0;
+        bool hasLayout = layoutEngine->hasScreen(def->screen);
+        for (int n = 0; n < BUILD_BENCHMARK_ITERATIONS; n++) {
+            unsigned long startMicros = micros();
+            def->build();
+            builtinTotal += micros() - startMicros;
+            releaseObjects(def);
+            if (hasLayout) {
+                startMicros = micros();
+                layoutEngine->buildScreen(def->screen);
+                layoutTotal += micros() - startMicros;
+                releaseObjects(def);
+            }
+        }
+        for (int j = 0; j < MAX_SCREEN_OBJECTS && def->objects[j]; j++) {
+            *def->objects[j] = saved[j];
+        }
+        state.benchBuiltinMicros = builtinTotal / BUILD_BENCHMARK_ITERATIONS;
+        state.benchLayoutMicros = layoutTotal / BUILD_BENCHMARK_ITERATIONS;
+        if (hasLayout) {
+            Serial.printf("  %-10s %u us / %u us\n", def->name, state.benchBuiltinMicros, state.benchLayoutMicros);
+        } else {
+            Serial.printf("  %-10s %u us / 布局中无此屏幕\n", def->name, state.benchBuiltinMicros);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+#ifndef SCREEN_LIFECYCLE_H
+#define SCREEN_LIFECYCLE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "config/config.h"
+
+// 屏幕数量（ScreenState从1开始编号）
+const int SCREEN_COUNT = NOTE_SCREEN;
+// 每个屏幕最多管理的顶层对象数量
+const int MAX_SCREEN_OBJECTS = 4;
+// 默认的屏幕对象堆内存预算（字节），可通过config.json中的ui.heap_budget修改
+const uint32_t DEFAULT_SCREEN_HEAP_BUDGET = 48 * 1024;
+// 创建耗时对比测试中每个屏幕的重复次数
+const int BUILD_BENCHMARK_ITERATIONS = 5;
+
+// 屏幕元素创建函数类型
+typedef void (*ScreenBuildFunction)();
+
+/**
+ * 屏幕对象生命周期管理器类
+ * 进入屏幕时按需创建该屏幕的标签和图像，离开后隐藏保留；
+ * 所有已创建屏幕占用的堆内存超出预算时，按最近最少使用(LRU)顺序释放
+ */
+class ScreenLifecycle {
+private:
+    static ScreenLifecycle* instance; // 单例实例
+
+    // 屏幕资源定义
+    struct ScreenResourceDef {
+        ScreenState screen;                         // 屏幕状态
+        const char* name;                           // 屏幕名称（用于日志和统计）
+        ScreenBuildFunction build;                  // 元素创建函数
+        lv_obj_t** objects[MAX_SCREEN_OBJECTS];     // 该屏幕拥有的全局对象指针
+    };
+
+    // 屏幕运行时状态
+    struct ScreenResourceState {
+        bool built;               // 元素是否已创建
+        uint32_t lastUsed;        // 最近使用序号（越大越新）
+        uint32_t objectBytes;     // 创建元素时测得的堆内存占用
+        uint32_t textBytes;       // 标签文本占用的内存
+        uint16_t objectCount;     // 对象数量（含子对象）
+        uint32_t buildCount;      // 创建次数
+        uint32_t evictCount;      // 被释放次数
+        uint32_t buildMicros;     // 最近一次创建耗时（微秒）
+        bool fromLayout;          // 最近一次是否由布局字节码创建
+        uint32_t benchBuiltinMicros; // 对比测试：内置创建函数平均耗时（微秒）
+        uint32_t benchLayoutMicros;  // 对比测试：布局字节码平均耗时（微秒，0表示布局中无该屏幕）
+    };
+
+    static const ScreenResourceDef resourceDefs[SCREEN_COUNT];
+    ScreenResourceState states[SCREEN_COUNT + 1]; // 按ScreenState下标访问
+    uint32_t useCounter;          // 使用序号计数器
+    uint32_t heapBudget;          // 堆内存预算（字节）
+    ScreenState activeScreen;     // 当前显示的屏幕（不可释放）
+    ScreenState preparedScreen;   // 预先准备的下一个屏幕（不可释放）
+    volatile bool benchmarkRequested; // Web任务请求创建耗时对比测试
+
+    // 私有构造函数（单例模式）
+    ScreenLifecycle();
+
+    // 查找屏幕资源定义
+    const ScreenResourceDef* findDef(ScreenState screen);
+
+    // 释放指定屏幕的元素
+    void evict(ScreenState screen);
+
+    // 删除屏幕资源定义中的所有对象并将全局指针置空
+    static void releaseObjects(const ScreenResourceDef* def);
+
+    // 调用布局字节码或内置创建函数创建元素，返回是否使用了布局
+    static bool buildObjects(const ScreenResourceDef* def);
+
+    // 释放除当前屏幕和预先准备屏幕以外的所有屏幕（布局更新后使用）
+    void evictInactive();
+
+    // 超出预算时按LRU顺序释放屏幕元素
+    void enforceBudget();
+
+    // 递归统计对象数量
+    static uint16_t countObjects(lv_obj_t* obj);
+
+public:
+    // 获取单例实例
+    static ScreenLifecycle* getInstance();
+
+    // 初始化（读取配置中的内存预算）
+    void init();
+
+    // 确保指定屏幕的元素已创建
+    void ensureBuilt(ScreenState screen);
+
+    // 进入屏幕：创建元素并标记为当前屏幕
+    void enterScreen(ScreenState screen);
+
+    // 标记预先准备的下一个屏幕，确保其元素已创建且不被释放
+    void setPreparedScreen(ScreenState screen);
+
+    // 更新指定屏幕的对象数量和文本内存统计（需在显示任务中调用）
+    void refreshStats(ScreenState screen);
+
+    // 设置堆内存预算
+    void setHeapBudget(uint32_t bytes);
+    uint32_t getHeapBudget() { return heapBudget; }
+
+    // 已创建屏幕占用的总内存
+    uint32_t getTotalBytes();
+
+    // 生成各屏幕对象数量和内存占用的统计JSON
+    String getStatsJson();
+
+    // 打印统计信息到串口
+    void printStats();
+
+    // 请求一次创建耗时对比测试（可在Web任务中调用）
+    void requestBenchmark() { benchmarkRequested = true; }
+
+    // 在显示任务中执行已请求的对比测试：分别用内置函数和布局字节码创建、删除各屏幕元素
+    void runPendingBenchmark();
+};
+
+#endif // SCREEN_LIFECYCLE_H
@@ -0,0 +1,264 @@
+#include "transition_manager.h"
+#include "config/config.h"
+#include "manager/time_manager.h"
+
+// 定义单例实例
+TransitionManager* TransitionManager::instance = nullptr;
+
+// 过渡期间允许的最长时钟停顿（毫秒），秒显示每1000ms更新一次
+static const unsigned long CLOCK_STALL_THRESHOLD = 1500;
+
+//*** 私有构造函数
+TransitionManager::TransitionManager() {
+    stepCount = 0;
+    nextStep = 0;
+    sequenceTime = 0;
+    stepTimer = nullptr;
+    animatedCount = 0;
+    runningAnimations = 0;
+    maxSliceTime = 0;
+    deferredSteps = 0;
+    clockStallCount = 0;
+    lastCheckTime = 0;
+}
+//*** 获取单例实例
+TransitionManager* TransitionManager::getInstance() {
+    if (instance == nullptr) {
+        instance = new TransitionManager();
+    }
+    return instance;
+}
+//*** 在序列末尾追加一个步骤
+bool TransitionManager::addStep(uint32_t delayMs, TransitionStepCallback callback, void* userData) {
+    if (callback == nullptr) {
+        return false;
+    }
+    // 序列已满时先压缩掉已执行的步骤
+    if (stepCount >= MAX_TRANSITION_STEPS && nextStep > 0) {
+        int remaining = stepCount - nextStep;
+        for (int i = 0; i < remaining; i++) {
+            steps[i] = steps[nextStep + i];
+        }
+        stepCount = remaining;
+        nextStep = 0;
+    }
+    if (stepCount >= MAX_TRANSITION_STEPS) {
+        Serial.println("过渡步骤序列已满，忽略新步骤");
+        return false;
+    }
+    // 步骤的延迟相对于序列中上一个步骤计算（按差值比较，millis()回绕后仍然正确）
+    uint32_t now = lv_tick_get();
+    uint32_t base = (nextStep < stepCount && (int32_t)(sequenceTime - now) > 0) ? sequenceTime : now;
+    steps[stepCount].dueTime = base + delayMs;
+    steps[stepCount].callback = callback;
+    steps[stepCount].userData = userData;
+    sequenceTime = steps[stepCount].dueTime;
+    stepCount++;
+    // 按需创建调度定时器
+    if (stepTimer == nullptr) {
+        stepTimer = lv_timer_create(stepTimerCallback, TRANSITION_TIMER_PERIOD, this);
+    } else if (stepTimer->paused) {
+        lv_timer_resume(stepTimer);
+        lastCheckTime = 0;
+    }
+    return true;
+}
+//*** 步骤调度定时器回调
+void TransitionManager::stepTimerCallback(lv_timer_t* timer) {
+    TransitionManager* self = static_cast<TransitionManager*>(timer->user_data);
+    uint32_t sliceStart = micros();
+    // 执行所有已到期的步骤，超出本帧预算的顺延到下一帧
+    while (self->nextStep < self->stepCount &&
+           lv_tick_elaps(self->steps[self->nextStep].dueTime) < 0x80000000UL) {
+        if (micros() - sliceStart >= TRANSITION_FRAME_BUDGET_US) {
+            self->deferredSteps++;
+            break;
+        }
+        TransitionStep& step = self->steps[self->nextStep++];
+        step.callback(step.userData);
+    }
+    uint32_t sliceTime = micros() - sliceStart;
+    if (sliceTime > self->maxSliceTime) {
+        self->maxSliceTime = sliceTime;
+    }
+    self->checkClockTicking();
+    // 所有步骤和动画结束后暂停定时器
+    if (self->nextStep >= self->stepCount) {
+        self->stepCount = 0;
+        self->nextStep = 0;
+        if (self->runningAnimations == 0) {
+            lv_timer_pause(timer);
+        }
+    }
+}
+//*** 检查过渡期间时钟是否仍在走动
+void TransitionManager::checkClockTicking() {
+    // 按32位计算间隔，与millis()一样回绕
+    uint32_t now = millis();
+    // 两次调度之间的间隔过长，说明显示任务被阻塞，时钟在此期间无法更新
+    uint32_t sinceCheck = now - (uint32_t)lastCheckTime;
+    if (lastCheckTime != 0 && sinceCheck > CLOCK_STALL_THRESHOLD) {
+        clockStallCount++;
+        Serial.printf("警告：过渡期间显示任务阻塞 %lu ms，时钟停止走动\n", (unsigned long)sinceCheck);
+    }
+    // 秒显示长时间未更新
+    unsigned long lastSecondUpdate = TimeManager::getInstance()->getLastSecondUpdate();
+    uint32_t sinceSecond = now - (uint32_t)lastSecondUpdate;
+    if (lastSecondUpdate != 0 && sinceSecond > CLOCK_STALL_THRESHOLD) {
+        clockStallCount++;
+        Serial.printf("警告：过渡期间时钟已停顿 %lu ms\n", (unsigned long)sinceSecond);
+    }
+    lastCheckTime = now;
+}
+//*** 取消所有未执行的步骤和正在进行的动画
+void TransitionManager::cancel() {
+    stepCount = 0;
+    nextStep = 0;
+    sequenceTime = 0;
+    // 停止动画并恢复对象的最终状态，避免停留在半透明或偏移位置
+    for (int i = 0; i < animatedCount; i++) {
+        lv_obj_t* obj = animatedObjs[i];
+        if (obj && lv_obj_is_valid(obj)) {
+            lv_anim_del(obj, fadeExecCallback);
+            lv_anim_del(obj, slideXExecCallback);
+            lv_anim_del(obj, slideYExecCallback);
+            lv_obj_set_style_opa(obj, LV_OPA_COVER, 0);
+            lv_obj_set_style_translate_x(obj, 0, 0);
+            lv_obj_set_style_translate_y(obj, 0, 0);
+        }
+    }
+    animatedCount = 0;
+    runningAnimations = 0;
+    if (stepTimer) {
+        lv_timer_pause(stepTimer);
+    }
+}
+//*** 是否有正在进行的过渡
+bool TransitionManager::isActive() {
+    return nextStep < stepCount || runningAnimations > 0;
+}
+//*** 记录正在执行动画的对象并启动动画
+void TransitionManager::startAnimation(lv_anim_t* anim, lv_obj_t* obj) {
+    bool tracked = false;
+    for (int i = 0; i < animatedCount; i++) {
+        if (animatedObjs[i] == obj) {
+            tracked = true;
+            break;
+        }
+    }
+    if (!tracked && animatedCount < MAX_TRANSITION_STEPS) {
+        animatedObjs[animatedCount++] = obj;
+    }
+    lv_anim_set_deleted_cb(anim, animationDeletedCallback);
+    runningAnimations++;
+    lv_anim_start(anim);
+    // 动画期间保持定时器运行，以便检查时钟
+    if (stepTimer == nullptr) {
+        stepTimer = lv_timer_create(stepTimerCallback, TRANSITION_TIMER_PERIOD, this);
+    } else if (stepTimer->paused) {
+        lv_timer_resume(stepTimer);
+        lastCheckTime = 0;
+    }
+}
+//*** 淡入淡出动画执行回调
+void TransitionManager::fadeExecCallback(void* obj, int32_t value) {
+    lv_obj_set_style_opa(static_cast<lv_obj_t*>(obj), static_cast<lv_opa_t>(value), 0);
+}
+//*** 水平滑动动画执行回调
+void TransitionManager::slideXExecCallback(void* obj, int32_t value) {
+    lv_obj_set_style_translate_x(static_cast<lv_obj_t*>(obj), static_cast<lv_coord_t>(value), 0);
+}
+//*** 垂直滑动动画执行回调
+void TransitionManager::slideYExecCallback(void* obj, int32_t value) {
+    lv_obj_set_style_translate_y(static_cast<lv_obj_t*>(obj), static_cast<lv_coord_t>(value), 0);
+}
+//*** 淡出结束回调：隐藏对象并恢复不透明度
+void TransitionManager::fadeOutReadyCallback(lv_anim_t* anim) {
+    lv_obj_t* obj = static_cast<lv_obj_t*>(anim->var);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_set_style_opa(obj, LV_OPA_COVER, 0);
+}
+//*** 动画结束或被删除回调
+void TransitionManager::animationDeletedCallback(lv_anim_t* anim) {
+    if (instance && instance->runningAnimations > 0) {
+        instance->runningAnimations--;
+        if (instance->runningAnimations == 0) {
+            instance->animatedCount = 0;
+        }
+    }
+}
+//*** 淡入对象
+void TransitionManager::fadeIn(lv_obj_t* obj, uint32_t duration, uint32_t delay) {
+    if (obj == nullptr || !lv_obj_is_valid(obj)) {
+        return;
+    }
+    lv_obj_set_style_opa(obj, LV_OPA_TRANSP, 0);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    lv_anim_t anim;
+    lv_anim_init(&anim);
+    lv_anim_set_var(&anim, obj);
+    lv_anim_set_exec_cb(&anim, fadeExecCallback);
+    lv_anim_set_values(&anim, LV_OPA_TRANSP, LV_OPA_COVER);
+    lv_anim_set_time(&anim, duration);
+    lv_anim_set_delay(&anim, delay);
+    startAnimation(&anim, obj);
+}
+//*** 淡出对象，结束后隐藏
+void TransitionManager::fadeOut(lv_obj_t* obj, uint32_t duration, uint32_t delay) {
+    if (obj == nullptr || !lv_obj_is_valid(obj)) {
+        return;
+    }
+    lv_anim_t anim;
+    lv_anim_init(&anim);
+    lv_anim_set_var(&anim, obj);
+    lv_anim_set_exec_cb(&anim, fadeExecCallback);
+    lv_anim_set_values(&anim, LV_OPA_COVER, LV_OPA_TRANSP);
+    lv_anim_set_time(&anim, duration);
+    lv_anim_set_delay(&anim, delay);
+    lv_anim_set_ready_cb(&anim, fadeOutReadyCallback);
+    startAnimation(&anim, obj);
+}
+//*** 从指定方向滑入对象
+void TransitionManager::slideIn(lv_obj_t* obj, lv_dir_t fromDir, uint32_t duration, uint32_t delay) {
+    if (obj == nullptr || !lv_obj_is_valid(obj)) {
+        return;
+    }
+    // 通过translate样式偏移，不改变对象原有的对齐和坐标
+    lv_anim_exec_xcb_t execCallback = slideXExecCallback;
+    int32_t startValue = 0;
+    switch (fromDir) {
+        case LV_DIR_LEFT:
+            startValue = -(int32_t)screenWidth;
+            break;
+        case LV_DIR_RIGHT:
+            startValue = screenWidth;
+            break;
+        case LV_DIR_TOP:
+            execCallback = slideYExecCallback;
+            startValue = -(int32_t)screenHeight;
+            break;
+        case LV_DIR_BOTTOM:
+            execCallback = slideYExecCallback;
+            startValue = screenHeight;
+            break;
+        default:
+            break;
+    }
+    execCallback(obj, startValue);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    lv_anim_t anim;
+    lv_anim_init(&anim);
+    lv_anim_set_var(&anim, obj);
+    lv_anim_set_exec_cb(&anim, execCallback);
+    lv_anim_set_values(&anim, startValue, 0);
+    lv_anim_set_time(&anim, duration);
+    lv_anim_set_delay(&anim, delay);
+    lv_anim_set_path_cb(&anim, lv_anim_path_ease_out);
+    startAnimation(&anim, obj);
+}
+//*** 分阶段依次显示一组对象
+void TransitionManager::stagedReveal(lv_obj_t** objs, int count, uint32_t interval, uint32_t fadeDuration) {
+    for (int i = 0; i < count; i++) {
+        fadeIn(objs[i], fadeDuration, interval * i);
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef TRANSITION_MANAGER_H
+#define TRANSITION_MANAGER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// 过渡步骤回调函数类型
+typedef void (*TransitionStepCallback)(void* userData);
+
+// 步骤序列的最大长度
+const int MAX_TRANSITION_STEPS = 16;
+// 步骤调度定时器周期（毫秒），与LVGL默认刷新周期一致
+const uint32_t TRANSITION_TIMER_PERIOD = 30;
+// 每帧执行步骤的时间预算（微秒），超出预算的步骤顺延到下一帧
+const uint32_t TRANSITION_FRAME_BUDGET_US = 5000;
+
+/**
+ * 屏幕过渡管理器类
+ * 基于LVGL定时器和动画实现分阶段显示、淡入淡出、滑入等过渡效果，
+ * 所有步骤都在lv_task_handler中按帧推进，不会阻塞显示任务
+ */
+class TransitionManager {
+private:
+    static TransitionManager* instance; // 单例实例
+
+    // 过渡步骤
+    struct TransitionStep {
+        uint32_t dueTime;                 // 步骤到期时间（毫秒）
+        TransitionStepCallback callback;  // 步骤回调
+        void* userData;                   // 回调参数
+    };
+
+    TransitionStep steps[MAX_TRANSITION_STEPS]; // 步骤序列（按添加顺序执行）
+    int stepCount;                // 序列中的步骤数量
+    int nextStep;                 // 下一个待执行的步骤
+    uint32_t sequenceTime;        // 序列中最后一个步骤的到期时间
+    lv_timer_t* stepTimer;        // 步骤调度定时器
+    lv_obj_t* animatedObjs[MAX_TRANSITION_STEPS]; // 正在执行动画的对象（用于取消时恢复）
+    int animatedCount;            // 正在执行动画的对象数量
+    int runningAnimations;        // 正在运行的动画数量
+
+    // 统计信息
+    uint32_t maxSliceTime;        // 单帧执行步骤的最长耗时（微秒）
+    uint32_t deferredSteps;       // 因超出帧预算而顺延的步骤次数
+    uint32_t clockStallCount;     // 过渡期间时钟停止走动的次数
+    unsigned long lastCheckTime;  // 上次检查时钟的时间
+
+    // 私有构造函数（单例模式）
+    TransitionManager();
+
+    // 步骤调度定时器回调
+    static void stepTimerCallback(lv_timer_t* timer);
+
+    // 检查过渡期间时钟是否仍在走动
+    void checkClockTicking();
+
+    // 记录正在执行动画的对象并启动动画
+    void startAnimation(lv_anim_t* anim, lv_obj_t* obj);
+
+    // 动画执行回调
+    static void fadeExecCallback(void* obj, int32_t value);
+    static void slideXExecCallback(void* obj, int32_t value);
+    static void slideYExecCallback(void* obj, int32_t value);
+    static void fadeOutReadyCallback(lv_anim_t* anim);
+    static void animationDeletedCallback(lv_anim_t* anim);
+
+public:
+    // 获取单例实例
+    static TransitionManager* getInstance();
+
+    // 在序列末尾追加一个步骤，delayMs为距离上一个步骤的延迟
+    bool addStep(uint32_t delayMs, TransitionStepCallback callback, void* userData = nullptr);
+
+    // 取消所有未执行的步骤和正在进行的动画
+    void cancel();
+
+    // 是否有正在进行的过渡
+    bool isActive();
+
+    // 淡入对象
+    void fadeIn(lv_obj_t* obj, uint32_t duration, uint32_t delay = 0);
+
+    // 淡出对象，结束后隐藏
+    void fadeOut(lv_obj_t* obj, uint32_t duration, uint32_t delay = 0);
+
+    // 从指定方向滑入对象
+    void slideIn(lv_obj_t* obj, lv_dir_t fromDir, uint32_t duration, uint32_t delay = 0);
+
+    // 分阶段依次显示一组对象，每个对象间隔interval毫秒淡入
+    void stagedReveal(lv_obj_t** objs, int count, uint32_t interval, uint32_t fadeDuration);
+
+    // 获取统计信息
+    uint32_t getMaxSliceTime() { return maxSliceTime; }
+    uint32_t getDeferredSteps() { return deferredSteps; }
+    uint32_t getClockStallCount() { return clockStallCount; }
+};
+
+#endif // TRANSITION_MANAGER_H
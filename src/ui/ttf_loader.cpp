@@ -0,0 +1,1134 @@
+#include "ttf_loader.h"
+#ifdef ARDUINO
+#include <SPIFFS.h>
+#include <ArduinoJson.h>
+#else
+#include <stdlib.h>
+#include <string.h>
+#endif
+#include <math.h>
+#include "manager/asset_bundle.h"
+
+// 定义单例实例
+TtfLoader* TtfLoader::instance = nullptr;
+
+// TrueType表标签
+#define TTF_TAG(a, b, c, d) (((uint32_t)(a) << 24) | ((uint32_t)(b) << 16) | ((uint32_t)(c) << 8) | (uint32_t)(d))
+
+// 组合字形的标志
+const uint16_t TTF_ARGS_ARE_WORDS = 0x0001;
+const uint16_t TTF_ARGS_ARE_XY = 0x0002;
+const uint16_t TTF_HAVE_SCALE = 0x0008;
+const uint16_t TTF_MORE_COMPONENTS = 0x0020;
+const uint16_t TTF_HAVE_XY_SCALE = 0x0040;
+const uint16_t TTF_HAVE_2X2 = 0x0080;
+const uint16_t TTF_USE_MY_METRICS = 0x0200;
+// 组合字形的最大嵌套层数
+const int TTF_MAX_COMPONENT_DEPTH = 4;
+// 字形边界框离原点的最大距离（字号的倍数），超出时（损坏的字体）按空白字形处理，不分配巨大的光栅化缓冲区
+const int TTF_MAX_GLYPH_EXTENT = 4;
+
+#ifdef ARDUINO
+// 字体文件、光栅化缓冲区和字形位图放在PSRAM中
+static inline void* ttfMalloc(size_t size) {
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+}
+static inline void ttfFree(void* data) {
+    heap_caps_free(data);
+}
+
+//*** 把SPIFFS中的字体文件整个读入PSRAM，没有文件或读取失败时返回nullptr
+static uint8_t* readFontFile(const char* path, uint32_t& length) {
+    if (!SPIFFS.exists(path)) {
+        return nullptr;
+    }
+    File file = SPIFFS.open(path, "r");
+    if (!file) {
+        return nullptr;
+    }
+    length = file.size();
+    uint8_t* data = (uint8_t*)ttfMalloc(length > 0 ? length : 1);
+    if (data != nullptr && file.read(data, length) != length) {
+        ttfFree(data);
+        data = nullptr;
+    }
+    if (data == nullptr) {
+        Serial.printf("无法读取轮廓字体%s（%u字节）\n", path, (unsigned)length);
+    }
+    file.close();
+    return data;
+}
+#else
+// Linux上测试使用：SPIFFS由目录代替（见setFontDir），字体文件按实际长度分配，越界读取可由AddressSanitizer发现
+static inline void* ttfMalloc(size_t size) {
+    return malloc(size);
+}
+static inline void ttfFree(void* data) {
+    free(data);
+}
+// 代替SPIFFS的目录
+static char fontDir[128] = ".";
+
+//*** 读取目录中的字体文件，没有文件或读取失败时返回nullptr
+static uint8_t* readFontFile(const char* path, uint32_t& length) {
+    char hostPath[192];
+    snprintf(hostPath, sizeof(hostPath), "%s%s", fontDir, path);
+    FILE* file = fopen(hostPath, "rb");
+    if (file == nullptr) {
+        return nullptr;
+    }
+    fseek(file, 0, SEEK_END);
+    length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t* data = (uint8_t*)ttfMalloc(length > 0 ? length : 1);
+    if (data != nullptr && fread(data, 1, length, file) != length) {
+        ttfFree(data);
+        data = nullptr;
+    }
+    if (data == nullptr) {
+        Serial.printf("无法读取轮廓字体%s（%u字节）\n", path, (unsigned)length);
+    }
+    fclose(file);
+    return data;
+}
+#endif
+
+// 大端读取
+static inline uint16_t readU16(const uint8_t* p) {
+    return (p[0] << 8) | p[1];
+}
+static inline int16_t readI16(const uint8_t* p) {
+    return (int16_t)readU16(p);
+}
+static inline uint32_t readU32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+// 2.14定点数
+static inline float readF2Dot14(const uint8_t* p) {
+    return readI16(p) / 16384.0f;
+}
+
+// 读取组合字形的一个部件：部件的字形编号、标志，以及与上一级变换组合后的变换
+static bool readComponent(const uint8_t*& p, const uint8_t* end, const float* matrix, uint16_t& component,
+                          uint16_t& flags, float* combined) {
+    if (p + 4 > end) {
+        return false;
+    }
+    flags = readU16(p);
+    component = readU16(p + 2);
+    p += 4;
+    float dx, dy;
+    size_t argSize = (flags & TTF_ARGS_ARE_WORDS) ? 4 : 2;
+    size_t scaleSize = (flags & TTF_HAVE_SCALE) ? 2 : (flags & TTF_HAVE_XY_SCALE) ? 4 : (flags & TTF_HAVE_2X2) ? 8 : 0;
+    if (p + argSize + scaleSize > end) {
+        return false;
+    }
+    if (flags & TTF_ARGS_ARE_WORDS) {
+        dx = readI16(p);
+        dy = readI16(p + 2);
+    } else {
+        dx = (int8_t)p[0];
+        dy = (int8_t)p[1];
+    }
+    p += argSize;
+    // 按点对齐的部件（参数为点编号）很少使用，按不偏移处理
+    if (!(flags & TTF_ARGS_ARE_XY)) {
+        dx = 0;
+        dy = 0;
+    }
+    float a = 1.0f, b = 0.0f, c = 0.0f, d = 1.0f;
+    if (flags & TTF_HAVE_SCALE) {
+        a = d = readF2Dot14(p);
+    } else if (flags & TTF_HAVE_XY_SCALE) {
+        a = readF2Dot14(p);
+        d = readF2Dot14(p + 2);
+    } else if (flags & TTF_HAVE_2X2) {
+        a = readF2Dot14(p);
+        b = readF2Dot14(p + 2);
+        c = readF2Dot14(p + 4);
+        d = readF2Dot14(p + 6);
+    }
+    p += scaleSize;
+    combined[0] = matrix[0] * a + matrix[2] * b;
+    combined[1] = matrix[1] * a + matrix[3] * b;
+    combined[2] = matrix[0] * c + matrix[2] * d;
+    combined[3] = matrix[1] * c + matrix[3] * d;
+    combined[4] = matrix[0] * dx + matrix[2] * dy + matrix[4];
+    combined[5] = matrix[1] * dx + matrix[3] * dy + matrix[5];
+    return true;
+}
+
+// 面积累加光栅化：每条线段把经过的每行中各像素左侧的带符号面积变化加到缓冲区，
+// 每行从左到右累加即得到像素的覆盖率（非零环绕规则下的近似，与字体轮廓的方向无关）
+struct TtfLoader::Raster {
+    float* cells;                  // 面积累加缓冲区（每行stride个单元）
+    int width;
+    int height;
+    int stride;
+
+    // 限制在位图的左右边缘之间
+    float clampX(float x) const {
+        return fminf(fmaxf(x, 0.0f), (float)width);
+    }
+
+    // 累加一条线段（像素坐标，y向下）
+    void line(float x0, float y0, float x1, float y1) {
+        if (y0 == y1) {
+            return;
+        }
+        float dir = 1.0f;
+        if (y0 > y1) {
+            dir = -1.0f;
+            float t = x0; x0 = x1; x1 = t;
+            t = y0; y0 = y1; y1 = t;
+        }
+        // 超出边界框的点（缩放取整误差）限制在位图内
+        x0 = clampX(x0);
+        x1 = clampX(x1);
+        float dxdy = (x1 - x0) / (y1 - y0);
+        float x = x0;
+        if (y0 < 0.0f) {
+            x = clampX(x - y0 * dxdy);
+        }
+        int yEnd = (int)ceilf(y1) < height ? (int)ceilf(y1) : height;
+        for (int y = y0 > 0.0f ? (int)y0 : 0; y < yEnd; y++) {
+            float* row = cells + y * stride;
+            float dy = fminf((float)(y + 1), y1) - fmaxf((float)y, y0);
+            // 远在位图外的点（损坏的字体）逐行累加时的舍入误差不能使位置越出缓冲区
+            float xNext = clampX(x + dxdy * dy);
+            float d = dy * dir;
+            float xa = fminf(x, xNext);
+            float xb = fmaxf(x, xNext);
+            float xaFloor = floorf(xa);
+            int xai = (int)xaFloor;
+            int xbi = (int)ceilf(xb);
+            if (xbi <= xai + 1) {
+                // 线段在这一行中只经过一个像素
+                float xmf = 0.5f * (x + xNext) - xaFloor;
+                row[xai] += d - d * xmf;
+                row[xai + 1] += d * xmf;
+            } else {
+                float s = 1.0f / (xb - xa);
+                float xaf = xa - xaFloor;
+                float a0 = 0.5f * s * (1.0f - xaf) * (1.0f - xaf);
+                float xbf = xb - xbi + 1.0f;
+                float am = 0.5f * s * xbf * xbf;
+                row[xai] += d * a0;
+                if (xbi == xai + 2) {
+                    row[xai + 1] += d * (1.0f - a0 - am);
+                } else {
+                    float a1 = s * (1.5f - xaf);
+                    row[xai + 1] += d * (a1 - a0);
+                    for (int xi = xai + 2; xi < xbi - 1; xi++) {
+                        row[xi] += d * s;
+                    }
+                    float a2 = a1 + (xbi - xai - 3) * s;
+                    row[xbi - 1] += d * (1.0f - a2 - am);
+                }
+                row[xbi] += d * am;
+            }
+            x = xNext;
+        }
+    }
+
+    // 二次贝塞尔曲线按弯曲程度展平为线段
+    void quad(float x0, float y0, float cx, float cy, float x1, float y1) {
+        float ddx = x0 - 2.0f * cx + x1;
+        float ddy = y0 - 2.0f * cy + y1;
+        float deviation = ddx * ddx + ddy * ddy;
+        if (deviation < 0.333f) {
+            line(x0, y0, x1, y1);
+            return;
+        }
+        int segments = 1 + (int)sqrtf(sqrtf(3.0f * deviation));
+        float px = x0;
+        float py = y0;
+        for (int i = 1; i <= segments; i++) {
+            float t = (float)i / segments;
+            float mt = 1.0f - t;
+            float nx = mt * mt * x0 + 2.0f * t * mt * cx + t * t * x1;
+            float ny = mt * mt * y0 + 2.0f * t * mt * cy + t * t * y1;
+            line(px, py, nx, ny);
+            px = nx;
+            py = ny;
+        }
+    }
+};
+
+//*** 私有构造函数
+TtfLoader::TtfLoader() {
+    faceCount = 0;
+    missingCount = 0;
+    fontCount = 0;
+    for (int i = 0; i < TTF_GLYPH_CACHE_BUCKETS; i++) {
+        buckets[i] = -1;
+    }
+    for (int i = 0; i < TTF_GLYPH_CACHE_ENTRIES; i++) {
+        entries[i].bitmap = nullptr;
+        entries[i].next = i + 1 < TTF_GLYPH_CACHE_ENTRIES ? i + 1 : -1;
+    }
+    freeHead = 0;
+    lruHead = -1;
+    lruTail = -1;
+    cacheBytes = 0;
+    evictions = 0;
+    coverage = nullptr;
+    coverageSize = 0;
+    pointBuffer = nullptr;
+    flagBuffer = nullptr;
+    pointCapacity = 0;
+}
+//*** 获取单例实例
+TtfLoader* TtfLoader::getInstance() {
+    if (instance == nullptr) {
+        instance = new TtfLoader();
+    }
+    return instance;
+}
+//*** 获取指定字体文件和字号的字体
+const lv_font_t* TtfLoader::font(const char* name, uint16_t size, const lv_font_t* fallback) {
+    if (size < TTF_MIN_SIZE || size > TTF_MAX_SIZE) {
+        return fallback;
+    }
+    Face* face = openFace(name);
+    if (face == nullptr) {
+        return fallback;
+    }
+    for (int i = 0; i < fontCount; i++) {
+        if (fonts[i].face == face && fonts[i].size == size) {
+            return &fonts[i].font;
+        }
+    }
+    if (fontCount >= TTF_MAX_FONTS) {
+        Serial.printf("轮廓字体数量已满，%s %u像素使用原来的字体\n", name, size);
+        return fallback;
+    }
+    SizedFont& sized = fonts[fontCount];
+    memset(&sized, 0, sizeof(SizedFont));
+    sized.face = face;
+    sized.size = size;
+    sized.scale = (float)size / face->unitsPerEm;
+    sized.index = fontCount;
+    sized.lastLetter = 0xFFFFFFFF;
+    // 行高和基线由hhea表的上升、下降高度和行间距得到
+    int lineGap = face->lineGap > 0 ? face->lineGap : 0;
+    int descent = (int)ceilf(-face->descender * sized.scale);
+    sized.font.get_glyph_dsc = glyphDscCallback;
+    sized.font.get_glyph_bitmap = glyphBitmapCallback;
+    sized.font.line_height = (int)ceilf((face->ascender - face->descender + lineGap) * sized.scale);
+    sized.font.base_line = descent;
+    sized.font.subpx = LV_FONT_SUBPX_NONE;
+    sized.font.underline_position = -descent / 2;
+    sized.font.underline_thickness = size / 16 > 1 ? size / 16 : 1;
+    sized.font.user_data = &sized;
+    sized.font.fallback = fallback;
+    fontCount++;
+    Serial.printf("轮廓字体%s生成%u像素字体，行高%d\n", name, size, sized.font.line_height);
+    return &sized.font;
+}
+//*** 是否有指定名称的字体文件
+bool TtfLoader::hasFace(const char* name) {
+    return openFace(name) != nullptr;
+}
+//*** 打开字体文件
+TtfLoader::Face* TtfLoader::openFace(const char* name) {
+    for (int i = 0; i < faceCount; i++) {
+        if (strcmp(faces[i].name, name) == 0) {
+            return &faces[i];
+        }
+    }
+    for (int i = 0; i < missingCount; i++) {
+        if (strcmp(missing[i], name) == 0) {
+            return nullptr;
+        }
+    }
+    if (strlen(name) >= TTF_NAME_SIZE) {
+        return nullptr;
+    }
+    if (faceCount < TTF_MAX_FACES) {
+        Face& face = faces[faceCount];
+        unsigned long startTime = millis();
+        memset(&face, 0, sizeof(Face));
+        strcpy(face.name, name);
+        // 资源分区中的字体直接使用映射的数据，SPIFFS中的字体整个读入PSRAM
+        face.data = AssetBundle::getInstance()->getOutline(name, face.length);
+        face.fromAssets = face.data != nullptr;
+        if (face.data == nullptr) {
+            char path[40];
+            snprintf(path, sizeof(path), TTF_LOADER_DIR "%s.ttf", name);
+            face.data = readFontFile(path, face.length);
+        }
+        if (face.data != nullptr) {
+            if (parseFace(face)) {
+                face.loadMillis = millis() - startTime;
+                faceCount++;
+                Serial.printf("已打开轮廓字体%s（%s）：%u个字形，%u字节，耗时%lu ms\n", name,
+                              face.fromAssets ? "资源分区" : "SPIFFS", face.glyphCount, (unsigned)face.length,
+                              (unsigned long)face.loadMillis);
+                return &face;
+            }
+            Serial.printf("轮廓字体%s无效或不支持（需要glyf轮廓和Unicode cmap表）\n", name);
+            if (!face.fromAssets) {
+                ttfFree((void*)face.data);
+            }
+        }
+    }
+    if (missingCount < TTF_MAX_FONTS) {
+        strcpy(missing[missingCount++], name);
+    }
+    return nullptr;
+}
+//*** 解析字体文件的表目录和需要的表
+bool TtfLoader::parseFace(Face& face) {
+    const uint8_t* data = face.data;
+    uint32_t length = face.length;
+    if (length < 12) {
+        return false;
+    }
+    uint32_t version = readU32(data);
+    if (version != 0x00010000 && version != TTF_TAG('t', 'r', 'u', 'e')) {
+        return false;
+    }
+    uint16_t tableCount = readU16(data + 4);
+    if (12 + tableCount * 16u > length) {
+        return false;
+    }
+    uint32_t head = 0, hhea = 0, maxp = 0, cmap = 0, kern = 0;
+    uint32_t locaLength = 0, cmapLength = 0, kernLength = 0;
+    uint32_t headLength = 0, hheaLength = 0, maxpLength = 0;
+    for (int i = 0; i < tableCount; i++) {
+        const uint8_t* record = data + 12 + i * 16;
+        uint32_t offset = readU32(record + 8);
+        uint32_t size = readU32(record + 12);
+        if (offset > length || size > length - offset) {
+            return false;
+        }
+        switch (readU32(record)) {
+            case TTF_TAG('h', 'e', 'a', 'd'): head = offset; headLength = size; break;
+            case TTF_TAG('h', 'h', 'e', 'a'): hhea = offset; hheaLength = size; break;
+            case TTF_TAG('m', 'a', 'x', 'p'): maxp = offset; maxpLength = size; break;
+            case TTF_TAG('h', 'm', 't', 'x'): face.hmtx = offset; face.hmtxLength = size; break;
+            case TTF_TAG('l', 'o', 'c', 'a'): face.loca = offset; locaLength = size; break;
+            case TTF_TAG('g', 'l', 'y', 'f'): face.glyf = offset; face.glyfLength = size; break;
+            case TTF_TAG('c', 'm', 'a', 'p'): cmap = offset; cmapLength = size; break;
+            case TTF_TAG('k', 'e', 'r', 'n'): kern = offset; kernLength = size; break;
+        }
+    }
+    // CFF轮廓（OpenType .otf）没有glyf和loca表，不支持
+    if (headLength < 54 || hheaLength < 36 || maxpLength < 6 || face.glyf == 0 || locaLength == 0 || cmapLength < 8) {
+        return false;
+    }
+    face.unitsPerEm = readU16(data + head + 18);
+    face.longLoca = readI16(data + head + 50) != 0;
+    face.ascender = readI16(data + hhea + 4);
+    face.descender = readI16(data + hhea + 6);
+    face.lineGap = readI16(data + hhea + 8);
+    face.hMetricCount = readU16(data + hhea + 34);
+    face.glyphCount = readU16(data + maxp + 4);
+    if (face.unitsPerEm < 16 || face.unitsPerEm > 16384 || face.hMetricCount == 0 ||
+        face.hmtxLength < face.hMetricCount * 4u ||
+        locaLength < (face.glyphCount + 1u) * (face.longLoca ? 4 : 2)) {
+        return false;
+    }
+    // 选择Unicode cmap子表：优先使用支持基本多文种平面以外字符的格式12
+    int best = 0;
+    uint16_t subtableCount = readU16(data + cmap + 2);
+    for (int i = 0; i < subtableCount && 4 + (i + 1) * 8u <= cmapLength; i++) {
+        const uint8_t* record = data + cmap + 4 + i * 8;
+        uint16_t platform = readU16(record);
+        uint16_t encoding = readU16(record + 2);
+        uint32_t offset = readU32(record + 4);
+        if (offset > cmapLength - 8) {
+            continue;
+        }
+        const uint8_t* subtable = data + cmap + offset;
+        uint16_t format = readU16(subtable);
+        bool unicode = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+        int score = 0;
+        if (unicode && format == 12 && offset + 16 <= cmapLength &&
+            readU32(subtable + 12) <= (cmapLength - offset - 16) / 12) {
+            score = 2;
+        } else if (unicode && format == 4 && offset + 14 <= cmapLength &&
+                   offset + 16 + readU16(subtable + 6) * 4u <= cmapLength) {
+            score = 1;
+        }
+        if (score > best) {
+            best = score;
+            face.cmap = cmap + offset;
+            face.cmapFormat = format;
+        }
+    }
+    if (best == 0) {
+        return false;
+    }
+    // kern表：只使用第一个子表，且须为水平方向的格式0
+    if (kern != 0 && kernLength >= 18 && readU16(data + kern) == 0 && readU16(data + kern + 2) > 0) {
+        uint16_t coverageFlags = readU16(data + kern + 8);
+        uint16_t pairs = readU16(data + kern + 10);
+        if ((coverageFlags >> 8) == 0 && (coverageFlags & 0x07) == 0x01 && 18 + pairs * 6u <= kernLength) {
+            face.kern = kern + 18;
+            face.kernPairs = pairs;
+        }
+    }
+    return true;
+}
+//*** 字符对应的字形编号
+uint16_t TtfLoader::glyphIndex(const Face& face, uint32_t letter) {
+    const uint8_t* table = face.data + face.cmap;
+    uint32_t glyphId = 0;
+    if (face.cmapFormat == 4) {
+        if (letter > 0xFFFF) {
+            return 0;
+        }
+        uint16_t segments = readU16(table + 6) / 2;
+        const uint8_t* ends = table + 14;
+        const uint8_t* starts = ends + segments * 2 + 2;
+        const uint8_t* deltas = starts + segments * 2;
+        const uint8_t* ranges = deltas + segments * 2;
+        // 二分查找第一个结束字符不小于letter的段
+        uint16_t low = 0, high = segments;
+        while (low < high) {
+            uint16_t mid = (low + high) / 2;
+            if (readU16(ends + mid * 2) < letter) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        if (low >= segments || readU16(starts + low * 2) > letter) {
+            return 0;
+        }
+        uint16_t delta = readU16(deltas + low * 2);
+        uint16_t rangeOffset = readU16(ranges + low * 2);
+        if (rangeOffset == 0) {
+            glyphId = (letter + delta) & 0xFFFF;
+        } else {
+            const uint8_t* entry = ranges + low * 2 + rangeOffset + (letter - readU16(starts + low * 2)) * 2;
+            if (entry + 2 > face.data + face.length) {
+                return 0;
+            }
+            glyphId = readU16(entry);
+            if (glyphId != 0) {
+                glyphId = (glyphId + delta) & 0xFFFF;
+            }
+        }
+    } else {
+        uint32_t low = 0, high = readU32(table + 12);
+        while (low < high) {
+            uint32_t mid = (low + high) / 2;
+            const uint8_t* group = table + 16 + mid * 12;
+            if (readU32(group + 4) < letter) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        const uint8_t* group = table + 16 + low * 12;
+        if (low >= readU32(table + 12) || readU32(group) > letter) {
+            return 0;
+        }
+        glyphId = readU32(group + 8) + (letter - readU32(group));
+    }
+    return glyphId < face.glyphCount ? glyphId : 0;
+}
+//*** 字形在glyf表中的数据
+bool TtfLoader::glyphData(const Face& face, uint16_t glyphId, const uint8_t*& data, uint32_t& length) {
+    if (glyphId >= face.glyphCount) {
+        return false;
+    }
+    const uint8_t* loca = face.data + face.loca;
+    uint32_t start, end;
+    if (face.longLoca) {
+        start = readU32(loca + glyphId * 4);
+        end = readU32(loca + glyphId * 4 + 4);
+    } else {
+        start = readU16(loca + glyphId * 2) * 2u;
+        end = readU16(loca + glyphId * 2 + 2) * 2u;
+    }
+    if (end < start || end > face.glyfLength) {
+        return false;
+    }
+    data = face.data + face.glyf + start;
+    length = end - start;
+    return true;
+}
+//*** 字形轮廓的水平偏移（字体单位）：与FreeType一致，把头部的最小x对齐到hmtx表中的左侧间距，
+// 组合字形中有部件标记为使用它的度量时按该部件计算
+int16_t TtfLoader::originShift(const Face& face, uint16_t glyphId, int depth) {
+    const uint8_t* data;
+    uint32_t length;
+    if (!glyphData(face, glyphId, data, length) || length < 10) {
+        return 0;
+    }
+    if (readI16(data) < 0 && depth < TTF_MAX_COMPONENT_DEPTH) {
+        const uint8_t* p = data + 10;
+        uint16_t flags;
+        do {
+            uint16_t component;
+            float combined[6];
+            float identity[6] = {1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f};
+            if (!readComponent(p, data + length, identity, component, flags, combined)) {
+                break;
+            }
+            if (flags & TTF_USE_MY_METRICS) {
+                return originShift(face, component, depth + 1);
+            }
+        } while (flags & TTF_MORE_COMPONENTS);
+    }
+    uint32_t offset = glyphId < face.hMetricCount ? glyphId * 4u + 2 : face.hMetricCount * 4u + (glyphId - face.hMetricCount) * 2u;
+    if (offset + 2 > face.hmtxLength) {
+        return 0;
+    }
+    return readI16(face.data + face.hmtx + offset) - readI16(data + 2);
+}
+//*** 按字号缩放的字形度量（边界框取整到像素）
+void TtfLoader::glyphBox(const SizedFont& font, uint16_t glyphId, lv_font_glyph_dsc_t& dsc) {
+    const Face& face = *font.face;
+    uint16_t metric = glyphId < face.hMetricCount ? glyphId : face.hMetricCount - 1;
+    dsc.adv_w = (uint16_t)(readU16(face.data + face.hmtx + metric * 4) * font.scale + 0.5f);
+    dsc.box_w = 0;
+    dsc.box_h = 0;
+    dsc.ofs_x = 0;
+    dsc.ofs_y = 0;
+    dsc.bpp = 4;
+    dsc.is_placeholder = 0;
+    float bounds[4] = {INFINITY, INFINITY, -INFINITY, -INFINITY};
+    float matrix[6] = {font.scale, 0.0f, 0.0f, font.scale, originShift(face, glyphId, 0) * font.scale, 0.0f};
+    if (!glyphBounds(face, glyphId, matrix, 0, bounds) || bounds[0] > bounds[2]) {
+        return;
+    }
+    // 与FreeType一致，缩放后的坐标先取整到1/64像素，轮廓恰好在像素边缘时不多出一列或一行
+    int x0 = (int)floorf(roundf(bounds[0] * 64.0f) / 64.0f);
+    int y0 = (int)floorf(roundf(bounds[1] * 64.0f) / 64.0f);
+    int x1 = (int)ceilf(roundf(bounds[2] * 64.0f) / 64.0f);
+    int y1 = (int)ceilf(roundf(bounds[3] * 64.0f) / 64.0f);
+    int extent = font.size * TTF_MAX_GLYPH_EXTENT;
+    if (x1 > x0 && y1 > y0 && x0 >= -extent && y0 >= -extent && x1 <= extent && y1 <= extent) {
+        dsc.box_w = x1 - x0;
+        dsc.box_h = y1 - y0;
+        dsc.ofs_x = x0;
+        dsc.ofs_y = y0;
+    }
+}
+//*** 字形经过matrix变换后的边界框，合并到bounds（最小x、最小y、最大x、最大y）
+bool TtfLoader::glyphBounds(const Face& face, uint16_t glyphId, const float* matrix, int depth, float* bounds) {
+    const uint8_t* data;
+    uint32_t length;
+    if (!glyphData(face, glyphId, data, length)) {
+        return false;
+    }
+    if (length == 0) {
+        return true;
+    }
+    if (length < 10) {
+        return false;
+    }
+    if (readI16(data) < 0) {
+        // 组合字形头部的边界框可能与部件不一致（如arial.ttf的U+0149），按部件的边界框重新计算
+        if (depth >= TTF_MAX_COMPONENT_DEPTH) {
+            return false;
+        }
+        const uint8_t* p = data + 10;
+        uint16_t flags;
+        do {
+            uint16_t component;
+            float combined[6];
+            if (!readComponent(p, data + length, matrix, component, flags, combined) ||
+                !glyphBounds(face, component, combined, depth + 1, bounds)) {
+                return false;
+            }
+        } while (flags & TTF_MORE_COMPONENTS);
+        return true;
+    }
+    // 简单字形使用头部的边界框，变换后取四个角的范围
+    float xs[2] = {(float)readI16(data + 2), (float)readI16(data + 6)};
+    float ys[2] = {(float)readI16(data + 4), (float)readI16(data + 8)};
+    for (int i = 0; i < 4; i++) {
+        float x = matrix[0] * xs[i & 1] + matrix[2] * ys[i >> 1] + matrix[4];
+        float y = matrix[1] * xs[i & 1] + matrix[3] * ys[i >> 1] + matrix[5];
+        bounds[0] = fminf(bounds[0], x);
+        bounds[1] = fminf(bounds[1], y);
+        bounds[2] = fmaxf(bounds[2], x);
+        bounds[3] = fmaxf(bounds[3], y);
+    }
+    return true;
+}
+//*** 字距（字体单位），没有kern表或没有这一对字形时为0
+int16_t TtfLoader::kerning(const Face& face, uint16_t left, uint16_t right) {
+    uint32_t key = ((uint32_t)left << 16) | right;
+    const uint8_t* pairs = face.data + face.kern;
+    int low = 0, high = face.kernPairs - 1;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        uint32_t value = readU32(pairs + mid * 6);
+        if (value == key) {
+            return readI16(pairs + mid * 6 + 4);
+        }
+        if (value < key) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return 0;
+}
+//*** 按需扩大光栅化缓冲区
+bool TtfLoader::ensureBuffers(size_t cells, uint16_t points) {
+    if (cells > coverageSize) {
+        ttfFree(coverage);
+        coverage = (float*)ttfMalloc(cells * sizeof(float));
+        coverageSize = coverage != nullptr ? cells : 0;
+        if (coverage == nullptr) {
+            return false;
+        }
+    }
+    if (points > pointCapacity) {
+        ttfFree(pointBuffer);
+        ttfFree(flagBuffer);
+        pointBuffer = (int16_t*)ttfMalloc(points * 2 * sizeof(int16_t));
+        flagBuffer = (uint8_t*)ttfMalloc(points);
+        pointCapacity = pointBuffer != nullptr && flagBuffer != nullptr ? points : 0;
+        if (pointCapacity == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+//*** 把字形轮廓（经过matrix变换到位图坐标）累加到光栅化缓冲区
+bool TtfLoader::drawGlyph(Raster& raster, const Face& face, uint16_t glyphId, const float* matrix, int depth) {
+    const uint8_t* data;
+    uint32_t length;
+    if (!glyphData(face, glyphId, data, length)) {
+        return false;
+    }
+    if (length == 0) {
+        return true;
+    }
+    if (length < 10) {
+        return false;
+    }
+    const uint8_t* end = data + length;
+    int16_t contours = readI16(data);
+    if (contours < 0) {
+        // 组合字形：依次绘制各部件，部件的变换与本字形的变换组合
+        if (depth >= TTF_MAX_COMPONENT_DEPTH) {
+            return false;
+        }
+        const uint8_t* p = data + 10;
+        uint16_t flags;
+        do {
+            uint16_t component;
+            float combined[6];
+            if (!readComponent(p, end, matrix, component, flags, combined) ||
+                !drawGlyph(raster, face, component, combined, depth + 1)) {
+                return false;
+            }
+        } while (flags & TTF_MORE_COMPONENTS);
+        return true;
+    }
+    // 简单字形：轮廓终点、指令（跳过）、标志和增量编码的坐标
+    const uint8_t* p = data + 10;
+    if (p + contours * 2 + 2 > end) {
+        return false;
+    }
+    uint16_t points = contours > 0 ? readU16(p + (contours - 1) * 2) + 1 : 0;
+    p += contours * 2;
+    uint16_t instructionLength = readU16(p);
+    if (instructionLength > end - p - 2) {
+        return false;
+    }
+    p += 2 + instructionLength;
+    if (points == 0) {
+        return true;
+    }
+    if (!ensureBuffers(0, points)) {
+        return false;
+    }
+    for (uint16_t i = 0; i < points;) {
+        if (p >= end) {
+            return false;
+        }
+        uint8_t flag = *p++;
+        flagBuffer[i++] = flag;
+        if (flag & 0x08) {
+            if (p >= end) {
+                return false;
+            }
+            for (uint8_t repeat = *p++; repeat > 0 && i < points; repeat--) {
+                flagBuffer[i++] = flag;
+            }
+        }
+    }
+    for (int axis = 0; axis < 2; axis++) {
+        uint8_t shortBit = axis == 0 ? 0x02 : 0x04;
+        uint8_t sameBit = axis == 0 ? 0x10 : 0x20;
+        int16_t value = 0;
+        for (uint16_t i = 0; i < points; i++) {
+            uint8_t flag = flagBuffer[i];
+            if (flag & shortBit) {
+                if (p >= end) {
+                    return false;
+                }
+                value += (flag & sameBit) ? *p : -*p;
+                p++;
+            } else if (!(flag & sameBit)) {
+                if (p + 2 > end) {
+                    return false;
+                }
+                value += readI16(p);
+                p += 2;
+            }
+            pointBuffer[i * 2 + axis] = value;
+        }
+    }
+    // 逐个轮廓输出线段和曲线：两个相邻的控制点之间隐含一个中点
+    uint16_t first = 0;
+    for (int contour = 0; contour < contours; contour++) {
+        uint16_t last = readU16(data + 10 + contour * 2);
+        if (last < first || last >= points) {
+            return false;
+        }
+        uint16_t count = last - first + 1;
+        float xs[2], ys[2];
+        auto point = [&](uint16_t i, float& x, float& y) {
+            float px = pointBuffer[(first + i) * 2];
+            float py = pointBuffer[(first + i) * 2 + 1];
+            x = matrix[0] * px + matrix[2] * py + matrix[4];
+            y = matrix[1] * px + matrix[3] * py + matrix[5];
+        };
+        auto onCurve = [&](uint16_t i) { return (flagBuffer[first + i] & 0x01) != 0; };
+        float startX, startY;
+        uint16_t begin = 0, stop = count;
+        if (onCurve(0)) {
+            point(0, startX, startY);
+            begin = 1;
+        } else if (onCurve(count - 1)) {
+            point(count - 1, startX, startY);
+            stop = count - 1;
+        } else {
+            point(0, xs[0], ys[0]);
+            point(count - 1, xs[1], ys[1]);
+            startX = 0.5f * (xs[0] + xs[1]);
+            startY = 0.5f * (ys[0] + ys[1]);
+        }
+        float curX = startX, curY = startY, ctrlX = 0, ctrlY = 0;
+        bool haveControl = false;
+        for (uint16_t i = begin; i < stop; i++) {
+            float x, y;
+            point(i, x, y);
+            if (onCurve(i)) {
+                if (haveControl) {
+                    raster.quad(curX, curY, ctrlX, ctrlY, x, y);
+                } else {
+                    raster.line(curX, curY, x, y);
+                }
+                curX = x;
+                curY = y;
+                haveControl = false;
+            } else {
+                if (haveControl) {
+                    float midX = 0.5f * (ctrlX + x);
+                    float midY = 0.5f * (ctrlY + y);
+                    raster.quad(curX, curY, ctrlX, ctrlY, midX, midY);
+                    curX = midX;
+                    curY = midY;
+                }
+                ctrlX = x;
+                ctrlY = y;
+                haveControl = true;
+            }
+        }
+        if (haveControl) {
+            raster.quad(curX, curY, ctrlX, ctrlY, startX, startY);
+        } else {
+            raster.line(curX, curY, startX, startY);
+        }
+        first = last + 1;
+    }
+    return true;
+}
+//*** 光栅化字形，返回新分配的4位灰度位图，失败时返回nullptr
+uint8_t* TtfLoader::rasterize(SizedFont& font, uint16_t glyphId, const lv_font_glyph_dsc_t& dsc, uint32_t& size) {
+    int width = dsc.box_w;
+    int height = dsc.box_h;
+    size_t cells = (size_t)(width + 2) * height;
+    if (!ensureBuffers(cells, 0)) {
+        return nullptr;
+    }
+    memset(coverage, 0, cells * sizeof(float));
+    Raster raster = {coverage, width, height, width + 2};
+    // 字体单位（y向上）到位图像素（y向下，原点在边界框左上角）的变换
+    float matrix[6] = {font.scale, 0.0f, 0.0f, -font.scale, originShift(*font.face, glyphId, 0) * font.scale - dsc.ofs_x,
+                       (float)(dsc.ofs_y + height)};
+    if (!drawGlyph(raster, *font.face, glyphId, matrix, 0)) {
+        return nullptr;
+    }
+    size = (width * height + 1) / 2;
+    uint8_t* bitmap = (uint8_t*)ttfMalloc(size);
+    if (bitmap == nullptr) {
+        return nullptr;
+    }
+    // 每行从左到右累加面积得到覆盖率，按LVGL的格式连续打包（行之间不对齐，前一个像素在高4位）
+    uint32_t pixel = 0;
+    for (int y = 0; y < height; y++) {
+        const float* row = coverage + y * raster.stride;
+        float sum = 0.0f;
+        for (int x = 0; x < width; x++, pixel++) {
+            sum += row[x];
+            float value = fminf(fabsf(sum), 1.0f);
+            uint8_t level = (uint8_t)(value * 15.0f + 0.5f);
+            if (pixel & 1) {
+                bitmap[pixel >> 1] |= level;
+            } else {
+                bitmap[pixel >> 1] = level << 4;
+            }
+        }
+    }
+    return bitmap;
+}
+//*** 字形缓存的哈希值
+uint32_t TtfLoader::hashKey(uint8_t fontIndex, uint16_t glyphId) {
+    return (glyphId * 2654435761u + fontIndex * 40503u) >> 16;
+}
+//*** 查找缓存的字形
+int16_t TtfLoader::findGlyph(uint8_t fontIndex, uint16_t glyphId) {
+    int16_t index = buckets[hashKey(fontIndex, glyphId) & (TTF_GLYPH_CACHE_BUCKETS - 1)];
+    while (index >= 0) {
+        const GlyphEntry& entry = entries[index];
+        if (entry.glyphId == glyphId && entry.fontIndex == fontIndex) {
+            return index;
+        }
+        index = entry.hashNext;
+    }
+    return -1;
+}
+//*** 从最近使用链表中移除
+void TtfLoader::unlinkGlyph(int16_t index) {
+    GlyphEntry& entry = entries[index];
+    if (entry.prev >= 0) {
+        entries[entry.prev].next = entry.next;
+    } else {
+        lruHead = entry.next;
+    }
+    if (entry.next >= 0) {
+        entries[entry.next].prev = entry.prev;
+    } else {
+        lruTail = entry.prev;
+    }
+}
+//*** 移到最近使用链表的头部
+void TtfLoader::touchGlyph(int16_t index) {
+    if (lruHead == index) {
+        return;
+    }
+    unlinkGlyph(index);
+    GlyphEntry& entry = entries[index];
+    entry.prev = -1;
+    entry.next = lruHead;
+    if (lruHead >= 0) {
+        entries[lruHead].prev = index;
+    }
+    lruHead = index;
+    if (lruTail < 0) {
+        lruTail = index;
+    }
+}
+//*** 释放最久未使用的字形
+void TtfLoader::evictOldest() {
+    int16_t index = lruTail;
+    if (index < 0) {
+        return;
+    }
+    GlyphEntry& entry = entries[index];
+    unlinkGlyph(index);
+    // 从哈希桶中移除
+    int16_t* link = &buckets[hashKey(entry.fontIndex, entry.glyphId) & (TTF_GLYPH_CACHE_BUCKETS - 1)];
+    while (*link != index) {
+        link = &entries[*link].hashNext;
+    }
+    *link = entry.hashNext;
+    ttfFree(entry.bitmap);
+    cacheBytes -= entry.size;
+    entry.bitmap = nullptr;
+    entry.next = freeHead;
+    freeHead = index;
+    evictions++;
+}
+//*** 把字形放入缓存，返回缓存中的位图
+const uint8_t* TtfLoader::insertGlyph(uint8_t fontIndex, uint16_t glyphId, uint8_t* bitmap, uint32_t size) {
+    while (lruTail >= 0 && (freeHead < 0 || cacheBytes + size > TTF_GLYPH_CACHE_BUDGET)) {
+        evictOldest();
+    }
+    int16_t index = freeHead;
+    GlyphEntry& entry = entries[index];
+    freeHead = entry.next;
+    entry.bitmap = bitmap;
+    entry.size = size;
+    entry.glyphId = glyphId;
+    entry.fontIndex = fontIndex;
+    int16_t* bucket = &buckets[hashKey(fontIndex, glyphId) & (TTF_GLYPH_CACHE_BUCKETS - 1)];
+    entry.hashNext = *bucket;
+    *bucket = index;
+    entry.prev = -1;
+    entry.next = lruHead;
+    if (lruHead >= 0) {
+        entries[lruHead].prev = index;
+    }
+    lruHead = index;
+    if (lruTail < 0) {
+        lruTail = index;
+    }
+    cacheBytes += size;
+    return bitmap;
+}
+//*** 字符对应的字形编号
+uint16_t TtfLoader::lookup(SizedFont& font, uint32_t letter) {
+    if (letter != font.lastLetter) {
+        font.lastLetter = letter;
+        font.lastGlyph = glyphIndex(*font.face, letter);
+    }
+    return font.lastGlyph;
+}
+//*** LVGL字体回调：字形度量
+bool TtfLoader::glyphDscCallback(const lv_font_t* font, lv_font_glyph_dsc_t* dsc, uint32_t letter, uint32_t letterNext) {
+    TtfLoader* self = getInstance();
+    SizedFont* sized = (SizedFont*)font->user_data;
+    bool tab = letter == '\t';
+    if (tab) {
+        letter = ' ';
+    }
+    uint16_t glyphId = self->lookup(*sized, letter);
+    if (glyphId == 0) {
+        return false;
+    }
+    self->glyphBox(*sized, glyphId, *dsc);
+    if (sized->face->kernPairs > 0 && letterNext != 0) {
+        uint16_t nextId = self->glyphIndex(*sized->face, letterNext);
+        if (nextId != 0) {
+            dsc->adv_w += (int)lroundf(self->kerning(*sized->face, glyphId, nextId) * sized->scale);
+        }
+    }
+    if (tab) {
+        dsc->adv_w *= 2;
+    }
+    return true;
+}
+//*** LVGL字体回调：从缓存获取字形位图，未命中时光栅化
+const uint8_t* TtfLoader::glyphBitmapCallback(const lv_font_t* font, uint32_t letter) {
+    TtfLoader* self = getInstance();
+    SizedFont* sized = (SizedFont*)font->user_data;
+    if (letter == '\t') {
+        letter = ' ';
+    }
+    uint16_t glyphId = self->lookup(*sized, letter);
+    if (glyphId == 0) {
+        return nullptr;
+    }
+    int16_t index = self->findGlyph(sized->index, glyphId);
+    if (index >= 0) {
+        sized->hits++;
+        self->touchGlyph(index);
+        return self->entries[index].bitmap;
+    }
+    unsigned long startTime = micros();
+    lv_font_glyph_dsc_t dsc;
+    self->glyphBox(*sized, glyphId, dsc);
+    if (dsc.box_w == 0) {
+        return nullptr;
+    }
+    uint32_t size = 0;
+    uint8_t* bitmap = self->rasterize(*sized, glyphId, dsc, size);
+    sized->misses++;
+    sized->rasterMicros += micros() - startTime;
+    if (bitmap == nullptr) {
+        return nullptr;
+    }
+    return self->insertGlyph(sized->index, glyphId, bitmap, size);
+}
+//*** 字体是否为本类生成的字体
+bool TtfLoader::isLoaded(const lv_font_t* font) {
+    for (int i = 0; i < fontCount; i++) {
+        if (font == &fonts[i].font) {
+            return true;
+        }
+    }
+    return false;
+}
+//*** 清空字形缓存
+void TtfLoader::clearCache() {
+    while (lruTail >= 0) {
+        evictOldest();
+    }
+}
+//*** 字形缓存的命中次数和未命中次数
+void TtfLoader::getCacheCounts(uint32_t& hits, uint32_t& misses) {
+    hits = 0;
+    misses = 0;
+    for (int i = 0; i < fontCount; i++) {
+        hits += fonts[i].hits;
+        misses += fonts[i].misses;
+    }
+}
+#ifndef ARDUINO
+//*** 设置代替SPIFFS的目录
+void TtfLoader::setFontDir(const char* dir) {
+    snprintf(fontDir, sizeof(fontDir), "%s", dir);
+}
+//*** 模拟重启：释放所有字体文件、字体和缓存的字形
+void TtfLoader::reset() {
+    clearCache();
+    for (int i = 0; i < faceCount; i++) {
+        if (!faces[i].fromAssets) {
+            ttfFree((void*)faces[i].data);
+        }
+    }
+    ttfFree(coverage);
+    ttfFree(pointBuffer);
+    ttfFree(flagBuffer);
+    *this = TtfLoader();
+}
+#else
+//*** 生成统计JSON
+String TtfLoader::getStatsJson() {
+    JsonDocument doc;
+    int cached = 0;
+    for (int16_t index = lruHead; index >= 0; index = entries[index].next) {
+        cached++;
+    }
+    JsonObject cache = doc["glyph_cache"].to<JsonObject>();
+    cache["budget_bytes"] = TTF_GLYPH_CACHE_BUDGET;
+    cache["used_bytes"] = cacheBytes;
+    cache["glyphs"] = cached;
+    cache["evictions"] = evictions;
+    cache["raster_buffer_bytes"] = coverageSize * sizeof(float);
+    JsonArray faceList = doc["faces"].to<JsonArray>();
+    for (int i = 0; i < faceCount; i++) {
+        const Face& face = faces[i];
+        JsonObject item = faceList.add<JsonObject>();
+        item["name"] = face.name;
+        item["source"] = face.fromAssets ? "assets" : "spiffs";
+        item["bytes"] = face.length;
+        item["glyphs"] = face.glyphCount;
+        item["units_per_em"] = face.unitsPerEm;
+        item["cmap_format"] = face.cmapFormat;
+        item["kern_pairs"] = face.kernPairs;
+        item["load_ms"] = face.loadMillis;
+    }
+    JsonArray fontList = doc["fonts"].to<JsonArray>();
+    for (int i = 0; i < fontCount; i++) {
+        const SizedFont& sized = fonts[i];
+        uint32_t lookups = sized.hits + sized.misses;
+        JsonObject item = fontList.add<JsonObject>();
+        item["face"] = sized.face->name;
+        item["size"] = sized.size;
+        item["line_height"] = sized.font.line_height;
+        item["hits"] = sized.hits;
+        item["misses"] = sized.misses;
+        item["hit_rate"] = lookups > 0 ? (float)sized.hits / lookups : 0;
+        item["avg_raster_us"] = sized.misses > 0 ? (uint32_t)(sized.rasterMicros / sized.misses) : 0;
+    }
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+#endif
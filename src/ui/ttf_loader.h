@@ -0,0 +1,174 @@
+#ifndef TTF_LOADER_H
+#define TTF_LOADER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// SPIFFS中轮廓字体文件的位置：<目录><名称>.ttf（资源分区中没有同名轮廓字体时使用，整个文件读入PSRAM）
+#define TTF_LOADER_DIR "/fonts/"
+// 最多打开的字体文件数和字体（字体文件加字号）数
+const int TTF_MAX_FACES = 2;
+const int TTF_MAX_FONTS = 8;
+const int TTF_NAME_SIZE = 16;
+// 支持的字号（像素）
+const uint16_t TTF_MIN_SIZE = 8;
+const uint16_t TTF_MAX_SIZE = 200;
+// 字形位图缓存的PSRAM预算（字节），大字号的字形占用更多预算，超出时按最近最少使用顺序释放
+const size_t TTF_GLYPH_CACHE_BUDGET = 128 * 1024;
+// 最多缓存的字形数量和哈希表大小（2的幂）
+const int TTF_GLYPH_CACHE_ENTRIES = 512;
+const int TTF_GLYPH_CACHE_BUCKETS = 256;
+
+/**
+ * TrueType轮廓字体类
+ * 从资源分区（映射的Flash，不复制）或SPIFFS读取TrueType字体（glyf轮廓，cmap格式4或12，kern表格式0），
+ * 同一个字体文件可以生成任意字号的LVGL字体：字形度量由轮廓的边界框和水平度量按字号缩放得到，
+ * 字形第一次绘制时把二次贝塞尔轮廓展平为线段，按面积累加计算每个像素的覆盖率（不使用hinting），
+ * 生成4位灰度位图放入按字号和字形编号查找的PSRAM缓存，之后的绘制直接使用缓存的位图。
+ * 字体中没有的字符使用原来的字体（fallback）
+ */
+class TtfLoader {
+private:
+    static TtfLoader* instance;    // 单例实例
+
+    // 字体文件
+    struct Face {
+        char name[TTF_NAME_SIZE];
+        const uint8_t* data;       // 字体文件数据（资源分区映射或PSRAM）
+        uint32_t length;
+        bool fromAssets;           // 数据在资源分区中（不需要释放）
+        uint16_t unitsPerEm;
+        int16_t ascender;
+        int16_t descender;
+        int16_t lineGap;
+        uint16_t glyphCount;
+        uint16_t hMetricCount;     // hmtx表中完整水平度量的数量
+        bool longLoca;             // loca表使用32位偏移
+        uint32_t loca;             // 各表在文件中的位置
+        uint32_t glyf;
+        uint32_t glyfLength;
+        uint32_t hmtx;
+        uint32_t hmtxLength;
+        uint32_t cmap;             // 使用的cmap子表
+        uint16_t cmapFormat;       // 4或12
+        uint32_t kern;             // kern表格式0子表，没有时为0
+        uint16_t kernPairs;
+        uint32_t loadMillis;       // 加载耗时
+    };
+    Face faces[TTF_MAX_FACES];
+    int faceCount;
+
+    // 找不到文件或加载失败的字体名称（不再重复尝试）
+    char missing[TTF_MAX_FONTS][TTF_NAME_SIZE];
+    int missingCount;
+
+    // 字体（字体文件加字号）
+    struct SizedFont {
+        lv_font_t font;            // LVGL字体（回调为本类的函数，user_data指向本结构）
+        Face* face;
+        uint16_t size;             // 字号（像素，即每em的像素数）
+        float scale;               // 字体单位到像素的比例
+        uint8_t index;             // 在fonts中的位置（字形缓存的键）
+        uint32_t lastLetter;       // 最近查找的字符和字形编号
+        uint16_t lastGlyph;
+        uint32_t hits;             // 字形缓存命中次数
+        uint32_t misses;           // 字形缓存未命中（光栅化）次数
+        uint64_t rasterMicros;     // 光栅化的累计耗时
+    };
+    SizedFont fonts[TTF_MAX_FONTS];
+    int fontCount;
+
+    // 字形缓存条目（按字体和字形编号查找）
+    struct GlyphEntry {
+        uint8_t* bitmap;           // 字形位图（4位灰度，PSRAM），为空表示空闲条目
+        uint32_t size;
+        uint16_t glyphId;
+        uint8_t fontIndex;
+        int16_t hashNext;          // 同一哈希桶中的下一个条目
+        int16_t prev;              // 最近使用链表（头部最新）
+        int16_t next;
+    };
+    GlyphEntry entries[TTF_GLYPH_CACHE_ENTRIES];
+    int16_t buckets[TTF_GLYPH_CACHE_BUCKETS];
+    int16_t lruHead;
+    int16_t lruTail;
+    int16_t freeHead;              // 空闲条目链表（通过next连接）
+    size_t cacheBytes;             // 缓存占用的字节数
+    uint32_t evictions;            // 因预算释放的字形数
+
+    // 光栅化使用的缓冲区（只在显示任务中使用，按需扩大）
+    float* coverage;               // 每行多两个单元的面积累加缓冲区
+    size_t coverageSize;
+    int16_t* pointBuffer;          // 字形的点坐标和标志
+    uint8_t* flagBuffer;
+    uint16_t pointCapacity;
+
+    // 私有构造函数（单例模式）
+    TtfLoader();
+
+    // 打开字体文件，失败时返回nullptr
+    Face* openFace(const char* name);
+    bool parseFace(Face& face);
+
+    // 字体文件中的字符、字形和度量
+    uint16_t glyphIndex(const Face& face, uint32_t letter);
+    bool glyphData(const Face& face, uint16_t glyphId, const uint8_t*& data, uint32_t& length);
+    int16_t originShift(const Face& face, uint16_t glyphId, int depth);
+    bool glyphBounds(const Face& face, uint16_t glyphId, const float* matrix, int depth, float* bounds);
+    void glyphBox(const SizedFont& font, uint16_t glyphId, lv_font_glyph_dsc_t& dsc);
+    int16_t kerning(const Face& face, uint16_t left, uint16_t right);
+
+    // 光栅化
+    struct Raster;
+    bool ensureBuffers(size_t cells, uint16_t points);
+    bool drawGlyph(Raster& raster, const Face& face, uint16_t glyphId, const float* matrix, int depth);
+    uint8_t* rasterize(SizedFont& font, uint16_t glyphId, const lv_font_glyph_dsc_t& dsc, uint32_t& size);
+
+    // 字形缓存操作
+    static uint32_t hashKey(uint8_t fontIndex, uint16_t glyphId);
+    int16_t findGlyph(uint8_t fontIndex, uint16_t glyphId);
+    void touchGlyph(int16_t index);
+    void unlinkGlyph(int16_t index);
+    void evictOldest();
+    const uint8_t* insertGlyph(uint8_t fontIndex, uint16_t glyphId, uint8_t* bitmap, uint32_t size);
+
+    // 字符对应的字形编号（使用最近查找的字符）
+    uint16_t lookup(SizedFont& font, uint32_t letter);
+
+    // LVGL字体回调
+    static bool glyphDscCallback(const lv_font_t* font, lv_font_glyph_dsc_t* dsc, uint32_t letter, uint32_t letterNext);
+    static const uint8_t* glyphBitmapCallback(const lv_font_t* font, uint32_t letter);
+
+public:
+    // 获取单例实例
+    static TtfLoader* getInstance();
+
+    // 获取指定字体文件和字号的字体（第一次使用时打开资源分区中或SPIFFS中<目录><名称>.ttf），
+    // 没有字体文件、字号超出范围或没有空闲位置时返回fallback（只在显示任务中调用）
+    const lv_font_t* font(const char* name, uint16_t size, const lv_font_t* fallback);
+
+    // 是否有指定名称的字体文件（第一次调用时尝试打开）
+    bool hasFace(const char* name);
+
+    // 字体是否为本类生成的字体
+    bool isLoaded(const lv_font_t* font);
+
+    // 清空字形缓存（性能测试中测量第一次绘制的耗时）
+    void clearCache();
+
+    // 字形缓存的命中次数和未命中次数（所有字体合计）
+    void getCacheCounts(uint32_t& hits, uint32_t& misses);
+
+#ifndef ARDUINO
+    // 设置代替SPIFFS的目录（Linux上测试使用，字体文件为<目录>/fonts/<名称>.ttf）
+    static void setFontDir(const char* dir);
+
+    // 模拟重启：释放所有字体文件、字体和缓存的字形（之前返回的字体不能再使用）
+    void reset();
+#else
+    // 生成统计JSON：各字体文件和字号的光栅化次数和耗时，以及字形缓存的占用
+    String getStatsJson();
+#endif
+};
+
+#endif // TTF_LOADER_H
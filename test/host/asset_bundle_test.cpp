@@ -0,0 +1,192 @@
+// 资源包的映射与解析：用tools/asset_packer.py打包的资源包（见test/host/Makefile）经AssetBundle::mapFile映射后，
+// 图像描述符须与src/images中编译进固件的图像相同，simsun_16_cjk的每个字形（含压缩位图的版本）须与LVGL中编译的
+// 字体相同；改动一个字节、截断或头部错误的资源包须被拒绝（在PC上运行，见test/host/Makefile）
+#include "manager/asset_bundle.h"
+#include "images/images.h"
+#include <lvgl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            printf("  失败: %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                    \
+        }                                                                  \
+    } while (0)
+
+// 由Makefile用asset_packer.py生成：assets/images中的图像和simsun_16_cjk，以及只含压缩位图字体的资源包
+const char* BUNDLE_PATH = "build/assets.bin";
+const char* COMPRESSED_BUNDLE_PATH = "build/assets_compressed.bin";
+const char* CORRUPT_PATH = "build/assets_corrupt.bin";
+const char* FONT_NAME = "simsun_16_cjk";
+
+// 编译进固件的图像
+struct CompiledImage {
+    const char* name;
+    const lv_img_dsc_t* dsc;
+};
+const CompiledImage IMAGES[] = {
+    {"astronauts", &astronauts}, {"calendar", &calendar}, {"iciba", &iciba},
+    {"maoselect", &maoselect},   {"soul", &soul},         {"taxicsoul", &taxicsoul},
+};
+
+//*** 读取整个文件
+static bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        data.insert(data.end(), buf, buf + n);
+    }
+    fclose(file);
+    return true;
+}
+
+//*** 写入整个文件
+static bool writeFile(const char* path, const std::vector<uint8_t>& data) {
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+    fclose(file);
+    return ok;
+}
+
+//*** 写入修改后的资源包并映射，返回是否被接受
+static bool mapModified(const std::vector<uint8_t>& data) {
+    CHECK(writeFile(CORRUPT_PATH, data));
+    return AssetBundle::getInstance()->mapFile(CORRUPT_PATH);
+}
+
+//*** 逐个码位比较两个字体的字形描述和位图，返回比较的字形数
+static int compareFonts(const lv_font_t* actual, const lv_font_t* expected) {
+    CHECK(actual->line_height == expected->line_height);
+    CHECK(actual->base_line == expected->base_line);
+    CHECK(actual->subpx == expected->subpx);
+    CHECK(actual->underline_position == expected->underline_position);
+    CHECK(actual->underline_thickness == expected->underline_thickness);
+    int glyphs = 0;
+    int mismatches = 0;
+    for (uint32_t letter = 0; letter < 0x10000 && mismatches < 5; letter++) {
+        lv_font_glyph_dsc_t a;
+        lv_font_glyph_dsc_t e;
+        memset(&a, 0, sizeof(a));
+        memset(&e, 0, sizeof(e));
+        bool foundA = lv_font_get_glyph_dsc(actual, &a, letter, 0);
+        bool foundE = lv_font_get_glyph_dsc(expected, &e, letter, 0);
+        bool same = foundA == foundE;
+        if (same && foundE) {
+            same = a.adv_w == e.adv_w && a.box_w == e.box_w && a.box_h == e.box_h && a.ofs_x == e.ofs_x &&
+                   a.ofs_y == e.ofs_y && a.bpp == e.bpp;
+            // 比较位图（压缩的位图由LVGL解压到同一个缓冲区，须先复制期望的位图）
+            size_t bytes = ((size_t)e.box_w * e.box_h * e.bpp + 7) / 8;
+            const uint8_t* bitmapE = lv_font_get_glyph_bitmap(expected, letter);
+            std::vector<uint8_t> copy(bitmapE, bitmapE + (bitmapE != nullptr ? bytes : 0));
+            const uint8_t* bitmapA = lv_font_get_glyph_bitmap(actual, letter);
+            if (bytes > 0) {
+                same = same && bitmapE != nullptr && bitmapA != nullptr && memcmp(bitmapA, copy.data(), bytes) == 0;
+            }
+            glyphs++;
+        }
+        if (!same) {
+            printf("  U+%04X 不同\n", (unsigned)letter);
+            mismatches++;
+        }
+    }
+    CHECK(mismatches == 0);
+    return glyphs;
+}
+
+int main() {
+    lv_init();
+    AssetBundle* bundle = AssetBundle::getInstance();
+    std::vector<uint8_t> original;
+    CHECK(readFile(BUNDLE_PATH, original));
+    if (original.size() < ASSET_BUNDLE_HEADER_SIZE) {
+        printf("无法读取%s（须在test/host中运行，由make生成）\n", BUNDLE_PATH);
+        return 1;
+    }
+
+    // 改动的资源包须被拒绝：数据中间（字体位图）、索引、CRC字段各改一个字节，截断，以及头部的标记和版本
+    const size_t flips[] = {original.size() - 100, original.size() / 2, ASSET_BUNDLE_HEADER_SIZE + 3, 12};
+    for (size_t offset : flips) {
+        std::vector<uint8_t> data = original;
+        data[offset] ^= 0x01;
+        CHECK(!mapModified(data));
+    }
+    std::vector<uint8_t> data = original;
+    data.resize(original.size() - 4);
+    CHECK(!mapModified(data));
+    data = original;
+    data[0] = 'X';
+    CHECK(!mapModified(data));
+    data = original;
+    data[4] = ASSET_BUNDLE_VERSION + 1;
+    CHECK(!mapModified(data));
+    CHECK(!bundle->mapFile("build/no_such_bundle.bin"));
+    CHECK(!bundle->isReady());
+    remove(CORRUPT_PATH);
+    printf("改动的资源包 %zu 个均被拒绝\n", sizeof(flips) / sizeof(flips[0]) + 3);
+
+    // 压缩位图的字体：字形由LVGL解压后须与未压缩的编译字体相同
+    CHECK(bundle->mapFile(COMPRESSED_BUNDLE_PATH));
+    const lv_font_t* compressed = bundle->getFont(FONT_NAME);
+    CHECK(compressed != nullptr);
+    if (compressed != nullptr) {
+        CHECK(((const lv_font_fmt_txt_dsc_t*)compressed->dsc)->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED);
+        int glyphs = compareFonts(compressed, &lv_font_simsun_16_cjk);
+        printf("%-14s 压缩位图 %d 个字形一致\n", FONT_NAME, glyphs);
+    }
+
+    // 完整的资源包
+    CHECK(bundle->mapFile(BUNDLE_PATH));
+    CHECK(bundle->isReady());
+    for (const CompiledImage& image : IMAGES) {
+        const lv_img_dsc_t* dsc = bundle->getImage(image.name);
+        CHECK(dsc != nullptr);
+        if (dsc == nullptr) {
+            continue;
+        }
+        CHECK(dsc->header.cf == image.dsc->header.cf);
+        CHECK(dsc->header.w == image.dsc->header.w && dsc->header.h == image.dsc->header.h);
+        CHECK(dsc->header.always_zero == 0 && dsc->header.reserved == 0);
+        CHECK(dsc->data_size == image.dsc->data_size);
+        CHECK(memcmp(dsc->data, image.dsc->data, image.dsc->data_size) == 0);
+        // 描述符指向映射的数据，不是编译进固件的数组
+        CHECK(dsc->data != image.dsc->data);
+        CHECK(bundle->image(image.name, image.dsc) == dsc);
+        printf("%-14s %3ux%-3u cf=%-2u %6u字节 一致\n", image.name, dsc->header.w, dsc->header.h, dsc->header.cf,
+               dsc->data_size);
+    }
+    const lv_font_t* font = bundle->getFont(FONT_NAME);
+    CHECK(font != nullptr);
+    if (font != nullptr) {
+        CHECK(((const lv_font_fmt_txt_dsc_t*)font->dsc)->bitmap_format == LV_FONT_FMT_TXT_PLAIN);
+        int glyphs = compareFonts(font, &lv_font_simsun_16_cjk);
+        CHECK(glyphs > 1000);
+        printf("%-14s 行高%d %d 个字形一致\n", FONT_NAME, font->line_height, glyphs);
+    }
+    // 不存在的资源使用编译进固件的版本，类型不同的同名资源不匹配
+    CHECK(bundle->getImage("no_such_image") == nullptr);
+    CHECK(bundle->image("no_such_image", &calendar) == &calendar);
+    CHECK(bundle->font("no_such_font", &lv_font_simsun_16_cjk) == &lv_font_simsun_16_cjk);
+    CHECK(bundle->getFont("calendar") == nullptr);
+    CHECK(bundle->getImage(FONT_NAME) == nullptr);
+
+    if (failures > 0) {
+        printf("asset_bundle_test: %d 项失败\n", failures);
+        return 1;
+    }
+    printf("asset_bundle_test: 全部通过\n");
+    return 0;
+}
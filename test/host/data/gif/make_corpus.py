@@ -0,0 +1,541 @@
+#!/usr/bin/env python3
+# 生成gif_decoder_test使用的GIF样本和每个样本逐帧的参考画布（固定内容，重复运行得到相同的文件）
+# 用法：cd test/host/data/gif && python3 make_corpus.py
+# 样本覆盖处置方式2和3、透明色、局部颜色表、交错存储、超出画布的帧、LZW编码宽度增长到12位和清除码、
+# 跳过的扩展块以及在帧数据、子块长度和图形控制扩展中间截断的文件；bad_开头的样本应在文件头或第一帧被拒绝。
+#
+# 参考画布由本文件中的模型按固件的约定合成（见src/ui/gif_decoder.h）：
+#   - 画布初始为全局颜色表的背景色，没有全局颜色表时为黑色；颜色按lv_color_make转换为RGB565
+#   - 处置方式2恢复为背景色，上一帧带透明色时恢复为黑色（屏幕背景）；处置方式3恢复为绘制上一帧之前的内容
+#   - 改变矩形是处置和绘制时值实际改变的像素的外接矩形
+#   - 数据结束（或截断）后回到第一帧；帧数据中间截断时保留已解码的像素
+# 每个样本的.expect文件（小端）：'GEXP'，文件头是否有效(u8)，宽(u16)，高(u16)，记录数(u16)，
+# 然后每次decodeNextFrame一条记录：是否成功(u8)，改变矩形x1,y1,x2,y2(i16，没有改变时为0,0,-1,-1)，
+# 帧间隔(u16，毫秒)，成功时再跟整幅RGB565画布(u16)
+import os
+import struct
+
+OUT = os.path.dirname(os.path.abspath(__file__))
+
+
+# ---------------------------------------------------------------- 编码
+
+def lzw_encode(indices, min_size):
+    """GIF的LZW编码（变长编码，表满时发清除码），返回字节串"""
+    clear = 1 << min_size
+    end = clear + 1
+    out = bytearray()
+    state = [0, 0]  # 位缓冲，位数
+
+    def emit(code, size):
+        state[0] |= code << state[1]
+        state[1] += size
+        while state[1] >= 8:
+            out.append(state[0] & 255)
+            state[0] >>= 8
+            state[1] -= 8
+
+    size = min_size + 1
+    table = {}
+    next_code = end + 1
+    emit(clear, size)
+    prefix = None
+    for px in indices:
+        if prefix is None:
+            prefix = px
+            continue
+        key = (prefix, px)
+        if key in table:
+            prefix = table[key]
+            continue
+        emit(prefix, size)
+        if next_code < 4096:
+            table[key] = next_code
+            next_code += 1
+            # 解码器比编码器晚一个表项，编码器在下一个编码超出当前宽度时才加宽
+            if next_code > (1 << size) and size < 12:
+                size += 1
+        else:
+            emit(clear, size)
+            table = {}
+            next_code = end + 1
+            size = min_size + 1
+        prefix = px
+    if prefix is not None:
+        emit(prefix, size)
+    emit(end, size)
+    if state[1] > 0:
+        out.append(state[0] & 255)
+    return bytes(out)
+
+
+def lzw_decode(data, min_size, count):
+    """独立的LZW解码，用于检查编码器"""
+    clear = 1 << min_size
+    end = clear + 1
+    size = min_size + 1
+    table = [[i] for i in range(clear)] + [None, None]
+    bits = 0
+    nbits = 0
+    pos = 0
+    out = []
+    prev = None
+    while len(out) < count:
+        while nbits < size:
+            bits |= data[pos] << nbits
+            pos += 1
+            nbits += 8
+        code = bits & ((1 << size) - 1)
+        bits >>= size
+        nbits -= size
+        if code == clear:
+            size = min_size + 1
+            table = table[:end + 1]
+            prev = None
+            continue
+        if code == end:
+            break
+        if prev is None:
+            entry = table[code]
+        elif code < len(table):
+            entry = table[code]
+            table.append(prev + entry[:1])
+        else:
+            assert code == len(table)
+            entry = prev + prev[:1]
+            table.append(entry)
+        out.extend(entry)
+        prev = entry
+        if len(table) == (1 << size) and size < 12:
+            size += 1
+    return out
+
+
+def sub_blocks(data, block):
+    out = bytearray()
+    for i in range(0, len(data), block):
+        chunk = data[i:i + block]
+        out.append(len(chunk))
+        out += chunk
+    out.append(0)
+    return bytes(out)
+
+
+def palette_bytes(colors):
+    """颜色表补足到2的幂（至少2项），返回(字节, 大小字段)"""
+    n = 2
+    while n < len(colors):
+        n *= 2
+    padded = list(colors) + [(0, 0, 0)] * (n - len(colors))
+    return b''.join(bytes(c) for c in padded), n.bit_length() - 2
+
+
+def interlace_order(h):
+    rows = []
+    for start, step in ((0, 8), (4, 8), (2, 4), (1, 2)):
+        rows.extend(range(start, h, step))
+    return rows
+
+
+class Gif:
+    """按帧构造GIF文件，记录每帧图像数据的位置以便截断"""
+
+    def __init__(self, w, h, palette=None, bg=0):
+        self.out = bytearray(b'GIF89a')
+        flags = 0
+        table = b''
+        if palette is not None:
+            table, field = palette_bytes(palette)
+            flags = 0x80 | 0x70 | field
+        self.out += struct.pack('<HHBBB', w, h, flags, bg, 0)
+        self.out += table
+        self.frames = []   # 每帧(GCE位置, 图像描述符位置, 图像数据位置)
+
+    def extension(self, label, payload):
+        self.out += bytes([0x21, label]) + sub_blocks(payload, 255)
+
+    def frame(self, x, y, w, h, pixels, disposal=1, transparent=None, delay=5, local=None,
+              interlaced=False, min_size=None, block=255, gce=True):
+        assert len(pixels) == w * h
+        gce_pos = len(self.out)
+        if gce:
+            flags = (disposal << 2) | (1 if transparent is not None else 0)
+            self.out += bytes([0x21, 0xF9, 4, flags]) + struct.pack('<HB', delay, transparent or 0) + b'\0'
+        desc_pos = len(self.out)
+        flags = 0x40 if interlaced else 0
+        table = b''
+        colors = local
+        if local is not None:
+            table, field = palette_bytes(local)
+            flags |= 0x80 | field
+        self.out += b',' + struct.pack('<HHHHB', x, y, w, h, flags) + table
+        top = max(pixels)
+        if min_size is None:
+            min_size = max(2, top.bit_length())
+        rows = [pixels[r * w:(r + 1) * w] for r in range(h)]
+        if interlaced:
+            order = interlace_order(h)
+            stream = [p for r in order for p in rows[r]]
+        else:
+            stream = list(pixels)
+        encoded = lzw_encode(stream, min_size)
+        assert lzw_decode(encoded, min_size, len(stream)) == stream
+        data_pos = len(self.out)
+        self.out += bytes([min_size]) + sub_blocks(encoded, block)
+        self.frames.append((gce_pos, desc_pos, data_pos))
+        return colors
+
+    def bytes(self, trailer=True):
+        return bytes(self.out) + (b';' if trailer else b'')
+
+
+# ---------------------------------------------------------------- 参考模型
+
+def rgb565(c):
+    r, g, b = c
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+class HeaderError(Exception):
+    pass
+
+
+class Model:
+    """按固件的约定逐帧合成画布"""
+
+    def __init__(self, data):
+        self.d = data
+        self.p = 0
+        sig = self.read_bytes(6)
+        if sig is None or bytes(sig[:3]) != b'GIF':
+            raise HeaderError()
+        self.w = self.word()
+        self.h = self.word()
+        flags = self.byte()
+        self.bg = self.byte() & 255
+        self.byte()
+        if self.w == 0 or self.h == 0 or flags < 0:
+            raise HeaderError()
+        self.gpal = [0] * 256
+        self.lpal = [0] * 256
+        self.has_global = bool(flags & 0x80)
+        if self.has_global:
+            self.read_palette(self.gpal, 1 << ((flags & 7) + 1))
+        self.start = self.p
+        fill = self.gpal[self.bg] if self.has_global else 0
+        self.canvas = [fill] * (self.w * self.h)
+        self.disposal = 0
+        self.transparent = False
+        self.tindex = 0
+        self.delay = 0
+        self.prev = (0, 0, 0, 0)
+        self.prev_disposal = 0
+        self.prev_transparent = False
+        self.backup = None
+        self.rewinds = 0
+
+    # 读取：数据结束时返回-1且不移动位置
+    def byte(self):
+        if self.p < len(self.d):
+            self.p += 1
+            return self.d[self.p - 1]
+        return -1
+
+    def read_bytes(self, n):
+        out = []
+        for _ in range(n):
+            v = self.byte()
+            if v < 0:
+                return None
+            out.append(v)
+        return out
+
+    def word(self):
+        lo = self.byte()
+        hi = self.byte()
+        return 0 if lo < 0 or hi < 0 else lo | (hi << 8)
+
+    def skip_sub(self):
+        n = self.byte()
+        while n > 0:
+            self.p += n
+            n = self.byte()
+
+    def read_palette(self, pal, count):
+        for i in range(count):
+            rgb = self.read_bytes(3) or (0, 0, 0)
+            pal[i] = rgb565(rgb)
+
+    def set(self, x, y, value):
+        i = y * self.w + x
+        if self.canvas[i] != value:
+            self.canvas[i] = value
+            if self.dirty is None:
+                self.dirty = [x, y, x, y]
+            else:
+                d = self.dirty
+                d[0], d[1], d[2], d[3] = min(d[0], x), min(d[1], y), max(d[2], x), max(d[3], y)
+
+    def decode(self):
+        rewound = False
+        while True:
+            sep = self.byte()
+            if sep == 0x21:
+                if self.byte() == 0xF9:
+                    self.byte()
+                    flags = self.byte()
+                    self.delay = (self.word() * 10) & 0xFFFF
+                    self.tindex = self.byte() & 255
+                    self.disposal = (flags >> 2) & 7
+                    self.transparent = bool(flags & 1)
+                self.skip_sub()
+            elif sep == 0x2C:
+                break
+            else:
+                if rewound:
+                    return False
+                rewound = True
+                self.rewinds += 1
+                self.p = self.start
+        fx, fy, fw, fh = self.word(), self.word(), self.word(), self.word()
+        flags = self.byte()
+        if fw == 0 or fh == 0 or flags < 0:
+            return False
+        pal = self.gpal
+        if flags & 0x80:
+            self.read_palette(self.lpal, 1 << ((flags & 7) + 1))
+            pal = self.lpal
+        self.dirty = None
+        # 处置上一帧
+        px, py, pw, ph = self.prev
+        if self.prev_disposal == 2:
+            color = 0 if self.prev_transparent else self.gpal[self.bg]
+            for y in range(py, min(py + ph, self.h)):
+                for x in range(px, min(px + pw, self.w)):
+                    self.set(x, y, color)
+        elif self.prev_disposal == 3 and self.backup is not None:
+            for y in range(py, min(py + ph, self.h)):
+                for x in range(px, min(px + pw, self.w)):
+                    self.set(x, y, self.backup[(x, y)])
+        self.backup = None
+        if self.disposal == 3:
+            self.backup = {(x, y): self.canvas[y * self.w + x]
+                           for y in range(fy, min(fy + fh, self.h)) for x in range(fx, min(fx + fw, self.w))}
+        ok = self.image(pal, fx, fy, fw, fh, bool(flags & 0x40))
+        self.prev = (fx, fy, fw, fh)
+        self.prev_disposal = self.disposal
+        self.prev_transparent = self.transparent
+        self.disposal = 0
+        self.transparent = False
+        return ok
+
+    def image(self, pal, fx, fy, fw, fh, interlaced):
+        """逐个编码解码，数据截断时停止（已输出的像素保留）"""
+        min_size = self.byte()
+        if min_size < 2 or min_size > 8:
+            return False
+        clear = 1 << min_size
+        end = clear + 1
+        size = min_size + 1
+        table = [[i] for i in range(clear)] + [None, None]
+        bits = nbits = remaining = 0
+        order = interlace_order(fh) if interlaced else list(range(fh))
+        left = fw * fh
+        n = 0
+        prev = None
+        ok = True
+        while left > 0:
+            while nbits < size:
+                if remaining == 0:
+                    remaining = self.byte()
+                    if remaining <= 0:
+                        remaining = 0
+                        break
+                v = self.byte()
+                if v < 0:
+                    break
+                bits |= v << nbits
+                nbits += 8
+                remaining -= 1
+            if nbits < size:
+                break
+            code = bits & ((1 << size) - 1)
+            bits >>= size
+            nbits -= size
+            if code == clear:
+                size = min_size + 1
+                table = table[:end + 1]
+                prev = None
+                continue
+            if code == end:
+                break
+            if prev is None:
+                if code >= clear:
+                    ok = False
+                    break
+                entry = table[code]
+            elif code < len(table) and code not in (clear, end):
+                entry = table[code]
+                if len(table) < 4096:
+                    table.append(prev + entry[:1])
+            elif code == len(table):
+                entry = prev + prev[:1]
+                if len(table) < 4096:
+                    table.append(entry)
+            else:
+                ok = False
+                break
+            if len(table) == (1 << size) and size < 12:
+                size += 1
+            prev = entry
+            for index in entry:
+                if left == 0:
+                    break
+                x = fx + n % fw
+                y = fy + order[n // fw]
+                if not (self.transparent and index == self.tindex) and x < self.w and y < self.h:
+                    self.set(x, y, pal[index])
+                n += 1
+                left -= 1
+        self.p += remaining
+        self.skip_sub()
+        return ok
+
+
+def write_expect(name, data):
+    out = bytearray(b'GEXP')
+    try:
+        model = Model(data)
+    except HeaderError:
+        out += struct.pack('<BHHH', 0, 0, 0, 0)
+        return out
+    records = []
+    # 播放一遍，再回到第一帧解码一次（覆盖循环时对最后一帧的处置）
+    while len(records) < 400:
+        ok = model.decode()
+        rec = bytearray(struct.pack('<B', 1 if ok else 0))
+        d = model.dirty if ok and model.dirty is not None else [0, 0, -1, -1]
+        rec += struct.pack('<hhhhH', d[0], d[1], d[2], d[3], model.delay)
+        if ok:
+            rec += struct.pack('<%dH' % len(model.canvas), *model.canvas)
+        records.append(rec)
+        if not ok or model.rewinds > 0:
+            break
+    out += struct.pack('<BHHH', 1, model.w, model.h, len(records))
+    for rec in records:
+        out += rec
+    return out
+
+
+# ---------------------------------------------------------------- 样本
+
+def pattern(w, h, colors, seed):
+    return [(x * 3 + y * 5 + seed + (x * y) // 3) % colors for y in range(h) for x in range(w)]
+
+
+def framed(w, h, border, fill):
+    return [border if x in (0, w - 1) or y in (0, h - 1) else fill + (x + y) % 3 for y in range(h) for x in range(w)]
+
+
+def noise(n, colors, seed):
+    state = seed
+    out = []
+    for _ in range(n):
+        state = (state * 1103515245 + 12345) & 0x7fffffff
+        out.append((state >> 16) % colors)
+    return out
+
+
+def palette(n, seed):
+    return [((i * 67 + seed) % 256, (i * 151 + seed * 3) % 256, (i * 37 + 90) % 256) for i in range(n)]
+
+
+def sample_disposal2():
+    g = Gif(24, 16, palette(16, 1), bg=3)
+    g.out += b'\x21\xFF\x0bNETSCAPE2.0\x03\x01\x00\x00\x00'
+    g.frame(0, 0, 24, 16, pattern(24, 16, 16, 0), disposal=1, delay=10)
+    g.extension(0xFE, b'comment block skipped by the decoder')
+    g.frame(4, 3, 8, 6, pattern(8, 6, 16, 5), disposal=2, delay=4)
+    g.frame(10, 5, 9, 7, pattern(9, 7, 6, 1), disposal=2, transparent=0, delay=3, block=7)
+    g.frame(18, 10, 10, 8, pattern(10, 8, 16, 9), disposal=2, delay=2)
+    g.frame(0, 0, 5, 5, pattern(5, 5, 16, 2), disposal=1, delay=0)
+    # 边框为背景色的帧：处置时边框不变，改变矩形只包含内部
+    g.frame(2, 2, 12, 10, framed(12, 10, 3, 4), disposal=2, delay=2)
+    g.frame(6, 6, 2, 2, [1, 2, 5, 6], disposal=1, delay=2)
+    return g
+
+
+def sample_disposal3():
+    g = Gif(24, 16, palette(8, 2), bg=1)
+    g.frame(0, 0, 24, 16, pattern(24, 16, 8, 3), disposal=0, delay=8)
+    g.frame(2, 2, 10, 8, pattern(10, 8, 8, 4), disposal=3, delay=5)
+    g.frame(6, 4, 12, 9, pattern(12, 9, 4, 0), disposal=3, transparent=2, local=palette(4, 9), delay=5, block=16)
+    g.frame(16, 10, 12, 10, pattern(12, 10, 8, 6), disposal=3, delay=5)
+    g.frame(1, 1, 6, 6, pattern(6, 6, 8, 1), disposal=2, transparent=4, delay=6)
+    g.frame(0, 0, 3, 3, pattern(3, 3, 8, 7), disposal=1, delay=6)
+    return g
+
+
+def sample_interlaced():
+    g = Gif(20, 13, palette(4, 3), bg=0)
+    g.frame(0, 0, 20, 13, pattern(20, 13, 4, 0), interlaced=True, delay=7)
+    g.frame(3, 2, 7, 5, pattern(7, 5, 4, 2), interlaced=True, transparent=1, disposal=0)
+    g.frame(0, 12, 20, 1, pattern(20, 1, 4, 3), interlaced=True)
+    g.frame(5, 0, 3, 9, pattern(3, 9, 4, 1), interlaced=True, disposal=0)
+    return g
+
+
+def sample_noise():
+    # 256色噪声：编码宽度增长到12位，表满后发清除码
+    g = Gif(72, 60, palette(256, 4), bg=7)
+    g.frame(0, 0, 72, 60, noise(72 * 60, 256, 1), delay=5)
+    g.frame(10, 10, 40, 30, noise(40 * 30, 256, 2), delay=5, block=100)
+    return g
+
+
+def sample_no_global():
+    # 没有全局颜色表：画布初始为黑色，处置方式2也恢复为黑色
+    g = Gif(16, 12)
+    g.frame(0, 0, 16, 12, pattern(16, 12, 8, 0), local=palette(8, 5), disposal=2, delay=5)
+    g.frame(4, 4, 8, 4, pattern(8, 4, 2, 0), local=[(255, 255, 255), (0, 0, 255)], disposal=0, delay=5)
+    return g
+
+
+def main():
+    samples = {}
+    d2 = sample_disposal2()
+    d3 = sample_disposal3()
+    samples['disposal2.gif'] = d2.bytes()
+    samples['disposal3.gif'] = d3.bytes()
+    samples['interlaced.gif'] = sample_interlaced().bytes()
+    samples['noise.gif'] = sample_noise().bytes()
+    samples['no_global.gif'] = sample_no_global().bytes()
+    samples['no_trailer.gif'] = d2.bytes(trailer=False)
+    # 截断：第3帧数据的第一个子块中间、第2帧子块长度之后、第2帧图形控制扩展中间
+    data = d3.bytes()
+    samples['truncated_frame.gif'] = data[:d3.frames[2][2] + 12]
+    data = d2.bytes()
+    samples['truncated_block.gif'] = data[:d2.frames[1][2] + 2]
+    samples['truncated_gce.gif'] = data[:d2.frames[1][0] + 5]
+    # 应被拒绝的文件
+    samples['bad_signature.gif'] = b'\x89PNG\r\n\x1a\n' + data[8:]
+    samples['bad_header.gif'] = data[:9]
+    samples['bad_zero_size.gif'] = data[:6] + b'\0\0' + data[8:]
+    samples['bad_no_frames.gif'] = data[:d2.frames[0][0]] + b';'
+    lzw = bytes([2, 2, 4 | (1 << 3) | ((7 & 3) << 6), 7 >> 2, 0])
+    samples['bad_lzw.gif'] = data[:d2.frames[0][1] + 10] + lzw + b';'
+    samples['bad_code_size.gif'] = data[:d2.frames[0][1] + 10] + bytes([12, 1, 0, 0]) + b';'
+    for name in sorted(os.listdir(OUT)):
+        if name.endswith('.gif') or name.endswith('.expect'):
+            os.remove(os.path.join(OUT, name))
+    for name, data in sorted(samples.items()):
+        with open(os.path.join(OUT, name), 'wb') as f:
+            f.write(data)
+        expect = write_expect(name, data)
+        with open(os.path.join(OUT, name[:-4] + '.expect'), 'wb') as f:
+            f.write(expect)
+        print('%-22s %6d字节' % (name, len(data)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+# 生成png_stream_test使用的PNG样本（固定随机种子，重复运行得到相同的文件）
+# 用法：cd test/host/data/png && python3 make_corpus.py
+# 有效样本覆盖所有颜色类型和位深度、tRNS、多个IDAT块、附加数据块、存储/固定/动态哈夫曼块、各种滤波类型和小窗口；
+# bad_开头的样本应被拒绝，interlaced.png是lodepng能解码但流式解码器交给LVGL的隔行扫描图像
+import os
+import random
+import struct
+import zlib
+
+random.seed(7)
+OUT = os.path.dirname(os.path.abspath(__file__))
+CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+SIGNATURE = b'\x89PNG\r\n\x1a\n'
+
+
+def chunk(kind, data):
+    body = kind + data
+    return struct.pack('>I', len(data)) + body + struct.pack('>I', zlib.crc32(body) & 0xffffffff)
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    return a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+
+
+def apply_filter(kind, cur, prev, bpp):
+    out = bytearray(len(cur))
+    for i in range(len(cur)):
+        a = cur[i - bpp] if i >= bpp else 0
+        b = prev[i]
+        c = prev[i - bpp] if i >= bpp else 0
+        out[i] = (cur[i] - [0, a, b, (a + b) // 2, paeth(a, b, c)][kind]) & 255
+    return out
+
+
+def raw_rows(w, h, ct, depth, mode, palette_size):
+    """生成每行的原始数据（未滤波）"""
+    bits = CHANNELS[ct] * depth
+    row_bytes = (w * bits + 7) // 8
+    top = (1 << depth) - 1
+    rows = []
+    for y in range(h):
+        if mode == 'noise':
+            row = bytearray(random.getrandbits(8) for _ in range(row_bytes))
+        else:
+            # 渐变：按样本打包
+            samples = [((x * 7 + y * 3 + c * 50) * top // (w * 7 + h * 3 + 100)) & top
+                       for x in range(w) for c in range(CHANNELS[ct])]
+            row = bytearray(row_bytes)
+            for i, s in enumerate(samples):
+                if depth == 16:
+                    row[2 * i] = s >> 8
+                    row[2 * i + 1] = s & 255
+                elif depth == 8:
+                    row[i] = s
+                else:
+                    bit = i * depth
+                    row[bit >> 3] |= s << (8 - depth - (bit & 7))
+        if ct == 3 and depth == 8 and palette_size is not None:
+            # 调色板索引限制在调色板内（越界索引的处理各解码器不同）
+            row = bytearray(b % palette_size for b in row)
+        rows.append(row)
+    return rows, max(1, bits // 8)
+
+
+def make(name, w, h, ct, depth, mode='grad', level=9, filters='mix', split=None, trns=None,
+         palette_size=None, interlace=0, extra=False, strategy=zlib.Z_DEFAULT_STRATEGY, wbits=15):
+    if ct == 3 and palette_size is None:
+        palette_size = 1 << depth if depth < 8 else 200
+    if ct == 3 and depth < 8:
+        # 小位深度的渐变和噪声都可能用到全部索引
+        palette_size = 1 << depth
+    rows, bpp = raw_rows(w, h, ct, depth, mode, palette_size)
+    data = bytearray()
+    prev = bytearray(len(rows[0]))
+    for row in rows:
+        kind = random.randrange(5) if filters == 'mix' else filters
+        data.append(kind)
+        data += apply_filter(kind, row, prev, bpp)
+        prev = row
+    compressor = zlib.compressobj(level, zlib.DEFLATED, wbits, 9, strategy)
+    compressed = compressor.compress(bytes(data)) + compressor.flush()
+    png = SIGNATURE + chunk(b'IHDR', struct.pack('>IIBBBBB', w, h, depth, ct, 0, 0, interlace))
+    if extra:
+        png += chunk(b'tEXt', b'Comment\x00' + b'x' * 300) + chunk(b'gAMA', struct.pack('>I', 45455))
+    if ct == 3:
+        png += chunk(b'PLTE', bytes(random.getrandbits(8) for _ in range(3 * palette_size)))
+    if trns is not None:
+        png += chunk(b'tRNS', trns)
+    if split:
+        for i in range(0, len(compressed), split):
+            png += chunk(b'IDAT', compressed[i:i + split])
+    else:
+        png += chunk(b'IDAT', compressed)
+    png += chunk(b'IEND', b'')
+    write(name, png)
+    return png
+
+
+def make_interlaced(w, h):
+    """8位RGBA的Adam7隔行扫描图像（每一遍的子图像按行滤波类型0存放）"""
+    passes = [(0, 0, 8, 8), (4, 0, 8, 8), (0, 4, 4, 8), (2, 0, 4, 4), (0, 2, 2, 4), (1, 0, 2, 2), (0, 1, 1, 2)]
+    pixels = [[bytes(random.getrandbits(8) for _ in range(4)) for _ in range(w)] for _ in range(h)]
+    data = bytearray()
+    for x0, y0, dx, dy in passes:
+        for y in range(y0, h, dy):
+            row = b''.join(pixels[y][x] for x in range(x0, w, dx))
+            if row:
+                data += b'\x00' + row
+    return (SIGNATURE + chunk(b'IHDR', struct.pack('>IIBBBBB', w, h, 8, 6, 0, 0, 1)) +
+            chunk(b'IDAT', zlib.compress(bytes(data))) + chunk(b'IEND', b''))
+
+
+def write(name, data):
+    with open(os.path.join(OUT, name + '.png'), 'wb') as f:
+        f.write(data)
+
+
+def main():
+    for old in os.listdir(OUT):
+        if old.endswith('.png'):
+            os.remove(os.path.join(OUT, old))
+    # 每种颜色类型和位深度：渐变（动态哈夫曼）和噪声（固定哈夫曼）
+    for ct, depths in [(0, [1, 2, 4, 8, 16]), (2, [8, 16]), (3, [1, 2, 4, 8]), (4, [8, 16]), (6, [8, 16])]:
+        for depth in depths:
+            make('c%d_d%d_grad' % (ct, depth), 17, 9, ct, depth, 'grad')
+            make('c%d_d%d_noise' % (ct, depth), 13, 7, ct, depth, 'noise', 6, strategy=zlib.Z_FIXED)
+    # tRNS：灰度和RGB的透明色（与像素相同和不同），调色板的部分Alpha
+    make('c0_d1_trns', 17, 9, 0, 1, trns=struct.pack('>H', 1))
+    make('c0_d8_trns', 17, 9, 0, 8, 'noise', trns=struct.pack('>H', 0x5a))
+    make('c0_d16_trns', 17, 9, 0, 16, trns=struct.pack('>H', 0))
+    make('c2_d8_trns', 17, 9, 2, 8, 'noise', trns=struct.pack('>HHH', 0x10, 0x20, 0x30))
+    make('c2_d16_trns', 17, 9, 2, 16, trns=struct.pack('>HHH', 0, 0x0126, 0x0c80))
+    for depth in [1, 2, 4, 8]:
+        count = 1 << depth if depth < 8 else 200
+        make('c3_d%d_trns' % depth, 17, 9, 3, depth, 'noise',
+             trns=bytes(random.getrandbits(8) for _ in range(max(1, count // 2))))
+    # 每种滤波类型单独使用
+    for kind in range(5):
+        make('c6_d8_filter%d' % kind, 23, 11, 6, 8, 'noise', filters=kind)
+    # 数据块和压缩方式
+    make('c2_d8_idat_split', 31, 17, 2, 8, 'grad', split=1)
+    make('c6_d8_idat_split7', 31, 17, 6, 8, 'noise', split=7)
+    make('c2_d8_extra_chunks', 31, 17, 2, 8, 'grad', extra=True)
+    make('c2_d8_stored', 200, 60, 2, 8, 'noise', level=0)
+    make('c2_d8_huffman_only', 64, 32, 2, 8, 'grad', strategy=zlib.Z_HUFFMAN_ONLY)
+    make('c2_d8_rle', 64, 32, 2, 8, 'grad', strategy=zlib.Z_RLE)
+    make('c6_d8_window512', 64, 64, 6, 8, 'grad', wbits=9)
+    make('c6_d8_noise64', 64, 64, 6, 8, 'noise')
+    make('c0_d8_width1', 1, 40, 0, 8, 'noise')
+    make('c6_d16_height1', 241, 1, 6, 16, 'grad')
+
+    # 隔行扫描：lodepng能解码，流式解码器拒绝
+    write('interlaced', make_interlaced(16, 16))
+    # 应被拒绝的样本
+    good = make('bad_base', 17, 9, 2, 8, 'grad', filters=0)
+    os.remove(os.path.join(OUT, 'bad_base.png'))
+    write('bad_signature', b'\x89PNX' + good[4:])
+    write('bad_truncated', good[:len(good) // 2])
+    write('bad_no_idat', good[:33] + chunk(b'IEND', b''))
+    # 第一行的滤波类型为5
+    rows, _ = raw_rows(17, 9, 2, 8, 'grad', None)
+    data = b''.join(bytes([5 if y == 0 else 0]) + bytes(r) for y, r in enumerate(rows))
+    header = SIGNATURE + chunk(b'IHDR', struct.pack('>IIBBBBB', 17, 9, 8, 2, 0, 0, 0))
+    write('bad_filter', header + chunk(b'IDAT', zlib.compress(data)) + chunk(b'IEND', b''))
+    # RGB不允许4位深度
+    write('bad_depth', SIGNATURE + chunk(b'IHDR', struct.pack('>IIBBBBB', 17, 9, 4, 2, 0, 0, 0)) +
+          chunk(b'IDAT', zlib.compress(b'\x00' * (9 * 27))) + chunk(b'IEND', b''))
+    # 调色板图像没有PLTE块
+    write('bad_no_plte', SIGNATURE + chunk(b'IHDR', struct.pack('>IIBBBBB', 17, 9, 8, 3, 0, 0, 0)) +
+          chunk(b'IDAT', zlib.compress(b'\x00' * (9 * 18))) + chunk(b'IEND', b''))
+    # zlib头的压缩方法不是deflate
+    compressed = bytearray(zlib.compress(data.replace(b'\x05', b'\x00', 1)))
+    compressed[0] = 0x79
+    compressed[1] = 0x9c - ((0x79 * 256 + 0x9c) % 31)
+    write('bad_zlib_header', header + chunk(b'IDAT', bytes(compressed)) + chunk(b'IEND', b''))
+    # 宽度为0
+    write('bad_width', SIGNATURE + chunk(b'IHDR', struct.pack('>IIBBBBB', 0, 9, 8, 2, 0, 0, 0)) +
+          chunk(b'IDAT', zlib.compress(b'')) + chunk(b'IEND', b''))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,89 @@
+// 生成ttf_loader_test使用的参考度量和覆盖率：用FreeType（不使用hinting）渲染lib/lvgl-8.3.7/examples/libs/freetype/Lato-Regular.ttf
+// 中的ASCII和Latin-1字符（À到ÿ多为组合字形）以及几对有字距的字符，每个字号输出一个lato_<字号>.ref文件
+// 用法：cd test/host && make ttf-reference（需要libfreetype开发包，生成的文件提交到仓库，运行测试时不需要FreeType）
+//
+// .ref文件（小端）：'TREF'，字号(u16)，字形数(u16)，字距对数(u16)，
+// 然后每个字形：字符(u32)，前进宽度(u16，像素，四舍五入)，位图宽、高(u16)，位图左边缘和下边缘相对原点的偏移(i16，y向上，
+// 与lv_font_glyph_dsc_t的ofs_x、ofs_y相同)，逐行的8位覆盖率(宽*高字节)；
+// 每个字距对：左、右字符(u32)，字距(i16，字体单位按字号缩放后四舍五入的像素)
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char* FONT = "../../lib/lvgl-8.3.7/examples/libs/freetype/Lato-Regular.ttf";
+static const unsigned SIZES[] = {12, 20, 36};
+static const unsigned KERN_PAIRS[][2] = {{'A', 'V'}, {'T', 'o'}, {'W', 'a'}, {'L', 'T'}, {'F', '.'}, {'Y', 0xE9}, {'A', 'B'}};
+
+static void putU16(FILE* file, unsigned value) {
+    fputc(value & 0xFF, file);
+    fputc((value >> 8) & 0xFF, file);
+}
+static void putU32(FILE* file, unsigned long value) {
+    putU16(file, value & 0xFFFF);
+    putU16(file, (value >> 16) & 0xFFFF);
+}
+
+int main(void) {
+    FT_Library library;
+    FT_Face face;
+    if (FT_Init_FreeType(&library) != 0 || FT_New_Face(library, FONT, 0, &face) != 0) {
+        fprintf(stderr, "无法打开%s\n", FONT);
+        return 1;
+    }
+    unsigned letters[256];
+    unsigned letterCount = 0;
+    for (unsigned c = 0x20; c <= 0xFF; c++) {
+        if ((c < 0x7F || c >= 0xA0) && FT_Get_Char_Index(face, c) != 0) {
+            letters[letterCount++] = c;
+        }
+    }
+    unsigned pairCount = sizeof(KERN_PAIRS) / sizeof(KERN_PAIRS[0]);
+    for (size_t s = 0; s < sizeof(SIZES) / sizeof(SIZES[0]); s++) {
+        unsigned size = SIZES[s];
+        char path[64];
+        snprintf(path, sizeof(path), "data/ttf/lato_%u.ref", size);
+        FILE* file = fopen(path, "wb");
+        if (file == NULL || FT_Set_Pixel_Sizes(face, 0, size) != 0) {
+            fprintf(stderr, "无法生成%s\n", path);
+            return 1;
+        }
+        fwrite("TREF", 1, 4, file);
+        putU16(file, size);
+        putU16(file, letterCount);
+        putU16(file, pairCount);
+        for (unsigned i = 0; i < letterCount; i++) {
+            FT_UInt glyph = FT_Get_Char_Index(face, letters[i]);
+            if (FT_Load_Glyph(face, glyph, FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP | FT_LOAD_RENDER) != 0) {
+                fprintf(stderr, "无法渲染U+%04X\n", letters[i]);
+                return 1;
+            }
+            FT_GlyphSlot slot = face->glyph;
+            FT_Bitmap* bitmap = &slot->bitmap;
+            putU32(file, letters[i]);
+            putU16(file, (unsigned)floor(slot->linearHoriAdvance / 65536.0 + 0.5));
+            putU16(file, bitmap->width);
+            putU16(file, bitmap->rows);
+            putU16(file, (unsigned)(slot->bitmap_left & 0xFFFF));
+            putU16(file, (unsigned)((slot->bitmap_top - (int)bitmap->rows) & 0xFFFF));
+            for (unsigned y = 0; y < bitmap->rows; y++) {
+                fwrite(bitmap->buffer + y * bitmap->pitch, 1, bitmap->width, file);
+            }
+        }
+        for (unsigned i = 0; i < pairCount; i++) {
+            FT_Vector kern;
+            FT_Get_Kerning(face, FT_Get_Char_Index(face, KERN_PAIRS[i][0]), FT_Get_Char_Index(face, KERN_PAIRS[i][1]),
+                           FT_KERNING_UNSCALED, &kern);
+            putU32(file, KERN_PAIRS[i][0]);
+            putU32(file, KERN_PAIRS[i][1]);
+            putU16(file, (unsigned)((int)lround((double)kern.x * size / face->units_per_EM) & 0xFFFF));
+        }
+        printf("%s：%u个字符，%u对字距，%ld字节\n", path, letterCount, pairCount, ftell(file));
+        fclose(file);
+    }
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return 0;
+}
@@ -0,0 +1,295 @@
+// 逐帧GIF解码与参考画布的比较：解码data/gif/中的样本（由make_corpus.py生成），每次decodeNextFrame后的
+// 画布、改变矩形和帧间隔须与.expect中的记录相同，bad_开头的样本须在文件头或第一帧被拒绝；
+// LVGL示例中的bulb.gif和只用处置方式0/1的样本再与LVGL自带的gifdec逐帧比较（在PC上运行，见test/host/Makefile）
+#include "ui/gif_decoder.h"
+#include <lvgl.h>
+extern "C" {
+#include "src/extra/libs/gif/gifdec.h"
+}
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            printf("  失败: %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                    \
+        }                                                                  \
+    } while (0)
+
+const char* CORPUS_DIR = "data/gif";
+const char* BULB_GIF = "../../lib/lvgl-8.3.7/examples/libs/gif/bulb.gif";
+
+// 只使用处置方式0和1的样本：gifdec对这些帧的合成与GifDecoder相同
+const char* GIFDEC_COMPARABLE[] = {"interlaced.gif", "noise.gif"};
+
+// 内存中的样本，每次读取的长度由种子决定（为0时一次读满）
+struct SampleReader {
+    const uint8_t* data;
+    size_t size;
+    uint32_t seed;
+};
+
+//*** 读取函数：随机长度的部分读取，检查解码器的读取缓冲在任意边界下仍然正确
+static size_t readSample(void* context, size_t offset, uint8_t* buf, size_t length) {
+    SampleReader* reader = (SampleReader*)context;
+    if (offset >= reader->size) {
+        return 0;
+    }
+    size_t want = length;
+    if (reader->seed != 0) {
+        reader->seed = reader->seed * 1103515245 + 12345;
+        want = 1 + (reader->seed >> 8) % length;
+    }
+    size_t n = std::min(want, reader->size - offset);
+    memcpy(buf, reader->data + offset, n);
+    return n;
+}
+
+//*** 读取整个文件
+static bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        data.insert(data.end(), buf, buf + n);
+    }
+    fclose(file);
+    return true;
+}
+
+// .expect中的一次解码记录
+struct Record {
+    bool ok;
+    int16_t x1, y1, x2, y2;      // 改变矩形（x2小于x1表示没有改变）
+    uint16_t delay;
+    std::vector<uint16_t> canvas;
+};
+
+struct Expect {
+    bool headerOk;
+    uint16_t width;
+    uint16_t height;
+    std::vector<Record> records;
+};
+
+//*** 解析.expect文件（格式见make_corpus.py）
+static bool parseExpect(const std::vector<uint8_t>& raw, Expect& expect) {
+    size_t pos = 0;
+    auto u8 = [&]() { return pos < raw.size() ? raw[pos++] : 0; };
+    auto u16 = [&]() { uint16_t low = u8(); return (uint16_t)(low | (u8() << 8)); };
+    if (raw.size() < 11 || memcmp(raw.data(), "GEXP", 4) != 0) {
+        return false;
+    }
+    pos = 4;
+    expect.headerOk = u8() != 0;
+    expect.width = u16();
+    expect.height = u16();
+    uint16_t count = u16();
+    for (uint16_t i = 0; i < count; i++) {
+        Record record;
+        record.ok = u8() != 0;
+        record.x1 = (int16_t)u16();
+        record.y1 = (int16_t)u16();
+        record.x2 = (int16_t)u16();
+        record.y2 = (int16_t)u16();
+        record.delay = u16();
+        if (record.ok) {
+            record.canvas.resize((size_t)expect.width * expect.height);
+            for (uint16_t& pixel : record.canvas) {
+                pixel = u16();
+            }
+        }
+        expect.records.push_back(record);
+    }
+    return pos == raw.size();
+}
+
+//*** 按记录逐帧解码并比较，seed为0xFFFFFFFF时直接从内存解码
+static void replay(const std::string& name, const std::vector<uint8_t>& data, const Expect& expect, uint32_t seed) {
+    SampleReader reader = {data.data(), data.size(), seed};
+    GifDecoder gif;
+    GifError error = seed == 0xFFFFFFFF ? gif.begin(data.data(), data.size()) : gif.begin(readSample, &reader);
+    CHECK((error == GIF_OK) == expect.headerOk);
+    if (error != GIF_OK) {
+        CHECK(error == GIF_ERROR_HEADER);
+        return;
+    }
+    CHECK(gif.width() == expect.width && gif.height() == expect.height);
+    size_t pixels = (size_t)gif.width() * gif.height();
+    std::vector<uint16_t> previous(pixels);
+    for (size_t i = 0; i < pixels; i++) {
+        previous[i] = gif.canvas()[i].full;
+    }
+    for (size_t frame = 0; frame < expect.records.size(); frame++) {
+        const Record& record = expect.records[frame];
+        bool ok = gif.decodeNextFrame();
+        CHECK(ok == record.ok);
+        if (!ok || !record.ok) {
+            return;
+        }
+        // 画布逐像素相同
+        size_t mismatch = pixels;
+        for (size_t i = 0; i < pixels && mismatch == pixels; i++) {
+            if (gif.canvas()[i].full != record.canvas[i]) {
+                mismatch = i;
+            }
+        }
+        CHECK(mismatch == pixels);
+        // 改变矩形与参考相同，并且包含与上一帧不同的所有像素
+        lv_area_t area;
+        bool changed = gif.getDirtyArea(area);
+        CHECK(changed == (record.x2 >= record.x1));
+        if (changed) {
+            CHECK(area.x1 == record.x1 && area.y1 == record.y1 && area.x2 == record.x2 && area.y2 == record.y2);
+        }
+        bool outside = false;
+        for (size_t i = 0; i < pixels; i++) {
+            int x = i % gif.width();
+            int y = i / gif.width();
+            if (gif.canvas()[i].full != previous[i] &&
+                !(changed && x >= area.x1 && x <= area.x2 && y >= area.y1 && y <= area.y2)) {
+                outside = true;
+            }
+            previous[i] = gif.canvas()[i].full;
+        }
+        CHECK(!outside);
+        CHECK(gif.frameDelay() == record.delay);
+        if (mismatch != pixels || outside) {
+            printf("  %s: 种子%u，第%zu次解码，像素(%zu,%zu)不同\n", name.c_str(), seed, frame + 1,
+                   mismatch % gif.width(), mismatch / gif.width());
+            return;
+        }
+    }
+}
+
+//*** 与LVGL自带的gifdec逐帧比较（循环两遍），返回比较的帧数
+static int compareWithGifdec(const std::string& name, const std::vector<uint8_t>& data, int frames) {
+    GifDecoder gif;
+    CHECK(gif.begin(data.data(), data.size()) == GIF_OK);
+    gd_GIF* reference = gd_open_gif_data(data.data());
+    CHECK(reference != nullptr);
+    if (reference == nullptr || gif.canvas() == nullptr) {
+        return 0;
+    }
+    CHECK(reference->width == gif.width() && reference->height == gif.height());
+    size_t pixels = (size_t)gif.width() * gif.height();
+    int compared = 0;
+    for (int frame = 0; frame < frames; frame++) {
+        int result = gd_get_frame(reference);
+        if (result == 0) {
+            gd_rewind(reference);
+            result = gd_get_frame(reference);
+        }
+        CHECK(result == 1);
+        CHECK(gif.decodeNextFrame());
+        if (result != 1) {
+            break;
+        }
+        gd_render_frame(reference, reference->canvas);
+        // 16位色深时gifdec的画布每像素3字节：RGB565低字节、高字节、透明度
+        size_t mismatch = pixels;
+        for (size_t i = 0; i < pixels && mismatch == pixels; i++) {
+            uint16_t expected = reference->canvas[i * 3] | (reference->canvas[i * 3 + 1] << 8);
+            if (gif.canvas()[i].full != expected) {
+                mismatch = i;
+            }
+        }
+        CHECK(mismatch == pixels);
+        if (mismatch != pixels) {
+            printf("  %s: 第%d帧与gifdec不同，像素(%zu,%zu)\n", name.c_str(), frame + 1, mismatch % gif.width(),
+                   mismatch / gif.width());
+            break;
+        }
+        compared++;
+    }
+    gd_close_gif(reference);
+    return compared;
+}
+
+int main() {
+    lv_init();
+    DIR* dir = opendir(CORPUS_DIR);
+    if (dir == nullptr) {
+        printf("无法打开%s（须在test/host中运行）\n", CORPUS_DIR);
+        return 1;
+    }
+    std::vector<std::string> names;
+    while (struct dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".gif") == 0) {
+            names.push_back(name);
+        }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+    int valid = 0;
+    int rejected = 0;
+    int truncated = 0;
+    for (const std::string& name : names) {
+        std::vector<uint8_t> data;
+        std::vector<uint8_t> raw;
+        Expect expect;
+        CHECK(readFile(std::string(CORPUS_DIR) + "/" + name, data));
+        CHECK(readFile(std::string(CORPUS_DIR) + "/" + name.substr(0, name.size() - 4) + ".expect", raw));
+        CHECK(parseExpect(raw, expect));
+        bool bad = name.compare(0, 4, "bad_") == 0;
+        // 有效样本每次解码都成功；应被拒绝的样本在文件头或第一帧失败
+        if (bad) {
+            CHECK(!expect.headerOk || (expect.records.size() == 1 && !expect.records[0].ok));
+        } else {
+            CHECK(expect.headerOk && !expect.records.empty());
+            for (const Record& record : expect.records) {
+                CHECK(record.ok);
+            }
+        }
+        // 直接从内存解码，一次读满和三种随机的部分读取
+        const uint32_t seeds[] = {0xFFFFFFFF, 0, 1, 77};
+        for (uint32_t seed : seeds) {
+            replay(name, data, expect, seed);
+        }
+        if (bad) {
+            printf("%-22s 拒绝（%s）\n", name.c_str(), expect.headerOk ? "第一帧" : "文件头");
+            rejected++;
+        } else {
+            printf("%-22s %3ux%-3u %2zu次解码 一致\n", name.c_str(), expect.width, expect.height,
+                   expect.records.size());
+            valid++;
+            truncated += name.compare(0, 10, "truncated_") == 0;
+        }
+    }
+    // 与gifdec比较：LVGL示例的动画和只用处置方式0/1的样本
+    std::vector<uint8_t> bulb;
+    CHECK(readFile(BULB_GIF, bulb));
+    int compared = compareWithGifdec("bulb.gif", bulb, 200);
+    CHECK(compared == 200);
+    printf("%-22s 与gifdec一致 %d帧\n", "bulb.gif", compared);
+    for (const char* name : GIFDEC_COMPARABLE) {
+        std::vector<uint8_t> data;
+        CHECK(readFile(std::string(CORPUS_DIR) + "/" + name, data));
+        compared = compareWithGifdec(name, data, 10);
+        CHECK(compared == 10);
+        printf("%-22s 与gifdec一致 %d帧\n", name, compared);
+    }
+    // 样本目录不完整时测试不能算通过
+    CHECK(valid >= 9);
+    CHECK(truncated >= 3);
+    CHECK(rejected >= 6);
+    printf("有效样本 %d 个（截断 %d 个），拒绝 %d 个\n", valid, truncated, rejected);
+    if (failures > 0) {
+        printf("gif_decoder_test: %d 项失败\n", failures);
+        return 1;
+    }
+    printf("gif_decoder_test: 全部通过\n");
+    return 0;
+}
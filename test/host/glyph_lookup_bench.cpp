@@ -0,0 +1,176 @@
+// cmap直接索引与二分查找的性能比较：用LVGL自带的simsun_16_cjk字体（约1400字）测量新闻标题的字形查找、
+// 文本测量和整屏标签重绘耗时，并检查0x0000-0xFFFF的每个字符在两种查找下得到相同的字形编号（在PC上运行，见test/host/Makefile）
+#include "ui/cmap_index.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// 与设备相同的屏幕尺寸
+const uint16_t SCREEN_WIDTH = 320;
+const uint16_t SCREEN_HEIGHT = 480;
+// 字形查找的重复次数和取最小值的轮数
+const int LOOKUP_REPEATS = 2000;
+const int LOOKUP_ROUNDS = 5;
+// 文本测量和重绘的次数（取最小值和中值）
+const int MEASURE_COUNT = 200;
+const int REDRAW_COUNT = 200;
+
+//*** 当前时间（微秒）
+static double nowMicros() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//*** 分配清零的内存
+static void* allocZeroed(size_t bytes) {
+    return calloc(1, bytes > 0 ? bytes : 1);
+}
+
+//*** 显示刷新回调：不输出像素
+static void flushCallback(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* pixels) {
+    (void)area;
+    (void)pixels;
+    lv_disp_flush_ready(drv);
+}
+
+//*** 读取标题文件，只保留字体中有的字符（固件字体覆盖GB2312，测试字体只有约1400字）
+static bool loadHeadlines(const char* path, const lv_font_t* font, std::string& text, std::vector<uint32_t>& letters,
+                          size_t& total) {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        printf("无法打开%s\n", path);
+        return false;
+    }
+    std::string raw;
+    char buf[1024];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        raw.append(buf, n);
+    }
+    fclose(file);
+    total = 0;
+    uint32_t i = 0;
+    while (i < raw.size()) {
+        uint32_t start = i;
+        uint32_t letter = _lv_txt_encoded_next(raw.c_str(), &i);
+        if (letter == '\r') {
+            continue;
+        }
+        lv_font_glyph_dsc_t glyph;
+        if (letter != '\n') {
+            total++;
+            if (!lv_font_get_glyph_dsc(font, &glyph, letter, 0)) {
+                continue;
+            }
+        }
+        letters.push_back(letter);
+        text.append(raw, start, i - start);
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : "data/news_headlines.txt";
+    lv_init();
+    static lv_disp_draw_buf_t drawBuf;
+    static lv_color_t buf1[SCREEN_WIDTH * 10];
+    static lv_color_t buf2[SCREEN_WIDTH * 10];
+    lv_disp_draw_buf_init(&drawBuf, buf1, buf2, SCREEN_WIDTH * 10);
+    static lv_disp_drv_t drv;
+    lv_disp_drv_init(&drv);
+    drv.hor_res = SCREEN_WIDTH;
+    drv.ver_res = SCREEN_HEIGHT;
+    drv.draw_buf = &drawBuf;
+    drv.flush_cb = flushCallback;
+    lv_disp_drv_register(&drv);
+
+    // 与FontLoader包装字体相同：复制字体和字形描述，在副本上建立索引
+    static lv_font_t font;
+    static lv_font_fmt_txt_dsc_t dsc;
+    static lv_font_fmt_txt_glyph_cache_t cache;
+    font = lv_font_simsun_16_cjk;
+    dsc = *(const lv_font_fmt_txt_dsc_t*)lv_font_simsun_16_cjk.dsc;
+    dsc.cache = &cache;
+    font.dsc = &dsc;
+    lv_font_fmt_txt_cmap_index_t index;
+    int usedPages = 0;
+    double buildStart = nowMicros();
+    size_t indexBytes = cmapIndexBuild(dsc, index, usedPages, allocZeroed, free);
+    double buildMicros = nowMicros() - buildStart;
+    if (indexBytes == 0) {
+        printf("建立索引失败\n");
+        return 1;
+    }
+    printf("索引      %d 页，%zu 字节，建立耗时 %.1f us\n", usedPages, indexBytes, buildMicros);
+
+    std::string text;
+    std::vector<uint32_t> letters;
+    size_t total = 0;
+    if (!loadHeadlines(path, &font, text, letters, total)) {
+        return 1;
+    }
+    size_t lines = std::count(letters.begin(), letters.end(), (uint32_t)'\n');
+    printf("标题      %zu 行，%zu 个字符，字体中有 %zu 个\n", lines, total, letters.size() - lines);
+
+    // 每个字符在两种查找下得到相同的字形编号
+    int mismatches = 0;
+    for (uint32_t letter = 0; letter < 0x10000; letter++) {
+        dsc.cmap_index = &index;
+        uint32_t indexed = lv_font_get_glyph_id_fmt_txt(&font, letter);
+        dsc.cmap_index = nullptr;
+        uint32_t searched = lv_font_get_glyph_id_fmt_txt(&font, letter);
+        if (indexed != searched && mismatches++ < 10) {
+            printf("  不一致: U+%04X 索引 %u，查找 %u\n", letter, indexed, searched);
+        }
+    }
+    printf("一致性    0x0000-0xFFFF 不一致 %d 个\n", mismatches);
+
+    lv_obj_t* label = lv_label_create(lv_scr_act());
+    lv_obj_set_width(label, SCREEN_WIDTH);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+    lv_obj_set_style_text_font(label, &font, 0);
+    lv_label_set_text(label, text.c_str());
+
+    for (int pass = 0; pass < 2; pass++) {
+        dsc.cmap_index = pass == 1 ? &index : nullptr;
+        // 字形查找：与绘制时相同，每个字符连同下一个字符（字距）查找一次
+        double lookupBest = 1e18;
+        uint32_t sink = 0;
+        for (int round = 0; round < LOOKUP_ROUNDS; round++) {
+            double start = nowMicros();
+            for (int r = 0; r < LOOKUP_REPEATS; r++) {
+                for (size_t k = 0; k < letters.size(); k++) {
+                    lv_font_glyph_dsc_t glyph;
+                    uint32_t next = k + 1 < letters.size() ? letters[k + 1] : 0;
+                    sink += lv_font_get_glyph_dsc(&font, &glyph, letters[k], next);
+                }
+            }
+            lookupBest = std::min(lookupBest, nowMicros() - start);
+        }
+        // 文本测量（换行计算）
+        double measureBest = 1e18;
+        for (int k = 0; k < MEASURE_COUNT; k++) {
+            lv_point_t size;
+            double start = nowMicros();
+            lv_txt_get_size(&size, text.c_str(), &font, 0, 0, SCREEN_WIDTH, LV_TEXT_FLAG_NONE);
+            measureBest = std::min(measureBest, nowMicros() - start);
+        }
+        // 整个标签重绘
+        std::vector<double> redraws;
+        for (int k = 0; k < REDRAW_COUNT; k++) {
+            double start = nowMicros();
+            lv_obj_invalidate(label);
+            lv_refr_now(NULL);
+            redraws.push_back(nowMicros() - start);
+        }
+        std::sort(redraws.begin(), redraws.end());
+        printf("%-10s 查找 %5.1f ns/字形  测量 %6.1f us  重绘中值 %7.1f us%s\n", pass == 1 ? "直接索引" : "二分查找",
+               lookupBest * 1000 / ((double)LOOKUP_REPEATS * letters.size()), measureBest,
+               redraws[redraws.size() / 2], sink == 0 ? "（未找到字形）" : "");
+    }
+    cmapIndexRelease(index, free);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,333 @@
+// 远程图像导入：启动tools/mock_image_server.py作为本地HTTP服务器，ImageIngest下载其中的PNG，缩放后保存为
+// RGB565原始数据或游程编码（保存目录代替SPIFFS），像素须与由lodepng解码的母版按同样的居中裁剪和盒式滤波得到的参考相同；
+// 地址不变时不重新下载，下载失败或不是PNG时保留原来的图像；模拟重启后从保存的文件重新读取（包括来源地址），
+// 之后服务器以分块传输提供同一图像时导入结果相同（在PC上运行，见test/host/Makefile）
+#include "manager/image_ingest.h"
+#include "ui/rle_image.h"
+#include <lvgl.h>
+#define LODEPNG_NO_COMPILE_CPP
+extern "C" {
+#include "src/extra/libs/png/lodepng.h"
+}
+#include <netinet/in.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            printf("  失败: %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                    \
+        }                                                                  \
+    } while (0)
+
+const char* SERVER_SCRIPT = "../../tools/mock_image_server.py";
+const char* MASTERS_DIR = "../../assets/images";
+// 代替SPIFFS的目录
+const char* STORAGE_DIR = "build/ingest_store";
+
+// 导入的图像：名称、服务器上的图片、目标尺寸和是否压缩
+struct IngestCase {
+    const char* name;
+    const char* image;
+    uint16_t width;
+    uint16_t height;
+    bool compress;
+};
+// soul和calendar与母版比较（横向和纵向裁剪），poster为服务器生成的海报（大片纯色，游程编码有效）
+const IngestCase CASES[] = {
+    {"soul", "soul.png", 80, 80, false},
+    {"calendar", "calendar.png", 60, 90, true},
+    {"poster", "poster.png", 80, 80, true},
+    {"poster_raw", "poster.png", 80, 80, false},
+};
+
+static pid_t server = -1;
+static int port = 0;
+
+//*** 启动模拟服务器，等到端口可以连接
+static bool startServer(const std::vector<std::string>& options) {
+    port = 18000 + getpid() % 1000;
+    server = fork();
+    if (server == 0) {
+        freopen("/dev/null", "w", stderr);
+        std::vector<std::string> args = {"python3", SERVER_SCRIPT, "--port", std::to_string(port)};
+        args.insert(args.end(), options.begin(), options.end());
+        std::vector<char*> argv;
+        for (std::string& arg : args) {
+            argv.push_back(&arg[0]);
+        }
+        argv.push_back(nullptr);
+        execvp("python3", argv.data());
+        _exit(127);
+    }
+    for (int i = 0; i < 100; i++) {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bool connected = connect(fd, (struct sockaddr*)&address, sizeof(address)) == 0;
+        close(fd);
+        if (connected) {
+            return true;
+        }
+        struct timespec wait = {0, 50 * 1000 * 1000};
+        nanosleep(&wait, nullptr);
+    }
+    return false;
+}
+
+//*** 停止模拟服务器
+static void stopServer() {
+    if (server > 0) {
+        kill(server, SIGTERM);
+        waitpid(server, nullptr, 0);
+        server = -1;
+    }
+}
+
+//*** 服务器上图片的地址（与/dsapi/返回的fenxiang_img相同）
+static std::string imageUrl(const char* image, const char* query = "") {
+    return "http://127.0.0.1:" + std::to_string(port) + "/images/" + image + query;
+}
+
+//*** 读取整个文件
+static bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        data.insert(data.end(), buf, buf + n);
+    }
+    fclose(file);
+    return true;
+}
+
+//*** 参考：由lodepng解码母版，按目标宽高比居中裁剪，每个目标像素取对应源区域的平均值
+static bool referencePixels(const char* image, uint16_t width, uint16_t height, std::vector<uint16_t>& pixels) {
+    std::vector<uint8_t> png;
+    unsigned char* rgba = nullptr;
+    unsigned sw = 0;
+    unsigned sh = 0;
+    if (!readFile(std::string(MASTERS_DIR) + "/" + image, png) ||
+        lodepng_decode32(&rgba, &sw, &sh, png.data(), png.size()) != 0) {
+        return false;
+    }
+    uint64_t cropW = sw;
+    uint64_t cropH = sh;
+    if ((uint64_t)sw * height > (uint64_t)sh * width) {
+        cropW = (uint64_t)sh * width / height;
+    } else {
+        cropH = (uint64_t)sw * height / width;
+    }
+    uint64_t left = (sw - cropW) / 2;
+    uint64_t top = (sh - cropH) / 2;
+    pixels.resize((size_t)width * height);
+    for (uint32_t ty = 0; ty < height; ty++) {
+        uint64_t y0 = top + ty * cropH / height;
+        uint64_t y1 = std::max(top + (ty + 1) * cropH / height, y0 + 1);
+        for (uint32_t tx = 0; tx < width; tx++) {
+            uint64_t x0 = left + tx * cropW / width;
+            uint64_t x1 = std::max(left + (tx + 1) * cropW / width, x0 + 1);
+            uint32_t sum[3] = {0, 0, 0};
+            for (uint64_t y = y0; y < y1; y++) {
+                for (uint64_t x = x0; x < x1; x++) {
+                    for (int c = 0; c < 3; c++) {
+                        sum[c] += rgba[(y * sw + x) * 4 + c];
+                    }
+                }
+            }
+            uint32_t count = (x1 - x0) * (y1 - y0);
+            pixels[ty * width + tx] = lv_color_make(sum[0] / count, sum[1] / count, sum[2] / count).full;
+        }
+    }
+    lv_mem_free(rgba);
+    return true;
+}
+
+//*** 导入图像的像素（游程编码的逐行解压），格式无效时返回false
+static bool imagePixels(const lv_img_dsc_t* dsc, std::vector<uint16_t>& pixels) {
+    uint16_t width = dsc->header.w;
+    uint16_t height = dsc->header.h;
+    pixels.resize((size_t)width * height);
+    if (dsc->header.cf == LV_IMG_CF_TRUE_COLOR) {
+        if (dsc->data_size != pixels.size() * 2) {
+            return false;
+        }
+        memcpy(pixels.data(), dsc->data, dsc->data_size);
+        return true;
+    }
+    if (dsc->header.cf != RLE_IMAGE_CF) {
+        return false;
+    }
+    for (uint16_t y = 0; y < height; y++) {
+        if (!RleImage::decodeLine(dsc->data, 0, y, width, (lv_color_t*)&pixels[(size_t)y * width])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//*** 读取保存的文件
+static bool readStoredFile(const std::string& name, std::string& content) {
+    FILE* file = fopen((std::string(STORAGE_DIR) + IMAGE_INGEST_DIR + name).c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    char buf[4096];
+    size_t n;
+    content.clear();
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        content.append(buf, n);
+    }
+    fclose(file);
+    return true;
+}
+
+// 没有导入时使用的图像
+static lv_img_dsc_t fallback;
+
+//*** 检查导入的图像：尺寸、格式、像素和保存的文件
+static void checkImage(const IngestCase& item, const std::vector<uint16_t>& expected, const std::string& url) {
+    ImageIngest* ingest = ImageIngest::getInstance();
+    const lv_img_dsc_t* dsc = ingest->image(item.name, &fallback);
+    CHECK(dsc != &fallback);
+    if (dsc == &fallback) {
+        return;
+    }
+    CHECK(dsc->header.w == item.width && dsc->header.h == item.height);
+    // 不压缩时保存原始数据；压缩时保存游程编码，压缩无效（不小于原始数据的90%）时仍保存原始数据
+    CHECK(dsc->header.cf == LV_IMG_CF_TRUE_COLOR || (item.compress && dsc->header.cf == RLE_IMAGE_CF));
+    std::vector<uint16_t> pixels;
+    CHECK(imagePixels(dsc, pixels));
+    size_t mismatch = 0;
+    while (mismatch < pixels.size() && mismatch < expected.size() && pixels[mismatch] == expected[mismatch]) {
+        mismatch++;
+    }
+    CHECK(pixels.size() == expected.size() && mismatch == expected.size());
+    if (mismatch != expected.size()) {
+        printf("  %s: 像素(%zu,%zu)不同\n", item.name, mismatch % item.width, mismatch / item.width);
+    }
+    // 保存的文件：LVGL图像头加像素数据，来源地址另存
+    std::string stored;
+    CHECK(readStoredFile(std::string(item.name) + ".bin", stored));
+    CHECK(stored.size() == sizeof(lv_img_header_t) + dsc->data_size);
+    CHECK(stored.size() >= sizeof(lv_img_header_t) &&
+          memcmp(stored.data() + sizeof(lv_img_header_t), dsc->data, dsc->data_size) == 0);
+    std::string storedUrl;
+    CHECK(readStoredFile(std::string(item.name) + ".url", storedUrl));
+    CHECK(storedUrl == url);
+}
+
+int main() {
+    lv_init();
+    signal(SIGPIPE, SIG_IGN);
+    mkdir(STORAGE_DIR, 0755);
+    mkdir((std::string(STORAGE_DIR) + "/img").c_str(), 0755);
+    for (const IngestCase& item : CASES) {
+        for (const char* ext : {".bin", ".url", ".tmp"}) {
+            remove((std::string(STORAGE_DIR) + IMAGE_INGEST_DIR + item.name + ext).c_str());
+        }
+    }
+    ImageIngest::setStorageDir(STORAGE_DIR);
+    ImageIngest* ingest = ImageIngest::getInstance();
+    ingest->init();
+    CHECK(ingest->image("soul", &fallback) == &fallback);
+
+    // 服务器以Content-Length提供图片
+    if (!startServer({})) {
+        printf("无法启动%s（须在test/host中运行，需要python3）\n", SERVER_SCRIPT);
+        stopServer();
+        return 1;
+    }
+    std::vector<std::vector<uint16_t>> expected(sizeof(CASES) / sizeof(CASES[0]));
+    for (size_t i = 0; i < sizeof(CASES) / sizeof(CASES[0]); i++) {
+        const IngestCase& item = CASES[i];
+        std::string url = imageUrl(item.image);
+        CHECK(ingest->ingest(item.name, url.c_str(), item.width, item.height, item.compress));
+        if (strcmp(item.image, "poster.png") != 0) {
+            CHECK(referencePixels(item.image, item.width, item.height, expected[i]));
+        } else {
+            // 海报没有母版：游程编码的版本须与原始数据的版本逐像素相同
+            const lv_img_dsc_t* raw = ingest->image("poster_raw", &fallback);
+            if (raw == &fallback) {
+                CHECK(ingest->ingest("poster_raw", url.c_str(), item.width, item.height, false));
+                raw = ingest->image("poster_raw", &fallback);
+            }
+            CHECK(imagePixels(raw, expected[i]));
+        }
+        checkImage(item, expected[i], url);
+        const lv_img_dsc_t* dsc = ingest->image(item.name, &fallback);
+        printf("%-10s %-11s -> %2ux%-2u %-6s %5u字节 一致\n", item.name, item.image, dsc->header.w, dsc->header.h,
+               dsc->header.cf == RLE_IMAGE_CF ? "RLE" : "RGB565", dsc->data_size);
+    }
+    // 海报有大片纯色，压缩须有效
+    CHECK(ingest->image("poster", &fallback)->header.cf == RLE_IMAGE_CF);
+    CHECK(ingest->image("poster", &fallback)->data_size < 80 * 80 * 2 * 9 / 10);
+
+    // 地址不变时不重新导入（图像数据不变）；下载失败或不是PNG时保留原来的图像
+    const lv_img_dsc_t* soul = ingest->image("soul", &fallback);
+    const uint8_t* soulData = soul->data;
+    CHECK(ingest->ingest("soul", imageUrl("soul.png").c_str(), 80, 80, false));
+    CHECK(ingest->image("soul", &fallback)->data == soulData);
+    CHECK(!ingest->ingest("soul", imageUrl("no_such.png").c_str(), 80, 80, false));
+    CHECK(!ingest->ingest("soul", ("http://127.0.0.1:" + std::to_string(port) + "/dsapi/").c_str(), 80, 80, false));
+    CHECK(ingest->image("soul", &fallback)->data == soulData);
+    checkImage(CASES[0], expected[0], imageUrl("soul.png"));
+    // 没有空闲位置
+    CHECK(!ingest->ingest("extra", imageUrl("soul.png").c_str(), 80, 80, false));
+    stopServer();
+    printf("地址不变时不重新下载，失败时保留原来的图像\n");
+
+    // 模拟重启：从保存的文件重新读取图像和来源地址
+    std::string soulUrl = imageUrl("soul.png");
+    ingest->reset();
+    CHECK(ingest->image("soul", &fallback) == &fallback);
+    ingest->init();
+    for (size_t i = 0; i < sizeof(CASES) / sizeof(CASES[0]); i++) {
+        checkImage(CASES[i], expected[i], imageUrl(CASES[i].image));
+    }
+    // 服务器已停止：地址不变时不需要下载，地址改变时下载失败并保留原来的图像
+    CHECK(ingest->ingest("soul", soulUrl.c_str(), 80, 80, false));
+    CHECK(!ingest->ingest("soul", imageUrl("soul.png", "?v=2").c_str(), 80, 80, false));
+    checkImage(CASES[0], expected[0], soulUrl);
+    printf("重启后重新读取 %zu 幅图像 一致\n", sizeof(CASES) / sizeof(CASES[0]));
+
+    // 服务器改用分块传输（慢速网络）：新地址重新下载，显示任务下次获取时采用新图像，结果相同
+    CHECK(startServer({"--chunked", "--poster-size", "1000x700"}));
+    std::string chunkedUrl = imageUrl("soul.png", "?v=3");
+    CHECK(ingest->ingest("soul", chunkedUrl.c_str(), 80, 80, false));
+    CHECK(ingest->image("soul", &fallback)->data != soulData);
+    checkImage(CASES[0], expected[0], chunkedUrl);
+    std::string posterUrl = imageUrl("poster.png", "?v=3");
+    CHECK(ingest->ingest("poster", posterUrl.c_str(), 80, 80, true));
+    const lv_img_dsc_t* poster = ingest->image("poster", &fallback);
+    CHECK(poster->header.cf == RLE_IMAGE_CF && poster->header.w == 80 && poster->header.h == 80);
+    stopServer();
+    printf("分块传输 一致\n");
+
+    ingest->reset();
+    if (failures > 0) {
+        printf("image_ingest_test: %d 项失败\n", failures);
+        return 1;
+    }
+    printf("image_ingest_test: 全部通过\n");
+    return 0;
+}
@@ -0,0 +1,304 @@
+// JPEG条带解码与LVGL绘制：JPEGDecoder由按参考位图输出MCU的替身代替（顺序和边缘填充与JPEGDecoder相同），
+// 图像经LVGL按绘制缓冲区分区域刷新后须与参考位图逐像素相同，整屏刷新（12个或与设备相同的48个区域）
+// 每帧只从头解码一次；只重绘中部区域时解码到该区域为止，解码中途失败后可重新开始（在PC上运行，见test/host/Makefile）
+#include "ui/jpeg_strip.h"
+#include <lvgl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            printf("  失败: %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                    \
+        }                                                                  \
+    } while (0)
+
+// 与设备相同的屏幕尺寸
+const uint16_t SCREEN_WIDTH = 320;
+const uint16_t SCREEN_HEIGHT = 480;
+// 超出图像的MCU填充值（不应出现在屏幕上）
+const uint16_t PADDING = 0xF81F;
+// 图像的颜色格式（与JPEG_IMAGE_CF相同）
+#define TEST_JPEG_CF LV_IMG_CF_USER_ENCODED_1
+
+// 测试图像：参考位图和按MCU输出的统计
+struct Fixture {
+    lv_img_dsc_t dsc;            // LVGL图像源（数据只是JPEG标记，像素来自参考位图）
+    uint16_t width;
+    uint16_t height;
+    uint16_t mcuWidth;
+    uint16_t mcuHeight;
+    std::vector<uint16_t> pixels; // 参考位图（RGB565）
+    JpegStripCounters counters;
+    uint32_t starts;             // 来源从头开始的次数
+    uint32_t mcus;               // 输出的MCU数
+    int failAfter;               // 输出这么多MCU后失败（-1表示不失败）
+};
+
+static const uint8_t JPEG_DATA[] = {0xFF, 0xD8, 0xFF, 0xD9};
+
+//*** 生成参考位图：每个像素各不相同的伪随机图案，相邻行和相邻MCU错位时必然不同
+static void makeFixture(Fixture& fixture, uint16_t width, uint16_t height, uint16_t mcuWidth, uint16_t mcuHeight,
+                        uint32_t seed) {
+    memset(&fixture.dsc, 0, sizeof(fixture.dsc));
+    fixture.dsc.header.cf = TEST_JPEG_CF;
+    fixture.dsc.header.w = width;
+    fixture.dsc.header.h = height;
+    fixture.dsc.data = JPEG_DATA;
+    fixture.dsc.data_size = sizeof(JPEG_DATA);
+    fixture.width = width;
+    fixture.height = height;
+    fixture.mcuWidth = mcuWidth;
+    fixture.mcuHeight = mcuHeight;
+    fixture.pixels.resize((size_t)width * height);
+    for (uint16_t& pixel : fixture.pixels) {
+        seed = seed * 1103515245 + 12345;
+        pixel = (seed >> 12) & 0xFFFF;
+        if (pixel == PADDING) {
+            pixel ^= 1;
+        }
+    }
+    memset(&fixture.counters, 0, sizeof(fixture.counters));
+    fixture.starts = 0;
+    fixture.mcus = 0;
+    fixture.failAfter = -1;
+}
+
+/**
+ * JPEGDecoder的替身：从参考位图按行从左到右输出MCU，右边和下边缘超出图像的部分填充PADDING
+ */
+class BitmapMcuSource : public JpegMcuSource {
+private:
+    Fixture* fixture = nullptr;
+    int next = 0;                // 下一个MCU的序号
+    uint16_t block[16 * 16];
+
+public:
+    bool open = false;           // 解码中（start之后、abort之前）
+
+    bool start(const void* image, JpegStripInfo& info) override {
+        CHECK(!open);
+        fixture = (Fixture*)image;
+        fixture->starts++;
+        next = 0;
+        open = true;
+        info.width = fixture->width;
+        info.height = fixture->height;
+        info.mcuWidth = fixture->mcuWidth;
+        info.mcuHeight = fixture->mcuHeight;
+        return true;
+    }
+    bool readMcu(uint16_t& mcuX, const uint16_t*& pixels) override {
+        int perRow = (fixture->width + fixture->mcuWidth - 1) / fixture->mcuWidth;
+        int rows = (fixture->height + fixture->mcuHeight - 1) / fixture->mcuHeight;
+        if (!open || next >= perRow * rows || next == fixture->failAfter) {
+            return false;
+        }
+        int x0 = (next % perRow) * fixture->mcuWidth;
+        int y0 = (next / perRow) * fixture->mcuHeight;
+        for (int y = 0; y < fixture->mcuHeight; y++) {
+            for (int x = 0; x < fixture->mcuWidth; x++) {
+                bool inside = x0 + x < fixture->width && y0 + y < fixture->height;
+                block[y * fixture->mcuWidth + x] =
+                    inside ? fixture->pixels[(size_t)(y0 + y) * fixture->width + x0 + x] : PADDING;
+            }
+        }
+        mcuX = next % perRow;
+        pixels = block;
+        next++;
+        fixture->mcus++;
+        return true;
+    }
+    void abort() override {
+        CHECK(open);
+        open = false;
+    }
+};
+
+static BitmapMcuSource source;
+static JpegStrip strip(&source);
+
+// 屏幕内容和刷新的区域数
+static std::vector<uint16_t> framebuffer(SCREEN_WIDTH * SCREEN_HEIGHT);
+static int flushes = 0;
+
+//*** 显示刷新回调：复制到屏幕内容
+static void flushCallback(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* pixels) {
+    lv_coord_t width = lv_area_get_width(area);
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&framebuffer[y * SCREEN_WIDTH + area->x1], pixels + (y - area->y1) * width, width * sizeof(lv_color_t));
+    }
+    flushes++;
+    lv_disp_flush_ready(drv);
+}
+
+// LVGL解码器回调：与JpegImage相同，图像键为Fixture（JpegImage中为统计项）
+//*** 读取图像信息
+static lv_res_t infoCallback(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header) {
+    LV_UNUSED(decoder);
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE || ((const lv_img_dsc_t*)src)->header.cf != TEST_JPEG_CF) {
+        return LV_RES_INV;
+    }
+    const Fixture* fixture = (const Fixture*)src;
+    header->cf = LV_IMG_CF_TRUE_COLOR;
+    header->always_zero = 0;
+    header->w = fixture->width;
+    header->h = fixture->height;
+    return LV_RES_OK;
+}
+//*** 打开图像
+static lv_res_t openCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    dsc->user_data = (void*)dsc->src;
+    dsc->img_data = nullptr;
+    return LV_RES_OK;
+}
+//*** 读取一行
+static lv_res_t readLineCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc, lv_coord_t x, lv_coord_t y,
+                                 lv_coord_t len, uint8_t* buf) {
+    LV_UNUSED(decoder);
+    Fixture* fixture = (Fixture*)dsc->user_data;
+    return strip.readLine(fixture, &fixture->counters, x, y, len, buf) ? LV_RES_OK : LV_RES_INV;
+}
+//*** 关闭图像
+static void closeCallback(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    dsc->user_data = nullptr;
+}
+
+//*** 比较屏幕上的图像区域与参考位图，返回不同的像素数
+static size_t compareScreen(const Fixture& fixture, lv_coord_t left, lv_coord_t top) {
+    size_t mismatches = 0;
+    for (int y = 0; y < fixture.height; y++) {
+        for (int x = 0; x < fixture.width; x++) {
+            if (framebuffer[(top + y) * SCREEN_WIDTH + left + x] != fixture.pixels[(size_t)y * fixture.width + x]) {
+                if (mismatches == 0) {
+                    printf("  像素(%d,%d)不同\n", x, y);
+                }
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+//*** 整屏刷新若干帧：每帧的区域数、从头解码次数、MCU行数和像素与参考相同
+static void checkFullFrames(Fixture& fixture, lv_coord_t left, lv_coord_t top, int expectedAreas) {
+    int stripsPerImage = (fixture.height + fixture.mcuHeight - 1) / fixture.mcuHeight;
+    int mcusPerImage = stripsPerImage * ((fixture.width + fixture.mcuWidth - 1) / fixture.mcuWidth);
+    for (int frame = 0; frame < 3; frame++) {
+        JpegStripCounters before = fixture.counters;
+        uint32_t starts = fixture.starts;
+        uint32_t mcus = fixture.mcus;
+        std::fill(framebuffer.begin(), framebuffer.end(), 0);
+        flushes = 0;
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(nullptr);
+        CHECK(flushes == expectedAreas);
+        CHECK(fixture.counters.restarts - before.restarts == 1);
+        CHECK(fixture.starts - starts == 1);
+        CHECK((int)(fixture.counters.strips - before.strips) == stripsPerImage);
+        CHECK((int)(fixture.mcus - mcus) == mcusPerImage);
+        CHECK(fixture.counters.pixels - before.pixels == (uint64_t)fixture.width * fixture.height);
+        CHECK(!source.open);
+        CHECK(compareScreen(fixture, left, top) == 0);
+    }
+    printf("%3ux%-3u MCU %2ux%-2u %2d个区域 每帧解码一次 %2d个MCU行 像素一致\n", fixture.width, fixture.height,
+           fixture.mcuWidth, fixture.mcuHeight, expectedAreas, stripsPerImage);
+}
+
+//*** 在新屏幕上居中显示图像
+static lv_obj_t* showImage(Fixture& fixture, lv_coord_t left, lv_coord_t top) {
+    lv_obj_t* screen = lv_obj_create(nullptr);
+    lv_obj_t* img = lv_img_create(screen);
+    lv_img_set_src(img, &fixture.dsc);
+    lv_obj_set_pos(img, left, top);
+    lv_scr_load(screen);
+    return screen;
+}
+
+int main() {
+    lv_init();
+    static lv_color_t buffer[SCREEN_WIDTH * 40];
+    static lv_disp_draw_buf_t drawBuf;
+    static lv_disp_drv_t drv;
+    lv_disp_drv_init(&drv);
+    drv.hor_res = SCREEN_WIDTH;
+    drv.ver_res = SCREEN_HEIGHT;
+    drv.flush_cb = flushCallback;
+    drv.draw_buf = &drawBuf;
+    lv_disp_t* disp = lv_disp_drv_register(&drv);
+    lv_img_decoder_t* decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, infoCallback);
+    lv_img_decoder_set_open_cb(decoder, openCallback);
+    lv_img_decoder_set_read_line_cb(decoder, readLineCallback);
+    lv_img_decoder_set_close_cb(decoder, closeCallback);
+
+    // 全屏图像，MCU 16×16：40行的绘制缓冲区每帧12个区域，MCU行跨越区域边界
+    static Fixture full;
+    makeFixture(full, SCREEN_WIDTH, SCREEN_HEIGHT, 16, 16, 1);
+    lv_disp_draw_buf_init(&drawBuf, buffer, nullptr, SCREEN_WIDTH * 40);
+    showImage(full, 0, 0);
+    checkFullFrames(full, 0, 0, 12);
+    CHECK(strip.getStripBytes() == SCREEN_WIDTH * 16 * sizeof(lv_color_t));
+
+    // 与设备相同的10行绘制缓冲区：48个区域
+    lv_disp_draw_buf_init(&drawBuf, buffer, nullptr, SCREEN_WIDTH * 10);
+    lv_disp_drv_update(disp, &drv);
+    checkFullFrames(full, 0, 0, 48);
+
+    // 只重绘中部：从头解码到该区域的最后一个MCU行为止，图像其余部分保持上一帧的内容
+    lv_disp_draw_buf_init(&drawBuf, buffer, nullptr, SCREEN_WIDTH * 40);
+    lv_disp_drv_update(disp, &drv);
+    lv_refr_now(nullptr);
+    JpegStripCounters before = full.counters;
+    lv_area_t middle = {0, 200, SCREEN_WIDTH - 1, 259};
+    std::fill(framebuffer.begin() + 200 * SCREEN_WIDTH, framebuffer.begin() + 260 * SCREEN_WIDTH, 0);
+    lv_obj_invalidate_area(lv_scr_act(), &middle);
+    lv_refr_now(nullptr);
+    CHECK(full.counters.restarts - before.restarts == 1);
+    CHECK(full.counters.strips - before.strips == (260 + 15) / 16);
+    CHECK(compareScreen(full, 0, 0) == 0);
+    // 之后的整屏刷新（从第0行开始）须从头解码
+    checkFullFrames(full, 0, 0, 12);
+
+    // 宽高都不是MCU整数倍、MCU 16×8的图像，不在屏幕原点：边缘MCU的填充不能出现在屏幕上
+    static Fixture edge;
+    makeFixture(edge, 310, 470, 16, 8, 2);
+    showImage(edge, 5, 6);
+    checkFullFrames(edge, 5, 6, 12);
+    CHECK(strip.getStripBytes() >= 310 * 8 * sizeof(lv_color_t));
+
+    // 换回全屏图像：换了图像须从头解码
+    showImage(full, 0, 0);
+    checkFullFrames(full, 0, 0, 12);
+
+    // 解码中途失败：读取失败，来源关闭，之后的读取重新从头解码并且正确
+    static Fixture broken;
+    makeFixture(broken, 64, 64, 16, 16, 3);
+    broken.failAfter = 6;
+    std::vector<uint16_t> line(64);
+    CHECK(strip.readLine(&broken, &broken.counters, 0, 0, 64, (uint8_t*)line.data()));
+    CHECK(!strip.readLine(&broken, &broken.counters, 0, 20, 64, (uint8_t*)line.data()));
+    CHECK(!source.open);
+    broken.failAfter = -1;
+    CHECK(strip.readLine(&broken, &broken.counters, 8, 63, 56, (uint8_t*)line.data()));
+    CHECK(memcmp(line.data(), &broken.pixels[63 * 64 + 8], 56 * 2) == 0);
+    CHECK(broken.starts == 2);
+    // 超出图像的读取被拒绝
+    CHECK(!strip.readLine(&broken, &broken.counters, 0, 64, 1, (uint8_t*)line.data()));
+    CHECK(!strip.readLine(&broken, &broken.counters, 60, 0, 8, (uint8_t*)line.data()));
+    printf("解码失败后重新开始 正确\n");
+
+    if (failures > 0) {
+        printf("jpeg_strip_test: %d 项失败\n", failures);
+        return 1;
+    }
+    printf("jpeg_strip_test: 全部通过\n");
+    return 0;
+}
@@ -0,0 +1,168 @@
+// 屏幕镜像矩形编解码的往返测试（在PC上运行，见test/host/Makefile）
+#include "network/mirror_codec.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            printf("  失败: %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                    \
+        }                                                                  \
+    } while (0)
+
+// 整帧大小与屏幕相同
+const uint16_t FRAME_WIDTH = 320;
+const uint16_t FRAME_HEIGHT = 480;
+
+//*** 编码一个矩形后解码到整帧，检查编码方式、长度和像素，返回编码后的字节数
+static size_t roundTrip(const char* name, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                        const std::vector<uint16_t>& pixels, MirrorEncoding expected) {
+    std::vector<uint8_t> out(mirrorRectWorstCase(w, h));
+    size_t length = mirrorEncodeRect(out.data(), out.size(), x, y, w, h, pixels.data());
+    std::vector<uint16_t> frame((size_t)FRAME_WIDTH * FRAME_HEIGHT, 0xDEAD);
+    size_t used = mirrorDecodeRect(out.data(), length, frame.data(), FRAME_WIDTH, FRAME_HEIGHT);
+    printf("%-28s %3ux%-3u %s %6zu 字节（原始 %6zu）\n", name, w, h,
+           out[8] == MIRROR_ENCODING_RLE ? "RLE" : "RAW", length, (size_t)w * h * 2);
+    CHECK(length > 0);
+    CHECK(length <= mirrorRectWorstCase(w, h));
+    CHECK(out[8] == expected);
+    CHECK(used == length);
+    // 矩形内的像素与输入一致，矩形外保持不变
+    for (uint16_t row = 0; row < FRAME_HEIGHT; row++) {
+        for (uint16_t col = 0; col < FRAME_WIDTH; col++) {
+            uint16_t value = frame[(size_t)row * FRAME_WIDTH + col];
+            bool inside = row >= y && row < y + h && col >= x && col < x + w;
+            uint16_t want = inside ? pixels[(size_t)(row - y) * w + (col - x)] : 0xDEAD;
+            if (value != want) {
+                printf("  失败: 像素(%u,%u)为%04X，应为%04X\n", col, row, value, want);
+                failures++;
+                return length;
+            }
+        }
+    }
+    return length;
+}
+
+//*** 生成纯色像素
+static std::vector<uint16_t> solid(size_t count, uint16_t color) {
+    return std::vector<uint16_t>(count, color);
+}
+
+int main() {
+    srand(7);
+
+    // 长度恰好为254、255、256的同色段：超过255的段拆成多个记录
+    roundTrip("单段 254", 0, 0, 254, 1, solid(254, 0x1234), MIRROR_ENCODING_RLE);
+    size_t len255 = roundTrip("单段 255", 0, 0, 255, 1, solid(255, 0x1234), MIRROR_ENCODING_RLE);
+    CHECK(len255 == MIRROR_RECT_HEADER_SIZE + 3);
+    size_t len256 = roundTrip("单段 256", 0, 0, 256, 1, solid(256, 0x1234), MIRROR_ENCODING_RLE);
+    CHECK(len256 == MIRROR_RECT_HEADER_SIZE + 6);
+
+    // 整屏纯色：153600个像素的同色段跨行拆分为602段
+    size_t fullLength = roundTrip("整屏纯色", 0, 0, FRAME_WIDTH, FRAME_HEIGHT,
+                                  solid((size_t)FRAME_WIDTH * FRAME_HEIGHT, 0x0000), MIRROR_ENCODING_RLE);
+    CHECK(fullLength == MIRROR_RECT_HEADER_SIZE + 3 * (((size_t)FRAME_WIDTH * FRAME_HEIGHT + 254) / 255));
+
+    // 长同色段与短段交替（文字行和背景），段长跨过255的边界
+    std::vector<uint16_t> mixed;
+    for (int band = 0; mixed.size() < 300 * 40; band++) {
+        size_t run = 1 + (band * 97) % 700;
+        for (size_t k = 0; k < run && mixed.size() < 300 * 40; k++) {
+            mixed.push_back(band & 1 ? 0xFFFF : (uint16_t)band);
+        }
+    }
+    roundTrip("长短段交替（偏移）", 10, 200, 300, 40, mixed, MIRROR_ENCODING_RLE);
+
+    // 相邻像素都不同：RLE比原始像素长，回退为RAW
+    std::vector<uint16_t> alternating(64 * 64);
+    for (size_t i = 0; i < alternating.size(); i++) {
+        alternating[i] = i & 1 ? 0xF800 : 0x001F;
+    }
+    roundTrip("交替像素（回退RAW）", 256, 416, 64, 64, alternating, MIRROR_ENCODING_RAW);
+
+    // 随机噪声（照片类图像）
+    std::vector<uint16_t> noise(120 * 90);
+    for (size_t i = 0; i < noise.size(); i++) {
+        noise[i] = (uint16_t)rand();
+    }
+    roundTrip("随机噪声（回退RAW）", 100, 100, 120, 90, noise, MIRROR_ENCODING_RAW);
+
+    // 前半长段、后半噪声：中途超过原始长度才放弃RLE
+    std::vector<uint16_t> halfNoise = solid(200 * 20, 0x7BEF);
+    for (size_t i = halfNoise.size() / 4; i < halfNoise.size(); i++) {
+        halfNoise[i] = (uint16_t)rand();
+    }
+    roundTrip("前段纯色后段噪声（RAW）", 0, 0, 200, 20, halfNoise, MIRROR_ENCODING_RAW);
+
+    // 单个像素：RLE(3字节)比原始像素(2字节)长
+    roundTrip("单像素（RAW）", FRAME_WIDTH - 1, FRAME_HEIGHT - 1, 1, 1, solid(1, 0xABCD), MIRROR_ENCODING_RAW);
+
+    // 长度正好相等时使用RLE：3个像素一段、两段共6字节等于原始的6字节
+    std::vector<uint16_t> tie = {1, 2, 2};
+    roundTrip("RLE与原始等长", 5, 5, 3, 1, tie, MIRROR_ENCODING_RLE);
+
+    // 一批中连续的多个矩形（与浏览器的解码顺序相同）
+    {
+        std::vector<uint8_t> batch(64 * 1024);
+        size_t fill = 0;
+        std::vector<uint16_t> a = solid(320 * 10, 0x0841);
+        std::vector<uint16_t> b = noise;
+        fill += mirrorEncodeRect(batch.data() + fill, batch.size() - fill, 0, 0, 320, 10, a.data());
+        fill += mirrorEncodeRect(batch.data() + fill, batch.size() - fill, 100, 300, 120, 90, b.data());
+        std::vector<uint16_t> frame((size_t)FRAME_WIDTH * FRAME_HEIGHT, 0);
+        size_t pos = 0;
+        int rects = 0;
+        while (pos < fill) {
+            size_t used = mirrorDecodeRect(batch.data() + pos, fill - pos, frame.data(), FRAME_WIDTH, FRAME_HEIGHT);
+            CHECK(used > 0);
+            if (used == 0) {
+                break;
+            }
+            pos += used;
+            rects++;
+        }
+        CHECK(rects == 2);
+        CHECK(frame[9 * FRAME_WIDTH + 319] == 0x0841);
+        CHECK(frame[300 * FRAME_WIDTH + 100] == b[0]);
+        CHECK(frame[389 * FRAME_WIDTH + 219] == b.back());
+        printf("%-28s %d 个矩形 %zu 字节\n", "一批多个矩形", rects, fill);
+    }
+
+    // 空间不足和无效输入
+    {
+        std::vector<uint16_t> pixels = solid(16, 0x1111);
+        uint8_t small[MIRROR_RECT_HEADER_SIZE + 31];
+        CHECK(mirrorEncodeRect(small, sizeof(small), 0, 0, 16, 1, pixels.data()) == 0);
+        CHECK(mirrorEncodeRect(small, sizeof(small), 0, 0, 0, 1, pixels.data()) == 0);
+
+        uint8_t out[MIRROR_RECT_HEADER_SIZE + 32];
+        size_t length = mirrorEncodeRect(out, sizeof(out), 310, 0, 16, 1, pixels.data());
+        std::vector<uint16_t> frame((size_t)FRAME_WIDTH * FRAME_HEIGHT, 0);
+        // 超出整帧范围
+        CHECK(length > 0);
+        CHECK(mirrorDecodeRect(out, length, frame.data(), FRAME_WIDTH, FRAME_HEIGHT) == 0);
+        length = mirrorEncodeRect(out, sizeof(out), 0, 0, 16, 1, pixels.data());
+        // 数据不完整
+        CHECK(mirrorDecodeRect(out, length - 1, frame.data(), FRAME_WIDTH, FRAME_HEIGHT) == 0);
+        CHECK(mirrorDecodeRect(out, MIRROR_RECT_HEADER_SIZE - 1, frame.data(), FRAME_WIDTH, FRAME_HEIGHT) == 0);
+        // RLE的像素数与矩形不符
+        out[MIRROR_RECT_HEADER_SIZE] = 15;
+        CHECK(mirrorDecodeRect(out, length, frame.data(), FRAME_WIDTH, FRAME_HEIGHT) == 0);
+        // 未知的编码方式
+        out[8] = 7;
+        CHECK(mirrorDecodeRect(out, length, frame.data(), FRAME_WIDTH, FRAME_HEIGHT) == 0);
+        printf("%-28s 完成\n", "无效输入");
+    }
+
+    if (failures > 0) {
+        printf("mirror_codec_test: %d 项失败\n", failures);
+        return 1;
+    }
+    printf("mirror_codec_test: 全部通过\n");
+    return 0;
+}
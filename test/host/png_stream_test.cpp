@@ -0,0 +1,233 @@
+// 流式PNG解码与lodepng的逐像素比较：解码data/png/中的样本（由make_corpus.py生成），
+// 有效样本的每一行须与lodepng_decode32的结果相同，bad_开头的样本须被拒绝（在PC上运行，见test/host/Makefile）
+#include "ui/png_stream.h"
+#include <lvgl.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// LVGL自带的lodepng（C编译），lodepng.h在C++中还会声明C++接口，这里只声明需要的函数
+extern "C" unsigned lodepng_decode32(unsigned char** out, unsigned* w, unsigned* h, const unsigned char* in,
+                                     size_t insize);
+
+static int failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            printf("  失败: %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                    \
+        }                                                                  \
+    } while (0)
+
+const char* CORPUS_DIR = "data/png";
+
+// 应被拒绝的样本和流式解码器应返回的错误
+struct Rejected {
+    const char* name;
+    PngError error;
+    PngError alternative;    // 也可以接受的错误（截断的数据可能在读取或解压时发现）
+};
+const Rejected REJECTED[] = {
+    {"bad_signature.png", PNG_ERROR_SIGNATURE, PNG_ERROR_SIGNATURE},
+    {"bad_truncated.png", PNG_ERROR_READ, PNG_ERROR_DATA},
+    {"bad_no_idat.png", PNG_ERROR_HEADER, PNG_ERROR_READ},
+    {"bad_filter.png", PNG_ERROR_DATA, PNG_ERROR_DATA},
+    {"bad_depth.png", PNG_ERROR_HEADER, PNG_ERROR_HEADER},
+    {"bad_no_plte.png", PNG_ERROR_HEADER, PNG_ERROR_HEADER},
+    {"bad_zlib_header.png", PNG_ERROR_DATA, PNG_ERROR_DATA},
+    {"bad_width.png", PNG_ERROR_HEADER, PNG_ERROR_HEADER},
+};
+
+// 内存中的样本，每次读取的长度由种子决定（为0时一次读满）
+struct SampleReader {
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+    uint32_t seed;
+};
+
+//*** 读取函数：随机长度的部分读取，检查解码器在任意位置被截断的读取下仍然正确
+static size_t readSample(void* context, uint8_t* buf, size_t length) {
+    SampleReader* reader = (SampleReader*)context;
+    size_t want = length;
+    if (reader->seed != 0) {
+        reader->seed = reader->seed * 1103515245 + 12345;
+        want = 1 + (reader->seed >> 8) % length;
+    }
+    size_t n = std::min(want, reader->size - reader->pos);
+    memcpy(buf, reader->data + reader->pos, n);
+    reader->pos += n;
+    return n;
+}
+
+//*** 读取整个文件
+static bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        data.insert(data.end(), buf, buf + n);
+    }
+    fclose(file);
+    return true;
+}
+
+//*** 流式解码整幅图像，返回第一个错误；reference不为空时逐行比较，mismatchRow为第一个不同的行
+static PngError decode(const std::vector<uint8_t>& data, uint32_t seed, const uint8_t* reference,
+                       int& mismatchRow, PngHeader& header) {
+    SampleReader reader = {data.data(), data.size(), 0, seed};
+    PngStream png;
+    mismatchRow = -1;
+    PngError error = png.begin(readSample, &reader);
+    if (error != PNG_OK) {
+        return error;
+    }
+    header = png.header();
+    std::vector<uint8_t> rgba((size_t)header.width * 4);
+    for (uint32_t y = 0; y < header.height; y++) {
+        error = png.readRow(rgba.data());
+        if (error != PNG_OK) {
+            png.end();
+            return error;
+        }
+        if (reference != nullptr && mismatchRow < 0 &&
+            memcmp(rgba.data(), reference + (size_t)y * header.width * 4, rgba.size()) != 0) {
+            mismatchRow = (int)y;
+        }
+    }
+    // 所有行读取后不再输出
+    error = png.readRow(rgba.data());
+    png.end();
+    return error == PNG_ERROR_END ? PNG_OK : PNG_ERROR_DATA;
+}
+
+//*** 比较一个有效样本
+static void checkValid(const std::string& name, const std::vector<uint8_t>& data) {
+    unsigned char* reference = nullptr;
+    unsigned width = 0;
+    unsigned height = 0;
+    unsigned lodeError = lodepng_decode32(&reference, &width, &height, data.data(), data.size());
+    CHECK(lodeError == 0);
+    if (lodeError != 0) {
+        printf("  %s: lodepng错误%u\n", name.c_str(), lodeError);
+        return;
+    }
+    // 只读取图像信息
+    SampleReader reader = {data.data(), data.size(), 0, 0};
+    PngHeader header;
+    CHECK(PngStream::readHeader(readSample, &reader, header) == PNG_OK);
+    CHECK(header.width == width && header.height == height);
+    // 有Alpha通道或tRNS块时须标记为透明；不透明的图像lodepng输出的Alpha全为255
+    bool opaque = true;
+    for (size_t i = 3; i < (size_t)width * height * 4; i += 4) {
+        opaque = opaque && reference[i] == 255;
+    }
+    CHECK(header.hasAlpha || opaque);
+    // 一次读满和三种随机的部分读取
+    const uint32_t seeds[] = {0, 1, 77, 4099};
+    for (uint32_t seed : seeds) {
+        int mismatchRow = -1;
+        PngHeader decoded;
+        PngError error = decode(data, seed, reference, mismatchRow, decoded);
+        CHECK(error == PNG_OK);
+        CHECK(mismatchRow < 0);
+        if (error != PNG_OK || mismatchRow >= 0) {
+            printf("  %s: 种子%u，错误%d，第%d行不同\n", name.c_str(), seed, error, mismatchRow);
+            break;
+        }
+    }
+    printf("%-28s %4ux%-4u 颜色类型%u %2u位%s 一致\n", name.c_str(), width, height, header.colorType, header.bitDepth,
+           header.hasKey || (header.colorType == 3 && header.hasAlpha) ? " tRNS" : "     ");
+    lv_mem_free(reference);
+}
+
+//*** 检查应被拒绝的样本
+static void checkRejected(const std::string& name, const std::vector<uint8_t>& data) {
+    const Rejected* expected = nullptr;
+    for (const Rejected& item : REJECTED) {
+        if (name == item.name) {
+            expected = &item;
+        }
+    }
+    CHECK(expected != nullptr);
+    unsigned char* reference = nullptr;
+    unsigned width = 0;
+    unsigned height = 0;
+    unsigned lodeError = lodepng_decode32(&reference, &width, &height, data.data(), data.size());
+    lv_mem_free(reference);
+    CHECK(lodeError != 0);
+    const uint32_t seeds[] = {0, 1, 77, 4099};
+    for (uint32_t seed : seeds) {
+        int mismatchRow = -1;
+        PngHeader header;
+        PngError error = decode(data, seed, nullptr, mismatchRow, header);
+        if (expected != nullptr) {
+            CHECK(error == expected->error || error == expected->alternative);
+        }
+        if (seed == 0) {
+            printf("%-28s 拒绝（错误%d，lodepng错误%u）\n", name.c_str(), error, lodeError);
+        }
+    }
+}
+
+int main() {
+    DIR* dir = opendir(CORPUS_DIR);
+    if (dir == nullptr) {
+        printf("无法打开%s（须在test/host中运行）\n", CORPUS_DIR);
+        return 1;
+    }
+    std::vector<std::string> names;
+    while (struct dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".png") == 0) {
+            names.push_back(name);
+        }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+    int valid = 0;
+    int rejected = 0;
+    bool interlacedSeen = false;
+    for (const std::string& name : names) {
+        std::vector<uint8_t> data;
+        CHECK(readFile(std::string(CORPUS_DIR) + "/" + name, data));
+        if (name.compare(0, 4, "bad_") == 0) {
+            checkRejected(name, data);
+            rejected++;
+        } else if (name == "interlaced.png") {
+            // lodepng能解码，流式解码器不支持，PngImage交给LVGL的PNG解码器
+            unsigned char* reference = nullptr;
+            unsigned width = 0;
+            unsigned height = 0;
+            CHECK(lodepng_decode32(&reference, &width, &height, data.data(), data.size()) == 0);
+            lv_mem_free(reference);
+            SampleReader reader = {data.data(), data.size(), 0, 0};
+            PngHeader header;
+            CHECK(PngStream::readHeader(readSample, &reader, header) == PNG_ERROR_INTERLACED);
+            printf("%-28s 隔行扫描，交给LVGL的PNG解码器\n", name.c_str());
+            interlacedSeen = true;
+        } else {
+            checkValid(name, data);
+            valid++;
+        }
+    }
+    // 样本目录不完整时测试不能算通过
+    CHECK(valid >= 40);
+    CHECK(rejected == (int)(sizeof(REJECTED) / sizeof(REJECTED[0])));
+    CHECK(interlacedSeen);
+    printf("有效样本 %d 个，拒绝 %d 个\n", valid, rejected);
+    if (failures > 0) {
+        printf("png_stream_test: %d 项失败\n", failures);
+        return 1;
+    }
+    printf("png_stream_test: 全部通过\n");
+    return 0;
+}
@@ -0,0 +1,43 @@
+// 主机测试中代替Arduino.h：lv_conf.h中LVGL的时钟使用millis()；
+// 默认使用系统的单调时钟，测试可以切换到模拟时钟逐帧推进（如检查过渡在millis()回绕时仍能结束），实现见arduino_clock.c
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t micros(void);
+uint32_t millis(void);
+// 切换到模拟时钟并设置当前时间（毫秒），之后只有hostClockAdvance会推进时钟
+void hostClockSet(uint32_t ms);
+// 推进模拟时钟（微秒）
+void hostClockAdvance(uint32_t us);
+
+// 被测模块声明的FreeRTOS任务句柄（config.h）
+typedef void* TaskHandle_t;
+
+#ifdef __cplusplus
+}
+
+// 被测模块的日志输出到标准输出
+struct HostSerial {
+    void println(const char* text) {
+        puts(text);
+    }
+    int printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        va_list args;
+        va_start(args, format);
+        int n = vprintf(format, args);
+        va_end(args);
+        return n;
+    }
+};
+inline HostSerial Serial;
+#endif
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,39 @@
+// 主机测试的millis()和micros()：与LVGL一起编译进静态库
+#include "Arduino.h"
+#include <stdbool.h>
+#include <time.h>
+
+// 模拟时钟（微秒），simulated为false时使用系统的单调时钟
+static bool simulated = false;
+static uint64_t simulatedMicros = 0;
+
+//*** 当前时间（微秒）
+static uint64_t nowMicros(void) {
+    if (simulated) {
+        return simulatedMicros;
+    }
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000ull + t.tv_nsec / 1000;
+}
+
+//*** 当前时间（微秒，32位）
+uint32_t micros(void) {
+    return (uint32_t)nowMicros();
+}
+
+//*** 当前时间（毫秒）：由64位的微秒计算，模拟时钟越过0xFFFFFFFF毫秒时与设备一样回绕到0
+uint32_t millis(void) {
+    return (uint32_t)(nowMicros() / 1000);
+}
+
+//*** 切换到模拟时钟并设置当前时间（毫秒）
+void hostClockSet(uint32_t ms) {
+    simulated = true;
+    simulatedMicros = (uint64_t)ms * 1000;
+}
+
+//*** 推进模拟时钟（微秒）
+void hostClockAdvance(uint32_t us) {
+    simulatedMicros += us;
+}
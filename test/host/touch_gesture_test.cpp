@@ -0,0 +1,288 @@
+// 触摸滤波、校准换算和滑动手势识别的测试：用脚本化的MockTouchSource回放触摸（在PC上运行，见test/host/Makefile）
+#include "manager/touch_gesture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            printf("  失败: %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                    \
+        }                                                                  \
+    } while (0)
+
+// 与设备相同的屏幕尺寸和config.json中的默认校准
+const uint16_t WIDTH = 320;
+const uint16_t HEIGHT = 480;
+const TouchCalibration DEFAULT_CAL = {300, 3800, 250, 3850, false};
+// LVGL读取触摸的周期（毫秒）
+const uint32_t READ_PERIOD = 10;
+
+// 回放结果
+struct Replay {
+    int reads;                        // 读取次数
+    int samples;                      // 实际读取触摸源的次数
+    std::vector<SwipeDirection> swipes; // 识别到的手势
+    uint32_t firstSwipeMs;            // 第一个手势的识别时间
+    uint32_t releaseMs;               // 最后一次按下之后第一次报告抬起的时间
+    int16_t lastX;                    // 最后报告的坐标
+    int16_t lastY;
+    int16_t maxStep;                  // 按下期间相邻两次报告的坐标的最大变化（像素）
+};
+
+//*** 屏幕坐标换算为默认校准下的原始读数
+static uint16_t rawX(int16_t x) {
+    return (uint16_t)(DEFAULT_CAL.xMin + (int32_t)x * (DEFAULT_CAL.xMax - DEFAULT_CAL.xMin) / (WIDTH - 1));
+}
+static uint16_t rawY(int16_t y) {
+    return (uint16_t)(DEFAULT_CAL.yMin + (int32_t)y * (DEFAULT_CAL.yMax - DEFAULT_CAL.yMin) / (HEIGHT - 1));
+}
+
+//*** 按LVGL的读取周期回放脚本，直到脚本结束后再读取几次
+static Replay replay(const TouchScriptStep* steps, int count, const TouchCalibration& cal = DEFAULT_CAL) {
+    MockTouchSource source(steps, count);
+    TouchTracker tracker;
+    Replay result = {0, 0, {}, 0, 0, 0, 0, 0};
+    bool wasPressed = false;
+    int16_t prevX = 0;
+    int16_t prevY = 0;
+    uint32_t end = steps[count - 1].atMs + 5 * READ_PERIOD;
+    for (uint32_t now = 0; now <= end; now += READ_PERIOD) {
+        source.setTime(now);
+        TouchReading reading = tracker.read(source, cal, WIDTH, HEIGHT, now);
+        result.reads++;
+        if (reading.sampled) {
+            result.samples++;
+        }
+        if (reading.swipe != SWIPE_NONE) {
+            if (result.swipes.empty()) {
+                result.firstSwipeMs = now;
+            }
+            result.swipes.push_back(reading.swipe);
+        }
+        if (reading.pressed && wasPressed) {
+            int16_t step = (int16_t)(abs(reading.x - prevX) + abs(reading.y - prevY));
+            if (step > result.maxStep) {
+                result.maxStep = step;
+            }
+        }
+        if (!reading.pressed && wasPressed) {
+            result.releaseMs = now;
+        }
+        wasPressed = reading.pressed;
+        prevX = reading.x;
+        prevY = reading.y;
+        result.lastX = reading.x;
+        result.lastY = reading.y;
+    }
+    return result;
+}
+
+//*** 校准换算：由两点推算的参数把这两点换算回原来的屏幕坐标
+static void testCalibration() {
+    struct Case {
+        const char* name;
+        bool swapXY;
+        uint16_t rawX1, rawY1, rawX2, rawY2;  // 在(30,30)和(289,449)两点的原始读数
+    } cases[] = {
+        {"正向", false, 584, 453, 3416, 3647},
+        {"X反向", false, 3516, 453, 684, 3647},
+        {"XY交换", true, 453, 584, 3647, 3416},
+        {"XY交换且Y反向", true, 3647, 584, 453, 3416},
+    };
+    for (const Case& c : cases) {
+        TouchCalibration cal;
+        bool ok = touchCalibrateFromPoints(30, 30, c.rawX1, c.rawY1, WIDTH - 31, HEIGHT - 31, c.rawX2, c.rawY2,
+                                           WIDTH, HEIGHT, c.swapXY, cal);
+        CHECK(ok);
+        int16_t x, y;
+        CHECK(touchMapToScreen(cal, c.rawX1, c.rawY1, WIDTH, HEIGHT, x, y));
+        CHECK(abs(x - 30) <= 1 && abs(y - 30) <= 1);
+        CHECK(touchMapToScreen(cal, c.rawX2, c.rawY2, WIDTH, HEIGHT, x, y));
+        CHECK(abs(x - (WIDTH - 31)) <= 1 && abs(y - (HEIGHT - 31)) <= 1);
+        // 超出校准范围的读数限制在屏幕内
+        CHECK(touchMapToScreen(cal, 0, 0, WIDTH, HEIGHT, x, y));
+        CHECK(x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT);
+        CHECK(touchMapToScreen(cal, 4095, 4095, WIDTH, HEIGHT, x, y));
+        CHECK(x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT);
+        printf("校准 %-14s X %d-%d Y %d-%d\n", c.name, cal.xMin, cal.xMax, cal.yMin, cal.yMax);
+    }
+    // 两点读数几乎相同（没有真正点到或XY方向设置错误）
+    TouchCalibration cal;
+    CHECK(!touchCalibrateFromPoints(30, 30, 2000, 2000, WIDTH - 31, HEIGHT - 31, 2010, 2010,
+                                    WIDTH, HEIGHT, false, cal));
+    CHECK(!touchCalibrateFromPoints(30, 30, 584, 453, 30, HEIGHT - 31, 584, 3647, WIDTH, HEIGHT, false, cal));
+    TouchCalibration invalid = {1000, 1000, 250, 3850, false};
+    int16_t x, y;
+    CHECK(!touchMapToScreen(invalid, 2000, 2000, WIDTH, HEIGHT, x, y));
+}
+
+//*** 中值：单个离群采样不影响结果
+static void testMedian() {
+    uint16_t values[TOUCH_SAMPLE_COUNT] = {2000, 2003, 4095, 1998, 2001};
+    CHECK(touchMedian(values, TOUCH_SAMPLE_COUNT) == 2001);
+    uint16_t same[3] = {7, 7, 7};
+    CHECK(touchMedian(same, 3) == 7);
+}
+
+//*** 滑动手势
+static void testSwipes() {
+    // 250ms内从右向左滑过200像素：越过阈值时立即识别，不等抬起
+    const TouchScriptStep left[] = {
+        {0, rawX(260), rawY(240), true},
+        {250, rawX(60), rawY(250), true},
+        {300, 0, 0, false},
+    };
+    Replay r = replay(left, 3);
+    CHECK(r.swipes.size() == 1 && r.swipes[0] == SWIPE_LEFT);
+    CHECK(r.firstSwipeMs < r.releaseMs);
+    CHECK(r.firstSwipeMs <= 120);
+    printf("左滑      识别于 %3u ms，抬起于 %3u ms，采样 %d/%d 次\n", r.firstSwipeMs, r.releaseMs, r.samples, r.reads);
+
+    const TouchScriptStep right[] = {
+        {0, rawX(40), rawY(100), true},
+        {200, rawX(280), rawY(90), true},
+        {260, 0, 0, false},
+    };
+    r = replay(right, 3);
+    CHECK(r.swipes.size() == 1 && r.swipes[0] == SWIPE_RIGHT);
+    printf("右滑      识别于 %3u ms\n", r.firstSwipeMs);
+
+    // 同一次按下来回滑动只报告一次
+    const TouchScriptStep backAndForth[] = {
+        {0, rawX(260), rawY(240), true},
+        {200, rawX(60), rawY(240), true},
+        {400, rawX(260), rawY(240), true},
+        {450, 0, 0, false},
+    };
+    r = replay(backAndForth, 4);
+    CHECK(r.swipes.size() == 1 && r.swipes[0] == SWIPE_LEFT);
+
+    // 两次独立的滑动各报告一次
+    const TouchScriptStep twice[] = {
+        {0, rawX(260), rawY(240), true},
+        {200, rawX(60), rawY(240), true},
+        {250, 0, 0, false},
+        {400, rawX(60), rawY(240), true},
+        {600, rawX(260), rawY(240), true},
+        {650, 0, 0, false},
+    };
+    r = replay(twice, 6);
+    CHECK(r.swipes.size() == 2 && r.swipes[0] == SWIPE_LEFT && r.swipes[1] == SWIPE_RIGHT);
+
+    // 纵向滑动
+    const TouchScriptStep down[] = {
+        {0, rawX(160), rawY(100), true},
+        {200, rawX(165), rawY(400), true},
+        {250, 0, 0, false},
+    };
+    r = replay(down, 3);
+    CHECK(r.swipes.size() == 1 && r.swipes[0] == SWIPE_DOWN);
+
+    // 慢速拖动（3秒拖过200像素，超过SWIPE_MAX_DURATION才达到距离）不是滑动
+    const TouchScriptStep slow[] = {
+        {0, rawX(260), rawY(240), true},
+        {3000, rawX(60), rawY(240), true},
+        {3050, 0, 0, false},
+    };
+    r = replay(slow, 3);
+    CHECK(r.swipes.empty());
+
+    // 斜向滑动不触发
+    const TouchScriptStep diagonal[] = {
+        {0, rawX(60), rawY(100), true},
+        {250, rawX(260), rawY(300), true},
+        {300, 0, 0, false},
+    };
+    r = replay(diagonal, 3);
+    CHECK(r.swipes.empty());
+
+    // 点击不触发
+    const TouchScriptStep tap[] = {
+        {0, rawX(160), rawY(240), true},
+        {80, 0, 0, false},
+    };
+    r = replay(tap, 2);
+    CHECK(r.swipes.empty());
+    CHECK(r.lastX >= 158 && r.lastX <= 162 && r.lastY >= 238 && r.lastY <= 242);
+
+    // X方向反向安装的触摸屏：原始读数增大对应向左滑
+    TouchCalibration reversed = {3800, 300, 250, 3850, false};
+    const TouchScriptStep raw[] = {
+        {0, 1000, 2000, true},
+        {200, 3200, 2000, true},
+        {250, 0, 0, false},
+    };
+    r = replay(raw, 3, reversed);
+    CHECK(r.swipes.size() == 1 && r.swipes[0] == SWIPE_LEFT);
+}
+
+//*** 滤波：静止按住时的小幅抖动不改变坐标，抬起后下一次按下不从旧位置拖过来
+static void testFilter() {
+    std::vector<TouchScriptStep> steps;
+    // 每10ms一个读数，原始读数抖动±6（不到1像素）；读取时刻正好落在步骤上，不会插值
+    for (uint32_t t = 0; t <= 500; t += 10) {
+        int jitter = (t / 10) % 3 == 0 ? 6 : ((t / 10) % 3 == 1 ? -6 : 0);
+        steps.push_back({t, (uint16_t)(rawX(100) + jitter), (uint16_t)(rawY(200) - jitter), true});
+    }
+    steps.push_back({510, 0, 0, false});
+    Replay r = replay(steps.data(), (int)steps.size());
+    CHECK(r.maxStep == 0);
+    CHECK(r.swipes.empty());
+    printf("抖动      按住 500 ms，坐标最大变化 %d 像素\n", r.maxStep);
+
+    // 第一次按下的位置直接使用
+    const TouchScriptStep jump[] = {
+        {0, rawX(20), rawY(20), true},
+        {30, 0, 0, false},
+        {100, rawX(300), rawY(460), true},
+        {130, 0, 0, false},
+    };
+    MockTouchSource source(jump, 4);
+    TouchTracker tracker;
+    TouchReading reading;
+    for (uint32_t now = 0; now <= 100; now += READ_PERIOD) {
+        source.setTime(now);
+        reading = tracker.read(source, DEFAULT_CAL, WIDTH, HEIGHT, now);
+    }
+    CHECK(reading.pressed);
+    CHECK(abs(reading.x - 300) <= 1 && abs(reading.y - 460) <= 1);
+}
+
+//*** 空闲：脚本结束后不再读取触摸源，报告抬起并保持最后的坐标
+static void testIdle() {
+    const TouchScriptStep tap[] = {
+        {0, rawX(50), rawY(60), true},
+        {50, 0, 0, false},
+    };
+    MockTouchSource source(tap, 2);
+    TouchTracker tracker;
+    int samples = 0;
+    TouchReading reading;
+    for (uint32_t now = 0; now <= 1000; now += READ_PERIOD) {
+        source.setTime(now);
+        reading = tracker.read(source, DEFAULT_CAL, WIDTH, HEIGHT, now);
+        samples += reading.sampled ? 1 : 0;
+    }
+    CHECK(samples == 5);
+    CHECK(!reading.pressed && !reading.sampled);
+    CHECK(abs(reading.x - 50) <= 1 && abs(reading.y - 60) <= 1);
+    printf("空闲      1000 ms内读取 101 次，采样 %d 次\n", samples);
+}
+
+int main() {
+    testCalibration();
+    testMedian();
+    testSwipes();
+    testFilter();
+    testIdle();
+    if (failures > 0) {
+        printf("touch_gesture_test: %d 项失败\n", failures);
+        return 1;
+    }
+    printf("touch_gesture_test: 全部通过\n");
+    return 0;
+}
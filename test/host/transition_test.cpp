@@ -0,0 +1,341 @@
+// 过渡管理器的逐帧测试：用模拟时钟推进LVGL的定时器和动画，检查淡入、淡出、滑入、分阶段显示、取消和步骤序列都能按时结束，
+// 期间每秒的时钟回调按时执行；每个场景在普通时间和millis()回绕前100ms各运行一遍（在PC上运行，见test/host/Makefile）
+#include "ui/transition_manager.h"
+#include "manager/time_manager.h"
+#include <lvgl.h>
+#include <stdio.h>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            printf("  失败: %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                    \
+        }                                                                  \
+    } while (0)
+
+// 与设备相同的屏幕尺寸
+const uint16_t SCREEN_WIDTH = 320;
+const uint16_t SCREEN_HEIGHT = 480;
+// 显示任务每帧的间隔（微秒）
+const uint32_t FRAME_US = 5000;
+// 耗时步骤每个占用的时间（微秒），帧预算内只能执行两个
+const uint32_t BUSY_STEP_US = 2000;
+// 结束时间允许的误差（毫秒）：动画和步骤定时器每30ms运行一次，再加一帧
+const uint32_t END_TOLERANCE = TRANSITION_TIMER_PERIOD + FRAME_US / 1000;
+// 时钟回调的周期和允许的延迟（毫秒），延迟包括一帧和同一帧中执行的耗时步骤
+const uint32_t CLOCK_PERIOD = 1000;
+const uint32_t CLOCK_TOLERANCE = (FRAME_US + TRANSITION_FRAME_BUDGET_US + BUSY_STEP_US) / 1000;
+// 场景结束后继续运行的时间（毫秒），保证每个场景中时钟回调至少执行一次
+const uint32_t SETTLE_TIME = 1200;
+// 等待过渡结束的最长时间（毫秒）
+const uint32_t MAX_SCENARIO_TIME = 5000;
+// 回绕场景的开始时间：100ms后millis()回绕到0
+const uint32_t WRAP_START = 0xFFFFFFFFUL - 100;
+
+// TimeManager的替身：真实实现依赖WiFi和TFT_eSPI，过渡管理器只读取秒显示的更新时间
+TimeManager* TimeManager::instance = nullptr;
+
+//*** 私有构造函数
+TimeManager::TimeManager() {
+    lastSecondUpdate = 0;
+}
+//*** 获取单例实例
+TimeManager* TimeManager::getInstance() {
+    if (instance == nullptr) {
+        instance = new TimeManager();
+    }
+    return instance;
+}
+//*** 更新时间显示：只记录秒显示的更新时间
+void TimeManager::updateTimeDisplay() {
+    lastSecondUpdate = millis();
+}
+
+// 时钟回调的统计
+static lv_timer_t* clockTimer = nullptr;
+static uint32_t lastClockRun = 0;
+static uint32_t maxClockGap = 0;
+static int clockRuns = 0;
+
+// 步骤回调的执行时间（相对场景开始，毫秒）
+const int MAX_RECORDED_STEPS = 16;
+static uint32_t scenarioStart = 0;
+static uint32_t stepTimes[MAX_RECORDED_STEPS];
+static int recordedSteps = 0;
+
+//*** 显示刷新回调：不输出像素
+static void flushCallback(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* pixels) {
+    (void)area;
+    (void)pixels;
+    lv_disp_flush_ready(drv);
+}
+
+//*** 每秒的时钟回调：与设备上一样更新秒显示，并记录与上次执行（或场景开始）的最大间隔
+static void clockTimerCallback(lv_timer_t* timer) {
+    (void)timer;
+    uint32_t now = millis();
+    if (now - lastClockRun > maxClockGap) {
+        maxClockGap = now - lastClockRun;
+    }
+    lastClockRun = now;
+    clockRuns++;
+    TimeManager::getInstance()->updateTimeDisplay();
+}
+
+//*** 步骤回调：记录执行时间
+static void recordStep(void* userData) {
+    (void)userData;
+    if (recordedSteps < MAX_RECORDED_STEPS) {
+        stepTimes[recordedSteps++] = millis() - scenarioStart;
+    }
+}
+
+//*** 耗时的步骤回调：推进时钟，模拟在显示任务中执行的工作
+static void busyStep(void* userData) {
+    recordStep(userData);
+    hostClockAdvance(BUSY_STEP_US);
+}
+
+//*** 把模拟时钟设到start开始一个场景：重启时钟回调，之前场景的时间不计入间隔统计
+static void startScenario(uint32_t start) {
+    hostClockSet(start);
+    scenarioStart = start;
+    recordedSteps = 0;
+    TimeManager::getInstance()->updateTimeDisplay();
+    lv_timer_reset(clockTimer);
+    lastClockRun = start;
+    maxClockGap = 0;
+    clockRuns = 0;
+}
+
+//*** 运行一帧
+static void runFrame() {
+    hostClockAdvance(FRAME_US);
+    lv_timer_handler();
+}
+
+//*** 运行到过渡结束，返回耗时（毫秒），超时返回-1
+static int32_t runUntilIdle() {
+    TransitionManager* transitions = TransitionManager::getInstance();
+    while (transitions->isActive()) {
+        if (millis() - scenarioStart > MAX_SCENARIO_TIME) {
+            return -1;
+        }
+        runFrame();
+    }
+    return (int32_t)(millis() - scenarioStart);
+}
+
+//*** 运行指定的时间（毫秒）
+static void runFor(uint32_t ms) {
+    uint32_t start = millis();
+    while (millis() - start < ms) {
+        runFrame();
+    }
+}
+
+//*** 过渡结束后继续运行，检查过渡不再活动、时钟回调按时执行
+static void finishScenario(const char* name, int32_t elapsed) {
+    runFor(SETTLE_TIME);
+    CHECK(!TransitionManager::getInstance()->isActive());
+    CHECK(clockRuns > 0);
+    CHECK(maxClockGap <= CLOCK_PERIOD + CLOCK_TOLERANCE);
+    printf("  %-14s 结束 %5d ms  时钟回调 %d 次，最大间隔 %u ms\n", name, (int)elapsed, clockRuns, maxClockGap);
+}
+
+//*** 检查耗时在预期的结束时间之后的误差内
+static bool endsOnTime(int32_t elapsed, uint32_t expected) {
+    return elapsed >= (int32_t)expected && elapsed <= (int32_t)(expected + END_TOLERANCE);
+}
+
+//*** 创建测试对象：与性能测试中的方块相同，不透明、无圆角和边框（半透明的对象淡入淡出时LVGL需要LV_COLOR_SCREEN_TRANSP）
+static lv_obj_t* createBox(int y) {
+    lv_obj_t* obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj, SCREEN_WIDTH, 40);
+    lv_obj_set_pos(obj, 0, y);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(obj, 0, 0);
+    lv_obj_set_style_radius(obj, 0, 0);
+    return obj;
+}
+
+//*** 淡入：延迟100ms，300ms后不透明
+static void testFadeIn(uint32_t start, lv_obj_t* obj) {
+    startScenario(start);
+    TransitionManager::getInstance()->fadeIn(obj, 300, 100);
+    CHECK(lv_obj_get_style_opa(obj, LV_PART_MAIN) == LV_OPA_TRANSP);
+    int32_t elapsed = runUntilIdle();
+    CHECK(endsOnTime(elapsed, 400));
+    CHECK(lv_obj_get_style_opa(obj, LV_PART_MAIN) == LV_OPA_COVER);
+    CHECK(!lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN));
+    finishScenario("fadeIn", elapsed);
+}
+
+//*** 淡出：结束后隐藏并恢复不透明度
+static void testFadeOut(uint32_t start, lv_obj_t* obj) {
+    startScenario(start);
+    TransitionManager::getInstance()->fadeOut(obj, 300);
+    runFor(150);
+    lv_opa_t middle = lv_obj_get_style_opa(obj, LV_PART_MAIN);
+    CHECK(middle > LV_OPA_TRANSP && middle < LV_OPA_COVER);
+    int32_t elapsed = runUntilIdle();
+    CHECK(endsOnTime(elapsed, 300));
+    CHECK(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN));
+    CHECK(lv_obj_get_style_opa(obj, LV_PART_MAIN) == LV_OPA_COVER);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    finishScenario("fadeOut", elapsed);
+}
+
+//*** 从四个方向滑入：开始时在屏幕外，结束时回到原位置
+static void testSlideIn(uint32_t start, lv_obj_t* obj) {
+    const lv_dir_t dirs[] = {LV_DIR_LEFT, LV_DIR_RIGHT, LV_DIR_TOP, LV_DIR_BOTTOM};
+    const char* names[] = {"slideIn左", "slideIn右", "slideIn上", "slideIn下"};
+    for (int i = 0; i < 4; i++) {
+        startScenario(start);
+        TransitionManager::getInstance()->slideIn(obj, dirs[i], 400);
+        lv_coord_t x = lv_obj_get_style_translate_x(obj, LV_PART_MAIN);
+        lv_coord_t y = lv_obj_get_style_translate_y(obj, LV_PART_MAIN);
+        switch (dirs[i]) {
+            case LV_DIR_LEFT:
+                CHECK(x == -(lv_coord_t)SCREEN_WIDTH && y == 0);
+                break;
+            case LV_DIR_RIGHT:
+                CHECK(x == (lv_coord_t)SCREEN_WIDTH && y == 0);
+                break;
+            case LV_DIR_TOP:
+                CHECK(x == 0 && y == -(lv_coord_t)SCREEN_HEIGHT);
+                break;
+            default:
+                CHECK(x == 0 && y == (lv_coord_t)SCREEN_HEIGHT);
+                break;
+        }
+        int32_t elapsed = runUntilIdle();
+        CHECK(endsOnTime(elapsed, 400));
+        CHECK(lv_obj_get_style_translate_x(obj, LV_PART_MAIN) == 0);
+        CHECK(lv_obj_get_style_translate_y(obj, LV_PART_MAIN) == 0);
+        finishScenario(names[i], elapsed);
+    }
+}
+
+//*** 分阶段显示：每隔150ms淡入一个对象
+static void testStagedReveal(uint32_t start, lv_obj_t** objs, int count) {
+    startScenario(start);
+    TransitionManager::getInstance()->stagedReveal(objs, count, 150, 200);
+    for (int i = 0; i < count; i++) {
+        CHECK(lv_obj_get_style_opa(objs[i], LV_PART_MAIN) == LV_OPA_TRANSP);
+    }
+    // 第一个对象已显示，最后一个还没有开始
+    runFor(350);
+    CHECK(lv_obj_get_style_opa(objs[0], LV_PART_MAIN) == LV_OPA_COVER);
+    CHECK(lv_obj_get_style_opa(objs[count - 1], LV_PART_MAIN) == LV_OPA_TRANSP);
+    int32_t elapsed = runUntilIdle();
+    CHECK(endsOnTime(elapsed, 150 * (count - 1) + 200));
+    for (int i = 0; i < count; i++) {
+        CHECK(lv_obj_get_style_opa(objs[i], LV_PART_MAIN) == LV_OPA_COVER);
+    }
+    finishScenario("stagedReveal", elapsed);
+}
+
+//*** 取消：动画停止并恢复到最终状态
+static void testCancel(uint32_t start, lv_obj_t* obj) {
+    startScenario(start);
+    TransitionManager* transitions = TransitionManager::getInstance();
+    transitions->slideIn(obj, LV_DIR_LEFT, 400);
+    transitions->addStep(1000, recordStep);
+    runFor(150);
+    CHECK(transitions->isActive());
+    transitions->cancel();
+    CHECK(!transitions->isActive());
+    CHECK(lv_obj_get_style_translate_x(obj, LV_PART_MAIN) == 0);
+    CHECK(lv_obj_get_style_opa(obj, LV_PART_MAIN) == LV_OPA_COVER);
+    int32_t elapsed = (int32_t)(millis() - start);
+    finishScenario("cancel", elapsed);
+    // 被取消的步骤不再执行
+    CHECK(recordedSteps == 0);
+}
+
+//*** 步骤序列：延迟相对于上一个步骤；序列未执行完时追加的步骤排在最后一个步骤之后
+static void testSteps(uint32_t start) {
+    startScenario(start);
+    TransitionManager* transitions = TransitionManager::getInstance();
+    CHECK(transitions->addStep(0, recordStep));
+    CHECK(transitions->addStep(200, recordStep));
+    CHECK(transitions->addStep(200, recordStep));
+    runFor(50);
+    // 回绕场景中最后一个步骤的到期时间已回绕到0之后，而当前时间还没有
+    CHECK(transitions->addStep(300, recordStep));
+    int32_t elapsed = runUntilIdle();
+    const uint32_t due[] = {0, 200, 400, 700};
+    CHECK(recordedSteps == 4);
+    for (int i = 0; i < recordedSteps && i < 4; i++) {
+        CHECK(endsOnTime(stepTimes[i], due[i]));
+        if (!endsOnTime(stepTimes[i], due[i])) {
+            printf("  步骤%d 在 %u ms 执行，应在 %u ms\n", i, stepTimes[i], due[i]);
+        }
+    }
+    CHECK(endsOnTime(elapsed, 700));
+    finishScenario("addStep", elapsed);
+}
+
+//*** 耗时的步骤：超出帧预算的步骤顺延到下一帧，时钟回调不被推迟
+static void testBusySteps(uint32_t start) {
+    startScenario(start);
+    TransitionManager* transitions = TransitionManager::getInstance();
+    uint32_t deferredBefore = transitions->getDeferredSteps();
+    const int count = 12;
+    // 第一个步骤在时钟回调到期前一点执行，后面的步骤须跨过时钟回调
+    CHECK(transitions->addStep(CLOCK_PERIOD - 20, busyStep));
+    for (int i = 1; i < count; i++) {
+        CHECK(transitions->addStep(0, busyStep));
+    }
+    int32_t elapsed = runUntilIdle();
+    CHECK(elapsed >= 0);
+    CHECK(recordedSteps == count);
+    CHECK(transitions->getDeferredSteps() > deferredBefore);
+    CHECK(transitions->getMaxSliceTime() < TRANSITION_FRAME_BUDGET_US + BUSY_STEP_US);
+    finishScenario("busySteps", elapsed);
+}
+
+int main() {
+    hostClockSet(10000);
+    lv_init();
+    static lv_disp_draw_buf_t drawBuf;
+    static lv_color_t buf1[SCREEN_WIDTH * 10];
+    static lv_color_t buf2[SCREEN_WIDTH * 10];
+    lv_disp_draw_buf_init(&drawBuf, buf1, buf2, SCREEN_WIDTH * 10);
+    static lv_disp_drv_t drv;
+    lv_disp_drv_init(&drv);
+    drv.hor_res = SCREEN_WIDTH;
+    drv.ver_res = SCREEN_HEIGHT;
+    drv.draw_buf = &drawBuf;
+    drv.flush_cb = flushCallback;
+    lv_disp_drv_register(&drv);
+    clockTimer = lv_timer_create(clockTimerCallback, CLOCK_PERIOD, nullptr);
+
+    const int revealCount = 5;
+    lv_obj_t* objs[revealCount];
+    for (int i = 0; i < revealCount; i++) {
+        objs[i] = createBox(10 + i * 50);
+    }
+    const uint32_t starts[] = {10000, WRAP_START};
+    for (uint32_t start : starts) {
+        printf("开始时间 0x%08X\n", start);
+        testFadeIn(start, objs[0]);
+        testFadeOut(start, objs[0]);
+        testSlideIn(start, objs[1]);
+        testStagedReveal(start, objs, revealCount);
+        testCancel(start, objs[2]);
+        testSteps(start);
+        testBusySteps(start);
+    }
+    // 时钟回调一直按时执行，过渡管理器没有发现时钟停顿
+    CHECK(TransitionManager::getInstance()->getClockStallCount() == 0);
+    if (failures > 0) {
+        printf("transition_test: %d 项失败\n", failures);
+        return 1;
+    }
+    printf("transition_test: 全部通过\n");
+    return 0;
+}
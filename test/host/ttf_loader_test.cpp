@@ -0,0 +1,600 @@
+// TrueType轮廓字体：TtfLoader从代替SPIFFS的目录打开LVGL示例中的Lato-Regular.ttf，各字号的前进宽度、字距和字形边界框
+// 须与data/ttf/中由FreeType（不使用hinting）生成的参考相同（由make_reference.c生成），4位灰度位图与参考的8位覆盖率按
+// 绝对坐标比较，每个像素的差不超过容差（组合字形的部件须画在正确的位置）；字形缓存第二次绘制时命中。
+// 之后把截断的字体文件和表目录、cmap、loca、字形数据、组合字形部件中的字节被改写的字体交给TtfLoader，打开、度量和光栅化
+// 所有字符时不能崩溃或越界读取（测试以AddressSanitizer编译）（在PC上运行，见test/host/Makefile）
+#include "ui/ttf_loader.h"
+#include <lvgl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            printf("  失败: %s:%d: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                    \
+        }                                                                  \
+    } while (0)
+
+const char* LATO_TTF = "../../lib/lvgl-8.3.7/examples/libs/freetype/Lato-Regular.ttf";
+const char* REFERENCE_DIR = "data/ttf";
+const uint16_t REFERENCE_SIZES[] = {12, 20, 36};
+// 代替SPIFFS的目录（字体文件在其中的fonts/下）
+const char* FONT_DIR = "build/ttf_store";
+
+// 覆盖率与参考的容差（15级灰度）：展平曲线和浮点累加与FreeType的定点光栅化略有不同
+const int MAX_LEVEL_DIFF = 3;
+const double MAX_MEAN_DIFF = 0.15;
+
+// 参考中的一个字形
+struct RefGlyph {
+    uint32_t letter;
+    uint16_t advance;
+    uint16_t width;
+    uint16_t height;
+    int16_t ofsX;
+    int16_t ofsY;
+    std::vector<uint8_t> coverage;   // 8位覆盖率，逐行
+};
+
+struct RefKern {
+    uint32_t left;
+    uint32_t right;
+    int16_t kern;
+};
+
+struct Reference {
+    uint16_t size;
+    std::vector<RefGlyph> glyphs;
+    std::vector<RefKern> kerns;
+};
+
+//*** 读取整个文件
+static bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        data.insert(data.end(), buf, buf + n);
+    }
+    fclose(file);
+    return true;
+}
+
+//*** 写入整个文件
+static bool writeFile(const std::string& path, const std::vector<uint8_t>& data) {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = data.empty() || fwrite(data.data(), 1, data.size(), file) == data.size();
+    fclose(file);
+    return ok;
+}
+
+// 小端读取（参考文件）
+static uint16_t leU16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+static uint32_t leU32(const uint8_t* p) {
+    return leU16(p) | ((uint32_t)leU16(p + 2) << 16);
+}
+
+//*** 读取一个字号的参考
+static bool readReference(uint16_t size, Reference& ref) {
+    std::vector<uint8_t> data;
+    if (!readFile(std::string(REFERENCE_DIR) + "/lato_" + std::to_string(size) + ".ref", data) || data.size() < 10 ||
+        memcmp(data.data(), "TREF", 4) != 0) {
+        return false;
+    }
+    ref.size = leU16(&data[4]);
+    uint16_t glyphCount = leU16(&data[6]);
+    uint16_t kernCount = leU16(&data[8]);
+    size_t pos = 10;
+    for (int i = 0; i < glyphCount; i++) {
+        if (pos + 14 > data.size()) {
+            return false;
+        }
+        RefGlyph glyph;
+        glyph.letter = leU32(&data[pos]);
+        glyph.advance = leU16(&data[pos + 4]);
+        glyph.width = leU16(&data[pos + 6]);
+        glyph.height = leU16(&data[pos + 8]);
+        glyph.ofsX = (int16_t)leU16(&data[pos + 10]);
+        glyph.ofsY = (int16_t)leU16(&data[pos + 12]);
+        pos += 14;
+        size_t pixels = (size_t)glyph.width * glyph.height;
+        if (pos + pixels > data.size()) {
+            return false;
+        }
+        glyph.coverage.assign(data.begin() + pos, data.begin() + pos + pixels);
+        pos += pixels;
+        ref.glyphs.push_back(glyph);
+    }
+    for (int i = 0; i < kernCount; i++) {
+        if (pos + 10 > data.size()) {
+            return false;
+        }
+        ref.kerns.push_back({leU32(&data[pos]), leU32(&data[pos + 4]), (int16_t)leU16(&data[pos + 8])});
+        pos += 10;
+    }
+    return pos == data.size() && ref.size == size;
+}
+
+//*** 4位灰度位图中的一个像素（连续打包，前一个像素在高4位）
+static int bitmapLevel(const uint8_t* bitmap, int index) {
+    uint8_t byte = bitmap[index >> 1];
+    return (index & 1) ? (byte & 0x0F) : (byte >> 4);
+}
+
+// 一个字号与参考比较的结果
+struct CompareStats {
+    int boxMismatches = 0;
+    int maxDiff = 0;
+    double diffSum = 0;
+    long pixels = 0;
+};
+
+//*** 按绝对坐标比较字形位图与参考的覆盖率（两者边界框的并集，框外为0）
+static void compareGlyph(const RefGlyph& ref, const lv_font_glyph_dsc_t& dsc, const uint8_t* bitmap, CompareStats& stats) {
+    int x0 = std::min<int>(ref.ofsX, dsc.ofs_x);
+    int y0 = std::min<int>(ref.ofsY, dsc.ofs_y);
+    int x1 = std::max<int>(ref.ofsX + ref.width, dsc.ofs_x + dsc.box_w);
+    int y1 = std::max<int>(ref.ofsY + ref.height, dsc.ofs_y + dsc.box_h);
+    int glyphMax = 0;
+    // 坐标y向上，位图的第一行在上边缘
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            int expected = 0;
+            int rx = x - ref.ofsX;
+            int ry = ref.ofsY + ref.height - 1 - y;
+            if (rx >= 0 && rx < ref.width && ry >= 0 && ry < ref.height) {
+                expected = (ref.coverage[ry * ref.width + rx] * 15 + 127) / 255;
+            }
+            int actual = 0;
+            int bx = x - dsc.ofs_x;
+            int by = dsc.ofs_y + dsc.box_h - 1 - y;
+            if (bitmap != nullptr && bx >= 0 && bx < dsc.box_w && by >= 0 && by < dsc.box_h) {
+                actual = bitmapLevel(bitmap, by * dsc.box_w + bx);
+            }
+            int diff = abs(actual - expected);
+            glyphMax = std::max(glyphMax, diff);
+            stats.diffSum += diff;
+            stats.pixels++;
+        }
+    }
+    if (glyphMax > MAX_LEVEL_DIFF) {
+        printf("  U+%04X: 像素差最大%d级\n", (unsigned)ref.letter, glyphMax);
+    }
+    stats.maxDiff = std::max(stats.maxDiff, glyphMax);
+}
+
+//*** 按参考检查一个字号的字体，返回光栅化的字形数
+static int checkReference(const lv_font_t* font, const Reference& ref) {
+    CompareStats stats;
+    int rasterized = 0;
+    for (const RefGlyph& glyph : ref.glyphs) {
+        lv_font_glyph_dsc_t dsc;
+        if (!lv_font_get_glyph_dsc(font, &dsc, glyph.letter, 0)) {
+            printf("  U+%04X: 没有字形\n", (unsigned)glyph.letter);
+            failures++;
+            continue;
+        }
+        CHECK(dsc.resolved_font == font);
+        CHECK(dsc.bpp == 4);
+        if (dsc.adv_w != glyph.advance) {
+            printf("  U+%04X: 前进宽度%u，参考%u\n", (unsigned)glyph.letter, dsc.adv_w, glyph.advance);
+            failures++;
+        }
+        if (dsc.box_w != glyph.width || dsc.box_h != glyph.height || dsc.ofs_x != glyph.ofsX || dsc.ofs_y != glyph.ofsY) {
+            printf("  U+%04X: 边界框%ux%u(%d,%d)，参考%ux%u(%d,%d)\n", (unsigned)glyph.letter, dsc.box_w, dsc.box_h,
+                   dsc.ofs_x, dsc.ofs_y, glyph.width, glyph.height, glyph.ofsX, glyph.ofsY);
+            stats.boxMismatches++;
+        }
+        const uint8_t* bitmap = nullptr;
+        if (dsc.box_w > 0) {
+            bitmap = lv_font_get_glyph_bitmap(font, glyph.letter);
+            CHECK(bitmap != nullptr);
+            rasterized++;
+        }
+        compareGlyph(glyph, dsc, bitmap, stats);
+    }
+    CHECK(stats.boxMismatches == 0);
+    CHECK(stats.maxDiff <= MAX_LEVEL_DIFF);
+    double mean = stats.pixels > 0 ? stats.diffSum / stats.pixels : 0;
+    CHECK(mean <= MAX_MEAN_DIFF);
+    // 字距：前进宽度加上按字号缩放的字距
+    for (const RefKern& pair : ref.kerns) {
+        lv_font_glyph_dsc_t alone, kerned;
+        CHECK(lv_font_get_glyph_dsc(font, &alone, pair.left, 0));
+        CHECK(lv_font_get_glyph_dsc(font, &kerned, pair.left, pair.right));
+        if (kerned.adv_w - alone.adv_w != pair.kern) {
+            printf("  U+%04X U+%04X: 字距%d，参考%d\n", (unsigned)pair.left, (unsigned)pair.right,
+                   kerned.adv_w - alone.adv_w, pair.kern);
+            failures++;
+        }
+    }
+    printf("%2u像素 %zu个字符（%d个光栅化）：边界框不同%d个，像素差最大%d级，平均%.3f级，%zu对字距\n", ref.size,
+           ref.glyphs.size(), rasterized, stats.boxMismatches, stats.maxDiff, mean, ref.kerns.size());
+    return rasterized;
+}
+
+// ---------------------------------------------------------------- 损坏的字体
+
+// 字体文件中一个表的位置
+struct TableRange {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+};
+
+static uint16_t beU16(const std::vector<uint8_t>& data, size_t pos) {
+    return (data[pos] << 8) | data[pos + 1];
+}
+static uint32_t beU32(const std::vector<uint8_t>& data, size_t pos) {
+    return ((uint32_t)beU16(data, pos) << 16) | beU16(data, pos + 2);
+}
+static void putBeU16(std::vector<uint8_t>& data, size_t pos, uint16_t value) {
+    data[pos] = value >> 8;
+    data[pos + 1] = value & 0xFF;
+}
+static void putBeU32(std::vector<uint8_t>& data, size_t pos, uint32_t value) {
+    putBeU16(data, pos, value >> 16);
+    putBeU16(data, pos + 2, value & 0xFFFF);
+}
+
+//*** 按标签查找表
+static TableRange findTable(const std::vector<uint8_t>& data, const char* tag) {
+    TableRange range;
+    uint16_t count = beU16(data, 4);
+    for (int i = 0; i < count; i++) {
+        size_t record = 12 + i * 16;
+        if (memcmp(&data[record], tag, 4) == 0) {
+            range.offset = beU32(data, record + 8);
+            range.length = beU32(data, record + 12);
+        }
+    }
+    return range;
+}
+
+// 打开并使用损坏字体的统计
+struct FuzzStats {
+    int variants = 0;
+    int opened = 0;
+    int glyphs = 0;
+};
+
+// 损坏字体测试中查询的字符：参考中的字符加上其他平面和cmap段边界附近的字符
+static std::vector<uint32_t> fuzzLetters;
+
+//*** 用TtfLoader打开一个字体文件（模拟重启后第一次使用），对所有字符获取度量和位图
+static void useFont(const std::vector<uint8_t>& data, FuzzStats& stats) {
+    TtfLoader* loader = TtfLoader::getInstance();
+    loader->reset();
+    CHECK(writeFile(std::string(FONT_DIR) + TTF_LOADER_DIR "fuzz.ttf", data));
+    stats.variants++;
+    // 上千个字体的打开日志不输出（越界读取的报告在标准错误中）
+    fflush(stdout);
+    int savedStdout = dup(STDOUT_FILENO);
+    int devNull = open("/dev/null", O_WRONLY);
+    dup2(devNull, STDOUT_FILENO);
+    close(devNull);
+    bool opened = false;
+    for (uint16_t size : {12, 36}) {
+        const lv_font_t* font = loader->font("fuzz", size, nullptr);
+        if (font == nullptr) {
+            continue;
+        }
+        opened = true;
+        CHECK(loader->isLoaded(font));
+        for (size_t i = 0; i < fuzzLetters.size(); i++) {
+            uint32_t letter = fuzzLetters[i];
+            uint32_t next = i + 1 < fuzzLetters.size() ? fuzzLetters[i + 1] : 0;
+            lv_font_glyph_dsc_t dsc;
+            if (font->get_glyph_dsc(font, &dsc, letter, next)) {
+                // 损坏的字形不能得到远超字号的位图
+                CHECK(dsc.box_w <= size * 8 && dsc.box_h <= size * 8);
+                lv_font_get_glyph_bitmap(font, letter);
+                stats.glyphs++;
+            }
+        }
+    }
+    fflush(stdout);
+    dup2(savedStdout, STDOUT_FILENO);
+    close(savedStdout);
+    stats.opened += opened;
+}
+
+//*** 简单的伪随机数（结果可重复）
+static uint32_t nextRandom(uint32_t& seed) {
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+//*** 改写区间中的几个字节（随机值，或0和0xFF等边界值）
+static void corruptRange(std::vector<uint8_t>& data, size_t start, size_t end, uint32_t& seed) {
+    int count = 1 + nextRandom(seed) % 4;
+    for (int i = 0; i < count && end > start; i++) {
+        size_t pos = start + nextRandom(seed) % (end - start);
+        switch (nextRandom(seed) % 4) {
+            case 0: data[pos] = 0x00; break;
+            case 1: data[pos] = 0xFF; break;
+            case 2: data[pos] ^= 1 << (nextRandom(seed) % 8); break;
+            default: data[pos] = nextRandom(seed) & 0xFF; break;
+        }
+    }
+}
+
+//*** 截断、改写字体文件的各个部分，检查打开和使用时不崩溃
+static void checkCorruptFonts(const std::vector<uint8_t>& lato) {
+    FuzzStats stats;
+    uint16_t tableCount = beU16(lato, 4);
+    TableRange cmap = findTable(lato, "cmap");
+    TableRange loca = findTable(lato, "loca");
+    TableRange glyf = findTable(lato, "glyf");
+    TableRange head = findTable(lato, "head");
+    TableRange maxp = findTable(lato, "maxp");
+    TableRange kern = findTable(lato, "kern");
+    TableRange hmtx = findTable(lato, "hmtx");
+    CHECK(cmap.length > 0 && loca.length > 0 && glyf.length > 0 && head.length > 0 && maxp.length > 0 && kern.length > 0 &&
+          hmtx.offset > head.offset);
+    bool longLoca = beU16(lato, head.offset + 50) != 0;
+    uint16_t glyphCount = beU16(lato, maxp.offset + 4);
+
+    // 截断：表目录中、每个表的开头和中间，以及整个文件中均匀分布的位置
+    std::vector<size_t> cuts = {0, 4, 11, 12, 12 + tableCount * 16u - 1};
+    for (int i = 0; i < tableCount; i++) {
+        uint32_t offset = beU32(lato, 12 + i * 16 + 8);
+        uint32_t length = beU32(lato, 12 + i * 16 + 12);
+        cuts.push_back(offset + 2);
+        cuts.push_back(offset + length / 2);
+        cuts.push_back(offset + length - 1);
+    }
+    for (size_t cut = 97; cut < lato.size(); cut += 4093) {
+        cuts.push_back(cut);
+    }
+    for (size_t cut : cuts) {
+        if (cut < lato.size()) {
+            useFont(std::vector<uint8_t>(lato.begin(), lato.begin() + cut), stats);
+        }
+    }
+    // 表目录中的长度缩短（表在文件中间截断）
+    for (int i = 0; i < tableCount; i++) {
+        size_t record = 12 + i * 16;
+        uint32_t length = beU32(lato, record + 12);
+        for (uint32_t shorter : {0u, 2u, length / 2, length - 1}) {
+            std::vector<uint8_t> data = lato;
+            putBeU32(data, record + 12, std::min(shorter, length));
+            useFont(data, stats);
+        }
+    }
+    printf("截断的字体：%d个，打开%d个，使用%d个字形\n", stats.variants, stats.opened, stats.glyphs);
+
+    // 简单字形和组合字形在文件中的位置（由loca和glyf找出）
+    std::vector<std::pair<uint32_t, uint32_t>> simples;
+    std::vector<std::pair<uint32_t, uint32_t>> composites;
+    for (uint16_t glyph = 0; glyph < glyphCount; glyph++) {
+        uint32_t start = longLoca ? beU32(lato, loca.offset + glyph * 4) : beU16(lato, loca.offset + glyph * 2) * 2u;
+        uint32_t end = longLoca ? beU32(lato, loca.offset + glyph * 4 + 4) : beU16(lato, loca.offset + glyph * 2 + 2) * 2u;
+        if (end >= start + 10) {
+            bool composite = (int16_t)beU16(lato, glyf.offset + start) < 0;
+            (composite ? composites : simples).push_back({glyf.offset + start, glyf.offset + end});
+        }
+    }
+    CHECK(simples.size() > 100 && composites.size() > 20);
+
+    // 改写：表目录、cmap表（子表记录和格式4子表）、head到hmtx的度量表、loca表、kern表、简单字形的数据和组合字形的部件记录
+    struct Region {
+        const char* name;
+        uint32_t start;
+        uint32_t end;
+        int variants;
+    };
+    std::vector<Region> regions = {
+        {"表目录", 0, 12 + tableCount * 16u, 300},
+        {"cmap", cmap.offset, cmap.offset + std::min<uint32_t>(cmap.length, 2048), 400},
+        {"head/hhea/maxp/hmtx", head.offset, hmtx.offset + hmtx.length, 300},
+        {"loca", loca.offset, loca.offset + loca.length, 200},
+        {"kern", kern.offset, kern.offset + 64, 100},
+    };
+    uint32_t seed = 0x7F4A7C15;
+    for (const Region& region : regions) {
+        FuzzStats regionStats;
+        for (int i = 0; i < region.variants; i++) {
+            std::vector<uint8_t> data = lato;
+            corruptRange(data, region.start, region.end, seed);
+            useFont(data, regionStats);
+        }
+        printf("%s被改写的字体：%d个，打开%d个，使用%d个字形\n", region.name, regionStats.variants, regionStats.opened,
+               regionStats.glyphs);
+    }
+    // 简单字形的轮廓终点、指令长度、标志和坐标（坐标远在边界框外时光栅化不能越出缓冲区）
+    FuzzStats simpleStats;
+    for (int i = 0; i < 300; i++) {
+        std::vector<uint8_t> data = lato;
+        for (int j = 0; j < 4; j++) {
+            const auto& range = simples[nextRandom(seed) % simples.size()];
+            corruptRange(data, range.first + 10, range.second, seed);
+        }
+        useFont(data, simpleStats);
+    }
+    printf("简单字形被改写的字体：%d个，打开%d个，使用%d个字形\n", simpleStats.variants, simpleStats.opened,
+           simpleStats.glyphs);
+    FuzzStats compositeStats;
+    for (int i = 0; i < 400; i++) {
+        std::vector<uint8_t> data = lato;
+        // 每次改写几个组合字形的部件记录（跳过头部的轮廓数和边界框）
+        for (int j = 0; j < 4; j++) {
+            const auto& range = composites[nextRandom(seed) % composites.size()];
+            corruptRange(data, range.first + 10, range.second, seed);
+        }
+        useFont(data, compositeStats);
+    }
+    // 部件引用自身、引用不存在的字形，以及部件的参数和变换越过字形数据的末尾（第一、中间和最后一个组合字形）
+    for (size_t index : {(size_t)0, composites.size() / 2, composites.size() - 1}) {
+        uint32_t offset = composites[index].first;
+        uint16_t self = 0;
+        for (uint16_t glyph = 0; glyph < glyphCount; glyph++) {
+            uint32_t start = longLoca ? beU32(lato, loca.offset + glyph * 4) : beU16(lato, loca.offset + glyph * 2) * 2u;
+            if (glyf.offset + start == offset) {
+                self = glyph;
+            }
+        }
+        std::vector<uint8_t> data = lato;
+        putBeU16(data, offset + 12, self);
+        useFont(data, compositeStats);
+        data = lato;
+        putBeU16(data, offset + 12, 0xFFFF);
+        useFont(data, compositeStats);
+        data = lato;
+        putBeU16(data, offset + 10, beU16(lato, offset + 10) | 0x0001 | 0x0020 | 0x0080);
+        useFont(data, compositeStats);
+    }
+    printf("组合字形被改写的字体：%d个，打开%d个，使用%d个字形\n", compositeStats.variants, compositeStats.opened,
+           compositeStats.glyphs);
+
+    // cmap中的极端值：子表偏移接近32位上限、格式4的段数和格式12的组数超出表的长度
+    FuzzStats cmapStats;
+    uint16_t subtables = beU16(lato, cmap.offset + 2);
+    for (int i = 0; i < subtables; i++) {
+        size_t record = cmap.offset + 4 + i * 8;
+        for (uint32_t offset : {0xFFFFFFFFu, 0xFFFFFFF9u, 0xFFFFFFF0u, cmap.length - 8, cmap.length - 14}) {
+            std::vector<uint8_t> data = lato;
+            putBeU32(data, record + 4, offset);
+            useFont(data, cmapStats);
+        }
+        uint32_t subtable = cmap.offset + beU32(lato, record + 4);
+        uint16_t format = beU16(lato, subtable);
+        for (uint32_t value : {0xFFFFu, 0xFFFEu, 0x8000u, 2u, 0u}) {
+            std::vector<uint8_t> data = lato;
+            if (format == 4) {
+                putBeU16(data, subtable + 6, value);
+            } else if (format == 12) {
+                putBeU32(data, subtable + 12, value * 0x10001u);
+            } else {
+                continue;
+            }
+            useFont(data, cmapStats);
+        }
+    }
+    // 度量的极端值：每em单位数为1（按字号放大上千倍）、字形头部的边界框为16位整数的范围
+    FuzzStats metricStats;
+    for (uint16_t unitsPerEm : {1, 16}) {
+        std::vector<uint8_t> data = lato;
+        putBeU16(data, head.offset + 18, unitsPerEm);
+        useFont(data, metricStats);
+    }
+    std::vector<uint8_t> huge = lato;
+    for (uint16_t glyph = 0; glyph < glyphCount; glyph++) {
+        uint32_t start = longLoca ? beU32(lato, loca.offset + glyph * 4) : beU16(lato, loca.offset + glyph * 2) * 2u;
+        uint32_t end = longLoca ? beU32(lato, loca.offset + glyph * 4 + 4) : beU16(lato, loca.offset + glyph * 2 + 2) * 2u;
+        if (end >= start + 10) {
+            putBeU16(huge, glyf.offset + start + 2, 0x8000);
+            putBeU16(huge, glyf.offset + start + 4, 0x8000);
+            putBeU16(huge, glyf.offset + start + 6, 0x7FFF);
+            putBeU16(huge, glyf.offset + start + 8, 0x7FFF);
+        }
+    }
+    useFont(huge, metricStats);
+    printf("度量极端值的字体：%d个，打开%d个，使用%d个字形\n", metricStats.variants, metricStats.opened,
+           metricStats.glyphs);
+    printf("cmap极端值的字体：%d个，打开%d个，使用%d个字形\n", cmapStats.variants, cmapStats.opened, cmapStats.glyphs);
+}
+
+int main() {
+    lv_init();
+    mkdir(FONT_DIR, 0755);
+    mkdir((std::string(FONT_DIR) + TTF_LOADER_DIR).c_str(), 0755);
+    std::vector<uint8_t> lato;
+    CHECK(readFile(LATO_TTF, lato));
+    CHECK(writeFile(std::string(FONT_DIR) + TTF_LOADER_DIR "lato.ttf", lato));
+    TtfLoader::setFontDir(FONT_DIR);
+    TtfLoader* loader = TtfLoader::getInstance();
+
+    // 没有字体文件或字号超出范围时使用原来的字体
+    CHECK(!loader->hasFace("nosuch"));
+    CHECK(loader->font("nosuch", 20, &lv_font_montserrat_14) == &lv_font_montserrat_14);
+    CHECK(loader->font("lato", TTF_MIN_SIZE - 1, &lv_font_montserrat_14) == &lv_font_montserrat_14);
+    CHECK(loader->font("lato", TTF_MAX_SIZE + 1, &lv_font_montserrat_14) == &lv_font_montserrat_14);
+    CHECK(loader->hasFace("lato"));
+
+    // 与FreeType的参考比较
+    std::vector<Reference> references;
+    int rasterized = 0;
+    int lastRasterized = 0;
+    for (uint16_t size : REFERENCE_SIZES) {
+        Reference ref;
+        if (!readReference(size, ref)) {
+            printf("无法读取%s中%u像素的参考（须在test/host中运行）\n", REFERENCE_DIR, size);
+            return 1;
+        }
+        const lv_font_t* font = loader->font("lato", size, &lv_font_montserrat_14);
+        CHECK(loader->isLoaded(font));
+        CHECK(loader->font("lato", size, &lv_font_montserrat_14) == font);
+        lastRasterized = checkReference(font, ref);
+        rasterized += lastRasterized;
+        references.push_back(ref);
+    }
+    uint32_t hits, misses;
+    loader->getCacheCounts(hits, misses);
+    CHECK(hits == 0);
+    CHECK(misses == (uint32_t)rasterized);
+
+    // 第二次绘制使用缓存的位图（缓存最多TTF_GLYPH_CACHE_ENTRIES个字形，最后一个字号的字形都在缓存中）
+    const Reference& last = references.back();
+    const lv_font_t* lastFont = loader->font("lato", last.size, &lv_font_montserrat_14);
+    for (const RefGlyph& glyph : last.glyphs) {
+        if (glyph.width > 0) {
+            lv_font_get_glyph_bitmap(lastFont, glyph.letter);
+        }
+    }
+    loader->getCacheCounts(hits, misses);
+    CHECK(hits == (uint32_t)lastRasterized);
+    CHECK(misses == (uint32_t)rasterized);
+    loader->clearCache();
+    const lv_font_t* lato20 = loader->font("lato", 20, &lv_font_montserrat_14);
+    CHECK(lv_font_get_glyph_bitmap(lato20, 'A') != nullptr);
+    loader->getCacheCounts(hits, misses);
+    CHECK(misses == (uint32_t)rasterized + 1);
+    printf("字形缓存：第二次绘制%u次命中\n", (unsigned)hits);
+
+    // 制表符为两个空格宽；字体中没有的字符使用原来的字体
+    lv_font_glyph_dsc_t space, tab, symbol;
+    CHECK(lv_font_get_glyph_dsc(lato20, &space, ' ', 0));
+    CHECK(lv_font_get_glyph_dsc(lato20, &tab, '\t', 0));
+    CHECK(tab.adv_w == space.adv_w * 2);
+    CHECK(lv_font_get_glyph_dsc(lato20, &symbol, 0xF00C, 0));
+    CHECK(symbol.resolved_font == &lv_font_montserrat_14);
+    CHECK(lato20->line_height >= 20 && lato20->base_line > 0);
+
+    // 损坏的字体
+    for (const Reference& ref : references) {
+        for (const RefGlyph& glyph : ref.glyphs) {
+            fuzzLetters.push_back(glyph.letter);
+        }
+        break;
+    }
+    for (uint32_t letter : {0x0u, 0x1Fu, 0x100u, 0x2026u, 0x20ACu, 0xFB01u, 0xFFFEu, 0xFFFFu, 0x10000u, 0x1F600u, 0x10FFFFu}) {
+        fuzzLetters.push_back(letter);
+    }
+    checkCorruptFonts(lato);
+
+    loader->reset();
+    if (failures > 0) {
+        printf("ttf_loader_test: %d 项失败\n", failures);
+        return 1;
+    }
+    printf("ttf_loader_test: 全部通过\n");
+    return 0;
+}
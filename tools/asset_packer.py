@@ -0,0 +1,453 @@
+"""
+资源包打包工具
+
+把背景图像和字体打包成资源包，烧录到user_huge_app.csv中的assets分区。固件启动时用esp_partition_mmap映射整个分区，
+图像和字体描述符直接指向映射的Flash，不复制数据；更换图片或字体只需重新烧录资源包，不需要重新编译固件。
+
+资源包格式（小端，所有数据块4字节对齐）：
+  头部（16字节）：'A','S','B','1'  uint16 版本  uint16 条目数  uint32 总长度  uint32 CRC32（头部之后的所有数据）
+  索引（每项32字节）：char[20] 名称  uint8 类型（1图像/2字体/3轮廓字体）  uint8 保留  uint16 保留  uint32 偏移  uint32 长度
+  图像：uint8 颜色格式  uint8 保留  uint16 宽  uint16 高  uint16 保留  uint32 数据长度  数据
+        （数据与src/images中C数组的内容相同：调色板索引、按行游程编码或RGB565；JPEG图像为完整的JPEG文件）
+  字体：40字节的字体头，之后是cmap表、字距分类表、glyph_dsc数组、unicode列表和glyph_bitmap，
+        glyph_dsc按固件中lv_font_fmt_txt_glyph_dsc_t的内存布局写入（取决于lv_conf.h中的LV_FONT_FMT_TXT_LARGE）
+  轮廓字体：完整的TrueType文件（大端，原样写入）
+
+assets/images中的JPEG（*.jpg）原样打包，由固件中的JpegImage逐MCU行流式解码，同名的PNG母版不再转换；
+JPEG须为基线（非渐进式）编码。
+
+字体从lv_font_conv生成的C文件（--format lvgl）读取，只支持字距分类表（--force-fast-kern-format），字距对表会被忽略。
+加上--compress-fonts时未压缩的字体位图按LVGL的压缩格式（行间异或加游程编码）重新编码，4位的16像素汉字字体约缩小1/4，
+大字号字体约缩小一半；
+固件中的FontLoader把压缩的字体包装为使用解压字形缓存的字体，字形只在第一次绘制时解压。
+
+assets/fonts中的TrueType字体（*.ttf，须为glyf轮廓）原样打包为轮廓字体，名称为字体系列（如digital.ttf对应布局中的
+digital24/48/64/108），固件中的TtfLoader在布局元素指定字号时直接从映射的Flash光栅化字形。
+
+用法：
+  python tools/asset_packer.py                                  # 打包assets/images中的图像和assets/fonts中的字体
+  python tools/asset_packer.py --font song16=lvgl_font_song_16.c # 加入指定的字体（名称与布局中的字体名称一致）
+  python tools/asset_packer.py --compress-fonts                 # 压缩字体位图（输出压缩前后的大小）
+  python tools/asset_packer.py --ttf digital=DS-DIGI.TTF         # 加入指定的轮廓字体
+  python tools/asset_packer.py --dump .pio/assets.bin           # 列出资源包的内容
+"""
+import argparse
+import glob
+import logging
+import os
+import re
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import image_converter  # noqa: E402
+
+# 配置日志
+logging.basicConfig(level=logging.INFO, format='%(asctime)s - %(levelname)s - %(message)s')
+logger = logging.getLogger(__name__)
+
+project_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+fonts_dir = os.path.join(project_dir, 'assets', 'fonts')
+partition_table = os.path.join(project_dir, 'user_huge_app.csv')
+lv_conf_path = os.path.join(project_dir, 'lib', 'lv_conf.h')
+default_output = os.path.join(project_dir, '.pio', 'assets.bin')
+
+BUNDLE_MAGIC = b'ASB1'
+BUNDLE_VERSION = 1
+BUNDLE_HEADER_SIZE = 16
+ENTRY_SIZE = 32
+NAME_SIZE = 20
+TYPE_IMAGE = 1
+TYPE_FONT = 2
+TYPE_OUTLINE = 3
+FONT_HEADER_SIZE = 40
+CMAP_RECORD_SIZE = 20
+KERN_RECORD_SIZE = 16
+PARTITION_NAME = 'assets'
+
+# image_converter的输出格式对应的lv_img_cf_t
+IMAGE_CF = {'raw': 4, 'indexed4': 9, 'indexed8': 10, 'rle': 30}
+# JPEG图像的颜色格式（LV_IMG_CF_USER_ENCODED_1，与jpeg_image.h中的JPEG_IMAGE_CF一致）
+JPEG_CF = 31
+# cmap类型
+CMAP_TYPES = {'FORMAT0_FULL': 0, 'SPARSE_FULL': 1, 'FORMAT0_TINY': 2, 'SPARSE_TINY': 3}
+
+
+# 4字节对齐
+def align(buffer):
+    while len(buffer) % 4:
+        buffer.append(0)
+
+
+# 去掉C注释
+def strip_comments(source):
+    return re.sub(r'/\*.*?\*/', '', source, flags=re.S)
+
+
+# 读取C数组：返回{名称: (类型, 数值列表)}
+def parse_arrays(source):
+    arrays = {}
+    pattern = r'(?:static\s+)?(?:LV_ATTRIBUTE_LARGE_CONST\s+)?const\s+(?:LV_ATTRIBUTE_LARGE_CONST\s+)?(uint8_t|uint16_t|int8_t)\s+(\w+)\[\]\s*=\s*\{(.*?)\};'
+    for kind, name, body in re.findall(pattern, source, flags=re.S):
+        values = [int(v, 0) for v in re.findall(r'-?(?:0x[0-9a-fA-F]+|\d+)', body)]
+        arrays[name] = (kind, values)
+    return arrays
+
+
+# 读取结构体中的字段
+def field(source, name, default=None):
+    match = re.search(r'\.' + name + r'\s*=\s*([^,\n}]+)', source)
+    if match is None:
+        if default is None:
+            raise ValueError(f'字体文件中缺少{name}')
+        return default
+    return match.group(1).strip()
+
+
+# 读取lv_conf.h中的LV_FONT_FMT_TXT_LARGE
+def glyph_dsc_large():
+    with open(lv_conf_path, 'r', encoding='utf-8') as f:
+        match = re.search(r'#define\s+LV_FONT_FMT_TXT_LARGE\s+(\d+)', f.read())
+    return match is not None and match.group(1) != '0'
+
+
+# 按位写入（高位在前）
+class BitWriter:
+    def __init__(self):
+        self.data = bytearray()
+        self.pos = 0
+
+    def put(self, value, bits):
+        for shift in range(bits - 1, -1, -1):
+            if self.pos % 8 == 0:
+                self.data.append(0)
+            if (value >> shift) & 1:
+                self.data[-1] |= 0x80 >> (self.pos % 8)
+            self.pos += 1
+
+
+# 读取一个字形的像素值（像素连续存放，行之间不按字节对齐，与LVGL的位图布局一致）
+def glyph_pixels(bitmap, index, width, height, bpp):
+    pixels = []
+    for i in range(width * height):
+        bit = i * bpp
+        byte = bitmap[index + bit // 8]
+        pixels.append((byte >> (8 - bit % 8 - bpp)) & ((1 << bpp) - 1))
+    return pixels
+
+
+# 按LVGL的压缩格式编码一个字形（与lv_font_fmt_txt.c中的rle_next()对应）：
+# 每行与上一行异或后游程编码；重复的值先用1位标记，连续11次后用6位计数
+def compress_glyph(pixels, width, bpp):
+    values = pixels[:width] + [pixels[i] ^ pixels[i - width] for i in range(width, len(pixels))]
+    out = BitWriter()
+    state = 'single'
+    prev = None
+    count = 0
+    i = 0
+    while i < len(values):
+        if state == 'single':
+            out.put(values[i], bpp)
+            if prev is not None and values[i] == prev:
+                state = 'repeat'
+                count = 0
+            prev = values[i]
+            i += 1
+        elif values[i] == prev:
+            out.put(1, 1)
+            count += 1
+            i += 1
+            if count == 11:
+                # 后面还有run个相同的值：计数为c时重复c-1次，然后是一个新值
+                run = 0
+                while i + run < len(values) and values[i + run] == prev and run < 62:
+                    run += 1
+                out.put(run + 1, 6)
+                i += run
+                if i < len(values):
+                    out.put(values[i], bpp)
+                    prev = values[i]
+                    i += 1
+                state = 'single'
+        else:
+            out.put(0, 1)
+            out.put(values[i], bpp)
+            prev = values[i]
+            i += 1
+            state = 'single'
+    return bytes(out.data)
+
+
+# 压缩所有字形的位图，返回新的位图和字形描述
+def compress_bitmaps(bitmap, glyphs, bpp):
+    compressed = bytearray()
+    result = []
+    for bitmap_index, adv_w, box_w, box_h, ofs_x, ofs_y in glyphs:
+        index = len(compressed)
+        if box_w * box_h > 0:
+            compressed += compress_glyph(glyph_pixels(bitmap, bitmap_index, box_w, box_h, bpp), box_w, bpp)
+        result.append((index, adv_w, box_w, box_h, ofs_x, ofs_y))
+    # 解压时可能多读一个字节
+    compressed.append(0)
+    return bytes(compressed), result
+
+
+# 解析lv_font_conv生成的C文件并编码为资源包中的字体
+def encode_font(path, compress=False):
+    with open(path, 'r', encoding='utf-8') as f:
+        source = strip_comments(f.read())
+    arrays = parse_arrays(source)
+    bitmap = bytes(v & 0xFF for v in arrays['glyph_bitmap'][1])
+    glyphs = [tuple(int(v) for v in g) for g in re.findall(
+        r'\{\s*\.bitmap_index\s*=\s*(\d+),\s*\.adv_w\s*=\s*(\d+),\s*\.box_w\s*=\s*(\d+),\s*\.box_h\s*=\s*(\d+),'
+        r'\s*\.ofs_x\s*=\s*(-?\d+),\s*\.ofs_y\s*=\s*(-?\d+)\s*\}', source)]
+    cmaps = re.findall(
+        r'\.range_start\s*=\s*(\d+),\s*\.range_length\s*=\s*(\d+),\s*\.glyph_id_start\s*=\s*(\d+),'
+        r'\s*\.unicode_list\s*=\s*(\w+),\s*\.glyph_id_ofs_list\s*=\s*(\w+),\s*\.list_length\s*=\s*(\d+),'
+        r'\s*\.type\s*=\s*LV_FONT_FMT_TXT_CMAP_(\w+)', source)
+    dsc_start = source.index('lv_font_fmt_txt_dsc_t font_dsc')
+    dsc = source[dsc_start:source.index('};', dsc_start)]
+    public = source[source.rindex('.get_glyph_dsc'):]
+    bpp = int(field(dsc, 'bpp'))
+    bitmap_format = int(field(dsc, 'bitmap_format', '0'))
+    kern_scale = int(field(dsc, 'kern_scale', '0'))
+    kern_dsc = field(dsc, 'kern_dsc', 'NULL')
+    kern_classes = int(field(dsc, 'kern_classes', '0'))
+    subpx = {'LV_FONT_SUBPX_NONE': 0, 'LV_FONT_SUBPX_HOR': 1, 'LV_FONT_SUBPX_VER': 2, 'LV_FONT_SUBPX_BOTH': 3}[field(public, 'subpx', 'LV_FONT_SUBPX_NONE')]
+    # 未压缩时所有字形位图的大小
+    raw_bitmap = sum((g[2] * g[3] * bpp + 7) // 8 for g in glyphs[1:])
+    if compress and bitmap_format == 0 and bpp in (1, 2, 4):
+        bitmap, glyphs = compress_bitmaps(bitmap, glyphs, bpp)
+        bitmap_format = 1
+
+    large = glyph_dsc_large()
+    payload = bytearray(FONT_HEADER_SIZE + CMAP_RECORD_SIZE * len(cmaps))
+    kern_record_offset = 0
+    if kern_dsc != 'NULL' and kern_classes:
+        kern_record_offset = len(payload)
+        payload += bytes(KERN_RECORD_SIZE)
+    elif kern_dsc != 'NULL':
+        logger.warning(f'{path}: 不支持字距对表，已忽略字距（生成字体时使用--force-fast-kern-format）')
+        kern_scale = 0
+    align(payload)
+
+    # glyph_dsc按固件中的内存布局写入
+    glyph_offset = len(payload)
+    for bitmap_index, adv_w, box_w, box_h, ofs_x, ofs_y in glyphs:
+        if large:
+            payload += struct.pack('<IIHHhh', bitmap_index, adv_w, box_w, box_h, ofs_x, ofs_y)
+        else:
+            payload += struct.pack('<IBBbb', bitmap_index | (adv_w << 20), box_w, box_h, ofs_x, ofs_y)
+
+    # 写入数组并返回偏移
+    def put_array(name):
+        if name == 'NULL':
+            return 0
+        kind, values = arrays[name]
+        align(payload)
+        offset = len(payload)
+        payload.extend(struct.pack('<%d%s' % (len(values), {'uint8_t': 'B', 'uint16_t': 'H', 'int8_t': 'b'}[kind]), *values))
+        return offset
+
+    records = bytearray()
+    for range_start, range_length, glyph_id_start, unicode_list, ofs_list, list_length, cmap_type in cmaps:
+        records += struct.pack('<IHHIIHBB', int(range_start), int(range_length), int(glyph_id_start),
+                               put_array(unicode_list), put_array(ofs_list), int(list_length), CMAP_TYPES[cmap_type], 0)
+    payload[FONT_HEADER_SIZE:FONT_HEADER_SIZE + len(records)] = records
+
+    kern_offset = 0
+    if kern_record_offset:
+        classes_start = source.index('lv_font_fmt_txt_kern_classes_t kern_classes')
+        classes = source[classes_start:source.index('};', classes_start)]
+        values = put_array(field(classes, 'class_pair_values'))
+        left = put_array(field(classes, 'left_class_mapping'))
+        right = put_array(field(classes, 'right_class_mapping'))
+        payload[kern_record_offset:kern_record_offset + KERN_RECORD_SIZE] = struct.pack(
+            '<IIIBBH', values, left, right, int(field(classes, 'left_class_cnt')), int(field(classes, 'right_class_cnt')), 0)
+        kern_offset = kern_record_offset
+
+    align(payload)
+    bitmap_offset = len(payload)
+    payload += bitmap
+    align(payload)
+
+    header = struct.pack('<hhbbBBBBHIHBBIIIII',
+                         int(field(public, 'line_height')), int(field(public, 'base_line')),
+                         int(field(public, 'underline_position', '0')), int(field(public, 'underline_thickness', '0')),
+                         subpx, bpp, bitmap_format, 16 if large else 8, len(cmaps), len(glyphs),
+                         kern_scale, 1 if kern_offset else 0, 0,
+                         glyph_offset, bitmap_offset, FONT_HEADER_SIZE, kern_offset, len(bitmap))
+    payload[:FONT_HEADER_SIZE] = header
+    return bytes(payload), {'glyphs': len(glyphs), 'cmaps': len(cmaps), 'bitmap': len(bitmap), 'raw_bitmap': raw_bitmap,
+                            'compressed': bitmap_format != 0, 'kerning': bool(kern_offset)}
+
+
+# 编码图像
+def encode_image(path, name):
+    result = image_converter.convert(path, None, name, 'auto', image_converter.DEFAULT_MIN_SAVING,
+                                     image_converter.DEFAULT_MIN_PSNR, False, False)
+    data = result['data']
+    payload = struct.pack('<BBHHHI', IMAGE_CF[result['format']], 0, result['width'], result['height'], 0, len(data)) + data
+    return payload, result
+
+
+# 读取JPEG的宽高，渐进式JPEG返回None
+def jpeg_size(data):
+    if data[:2] != b'\xff\xd8':
+        return None
+    pos = 2
+    while pos + 4 <= len(data) and data[pos] == 0xFF:
+        marker = data[pos + 1]
+        length = struct.unpack_from('>H', data, pos + 2)[0]
+        if marker == 0xC2:
+            return None
+        if 0xC0 <= marker <= 0xCF and marker not in (0xC4, 0xC8, 0xCC):
+            height, width = struct.unpack_from('>HH', data, pos + 5)
+            return width, height
+        pos += 2 + length
+    return None
+
+
+# 打包JPEG图像（原样保存JPEG数据）
+def encode_jpeg(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    size = jpeg_size(data)
+    if size is None:
+        raise ValueError(f'{path}不是基线JPEG')
+    payload = struct.pack('<BBHHHI', JPEG_CF, 0, size[0], size[1], 0, len(data)) + data
+    return payload, size
+
+
+# 生成资源包
+# 读取并校验TrueType字体（固件只支持glyf轮廓）
+def encode_outline(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if len(data) < 12 or data[:4] not in (b'\x00\x01\x00\x00', b'true'):
+        raise ValueError(f'{path}不是TrueType字体')
+    tables = {}
+    for index in range(struct.unpack_from('>H', data, 4)[0]):
+        tag, _, offset, length = struct.unpack_from('>4sIII', data, 12 + index * 16)
+        tables[tag] = (offset, length)
+    missing = [tag.decode() for tag in (b'head', b'hhea', b'maxp', b'hmtx', b'loca', b'glyf', b'cmap') if tag not in tables]
+    if missing:
+        raise ValueError(f'{path}缺少{",".join(missing)}表（CFF轮廓的字体不支持）')
+    glyphs = struct.unpack_from('>H', data, tables[b'maxp'][0] + 4)[0]
+    return data, {'glyphs': glyphs, 'kerning': b'kern' in tables}
+
+
+def build_bundle(entries):
+    body = bytearray(ENTRY_SIZE * len(entries))
+    for index, (name, kind, payload) in enumerate(entries):
+        align(body)
+        offset = BUNDLE_HEADER_SIZE + len(body)
+        body += payload
+        body[index * ENTRY_SIZE:(index + 1) * ENTRY_SIZE] = struct.pack(
+            '<20sBBHII', name.encode('utf-8')[:NAME_SIZE - 1], kind, 0, 0, offset, len(payload))
+    align(body)
+    total = BUNDLE_HEADER_SIZE + len(body)
+    header = BUNDLE_MAGIC + struct.pack('<HHII', BUNDLE_VERSION, len(entries), total, zlib.crc32(bytes(body)) & 0xFFFFFFFF)
+    return header + bytes(body)
+
+
+# 从分区表读取资源分区的偏移和大小
+def find_partition():
+    with open(partition_table, 'r', encoding='utf-8') as f:
+        for line in f:
+            columns = [c.strip() for c in line.split('#')[0].split(',')]
+            if len(columns) >= 5 and columns[0] == PARTITION_NAME:
+                return int(columns[3], 0), int(columns[4], 0)
+    return None, None
+
+
+# 列出资源包的内容
+def dump(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] != BUNDLE_MAGIC:
+        logger.error(f'{path}不是资源包')
+        return
+    version, count, total, crc = struct.unpack_from('<HHII', data, 4)
+    ok = zlib.crc32(data[BUNDLE_HEADER_SIZE:total]) & 0xFFFFFFFF == crc
+    print(f'版本 {version}, {count}个条目, {total}字节, CRC {"正确" if ok else "错误"}')
+    for index in range(count):
+        name, kind, _, _, offset, size = struct.unpack_from('<20sBBHII', data, BUNDLE_HEADER_SIZE + index * ENTRY_SIZE)
+        name = name.rstrip(b'\0').decode('utf-8')
+        if kind == TYPE_IMAGE:
+            cf, _, width, height, _, data_size = struct.unpack_from('<BBHHHI', data, offset)
+            detail = f'图像 {width}x{height} cf={cf} {data_size}字节'
+        elif kind == TYPE_OUTLINE:
+            glyphs = struct.unpack_from('>H', data, offset + 4)[0]
+            detail = f'轮廓字体 {glyphs}个表'
+        else:
+            line_height, _, _, _, _, bpp, bitmap_format, _, cmaps, glyphs = struct.unpack_from('<hhbbBBBBHI', data, offset)
+            detail = f'字体 行高{line_height} {bpp}bpp {glyphs}个字形 {cmaps}个cmap{" 压缩" if bitmap_format else ""}'
+        print(f'  {name:<20}偏移 0x{offset:06x} {size:>8}字节  {detail}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='把图像和字体打包为assets分区的资源包')
+    parser.add_argument('-o', '--output', default=default_output, help='输出文件')
+    parser.add_argument('--font', action='append', default=[], help='加入字体：名称=lv_font_conv生成的C文件')
+    parser.add_argument('--ttf', action='append', default=[], help='加入轮廓字体：名称=TrueType字体文件')
+    parser.add_argument('--no-images', action='store_true', help='不打包assets/images中的图像')
+    parser.add_argument('--compress-fonts', action='store_true', help='按LVGL的压缩格式编码未压缩的字体位图')
+    parser.add_argument('--dump', help='列出资源包的内容')
+    args = parser.parse_args()
+
+    if args.dump:
+        dump(args.dump)
+        return
+
+    entries = []
+    if not args.no_images:
+        jpegs = sorted(glob.glob(os.path.join(image_converter.masters_dir, '*.jpg')))
+        for path in jpegs:
+            name = os.path.splitext(os.path.basename(path))[0]
+            payload, size = encode_jpeg(path)
+            entries.append((name, TYPE_IMAGE, payload))
+            logger.info(f'图像 {name}: jpeg {size[0]}x{size[1]}, {len(payload)}字节')
+        jpeg_names = {os.path.splitext(os.path.basename(p))[0] for p in jpegs}
+        for path in sorted(glob.glob(os.path.join(image_converter.masters_dir, '*.png'))):
+            name = os.path.splitext(os.path.basename(path))[0]
+            if name in jpeg_names:
+                logger.info(f'图像 {name}: 使用JPEG，跳过PNG母版')
+                continue
+            payload, result = encode_image(path, name)
+            entries.append((name, TYPE_IMAGE, payload))
+            logger.info(f'图像 {name}: {result["format"]}, {len(payload)}字节')
+    fonts = [(os.path.splitext(os.path.basename(p))[0], p) for p in sorted(glob.glob(os.path.join(fonts_dir, '*.c')))]
+    fonts += [tuple(spec.split('=', 1)) for spec in args.font]
+    for name, path in fonts:
+        payload, info = encode_font(path, args.compress_fonts)
+        entries.append((name, TYPE_FONT, payload))
+        bitmap_detail = f'位图{info["bitmap"]}字节'
+        if info['compressed']:
+            bitmap_detail += f'（压缩，未压缩{info["raw_bitmap"]}字节，{info["bitmap"] * 100 // max(info["raw_bitmap"], 1)}%）'
+        logger.info(f'字体 {name}: {info["glyphs"]}个字形, {info["cmaps"]}个cmap, {bitmap_detail}, '
+                     f'{"有" if info["kerning"] else "无"}字距, 共{len(payload)}字节')
+    outlines = [(os.path.splitext(os.path.basename(p))[0], p) for p in sorted(glob.glob(os.path.join(fonts_dir, '*.ttf')))]
+    outlines += [tuple(spec.split('=', 1)) for spec in args.ttf]
+    for name, path in outlines:
+        payload, info = encode_outline(path)
+        entries.append((name, TYPE_OUTLINE, payload))
+        logger.info(f'轮廓字体 {name}: {info["glyphs"]}个字形, {"有" if info["kerning"] else "无"}字距, {len(payload)}字节')
+
+    bundle = build_bundle(entries)
+    offset, size = find_partition()
+    if size is not None and len(bundle) > size:
+        logger.error(f'资源包{len(bundle)}字节，超过assets分区的{size}字节')
+        sys.exit(1)
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, 'wb') as f:
+        f.write(bundle)
+    logger.info(f'已生成 {args.output}: {len(entries)}个条目, {len(bundle)}字节' +
+                (f'（分区{size}字节，已用{len(bundle) * 100 // size}%）' if size else ''))
+    if offset is not None:
+        print(f'烧录: esptool.py --chip esp32 write_flash 0x{offset:x} {args.output}')
+
+
+if __name__ == '__main__':
+    main()
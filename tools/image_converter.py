@@ -0,0 +1,657 @@
+"""
+背景图像转换工具
+
+把无损的母版图像（assets/images/*.png，或LVGL图像转换器生成的真彩色C数组）转换为固件使用的图像C文件：
+- 调色板索引图像（LV_IMG_CF_INDEXED_4BIT/8BIT），可选Floyd-Steinberg抖动；
+  与母版相比的PSNR不低于阈值时才使用，由LVGL自带的解码器绘制
+- 按行游程编码（RLE）的RGB565图像，由固件中的RleImage解码器在绘制时逐行解压
+- 压缩后节省的空间不足时保留RGB565原始数据（只保留16位色深的数据，源文件也随之变小）
+
+压缩格式（小端）：
+  0   'R','L','E','6'       魔数
+  4   uint16 宽度
+  6   uint16 高度
+  8   char[16] 图像名称（统计中使用）
+  24  uint32 行偏移表[高度]（相对数据开头）
+  ... 每行的数据：控制字节c
+        c & 0x80 为重复段：下一个像素重复 (c & 0x7F) + 1 次
+        否则为原样段：后面跟 c + 1 个像素
+      像素为2字节RGB565（LV_COLOR_16_SWAP = 0时的字节顺序）
+
+索引图像是有损的，所以母版单独保存在assets/images中，每次都从母版转换，PSNR也相对母版计算。
+
+用法：
+  python tools/image_converter.py --all                    # 从母版转换全部背景图像到src/images
+  python tools/image_converter.py --all --dither           # 索引图像使用抖动
+  python tools/image_converter.py soul.png -o src/images/soul.c --name soul
+  python tools/image_converter.py --report                 # 只输出各格式的大小和PSNR，不写文件
+  python tools/image_converter.py --export-masters         # 把src/images中的无损图像导出为母版PNG
+"""
+import argparse
+import glob
+import logging
+import os
+import math
+import re
+import struct
+import zlib
+
+# 配置日志
+logging.basicConfig(level=logging.INFO, format='%(asctime)s - %(levelname)s - %(message)s')
+logger = logging.getLogger(__name__)
+
+# 图像目录
+project_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+images_dir = os.path.join(project_dir, 'src', 'images')
+masters_dir = os.path.join(project_dir, 'assets', 'images')
+
+RLE_MAGIC = b'RLE6'
+RLE_NAME_SIZE = 16
+RLE_HEADER_SIZE = 8 + RLE_NAME_SIZE
+# 每段最多的像素数
+RLE_MAX_SEGMENT = 128
+# 压缩后至少节省的比例，不足时保留原始数据（解压有开销，省得太少不值得）
+DEFAULT_MIN_SAVING = 0.10
+# 索引图像与母版相比的最低PSNR（dB），低于该值时保留真彩色
+DEFAULT_MIN_PSNR = 32.0
+# 自动选择时尝试的索引格式（按从小到大的顺序）
+INDEXED_FORMATS = (('indexed4', 4), ('indexed8', 8))
+
+
+# 从LVGL C文件中读取图像：返回(宽度, 高度, RGB565像素列表)
+def load_c_image(path):
+    with open(path, 'r', encoding='utf-8') as f:
+        source = f.read()
+    width = int(re.search(r'\.header\.w\s*=\s*(\d+)', source).group(1))
+    height = int(re.search(r'\.header\.h\s*=\s*(\d+)', source).group(1))
+    data = None
+    # 本工具生成的文件只有一段数据
+    marker = '#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0'
+    if marker in source:
+        start = source.index(marker)
+        body = source[start:source.index('#endif', start)].split('\n', 1)[1]
+    else:
+        start = source.index('[] = {')
+        body = source[start:source.index('};', start)]
+    data = bytes(int(value, 16) for value in re.findall(r'0x([0-9a-fA-F]{2})', body))
+    if data[:4] == RLE_MAGIC:
+        return width, height, rle_decode(data)
+    cf = re.search(r'\.header\.cf\s*=\s*(\w+)', source).group(1)
+    if cf.startswith('LV_IMG_CF_INDEXED_'):
+        logger.warning(f'{path}是有损的索引图像，应从母版转换')
+        return width, height, indexed_decode(data, width, height, 4 if cf.endswith('4BIT') else 8)
+    pixels = list(struct.unpack('<%dH' % (width * height), data[:width * height * 2]))
+    return width, height, pixels
+
+
+# RGB565与RGB888互相转换（扩展时低位复制高位，往返转换不丢失信息）
+def rgb565_to_rgb(pixel):
+    r = (pixel >> 11) & 0x1F
+    g = (pixel >> 5) & 0x3F
+    b = pixel & 0x1F
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
+
+
+def rgb_to_rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+# PNG行滤波的Paeth预测
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+# 读取PNG文件（只用标准库，支持8位RGB/RGBA/调色板，不支持隔行扫描）
+def load_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError(f'{path}不是PNG文件')
+    pos = 8
+    idat = bytearray()
+    palette = []
+    while pos < len(data):
+        length, kind = struct.unpack_from('>I4s', data, pos)
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, color_type, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b'IDAT':
+            idat += chunk
+        elif kind == b'IEND':
+            break
+    channels = {2: 3, 6: 4, 3: 1}.get(color_type)
+    if depth != 8 or channels is None or interlace:
+        raise ValueError(f'{path}: 只支持8位RGB/RGBA/调色板的非隔行PNG')
+    raw = zlib.decompress(bytes(idat))
+    stride = width * channels
+    previous = bytearray(stride)
+    pixels = []
+    for y in range(height):
+        offset = y * (stride + 1)
+        kind = raw[offset]
+        row = bytearray(raw[offset + 1:offset + 1 + stride])
+        for i in range(stride):
+            left = row[i - channels] if i >= channels else 0
+            up = previous[i]
+            upper_left = previous[i - channels] if i >= channels else 0
+            if kind == 1:
+                row[i] = (row[i] + left) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + up) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                row[i] = (row[i] + paeth(left, up, upper_left)) & 0xFF
+        for x in range(width):
+            if channels == 1:
+                r, g, b = palette[row[x]]
+            else:
+                r, g, b = row[x * channels:x * channels + 3]
+            pixels.append(rgb_to_rgb565(r, g, b))
+        previous = row
+    return width, height, pixels
+
+
+# 写入PNG文件（8位RGB，每行选择绝对值和最小的滤波方式）
+def save_png(path, width, height, pixels):
+    out = bytearray()
+    previous = bytearray(width * 3)
+    for y in range(height):
+        row = bytearray()
+        for pixel in pixels[y * width:(y + 1) * width]:
+            row += bytes(rgb565_to_rgb(pixel))
+        best = None
+        for kind in range(5):
+            filtered = bytearray([kind])
+            for i in range(len(row)):
+                left = row[i - 3] if i >= 3 else 0
+                up = previous[i]
+                upper_left = previous[i - 3] if i >= 3 else 0
+                predict = (0, left, up, (left + up) >> 1, paeth(left, up, upper_left))[kind]
+                filtered.append((row[i] - predict) & 0xFF)
+            score = sum(v if v < 128 else 256 - v for v in filtered[1:])
+            if best is None or score < best[0]:
+                best = (score, filtered)
+        out += best[1]
+        previous = row
+
+    def chunk(kind, body):
+        return struct.pack('>I', len(body)) + kind + body + struct.pack('>I', zlib.crc32(kind + body) & 0xFFFFFFFF)
+
+    with open(path, 'wb') as f:
+        f.write(b'\x89PNG\r\n\x1a\n')
+        f.write(chunk(b'IHDR', struct.pack('>IIBBBBB', width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b'IDAT', zlib.compress(bytes(out), 9)))
+        f.write(chunk(b'IEND', b''))
+
+
+# 读取输入图像
+def load_image(path):
+    if path.endswith('.c'):
+        return load_c_image(path)
+    return load_png(path)
+
+
+# 编码一行像素
+def rle_encode_row(row):
+    out = bytearray()
+    i = 0
+    n = len(row)
+    while i < n:
+        # 重复段：至少2个相同像素
+        j = i + 1
+        while j < n and row[j] == row[i] and j - i < RLE_MAX_SEGMENT:
+            j += 1
+        if j - i >= 2:
+            out.append(0x80 | (j - i - 1))
+            out += struct.pack('<H', row[i])
+            i = j
+            continue
+        # 原样段：直到出现两个相同的相邻像素
+        j = i + 1
+        while j < n and j - i < RLE_MAX_SEGMENT and row[j] != row[j - 1]:
+            j += 1
+        if j < n and row[j] == row[j - 1] and j - 1 > i:
+            # 把重复段的第一个像素留给下一个重复段
+            j -= 1
+        out.append(j - i - 1)
+        out += struct.pack('<%dH' % (j - i), *row[i:j])
+        i = j
+    return out
+
+
+# 编码整幅图像
+def rle_encode(width, height, pixels, name):
+    header = RLE_MAGIC + struct.pack('<HH', width, height) + name.encode('utf-8')[:RLE_NAME_SIZE - 1].ljust(RLE_NAME_SIZE, b'\0')
+    offsets = bytearray()
+    rows = bytearray()
+    base = RLE_HEADER_SIZE + height * 4
+    for y in range(height):
+        offsets += struct.pack('<I', base + len(rows))
+        rows += rle_encode_row(pixels[y * width:(y + 1) * width])
+    return bytes(header + offsets + rows)
+
+
+# 解码整幅图像（用于校验和再次转换）
+def rle_decode(data):
+    width, height = struct.unpack_from('<HH', data, 4)
+    pixels = []
+    for y in range(height):
+        pos = struct.unpack_from('<I', data, RLE_HEADER_SIZE + y * 4)[0]
+        count = 0
+        while count < width:
+            control = data[pos]
+            pos += 1
+            length = (control & 0x7F) + 1
+            if control & 0x80:
+                pixels += [struct.unpack_from('<H', data, pos)[0]] * length
+                pos += 2
+            else:
+                pixels += list(struct.unpack_from('<%dH' % length, data, pos))
+                pos += length * 2
+            count += length
+    return pixels
+
+
+# 中位切分生成初始调色板（在不重复的颜色上按像素数加权）
+def median_cut(histogram, count):
+    boxes = [list(histogram.items())]
+    while len(boxes) < count:
+        # 切分像素数乘颜色范围最大的盒子
+        best = None
+        for index, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            ranges = [max(c[0][k] for c in box) - min(c[0][k] for c in box) for k in range(3)]
+            weight = sum(c[1] for c in box) * max(ranges)
+            if best is None or weight > best[0]:
+                best = (weight, index, ranges.index(max(ranges)))
+        if best is None:
+            break
+        _, index, axis = best
+        box = sorted(boxes.pop(index), key=lambda c: c[0][axis])
+        total = sum(c[1] for c in box)
+        half = 0
+        split = 1
+        for i, (_, weight) in enumerate(box[:-1]):
+            half += weight
+            if half * 2 >= total:
+                split = i + 1
+                break
+        boxes += [box[:split], box[split:]]
+    return [box_mean(box) for box in boxes if box]
+
+
+def box_mean(box):
+    total = sum(c[1] for c in box)
+    return tuple(sum(c[0][k] * c[1] for c in box) / total for k in range(3))
+
+
+# 找最近的调色板颜色
+def nearest(palette, color):
+    best = 0
+    best_distance = None
+    r, g, b = color
+    for index, (pr, pg, pb) in enumerate(palette):
+        distance = (r - pr) ** 2 + (g - pg) ** 2 + (b - pb) ** 2
+        if best_distance is None or distance < best_distance:
+            best = index
+            best_distance = distance
+    return best
+
+
+# 生成调色板：中位切分后用k均值迭代优化，颜色最后对齐到RGB565（设备上显示的颜色）
+def build_palette(pixels, count, iterations=4):
+    histogram = {}
+    for pixel in pixels:
+        color = rgb565_to_rgb(pixel)
+        histogram[color] = histogram.get(color, 0) + 1
+    if len(histogram) <= count:
+        return list(histogram.keys())
+    palette = median_cut(histogram, count)
+    for _ in range(iterations):
+        sums = [[0, 0, 0, 0] for _ in palette]
+        for color, weight in histogram.items():
+            entry = sums[nearest(palette, color)]
+            for k in range(3):
+                entry[k] += color[k] * weight
+            entry[3] += weight
+        palette = [tuple(e[k] / e[3] for k in range(3)) if e[3] else palette[i] for i, e in enumerate(sums)]
+    return [rgb565_to_rgb(rgb_to_rgb565(*(min(255, int(round(v))) for v in color))) for color in palette]
+
+
+# 量化为调色板索引，dither为True时使用Floyd-Steinberg误差扩散
+def quantize(width, height, pixels, bits, dither):
+    palette = build_palette(pixels, 1 << bits)
+    cache = {}
+    indices = [0] * len(pixels)
+    if not dither:
+        for i, pixel in enumerate(pixels):
+            if pixel not in cache:
+                cache[pixel] = nearest(palette, rgb565_to_rgb(pixel))
+            indices[i] = cache[pixel]
+        return palette, indices
+    errors = [[0.0, 0.0, 0.0] for _ in range(width * 2)]
+    for y in range(height):
+        current = errors[(y & 1) * width:(y & 1) * width + width]
+        following = [[0.0, 0.0, 0.0] for _ in range(width)]
+        for x in range(width):
+            source = rgb565_to_rgb(pixels[y * width + x])
+            color = tuple(min(255, max(0, int(round(source[k] + current[x][k])))) for k in range(3))
+            if color not in cache:
+                cache[color] = nearest(palette, color)
+            index = cache[color]
+            indices[y * width + x] = index
+            error = [color[k] - palette[index][k] for k in range(3)]
+            for k in range(3):
+                if x + 1 < width:
+                    current[x + 1][k] += error[k] * 7 / 16
+                    following[x + 1][k] += error[k] / 16
+                if x > 0:
+                    following[x - 1][k] += error[k] * 3 / 16
+                following[x][k] += error[k] * 5 / 16
+        errors[((y + 1) & 1) * width:((y + 1) & 1) * width + width] = following
+    return palette, indices
+
+
+# 生成LVGL索引图像数据：调色板（lv_color32_t：B、G、R、A）后面是按行对齐的索引
+def indexed_encode(width, height, palette, indices, bits):
+    data = bytearray()
+    for i in range(1 << bits):
+        r, g, b = palette[i] if i < len(palette) else (0, 0, 0)
+        data += bytes((b, g, r, 0xFF))
+    for y in range(height):
+        row = indices[y * width:(y + 1) * width]
+        if bits == 8:
+            data += bytes(row)
+        else:
+            for x in range(0, width, 2):
+                data.append((row[x] << 4) | (row[x + 1] if x + 1 < width else 0))
+    return bytes(data)
+
+
+# 解码LVGL索引图像数据
+def indexed_decode(data, width, height, bits):
+    count = 1 << bits
+    palette = [rgb_to_rgb565(data[i * 4 + 2], data[i * 4 + 1], data[i * 4]) for i in range(count)]
+    stride = width if bits == 8 else (width + 1) // 2
+    pixels = []
+    for y in range(height):
+        row = data[count * 4 + y * stride:count * 4 + (y + 1) * stride]
+        for x in range(width):
+            if bits == 8:
+                pixels.append(palette[row[x]])
+            else:
+                pixels.append(palette[(row[x >> 1] >> (4 if x % 2 == 0 else 0)) & 0x0F])
+    return pixels
+
+
+# 计算峰值信噪比（dB，按RGB888计算），完全相同时返回无穷大
+def psnr(original, pixels):
+    total = 0
+    for a, b in zip(original, pixels):
+        if a != b:
+            ca = rgb565_to_rgb(a)
+            cb = rgb565_to_rgb(b)
+            total += (ca[0] - cb[0]) ** 2 + (ca[1] - cb[1]) ** 2 + (ca[2] - cb[2]) ** 2
+    if total == 0:
+        return math.inf
+    mse = total / (len(original) * 3)
+    return 10 * math.log10(255 * 255 / mse)
+
+
+# 格式化字节数组
+def format_bytes(data):
+    lines = []
+    for i in range(0, len(data), 32):
+        lines.append('  ' + ', '.join('0x%02x' % b for b in data[i:i + 32]) + ',')
+    return '\n'.join(lines)
+
+
+# 生成C文件内容
+def generate_c(name, width, height, data, image_format, quality=None):
+    attribute = 'LV_ATTRIBUTE_IMG_' + name.upper()
+    if image_format in ('indexed4', 'indexed8'):
+        return generate_indexed_c(name, width, height, data, image_format, quality, attribute)
+    if image_format == 'rle':
+        cf = 'LV_IMG_CF_USER_ENCODED_0'
+        comment = '按行游程编码的RGB565图像，由RleImage解码器在绘制时逐行解压'
+    else:
+        cf = 'LV_IMG_CF_TRUE_COLOR'
+        comment = 'RGB565图像（压缩节省的空间太少，保留原始数据）'
+    return f'''/* 由tools/image_converter.py生成，请勿手工修改：{comment} */
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP != 0
+#error "{name}.c只包含RGB565数据（LV_COLOR_DEPTH = 16，LV_COLOR_16_SWAP = 0），其他色深请重新转换"
+#endif
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef {attribute}
+#define {attribute}
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST {attribute} uint8_t {name}_map[] = {{
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+{format_bytes(data)}
+#endif
+}};
+
+const lv_img_dsc_t {name} = {{
+  .header.cf = {cf},
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = {width},
+  .header.h = {height},
+  .data_size = {len(data)},
+  .data = {name}_map,
+}};
+'''
+
+
+# 生成索引图像的C文件内容（与LVGL图像转换器的输出格式一致，调色板与色深无关）
+def generate_indexed_c(name, width, height, data, image_format, quality, attribute):
+    bits = 4 if image_format == 'indexed4' else 8
+    palette_size = (1 << bits) * 4
+    return f'''/* 由tools/image_converter.py生成，请勿手工修改：{1 << bits}色调色板索引图像，与母版相比PSNR {quality:.1f} dB */
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef {attribute}
+#define {attribute}
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST {attribute} uint8_t {name}_map[] = {{
+  /*调色板（B, G, R, A）*/
+{format_bytes(data[:palette_size])}
+
+  /*像素索引*/
+{format_bytes(data[palette_size:])}
+}};
+
+const lv_img_dsc_t {name} = {{
+  .header.cf = LV_IMG_CF_INDEXED_{bits}BIT,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = {width},
+  .header.h = {height},
+  .data_size = {len(data)},
+  .data = {name}_map,
+}};
+'''
+
+
+# 转换一幅图像，返回统计信息
+# image_format为auto时：PSNR不低于min_psnr且比真彩色小的最小索引格式，否则为RLE（节省不足min_saving时为原始数据）
+def convert(input_path, output_path, name, image_format, min_saving, min_psnr, dither, write):
+    width, height, pixels = load_image(input_path)
+    raw = struct.pack('<%dH' % len(pixels), *pixels)
+    encoded = rle_encode(width, height, pixels, name)
+    if rle_decode(encoded) != pixels:
+        raise ValueError(f'{name}: 编码校验失败')
+    true_color = ('rle', encoded) if len(encoded) <= len(raw) * (1 - min_saving) else ('raw', raw)
+    candidates = {'raw': (raw, math.inf), 'rle': (encoded, math.inf)}
+    quality = {}
+    for candidate, bits in INDEXED_FORMATS:
+        if image_format not in ('auto', candidate):
+            continue
+        palette, indices = quantize(width, height, pixels, bits, dither)
+        data = indexed_encode(width, height, palette, indices, bits)
+        quality[candidate] = psnr(pixels, indexed_decode(data, width, height, bits))
+        candidates[candidate] = (data, quality[candidate])
+    if image_format == 'auto':
+        chosen = true_color[0]
+        for candidate, _ in INDEXED_FORMATS:
+            data, value = candidates[candidate]
+            if value >= min_psnr and len(data) < len(true_color[1]):
+                chosen = candidate
+                break
+    else:
+        chosen = image_format
+    data, value = candidates[chosen]
+    if write:
+        with open(output_path, 'w', encoding='utf-8') as f:
+            f.write(generate_c(name, width, height, data, chosen, value))
+    return {
+        'name': name,
+        'size': f'{width}x{height}',
+        'raw': len(raw),
+        'rle': len(encoded),
+        'psnr4': quality.get('indexed4'),
+        'psnr8': quality.get('indexed8'),
+        'format': chosen,
+        'stored': len(data),
+        'width': width,
+        'height': height,
+        'data': data,
+    }
+
+
+# 输出统计表
+def print_report(results):
+    def db(value):
+        if value is None:
+            return '-'
+        return 'inf' if math.isinf(value) else f'{value:.1f}'
+
+    print(f'{"图像":<12}{"尺寸":<10}{"原始":>9}{"RLE":>9}{"4位PSNR":>9}{"8位PSNR":>9}  {"格式":<9}{"固件占用":>9}{"节省":>8}')
+    total_raw = 0
+    total_stored = 0
+    for r in results:
+        saving = (1 - r['stored'] / r['raw']) * 100
+        print(f'{r["name"]:<12}{r["size"]:<10}{r["raw"]:>9}{r["rle"]:>9}{db(r["psnr4"]):>9}{db(r["psnr8"]):>9}  '
+              f'{r["format"]:<9}{r["stored"]:>9}{saving:>7.1f}%')
+        total_raw += r['raw']
+        total_stored += r['stored']
+    if results:
+        print(f'合计: 原始 {total_raw} 字节, 固件占用 {total_stored} 字节, 节省 {total_raw - total_stored} 字节 ({(1 - total_stored / total_raw) * 100:.1f}%)')
+
+
+# 把src/images中的无损图像导出为母版PNG
+def export_masters():
+    os.makedirs(masters_dir, exist_ok=True)
+    for path in sorted(glob.glob(os.path.join(images_dir, '*.c'))):
+        name = os.path.splitext(os.path.basename(path))[0]
+        with open(path, 'r', encoding='utf-8') as f:
+            if 'LV_IMG_CF_INDEXED_' in f.read():
+                logger.warning(f'{path}是有损的索引图像，跳过')
+                continue
+        width, height, pixels = load_c_image(path)
+        save_png(os.path.join(masters_dir, name + '.png'), width, height, pixels)
+        logger.info(f'已导出 {name}.png')
+
+
+# 批量转换的输入：优先使用母版PNG，没有母版时使用src/images中的C文件
+def collect_all():
+    jobs = []
+    names = set()
+    for path in sorted(glob.glob(os.path.join(masters_dir, '*.png'))):
+        name = os.path.splitext(os.path.basename(path))[0]
+        names.add(name)
+        jobs.append((path, os.path.join(images_dir, name + '.c'), name))
+    for path in sorted(glob.glob(os.path.join(images_dir, '*.c'))):
+        name = os.path.splitext(os.path.basename(path))[0]
+        if name not in names:
+            jobs.append((path, path, name))
+    return jobs
+
+
+def main():
+    parser = argparse.ArgumentParser(description='把背景图像转换为调色板索引或按行游程编码的LVGL图像')
+    parser.add_argument('input', nargs='?', help='输入文件（PNG或LVGL C数组）')
+    parser.add_argument('-o', '--output', help='输出的C文件')
+    parser.add_argument('--name', help='图像名称（C变量名），默认取文件名')
+    parser.add_argument('--all', action='store_true', help='转换全部图像（优先使用assets/images中的母版）')
+    parser.add_argument('--report', action='store_true', help='只输出各格式的大小和PSNR，不写文件')
+    parser.add_argument('--format', choices=('auto', 'raw', 'rle', 'indexed4', 'indexed8'), default='auto', help='输出格式')
+    parser.add_argument('--dither', action='store_true', help='索引图像使用Floyd-Steinberg抖动')
+    parser.add_argument('--min-psnr', type=float, default=DEFAULT_MIN_PSNR, help='索引图像的最低PSNR（dB），低于该值时保留真彩色')
+    parser.add_argument('--min-saving', type=float, default=DEFAULT_MIN_SAVING, help='压缩至少节省的比例，不足时保留原始数据')
+    parser.add_argument('--export-masters', action='store_true', help='把src/images中的无损图像导出为assets/images中的母版PNG')
+    args = parser.parse_args()
+
+    if args.export_masters:
+        export_masters()
+        return
+    jobs = []
+    if args.all or (args.report and not args.input):
+        jobs = collect_all()
+    elif args.input:
+        name = args.name or os.path.splitext(os.path.basename(args.input))[0]
+        output = args.output or os.path.join(images_dir, name + '.c')
+        jobs.append((args.input, output, name))
+    else:
+        parser.print_help()
+        return
+
+    results = []
+    for input_path, output_path, name in jobs:
+        try:
+            results.append(convert(input_path, output_path, name, args.format, args.min_saving,
+                                   args.min_psnr, args.dither, not args.report))
+            if not args.report:
+                logger.info(f'已生成 {output_path}')
+        except Exception as e:
+            logger.error(f'转换{input_path}时出错: {e}')
+    print_report(results)
+
+
+if __name__ == '__main__':
+    main()
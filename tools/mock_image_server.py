@@ -0,0 +1,139 @@
+"""
+每日一句接口的本地模拟服务器
+
+在电脑上模拟open.iciba.com/dsapi/接口和分享图片，用于测试固件的远程图像导入（ImageIngest），不依赖外网
+（主机测试test/host/image_ingest_test.cpp也会启动本服务器）：
+- /dsapi/ 返回与每日一句接口格式相同的JSON，fenxiang_img指向本服务器上的图片
+- /images/<名称>.png 返回assets/images中的母版PNG；poster.png为生成的大尺寸海报（默认750x1334，与真实分享图片相近）
+
+在配置文件中把每日一句接口指向本服务器：
+  "api": {"iciba": "http://<电脑的IP>:8000/dsapi/"},
+  "ingest": {"enabled": true, "compress": false}
+
+用法：
+  python tools/mock_image_server.py                         # 在8000端口提供服务，分享图片为poster.png
+  python tools/mock_image_server.py --image iciba.png       # 分享图片使用assets/images中的母版
+  python tools/mock_image_server.py --chunked --delay 0.05  # 分块传输图片，每块之间延时（模拟慢速网络）
+  python tools/mock_image_server.py --rotate                # 每次请求返回不同的图片地址（测试重新导入）
+"""
+import argparse
+import datetime
+import json
+import logging
+import os
+import struct
+import time
+import zlib
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+# 配置日志
+logging.basicConfig(level=logging.INFO, format='%(asctime)s - %(levelname)s - %(message)s')
+logger = logging.getLogger(__name__)
+
+project_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+masters_dir = os.path.join(project_dir, 'assets', 'images')
+
+# 分块传输时每块的字节数
+CHUNK_SIZE = 4096
+
+
+# 生成海报PNG（8位RGB，渐变背景加格子图案，便于检查缩放和裁剪的位置）
+def make_poster(width, height):
+    rows = bytearray()
+    for y in range(height):
+        rows.append(0)
+        for x in range(width):
+            if (x // 50 + y // 50) % 2 == 0:
+                rows += bytes((x * 255 // width, y * 255 // height, 160))
+            else:
+                rows += bytes((240, 240, 240))
+
+    def chunk(kind, body):
+        return struct.pack('>I', len(body)) + kind + body + struct.pack('>I', zlib.crc32(kind + body) & 0xFFFFFFFF)
+
+    return (b'\x89PNG\r\n\x1a\n' + chunk(b'IHDR', struct.pack('>IIBBBBB', width, height, 8, 2, 0, 0, 0)) +
+            chunk(b'IDAT', zlib.compress(bytes(rows), 6)) + chunk(b'IEND', b''))
+
+
+class MockHandler(BaseHTTPRequestHandler):
+    options = None
+    poster = b''
+    requests = 0
+
+    def send_body(self, content_type, body, chunked=False):
+        self.send_response(200)
+        self.send_header('Content-Type', content_type)
+        if chunked:
+            self.send_header('Transfer-Encoding', 'chunked')
+            self.end_headers()
+            for pos in range(0, len(body), CHUNK_SIZE):
+                part = body[pos:pos + CHUNK_SIZE]
+                self.wfile.write(b'%x\r\n' % len(part) + part + b'\r\n')
+                if self.options.delay > 0:
+                    time.sleep(self.options.delay)
+            self.wfile.write(b'0\r\n\r\n')
+        else:
+            self.send_header('Content-Length', str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+    def do_GET(self):
+        path = self.path.split('?')[0]
+        if path.rstrip('/') == '/dsapi':
+            MockHandler.requests += 1
+            host = self.headers.get('Host') or f'127.0.0.1:{self.options.port}'
+            url = f'http://{host}/images/{self.options.image}'
+            if self.options.rotate:
+                url += f'?v={MockHandler.requests}'
+            data = {
+                'sid': str(5000 + MockHandler.requests),
+                'content': 'The best way to predict the future is to create it.',
+                'note': '预测未来的最好方法就是创造未来。',
+                'dateline': datetime.date.today().isoformat(),
+                'fenxiang_img': url,
+            }
+            self.send_body('application/json; charset=utf-8', json.dumps(data, ensure_ascii=False).encode('utf-8'))
+            return
+        if path.startswith('/images/'):
+            name = os.path.basename(path)
+            if name == 'poster.png':
+                body = MockHandler.poster
+            else:
+                file_path = os.path.join(masters_dir, name)
+                if not os.path.isfile(file_path):
+                    self.send_error(404)
+                    return
+                with open(file_path, 'rb') as f:
+                    body = f.read()
+            self.send_body('image/png', body, self.options.chunked)
+            return
+        self.send_error(404)
+
+    def log_message(self, format, *args):
+        logger.info('%s %s', self.address_string(), format % args)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='模拟每日一句接口和分享图片的本地HTTP服务器')
+    parser.add_argument('--port', type=int, default=8000, help='监听端口')
+    parser.add_argument('--image', default='poster.png', help='fenxiang_img指向的图片（poster.png或assets/images中的文件）')
+    parser.add_argument('--poster-size', default='750x1334', help='生成的海报尺寸（宽x高）')
+    parser.add_argument('--chunked', action='store_true', help='图片使用分块传输（不发送Content-Length）')
+    parser.add_argument('--delay', type=float, default=0, help='分块传输时每块之间的延时（秒）')
+    parser.add_argument('--rotate', action='store_true', help='每次请求在图片地址后加上不同的参数')
+    args = parser.parse_args()
+
+    width, height = (int(v) for v in args.poster_size.lower().split('x'))
+    MockHandler.options = args
+    MockHandler.poster = make_poster(width, height)
+    logger.info(f'海报{width}x{height}，{len(MockHandler.poster)}字节')
+    server = ThreadingHTTPServer(('0.0.0.0', args.port), MockHandler)
+    logger.info(f'模拟服务器已启动: http://0.0.0.0:{args.port}/dsapi/')
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()